@@ -1,5 +1,9 @@
 using UnrealBuildTool;
+using System;
+using System.Collections.Generic;
 using System.IO;
+using System.Security.Cryptography;
+using System.Text;
 
 public class CardanoPlugin : ModuleRules
 {
@@ -21,19 +25,99 @@ public class CardanoPlugin : ModuleRules
             "JsonUtilities"
         });
 
-        PrivateDependencyModuleNames.AddRange(new string[] { });
+        PrivateDependencyModuleNames.AddRange(new string[] {
+            "HTTPServer",
+            "Sockets"
+        });
 
         string ThirdPartyPath = Path.Combine(ModuleDirectory, "../../ThirdParty");
 
+        string CardanoIncludePath = Path.Combine(ThirdPartyPath, "CardanoC", "include");
+
         if (Target.Platform == UnrealTargetPlatform.Win64)
         {
-            string CardanoIncludePath = Path.Combine(ThirdPartyPath, "CardanoC", "include");
             string CardanoLibPath = Path.Combine(ThirdPartyPath, "CardanoC", "lib", "Win64");
 
+            // Only warns for now: the committed DLL has not been rebuilt with build-win64.sh since the sources changed
+            CheckCardanoLibrary(Path.Combine(CardanoLibPath, "libcardano-c.dll"), "build-win64.sh", false);
+
             PublicIncludePaths.Add(CardanoIncludePath);
             PublicAdditionalLibraries.Add(Path.Combine(CardanoLibPath, "libcardano-c.dll.a"));
-            RuntimeDependencies.Add(Path.Combine(CardanoLibPath, "libcardano-c.dll"));
-            RuntimeDependencies.Add(Path.Combine(CardanoLibPath, "libgcc_s_seh-1.dll"));
+
+            // Copied next to the module, so the loader never picks up a DLL left in Binaries by an older build
+            RuntimeDependencies.Add("$(BinaryOutputDir)/libcardano-c.dll", Path.Combine(CardanoLibPath, "libcardano-c.dll"));
+            RuntimeDependencies.Add("$(BinaryOutputDir)/libgcc_s_seh-1.dll", Path.Combine(CardanoLibPath, "libgcc_s_seh-1.dll"));
+        }
+        else if (Target.Platform.IsInGroup(UnrealPlatformGroup.Linux))
+        {
+            // Linked statically, libsodium included, so dedicated servers ship no extra shared library.
+            // Target.Architecture is the toolchain triple: x86_64-unknown-linux-gnu or aarch64-unknown-linux-gnueabi
+            string CardanoLibrary = Path.Combine(ThirdPartyPath, "CardanoC", "lib", "Linux", Target.Architecture, "libcardano-c.a");
+
+            CheckCardanoLibrary(CardanoLibrary, "build-linux.sh", true);
+
+            PublicIncludePaths.Add(CardanoIncludePath);
+            PublicAdditionalLibraries.Add(CardanoLibrary);
+        }
+    }
+
+    /**
+     * Fails the build if Library is missing, or was built from other cardano-c sources than the ones in the tree, since
+     * the plugin would then call functions it lacks or use structures laid out differently. With bFatal false, the
+     * second case only warns.
+     */
+    private void CheckCardanoLibrary(string Library, string BuildScript, bool bFatal)
+    {
+        string CardanoPath = Path.GetFullPath(Path.Combine(ModuleDirectory, "../../ThirdParty/CardanoC"));
+
+        if (!File.Exists(Library))
+        {
+            throw new BuildException("Missing {0}; build it with ThirdParty/CardanoC/{1}", Library, BuildScript);
+        }
+
+        string SourcesFile = Path.Combine(Path.GetDirectoryName(Library), "libcardano-c.sources");
+        string BuiltFrom = File.Exists(SourcesFile) ? File.ReadAllText(SourcesFile).Trim() : "";
+
+        if (BuiltFrom != GetCardanoSourcesHash(CardanoPath))
+        {
+            string Message = String.Format("{0} was built from other cardano-c sources; rebuild it with ThirdParty/CardanoC/{1}", Library, BuildScript);
+            if (bFatal)
+            {
+                throw new BuildException(Message);
+            }
+            Console.WriteLine("Warning: {0}", Message);
+        }
+    }
+
+    /** The hash ThirdParty/CardanoC/sources-hash.sh prints; see there for what it covers. */
+    private static string GetCardanoSourcesHash(string CardanoPath)
+    {
+        List<string> Sources = new List<string>();
+        foreach (string Folder in new string[] { "src", "include", "external" })
+        {
+            foreach (string Source in Directory.EnumerateFiles(Path.Combine(CardanoPath, Folder), "*", SearchOption.AllDirectories))
+            {
+                if (Source.EndsWith(".c", StringComparison.Ordinal) || Source.EndsWith(".h", StringComparison.Ordinal))
+                {
+                    Sources.Add(Source.Substring(CardanoPath.Length + 1).Replace('\\', '/'));
+                }
+            }
+        }
+        Sources.Sort(StringComparer.Ordinal);
+
+        using (SHA256 Hash = SHA256.Create())
+        {
+            foreach (string Source in Sources)
+            {
+                byte[] Name = Encoding.UTF8.GetBytes(Source + "\n");
+                Hash.TransformBlock(Name, 0, Name.Length, null, 0);
+
+                byte[] Content = Array.FindAll(File.ReadAllBytes(Path.Combine(CardanoPath, Source)), Byte => Byte != (byte)'\r');
+                Hash.TransformBlock(Content, 0, Content.Length, null, 0);
+            }
+            Hash.TransformFinalBlock(new byte[0], 0, 0);
+
+            return BitConverter.ToString(Hash.Hash).Replace("-", "").ToLowerInvariant();
         }
     }
 }
@@ -0,0 +1,225 @@
+#include "CardanoAddressSubscriptions.h"
+#include "CardanoChainFollower.h"
+#include "CardanoLog.h"
+#include "CardanoUTxOCache.h"
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+
+UCardanoAddressSubscriptions* UCardanoAddressSubscriptions::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoAddressSubscriptions>() : nullptr;
+}
+
+void UCardanoAddressSubscriptions::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Collection.InitializeDependency(UCardanoUTxOCache::StaticClass());
+    Collection.InitializeDependency(UCardanoChainFollower::StaticClass());
+
+    if (UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get())
+    {
+        UTxOsChangedHandle = Cache->OnUTxOsChanged().AddUObject(this, &UCardanoAddressSubscriptions::OnUTxOsChanged);
+    }
+}
+
+void UCardanoAddressSubscriptions::Deinitialize()
+{
+    if (UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get())
+    {
+        Cache->OnUTxOsChanged().Remove(UTxOsChangedHandle);
+    }
+
+    Addresses.Reset();
+    SubscriptionAddresses.Reset();
+    Super::Deinitialize();
+}
+
+int32 UCardanoAddressSubscriptions::Subscribe(const FString& Address, const FOnCardanoAddressUpdate& OnUpdate)
+{
+    const int32 SubscriptionId = NextSubscriptionId++;
+    SubscriptionAddresses.Add(SubscriptionId, Address);
+
+    bool bNewAddress = false;
+    FAddressSubscribers* Entry = Addresses.Find(Address);
+    if (!Entry)
+    {
+        bNewAddress = true;
+        Entry = &Addresses.Add(Address);
+    }
+    Entry->Delegates.Add(SubscriptionId, OnUpdate);
+
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (bNewAddress && Cache && !Cache->IsWatched(Address))
+    {
+        Entry->bOwnsWatch = true;
+        Cache->WatchAddress(Address);
+
+        // A running follower downloads newly watched addresses on its next poll
+        UCardanoChainFollower* Follower = UCardanoChainFollower::Get();
+        if (Follower && !Follower->IsFollowing() && bStartChainFollower)
+        {
+            Follower->Start();
+        }
+        else if (!Follower || !Follower->IsFollowing())
+        {
+            Cache->RefreshAll(FOnUTxOCacheRefreshed());
+        }
+    }
+
+    // Deferred so the subscriber hears of the address only once it has the id; if the cache has not downloaded
+    // the address yet, the first change it reports delivers it instead
+    Entry->Joining.Add(SubscriptionId);
+    TWeakObjectPtr<UCardanoAddressSubscriptions> WeakThis(this);
+    AsyncTask(ENamedThreads::GameThread, [WeakThis, Address]()
+        {
+            if (UCardanoAddressSubscriptions* This = WeakThis.Get())
+            {
+                This->Deliver(Address);
+            }
+        });
+
+    return SubscriptionId;
+}
+
+void UCardanoAddressSubscriptions::Unsubscribe(int32 SubscriptionId)
+{
+    FString Address;
+    if (!SubscriptionAddresses.RemoveAndCopyValue(SubscriptionId, Address))
+    {
+        return;
+    }
+
+    FAddressSubscribers* Entry = Addresses.Find(Address);
+    if (!Entry)
+    {
+        return;
+    }
+
+    Entry->Delegates.Remove(SubscriptionId);
+    Entry->Joining.Remove(SubscriptionId);
+    if (Entry->Delegates.Num() > 0)
+    {
+        return;
+    }
+
+    const bool bOwnsWatch = Entry->bOwnsWatch;
+    Addresses.Remove(Address);
+
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (bOwnsWatch && Cache)
+    {
+        Cache->UnwatchAddress(Address);
+    }
+}
+
+void UCardanoAddressSubscriptions::OnUTxOsChanged(const TSet<FString>& ChangedAddresses)
+{
+    // Usually a handful of addresses out of many, so the smaller set is walked
+    if (ChangedAddresses.Num() <= Addresses.Num())
+    {
+        for (const FString& Address : ChangedAddresses)
+        {
+            if (Addresses.Contains(Address))
+            {
+                Deliver(Address);
+            }
+        }
+        return;
+    }
+
+    TArray<FString> Subscribed;
+    Addresses.GenerateKeyArray(Subscribed);
+    for (const FString& Address : Subscribed)
+    {
+        if (ChangedAddresses.Contains(Address))
+        {
+            Deliver(Address);
+        }
+    }
+}
+
+void UCardanoAddressSubscriptions::Deliver(const FString& Address)
+{
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    FAddressSubscribers* Entry = Addresses.Find(Address);
+    TArray<FUTxO> Current;
+    if (!Cache || !Entry || !Cache->GetCachedUTxOs(Address, Current))
+    {
+        return;
+    }
+
+    TMap<FCardanoUTxORef, FUTxO> CurrentByRef;
+    CurrentByRef.Reserve(Current.Num());
+    TArray<FUTxO> Added;
+    for (FUTxO& UTxO : Current)
+    {
+        FCardanoUTxORef Ref;
+        Ref.TxIndex = static_cast<uint32>(UTxO.TxIndex);
+        if (!FCardanoHash32::FromHex(UTxO.TxHash, Ref.TxHash))
+        {
+            continue;
+        }
+
+        if (!Entry->Delivered.Contains(Ref))
+        {
+            Added.Add(UTxO);
+        }
+        CurrentByRef.Add(Ref, MoveTemp(UTxO));
+    }
+
+    TArray<FUTxO> Spent;
+    for (const TPair<FCardanoUTxORef, FUTxO>& Previous : Entry->Delivered)
+    {
+        if (!CurrentByRef.Contains(Previous.Key))
+        {
+            Spent.Add(Previous.Value);
+        }
+    }
+
+    const bool bChanged = !Entry->bDelivered || Added.Num() > 0 || Spent.Num() > 0;
+    if (!bChanged && Entry->Joining.Num() == 0)
+    {
+        return;
+    }
+
+    if (bChanged)
+    {
+        Entry->Delivered = MoveTemp(CurrentByRef);
+        Entry->bDelivered = true;
+        UE_LOG(LogCardano, Verbose, TEXT("Subscriptions: %s gained %d UTxOs and spent %d"), *Address, Added.Num(), Spent.Num());
+    }
+
+    FAddressBalance Balance;
+    Cache->GetCachedBalance(Address, Balance);
+
+    TArray<FUTxO> Everything;
+    const TSet<int32> Joining = MoveTemp(Entry->Joining);
+    Entry->Joining.Reset();
+    if (Joining.Num() > 0)
+    {
+        Entry->Delivered.GenerateValueArray(Everything);
+    }
+
+    // Copied, since a subscriber may unsubscribe itself or others from its handler
+    const TArray<TPair<int32, FOnCardanoAddressUpdate>> Delegates = Entry->Delegates.Array();
+    for (const TPair<int32, FOnCardanoAddressUpdate>& Delegate : Delegates)
+    {
+        if (!SubscriptionAddresses.Contains(Delegate.Key))
+        {
+            continue;
+        }
+
+        if (!Delegate.Value.IsBound())
+        {
+            Unsubscribe(Delegate.Key);
+        }
+        else if (Joining.Contains(Delegate.Key))
+        {
+            Delegate.Value.Execute(Address, Balance, Everything, TArray<FUTxO>());
+        }
+        else if (bChanged)
+        {
+            Delegate.Value.Execute(Address, Balance, Added, Spent);
+        }
+    }
+}
@@ -0,0 +1,813 @@
+#include "CardanoAssetMetadataCache.h"
+#include "CardanoFrameScheduler.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoLog.h"
+#include "Engine/Engine.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "HAL/FileManager.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "JsonObjectConverter.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+/** Hex length of a policy id, a Blake2b-224 hash. */
+static const int32 POLICY_ID_HEX_LENGTH = 56;
+
+/** CIP-67 labels of asset names, hex encoded. */
+static const TCHAR* CIP68_REFERENCE_LABEL = TEXT("000643b0");
+static const TCHAR* CIP68_NFT_LABEL = TEXT("000de140");
+static const TCHAR* CIP68_FT_LABEL = TEXT("0014df10");
+static const int32 CIP67_LABEL_HEX_LENGTH = 8;
+
+struct UCardanoAssetMetadataCache::FMetadataRequest
+{
+    TArray<FString> AssetIds;
+    FOnAssetMetadataResult OnComplete;
+    int32 PendingAssets = 0;
+    FString FirstError;
+};
+
+/** The reference token holding the datum of a CIP-68 user or fungible token, or an empty string for other assets. */
+static FString GetReferenceAssetId(const FString& AssetId)
+{
+    const FString AssetName = AssetId.Mid(POLICY_ID_HEX_LENGTH);
+    if (!AssetName.StartsWith(CIP68_NFT_LABEL) && !AssetName.StartsWith(CIP68_FT_LABEL))
+    {
+        return FString();
+    }
+    return AssetId.Left(POLICY_ID_HEX_LENGTH) + CIP68_REFERENCE_LABEL + AssetName.Mid(CIP67_LABEL_HEX_LENGTH);
+}
+
+static FString MakeAssetInfoBody(const TArray<FString>& AssetIds)
+{
+    FString RequestBody;
+    RequestBody.Reserve(UCardanoKoiosClient::EstimateStringListBodyLength(AssetIds, 32));
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBody);
+
+    Writer->WriteObjectStart();
+    Writer->WriteArrayStart(TEXT("_asset_list"));
+    for (const FString& AssetId : AssetIds)
+    {
+        Writer->WriteArrayStart();
+        Writer->WriteValue(AssetId.Left(POLICY_ID_HEX_LENGTH));
+        Writer->WriteValue(AssetId.Mid(POLICY_ID_HEX_LENGTH));
+        Writer->WriteArrayEnd();
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return RequestBody;
+}
+
+/** Deserializes a Koios array response, returning an error message on failure. */
+static FString ReadJsonArray(const FHttpResponsePtr& Response, bool Success, TArray<TSharedPtr<FJsonValue>>& OutArray)
+{
+    if (!Success || !Response.IsValid())
+    {
+        return TEXT("Network request failed");
+    }
+    if (Response->GetResponseCode() != 200)
+    {
+        return FString::Printf(TEXT("Koios returned HTTP %d"), Response->GetResponseCode());
+    }
+    if (!ParseJsonArray(Response, OutArray))
+    {
+        return TEXT("Invalid response format");
+    }
+    return TEXT("");
+}
+
+static FString HexToUtf8(const FString& Hex)
+{
+    if (Hex.Len() % 2 != 0)
+    {
+        return FString();
+    }
+
+    TArray<uint8> Bytes;
+    Bytes.SetNumUninitialized(Hex.Len() / 2);
+    if (HexToBytes(Hex, Bytes.GetData()) != Bytes.Num())
+    {
+        return FString();
+    }
+
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+    return FString(Converted.Length(), Converted.Get());
+}
+
+/** True if Text is worth showing as a name: non-empty and free of control characters. */
+static bool IsPrintable(const FString& Text)
+{
+    if (Text.IsEmpty())
+    {
+        return false;
+    }
+    for (const TCHAR Char : Text)
+    {
+        if (Char < 0x20 || Char == 0x7f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** CIP-25 splits strings longer than 64 bytes into arrays of chunks. */
+static FString ReadChunkedString(const FJsonObject& Object, const FString& Field)
+{
+    FString Value;
+    if (Object.TryGetStringField(Field, Value))
+    {
+        return Value;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Chunks = nullptr;
+    if (Object.TryGetArrayField(Field, Chunks) && Chunks)
+    {
+        for (const TSharedPtr<FJsonValue>& Chunk : *Chunks)
+        {
+            FString Part;
+            if (Chunk.IsValid() && Chunk->TryGetString(Part))
+            {
+                Value += Part;
+            }
+        }
+    }
+    return Value;
+}
+
+/** Reads the label 721 metadata of the minting transaction; version 1 keys assets by UTF-8 name, version 2 by hex. */
+static bool ParseCip25(const FJsonObject& Row, const FString& PolicyId, const FString& AssetName, FCardanoAssetMetadata& OutMetadata)
+{
+    const TSharedPtr<FJsonObject>* MintMetadata = nullptr;
+    const TSharedPtr<FJsonObject>* Label = nullptr;
+    const TSharedPtr<FJsonObject>* Policy = nullptr;
+    if (!Row.TryGetObjectField("minting_tx_metadata", MintMetadata) || !MintMetadata
+        || !(*MintMetadata)->TryGetObjectField("721", Label) || !Label
+        || !(*Label)->TryGetObjectField(PolicyId, Policy) || !Policy)
+    {
+        return false;
+    }
+
+    const TSharedPtr<FJsonObject>* Asset = nullptr;
+    if (!(*Policy)->TryGetObjectField(HexToUtf8(AssetName), Asset) && !(*Policy)->TryGetObjectField(AssetName, Asset))
+    {
+        return false;
+    }
+
+    OutMetadata.Standard = ECardanoAssetMetadataStandard::Cip25;
+    OutMetadata.DisplayName = ReadChunkedString(**Asset, TEXT("name"));
+    OutMetadata.Description = ReadChunkedString(**Asset, TEXT("description"));
+    OutMetadata.Image = ReadChunkedString(**Asset, TEXT("image"));
+    OutMetadata.MediaType = ReadChunkedString(**Asset, TEXT("mediaType"));
+    return true;
+}
+
+/** Reads a plutus data value as text: bytes as UTF-8, lists of bytes concatenated, integers in decimal. */
+static FString ReadDatumString(const TSharedPtr<FJsonValue>& Value)
+{
+    const TSharedPtr<FJsonObject>* Object = nullptr;
+    if (!Value.IsValid() || !Value->TryGetObject(Object) || !Object)
+    {
+        return FString();
+    }
+
+    FString Bytes;
+    if ((*Object)->TryGetStringField("bytes", Bytes))
+    {
+        return HexToUtf8(Bytes);
+    }
+
+    int64 Int = 0;
+    if ((*Object)->TryGetNumberField("int", Int))
+    {
+        return FString::Printf(TEXT("%lld"), Int);
+    }
+
+    FString Text;
+    const TArray<TSharedPtr<FJsonValue>>* List = nullptr;
+    if ((*Object)->TryGetArrayField("list", List) && List)
+    {
+        for (const TSharedPtr<FJsonValue>& Item : *List)
+        {
+            Text += ReadDatumString(Item);
+        }
+    }
+    return Text;
+}
+
+/** Reads the metadata map, the first field of a CIP-68 reference datum, in its detailed JSON schema. */
+static bool ParseCip68(const FJsonObject& ReferenceRow, FCardanoAssetMetadata& OutMetadata)
+{
+    const TSharedPtr<FJsonObject>* Cip68 = nullptr;
+    if (!ReferenceRow.TryGetObjectField("cip68_metadata", Cip68) || !Cip68)
+    {
+        return false;
+    }
+
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Label : (*Cip68)->Values)
+    {
+        const TSharedPtr<FJsonObject>* Datum = nullptr;
+        const TArray<TSharedPtr<FJsonValue>>* Fields = nullptr;
+        const TSharedPtr<FJsonObject>* MapObject = nullptr;
+        const TArray<TSharedPtr<FJsonValue>>* Map = nullptr;
+        if (!Label.Value.IsValid() || !Label.Value->TryGetObject(Datum) || !Datum
+            || !(*Datum)->TryGetArrayField("fields", Fields) || !Fields || Fields->Num() == 0
+            || !(*Fields)[0]->TryGetObject(MapObject) || !MapObject
+            || !(*MapObject)->TryGetArrayField("map", Map) || !Map)
+        {
+            continue;
+        }
+
+        for (const TSharedPtr<FJsonValue>& Entry : *Map)
+        {
+            const TSharedPtr<FJsonObject>* Pair = nullptr;
+            if (!Entry.IsValid() || !Entry->TryGetObject(Pair) || !Pair)
+            {
+                continue;
+            }
+
+            const FString Key = ReadDatumString((*Pair)->TryGetField(TEXT("k")));
+            const FString Value = ReadDatumString((*Pair)->TryGetField(TEXT("v")));
+            if (Key == TEXT("name"))
+            {
+                OutMetadata.DisplayName = Value;
+            }
+            else if (Key == TEXT("description"))
+            {
+                OutMetadata.Description = Value;
+            }
+            else if (Key == TEXT("image") || Key == TEXT("logo"))
+            {
+                OutMetadata.Image = OutMetadata.Image.IsEmpty() ? Value : OutMetadata.Image;
+            }
+            else if (Key == TEXT("mediaType"))
+            {
+                OutMetadata.MediaType = Value;
+            }
+            else if (Key == TEXT("ticker"))
+            {
+                OutMetadata.Ticker = Value;
+            }
+            else if (Key == TEXT("decimals"))
+            {
+                OutMetadata.Decimals = FCString::Atoi(*Value);
+            }
+        }
+
+        OutMetadata.Standard = ECardanoAssetMetadataStandard::Cip68;
+        return true;
+    }
+
+    return false;
+}
+
+/** Fills what the other standards left empty from the token registry, the usual source of fungible token tickers. */
+static void ParseRegistry(const FJsonObject& Row, FCardanoAssetMetadata& OutMetadata)
+{
+    const TSharedPtr<FJsonObject>* Registry = nullptr;
+    if (!Row.TryGetObjectField("token_registry_metadata", Registry) || !Registry)
+    {
+        return;
+    }
+
+    if (OutMetadata.Standard == ECardanoAssetMetadataStandard::None)
+    {
+        OutMetadata.Standard = ECardanoAssetMetadataStandard::Registry;
+        (*Registry)->TryGetStringField("name", OutMetadata.DisplayName);
+        (*Registry)->TryGetStringField("description", OutMetadata.Description);
+        (*Registry)->TryGetNumberField("decimals", OutMetadata.Decimals);
+    }
+    if (OutMetadata.Ticker.IsEmpty())
+    {
+        (*Registry)->TryGetStringField("ticker", OutMetadata.Ticker);
+    }
+
+    FString Logo;
+    if (OutMetadata.Image.IsEmpty() && (*Registry)->TryGetStringField("logo", Logo) && !Logo.IsEmpty())
+    {
+        OutMetadata.Image = TEXT("data:image/png;base64,") + Logo;
+        OutMetadata.MediaType = TEXT("image/png");
+    }
+}
+
+static FCardanoAssetMetadata ParseMetadata(const FString& AssetId, const FJsonObject& Row, const FJsonObject* ReferenceRow, int64 Now)
+{
+    FCardanoAssetMetadata Result;
+    Result.AssetId = AssetId;
+    Result.PolicyId = AssetId.Left(POLICY_ID_HEX_LENGTH);
+    Result.AssetName = AssetId.Mid(POLICY_ID_HEX_LENGTH);
+    Result.FetchedAt = Now;
+    Row.TryGetStringField("fingerprint", Result.Fingerprint);
+
+    if (!(ReferenceRow && ParseCip68(*ReferenceRow, Result)) && !ParseCip68(Row, Result))
+    {
+        ParseCip25(Row, Result.PolicyId, Result.AssetName, Result);
+    }
+    ParseRegistry(Row, Result);
+
+    if (Result.DisplayName.IsEmpty())
+    {
+        // CIP-67 labels are not part of what users call the token
+        const int32 LabelLength = GetReferenceAssetId(AssetId).IsEmpty() ? 0 : CIP67_LABEL_HEX_LENGTH;
+        const FString Name = HexToUtf8(Result.AssetName.Mid(LabelLength));
+        Result.DisplayName = IsPrintable(Name) ? Name : Result.Fingerprint;
+    }
+
+    return Result;
+}
+
+UCardanoAssetMetadataCache* UCardanoAssetMetadataCache::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoAssetMetadataCache>() : nullptr;
+}
+
+void UCardanoAssetMetadataCache::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Collection.InitializeDependency(UCardanoKoiosClient::StaticClass());
+
+    LoadFromDisk();
+}
+
+void UCardanoAssetMetadataCache::Deinitialize()
+{
+    if (SaveHandle.IsValid())
+    {
+        FTicker::GetCoreTicker().RemoveTicker(SaveHandle);
+        SaveToDisk(0.0f);
+    }
+
+    Super::Deinitialize();
+}
+
+FString UCardanoAssetMetadataCache::MakeAssetId(const FString& PolicyId, const FString& AssetName)
+{
+    return (PolicyId + AssetName).ToLower();
+}
+
+void UCardanoAssetMetadataCache::GetMetadata(const TArray<FTokenBalance>& Assets, const FOnAssetMetadataResult& OnComplete)
+{
+    TSharedRef<FMetadataRequest> Request = MakeShared<FMetadataRequest>();
+    Request->OnComplete = OnComplete;
+    Request->AssetIds.Reserve(Assets.Num());
+
+    const int64 Now = FDateTime::UtcNow().ToUnixTimestamp();
+    TArray<FString> ToFetch;
+    TSet<FString> Seen;
+    for (const FTokenBalance& Asset : Assets)
+    {
+        const FString AssetId = MakeAssetId(Asset.PolicyId, Asset.AssetName);
+        Request->AssetIds.Add(AssetId);
+
+        bool bAlreadySeen = false;
+        Seen.Add(AssetId, &bAlreadySeen);
+        if (bAlreadySeen)
+        {
+            continue;
+        }
+
+        const FCardanoAssetMetadata* Entry = Cached.Find(AssetId);
+        if (Entry && IsFresh(*Entry, Now))
+        {
+            continue;
+        }
+
+        ++Request->PendingAssets;
+        if (TArray<TSharedRef<FMetadataRequest>>* Waiting = InFlight.Find(AssetId))
+        {
+            Waiting->Add(Request);
+            continue;
+        }
+
+        InFlight.Add(AssetId).Add(Request);
+        ToFetch.Add(AssetId);
+    }
+
+    if (Request->PendingAssets == 0)
+    {
+        FinishRequest(*Request);
+        return;
+    }
+
+    // Each CIP-68 asset may take a second row for its reference token
+    const int32 ChunkSize = FMath::Max(UCardanoKoiosClient::Get()->GetMaxAddressesPerRequest() / 2, 1);
+    for (const TArray<FString>& Chunk : ChunkAddresses(ToFetch, ChunkSize))
+    {
+        FetchBatch(Chunk);
+    }
+}
+
+bool UCardanoAssetMetadataCache::FindMetadata(const FString& PolicyId, const FString& AssetName, FCardanoAssetMetadata& OutMetadata) const
+{
+    const FCardanoAssetMetadata* Entry = Cached.Find(MakeAssetId(PolicyId, AssetName));
+    if (!Entry)
+    {
+        return false;
+    }
+
+    OutMetadata = *Entry;
+    return true;
+}
+
+bool UCardanoAssetMetadataCache::IsFresh(const FCardanoAssetMetadata& Entry, int64 Now) const
+{
+    if (Entry.Standard == ECardanoAssetMetadataStandard::Cip25 || Entry.Standard == ECardanoAssetMetadataStandard::Registry)
+    {
+        return true;
+    }
+
+    // Reference datums can be replaced, and an asset without metadata may get some
+    return Now - Entry.FetchedAt < static_cast<int64>(MaxAgeHours) * 3600;
+}
+
+void UCardanoAssetMetadataCache::FetchBatch(const TArray<FString>& AssetIds)
+{
+    TArray<FString> Requested = AssetIds;
+    for (const FString& AssetId : AssetIds)
+    {
+        const FString ReferenceId = GetReferenceAssetId(AssetId);
+        if (!ReferenceId.IsEmpty())
+        {
+            Requested.AddUnique(ReferenceId);
+        }
+    }
+
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateJsonPost(TEXT("asset_info"), MakeAssetInfoBody(Requested));
+
+    TWeakObjectPtr<UCardanoAssetMetadataCache> WeakThis(this);
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, AssetIds](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            const FString Error = ReadJsonArray(Response, Success, JsonArray);
+
+            TSharedRef<TMap<FString, TSharedPtr<FJsonObject>>> Rows = MakeShared<TMap<FString, TSharedPtr<FJsonObject>>>();
+            for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+            {
+                TSharedPtr<FJsonObject> Row = Item->AsObject();
+                FString PolicyId;
+                FString AssetName;
+                if (Row.IsValid() && Row->TryGetStringField("policy_id", PolicyId) && Row->TryGetStringField("asset_name", AssetName))
+                {
+                    Rows->Add(MakeAssetId(PolicyId, AssetName), Row);
+                }
+            }
+
+            // Metadata of large collections is parsed over a few frames on clients rather than in one hitch
+            const int64 Now = FDateTime::UtcNow().ToUnixTimestamp();
+            FCardanoFrameScheduler::Get().ForEach(ECardanoWorkPriority::Normal, AssetIds.Num(),
+                [WeakThis, AssetIds, Rows, Error, Now](int32 Index)
+                {
+                    if (!WeakThis.IsValid())
+                    {
+                        return;
+                    }
+
+                    const FString& AssetId = AssetIds[Index];
+                    const TSharedPtr<FJsonObject>* Row = Rows->Find(AssetId);
+                    if (!Error.IsEmpty() || !Row)
+                    {
+                        WeakThis->CompleteAsset(AssetId, Error.IsEmpty() ? FString::Printf(TEXT("Asset %s not found"), *AssetId) : Error);
+                        return;
+                    }
+
+                    const TSharedPtr<FJsonObject>* ReferenceRow = Rows->Find(GetReferenceAssetId(AssetId));
+                    WeakThis->Cached.Add(AssetId, ParseMetadata(AssetId, **Row, ReferenceRow ? ReferenceRow->Get() : nullptr, Now));
+                    WeakThis->CompleteAsset(AssetId, TEXT(""));
+                },
+                [WeakThis, bSave = Error.IsEmpty()]()
+                {
+                    if (bSave && WeakThis.IsValid())
+                    {
+                        WeakThis->ScheduleSave();
+                    }
+                });
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::History);
+}
+
+void UCardanoAssetMetadataCache::CompleteAsset(const FString& AssetId, const FString& ErrorMessage)
+{
+    TArray<TSharedRef<FMetadataRequest>> Waiting;
+    if (!InFlight.RemoveAndCopyValue(AssetId, Waiting))
+    {
+        return;
+    }
+
+    for (const TSharedRef<FMetadataRequest>& Request : Waiting)
+    {
+        if (!ErrorMessage.IsEmpty() && Request->FirstError.IsEmpty())
+        {
+            Request->FirstError = ErrorMessage;
+        }
+        if (--Request->PendingAssets == 0)
+        {
+            FinishRequest(*Request);
+        }
+    }
+}
+
+void UCardanoAssetMetadataCache::FinishRequest(const FMetadataRequest& Request)
+{
+    TArray<FCardanoAssetMetadata> Result;
+    Result.Reserve(Request.AssetIds.Num());
+    for (const FString& AssetId : Request.AssetIds)
+    {
+        if (const FCardanoAssetMetadata* Entry = Cached.Find(AssetId))
+        {
+            Result.Add(*Entry);
+        }
+    }
+
+    Request.OnComplete.ExecuteIfBound(Request.FirstError.IsEmpty(), Result, Request.FirstError);
+}
+
+void UCardanoAssetMetadataCache::GetImage(const FString& PolicyId, const FString& AssetName, const FOnAssetImageResult& OnComplete)
+{
+    TWeakObjectPtr<UCardanoAssetMetadataCache> WeakThis(this);
+    auto WithMetadata = [WeakThis, OnComplete](const FCardanoAssetMetadata& Entry)
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+            if (Entry.Image.IsEmpty())
+            {
+                OnComplete.ExecuteIfBound(false, TArray<uint8>(), FString::Printf(TEXT("Asset %s has no image"), *Entry.AssetId));
+                return;
+            }
+
+            // Small images, token registry logos especially, are embedded in the metadata
+            if (Entry.Image.StartsWith(TEXT("data:")))
+            {
+                FString Header;
+                FString Data;
+                TArray<uint8> Bytes;
+                if (!Entry.Image.Split(TEXT(","), &Header, &Data)
+                    || (Header.EndsWith(TEXT(";base64")) && !FBase64::Decode(Data, Bytes)))
+                {
+                    OnComplete.ExecuteIfBound(false, TArray<uint8>(), TEXT("Malformed data URI"));
+                    return;
+                }
+                if (!Header.EndsWith(TEXT(";base64")))
+                {
+                    const FTCHARToUTF8 Text(*FGenericPlatformHttp::UrlDecode(Data));
+                    Bytes.Append(reinterpret_cast<const uint8*>(Text.Get()), Text.Length());
+                }
+                OnComplete.ExecuteIfBound(true, Bytes, FString());
+                return;
+            }
+
+            WeakThis->RequestImage(WeakThis->ResolveImageUrl(Entry.Image), OnComplete);
+        };
+
+    FCardanoAssetMetadata Entry;
+    if (FindMetadata(PolicyId, AssetName, Entry))
+    {
+        WithMetadata(Entry);
+        return;
+    }
+
+    FTokenBalance Asset;
+    Asset.PolicyId = PolicyId;
+    Asset.AssetName = AssetName;
+
+    FOnAssetMetadataResult OnMetadata;
+    OnMetadata.BindLambda([WithMetadata, OnComplete](bool bSuccess, const TArray<FCardanoAssetMetadata>& Metadata, const FString& ErrorMessage)
+        {
+            if (!bSuccess || Metadata.Num() == 0)
+            {
+                OnComplete.ExecuteIfBound(false, TArray<uint8>(), ErrorMessage);
+                return;
+            }
+            WithMetadata(Metadata[0]);
+        });
+    GetMetadata({ Asset }, OnMetadata);
+}
+
+FString UCardanoAssetMetadataCache::ResolveImageUrl(const FString& Image) const
+{
+    if (!Image.StartsWith(TEXT("ipfs://")))
+    {
+        return Image;
+    }
+
+    // Both ipfs://<cid> and the older ipfs://ipfs/<cid> are in use
+    FString Path = Image.Mid(7);
+    Path.RemoveFromStart(TEXT("ipfs/"));
+    return IpfsGatewayUrl.EndsWith(TEXT("/")) ? IpfsGatewayUrl + Path : IpfsGatewayUrl / Path;
+}
+
+void UCardanoAssetMetadataCache::Clear()
+{
+    Cached.Reset();
+    Images.Reset();
+    ImageOrder.Empty();
+    ImageCacheBytes = 0;
+
+    if (SaveHandle.IsValid())
+    {
+        FTicker::GetCoreTicker().RemoveTicker(SaveHandle);
+        SaveHandle.Reset();
+    }
+    IFileManager::Get().Delete(*GetCacheFilePath(), false, false, true);
+}
+
+void UCardanoAssetMetadataCache::RequestImage(const FString& Url, const FOnAssetImageResult& OnComplete)
+{
+    if (const TArray<uint8>* Bytes = FindImage(Url))
+    {
+        OnComplete.ExecuteIfBound(true, *Bytes, FString());
+        return;
+    }
+
+    if (FImageDownload* Download = ImageDownloads.Find(Url))
+    {
+        Download->Callbacks.Add(OnComplete);
+        return;
+    }
+
+    FImageDownload& Download = ImageDownloads.Add(Url);
+    Download.Url = Url;
+    Download.Callbacks.Add(OnComplete);
+    QueuedImageUrls.Add(Url);
+    StartImageDownloads();
+}
+
+void UCardanoAssetMetadataCache::StartImageDownloads()
+{
+    while (ActiveImageDownloads < FMath::Max(MaxConcurrentImageDownloads, 1) && QueuedImageUrls.Num() > 0)
+    {
+        const FString Url = QueuedImageUrls[0];
+        QueuedImageUrls.RemoveAt(0);
+
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+        HttpRequest->SetVerb(TEXT("GET"));
+        HttpRequest->SetURL(Url);
+
+        TWeakObjectPtr<UCardanoAssetMetadataCache> WeakThis(this);
+        HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Url](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+            {
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->OnImageDownloaded(Url, Response, Success);
+                }
+            });
+
+        ++ActiveImageDownloads;
+        if (!HttpRequest->ProcessRequest())
+        {
+            OnImageDownloaded(Url, nullptr, false);
+        }
+    }
+}
+
+void UCardanoAssetMetadataCache::OnImageDownloaded(const FString& Url, FHttpResponsePtr Response, bool Success)
+{
+    --ActiveImageDownloads;
+
+    FString Error;
+    TArray<uint8> Bytes;
+    if (!Success || !Response.IsValid())
+    {
+        Error = TEXT("Network request failed");
+    }
+    else if (!EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+    {
+        Error = FString::Printf(TEXT("Image host returned HTTP %d"), Response->GetResponseCode());
+    }
+    else if (Response->GetContent().Num() > MaxImageBytes)
+    {
+        Error = FString::Printf(TEXT("Image of %d bytes is larger than MaxImageBytes"), Response->GetContent().Num());
+    }
+    else
+    {
+        Bytes = Response->GetContent();
+    }
+
+    FImageDownload Download;
+    ImageDownloads.RemoveAndCopyValue(Url, Download);
+
+    if (Error.IsEmpty())
+    {
+        AddImage(Url, CopyTemp(Bytes));
+    }
+    else
+    {
+        UE_LOG(LogCardano, Verbose, TEXT("Failed to download %s: %s"), *Url, *Error);
+    }
+
+    for (const FOnAssetImageResult& Callback : Download.Callbacks)
+    {
+        Callback.ExecuteIfBound(Error.IsEmpty(), Bytes, Error);
+    }
+
+    StartImageDownloads();
+}
+
+const TArray<uint8>* UCardanoAssetMetadataCache::FindImage(const FString& Url)
+{
+    FCachedImage* Image = Images.Find(Url);
+    if (!Image)
+    {
+        return nullptr;
+    }
+
+    ImageOrder.RemoveNode(Image->Node, false);
+    ImageOrder.AddHead(Image->Node);
+    return &Image->Bytes;
+}
+
+void UCardanoAssetMetadataCache::AddImage(const FString& Url, TArray<uint8>&& Bytes)
+{
+    if (Bytes.Num() > MaxImageCacheBytes || Images.Contains(Url))
+    {
+        return;
+    }
+
+    ImageCacheBytes += Bytes.Num();
+    ImageOrder.AddHead(Url);
+
+    FCachedImage& Image = Images.Add(Url);
+    Image.Bytes = MoveTemp(Bytes);
+    Image.Node = ImageOrder.GetHead();
+
+    while (ImageCacheBytes > MaxImageCacheBytes)
+    {
+        TDoubleLinkedList<FString>::TDoubleLinkedListNode* Oldest = ImageOrder.GetTail();
+        FCachedImage Evicted;
+        Images.RemoveAndCopyValue(Oldest->GetValue(), Evicted);
+        ImageCacheBytes -= Evicted.Bytes.Num();
+        ImageOrder.RemoveNode(Oldest);
+    }
+}
+
+FString UCardanoAssetMetadataCache::GetCacheFilePath() const
+{
+    return FPaths::ProjectSavedDir() / TEXT("Cardano") / TEXT("AssetMetadata.json");
+}
+
+void UCardanoAssetMetadataCache::LoadFromDisk()
+{
+    FString JsonString;
+    if (!FFileHelper::LoadFileToString(JsonString, *GetCacheFilePath()))
+    {
+        return;
+    }
+
+    FCardanoAssetMetadataFile Loaded;
+    if (!FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &Loaded, 0, 0))
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Ignoring unreadable asset metadata cache"));
+        return;
+    }
+
+    Cached.Reserve(Loaded.Assets.Num());
+    for (FCardanoAssetMetadata& Entry : Loaded.Assets)
+    {
+        const FString AssetId = Entry.AssetId;
+        Cached.Add(AssetId, MoveTemp(Entry));
+    }
+    UE_LOG(LogCardano, Log, TEXT("Loaded metadata of %d cached assets"), Cached.Num());
+}
+
+void UCardanoAssetMetadataCache::ScheduleSave()
+{
+    if (!SaveHandle.IsValid())
+    {
+        SaveHandle = FTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &UCardanoAssetMetadataCache::SaveToDisk), 1.0f);
+    }
+}
+
+bool UCardanoAssetMetadataCache::SaveToDisk(float DeltaTime)
+{
+    SaveHandle.Reset();
+
+    FCardanoAssetMetadataFile File;
+    Cached.GenerateValueArray(File.Assets);
+
+    FString JsonString;
+    if (!FJsonObjectConverter::UStructToJsonObjectString(File, JsonString) ||
+        !FFileHelper::SaveStringToFile(JsonString, *GetCacheFilePath()))
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Failed to persist asset metadata"));
+    }
+
+    // One-shot
+    return false;
+}
@@ -0,0 +1,286 @@
+#include "CardanoAsyncQueries.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoLog.h"
+
+/** One Koios request shared by every query for the same address while it is in flight. */
+template <typename ActionType>
+struct TCardanoSharedQuery
+{
+    TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Request;
+    TArray<TWeakObjectPtr<ActionType>> Waiters;
+};
+
+template <typename ActionType>
+using TCardanoQueryRegistry = TMap<FString, TSharedRef<TCardanoSharedQuery<ActionType>>>;
+
+/** Requests in flight by address; only touched on the game thread. */
+static TCardanoQueryRegistry<UCardanoGetAddressBalanceAction> GBalanceQueries;
+static TCardanoQueryRegistry<UCardanoGetAddressUTxOsAction> GUTxOQueries;
+
+/** Results of the last response for each address, so repeated polls skip decoding identical responses. */
+static TKoiosResponseMemo<FAddressBalance> GBalanceResponses;
+static TKoiosResponseMemo<TArray<FUTxO>> GUTxOResponses;
+
+struct FCardanoSharedQueries
+{
+    /**
+     * Adds Action to the request in flight for its address, or sends a new one to Endpoint. Each response is decoded
+     * once by Decode, then Result is filled for every query still waiting: copied, except for the last one. A response
+     * identical to the previous one for the address is not decoded again; the result Memo kept from it is used.
+     */
+    template <typename ActionType, typename ResultType>
+    static void Join(
+        ActionType* Action,
+        TCardanoQueryRegistry<ActionType>& Registry,
+        TKoiosResponseMemo<ResultType>& Memo,
+        const TCHAR* Endpoint,
+        const FString& Body,
+        ResultType ActionType::* Result,
+        TFunction<bool(const TArray<uint8>&, ResultType&)> Decode)
+    {
+        if (TSharedRef<TCardanoSharedQuery<ActionType>>* Existing = Registry.Find(Action->Address))
+        {
+            (*Existing)->Waiters.Add(Action);
+            return;
+        }
+
+        UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+        if (!Koios)
+        {
+            Action->Finish(false, TEXT("Koios client is not available"));
+            return;
+        }
+
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateJsonPost(Endpoint, Body);
+        TSharedRef<TCardanoSharedQuery<ActionType>> Query = MakeShared<TCardanoSharedQuery<ActionType>>();
+        Query->Request = HttpRequest;
+        Query->Waiters.Add(Action);
+        Registry.Add(Action->Address, Query);
+
+        const FString MemoKey = FString(Endpoint) + Body;
+        Memo.Prepare(MemoKey, *HttpRequest);
+
+        HttpRequest->OnProcessRequestComplete().BindLambda([&Registry, &Memo, MemoKey, Address = Action->Address, Query, Result, Decode = MoveTemp(Decode)](
+            FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+            {
+                // Queries made from now on send a request of their own
+                const TSharedRef<TCardanoSharedQuery<ActionType>>* Current = Registry.Find(Address);
+                if (Current && *Current == Query)
+                {
+                    Registry.Remove(Address);
+                }
+
+                Query->Waiters.RemoveAll([](const TWeakObjectPtr<ActionType>& Waiter) { return !Waiter.IsValid(); });
+                if (Query->Waiters.Num() == 0)
+                {
+                    return;
+                }
+
+                const FKoiosResponseFingerprint Fingerprint = FKoiosResponseFingerprint::Make(Response);
+                if (const ResultType* Unchanged = Success ? Memo.FindUnchanged(MemoKey, Fingerprint) : nullptr)
+                {
+                    Succeed(Query, Result, ResultType(*Unchanged));
+                    return;
+                }
+
+                if (!Success || !Response.IsValid() || Response->GetResponseCode() != 200)
+                {
+                    const FString Error = Response.IsValid() ? FString::Printf(TEXT("Koios returned HTTP %d"), Response->GetResponseCode()) : TEXT("Network request failed");
+                    Fail(Query, Error);
+                    return;
+                }
+
+                TSharedRef<ResultType> Decoded = MakeShared<ResultType>();
+
+                DecodeKoiosResponse(Response,
+                    [Decoded, Decode](const TArray<uint8>& Content)
+                    {
+                        return Decode(Content, *Decoded);
+                    },
+                    [&Memo, MemoKey, Fingerprint, Query, Decoded, Result](bool bDecoded)
+                    {
+                        if (!bDecoded)
+                        {
+                            Fail(Query, TEXT("Invalid response format"));
+                            return;
+                        }
+
+                        Memo.Store(MemoKey, Fingerprint, *Decoded);
+                        Succeed(Query, Result, MoveTemp(*Decoded));
+                    });
+            });
+
+        Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+    }
+
+    /** Removes Action from the request for its address, withdrawing the request once nothing waits on it. */
+    template <typename ActionType>
+    static void Leave(ActionType* Action, TCardanoQueryRegistry<ActionType>& Registry)
+    {
+        const TSharedRef<TCardanoSharedQuery<ActionType>>* Found = Registry.Find(Action->Address);
+        if (!Found)
+        {
+            return;
+        }
+
+        TSharedRef<TCardanoSharedQuery<ActionType>> Query = *Found;
+        Query->Waiters.Remove(Action);
+
+        if (Query->Waiters.Num() == 0)
+        {
+            Registry.Remove(Action->Address);
+
+            if (UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get())
+            {
+                Koios->CancelRequest(Query->Request.ToSharedRef());
+            }
+        }
+    }
+
+    /** Hands Value to every query still waiting: copied, except for the last one. */
+    template <typename ActionType, typename ResultType>
+    static void Succeed(const TSharedRef<TCardanoSharedQuery<ActionType>>& Query, ResultType ActionType::* Result, ResultType&& Value)
+    {
+        // Finishing a query may cancel another one, so the waiters are taken first
+        TArray<TWeakObjectPtr<ActionType>> Waiters = MoveTemp(Query->Waiters);
+        Waiters.RemoveAll([](const TWeakObjectPtr<ActionType>& Waiter) { return !Waiter.IsValid(); });
+        for (int32 i = 0; i < Waiters.Num(); ++i)
+        {
+            if (ActionType* Waiter = Waiters[i].Get())
+            {
+                Waiter->*Result = (i == Waiters.Num() - 1) ? MoveTemp(Value) : Value;
+                Waiter->Finish(true, FString());
+            }
+        }
+    }
+
+    template <typename ActionType>
+    static void Fail(const TSharedRef<TCardanoSharedQuery<ActionType>>& Query, const FString& Error)
+    {
+        TArray<TWeakObjectPtr<ActionType>> Waiters = MoveTemp(Query->Waiters);
+        for (const TWeakObjectPtr<ActionType>& Waiter : Waiters)
+        {
+            if (Waiter.IsValid())
+            {
+                Waiter->Finish(false, Error);
+            }
+        }
+    }
+};
+
+UCardanoGetAddressBalanceAction* UCardanoGetAddressBalanceAction::GetAddressBalanceAsync(const FString& Address)
+{
+    UCardanoGetAddressBalanceAction* Action = NewObject<UCardanoGetAddressBalanceAction>();
+    Action->Address = Address;
+    return Action;
+}
+
+void UCardanoGetAddressBalanceAction::Activate()
+{
+    // Rooted until it finishes, since nothing else may reference the query while it waits
+    AddToRoot();
+
+    FCardanoSharedQueries::Join<UCardanoGetAddressBalanceAction, FAddressBalance>(this, GBalanceQueries, GBalanceResponses,
+        TEXT("address_info"), UCardanoKoiosClient::MakeAddressesBody({ Address }), &UCardanoGetAddressBalanceAction::Balance,
+        [](const TArray<uint8>& Content, FAddressBalance& OutBalance)
+        {
+            // Koios returns no row for an address that never received anything, which leaves the balance empty
+            bool bFound = false;
+            return DecodeAddressInfoRows(Content,
+                [&OutBalance, &bFound](FString&&, FAddressBalance&& Balance)
+                {
+                    if (!bFound)
+                    {
+                        OutBalance = MoveTemp(Balance);
+                        bFound = true;
+                    }
+                });
+        });
+}
+
+void UCardanoGetAddressBalanceAction::Cancel()
+{
+    if (bFinished)
+    {
+        return;
+    }
+
+    bFinished = true;
+    FCardanoSharedQueries::Leave(this, GBalanceQueries);
+    SetReadyToDestroy();
+    RemoveFromRoot();
+}
+
+void UCardanoGetAddressBalanceAction::Finish(bool bSuccess, const FString& ErrorMessage)
+{
+    if (bFinished)
+    {
+        return;
+    }
+    bFinished = true;
+
+    if (!bSuccess)
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Balance query for %s failed: %s"), *Address, *ErrorMessage);
+    }
+
+    (bSuccess ? OnSuccess : OnFailure).Broadcast(Balance, ErrorMessage);
+
+    SetReadyToDestroy();
+    RemoveFromRoot();
+}
+
+UCardanoGetAddressUTxOsAction* UCardanoGetAddressUTxOsAction::GetAddressUTxOsAsync(const FString& Address)
+{
+    UCardanoGetAddressUTxOsAction* Action = NewObject<UCardanoGetAddressUTxOsAction>();
+    Action->Address = Address;
+    return Action;
+}
+
+void UCardanoGetAddressUTxOsAction::Activate()
+{
+    AddToRoot();
+
+    FCardanoSharedQueries::Join<UCardanoGetAddressUTxOsAction, TArray<FUTxO>>(this, GUTxOQueries, GUTxOResponses,
+        TEXT("address_utxos"), UCardanoKoiosClient::MakeAddressesBody({ Address }, true), &UCardanoGetAddressUTxOsAction::UTxOs,
+        [](const TArray<uint8>& Content, TArray<FUTxO>& OutUTxOs)
+        {
+            int32 RowCount = 0;
+            return DecodeUTxORows(Content,
+                [&OutUTxOs](FString&&, FUTxO&& UTxO) { OutUTxOs.Add(MoveTemp(UTxO)); },
+                RowCount);
+        });
+}
+
+void UCardanoGetAddressUTxOsAction::Cancel()
+{
+    if (bFinished)
+    {
+        return;
+    }
+
+    bFinished = true;
+    FCardanoSharedQueries::Leave(this, GUTxOQueries);
+    SetReadyToDestroy();
+    RemoveFromRoot();
+}
+
+void UCardanoGetAddressUTxOsAction::Finish(bool bSuccess, const FString& ErrorMessage)
+{
+    if (bFinished)
+    {
+        return;
+    }
+    bFinished = true;
+
+    if (!bSuccess)
+    {
+        UE_LOG(LogCardano, Warning, TEXT("UTxO query for %s failed: %s"), *Address, *ErrorMessage);
+    }
+
+    (bSuccess ? OnSuccess : OnFailure).Broadcast(UTxOs, ErrorMessage);
+
+    SetReadyToDestroy();
+    RemoveFromRoot();
+}
@@ -0,0 +1,141 @@
+#include "CardanoBalanceTotals.h"
+
+/** Koios quantities are unsigned; anything else counts as zero. */
+static FCardanoQuantity ParseQuantity(const FString& Quantity)
+{
+    FCardanoQuantity Parsed;
+    return FCardanoQuantity::FromString(Quantity, Parsed) && !Parsed.IsNegative() ? Parsed : FCardanoQuantity();
+}
+
+void FCardanoBalanceTotals::Add(const FUTxO& UTxO)
+{
+    Lovelace += UTxO.Value;
+    for (const FTokenBalance& Asset : UTxO.Assets)
+    {
+        AddToken(Asset);
+    }
+}
+
+void FCardanoBalanceTotals::Remove(const FUTxO& UTxO)
+{
+    Lovelace = FMath::Max<int64>(Lovelace - UTxO.Value, 0);
+    for (const FTokenBalance& Asset : UTxO.Assets)
+    {
+        RemoveToken(Asset);
+    }
+}
+
+void FCardanoBalanceTotals::AddToken(const FTokenBalance& Token)
+{
+    AddQuantity(Token.PolicyId, Token.AssetName, ParseQuantity(Token.Quantity));
+}
+
+void FCardanoBalanceTotals::RemoveToken(const FTokenBalance& Token)
+{
+    RemoveQuantity(Token.PolicyId, Token.AssetName, ParseQuantity(Token.Quantity));
+}
+
+void FCardanoBalanceTotals::AddQuantity(const FString& PolicyId, const FString& AssetName, const FCardanoQuantity& Quantity)
+{
+    if (Quantity.IsZero())
+    {
+        return;
+    }
+
+    FAssetKey Key;
+    Key.PolicyId = PolicyId;
+    Key.AssetName = AssetName;
+    FCardanoQuantity& Total = Assets.FindOrAdd(MoveTemp(Key));
+    FCardanoQuantity::Add(Total, Quantity, Total);
+}
+
+void FCardanoBalanceTotals::RemoveQuantity(const FString& PolicyId, const FString& AssetName, const FCardanoQuantity& Quantity)
+{
+    FAssetKey Key;
+    Key.PolicyId = PolicyId;
+    Key.AssetName = AssetName;
+
+    FCardanoQuantity* Total = Assets.Find(Key);
+    if (!Total)
+    {
+        return;
+    }
+
+    if (*Total <= Quantity)
+    {
+        Assets.Remove(Key);
+    }
+    else
+    {
+        FCardanoQuantity::Subtract(*Total, Quantity, *Total);
+    }
+}
+
+void FCardanoBalanceTotals::Append(const FCardanoBalanceTotals& Other)
+{
+    Lovelace += Other.Lovelace;
+    for (const TPair<FAssetKey, FCardanoQuantity>& Asset : Other.Assets)
+    {
+        FCardanoQuantity& Total = Assets.FindOrAdd(Asset.Key);
+        FCardanoQuantity::Add(Total, Asset.Value, Total);
+    }
+}
+
+void FCardanoBalanceTotals::Reset()
+{
+    Lovelace = 0;
+    Assets.Reset();
+}
+
+FCardanoQuantity FCardanoBalanceTotals::GetQuantity(const FString& PolicyId, const FString& AssetName) const
+{
+    FAssetKey Key;
+    Key.PolicyId = PolicyId;
+    Key.AssetName = AssetName;
+
+    const FCardanoQuantity* Total = Assets.Find(Key);
+    return Total ? *Total : FCardanoQuantity();
+}
+
+void FCardanoBalanceTotals::ToBalance(FAddressBalance& OutBalance) const
+{
+    OutBalance.Lovelace = Lovelace;
+    GetTokens(OutBalance.Tokens);
+}
+
+void FCardanoBalanceTotals::GetTokens(TArray<FTokenBalance>& OutTokens) const
+{
+    OutTokens.Reset(Assets.Num());
+    for (const TPair<FAssetKey, FCardanoQuantity>& Asset : Assets)
+    {
+        FTokenBalance& Token = OutTokens.AddDefaulted_GetRef();
+        Token.PolicyId = Asset.Key.PolicyId;
+        Token.AssetName = Asset.Key.AssetName;
+        Token.Quantity = Asset.Value.ToString();
+    }
+}
+
+void FCardanoBalanceTotals::MergeTokens(TArray<FTokenBalance>& Tokens)
+{
+    if (Tokens.Num() < 2)
+    {
+        return;
+    }
+
+    FCardanoBalanceTotals Totals;
+    for (const FTokenBalance& Token : Tokens)
+    {
+        Totals.AddToken(Token);
+    }
+    Totals.GetTokens(Tokens);
+}
+
+SIZE_T FCardanoBalanceTotals::GetAllocatedSize() const
+{
+    SIZE_T Size = Assets.GetAllocatedSize();
+    for (const TPair<FAssetKey, FCardanoQuantity>& Asset : Assets)
+    {
+        Size += Asset.Key.PolicyId.GetAllocatedSize() + Asset.Key.AssetName.GetAllocatedSize();
+    }
+    return Size;
+}
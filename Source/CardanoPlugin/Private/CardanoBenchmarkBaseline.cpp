@@ -0,0 +1,691 @@
+#include "CardanoBenchmarkBaseline.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoLibraryBenchmark.h"
+#include "CardanoLoadTest.h"
+#include "CardanoLog.h"
+#include "CardanoMockKoiosServer.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProperties.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include <cardano/cardano.h>
+
+/** Addresses and UTxOs per address of the address_utxos response the JSON cases decode. */
+static const int32 JSON_ADDRESSES = 10;
+static const int32 JSON_UTXOS_PER_ADDRESS = 100;
+
+/** Longest a load test is waited for to release the previous one before the HTTP cases are given up. */
+static const double LOAD_TEST_START_TIMEOUT_SECONDS = 30.0;
+
+/** Two-sided 95% quantiles of Student's t distribution for 1 to 30 degrees of freedom. */
+static const double T_QUANTILES_95[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+};
+
+namespace
+{
+    /** State of a suite run while its load tests go one after the other on the game thread. */
+    struct FSuiteRun
+    {
+        FCardanoBenchmarkSuiteConfig Config;
+        FOnCardanoBenchmarkSuiteComplete OnComplete;
+        TArray<FCardanoBenchmarkSamples> Samples;
+        int32 HttpRepetition = 0;
+    };
+
+    void add_sample(TArray<FCardanoBenchmarkSamples>& Samples, const FString& Name, const TCHAR* Unit, double Value)
+    {
+        FCardanoBenchmarkSamples* Existing = Samples.FindByPredicate([&Name](const FCardanoBenchmarkSamples& Entry) { return Entry.Name == Name; });
+        if (!Existing)
+        {
+            Existing = &Samples.AddDefaulted_GetRef();
+            Existing->Name = Name;
+            Existing->Unit = Unit;
+        }
+        Existing->Values.Add(Value);
+    }
+
+    /** Nanoseconds per call of Op, over growing batches until they take MinSeconds, as FCardanoLibraryBenchmark times. */
+    double measure_nanos(double MinSeconds, TFunctionRef<bool()> Op)
+    {
+        Op();
+
+        int64 Batch = 1;
+        for (;;)
+        {
+            const double Start = FPlatformTime::Seconds();
+            for (int64 i = 0; i < Batch; i++)
+            {
+                Op();
+            }
+            const double Elapsed = FPlatformTime::Seconds() - Start;
+
+            if (Elapsed >= MinSeconds || Batch >= (int64(1) << 40))
+            {
+                return Elapsed * 1.0e9 / Batch;
+            }
+
+            const double Scale = Elapsed > 0.0 ? FMath::Min(MinSeconds * 1.4 / Elapsed, 10.0) : 10.0;
+            Batch = FMath::Max(Batch + 1, static_cast<int64>(Batch * Scale));
+        }
+    }
+
+    /** The Koios response decoders, on the body the mock server sends for address_utxos. */
+    void run_json_cases(double MinSeconds, TArray<FCardanoBenchmarkSamples>& Samples)
+    {
+        TArray<FString> Addresses;
+        for (int32 i = 0; i < JSON_ADDRESSES; i++)
+        {
+            Addresses.Add(FString::Printf(TEXT("addr_test1benchmark%02d"), i));
+        }
+
+        const FString Body = FCardanoMockKoiosServer::MakeAddressUTxOsResponse(Addresses, JSON_UTXOS_PER_ADDRESS);
+        const FTCHARToUTF8 Converter(*Body);
+        const TArray<uint8> Content(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+        const int32 Rows = JSON_ADDRESSES * JSON_UTXOS_PER_ADDRESS;
+
+        add_sample(Samples, FString::Printf(TEXT("json/address_utxos/pull/%d_rows"), Rows), TEXT("ns"), measure_nanos(MinSeconds, [&Content]()
+            {
+                int32 RowCount = 0;
+                return DecodeUTxORows(Content, [](FString&& Address, FUTxO&& UTxO) {}, RowCount);
+            }));
+
+        // The FString and DOM path the pull decoder replaced, kept so the two stay comparable
+        add_sample(Samples, FString::Printf(TEXT("json/address_utxos/dom/%d_rows"), Rows), TEXT("ns"), measure_nanos(MinSeconds, [&Content]()
+            {
+                FUTF8ToTCHAR Text(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+                TArray<TSharedPtr<FJsonValue>> Array;
+                if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(FString(Text.Length(), Text.Get())), Array))
+                {
+                    return false;
+                }
+
+                FUTxO UTxO;
+                for (const TSharedPtr<FJsonValue>& Row : Array)
+                {
+                    const TSharedPtr<FJsonObject>* Object = nullptr;
+                    if (!Row->TryGetObject(Object) || !ParseUTxO(**Object, UTxO))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }));
+    }
+
+    void finish_run(const TSharedRef<FSuiteRun>& Run)
+    {
+        Run->OnComplete.ExecuteIfBound(Run->Samples);
+    }
+
+    void start_load_test(const TSharedRef<FSuiteRun>& Run, double WaitingSince);
+
+    /** Waits for the previous load test to be released, since only one runs at a time, then starts the next one. */
+    void schedule_load_test(const TSharedRef<FSuiteRun>& Run)
+    {
+        const double WaitingSince = FPlatformTime::Seconds();
+        FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Run, WaitingSince](float DeltaTime)
+            {
+                if (FCardanoLoadTest::GetRunning().IsValid())
+                {
+                    if (FPlatformTime::Seconds() - WaitingSince < LOAD_TEST_START_TIMEOUT_SECONDS)
+                    {
+                        return true;
+                    }
+
+                    UE_LOG(LogCardano, Warning, TEXT("Cardano benchmark suite: another load test is running; skipping the HTTP cases"));
+                    finish_run(Run);
+                    return false;
+                }
+
+                start_load_test(Run, WaitingSince);
+                return false;
+            }), 0.1f);
+    }
+
+    void start_load_test(const TSharedRef<FSuiteRun>& Run, double WaitingSince)
+    {
+        if (Run->HttpRepetition >= Run->Config.Repetitions)
+        {
+            finish_run(Run);
+            return;
+        }
+
+        // No added latency, so the numbers are the plugin's own queueing, parsing and thread hand-offs
+        FCardanoLoadTestConfig LoadTest;
+        LoadTest.Wallets = FMath::Max(Run->Config.HttpWallets, 1);
+        LoadTest.DurationSeconds = FMath::Max(Run->Config.HttpSeconds, 1.0f);
+        LoadTest.ThinkTimeSeconds = 0.1f;
+        LoadTest.bMockServer = true;
+        LoadTest.MockLatencySeconds = 0.0f;
+
+        const TSharedPtr<FCardanoLoadTest, ESPMode::ThreadSafe> Test = FCardanoLoadTest::Start(LoadTest, FOnCardanoLoadTestComplete::CreateLambda([Run](const FCardanoLoadTestReport& Report)
+            {
+                if (!Report.FirstError.IsEmpty())
+                {
+                    UE_LOG(LogCardano, Warning, TEXT("Cardano benchmark suite: load test %d: %s"), Run->HttpRepetition + 1, *Report.FirstError);
+                }
+
+                for (const FCardanoLoadTestStageStats& Stage : Report.Stages)
+                {
+                    if (Stage.Count > Stage.Failures)
+                    {
+                        add_sample(Run->Samples, FString::Printf(TEXT("http/%s/p50"), *Stage.Name), TEXT("ms"), Stage.P50Ms);
+                        add_sample(Run->Samples, FString::Printf(TEXT("http/%s/p90"), *Stage.Name), TEXT("ms"), Stage.P90Ms);
+                    }
+                }
+
+                Run->HttpRepetition++;
+                schedule_load_test(Run);
+            }));
+
+        if (!Test.IsValid())
+        {
+            finish_run(Run);
+        }
+    }
+
+    /** Two-sided 95% quantile of Student's t, rounding Degrees down so the interval errs wide. */
+    double t_quantile_95(double Degrees)
+    {
+        const int32 Whole = FMath::Max(FMath::FloorToInt(Degrees), 1);
+        if (Whole <= UE_ARRAY_COUNT(T_QUANTILES_95))
+        {
+            return T_QUANTILES_95[Whole - 1];
+        }
+        return Whole <= 40 ? 2.021 : Whole <= 60 ? 2.000 : Whole <= 120 ? 1.980 : 1.960;
+    }
+
+    /** Sets the change of Current over Baseline and its confidence interval, with Welch's t-test for unequal spreads. */
+    void compute_delta(const FCardanoBenchmarkSamples& Baseline, const FCardanoBenchmarkSamples& Current, FCardanoBenchmarkDelta& OutDelta)
+    {
+        OutDelta.BaselineMean = Baseline.GetMean();
+        OutDelta.CurrentMean = Current.GetMean();
+        if (OutDelta.BaselineMean <= 0.0)
+        {
+            return;
+        }
+
+        const double Scale = 100.0 / OutDelta.BaselineMean;
+        const double Difference = OutDelta.CurrentMean - OutDelta.BaselineMean;
+        OutDelta.DeltaPercent = Difference * Scale;
+
+        // A single repetition on either side leaves the interval at the point estimate
+        const int32 BaselineCount = Baseline.Values.Num();
+        const int32 CurrentCount = Current.Values.Num();
+        double Margin = 0.0;
+        if (BaselineCount >= 2 && CurrentCount >= 2)
+        {
+            const double BaselineTerm = FMath::Square(Baseline.GetStdDev()) / BaselineCount;
+            const double CurrentTerm = FMath::Square(Current.GetStdDev()) / CurrentCount;
+            const double Variance = BaselineTerm + CurrentTerm;
+            if (Variance > 0.0)
+            {
+                const double Degrees = FMath::Square(Variance) /
+                    (FMath::Square(BaselineTerm) / (BaselineCount - 1) + FMath::Square(CurrentTerm) / (CurrentCount - 1));
+                Margin = t_quantile_95(Degrees) * FMath::Sqrt(Variance);
+            }
+        }
+
+        OutDelta.LowPercent = (Difference - Margin) * Scale;
+        OutDelta.HighPercent = (Difference + Margin) * Scale;
+
+        if (OutDelta.LowPercent > 0.0)
+        {
+            OutDelta.Verdict = OutDelta.DeltaPercent > OutDelta.ThresholdPercent ? ECardanoBenchmarkVerdict::Regressed : ECardanoBenchmarkVerdict::Slower;
+        }
+        else if (OutDelta.HighPercent < 0.0)
+        {
+            OutDelta.Verdict = ECardanoBenchmarkVerdict::Faster;
+        }
+    }
+
+    double find_threshold(const FString& Name, const TArray<FCardanoBenchmarkThreshold>& Thresholds)
+    {
+        int32 BestLength = -1;
+        double Percent = 10.0;
+        for (const FCardanoBenchmarkThreshold& Threshold : Thresholds)
+        {
+            if (Threshold.Prefix.Len() > BestLength && Name.StartsWith(Threshold.Prefix))
+            {
+                BestLength = Threshold.Prefix.Len();
+                Percent = Threshold.Percent;
+            }
+        }
+        return Percent;
+    }
+
+    /** The area a case covers, from its name, so a report reads by area. */
+    const TCHAR* get_category(const FString& Name)
+    {
+        if (Name.StartsWith(TEXT("cbor/")) || Name.StartsWith(TEXT("transaction/")))
+        {
+            return TEXT("cbor");
+        }
+        if (Name.StartsWith(TEXT("balance_transaction/")) || Name.StartsWith(TEXT("coin_selection/")))
+        {
+            return TEXT("balancing");
+        }
+        if (Name.StartsWith(TEXT("json/")))
+        {
+            return TEXT("json");
+        }
+        if (Name.StartsWith(TEXT("http/")))
+        {
+            return TEXT("http");
+        }
+        return TEXT("crypto");
+    }
+
+    const TCHAR* get_verdict_name(ECardanoBenchmarkVerdict Verdict)
+    {
+        switch (Verdict)
+        {
+        case ECardanoBenchmarkVerdict::Faster: return TEXT("faster");
+        case ECardanoBenchmarkVerdict::Slower: return TEXT("slower");
+        case ECardanoBenchmarkVerdict::Regressed: return TEXT("REGRESSED");
+        case ECardanoBenchmarkVerdict::Missing: return TEXT("missing");
+        default: return TEXT("ok");
+        }
+    }
+}
+
+double FCardanoBenchmarkSamples::GetMean() const
+{
+    double Total = 0.0;
+    for (double Value : Values)
+    {
+        Total += Value;
+    }
+    return Values.Num() > 0 ? Total / Values.Num() : 0.0;
+}
+
+double FCardanoBenchmarkSamples::GetStdDev() const
+{
+    if (Values.Num() < 2)
+    {
+        return 0.0;
+    }
+
+    const double Mean = GetMean();
+    double Squares = 0.0;
+    for (double Value : Values)
+    {
+        Squares += FMath::Square(Value - Mean);
+    }
+    return FMath::Sqrt(Squares / (Values.Num() - 1));
+}
+
+void FCardanoBenchmarkSuite::Run(const FCardanoBenchmarkSuiteConfig& Config, FOnCardanoBenchmarkSuiteComplete OnComplete)
+{
+    check(IsInGameThread());
+
+    TSharedRef<FSuiteRun> Run = MakeShared<FSuiteRun>();
+    Run->Config = Config;
+    Run->Config.Repetitions = FMath::Max(Config.Repetitions, 1);
+    Run->OnComplete = MoveTemp(OnComplete);
+
+    // A dedicated thread, so the thread pool is idle and the cases have a core to themselves
+    Async(EAsyncExecution::Thread, [Run]()
+        {
+            TArray<FCardanoBenchmarkSamples> Samples;
+            for (int32 Repetition = 0; Repetition < Run->Config.Repetitions; Repetition++)
+            {
+                for (const FCardanoLibraryBenchmarkResult& Result : FCardanoLibraryBenchmark::Run(Run->Config.MinSecondsPerCase, {}))
+                {
+                    add_sample(Samples, Result.Name, TEXT("ns"), Result.NanosPerOp);
+                }
+                run_json_cases(Run->Config.MinSecondsPerCase, Samples);
+                UE_LOG(LogCardano, Log, TEXT("Cardano benchmark suite: repetition %d of %d done"), Repetition + 1, Run->Config.Repetitions);
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [Run, Samples = MoveTemp(Samples)]() mutable
+                {
+                    Run->Samples = MoveTemp(Samples);
+                    if (Run->Config.bHttp)
+                    {
+                        schedule_load_test(Run);
+                    }
+                    else
+                    {
+                        finish_run(Run);
+                    }
+                });
+        });
+}
+
+FString FCardanoBenchmarkSuite::GetMachineProfile()
+{
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+    const TCHAR* BuildType = TEXT("release");
+#else
+    const TCHAR* BuildType = TEXT("debug");
+#endif
+
+    const FString Profile = FString::Printf(TEXT("%s-%s-%dt-%s"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()),
+        *FPlatformMisc::GetCPUBrand().TrimStartAndEnd(), FPlatformMisc::NumberOfCoresIncludingHyperthreads(), BuildType);
+
+    // CPU brands hold spaces, parentheses and "@"; keep a name every file system takes
+    FString FileName;
+    for (const TCHAR Character : Profile)
+    {
+        FileName.AppendChar(FChar::IsAlnum(Character) || Character == TEXT('-') || Character == TEXT('.') ? Character : TEXT('_'));
+    }
+    return FileName;
+}
+
+FString FCardanoBenchmarkSuite::GetProfileDirectory(const FString& Profile)
+{
+    return FPaths::ProjectSavedDir() / TEXT("Cardano") / TEXT("Benchmarks") / Profile;
+}
+
+FString FCardanoBenchmarkSuite::ToJson(const FCardanoBenchmarkBaseline& Baseline)
+{
+    TArray<TSharedPtr<FJsonValue>> Benchmarks;
+    for (const FCardanoBenchmarkSamples& Samples : Baseline.Benchmarks)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        for (double Value : Samples.Values)
+        {
+            Values.Add(MakeShared<FJsonValueNumber>(Value));
+        }
+
+        // Mean and spread are derived, but spare dashboards from recomputing them
+        TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("name"), Samples.Name);
+        Entry->SetStringField(TEXT("unit"), Samples.Unit);
+        Entry->SetArrayField(TEXT("values"), Values);
+        Entry->SetNumberField(TEXT("mean"), Samples.GetMean());
+        Entry->SetNumberField(TEXT("stddev"), Samples.GetStdDev());
+        Benchmarks.Add(MakeShared<FJsonValueObject>(Entry));
+    }
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetStringField(TEXT("profile"), Baseline.Profile);
+    Root->SetStringField(TEXT("date"), Baseline.Date);
+    Root->SetStringField(TEXT("library_version"), Baseline.LibraryVersion);
+    Root->SetArrayField(TEXT("benchmarks"), Benchmarks);
+
+    FString Json;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    FJsonSerializer::Serialize(Root, Writer);
+    return Json;
+}
+
+bool FCardanoBenchmarkSuite::FromJson(const FString& Json, FCardanoBenchmarkBaseline& OutBaseline)
+{
+    TSharedPtr<FJsonObject> Root;
+    const TArray<TSharedPtr<FJsonValue>>* Benchmarks = nullptr;
+    if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid() ||
+        !Root->TryGetArrayField(TEXT("benchmarks"), Benchmarks))
+    {
+        return false;
+    }
+
+    FCardanoBenchmarkBaseline Baseline;
+    Root->TryGetStringField(TEXT("profile"), Baseline.Profile);
+    Root->TryGetStringField(TEXT("date"), Baseline.Date);
+    Root->TryGetStringField(TEXT("library_version"), Baseline.LibraryVersion);
+
+    for (const TSharedPtr<FJsonValue>& Item : *Benchmarks)
+    {
+        const TSharedPtr<FJsonObject>* Entry = nullptr;
+        const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+        FCardanoBenchmarkSamples Samples;
+        if (!Item->TryGetObject(Entry) || !(*Entry)->TryGetStringField(TEXT("name"), Samples.Name) ||
+            !(*Entry)->TryGetArrayField(TEXT("values"), Values))
+        {
+            return false;
+        }
+
+        (*Entry)->TryGetStringField(TEXT("unit"), Samples.Unit);
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            Samples.Values.Add(Value->AsNumber());
+        }
+        Baseline.Benchmarks.Add(MoveTemp(Samples));
+    }
+
+    OutBaseline = MoveTemp(Baseline);
+    return true;
+}
+
+TArray<FCardanoBenchmarkThreshold> FCardanoBenchmarkSuite::GetDefaultThresholds()
+{
+    TArray<FCardanoBenchmarkThreshold> Thresholds;
+    Thresholds.Add({ FString(), 10.0 });
+    Thresholds.Add({ TEXT("http/"), 25.0 });
+    return Thresholds;
+}
+
+FCardanoBenchmarkComparison FCardanoBenchmarkSuite::Compare(const FCardanoBenchmarkBaseline& Baseline, const FCardanoBenchmarkBaseline& Current,
+    const TArray<FCardanoBenchmarkThreshold>& Thresholds)
+{
+    FCardanoBenchmarkComparison Comparison;
+    Comparison.Profile = Current.Profile;
+    Comparison.BaselineDate = Baseline.Date;
+    Comparison.BaselineLibraryVersion = Baseline.LibraryVersion;
+    Comparison.LibraryVersion = Current.LibraryVersion;
+
+    TMap<FString, const FCardanoBenchmarkSamples*> BaselineByName;
+    for (const FCardanoBenchmarkSamples& Samples : Baseline.Benchmarks)
+    {
+        BaselineByName.Add(Samples.Name, &Samples);
+    }
+
+    for (const FCardanoBenchmarkSamples& Samples : Current.Benchmarks)
+    {
+        FCardanoBenchmarkDelta& Delta = Comparison.Deltas.AddDefaulted_GetRef();
+        Delta.Name = Samples.Name;
+        Delta.Unit = Samples.Unit;
+        Delta.ThresholdPercent = find_threshold(Samples.Name, Thresholds);
+
+        const FCardanoBenchmarkSamples* const* Previous = BaselineByName.Find(Samples.Name);
+        if (!Previous)
+        {
+            Delta.CurrentMean = Samples.GetMean();
+            Delta.Verdict = ECardanoBenchmarkVerdict::Missing;
+            continue;
+        }
+
+        compute_delta(**Previous, Samples, Delta);
+        BaselineByName.Remove(Samples.Name);
+        if (Delta.Verdict == ECardanoBenchmarkVerdict::Regressed)
+        {
+            Comparison.Regressions++;
+        }
+    }
+
+    // Cases the baseline has but this run does not, such as the HTTP ones of a run without them
+    for (const FCardanoBenchmarkSamples& Samples : Baseline.Benchmarks)
+    {
+        if (BaselineByName.Contains(Samples.Name))
+        {
+            FCardanoBenchmarkDelta& Delta = Comparison.Deltas.AddDefaulted_GetRef();
+            Delta.Name = Samples.Name;
+            Delta.Unit = Samples.Unit;
+            Delta.BaselineMean = Samples.GetMean();
+            Delta.ThresholdPercent = find_threshold(Samples.Name, Thresholds);
+            Delta.Verdict = ECardanoBenchmarkVerdict::Missing;
+        }
+    }
+
+    return Comparison;
+}
+
+FString FCardanoBenchmarkSuite::FormatComparison(const FCardanoBenchmarkComparison& Comparison)
+{
+    FString Report = FString::Printf(TEXT("Benchmarks on %s, cardano-c %s against the baseline of %s, cardano-c %s\n"),
+        *Comparison.Profile, *Comparison.LibraryVersion, *Comparison.BaselineDate, *Comparison.BaselineLibraryVersion);
+
+    Report += FString::Printf(TEXT("%-9s  %-48s  %12s  %12s  %4s  %8s  %19s  %6s  %s\n"),
+        TEXT("area"), TEXT("case"), TEXT("baseline"), TEXT("current"), TEXT("unit"), TEXT("delta"), TEXT("95% interval"), TEXT("limit"), TEXT("verdict"));
+
+    for (const FCardanoBenchmarkDelta& Delta : Comparison.Deltas)
+    {
+        if (Delta.Verdict == ECardanoBenchmarkVerdict::Missing)
+        {
+            Report += FString::Printf(TEXT("%-9s  %-48s  %12.1f  %12.1f  %4s  %8s  %19s  %5.0f%%  %s\n"),
+                get_category(Delta.Name), *Delta.Name, Delta.BaselineMean, Delta.CurrentMean, *Delta.Unit, TEXT("-"), TEXT("-"),
+                Delta.ThresholdPercent, get_verdict_name(Delta.Verdict));
+            continue;
+        }
+
+        const FString Interval = FString::Printf(TEXT("[%+.1f%%, %+.1f%%]"), Delta.LowPercent, Delta.HighPercent);
+        Report += FString::Printf(TEXT("%-9s  %-48s  %12.1f  %12.1f  %4s  %+7.1f%%  %19s  %5.0f%%  %s\n"),
+            get_category(Delta.Name), *Delta.Name, Delta.BaselineMean, Delta.CurrentMean, *Delta.Unit, Delta.DeltaPercent, *Interval,
+            Delta.ThresholdPercent, get_verdict_name(Delta.Verdict));
+    }
+
+    Report += FString::Printf(TEXT("%d of %d cases regressed\n"), Comparison.Regressions, Comparison.Deltas.Num());
+    return Report;
+}
+
+static void log_lines(ELogVerbosity::Type Verbosity, const FString& Text)
+{
+    TArray<FString> Lines;
+    Text.ParseIntoArrayLines(Lines);
+    for (const FString& Line : Lines)
+    {
+        if (Verbosity == ELogVerbosity::Error)
+        {
+            UE_LOG(LogCardano, Error, TEXT("%s"), *Line);
+        }
+        else
+        {
+            UE_LOG(LogCardano, Log, TEXT("%s"), *Line);
+        }
+    }
+}
+
+static bool save_run(const FCardanoBenchmarkBaseline& Run, const FString& FilePath)
+{
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+    if (!FFileHelper::SaveStringToFile(FCardanoBenchmarkSuite::ToJson(Run), *FilePath))
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Cardano.BenchmarkBaseline: cannot write %s"), *FilePath);
+        return false;
+    }
+    return true;
+}
+
+static FAutoConsoleCommand BenchmarkBaselineCommand(
+    TEXT("Cardano.BenchmarkBaseline"),
+    TEXT("Captures a baseline of the CBOR, crypto, balancing, JSON and HTTP benchmarks for this machine, or compares a new run against it. ")
+    TEXT("Usage: Cardano.BenchmarkBaseline capture|compare [Repetitions=5] [profile=<name>] [threshold=[<prefix>:]<percent>...] [nohttp] [exit]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            const bool bCapture = Args.Num() > 0 && Args[0].Equals(TEXT("capture"), ESearchCase::IgnoreCase);
+            if (!bCapture && (Args.Num() == 0 || !Args[0].Equals(TEXT("compare"), ESearchCase::IgnoreCase)))
+            {
+                UE_LOG(LogCardano, Warning, TEXT("Cardano.BenchmarkBaseline: expected capture or compare"));
+                return;
+            }
+
+            FCardanoBenchmarkSuiteConfig Config;
+            FString Profile = FCardanoBenchmarkSuite::GetMachineProfile();
+            TArray<FCardanoBenchmarkThreshold> Thresholds = FCardanoBenchmarkSuite::GetDefaultThresholds();
+            bool bExit = false;
+
+            for (int32 i = 1; i < Args.Num(); i++)
+            {
+                const FString& Arg = Args[i];
+                FString Value;
+                if (Arg.IsNumeric())
+                {
+                    Config.Repetitions = FMath::Max(FCString::Atoi(*Arg), 2);
+                }
+                else if (Arg.Equals(TEXT("nohttp"), ESearchCase::IgnoreCase))
+                {
+                    Config.bHttp = false;
+                }
+                else if (Arg.Equals(TEXT("exit"), ESearchCase::IgnoreCase))
+                {
+                    bExit = true;
+                }
+                else if (FParse::Value(*Arg, TEXT("profile="), Value))
+                {
+                    Profile = Value;
+                }
+                else if (FParse::Value(*Arg, TEXT("threshold="), Value))
+                {
+                    // "15" replaces the default for every case; "http/:30" sets the cases under a prefix
+                    FString Prefix;
+                    FString Percent = Value;
+                    Value.Split(TEXT(":"), &Prefix, &Percent, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
+                    FCardanoBenchmarkThreshold* Existing = Thresholds.FindByPredicate([&Prefix](const FCardanoBenchmarkThreshold& Threshold) { return Threshold.Prefix == Prefix; });
+                    if (!Existing)
+                    {
+                        Existing = &Thresholds.AddDefaulted_GetRef();
+                        Existing->Prefix = Prefix;
+                    }
+                    Existing->Percent = FCString::Atod(*Percent);
+                }
+                else
+                {
+                    UE_LOG(LogCardano, Warning, TEXT("Cardano.BenchmarkBaseline: ignoring %s"), *Arg);
+                }
+            }
+
+            const FString Directory = FCardanoBenchmarkSuite::GetProfileDirectory(Profile);
+            const FString BaselinePath = Directory / TEXT("baseline.json");
+
+            // Loaded before running, so a missing baseline does not cost a whole run
+            FCardanoBenchmarkBaseline Baseline;
+            FString BaselineJson;
+            if (!bCapture && (!FFileHelper::LoadFileToString(BaselineJson, *BaselinePath) || !FCardanoBenchmarkSuite::FromJson(BaselineJson, Baseline)))
+            {
+                UE_LOG(LogCardano, Error, TEXT("Cardano.BenchmarkBaseline: no baseline at %s; run Cardano.BenchmarkBaseline capture first"), *BaselinePath);
+                if (bExit)
+                {
+                    FPlatformMisc::RequestExitWithStatus(false, 1);
+                }
+                return;
+            }
+
+            UE_LOG(LogCardano, Log, TEXT("Cardano.BenchmarkBaseline: %d repetitions on %s"), Config.Repetitions, *Profile);
+            FCardanoBenchmarkSuite::Run(Config, FOnCardanoBenchmarkSuiteComplete::CreateLambda(
+                [bCapture, bExit, Profile, Directory, BaselinePath, Baseline, Thresholds](const TArray<FCardanoBenchmarkSamples>& Samples)
+                {
+                    FCardanoBenchmarkBaseline Current;
+                    Current.Profile = Profile;
+                    Current.Date = FDateTime::UtcNow().ToIso8601();
+                    Current.LibraryVersion = UTF8_TO_TCHAR(cardano_get_lib_version());
+                    Current.Benchmarks = Samples;
+
+                    bool bFailed = false;
+                    if (bCapture)
+                    {
+                        bFailed = !save_run(Current, BaselinePath);
+                        if (!bFailed)
+                        {
+                            UE_LOG(LogCardano, Log, TEXT("Cardano.BenchmarkBaseline: captured %d cases to %s"), Samples.Num(), *BaselinePath);
+                        }
+                    }
+                    else
+                    {
+                        // Every compared run is kept next to the baseline, as the history a dashboard plots
+                        save_run(Current, Directory / FString::Printf(TEXT("run-%s.json"), *FDateTime::UtcNow().ToString(TEXT("%Y%m%d-%H%M%S"))));
+
+                        const FCardanoBenchmarkComparison Comparison = FCardanoBenchmarkSuite::Compare(Baseline, Current, Thresholds);
+                        bFailed = Comparison.Regressions > 0;
+                        log_lines(bFailed ? ELogVerbosity::Error : ELogVerbosity::Log, FCardanoBenchmarkSuite::FormatComparison(Comparison));
+                    }
+
+                    if (bExit)
+                    {
+                        FPlatformMisc::RequestExitWithStatus(false, bFailed ? 1 : 0);
+                    }
+                }));
+        }));
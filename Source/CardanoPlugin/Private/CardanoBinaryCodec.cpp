@@ -0,0 +1,574 @@
+#include "CardanoBinaryCodec.h"
+#include "CardanoStateDelta.h"
+
+/** Byte lengths of a policy id and of a transaction hash. */
+static const int32 POLICY_ID_BYTES = 28;
+static const int32 TX_HASH_BYTES = 32;
+
+/** Bound on lengths and counts read from archives that cannot tell how many bytes are left. */
+static const uint64 MAX_UNBOUNDED_LENGTH = 1 << 24;
+
+/** Tag of a token whose policy id is the previous token's; raw hex tags are even, string tags odd. */
+static const uint64 SAME_POLICY_TAG = 2;
+
+/** Fails the archive if Length more bytes cannot be read from it. */
+static bool CheckRemaining(FArchive& Ar, uint64 Length)
+{
+    const int64 Total = Ar.TotalSize();
+    const int64 Position = Ar.Tell();
+    const bool bFits = Total >= 0 && Position >= 0
+        ? Length <= static_cast<uint64>(FMath::Max<int64>(Total - Position, 0))
+        : Length <= MAX_UNBOUNDED_LENGTH;
+
+    if (!bFits)
+    {
+        Ar.SetError();
+    }
+    return bFits;
+}
+
+static bool IsHex(const FString& Text)
+{
+    for (const TCHAR Char : Text)
+    {
+        if (!FChar::IsHexDigit(Char))
+        {
+            return false;
+        }
+    }
+    return Text.Len() % 2 == 0;
+}
+
+static void WriteUtf8(FArchive& Ar, const FString& Text)
+{
+    const FTCHARToUTF8 Utf8(*Text);
+    uint64 Tag = (static_cast<uint64>(Utf8.Length()) << 1) | 1;
+    SerializeVarUInt(Ar, Tag);
+    Ar.Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+}
+
+/** Reads the bytes of a string whose odd tag was already read. */
+static void ReadUtf8(FArchive& Ar, uint64 Tag, FString& OutText)
+{
+    const uint64 Length = Tag >> 1;
+    if (!CheckRemaining(Ar, Length))
+    {
+        return;
+    }
+
+    TArray<uint8> Bytes;
+    Bytes.SetNumUninitialized(static_cast<int32>(Length));
+    Ar.Serialize(Bytes.GetData(), Bytes.Num());
+
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+    OutText = FString(Converted.Length(), Converted.Get());
+}
+
+static void WriteHex(FArchive& Ar, const FString& Hex, int32 ByteLength)
+{
+    const int32 Length = Hex.Len() / 2;
+    if (!IsHex(Hex) || (ByteLength > 0 && Length != ByteLength))
+    {
+        WriteUtf8(Ar, Hex);
+        return;
+    }
+
+    // Fixed-length fields only need to say they are raw
+    uint64 Tag = ByteLength > 0 ? 0 : static_cast<uint64>(Length) << 1;
+    SerializeVarUInt(Ar, Tag);
+
+    TArray<uint8> Bytes;
+    Bytes.SetNumUninitialized(Length);
+    HexToBytes(Hex, Bytes.GetData());
+    Ar.Serialize(Bytes.GetData(), Bytes.Num());
+}
+
+/** Reads the body of a hex field whose tag was already read. */
+static void ReadHex(FArchive& Ar, uint64 Tag, int32 ByteLength, FString& OutHex)
+{
+    if (Tag & 1)
+    {
+        ReadUtf8(Ar, Tag, OutHex);
+        return;
+    }
+
+    if (ByteLength > 0 && Tag != 0)
+    {
+        Ar.SetError();
+        return;
+    }
+
+    const uint64 Length = ByteLength > 0 ? ByteLength : Tag >> 1;
+    if (!CheckRemaining(Ar, Length))
+    {
+        return;
+    }
+
+    TArray<uint8> Bytes;
+    Bytes.SetNumUninitialized(static_cast<int32>(Length));
+    Ar.Serialize(Bytes.GetData(), Bytes.Num());
+    OutHex = BytesToHex(Bytes.GetData(), Bytes.Num()).ToLower();
+}
+
+void SerializeVarUInt(FArchive& Ar, uint64& Value)
+{
+    if (Ar.IsLoading())
+    {
+        Value = 0;
+        for (int32 Shift = 0; Shift < 64; Shift += 7)
+        {
+            uint8 Byte = 0;
+            Ar << Byte;
+            if (Ar.IsError())
+            {
+                return;
+            }
+
+            Value |= static_cast<uint64>(Byte & 0x7f) << Shift;
+            if ((Byte & 0x80) == 0)
+            {
+                return;
+            }
+        }
+
+        // More than ten bytes: not something this codec wrote
+        Ar.SetError();
+        return;
+    }
+
+    uint64 Remaining = Value;
+    do
+    {
+        uint8 Byte = static_cast<uint8>(Remaining & 0x7f);
+        Remaining >>= 7;
+        if (Remaining != 0)
+        {
+            Byte |= 0x80;
+        }
+        Ar << Byte;
+    }
+    while (Remaining != 0);
+}
+
+void SerializeVarInt(FArchive& Ar, int64& Value)
+{
+    uint64 ZigZag = (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+    SerializeVarUInt(Ar, ZigZag);
+
+    if (Ar.IsLoading())
+    {
+        Value = static_cast<int64>(ZigZag >> 1) ^ -static_cast<int64>(ZigZag & 1);
+    }
+}
+
+bool SerializeCount(FArchive& Ar, int32& Count)
+{
+    uint64 Value = static_cast<uint64>(FMath::Max(Count, 0));
+    SerializeVarUInt(Ar, Value);
+
+    if (Ar.IsLoading())
+    {
+        // Every element takes at least one byte
+        if (Ar.IsError() || Value > MAX_int32 || !CheckRemaining(Ar, Value))
+        {
+            Ar.SetError();
+            Count = 0;
+            return false;
+        }
+        Count = static_cast<int32>(Value);
+    }
+    return !Ar.IsError();
+}
+
+void SerializeHex(FArchive& Ar, FString& Hex, int32 ByteLength)
+{
+    if (!Ar.IsLoading())
+    {
+        WriteHex(Ar, Hex, ByteLength);
+        return;
+    }
+
+    uint64 Tag = 0;
+    SerializeVarUInt(Ar, Tag);
+    if (!Ar.IsError())
+    {
+        ReadHex(Ar, Tag, ByteLength, Hex);
+    }
+}
+
+void SerializeQuantity(FArchive& Ar, FString& Quantity)
+{
+    if (Ar.IsLoading())
+    {
+        uint64 Tag = 0;
+        SerializeVarUInt(Ar, Tag);
+        if (Ar.IsError())
+        {
+            return;
+        }
+
+        if (Tag & 1)
+        {
+            ReadUtf8(Ar, Tag, Quantity);
+        }
+        else
+        {
+            Quantity = FString::Printf(TEXT("%llu"), static_cast<unsigned long long>(Tag >> 1));
+        }
+        return;
+    }
+
+    // Only canonical decimals take the short form, so the string read back is the one written
+    const uint64 Value = FCString::Strtoui64(*Quantity, nullptr, 10);
+    if (Value < (1ULL << 63) && Quantity == FString::Printf(TEXT("%llu"), static_cast<unsigned long long>(Value)))
+    {
+        uint64 Tag = Value << 1;
+        SerializeVarUInt(Ar, Tag);
+        return;
+    }
+
+    WriteUtf8(Ar, Quantity);
+}
+
+void SerializeTokens(FArchive& Ar, TArray<FTokenBalance>& Tokens)
+{
+    int32 Count = Tokens.Num();
+    if (!SerializeCount(Ar, Count))
+    {
+        return;
+    }
+
+    if (Ar.IsLoading())
+    {
+        Tokens.Reset(Count);
+    }
+
+    for (int32 i = 0; i < Count && !Ar.IsError(); i++)
+    {
+        FTokenBalance& Token = Ar.IsLoading() ? Tokens.AddDefaulted_GetRef() : Tokens[i];
+        const FTokenBalance* Previous = i > 0 ? &Tokens[i - 1] : nullptr;
+
+        // Collections hold many tokens of one policy, usually listed together
+        if (Ar.IsLoading())
+        {
+            uint64 Tag = 0;
+            SerializeVarUInt(Ar, Tag);
+            if (Tag == SAME_POLICY_TAG && Previous)
+            {
+                Token.PolicyId = Previous->PolicyId;
+            }
+            else
+            {
+                ReadHex(Ar, Tag, POLICY_ID_BYTES, Token.PolicyId);
+            }
+        }
+        else if (Previous && Previous->PolicyId == Token.PolicyId)
+        {
+            uint64 Tag = SAME_POLICY_TAG;
+            SerializeVarUInt(Ar, Tag);
+        }
+        else
+        {
+            WriteHex(Ar, Token.PolicyId, POLICY_ID_BYTES);
+        }
+
+        SerializeHex(Ar, Token.AssetName, 0);
+        SerializeQuantity(Ar, Token.Quantity);
+    }
+}
+
+FString GetUTxOKey(const FUTxO& UTxO)
+{
+    return FString::Printf(TEXT("%s#%d"), *UTxO.TxHash, UTxO.TxIndex);
+}
+
+bool FTokenBalance::Serialize(FArchive& Ar)
+{
+    SerializeHex(Ar, PolicyId, POLICY_ID_BYTES);
+    SerializeHex(Ar, AssetName, 0);
+    SerializeQuantity(Ar, Quantity);
+    return true;
+}
+
+bool FTokenBalance::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Serialize(Ar);
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
+
+bool FAddressBalance::Serialize(FArchive& Ar)
+{
+    SerializeVarInt(Ar, Lovelace);
+    SerializeTokens(Ar, Tokens);
+    return true;
+}
+
+bool FAddressBalance::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Serialize(Ar);
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
+
+bool FUTxO::Serialize(FArchive& Ar)
+{
+    SerializeHex(Ar, TxHash, TX_HASH_BYTES);
+
+    int64 Index = TxIndex;
+    SerializeVarInt(Ar, Index);
+    TxIndex = static_cast<int32>(Index);
+
+    SerializeVarInt(Ar, Value);
+    SerializeTokens(Ar, Assets);
+    return true;
+}
+
+bool FUTxO::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Serialize(Ar);
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
+
+/** Ascending indices as gaps from the previous one, which keeps them to a byte each when changes are dense. */
+static void WriteIndices(FArchive& Ar, const TArray<int32>& Indices)
+{
+    int32 Count = Indices.Num();
+    SerializeCount(Ar, Count);
+
+    int32 Last = -1;
+    for (const int32 Index : Indices)
+    {
+        uint64 Gap = static_cast<uint64>(Index - Last - 1);
+        SerializeVarUInt(Ar, Gap);
+        Last = Index;
+    }
+}
+
+static bool ReadIndices(FArchive& Ar, int32 Limit, TArray<int32>& OutIndices)
+{
+    int32 Count = 0;
+    if (!SerializeCount(Ar, Count) || Count > Limit)
+    {
+        Ar.SetError();
+        return false;
+    }
+
+    OutIndices.Reset(Count);
+    int64 Last = -1;
+    for (int32 i = 0; i < Count; i++)
+    {
+        uint64 Gap = 0;
+        SerializeVarUInt(Ar, Gap);
+        if (Ar.IsError() || Gap >= static_cast<uint64>(Limit - Last - 1))
+        {
+            Ar.SetError();
+            return false;
+        }
+
+        Last += static_cast<int64>(Gap) + 1;
+        OutIndices.Add(static_cast<int32>(Last));
+    }
+    return true;
+}
+
+void FCardanoStateDelta::WriteUTxOs(FArchive& Ar, const TArray<FUTxO>& Previous, const TArray<FUTxO>& Current)
+{
+    check(!Ar.IsLoading());
+
+    TSet<FString> CurrentKeys;
+    CurrentKeys.Reserve(Current.Num());
+    for (const FUTxO& UTxO : Current)
+    {
+        CurrentKeys.Add(GetUTxOKey(UTxO));
+    }
+
+    TSet<FString> PreviousKeys;
+    PreviousKeys.Reserve(Previous.Num());
+    TArray<int32> Spent;
+    for (int32 i = 0; i < Previous.Num(); i++)
+    {
+        const FString Key = GetUTxOKey(Previous[i]);
+        PreviousKeys.Add(Key);
+        if (!CurrentKeys.Contains(Key))
+        {
+            Spent.Add(i);
+        }
+    }
+
+    WriteIndices(Ar, Spent);
+
+    TArray<FUTxO> Created;
+    for (const FUTxO& UTxO : Current)
+    {
+        if (!PreviousKeys.Contains(GetUTxOKey(UTxO)))
+        {
+            Created.Add(UTxO);
+        }
+    }
+
+    int32 Count = Created.Num();
+    SerializeCount(Ar, Count);
+    for (FUTxO& UTxO : Created)
+    {
+        UTxO.Serialize(Ar);
+    }
+}
+
+bool FCardanoStateDelta::ReadUTxOs(FArchive& Ar, const TArray<FUTxO>& Previous, TArray<FUTxO>& OutCurrent)
+{
+    check(Ar.IsLoading());
+
+    TArray<int32> Spent;
+    if (!ReadIndices(Ar, Previous.Num(), Spent))
+    {
+        return false;
+    }
+
+    int32 Count = 0;
+    if (!SerializeCount(Ar, Count))
+    {
+        return false;
+    }
+
+    TArray<FUTxO> Current;
+    Current.Reserve(Previous.Num() - Spent.Num() + Count);
+
+    int32 NextSpent = 0;
+    for (int32 i = 0; i < Previous.Num(); i++)
+    {
+        if (NextSpent < Spent.Num() && Spent[NextSpent] == i)
+        {
+            ++NextSpent;
+            continue;
+        }
+        Current.Add(Previous[i]);
+    }
+
+    for (int32 i = 0; i < Count && !Ar.IsError(); i++)
+    {
+        Current.AddDefaulted_GetRef().Serialize(Ar);
+    }
+
+    if (Ar.IsError())
+    {
+        return false;
+    }
+
+    OutCurrent = MoveTemp(Current);
+    return true;
+}
+
+void FCardanoStateDelta::WriteBalance(FArchive& Ar, const FAddressBalance& Previous, const FAddressBalance& Current)
+{
+    check(!Ar.IsLoading());
+
+    int64 LovelaceDelta = static_cast<int64>(static_cast<uint64>(Current.Lovelace) - static_cast<uint64>(Previous.Lovelace));
+    SerializeVarInt(Ar, LovelaceDelta);
+
+    // Balances may list one asset several times, once per UTxO holding it; occurrences are matched in order
+    TMap<FString, TArray<int32>> CurrentByAsset;
+    for (int32 i = 0; i < Current.Tokens.Num(); i++)
+    {
+        CurrentByAsset.FindOrAdd(Current.Tokens[i].PolicyId + Current.Tokens[i].AssetName).Add(i);
+    }
+
+    TMap<FString, int32> Matched;
+    TBitArray<> CurrentMatched(false, Current.Tokens.Num());
+    TArray<int32> Removed;
+    TArray<int32> Changed;
+    TArray<FString> ChangedQuantities;
+    for (int32 i = 0; i < Previous.Tokens.Num(); i++)
+    {
+        const FString Key = Previous.Tokens[i].PolicyId + Previous.Tokens[i].AssetName;
+        const TArray<int32>* Occurrences = CurrentByAsset.Find(Key);
+        int32& Used = Matched.FindOrAdd(Key, 0);
+        if (!Occurrences || Used >= Occurrences->Num())
+        {
+            Removed.Add(i);
+            continue;
+        }
+
+        const int32 Match = (*Occurrences)[Used++];
+        CurrentMatched[Match] = true;
+        if (Current.Tokens[Match].Quantity != Previous.Tokens[i].Quantity)
+        {
+            Changed.Add(i);
+            ChangedQuantities.Add(Current.Tokens[Match].Quantity);
+        }
+    }
+
+    WriteIndices(Ar, Removed);
+    WriteIndices(Ar, Changed);
+    for (FString& Quantity : ChangedQuantities)
+    {
+        SerializeQuantity(Ar, Quantity);
+    }
+
+    TArray<FTokenBalance> Added;
+    for (int32 i = 0; i < Current.Tokens.Num(); i++)
+    {
+        if (!CurrentMatched[i])
+        {
+            Added.Add(Current.Tokens[i]);
+        }
+    }
+    SerializeTokens(Ar, Added);
+}
+
+bool FCardanoStateDelta::ReadBalance(FArchive& Ar, const FAddressBalance& Previous, FAddressBalance& OutCurrent)
+{
+    check(Ar.IsLoading());
+
+    int64 LovelaceDelta = 0;
+    SerializeVarInt(Ar, LovelaceDelta);
+
+    TArray<int32> Removed;
+    TArray<int32> Changed;
+    if (Ar.IsError() || !ReadIndices(Ar, Previous.Tokens.Num(), Removed) || !ReadIndices(Ar, Previous.Tokens.Num(), Changed))
+    {
+        return false;
+    }
+
+    FAddressBalance Current;
+    Current.Lovelace = static_cast<int64>(static_cast<uint64>(Previous.Lovelace) + static_cast<uint64>(LovelaceDelta));
+
+    TArray<FString> Quantities;
+    Quantities.SetNum(Previous.Tokens.Num());
+    for (const int32 Index : Changed)
+    {
+        SerializeQuantity(Ar, Quantities[Index]);
+    }
+
+    TArray<FTokenBalance> Added;
+    SerializeTokens(Ar, Added);
+    if (Ar.IsError())
+    {
+        return false;
+    }
+
+    int32 NextRemoved = 0;
+    int32 NextChanged = 0;
+    Current.Tokens.Reserve(Previous.Tokens.Num() - Removed.Num() + Added.Num());
+    for (int32 i = 0; i < Previous.Tokens.Num(); i++)
+    {
+        const bool bChanged = NextChanged < Changed.Num() && Changed[NextChanged] == i;
+        NextChanged += bChanged ? 1 : 0;
+        if (NextRemoved < Removed.Num() && Removed[NextRemoved] == i)
+        {
+            ++NextRemoved;
+            continue;
+        }
+
+        FTokenBalance& Token = Current.Tokens.Add_GetRef(Previous.Tokens[i]);
+        if (bChanged)
+        {
+            Token.Quantity = Quantities[i];
+        }
+    }
+    Current.Tokens.Append(MoveTemp(Added));
+
+    OutCurrent = MoveTemp(Current);
+    return true;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoTypes.h"
+
+/**
+ * Building blocks of the compact binary form of the plugin types, shared by their Serialize methods and
+ * FCardanoStateDelta. Each function both reads and writes depending on Ar.IsLoading(), and flags malformed input
+ * with Ar.SetError() instead of asserting, since replicated bytes come from the network.
+ */
+
+/** LEB128: seven bits per byte, so values below 128 take one byte. */
+void SerializeVarUInt(FArchive& Ar, uint64& Value);
+
+/** Zig-zag mapped so small negative values stay short. */
+void SerializeVarInt(FArchive& Ar, int64& Value);
+
+/** Reads an element count, rejecting counts larger than the bytes left could hold. */
+bool SerializeCount(FArchive& Ar, int32& Count);
+
+/**
+ * Hex strings of ByteLength bytes as raw bytes, or any length when ByteLength is 0. Strings that are not such hex
+ * are written as they are; the leading varint tells both forms apart. Loaded hex is lower case.
+ */
+void SerializeHex(FArchive& Ar, FString& Hex, int32 ByteLength);
+
+/** Decimal quantities that fit in 64 bits as a varint, anything else as a string. */
+void SerializeQuantity(FArchive& Ar, FString& Quantity);
+
+/** A token list; tokens of the same policy as the previous one do not repeat the policy id. */
+void SerializeTokens(FArchive& Ar, TArray<FTokenBalance>& Tokens);
+
+/** Identity of a UTxO, "TxHash#TxIndex". */
+FString GetUTxOKey(const FUTxO& UTxO);
@@ -1,4 +1,20 @@
 #include "CardanoBlueprintLibrary.h"
+#include "CardanoChainTip.h"
+#include "CardanoFrameScheduler.h"
+#include "CardanoHandle.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoLog.h"
+#include "CardanoMinAda.h"
+#include "CardanoMnemonic.h"
+#include "CardanoNative.h"
+#include "CardanoPaymentKeyIndex.h"
+#include "CardanoProtocolParamsCache.h"
+#include "CardanoQuantity.h"
+#include "CardanoSigningPipeline.h"
+#include "CardanoStats.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "CardanoWarmUp.h"
 #include "CoreMinimal.h"
 #include <cardano/bip39.h>
 #include <cardano/error.h>
@@ -17,122 +33,153 @@
 #include <cardano/key_handlers/software_secure_key_handler.h>
 #include "cardano/key_handlers/secure_key_handler.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
 #include "Misc/OutputDeviceDebug.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include <cardano/cardano.h>
 #include <sodium.h>
 
 cardano_credential_t* create_credential(cardano_ed25519_public_key_t* public_key)
 {
-    cardano_blake2b_hash_t* hash = nullptr;
-    cardano_error_t result = cardano_ed25519_public_key_to_hash(public_key, &hash);
-
-    if (result != CARDANO_SUCCESS) {
+    TCardanoRef<cardano_blake2b_hash_t> Hash;
+    cardano_credential_t* credential = nullptr;
+    if (cardano_ed25519_public_key_to_hash(public_key, Hash.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_credential_new(Hash.Get(), CARDANO_CREDENTIAL_TYPE_KEY_HASH, &credential) != CARDANO_SUCCESS) {
         return nullptr;
     }
 
-    cardano_credential_t* credential = nullptr;
-    result = cardano_credential_new(hash, CARDANO_CREDENTIAL_TYPE_KEY_HASH, &credential);
-    cardano_blake2b_hash_unref(&hash);
-
     return credential;
 }
 
-cardano_address_t* create_address_from_derivation_paths(
-    cardano_secure_key_handler_t* key_handler,
-    cardano_account_derivation_path_t account_path,
-    uint32_t payment_index,
-    uint32_t stake_key_index)
+cardano_credential_t* derive_credential(cardano_bip32_public_key_t* account_public_key, uint32_t role, uint32_t index)
 {
-    cardano_bip32_public_key_t* root_public_key = nullptr;
-    cardano_error_t result = cardano_secure_key_handler_bip32_get_extended_account_public_key(
-        key_handler, account_path, &root_public_key);
+    const uint32_t derivation_path[] = { role, index };
 
-    if (result != CARDANO_SUCCESS) {
+    TCardanoRef<cardano_bip32_public_key_t> ChildPublicKey;
+    TCardanoRef<cardano_ed25519_public_key_t> ChildKey;
+    if (cardano_bip32_public_key_derive(account_public_key, derivation_path, 2, ChildPublicKey.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_bip32_public_key_to_ed25519_key(ChildPublicKey.Get(), ChildKey.GetInitReference()) != CARDANO_SUCCESS) {
         return nullptr;
     }
 
-    const uint32_t payment_key_derivation_path[] = {
-        CARDANO_CIP_1852_ROLE_EXTERNAL,
-        payment_index
-    };
-
-    const uint32_t stake_key_derivation_path[] = {
-        CARDANO_CIP_1852_ROLE_STAKING,
-        stake_key_index
-    };
-
-    cardano_bip32_public_key_t* payment_public_key = nullptr;
-    cardano_bip32_public_key_t* stake_public_key = nullptr;
-    cardano_ed25519_public_key_t* payment_key = nullptr;
-    cardano_ed25519_public_key_t* stake_key = nullptr;
+    return create_credential(ChildKey.Get());
+}
 
-    result = cardano_bip32_public_key_derive(root_public_key, payment_key_derivation_path, 2, &payment_public_key);
-    if (result != CARDANO_SUCCESS) {
-        cardano_bip32_public_key_unref(&root_public_key);
+cardano_address_t* create_base_address(cardano_credential_t* payment_cred, cardano_credential_t* stake_cred)
+{
+    if (!payment_cred || !stake_cred) {
         return nullptr;
     }
 
-    result = cardano_bip32_public_key_derive(root_public_key, stake_key_derivation_path, 2, &stake_public_key);
-    if (result != CARDANO_SUCCESS) {
-        cardano_bip32_public_key_unref(&root_public_key);
-        cardano_bip32_public_key_unref(&payment_public_key);
+    TCardanoRef<cardano_base_address_t> BaseAddress;
+    if (cardano_base_address_from_credentials(CARDANO_NETWORK_ID_MAIN_NET, payment_cred, stake_cred, BaseAddress.GetInitReference()) != CARDANO_SUCCESS) {
         return nullptr;
     }
 
-    result = cardano_bip32_public_key_to_ed25519_key(payment_public_key, &payment_key);
-    if (result != CARDANO_SUCCESS) {
-        cardano_bip32_public_key_unref(&root_public_key);
-        cardano_bip32_public_key_unref(&payment_public_key);
-        cardano_bip32_public_key_unref(&stake_public_key);
+    return cardano_base_address_to_address(BaseAddress.Get());
+}
+
+cardano_address_t* create_address_from_derivation_paths(
+    cardano_secure_key_handler_t* key_handler,
+    cardano_account_derivation_path_t account_path,
+    uint32_t payment_index,
+    uint32_t stake_key_index)
+{
+    CARDANO_SCOPE(CardanoKeyDerivation);
+
+    TCardanoRef<cardano_bip32_public_key_t> RootPublicKey;
+    if (cardano_secure_key_handler_bip32_get_extended_account_public_key(key_handler, account_path, RootPublicKey.GetInitReference()) != CARDANO_SUCCESS) {
         return nullptr;
     }
 
-    result = cardano_bip32_public_key_to_ed25519_key(stake_public_key, &stake_key);
-    if (result != CARDANO_SUCCESS) {
-        cardano_bip32_public_key_unref(&root_public_key);
-        cardano_bip32_public_key_unref(&payment_public_key);
-        cardano_bip32_public_key_unref(&stake_public_key);
-        cardano_ed25519_public_key_unref(&payment_key);
-        return nullptr;
+    const TCardanoRef<cardano_credential_t> PaymentCredential(derive_credential(RootPublicKey.Get(), CARDANO_CIP_1852_ROLE_EXTERNAL, payment_index));
+    const TCardanoRef<cardano_credential_t> StakeCredential(derive_credential(RootPublicKey.Get(), CARDANO_CIP_1852_ROLE_STAKING, stake_key_index));
+    return create_base_address(PaymentCredential.Get(), StakeCredential.Get());
+}
+
+/** State of one GetAddressUTXOsPaged call, shared by its page requests. */
+struct FPagedUTxOQuery
+{
+    FString Address;
+    int32 PageSize = 0;
+    int32 PagesFetched = 0;
+    int32 LastPageRows = 0;
+    TArray<FUTxO> UTxOs;
+    FOnUTxOPageProgress OnProgress;
+    FOnPagedUTxOsResult OnComplete;
+};
+
+void RequestUTxOPage(TSharedRef<FPagedUTxOQuery> Query)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        Query->OnComplete.ExecuteIfBound(false, Query->UTxOs, TEXT("Koios client is not available"));
+        return;
     }
 
-    cardano_base_address_t* base_address = nullptr;
-    cardano_credential_t* payment_cred = create_credential(payment_key);
-    cardano_credential_t* stake_cred = create_credential(stake_key);
+    // A stable order keeps rows from shifting between pages
+    const FString Path = FString::Printf(TEXT("address_utxos?order=tx_hash.asc,tx_index.asc&offset=%d&limit=%d"),
+        Query->PagesFetched * Query->PageSize, Query->PageSize);
 
-    result = cardano_base_address_from_credentials(CARDANO_NETWORK_ID_MAIN_NET, payment_cred, stake_cred, &base_address);
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
+        Koios->CreateJsonPost(Path, UCardanoKoiosClient::MakeAddressesBody({ Query->Address }));
 
-    // Cleanup
-    cardano_bip32_public_key_unref(&root_public_key);
-    cardano_bip32_public_key_unref(&payment_public_key);
-    cardano_bip32_public_key_unref(&stake_public_key);
-    cardano_credential_unref(&payment_cred);
-    cardano_credential_unref(&stake_cred);
-    cardano_ed25519_public_key_unref(&payment_key);
-    cardano_ed25519_public_key_unref(&stake_key);
+    HttpRequest->OnProcessRequestComplete().BindLambda([Query](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!Success || !Response.IsValid())
+            {
+                Query->OnComplete.ExecuteIfBound(false, Query->UTxOs, TEXT("Network request failed"));
+                return;
+            }
 
-    if (result != CARDANO_SUCCESS) {
-        return nullptr;
-    }
+            Query->UTxOs.Reserve(Query->UTxOs.Num() + Query->PageSize);
+
+            // Only this query's chain of page requests touches Query, one page at a time
+            DecodeKoiosResponse(Response,
+                [Query](const TArray<uint8>& Content)
+                {
+                    return DecodeUTxORows(Content,
+                        [&Query](FString&&, FUTxO&& UTxO) { Query->UTxOs.Add(MoveTemp(UTxO)); },
+                        Query->LastPageRows);
+                },
+                [Query](bool bDecoded)
+                {
+                    if (!bDecoded)
+                    {
+                        Query->OnComplete.ExecuteIfBound(false, Query->UTxOs, TEXT("Invalid response format"));
+                        return;
+                    }
+
+                    Query->PagesFetched++;
+                    Query->OnProgress.ExecuteIfBound(Query->PagesFetched, Query->UTxOs.Num());
+
+                    if (Query->LastPageRows < Query->PageSize)
+                    {
+                        Query->UTxOs.Shrink();
+                        Query->OnComplete.ExecuteIfBound(true, Query->UTxOs, TEXT(""));
+                        return;
+                    }
+
+                    RequestUTxOPage(Query);
+                });
+        });
 
-    cardano_address_t* address = cardano_base_address_to_address(base_address);
-    cardano_base_address_unref(&base_address);
-    return address;
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
 }
 
 void UCardanoBlueprintLibrary::GenerateWallet(TArray<FString>& OutMnemonicWords, FString& OutAddress)
 {
-    UE_LOG(LogTemp, Warning, TEXT("Starting wallet generation..."));
+    FCardanoOperationLog OperationLog(TEXT("GenerateWallet"));
 
-    if (sodium_init() < 0) {
-        UE_LOG(LogTemp, Error, TEXT("Libsodium initialization failed"));
+    if (!FCardanoWarmUp::InitializeSodium()) {
+        UE_LOG(LogCardano, Error, TEXT("Libsodium initialization failed"));
         return;
     }
-    UE_LOG(LogTemp, Warning, TEXT("Libsodium initialized successfully"));
 
     byte_t entropy[32];
     randombytes_buf(entropy, sizeof(entropy));
-    UE_LOG(LogTemp, Warning, TEXT("Generated %d bytes of entropy"), sizeof(entropy));
 
     const char* word_array[24] = { nullptr };
     size_t word_count = 0;
@@ -145,56 +192,49 @@ void UCardanoBlueprintLibrary::GenerateWallet(TArray<FString>& OutMnemonicWords,
     );
 
     if (result != CARDANO_SUCCESS || word_count == 0) {
-        UE_LOG(LogTemp, Error, TEXT("Mnemonic generation failed: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+        UE_LOG(LogCardano, Error, TEXT("Mnemonic generation failed: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
         return;
     }
-    UE_LOG(LogTemp, Warning, TEXT("Generated %d mnemonic words"), word_count);
 
     OutMnemonicWords.Empty();
     for (size_t i = 0; i < word_count; i++) {
         FString Word = UTF8_TO_TCHAR(word_array[i]);
         OutMnemonicWords.Add(Word);
-        UE_LOG(LogTemp, Warning, TEXT("Word %d: %s"), i + 1, *Word);
     }
 
     const TCHAR* PassphraseStr = TEXT("password");
     const char* PassphraseUtf8 = TCHAR_TO_UTF8(PassphraseStr);
-    UE_LOG(LogTemp, Warning, TEXT("Using passphrase: %s"), PassphraseStr);
 
-    cardano_secure_key_handler_t* key_handler = nullptr;
+    TCardanoRef<cardano_secure_key_handler_t> KeyHandler;
     result = cardano_software_secure_key_handler_new(
         entropy,
         sizeof(entropy),
         (const byte_t*)PassphraseUtf8,
         strlen(PassphraseUtf8),
         &GetPassphrase,
-        &key_handler
+        KeyHandler.GetInitReference()
     );
 
-    if (result != CARDANO_SUCCESS || !key_handler) {
-        UE_LOG(LogTemp, Error, TEXT("Key handler creation failed: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+    if (result != CARDANO_SUCCESS || !KeyHandler) {
+        UE_LOG(LogCardano, Error, TEXT("Key handler creation failed: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
         return;
     }
-    UE_LOG(LogTemp, Warning, TEXT("Key handler created successfully"));
 
-    cardano_address_t* address = create_address_from_derivation_paths(
-        key_handler,
+    const TCardanoRef<cardano_address_t> Address(create_address_from_derivation_paths(
+        KeyHandler.Get(),
         ACCOUNT_DERIVATION_PATH,
         0,
         0
-    );
+    ));
 
-    if (address) {
-        OutAddress = UTF8_TO_TCHAR(cardano_address_get_string(address));
-        UE_LOG(LogTemp, Warning, TEXT("Generated address: %s"), *OutAddress);
-        cardano_address_unref(&address);
+    if (Address) {
+        OutAddress = UTF8_TO_TCHAR(cardano_address_get_string(Address.Get()));
+        UE_LOG(LogCardano, Verbose, TEXT("Generated address: %s"), *OutAddress);
+        OperationLog.Finish(true);
     }
     else {
-        UE_LOG(LogTemp, Error, TEXT("Address generation failed"));
+        UE_LOG(LogCardano, Error, TEXT("Address generation failed"));
     }
-
-    cardano_secure_key_handler_unref(&key_handler);
-    UE_LOG(LogTemp, Warning, TEXT("Wallet generation completed"));
 }
 
 int32 UCardanoBlueprintLibrary::GetPassphrase(byte_t* buffer, size_t buffer_len)
@@ -214,196 +254,725 @@ int32 UCardanoBlueprintLibrary::GetPassphrase(byte_t* buffer, size_t buffer_len)
 
 void UCardanoBlueprintLibrary::RestoreWallet(const TArray<FString>& MnemonicWords, FString& OutAddress, const FString& Password)
 {
-    UE_LOG(LogTemp, Warning, TEXT("Starting wallet restoration..."));
+    FCardanoOperationLog OperationLog(TEXT("RestoreWallet"));
 
-    if (sodium_init() < 0) {
-        UE_LOG(LogTemp, Error, TEXT("Libsodium initialization failed"));
+    if (!FCardanoWarmUp::InitializeSodium()) {
+        UE_LOG(LogCardano, Error, TEXT("Libsodium initialization failed"));
         return;
     }
 
-    // Validate mnemonic word count
-    if (MnemonicWords.Num() != 24) {
-        UE_LOG(LogTemp, Error, TEXT("Invalid mnemonic word count. Expected 24, got %d"), MnemonicWords.Num());
-        return;
-    }
-
-    // Convert and sanitize mnemonic words to C-style array
-    const char* word_array[24] = { nullptr };
-    for (int32 i = 0; i < MnemonicWords.Num(); i++) {
-        // Trim whitespace and convert to lowercase
-        FString SanitizedWord = MnemonicWords[i].TrimStartAndEnd().ToLower();
-
-        // Remove any non-ascii characters
-        FString CleanWord;
-        for (TCHAR Character : SanitizedWord) {
-            if (Character >= 32 && Character <= 126) {
-                CleanWord.AppendChar(Character);
-            }
-        }
-
-        // Allocate memory for the C string that will persist through function
-        char* word = (char*)malloc(CleanWord.Len() + 1);
-        if (!word) {
-            // Clean up previously allocated strings
-            for (int32 j = 0; j < i; j++) {
-                free((void*)word_array[j]);
-            }
-            UE_LOG(LogTemp, Error, TEXT("Memory allocation failed"));
-            return;
-        }
-
-        FCStringAnsi::Strcpy(word, CleanWord.Len() + 1, TCHAR_TO_UTF8(*CleanWord));
-        word_array[i] = word;
-
-        UE_LOG(LogTemp, Warning, TEXT("Sanitized word %d: %s"), i + 1, *CleanWord);
-    }
-
     // Convert mnemonic to entropy
     byte_t entropy[64] = { 0 };
     size_t entropy_size = 0;
 
-    cardano_error_t result = cardano_bip39_mnemonic_words_to_entropy(
-        word_array,
-        24,  // Explicitly specify 24 words
-        entropy,
-        sizeof(entropy),
-        &entropy_size
-    );
-
-    // Free allocated word strings
-    for (int32 i = 0; i < 24; i++) {
-        free((void*)word_array[i]);
-    }
-
-    if (result != CARDANO_SUCCESS) {
-        UE_LOG(LogTemp, Error, TEXT("Failed to convert mnemonic to entropy: %s"),
-            UTF8_TO_TCHAR(cardano_error_to_string(result)));
+    if (!mnemonic_to_entropy(MnemonicWords, entropy, sizeof(entropy), &entropy_size)) {
         return;
     }
 
     // Create key handler with provided password
     FString SanitizedPassword = Password.TrimStartAndEnd();
     const char* PassphraseUtf8 = TCHAR_TO_UTF8(*SanitizedPassword);
-    cardano_secure_key_handler_t* key_handler = nullptr;
+    TCardanoRef<cardano_secure_key_handler_t> KeyHandler;
 
-    result = cardano_software_secure_key_handler_new(
+    cardano_error_t result = cardano_software_secure_key_handler_new(
         entropy,
         entropy_size,
         (const byte_t*)PassphraseUtf8,
         strlen(PassphraseUtf8),
         &GetPassphrase,
-        &key_handler
+        KeyHandler.GetInitReference()
     );
+    sodium_memzero(entropy, sizeof(entropy));
 
-    if (result != CARDANO_SUCCESS || !key_handler) {
-        UE_LOG(LogTemp, Error, TEXT("Key handler creation failed: %s"),
+    if (result != CARDANO_SUCCESS || !KeyHandler) {
+        UE_LOG(LogCardano, Error, TEXT("Key handler creation failed: %s"),
             UTF8_TO_TCHAR(cardano_error_to_string(result)));
         return;
     }
 
     // Generate address using the same derivation path as wallet creation
-    cardano_address_t* address = create_address_from_derivation_paths(
-        key_handler,
+    const TCardanoRef<cardano_address_t> Address(create_address_from_derivation_paths(
+        KeyHandler.Get(),
         ACCOUNT_DERIVATION_PATH,
         0,  // payment index
         0   // stake key index
-    );
+    ));
 
-    if (address) {
-        OutAddress = UTF8_TO_TCHAR(cardano_address_get_string(address));
-        UE_LOG(LogTemp, Warning, TEXT("Restored address: %s"), *OutAddress);
-        cardano_address_unref(&address);
+    if (Address) {
+        OutAddress = UTF8_TO_TCHAR(cardano_address_get_string(Address.Get()));
+        UE_LOG(LogCardano, Verbose, TEXT("Restored address: %s"), *OutAddress);
+        OperationLog.Finish(true);
     }
     else {
-        UE_LOG(LogTemp, Error, TEXT("Address restoration failed"));
+        UE_LOG(LogCardano, Error, TEXT("Address restoration failed"));
+    }
+}
+
+bool UCardanoBlueprintLibrary::DeriveAccountPublicKey(
+    const TArray<FString>& MnemonicWords,
+    int32 AccountIndex,
+    const FString& Password,
+    TArray<uint8>& OutAccountKey)
+{
+    FString Error;
+    const FCardanoWallet Wallet = FCardanoWallet::FromMnemonic(MnemonicWords, Password, AccountIndex, Error);
+    if (!Wallet.IsValid()) {
+        UE_LOG(LogCardano, Error, TEXT("%s"), *Error);
+        return false;
     }
 
-    cardano_secure_key_handler_unref(&key_handler);
-    UE_LOG(LogTemp, Warning, TEXT("Wallet restoration completed"));
+    OutAccountKey = TArray<uint8>(Wallet.GetAccountPublicKey());
+    return true;
 }
 
-void UCardanoBlueprintLibrary::GetAddressBalance(const FString& Address, FAddressBalance& OutBalance, const FOnBalanceResult& OnComplete)
+/**
+ * Payment keys of every address derived by DeriveAddresses and DiscoverWalletAddresses, whichever mnemonic they came
+ * from, so the transactions spending from those addresses find their signing paths without a derivation search.
+ */
+static FCardanoPaymentKeyIndex GDerivedKeys;
+static FRWLock GDerivedKeysLock;
+
+static void index_derived_keys(int32 AccountIndex, int32 Role, int32 StartIndex, const TArray<FCardanoHash28>& KeyHashes)
+{
+    FRWScopeLock Lock(GDerivedKeysLock, SLT_Write);
+    GDerivedKeys.AddRange(AccountIndex, Role, StartIndex, KeyHashes);
+}
+
+static bool find_derived_key(const FString& Address, FCardanoKeyLocation& OutLocation)
+{
+    FCardanoHash28 KeyHash;
+    if (!FCardanoPaymentKeyIndex::ReadPaymentKeyHash(Address, KeyHash)) {
+        return false;
+    }
+
+    FRWScopeLock Lock(GDerivedKeysLock, SLT_ReadOnly);
+    return GDerivedKeys.Find(KeyHash, OutLocation);
+}
+
+static cardano_network_id_t ToNetworkId(ECardanoNetwork Network)
 {
-    FString Url = TEXT("https://api.koios.rest/api/v1/address_info");
+    return Network == ECardanoNetwork::Mainnet ? CARDANO_NETWORK_ID_MAIN_NET : CARDANO_NETWORK_ID_TEST_NET;
+}
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-    HttpRequest->SetVerb("POST");
-    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+// The factory writes the key hashes of a chunk straight into its FCardanoHash28 array
+static_assert(sizeof(FCardanoHash28) == FCardanoHash28::Size, "FCardanoHash28 must hold nothing but its bytes");
 
-    // Create request body
-    TSharedPtr<FJsonObject> RequestObj = MakeShared<FJsonObject>();
-    TArray<TSharedPtr<FJsonValue>> AddressArray;
-    AddressArray.Add(MakeShared<FJsonValueString>(Address));
-    RequestObj->SetArrayField("_addresses", AddressArray);
+bool derive_base_addresses(TArrayView<const uint8> AccountKey, int32 Role, int32 StartIndex, int32 Count, TArray<FString>& OutAddresses, TArray<FCardanoHash28>* OutKeyHashes,
+    cardano_network_id_t NetworkId)
+{
+    CARDANO_SCOPE(CardanoKeyDerivation);
 
-    FString RequestBody;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(RequestObj.ToSharedRef(), Writer);
+    OutAddresses.SetNum(Count);
+    if (OutKeyHashes) {
+        OutKeyHashes->SetNum(Count);
+    }
 
-    HttpRequest->SetContentAsString(RequestBody);
-    HttpRequest->SetURL(Url);
+    // cardano-c objects are not thread safe, so every chunk works on its own copy of the account key
+    const int32 ChunkSize = 64;
+    const int32 NumChunks = FMath::DivideAndRoundUp(Count, ChunkSize);
+    const size_t SlotSize = cardano_address_factory_get_string_size(CARDANO_ADDRESS_FACTORY_KIND_BASE, NetworkId);
+    TAtomic<bool> bFailed(false);
 
-    HttpRequest->OnProcessRequestComplete().BindLambda([OnComplete, &OutBalance](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+    ParallelFor(NumChunks, [&](int32 ChunkIndex)
         {
-            if (!Success || !Response.IsValid())
+            cardano_bip32_public_key_t* chunk_account_key = nullptr;
+            if (cardano_bip32_public_key_from_bytes(AccountKey.GetData(), AccountKey.Num(), &chunk_account_key) != CARDANO_SUCCESS) {
+                bFailed = true;
+                return;
+            }
+
+            const int32 First = ChunkIndex * ChunkSize;
+            const int32 Last = FMath::Min(First + ChunkSize, Count);
+            const int32 ChunkCount = Last - First;
+
+            // Only the keys are objects; the factory hashes them in one multi-buffer call and encodes straight to bech32
+            const uint32_t stake_path[] = { CARDANO_CIP_1852_ROLE_STAKING, 0 };
+            cardano_bip32_public_key_t* stake_public_key = nullptr;
+            cardano_ed25519_public_key_t* stake_key = nullptr;
+            if (cardano_bip32_public_key_derive(chunk_account_key, stake_path, 2, &stake_public_key) != CARDANO_SUCCESS ||
+                cardano_bip32_public_key_to_ed25519_key(stake_public_key, &stake_key) != CARDANO_SUCCESS) {
+                bFailed = true;
+            }
+            cardano_bip32_public_key_unref(&stake_public_key);
+
+            TArray<cardano_ed25519_public_key_t*> PaymentKeys;
+            PaymentKeys.SetNumZeroed(ChunkCount);
+
+            // The role node is derived once per chunk; every address after the first only derives its index
+            cardano_bip32_derivation_cache_t* derivation_cache = nullptr;
+            if (cardano_bip32_derivation_cache_new(0, &derivation_cache) != CARDANO_SUCCESS) {
+                bFailed = true;
+            }
+
+            for (int32 i = 0; i < ChunkCount && !bFailed; i++) {
+                const uint32_t derivation_path[] = { static_cast<uint32_t>(Role), static_cast<uint32_t>(StartIndex + First + i) };
+
+                cardano_bip32_public_key_t* child_public_key = nullptr;
+                if (cardano_bip32_derivation_cache_derive_public(derivation_cache, chunk_account_key, derivation_path, 2, &child_public_key) != CARDANO_SUCCESS ||
+                    cardano_bip32_public_key_to_ed25519_key(child_public_key, &PaymentKeys[i]) != CARDANO_SUCCESS) {
+                    bFailed = true;
+                }
+                cardano_bip32_public_key_unref(&child_public_key);
+            }
+
+            cardano_bip32_derivation_cache_unref(&derivation_cache);
+
+            TArray<ANSICHAR> Strings;
+            Strings.SetNumUninitialized(static_cast<int32>(SlotSize) * ChunkCount);
+            TArray<FCardanoHash28> ChunkHashes;
+            ChunkHashes.SetNum(ChunkCount);
+
+            if (!bFailed && cardano_address_factory_from_keys(CARDANO_ADDRESS_FACTORY_KIND_BASE, NetworkId,
+                PaymentKeys.GetData(), ChunkCount, &stake_key, 1,
+                ChunkHashes[0].Bytes, Strings.GetData(), Strings.Num()) != CARDANO_SUCCESS) {
+                bFailed = true;
+            }
+
+            for (int32 i = 0; i < ChunkCount && !bFailed; i++) {
+                OutAddresses[First + i] = ANSI_TO_TCHAR(&Strings[i * static_cast<int32>(SlotSize)]);
+
+                // Kept for FCardanoPaymentKeyIndex, so signing never has to derive keys to find these again
+                if (OutKeyHashes) {
+                    (*OutKeyHashes)[First + i] = ChunkHashes[i];
+                }
+            }
+
+            for (int32 i = 0; i < ChunkCount; i++) {
+                cardano_ed25519_public_key_unref(&PaymentKeys[i]);
+            }
+
+            cardano_ed25519_public_key_unref(&stake_key);
+            cardano_bip32_public_key_unref(&chunk_account_key);
+        }, FCardanoFrameScheduler::Get().ShouldRunSingleThreaded() ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    return !bFailed;
+}
+
+bool UCardanoBlueprintLibrary::DeriveAddresses(
+    const TArray<FString>& MnemonicWords,
+    int32 AccountIndex,
+    int32 Role,
+    int32 StartIndex,
+    int32 Count,
+    TArray<FString>& OutAddresses,
+    const FString& Password,
+    ECardanoNetwork Network)
+{
+    OutAddresses.Empty();
+
+    if (AccountIndex < 0 || Role < 0 || StartIndex < 0 || Count <= 0) {
+        UE_LOG(LogCardano, Error, TEXT("Invalid derivation range: account %d, role %d, start %d, count %d"),
+            AccountIndex, Role, StartIndex, Count);
+        return false;
+    }
+
+    TArray<uint8> AccountKey;
+    if (!DeriveAccountPublicKey(MnemonicWords, AccountIndex, Password, AccountKey)) {
+        return false;
+    }
+
+    TArray<FCardanoHash28> KeyHashes;
+    if (!derive_base_addresses(AccountKey, Role, StartIndex, Count, OutAddresses, &KeyHashes, ToNetworkId(Network))) {
+        UE_LOG(LogCardano, Error, TEXT("Address derivation failed for account %d, role %d"), AccountIndex, Role);
+        OutAddresses.Empty();
+        return false;
+    }
+
+    index_derived_keys(AccountIndex, Role, StartIndex, KeyHashes);
+
+    UE_LOG(LogCardano, Verbose, TEXT("Derived %d addresses for account %d, role %d"), Count, AccountIndex, Role);
+    return true;
+}
+
+bool UCardanoBlueprintLibrary::MakeAddresses(
+    ECardanoAddressKind Kind,
+    ECardanoNetwork Network,
+    const TArray<FCardanoCredential>& Credentials,
+    const TArray<FCardanoCredential>& StakeCredentials,
+    TArray<FString>& OutAddresses)
+{
+    OutAddresses.Empty();
+
+    const int32 Count = Credentials.Num();
+    const int32 StakeCount = StakeCredentials.Num();
+    const bool bBase = Kind == ECardanoAddressKind::Base;
+    if (bBase ? (Count > 0 && StakeCount != 1 && StakeCount != Count) : StakeCount != 0) {
+        UE_LOG(LogCardano, Error, TEXT("%d stake credentials do not fit %d addresses of this kind"), StakeCount, Count);
+        return false;
+    }
+
+    const cardano_address_factory_kind_t kind =
+        Kind == ECardanoAddressKind::Base ? CARDANO_ADDRESS_FACTORY_KIND_BASE :
+        Kind == ECardanoAddressKind::Enterprise ? CARDANO_ADDRESS_FACTORY_KIND_ENTERPRISE : CARDANO_ADDRESS_FACTORY_KIND_REWARD;
+    const cardano_network_id_t network_id = ToNetworkId(Network);
+    const size_t SlotSize = cardano_address_factory_get_string_size(kind, network_id);
+
+    OutAddresses.SetNum(Count);
+
+    const int32 ChunkSize = 1024;
+    const int32 NumChunks = FMath::DivideAndRoundUp(Count, ChunkSize);
+    TAtomic<bool> bFailed(false);
+
+    ParallelFor(NumChunks, [&](int32 ChunkIndex)
+        {
+            const int32 First = ChunkIndex * ChunkSize;
+            const int32 ChunkCount = FMath::Min(ChunkSize, Count - First);
+
+            // One scratch buffer per chunk: the hashes back to back, then the strings the factory writes
+            TArray<uint8> Hashes;
+            Hashes.SetNumUninitialized((bBase && StakeCount == Count ? 2 : 1) * ChunkCount * FCardanoHash28::Size);
+            TArray<ANSICHAR> Strings;
+            Strings.SetNumUninitialized(static_cast<int32>(SlotSize) * ChunkCount);
+
+            uint8* StakeHashes = Hashes.GetData() + ChunkCount * FCardanoHash28::Size;
+            for (int32 i = 0; i < ChunkCount; i++) {
+                FMemory::Memcpy(Hashes.GetData() + i * FCardanoHash28::Size, Credentials[First + i].Hash.Bytes, FCardanoHash28::Size);
+                if (bBase && StakeCount == Count) {
+                    FMemory::Memcpy(StakeHashes + i * FCardanoHash28::Size, StakeCredentials[First + i].Hash.Bytes, FCardanoHash28::Size);
+                }
+            }
+
+            // The factory takes one credential type per call, so each run of equally typed credentials is one call
+            for (int32 RunStart = 0; RunStart < ChunkCount && !bFailed;) {
+                auto StakeAt = [&](int32 i) { return StakeCount == 1 ? &StakeCredentials[0] : &StakeCredentials[First + i]; };
+                const bool bScript = Credentials[First + RunStart].bScript;
+                const bool bStakeScript = bBase && StakeAt(RunStart)->bScript;
+
+                int32 RunEnd = RunStart + 1;
+                while (RunEnd < ChunkCount && Credentials[First + RunEnd].bScript == bScript && (!bBase || StakeAt(RunEnd)->bScript == bStakeScript)) {
+                    RunEnd++;
+                }
+
+                const uint8* stake_hashes = !bBase ? nullptr : StakeCount == 1 ? StakeCredentials[0].Hash.Bytes : StakeHashes + RunStart * FCardanoHash28::Size;
+                if (cardano_address_factory_from_hashes(kind, network_id,
+                    Hashes.GetData() + RunStart * FCardanoHash28::Size, bScript ? CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH : CARDANO_CREDENTIAL_TYPE_KEY_HASH, RunEnd - RunStart,
+                    stake_hashes, bStakeScript ? CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH : CARDANO_CREDENTIAL_TYPE_KEY_HASH, !bBase ? 0 : StakeCount == 1 ? 1 : RunEnd - RunStart,
+                    Strings.GetData() + RunStart * SlotSize, (RunEnd - RunStart) * SlotSize) != CARDANO_SUCCESS) {
+                    bFailed = true;
+                }
+
+                RunStart = RunEnd;
+            }
+
+            for (int32 i = 0; i < ChunkCount && !bFailed; i++) {
+                OutAddresses[First + i] = ANSI_TO_TCHAR(&Strings[i * static_cast<int32>(SlotSize)]);
+            }
+        }, FCardanoFrameScheduler::Get().ShouldRunSingleThreaded() ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    if (bFailed) {
+        UE_LOG(LogCardano, Error, TEXT("Failed to encode %d addresses"), Count);
+        OutAddresses.Empty();
+        return false;
+    }
+
+    return true;
+}
+
+namespace
+{
+    /**
+     * Drives one DiscoverWalletAddresses call. Lives on the game thread; only the window derivation runs on workers.
+     * At most one address_info round and one derivation are in flight at a time, the derivation one window ahead.
+     */
+    class FAddressDiscovery : public TSharedFromThis<FAddressDiscovery>
+    {
+    public:
+        static constexpr int32 NumChains = 2;
+
+        FAddressDiscovery(TArray<uint8>&& InAccountKey, int32 InAccountIndex, int32 InGapLimit, const FOnWalletDiscoveryResult& InOnComplete)
+            : AccountKey(MoveTemp(InAccountKey))
+            , AccountIndex(InAccountIndex)
+            , GapLimit(InGapLimit)
+            , OnComplete(InOnComplete)
+        {
+        }
+
+        void Start()
+        {
+            DeriveNextWindow();
+        }
+
+    private:
+        // One window of consecutive addresses per chain; chains that already stopped have no addresses
+        struct FWindow
+        {
+            int32 Start[NumChains] = { 0, 0 };
+            TArray<FString> Addresses[NumChains];
+        };
+
+        struct FChain
+        {
+            int32 Role = 0;
+            int32 NextDeriveIndex = 0;
+            int32 LastUsedIndex = INDEX_NONE;
+            bool bActive = true;
+        };
+
+        TArray<uint8> AccountKey;
+        int32 AccountIndex = 0;
+        int32 GapLimit = 20;
+        FOnWalletDiscoveryResult OnComplete;
+        FChain Chains[NumChains] = { { static_cast<int32>(CARDANO_CIP_1852_ROLE_EXTERNAL) }, { static_cast<int32>(CARDANO_CIP_1852_ROLE_INTERNAL) } };
+
+        FWindow ReadyWindow;
+        bool bWindowReady = false;
+        bool bDeriving = false;
+        bool bFinished = false;
+
+        // The round in flight: which chain and index every queried address belongs to
+        TMap<FString, TPair<int32, int32>> InFlight;
+        bool bChainUsedInRound[NumChains] = { false, false };
+        int32 PendingChunks = 0;
+        FString RoundError;
+
+        TArray<FCardanoDiscoveredAddress> UsedAddresses;
+
+        void DeriveNextWindow()
+        {
+            FWindow Window;
+            for (int32 c = 0; c < NumChains; c++)
+            {
+                Window.Start[c] = Chains[c].bActive ? Chains[c].NextDeriveIndex : INDEX_NONE;
+                if (Chains[c].bActive)
+                {
+                    Chains[c].NextDeriveIndex += GapLimit;
+                }
+            }
+
+            bDeriving = true;
+            const int32 Roles[NumChains] = { Chains[0].Role, Chains[1].Role };
+
+            FCardanoFrameScheduler::Get().RunInBackground(ECardanoWorkPriority::Normal, [This = AsShared(), Window = MoveTemp(Window), Roles]() mutable
+                {
+                    bool bSuccess = true;
+                    TArray<FCardanoHash28> KeyHashes;
+                    for (int32 c = 0; c < NumChains && bSuccess; c++)
+                    {
+                        if (Window.Start[c] != INDEX_NONE)
+                        {
+                            bSuccess = derive_base_addresses(This->AccountKey, Roles[c], Window.Start[c], This->GapLimit, Window.Addresses[c], &KeyHashes, CARDANO_NETWORK_ID_MAIN_NET);
+                            if (bSuccess)
+                            {
+                                index_derived_keys(This->AccountIndex, Roles[c], Window.Start[c], KeyHashes);
+                            }
+                        }
+                    }
+
+                    AsyncTask(ENamedThreads::GameThread, [This, Window = MoveTemp(Window), bSuccess]() mutable
+                        {
+                            This->OnWindowDerived(MoveTemp(Window), bSuccess);
+                        });
+                });
+        }
+
+        void OnWindowDerived(FWindow&& Window, bool bSuccess)
+        {
+            bDeriving = false;
+
+            if (bFinished)
             {
-                OnComplete.ExecuteIfBound(false, TEXT("Network request failed"));
                 return;
             }
 
-            const FString ResponseString = Response->GetContentAsString();
-            TArray<TSharedPtr<FJsonValue>> JsonArray;
-            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseString);
+            if (!bSuccess)
+            {
+                Finish(TEXT("Address derivation failed"));
+                return;
+            }
 
-            if (!FJsonSerializer::Deserialize(Reader, JsonArray) || JsonArray.Num() == 0)
+            ReadyWindow = MoveTemp(Window);
+            bWindowReady = true;
+
+            if (PendingChunks == 0)
             {
-                OnComplete.ExecuteIfBound(false, TEXT("Invalid response format"));
+                SendReadyWindow();
+            }
+        }
+
+        void SendReadyWindow()
+        {
+            bWindowReady = false;
+            InFlight.Reset();
+
+            TArray<FString> Addresses;
+            for (int32 c = 0; c < NumChains; c++)
+            {
+                bChainUsedInRound[c] = false;
+
+                // A chain may have stopped while this window was being derived ahead of time
+                if (!Chains[c].bActive)
+                {
+                    continue;
+                }
+
+                for (int32 i = 0; i < ReadyWindow.Addresses[c].Num(); i++)
+                {
+                    InFlight.Add(ReadyWindow.Addresses[c][i], TPair<int32, int32>(c, ReadyWindow.Start[c] + i));
+                    Addresses.Add(ReadyWindow.Addresses[c][i]);
+                }
+            }
+
+            UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+            if (!Koios)
+            {
+                Finish(TEXT("Koios client is not available"));
                 return;
             }
 
-            TSharedPtr<FJsonObject> AddressInfo = JsonArray[0]->AsObject();
-            if (!AddressInfo.IsValid())
+            const TArray<TArray<FString>> Chunks = ChunkAddresses(Addresses, Koios->GetMaxAddressesPerRequest());
+            if (Chunks.Num() == 0)
             {
-                OnComplete.ExecuteIfBound(false, TEXT("Invalid address info"));
+                Finish(TEXT(""));
                 return;
             }
 
-            FString BalanceStr;
-            if (AddressInfo->TryGetStringField("balance", BalanceStr))
+            PendingChunks = Chunks.Num();
+            RoundError.Empty();
+
+            for (const TArray<FString>& Chunk : Chunks)
             {
-                OutBalance.Lovelace = FCString::Atoi64(*BalanceStr);
+                TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
+                    Koios->CreateJsonPost(TEXT("address_info"), UCardanoKoiosClient::MakeAddressesBody(Chunk));
+
+                HttpRequest->OnProcessRequestComplete().BindLambda([This = AsShared()](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+                    {
+                        This->OnChunkComplete(Response, Success);
+                    });
+
+                Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::History);
+            }
+
+            // Pipeline: derive the following window while this round is on the wire
+            if (!bDeriving)
+            {
+                DeriveNextWindow();
             }
+        }
 
-            const TArray<TSharedPtr<FJsonValue>>* UtxoSet = nullptr;
-            if (AddressInfo->TryGetArrayField("utxo_set", UtxoSet) && UtxoSet)
+        void OnChunkComplete(FHttpResponsePtr Response, bool Success)
+        {
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            if (!Success || !Response.IsValid())
             {
-                for (const auto& UtxoValue : *UtxoSet)
+                RoundError = RoundError.IsEmpty() ? TEXT("Network request failed") : RoundError;
+            }
+            else if (!ParseJsonArray(Response, JsonArray))
+            {
+                RoundError = RoundError.IsEmpty() ? TEXT("Invalid response format") : RoundError;
+            }
+
+            for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+            {
+                TSharedPtr<FJsonObject> AddressInfo = Item->AsObject();
+                FString Address;
+                if (!AddressInfo.IsValid() || !AddressInfo->TryGetStringField("address", Address))
+                {
+                    continue;
+                }
+
+                // Koios only returns rows for addresses it has seen on chain
+                if (const TPair<int32, int32>* Location = InFlight.Find(Address))
                 {
-                    auto UtxoObject = UtxoValue->AsObject();
-                    if (!UtxoObject.IsValid()) continue;
+                    FCardanoDiscoveredAddress& Used = UsedAddresses.AddDefaulted_GetRef();
+                    Used.Address = Address;
+                    Used.Role = Chains[Location->Key].Role;
+                    Used.Index = Location->Value;
+                    ParseAddressInfo(*AddressInfo, Used.Balance);
+
+                    FChain& Chain = Chains[Location->Key];
+                    Chain.LastUsedIndex = FMath::Max(Chain.LastUsedIndex, Location->Value);
+                    bChainUsedInRound[Location->Key] = true;
+                }
+            }
+
+            if (--PendingChunks > 0 || bFinished)
+            {
+                return;
+            }
 
-                    const TArray<TSharedPtr<FJsonValue>>* AssetList = nullptr;
-                    if (UtxoObject->TryGetArrayField("asset_list", AssetList) && AssetList)
+            if (!RoundError.IsEmpty())
+            {
+                Finish(RoundError);
+                return;
+            }
+
+            bool bAnyActive = false;
+            for (int32 c = 0; c < NumChains; c++)
+            {
+                // A full window without a used address closes the chain
+                Chains[c].bActive = Chains[c].bActive && bChainUsedInRound[c];
+                bAnyActive |= Chains[c].bActive;
+            }
+
+            if (!bAnyActive)
+            {
+                Finish(TEXT(""));
+            }
+            else if (bWindowReady)
+            {
+                SendReadyWindow();
+            }
+            else if (!bDeriving)
+            {
+                DeriveNextWindow();
+            }
+        }
+
+        void Finish(const FString& Error)
+        {
+            if (bFinished)
+            {
+                return;
+            }
+            bFinished = true;
+
+            FCardanoWalletDiscovery Discovery;
+            if (Error.IsEmpty())
+            {
+                UsedAddresses.Sort([](const FCardanoDiscoveredAddress& A, const FCardanoDiscoveredAddress& B)
                     {
-                        for (const auto& AssetValue : *AssetList)
-                        {
-                            auto AssetObject = AssetValue->AsObject();
-                            if (!AssetObject.IsValid()) continue;
-
-                            FTokenBalance TokenBalance;
-                            AssetObject->TryGetStringField("policy_id", TokenBalance.PolicyId);
-                            AssetObject->TryGetStringField("asset_name", TokenBalance.AssetName);
-                            AssetObject->TryGetStringField("quantity", TokenBalance.Quantity);
-                            OutBalance.Tokens.Add(TokenBalance);
-                        }
+                        return A.Role != B.Role ? A.Role < B.Role : A.Index < B.Index;
+                    });
+
+                Discovery.UsedAddresses = MoveTemp(UsedAddresses);
+                Discovery.NextExternalIndex = Chains[0].LastUsedIndex + 1;
+                Discovery.NextInternalIndex = Chains[1].LastUsedIndex + 1;
+            }
+
+            OnComplete.ExecuteIfBound(Error.IsEmpty(), Discovery, Error);
+        }
+    };
+}
+
+void UCardanoBlueprintLibrary::DiscoverWalletAddresses(
+    const TArray<FString>& MnemonicWords,
+    int32 AccountIndex,
+    const FOnWalletDiscoveryResult& OnComplete,
+    int32 GapLimit,
+    const FString& Password)
+{
+    if (AccountIndex < 0 || GapLimit <= 0)
+    {
+        OnComplete.ExecuteIfBound(false, {}, TEXT("Invalid account index or gap limit"));
+        return;
+    }
+
+    // The hardened account derivation decrypts the key material, so it stays off the game thread too
+    Async(EAsyncExecution::ThreadPool, [MnemonicWords, AccountIndex, OnComplete, GapLimit, Password]()
+        {
+            TArray<uint8> AccountKey;
+            const bool bSuccess = DeriveAccountPublicKey(MnemonicWords, AccountIndex, Password, AccountKey);
+
+            AsyncTask(ENamedThreads::GameThread, [AccountKey = MoveTemp(AccountKey), bSuccess, AccountIndex, GapLimit, OnComplete]() mutable
+                {
+                    if (!bSuccess)
+                    {
+                        OnComplete.ExecuteIfBound(false, {}, TEXT("Account key derivation failed"));
+                        return;
                     }
-                }
+
+                    MakeShared<FAddressDiscovery>(MoveTemp(AccountKey), AccountIndex, GapLimit, OnComplete)->Start();
+                });
+        });
+}
+
+void UCardanoBlueprintLibrary::GenerateWalletAsync(const FOnWalletResult& OnComplete)
+{
+    Async(EAsyncExecution::ThreadPool, [OnComplete]()
+        {
+            FCardanoWalletInfo Wallet;
+            GenerateWallet(Wallet.MnemonicWords, Wallet.PaymentAddress);
+
+            AsyncTask(ENamedThreads::GameThread, [OnComplete, Wallet = MoveTemp(Wallet)]()
+                {
+                    const bool bSuccess = !Wallet.PaymentAddress.IsEmpty();
+                    OnComplete.ExecuteIfBound(bSuccess, Wallet, bSuccess ? TEXT("") : TEXT("Wallet generation failed"));
+                });
+        });
+}
+
+void UCardanoBlueprintLibrary::RestoreWalletAsync(const TArray<FString>& MnemonicWords, const FOnWalletResult& OnComplete, const FString& Password)
+{
+    Async(EAsyncExecution::ThreadPool, [MnemonicWords, OnComplete, Password]()
+        {
+            FCardanoWalletInfo Wallet;
+            Wallet.MnemonicWords = MnemonicWords;
+            RestoreWallet(MnemonicWords, Wallet.PaymentAddress, Password);
+
+            AsyncTask(ENamedThreads::GameThread, [OnComplete, Wallet = MoveTemp(Wallet)]()
+                {
+                    const bool bSuccess = !Wallet.PaymentAddress.IsEmpty();
+                    OnComplete.ExecuteIfBound(bSuccess, Wallet, bSuccess ? TEXT("") : TEXT("Wallet restoration failed"));
+                });
+        });
+}
+
+using FBalanceRow = TPair<FString, FAddressBalance>;
+
+/** Results of the last address_info response to each request body, so unchanged balance polls are not decoded again. */
+static TKoiosResponseMemo<FAddressBalance> GBalanceResponses;
+static TKoiosResponseMemo<TArray<FBalanceRow>> GBalanceRowResponses;
+
+void UCardanoBlueprintLibrary::GetAddressBalance(const FString& Address, FAddressBalance& OutBalance, const FOnBalanceResult& OnComplete)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        OnComplete.ExecuteIfBound(false, TEXT("Koios client is not available"));
+        return;
+    }
+
+    const FString RequestBody = UCardanoKoiosClient::MakeAddressesBody({ Address });
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateJsonPost(TEXT("address_info"), RequestBody);
+    GBalanceResponses.Prepare(RequestBody, *HttpRequest);
+
+    HttpRequest->OnProcessRequestComplete().BindLambda([OnComplete, &OutBalance, RequestBody](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!Success || !Response.IsValid())
+            {
+                OnComplete.ExecuteIfBound(false, TEXT("Network request failed"));
+                return;
             }
 
-            OnComplete.ExecuteIfBound(true, TEXT(""));
+            const FKoiosResponseFingerprint Fingerprint = FKoiosResponseFingerprint::Make(Response);
+            if (const FAddressBalance* Unchanged = GBalanceResponses.FindUnchanged(RequestBody, Fingerprint))
+            {
+                OutBalance = *Unchanged;
+                OnComplete.ExecuteIfBound(true, TEXT(""));
+                return;
+            }
+
+            // Decoded into a private copy, which is only handed to OutBalance back on the game thread
+            TSharedRef<TOptional<FAddressBalance>> Decoded = MakeShared<TOptional<FAddressBalance>>();
+
+            DecodeKoiosResponse(Response,
+                [Decoded](const TArray<uint8>& Content)
+                {
+                    return DecodeAddressInfoRows(Content,
+                        [&Decoded](FString&&, FAddressBalance&& Balance)
+                        {
+                            if (!Decoded->IsSet())
+                            {
+                                Decoded->Emplace(MoveTemp(Balance));
+                            }
+                        });
+                },
+                [Decoded, OnComplete, &OutBalance, RequestBody, Fingerprint](bool bDecoded)
+                {
+                    if (!bDecoded || !Decoded->IsSet())
+                    {
+                        OnComplete.ExecuteIfBound(false, TEXT("Invalid response format"));
+                        return;
+                    }
+
+                    GBalanceResponses.Store(RequestBody, Fingerprint, Decoded->GetValue());
+                    OutBalance = MoveTemp(Decoded->GetValue());
+
+                    OnComplete.ExecuteIfBound(true, TEXT(""));
+                });
         });
 
-    HttpRequest->ProcessRequest();
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
 }
 
 void UCardanoBlueprintLibrary::GetAddressUTXOs(
@@ -411,247 +980,534 @@ void UCardanoBlueprintLibrary::GetAddressUTXOs(
     TArray<FUTxO>& OutUTxOs,
     const FOnUTxOsResult& OnComplete)
 {
-    FString Url = TEXT("https://api.koios.rest/api/v1/address_utxos");
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-    HttpRequest->SetVerb("POST");
-    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-    HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
-
-    // Create JSON payload
-    TSharedPtr<FJsonObject> RequestObj = MakeShared<FJsonObject>();
-    TArray<TSharedPtr<FJsonValue>> AddressArray;
-
-    // Ensure we're adding the full address, not a number
-    AddressArray.Add(MakeShared<FJsonValueString>(Address));
-
-    RequestObj->SetArrayField("_addresses", AddressArray);
-    RequestObj->SetBoolField("_extended", true);
-
-    FString RequestBody;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(RequestObj.ToSharedRef(), Writer);
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        OnComplete.ExecuteIfBound(false, TEXT("Koios client is not available"));
+        return;
+    }
 
-    HttpRequest->SetContentAsString(RequestBody);
-    HttpRequest->SetURL(Url);
+    const FString RequestBody = UCardanoKoiosClient::MakeAddressesBody({ Address }, true);
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateJsonPost(TEXT("address_utxos"), RequestBody);
 
-    UE_LOG(LogTemp, Warning, TEXT("Sending request to %s with body: %s"), *Url, *RequestBody);
+    UE_LOG(LogCardano, VeryVerbose, TEXT("Sending request to %s with body: %s"), *HttpRequest->GetURL(), *RequestBody);
 
     TArray<FUTxO>* UTxOsPtr = &OutUTxOs;
     FOnUTxOsResult OnCompleteCallback = OnComplete;
+    TSharedRef<FCardanoOperationLog> OperationLog = MakeShared<FCardanoOperationLog>(TEXT("GetAddressUTXOs"));
 
     HttpRequest->OnProcessRequestComplete().BindLambda(
-        [UTxOsPtr, OnCompleteCallback, Address](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        [UTxOsPtr, OnCompleteCallback, Address, OperationLog](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
         {
             if (!Success || !Response.IsValid())
             {
-                UE_LOG(LogTemp, Error, TEXT("Network request failed for address %s"), *Address);
+                UE_LOG(LogCardano, Error, TEXT("Network request failed for address %s"), *Address);
+                OperationLog->Finish(false);
                 OnCompleteCallback.ExecuteIfBound(false, TEXT("Network request failed"));
                 return;
             }
 
-            const FString ResponseString = Response->GetContentAsString();
-            UE_LOG(LogTemp, Warning, TEXT("Response: %s"), *ResponseString);
+            // Still throttled once the client's retries run out
+            if (Response->GetResponseCode() != 200)
+            {
+                OperationLog->Add(TEXT("http"), Response->GetResponseCode());
+                OperationLog->Finish(false);
+                OnCompleteCallback.ExecuteIfBound(false, FString::Printf(TEXT("Koios returned HTTP %d"), Response->GetResponseCode()));
+                return;
+            }
+
+            // Decoded into a private array, which is only moved into the caller's back on the game thread
+            TSharedRef<TArray<FUTxO>> Decoded = MakeShared<TArray<FUTxO>>();
+
+            DecodeKoiosResponse(Response,
+                [Decoded](const TArray<uint8>& Content)
+                {
+                    int32 RowCount = 0;
+                    return DecodeUTxORows(Content,
+                        [&Decoded](FString&&, FUTxO&& UTxO) { Decoded->Add(MoveTemp(UTxO)); },
+                        RowCount);
+                },
+                [Decoded, UTxOsPtr, OnCompleteCallback, Address, OperationLog](bool bDecoded)
+                {
+                    if (!bDecoded)
+                    {
+                        UE_LOG(LogCardano, Error, TEXT("Failed to parse JSON response for address %s"), *Address);
+                        OperationLog->Finish(false);
+                        OnCompleteCallback.ExecuteIfBound(false, TEXT("Invalid response format"));
+                        return;
+                    }
+
+                    *UTxOsPtr = MoveTemp(*Decoded);
+
+                    int32 NumUtxos = UTxOsPtr->Num();
+                    OperationLog->Add(TEXT("utxos"), NumUtxos);
+                    OperationLog->Finish(NumUtxos > 0);
+
+                    if (NumUtxos == 0)
+                    {
+                        OnCompleteCallback.ExecuteIfBound(false, TEXT("No valid UTXOs found"));
+                    }
+                    else
+                    {
+                        OnCompleteCallback.ExecuteIfBound(true, TEXT(""));
+                    }
+                });
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+}
+
+void UCardanoBlueprintLibrary::GetBalancesForAddresses(const TArray<FString>& Addresses, const FOnBalancesResult& OnComplete)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        OnComplete.ExecuteIfBound(false, {}, TEXT("Koios client is not available"));
+        return;
+    }
+
+    const TArray<TArray<FString>> Chunks = ChunkAddresses(Addresses, Koios->GetMaxAddressesPerRequest());
+    if (Chunks.Num() == 0)
+    {
+        OnComplete.ExecuteIfBound(true, {}, TEXT(""));
+        return;
+    }
+
+    // Shared by the chunk callbacks, which all run on the game thread
+    struct FBatchState
+    {
+        TMap<FString, FAddressBalance> Balances;
+        int32 PendingChunks = 0;
+        FString FirstError;
+    };
+    TSharedRef<FBatchState> State = MakeShared<FBatchState>();
+    State->PendingChunks = Chunks.Num();
+
+    for (const TArray<FString>& Chunk : Chunks)
+    {
+        const FString RequestBody = UCardanoKoiosClient::MakeAddressesBody(Chunk);
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateJsonPost(TEXT("address_info"), RequestBody);
+        GBalanceRowResponses.Prepare(RequestBody, *HttpRequest);
+
+        HttpRequest->OnProcessRequestComplete().BindLambda([State, OnComplete, RequestBody](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+            {
+                auto FinishChunk = [State, OnComplete]()
+                {
+                    if (--State->PendingChunks == 0)
+                    {
+                        OnComplete.ExecuteIfBound(State->FirstError.IsEmpty(), State->Balances, State->FirstError);
+                    }
+                };
+
+                auto MergeRows = [State](TArray<FBalanceRow>&& Rows)
+                {
+                    for (FBalanceRow& Row : Rows)
+                    {
+                        FAddressBalance& Balance = State->Balances.FindOrAdd(Row.Key);
+                        Balance.Lovelace = Row.Value.Lovelace;
+                        Balance.Tokens.Append(MoveTemp(Row.Value.Tokens));
+                    }
+                };
+
+                if (!Success || !Response.IsValid())
+                {
+                    State->FirstError = State->FirstError.IsEmpty() ? TEXT("Network request failed") : State->FirstError;
+                    FinishChunk();
+                    return;
+                }
+
+                const FKoiosResponseFingerprint Fingerprint = FKoiosResponseFingerprint::Make(Response);
+                if (const TArray<FBalanceRow>* Unchanged = GBalanceRowResponses.FindUnchanged(RequestBody, Fingerprint))
+                {
+                    MergeRows(TArray<FBalanceRow>(*Unchanged));
+                    FinishChunk();
+                    return;
+                }
+
+                // Rows are collected off the shared state, then merged into it back on the game thread
+                TSharedRef<TArray<FBalanceRow>> Rows = MakeShared<TArray<FBalanceRow>>();
+
+                DecodeKoiosResponse(Response,
+                    [Rows](const TArray<uint8>& Content)
+                    {
+                        return DecodeAddressInfoRows(Content, [&Rows](FString&& Address, FAddressBalance&& Balance)
+                            {
+                                if (!Address.IsEmpty())
+                                {
+                                    Rows->Emplace(MoveTemp(Address), MoveTemp(Balance));
+                                }
+                            });
+                    },
+                    [State, Rows, FinishChunk, MergeRows, RequestBody, Fingerprint](bool bDecoded)
+                    {
+                        if (!bDecoded)
+                        {
+                            State->FirstError = State->FirstError.IsEmpty() ? TEXT("Invalid response format") : State->FirstError;
+                        }
+                        else
+                        {
+                            GBalanceRowResponses.Store(RequestBody, Fingerprint, *Rows);
+                            MergeRows(MoveTemp(*Rows));
+                        }
+
+                        FinishChunk();
+                    });
+            });
+
+        Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+    }
+}
+
+void UCardanoBlueprintLibrary::GetUTxOsForAddresses(const TArray<FString>& Addresses, const FOnAddressUTxOsResult& OnComplete)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        OnComplete.ExecuteIfBound(false, {}, TEXT("Koios client is not available"));
+        return;
+    }
+
+    const TArray<TArray<FString>> Chunks = ChunkAddresses(Addresses, Koios->GetMaxAddressesPerRequest());
+    if (Chunks.Num() == 0)
+    {
+        OnComplete.ExecuteIfBound(true, {}, TEXT(""));
+        return;
+    }
 
-            TArray<TSharedPtr<FJsonValue>> JsonArray;
-            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseString);
+    // Shared by the chunk callbacks, which all run on the game thread
+    struct FBatchState
+    {
+        TMap<FString, FAddressUTxOs> UTxOsByAddress;
+        int32 PendingChunks = 0;
+        FString FirstError;
+    };
+    TSharedRef<FBatchState> State = MakeShared<FBatchState>();
+    State->PendingChunks = Chunks.Num();
 
-            if (!FJsonSerializer::Deserialize(Reader, JsonArray))
-            {
-                UE_LOG(LogTemp, Error, TEXT("Failed to parse JSON response for address %s"), *Address);
-                OnCompleteCallback.ExecuteIfBound(false, TEXT("Invalid response format"));
-                return;
-            }
+    for (const TArray<FString>& Chunk : Chunks)
+    {
+        // Every requested address gets an entry, even if it holds no UTxOs
+        for (const FString& Address : Chunk)
+        {
+            State->UTxOsByAddress.Add(Address);
+        }
 
-            UTxOsPtr->Empty();
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
+            Koios->CreateJsonPost(TEXT("address_utxos"), UCardanoKoiosClient::MakeAddressesBody(Chunk, true));
 
-            for (const auto& Item : JsonArray)
+        HttpRequest->OnProcessRequestComplete().BindLambda([State, OnComplete](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
             {
-                TSharedPtr<FJsonObject> UtxoObject = Item->AsObject();
-                if (!UtxoObject.IsValid())
+                auto FinishChunk = [State, OnComplete]()
                 {
-                    continue;
-                }
-
-                FUTxO UTxO;
-                bool bValidUtxo = true;
+                    if (--State->PendingChunks == 0)
+                    {
+                        OnComplete.ExecuteIfBound(State->FirstError.IsEmpty(), State->UTxOsByAddress, State->FirstError);
+                    }
+                };
 
-                // Get tx_hash
-                if (!UtxoObject->TryGetStringField("tx_hash", UTxO.TxHash))
+                if (!Success || !Response.IsValid())
                 {
-                    bValidUtxo = false;
-                    UE_LOG(LogTemp, Warning, TEXT("Missing tx_hash field"));
+                    State->FirstError = State->FirstError.IsEmpty() ? TEXT("Network request failed") : State->FirstError;
+                    FinishChunk();
+                    return;
                 }
 
-                // Get tx_index
-                int64 TxIndex;
-                if (!UtxoObject->TryGetNumberField("tx_index", TxIndex))
-                {
-                    bValidUtxo = false;
-                    UE_LOG(LogTemp, Warning, TEXT("Missing tx_index field"));
-                }
-                else
-                {
-                    UTxO.TxIndex = static_cast<int32>(TxIndex);
-                }
+                // Rows are collected off the shared state, then merged into it back on the game thread
+                using FUTxORow = TPair<FString, FUTxO>;
+                TSharedRef<TArray<FUTxORow>> Rows = MakeShared<TArray<FUTxORow>>();
 
-                // Get value (as string)
-                FString ValueStr;
-                if (UtxoObject->TryGetStringField("value", ValueStr))
-                {
-                    UTxO.Value = FCString::Atoi64(*ValueStr);
-                }
-                else
-                {
-                    UTxO.Value = 0;
-                    UE_LOG(LogTemp, Warning, TEXT("Missing or invalid value field"));
-                }
+                DecodeKoiosResponse(Response,
+                    [Rows](const TArray<uint8>& Content)
+                    {
+                        int32 RowCount = 0;
+                        return DecodeUTxORows(Content, [&Rows](FString&& Address, FUTxO&& UTxO)
+                            {
+                                if (!Address.IsEmpty())
+                                {
+                                    Rows->Emplace(MoveTemp(Address), MoveTemp(UTxO));
+                                }
+                            },
+                            RowCount);
+                    },
+                    [State, Rows, FinishChunk](bool bDecoded)
+                    {
+                        if (!bDecoded)
+                        {
+                            State->FirstError = State->FirstError.IsEmpty() ? TEXT("Invalid response format") : State->FirstError;
+                        }
+                        else
+                        {
+                            for (FUTxORow& Row : *Rows)
+                            {
+                                State->UTxOsByAddress.FindOrAdd(Row.Key).UTxOs.Add(MoveTemp(Row.Value));
+                            }
+                        }
 
-                // Check if UTXO is spent
-                bool bIsSpent;
-                if (UtxoObject->TryGetBoolField("is_spent", bIsSpent) && bIsSpent)
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("Skipping spent UTXO"));
-                    continue;
-                }
+                        FinishChunk();
+                    });
+            });
 
-                if (bValidUtxo)
-                {
-                    UTxOsPtr->Add(UTxO);
-                    UE_LOG(LogTemp, Log, TEXT("Added UTXO - Hash: %s, Index: %d, Value: %lld"),
-                        *UTxO.TxHash, UTxO.TxIndex, UTxO.Value);
-                }
-            }
+        Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+    }
+}
 
-            int32 NumUtxos = UTxOsPtr->Num();
-            UE_LOG(LogTemp, Log, TEXT("Processed %d valid UTXOs for address %s"), NumUtxos, *Address);
+void UCardanoBlueprintLibrary::GetAddressUTXOsPaged(const FString& Address, const FOnUTxOPageProgress& OnProgress, const FOnPagedUTxOsResult& OnComplete, int32 PageSize)
+{
+    if (PageSize <= 0)
+    {
+        OnComplete.ExecuteIfBound(false, {}, TEXT("Page size must be positive"));
+        return;
+    }
 
-            if (NumUtxos == 0)
-            {
-                OnCompleteCallback.ExecuteIfBound(false, TEXT("No valid UTXOs found"));
-            }
-            else
-            {
-                OnCompleteCallback.ExecuteIfBound(true, TEXT(""));
-            }
-        });
+    TSharedRef<FPagedUTxOQuery> Query = MakeShared<FPagedUTxOQuery>();
+    Query->Address = Address;
+    Query->PageSize = PageSize;
+    Query->OnProgress = OnProgress;
+    Query->OnComplete = OnComplete;
 
-    HttpRequest->ProcessRequest();
+    RequestUTxOPage(Query);
 }
 
-void UCardanoBlueprintLibrary::SubmitTransactionWithKoios(const TArray<uint8>& TransactionBytes, const FString& KoiosApiEndpoint)
+void UCardanoBlueprintLibrary::SubmitTransactionWithKoios(const TArray<uint8>& TransactionBytes, const FString& KoiosApiEndpoint, const FOnTransactionSubmitted& OnComplete)
 {
     if (TransactionBytes.Num() == 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("Invalid transaction bytes: Empty array"));
+        UE_LOG(LogCardano, Error, TEXT("Invalid transaction bytes: Empty array"));
+        OnComplete.ExecuteIfBound(ECardanoSubmitError::Other, TEXT(""), TEXT("Invalid transaction bytes: Empty array"));
         return;
     }
 
-    // Validate and format API endpoint
-    FString EndpointToUse = KoiosApiEndpoint;
-    if (EndpointToUse.IsEmpty())
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
     {
-        EndpointToUse = TEXT("https://api.koios.rest/api/v1");
+        UE_LOG(LogCardano, Error, TEXT("Koios client is not available"));
+        OnComplete.ExecuteIfBound(ECardanoSubmitError::ProviderError, TEXT(""), TEXT("Koios client is not available"));
+        return;
     }
 
-    // Ensure base endpoint doesn't end with a slash
-    if (EndpointToUse.EndsWith(TEXT("/")))
+    // An explicit endpoint overrides the client's base URL for this submission only
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateRequest(TEXT("POST"), TEXT("submittx"));
+    if (!KoiosApiEndpoint.IsEmpty())
     {
-        EndpointToUse.RemoveAt(EndpointToUse.Len() - 1);
+        FString EndpointToUse = KoiosApiEndpoint;
+        while (EndpointToUse.EndsWith(TEXT("/")))
+        {
+            EndpointToUse.RemoveAt(EndpointToUse.Len() - 1);
+        }
+        HttpRequest->SetURL(FString::Printf(TEXT("%s/submittx"), *EndpointToUse));
     }
 
-    // Add the correct submit transaction endpoint
-    FString SubmitEndpoint = FString::Printf(TEXT("%s/submittx"), *EndpointToUse);
+    UE_LOG(LogCardano, Verbose, TEXT("Submitting %d byte transaction to %s"), TransactionBytes.Num(), *HttpRequest->GetURL());
 
-    UE_LOG(LogTemp, Log, TEXT("Submitting transaction to endpoint: %s"), *SubmitEndpoint);
-    UE_LOG(LogTemp, Log, TEXT("Transaction size: %d bytes"), TransactionBytes.Num());
-
-    // Create HTTP request
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-    HttpRequest->SetVerb("POST");
     HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/cbor"));
 
     // Set the binary content
     HttpRequest->SetContent(TransactionBytes);
-    HttpRequest->SetURL(SubmitEndpoint);
-
-    // Add request timeout
-    HttpRequest->SetTimeout(30.0f);
 
     HttpRequest->OnProcessRequestComplete().BindLambda(
-        [](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        [OnComplete](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
         {
-            if (!Success)
+            const ECardanoSubmitError Error = ParseSubmitError(Response, Success);
+            if (Error == ECardanoSubmitError::NetworkError)
             {
-                UE_LOG(LogTemp, Error, TEXT("Transaction submission failed: Network error"));
+                UE_LOG(LogCardano, Error, TEXT("Transaction submission failed: Network error"));
+                OnComplete.ExecuteIfBound(Error, TEXT(""), TEXT("Network request failed"));
                 return;
             }
 
-            if (!Response.IsValid())
+            const int32 ResponseCode = Response->GetResponseCode();
+            const FString ResponseString = Response->GetContentAsString();
+
+            if (Error == ECardanoSubmitError::None)
             {
-                UE_LOG(LogTemp, Error, TEXT("Transaction submission failed: Invalid response"));
+                // The body is the id of the transaction, as a JSON string
+                FString TxHash = ResponseString.TrimStartAndEnd().TrimChar(TEXT('"'));
+                UE_LOG(LogCardano, Log, TEXT("Transaction submitted: %s"), *TxHash);
+                OnComplete.ExecuteIfBound(Error, TxHash.ToLower(), TEXT(""));
                 return;
             }
 
-            const int32 ResponseCode = Response->GetResponseCode();
-            const FString ResponseString = Response->GetContentAsString();
+            UE_LOG(LogCardano, Error, TEXT("Transaction submission failed with code %d (%s)"), ResponseCode, *GetSubmitErrorName(Error));
+            UE_LOG(LogCardano, Error, TEXT("Error response: %s"), *ResponseString);
+
+            // Additional debug information
+            UE_LOG(LogCardano, Verbose, TEXT("Request URL: %s"), *Request->GetURL());
+            UE_LOG(LogCardano, Verbose, TEXT("Request headers: %s"), *FString::Join(Request->GetAllHeaders(), TEXT(", ")));
+
+            OnComplete.ExecuteIfBound(Error, TEXT(""), FString::Printf(TEXT("Koios returned HTTP %d: %s"), ResponseCode, *ResponseString));
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Submission);
+}
 
-            if (ResponseCode == 202)
+void UCardanoBlueprintLibrary::GetProtocolParameters(const FOnProtocolParametersResult& OnComplete)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        OnComplete.ExecuteIfBound(false, FCardanoProtocolParameters(), TEXT("Koios client is not available"));
+        return;
+    }
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
+        Koios->CreateRequest(TEXT("GET"), TEXT("epoch_params?order=epoch_no.desc&limit=1"));
+
+    HttpRequest->OnProcessRequestComplete().BindLambda([OnComplete](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            FCardanoProtocolParameters Parameters;
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            if (!Success || !Response.IsValid())
             {
-                UE_LOG(LogTemp, Log, TEXT("Transaction submitted successfully"));
-                UE_LOG(LogTemp, Log, TEXT("Response: %s"), *ResponseString);
+                OnComplete.ExecuteIfBound(false, Parameters, TEXT("Network request failed"));
+                return;
             }
-            else
+
+            if (!ParseJsonArray(Response, JsonArray) || JsonArray.Num() == 0)
             {
-                UE_LOG(LogTemp, Error, TEXT("Transaction submission failed with code: %d"), ResponseCode);
-                UE_LOG(LogTemp, Error, TEXT("Error response: %s"), *ResponseString);
-
-                // Additional debug information
-                UE_LOG(LogTemp, Log, TEXT("Request URL: %s"), *Request->GetURL());
-                UE_LOG(LogTemp, Log, TEXT("Request headers:"));
-                const TArray<FString>& Headers = Request->GetAllHeaders();
-                for (const FString& Header : Headers)
-                {
-                    UE_LOG(LogTemp, Log, TEXT("  %s"), *Header);
-                }
+                OnComplete.ExecuteIfBound(false, Parameters, TEXT("Invalid response format"));
+                return;
+            }
+
+            TSharedPtr<FJsonObject> ParamsObject = JsonArray[0]->AsObject();
+            if (!ParamsObject.IsValid() || !ParseProtocolParameters(*ParamsObject, Parameters))
+            {
+                OnComplete.ExecuteIfBound(false, Parameters, TEXT("Incomplete protocol parameters"));
+                return;
             }
+
+            OnComplete.ExecuteIfBound(true, Parameters, TEXT(""));
         });
 
-    HttpRequest->ProcessRequest();
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
 }
 
-TArray<uint8> UCardanoBlueprintLibrary::BuildTransaction(
-    const TArray<FTransactionInput>& Inputs,
-    const FString& ReceiverAddress,
-    int64 AmountLovelace,
-    int64 FeeLovelace,
-    int64 TTL,
-    const TArray<FString>& MnemonicWords)  // Added mnemonic parameter
+/**
+ * The keys locking Inputs, each once. An input is looked up by the payment credential of its PaymentAddress among
+ * the keys of the addresses derived so far; an input without a known address is taken to be locked by the external
+ * address AddressIndex of account 0. OutAddressKeyHashes holds, for the locations of inputs with an address, the key
+ * hash the derived key must match.
+ */
+static void resolve_input_keys(const TArray<FTransactionInput>& Inputs, TArray<FCardanoKeyLocation>& OutLocations, TMap<FCardanoKeyLocation, FCardanoHash28>& OutAddressKeyHashes)
+{
+    for (const FTransactionInput& Input : Inputs)
+    {
+        FCardanoKeyLocation Location;
+        if (Input.PaymentAddress.IsEmpty() || !find_derived_key(Input.PaymentAddress, Location))
+        {
+            Location.Account = 0;
+            Location.Role = CARDANO_CIP_1852_ROLE_EXTERNAL;
+            Location.Index = FMath::Max(Input.AddressIndex, 0);
+        }
+        OutLocations.AddUnique(Location);
+
+        FCardanoHash28 KeyHash;
+        if (!Input.PaymentAddress.IsEmpty() && FCardanoPaymentKeyIndex::ReadPaymentKeyHash(Input.PaymentAddress, KeyHash))
+        {
+            OutAddressKeyHashes.Add(Location, KeyHash);
+        }
+    }
+}
+
+/**
+ * Derives the key at Location below RootKey, signs BodyHash with it and adds the witness to WitnessSet. Fails if
+ * ExpectedKeyHash is set and is not the hash of the derived key, since the witness would not unlock the input.
+ */
+static bool add_root_key_witness(
+    const cardano_bip32_private_key_t* RootKey,
+    const FCardanoKeyLocation& Location,
+    const FCardanoHash28* ExpectedKeyHash,
+    const cardano_blake2b_hash_t* BodyHash,
+    cardano_vkey_witness_set_t* WitnessSet)
 {
+    const cardano_derivation_path_t Path = Location.ToDerivationPath();
+    const uint32_t path[] = {
+        static_cast<uint32_t>(Path.purpose),
+        static_cast<uint32_t>(Path.coin_type),
+        static_cast<uint32_t>(Path.account),
+        static_cast<uint32_t>(Path.role),
+        static_cast<uint32_t>(Path.index)
+    };
 
-    // Prepare sanitized words for conversion
-    TArray<const char*> WordsPtr;
-    for (const FString& Word : MnemonicWords)
+    TCardanoRef<cardano_bip32_private_key_t> SpendingKey;
+    TCardanoRef<cardano_bip32_public_key_t> Bip32PublicKey;
+    TCardanoRef<cardano_ed25519_private_key_t> PrivateKey;
+    TCardanoRef<cardano_ed25519_public_key_t> PublicKey;
+
+    if (cardano_bip32_private_key_derive(RootKey, path, UE_ARRAY_COUNT(path), SpendingKey.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_bip32_private_key_to_ed25519_key(SpendingKey.Get(), PrivateKey.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_bip32_private_key_get_public_key(SpendingKey.Get(), Bip32PublicKey.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_bip32_public_key_to_ed25519_key(Bip32PublicKey.Get(), PublicKey.GetInitReference()) != CARDANO_SUCCESS)
     {
-        WordsPtr.Add(TCHAR_TO_UTF8(*Word));
+        UE_LOG(LogCardano, Error, TEXT("Failed to derive spending key %d'/%d/%d"), Location.Account, Location.Role, Location.Index);
+        return false;
     }
 
-    // Validate mnemonic word count (typical BIP-39 mnemonics are 12, 15, 18, 21, or 24 words)
-    if (WordsPtr.Num() < 12 || WordsPtr.Num() > 24 || (WordsPtr.Num() % 3 != 0))
+    if (ExpectedKeyHash)
     {
-        UE_LOG(LogTemp, Error, TEXT("Invalid number of mnemonic words: %d"), WordsPtr.Num());
-        return TArray<uint8>();
+        TCardanoRef<cardano_blake2b_hash_t> KeyHash;
+        if (cardano_ed25519_public_key_to_hash(PublicKey.Get(), KeyHash.GetInitReference()) != CARDANO_SUCCESS ||
+            cardano_blake2b_hash_get_bytes_size(KeyHash.Get()) != FCardanoHash28::Size ||
+            FMemory::Memcmp(cardano_blake2b_hash_get_data(KeyHash.Get()), ExpectedKeyHash->Bytes, FCardanoHash28::Size) != 0)
+        {
+            UE_LOG(LogCardano, Error, TEXT("Key %d'/%d/%d of the mnemonic does not lock the address of an input"), Location.Account, Location.Role, Location.Index);
+            return false;
+        }
     }
 
+    CARDANO_SCOPE(CardanoSign);
+    TCardanoRef<cardano_ed25519_signature_t> Signature;
+    TCardanoRef<cardano_vkey_witness_t> Witness;
+    return cardano_ed25519_private_key_sign(
+            PrivateKey.Get(),
+            cardano_blake2b_hash_get_data(BodyHash),
+            cardano_blake2b_hash_get_bytes_size(BodyHash),
+            Signature.GetInitReference()) == CARDANO_SUCCESS &&
+        cardano_vkey_witness_new(PublicKey.Get(), Signature.Get(), Witness.GetInitReference()) == CARDANO_SUCCESS &&
+        cardano_vkey_witness_set_add(WitnessSet, Witness.Get()) == CARDANO_SUCCESS;
+}
+
+/** The unsigned transaction of create_payment_transaction, with the parts BuildTransaction works on. */
+struct FPaymentTransaction
+{
+    TCardanoRef<cardano_transaction_t> Transaction;
+    TCardanoRef<cardano_transaction_body_t> Body;
+    TCardanoRef<cardano_witness_set_t> WitnessSet;
+    int64 NumInputs = 0;
+    int64 NumOutputs = 0;
+};
+
+/**
+ * Creates the unsigned transaction of BuildTransaction: Inputs paying AmountLovelace to ReceiverAddress, with the
+ * change sent back there. On failure logs why and returns false; whatever it created is released with OutPayment.
+ */
+static bool create_payment_transaction(
+    const TArray<FTransactionInput>& Inputs,
+    const FString& ReceiverAddress,
+    int64 AmountLovelace,
+    int64 FeeLovelace,
+    int64 TTL,
+    FPaymentTransaction& OutPayment)
+{
     // Constants
-    const int64 MIN_UTXO_VALUE = 961130; // Minimum ADA per output
     const int64 SLOT_LENGTH_IN_SECONDS = 1;
     const int64 SLOTS_PER_EPOCH = 432000;
 
+    // Both outputs hold ada alone at the receiver address, so they share one minimum. Without cached protocol
+    // parameters, fall back to a fixed minimum, 223 bytes at mainnet's 4310 lovelace per byte.
+    int64 MinUTxOValue = 961130;
+    FCardanoProtocolParameters CachedParameters;
+    UCardanoProtocolParamsCache* ParamsCache = IsInGameThread() ? UCardanoProtocolParamsCache::Get() : nullptr;
+    const int32 ReceiverAddressSize = FCardanoMinAda::GetAddressSize(ReceiverAddress);
+    if (ParamsCache && ParamsCache->GetCachedParameters(CachedParameters) && CachedParameters.CoinsPerUTxOByte > 0 && ReceiverAddressSize > 0)
+    {
+        MinUTxOValue = FCardanoMinAda::GetMinLovelace(CachedParameters.CoinsPerUTxOByte, ReceiverAddressSize, TArray<FTokenBalance>());
+    }
+
     // Validate output amount meets minimum requirement
-    if (AmountLovelace < MIN_UTXO_VALUE)
+    if (AmountLovelace < MinUTxOValue)
     {
-        UE_LOG(LogTemp, Error, TEXT("Output amount %lld is below minimum required value of %lld lovelace"), AmountLovelace, MIN_UTXO_VALUE);
-        return TArray<uint8>();
+        UE_LOG(LogCardano, Error, TEXT("Output amount %lld is below minimum required value of %lld lovelace"), AmountLovelace, MinUTxOValue);
+        return false;
     }
 
     // Calculate total input value
@@ -659,201 +1515,162 @@ TArray<uint8> UCardanoBlueprintLibrary::BuildTransaction(
     for (const FTransactionInput& Input : Inputs)
     {
         TotalInputValue += Input.Value;
-        UE_LOG(LogTemp, Log, TEXT("Adding input value %lld from UTXO %s"), Input.Value, *Input.TxHash);
+        UE_LOG(LogCardano, VeryVerbose, TEXT("Adding input value %lld from UTXO %s"), Input.Value, *Input.TxHash);
     }
 
     // Calculate change value
     int64 ChangeValue = TotalInputValue - AmountLovelace - FeeLovelace;
     if (ChangeValue < 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("Insufficient funds. Total: %lld, Attempting to send: %lld, Fee: %lld"),
+        UE_LOG(LogCardano, Error, TEXT("Insufficient funds. Total: %lld, Attempting to send: %lld, Fee: %lld"),
             TotalInputValue, AmountLovelace, FeeLovelace);
-        return TArray<uint8>();
+        return false;
     }
 
-    // Calculate proper TTL
-    const int64 CURRENT_SLOT = 146550425;
-    const int64 TTL_OFFSET = 7200; // 2 hours worth of slots
-    const int64 ProperTTL = CURRENT_SLOT + TTL_OFFSET;
+    // A non-positive TTL means two hours from the locally extrapolated tip
+    UCardanoChainTip* ChainTip = UCardanoChainTip::Get();
+    const int64 ProperTTL = TTL > 0 ? TTL : (ChainTip ? ChainTip->GetTimeToLive(7200) : 0);
+    if (ProperTTL <= 0)
+    {
+        UE_LOG(LogCardano, Error, TEXT("Unable to compute a TTL for the transaction"));
+        return false;
+    }
 
-    cardano_transaction_t* transaction = nullptr;
-    cardano_transaction_body_t* tx_body = nullptr;
-    cardano_transaction_input_set_t* input_set = nullptr;
-    cardano_transaction_output_list_t* output_list = nullptr;
-    cardano_address_t* receiver_addr = nullptr;
-    cardano_witness_set_t* witness_set = nullptr;
+    TCardanoRef<cardano_transaction_input_set_t> InputSet;
+    TCardanoRef<cardano_transaction_output_list_t> OutputList;
+    TCardanoRef<cardano_address_t> Receiver;
 
     // Create transaction input set
-    if (cardano_transaction_input_set_new(&input_set) != CARDANO_SUCCESS)
+    if (cardano_transaction_input_set_new(InputSet.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_transaction_input_set_reserve(InputSet.Get(), Inputs.Num()) != CARDANO_SUCCESS)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create transaction input set"));
-        return TArray<uint8>();
+        UE_LOG(LogCardano, Error, TEXT("Failed to create transaction input set"));
+        return false;
     }
 
     // Add inputs
     for (const FTransactionInput& Input : Inputs)
     {
-        cardano_transaction_input_t* tx_input = nullptr;
-        cardano_blake2b_hash_t* tx_hash = nullptr;
+        TCardanoRef<cardano_blake2b_hash_t> TxHash;
+        TCardanoRef<cardano_transaction_input_t> TxInput;
 
-        if (cardano_blake2b_hash_from_hex(TCHAR_TO_UTF8(*Input.TxHash), Input.TxHash.Len(), &tx_hash) != CARDANO_SUCCESS)
+        if (create_tx_hash(Input.TxHash, TxHash.GetInitReference()) != CARDANO_SUCCESS)
         {
-            UE_LOG(LogTemp, Error, TEXT("Failed to decode TxHash for input"));
-            cardano_transaction_input_set_unref(&input_set);
-            return TArray<uint8>();
+            UE_LOG(LogCardano, Error, TEXT("Failed to decode TxHash for input"));
+            return false;
         }
 
-        if (cardano_transaction_input_new(tx_hash, Input.TxIndex, &tx_input) != CARDANO_SUCCESS)
+        if (cardano_transaction_input_new(TxHash.Get(), Input.TxIndex, TxInput.GetInitReference()) != CARDANO_SUCCESS ||
+            cardano_transaction_input_set_add(InputSet.Get(), TxInput.Get()) != CARDANO_SUCCESS)
         {
-            UE_LOG(LogTemp, Error, TEXT("Failed to create transaction input"));
-            cardano_blake2b_hash_unref(&tx_hash);
-            cardano_transaction_input_set_unref(&input_set);
-            return TArray<uint8>();
+            UE_LOG(LogCardano, Error, TEXT("Failed to create transaction input"));
+            return false;
         }
-
-        cardano_transaction_input_set_add(input_set, tx_input);
-        cardano_transaction_input_unref(&tx_input);
-        cardano_blake2b_hash_unref(&tx_hash);
     }
 
     // Create transaction output list
-    if (cardano_transaction_output_list_new(&output_list) != CARDANO_SUCCESS)
+    if (cardano_transaction_output_list_new(OutputList.GetInitReference()) != CARDANO_SUCCESS)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create transaction output list"));
-        cardano_transaction_input_set_unref(&input_set);
-        return TArray<uint8>();
+        UE_LOG(LogCardano, Error, TEXT("Failed to create transaction output list"));
+        return false;
     }
 
     // Parse receiver address
-    const char* address_str = TCHAR_TO_UTF8(*ReceiverAddress);
-    size_t address_len = strlen(address_str);
-    if (cardano_address_from_string(address_str, address_len, &receiver_addr) != CARDANO_SUCCESS)
+    const FTCHARToUTF8 AddressUtf8(*ReceiverAddress);
+    if (cardano_address_from_string(AddressUtf8.Get(), AddressUtf8.Length(), Receiver.GetInitReference()) != CARDANO_SUCCESS)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to parse receiver address: %s"), *ReceiverAddress);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
-        return TArray<uint8>();
+        UE_LOG(LogCardano, Error, TEXT("Failed to parse receiver address: %s"), *ReceiverAddress);
+        return false;
     }
 
     // Create and add output
-    cardano_transaction_output_t* tx_output = nullptr;
-    if (cardano_transaction_output_new(receiver_addr, AmountLovelace, &tx_output) != CARDANO_SUCCESS)
+    TCardanoRef<cardano_transaction_output_t> Output;
+    if (cardano_transaction_output_new(Receiver.Get(), AmountLovelace, Output.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_transaction_output_list_add(OutputList.Get(), Output.Get()) != CARDANO_SUCCESS)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create transaction output"));
-        cardano_address_unref(&receiver_addr);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
-        return TArray<uint8>();
+        UE_LOG(LogCardano, Error, TEXT("Failed to create transaction output"));
+        return false;
     }
 
-    cardano_transaction_output_list_add(output_list, tx_output);
-    cardano_transaction_output_unref(&tx_output);
-
     // Add change output if needed
-    if (ChangeValue > MIN_UTXO_VALUE)
+    if (ChangeValue > MinUTxOValue)
     {
-        cardano_transaction_output_t* change_output = nullptr;
-        if (cardano_transaction_output_new(receiver_addr, ChangeValue, &change_output) != CARDANO_SUCCESS)
+        TCardanoRef<cardano_transaction_output_t> ChangeOutput;
+        if (cardano_transaction_output_new(Receiver.Get(), ChangeValue, ChangeOutput.GetInitReference()) != CARDANO_SUCCESS ||
+            cardano_transaction_output_list_add(OutputList.Get(), ChangeOutput.Get()) != CARDANO_SUCCESS)
         {
-            UE_LOG(LogTemp, Error, TEXT("Failed to create change output"));
-            cardano_address_unref(&receiver_addr);
-            cardano_transaction_output_list_unref(&output_list);
-            cardano_transaction_input_set_unref(&input_set);
-            return TArray<uint8>();
+            UE_LOG(LogCardano, Error, TEXT("Failed to create change output"));
+            return false;
         }
-
-        cardano_transaction_output_list_add(output_list, change_output);
-        cardano_transaction_output_unref(&change_output);
     }
 
-    cardano_address_unref(&receiver_addr);
-
     // Create transaction body
     uint64_t proper_ttl = static_cast<uint64_t>(ProperTTL);
-    if (cardano_transaction_body_new(input_set, output_list, FeeLovelace, &proper_ttl, &tx_body) != CARDANO_SUCCESS)
+    if (cardano_transaction_body_new(InputSet.Get(), OutputList.Get(), FeeLovelace, &proper_ttl, OutPayment.Body.GetInitReference()) != CARDANO_SUCCESS)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create transaction body"));
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
-        return TArray<uint8>();
+        UE_LOG(LogCardano, Error, TEXT("Failed to create transaction body"));
+        return false;
     }
 
     // Create empty witness set (will be replaced with signed witnesses)
-    if (cardano_witness_set_new(&witness_set) != CARDANO_SUCCESS)
+    if (cardano_witness_set_new(OutPayment.WitnessSet.GetInitReference()) != CARDANO_SUCCESS)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create witness set"));
-        cardano_transaction_body_unref(&tx_body);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
-        return TArray<uint8>();
+        UE_LOG(LogCardano, Error, TEXT("Failed to create witness set"));
+        return false;
     }
-    UE_LOG(LogTemp, Warning, TEXT("Successfully created witness set"));
 
     // Create transaction
-    if (cardano_transaction_new(tx_body, witness_set, nullptr, &transaction) != CARDANO_SUCCESS)
+    if (cardano_transaction_new(OutPayment.Body.Get(), OutPayment.WitnessSet.Get(), nullptr, OutPayment.Transaction.GetInitReference()) != CARDANO_SUCCESS)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create transaction"));
-        cardano_witness_set_unref(&witness_set);
-        cardano_transaction_body_unref(&tx_body);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
-        return TArray<uint8>();
+        UE_LOG(LogCardano, Error, TEXT("Failed to create transaction"));
+        return false;
     }
 
-    // Convert and sanitize mnemonic words to C-style array
-    const char* word_array[24] = { nullptr };
-    for (int32 i = 0; i < MnemonicWords.Num(); i++) {
-        // Trim whitespace and convert to lowercase
-        FString SanitizedWord = MnemonicWords[i].TrimStartAndEnd().ToLower();
-
-        // Remove any non-ascii characters
-        FString CleanWord;
-        for (TCHAR Character : SanitizedWord) {
-            if (Character >= 32 && Character <= 126) {
-                CleanWord.AppendChar(Character);
-            }
-        }
+    OutPayment.NumInputs = static_cast<int64>(cardano_transaction_input_set_get_length(InputSet.Get()));
+    OutPayment.NumOutputs = static_cast<int64>(cardano_transaction_output_list_get_length(OutputList.Get()));
+    return true;
+}
 
-        // Allocate memory for the C string that will persist through function
-        char* word = (char*)malloc(CleanWord.Len() + 1);
-        if (!word) {
-            // Clean up previously allocated strings
-            for (int32 j = 0; j < i; j++) {
-                free((void*)word_array[j]);
-            }
-            UE_LOG(LogTemp, Error, TEXT("Memory allocation failed"));
-            return TArray<uint8>();
-        }
+TArray<uint8> UCardanoBlueprintLibrary::BuildTransaction(
+    const TArray<FTransactionInput>& Inputs,
+    const FString& ReceiverAddress,
+    int64 AmountLovelace,
+    int64 FeeLovelace,
+    int64 TTL,
+    const TArray<FString>& MnemonicWords)  // Added mnemonic parameter
+{
+    CARDANO_SCOPE(CardanoBuild);
+    FCardanoOperationLog OperationLog(TEXT("BuildTransaction"));
 
-        FCStringAnsi::Strcpy(word, CleanWord.Len() + 1, TCHAR_TO_UTF8(*CleanWord));
-        word_array[i] = word;
+    // Validate mnemonic word count (typical BIP-39 mnemonics are 12, 15, 18, 21, or 24 words)
+    if (MnemonicWords.Num() < 12 || MnemonicWords.Num() > 24 || (MnemonicWords.Num() % 3 != 0))
+    {
+        UE_LOG(LogCardano, Error, TEXT("Invalid number of mnemonic words: %d"), MnemonicWords.Num());
+        return TArray<uint8>();
+    }
 
-        // UE_LOG(LogTemp, Warning, TEXT("Build Tx, Sanitized word %d: %s"), i + 1, *CleanWord);
+    FPaymentTransaction Payment;
+    if (!create_payment_transaction(Inputs, ReceiverAddress, AmountLovelace, FeeLovelace, TTL, Payment))
+    {
+        return TArray<uint8>();
     }
 
+    // Sanitized into one stack buffer, wiped when it goes out of scope
+    FCardanoMnemonicWords Words(MnemonicWords);
+
     // Convert mnemonic to entropy
     byte_t entropy[64] = { 0 };
     size_t entropy_size = 0;
 
-    // Free allocated word strings
-    for (int32 i = 0; i < 24; i++) {
-        free((void*)word_array[i]);
-    }
-
-    if (cardano_bip39_mnemonic_words_to_entropy(
-        word_array,
-        24,  // Explicitly specify 24 words
+    if (!Words.IsValid() || cardano_bip39_mnemonic_words_to_entropy(
+        Words.GetWords(),
+        Words.Num(),
         entropy,
         sizeof(entropy),
         &entropy_size
     ) != CARDANO_SUCCESS)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to convert mnemonic to entropy"));
-        cardano_transaction_unref(&transaction);
-        cardano_witness_set_unref(&witness_set);
-        cardano_transaction_body_unref(&tx_body);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
+        UE_LOG(LogCardano, Error, TEXT("Failed to convert mnemonic to entropy"));
         return TArray<uint8>();
     }
 
@@ -862,399 +1679,203 @@ TArray<uint8> UCardanoBlueprintLibrary::BuildTransaction(
     size_t password_length = 0;
 
     // Convert entropy to root key
-    cardano_bip32_private_key_t* root_key = nullptr;
-    if (cardano_bip32_private_key_from_bip39_entropy(
+    TCardanoRef<cardano_bip32_private_key_t> RootKey;
+    const cardano_error_t root_result = cardano_bip32_private_key_from_bip39_entropy(
         password,
         password_length,
         entropy,
         entropy_size,
-        &root_key) != CARDANO_SUCCESS)
+        RootKey.GetInitReference());
+    sodium_memzero(entropy, sizeof(entropy));
+
+    if (root_result != CARDANO_SUCCESS)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to derive root key from entropy"));
-        cardano_transaction_unref(&transaction);
-        cardano_witness_set_unref(&witness_set);
-        cardano_transaction_body_unref(&tx_body);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
+        UE_LOG(LogCardano, Error, TEXT("Failed to derive root key from entropy"));
         return TArray<uint8>();
     }
 
-    // Derive account key using CIP-1852
-    // m/1852'/1815'/0'/0/0
-    uint32_t path[] = {
-        cardano_bip32_harden(1852),  // purpose
-        cardano_bip32_harden(1815),  // coin_type (ADA)
-        cardano_bip32_harden(0),     // account #0
-        0,                           // chain (external)
-        0                            // address index
-    };
+    TArray<FCardanoKeyLocation> Locations;
+    TMap<FCardanoKeyLocation, FCardanoHash28> AddressKeyHashes;
+    resolve_input_keys(Inputs, Locations, AddressKeyHashes);
 
-    cardano_bip32_private_key_t* spending_key = nullptr;
-    if (cardano_bip32_private_key_derive(
-        root_key,
-        path,
-        5,  // path length
-        &spending_key) != CARDANO_SUCCESS)
-    {
-        UE_LOG(LogTemp, Error, TEXT("Failed to derive spending key"));
-        cardano_bip32_private_key_unref(&root_key);
-        cardano_transaction_unref(&transaction);
-        cardano_witness_set_unref(&witness_set);
-        cardano_transaction_body_unref(&tx_body);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
-        return TArray<uint8>();
-    }
+    // The body hash is both what the witnesses sign and the transaction ID
+    const TCardanoRef<cardano_blake2b_hash_t> BodyHash(cardano_transaction_body_get_hash(Payment.Body.Get()));
+    TCardanoRef<cardano_vkey_witness_set_t> VKeyWitnesses;
+    bool bSigned = BodyHash && cardano_vkey_witness_set_new(VKeyWitnesses.GetInitReference()) == CARDANO_SUCCESS;
 
-    // Convert BIP32 private key to Ed25519 private key
-    cardano_ed25519_private_key_t* ed_private_key = nullptr;
-    if (cardano_bip32_private_key_to_ed25519_key(spending_key, &ed_private_key) != CARDANO_SUCCESS)
+    // One witness per distinct key, however many inputs it locks
+    for (int32 i = 0; bSigned && i < Locations.Num(); i++)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to convert to ed25519 key"));
-        cardano_bip32_private_key_unref(&spending_key);
-        cardano_bip32_private_key_unref(&root_key);
-        cardano_transaction_unref(&transaction);
-        cardano_witness_set_unref(&witness_set);
-        cardano_transaction_body_unref(&tx_body);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
-        return TArray<uint8>();
+        bSigned = add_root_key_witness(RootKey.Get(), Locations[i], AddressKeyHashes.Find(Locations[i]), BodyHash.Get(), VKeyWitnesses.Get());
     }
 
-    // Convert BIP32 public key to Ed25519 public key
-    cardano_ed25519_public_key_t* ed_public_key = nullptr;
-    cardano_bip32_public_key_t* bip32_public_key = nullptr;
+    bSigned = bSigned &&
+        cardano_witness_set_set_vkeys(Payment.WitnessSet.Get(), VKeyWitnesses.Get()) == CARDANO_SUCCESS &&
+        cardano_transaction_set_witness_set(Payment.Transaction.Get(), Payment.WitnessSet.Get()) == CARDANO_SUCCESS;
 
-    // Get public key from spending key
-    if (cardano_bip32_private_key_get_public_key(spending_key, &bip32_public_key) != CARDANO_SUCCESS)
+    if (BodyHash)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to get public key"));
-        cardano_ed25519_private_key_unref(&ed_private_key);
-        cardano_bip32_private_key_unref(&spending_key);
-        cardano_bip32_private_key_unref(&root_key);
-        cardano_transaction_unref(&transaction);
-        cardano_witness_set_unref(&witness_set);
-        cardano_transaction_body_unref(&tx_body);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
-        return TArray<uint8>();
+        OperationLog.Add(TEXT("tx"), hash_to_hex(BodyHash.Get()));
     }
 
-    // Convert BIP32 public key to Ed25519 public key
-    if (cardano_bip32_public_key_to_ed25519_key(bip32_public_key, &ed_public_key) != CARDANO_SUCCESS)
+    if (!bSigned)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to convert public key to Ed25519"));
-        cardano_bip32_public_key_unref(&bip32_public_key);
-        cardano_ed25519_private_key_unref(&ed_private_key);
-        cardano_bip32_private_key_unref(&spending_key);
-        cardano_bip32_private_key_unref(&root_key);
-        cardano_transaction_unref(&transaction);
-        cardano_witness_set_unref(&witness_set);
-        cardano_transaction_body_unref(&tx_body);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
+        UE_LOG(LogCardano, Error, TEXT("Failed to sign transaction"));
+        OperationLog.Finish(false);
         return TArray<uint8>();
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("Before Hash transaction, Transaction Body Pointer: %p"), tx_body);
-    UE_LOG(LogTemp, Warning, TEXT("Before Hash transaction, Transaction Witness Set Pointer: %p"), witness_set);
+    OperationLog.Add(TEXT("inputs"), Payment.NumInputs);
+    OperationLog.Add(TEXT("outputs"), Payment.NumOutputs);
+    OperationLog.Add(TEXT("witnesses"), Locations.Num());
 
-    // Hash transaction body
-    cardano_buffer_t* tx_body_bytes = nullptr;
-    cardano_cbor_writer_t* body_writer = cardano_cbor_writer_new();
-    if (cardano_transaction_body_to_cbor(tx_body, body_writer) != CARDANO_SUCCESS ||
-        cardano_cbor_writer_encode_in_buffer(body_writer, &tx_body_bytes) != CARDANO_SUCCESS)
+    // Serialize the complete transaction
+    TArray<uint8> SerializedTransaction;
+    if (!serialize_transaction(Payment.Transaction.Get(), SerializedTransaction))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to serialize transaction body"));
-        cardano_ed25519_public_key_unref(&ed_public_key);
-        cardano_ed25519_private_key_unref(&ed_private_key);
-        cardano_bip32_public_key_unref(&bip32_public_key);
-        cardano_bip32_private_key_unref(&spending_key);
-        cardano_bip32_private_key_unref(&root_key);
-        cardano_transaction_unref(&transaction);
-        cardano_witness_set_unref(&witness_set);
-        cardano_transaction_body_unref(&tx_body);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
+        UE_LOG(LogCardano, Error, TEXT("Failed to serialize transaction"));
+        OperationLog.Finish(false);
         return TArray<uint8>();
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("Before Sign the serialized transaction body, Transaction Body Pointer: %p"), tx_body);
-    UE_LOG(LogTemp, Warning, TEXT("Before Sign the serialized transaction body, Transaction Witness Set Pointer: %p"), witness_set);
-
-    // Sign the serialized transaction body
-    cardano_ed25519_signature_t* signature = nullptr;
-    if (cardano_ed25519_private_key_sign(
-        ed_private_key,
-        cardano_buffer_get_data(tx_body_bytes),
-        cardano_buffer_get_size(tx_body_bytes),
-        &signature) != CARDANO_SUCCESS)
+    // The hex dump is only formatted when someone asked for it
+    if (UE_LOG_ACTIVE(LogCardano, VeryVerbose))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to sign transaction"));
-        cardano_buffer_unref(&tx_body_bytes);
-        cardano_cbor_writer_unref(&body_writer);
-        cardano_ed25519_public_key_unref(&ed_public_key);
-        cardano_ed25519_private_key_unref(&ed_private_key);
-        cardano_bip32_public_key_unref(&bip32_public_key);
-        cardano_bip32_private_key_unref(&spending_key);
-        cardano_bip32_private_key_unref(&root_key);
-        cardano_transaction_unref(&transaction);
-        cardano_witness_set_unref(&witness_set);
-        cardano_transaction_body_unref(&tx_body);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
-        return TArray<uint8>();
+        UE_LOG(LogCardano, VeryVerbose, TEXT("Transaction hex: %s"), *BytesToHex(SerializedTransaction.GetData(), SerializedTransaction.Num()).ToLower());
     }
+    OperationLog.Add(TEXT("bytes"), SerializedTransaction.Num());
+    OperationLog.Finish(SerializedTransaction.Num() > 0);
 
-    // 
-    UE_LOG(LogTemp, Warning, TEXT("Before Serialization, Transaction Body Pointer: %p"), tx_body);
-    UE_LOG(LogTemp, Warning, TEXT("Before Serialization, Transaction Witness Set Pointer: %p"), witness_set);
+    return SerializedTransaction;
+}
 
-    // Create VKey witness (now using Ed25519 public key)
-    cardano_vkey_witness_t* vkey_witness = nullptr;
-    if (cardano_vkey_witness_new(ed_public_key, signature, &vkey_witness) != CARDANO_SUCCESS)
+/** Creates the transaction of create_payment_transaction and serializes it without any witness. */
+static bool build_unsigned_payment(
+    const TArray<FTransactionInput>& Inputs,
+    const FString& ReceiverAddress,
+    int64 AmountLovelace,
+    int64 FeeLovelace,
+    int64 TTL,
+    TArray<uint8>& OutTransaction)
+{
+    FPaymentTransaction Payment;
+    if (!create_payment_transaction(Inputs, ReceiverAddress, AmountLovelace, FeeLovelace, TTL, Payment))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create VKey witness"));
-        // ... error cleanup ...
-        return TArray<uint8>();
+        return false;
     }
-    UE_LOG(LogTemp, Warning, TEXT("Successfully created vkey witness"));
 
-    // Create VKey witness set
-    cardano_vkey_witness_set_t* vkey_witness_set = nullptr;
-    if (cardano_vkey_witness_set_new(&vkey_witness_set) != CARDANO_SUCCESS)
+    if (!serialize_transaction(Payment.Transaction.Get(), OutTransaction))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create VKey witness set"));
-        cardano_vkey_witness_unref(&vkey_witness);
-        // ... error cleanup ...
-        return TArray<uint8>();
+        UE_LOG(LogCardano, Error, TEXT("Failed to serialize transaction"));
+        return false;
     }
-    UE_LOG(LogTemp, Warning, TEXT("Successfully created vkey witness set"));
+    return true;
+}
 
-    // Add witness to the set
-    if (cardano_vkey_witness_set_add(vkey_witness_set, vkey_witness) != CARDANO_SUCCESS)
-    {
-        UE_LOG(LogTemp, Error, TEXT("Failed to add VKey witness to set"));
-        cardano_vkey_witness_set_unref(&vkey_witness_set);
-        cardano_vkey_witness_unref(&vkey_witness);
-        // ... error cleanup ...
-        return TArray<uint8>();
-    }
-    UE_LOG(LogTemp, Warning, TEXT("Successfully added vkey witness to set"));
+TArray<uint8> UCardanoBlueprintLibrary::BuildTransactionWithKeyHandler(
+    const TArray<FTransactionInput>& Inputs,
+    const FString& ReceiverAddress,
+    int64 AmountLovelace,
+    int64 FeeLovelace,
+    int64 TTL,
+    cardano_secure_key_handler_t* KeyHandler,
+    const TArray<cardano_derivation_path_t>& DerivationPaths,
+    FString& OutError)
+{
+    CARDANO_SCOPE(CardanoBuild);
+    FCardanoOperationLog OperationLog(TEXT("BuildTransactionWithKeyHandler"));
 
-    // Set the VKey witness set in the witness set
-    if (cardano_witness_set_set_vkeys(witness_set, vkey_witness_set) != CARDANO_SUCCESS)
+    if (!KeyHandler)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to set VKey witness set in witness set"));
-        cardano_vkey_witness_set_unref(&vkey_witness_set);
-        cardano_vkey_witness_unref(&vkey_witness);
-        // ... error cleanup ...
+        OutError = TEXT("A key handler is required");
         return TArray<uint8>();
     }
-    UE_LOG(LogTemp, Warning, TEXT("Successfully set vkey witness set in witness set"));
 
-    // Update transaction with witness set
-    if (cardano_transaction_set_witness_set(transaction, witness_set) != CARDANO_SUCCESS)
+    TArray<cardano_derivation_path_t> Paths = DerivationPaths;
+    if (Paths.Num() == 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to set witness set in transaction"));
-        cardano_vkey_witness_set_unref(&vkey_witness_set);
-        cardano_vkey_witness_unref(&vkey_witness);
-        // ... error cleanup ...
-        return TArray<uint8>();
-    }
-
-    // Clean up the witness related objects
-    cardano_vkey_witness_set_unref(&vkey_witness_set);
-    cardano_vkey_witness_unref(&vkey_witness);
+        TArray<FCardanoKeyLocation> Locations;
+        TMap<FCardanoKeyLocation, FCardanoHash28> AddressKeyHashes;
+        resolve_input_keys(Inputs, Locations, AddressKeyHashes);
 
-    // Cleanup
-    cardano_vkey_witness_unref(&vkey_witness);
-    cardano_ed25519_signature_unref(&signature);
-    cardano_buffer_unref(&tx_body_bytes);
-    cardano_cbor_writer_unref(&body_writer);
-    cardano_ed25519_public_key_unref(&ed_public_key);
-    cardano_ed25519_private_key_unref(&ed_private_key);
-    cardano_bip32_public_key_unref(&bip32_public_key);
-    cardano_bip32_private_key_unref(&spending_key);
-    cardano_bip32_private_key_unref(&root_key);
-
-    // Serialize the complete transaction
-    cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
-    if (!writer) {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create CBOR writer"));
-        return TArray<uint8>();
-    }
-    UE_LOG(LogTemp, Warning, TEXT("Successfully created CBOR writer"));
-
-
-    // Debug checks before serialization
-    if (!transaction) { 
-        UE_LOG(LogTemp, Error, TEXT("Transaction is NULL before serialization"));
-        return TArray<uint8>();
-    }
-
-    // Check transaction body
-    cardano_transaction_body_t* debug_tx_body = cardano_transaction_get_body(transaction);
-    if (!debug_tx_body) {
-        UE_LOG(LogTemp, Error, TEXT("Transaction body is NULL"));
-        return TArray<uint8>();
-    }
-
-    // Check transaction inputs
-    cardano_transaction_input_set_t* inputs = cardano_transaction_body_get_inputs(debug_tx_body);
-    if (!inputs) {
-        UE_LOG(LogTemp, Error, TEXT("Transaction inputs are NULL"));
-        return TArray<uint8>();
-    }
-    size_t input_count = cardano_transaction_input_set_get_length(inputs);
-    UE_LOG(LogTemp, Warning, TEXT("Number of inputs: %d"), input_count);
-
-    // Check transaction outputs
-    cardano_transaction_output_list_t* outputs = cardano_transaction_body_get_outputs(debug_tx_body);
-    if (!outputs) {
-        UE_LOG(LogTemp, Error, TEXT("Transaction outputs are NULL"));
-        return TArray<uint8>();
-    }
-    size_t output_count = cardano_transaction_output_list_get_length(outputs);
-    UE_LOG(LogTemp, Warning, TEXT("Number of outputs: %d"), output_count);
-
-    // Check witness set
-    cardano_witness_set_t* current_witness = cardano_transaction_get_witness_set(transaction);
-    if (!current_witness) {
-        UE_LOG(LogTemp, Error, TEXT("Failed to get witness set from transaction"));
-        return TArray<uint8>();
-    }
-
-    // Check vkey witness set in witness set
-    cardano_vkey_witness_set_t* vkeys = cardano_witness_set_get_vkeys(current_witness);
-    if (!vkeys) {
-        UE_LOG(LogTemp, Error, TEXT("VKey witness set is NULL in witness set"));
-        return TArray<uint8>();
-    }
-    size_t vkey_count = cardano_vkey_witness_set_get_length(vkeys);
-    UE_LOG(LogTemp, Warning, TEXT("Number of VKey witnesses: %d"), vkey_count);
-
-    // Now try to serialize
-	cardano_cbor_writer_t* debug_writer = cardano_cbor_writer_new();
-	if (!debug_writer) {
-		UE_LOG(LogTemp, Error, TEXT("Failed to create CBOR writer"));
-		return TArray<uint8>();
-	}
-	UE_LOG(LogTemp, Warning, TEXT("Successfully created CBOR writer"));
-
-    // Before cardano_transaction_to_cbor call
-    UE_LOG(LogTemp, Warning, TEXT("Before Serialization, Transaction Body Pointer: %p"), tx_body);
-    UE_LOG(LogTemp, Warning, TEXT("Before Serialization, Transaction Witness Set Pointer: %p"), witness_set);
-
-    if (!transaction) {
-        UE_LOG(LogTemp, Error, TEXT("Transaction pointer is NULL"));
-        return TArray<uint8>();
-    }
-
-    const char* last_error = cardano_cbor_writer_get_last_error(debug_writer);
-    if (last_error) {
-        UE_LOG(LogTemp, Error, TEXT("CBOR Writer Error Before Serialization: %s"), (void*)last_error);
-    }
-
-    // Add this before attempting serialization
-    cardano_transaction_clear_cbor_cache(transaction);
-
-    cardano_vkey_witness_set_t* debug_vkeys = cardano_witness_set_get_vkeys(witness_set);
-    if (!debug_vkeys)
-    {
-        UE_LOG(LogTemp, Error, TEXT("VKey witness set is missing from witness set"));
-        return TArray<uint8>();
+        for (const FCardanoKeyLocation& Location : Locations)
+        {
+            Paths.Add(Location.ToDerivationPath());
+        }
     }
 
-    // Verify the witness set is properly attached
-    cardano_witness_set_t* attached_witness = cardano_transaction_get_witness_set(transaction);
-    if (!attached_witness)
+    TArray<uint8> Unsigned;
+    if (!build_unsigned_payment(Inputs, ReceiverAddress, AmountLovelace, FeeLovelace, TTL, Unsigned))
     {
-        UE_LOG(LogTemp, Error, TEXT("Witness set not properly attached to transaction"));
+        OutError = TEXT("Failed to build transaction");
         return TArray<uint8>();
     }
 
-    cardano_cbor_writer_t* body_debug_writer = cardano_cbor_writer_new();
-    if (cardano_transaction_body_to_cbor(tx_body, body_debug_writer) != CARDANO_SUCCESS)
+    TArray<uint8> Signed;
+    if (!FCardanoSigningPipeline::SignTransaction(KeyHandler, Unsigned, Paths, Signed, OutError))
     {
-        UE_LOG(LogTemp, Error, TEXT("Transaction body CBOR serialization failed"));
-        cardano_cbor_writer_unref(&body_debug_writer);
+        OperationLog.Finish(false);
         return TArray<uint8>();
     }
-    cardano_cbor_writer_unref(&body_debug_writer);
 
-    if (cardano_transaction_to_cbor(transaction, debug_writer) != CARDANO_SUCCESS) {
-        last_error = cardano_cbor_writer_get_last_error(debug_writer);
-        UE_LOG(LogTemp, Error, TEXT("Transaction CBOR Serialization Specific Error: %s"),
-            last_error ? UTF8_TO_TCHAR(last_error) : TEXT("Unknown error"));
-
-        // Additional diagnostic logging
-        UE_LOG(LogTemp, Error, TEXT("Transaction Body Pointer: %p"), cardano_transaction_get_body(transaction));
-        UE_LOG(LogTemp, Error, TEXT("Transaction Witness Set Pointer: %p"), cardano_transaction_get_witness_set(transaction));
-    }
-
-    if (!writer || cardano_transaction_to_cbor(transaction, writer) != CARDANO_SUCCESS)
-    {
-        UE_LOG(LogTemp, Error, TEXT("Failed to serialize transaction"));
-        cardano_transaction_unref(&transaction);
-        cardano_witness_set_unref(&witness_set);
-        cardano_transaction_body_unref(&tx_body);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
-        cardano_cbor_writer_unref(&writer);
-        return TArray<uint8>();
-    }
+    OperationLog.Add(TEXT("witnesses"), Paths.Num());
+    OperationLog.Add(TEXT("bytes"), Signed.Num());
+    OperationLog.Finish(true);
+    return Signed;
+}
 
-    // Extract serialized data into buffer
-    cardano_buffer_t* buffer = nullptr;
-    if (cardano_cbor_writer_encode_in_buffer(writer, &buffer) != CARDANO_SUCCESS)
+void UCardanoBlueprintLibrary::BuildWalletTransaction(
+    const TArray<FTransactionInput>& Inputs,
+    const FString& ReceiverAddress,
+    int64 AmountLovelace,
+    int64 FeeLovelace,
+    int64 TTL,
+    FCardanoWalletHandle Wallet,
+    const FString& Password,
+    const FOnWalletSigned& OnComplete)
+{
+    UCardanoWalletSubsystem* Wallets = UCardanoWalletSubsystem::Get();
+    if (!Wallets || !Wallets->IsWalletValid(Wallet))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to encode transaction into buffer"));
-        cardano_cbor_writer_unref(&writer);
-        cardano_transaction_unref(&transaction);
-        cardano_witness_set_unref(&witness_set);
-        cardano_transaction_body_unref(&tx_body);
-        cardano_transaction_output_list_unref(&output_list);
-        cardano_transaction_input_set_unref(&input_set);
-        return TArray<uint8>();
+        OnComplete.ExecuteIfBound(false, TArray<uint8>(), TEXT("Unknown wallet"));
+        return;
     }
 
-    // Convert buffer to TArray<uint8>
-    TArray<uint8> SerializedTransaction;
-    byte_t* buffer_data = cardano_buffer_get_data(buffer);
-    size_t buffer_size = cardano_buffer_get_size(buffer);
-
-    if (buffer_data && buffer_size > 0)
+    TArray<uint8> Unsigned;
     {
-        SerializedTransaction.Append(buffer_data, buffer_size);
-
-        // Debug log the hex representation
-        FString HexString;
-        for (int32 i = 0; i < SerializedTransaction.Num(); i++)
+        CARDANO_SCOPE(CardanoBuild);
+        if (!build_unsigned_payment(Inputs, ReceiverAddress, AmountLovelace, FeeLovelace, TTL, Unsigned))
         {
-            HexString += FString::Printf(TEXT("%02x"), SerializedTransaction[i]);
+            OnComplete.ExecuteIfBound(false, TArray<uint8>(), TEXT("Failed to build transaction"));
+            return;
         }
-        UE_LOG(LogTemp, Log, TEXT("Transaction hex: %s"), *HexString);
     }
 
-    // Cleanup
-    cardano_buffer_unref(&buffer);
-    cardano_cbor_writer_unref(&writer);
-    cardano_transaction_unref(&transaction);
-    cardano_witness_set_unref(&witness_set);
-    cardano_transaction_body_unref(&tx_body);
-    cardano_transaction_output_list_unref(&output_list);
-    cardano_transaction_input_set_unref(&input_set);
-
-    return SerializedTransaction;
+    Wallets->SignTransaction(Wallet, Unsigned, Password, OnComplete);
 }
 
+/** Lovelace per ada, as a number of decimals. */
+static const int32 LOVELACE_DECIMALS = 6;
+
 float UCardanoBlueprintLibrary::LovelaceToAda(const int64 Lovelace)
 {
-    return Lovelace / 1000000.0f;
+    return static_cast<float>(Lovelace / 1000000.0);
 }
 
 int64 UCardanoBlueprintLibrary::AdaToLovelace(const float Ada)
 {
-    return static_cast<int64>(Ada * 1000000.0f);
+    // Truncating would turn 1.1 ada, stored as 1.0999999, into 1099999 lovelace
+    return static_cast<int64>(FMath::RoundToDouble(static_cast<double>(Ada) * 1000000.0));
+}
+
+FString UCardanoBlueprintLibrary::LovelaceToAdaString(const int64 Lovelace)
+{
+    return FCardanoQuantity::FromInt64(Lovelace).ToDecimalString(LOVELACE_DECIMALS);
+}
+
+bool UCardanoBlueprintLibrary::AdaStringToLovelace(const FString& Ada, int64& OutLovelace)
+{
+    OutLovelace = 0;
+    FCardanoQuantity Lovelace;
+    return FCardanoQuantity::FromDecimalString(Ada.TrimStartAndEnd(), LOVELACE_DECIMALS, Lovelace) && Lovelace.ToInt64(OutLovelace);
 }
\ No newline at end of file
@@ -0,0 +1,711 @@
+#include "CardanoChainFollower.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoLog.h"
+#include "CardanoUTxOCache.h"
+#include "Engine/Engine.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include <cardano/address/address.h>
+#include <cardano/address/base_address.h>
+#include <cardano/address/enterprise_address.h>
+#include <cardano/address/pointer_address.h>
+#include <cardano/address/reward_address.h>
+
+/** Koios never returns more rows than this per request. */
+static const int32 KOIOS_PAGE_SIZE = 1000;
+
+/** Blocks compared per request while looking for the point a rollback went back to. */
+static const int32 ROLLBACK_SEARCH_WINDOW = 100;
+
+static FString MakeBlockTxInfoBody(const TArray<FString>& BlockHashes)
+{
+    FString RequestBody;
+    RequestBody.Reserve(UCardanoKoiosClient::EstimateStringListBodyLength(BlockHashes, 160));
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBody);
+
+    Writer->WriteObjectStart();
+    Writer->WriteArrayStart(TEXT("_block_hashes"));
+    for (const FString& BlockHash : BlockHashes)
+    {
+        Writer->WriteValue(BlockHash);
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteValue(TEXT("_inputs"), true);
+    Writer->WriteValue(TEXT("_assets"), true);
+    Writer->WriteValue(TEXT("_metadata"), false);
+    Writer->WriteValue(TEXT("_withdrawals"), false);
+    Writer->WriteValue(TEXT("_certs"), false);
+    Writer->WriteValue(TEXT("_scripts"), false);
+    Writer->WriteValue(TEXT("_bytecode"), false);
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return RequestBody;
+}
+
+/** Deserializes a Koios array response, returning an error message on failure. */
+static FString ReadJsonArray(const FHttpResponsePtr& Response, bool Success, TArray<TSharedPtr<FJsonValue>>& OutArray)
+{
+    if (!Success || !Response.IsValid())
+    {
+        return TEXT("Network request failed");
+    }
+    if (Response->GetResponseCode() != 200)
+    {
+        return FString::Printf(TEXT("Koios returned HTTP %d"), Response->GetResponseCode());
+    }
+    if (!ParseJsonArray(Response, OutArray))
+    {
+        return TEXT("Invalid response format");
+    }
+    return TEXT("");
+}
+
+/** Takes the hex hash of a credential and releases the credential. */
+static FString TakeCredentialHex(cardano_credential_t* Credential)
+{
+    const FString Hex = Credential ? FString(UTF8_TO_TCHAR(cardano_credential_get_hash_hex(Credential))) : FString();
+    cardano_credential_unref(&Credential);
+    return Hex;
+}
+
+/** The stake address a base address delegates to. */
+static FString GetStakeAddress(cardano_base_address_t* BaseAddress, cardano_network_id_t NetworkId)
+{
+    cardano_credential_t* stake_credential = cardano_base_address_get_stake_credential(BaseAddress);
+    cardano_reward_address_t* reward_address = nullptr;
+
+    FString StakeAddress;
+    if (stake_credential && cardano_reward_address_from_credentials(NetworkId, stake_credential, &reward_address) == CARDANO_SUCCESS)
+    {
+        StakeAddress = UTF8_TO_TCHAR(cardano_reward_address_get_string(reward_address));
+    }
+
+    cardano_reward_address_unref(&reward_address);
+    cardano_credential_unref(&stake_credential);
+    return StakeAddress;
+}
+
+/**
+ * Reads the payment credential and stake address an address is matched by; either may be empty. Returns false
+ * for addresses without credentials, such as Byron ones, which can only be matched by address.
+ */
+static bool ReadCredentials(const FString& Address, FString& OutPaymentCredential, FString& OutStakeAddress)
+{
+    const FTCHARToUTF8 AddressUtf8(*Address);
+    cardano_address_t* address = nullptr;
+    cardano_network_id_t network_id = CARDANO_NETWORK_ID_MAIN_NET;
+    if (cardano_address_from_string(AddressUtf8.Get(), AddressUtf8.Length(), &address) != CARDANO_SUCCESS
+        || cardano_address_get_network_id(address, &network_id) != CARDANO_SUCCESS)
+    {
+        cardano_address_unref(&address);
+        return false;
+    }
+
+    cardano_base_address_t* base_address = cardano_address_to_base_address(address);
+    cardano_enterprise_address_t* enterprise_address = base_address ? nullptr : cardano_address_to_enterprise_address(address);
+    cardano_pointer_address_t* pointer_address = base_address || enterprise_address ? nullptr : cardano_address_to_pointer_address(address);
+
+    if (base_address)
+    {
+        OutPaymentCredential = TakeCredentialHex(cardano_base_address_get_payment_credential(base_address));
+        OutStakeAddress = GetStakeAddress(base_address, network_id);
+    }
+    else if (enterprise_address)
+    {
+        OutPaymentCredential = TakeCredentialHex(cardano_enterprise_address_get_payment_credential(enterprise_address));
+    }
+    else if (pointer_address)
+    {
+        OutPaymentCredential = TakeCredentialHex(cardano_pointer_address_get_payment_credential(pointer_address));
+    }
+
+    const bool bHasCredentials = !OutPaymentCredential.IsEmpty();
+    cardano_base_address_unref(&base_address);
+    cardano_enterprise_address_unref(&enterprise_address);
+    cardano_pointer_address_unref(&pointer_address);
+    cardano_address_unref(&address);
+    return bHasCredentials;
+}
+
+/** Counts one more or one less reference to Key, dropping it at zero. */
+static void AdjustCount(TMap<FString, int32>& Counts, const FString& Key, bool bAdd)
+{
+    if (bAdd)
+    {
+        ++Counts.FindOrAdd(Key, 0);
+    }
+    else if (int32* Count = Counts.Find(Key))
+    {
+        if (--(*Count) <= 0)
+        {
+            Counts.Remove(Key);
+        }
+    }
+}
+
+UCardanoChainFollower* UCardanoChainFollower::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoChainFollower>() : nullptr;
+}
+
+void UCardanoChainFollower::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Collection.InitializeDependency(UCardanoKoiosClient::StaticClass());
+    Collection.InitializeDependency(UCardanoUTxOCache::StaticClass());
+
+    if (UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get())
+    {
+        WatchChangedHandle = Cache->OnWatchChanged().AddUObject(this, &UCardanoChainFollower::IndexAddress);
+        RebuildCredentialIndex();
+    }
+
+    PollHandle = FTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UCardanoChainFollower::Poll), FMath::Max(PollIntervalSeconds, 1.0f));
+
+    if (bStartOnInitialize)
+    {
+        Start();
+    }
+}
+
+void UCardanoChainFollower::Deinitialize()
+{
+    FTicker::GetCoreTicker().RemoveTicker(PollHandle);
+    Stop();
+
+    if (UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get())
+    {
+        Cache->OnWatchChanged().Remove(WatchChangedHandle);
+    }
+
+    Super::Deinitialize();
+}
+
+void UCardanoChainFollower::Start()
+{
+    if (bFollowing)
+    {
+        return;
+    }
+
+    ++Session;
+    bFollowing = true;
+    bPollInProgress = false;
+    RecentBlocks.Reset();
+    Poll(0.0f);
+}
+
+void UCardanoChainFollower::Stop()
+{
+    if (!bFollowing)
+    {
+        return;
+    }
+
+    ++Session;
+    bFollowing = false;
+    bPollInProgress = false;
+    RecentBlocks.Reset();
+
+    if (UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get())
+    {
+        Cache->StopFollowing();
+    }
+}
+
+void UCardanoChainFollower::WatchStakeAddress(const FString& StakeAddress)
+{
+    bool bAlreadyWatched = false;
+    ExtraStakeAddresses.Add(StakeAddress, &bAlreadyWatched);
+    if (!bAlreadyWatched)
+    {
+        AdjustCount(StakeAddresses, StakeAddress, true);
+    }
+}
+
+void UCardanoChainFollower::UnwatchStakeAddress(const FString& StakeAddress)
+{
+    if (ExtraStakeAddresses.Remove(StakeAddress) > 0)
+    {
+        AdjustCount(StakeAddresses, StakeAddress, false);
+    }
+}
+
+bool UCardanoChainFollower::Poll(float DeltaTime)
+{
+    if (!bFollowing || bPollInProgress)
+    {
+        return true;
+    }
+
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (!UCardanoKoiosClient::Get() || !Cache)
+    {
+        return true;
+    }
+
+    bPollInProgress = true;
+
+    if (RecentBlocks.Num() == 0)
+    {
+        FetchTip();
+        return true;
+    }
+
+    // Newly watched addresses are downloaded up to the follower's block; already followed ones cost nothing
+    if (Cache->GetWatchRevision() != RefreshedWatchRevision)
+    {
+        RefreshedWatchRevision = Cache->GetWatchRevision();
+        Cache->RefreshAll(FOnUTxOCacheRefreshed());
+    }
+
+    FetchNextBlocks();
+    return true;
+}
+
+void UCardanoChainFollower::FetchTip()
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateRequest(TEXT("GET"), TEXT("tip"));
+
+    TWeakObjectPtr<UCardanoChainFollower> WeakThis(this);
+    const uint32 RequestSession = Session;
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, RequestSession](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid() || WeakThis->Session != RequestSession)
+            {
+                return;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            FString Error = ReadJsonArray(Response, Success, JsonArray);
+
+            FBlockHeader Tip;
+            TSharedPtr<FJsonObject> TipObject = JsonArray.Num() > 0 ? JsonArray[0]->AsObject() : nullptr;
+            if (Error.IsEmpty() && (!TipObject.IsValid() || !TipObject->TryGetNumberField("block_no", Tip.Height) || !TipObject->TryGetStringField("hash", Tip.Hash)))
+            {
+                Error = TEXT("Missing block_no or hash in tip response");
+            }
+
+            if (!Error.IsEmpty())
+            {
+                WeakThis->FinishPoll(Error);
+                return;
+            }
+
+            UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+            Cache->BeginFollowing(Tip.Height, WeakThis->SecurityParameter);
+            WeakThis->RecentBlocks.Add(Tip);
+            WeakThis->RefreshedWatchRevision = Cache->GetWatchRevision();
+            Cache->RefreshAll(FOnUTxOCacheRefreshed());
+
+            UE_LOG(LogCardano, Log, TEXT("Chain follower started at block %lld"), Tip.Height);
+            WeakThis->FinishPoll(TEXT(""));
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+}
+
+void UCardanoChainFollower::FetchNextBlocks()
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    const FBlockHeader& Last = RecentBlocks.Last();
+
+    // The last applied block is listed again, so a changed hash gives a rollback away
+    const FString Path = FString::Printf(TEXT("blocks?select=hash,block_height,tx_count&block_height=gte.%lld&order=block_height.asc&limit=%d"),
+        Last.Height, FMath::Clamp(MaxBlocksPerPoll, 1, KOIOS_PAGE_SIZE - 1) + 1);
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateRequest(TEXT("GET"), Path);
+
+    TWeakObjectPtr<UCardanoChainFollower> WeakThis(this);
+    const uint32 RequestSession = Session;
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, RequestSession](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid() || WeakThis->Session != RequestSession)
+            {
+                return;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            const FString Error = ReadJsonArray(Response, Success, JsonArray);
+            if (!Error.IsEmpty())
+            {
+                WeakThis->FinishPoll(Error);
+                return;
+            }
+
+            TArray<FBlockHeader> Blocks;
+            for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+            {
+                TSharedPtr<FJsonObject> BlockObject = Item->AsObject();
+                FBlockHeader& Block = Blocks.AddDefaulted_GetRef();
+                if (!BlockObject.IsValid() || !BlockObject->TryGetNumberField("block_height", Block.Height)
+                    || !BlockObject->TryGetStringField("hash", Block.Hash) || !BlockObject->TryGetNumberField("tx_count", Block.TxCount)
+                    || (Blocks.Num() > 1 && Block.Height != Blocks[Blocks.Num() - 2].Height + 1))
+                {
+                    WeakThis->FinishPoll(TEXT("Invalid blocks response"));
+                    return;
+                }
+            }
+
+            // A Koios instance that has not seen our last block yet is behind, not on another fork
+            if (Blocks.Num() == 0)
+            {
+                WeakThis->FinishPoll(TEXT(""));
+                return;
+            }
+
+            const FBlockHeader& Last = WeakThis->RecentBlocks.Last();
+            if (Blocks[0].Height != Last.Height || Blocks[0].Hash != Last.Hash)
+            {
+                WeakThis->FindRollbackPoint(Last.Height);
+                return;
+            }
+
+            Blocks.RemoveAt(0);
+            if (Blocks.Num() == 0)
+            {
+                WeakThis->FinishPoll(TEXT(""));
+                return;
+            }
+
+            WeakThis->FetchBlockTransactions(Blocks, 0);
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+}
+
+void UCardanoChainFollower::FindRollbackPoint(int64 HighestHeight)
+{
+    const int64 OldestHeight = RecentBlocks[0].Height;
+    if (HighestHeight < OldestHeight)
+    {
+        // Deeper than the blocks kept: nothing is known to be common, so every followed address is redownloaded
+        UE_LOG(LogCardano, Warning, TEXT("Chain follower rolled back past block %lld, restarting from the tip"), OldestHeight);
+        RollBack(OldestHeight - 1);
+        RecentBlocks.Reset();
+        return;
+    }
+
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    const int64 LowestHeight = FMath::Max(OldestHeight, HighestHeight - ROLLBACK_SEARCH_WINDOW + 1);
+    const FString Path = FString::Printf(TEXT("blocks?select=hash,block_height&block_height=gte.%lld&block_height=lte.%lld"), LowestHeight, HighestHeight);
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateRequest(TEXT("GET"), Path);
+
+    TWeakObjectPtr<UCardanoChainFollower> WeakThis(this);
+    const uint32 RequestSession = Session;
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, RequestSession, LowestHeight](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid() || WeakThis->Session != RequestSession)
+            {
+                return;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            const FString Error = ReadJsonArray(Response, Success, JsonArray);
+            if (!Error.IsEmpty())
+            {
+                WeakThis->FinishPoll(Error);
+                return;
+            }
+
+            const TArray<FBlockHeader>& Recent = WeakThis->RecentBlocks;
+            int64 CommonHeight = -1;
+            for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+            {
+                TSharedPtr<FJsonObject> BlockObject = Item->AsObject();
+                int64 Height = 0;
+                FString Hash;
+                if (BlockObject.IsValid() && BlockObject->TryGetNumberField("block_height", Height) && BlockObject->TryGetStringField("hash", Hash))
+                {
+                    const int64 Index = Height - Recent[0].Height;
+                    if (Index >= 0 && Index < Recent.Num() && Recent[Index].Hash == Hash)
+                    {
+                        CommonHeight = FMath::Max(CommonHeight, Height);
+                    }
+                }
+            }
+
+            if (CommonHeight < 0)
+            {
+                WeakThis->FindRollbackPoint(LowestHeight - 1);
+                return;
+            }
+
+            WeakThis->RollBack(CommonHeight);
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+}
+
+void UCardanoChainFollower::RollBack(int64 BlockHeight)
+{
+    UE_LOG(LogCardano, Log, TEXT("Chain follower rolling back from block %lld to %lld"), GetBlockHeight(), BlockHeight);
+
+    RecentBlocks.RemoveAll([BlockHeight](const FBlockHeader& Block) { return Block.Height > BlockHeight; });
+
+    // Invalidated addresses are downloaded again right away
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    Cache->RollBackTo(BlockHeight);
+    Cache->RefreshAll(FOnUTxOCacheRefreshed());
+
+    OnRollback.Broadcast(BlockHeight);
+    FinishPoll(TEXT(""));
+}
+
+void UCardanoChainFollower::FetchBlockTransactions(const TArray<FBlockHeader>& Blocks, int32 FirstBlock)
+{
+    // Blocks are requested in groups whose transactions fit in one page; empty blocks and blocks nobody
+    // could match need no request at all
+    const bool bNothingWatched = PaymentCredentials.Num() == 0 && StakeAddresses.Num() == 0 && CredentialLessAddresses.Num() == 0;
+
+    TArray<FBlockHeader> Batch;
+    TArray<FString> BlockHashes;
+    int32 TxCount = 0;
+    int32 NextBlock = FirstBlock;
+    for (; NextBlock < Blocks.Num(); NextBlock++)
+    {
+        const FBlockHeader& Block = Blocks[NextBlock];
+        if (BlockHashes.Num() > 0 && TxCount + Block.TxCount > MaxTransactionsPerRequest)
+        {
+            break;
+        }
+
+        Batch.Add(Block);
+        if (Block.TxCount > 0 && !bNothingWatched)
+        {
+            BlockHashes.Add(Block.Hash);
+            TxCount += Block.TxCount;
+        }
+    }
+
+    if (BlockHashes.Num() == 0)
+    {
+        ApplyBlocks(Batch, TArray<TSharedPtr<FJsonValue>>());
+        if (NextBlock < Blocks.Num())
+        {
+            FetchBlockTransactions(Blocks, NextBlock);
+        }
+        else
+        {
+            FinishPoll(TEXT(""));
+        }
+        return;
+    }
+
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateJsonPost(TEXT("block_tx_info"), MakeBlockTxInfoBody(BlockHashes));
+
+    TWeakObjectPtr<UCardanoChainFollower> WeakThis(this);
+    const uint32 RequestSession = Session;
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, RequestSession, Blocks, Batch, NextBlock, TxCount](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid() || WeakThis->Session != RequestSession)
+            {
+                return;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            FString Error = ReadJsonArray(Response, Success, JsonArray);
+            if (Error.IsEmpty() && JsonArray.Num() != TxCount)
+            {
+                // A partial answer would silently drop transactions; the blocks are retried on the next poll
+                Error = FString::Printf(TEXT("block_tx_info returned %d of %d transactions"), JsonArray.Num(), TxCount);
+            }
+
+            if (!Error.IsEmpty())
+            {
+                WeakThis->FinishPoll(Error);
+                return;
+            }
+
+            WeakThis->ApplyBlocks(Batch, JsonArray);
+            if (NextBlock < Blocks.Num())
+            {
+                WeakThis->FetchBlockTransactions(Blocks, NextBlock);
+            }
+            else
+            {
+                WeakThis->FinishPoll(TEXT(""));
+            }
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::History);
+}
+
+void UCardanoChainFollower::ApplyBlocks(const TArray<FBlockHeader>& Blocks, const TArray<TSharedPtr<FJsonValue>>& Transactions)
+{
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+
+    TArray<FCardanoBlockDelta> Deltas;
+    TMap<FString, int32> BlockIndices;
+    for (const FBlockHeader& Block : Blocks)
+    {
+        BlockIndices.Add(Block.Hash, Deltas.Num());
+        Deltas.AddDefaulted_GetRef().BlockHeight = Block.Height;
+    }
+
+    TArray<TTuple<FString, FString, int64>> Activity;
+    for (const TSharedPtr<FJsonValue>& Item : Transactions)
+    {
+        TSharedPtr<FJsonObject> TxObject = Item->AsObject();
+        FString BlockHash;
+        FString TxHash;
+        if (!TxObject.IsValid() || !TxObject->TryGetStringField("block_hash", BlockHash) || !TxObject->TryGetStringField("tx_hash", TxHash))
+        {
+            continue;
+        }
+
+        const int32* BlockIndex = BlockIndices.Find(BlockHash);
+        if (!BlockIndex)
+        {
+            continue;
+        }
+
+        FCardanoBlockDelta& Delta = Deltas[*BlockIndex];
+        TSet<FString> MatchedAddresses;
+
+        const TArray<TSharedPtr<FJsonValue>>* Inputs = nullptr;
+        if (TxObject->TryGetArrayField("inputs", Inputs) && Inputs)
+        {
+            for (const TSharedPtr<FJsonValue>& InputValue : *Inputs)
+            {
+                TSharedPtr<FJsonObject> InputObject = InputValue->AsObject();
+                FString Address;
+                FString InputTxHash;
+                int64 InputTxIndex = 0;
+                FCardanoHash32 InputHash;
+                if (InputObject.IsValid() && MatchesWatched(*InputObject, Address)
+                    && InputObject->TryGetStringField("tx_hash", InputTxHash) && InputObject->TryGetNumberField("tx_index", InputTxIndex)
+                    && FCardanoHash32::FromHex(InputTxHash, InputHash))
+                {
+                    Delta.SpentInputs.Emplace(Address, FCardanoUTxORef(InputHash, static_cast<uint32>(InputTxIndex)));
+                    MatchedAddresses.Add(Address);
+                }
+            }
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* Outputs = nullptr;
+        if (TxObject->TryGetArrayField("outputs", Outputs) && Outputs)
+        {
+            for (const TSharedPtr<FJsonValue>& OutputValue : *Outputs)
+            {
+                TSharedPtr<FJsonObject> OutputObject = OutputValue->AsObject();
+                FString Address;
+                FUTxO UTxO;
+                if (OutputObject.IsValid() && MatchesWatched(*OutputObject, Address))
+                {
+                    if (Cache->IsWatched(Address) && ParseUTxO(*OutputObject, UTxO))
+                    {
+                        Delta.CreatedOutputs.Emplace(Address, MoveTemp(UTxO));
+                    }
+                    MatchedAddresses.Add(Address);
+                }
+            }
+        }
+
+        if (MatchedAddresses.Num() > 0)
+        {
+            Delta.TxHashes.Add(TxHash);
+            for (const FString& Address : MatchedAddresses)
+            {
+                Activity.Emplace(Address, TxHash, Delta.BlockHeight);
+            }
+        }
+    }
+
+    for (int32 i = 0; i < Blocks.Num(); i++)
+    {
+        Cache->ApplyBlock(Deltas[i]);
+        RecentBlocks.Add(Blocks[i]);
+    }
+
+    const int32 MaxRecentBlocks = FMath::Max(SecurityParameter, 1);
+    if (RecentBlocks.Num() > MaxRecentBlocks)
+    {
+        RecentBlocks.RemoveAt(0, RecentBlocks.Num() - MaxRecentBlocks, false);
+    }
+
+    for (const TTuple<FString, FString, int64>& Entry : Activity)
+    {
+        OnActivity.Broadcast(Entry.Get<0>(), Entry.Get<1>(), Entry.Get<2>());
+    }
+}
+
+void UCardanoChainFollower::RebuildCredentialIndex()
+{
+    PaymentCredentials.Reset();
+    StakeAddresses.Reset();
+    CredentialLessAddresses.Reset();
+
+    for (const FString& StakeAddress : ExtraStakeAddresses)
+    {
+        AdjustCount(StakeAddresses, StakeAddress, true);
+    }
+
+    for (const FString& Address : UCardanoUTxOCache::Get()->GetWatchedAddresses())
+    {
+        IndexAddress(Address, true);
+    }
+}
+
+void UCardanoChainFollower::IndexAddress(const FString& Address, bool bWatched)
+{
+    FString PaymentCredential;
+    FString StakeAddress;
+    if (!ReadCredentials(Address, PaymentCredential, StakeAddress))
+    {
+        if (bWatched)
+        {
+            CredentialLessAddresses.Add(Address);
+        }
+        else
+        {
+            CredentialLessAddresses.Remove(Address);
+        }
+        return;
+    }
+
+    if (bWatched)
+    {
+        PaymentCredentials.AddHex(PaymentCredential);
+    }
+    else
+    {
+        PaymentCredentials.RemoveHex(PaymentCredential);
+    }
+
+    if (!StakeAddress.IsEmpty())
+    {
+        AdjustCount(StakeAddresses, StakeAddress, bWatched);
+    }
+}
+
+bool UCardanoChainFollower::MatchesWatched(const FJsonObject& Row, FString& OutAddress) const
+{
+    const TSharedPtr<FJsonObject>* PaymentAddr = nullptr;
+    if (!Row.TryGetObjectField("payment_addr", PaymentAddr) || !PaymentAddr || !(*PaymentAddr)->TryGetStringField("bech32", OutAddress))
+    {
+        return false;
+    }
+
+    FString Credential;
+    FString StakeAddress;
+    return ((*PaymentAddr)->TryGetStringField("cred", Credential) && PaymentCredentials.ContainsHex(Credential))
+        || (Row.TryGetStringField("stake_addr", StakeAddress) && StakeAddresses.Contains(StakeAddress))
+        || CredentialLessAddresses.Contains(OutAddress);
+}
+
+void UCardanoChainFollower::FinishPoll(const FString& ErrorMessage)
+{
+    bPollInProgress = false;
+
+    if (!ErrorMessage.IsEmpty())
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Chain follower poll failed at block %lld: %s"), GetBlockHeight(), *ErrorMessage);
+    }
+}
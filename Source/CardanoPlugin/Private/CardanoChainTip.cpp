@@ -0,0 +1,128 @@
+#include "CardanoChainTip.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoLog.h"
+#include "Engine/Engine.h"
+#include "Interfaces/IHttpResponse.h"
+#include <cardano/time.h>
+
+UCardanoChainTip* UCardanoChainTip::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoChainTip>() : nullptr;
+}
+
+void UCardanoChainTip::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Collection.InitializeDependency(UCardanoKoiosClient::StaticClass());
+
+    StartSync();
+}
+
+void UCardanoChainTip::Sync(const FOnChainTipSynced& OnComplete)
+{
+    PendingCallbacks.Add(OnComplete);
+    StartSync();
+}
+
+int64 UCardanoChainTip::GetCurrentSlot()
+{
+    // Keep the cached tip fresh without ever blocking the caller
+    if (!bSyncInProgress && (LastSyncTime == 0.0 || FPlatformTime::Seconds() - LastSyncTime > ResyncIntervalSeconds))
+    {
+        StartSync();
+    }
+
+    const int64 Now = FDateTime::UtcNow().ToUnixTimestamp();
+
+    if (bSynced)
+    {
+        const int64 Elapsed = FMath::Max<int64>(Now - TipUnixTime, 0);
+        return TipSlot + Elapsed * 1000 / FMath::Max(SlotLengthMilliseconds, 1);
+    }
+
+    const uint64_t Slot = cardano_compute_slot_from_unix_time(static_cast<cardano_network_magic_t>(NetworkMagic), static_cast<uint64_t>(Now));
+    return Slot == UINT64_MAX ? 0 : static_cast<int64>(Slot);
+}
+
+int64 UCardanoChainTip::GetTimeToLive(int64 ValiditySeconds)
+{
+    const int64 CurrentSlot = GetCurrentSlot();
+    if (CurrentSlot == 0)
+    {
+        return 0;
+    }
+
+    return CurrentSlot + ValiditySeconds * 1000 / FMath::Max(SlotLengthMilliseconds, 1);
+}
+
+void UCardanoChainTip::StartSync()
+{
+    if (bSyncInProgress)
+    {
+        return;
+    }
+
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        FinishSync(false);
+        return;
+    }
+
+    bSyncInProgress = true;
+    LastSyncTime = FPlatformTime::Seconds();
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateRequest(TEXT("GET"), TEXT("tip"));
+    TWeakObjectPtr<UCardanoChainTip> WeakThis(this);
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            if (!Success || !Response.IsValid() ||
+                !ParseJsonArray(Response, JsonArray) ||
+                JsonArray.Num() == 0)
+            {
+                UE_LOG(LogCardano, Warning, TEXT("Failed to fetch chain tip"));
+                WeakThis->FinishSync(false);
+                return;
+            }
+
+            TSharedPtr<FJsonObject> TipObject = JsonArray[0]->AsObject();
+            int64 AbsSlot = 0;
+            int64 BlockTime = 0;
+            if (!TipObject.IsValid() || !TipObject->TryGetNumberField("abs_slot", AbsSlot) || !TipObject->TryGetNumberField("block_time", BlockTime))
+            {
+                UE_LOG(LogCardano, Warning, TEXT("Chain tip response is missing abs_slot or block_time"));
+                WeakThis->FinishSync(false);
+                return;
+            }
+
+            WeakThis->TipSlot = AbsSlot;
+            WeakThis->TipUnixTime = BlockTime;
+            WeakThis->bSynced = true;
+            UE_LOG(LogCardano, Log, TEXT("Chain tip synced at slot %lld"), AbsSlot);
+
+            WeakThis->FinishSync(true);
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+}
+
+void UCardanoChainTip::FinishSync(bool bSuccess)
+{
+    bSyncInProgress = false;
+
+    TArray<FOnChainTipSynced> Callbacks = MoveTemp(PendingCallbacks);
+    PendingCallbacks.Reset();
+
+    const int64 Slot = bSuccess ? TipSlot : 0;
+    for (const FOnChainTipSynced& Callback : Callbacks)
+    {
+        Callback.ExecuteIfBound(bSuccess, Slot);
+    }
+}
@@ -0,0 +1,379 @@
+#include "CardanoCorpusBenchmark.h"
+#include "CardanoLog.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include <cardano/cardano.h>
+
+// Reports list at most this many file names per category; the counts are always complete
+static const int32 MAX_LISTED_FILES = 20;
+
+namespace
+{
+    struct FCorpusEntry
+    {
+        FString Name;
+
+        /** Storage of the bytes unless they are mapped. */
+        TArray<uint8> Owned;
+        TArrayView<const uint8> Cbor;
+    };
+
+    /** The loaded corpus. Regions are released before the files they map. */
+    struct FCorpus
+    {
+        TArray<FCorpusEntry> Entries;
+        TArray<TUniquePtr<IMappedFileHandle>> MappedFiles;
+        TArray<TUniquePtr<IMappedFileRegion>> MappedRegions;
+
+        ~FCorpus()
+        {
+            Entries.Reset();
+            MappedRegions.Reset();
+            MappedFiles.Reset();
+        }
+    };
+
+    bool load_hex_file(const FString& Path, TArray<uint8>& OutCbor)
+    {
+        FString Hex;
+        if (!FFileHelper::LoadFileToString(Hex, *Path))
+        {
+            return false;
+        }
+
+        Hex.TrimStartAndEndInline();
+        OutCbor.SetNumUninitialized(Hex.Len() / 2);
+        return Hex.Len() > 0 && Hex.Len() % 2 == 0 && HexToBytes(Hex, OutCbor.GetData()) == OutCbor.Num();
+    }
+
+    bool map_file(const FString& Path, FCorpus& Corpus, TArrayView<const uint8>& OutCbor)
+    {
+        TUniquePtr<IMappedFileHandle> File(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+        if (!File.IsValid() || File->GetFileSize() <= 0)
+        {
+            return false;
+        }
+
+        TUniquePtr<IMappedFileRegion> Region(File->MapRegion(0, File->GetFileSize(), true));
+        if (!Region.IsValid())
+        {
+            return false;
+        }
+
+        OutCbor = TArrayView<const uint8>(Region->GetMappedPtr(), static_cast<int32>(Region->GetMappedSize()));
+        Corpus.MappedRegions.Add(MoveTemp(Region));
+        Corpus.MappedFiles.Add(MoveTemp(File));
+        return true;
+    }
+
+    void load_corpus(const FString& Directory, bool bMemoryMap, FCorpus& Corpus, FCardanoCorpusBenchmarkReport& Report)
+    {
+        TArray<FString> Files;
+        IFileManager::Get().FindFiles(Files, *Directory, nullptr);
+        Files.Sort();
+
+        for (const FString& File : Files)
+        {
+            const FString Extension = FPaths::GetExtension(File).ToLower();
+            const bool bRaw = Extension == TEXT("cbor");
+            if (!bRaw && Extension != TEXT("hex") && Extension != TEXT("txt"))
+            {
+                continue;
+            }
+
+            const FString Path = FPaths::Combine(Directory, File);
+            FCorpusEntry Entry;
+            Entry.Name = File;
+
+            bool bLoaded = false;
+            if (!bRaw)
+            {
+                bLoaded = load_hex_file(Path, Entry.Owned);
+            }
+            else if (bMemoryMap)
+            {
+                bLoaded = map_file(Path, Corpus, Entry.Cbor);
+            }
+            else
+            {
+                bLoaded = FFileHelper::LoadFileToArray(Entry.Owned, *Path) && Entry.Owned.Num() > 0;
+            }
+
+            if (!bLoaded)
+            {
+                Report.Rejected.Add(File);
+                continue;
+            }
+
+            if (Entry.Owned.Num() > 0)
+            {
+                Entry.Cbor = Entry.Owned;
+            }
+            Corpus.Entries.Add(MoveTemp(Entry));
+        }
+
+        // Fault every page in now, so a mapped corpus is not read from disk during the first timed pass
+        uint8 Checksum = 0;
+        for (const FCorpusEntry& Entry : Corpus.Entries)
+        {
+            for (int32 Offset = 0; Offset < Entry.Cbor.Num(); Offset += 4096)
+            {
+                Checksum ^= Entry.Cbor[Offset];
+            }
+        }
+        UE_LOG(LogCardano, Verbose, TEXT("Cardano corpus benchmark: loaded %d transactions (checksum %u)"), Corpus.Entries.Num(), Checksum);
+    }
+
+    cardano_error_t decode_transaction(TArrayView<const uint8> Cbor, cardano_transaction_t** out_transaction)
+    {
+        cardano_cbor_reader_t* reader = cardano_cbor_reader_new(Cbor.GetData(), Cbor.Num());
+        if (!reader)
+        {
+            return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+        }
+
+        const cardano_error_t result = cardano_transaction_from_cbor(reader, out_transaction);
+        cardano_cbor_reader_unref(&reader);
+        return result;
+    }
+
+    bool encode_transaction(cardano_transaction_t* transaction, TArray<uint8>& OutCbor)
+    {
+        cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+        cardano_buffer_t* buffer = nullptr;
+        const bool bEncoded = writer &&
+            cardano_transaction_to_cbor(transaction, writer) == CARDANO_SUCCESS &&
+            cardano_cbor_writer_encode_in_buffer(writer, &buffer) == CARDANO_SUCCESS;
+
+        if (bEncoded)
+        {
+            OutCbor = TArray<uint8>(cardano_buffer_get_data(buffer), static_cast<int32>(cardano_buffer_get_size(buffer)));
+        }
+
+        cardano_buffer_unref(&buffer);
+        cardano_cbor_writer_unref(&writer);
+        return bEncoded;
+    }
+
+    bool same_bytes(const TArray<uint8>& Encoded, TArrayView<const uint8> Expected)
+    {
+        return Encoded.Num() == Expected.Num() && FMemory::Memcmp(Encoded.GetData(), Expected.GetData(), Expected.Num()) == 0;
+    }
+
+    bool same_id(cardano_blake2b_hash_t* lhs, cardano_blake2b_hash_t* rhs)
+    {
+        return lhs && rhs && cardano_blake2b_hash_equals(lhs, rhs);
+    }
+
+    /**
+     * Runs Pass over the whole corpus until MinSeconds have elapsed, after one untimed warm-up pass. Pass returns the
+     * number of transactions it failed on.
+     */
+    FCardanoCorpusBenchmarkStage measure(const FString& Name, double MinSeconds, int32 Transactions, int64 Bytes, TFunctionRef<int64()> Pass)
+    {
+        FCardanoCorpusBenchmarkStage Stage;
+        Stage.Name = Name;
+
+        Pass();
+
+        const double Start = FPlatformTime::Seconds();
+        double Elapsed = 0.0;
+        do
+        {
+            Stage.Failures += Pass();
+            Stage.Passes++;
+            Elapsed = FPlatformTime::Seconds() - Start;
+        } while (Elapsed < MinSeconds);
+
+        Stage.Transactions = static_cast<int64>(Stage.Passes) * Transactions;
+        if (Elapsed > 0.0)
+        {
+            Stage.TxPerSecond = Stage.Transactions / Elapsed;
+            Stage.MBPerSecond = static_cast<double>(Stage.Passes) * Bytes / Elapsed / (1024.0 * 1024.0);
+        }
+        return Stage;
+    }
+}
+
+bool FCardanoCorpusBenchmark::Run(const FString& Directory, double MinSeconds, bool bMemoryMap, FCardanoCorpusBenchmarkReport& OutReport)
+{
+    OutReport = FCardanoCorpusBenchmarkReport();
+    OutReport.Directory = Directory;
+    OutReport.bMemoryMapped = bMemoryMap;
+    MinSeconds = FMath::Max(MinSeconds, 0.01);
+
+    FCorpus Corpus;
+    load_corpus(Directory, bMemoryMap, Corpus, OutReport);
+
+    // Decode everything once: the encode and hash stages run on these, and files that do not decode are dropped
+    TArray<const FCorpusEntry*> Entries;
+    TArray<cardano_transaction_t*> Transactions;
+    for (const FCorpusEntry& Entry : Corpus.Entries)
+    {
+        cardano_transaction_t* transaction = nullptr;
+        if (decode_transaction(Entry.Cbor, &transaction) != CARDANO_SUCCESS)
+        {
+            OutReport.Rejected.Add(Entry.Name);
+            continue;
+        }
+
+        Entries.Add(&Entry);
+        Transactions.Add(transaction);
+        OutReport.Bytes += Entry.Cbor.Num();
+    }
+    OutReport.Transactions = Transactions.Num();
+
+    if (Transactions.Num() == 0)
+    {
+        UE_LOG(LogCardano, Error, TEXT("Cardano corpus benchmark: no transaction could be loaded from %s"), *Directory);
+        return false;
+    }
+
+    // Round trips: the cached encoding must reproduce the input, and a full re-serialization should, with the same id
+    for (int32 Index = 0; Index < Transactions.Num(); ++Index)
+    {
+        cardano_transaction_t* transaction = Transactions[Index];
+        const FCorpusEntry& Entry = *Entries[Index];
+
+        TArray<uint8> Encoded;
+        if (!encode_transaction(transaction, Encoded) || !same_bytes(Encoded, Entry.Cbor))
+        {
+            OutReport.PreservedMismatches.Add(Entry.Name);
+        }
+
+        cardano_transaction_t* copy = nullptr;
+        if (decode_transaction(Entry.Cbor, &copy) != CARDANO_SUCCESS)
+        {
+            OutReport.ReencodeMismatches.Add(Entry.Name);
+            continue;
+        }
+
+        cardano_blake2b_hash_t* id = cardano_transaction_get_id(copy);
+        cardano_transaction_clear_cbor_cache(copy);
+        cardano_blake2b_hash_t* reencoded_id = cardano_transaction_get_id(copy);
+
+        if (!encode_transaction(copy, Encoded) || !same_bytes(Encoded, Entry.Cbor) || !same_id(id, reencoded_id))
+        {
+            OutReport.ReencodeMismatches.Add(Entry.Name);
+        }
+
+        cardano_blake2b_hash_unref(&reencoded_id);
+        cardano_blake2b_hash_unref(&id);
+        cardano_transaction_unref(&copy);
+    }
+
+    const int32 Count = Transactions.Num();
+    const int64 Bytes = OutReport.Bytes;
+
+    OutReport.Stages.Add(measure(TEXT("decode"), MinSeconds, Count, Bytes, [&Entries]()
+        {
+            int64 Failures = 0;
+            for (const FCorpusEntry* Entry : Entries)
+            {
+                cardano_transaction_t* transaction = nullptr;
+                Failures += decode_transaction(Entry->Cbor, &transaction) != CARDANO_SUCCESS;
+                cardano_transaction_unref(&transaction);
+            }
+            return Failures;
+        }));
+
+    // Clearing the caches makes to_cbor serialize every field instead of copying the input bytes back
+    OutReport.Stages.Add(measure(TEXT("encode"), MinSeconds, Count, Bytes, [&Transactions]()
+        {
+            int64 Failures = 0;
+            TArray<uint8> Cbor;
+            for (cardano_transaction_t* transaction : Transactions)
+            {
+                cardano_transaction_clear_cbor_cache(transaction);
+                Failures += !encode_transaction(transaction, Cbor);
+            }
+            return Failures;
+        }));
+
+    OutReport.Stages.Add(measure(TEXT("hash (tx id)"), MinSeconds, Count, Bytes, [&Transactions]()
+        {
+            int64 Failures = 0;
+            for (cardano_transaction_t* transaction : Transactions)
+            {
+                cardano_blake2b_hash_t* id = cardano_transaction_get_id(transaction);
+                Failures += id == nullptr;
+                cardano_blake2b_hash_unref(&id);
+            }
+            return Failures;
+        }));
+
+    for (cardano_transaction_t*& transaction : Transactions)
+    {
+        cardano_transaction_unref(&transaction);
+    }
+    return true;
+}
+
+FString FCardanoCorpusBenchmark::FormatReport(const FCardanoCorpusBenchmarkReport& Report)
+{
+    FString Text = FString::Printf(TEXT("corpus %s: %d transactions, %lld bytes%s\n"), *Report.Directory, Report.Transactions, Report.Bytes,
+        Report.bMemoryMapped ? TEXT(", memory-mapped") : TEXT(""));
+
+    Text += FString::Printf(TEXT("%-16s  %8s  %12s  %14s  %10s  %8s\n"), TEXT("stage"), TEXT("passes"), TEXT("tx"), TEXT("tx/s"), TEXT("MB/s"), TEXT("failed"));
+    for (const FCardanoCorpusBenchmarkStage& Stage : Report.Stages)
+    {
+        Text += FString::Printf(TEXT("%-16s  %8d  %12lld  %14.1f  %10.2f  %8lld\n"), *Stage.Name, Stage.Passes, Stage.Transactions, Stage.TxPerSecond, Stage.MBPerSecond, Stage.Failures);
+    }
+
+    auto AppendList = [&Text](const TCHAR* Label, const TArray<FString>& Names)
+    {
+        Text += FString::Printf(TEXT("%s: %d\n"), Label, Names.Num());
+        for (int32 Index = 0; Index < Names.Num() && Index < MAX_LISTED_FILES; ++Index)
+        {
+            Text += FString::Printf(TEXT("  %s\n"), *Names[Index]);
+        }
+        if (Names.Num() > MAX_LISTED_FILES)
+        {
+            Text += FString::Printf(TEXT("  ... and %d more\n"), Names.Num() - MAX_LISTED_FILES);
+        }
+    };
+
+    AppendList(TEXT("cached encoding differs from input"), Report.PreservedMismatches);
+    AppendList(TEXT("re-serialization differs from input"), Report.ReencodeMismatches);
+    AppendList(TEXT("rejected files"), Report.Rejected);
+    return Text;
+}
+
+static FAutoConsoleCommand BenchmarkCorpusCommand(
+    TEXT("Cardano.BenchmarkCorpus"),
+    TEXT("Decodes, re-encodes and hashes a directory of transactions (.cbor raw, .hex/.txt hex), checks the round trips and reports throughput. ")
+    TEXT("Usage: Cardano.BenchmarkCorpus <Directory> [MinSeconds=2] [mmap]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            if (Args.Num() < 1)
+            {
+                UE_LOG(LogCardano, Warning, TEXT("Usage: Cardano.BenchmarkCorpus <Directory> [MinSeconds=2] [mmap]"));
+                return;
+            }
+
+            const FString Directory = Args[0];
+            const double MinSeconds = Args.Num() > 1 ? FCString::Atod(*Args[1]) : 2.0;
+            const bool bMemoryMap = Args.Num() > 2 && Args[2].Equals(TEXT("mmap"), ESearchCase::IgnoreCase);
+
+            Async(EAsyncExecution::Thread, [Directory, MinSeconds, bMemoryMap]()
+                {
+                    FCardanoCorpusBenchmarkReport Report;
+                    if (!FCardanoCorpusBenchmark::Run(Directory, MinSeconds, bMemoryMap, Report))
+                    {
+                        return;
+                    }
+
+                    TArray<FString> Lines;
+                    FCardanoCorpusBenchmark::FormatReport(Report).ParseIntoArrayLines(Lines);
+                    for (const FString& Line : Lines)
+                    {
+                        UE_LOG(LogCardano, Log, TEXT("%s"), *Line);
+                    }
+                });
+        }));
@@ -0,0 +1,177 @@
+#include "CardanoCredentialFilter.h"
+
+/** 16 bits per credential with 8 probes in a 512-bit block keeps false positives around 0.1%. */
+static constexpr int32 BITS_PER_CREDENTIAL = 16;
+static constexpr int32 WORDS_PER_BLOCK = 8;
+static constexpr int32 BITS_PER_BLOCK = WORDS_PER_BLOCK * 64;
+static constexpr int32 PROBES = 8;
+
+static uint64 LoadWord(const uint8* Bytes)
+{
+    uint64 Word = 0;
+    FMemory::Memcpy(&Word, Bytes, sizeof(Word));
+    return Word;
+}
+
+FCardanoCredentialFilter::FCardanoCredentialFilter(int32 InitialCapacity)
+{
+    Rebuild(InitialCapacity);
+}
+
+void FCardanoCredentialFilter::Add(const uint8* Hash)
+{
+    FHash Key;
+    FMemory::Memcpy(Key.Bytes, Hash, HashSize);
+
+    int32& Count = Counts.FindOrAdd(Key, 0);
+    if (++Count > 1)
+    {
+        return;
+    }
+
+    if (Counts.Num() + StaleCount > Capacity)
+    {
+        Rebuild(Counts.Num() * 2);
+        return;
+    }
+
+    SetBits(Hash);
+}
+
+void FCardanoCredentialFilter::Remove(const uint8* Hash)
+{
+    FHash Key;
+    FMemory::Memcpy(Key.Bytes, Hash, HashSize);
+
+    int32* Count = Counts.Find(Key);
+    if (!Count || --(*Count) > 0)
+    {
+        return;
+    }
+
+    Counts.Remove(Key);
+    if (++StaleCount > Counts.Num())
+    {
+        Rebuild(Capacity);
+    }
+}
+
+bool FCardanoCredentialFilter::MayContain(const uint8* Hash) const
+{
+    const uint64* Block = Words.GetData() + (LoadWord(Hash) & BlockMask) * WORDS_PER_BLOCK;
+    uint64 Probes = LoadWord(Hash + 8);
+    uint64 MoreProbes = LoadWord(Hash + 16);
+
+    for (int32 i = 0; i < PROBES; i++)
+    {
+        const uint32 Bit = static_cast<uint32>(Probes & (BITS_PER_BLOCK - 1));
+        if ((Block[Bit >> 6] & (1ULL << (Bit & 63))) == 0)
+        {
+            return false;
+        }
+
+        // Nine bits per probe: seven probes from the first word, the last one from the second
+        Probes = i == 6 ? MoreProbes : Probes >> 9;
+    }
+
+    return true;
+}
+
+bool FCardanoCredentialFilter::Contains(const uint8* Hash) const
+{
+    if (!MayContain(Hash))
+    {
+        return false;
+    }
+
+    FHash Key;
+    FMemory::Memcpy(Key.Bytes, Hash, HashSize);
+    return Counts.Contains(Key);
+}
+
+bool FCardanoCredentialFilter::AddHex(const FString& Hex)
+{
+    FHash Hash;
+    if (!DecodeHex(Hex, Hash))
+    {
+        return false;
+    }
+
+    Add(Hash.Bytes);
+    return true;
+}
+
+bool FCardanoCredentialFilter::RemoveHex(const FString& Hex)
+{
+    FHash Hash;
+    if (!DecodeHex(Hex, Hash))
+    {
+        return false;
+    }
+
+    Remove(Hash.Bytes);
+    return true;
+}
+
+bool FCardanoCredentialFilter::ContainsHex(const FString& Hex) const
+{
+    FHash Hash;
+    return DecodeHex(Hex, Hash) && Contains(Hash.Bytes);
+}
+
+void FCardanoCredentialFilter::Reset()
+{
+    Counts.Reset();
+    Rebuild(0);
+}
+
+bool FCardanoCredentialFilter::DecodeHex(const FString& Hex, FHash& OutHash)
+{
+    if (Hex.Len() != HashSize * 2)
+    {
+        return false;
+    }
+
+    const TCHAR* Chars = *Hex;
+    for (int32 i = 0; i < HashSize; i++)
+    {
+        if (!FChar::IsHexDigit(Chars[2 * i]) || !FChar::IsHexDigit(Chars[2 * i + 1]))
+        {
+            return false;
+        }
+        OutHash.Bytes[i] = static_cast<uint8>((FParse::HexDigit(Chars[2 * i]) << 4) | FParse::HexDigit(Chars[2 * i + 1]));
+    }
+
+    return true;
+}
+
+void FCardanoCredentialFilter::SetBits(const uint8* Hash)
+{
+    uint64* Block = Words.GetData() + (LoadWord(Hash) & BlockMask) * WORDS_PER_BLOCK;
+    uint64 Probes = LoadWord(Hash + 8);
+    uint64 MoreProbes = LoadWord(Hash + 16);
+
+    for (int32 i = 0; i < PROBES; i++)
+    {
+        const uint32 Bit = static_cast<uint32>(Probes & (BITS_PER_BLOCK - 1));
+        Block[Bit >> 6] |= 1ULL << (Bit & 63);
+        Probes = i == 6 ? MoreProbes : Probes >> 9;
+    }
+}
+
+void FCardanoCredentialFilter::Rebuild(int32 NewCapacity)
+{
+    const int64 Bits = static_cast<int64>(FMath::Max3(NewCapacity, Counts.Num(), 64)) * BITS_PER_CREDENTIAL;
+    const uint64 BlockCount = FMath::RoundUpToPowerOfTwo64(static_cast<uint64>((Bits + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK));
+
+    Words.Reset();
+    Words.AddZeroed(static_cast<int32>(BlockCount * WORDS_PER_BLOCK));
+    BlockMask = BlockCount - 1;
+    Capacity = static_cast<int32>(BlockCount * BITS_PER_BLOCK / BITS_PER_CREDENTIAL);
+    StaleCount = 0;
+
+    for (const TPair<FHash, int32>& Entry : Counts)
+    {
+        SetBits(Entry.Key.Bytes);
+    }
+}
@@ -0,0 +1,179 @@
+#include "CardanoFrameScheduler.h"
+#include "CardanoLog.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/ScopeLock.h"
+
+static const int32 NUM_PRIORITIES = static_cast<int32>(ECardanoWorkPriority::Count);
+
+FCardanoFrameScheduler& FCardanoFrameScheduler::Get()
+{
+    static FCardanoFrameScheduler Scheduler;
+    return Scheduler;
+}
+
+void FCardanoFrameScheduler::Start()
+{
+    // Servers have cores to spare and no frame to keep smooth, so they keep running work as fast as possible
+    bool bSliced = !IsRunningDedicatedServer() && !IsRunningCommandlet();
+    float BudgetMilliseconds = 2.0f;
+    int32 MaxJobs = 1;
+
+    if (GConfig)
+    {
+        GConfig->GetBool(TEXT("CardanoPlugin"), TEXT("FrameSlicedWork"), bSliced, GGameIni);
+        GConfig->GetFloat(TEXT("CardanoPlugin"), TEXT("FrameBudgetMilliseconds"), BudgetMilliseconds, GGameIni);
+        GConfig->GetInt(TEXT("CardanoPlugin"), TEXT("MaxBackgroundJobs"), MaxJobs, GGameIni);
+    }
+
+    bFrameSliced = bSliced;
+    BudgetSeconds = FMath::Max(BudgetMilliseconds, 0.1f) / 1000.0;
+    {
+        FScopeLock Lock(&BackgroundLock);
+        MaxBackgroundJobs = FMath::Max(MaxJobs, 1);
+    }
+
+    if (bFrameSliced)
+    {
+        TickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FCardanoFrameScheduler::Tick));
+        UE_LOG(LogCardano, Log, TEXT("Frame-sliced work: %.1f ms per frame, %d background jobs at a time"), BudgetSeconds * 1000.0, MaxBackgroundJobs);
+    }
+}
+
+void FCardanoFrameScheduler::Stop()
+{
+    FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    TickHandle.Reset();
+
+    for (TArray<TUniqueFunction<bool(double)>>& Queue : Jobs)
+    {
+        Queue.Reset();
+    }
+
+    // Background jobs already running finish; the queued ones are dropped with the module
+    FScopeLock Lock(&BackgroundLock);
+    for (TArray<TUniqueFunction<void()>>& Queue : BackgroundJobs)
+    {
+        Queue.Reset();
+    }
+    bFrameSliced = false;
+}
+
+void FCardanoFrameScheduler::Submit(ECardanoWorkPriority Priority, TUniqueFunction<bool(double Deadline)> Step)
+{
+    check(IsInGameThread());
+
+    if (!bFrameSliced)
+    {
+        while (!Step(DBL_MAX))
+        {
+        }
+        return;
+    }
+
+    Jobs[static_cast<int32>(Priority)].Add(MoveTemp(Step));
+}
+
+void FCardanoFrameScheduler::ForEach(ECardanoWorkPriority Priority, int32 Count, TFunction<void(int32 Index)> Body, TUniqueFunction<void()> OnComplete)
+{
+    Submit(Priority, [Count, Body = MoveTemp(Body), OnComplete = MoveTemp(OnComplete), Next = 0](double Deadline) mutable
+        {
+            while (Next < Count)
+            {
+                Body(Next++);
+                if (FPlatformTime::Seconds() >= Deadline)
+                {
+                    break;
+                }
+            }
+
+            if (Next < Count)
+            {
+                return false;
+            }
+
+            if (OnComplete)
+            {
+                OnComplete();
+            }
+            return true;
+        });
+}
+
+bool FCardanoFrameScheduler::Tick(float DeltaTime)
+{
+    const double Deadline = FPlatformTime::Seconds() + BudgetSeconds;
+    bool bRanAny = false;
+
+    for (int32 p = 0; p < NUM_PRIORITIES; ++p)
+    {
+        // Jobs of a priority take turns, so a long one does not hold back the others; the first step of a frame
+        // always runs, or a budget smaller than one step would stall every job
+        while (Jobs[p].Num() > 0 && (!bRanAny || FPlatformTime::Seconds() < Deadline))
+        {
+            TUniqueFunction<bool(double)> Job = MoveTemp(Jobs[p][0]);
+            Jobs[p].RemoveAt(0, 1, false);
+            bRanAny = true;
+
+            if (!Job(Deadline))
+            {
+                Jobs[p].Add(MoveTemp(Job));
+            }
+        }
+
+        if (bRanAny && FPlatformTime::Seconds() >= Deadline)
+        {
+            break;
+        }
+    }
+
+    return true;
+}
+
+void FCardanoFrameScheduler::RunInBackground(ECardanoWorkPriority Priority, TUniqueFunction<void()> Work)
+{
+    if (!bFrameSliced)
+    {
+        Async(EAsyncExecution::ThreadPool, MoveTemp(Work));
+        return;
+    }
+
+    FScopeLock Lock(&BackgroundLock);
+    BackgroundJobs[static_cast<int32>(Priority)].Add(MoveTemp(Work));
+    DispatchBackground();
+}
+
+void FCardanoFrameScheduler::DispatchBackground()
+{
+    while (RunningBackgroundJobs < MaxBackgroundJobs)
+    {
+        TArray<TUniqueFunction<void()>>* Queue = nullptr;
+        for (TArray<TUniqueFunction<void()>>& Candidate : BackgroundJobs)
+        {
+            if (Candidate.Num() > 0)
+            {
+                Queue = &Candidate;
+                break;
+            }
+        }
+
+        if (!Queue)
+        {
+            return;
+        }
+
+        TUniqueFunction<void()> Work = MoveTemp((*Queue)[0]);
+        Queue->RemoveAt(0, 1, false);
+        ++RunningBackgroundJobs;
+
+        Async(EAsyncExecution::ThreadPool, [this, Work = MoveTemp(Work)]() mutable
+            {
+                Work();
+
+                FScopeLock Lock(&BackgroundLock);
+                --RunningBackgroundJobs;
+                DispatchBackground();
+            });
+    }
+}
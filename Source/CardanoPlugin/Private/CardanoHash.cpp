@@ -0,0 +1,162 @@
+#include "CardanoHash.h"
+
+FString CardanoBytesToHex(const uint8* Bytes, int32 Size)
+{
+    static const TCHAR Digits[] = TEXT("0123456789abcdef");
+
+    FString Hex;
+    TArray<TCHAR, FString::AllocatorType>& Chars = Hex.GetCharArray();
+    Chars.SetNumUninitialized(Size * 2 + 1);
+    for (int32 i = 0; i < Size; i++)
+    {
+        Chars[2 * i] = Digits[Bytes[i] >> 4];
+        Chars[2 * i + 1] = Digits[Bytes[i] & 0x0f];
+    }
+    Chars[Size * 2] = TEXT('\0');
+    return Hex;
+}
+
+/** Value of each hex digit below 128, or 0xff for any other character. */
+static const uint8* HexDigitValues()
+{
+    struct FTable
+    {
+        uint8 Values[128];
+
+        FTable()
+        {
+            FMemory::Memset(Values, 0xff, sizeof(Values));
+            for (uint8 i = 0; i < 10; i++)
+            {
+                Values['0' + i] = i;
+            }
+            for (uint8 i = 0; i < 6; i++)
+            {
+                Values['a' + i] = Values['A' + i] = 10 + i;
+            }
+        }
+    };
+
+    static const FTable Table;
+    return Table.Values;
+}
+
+bool CardanoHexToBytes(const TCHAR* Hex, int32 Length, uint8* OutBytes)
+{
+    if (Length % 2 != 0)
+    {
+        return false;
+    }
+
+    // Validated before anything is written, so OutBytes is still untouched when a digit is bad
+    const uint8* Values = HexDigitValues();
+    for (int32 i = 0; i < Length; i += 2)
+    {
+        const uint32 High = static_cast<uint32>(Hex[i]);
+        const uint32 Low = static_cast<uint32>(Hex[i + 1]);
+        if (High >= 128 || Low >= 128 || (Values[High] | Values[Low]) == 0xff)
+        {
+            return false;
+        }
+    }
+
+    for (int32 i = 0; i < Length; i += 2)
+    {
+        OutBytes[i / 2] = static_cast<uint8>((Values[static_cast<uint32>(Hex[i])] << 4) | Values[static_cast<uint32>(Hex[i + 1])]);
+    }
+    return true;
+}
+
+bool CardanoHexToBytes(const FString& Hex, uint8* OutBytes, int32 Size)
+{
+    return Hex.Len() == Size * 2 && CardanoHexToBytes(*Hex, Hex.Len(), OutBytes);
+}
+
+/** Text export shared by both sizes: bare hex, which round-trips through config files, copy-paste and JSON. */
+static bool ImportHex(const TCHAR*& Buffer, uint8* OutBytes, int32 Size)
+{
+    const TCHAR* Start = Buffer;
+    int32 Length = 0;
+    while (Length < Size * 2 && FChar::IsHexDigit(Start[Length]))
+    {
+        ++Length;
+    }
+
+    if (Length != Size * 2 || FChar::IsHexDigit(Start[Length]) || !CardanoHexToBytes(Start, Length, OutBytes))
+    {
+        return false;
+    }
+
+    Buffer += Length;
+    return true;
+}
+
+static bool IsZeroBytes(const uint8* Bytes, int32 Size)
+{
+    for (int32 i = 0; i < Size; i++)
+    {
+        if (Bytes[i] != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FCardanoHash32::IsZero() const
+{
+    return IsZeroBytes(Bytes, Size);
+}
+
+bool FCardanoHash32::Serialize(FArchive& Ar)
+{
+    Ar.Serialize(Bytes, Size);
+    return true;
+}
+
+bool FCardanoHash32::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar.Serialize(Bytes, Size);
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
+
+bool FCardanoHash32::ExportTextItem(FString& ValueStr, const FCardanoHash32& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const
+{
+    ValueStr += ToHex();
+    return true;
+}
+
+bool FCardanoHash32::ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText)
+{
+    return ImportHex(Buffer, Bytes, Size);
+}
+
+bool FCardanoHash28::IsZero() const
+{
+    return IsZeroBytes(Bytes, Size);
+}
+
+bool FCardanoHash28::Serialize(FArchive& Ar)
+{
+    Ar.Serialize(Bytes, Size);
+    return true;
+}
+
+bool FCardanoHash28::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar.Serialize(Bytes, Size);
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
+
+bool FCardanoHash28::ExportTextItem(FString& ValueStr, const FCardanoHash28& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const
+{
+    ValueStr += ToHex();
+    return true;
+}
+
+bool FCardanoHash28::ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText)
+{
+    return ImportHex(Buffer, Bytes, Size);
+}
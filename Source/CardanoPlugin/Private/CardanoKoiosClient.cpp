@@ -0,0 +1,543 @@
+#include "CardanoKoiosClient.h"
+#include "CardanoLog.h"
+#include "CardanoStats.h"
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/Compression.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+/** Inflated bodies larger than this are rejected rather than allocated; far above any Koios response. */
+static const int64 MAX_INFLATED_BODY_SIZE = 512 * 1024 * 1024;
+
+namespace
+{
+    /** A response whose gzip body was inflated by the client; everything but the body is read from the original. */
+    class FInflatedHttpResponse : public IHttpResponse
+    {
+    public:
+        FInflatedHttpResponse(FHttpResponsePtr InOriginal, TArray<uint8> InContent)
+            : Original(MoveTemp(InOriginal))
+            , Content(MoveTemp(InContent))
+        {
+        }
+
+        virtual FString GetURL() const override { return Original->GetURL(); }
+        virtual FString GetURLParameter(const FString& ParameterName) const override { return Original->GetURLParameter(ParameterName); }
+
+        virtual FString GetHeader(const FString& HeaderName) const override
+        {
+            if (HeaderName.Equals(TEXT("Content-Encoding"), ESearchCase::IgnoreCase))
+            {
+                return FString();
+            }
+            if (HeaderName.Equals(TEXT("Content-Length"), ESearchCase::IgnoreCase))
+            {
+                return FString::FromInt(Content.Num());
+            }
+            return Original->GetHeader(HeaderName);
+        }
+
+        virtual TArray<FString> GetAllHeaders() const override { return Original->GetAllHeaders(); }
+        virtual FString GetContentType() const override { return Original->GetContentType(); }
+        virtual int32 GetContentLength() const override { return Content.Num(); }
+        virtual const TArray<uint8>& GetContent() const override { return Content; }
+        virtual int32 GetResponseCode() const override { return Original->GetResponseCode(); }
+
+        virtual FString GetContentAsString() const override
+        {
+            const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+            return FString(Converted.Length(), Converted.Get());
+        }
+
+    private:
+        FHttpResponsePtr Original;
+        TArray<uint8> Content;
+    };
+
+    /** Size a gzip body inflates to, from its trailer, or -1 if Content is not a gzip stream the backend left alone. */
+    int64 get_gzip_inflated_size(const FHttpResponsePtr& Response)
+    {
+        const TArray<uint8>& Content = Response->GetContent();
+        if (Content.Num() < 18 || Content[0] != 0x1f || Content[1] != 0x8b || !Response->GetHeader(TEXT("Content-Encoding")).Contains(TEXT("gzip")))
+        {
+            return -1;
+        }
+
+        // ISIZE, the inflated size modulo 2^32, closes the stream
+        const uint8* Trailer = Content.GetData() + Content.Num() - 4;
+        return static_cast<int64>(Trailer[0]) | (static_cast<int64>(Trailer[1]) << 8) | (static_cast<int64>(Trailer[2]) << 16) | (static_cast<int64>(Trailer[3]) << 24);
+    }
+
+    /** Inflates the gzip body of Response; returns nullptr if it does not inflate to exactly InflatedSize bytes. */
+    FHttpResponsePtr inflate_response(const FHttpResponsePtr& Response, int64 InflatedSize)
+    {
+        if (InflatedSize > MAX_INFLATED_BODY_SIZE)
+        {
+            return nullptr;
+        }
+
+        TArray<uint8> Inflated;
+        Inflated.SetNumUninitialized(static_cast<int32>(InflatedSize));
+
+        const TArray<uint8>& Content = Response->GetContent();
+        if (!FCompression::UncompressMemory(NAME_Gzip, Inflated.GetData(), Inflated.Num(), Content.GetData(), Content.Num()))
+        {
+            return nullptr;
+        }
+
+        return MakeShared<FInflatedHttpResponse, ESPMode::ThreadSafe>(Response, MoveTemp(Inflated));
+    }
+
+    /** Last path segment of URL, e.g. address_utxos, which labels the request metrics without their unbounded query. */
+    FString get_endpoint_label(const FString& URL)
+    {
+        int32 QueryStart = INDEX_NONE;
+        const FString Path = URL.FindChar(TEXT('?'), QueryStart) ? URL.Left(QueryStart) : URL;
+
+        int32 SegmentStart = INDEX_NONE;
+        return Path.FindLastChar(TEXT('/'), SegmentStart) ? Path.RightChop(SegmentStart + 1) : Path;
+    }
+}
+
+UCardanoKoiosClient* UCardanoKoiosClient::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoKoiosClient>() : nullptr;
+}
+
+void UCardanoKoiosClient::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    MetricsHandle = FCardanoMetrics::Get().OnCollect().AddUObject(this, &UCardanoKoiosClient::CollectMetrics);
+}
+
+void UCardanoKoiosClient::Deinitialize()
+{
+    FCardanoMetrics::Get().OnCollect().Remove(MetricsHandle);
+    MetricsHandle.Reset();
+
+    FTicker::GetCoreTicker().RemoveTicker(PumpHandle);
+    PumpHandle.Reset();
+
+    // Callers still waiting on a queued request get the same answer as a failed connection
+    for (TArray<TSharedRef<FQueuedRequest>>& Queue : Queues)
+    {
+        TArray<TSharedRef<FQueuedRequest>> Abandoned = MoveTemp(Queue);
+        for (const TSharedRef<FQueuedRequest>& Queued : Abandoned)
+        {
+            DEC_DWORD_STAT(STAT_CardanoRequestsQueued);
+            --NumQueued;
+            Queued->OnComplete.ExecuteIfBound(Queued->Request, nullptr, false);
+        }
+    }
+
+    Super::Deinitialize();
+}
+
+void UCardanoKoiosClient::SetBaseUrl(const FString& InBaseUrl)
+{
+    BaseUrl = InBaseUrl;
+
+    // Paths are always appended with a leading slash
+    while (BaseUrl.EndsWith(TEXT("/")))
+    {
+        BaseUrl.RemoveAt(BaseUrl.Len() - 1);
+    }
+}
+
+void UCardanoKoiosClient::SetAuthToken(const FString& InAuthToken)
+{
+    AuthToken = InAuthToken;
+}
+
+void UCardanoKoiosClient::SetTimeout(float InTimeoutSeconds)
+{
+    TimeoutSeconds = FMath::Max(InTimeoutSeconds, 0.0f);
+}
+
+void UCardanoKoiosClient::SetDefaultHeader(const FString& Name, const FString& Value)
+{
+    if (Value.IsEmpty())
+    {
+        DefaultHeaders.Remove(Name);
+    }
+    else
+    {
+        DefaultHeaders.Add(Name, Value);
+    }
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UCardanoKoiosClient::CreateRequest(const FString& Verb, const FString& Path) const
+{
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    HttpRequest->SetVerb(Verb);
+    HttpRequest->SetURL(Path.StartsWith(TEXT("/")) ? BaseUrl + Path : BaseUrl / Path);
+    HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
+
+    if (bAcceptCompressedResponses)
+    {
+        HttpRequest->SetHeader(TEXT("Accept-Encoding"), TEXT("gzip"));
+    }
+
+    // Let the HTTP backend keep the TLS connection to Koios open between polls
+    HttpRequest->SetHeader(TEXT("Connection"), TEXT("keep-alive"));
+
+    if (!AuthToken.IsEmpty())
+    {
+        HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *AuthToken));
+    }
+
+    for (const TPair<FString, FString>& Header : DefaultHeaders)
+    {
+        HttpRequest->SetHeader(Header.Key, Header.Value);
+    }
+
+    if (TimeoutSeconds > 0.0f)
+    {
+        HttpRequest->SetTimeout(TimeoutSeconds);
+    }
+
+    return HttpRequest;
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UCardanoKoiosClient::CreateJsonPost(const FString& Path, const FString& Body) const
+{
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateRequest(TEXT("POST"), Path);
+    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    HttpRequest->SetContentAsString(Body);
+    return HttpRequest;
+}
+
+int32 UCardanoKoiosClient::EstimateStringListBodyLength(const TArray<FString>& Values, int32 ExtraChars)
+{
+    // Two quotes and a comma around every element; addresses and hashes never need escaping
+    int32 Length = ExtraChars;
+    for (const FString& Value : Values)
+    {
+        Length += Value.Len() + 3;
+    }
+    return Length;
+}
+
+FString UCardanoKoiosClient::MakeAddressesBody(const TArray<FString>& Addresses, bool bExtended)
+{
+    FString RequestBody;
+    RequestBody.Reserve(EstimateStringListBodyLength(Addresses, 40));
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBody);
+
+    Writer->WriteObjectStart();
+    Writer->WriteArrayStart(TEXT("_addresses"));
+    for (const FString& Address : Addresses)
+    {
+        Writer->WriteValue(Address);
+    }
+    Writer->WriteArrayEnd();
+
+    if (bExtended)
+    {
+        Writer->WriteValue(TEXT("_extended"), true);
+    }
+
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return RequestBody;
+}
+
+void UCardanoKoiosClient::ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, ECardanoRequestPriority Priority)
+{
+    TSharedRef<FQueuedRequest> Queued = MakeShared<FQueuedRequest>(FQueuedRequest{ Request, Request->OnProcessRequestComplete(), Priority });
+    Request->OnProcessRequestComplete().Unbind();
+
+    Queues[static_cast<int32>(Priority)].Add(Queued);
+    INC_DWORD_STAT(STAT_CardanoRequestsQueued);
+    Stats.RequestsQueued++;
+    Stats.PeakQueued = FMath::Max(Stats.PeakQueued, ++NumQueued);
+    PumpQueue();
+}
+
+TCardanoTask<FHttpResponsePtr> UCardanoKoiosClient::ProcessRequestTask(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, ECardanoRequestPriority Priority)
+{
+    TCardanoTask<FHttpResponsePtr> Task;
+    Request->OnProcessRequestComplete().BindLambda([Task](FHttpRequestPtr, FHttpResponsePtr Response, bool bSuccess)
+        {
+            if (!bSuccess || !Response.IsValid())
+            {
+                Task.Fail(TEXT("Network request failed"));
+                return;
+            }
+            Task.Succeed(Response);
+        });
+
+    ProcessRequest(Request, Priority);
+    return Task;
+}
+
+void UCardanoKoiosClient::CancelRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request)
+{
+    for (TArray<TSharedRef<FQueuedRequest>>& Queue : Queues)
+    {
+        const int32 Index = Queue.IndexOfByPredicate([&Request](const TSharedRef<FQueuedRequest>& Queued) { return Queued->Request == Request; });
+        if (Index != INDEX_NONE)
+        {
+            Queue.RemoveAt(Index);
+            DEC_DWORD_STAT(STAT_CardanoRequestsQueued);
+            --NumQueued;
+            Stats.Cancelled++;
+            return;
+        }
+    }
+
+    if (Request->GetStatus() == EHttpRequestStatus::Processing)
+    {
+        Stats.Cancelled++;
+        Request->CancelRequest();
+    }
+}
+
+void UCardanoKoiosClient::ResetStats()
+{
+    Stats = FCardanoKoiosClientStats();
+    Stats.PeakInFlight = NumInFlight;
+    Stats.PeakQueued = NumQueued;
+}
+
+void UCardanoKoiosClient::RefillTokens(double Now)
+{
+    const double Capacity = FMath::Max(BurstSize, 1);
+    const double MaxRate = FMath::Max(RequestsPerSecond, 0.1f);
+
+    if (LastRefillTime == 0.0)
+    {
+        Tokens = Capacity;
+        CurrentRate = MaxRate;
+    }
+    else
+    {
+        Tokens = FMath::Min(Tokens + (Now - LastRefillTime) * CurrentRate, Capacity);
+    }
+
+    LastRefillTime = Now;
+}
+
+void UCardanoKoiosClient::PumpQueue()
+{
+    const double Now = FPlatformTime::Seconds();
+    RefillTokens(Now);
+
+    if (Now < BlockedUntil)
+    {
+        SchedulePump(BlockedUntil - Now);
+        return;
+    }
+
+    for (TArray<TSharedRef<FQueuedRequest>>& Queue : Queues)
+    {
+        while (Queue.Num() > 0 && Tokens >= 1.0)
+        {
+            TSharedRef<FQueuedRequest> Queued = Queue[0];
+            Queue.RemoveAt(0, 1, false);
+            DEC_DWORD_STAT(STAT_CardanoRequestsQueued);
+            --NumQueued;
+            Tokens -= 1.0;
+            Send(Queued);
+        }
+    }
+
+    for (const TArray<TSharedRef<FQueuedRequest>>& Queue : Queues)
+    {
+        if (Queue.Num() > 0)
+        {
+            SchedulePump((1.0 - Tokens) / CurrentRate);
+            return;
+        }
+    }
+}
+
+void UCardanoKoiosClient::SchedulePump(double DelaySeconds)
+{
+    FTicker::GetCoreTicker().RemoveTicker(PumpHandle);
+    PumpHandle = FTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UCardanoKoiosClient::PumpTick), static_cast<float>(FMath::Max(DelaySeconds, 0.0)));
+}
+
+bool UCardanoKoiosClient::PumpTick(float DeltaTime)
+{
+    PumpHandle.Reset();
+    PumpQueue();
+
+    // PumpQueue registers a fresh ticker when requests are still waiting
+    return false;
+}
+
+void UCardanoKoiosClient::Send(const TSharedRef<FQueuedRequest>& Queued)
+{
+    TWeakObjectPtr<UCardanoKoiosClient> WeakThis(this);
+    Queued->Request->OnProcessRequestComplete().BindLambda([WeakThis, Queued](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            DEC_DWORD_STAT(STAT_CardanoRequestsInFlight);
+            INC_QWORD_STAT_BY(STAT_CardanoBytesReceived, Response.IsValid() ? Response->GetContent().Num() : 0);
+
+            if (WeakThis.IsValid())
+            {
+                WeakThis->NumInFlight--;
+                WeakThis->Stats.BytesReceived += Response.IsValid() ? Response->GetContent().Num() : 0;
+                WeakThis->OnCompressedResponse(Queued, Response, Success);
+            }
+            else
+            {
+                Queued->OnComplete.ExecuteIfBound(Request, Response, Success);
+            }
+        });
+
+    INC_DWORD_STAT(STAT_CardanoRequestsInFlight);
+    INC_DWORD_STAT(STAT_CardanoRequestsSent);
+    INC_QWORD_STAT_BY(STAT_CardanoBytesSent, Queued->Request->GetContent().Num());
+    Stats.RequestsSent++;
+    Stats.BytesSent += Queued->Request->GetContent().Num();
+    Stats.PeakInFlight = FMath::Max(Stats.PeakInFlight, ++NumInFlight);
+
+    Queued->SentAt = FPlatformTime::Seconds();
+    Queued->Request->ProcessRequest();
+}
+
+void UCardanoKoiosClient::OnCompressedResponse(const TSharedRef<FQueuedRequest>& Queued, FHttpResponsePtr Response, bool bSuccess)
+{
+    const int64 InflatedSize = bSuccess && Response.IsValid() ? get_gzip_inflated_size(Response) : -1;
+    if (InflatedSize < 0)
+    {
+        OnResponse(Queued, Response, bSuccess);
+        return;
+    }
+
+    // Bodies the game thread would decode inline are small enough to inflate inline too. Either way, a body that does not
+    // inflate to its trailer's size (cut short, over 4 GiB, or several gzip members) fails the request, as callers
+    // would otherwise parse the compressed bytes as JSON
+    if (InflatedSize < GetAsyncDecodeThreshold())
+    {
+        FHttpResponsePtr Inflated = inflate_response(Response, InflatedSize);
+        if (!Inflated.IsValid())
+        {
+            UE_LOG(LogCardano, Warning, TEXT("Failed to inflate the gzip response of %s"), *Queued->Request->GetURL());
+        }
+        Stats.BytesInflated += Inflated.IsValid() ? Inflated->GetContent().Num() : 0;
+        OnResponse(Queued, Inflated.IsValid() ? Inflated : Response, Inflated.IsValid());
+        return;
+    }
+
+    TWeakObjectPtr<UCardanoKoiosClient> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Queued, Response, InflatedSize]()
+        {
+            FHttpResponsePtr Inflated = inflate_response(Response, InflatedSize);
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Queued, Response, Inflated]()
+                {
+                    if (!Inflated.IsValid())
+                    {
+                        UE_LOG(LogCardano, Warning, TEXT("Failed to inflate the gzip response of %s"), *Queued->Request->GetURL());
+                    }
+
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->Stats.BytesInflated += Inflated.IsValid() ? Inflated->GetContent().Num() : 0;
+                        WeakThis->OnResponse(Queued, Inflated.IsValid() ? Inflated : Response, Inflated.IsValid());
+                    }
+                    else
+                    {
+                        Queued->OnComplete.ExecuteIfBound(Queued->Request, Inflated.IsValid() ? Inflated : Response, Inflated.IsValid());
+                    }
+                });
+        });
+}
+
+void UCardanoKoiosClient::OnResponse(const TSharedRef<FQueuedRequest>& Queued, FHttpResponsePtr Response, bool bSuccess)
+{
+    // Covers the caller's completion handler, which is where responses are parsed and turned into plugin types
+    CARDANO_SCOPE(CardanoHttpResponse);
+
+    const int32 ResponseCode = Response.IsValid() ? Response->GetResponseCode() : 0;
+    const bool bThrottled = ResponseCode == 429 || ResponseCode == 503;
+    const double MaxRate = FMath::Max(RequestsPerSecond, 0.1f);
+
+    FCardanoMetrics& Metrics = FCardanoMetrics::Get();
+    const FString Endpoint = get_endpoint_label(Queued->Request->GetURL());
+    const FString Status = bSuccess && Response.IsValid() ? FString::FromInt(ResponseCode) : FString(TEXT("failed"));
+    Metrics.Histogram(TEXT("cardano_http_request_duration_seconds"), TEXT("Duration of each Koios request attempt, from sending it to its response."),
+        FCardanoMetrics::MakeLabels(TEXT("endpoint"), Endpoint)).Observe(FPlatformTime::Seconds() - Queued->SentAt);
+    Metrics.Counter(TEXT("cardano_http_responses_total"), TEXT("Koios request attempts by response status, or failed without a response."),
+        FCardanoMetrics::MakeLabels(TEXT("endpoint"), Endpoint, TEXT("status"), Status)).Add();
+
+    if (bThrottled && Queued->Retries < MaxRetries)
+    {
+        Queued->Retries++;
+        INC_DWORD_STAT(STAT_CardanoRequestsThrottled);
+        Stats.Retries++;
+
+        static FCardanoCounter& RetriesCounter = Metrics.Counter(TEXT("cardano_http_retries_total"), TEXT("Koios requests retried after a 429 or 503 response."));
+        RetriesCounter.Add();
+
+        // Everything queued waits out the server's window, then resumes at half the rate
+        const double Now = FPlatformTime::Seconds();
+        RefillTokens(Now);
+        BlockedUntil = FMath::Max(BlockedUntil, Now + GetRetryDelay(Response, Queued->Retries));
+        CurrentRate = FMath::Max(CurrentRate * 0.5, MaxRate / 16.0);
+        Tokens = 0.0;
+
+        Queues[static_cast<int32>(Queued->Priority)].Insert(Queued, 0);
+        INC_DWORD_STAT(STAT_CardanoRequestsQueued);
+        Stats.PeakQueued = FMath::Max(Stats.PeakQueued, ++NumQueued);
+        PumpQueue();
+        return;
+    }
+
+    if (!bThrottled)
+    {
+        CurrentRate = FMath::Min(CurrentRate + MaxRate / 20.0, MaxRate);
+    }
+
+    if (!bSuccess || !Response.IsValid())
+    {
+        Stats.ConnectionFailures++;
+    }
+    else if (ResponseCode >= 400)
+    {
+        Stats.ErrorResponses++;
+    }
+
+    Queued->OnComplete.ExecuteIfBound(Queued->Request, Response, bSuccess);
+}
+
+void UCardanoKoiosClient::CollectMetrics()
+{
+    static FCardanoGauge& QueuedGauge = FCardanoMetrics::Get().Gauge(TEXT("cardano_http_requests_queued"), TEXT("Koios requests waiting for the rate limiter."));
+    static FCardanoGauge& InFlightGauge = FCardanoMetrics::Get().Gauge(TEXT("cardano_http_requests_in_flight"), TEXT("Koios requests awaiting their response."));
+    QueuedGauge.Set(NumQueued);
+    InFlightGauge.Set(NumInFlight);
+}
+
+double UCardanoKoiosClient::GetRetryDelay(const FHttpResponsePtr& Response, int32 Retries) const
+{
+    const double MaxDelay = FMath::Max(MaxBackoffSeconds, 0.0f);
+    const FString RetryAfter = Response.IsValid() ? Response->GetHeader(TEXT("Retry-After")) : FString();
+
+    // Retry-After is either a number of seconds or an HTTP date
+    if (RetryAfter.IsNumeric())
+    {
+        return FMath::Clamp(FCString::Atod(*RetryAfter), 0.0, MaxDelay);
+    }
+
+    FDateTime RetryTime;
+    if (!RetryAfter.IsEmpty() && FDateTime::ParseHttpDate(RetryAfter, RetryTime))
+    {
+        return FMath::Clamp((RetryTime - FDateTime::UtcNow()).GetTotalSeconds(), 0.0, MaxDelay);
+    }
+
+    // Jitter keeps clients that were throttled together from retrying in lockstep
+    const double Backoff = FMath::Min(0.5 * FMath::Pow(2.0, static_cast<double>(Retries - 1)), MaxDelay);
+    return Backoff * FMath::FRandRange(0.5f, 1.0f);
+}
@@ -0,0 +1,621 @@
+#include "CardanoKoiosParsing.h"
+#include "CardanoBalanceTotals.h"
+#include "CardanoFrameScheduler.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoLog.h"
+#include "CardanoStats.h"
+#include "Async/Async.h"
+#include "Hash/CityHash.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include <cardano/json/json_reader.h>
+
+bool ParseJsonArray(const FHttpResponsePtr& Response, TArray<TSharedPtr<FJsonValue>>& OutArray)
+{
+    CARDANO_SCOPE(CardanoParseJson);
+    return FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Response->GetContentAsString()), OutArray);
+}
+
+void ParseAssetList(const TArray<TSharedPtr<FJsonValue>>& AssetList, TArray<FTokenBalance>& OutTokens)
+{
+    OutTokens.Reserve(OutTokens.Num() + AssetList.Num());
+    for (const auto& AssetValue : AssetList)
+    {
+        auto AssetObject = AssetValue->AsObject();
+        if (!AssetObject.IsValid()) continue;
+
+        FTokenBalance TokenBalance;
+        AssetObject->TryGetStringField("policy_id", TokenBalance.PolicyId);
+        AssetObject->TryGetStringField("asset_name", TokenBalance.AssetName);
+        AssetObject->TryGetStringField("quantity", TokenBalance.Quantity);
+        OutTokens.Add(TokenBalance);
+    }
+}
+
+void ParseAddressInfo(const FJsonObject& AddressInfo, FAddressBalance& OutBalance)
+{
+    FString BalanceStr;
+    if (AddressInfo.TryGetStringField("balance", BalanceStr))
+    {
+        OutBalance.Lovelace = FCString::Atoi64(*BalanceStr);
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* UtxoSet = nullptr;
+    if (AddressInfo.TryGetArrayField("utxo_set", UtxoSet) && UtxoSet)
+    {
+        for (const auto& UtxoValue : *UtxoSet)
+        {
+            auto UtxoObject = UtxoValue->AsObject();
+            if (!UtxoObject.IsValid()) continue;
+
+            const TArray<TSharedPtr<FJsonValue>>* AssetList = nullptr;
+            if (UtxoObject->TryGetArrayField("asset_list", AssetList) && AssetList)
+            {
+                ParseAssetList(*AssetList, OutBalance.Tokens);
+            }
+        }
+    }
+
+    // The asset lists are per UTxO, so an asset held in several UTxOs is listed once for each
+    FCardanoBalanceTotals::MergeTokens(OutBalance.Tokens);
+}
+
+bool ParseUTxO(const FJsonObject& UtxoObject, FUTxO& OutUTxO)
+{
+    bool bValidUtxo = true;
+
+    // Get tx_hash
+    if (!UtxoObject.TryGetStringField("tx_hash", OutUTxO.TxHash))
+    {
+        bValidUtxo = false;
+        UE_LOG(LogCardano, Warning, TEXT("Missing tx_hash field"));
+    }
+
+    // Get tx_index
+    int64 TxIndex;
+    if (!UtxoObject.TryGetNumberField("tx_index", TxIndex))
+    {
+        bValidUtxo = false;
+        UE_LOG(LogCardano, Warning, TEXT("Missing tx_index field"));
+    }
+    else
+    {
+        OutUTxO.TxIndex = static_cast<int32>(TxIndex);
+    }
+
+    // Get value (as string)
+    FString ValueStr;
+    if (UtxoObject.TryGetStringField("value", ValueStr))
+    {
+        OutUTxO.Value = FCString::Atoi64(*ValueStr);
+    }
+    else
+    {
+        OutUTxO.Value = 0;
+        UE_LOG(LogCardano, Warning, TEXT("Missing or invalid value field"));
+    }
+
+    // Multi-asset content, present on extended queries
+    const TArray<TSharedPtr<FJsonValue>>* AssetList = nullptr;
+    if (UtxoObject.TryGetArrayField("asset_list", AssetList) && AssetList)
+    {
+        ParseAssetList(*AssetList, OutUTxO.Assets);
+    }
+
+    // Check if UTXO is spent
+    bool bIsSpent;
+    if (UtxoObject.TryGetBoolField("is_spent", bIsSpent) && bIsSpent)
+    {
+        UE_LOG(LogCardano, VeryVerbose, TEXT("Skipping spent UTXO"));
+        return false;
+    }
+
+    return bValidUtxo;
+}
+
+TArray<TArray<FString>> ChunkAddresses(const TArray<FString>& Addresses, int32 ChunkSize)
+{
+    TArray<FString> Unique;
+    Unique.Reserve(Addresses.Num());
+    for (const FString& Address : Addresses)
+    {
+        Unique.AddUnique(Address);
+    }
+
+    TArray<TArray<FString>> Chunks;
+    for (int32 First = 0; First < Unique.Num(); First += ChunkSize)
+    {
+        const int32 Num = FMath::Min(ChunkSize, Unique.Num() - First);
+        Chunks.Emplace(Unique.GetData() + First, Num);
+    }
+    return Chunks;
+}
+
+/** Compares the property name the reader is positioned at with a string literal. */
+template <size_t N>
+static bool IsField(const cardano_json_reader_t* Reader, const char (&Name)[N])
+{
+    return cardano_json_reader_property_equals(Reader, Name, N - 1);
+}
+
+/** Copies the UTF-8 view of the last string or number read into an FString. */
+static FString GetViewString(const cardano_json_reader_t* Reader)
+{
+    size_t Size = 0;
+    const char* Text = cardano_json_reader_get_string(Reader, &Size);
+    if (!Text || Size == 0)
+    {
+        return FString();
+    }
+
+    FUTF8ToTCHAR Converted(Text, static_cast<int32>(Size));
+    return FString(Converted.Length(), Converted.Get());
+}
+
+/**
+ * Reads the value of the property the reader is positioned at as text. Objects and arrays are skipped and leave
+ * OutValue untouched, as does null; returns false only on malformed JSON.
+ */
+static bool ReadStringValue(cardano_json_reader_t* Reader, FString& OutValue, bool* bOutFound = nullptr)
+{
+    cardano_json_token_type_t Token = CARDANO_JSON_TOKEN_TYPE_NONE;
+    if (cardano_json_reader_read(Reader, &Token) != CARDANO_SUCCESS)
+    {
+        return false;
+    }
+
+    if (Token == CARDANO_JSON_TOKEN_TYPE_STRING || Token == CARDANO_JSON_TOKEN_TYPE_NUMBER)
+    {
+        OutValue = GetViewString(Reader);
+        if (bOutFound)
+        {
+            *bOutFound = true;
+        }
+        return true;
+    }
+
+    return cardano_json_reader_skip(Reader) == CARDANO_SUCCESS;
+}
+
+/** Reads a property value holding an integer, as a number or a string; anything else leaves OutValue untouched. */
+static bool ReadInt64Value(cardano_json_reader_t* Reader, int64& OutValue, bool* bOutFound = nullptr)
+{
+    cardano_json_token_type_t Token = CARDANO_JSON_TOKEN_TYPE_NONE;
+    if (cardano_json_reader_read(Reader, &Token) != CARDANO_SUCCESS)
+    {
+        return false;
+    }
+
+    int64_t Value = 0;
+    if ((Token == CARDANO_JSON_TOKEN_TYPE_STRING || Token == CARDANO_JSON_TOKEN_TYPE_NUMBER)
+        && cardano_json_reader_get_signed_int(Reader, &Value) == CARDANO_SUCCESS)
+    {
+        OutValue = Value;
+        if (bOutFound)
+        {
+            *bOutFound = true;
+        }
+        return true;
+    }
+
+    return cardano_json_reader_skip(Reader) == CARDANO_SUCCESS;
+}
+
+/**
+ * Reads a property value holding an array of objects, calling ReadMember with the reader positioned at each property
+ * name of each object. ReadMember must consume the property value. Null and non-array values are skipped.
+ */
+static bool ReadObjectArray(cardano_json_reader_t* Reader, TFunctionRef<bool(cardano_json_reader_t*)> ReadMember,
+    TFunctionRef<void()> OnObjectEnd)
+{
+    cardano_json_token_type_t Token = CARDANO_JSON_TOKEN_TYPE_NONE;
+    if (cardano_json_reader_read(Reader, &Token) != CARDANO_SUCCESS)
+    {
+        return false;
+    }
+
+    if (Token != CARDANO_JSON_TOKEN_TYPE_START_ARRAY)
+    {
+        return cardano_json_reader_skip(Reader) == CARDANO_SUCCESS;
+    }
+
+    while (cardano_json_reader_read(Reader, &Token) == CARDANO_SUCCESS)
+    {
+        if (Token == CARDANO_JSON_TOKEN_TYPE_END_ARRAY)
+        {
+            return true;
+        }
+
+        if (Token != CARDANO_JSON_TOKEN_TYPE_START_OBJECT)
+        {
+            if (cardano_json_reader_skip(Reader) != CARDANO_SUCCESS)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        while (cardano_json_reader_read(Reader, &Token) == CARDANO_SUCCESS && Token == CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME)
+        {
+            if (!ReadMember(Reader))
+            {
+                return false;
+            }
+        }
+
+        if (Token != CARDANO_JSON_TOKEN_TYPE_END_OBJECT)
+        {
+            return false;
+        }
+
+        OnObjectEnd();
+    }
+
+    return false;
+}
+
+/** Reads an asset_list value, appending its entries to OutTokens like ParseAssetList. */
+static bool ReadAssetList(cardano_json_reader_t* Reader, TArray<FTokenBalance>& OutTokens)
+{
+    FTokenBalance TokenBalance;
+
+    return ReadObjectArray(Reader,
+        [&TokenBalance](cardano_json_reader_t* Member)
+        {
+            if (IsField(Member, "policy_id")) return ReadStringValue(Member, TokenBalance.PolicyId);
+            if (IsField(Member, "asset_name")) return ReadStringValue(Member, TokenBalance.AssetName);
+            if (IsField(Member, "quantity")) return ReadStringValue(Member, TokenBalance.Quantity);
+            return cardano_json_reader_skip(Member) == CARDANO_SUCCESS;
+        },
+        [&TokenBalance, &OutTokens]()
+        {
+            OutTokens.Add(MoveTemp(TokenBalance));
+            TokenBalance = FTokenBalance();
+        });
+}
+
+/** Creates a reader over a response body, or returns nullptr if it is empty. */
+static cardano_json_reader_t* CreateReader(const TArray<uint8>& Content)
+{
+    if (Content.Num() == 0)
+    {
+        return nullptr;
+    }
+    return cardano_json_reader_new(reinterpret_cast<const char*>(Content.GetData()), static_cast<size_t>(Content.Num()));
+}
+
+/** Reads the top-level array of a Koios response, then checks nothing but the end of the document follows it. */
+static bool ReadResponseRows(const TArray<uint8>& Content, TFunctionRef<bool(cardano_json_reader_t*)> ReadMember,
+    TFunctionRef<void()> OnRowEnd)
+{
+    cardano_json_reader_t* Reader = CreateReader(Content);
+    if (!Reader)
+    {
+        return false;
+    }
+
+    cardano_json_token_type_t Token = CARDANO_JSON_TOKEN_TYPE_NONE;
+    bool bValid = false;
+
+    if (cardano_json_reader_read(Reader, &Token) == CARDANO_SUCCESS && Token == CARDANO_JSON_TOKEN_TYPE_START_ARRAY)
+    {
+        bValid = true;
+
+        while (bValid && cardano_json_reader_read(Reader, &Token) == CARDANO_SUCCESS && Token != CARDANO_JSON_TOKEN_TYPE_END_ARRAY)
+        {
+            if (Token != CARDANO_JSON_TOKEN_TYPE_START_OBJECT)
+            {
+                bValid = false;
+                break;
+            }
+
+            while (bValid && cardano_json_reader_read(Reader, &Token) == CARDANO_SUCCESS && Token == CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME)
+            {
+                bValid = ReadMember(Reader);
+            }
+
+            if (bValid && Token != CARDANO_JSON_TOKEN_TYPE_END_OBJECT)
+            {
+                bValid = false;
+            }
+
+            if (bValid)
+            {
+                OnRowEnd();
+            }
+        }
+
+        bValid = bValid && Token == CARDANO_JSON_TOKEN_TYPE_END_ARRAY
+            && cardano_json_reader_read(Reader, &Token) == CARDANO_SUCCESS && Token == CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT;
+    }
+
+    cardano_json_reader_unref(&Reader);
+    return bValid;
+}
+
+bool DecodeAddressInfoRows(const TArray<uint8>& Content, TFunctionRef<void(FString&& Address, FAddressBalance&& Balance)> OnRow)
+{
+    CARDANO_SCOPE(CardanoParseJson);
+
+    FString Address;
+    FAddressBalance Balance;
+
+    return ReadResponseRows(Content,
+        [&Address, &Balance](cardano_json_reader_t* Reader)
+        {
+            if (IsField(Reader, "address")) return ReadStringValue(Reader, Address);
+            if (IsField(Reader, "balance")) return ReadInt64Value(Reader, Balance.Lovelace);
+            if (IsField(Reader, "utxo_set"))
+            {
+                return ReadObjectArray(Reader,
+                    [&Balance](cardano_json_reader_t* Member)
+                    {
+                        if (IsField(Member, "asset_list")) return ReadAssetList(Member, Balance.Tokens);
+                        return cardano_json_reader_skip(Member) == CARDANO_SUCCESS;
+                    },
+                    []() {});
+            }
+            return cardano_json_reader_skip(Reader) == CARDANO_SUCCESS;
+        },
+        [&Address, &Balance, &OnRow]()
+        {
+            FCardanoBalanceTotals::MergeTokens(Balance.Tokens);
+            OnRow(MoveTemp(Address), MoveTemp(Balance));
+            Address.Reset();
+            Balance = FAddressBalance();
+        });
+}
+
+bool DecodeUTxORows(const TArray<uint8>& Content, TFunctionRef<void(FString&& Address, FUTxO&& UTxO)> OnRow, int32& OutRowCount)
+{
+    CARDANO_SCOPE(CardanoParseJson);
+
+    OutRowCount = 0;
+
+    FString Address;
+    FUTxO UTxO;
+    int64 TxIndex = 0;
+    bool bHasHash = false;
+    bool bHasIndex = false;
+    bool bIsSpent = false;
+
+    auto ResetRow = [&]()
+    {
+        Address.Reset();
+        UTxO = FUTxO();
+        UTxO.Value = 0;
+        bHasHash = false;
+        bHasIndex = false;
+        bIsSpent = false;
+    };
+    ResetRow();
+
+    return ReadResponseRows(Content,
+        [&](cardano_json_reader_t* Reader)
+        {
+            if (IsField(Reader, "address")) return ReadStringValue(Reader, Address);
+            if (IsField(Reader, "tx_hash")) return ReadStringValue(Reader, UTxO.TxHash, &bHasHash);
+            if (IsField(Reader, "tx_index")) return ReadInt64Value(Reader, TxIndex, &bHasIndex);
+            if (IsField(Reader, "value")) return ReadInt64Value(Reader, UTxO.Value);
+            if (IsField(Reader, "asset_list")) return ReadAssetList(Reader, UTxO.Assets);
+            if (IsField(Reader, "is_spent"))
+            {
+                cardano_json_token_type_t Token = CARDANO_JSON_TOKEN_TYPE_NONE;
+                if (cardano_json_reader_read(Reader, &Token) != CARDANO_SUCCESS)
+                {
+                    return false;
+                }
+                if (Token == CARDANO_JSON_TOKEN_TYPE_BOOLEAN)
+                {
+                    return cardano_json_reader_get_boolean(Reader, &bIsSpent) == CARDANO_SUCCESS;
+                }
+                return cardano_json_reader_skip(Reader) == CARDANO_SUCCESS;
+            }
+            return cardano_json_reader_skip(Reader) == CARDANO_SUCCESS;
+        },
+        [&]()
+        {
+            OutRowCount++;
+
+            if (bHasHash && bHasIndex && !bIsSpent)
+            {
+                UTxO.TxIndex = static_cast<int32>(TxIndex);
+                OnRow(MoveTemp(Address), MoveTemp(UTxO));
+            }
+            ResetRow();
+        });
+}
+
+void DecodeKoiosResponse(FHttpResponsePtr Response, TUniqueFunction<bool(const TArray<uint8>&)> Decode, TUniqueFunction<void(bool)> OnDecoded)
+{
+    const UCardanoKoiosClient* Koios = IsInGameThread() ? UCardanoKoiosClient::Get() : nullptr;
+    const int32 Threshold = Koios ? Koios->GetAsyncDecodeThreshold() : KoiosAsyncDecodeThreshold;
+
+    if (Response->GetContent().Num() < Threshold)
+    {
+        OnDecoded(Decode(Response->GetContent()));
+        return;
+    }
+
+    // The response is immutable once complete, so the worker can read its body in place
+    FCardanoFrameScheduler::Get().RunInBackground(ECardanoWorkPriority::High, [Response, Decode = MoveTemp(Decode), OnDecoded = MoveTemp(OnDecoded)]() mutable
+        {
+            const bool bDecoded = Decode(Response->GetContent());
+
+            AsyncTask(ENamedThreads::GameThread, [OnDecoded = MoveTemp(OnDecoded), bDecoded]() mutable
+                {
+                    OnDecoded(bDecoded);
+                });
+        });
+}
+
+FKoiosResponseFingerprint FKoiosResponseFingerprint::Make(const FHttpResponsePtr& Response)
+{
+    FKoiosResponseFingerprint Fingerprint;
+    if (!Response.IsValid())
+    {
+        return Fingerprint;
+    }
+
+    Fingerprint.ETag = Response->GetHeader(TEXT("ETag"));
+    Fingerprint.LastModified = Response->GetHeader(TEXT("Last-Modified"));
+    Fingerprint.bNotModified = Response->GetResponseCode() == 304;
+
+    // Error bodies are never stored, and must not match what was
+    if (Response->GetResponseCode() != 200)
+    {
+        Fingerprint.BodySize = -1;
+        return Fingerprint;
+    }
+
+    const TArray<uint8>& Content = Response->GetContent();
+    Fingerprint.BodySize = Content.Num();
+    Fingerprint.BodyHash = CityHash64(reinterpret_cast<const char*>(Content.GetData()), static_cast<uint32>(Content.Num()));
+    return Fingerprint;
+}
+
+void AddKoiosValidators(IHttpRequest& Request, const FKoiosResponseFingerprint& Previous)
+{
+    if (!Previous.ETag.IsEmpty())
+    {
+        Request.SetHeader(TEXT("If-None-Match"), Previous.ETag);
+    }
+    if (!Previous.LastModified.IsEmpty())
+    {
+        Request.SetHeader(TEXT("If-Modified-Since"), Previous.LastModified);
+    }
+}
+
+bool IsSameKoiosResponse(const FKoiosResponseFingerprint& Previous, const FKoiosResponseFingerprint& Current)
+{
+    const bool bSame = Current.bNotModified || (Current.BodySize >= 0 && Current.BodySize == Previous.BodySize && Current.BodyHash == Previous.BodyHash);
+    if (bSame)
+    {
+        INC_DWORD_STAT(STAT_CardanoUnchangedResponses);
+    }
+    return bSame;
+}
+
+/** Koios returns lovelace amounts as strings and counts as numbers; accept either. */
+static bool GetInt64Field(const FJsonObject& Object, const TCHAR* FieldName, int64& OutValue)
+{
+    FString StringValue;
+    if (Object.TryGetStringField(FieldName, StringValue))
+    {
+        OutValue = FCString::Atoi64(*StringValue);
+        return true;
+    }
+    return Object.TryGetNumberField(FieldName, OutValue);
+}
+
+bool ParseProtocolParameters(const FJsonObject& ParamsObject, FCardanoProtocolParameters& OutParams)
+{
+    int64 Value = 0;
+    if (GetInt64Field(ParamsObject, TEXT("epoch_no"), Value)) OutParams.EpochNo = static_cast<int32>(Value);
+    if (GetInt64Field(ParamsObject, TEXT("collateral_percent"), Value)) OutParams.CollateralPercentage = static_cast<int32>(Value);
+    if (GetInt64Field(ParamsObject, TEXT("max_collateral_inputs"), Value)) OutParams.MaxCollateralInputs = static_cast<int32>(Value);
+    if (GetInt64Field(ParamsObject, TEXT("protocol_major"), Value)) OutParams.ProtocolMajor = static_cast<int32>(Value);
+    if (GetInt64Field(ParamsObject, TEXT("protocol_minor"), Value)) OutParams.ProtocolMinor = static_cast<int32>(Value);
+
+    GetInt64Field(ParamsObject, TEXT("max_val_size"), OutParams.MaxValueSize);
+    GetInt64Field(ParamsObject, TEXT("pool_deposit"), OutParams.PoolDeposit);
+    GetInt64Field(ParamsObject, TEXT("drep_deposit"), OutParams.DRepDeposit);
+    GetInt64Field(ParamsObject, TEXT("gov_action_deposit"), OutParams.GovActionDeposit);
+
+    ParamsObject.TryGetNumberField("price_mem", OutParams.PriceMemory);
+    ParamsObject.TryGetNumberField("price_step", OutParams.PriceSteps);
+    ParamsObject.TryGetNumberField("min_fee_ref_script_cost_per_byte", OutParams.RefScriptCostPerByte);
+
+    bool bValid = true;
+    bValid &= GetInt64Field(ParamsObject, TEXT("min_fee_a"), OutParams.MinFeeA);
+    bValid &= GetInt64Field(ParamsObject, TEXT("min_fee_b"), OutParams.MinFeeB);
+    bValid &= GetInt64Field(ParamsObject, TEXT("max_tx_size"), OutParams.MaxTxSize);
+    bValid &= GetInt64Field(ParamsObject, TEXT("coins_per_utxo_size"), OutParams.CoinsPerUTxOByte);
+    bValid &= GetInt64Field(ParamsObject, TEXT("key_deposit"), OutParams.KeyDeposit);
+
+    if (!bValid)
+    {
+        UE_LOG(LogCardano, Warning, TEXT("epoch_params row is missing fee or deposit fields"));
+    }
+
+    return bValid;
+}
+
+ECardanoSubmitError ParseSubmitError(const FHttpResponsePtr& Response, bool bSuccess)
+{
+    if (!bSuccess || !Response.IsValid())
+    {
+        return ECardanoSubmitError::NetworkError;
+    }
+
+    const int32 ResponseCode = Response->GetResponseCode();
+    if (ResponseCode == 200 || ResponseCode == 202)
+    {
+        return ECardanoSubmitError::None;
+    }
+
+    // The client already retried throttled and unavailable responses
+    if (ResponseCode == 429 || ResponseCode >= 500)
+    {
+        return ECardanoSubmitError::ProviderError;
+    }
+
+    // Constructor names of the ledger failures, which every era's errors and every submit API render the same way
+    struct FRule
+    {
+        const TCHAR* Name;
+        ECardanoSubmitError Error;
+    };
+
+    static const FRule Rules[] = {
+        { TEXT("BadInputsUTxO"), ECardanoSubmitError::InputsSpent },
+        { TEXT("OutsideValidityIntervalUTxO"), ECardanoSubmitError::Expired },
+        { TEXT("FeeTooSmallUTxO"), ECardanoSubmitError::FeeTooSmall },
+        { TEXT("MissingVKeyWitnessesUTXOW"), ECardanoSubmitError::MissingWitnesses },
+        { TEXT("InvalidWitnessesUTXOW"), ECardanoSubmitError::MissingWitnesses },
+        { TEXT("InsufficientCollateral"), ECardanoSubmitError::ScriptFailure },
+        { TEXT("NoCollateralInputs"), ECardanoSubmitError::ScriptFailure },
+        { TEXT("CollateralContainsNonADA"), ECardanoSubmitError::ScriptFailure },
+        { TEXT("ScriptsNotPaidUTxO"), ECardanoSubmitError::ScriptFailure },
+        { TEXT("ExUnitsTooBigUTxO"), ECardanoSubmitError::ScriptFailure },
+        { TEXT("ValidationTagMismatch"), ECardanoSubmitError::ScriptFailure },
+        { TEXT("MissingRedeemers"), ECardanoSubmitError::ScriptFailure },
+        { TEXT("ExtraRedeemers"), ECardanoSubmitError::ScriptFailure },
+        { TEXT("MissingScriptWitnessesUTXOW"), ECardanoSubmitError::ScriptFailure },
+        { TEXT("PPViewHashesDontMatch"), ECardanoSubmitError::ScriptFailure },
+        { TEXT("OutputTooSmallUTxO"), ECardanoSubmitError::OutputTooSmall },
+        { TEXT("MaxTxSizeUTxO"), ECardanoSubmitError::TooLarge },
+        { TEXT("OutputTooBigUTxO"), ECardanoSubmitError::TooLarge },
+        { TEXT("ValueNotConservedUTxO"), ECardanoSubmitError::ValueNotConserved },
+    };
+
+    const FString Body = Response->GetContentAsString();
+    for (const FRule& Rule : Rules)
+    {
+        if (Body.Contains(Rule.Name, ESearchCase::CaseSensitive))
+        {
+            return Rule.Error;
+        }
+    }
+
+    return ECardanoSubmitError::Other;
+}
+
+FString GetSubmitErrorName(ECardanoSubmitError Error)
+{
+    switch (Error)
+    {
+    case ECardanoSubmitError::None: return TEXT("none");
+    case ECardanoSubmitError::NetworkError: return TEXT("network_error");
+    case ECardanoSubmitError::ProviderError: return TEXT("provider_error");
+    case ECardanoSubmitError::InputsSpent: return TEXT("inputs_spent");
+    case ECardanoSubmitError::FeeTooSmall: return TEXT("fee_too_small");
+    case ECardanoSubmitError::Expired: return TEXT("expired");
+    case ECardanoSubmitError::ValueNotConserved: return TEXT("value_not_conserved");
+    case ECardanoSubmitError::OutputTooSmall: return TEXT("output_too_small");
+    case ECardanoSubmitError::TooLarge: return TEXT("too_large");
+    case ECardanoSubmitError::MissingWitnesses: return TEXT("missing_witnesses");
+    case ECardanoSubmitError::ScriptFailure: return TEXT("script_failure");
+    default: return TEXT("other");
+    }
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "CardanoSubmissionQueue.h"
+#include "CardanoTypes.h"
+
+/**
+ * Helpers turning Koios JSON responses into plugin types, shared by every Koios consumer in the plugin.
+ */
+
+/** Parses a response body that is a JSON array (every Koios endpoint returns one) into a DOM. */
+bool ParseJsonArray(const FHttpResponsePtr& Response, TArray<TSharedPtr<FJsonValue>>& OutArray);
+
+/** Appends the entries of a Koios asset_list array to OutTokens. */
+void ParseAssetList(const TArray<TSharedPtr<FJsonValue>>& AssetList, TArray<FTokenBalance>& OutTokens);
+
+/** Reads an address_info row: lovelace balance plus the assets of its utxo_set, one token per asset. */
+void ParseAddressInfo(const FJsonObject& AddressInfo, FAddressBalance& OutBalance);
+
+/** Reads a UTxO row; returns false if it is incomplete or already spent. */
+bool ParseUTxO(const FJsonObject& UtxoObject, FUTxO& OutUTxO);
+
+/** De-duplicates Addresses and splits them into chunks of at most ChunkSize entries. */
+TArray<TArray<FString>> ChunkAddresses(const TArray<FString>& Addresses, int32 ChunkSize);
+
+/**
+ * Decodes an address_info response straight from its UTF-8 body with a pull reader, without building a JSON DOM or
+ * converting the body to an FString. OnRow receives the address and balance of every row, in response order, with
+ * the assets of its UTxOs merged into one token each.
+ */
+bool DecodeAddressInfoRows(const TArray<uint8>& Content, TFunctionRef<void(FString&& Address, FAddressBalance&& Balance)> OnRow);
+
+/**
+ * Decodes an address_utxos response the same way, calling OnRow with the address and UTxO of every complete, unspent
+ * row. OutRowCount receives the number of rows, spent ones included, so paged callers can detect the last page.
+ */
+bool DecodeUTxORows(const TArray<uint8>& Content, TFunctionRef<void(FString&& Address, FUTxO&& UTxO)> OnRow, int32& OutRowCount);
+
+/** Threshold of DecodeKoiosResponse when the Koios client is not available. */
+constexpr int32 KoiosAsyncDecodeThreshold = 64 * 1024;
+
+/**
+ * Runs Decode over the body of Response, then calls OnDecoded with its result. Bodies smaller than the Koios
+ * client's AsyncDecodeThresholdBytes are decoded inline; larger ones on the thread pool, with OnDecoded then called
+ * on the game thread. Decode must not touch state owned by the game thread, and should fill a private result that
+ * OnDecoded hands over, so only the decoded structs cross back to the game thread.
+ */
+void DecodeKoiosResponse(FHttpResponsePtr Response, TUniqueFunction<bool(const TArray<uint8>&)> Decode, TUniqueFunction<void(bool)> OnDecoded);
+
+/** What tells a response to a repeated query apart from the previous one: the server's validators and a body hash. */
+struct FKoiosResponseFingerprint
+{
+    FString ETag;
+    FString LastModified;
+    uint64 BodyHash = 0;
+
+    /** -1 for any status but 200. */
+    int32 BodySize = -1;
+
+    /** The server answered a conditional request with 304 Not Modified, and sent no body. */
+    bool bNotModified = false;
+
+    /** Reads the validators of a completed response and hashes its body, which costs far less than parsing it. */
+    static FKoiosResponseFingerprint Make(const FHttpResponsePtr& Response);
+};
+
+/** Sets If-None-Match and If-Modified-Since on Request from the validators Previous carries, if any. */
+void AddKoiosValidators(IHttpRequest& Request, const FKoiosResponseFingerprint& Previous);
+
+/** True if Current is a 304 or has the body of Previous. */
+bool IsSameKoiosResponse(const FKoiosResponseFingerprint& Previous, const FKoiosResponseFingerprint& Current);
+
+/**
+ * The decoded result of the last response to each repeated query, keyed by endpoint and body, so a poll answered
+ * with what it got last time skips decoding and rebuilding its structs and is handed a copy of the stored result.
+ * Requests carry the validators of the previous response, for Koios instances that answer them with a 304; for the
+ * others, which send the full body again, the body hash tells. Holds the results of the last MaxEntries queries.
+ * Game thread only.
+ */
+template <typename ResultType>
+class TKoiosResponseMemo
+{
+public:
+    /** Adds the validators of the last response to Key to Request, before it is sent. */
+    void Prepare(const FString& Key, IHttpRequest& Request) const
+    {
+        if (const FEntry* Entry = Entries.Find(Key))
+        {
+            AddKoiosValidators(Request, Entry->Fingerprint);
+        }
+    }
+
+    /** The result of the last response to Key if the one Fingerprint describes is the same; nullptr otherwise. */
+    const ResultType* FindUnchanged(const FString& Key, const FKoiosResponseFingerprint& Fingerprint) const
+    {
+        const FEntry* Entry = Entries.Find(Key);
+        return Entry && IsSameKoiosResponse(Entry->Fingerprint, Fingerprint) ? &Entry->Result : nullptr;
+    }
+
+    /** Records Result as decoded from the response Fingerprint describes. */
+    void Store(const FString& Key, const FKoiosResponseFingerprint& Fingerprint, const ResultType& Result)
+    {
+        if (Fingerprint.bNotModified)
+        {
+            return;
+        }
+
+        if (Entries.Num() >= MaxEntries && !Entries.Contains(Key))
+        {
+            Entries.Remove(Entries.CreateConstIterator().Key());
+        }
+        Entries.Add(Key, FEntry{ Fingerprint, Result });
+    }
+
+private:
+    struct FEntry
+    {
+        FKoiosResponseFingerprint Fingerprint;
+        ResultType Result;
+    };
+
+    static constexpr int32 MaxEntries = 256;
+
+    TMap<FString, FEntry> Entries;
+};
+
+/**
+ * Reads the outcome of a submittx request: None if the transaction was accepted, otherwise the first failed ledger
+ * rule found in the body. Nodes report every rule a transaction breaks, and some follow from others, such as an
+ * unbalanced value from a missing input, so the ones naming the cause are looked for first.
+ */
+ECardanoSubmitError ParseSubmitError(const FHttpResponsePtr& Response, bool bSuccess);
+
+/** Lower-case name of Error, as used in metric labels and logs. */
+FString GetSubmitErrorName(ECardanoSubmitError Error);
+
+/** Reads an epoch_params row; returns false if a field required for fee computation is missing. */
+bool ParseProtocolParameters(const FJsonObject& ParamsObject, FCardanoProtocolParameters& OutParams);
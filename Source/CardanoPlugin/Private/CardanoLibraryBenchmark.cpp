@@ -0,0 +1,729 @@
+#include "CardanoLibraryBenchmark.h"
+#include "CardanoLog.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include <cardano/cardano.h>
+#include <cardano/common/utxo_list.h>
+#include <cardano/memory_footprint.h>
+#include <sodium.h>
+
+static const char* BENCHMARK_ADDRESS = "addr1qx2fxv2umyhttkxyxp8x0dlpdt3k6cwng5pxj3jhsydzer3n0d3vllmyqwsx5wktcd8cc3sq835lu7drv2xwl2wywfgse35a3x";
+static const int32 BENCHMARK_UTXO_SET_SIZES[] = { 10, 1000, 100000 };
+
+namespace
+{
+    /** Objects shared by the cases; created once so only the operation under test is timed. */
+    struct FBenchmarkFixture
+    {
+        cardano_protocol_parameters_t* Params = nullptr;
+        cardano_address_t* Address = nullptr;
+        TArray<cardano_utxo_list_t*> UTxOSets;
+        TArray<TArray<uint8>> Transactions;
+        cardano_ed25519_private_key_t* SigningKey = nullptr;
+        cardano_ed25519_public_key_t* VerificationKey = nullptr;
+        cardano_ed25519_signature_t* Signature = nullptr;
+        cardano_bip32_private_key_t* RootKey = nullptr;
+        TArray<uint8> Payload;
+
+        ~FBenchmarkFixture()
+        {
+            for (cardano_utxo_list_t*& UTxOs : UTxOSets)
+            {
+                cardano_utxo_list_unref(&UTxOs);
+            }
+
+            cardano_bip32_private_key_unref(&RootKey);
+            cardano_ed25519_signature_unref(&Signature);
+            cardano_ed25519_public_key_unref(&VerificationKey);
+            cardano_ed25519_private_key_unref(&SigningKey);
+            cardano_address_unref(&Address);
+            cardano_protocol_parameters_unref(&Params);
+        }
+    };
+
+    /** Mainnet values as of the Conway era; only the fee and deposit related ones matter here. */
+    FCardanoProtocolParameters mainnet_parameters()
+    {
+        FCardanoProtocolParameters Parameters;
+        Parameters.MinFeeA = 44;
+        Parameters.MinFeeB = 155381;
+        Parameters.MaxTxSize = 16384;
+        Parameters.MaxValueSize = 5000;
+        Parameters.CoinsPerUTxOByte = 4310;
+        Parameters.KeyDeposit = 2000000;
+        Parameters.PoolDeposit = 500000000;
+        Parameters.DRepDeposit = 500000000;
+        Parameters.GovActionDeposit = 100000000000;
+        Parameters.CollateralPercentage = 150;
+        Parameters.MaxCollateralInputs = 3;
+        Parameters.ProtocolMajor = 10;
+        Parameters.PriceMemory = 0.0577;
+        Parameters.PriceSteps = 0.0000721;
+        Parameters.RefScriptCostPerByte = 15.0;
+        return Parameters;
+    }
+
+    /** Count pure-ADA UTxOs between 1 and 100 ADA, the same for every run. */
+    cardano_error_t create_utxo_set(cardano_address_t* owner, int32 Count, cardano_utxo_list_t** out_utxos)
+    {
+        FRandomStream Random(Count);
+        cardano_utxo_list_t* utxos = nullptr;
+        cardano_error_t result = cardano_utxo_list_new(&utxos);
+
+        for (int32 Index = 0; Index < Count && result == CARDANO_SUCCESS; ++Index)
+        {
+            FUTxO UTxO;
+            UTxO.TxHash = FString::Printf(TEXT("%064llx"), static_cast<uint64>(Index) + 1);
+            UTxO.TxIndex = Index % 4;
+            UTxO.Value = static_cast<int64>(Random.RandRange(1, 100)) * 1000000;
+
+            cardano_utxo_t* utxo = nullptr;
+            result = create_utxo(owner, UTxO, &utxo);
+            if (result == CARDANO_SUCCESS)
+            {
+                result = cardano_utxo_list_add(utxos, utxo);
+            }
+            cardano_utxo_unref(&utxo);
+        }
+
+        if (result != CARDANO_SUCCESS)
+        {
+            cardano_utxo_list_unref(&utxos);
+            return result;
+        }
+
+        *out_utxos = utxos;
+        return CARDANO_SUCCESS;
+    }
+
+    /** Builds, and so balances, a payment spending from utxos. This is what UCardanoTxBuilder does per transaction. */
+    cardano_error_t build_payment(const FBenchmarkFixture& Fixture, cardano_utxo_list_t* utxos, cardano_transaction_t** out_transaction)
+    {
+        cardano_provider_t* provider = nullptr;
+        cardano_coin_selector_t* selector = nullptr;
+        cardano_error_t result = create_offline_provider(CARDANO_NETWORK_MAGIC_MAINNET, &provider);
+        if (result == CARDANO_SUCCESS)
+        {
+            result = cardano_large_first_coin_selector_new(&selector);
+        }
+
+        cardano_tx_builder_t* builder = result == CARDANO_SUCCESS ? cardano_tx_builder_new(Fixture.Params, provider) : nullptr;
+        cardano_provider_unref(&provider);
+
+        if (!builder)
+        {
+            cardano_coin_selector_unref(&selector);
+            return result == CARDANO_SUCCESS ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : result;
+        }
+
+        cardano_tx_builder_set_network_id(builder, CARDANO_NETWORK_ID_MAIN_NET);
+        cardano_tx_builder_set_coin_selector(builder, selector);
+        cardano_tx_builder_set_utxos(builder, utxos);
+        cardano_tx_builder_set_change_address(builder, Fixture.Address);
+        cardano_tx_builder_set_invalid_after(builder, 200000000);
+        cardano_tx_builder_send_lovelace(builder, Fixture.Address, 150000000);
+        cardano_coin_selector_unref(&selector);
+
+        result = cardano_tx_builder_build(builder, out_transaction);
+        cardano_tx_builder_unref(&builder);
+        return result;
+    }
+
+    bool encode_transaction(cardano_transaction_t* transaction, TArray<uint8>& OutCbor)
+    {
+        cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+        cardano_buffer_t* buffer = nullptr;
+        const bool bEncoded = writer &&
+            cardano_transaction_to_cbor(transaction, writer) == CARDANO_SUCCESS &&
+            cardano_cbor_writer_encode_in_buffer(writer, &buffer) == CARDANO_SUCCESS;
+
+        if (bEncoded)
+        {
+            OutCbor = TArray<uint8>(cardano_buffer_get_data(buffer), static_cast<int32>(cardano_buffer_get_size(buffer)));
+        }
+
+        cardano_buffer_unref(&buffer);
+        cardano_cbor_writer_unref(&writer);
+        return bEncoded;
+    }
+
+    bool create_fixture(const TArray<TArray<uint8>>& Transactions, FBenchmarkFixture& Fixture)
+    {
+        if (sodium_init() < 0 ||
+            create_protocol_parameters(mainnet_parameters(), &Fixture.Params) != CARDANO_SUCCESS ||
+            cardano_address_from_string(BENCHMARK_ADDRESS, strlen(BENCHMARK_ADDRESS), &Fixture.Address) != CARDANO_SUCCESS)
+        {
+            return false;
+        }
+
+        for (const int32 Size : BENCHMARK_UTXO_SET_SIZES)
+        {
+            cardano_utxo_list_t* utxos = nullptr;
+            if (create_utxo_set(Fixture.Address, Size, &utxos) != CARDANO_SUCCESS)
+            {
+                return false;
+            }
+            Fixture.UTxOSets.Add(utxos);
+        }
+
+        cardano_transaction_t* transaction = nullptr;
+        TArray<uint8> Built;
+        const bool bBuilt = build_payment(Fixture, Fixture.UTxOSets[1], &transaction) == CARDANO_SUCCESS && encode_transaction(transaction, Built);
+        cardano_transaction_unref(&transaction);
+
+        if (!bBuilt)
+        {
+            return false;
+        }
+
+        Fixture.Transactions.Add(MoveTemp(Built));
+        Fixture.Transactions.Append(Transactions);
+
+        byte_t seed[32];
+        byte_t entropy[32];
+        for (int32 i = 0; i < 32; i++)
+        {
+            seed[i] = static_cast<byte_t>(i);
+            entropy[i] = static_cast<byte_t>(0xff - i);
+        }
+
+        // A typical transaction body hash sized message
+        Fixture.Payload.SetNumUninitialized(32);
+        FMemory::Memset(Fixture.Payload.GetData(), 0xab, Fixture.Payload.Num());
+
+        return cardano_ed25519_private_key_from_normal_bytes(seed, sizeof(seed), &Fixture.SigningKey) == CARDANO_SUCCESS &&
+            cardano_ed25519_private_key_get_public_key(Fixture.SigningKey, &Fixture.VerificationKey) == CARDANO_SUCCESS &&
+            cardano_ed25519_private_key_sign(Fixture.SigningKey, Fixture.Payload.GetData(), Fixture.Payload.Num(), &Fixture.Signature) == CARDANO_SUCCESS &&
+            cardano_bip32_private_key_from_bip39_entropy(nullptr, 0, entropy, sizeof(entropy), &Fixture.RootKey) == CARDANO_SUCCESS;
+    }
+
+    /**
+     * Runs Op in batches of growing size, Google Benchmark style, until a batch takes at least MinSeconds, and reports
+     * the time per call of that last batch. Op returns false when the operation failed.
+     */
+    FCardanoLibraryBenchmarkResult measure(const FString& Name, double MinSeconds, TFunctionRef<bool()> Op)
+    {
+        FCardanoLibraryBenchmarkResult Result;
+        Result.Name = Name;
+
+        // Warm-up: first-touch allocations and lazily computed caches are not what is being measured
+        if (!Op())
+        {
+            Result.Failures++;
+        }
+
+        int64 Batch = 1;
+        for (;;)
+        {
+            int64 Failures = 0;
+            const double Start = FPlatformTime::Seconds();
+            for (int64 i = 0; i < Batch; i++)
+            {
+                if (!Op())
+                {
+                    Failures++;
+                }
+            }
+            const double Elapsed = FPlatformTime::Seconds() - Start;
+
+            if (Elapsed >= MinSeconds || Batch >= (int64(1) << 40))
+            {
+                Result.Iterations = Batch;
+                Result.Failures += Failures;
+                Result.NanosPerOp = Elapsed * 1.0e9 / Batch;
+                return Result;
+            }
+
+            // Aim straight for MinSeconds, but never grow by more than 10x on a noisy short batch
+            const double Scale = Elapsed > 0.0 ? FMath::Min(MinSeconds * 1.4 / Elapsed, 10.0) : 10.0;
+            Batch = FMath::Max(Batch + 1, static_cast<int64>(Batch * Scale));
+        }
+    }
+
+    bool cbor_round_trip()
+    {
+        cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+        if (!writer)
+        {
+            return false;
+        }
+
+        static const byte_t Bytes[28] = { 0 };
+        bool bSuccess = cardano_cbor_writer_write_start_array(writer, 64) == CARDANO_SUCCESS;
+        for (int64 i = 0; i < 32 && bSuccess; i++)
+        {
+            bSuccess = cardano_cbor_writer_write_uint(writer, static_cast<uint64_t>(i) * 1000003) == CARDANO_SUCCESS &&
+                cardano_cbor_writer_write_bytestring(writer, Bytes, sizeof(Bytes)) == CARDANO_SUCCESS;
+        }
+
+        cardano_buffer_t* buffer = nullptr;
+        bSuccess = bSuccess && cardano_cbor_writer_encode_in_buffer(writer, &buffer) == CARDANO_SUCCESS;
+        cardano_cbor_writer_unref(&writer);
+
+        cardano_cbor_reader_t* reader = bSuccess ? cardano_cbor_reader_new(cardano_buffer_get_data(buffer), cardano_buffer_get_size(buffer)) : nullptr;
+        int64_t length = 0;
+        bSuccess = reader && cardano_cbor_reader_read_start_array(reader, &length) == CARDANO_SUCCESS;
+        for (int64_t i = 0; i < length / 2 && bSuccess; i++)
+        {
+            uint64_t value = 0;
+            const byte_t* data = nullptr;
+            size_t size = 0;
+            bSuccess = cardano_cbor_reader_read_uint(reader, &value) == CARDANO_SUCCESS &&
+                cardano_cbor_reader_read_bytestring_view(reader, &data, &size) == CARDANO_SUCCESS;
+        }
+        bSuccess = bSuccess && cardano_cbor_reader_read_end_array(reader) == CARDANO_SUCCESS;
+
+        cardano_cbor_reader_unref(&reader);
+        cardano_buffer_unref(&buffer);
+        return bSuccess;
+    }
+
+    bool decode_transaction(const TArray<uint8>& Cbor)
+    {
+        cardano_cbor_reader_t* reader = cardano_cbor_reader_new(Cbor.GetData(), Cbor.Num());
+        cardano_transaction_t* transaction = nullptr;
+        const bool bSuccess = reader && cardano_transaction_from_cbor(reader, &transaction) == CARDANO_SUCCESS;
+        cardano_transaction_unref(&transaction);
+        cardano_cbor_reader_unref(&reader);
+        return bSuccess;
+    }
+
+    /** Clears the cached encoding so to_cbor really re-serializes the body instead of copying the original bytes. */
+    bool reencode_transaction(cardano_transaction_t* transaction)
+    {
+        cardano_transaction_clear_cbor_cache(transaction);
+
+        TArray<uint8> Cbor;
+        return encode_transaction(transaction, Cbor);
+    }
+
+    bool select_coins(cardano_coin_selector_t* selector, cardano_utxo_list_t* utxos, cardano_value_t* target)
+    {
+        cardano_utxo_list_t* selection = nullptr;
+        cardano_utxo_list_t* remaining = nullptr;
+        const bool bSuccess = cardano_coin_selector_select(selector, nullptr, utxos, target, &selection, &remaining) == CARDANO_SUCCESS;
+        cardano_utxo_list_unref(&remaining);
+        cardano_utxo_list_unref(&selection);
+        return bSuccess;
+    }
+
+    /** A value holding Policies policies of Assets tokens each, like the outputs of an NFT heavy wallet. */
+    cardano_value_t* create_multi_asset_value(int32 Policies, int32 Assets)
+    {
+        cardano_value_t* value = cardano_value_new_from_coin(2000000);
+        cardano_error_t result = value ? CARDANO_SUCCESS : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+
+        for (int32 Policy = 0; Policy < Policies && result == CARDANO_SUCCESS; ++Policy)
+        {
+            byte_t policy_bytes[28] = { 0 };
+            policy_bytes[0] = static_cast<byte_t>(Policy);
+
+            cardano_blake2b_hash_t* policy_id = nullptr;
+            result = cardano_blake2b_hash_from_bytes(policy_bytes, sizeof(policy_bytes), &policy_id);
+
+            for (int32 Asset = 0; Asset < Assets && result == CARDANO_SUCCESS; ++Asset)
+            {
+                const FTCHARToUTF8 Name(*FString::Printf(TEXT("Token%04d"), Asset));
+                cardano_asset_name_t* asset_name = nullptr;
+                result = cardano_asset_name_from_string(Name.Get(), Name.Length(), &asset_name);
+                if (result == CARDANO_SUCCESS)
+                {
+                    result = cardano_value_add_asset(value, policy_id, asset_name, 1);
+                }
+                cardano_asset_name_unref(&asset_name);
+            }
+
+            cardano_blake2b_hash_unref(&policy_id);
+        }
+
+        if (result != CARDANO_SUCCESS)
+        {
+            cardano_value_unref(&value);
+        }
+
+        return value;
+    }
+
+    FCardanoMemoryFootprintResult to_footprint_result(const FString& Name, const cardano_memory_footprint_t& Footprint, int64 EncodedBytes)
+    {
+        FCardanoMemoryFootprintResult Result;
+        Result.Name = Name;
+        Result.EncodedBytes = EncodedBytes;
+        Result.HeapBytes = static_cast<int64>(Footprint.heap_bytes);
+        Result.Allocations = static_cast<int64>(Footprint.allocation_count);
+        Result.Objects = static_cast<int64>(Footprint.object_count);
+        Result.RefcountOverheadBytes = static_cast<int64>(Footprint.refcount_overhead_bytes);
+        Result.LastErrorBytes = static_cast<int64>(Footprint.last_error_bytes);
+        Result.SharedObjects = static_cast<int64>(Footprint.shared_object_count);
+        Result.UnmeasuredObjects = static_cast<int64>(Footprint.unmeasured_object_count);
+
+        for (int32 Type = 0; Type < CARDANO_MEMORY_FOOTPRINT_TYPE_COUNT; ++Type)
+        {
+            const cardano_memory_footprint_entry_t& Entry = Footprint.by_type[Type];
+            if (Entry.object_count == 0 && Entry.heap_bytes == 0)
+            {
+                continue;
+            }
+
+            FCardanoMemoryFootprintTypeEntry& TypeEntry = Result.ByType.AddDefaulted_GetRef();
+            TypeEntry.Type = UTF8_TO_TCHAR(cardano_memory_footprint_type_to_string(static_cast<cardano_memory_footprint_type_t>(Type)));
+            TypeEntry.Objects = static_cast<int64>(Entry.object_count);
+            TypeEntry.HeapBytes = static_cast<int64>(Entry.heap_bytes);
+        }
+
+        Result.ByType.Sort([](const FCardanoMemoryFootprintTypeEntry& A, const FCardanoMemoryFootprintTypeEntry& B) { return A.HeapBytes > B.HeapBytes; });
+        return Result;
+    }
+}
+
+TArray<FCardanoLibraryBenchmarkResult> FCardanoLibraryBenchmark::Run(double MinSecondsPerCase, const TArray<TArray<uint8>>& Transactions)
+{
+    TArray<FCardanoLibraryBenchmarkResult> Results;
+    const double MinSeconds = FMath::Max(MinSecondsPerCase, 0.01);
+
+    FBenchmarkFixture Fixture;
+    if (!create_fixture(Transactions, Fixture))
+    {
+        UE_LOG(LogCardano, Error, TEXT("Cardano library benchmark: failed to prepare the fixture"));
+        return Results;
+    }
+
+    Results.Add(measure(TEXT("cbor/round_trip/32_entries"), MinSeconds, []() { return cbor_round_trip(); }));
+
+    for (int32 Index = 0; Index < Fixture.Transactions.Num(); ++Index)
+    {
+        const TArray<uint8>& Cbor = Fixture.Transactions[Index];
+        const FString Label = Index == 0 ? FString::Printf(TEXT("built_%d_bytes"), Cbor.Num()) : FString::Printf(TEXT("input%d_%d_bytes"), Index, Cbor.Num());
+
+        Results.Add(measure(TEXT("transaction/from_cbor/") + Label, MinSeconds, [&Cbor]() { return decode_transaction(Cbor); }));
+
+        cardano_cbor_reader_t* reader = cardano_cbor_reader_new(Cbor.GetData(), Cbor.Num());
+        cardano_transaction_t* transaction = nullptr;
+        if (reader && cardano_transaction_from_cbor(reader, &transaction) == CARDANO_SUCCESS)
+        {
+            Results.Add(measure(TEXT("transaction/to_cbor/") + Label, MinSeconds, [transaction]() { return reencode_transaction(transaction); }));
+        }
+        cardano_transaction_unref(&transaction);
+        cardano_cbor_reader_unref(&reader);
+    }
+
+    const TArray<uint8>& BuiltTransaction = Fixture.Transactions[0];
+    Results.Add(measure(FString::Printf(TEXT("blake2b/256/%d_bytes"), BuiltTransaction.Num()), MinSeconds, [&BuiltTransaction]()
+        {
+            cardano_blake2b_hash_t* hash = nullptr;
+            const bool bSuccess = cardano_blake2b_compute_hash(BuiltTransaction.GetData(), BuiltTransaction.Num(), 32, &hash) == CARDANO_SUCCESS;
+            cardano_blake2b_hash_unref(&hash);
+            return bSuccess;
+        }));
+
+    Results.Add(measure(TEXT("ed25519/sign"), MinSeconds, [&Fixture]()
+        {
+            cardano_ed25519_signature_t* signature = nullptr;
+            const bool bSuccess = cardano_ed25519_private_key_sign(Fixture.SigningKey, Fixture.Payload.GetData(), Fixture.Payload.Num(), &signature) == CARDANO_SUCCESS;
+            cardano_ed25519_signature_unref(&signature);
+            return bSuccess;
+        }));
+
+    Results.Add(measure(TEXT("ed25519/verify"), MinSeconds, [&Fixture]()
+        {
+            return cardano_ed25519_public_verify(Fixture.VerificationKey, Fixture.Signature, Fixture.Payload.GetData(), Fixture.Payload.Num());
+        }));
+
+    Results.Add(measure(TEXT("bip32/derive/cip1852_payment_key"), MinSeconds, [&Fixture]()
+        {
+            const uint32_t path[] = {
+                cardano_bip32_harden(CARDANO_CIP_1852_PURPOSE_STANDARD),
+                cardano_bip32_harden(CARDANO_CIP_1852_COIN_TYPE),
+                cardano_bip32_harden(0),
+                0,
+                0
+            };
+
+            cardano_bip32_private_key_t* derived = nullptr;
+            const bool bSuccess = cardano_bip32_private_key_derive(Fixture.RootKey, path, UE_ARRAY_COUNT(path), &derived) == CARDANO_SUCCESS;
+            cardano_bip32_private_key_unref(&derived);
+            return bSuccess;
+        }));
+
+    const size_t AddressLength = strlen(BENCHMARK_ADDRESS);
+    Results.Add(measure(TEXT("bech32/decode/base_address"), MinSeconds, [AddressLength]()
+        {
+            char hrp[16];
+            byte_t data[64];
+            size_t hrp_length = 0;
+            const size_t data_length = cardano_encoding_bech32_get_decoded_length(BENCHMARK_ADDRESS, AddressLength, &hrp_length);
+            return data_length <= sizeof(data) && hrp_length <= sizeof(hrp) &&
+                cardano_encoding_bech32_decode(BENCHMARK_ADDRESS, AddressLength, hrp, hrp_length, data, data_length) == CARDANO_SUCCESS;
+        }));
+
+    Results.Add(measure(TEXT("bech32/encode/base_address"), MinSeconds, [&Fixture]()
+        {
+            const byte_t* data = cardano_address_get_bytes(Fixture.Address);
+            const size_t data_length = cardano_address_get_bytes_size(Fixture.Address);
+            char output[128];
+            const size_t output_length = cardano_encoding_bech32_get_encoded_length("addr", 4, data, data_length);
+            return output_length <= sizeof(output) &&
+                cardano_encoding_bech32_encode("addr", 4, data, data_length, output, output_length) == CARDANO_SUCCESS;
+        }));
+
+    for (int32 SetIndex = 0; SetIndex < Fixture.UTxOSets.Num(); ++SetIndex)
+    {
+        cardano_utxo_list_t* utxos = Fixture.UTxOSets[SetIndex];
+        const int32 Size = BENCHMARK_UTXO_SET_SIZES[SetIndex];
+
+        // Building runs coin selection, fee estimation and cardano_balance_transaction on the result
+        Results.Add(measure(FString::Printf(TEXT("balance_transaction/%d"), Size), MinSeconds, [&Fixture, utxos]()
+            {
+                cardano_transaction_t* transaction = nullptr;
+                const bool bSuccess = build_payment(Fixture, utxos, &transaction) == CARDANO_SUCCESS;
+                cardano_transaction_unref(&transaction);
+                return bSuccess;
+            }));
+
+        cardano_coin_selector_t* large_first = nullptr;
+        cardano_coin_selector_t* random_improve = nullptr;
+        cardano_coin_selector_t* branch_and_bound = nullptr;
+        cardano_value_t* target = cardano_value_new_from_coin(Size == 10 ? 150000000 : 1500000000);
+
+        if (cardano_large_first_coin_selector_new(&large_first) == CARDANO_SUCCESS &&
+            cardano_random_improve_coin_selector_new_with_seed(42, &random_improve) == CARDANO_SUCCESS &&
+            cardano_branch_and_bound_coin_selector_new(1000000, CARDANO_BRANCH_AND_BOUND_DEFAULT_MAX_NODES, large_first, &branch_and_bound) == CARDANO_SUCCESS &&
+            target)
+        {
+            const TPair<const TCHAR*, cardano_coin_selector_t*> Selectors[] = {
+                { TEXT("large_first"), large_first },
+                { TEXT("random_improve"), random_improve },
+                { TEXT("branch_and_bound"), branch_and_bound },
+            };
+
+            for (const TPair<const TCHAR*, cardano_coin_selector_t*>& Selector : Selectors)
+            {
+                cardano_coin_selector_t* selector = Selector.Value;
+                Results.Add(measure(FString::Printf(TEXT("coin_selection/%s/%d"), Selector.Key, Size), MinSeconds, [selector, utxos, target]()
+                    {
+                        return select_coins(selector, utxos, target);
+                    }));
+            }
+        }
+
+        cardano_value_unref(&target);
+        cardano_coin_selector_unref(&branch_and_bound);
+        cardano_coin_selector_unref(&random_improve);
+        cardano_coin_selector_unref(&large_first);
+    }
+
+    return Results;
+}
+
+FString FCardanoLibraryBenchmark::FormatReport(const TArray<FCardanoLibraryBenchmarkResult>& Results)
+{
+    FString Report = FString::Printf(TEXT("%-48s  %12s  %14s  %8s\n"), TEXT("case"), TEXT("iterations"), TEXT("ns/op"), TEXT("failed"));
+    for (const FCardanoLibraryBenchmarkResult& Result : Results)
+    {
+        Report += FString::Printf(TEXT("%-48s  %12lld  %14.1f  %8lld\n"), *Result.Name, Result.Iterations, Result.NanosPerOp, Result.Failures);
+    }
+    return Report;
+}
+
+TArray<FCardanoMemoryFootprintResult> FCardanoLibraryBenchmark::MeasureFootprints(const TArray<TArray<uint8>>& Transactions)
+{
+    TArray<FCardanoMemoryFootprintResult> Results;
+
+    FBenchmarkFixture Fixture;
+    if (!create_fixture(Transactions, Fixture))
+    {
+        UE_LOG(LogCardano, Error, TEXT("Cardano memory footprint: failed to prepare the fixture"));
+        return Results;
+    }
+
+    cardano_memory_footprint_t Footprint;
+
+    if (cardano_address_get_memory_footprint(Fixture.Address, &Footprint) == CARDANO_SUCCESS)
+    {
+        Results.Add(to_footprint_result(TEXT("address/base"), Footprint, 0));
+    }
+
+    const TPair<int32, int32> ValueShapes[] = { { 0, 0 }, { 1, 1 }, { 10, 10 } };
+    for (const TPair<int32, int32>& Shape : ValueShapes)
+    {
+        cardano_value_t* value = create_multi_asset_value(Shape.Key, Shape.Value);
+        if (value && cardano_value_get_memory_footprint(value, &Footprint) == CARDANO_SUCCESS)
+        {
+            Results.Add(to_footprint_result(FString::Printf(TEXT("value/%dx%d_assets"), Shape.Key, Shape.Value), Footprint, 0));
+        }
+        cardano_value_unref(&value);
+    }
+
+    for (int32 SetIndex = 0; SetIndex < Fixture.UTxOSets.Num(); ++SetIndex)
+    {
+        if (cardano_utxo_list_get_memory_footprint(Fixture.UTxOSets[SetIndex], &Footprint) == CARDANO_SUCCESS)
+        {
+            Results.Add(to_footprint_result(FString::Printf(TEXT("utxo_list/%d"), BENCHMARK_UTXO_SET_SIZES[SetIndex]), Footprint, 0));
+        }
+    }
+
+    for (int32 Index = 0; Index < Fixture.Transactions.Num(); ++Index)
+    {
+        const TArray<uint8>& Cbor = Fixture.Transactions[Index];
+        const FString Label = Index == 0 ? FString::Printf(TEXT("built_%d_bytes"), Cbor.Num()) : FString::Printf(TEXT("input%d_%d_bytes"), Index, Cbor.Num());
+
+        cardano_cbor_reader_t* reader = cardano_cbor_reader_new(Cbor.GetData(), Cbor.Num());
+        cardano_transaction_t* transaction = nullptr;
+        if (reader && cardano_transaction_from_cbor(reader, &transaction) == CARDANO_SUCCESS &&
+            cardano_transaction_get_memory_footprint(transaction, &Footprint) == CARDANO_SUCCESS)
+        {
+            Results.Add(to_footprint_result(TEXT("transaction/") + Label, Footprint, Cbor.Num()));
+        }
+        cardano_transaction_unref(&transaction);
+        cardano_cbor_reader_unref(&reader);
+    }
+
+    return Results;
+}
+
+FString FCardanoLibraryBenchmark::FormatFootprintReport(const TArray<FCardanoMemoryFootprintResult>& Results)
+{
+    FString Report = FString::Printf(TEXT("%-36s  %12s  %8s  %8s  %10s  %10s  %7s  %10s\n"),
+        TEXT("footprint"), TEXT("heap bytes"), TEXT("allocs"), TEXT("objects"), TEXT("last_error"), TEXT("bytes/in"), TEXT("shared"), TEXT("unmeasured"));
+
+    for (const FCardanoMemoryFootprintResult& Result : Results)
+    {
+        const FString PerInputByte = Result.EncodedBytes > 0 ? FString::Printf(TEXT("%.1f"), static_cast<double>(Result.HeapBytes) / Result.EncodedBytes) : FString(TEXT("-"));
+        const double LastErrorShare = Result.HeapBytes > 0 ? 100.0 * Result.LastErrorBytes / Result.HeapBytes : 0.0;
+
+        Report += FString::Printf(TEXT("%-36s  %12lld  %8lld  %8lld  %9.1f%%  %10s  %7lld  %10lld\n"),
+            *Result.Name, Result.HeapBytes, Result.Allocations, Result.Objects, LastErrorShare, *PerInputByte, Result.SharedObjects, Result.UnmeasuredObjects);
+
+        for (const FCardanoMemoryFootprintTypeEntry& Entry : Result.ByType)
+        {
+            Report += FString::Printf(TEXT("    %-32s  %12lld  %8s  %8lld\n"), *Entry.Type, Entry.HeapBytes, TEXT(""), Entry.Objects);
+        }
+    }
+
+    return Report;
+}
+
+FString FCardanoLibraryBenchmark::ToJson(const TArray<FCardanoLibraryBenchmarkResult>& Results)
+{
+    TSharedRef<FJsonObject> Context = MakeShared<FJsonObject>();
+    Context->SetStringField(TEXT("date"), FDateTime::UtcNow().ToIso8601());
+    Context->SetStringField(TEXT("executable"), TEXT("CardanoPlugin"));
+    Context->SetNumberField(TEXT("num_cpus"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+    Context->SetStringField(TEXT("library_version"), UTF8_TO_TCHAR(cardano_get_lib_version()));
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+    Context->SetStringField(TEXT("library_build_type"), TEXT("release"));
+#else
+    Context->SetStringField(TEXT("library_build_type"), TEXT("debug"));
+#endif
+
+    TArray<TSharedPtr<FJsonValue>> Benchmarks;
+    for (const FCardanoLibraryBenchmarkResult& Result : Results)
+    {
+        TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("name"), Result.Name);
+        Entry->SetStringField(TEXT("run_name"), Result.Name);
+        Entry->SetStringField(TEXT("run_type"), TEXT("iteration"));
+        Entry->SetNumberField(TEXT("iterations"), static_cast<double>(Result.Iterations));
+        Entry->SetNumberField(TEXT("real_time"), Result.NanosPerOp);
+        Entry->SetNumberField(TEXT("cpu_time"), Result.NanosPerOp);
+        Entry->SetStringField(TEXT("time_unit"), TEXT("ns"));
+        Entry->SetNumberField(TEXT("failures"), static_cast<double>(Result.Failures));
+        Benchmarks.Add(MakeShared<FJsonValueObject>(Entry));
+    }
+
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetObjectField(TEXT("context"), Context);
+    Root->SetArrayField(TEXT("benchmarks"), Benchmarks);
+
+    FString Json;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    FJsonSerializer::Serialize(Root, Writer);
+    return Json;
+}
+
+/** Loads the hex encoded transactions in Files, skipping (with a warning) those that cannot be read or decoded. */
+static TArray<TArray<uint8>> load_hex_transactions(const TCHAR* Command, const TArray<FString>& Files)
+{
+    TArray<TArray<uint8>> Transactions;
+    for (const FString& File : Files)
+    {
+        FString Hex;
+        TArray<uint8> Cbor;
+        if (!FFileHelper::LoadFileToString(Hex, *File))
+        {
+            UE_LOG(LogCardano, Warning, TEXT("%s: cannot read %s"), Command, *File);
+            continue;
+        }
+
+        Hex.TrimStartAndEndInline();
+        Cbor.SetNumUninitialized(Hex.Len() / 2);
+        if (Hex.Len() % 2 != 0 || HexToBytes(Hex, Cbor.GetData()) != Cbor.Num())
+        {
+            UE_LOG(LogCardano, Warning, TEXT("%s: %s is not a hex encoded transaction"), Command, *File);
+            continue;
+        }
+        Transactions.Add(MoveTemp(Cbor));
+    }
+    return Transactions;
+}
+
+static void log_report(const FString& Report)
+{
+    TArray<FString> Lines;
+    Report.ParseIntoArrayLines(Lines);
+    for (const FString& Line : Lines)
+    {
+        UE_LOG(LogCardano, Log, TEXT("%s"), *Line);
+    }
+}
+
+static FAutoConsoleCommand BenchmarkLibraryCommand(
+    TEXT("Cardano.BenchmarkLibrary"),
+    TEXT("Micro-benchmarks the cardano-c hot paths (CBOR, transactions, hashing, signing, derivation, bech32, balancing, coin selection). ")
+    TEXT("Usage: Cardano.BenchmarkLibrary [MinSecondsPerCase=0.5] [OutputFile.json] [TxCborHexFile...]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            const double MinSeconds = Args.Num() > 0 ? FCString::Atod(*Args[0]) : 0.5;
+            const FString OutputFile = Args.Num() > 1 ? Args[1] : FString();
+
+            TArray<FString> Files = Args;
+            Files.RemoveAt(0, FMath::Min(2, Files.Num()));
+            TArray<TArray<uint8>> Transactions = load_hex_transactions(TEXT("Cardano.BenchmarkLibrary"), Files);
+
+            // Keep the game thread responsive; the 100k UTxO cases alone take several seconds
+            Async(EAsyncExecution::Thread, [MinSeconds, OutputFile, Transactions = MoveTemp(Transactions)]()
+                {
+                    const TArray<FCardanoLibraryBenchmarkResult> Results = FCardanoLibraryBenchmark::Run(MinSeconds, Transactions);
+                    log_report(FCardanoLibraryBenchmark::FormatReport(Results));
+                    log_report(FCardanoLibraryBenchmark::FormatFootprintReport(FCardanoLibraryBenchmark::MeasureFootprints(Transactions)));
+
+                    if (!OutputFile.IsEmpty() && !FFileHelper::SaveStringToFile(FCardanoLibraryBenchmark::ToJson(Results), *OutputFile))
+                    {
+                        UE_LOG(LogCardano, Warning, TEXT("Cardano.BenchmarkLibrary: cannot write %s"), *OutputFile);
+                    }
+                });
+        }));
+
+static FAutoConsoleCommand MemoryFootprintCommand(
+    TEXT("Cardano.MemoryFootprint"),
+    TEXT("Logs the deep heap size of cardano-c UTxO sets, values, addresses and transactions, broken down by object type. ")
+    TEXT("Usage: Cardano.MemoryFootprint [TxCborHexFile...]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            TArray<TArray<uint8>> Transactions = load_hex_transactions(TEXT("Cardano.MemoryFootprint"), Args);
+
+            // Building the 100k UTxO set takes a few seconds
+            Async(EAsyncExecution::Thread, [Transactions = MoveTemp(Transactions)]()
+                {
+                    log_report(FCardanoLibraryBenchmark::FormatFootprintReport(FCardanoLibraryBenchmark::MeasureFootprints(Transactions)));
+                });
+        }));
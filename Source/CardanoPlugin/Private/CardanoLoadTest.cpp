@@ -0,0 +1,689 @@
+#include "CardanoLoadTest.h"
+#include "CardanoBlueprintLibrary.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoLog.h"
+#include "CardanoMockKoiosServer.h"
+#include "CardanoSigningPipeline.h"
+#include "CardanoTxPlanner.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IHttpResponse.h"
+#include <cardano/key_handlers/software_secure_key_handler.h>
+#include <sodium.h>
+
+// Defined in CardanoBlueprintLibrary.cpp; the wallets get their addresses the way GenerateWallet does
+cardano_address_t* create_address_from_derivation_paths(
+    cardano_secure_key_handler_t* key_handler,
+    cardano_account_derivation_path_t account_path,
+    uint32_t payment_index,
+    uint32_t stake_key_index);
+
+static const char* LOAD_TEST_PASSPHRASE = "password";
+
+static const TCHAR* STAGE_NAMES[] = { TEXT("balance"), TEXT("utxos"), TEXT("build"), TEXT("sign"), TEXT("submit") };
+
+// Validity window given to the transactions, in slots past the tip
+static const int64 LOAD_TEST_TTL_SLOTS = 7200;
+
+TWeakPtr<FCardanoLoadTest, ESPMode::ThreadSafe> FCardanoLoadTest::Running;
+
+static int32_t get_load_test_passphrase(byte_t* buffer, size_t buffer_len)
+{
+    const size_t PassphraseLen = strlen(LOAD_TEST_PASSPHRASE);
+    if (buffer_len < PassphraseLen)
+    {
+        return -1;
+    }
+
+    FMemory::Memcpy(buffer, LOAD_TEST_PASSPHRASE, PassphraseLen);
+    return static_cast<int32_t>(PassphraseLen);
+}
+
+namespace
+{
+    /** Creates a wallet from fresh entropy; returns false if the key handler or the address could not be made. */
+    bool create_wallet(cardano_secure_key_handler_t** OutKeyHandler, FString& OutAddress)
+    {
+        byte_t entropy[32];
+        randombytes_buf(entropy, sizeof(entropy));
+
+        cardano_secure_key_handler_t* key_handler = nullptr;
+        cardano_error_t result = cardano_software_secure_key_handler_new(
+            entropy,
+            sizeof(entropy),
+            (const byte_t*)LOAD_TEST_PASSPHRASE,
+            strlen(LOAD_TEST_PASSPHRASE),
+            &get_load_test_passphrase,
+            &key_handler);
+        sodium_memzero(entropy, sizeof(entropy));
+
+        if (result != CARDANO_SUCCESS || !key_handler)
+        {
+            return false;
+        }
+
+        cardano_address_t* address = create_address_from_derivation_paths(key_handler, ACCOUNT_DERIVATION_PATH, 0, 0);
+        if (!address)
+        {
+            cardano_secure_key_handler_unref(&key_handler);
+            return false;
+        }
+
+        OutAddress = UTF8_TO_TCHAR(cardano_address_get_string(address));
+        cardano_address_unref(&address);
+
+        *OutKeyHandler = key_handler;
+        return true;
+    }
+
+    /** Nearest-rank percentile of sorted samples. */
+    double percentile(const TArray<double>& Sorted, double Fraction)
+    {
+        if (Sorted.Num() == 0)
+        {
+            return 0.0;
+        }
+
+        const int32 Rank = FMath::CeilToInt(Fraction * Sorted.Num()) - 1;
+        return Sorted[FMath::Clamp(Rank, 0, Sorted.Num() - 1)];
+    }
+
+    bool is_success_response(const FHttpResponsePtr& Response, bool bSuccess)
+    {
+        return bSuccess && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode());
+    }
+
+    FString describe_failure(const TCHAR* Path, const FHttpResponsePtr& Response)
+    {
+        return Response.IsValid()
+            ? FString::Printf(TEXT("%s returned HTTP %d"), Path, Response->GetResponseCode())
+            : FString::Printf(TEXT("%s: no response"), Path);
+    }
+}
+
+FCardanoLoadTest::~FCardanoLoadTest()
+{
+    for (FWallet& Wallet : Wallets)
+    {
+        cardano_secure_key_handler_unref(&Wallet.KeyHandler);
+    }
+}
+
+TSharedPtr<FCardanoLoadTest, ESPMode::ThreadSafe> FCardanoLoadTest::Start(const FCardanoLoadTestConfig& Config, FOnCardanoLoadTestComplete OnComplete)
+{
+    check(IsInGameThread());
+
+    if (Running.IsValid())
+    {
+        UE_LOG(LogCardano, Warning, TEXT("A load test is already running"));
+        return nullptr;
+    }
+
+    TSharedPtr<FCardanoLoadTest, ESPMode::ThreadSafe> Test = MakeShareable(new FCardanoLoadTest());
+    Test->Config = Config;
+    Test->Config.Wallets = FMath::Max(Config.Wallets, 1);
+    Test->Config.bSubmit = Config.bSubmit || Config.bMockServer;
+    Test->OnComplete = MoveTemp(OnComplete);
+    Running = Test;
+
+    Test->Begin();
+    return Test;
+}
+
+void FCardanoLoadTest::Stop()
+{
+    bStopping = true;
+}
+
+void FCardanoLoadTest::Begin()
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        Fail(TEXT("Koios client is not available"));
+        return;
+    }
+
+    if (sodium_init() < 0)
+    {
+        Fail(TEXT("libsodium could not be initialized"));
+        return;
+    }
+
+    PreviousBaseUrl = Koios->GetBaseUrl();
+
+    if (Config.bMockServer)
+    {
+        MockServer = MakeUnique<FCardanoMockKoiosServer>();
+        if (!MockServer->Start(Config.MockPort, Config.MockLatencySeconds, Config.MockUTxOsPerWallet))
+        {
+            MockServer.Reset();
+            Fail(TEXT("Mock Koios server could not be started"));
+            return;
+        }
+
+        Koios->SetBaseUrl(MockServer->GetBaseUrl());
+    }
+    else if (!Config.Endpoint.IsEmpty())
+    {
+        Koios->SetBaseUrl(Config.Endpoint);
+    }
+
+    // Each key handler pays for an EMIP-3 encryption; spread them over the cores rather than stalling the game thread
+    const int32 NumWallets = Config.Wallets;
+    TSharedRef<FCardanoLoadTest, ESPMode::ThreadSafe> Self = AsShared();
+    Async(EAsyncExecution::Thread, [Self, NumWallets]()
+        {
+            TArray<cardano_secure_key_handler_t*> KeyHandlers;
+            TArray<FString> Addresses;
+            KeyHandlers.SetNumZeroed(NumWallets);
+            Addresses.SetNum(NumWallets);
+
+            ParallelFor(NumWallets, [&KeyHandlers, &Addresses](int32 i)
+                {
+                    create_wallet(&KeyHandlers[i], Addresses[i]);
+                });
+
+            AsyncTask(ENamedThreads::GameThread, [Self, KeyHandlers = MoveTemp(KeyHandlers), Addresses = MoveTemp(Addresses)]()
+                {
+                    for (int32 i = 0; i < KeyHandlers.Num(); i++)
+                    {
+                        if (KeyHandlers[i])
+                        {
+                            FWallet& Wallet = Self->Wallets.AddDefaulted_GetRef();
+                            Wallet.KeyHandler = KeyHandlers[i];
+                            Wallet.Address = Addresses[i];
+                        }
+                    }
+
+                    if (Self->Wallets.Num() == 0)
+                    {
+                        Self->Fail(TEXT("No wallet could be created"));
+                        return;
+                    }
+
+                    Self->FetchNetworkState();
+                });
+        });
+}
+
+void FCardanoLoadTest::FetchNetworkState()
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        Fail(TEXT("Koios client is not available"));
+        return;
+    }
+
+    // The tip and the parameters are shared by every wallet, as a game shares its UCardanoChainTip and parameter cache
+    TSharedRef<FCardanoLoadTest, ESPMode::ThreadSafe> Self = AsShared();
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> TipRequest = Koios->CreateRequest(TEXT("GET"), TEXT("tip"));
+    TipRequest->OnProcessRequestComplete().BindLambda([Self](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            int64 AbsSlot = 0;
+            if (!is_success_response(Response, Success) || !ParseJsonArray(Response, JsonArray) || JsonArray.Num() == 0 ||
+                !JsonArray[0]->AsObject().IsValid() || !JsonArray[0]->AsObject()->TryGetNumberField("abs_slot", AbsSlot))
+            {
+                Self->Fail(describe_failure(TEXT("tip"), Response));
+                return;
+            }
+
+            Self->InvalidAfter = AbsSlot + LOAD_TEST_TTL_SLOTS;
+
+            UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+            if (!Koios)
+            {
+                Self->Fail(TEXT("Koios client is not available"));
+                return;
+            }
+
+            TSharedRef<IHttpRequest, ESPMode::ThreadSafe> ParamsRequest =
+                Koios->CreateRequest(TEXT("GET"), TEXT("epoch_params?order=epoch_no.desc&limit=1"));
+            ParamsRequest->OnProcessRequestComplete().BindLambda([Self](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+                {
+                    TArray<TSharedPtr<FJsonValue>> JsonArray;
+                    if (!is_success_response(Response, Success) || !ParseJsonArray(Response, JsonArray) || JsonArray.Num() == 0 ||
+                        !JsonArray[0]->AsObject().IsValid() || !ParseProtocolParameters(*JsonArray[0]->AsObject(), Self->Parameters))
+                    {
+                        Self->Fail(describe_failure(TEXT("epoch_params"), Response));
+                        return;
+                    }
+
+                    Self->StartWallets();
+                });
+            Koios->ProcessRequest(ParamsRequest, ECardanoRequestPriority::Balance);
+        });
+    Koios->ProcessRequest(TipRequest, ECardanoRequestPriority::Balance);
+}
+
+void FCardanoLoadTest::StartWallets()
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        Fail(TEXT("Koios client is not available"));
+        return;
+    }
+
+    Koios->ResetStats();
+    StartTime = FPlatformTime::Seconds();
+    EndTime = StartTime + Config.DurationSeconds;
+    ActiveWallets = Wallets.Num();
+
+    UE_LOG(LogCardano, Log, TEXT("Load test started: %d wallets for %.0f s against %s"),
+        Wallets.Num(), Config.DurationSeconds, *Koios->GetBaseUrl());
+
+    // Spread the first iterations over one think time so the wallets do not poll in lockstep
+    TSharedRef<FCardanoLoadTest, ESPMode::ThreadSafe> Self = AsShared();
+    for (int32 i = 0; i < Wallets.Num(); i++)
+    {
+        const float Delay = Config.ThinkTimeSeconds * i / Wallets.Num();
+        FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Self, i](float)
+            {
+                Self->StartIteration(i);
+                return false;
+            }), Delay);
+    }
+}
+
+void FCardanoLoadTest::StartIteration(int32 WalletIndex)
+{
+    if (bStopping || FPlatformTime::Seconds() >= EndTime)
+    {
+        if (--ActiveWallets == 0)
+        {
+            Finish();
+        }
+        return;
+    }
+
+    RunBalance(WalletIndex);
+}
+
+void FCardanoLoadTest::FinishStage(int32 WalletIndex, EStage Stage, bool bSuccess, const FString& Error)
+{
+    const int32 StageIndex = static_cast<int32>(Stage);
+
+    if (!bSuccess)
+    {
+        Failures[StageIndex]++;
+        if (FirstError.IsEmpty())
+        {
+            FirstError = FString::Printf(TEXT("%s: %s"), STAGE_NAMES[StageIndex], *Error);
+        }
+
+        EndIteration(WalletIndex);
+        return;
+    }
+
+    Latencies[StageIndex].Add((FPlatformTime::Seconds() - Wallets[WalletIndex].StageStart) * 1000.0);
+
+    switch (Stage)
+    {
+    case EStage::Balance:
+        RunUTxOs(WalletIndex);
+        break;
+    case EStage::UTxOs:
+        RunBuild(WalletIndex);
+        break;
+    case EStage::Build:
+        RunSign(WalletIndex);
+        break;
+    case EStage::Sign:
+        if (Config.bSubmit)
+        {
+            RunSubmit(WalletIndex);
+            break;
+        }
+        Iterations++;
+        EndIteration(WalletIndex);
+        break;
+    default:
+        Iterations++;
+        EndIteration(WalletIndex);
+        break;
+    }
+}
+
+void FCardanoLoadTest::EndIteration(int32 WalletIndex)
+{
+    TSharedRef<FCardanoLoadTest, ESPMode::ThreadSafe> Self = AsShared();
+    FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Self, WalletIndex](float)
+        {
+            Self->StartIteration(WalletIndex);
+            return false;
+        }), FMath::Max(Config.ThinkTimeSeconds, 0.0f));
+}
+
+void FCardanoLoadTest::RunBalance(int32 WalletIndex)
+{
+    FWallet& Wallet = Wallets[WalletIndex];
+    Wallet.StageStart = FPlatformTime::Seconds();
+
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        FinishStage(WalletIndex, EStage::Balance, false, TEXT("Koios client is not available"));
+        return;
+    }
+
+    TSharedRef<FCardanoLoadTest, ESPMode::ThreadSafe> Self = AsShared();
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
+        Koios->CreateJsonPost(TEXT("address_info"), UCardanoKoiosClient::MakeAddressesBody({ Wallet.Address }));
+    HttpRequest->OnProcessRequestComplete().BindLambda([Self, WalletIndex](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!is_success_response(Response, Success))
+            {
+                Self->FinishStage(WalletIndex, EStage::Balance, false, describe_failure(TEXT("address_info"), Response));
+                return;
+            }
+
+            DecodeKoiosResponse(Response,
+                [](const TArray<uint8>& Content)
+                {
+                    return DecodeAddressInfoRows(Content, [](FString&&, FAddressBalance&&) {});
+                },
+                [Self, WalletIndex](bool bDecoded)
+                {
+                    Self->FinishStage(WalletIndex, EStage::Balance, bDecoded, TEXT("address_info response could not be decoded"));
+                });
+        });
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+}
+
+void FCardanoLoadTest::RunUTxOs(int32 WalletIndex)
+{
+    FWallet& Wallet = Wallets[WalletIndex];
+    Wallet.StageStart = FPlatformTime::Seconds();
+
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        FinishStage(WalletIndex, EStage::UTxOs, false, TEXT("Koios client is not available"));
+        return;
+    }
+
+    TSharedRef<FCardanoLoadTest, ESPMode::ThreadSafe> Self = AsShared();
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
+        Koios->CreateJsonPost(TEXT("address_utxos"), UCardanoKoiosClient::MakeAddressesBody({ Wallet.Address }, true));
+    HttpRequest->OnProcessRequestComplete().BindLambda([Self, WalletIndex](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!is_success_response(Response, Success))
+            {
+                Self->FinishStage(WalletIndex, EStage::UTxOs, false, describe_failure(TEXT("address_utxos"), Response));
+                return;
+            }
+
+            // Decoded into a buffer of its own, since large bodies are decoded on the thread pool
+            TSharedRef<TArray<FUTxO>, ESPMode::ThreadSafe> UTxOs = MakeShared<TArray<FUTxO>, ESPMode::ThreadSafe>();
+            DecodeKoiosResponse(Response,
+                [UTxOs](const TArray<uint8>& Content)
+                {
+                    int32 RowCount = 0;
+                    return DecodeUTxORows(Content, [&UTxOs = *UTxOs](FString&&, FUTxO&& UTxO) { UTxOs.Add(MoveTemp(UTxO)); }, RowCount);
+                },
+                [Self, WalletIndex, UTxOs](bool bDecoded)
+                {
+                    if (bDecoded)
+                    {
+                        Self->Wallets[WalletIndex].UTxOs = MoveTemp(*UTxOs);
+                    }
+                    Self->FinishStage(WalletIndex, EStage::UTxOs, bDecoded, TEXT("address_utxos response could not be decoded"));
+                });
+        });
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+}
+
+void FCardanoLoadTest::RunBuild(int32 WalletIndex)
+{
+    FWallet& Wallet = Wallets[WalletIndex];
+    Wallet.StageStart = FPlatformTime::Seconds();
+
+    FCardanoTxPlan Plan;
+    Plan.Parameters = Parameters;
+    Plan.ChangeAddress = Wallet.Address;
+    Plan.OwnerAddress = Wallet.Address;
+    Plan.InvalidAfter = InvalidAfter;
+
+    // A real endpoint knows nothing of these fresh wallets; build on the mock's UTxOs so the build and sign stages
+    // are still measured
+    Plan.UTxOs = Wallet.UTxOs.Num() > 0 ? Wallet.UTxOs : FCardanoMockKoiosServer::MakeUTxOs(Wallet.Address, Config.MockUTxOsPerWallet);
+
+    FCardanoTxPayment& Payment = Plan.Payments.AddDefaulted_GetRef();
+    Payment.Address = Wallet.Address;
+    Payment.Lovelace = Config.PaymentLovelace;
+
+    TSharedRef<FCardanoLoadTest, ESPMode::ThreadSafe> Self = AsShared();
+    Async(EAsyncExecution::ThreadPool, [Self, WalletIndex, Plan = MoveTemp(Plan)]()
+        {
+            TArray<FCardanoTxCandidate> Candidates;
+            FString Error;
+            const bool bBuilt = FCardanoTxPlanner::BuildCandidates(Plan, { FCardanoTxStrategy() }, Candidates, Error) &&
+                Candidates.Num() > 0 && Candidates[0].bSuccess;
+
+            TArray<uint8> Transaction;
+            if (bBuilt)
+            {
+                Transaction = MoveTemp(Candidates[0].Transaction);
+            }
+            else if (Candidates.Num() > 0)
+            {
+                Error = Candidates[0].Error;
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [Self, WalletIndex, bBuilt, Transaction = MoveTemp(Transaction), Error]() mutable
+                {
+                    Self->Wallets[WalletIndex].Transaction = MoveTemp(Transaction);
+                    Self->FinishStage(WalletIndex, EStage::Build, bBuilt, Error);
+                });
+        });
+}
+
+void FCardanoLoadTest::RunSign(int32 WalletIndex)
+{
+    FWallet& Wallet = Wallets[WalletIndex];
+    Wallet.StageStart = FPlatformTime::Seconds();
+
+    // The wallet is in one stage at a time, so its key handler is never used by two workers at once
+    cardano_secure_key_handler_t* KeyHandler = Wallet.KeyHandler;
+    TArray<TArray<uint8>> UnsignedTransactions = { Wallet.Transaction };
+
+    TSharedRef<FCardanoLoadTest, ESPMode::ThreadSafe> Self = AsShared();
+    Async(EAsyncExecution::ThreadPool, [Self, WalletIndex, KeyHandler, UnsignedTransactions = MoveTemp(UnsignedTransactions)]()
+        {
+            const cardano_derivation_path_t PaymentPath = {
+                ACCOUNT_DERIVATION_PATH.purpose,
+                ACCOUNT_DERIVATION_PATH.coin_type,
+                ACCOUNT_DERIVATION_PATH.account | 0x80000000,
+                0,
+                0
+            };
+
+            TArray<TArray<uint8>> SignedTransactions;
+            FString Error;
+            const bool bSigned = FCardanoSigningPipeline::SignTransactions(KeyHandler, UnsignedTransactions, { PaymentPath }, SignedTransactions, Error);
+
+            TArray<uint8> Transaction;
+            if (bSigned)
+            {
+                Transaction = MoveTemp(SignedTransactions[0]);
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [Self, WalletIndex, bSigned, Transaction = MoveTemp(Transaction), Error]() mutable
+                {
+                    Self->Wallets[WalletIndex].Transaction = MoveTemp(Transaction);
+                    Self->FinishStage(WalletIndex, EStage::Sign, bSigned, Error);
+                });
+        });
+}
+
+void FCardanoLoadTest::RunSubmit(int32 WalletIndex)
+{
+    FWallet& Wallet = Wallets[WalletIndex];
+    Wallet.StageStart = FPlatformTime::Seconds();
+
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        FinishStage(WalletIndex, EStage::Submit, false, TEXT("Koios client is not available"));
+        return;
+    }
+
+    TSharedRef<FCardanoLoadTest, ESPMode::ThreadSafe> Self = AsShared();
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateRequest(TEXT("POST"), TEXT("submittx"));
+    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/cbor"));
+    HttpRequest->SetContent(Wallet.Transaction);
+    HttpRequest->OnProcessRequestComplete().BindLambda([Self, WalletIndex](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            Self->FinishStage(WalletIndex, EStage::Submit, is_success_response(Response, Success), describe_failure(TEXT("submittx"), Response));
+        });
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Submission);
+}
+
+void FCardanoLoadTest::Fail(const FString& Error)
+{
+    if (FirstError.IsEmpty())
+    {
+        FirstError = Error;
+    }
+
+    UE_LOG(LogCardano, Error, TEXT("Load test aborted: %s"), *Error);
+    Finish();
+}
+
+void FCardanoLoadTest::Finish()
+{
+    if (bFinished)
+    {
+        return;
+    }
+    bFinished = true;
+
+    FCardanoLoadTestReport Report;
+    Report.Wallets = Wallets.Num();
+    Report.ElapsedSeconds = StartTime > 0.0 ? FPlatformTime::Seconds() - StartTime : 0.0;
+    Report.Iterations = Iterations;
+    Report.IterationsPerSecond = Report.ElapsedSeconds > 0.0 ? Iterations / Report.ElapsedSeconds : 0.0;
+    Report.FirstError = FirstError;
+
+    for (int32 StageIndex = 0; StageIndex < static_cast<int32>(EStage::Count); StageIndex++)
+    {
+        if (StageIndex == static_cast<int32>(EStage::Submit) && !Config.bSubmit)
+        {
+            continue;
+        }
+
+        TArray<double>& Samples = Latencies[StageIndex];
+        Samples.Sort();
+
+        FCardanoLoadTestStageStats& Stage = Report.Stages.AddDefaulted_GetRef();
+        Stage.Name = STAGE_NAMES[StageIndex];
+        Stage.Failures = Failures[StageIndex];
+        Stage.Count = Samples.Num() + Stage.Failures;
+
+        double Total = 0.0;
+        for (double Sample : Samples)
+        {
+            Total += Sample;
+        }
+
+        Stage.MeanMs = Samples.Num() > 0 ? Total / Samples.Num() : 0.0;
+        Stage.P50Ms = percentile(Samples, 0.50);
+        Stage.P90Ms = percentile(Samples, 0.90);
+        Stage.P99Ms = percentile(Samples, 0.99);
+        Stage.MaxMs = Samples.Num() > 0 ? Samples.Last() : 0.0;
+    }
+
+    if (UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get())
+    {
+        Report.Endpoint = Koios->GetBaseUrl();
+        Report.Http = Koios->GetStats();
+
+        if (!PreviousBaseUrl.IsEmpty())
+        {
+            Koios->SetBaseUrl(PreviousBaseUrl);
+        }
+    }
+
+    if (MockServer.IsValid())
+    {
+        Report.MockRequestsServed = MockServer->GetRequestsServed();
+        MockServer->Stop();
+    }
+
+    OnComplete.ExecuteIfBound(Report);
+}
+
+FString FCardanoLoadTest::FormatReport(const FCardanoLoadTestReport& Report)
+{
+    FString Text = FString::Printf(TEXT("Load test against %s: %d wallets, %d iterations in %.1f s (%.2f/s)\n"),
+        *Report.Endpoint, Report.Wallets, Report.Iterations, Report.ElapsedSeconds, Report.IterationsPerSecond);
+
+    Text += TEXT("stage    count  failed  mean(ms)  p50(ms)  p90(ms)  p99(ms)  max(ms)\n");
+    for (const FCardanoLoadTestStageStats& Stage : Report.Stages)
+    {
+        Text += FString::Printf(TEXT("%-7s  %5d  %6d  %8.1f  %7.1f  %7.1f  %7.1f  %7.1f\n"),
+            *Stage.Name, Stage.Count, Stage.Failures, Stage.MeanMs, Stage.P50Ms, Stage.P90Ms, Stage.P99Ms, Stage.MaxMs);
+    }
+
+    const FCardanoKoiosClientStats& Http = Report.Http;
+    Text += FString::Printf(TEXT("http: %lld queued, %lld sent, %lld retried, %lld connection failures, %lld error responses\n"),
+        Http.RequestsQueued, Http.RequestsSent, Http.Retries, Http.ConnectionFailures, Http.ErrorResponses);
+    Text += FString::Printf(TEXT("http: peak %d in flight, peak %d queued, %.1f KiB sent, %.1f KiB received\n"),
+        Http.PeakInFlight, Http.PeakQueued, Http.BytesSent / 1024.0, Http.BytesReceived / 1024.0);
+
+    if (Report.MockRequestsServed > 0)
+    {
+        Text += FString::Printf(TEXT("mock server answered %lld requests\n"), Report.MockRequestsServed);
+    }
+
+    if (!Report.FirstError.IsEmpty())
+    {
+        Text += FString::Printf(TEXT("first error: %s\n"), *Report.FirstError);
+    }
+
+    return Text;
+}
+
+static FAutoConsoleCommand LoadTestCommand(
+    TEXT("Cardano.LoadTest"),
+    TEXT("Runs concurrent wallets through balance, UTxO, build, sign and submit and logs per-stage latencies. ")
+    TEXT("Usage: Cardano.LoadTest [Wallets=50] [DurationSeconds=60] [Endpoint|mock=mock] [ThinkTimeSeconds=1]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            FCardanoLoadTestConfig Config;
+            if (Args.Num() > 0) Config.Wallets = FCString::Atoi(*Args[0]);
+            if (Args.Num() > 1) Config.DurationSeconds = FCString::Atof(*Args[1]);
+            if (Args.Num() > 2 && !Args[2].Equals(TEXT("mock"), ESearchCase::IgnoreCase))
+            {
+                Config.bMockServer = false;
+                Config.Endpoint = Args[2];
+            }
+            if (Args.Num() > 3) Config.ThinkTimeSeconds = FCString::Atof(*Args[3]);
+
+            FCardanoLoadTest::Start(Config, FOnCardanoLoadTestComplete::CreateLambda([](const FCardanoLoadTestReport& Report)
+                {
+                    TArray<FString> Lines;
+                    FCardanoLoadTest::FormatReport(Report).ParseIntoArrayLines(Lines);
+                    for (const FString& Line : Lines)
+                    {
+                        UE_LOG(LogCardano, Log, TEXT("%s"), *Line);
+                    }
+                }));
+        }));
+
+static FAutoConsoleCommand LoadTestStopCommand(
+    TEXT("Cardano.LoadTestStop"),
+    TEXT("Ends the running Cardano.LoadTest early; the report is logged once the wallets finish their current stage."),
+    FConsoleCommandDelegate::CreateLambda([]()
+        {
+            if (TSharedPtr<FCardanoLoadTest, ESPMode::ThreadSafe> Test = FCardanoLoadTest::GetRunning())
+            {
+                Test->Stop();
+            }
+        }));
@@ -0,0 +1,250 @@
+#include "CardanoMempoolOverlay.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoLog.h"
+#include "CardanoUTxOCache.h"
+#include "Engine/Engine.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+struct UCardanoMempoolOverlay::FPollRound
+{
+    /** Address listings still in flight, then transactions still being read. */
+    int32 Remaining = 0;
+
+    /** Cleared if a listing failed, so the transactions it would have listed are not forgotten. */
+    bool bComplete = true;
+
+    /** Every mempool transaction listed for a watched address. */
+    TSet<FString> Listed;
+
+    /** Spent outputs of the transactions read this round. */
+    TMap<FString, TArray<FCardanoUTxORef>> Fetched;
+};
+
+UCardanoMempoolOverlay* UCardanoMempoolOverlay::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoMempoolOverlay>() : nullptr;
+}
+
+void UCardanoMempoolOverlay::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Collection.InitializeDependency(UCardanoUTxOCache::StaticClass());
+
+    if (IsEnabled())
+    {
+        TickHandle = FTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &UCardanoMempoolOverlay::Tick), FMath::Max(PollIntervalSeconds, 1.0f));
+    }
+}
+
+void UCardanoMempoolOverlay::Deinitialize()
+{
+    FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    Super::Deinitialize();
+}
+
+bool UCardanoMempoolOverlay::Tick(float DeltaTime)
+{
+    PollNow();
+    return true;
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UCardanoMempoolOverlay::CreateRequest(const FString& Path) const
+{
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    HttpRequest->SetVerb(TEXT("GET"));
+    HttpRequest->SetURL(MempoolUrl.EndsWith(TEXT("/")) ? MempoolUrl + Path : MempoolUrl / Path);
+    HttpRequest->SetHeader(TEXT("Accept"), TEXT("application/json"));
+    if (!ProjectId.IsEmpty())
+    {
+        HttpRequest->SetHeader(TEXT("project_id"), ProjectId);
+    }
+    return HttpRequest;
+}
+
+void UCardanoMempoolOverlay::PollNow()
+{
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (bPollInProgress || !IsEnabled() || !Cache)
+    {
+        return;
+    }
+
+    const TArray<FString> Addresses = Cache->GetWatchedAddresses();
+    TSharedRef<FPollRound> Round = MakeShared<FPollRound>();
+    if (Addresses.Num() == 0)
+    {
+        FinishRound(Round);
+        return;
+    }
+
+    bPollInProgress = true;
+    Round->Remaining = Addresses.Num();
+
+    TWeakObjectPtr<UCardanoMempoolOverlay> WeakThis(this);
+    for (const FString& Address : Addresses)
+    {
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateRequest(TEXT("mempool/addresses/") + Address);
+        HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Round](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+            {
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->OnAddressListed(Round, Response, Success);
+                }
+            });
+
+        if (!HttpRequest->ProcessRequest())
+        {
+            OnAddressListed(Round, nullptr, false);
+        }
+    }
+}
+
+void UCardanoMempoolOverlay::OnAddressListed(TSharedRef<FPollRound> Round, FHttpResponsePtr Response, bool bSuccess)
+{
+    // Blockfrost answers 404 for an address without mempool transactions
+    TArray<TSharedPtr<FJsonValue>> Rows;
+    if (bSuccess && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()) && ParseJsonArray(Response, Rows))
+    {
+        for (const TSharedPtr<FJsonValue>& Row : Rows)
+        {
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            FString TxHash;
+            if (Row.IsValid() && Row->TryGetObject(Object) && (*Object)->TryGetStringField(TEXT("tx_hash"), TxHash))
+            {
+                Round->Listed.Add(TxHash.ToLower());
+            }
+        }
+    }
+    else if (!bSuccess || !Response.IsValid() || Response->GetResponseCode() != EHttpResponseCodes::NotFound)
+    {
+        UE_LOG(LogCardano, Verbose, TEXT("Mempool listing failed (HTTP %d)"), Response.IsValid() ? Response->GetResponseCode() : 0);
+        Round->bComplete = false;
+    }
+
+    if (--Round->Remaining == 0)
+    {
+        FetchTransactions(Round);
+    }
+}
+
+void UCardanoMempoolOverlay::FetchTransactions(TSharedRef<FPollRound> Round)
+{
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+
+    TArray<FString> TxHashes;
+    for (const FString& TxHash : Round->Listed)
+    {
+        if (!Transactions.Contains(TxHash) && !(Cache && Cache->IsPendingTransaction(TxHash)) && TxHashes.Num() < FMath::Max(MaxTransactionsPerPoll, 1))
+        {
+            TxHashes.Add(TxHash);
+        }
+    }
+
+    if (TxHashes.Num() == 0)
+    {
+        FinishRound(Round);
+        return;
+    }
+
+    Round->Remaining = TxHashes.Num();
+
+    TWeakObjectPtr<UCardanoMempoolOverlay> WeakThis(this);
+    for (const FString& TxHash : TxHashes)
+    {
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateRequest(TEXT("mempool/") + TxHash);
+        HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Round, TxHash](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+            {
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->OnTransactionFetched(Round, TxHash, Response, Success);
+                }
+            });
+
+        if (!HttpRequest->ProcessRequest())
+        {
+            OnTransactionFetched(Round, TxHash, nullptr, false);
+        }
+    }
+}
+
+void UCardanoMempoolOverlay::OnTransactionFetched(TSharedRef<FPollRound> Round, const FString& TxHash, FHttpResponsePtr Response, bool bSuccess)
+{
+    TSharedPtr<FJsonObject> Transaction;
+    const TArray<TSharedPtr<FJsonValue>>* Inputs = nullptr;
+
+    // A transaction that left the mempool in the meantime answers 404, and is not listed by the next poll
+    if (bSuccess && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()) &&
+        FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Response->GetContentAsString()), Transaction) &&
+        Transaction.IsValid() && Transaction->TryGetArrayField(TEXT("inputs"), Inputs))
+    {
+        TArray<FCardanoUTxORef>& Spent = Round->Fetched.Add(TxHash);
+        for (const TSharedPtr<FJsonValue>& Input : *Inputs)
+        {
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            FString InputHash;
+            int32 OutputIndex = 0;
+            bool bCollateral = false;
+            bool bReference = false;
+
+            // Collateral only goes if the scripts fail, and reference inputs are only read
+            if (!Input.IsValid() || !Input->TryGetObject(Object) ||
+                !(*Object)->TryGetStringField(TEXT("tx_hash"), InputHash) ||
+                !(*Object)->TryGetNumberField(TEXT("output_index"), OutputIndex) ||
+                ((*Object)->TryGetBoolField(TEXT("collateral"), bCollateral) && bCollateral) ||
+                ((*Object)->TryGetBoolField(TEXT("reference"), bReference) && bReference))
+            {
+                continue;
+            }
+
+            FCardanoUTxORef& Ref = Spent.AddDefaulted_GetRef();
+            Ref.TxIndex = static_cast<uint32>(OutputIndex);
+            if (!FCardanoHash32::FromHex(InputHash, Ref.TxHash))
+            {
+                Spent.Pop();
+            }
+        }
+    }
+
+    if (--Round->Remaining == 0)
+    {
+        FinishRound(Round);
+    }
+}
+
+void UCardanoMempoolOverlay::FinishRound(TSharedRef<FPollRound> Round)
+{
+    bPollInProgress = false;
+
+    // A partial listing cannot tell a transaction that left the mempool from one it missed
+    if (Round->bComplete)
+    {
+        for (auto It = Transactions.CreateIterator(); It; ++It)
+        {
+            if (!Round->Listed.Contains(It.Key()))
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+    Transactions.Append(MoveTemp(Round->Fetched));
+
+    TMap<FCardanoUTxORef, FString> Spends;
+    for (const TPair<FString, TArray<FCardanoUTxORef>>& Transaction : Transactions)
+    {
+        for (const FCardanoUTxORef& Ref : Transaction.Value)
+        {
+            Spends.Add(Ref, Transaction.Key);
+        }
+    }
+
+    UE_LOG(LogCardano, Verbose, TEXT("Mempool poll: %d transactions spending %d outputs"), Transactions.Num(), Spends.Num());
+
+    if (UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get())
+    {
+        Cache->SetMempoolSpends(MoveTemp(Spends));
+    }
+}
@@ -0,0 +1,305 @@
+#include "CardanoMetrics.h"
+#include "CardanoLog.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
+#include "Misc/ScopeLock.h"
+
+static const double DURATION_BOUNDS[] = { 0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0 };
+
+struct FCardanoMetrics::FHttpEndpoint
+{
+    TSharedPtr<IHttpRouter> Router;
+    FHttpRouteHandle Route;
+};
+
+/** Label values escape backslashes, quotes and line feeds. */
+static FString EscapeLabelValue(const FString& Value)
+{
+    return Value.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\"")).Replace(TEXT("\n"), TEXT("\\n"));
+}
+
+/** Shortest form that reads back to the same double, as the exposition format expects for bounds and sums. */
+static FString FormatNumber(double Value)
+{
+    FString Text = FString::Printf(TEXT("%.17g"), Value);
+    for (int32 Precision = 1; Precision < 17; ++Precision)
+    {
+        const FString Shorter = FString::Printf(TEXT("%.*g"), Precision, Value);
+        if (FCString::Atod(*Shorter) == Value)
+        {
+            Text = Shorter;
+            break;
+        }
+    }
+    return Text;
+}
+
+FCardanoHistogram::FCardanoHistogram(TArrayView<const double> InBounds)
+{
+    BoundCount = FMath::Min(InBounds.Num(), MaxBuckets);
+    for (int32 i = 0; i < BoundCount; ++i)
+    {
+        Bounds[i] = InBounds[i];
+    }
+
+    for (TAtomic<uint64>& Count : Counts)
+    {
+        Count.Store(0, EMemoryOrder::Relaxed);
+    }
+}
+
+void FCardanoHistogram::Observe(double Value)
+{
+    int32 Bucket = 0;
+    while (Bucket < BoundCount && Value > Bounds[Bucket])
+    {
+        ++Bucket;
+    }
+    Counts[Bucket] += 1;
+
+    uint64 Expected = SumBits.Load(EMemoryOrder::Relaxed);
+    for (;;)
+    {
+        double Sum;
+        FMemory::Memcpy(&Sum, &Expected, sizeof(Sum));
+        Sum += Value;
+
+        uint64 Desired;
+        FMemory::Memcpy(&Desired, &Sum, sizeof(Desired));
+        if (SumBits.CompareExchange(Expected, Desired))
+        {
+            break;
+        }
+    }
+}
+
+void FCardanoHistogram::GetCumulativeCounts(TArray<uint64>& OutCounts) const
+{
+    OutCounts.SetNumUninitialized(BoundCount + 1);
+
+    uint64 Total = 0;
+    for (int32 i = 0; i <= BoundCount; ++i)
+    {
+        Total += Counts[i].Load(EMemoryOrder::Relaxed);
+        OutCounts[i] = Total;
+    }
+}
+
+double FCardanoHistogram::GetSum() const
+{
+    const uint64 Bits = SumBits.Load(EMemoryOrder::Relaxed);
+    double Sum;
+    FMemory::Memcpy(&Sum, &Bits, sizeof(Sum));
+    return Sum;
+}
+
+FCardanoMetrics& FCardanoMetrics::Get()
+{
+    static FCardanoMetrics Metrics;
+    return Metrics;
+}
+
+FCardanoMetrics::FCardanoMetrics() = default;
+
+FCardanoMetrics::~FCardanoMetrics() = default;
+
+TArrayView<const double> FCardanoMetrics::GetDurationBounds()
+{
+    return MakeArrayView(DURATION_BOUNDS, UE_ARRAY_COUNT(DURATION_BOUNDS));
+}
+
+FString FCardanoMetrics::MakeLabels(const TCHAR* Key, const FString& Value)
+{
+    return FString::Printf(TEXT("%s=\"%s\""), Key, *EscapeLabelValue(Value));
+}
+
+FString FCardanoMetrics::MakeLabels(const TCHAR* Key1, const FString& Value1, const TCHAR* Key2, const FString& Value2)
+{
+    return MakeLabels(Key1, Value1) + TEXT(",") + MakeLabels(Key2, Value2);
+}
+
+FCardanoMetrics::FSeries& FCardanoMetrics::FindOrAddSeries(const FString& Name, const FString& Help, const FString& Labels, ECardanoMetricType Type)
+{
+    FFamily*& Family = FamiliesByName.FindOrAdd(Name);
+    if (!Family)
+    {
+        Family = Families.Add_GetRef(MakeUnique<FFamily>()).Get();
+        Family->Name = Name;
+        Family->Help = Help;
+        Family->Type = Type;
+    }
+
+    checkf(Family->Type == Type, TEXT("Metric %s is registered with two types"), *Name);
+
+    for (const TUniquePtr<FSeries>& Series : Family->Series)
+    {
+        if (Series->Labels == Labels)
+        {
+            return *Series;
+        }
+    }
+
+    FSeries& Series = *Family->Series.Add_GetRef(MakeUnique<FSeries>());
+    Series.Labels = Labels;
+    return Series;
+}
+
+FCardanoCounter& FCardanoMetrics::Counter(const FString& Name, const FString& Help, const FString& Labels)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    FSeries& Series = FindOrAddSeries(Name, Help, Labels, ECardanoMetricType::Counter);
+    if (!Series.Counter)
+    {
+        Series.Counter = MakeUnique<FCardanoCounter>();
+    }
+    return *Series.Counter;
+}
+
+FCardanoGauge& FCardanoMetrics::Gauge(const FString& Name, const FString& Help, const FString& Labels)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    FSeries& Series = FindOrAddSeries(Name, Help, Labels, ECardanoMetricType::Gauge);
+    if (!Series.Gauge)
+    {
+        Series.Gauge = MakeUnique<FCardanoGauge>();
+    }
+    return *Series.Gauge;
+}
+
+FCardanoHistogram& FCardanoMetrics::Histogram(const FString& Name, const FString& Help, const FString& Labels, TArrayView<const double> Bounds)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    FSeries& Series = FindOrAddSeries(Name, Help, Labels, ECardanoMetricType::Histogram);
+    if (!Series.Histogram)
+    {
+        // Every series of a family shares the bounds of the first one, as aggregating them across labels requires
+        FFamily* Family = FamiliesByName[Name];
+        const FSeries& First = *Family->Series[0];
+        Series.Histogram = MakeUnique<FCardanoHistogram>(First.Histogram ? First.Histogram->GetBounds() : Bounds);
+    }
+    return *Series.Histogram;
+}
+
+void FCardanoMetrics::Visit(TFunctionRef<void(const FCardanoMetricSample& Sample)> Visitor)
+{
+    check(IsInGameThread());
+    Collect.Broadcast();
+
+    FScopeLock ScopeLock(&Lock);
+
+    FCardanoMetricSample Sample;
+    for (const TUniquePtr<FFamily>& Family : Families)
+    {
+        Sample.Name = &Family->Name;
+        Sample.Help = &Family->Help;
+        Sample.Type = Family->Type;
+
+        for (const TUniquePtr<FSeries>& Series : Family->Series)
+        {
+            Sample.Labels = &Series->Labels;
+            if (Series->Counter)
+            {
+                Sample.Value = Series->Counter->Get();
+            }
+            else if (Series->Gauge)
+            {
+                Sample.Value = Series->Gauge->Get();
+            }
+            else if (Series->Histogram)
+            {
+                Sample.Bounds = Series->Histogram->GetBounds();
+                Series->Histogram->GetCumulativeCounts(Sample.CumulativeCounts);
+                Sample.Sum = Series->Histogram->GetSum();
+            }
+            Visitor(Sample);
+        }
+    }
+}
+
+FString FCardanoMetrics::ExportPrometheus()
+{
+    FString Text;
+    Text.Reserve(16 * 1024);
+
+    const FString* LastFamily = nullptr;
+    Visit([&Text, &LastFamily](const FCardanoMetricSample& Sample)
+        {
+            if (Sample.Name != LastFamily)
+            {
+                LastFamily = Sample.Name;
+                const TCHAR* Type = Sample.Type == ECardanoMetricType::Counter ? TEXT("counter")
+                    : Sample.Type == ECardanoMetricType::Gauge ? TEXT("gauge") : TEXT("histogram");
+                Text += FString::Printf(TEXT("# HELP %s %s\n# TYPE %s %s\n"), **Sample.Name, *Sample.Help->Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\n"), TEXT("\\n")), **Sample.Name, Type);
+            }
+
+            const FString& Labels = *Sample.Labels;
+            if (Sample.Type != ECardanoMetricType::Histogram)
+            {
+                Text += Labels.IsEmpty()
+                    ? FString::Printf(TEXT("%s %lld\n"), **Sample.Name, Sample.Value)
+                    : FString::Printf(TEXT("%s{%s} %lld\n"), **Sample.Name, *Labels, Sample.Value);
+                return;
+            }
+
+            const FString Separator = Labels.IsEmpty() ? FString() : TEXT(",");
+            for (int32 i = 0; i < Sample.CumulativeCounts.Num(); ++i)
+            {
+                const FString Bound = i < Sample.Bounds.Num() ? FormatNumber(Sample.Bounds[i]) : FString(TEXT("+Inf"));
+                Text += FString::Printf(TEXT("%s_bucket{%s%sle=\"%s\"} %llu\n"), **Sample.Name, *Labels, *Separator, *Bound, Sample.CumulativeCounts[i]);
+            }
+
+            const FString Braced = Labels.IsEmpty() ? FString() : FString::Printf(TEXT("{%s}"), *Labels);
+            Text += FString::Printf(TEXT("%s_sum%s %s\n"), **Sample.Name, *Braced, *FormatNumber(Sample.Sum));
+            Text += FString::Printf(TEXT("%s_count%s %llu\n"), **Sample.Name, *Braced, Sample.CumulativeCounts.Last());
+        });
+
+    return Text;
+}
+
+bool FCardanoMetrics::StartHttpEndpoint(uint32 Port, const FString& Path)
+{
+    StopHttpEndpoint();
+
+    TSharedPtr<IHttpRouter> Router = FHttpServerModule::Get().GetHttpRouter(Port);
+    if (!Router.IsValid())
+    {
+        UE_LOG(LogCardano, Error, TEXT("Metrics endpoint could not create a router on port %u"), Port);
+        return false;
+    }
+
+    FHttpRouteHandle Route = Router->BindRoute(FHttpPath(Path), EHttpServerRequestVerbs::VERB_GET,
+        [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+        {
+            TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(ExportPrometheus(), TEXT("text/plain; version=0.0.4; charset=utf-8"));
+            OnComplete(MoveTemp(Response));
+            return true;
+        });
+
+    if (!Route.IsValid())
+    {
+        UE_LOG(LogCardano, Error, TEXT("Metrics endpoint could not bind %s on port %u"), *Path, Port);
+        return false;
+    }
+
+    HttpEndpoint = MakeUnique<FHttpEndpoint>();
+    HttpEndpoint->Router = Router;
+    HttpEndpoint->Route = Route;
+
+    FHttpServerModule::Get().StartAllListeners();
+    UE_LOG(LogCardano, Log, TEXT("Serving metrics on http://localhost:%u%s"), Port, *Path);
+    return true;
+}
+
+void FCardanoMetrics::StopHttpEndpoint()
+{
+    if (HttpEndpoint.IsValid())
+    {
+        HttpEndpoint->Router->UnbindRoute(HttpEndpoint->Route);
+        HttpEndpoint.Reset();
+    }
+}
@@ -0,0 +1,286 @@
+#include "CardanoMinAda.h"
+#include "Algo/StableSort.h"
+#include <cardano/cardano.h>
+
+namespace
+{
+    /** Constant overhead of the ledger rule: the input and the UTxO map entry, 20 words of 8 bytes. */
+    const int64 MIN_ADA_OVERHEAD = 160;
+
+    const int32 BECH32_CHECKSUM_CHARS = 6;
+    const int32 POLICY_ID_SIZE = 28;
+    const int32 DATUM_HASH_SIZE = 32;
+
+    /** Longest CBOR unsigned integer, which any coin of an output fits in. */
+    const int64 MAX_COIN_SIZE = 9;
+
+    /** Length of a CBOR unsigned integer, or of the header of a string, array or map of that length. */
+    int64 get_uint_size(uint64 Value)
+    {
+        if (Value < 24) return 1;
+        if (Value <= 0xFF) return 2;
+        if (Value <= 0xFFFF) return 3;
+        if (Value <= 0xFFFFFFFFull) return 5;
+        return 9;
+    }
+
+    /**
+     * Size of the output without its coin: a map of up to four entries with one-byte keys, the address as a byte
+     * string, the value as a bare coin or [coin, multi-asset], and the datum as [0, hash] or [1, #6.24(bytes)].
+     */
+    int64 get_size_without_coin(int32 AddressSize, int64 MultiAssetSize, int32 InlineDatumBytes, bool bDatumHash)
+    {
+        int64 Size = 1 + 1 + get_uint_size(AddressSize) + AddressSize + 1;
+
+        if (MultiAssetSize > 0)
+        {
+            Size += 1 + MultiAssetSize;
+        }
+
+        if (InlineDatumBytes > 0)
+        {
+            Size += 1 + 1 + 1 + 2 + get_uint_size(InlineDatumBytes) + InlineDatumBytes;
+        }
+        else if (bDatumHash)
+        {
+            Size += 1 + 1 + 1 + get_uint_size(DATUM_HASH_SIZE) + DATUM_HASH_SIZE;
+        }
+
+        return Size;
+    }
+
+    /** Size of the multi-asset map of Assets, 0 if there are none. */
+    int64 get_multi_asset_size(TArrayView<const FTokenBalance> Assets)
+    {
+        TMap<FString, TMap<FString, uint64>> Policies;
+        for (const FTokenBalance& Asset : Assets)
+        {
+            Policies.FindOrAdd(Asset.PolicyId).FindOrAdd(Asset.AssetName) += FCString::Strtoui64(*Asset.Quantity, nullptr, 10);
+        }
+
+        if (Policies.Num() == 0)
+        {
+            return 0;
+        }
+
+        int64 Size = get_uint_size(Policies.Num());
+        for (const TPair<FString, TMap<FString, uint64>>& Policy : Policies)
+        {
+            Size += get_uint_size(POLICY_ID_SIZE) + POLICY_ID_SIZE + get_uint_size(Policy.Value.Num());
+            for (const TPair<FString, uint64>& Token : Policy.Value)
+            {
+                const int32 NameSize = Token.Key.Len() / 2;
+                Size += get_uint_size(NameSize) + NameSize + get_uint_size(Token.Value);
+            }
+        }
+        return Size;
+    }
+
+    /** Size of a value: a bare coin, or [coin, multi-asset]. */
+    int64 get_value_size(int64 CoinSize, int64 MultiAssetSize)
+    {
+        return MultiAssetSize > 0 ? 1 + CoinSize + MultiAssetSize : CoinSize;
+    }
+
+    /** Tokens packed into one output by FCardanoMinAda::PackAssets. */
+    struct FAssetGroup
+    {
+        /** Tokens of each policy in the group. */
+        TMap<FString, int32> TokenCounts;
+
+        /** Size of the entries of the multi-asset map, without its own header. */
+        int64 EntryBytes = 0;
+
+        TArray<FTokenBalance> Assets;
+
+        /** Entry bytes after adding a token of TokenSize bytes under PolicyId. */
+        int64 GetEntryBytesWith(const FString& PolicyId, int64 TokenSize) const
+        {
+            const int32* Count = TokenCounts.Find(PolicyId);
+            const int64 PolicyDelta = Count
+                ? get_uint_size(*Count + 1) - get_uint_size(*Count)
+                : get_uint_size(POLICY_ID_SIZE) + POLICY_ID_SIZE + get_uint_size(1);
+            return EntryBytes + PolicyDelta + TokenSize;
+        }
+
+        /** Value size after adding the token, with room for any coin. */
+        int64 GetValueSizeWith(const FString& PolicyId, int64 TokenSize) const
+        {
+            const int32 PolicyCount = TokenCounts.Num() + (TokenCounts.Contains(PolicyId) ? 0 : 1);
+            return get_value_size(MAX_COIN_SIZE, get_uint_size(PolicyCount) + GetEntryBytesWith(PolicyId, TokenSize));
+        }
+
+        void Add(const FString& PolicyId, const FString& AssetName, uint64 Quantity, int64 TokenSize)
+        {
+            EntryBytes = GetEntryBytesWith(PolicyId, TokenSize);
+            ++TokenCounts.FindOrAdd(PolicyId);
+
+            FTokenBalance& Asset = Assets.AddDefaulted_GetRef();
+            Asset.PolicyId = PolicyId;
+            Asset.AssetName = AssetName;
+            Asset.Quantity = FString::Printf(TEXT("%llu"), Quantity);
+        }
+    };
+
+    /** Solves min = (overhead + size + coin size of min) * coins per byte, whose coin size depends on min itself. */
+    int64 solve_min_lovelace(int64 CoinsPerUTxOByte, int64 SizeWithoutCoin)
+    {
+        if (CoinsPerUTxOByte <= 0)
+        {
+            return 0;
+        }
+
+        // The coin size only grows with the amount, so this settles within the five CBOR integer sizes
+        int64 CoinSize = 1;
+        int64 MinLovelace = 0;
+        for (int32 i = 0; i < 5; ++i)
+        {
+            MinLovelace = (MIN_ADA_OVERHEAD + SizeWithoutCoin + CoinSize) * CoinsPerUTxOByte;
+            const int64 NewCoinSize = get_uint_size(static_cast<uint64>(MinLovelace));
+            if (NewCoinSize == CoinSize)
+            {
+                break;
+            }
+            CoinSize = NewCoinSize;
+        }
+        return MinLovelace;
+    }
+}
+
+int32 FCardanoMinAda::GetAddressSize(FStringView Address)
+{
+    // Bech32: human-readable part, separator, 5-bit data characters, checksum
+    int32 Separator = INDEX_NONE;
+    if (Address.StartsWith(TEXT("addr")) && Address.FindLastChar(TEXT('1'), Separator))
+    {
+        const int32 DataChars = Address.Len() - Separator - 1 - BECH32_CHECKSUM_CHARS;
+        return DataChars > 0 ? DataChars * 5 / 8 : -1;
+    }
+
+    // Byron addresses are rare enough that decoding them is fine
+    const FTCHARToUTF8 Utf8(Address.GetData(), Address.Len());
+    cardano_address_t* address = nullptr;
+    if (cardano_address_from_string(Utf8.Get(), Utf8.Length(), &address) != CARDANO_SUCCESS)
+    {
+        return -1;
+    }
+
+    const int32 Size = static_cast<int32>(cardano_address_get_bytes_size(address));
+    cardano_address_unref(&address);
+    return Size;
+}
+
+int32 FCardanoMinAda::GetAddressSize(ECardanoOutputAddressType AddressType)
+{
+    return AddressType == ECardanoOutputAddressType::Base ? 1 + 2 * POLICY_ID_SIZE : 1 + POLICY_ID_SIZE;
+}
+
+int64 FCardanoMinAda::GetOutputSize(int32 AddressSize, int64 Lovelace, const TArray<FTokenBalance>& Assets, int32 InlineDatumBytes, bool bDatumHash)
+{
+    return get_size_without_coin(AddressSize, get_multi_asset_size(Assets), InlineDatumBytes, bDatumHash) +
+        get_uint_size(static_cast<uint64>(FMath::Max<int64>(Lovelace, 0)));
+}
+
+int64 FCardanoMinAda::GetMinLovelace(int64 CoinsPerUTxOByte, int32 AddressSize, TArrayView<const FTokenBalance> Assets, int32 InlineDatumBytes, bool bDatumHash)
+{
+    return solve_min_lovelace(CoinsPerUTxOByte, get_size_without_coin(AddressSize, get_multi_asset_size(Assets), InlineDatumBytes, bDatumHash));
+}
+
+int64 FCardanoMinAda::GetMinLovelace(int64 CoinsPerUTxOByte, const FCardanoOutputShape& Shape)
+{
+    int64 MultiAssetSize = 0;
+    if (Shape.PolicyCount > 0 && Shape.AssetCount > 0)
+    {
+        const int32 AssetsPerPolicy = FMath::DivideAndRoundUp(Shape.AssetCount, Shape.PolicyCount);
+        MultiAssetSize = get_uint_size(Shape.PolicyCount) +
+            Shape.PolicyCount * (get_uint_size(POLICY_ID_SIZE) + POLICY_ID_SIZE + get_uint_size(AssetsPerPolicy)) +
+            Shape.AssetCount * (1 + get_uint_size(static_cast<uint64>(FMath::Max<int64>(Shape.MaxQuantity, 0)))) +
+            FMath::Max(Shape.AssetNameBytes, 0);
+    }
+
+    return solve_min_lovelace(CoinsPerUTxOByte,
+        get_size_without_coin(GetAddressSize(Shape.AddressType), MultiAssetSize, Shape.InlineDatumBytes, Shape.bDatumHash));
+}
+
+int64 FCardanoMinAda::GetValueSize(int64 Lovelace, const TArray<FTokenBalance>& Assets)
+{
+    return get_value_size(get_uint_size(static_cast<uint64>(FMath::Max<int64>(Lovelace, 0))), get_multi_asset_size(Assets));
+}
+
+void FCardanoMinAda::PackAssets(TArrayView<const FTokenBalance> Assets, int64 MaxValueSize, TArray<TArray<FTokenBalance>>& OutGroups)
+{
+    OutGroups.Reset();
+
+    // Summed as get_multi_asset_size does, in the order the tokens are first seen
+    TMap<FString, TMap<FString, uint64>> Policies;
+    for (const FTokenBalance& Asset : Assets)
+    {
+        Policies.FindOrAdd(Asset.PolicyId).FindOrAdd(Asset.AssetName) += FCString::Strtoui64(*Asset.Quantity, nullptr, 10);
+    }
+
+    if (Policies.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<const TPair<FString, TMap<FString, uint64>>*> Order;
+    for (const TPair<FString, TMap<FString, uint64>>& Policy : Policies)
+    {
+        Order.Add(&Policy);
+    }
+    Algo::StableSort(Order, [](const TPair<FString, TMap<FString, uint64>>* A, const TPair<FString, TMap<FString, uint64>>* B)
+        {
+            return A->Value.Num() > B->Value.Num();
+        });
+
+    const int64 Budget = MaxValueSize > 0 ? MaxValueSize : MAX_int64;
+    TArray<FAssetGroup> Groups;
+
+    for (const TPair<FString, TMap<FString, uint64>>* Policy : Order)
+    {
+        const FString& PolicyId = Policy->Key;
+
+        // Size of the whole policy entry, to keep it in one group when some group has room for it
+        int64 PolicyBytes = get_uint_size(POLICY_ID_SIZE) + POLICY_ID_SIZE + get_uint_size(Policy->Value.Num());
+        for (const TPair<FString, uint64>& Token : Policy->Value)
+        {
+            const int32 NameSize = Token.Key.Len() / 2;
+            PolicyBytes += get_uint_size(NameSize) + NameSize + get_uint_size(Token.Value);
+        }
+
+        int32 Target = Groups.IndexOfByPredicate([&](const FAssetGroup& Group)
+            {
+                return get_value_size(MAX_COIN_SIZE, get_uint_size(Group.TokenCounts.Num() + 1) + Group.EntryBytes + PolicyBytes) <= Budget;
+            });
+
+        for (const TPair<FString, uint64>& Token : Policy->Value)
+        {
+            const int32 NameSize = Token.Key.Len() / 2;
+            const int64 TokenSize = get_uint_size(NameSize) + NameSize + get_uint_size(Token.Value);
+
+            // A policy that fits nowhere whole is spread over the first groups with room, then new ones
+            if (Target == INDEX_NONE || Groups[Target].GetValueSizeWith(PolicyId, TokenSize) > Budget)
+            {
+                Target = Groups.IndexOfByPredicate([&](const FAssetGroup& Group) { return Group.GetValueSizeWith(PolicyId, TokenSize) <= Budget; });
+                if (Target == INDEX_NONE)
+                {
+                    Target = Groups.AddDefaulted();
+                }
+            }
+
+            Groups[Target].Add(PolicyId, Token.Key, Token.Value, TokenSize);
+        }
+    }
+
+    OutGroups.Reserve(Groups.Num());
+    for (FAssetGroup& Group : Groups)
+    {
+        OutGroups.Add(MoveTemp(Group.Assets));
+    }
+}
+
+int64 UCardanoMinAdaLibrary::GetMinLovelaceForOutput(const FString& Address, const TArray<FTokenBalance>& Assets, int64 CoinsPerUTxOByte, int32 InlineDatumBytes)
+{
+    const int32 AddressSize = FCardanoMinAda::GetAddressSize(Address);
+    return AddressSize > 0 ? FCardanoMinAda::GetMinLovelace(CoinsPerUTxOByte, AddressSize, Assets, InlineDatumBytes) : 0;
+}
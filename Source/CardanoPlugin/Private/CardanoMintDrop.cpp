@@ -0,0 +1,282 @@
+#include "CardanoMintDrop.h"
+#include "CardanoChainTip.h"
+#include "CardanoHash.h"
+#include "CardanoLog.h"
+#include "CardanoSigningPipeline.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "Async/Async.h"
+
+// Validity window given to the transactions when the plan has none, in slots past the tip
+static const int64 MINT_DROP_TTL_SLOTS = 7200;
+
+UCardanoMintDrop* UCardanoMintDrop::Start(const FCardanoMintDropConfig& Config, FString& OutError)
+{
+    check(IsInGameThread());
+
+    if (Config.Items.Num() == 0)
+    {
+        OutError = TEXT("A mint drop needs at least one item");
+        return nullptr;
+    }
+
+    if (!Config.KeyHandler || Config.DerivationPaths.Num() == 0)
+    {
+        OutError = TEXT("A mint drop needs a key handler and the derivation paths of its signing keys");
+        return nullptr;
+    }
+
+    // Every wave shares one TTL, resolved here since the workers cannot read the chain tip
+    int64 InvalidAfter = Config.Plan.InvalidAfter;
+    if (InvalidAfter <= 0)
+    {
+        UCardanoChainTip* ChainTip = UCardanoChainTip::Get();
+        InvalidAfter = ChainTip ? ChainTip->GetTimeToLive(MINT_DROP_TTL_SLOTS) : 0;
+        if (InvalidAfter <= 0)
+        {
+            OutError = TEXT("Unable to compute a TTL for the transactions");
+            return nullptr;
+        }
+    }
+
+    UCardanoMintDrop* Drop = NewObject<UCardanoMintDrop>();
+    Drop->AddToRoot();
+    Drop->Config = Config;
+    Drop->Config.Plan.InvalidAfter = InvalidAfter;
+    Drop->Config.Plan.Payments.Reset();
+    cardano_secure_key_handler_ref(Drop->Config.KeyHandler);
+
+    Drop->Progress.TotalItems = Config.Items.Num();
+    Drop->ItemTxHashes.SetNum(Config.Items.Num());
+
+    TArray<int32> ItemIndices;
+    ItemIndices.Reserve(Config.Items.Num());
+    for (int32 Index = 0; Index < Config.Items.Num(); ++Index)
+    {
+        ItemIndices.Add(Index);
+    }
+
+    UE_LOG(LogCardano, Log, TEXT("Starting a mint drop of %d tokens funded by %d UTxOs"), Config.Items.Num(), Config.Plan.UTxOs.Num());
+    Drop->RunWave(Config.Plan.UTxOs, MoveTemp(ItemIndices));
+    return Drop;
+}
+
+void UCardanoMintDrop::BeginDestroy()
+{
+    ReleaseKeyHandler();
+    Super::BeginDestroy();
+}
+
+void UCardanoMintDrop::ReleaseKeyHandler()
+{
+    cardano_secure_key_handler_unref(&Config.KeyHandler);
+    Config.KeyHandler = nullptr;
+}
+
+void UCardanoMintDrop::RunWave(TArray<FUTxO> UTxOs, TArray<int32> ItemIndices)
+{
+    FCardanoTxPlan Plan = Config.Plan;
+    Plan.UTxOs = MoveTemp(UTxOs);
+
+    TArray<FCardanoMintItem> Items;
+    Items.Reserve(ItemIndices.Num());
+    for (const int32 Index : ItemIndices)
+    {
+        Items.Add(Config.Items[Index]);
+    }
+
+    // Waves run one after the other, so the key handler is never used by two workers at once
+    TWeakObjectPtr<UCardanoMintDrop> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Plan = MoveTemp(Plan), Items = MoveTemp(Items), ItemIndices = MoveTemp(ItemIndices),
+        PolicyScriptJson = Config.PolicyScriptJson, Options = Config.Options, KeyHandler = Config.KeyHandler, DerivationPaths = Config.DerivationPaths]()
+        {
+            TArray<FCardanoMintTransaction> Transactions;
+            TArray<FSignedMint> Signed;
+            TArray<int32> Retry;
+            TArray<int32> Failed;
+            TArray<FUTxO> NextUTxOs;
+            FString Error;
+
+            if (!FCardanoTxPlanner::BuildMintDrop(Plan, PolicyScriptJson, Items, Options, Transactions, Error))
+            {
+                Failed = ItemIndices;
+            }
+
+            TArray<TArray<uint8>> Unsigned;
+            for (FCardanoMintTransaction& Transaction : Transactions)
+            {
+                TArray<int32> Indices;
+                for (const int32 Local : Transaction.ItemIndices)
+                {
+                    Indices.Add(ItemIndices[Local]);
+                }
+
+                if (Transaction.bSuccess)
+                {
+                    FSignedMint& Mint = Signed.AddDefaulted_GetRef();
+                    Mint.ItemIndices = MoveTemp(Indices);
+                    Mint.Fee = Transaction.Fee;
+                    Unsigned.Add(MoveTemp(Transaction.Transaction));
+                }
+                else if (Transaction.bInsufficientFunds)
+                {
+                    Retry.Append(Indices);
+                }
+                else
+                {
+                    Failed.Append(Indices);
+                    Error = Transaction.Error;
+                }
+            }
+
+            TArray<TArray<uint8>> SignedTransactions;
+            if (Unsigned.Num() > 0 && !FCardanoSigningPipeline::SignTransactions(KeyHandler, Unsigned, DerivationPaths, SignedTransactions, Error))
+            {
+                for (const FSignedMint& Mint : Signed)
+                {
+                    Failed.Append(Mint.ItemIndices);
+                }
+                Signed.Reset();
+            }
+
+            // The next wave spends what this one left: the UTxOs it did not take, and the change it sends back
+            TSet<FCardanoUTxORef> Spent;
+            for (int32 i = 0; i < Signed.Num(); ++i)
+            {
+                Signed[i].Transaction = MoveTemp(SignedTransactions[i]);
+
+                TArray<FCardanoUTxORef> SpentKeys;
+                TArray<TPair<FString, FUTxO>> Outputs;
+                if (!decode_transaction_utxos(Signed[i].Transaction, Signed[i].TxHash, SpentKeys, Outputs))
+                {
+                    continue;
+                }
+
+                Spent.Append(SpentKeys);
+                for (TPair<FString, FUTxO>& Output : Outputs)
+                {
+                    if (Output.Key == Plan.OwnerAddress)
+                    {
+                        NextUTxOs.Add(MoveTemp(Output.Value));
+                    }
+                }
+            }
+
+            for (const FUTxO& UTxO : Plan.UTxOs)
+            {
+                FCardanoUTxORef Ref;
+                Ref.TxIndex = static_cast<uint32>(UTxO.TxIndex);
+                if (FCardanoHash32::FromHex(UTxO.TxHash, Ref.TxHash) && !Spent.Contains(Ref))
+                {
+                    NextUTxOs.Add(UTxO);
+                }
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Signed = MoveTemp(Signed), Retry = MoveTemp(Retry), Failed = MoveTemp(Failed),
+                Error = MoveTemp(Error), NextUTxOs = MoveTemp(NextUTxOs)]() mutable
+                {
+                    if (UCardanoMintDrop* This = WeakThis.Get())
+                    {
+                        This->OnWaveSigned(MoveTemp(Signed), MoveTemp(Retry), MoveTemp(Failed), MoveTemp(Error), MoveTemp(NextUTxOs));
+                    }
+                });
+        });
+}
+
+void UCardanoMintDrop::OnWaveSigned(TArray<FSignedMint> Signed, TArray<int32> Retry, TArray<int32> Failed, FString Error, TArray<FUTxO> NextUTxOs)
+{
+    if (Failed.Num() > 0)
+    {
+        FailItems(Failed.Num(), Error);
+    }
+
+    UCardanoSubmissionQueue* Queue = UCardanoSubmissionQueue::Get();
+    int32 Queued = 0;
+
+    for (FSignedMint& Mint : Signed)
+    {
+        if (!Queue || Mint.TxHash.IsEmpty())
+        {
+            FailItems(Mint.ItemIndices.Num(), Queue ? TEXT("Failed to decode a signed transaction") : TEXT("Submission queue is not available"));
+            continue;
+        }
+
+        // Recorded before queuing: the queue may report a rejection before Enqueue returns
+        const FString TxHash = Mint.TxHash.ToLower();
+        for (const int32 Index : Mint.ItemIndices)
+        {
+            ItemTxHashes[Index] = TxHash;
+        }
+        Progress.QueuedItems += Mint.ItemIndices.Num();
+        Progress.QueuedTransactions += 1;
+        Progress.TotalFee += Mint.Fee;
+        PendingItems.Add(TxHash, MoveTemp(Mint.ItemIndices));
+        ++Queued;
+
+        FOnTransactionTracked OnTracked;
+        OnTracked.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UCardanoMintDrop, OnTransactionTracked));
+        Queue->Enqueue(Mint.Transaction, OnTracked);
+    }
+
+    if (Retry.Num() > 0)
+    {
+        // Without a transaction queued in this wave, there is no new change to fund the next one
+        if (Queued > 0)
+        {
+            UE_LOG(LogCardano, Log, TEXT("Mint drop: %d tokens queued, %d left for the next wave"), Progress.QueuedItems, Retry.Num());
+            RunWave(MoveTemp(NextUTxOs), MoveTemp(Retry));
+        }
+        else
+        {
+            FailItems(Retry.Num(), TEXT("Insufficient funds for the remaining tokens"));
+        }
+    }
+
+    UpdateProgress();
+}
+
+void UCardanoMintDrop::OnTransactionTracked(ECardanoTxOutcome Outcome, ECardanoSubmitError Error, const FString& TxHash, const FString& ErrorMessage)
+{
+    TArray<int32> Items;
+    if (!PendingItems.RemoveAndCopyValue(TxHash.ToLower(), Items))
+    {
+        return;
+    }
+
+    if (Outcome == ECardanoTxOutcome::Confirmed)
+    {
+        Progress.ConfirmedItems += Items.Num();
+        Progress.ConfirmedTransactions += 1;
+    }
+    else
+    {
+        FailItems(Items.Num(), ErrorMessage.IsEmpty() ? FString::Printf(TEXT("Transaction %s timed out"), *TxHash) : ErrorMessage);
+    }
+
+    UpdateProgress();
+}
+
+void UCardanoMintDrop::FailItems(int32 Count, const FString& Error)
+{
+    Progress.FailedItems += Count;
+    Progress.LastError = Error;
+    UE_LOG(LogCardano, Warning, TEXT("Mint drop: %d tokens failed: %s"), Count, *Error);
+}
+
+void UCardanoMintDrop::UpdateProgress()
+{
+    OnProgress.Broadcast(Progress);
+
+    if (bFinished || Progress.ConfirmedItems + Progress.FailedItems < Progress.TotalItems)
+    {
+        return;
+    }
+
+    bFinished = true;
+    ReleaseKeyHandler();
+
+    UE_LOG(LogCardano, Log, TEXT("Mint drop finished: %d of %d tokens confirmed in %d transactions, %lld lovelace of fees"),
+        Progress.ConfirmedItems, Progress.TotalItems, Progress.ConfirmedTransactions, Progress.TotalFee);
+
+    OnComplete.Broadcast(Progress);
+    RemoveFromRoot();
+}
@@ -0,0 +1,123 @@
+#include "CardanoMnemonic.h"
+#include "CardanoLog.h"
+#include <cardano/bip39.h>
+#include <cardano/error.h>
+#include <sodium.h>
+
+/** The passphrase get_scoped_passphrase hands out to the key handler running on this thread, if any. */
+static thread_local const FCardanoScopedPassphrase* GActivePassphrase = nullptr;
+
+FCardanoMnemonicWords::FCardanoMnemonicWords(TArrayView<const FString> MnemonicWords)
+{
+    FMemory::Memzero(Words, sizeof(Words));
+
+    if (MnemonicWords.Num() > MaxWords)
+    {
+        return;
+    }
+
+    int32 Offset = 0;
+    for (const FString& Word : MnemonicWords)
+    {
+        // Same sanitizing as TrimStartAndEnd().ToLower() followed by a printable-ASCII filter, with no temporaries
+        int32 Start = 0;
+        int32 End = Word.Len();
+        while (Start < End && FChar::IsWhitespace(Word[Start]))
+        {
+            ++Start;
+        }
+        while (End > Start && FChar::IsWhitespace(Word[End - 1]))
+        {
+            --End;
+        }
+
+        // The filter only drops characters, so the trimmed length bounds what is written
+        if (Offset + (End - Start) + 1 > BufferSize)
+        {
+            Count = 0;
+            FMemory::Memzero(Words, sizeof(Words));
+            return;
+        }
+
+        Words[Count++] = &Buffer[Offset];
+        for (int32 i = Start; i < End; ++i)
+        {
+            const TCHAR Character = FChar::ToLower(Word[i]);
+            if (Character >= 32 && Character <= 126)
+            {
+                Buffer[Offset++] = static_cast<ANSICHAR>(Character);
+            }
+        }
+        Buffer[Offset++] = '\0';
+    }
+
+    bValid = true;
+}
+
+FCardanoMnemonicWords::~FCardanoMnemonicWords()
+{
+    sodium_memzero(Buffer, sizeof(Buffer));
+}
+
+bool mnemonic_to_entropy(TArrayView<const FString> MnemonicWords, byte_t* entropy, size_t entropy_capacity, size_t* entropy_size)
+{
+    if (MnemonicWords.Num() != 24) {
+        UE_LOG(LogCardano, Error, TEXT("Invalid mnemonic word count. Expected 24, got %d"), MnemonicWords.Num());
+        return false;
+    }
+
+    FCardanoMnemonicWords Words(MnemonicWords);
+    if (!Words.IsValid()) {
+        UE_LOG(LogCardano, Error, TEXT("Mnemonic words are too long"));
+        return false;
+    }
+
+    cardano_error_t result = cardano_bip39_mnemonic_words_to_entropy(
+        Words.GetWords(),
+        Words.Num(),
+        entropy,
+        entropy_capacity,
+        entropy_size
+    );
+
+    if (result != CARDANO_SUCCESS) {
+        UE_LOG(LogCardano, Error, TEXT("Failed to convert mnemonic to entropy: %s"),
+            UTF8_TO_TCHAR(cardano_error_to_string(result)));
+        return false;
+    }
+
+    return true;
+}
+
+FCardanoScopedPassphrase::FCardanoScopedPassphrase(FStringView Password)
+    : PreviousPassphrase(GActivePassphrase)
+{
+    const FStringView Trimmed = Password.TrimStartAndEnd();
+    const FTCHARToUTF8 Utf8(Trimmed.GetData(), Trimmed.Len());
+    if (Utf8.Length() <= MaxLength)
+    {
+        Length = Utf8.Length();
+        FMemory::Memcpy(Bytes, Utf8.Get(), Length);
+    }
+
+    // The converter's own buffer, inline or on the heap for long passwords, is wiped before it is released
+    sodium_memzero(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+    GActivePassphrase = this;
+}
+
+FCardanoScopedPassphrase::~FCardanoScopedPassphrase()
+{
+    GActivePassphrase = PreviousPassphrase;
+    sodium_memzero(Bytes, sizeof(Bytes));
+}
+
+int32_t get_scoped_passphrase(byte_t* buffer, size_t buffer_len)
+{
+    if (!GActivePassphrase || buffer_len < GActivePassphrase->Num())
+    {
+        return -1;
+    }
+
+    FMemory::Memcpy(buffer, GActivePassphrase->GetData(), GActivePassphrase->Num());
+    return static_cast<int32_t>(GActivePassphrase->Num());
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "Containers/StringView.h"
+#include <cardano/typedefs.h>
+
+/**
+ * Mnemonic words in the form the cardano-c BIP-39 functions take, converted without touching the heap. Each word is
+ * trimmed, lower-cased and stripped of non-printable and non-ASCII characters, then written into one UTF-8 buffer that
+ * lives with the object, typically on the stack, and is wiped when it goes out of scope. GetWords points into it.
+ */
+class FCardanoMnemonicWords
+{
+public:
+    static constexpr int32 MaxWords = 24;
+
+    /** Room for 24 words far longer than any BIP-39 word, with their terminators. */
+    static constexpr int32 BufferSize = 512;
+
+    explicit FCardanoMnemonicWords(TArrayView<const FString> MnemonicWords);
+    ~FCardanoMnemonicWords();
+
+    FCardanoMnemonicWords(const FCardanoMnemonicWords&) = delete;
+    FCardanoMnemonicWords& operator=(const FCardanoMnemonicWords&) = delete;
+
+    /** False if there were more than MaxWords words or they did not fit the buffer; GetWords is then empty. */
+    bool IsValid() const { return bValid; }
+
+    const char** GetWords() { return Words; }
+    int32 Num() const { return Count; }
+
+private:
+    ANSICHAR Buffer[BufferSize];
+    const char* Words[MaxWords];
+    int32 Count = 0;
+    bool bValid = false;
+};
+
+/** Converts a 24-word mnemonic to its entropy, logging why it failed if it does. */
+bool mnemonic_to_entropy(TArrayView<const FString> MnemonicWords, byte_t* entropy, size_t entropy_capacity, size_t* entropy_size);
+
+/**
+ * Makes Password, trimmed, the passphrase of the key handler calls made on this thread within the scope, and wipes it
+ * afterwards. The software key handler asks for the passphrase through a callback without context, so this is how
+ * wallets with different passwords share get_scoped_passphrase without any of them being stored.
+ * The UTF-8 bytes are kept in a buffer inside the object rather than on the heap, like FCardanoMnemonicWords.
+ */
+class FCardanoScopedPassphrase
+{
+public:
+    /** The most the software key handler reads; a longer password is treated as empty, so it is rejected. */
+    static constexpr int32 MaxLength = 128;
+
+    explicit FCardanoScopedPassphrase(FStringView Password);
+    ~FCardanoScopedPassphrase();
+
+    FCardanoScopedPassphrase(const FCardanoScopedPassphrase&) = delete;
+    FCardanoScopedPassphrase& operator=(const FCardanoScopedPassphrase&) = delete;
+
+    const byte_t* GetData() const { return Bytes; }
+    size_t Num() const { return static_cast<size_t>(Length); }
+
+private:
+    uint8 Bytes[MaxLength];
+    int32 Length = 0;
+    const FCardanoScopedPassphrase* PreviousPassphrase = nullptr;
+};
+
+/** Passphrase callback of software key handlers, handing out the one of the innermost FCardanoScopedPassphrase. */
+int32_t get_scoped_passphrase(byte_t* buffer, size_t buffer_len);
@@ -0,0 +1,271 @@
+#include "CardanoMockKoiosServer.h"
+#include "CardanoLog.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "HttpPath.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
+#include "Math/RandomStream.h"
+#include "Misc/DateTime.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include <sodium.h>
+
+// Unix time of mainnet slot 0 in the Shelley slot numbering Koios reports
+static const int64 MAINNET_SLOT_ZERO_UNIX_TIME = 1591566291;
+
+namespace
+{
+    using FCondensedWriter = TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+    using FCondensedWriterFactory = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+
+    /** Reads the `_addresses` array of a request body; unknown or malformed bodies yield no addresses. */
+    TArray<FString> read_addresses(const TArray<uint8>& RequestBody)
+    {
+        FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(RequestBody.GetData()), RequestBody.Num());
+        const FString Json(Converter.Length(), Converter.Get());
+
+        TArray<FString> Addresses;
+        TSharedPtr<FJsonObject> Object;
+        const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+        if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Object) && Object.IsValid() &&
+            Object->TryGetArrayField(TEXT("_addresses"), Values))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *Values)
+            {
+                Addresses.Add(Value->AsString());
+            }
+        }
+        return Addresses;
+    }
+
+    FString make_tip_body()
+    {
+        const int64 Now = FDateTime::UtcNow().ToUnixTimestamp();
+
+        FString Body;
+        TSharedRef<FCondensedWriter> Writer = FCondensedWriterFactory::Create(&Body);
+        Writer->WriteArrayStart();
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("abs_slot"), Now - MAINNET_SLOT_ZERO_UNIX_TIME);
+        Writer->WriteValue(TEXT("block_time"), Now);
+        Writer->WriteValue(TEXT("block_no"), (Now - MAINNET_SLOT_ZERO_UNIX_TIME) / 20);
+        Writer->WriteObjectEnd();
+        Writer->WriteArrayEnd();
+        Writer->Close();
+        return Body;
+    }
+
+    /** Mainnet values as of the Conway era, in the field names and types Koios uses. */
+    FString make_epoch_params_body()
+    {
+        FString Body;
+        TSharedRef<FCondensedWriter> Writer = FCondensedWriterFactory::Create(&Body);
+        Writer->WriteArrayStart();
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("epoch_no"), 500);
+        Writer->WriteValue(TEXT("min_fee_a"), 44);
+        Writer->WriteValue(TEXT("min_fee_b"), 155381);
+        Writer->WriteValue(TEXT("max_tx_size"), 16384);
+        Writer->WriteValue(TEXT("max_val_size"), 5000);
+        Writer->WriteValue(TEXT("key_deposit"), TEXT("2000000"));
+        Writer->WriteValue(TEXT("pool_deposit"), TEXT("500000000"));
+        Writer->WriteValue(TEXT("drep_deposit"), TEXT("500000000"));
+        Writer->WriteValue(TEXT("gov_action_deposit"), TEXT("100000000000"));
+        Writer->WriteValue(TEXT("coins_per_utxo_size"), TEXT("4310"));
+        Writer->WriteValue(TEXT("price_mem"), 0.0577);
+        Writer->WriteValue(TEXT("price_step"), 0.0000721);
+        Writer->WriteValue(TEXT("min_fee_ref_script_cost_per_byte"), 15);
+        Writer->WriteValue(TEXT("collateral_percent"), 150);
+        Writer->WriteValue(TEXT("max_collateral_inputs"), 3);
+        Writer->WriteValue(TEXT("protocol_major"), 10);
+        Writer->WriteValue(TEXT("protocol_minor"), 0);
+        Writer->WriteObjectEnd();
+        Writer->WriteArrayEnd();
+        Writer->Close();
+        return Body;
+    }
+
+    /** Answers submittx like Koios, with the transaction id as a JSON string; here a hash of the whole CBOR. */
+    FString make_submit_body(const TArray<uint8>& RequestBody)
+    {
+        uint8 Hash[32];
+        crypto_generichash(Hash, sizeof(Hash), RequestBody.GetData(), RequestBody.Num(), nullptr, 0);
+        return FString::Printf(TEXT("\"%s\""), *BytesToHex(Hash, sizeof(Hash)).ToLower());
+    }
+}
+
+FCardanoMockKoiosServer::~FCardanoMockKoiosServer()
+{
+    Stop();
+}
+
+bool FCardanoMockKoiosServer::Start(uint32 InPort, float InLatencySeconds, int32 InUTxOsPerAddress)
+{
+    Stop();
+
+    Port = InPort;
+    LatencySeconds = FMath::Max(InLatencySeconds, 0.0f);
+    UTxOsPerAddress = FMath::Max(InUTxOsPerAddress, 1);
+    RequestsServed = 0;
+
+    Router = FHttpServerModule::Get().GetHttpRouter(Port);
+    if (!Router.IsValid())
+    {
+        UE_LOG(LogCardano, Error, TEXT("Mock Koios server could not create a router on port %u"), Port);
+        return false;
+    }
+
+    Bind(TEXT("/api/v1/address_info"), EHttpServerRequestVerbs::VERB_POST, EHttpServerResponseCodes::Ok,
+        [this](const TArray<uint8>& RequestBody) { return MakeAddressInfoBody(RequestBody); });
+    Bind(TEXT("/api/v1/address_utxos"), EHttpServerRequestVerbs::VERB_POST, EHttpServerResponseCodes::Ok,
+        [this](const TArray<uint8>& RequestBody) { return MakeAddressUTxOsBody(RequestBody); });
+    Bind(TEXT("/api/v1/tip"), EHttpServerRequestVerbs::VERB_GET, EHttpServerResponseCodes::Ok,
+        [](const TArray<uint8>&) { return make_tip_body(); });
+    Bind(TEXT("/api/v1/epoch_params"), EHttpServerRequestVerbs::VERB_GET, EHttpServerResponseCodes::Ok,
+        [](const TArray<uint8>&) { return make_epoch_params_body(); });
+    Bind(TEXT("/api/v1/submittx"), EHttpServerRequestVerbs::VERB_POST, EHttpServerResponseCodes::Accepted,
+        [](const TArray<uint8>& RequestBody) { return make_submit_body(RequestBody); });
+
+    FHttpServerModule::Get().StartAllListeners();
+    UE_LOG(LogCardano, Log, TEXT("Mock Koios server listening on %s"), *GetBaseUrl());
+    return true;
+}
+
+void FCardanoMockKoiosServer::Stop()
+{
+    if (Router.IsValid())
+    {
+        for (const FHttpRouteHandle& Route : Routes)
+        {
+            Router->UnbindRoute(Route);
+        }
+    }
+
+    // The listener itself stays up; other users of the HTTPServer module may share it
+    Routes.Reset();
+    Router.Reset();
+}
+
+FString FCardanoMockKoiosServer::GetBaseUrl() const
+{
+    return FString::Printf(TEXT("http://localhost:%u/api/v1"), Port);
+}
+
+void FCardanoMockKoiosServer::Bind(const TCHAR* Path, EHttpServerRequestVerbs Verb, EHttpServerResponseCodes Code, TFunction<FString(const TArray<uint8>&)> MakeBody)
+{
+    const float Latency = LatencySeconds;
+    FHttpRouteHandle Route = Router->BindRoute(FHttpPath(Path), Verb,
+        [this, MakeBody, Code, Latency](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+        {
+            RequestsServed++;
+            FString Body = MakeBody(Request.Body);
+
+            auto Send = [Body = MoveTemp(Body), Code, OnComplete]()
+            {
+                TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(Body, TEXT("application/json"));
+                Response->Code = Code;
+                OnComplete(MoveTemp(Response));
+            };
+
+            if (Latency <= 0.0f)
+            {
+                Send();
+                return true;
+            }
+
+            // The HTTPServer module keeps the connection open until OnComplete runs
+            FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Send](float)
+                {
+                    Send();
+                    return false;
+                }), Latency);
+            return true;
+        });
+
+    if (Route.IsValid())
+    {
+        Routes.Add(Route);
+    }
+    else
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Mock Koios server could not bind %s"), Path);
+    }
+}
+
+TArray<FUTxO> FCardanoMockKoiosServer::MakeUTxOs(const FString& Address, int32 Count)
+{
+    // One transaction per address, so the same address always gets the same outputs
+    FRandomStream Stream(static_cast<int32>(GetTypeHash(Address)));
+    uint8 TxHash[32];
+    for (uint8& Byte : TxHash)
+    {
+        Byte = static_cast<uint8>(Stream.RandRange(0, 255));
+    }
+    const FString TxHashHex = BytesToHex(TxHash, sizeof(TxHash)).ToLower();
+
+    TArray<FUTxO> UTxOs;
+    UTxOs.Reserve(Count);
+    for (int32 i = 0; i < Count; i++)
+    {
+        FUTxO& UTxO = UTxOs.AddDefaulted_GetRef();
+        UTxO.TxHash = TxHashHex;
+        UTxO.TxIndex = i;
+        UTxO.Value = UTxOLovelace;
+    }
+    return UTxOs;
+}
+
+FString FCardanoMockKoiosServer::MakeAddressInfoBody(const TArray<uint8>& RequestBody) const
+{
+    FString Body;
+    TSharedRef<FCondensedWriter> Writer = FCondensedWriterFactory::Create(&Body);
+    Writer->WriteArrayStart();
+    for (const FString& Address : read_addresses(RequestBody))
+    {
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("address"), Address);
+        Writer->WriteValue(TEXT("balance"), LexToString(UTxOLovelace * UTxOsPerAddress));
+        Writer->WriteValue(TEXT("script_address"), false);
+        Writer->WriteArrayStart(TEXT("utxo_set"));
+        Writer->WriteArrayEnd();
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteArrayEnd();
+    Writer->Close();
+    return Body;
+}
+
+FString FCardanoMockKoiosServer::MakeAddressUTxOsBody(const TArray<uint8>& RequestBody) const
+{
+    return MakeAddressUTxOsResponse(read_addresses(RequestBody), UTxOsPerAddress);
+}
+
+FString FCardanoMockKoiosServer::MakeAddressUTxOsResponse(const TArray<FString>& Addresses, int32 UTxOsPerAddress)
+{
+    FString Body;
+    TSharedRef<FCondensedWriter> Writer = FCondensedWriterFactory::Create(&Body);
+    Writer->WriteArrayStart();
+    for (const FString& Address : Addresses)
+    {
+        for (const FUTxO& UTxO : MakeUTxOs(Address, UTxOsPerAddress))
+        {
+            Writer->WriteObjectStart();
+            Writer->WriteValue(TEXT("tx_hash"), UTxO.TxHash);
+            Writer->WriteValue(TEXT("tx_index"), UTxO.TxIndex);
+            Writer->WriteValue(TEXT("address"), Address);
+            Writer->WriteValue(TEXT("value"), LexToString(UTxO.Value));
+            Writer->WriteValue(TEXT("is_spent"), false);
+            Writer->WriteArrayStart(TEXT("asset_list"));
+            Writer->WriteArrayEnd();
+            Writer->WriteObjectEnd();
+        }
+    }
+    Writer->WriteArrayEnd();
+    Writer->Close();
+    return Body;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HttpRouteHandle.h"
+#include "HttpServerConstants.h"
+#include "CardanoTypes.h"
+
+class IHttpRouter;
+
+/**
+ * In-process stand-in for the Koios endpoints the plugin's wallet loop uses (address_info, address_utxos, tip,
+ * epoch_params and submittx), served on localhost by the engine's HTTPServer module.
+ *
+ * Every address owns the same synthetic UTxOs, so transactions can be built and signed without funding anything;
+ * submitted transactions are accepted without validation and do not change the UTxOs. Responses are delayed by
+ * LatencySeconds to approximate a remote instance. Must be started, used and stopped on the game thread.
+ */
+class FCardanoMockKoiosServer
+{
+public:
+    ~FCardanoMockKoiosServer();
+
+    /** Binds the routes on Port and starts listening; returns false if the router could not be created. */
+    bool Start(uint32 InPort, float InLatencySeconds, int32 InUTxOsPerAddress);
+
+    void Stop();
+
+    /** Base URL to point UCardanoKoiosClient at, e.g. http://localhost:8089/api/v1. */
+    FString GetBaseUrl() const;
+
+    /** Requests answered since Start. */
+    int64 GetRequestsServed() const { return RequestsServed; }
+
+    /** The UTxOs the server reports for Address; the load test also builds on them when a real endpoint has none. */
+    static TArray<FUTxO> MakeUTxOs(const FString& Address, int32 Count);
+
+    /** The address_utxos response for Addresses, as served; also what the JSON decoding benchmarks parse. */
+    static FString MakeAddressUTxOsResponse(const TArray<FString>& Addresses, int32 UTxOsPerAddress);
+
+    /** Lovelace held by each synthetic UTxO. */
+    static constexpr int64 UTxOLovelace = 25000000;
+
+private:
+    void Bind(const TCHAR* Path, EHttpServerRequestVerbs Verb, EHttpServerResponseCodes Code, TFunction<FString(const TArray<uint8>&)> MakeBody);
+
+    FString MakeAddressInfoBody(const TArray<uint8>& RequestBody) const;
+    FString MakeAddressUTxOsBody(const TArray<uint8>& RequestBody) const;
+
+    TSharedPtr<IHttpRouter> Router;
+    TArray<FHttpRouteHandle> Routes;
+    uint32 Port = 0;
+    float LatencySeconds = 0.0f;
+    int32 UTxOsPerAddress = 0;
+    int64 RequestsServed = 0;
+};
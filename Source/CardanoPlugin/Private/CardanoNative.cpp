@@ -0,0 +1,436 @@
+#include "CardanoNative.h"
+#include "CardanoBlueprintLibrary.h"
+#include "CardanoChainTip.h"
+#include "CardanoLog.h"
+#include "CardanoMetrics.h"
+#include "CardanoMinAda.h"
+#include "CardanoMnemonic.h"
+#include "CardanoScriptCache.h"
+#include "CardanoSigningPipeline.h"
+#include "CardanoStats.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "CardanoWarmUp.h"
+#include <cardano/common/utxo_list.h>
+#include <cardano/key_handlers/software_secure_key_handler.h>
+#include <sodium.h>
+
+// Defined in CardanoBlueprintLibrary.cpp; wallets are derived the way the Blueprint library does it
+bool derive_base_addresses(TArrayView<const uint8> AccountKey, int32 Role, int32 StartIndex, int32 Count, TArray<FString>& OutAddresses, TArray<FCardanoHash28>* OutKeyHashes,
+    cardano_network_id_t NetworkId);
+
+namespace
+{
+    /** Feeds the profile of the last build into the balancing metrics. */
+    void record_build_profile(const cardano_tx_builder_t* builder)
+    {
+        static const double ITERATION_BOUNDS[] = { 1, 2, 3, 4, 6, 8, 12, 16 };
+
+        cardano_tx_build_profile_t Profile = {};
+        if (cardano_tx_builder_get_build_profile(builder, &Profile) != CARDANO_SUCCESS || Profile.total_ns == 0)
+        {
+            return;
+        }
+
+        FCardanoMetrics& Metrics = FCardanoMetrics::Get();
+        static FCardanoHistogram& Iterations = Metrics.Histogram(TEXT("cardano_tx_balancing_iterations"), TEXT("Passes of the balancing loop per transaction build."),
+            FString(), MakeArrayView(ITERATION_BOUNDS, UE_ARRAY_COUNT(ITERATION_BOUNDS)));
+        static FCardanoHistogram& Selection = Metrics.Histogram(TEXT("cardano_tx_build_step_duration_seconds"), TEXT("Time of each transaction build spent in a step of balancing."),
+            FCardanoMetrics::MakeLabels(TEXT("step"), TEXT("selection")));
+        static FCardanoHistogram& Evaluation = Metrics.Histogram(TEXT("cardano_tx_build_step_duration_seconds"), TEXT("Time of each transaction build spent in a step of balancing."),
+            FCardanoMetrics::MakeLabels(TEXT("step"), TEXT("evaluation")));
+        static FCardanoHistogram& Fee = Metrics.Histogram(TEXT("cardano_tx_build_step_duration_seconds"), TEXT("Time of each transaction build spent in a step of balancing."),
+            FCardanoMetrics::MakeLabels(TEXT("step"), TEXT("fee")));
+
+        static FCardanoCounter& EvaluationsReused = Metrics.Counter(TEXT("cardano_tx_evaluations_reused_total"),
+            TEXT("Balancing passes of script transactions that reused the execution units of the previous pass."));
+
+        Iterations.Observe(static_cast<double>(Profile.balancing_iterations));
+        Selection.Observe(Profile.selection_ns * 1e-9);
+        if (Profile.evaluation_count > 0)
+        {
+            Evaluation.Observe(Profile.evaluation_ns * 1e-9);
+        }
+        EvaluationsReused.Add(static_cast<int64>(Profile.evaluation_cache_hits));
+        Fee.Observe(Profile.fee_computation_ns * 1e-9);
+    }
+}
+
+FCardanoProvider FCardanoProvider::CreateOffline(cardano_network_magic_t NetworkMagic)
+{
+    FCardanoProviderHandle Provider;
+    if (create_offline_provider(NetworkMagic, Provider.GetInitReference()) != CARDANO_SUCCESS)
+    {
+        Provider.Reset();
+    }
+    return FCardanoProvider(MoveTemp(Provider));
+}
+
+cardano_network_magic_t FCardanoProvider::GetNetworkMagic() const
+{
+    return cardano_provider_get_network_magic(Provider.Get());
+}
+
+FCardanoTxBuilder FCardanoTxBuilder::Create(const FCardanoProtocolParameters& Parameters, const FCardanoProvider& Provider, FString& OutError)
+{
+    FCardanoTxBuilder TxBuilder;
+
+    TCardanoRef<cardano_protocol_parameters_t> Params;
+    if (!Provider.IsValid() || create_protocol_parameters(Parameters, Params.GetInitReference()) != CARDANO_SUCCESS)
+    {
+        OutError = TEXT("Failed to convert protocol parameters for the transaction builder");
+        return TxBuilder;
+    }
+
+    // The builder keeps its own references to both
+    TxBuilder.Builder.Reset(cardano_tx_builder_new(Params.Get(), Provider.Get()));
+
+    if (!TxBuilder.Builder)
+    {
+        OutError = TEXT("Failed to create transaction builder");
+        return TxBuilder;
+    }
+
+    const cardano_network_magic_t magic = Provider.GetNetworkMagic();
+    cardano_tx_builder_set_network_id(TxBuilder.Get(), magic == CARDANO_NETWORK_MAGIC_MAINNET ? CARDANO_NETWORK_ID_MAIN_NET : CARDANO_NETWORK_ID_TEST_NET);
+
+    // Profiling only reads the clock around the build steps; their counts and times feed the metrics
+    cardano_tx_builder_set_profiling_enabled(TxBuilder.Get(), true);
+
+    TxBuilder.MaxValueSize = Parameters.MaxValueSize;
+    TxBuilder.CoinsPerUTxOByte = Parameters.CoinsPerUTxOByte;
+    return TxBuilder;
+}
+
+void FCardanoTxBuilder::SendLovelace(FStringView Address, int64 Lovelace)
+{
+    const FTCHARToUTF8 AddressUtf8(Address.GetData(), Address.Len());
+    cardano_tx_builder_send_lovelace_ex(Builder.Get(), AddressUtf8.Get(), AddressUtf8.Length(), static_cast<uint64_t>(Lovelace));
+}
+
+void FCardanoTxBuilder::SendValue(FStringView Address, int64 Lovelace, TArrayView<const FTokenBalance> Assets)
+{
+    FCardanoValueHandle Value;
+    if (create_value(Lovelace, Assets, Value.GetInitReference()) != CARDANO_SUCCESS)
+    {
+        Defer(TEXT("Invalid asset in SendValue"));
+        return;
+    }
+
+    const FTCHARToUTF8 AddressUtf8(Address.GetData(), Address.Len());
+    cardano_tx_builder_send_value_ex(Builder.Get(), AddressUtf8.Get(), AddressUtf8.Length(), Value.Get());
+}
+
+void FCardanoTxBuilder::SendAssets(FStringView Address, int64 Lovelace, TArrayView<const FTokenBalance> Assets)
+{
+    TArray<TArray<FTokenBalance>> Groups;
+    FCardanoMinAda::PackAssets(Assets, MaxValueSize, Groups);
+    if (Groups.Num() == 0)
+    {
+        SendLovelace(Address, Lovelace);
+        return;
+    }
+
+    const int32 AddressSize = FCardanoMinAda::GetAddressSize(Address);
+    if (AddressSize <= 0)
+    {
+        Defer(FString::Printf(TEXT("Invalid output address: %.*s"), Address.Len(), Address.GetData()));
+        return;
+    }
+
+    for (int32 Index = 0; Index < Groups.Num(); ++Index)
+    {
+        const int64 MinLovelace = FCardanoMinAda::GetMinLovelace(CoinsPerUTxOByte, AddressSize, Groups[Index]);
+        SendValue(Address, Index == 0 ? FMath::Max(Lovelace, MinLovelace) : MinLovelace, Groups[Index]);
+    }
+
+    UE_LOG(LogCardano, Verbose, TEXT("Packed %d assets to %.*s into %d outputs"), Assets.Num(), Address.Len(), Address.GetData(), Groups.Num());
+}
+
+void FCardanoTxBuilder::SendOutputs(TArrayView<const FTransactionOutput> Outputs)
+{
+    TArray<FTransactionOutput> Merged;
+    TMap<FString, int32> OutputByAddress;
+    for (const FTransactionOutput& Output : Outputs)
+    {
+        if (const int32* Existing = OutputByAddress.Find(Output.Address))
+        {
+            Merged[*Existing].Value += Output.Value;
+            Merged[*Existing].Assets.Append(Output.Assets);
+        }
+        else
+        {
+            OutputByAddress.Add(Output.Address, Merged.Add(Output));
+        }
+    }
+
+    for (const FTransactionOutput& Output : Merged)
+    {
+        SendAssets(Output.Address, Output.Value, Output.Assets);
+    }
+}
+
+void FCardanoTxBuilder::SetChangeAddress(FStringView Address)
+{
+    const FTCHARToUTF8 AddressUtf8(Address.GetData(), Address.Len());
+    cardano_tx_builder_set_change_address_ex(Builder.Get(), AddressUtf8.Get(), AddressUtf8.Length());
+}
+
+void FCardanoTxBuilder::SetUTxOs(FStringView OwnerAddress, TArrayView<const FUTxO> UTxOs)
+{
+    FCardanoUTxOListHandle UTxOList;
+    if (cardano_utxo_list_new(UTxOList.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_utxo_list_reserve(UTxOList.Get(), UTxOs.Num()) != CARDANO_SUCCESS)
+    {
+        Defer(TEXT("Failed to add UTxO to the builder"));
+        return;
+    }
+
+    if (AddUTxOs(UTxOList.Get(), OwnerAddress, UTxOs))
+    {
+        cardano_tx_builder_set_utxos(Builder.Get(), UTxOList.Get());
+    }
+}
+
+void FCardanoTxBuilder::SetUTxOs(const TMap<FString, FAddressUTxOs>& UTxOsByAddress)
+{
+    int32 NumUTxOs = 0;
+    for (const TPair<FString, FAddressUTxOs>& Pair : UTxOsByAddress)
+    {
+        NumUTxOs += Pair.Value.UTxOs.Num();
+    }
+
+    FCardanoUTxOListHandle UTxOList;
+    if (cardano_utxo_list_new(UTxOList.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_utxo_list_reserve(UTxOList.Get(), NumUTxOs) != CARDANO_SUCCESS)
+    {
+        Defer(TEXT("Failed to add UTxO to the builder"));
+        return;
+    }
+
+    for (const TPair<FString, FAddressUTxOs>& Pair : UTxOsByAddress)
+    {
+        if (!AddUTxOs(UTxOList.Get(), Pair.Key, Pair.Value.UTxOs))
+        {
+            return;
+        }
+    }
+
+    cardano_tx_builder_set_utxos(Builder.Get(), UTxOList.Get());
+}
+
+bool FCardanoTxBuilder::AddUTxOs(cardano_utxo_list_t* UTxOList, FStringView OwnerAddress, TArrayView<const FUTxO> UTxOs)
+{
+    FCardanoAddressHandle Owner;
+    const FTCHARToUTF8 AddressUtf8(OwnerAddress.GetData(), OwnerAddress.Len());
+    if (cardano_address_from_string(AddressUtf8.Get(), AddressUtf8.Length(), Owner.GetInitReference()) != CARDANO_SUCCESS)
+    {
+        Defer(FString::Printf(TEXT("Invalid UTxO owner address: %.*s"), OwnerAddress.Len(), OwnerAddress.GetData()));
+        return false;
+    }
+
+    for (const FUTxO& UTxO : UTxOs)
+    {
+        TCardanoRef<cardano_utxo_t> Entry;
+        if (create_utxo(Owner.Get(), UTxO, Entry.GetInitReference()) != CARDANO_SUCCESS)
+        {
+            UE_LOG(LogCardano, Warning, TEXT("Skipping malformed UTxO %s#%d"), *UTxO.TxHash, UTxO.TxIndex);
+            continue;
+        }
+
+        if (cardano_utxo_list_add(UTxOList, Entry.Get()) != CARDANO_SUCCESS)
+        {
+            Defer(TEXT("Failed to add UTxO to the builder"));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void FCardanoTxBuilder::AddReferenceInput(const FCardanoUTxORef& Ref)
+{
+    // The cached UTxO is frozen and shared; the builder only keeps a reference to it
+    UCardanoScriptCache* ScriptCache = UCardanoScriptCache::Get();
+    const TCardanoRef<cardano_utxo_t> Cached(ScriptCache ? ScriptCache->FindReferenceInput(Ref) : nullptr);
+    if (!Cached)
+    {
+        Defer(FString::Printf(TEXT("Reference input %s is not cached"), *Ref.ToString()));
+        return;
+    }
+
+    cardano_tx_builder_add_reference_input(Builder.Get(), Cached.Get());
+}
+
+void FCardanoTxBuilder::AddReferenceInput(FStringView TxHash, int32 TxIndex)
+{
+    FCardanoUTxORef Ref(FCardanoHash32(), static_cast<uint32>(TxIndex));
+    if (TxIndex < 0 || TxHash.Len() != FCardanoHash32::Size * 2 || !CardanoHexToBytes(TxHash.GetData(), TxHash.Len(), Ref.TxHash.Bytes))
+    {
+        Defer(FString::Printf(TEXT("Reference input %.*s#%d is not cached"), TxHash.Len(), TxHash.GetData(), TxIndex));
+        return;
+    }
+    AddReferenceInput(Ref);
+}
+
+void FCardanoTxBuilder::SetInvalidAfter(int64 Slot)
+{
+    cardano_tx_builder_set_invalid_after(Builder.Get(), static_cast<uint64_t>(Slot));
+    bHasInvalidAfter = true;
+}
+
+FCardanoTransactionHandle FCardanoTxBuilder::Build(FString& OutError)
+{
+    FCardanoTransactionHandle Transaction;
+
+    if (!Builder || bBuilt)
+    {
+        OutError = TEXT("Transaction builder is not valid or has already been used");
+        return Transaction;
+    }
+
+    if (!DeferredError.IsEmpty())
+    {
+        OutError = DeferredError;
+        return Transaction;
+    }
+
+    if (!bHasInvalidAfter)
+    {
+        UCardanoChainTip* ChainTip = UCardanoChainTip::Get();
+        const int64 Slot = ChainTip ? ChainTip->GetTimeToLive(7200) : 0;
+        if (Slot <= 0)
+        {
+            OutError = TEXT("Unable to compute a TTL for the transaction");
+            return Transaction;
+        }
+        SetInvalidAfter(Slot);
+    }
+
+    bBuilt = true;
+
+    cardano_error_t result;
+    {
+        CARDANO_SCOPE(CardanoBuild);
+        result = cardano_tx_builder_build(Builder.Get(), Transaction.GetInitReference());
+    }
+    record_build_profile(Builder.Get());
+    if (result != CARDANO_SUCCESS)
+    {
+        OutError = UTF8_TO_TCHAR(cardano_tx_builder_get_last_error(Builder.Get()));
+        UE_LOG(LogCardano, Error, TEXT("Failed to build transaction: %s"), *OutError);
+        Transaction.Reset();
+    }
+    return Transaction;
+}
+
+TArray<uint8> FCardanoTxBuilder::BuildCbor(FString& OutError)
+{
+    TArray<uint8> Cbor;
+
+    const FCardanoTransactionHandle Transaction = Build(OutError);
+    if (Transaction && !serialize_transaction(Transaction.Get(), Cbor))
+    {
+        OutError = TEXT("Failed to serialize transaction");
+    }
+    return Cbor;
+}
+
+void FCardanoTxBuilder::Defer(FString&& Error)
+{
+    if (DeferredError.IsEmpty())
+    {
+        DeferredError = MoveTemp(Error);
+    }
+}
+
+FCardanoWallet FCardanoWallet::FromMnemonic(TArrayView<const FString> MnemonicWords, FStringView Password, int32 InAccountIndex, FString& OutError)
+{
+    CARDANO_SCOPE(CardanoKeyDerivation);
+
+    FCardanoWallet Wallet;
+
+    if (InAccountIndex < 0)
+    {
+        OutError = TEXT("Invalid account index");
+        return Wallet;
+    }
+
+    if (!FCardanoWarmUp::InitializeSodium())
+    {
+        OutError = TEXT("Libsodium initialization failed");
+        return Wallet;
+    }
+
+    byte_t entropy[64] = { 0 };
+    size_t entropy_size = 0;
+
+    if (!mnemonic_to_entropy(MnemonicWords, entropy, sizeof(entropy), &entropy_size))
+    {
+        OutError = TEXT("Invalid mnemonic");
+        return Wallet;
+    }
+
+    // The account key is the only hardened, and so passphrase protected, step; everything below is a soft derivation
+    const FCardanoScopedPassphrase Passphrase(Password);
+    cardano_error_t result = cardano_software_secure_key_handler_new(
+        entropy,
+        entropy_size,
+        Passphrase.GetData(),
+        Passphrase.Num(),
+        &get_scoped_passphrase,
+        Wallet.KeyHandler.GetInitReference());
+    sodium_memzero(entropy, sizeof(entropy));
+
+    if (result != CARDANO_SUCCESS)
+    {
+        OutError = FString::Printf(TEXT("Key handler creation failed: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+        Wallet.KeyHandler.Reset();
+        return Wallet;
+    }
+
+    const cardano_account_derivation_path_t account_path = {
+        ACCOUNT_DERIVATION_PATH.purpose,
+        ACCOUNT_DERIVATION_PATH.coin_type,
+        static_cast<uint64_t>(InAccountIndex) | 0x80000000U
+    };
+
+    TCardanoRef<cardano_bip32_public_key_t> AccountPublicKey;
+    result = cardano_secure_key_handler_bip32_get_extended_account_public_key(Wallet.KeyHandler.Get(), account_path, AccountPublicKey.GetInitReference());
+    if (result != CARDANO_SUCCESS)
+    {
+        OutError = FString::Printf(TEXT("Failed to derive account public key: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+        Wallet.KeyHandler.Reset();
+        return Wallet;
+    }
+
+    Wallet.AccountKey.Append(cardano_bip32_public_key_get_data(AccountPublicKey.Get()), cardano_bip32_public_key_get_bytes_size(AccountPublicKey.Get()));
+    Wallet.AccountIndex = InAccountIndex;
+    return Wallet;
+}
+
+bool FCardanoWallet::DeriveAddresses(int32 Role, int32 StartIndex, int32 Count, ECardanoNetwork Network, TArray<FString>& OutAddresses, TArray<FCardanoHash28>* OutKeyHashes) const
+{
+    OutAddresses.Reset();
+
+    if (!IsValid() || Role < 0 || StartIndex < 0 || Count <= 0)
+    {
+        return false;
+    }
+
+    const cardano_network_id_t NetworkId = Network == ECardanoNetwork::Mainnet ? CARDANO_NETWORK_ID_MAIN_NET : CARDANO_NETWORK_ID_TEST_NET;
+    if (!derive_base_addresses(AccountKey, Role, StartIndex, Count, OutAddresses, OutKeyHashes, NetworkId))
+    {
+        OutAddresses.Reset();
+        return false;
+    }
+    return true;
+}
+
+TArray<uint8> FCardanoWallet::SignTransaction(TArrayView<const uint8> UnsignedTransaction, TArrayView<const cardano_derivation_path_t> DerivationPaths, FStringView Password, FString& OutError) const
+{
+    TArray<uint8> Signed;
+
+    const FCardanoScopedPassphrase Passphrase(Password);
+    FCardanoSigningPipeline::SignTransaction(KeyHandler.Get(), UnsignedTransaction, DerivationPaths, Signed, OutError);
+    return Signed;
+}
@@ -0,0 +1,647 @@
+#include "CardanoParserFuzzer.h"
+#include "CardanoLog.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include <cardano/allocation_stats.h>
+#include <cardano/cardano.h>
+#include <cardano/cbor/cbor_well_formed.h>
+
+// A small Conway-era transaction with multi-asset outputs, a validity interval and metadata
+static const char* SEED_TRANSACTION_HEX =
+    "84a30081825820000000000000000000000000000000000000000000000000000000000000000000018382581d61111111111111111111111111"
+    "11111111111111111111111111111111821a000f4240a1581c22222222222222222222222222222222222222222222222222222222a2434142"
+    "4305400aa200581d6333311111111111111111111111111111111111111111111111111111011a001e8480a201821a00000007a1581c222222"
+    "22222222222222222222222222222222222222222222222222a141580100581d61111111111111111111111111111111111111111111111111"
+    "11111111021a00029810a0f4d90103a100a1187b63616263";
+
+// Bodies shaped like the Koios responses the plugin parses
+static const char* SEED_JSON[] = {
+    "[{\"tx_hash\":\"a1b2c3d4e5f60718293a4b5c6d7e8f90a1b2c3d4e5f60718293a4b5c6d7e8f90\",\"tx_index\":0,\"address\":"
+    "\"addr1qx2fxv2umyhttkxyxp8x0dlpdt3k6cwng5pxj3jhsydzer3n0d3vllmyqwsx5wktcd8cc3sq835lu7drv2xwl2wywfgse35a3x\","
+    "\"value\":\"25000000\",\"is_spent\":false,\"asset_list\":[{\"policy_id\":\"22222222222222222222222222222222222222222222"
+    "222222222222\",\"asset_name\":\"414243\",\"quantity\":\"10\"}]}]",
+    "[{\"epoch_no\":500,\"min_fee_a\":44,\"min_fee_b\":155381,\"max_tx_size\":16384,\"key_deposit\":\"2000000\","
+    "\"coins_per_utxo_size\":\"4310\",\"price_mem\":0.0577,\"price_step\":7.21e-05,\"protocol_major\":10,"
+    "\"cost_models\":{\"PlutusV3\":[100788,420,1,1,1000,173,0,1,1000,59957,4,1,11183,32,201305,8356,4]}}]",
+    "[{\"abs_slot\":130000000,\"block_time\":1721632291,\"block_no\":6500000,\"hash\":\"\\u00e9t\\u00e9\\n\\\"q\\\"\"}]",
+};
+
+static const int32 FUZZ_GROWTH_SIZES[] = { 1024, 4096, 16384 };
+
+// Findings kept in the report; all of them are counted
+static const int32 MAX_REPORTED_FINDINGS = 50;
+
+namespace
+{
+    enum class EInputKind : uint8
+    {
+        Cbor,
+        Json
+    };
+
+    struct FTarget
+    {
+        const TCHAR* Name;
+        EInputKind Kind;
+        TFunction<void(const TArray<uint8>&)> Parse;
+    };
+
+    struct FGenerator
+    {
+        const TCHAR* Name;
+        EInputKind Kind;
+        TFunction<TArray<uint8>(int32)> Make;
+    };
+
+    struct FCost
+    {
+        double NanosPerByte = 0.0;
+        double AllocatedBytesPerByte = 0.0;
+    };
+
+    void append_bytes(TArray<uint8>& Bytes, std::initializer_list<uint8> Values)
+    {
+        for (const uint8 Value : Values)
+        {
+            Bytes.Add(Value);
+        }
+    }
+
+    void append_text(TArray<uint8>& Bytes, const char* Text)
+    {
+        Bytes.Append(reinterpret_cast<const uint8*>(Text), static_cast<int32>(strlen(Text)));
+    }
+
+    /** Nests Tail in as many Prefix ... Suffix pairs as fit in Size bytes. */
+    TArray<uint8> nest(int32 Size, const char* Prefix, const char* Suffix, const char* Tail)
+    {
+        const int32 PrefixLength = static_cast<int32>(strlen(Prefix));
+        const int32 SuffixLength = static_cast<int32>(strlen(Suffix));
+        const int32 Depth = FMath::Max(1, (Size - static_cast<int32>(strlen(Tail))) / (PrefixLength + SuffixLength));
+
+        TArray<uint8> Bytes;
+        Bytes.Reserve(Size);
+        for (int32 i = 0; i < Depth; i++)
+        {
+            append_text(Bytes, Prefix);
+        }
+        append_text(Bytes, Tail);
+        for (int32 i = 0; i < Depth; i++)
+        {
+            append_text(Bytes, Suffix);
+        }
+        return Bytes;
+    }
+
+    /** Head, then as many Items as fit in Size bytes alongside End, then End. */
+    TArray<uint8> repeat(int32 Size, std::initializer_list<uint8> Head, std::initializer_list<uint8> Item, std::initializer_list<uint8> End)
+    {
+        TArray<uint8> Bytes;
+        Bytes.Reserve(Size);
+        append_bytes(Bytes, Head);
+        while (Bytes.Num() + static_cast<int32>(Item.size()) + static_cast<int32>(End.size()) <= Size)
+        {
+            append_bytes(Bytes, Item);
+        }
+        append_bytes(Bytes, End);
+        return Bytes;
+    }
+
+    /** An array or map header with a 32-bit count. */
+    void append_count(TArray<uint8>& Bytes, uint8 MajorTypeByte, uint32 Count)
+    {
+        append_bytes(Bytes, { static_cast<uint8>(MajorTypeByte | 26), static_cast<uint8>(Count >> 24), static_cast<uint8>(Count >> 16), static_cast<uint8>(Count >> 8), static_cast<uint8>(Count) });
+    }
+
+    /** A transaction whose body holds only an input set of Size bytes, with distinct or repeated inputs. */
+    TArray<uint8> transaction_with_inputs(int32 Size, bool bDistinct)
+    {
+        const int32 InputSize = 37;
+        const uint32 Count = static_cast<uint32>(FMath::Max(1, (Size - 16) / InputSize));
+
+        TArray<uint8> Bytes;
+        Bytes.Reserve(Size);
+        append_bytes(Bytes, { 0x84, 0xa1, 0x00 });
+        append_count(Bytes, 0x80, Count);
+        for (uint32 i = 0; i < Count; i++)
+        {
+            const uint32 Id = bDistinct ? i : 0;
+            append_bytes(Bytes, { 0x82, 0x58, 0x20 });
+            for (int32 b = 0; b < 28; b++)
+            {
+                Bytes.Add(0);
+            }
+            append_bytes(Bytes, { static_cast<uint8>(Id >> 24), static_cast<uint8>(Id >> 16), static_cast<uint8>(Id >> 8), static_cast<uint8>(Id), 0x00 });
+        }
+        append_bytes(Bytes, { 0xa0, 0xf5, 0xf6 });
+        return Bytes;
+    }
+
+    TArray<uint8> json_object(int32 Size, bool bDistinct)
+    {
+        TArray<uint8> Bytes;
+        Bytes.Reserve(Size + 16);
+        Bytes.Add('{');
+        for (int32 i = 0; Bytes.Num() < Size - 16; i++)
+        {
+            if (i > 0)
+            {
+                Bytes.Add(',');
+            }
+            append_text(Bytes, TCHAR_TO_UTF8(*FString::Printf(TEXT("\"k%d\":%d"), bDistinct ? i : 0, i)));
+        }
+        Bytes.Add('}');
+        return Bytes;
+    }
+
+    TArray<FGenerator> make_generators()
+    {
+        TArray<FGenerator> Generators;
+
+        // CBOR: nesting, declared lengths the input cannot hold, and containers the decoders check element by element
+        Generators.Add({ TEXT("deep_arrays"), EInputKind::Cbor, [](int32 Size) { return repeat(Size, {}, { 0x81 }, { 0x00 }); } });
+        Generators.Add({ TEXT("deep_indefinite_arrays"), EInputKind::Cbor, [](int32 Size) { return nest(Size, "\x9f", "\xff", "\x01"); } });
+        Generators.Add({ TEXT("deep_maps"), EInputKind::Cbor, [](int32 Size) { return repeat(Size, {}, { 0xa1, 0x00 }, { 0x00 }); } });
+        Generators.Add({ TEXT("deep_tags"), EInputKind::Cbor, [](int32 Size) { return repeat(Size, {}, { 0xd8, 0x18 }, { 0x00 }); } });
+        Generators.Add({ TEXT("huge_array_length"), EInputKind::Cbor, [](int32 Size) { return repeat(Size, { 0x9b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }, { 0x00 }, {}); } });
+        Generators.Add({ TEXT("huge_map_length"), EInputKind::Cbor, [](int32 Size) { return repeat(Size, { 0xbb, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }, { 0x00 }, {}); } });
+        Generators.Add({ TEXT("huge_bytestring_length"), EInputKind::Cbor, [](int32 Size) { return repeat(Size, { 0x5b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }, { 0x00 }, {}); } });
+        Generators.Add({ TEXT("indefinite_string_chunks"), EInputKind::Cbor, [](int32 Size) { return repeat(Size, { 0x5f }, { 0x41, 0x00 }, { 0xff }); } });
+        Generators.Add({ TEXT("empty_string_chunks"), EInputKind::Cbor, [](int32 Size) { return repeat(Size, { 0x7f }, { 0x60 }, { 0xff }); } });
+        Generators.Add({ TEXT("wide_array"), EInputKind::Cbor, [](int32 Size)
+            {
+                TArray<uint8> Bytes;
+                append_count(Bytes, 0x80, static_cast<uint32>(Size - 5));
+                Bytes.AddZeroed(Size - 5);
+                return Bytes;
+            } });
+        Generators.Add({ TEXT("distinct_tx_inputs"), EInputKind::Cbor, [](int32 Size) { return transaction_with_inputs(Size, true); } });
+        Generators.Add({ TEXT("duplicate_tx_inputs"), EInputKind::Cbor, [](int32 Size) { return transaction_with_inputs(Size, false); } });
+
+        // JSON: nesting, escapes and objects the parser checks key by key
+        Generators.Add({ TEXT("deep_arrays"), EInputKind::Json, [](int32 Size) { return nest(Size, "[", "]", "0"); } });
+        Generators.Add({ TEXT("deep_objects"), EInputKind::Json, [](int32 Size) { return nest(Size, "{\"a\":", "}", "0"); } });
+        Generators.Add({ TEXT("unicode_escape_run"), EInputKind::Json, [](int32 Size) { return repeat(Size, { '"' }, { '\\', 'u', '0', '0', 'e', '9' }, { '"' }); } });
+        Generators.Add({ TEXT("surrogate_pair_run"), EInputKind::Json, [](int32 Size) { return repeat(Size, { '"' }, { '\\', 'u', 'd', '8', '3', 'd', '\\', 'u', 'd', 'e', '0', '0' }, { '"' }); } });
+        Generators.Add({ TEXT("backslash_run"), EInputKind::Json, [](int32 Size) { return repeat(Size, { '"' }, { '\\', '\\' }, { '"' }); } });
+        Generators.Add({ TEXT("unterminated_string"), EInputKind::Json, [](int32 Size) { return repeat(Size, { '"' }, { '\\', 'n' }, {}); } });
+        Generators.Add({ TEXT("long_number"), EInputKind::Json, [](int32 Size) { return repeat(Size, { '1' }, { '9' }, {}); } });
+        Generators.Add({ TEXT("long_fraction"), EInputKind::Json, [](int32 Size) { return repeat(Size, { '0', '.' }, { '3' }, { 'e', '9' }); } });
+        Generators.Add({ TEXT("wide_array"), EInputKind::Json, [](int32 Size) { return repeat(Size, { '[', '0' }, { ',', '0' }, { ']' }); } });
+        Generators.Add({ TEXT("distinct_keys"), EInputKind::Json, [](int32 Size) { return json_object(Size, true); } });
+        Generators.Add({ TEXT("duplicate_keys"), EInputKind::Json, [](int32 Size) { return json_object(Size, false); } });
+
+        return Generators;
+    }
+
+    /** Byte-level mutations, plus splices of the headers and tokens that make parsers nest or trust a length. */
+    TArray<uint8> mutate(const TArray<uint8>& Seed, EInputKind Kind, int32 MaxBytes, FRandomStream& Random)
+    {
+        static const uint8 CborTokens[][9] = {
+            { 1, 0x9f }, { 1, 0xbf }, { 1, 0x5f }, { 1, 0x7f }, { 1, 0xff }, { 2, 0xd8, 0x18 },
+            { 9, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }, { 5, 0x5a, 0x7f, 0xff, 0xff, 0xff }, { 5, 0xba, 0x00, 0xff, 0xff, 0xff },
+        };
+        static const char* JsonTokens[] = { "[", "{", "\"", "\\", "\\u", "\\ud83d", "]", "}", ":", ",", "-", "1e999", "\"k\":", "null" };
+
+        TArray<uint8> Input = Seed;
+        const int32 Mutations = Random.RandRange(1, 8);
+        for (int32 m = 0; m < Mutations; m++)
+        {
+            const int32 Position = Input.Num() > 0 ? Random.RandRange(0, Input.Num() - 1) : 0;
+            switch (Random.RandRange(0, 5))
+            {
+                case 0:
+                    if (Input.Num() > 0)
+                    {
+                        Input[Position] ^= static_cast<uint8>(1 << Random.RandRange(0, 7));
+                    }
+                    break;
+                case 1:
+                    if (Input.Num() > 0)
+                    {
+                        Input[Position] = static_cast<uint8>(Random.RandRange(0, 255));
+                    }
+                    break;
+                case 2:
+                    if (Input.Num() > 1)
+                    {
+                        Input.RemoveAt(Position, FMath::Min(Random.RandRange(1, 16), Input.Num() - Position));
+                    }
+                    break;
+                case 3:
+                {
+                    // Duplicating a range repeats whatever structure it holds, nesting included
+                    const int32 Length = FMath::Min(Random.RandRange(1, 256), Input.Num() - Position);
+                    const int32 Copies = Random.RandRange(1, 64);
+                    TArray<uint8> Range(Input.GetData() + Position, Length);
+                    for (int32 c = 0; c < Copies && Input.Num() + Length <= MaxBytes; c++)
+                    {
+                        Input.Insert(Range, Position);
+                    }
+                    break;
+                }
+                default:
+                {
+                    TArray<uint8> Token;
+                    if (Kind == EInputKind::Cbor)
+                    {
+                        const uint8* Entry = CborTokens[Random.RandRange(0, static_cast<int32>(UE_ARRAY_COUNT(CborTokens)) - 1)];
+                        Token.Append(Entry + 1, Entry[0]);
+                    }
+                    else
+                    {
+                        append_text(Token, JsonTokens[Random.RandRange(0, static_cast<int32>(UE_ARRAY_COUNT(JsonTokens)) - 1)]);
+                    }
+
+                    const int32 Copies = Random.RandRange(0, 3) == 0 ? Random.RandRange(2, 512) : 1;
+                    for (int32 c = 0; c < Copies && Input.Num() + Token.Num() <= MaxBytes; c++)
+                    {
+                        Input.Insert(Token, Position);
+                    }
+                    break;
+                }
+            }
+        }
+
+        if (Input.Num() > MaxBytes)
+        {
+            Input.SetNum(MaxBytes);
+        }
+        return Input;
+    }
+
+    TArray<FTarget> make_targets()
+    {
+        TArray<FTarget> Targets;
+        Targets.Add({ TEXT("cbor/well_formed"), EInputKind::Cbor, [](const TArray<uint8>& Input)
+            {
+                size_t error_offset = 0U;
+                (void)cardano_cbor_validate_well_formed(Input.GetData(), Input.Num(), 0U, &error_offset);
+            } });
+        Targets.Add({ TEXT("cbor/skip_value"), EInputKind::Cbor, [](const TArray<uint8>& Input)
+            {
+                cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(Input.GetData(), Input.Num());
+                (void)cardano_cbor_reader_skip_value(reader);
+                cardano_cbor_reader_unref(&reader);
+            } });
+        Targets.Add({ TEXT("cbor/transaction"), EInputKind::Cbor, [](const TArray<uint8>& Input)
+            {
+                cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(Input.GetData(), Input.Num());
+                cardano_transaction_t* transaction = nullptr;
+                (void)cardano_transaction_from_cbor(reader, &transaction);
+                cardano_transaction_unref(&transaction);
+                cardano_cbor_reader_unref(&reader);
+            } });
+        Targets.Add({ TEXT("json/parse"), EInputKind::Json, [](const TArray<uint8>& Input)
+            {
+                cardano_json_object_t* json = cardano_json_object_parse(reinterpret_cast<const char*>(Input.GetData()), Input.Num());
+                cardano_json_object_unref(&json);
+            } });
+        return Targets;
+    }
+
+    uint64 total_allocated_bytes()
+    {
+        uint64 Total = 0;
+        for (int32 Tag = 0; Tag < CARDANO_ALLOCATION_TAG_COUNT; ++Tag)
+        {
+            cardano_allocation_stats_t Stats;
+            if (cardano_allocation_stats_get(static_cast<cardano_allocation_tag_t>(Tag), &Stats) == CARDANO_SUCCESS)
+            {
+                Total += Stats.allocated_bytes;
+            }
+        }
+        return Total;
+    }
+
+    /**
+     * Cost of one parse of Input: allocations of a single call, and the best of three timings, each repeating the
+     * call until it has run for 50us, so short inputs are not all timer resolution and a preempted run does not flag.
+     */
+    FCost measure(const FTarget& Target, const TArray<uint8>& Input, int32 CostFloorBytes, bool bAllocationTracking)
+    {
+        const double Bytes = FMath::Max(Input.Num(), CostFloorBytes);
+        FCost Cost;
+
+        const uint64 AllocatedBefore = bAllocationTracking ? total_allocated_bytes() : 0;
+        Target.Parse(Input);
+        if (bAllocationTracking)
+        {
+            Cost.AllocatedBytesPerByte = static_cast<double>(total_allocated_bytes() - AllocatedBefore) / Bytes;
+        }
+
+        double Best = TNumericLimits<double>::Max();
+        for (int32 Run = 0; Run < 3; ++Run)
+        {
+            int32 Calls = 0;
+            const double Start = FPlatformTime::Seconds();
+            double Elapsed = 0.0;
+            do
+            {
+                Target.Parse(Input);
+                Calls++;
+                Elapsed = FPlatformTime::Seconds() - Start;
+            } while (Elapsed < 50.0e-6);
+
+            Best = FMath::Min(Best, Elapsed / Calls);
+        }
+
+        Cost.NanosPerByte = Best * 1.0e9 / Bytes;
+        return Cost;
+    }
+
+    double median(TArray<double> Values)
+    {
+        if (Values.Num() == 0)
+        {
+            return 0.0;
+        }
+        Values.Sort();
+        return Values[Values.Num() / 2];
+    }
+
+    class FFuzzRun
+    {
+    public:
+        FFuzzRun(const FCardanoParserFuzzConfig& InConfig, FCardanoParserFuzzReport& InReport)
+            : Config(InConfig)
+            , Report(InReport)
+        {
+        }
+
+        void Measure(const FTarget& Target, FCardanoParserFuzzTargetStats& Stats, const FString& InputName, const TArray<uint8>& Input, FCost* OutCost = nullptr)
+        {
+            const FCost Cost = measure(Target, Input, Config.CostFloorBytes, Report.bAllocationTracking);
+            Stats.Inputs++;
+
+            if (Cost.NanosPerByte > Stats.WorstNanosPerByte)
+            {
+                Stats.WorstNanosPerByte = Cost.NanosPerByte;
+                Stats.WorstTimeInput = InputName;
+            }
+            if (Cost.AllocatedBytesPerByte > Stats.WorstAllocatedBytesPerByte)
+            {
+                Stats.WorstAllocatedBytesPerByte = Cost.AllocatedBytesPerByte;
+                Stats.WorstAllocationInput = InputName;
+            }
+
+            const double TimeLimit = Limit(Stats.BaselineNanosPerByte, Config.MaxNanosPerByte);
+            const double AllocationLimit = Limit(Stats.BaselineAllocatedBytesPerByte, Config.MaxAllocatedBytesPerByte);
+            if (TimeLimit > 0.0 && Cost.NanosPerByte > TimeLimit)
+            {
+                Flag(Target, InputName, Input, Cost, FString::Printf(TEXT("%.1f ns/byte over the %.1f limit"), Cost.NanosPerByte, TimeLimit));
+            }
+            else if (AllocationLimit > 0.0 && Cost.AllocatedBytesPerByte > AllocationLimit)
+            {
+                Flag(Target, InputName, Input, Cost, FString::Printf(TEXT("%.1f allocated bytes/byte over the %.1f limit"), Cost.AllocatedBytesPerByte, AllocationLimit));
+            }
+
+            if (OutCost)
+            {
+                *OutCost = Cost;
+            }
+        }
+
+        void Flag(const FTarget& Target, const FString& InputName, const TArray<uint8>& Input, const FCost& Cost, const FString& Reason)
+        {
+            Report.FindingCount++;
+            if (Report.Findings.Num() >= MAX_REPORTED_FINDINGS)
+            {
+                return;
+            }
+
+            FCardanoParserFuzzFinding& Finding = Report.Findings.AddDefaulted_GetRef();
+            Finding.Target = Target.Name;
+            Finding.Input = InputName;
+            Finding.Size = Input.Num();
+            Finding.NanosPerByte = Cost.NanosPerByte;
+            Finding.AllocatedBytesPerByte = Cost.AllocatedBytesPerByte;
+            Finding.Reason = Reason;
+
+            if (!Config.OutputDirectory.IsEmpty())
+            {
+                const FString FileName = FString::Printf(TEXT("%s-%s.%s"), Target.Name, *InputName, Target.Kind == EInputKind::Cbor ? TEXT("cbor") : TEXT("json"))
+                    .Replace(TEXT("/"), TEXT("_"));
+                const FString Path = FPaths::Combine(Config.OutputDirectory, FileName);
+                if (FFileHelper::SaveArrayToFile(Input, *Path))
+                {
+                    Finding.SavedTo = Path;
+                }
+            }
+        }
+
+    private:
+        double Limit(double Baseline, double Absolute) const
+        {
+            const double Relative = Baseline > 0.0 ? Baseline * Config.CostRatio : 0.0;
+            if (Relative > 0.0 && Absolute > 0.0)
+            {
+                return FMath::Min(Relative, Absolute);
+            }
+            return FMath::Max(Relative, Absolute);
+        }
+
+        const FCardanoParserFuzzConfig& Config;
+        FCardanoParserFuzzReport& Report;
+    };
+}
+
+FCardanoParserFuzzReport FCardanoParserFuzzer::Run(const FCardanoParserFuzzConfig& Config)
+{
+    FCardanoParserFuzzReport Report;
+    Report.bAllocationTracking = cardano_allocation_tracking_is_enabled();
+    const double StartTime = FPlatformTime::Seconds();
+    const int32 MaxBytes = FMath::Max(Config.MaxInputBytes, 64);
+
+    TArray<TArray<uint8>> CborSeeds;
+    TArray<uint8>& Transaction = CborSeeds.AddDefaulted_GetRef();
+    Transaction.SetNumUninitialized(static_cast<int32>(strlen(SEED_TRANSACTION_HEX)) / 2);
+    HexToBytes(UTF8_TO_TCHAR(SEED_TRANSACTION_HEX), Transaction.GetData());
+    CborSeeds.Append(Config.CborSeeds);
+
+    TArray<TArray<uint8>> JsonSeeds;
+    for (const char* Json : SEED_JSON)
+    {
+        append_text(JsonSeeds.AddDefaulted_GetRef(), Json);
+    }
+    for (const FString& Json : Config.JsonSeeds)
+    {
+        append_text(JsonSeeds.AddDefaulted_GetRef(), TCHAR_TO_UTF8(*Json));
+    }
+
+    if (!Config.OutputDirectory.IsEmpty())
+    {
+        IFileManager::Get().MakeDirectory(*Config.OutputDirectory, true);
+    }
+
+    FFuzzRun Fuzz(Config, Report);
+    const TArray<FTarget> Targets = make_targets();
+    const TArray<FGenerator> Generators = make_generators();
+
+    for (const FTarget& Target : Targets)
+    {
+        FCardanoParserFuzzTargetStats& Stats = Report.Targets.AddDefaulted_GetRef();
+        Stats.Name = Target.Name;
+        const TArray<TArray<uint8>>& Seeds = Target.Kind == EInputKind::Cbor ? CborSeeds : JsonSeeds;
+
+        // The baseline, measured before any limit applies
+        TArray<double> SeedNanos;
+        TArray<double> SeedAllocations;
+        for (int32 Index = 0; Index < Seeds.Num(); ++Index)
+        {
+            FCost Cost;
+            Fuzz.Measure(Target, Stats, FString::Printf(TEXT("seed/%d"), Index), Seeds[Index], &Cost);
+            SeedNanos.Add(Cost.NanosPerByte);
+            SeedAllocations.Add(Cost.AllocatedBytesPerByte);
+        }
+        Stats.BaselineNanosPerByte = median(SeedNanos);
+        Stats.BaselineAllocatedBytesPerByte = median(SeedAllocations);
+
+        for (const FGenerator& Generator : Generators)
+        {
+            if (Generator.Kind != Target.Kind)
+            {
+                continue;
+            }
+
+            FCost Smallest;
+            FCost Largest;
+            int32 SmallestSize = 0;
+            int32 LargestSize = 0;
+            TArray<uint8> LargestInput;
+            for (const int32 Size : FUZZ_GROWTH_SIZES)
+            {
+                if (Size > MaxBytes)
+                {
+                    break;
+                }
+
+                FCost Cost;
+                TArray<uint8> Input = Generator.Make(Size);
+                Fuzz.Measure(Target, Stats, FString::Printf(TEXT("%s/%d"), Generator.Name, Size), Input, &Cost);
+
+                if (SmallestSize == 0)
+                {
+                    Smallest = Cost;
+                    SmallestSize = Size;
+                }
+                Largest = Cost;
+                LargestSize = Size;
+                LargestInput = MoveTemp(Input);
+            }
+
+            if (LargestSize > SmallestSize)
+            {
+                const bool bTimeGrows = Largest.NanosPerByte > Smallest.NanosPerByte * Config.GrowthRatio;
+                const bool bAllocationGrows = Largest.AllocatedBytesPerByte > Smallest.AllocatedBytesPerByte * Config.GrowthRatio && Smallest.AllocatedBytesPerByte > 0.0;
+                if (bTimeGrows || bAllocationGrows)
+                {
+                    Fuzz.Flag(Target, FString::Printf(TEXT("%s/%d"), Generator.Name, LargestSize), LargestInput, Largest,
+                        FString::Printf(TEXT("superlinear: %s per byte grows %.1fx from %d to %d bytes"), bTimeGrows ? TEXT("time") : TEXT("allocation"),
+                            bTimeGrows ? Largest.NanosPerByte / Smallest.NanosPerByte : Largest.AllocatedBytesPerByte / Smallest.AllocatedBytesPerByte, SmallestSize, LargestSize));
+                }
+            }
+        }
+
+        // Every target of a kind sees the same mutations
+        FRandomStream Random(Config.Seed);
+        for (int32 Index = 0; Index < Config.RandomInputs && Seeds.Num() > 0; ++Index)
+        {
+            const TArray<uint8>& Seed = Seeds[Random.RandRange(0, Seeds.Num() - 1)];
+            Fuzz.Measure(Target, Stats, FString::Printf(TEXT("mutation/%d"), Index), mutate(Seed, Target.Kind, MaxBytes, Random));
+        }
+    }
+
+    Report.ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+    return Report;
+}
+
+FString FCardanoParserFuzzer::FormatReport(const FCardanoParserFuzzReport& Report)
+{
+    FString Text = FString::Printf(TEXT("%-18s  %7s  %10s  %10s  %-34s  %10s  %10s  %s\n"), TEXT("target"), TEXT("inputs"), TEXT("base ns/B"), TEXT("worst ns/B"),
+        TEXT("worst time input"), TEXT("base al/B"), TEXT("worst al/B"), TEXT("worst allocation input"));
+    for (const FCardanoParserFuzzTargetStats& Stats : Report.Targets)
+    {
+        Text += FString::Printf(TEXT("%-18s  %7d  %10.1f  %10.1f  %-34s  %10.1f  %10.1f  %s\n"), *Stats.Name, Stats.Inputs, Stats.BaselineNanosPerByte,
+            Stats.WorstNanosPerByte, *Stats.WorstTimeInput, Stats.BaselineAllocatedBytesPerByte, Stats.WorstAllocatedBytesPerByte,
+            Report.bAllocationTracking ? *Stats.WorstAllocationInput : TEXT("(tracking off)"));
+    }
+
+    Text += FString::Printf(TEXT("%d findings in %.1f s%s\n"), Report.FindingCount, Report.ElapsedSeconds,
+        Report.FindingCount > Report.Findings.Num() ? *FString::Printf(TEXT(", first %d listed"), Report.Findings.Num()) : TEXT(""));
+    for (const FCardanoParserFuzzFinding& Finding : Report.Findings)
+    {
+        Text += FString::Printf(TEXT("  %s %s (%d bytes): %s%s\n"), *Finding.Target, *Finding.Input, Finding.Size, *Finding.Reason,
+            Finding.SavedTo.IsEmpty() ? TEXT("") : *FString::Printf(TEXT(", saved to %s"), *Finding.SavedTo));
+    }
+    return Text;
+}
+
+static FAutoConsoleCommand FuzzParsersCommand(
+    TEXT("Cardano.FuzzParsers"),
+    TEXT("Feeds adversarial and mutated inputs to the cardano-c CBOR and JSON parsers and reports inputs whose cost per byte is out of bounds. ")
+    TEXT("Usage: Cardano.FuzzParsers [RandomInputs=2000] [Seed=1] [CostRatio=8] [OutputDirectory] [SeedFile...]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            FCardanoParserFuzzConfig Config;
+            if (Args.Num() > 0)
+            {
+                Config.RandomInputs = FCString::Atoi(*Args[0]);
+            }
+            if (Args.Num() > 1)
+            {
+                Config.Seed = FCString::Atoi(*Args[1]);
+            }
+            if (Args.Num() > 2)
+            {
+                Config.CostRatio = FCString::Atod(*Args[2]);
+            }
+            if (Args.Num() > 3)
+            {
+                Config.OutputDirectory = Args[3];
+            }
+
+            // .json seeds are JSON; anything else is a hex encoded transaction, as for Cardano.BenchmarkLibrary
+            for (int32 Index = 4; Index < Args.Num(); ++Index)
+            {
+                FString Text;
+                if (!FFileHelper::LoadFileToString(Text, *Args[Index]))
+                {
+                    UE_LOG(LogCardano, Warning, TEXT("Cardano.FuzzParsers: cannot read %s"), *Args[Index]);
+                    continue;
+                }
+
+                if (FPaths::GetExtension(Args[Index]).Equals(TEXT("json"), ESearchCase::IgnoreCase))
+                {
+                    Config.JsonSeeds.Add(MoveTemp(Text));
+                    continue;
+                }
+
+                Text.TrimStartAndEndInline();
+                TArray<uint8> Cbor;
+                Cbor.SetNumUninitialized(Text.Len() / 2);
+                if (Text.Len() % 2 != 0 || HexToBytes(Text, Cbor.GetData()) != Cbor.Num())
+                {
+                    UE_LOG(LogCardano, Warning, TEXT("Cardano.FuzzParsers: %s is not a hex encoded transaction"), *Args[Index]);
+                    continue;
+                }
+                Config.CborSeeds.Add(MoveTemp(Cbor));
+            }
+
+            Async(EAsyncExecution::Thread, [Config = MoveTemp(Config)]()
+                {
+                    const FCardanoParserFuzzReport Report = FCardanoParserFuzzer::Run(Config);
+
+                    TArray<FString> Lines;
+                    FCardanoParserFuzzer::FormatReport(Report).ParseIntoArrayLines(Lines);
+                    for (const FString& Line : Lines)
+                    {
+                        UE_LOG(LogCardano, Log, TEXT("%s"), *Line);
+                    }
+                });
+        }));
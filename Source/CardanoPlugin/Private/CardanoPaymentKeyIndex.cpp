@@ -0,0 +1,88 @@
+#include "CardanoPaymentKeyIndex.h"
+#include "CardanoBlueprintLibrary.h"
+
+cardano_derivation_path_t FCardanoKeyLocation::ToDerivationPath() const
+{
+    return {
+        ACCOUNT_DERIVATION_PATH.purpose,
+        ACCOUNT_DERIVATION_PATH.coin_type,
+        static_cast<uint64_t>(Account) | 0x80000000,
+        static_cast<uint64_t>(Role),
+        static_cast<uint64_t>(Index)
+    };
+}
+
+void FCardanoPaymentKeyIndex::AddRange(int32 Account, int32 Role, int32 StartIndex, TArrayView<const FCardanoHash28> KeyHashes)
+{
+    Locations.Reserve(Locations.Num() + KeyHashes.Num());
+
+    FCardanoKeyLocation Location;
+    Location.Account = Account;
+    Location.Role = Role;
+
+    for (int32 i = 0; i < KeyHashes.Num(); i++)
+    {
+        Location.Index = StartIndex + i;
+        Locations.Add(KeyHashes[i], Location);
+    }
+}
+
+bool FCardanoPaymentKeyIndex::Find(const FCardanoHash28& KeyHash, FCardanoKeyLocation& OutLocation) const
+{
+    const FCardanoKeyLocation* Location = Locations.Find(KeyHash);
+    if (!Location)
+    {
+        return false;
+    }
+
+    OutLocation = *Location;
+    return true;
+}
+
+bool FCardanoPaymentKeyIndex::FindAddress(const FString& Address, FCardanoKeyLocation& OutLocation) const
+{
+    FCardanoHash28 KeyHash;
+    return ReadPaymentKeyHash(Address, KeyHash) && Find(KeyHash, OutLocation);
+}
+
+bool FCardanoPaymentKeyIndex::ReadPaymentKeyHash(const FString& Address, FCardanoHash28& OutKeyHash)
+{
+    const FTCHARToUTF8 AddressUtf8(*Address);
+    cardano_address_t* address = nullptr;
+    if (cardano_address_from_string(AddressUtf8.Get(), AddressUtf8.Length(), &address) != CARDANO_SUCCESS)
+    {
+        return false;
+    }
+
+    cardano_credential_t* credential = nullptr;
+    if (cardano_base_address_t* base_address = cardano_address_to_base_address(address))
+    {
+        credential = cardano_base_address_get_payment_credential(base_address);
+        cardano_base_address_unref(&base_address);
+    }
+    else if (cardano_enterprise_address_t* enterprise_address = cardano_address_to_enterprise_address(address))
+    {
+        credential = cardano_enterprise_address_get_payment_credential(enterprise_address);
+        cardano_enterprise_address_unref(&enterprise_address);
+    }
+    else if (cardano_pointer_address_t* pointer_address = cardano_address_to_pointer_address(address))
+    {
+        credential = cardano_pointer_address_get_payment_credential(pointer_address);
+        cardano_pointer_address_unref(&pointer_address);
+    }
+    cardano_address_unref(&address);
+
+    cardano_credential_type_t type = CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH;
+    const bool bKeyHash = credential &&
+        cardano_credential_get_type(credential, &type) == CARDANO_SUCCESS &&
+        type == CARDANO_CREDENTIAL_TYPE_KEY_HASH &&
+        cardano_credential_get_hash_bytes_size(credential) == FCardanoHash28::Size;
+
+    if (bKeyHash)
+    {
+        FMemory::Memcpy(OutKeyHash.Bytes, cardano_credential_get_hash_bytes(credential), FCardanoHash28::Size);
+    }
+
+    cardano_credential_unref(&credential);
+    return bKeyHash;
+}
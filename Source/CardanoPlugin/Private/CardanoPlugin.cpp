@@ -1,18 +1,151 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "CardanoPlugin.h"
+#include "CardanoFrameScheduler.h"
+#include "CardanoLog.h"
+#include "CardanoMetrics.h"
+#include "CardanoStats.h"
+#include "CardanoWarmUp.h"
+#include "Containers/Ticker.h"
+#include <cardano/allocation_stats.h>
+
+DEFINE_LOG_CATEGORY(LogCardano);
+
+UE_TRACE_CHANNEL_DEFINE(CardanoChannel);
+
+DEFINE_STAT(STAT_CardanoKeyDerivation);
+DEFINE_STAT(STAT_CardanoBuild);
+DEFINE_STAT(STAT_CardanoSign);
+DEFINE_STAT(STAT_CardanoSerialize);
+DEFINE_STAT(STAT_CardanoParseJson);
+DEFINE_STAT(STAT_CardanoHttpResponse);
+DEFINE_STAT(STAT_CardanoRequestsQueued);
+DEFINE_STAT(STAT_CardanoRequestsInFlight);
+DEFINE_STAT(STAT_CardanoRequestsSent);
+DEFINE_STAT(STAT_CardanoRequestsThrottled);
+DEFINE_STAT(STAT_CardanoBytesSent);
+DEFINE_STAT(STAT_CardanoBytesReceived);
+DEFINE_STAT(STAT_CardanoUnchangedResponses);
+DEFINE_STAT(STAT_CardanoUTxOCacheHits);
+DEFINE_STAT(STAT_CardanoUTxOCacheMisses);
+DEFINE_STAT(STAT_CardanoParamsCacheHits);
+DEFINE_STAT(STAT_CardanoParamsCacheMisses);
+DEFINE_STAT(STAT_CardanoLiveCbor);
+DEFINE_STAT(STAT_CardanoPeakCbor);
+DEFINE_STAT(STAT_CardanoAllocationsCbor);
+DEFINE_STAT(STAT_CardanoLiveJson);
+DEFINE_STAT(STAT_CardanoPeakJson);
+DEFINE_STAT(STAT_CardanoAllocationsJson);
+DEFINE_STAT(STAT_CardanoLiveCrypto);
+DEFINE_STAT(STAT_CardanoPeakCrypto);
+DEFINE_STAT(STAT_CardanoAllocationsCrypto);
+DEFINE_STAT(STAT_CardanoLiveBuilder);
+DEFINE_STAT(STAT_CardanoPeakBuilder);
+DEFINE_STAT(STAT_CardanoAllocationsBuilder);
+DEFINE_STAT(STAT_CardanoLiveCollections);
+DEFINE_STAT(STAT_CardanoPeakCollections);
+DEFINE_STAT(STAT_CardanoAllocationsCollections);
+DEFINE_STAT(STAT_CardanoLiveBuffer);
+DEFINE_STAT(STAT_CardanoPeakBuffer);
+DEFINE_STAT(STAT_CardanoAllocationsBuffer);
+DEFINE_STAT(STAT_CardanoLiveOther);
+DEFINE_STAT(STAT_CardanoPeakOther);
+DEFINE_STAT(STAT_CardanoAllocationsOther);
+
+#if STATS
+/** Copies the cardano-c allocation counters into `stat Cardano`. */
+static bool UpdateAllocationStats(float DeltaTime)
+{
+    cardano_allocation_stats_t Stats;
+
+#define CARDANO_SET_ALLOCATION_STATS(Tag, Name) \
+    if (cardano_allocation_stats_get(Tag, &Stats) == CARDANO_SUCCESS) \
+    { \
+        SET_MEMORY_STAT(STAT_CardanoLive##Name, Stats.live_bytes); \
+        SET_MEMORY_STAT(STAT_CardanoPeak##Name, Stats.peak_bytes); \
+        SET_DWORD_STAT(STAT_CardanoAllocations##Name, static_cast<uint32>(Stats.live_count)); \
+    }
+
+    CARDANO_SET_ALLOCATION_STATS(CARDANO_ALLOCATION_TAG_CBOR, Cbor)
+    CARDANO_SET_ALLOCATION_STATS(CARDANO_ALLOCATION_TAG_JSON, Json)
+    CARDANO_SET_ALLOCATION_STATS(CARDANO_ALLOCATION_TAG_CRYPTO, Crypto)
+    CARDANO_SET_ALLOCATION_STATS(CARDANO_ALLOCATION_TAG_BUILDER, Builder)
+    CARDANO_SET_ALLOCATION_STATS(CARDANO_ALLOCATION_TAG_COLLECTIONS, Collections)
+    CARDANO_SET_ALLOCATION_STATS(CARDANO_ALLOCATION_TAG_BUFFER, Buffer)
+    CARDANO_SET_ALLOCATION_STATS(CARDANO_ALLOCATION_TAG_OTHER, Other)
+
+#undef CARDANO_SET_ALLOCATION_STATS
+
+    return true;
+}
+#endif
+
+/** Samples the cardano-c allocation counters into the cardano_library_memory_bytes metric. */
+static void CollectAllocationMetrics()
+{
+    static const struct
+    {
+        cardano_allocation_tag_t Tag;
+        const TCHAR* Label;
+    } TAGS[] = {
+        { CARDANO_ALLOCATION_TAG_CBOR, TEXT("cbor") },
+        { CARDANO_ALLOCATION_TAG_JSON, TEXT("json") },
+        { CARDANO_ALLOCATION_TAG_CRYPTO, TEXT("crypto") },
+        { CARDANO_ALLOCATION_TAG_BUILDER, TEXT("builder") },
+        { CARDANO_ALLOCATION_TAG_COLLECTIONS, TEXT("collections") },
+        { CARDANO_ALLOCATION_TAG_BUFFER, TEXT("buffer") },
+        { CARDANO_ALLOCATION_TAG_OTHER, TEXT("other") },
+    };
+
+    for (const auto& Entry : TAGS)
+    {
+        cardano_allocation_stats_t Stats;
+        if (cardano_allocation_stats_get(Entry.Tag, &Stats) == CARDANO_SUCCESS)
+        {
+            FCardanoMetrics::Get().Gauge(TEXT("cardano_library_memory_bytes"), TEXT("Heap held by cardano-c, by allocation tag."),
+                FCardanoMetrics::MakeLabels(TEXT("tag"), Entry.Label)).Set(static_cast<int64>(Stats.live_bytes));
+        }
+    }
+}
 
 #define LOCTEXT_NAMESPACE "FCardanoPluginModule"
 
 void FCardanoPluginModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+#if STATS
+	// The counters only exist in builds of cardano-c with allocation tracking
+	if (cardano_allocation_tracking_is_enabled())
+	{
+		AllocationStatsHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&UpdateAllocationStats), 0.5f);
+	}
+#endif
+
+	if (cardano_allocation_tracking_is_enabled())
+	{
+		AllocationMetricsHandle = FCardanoMetrics::Get().OnCollect().AddStatic(&CollectAllocationMetrics);
+	}
+
+	// Dedicated servers expose their metrics to a Prometheus scraper when a port is configured
+	int32 MetricsPort = 0;
+	GConfig->GetInt(TEXT("CardanoPlugin"), TEXT("MetricsPort"), MetricsPort, GGameIni);
+	if (MetricsPort > 0)
+	{
+		FCardanoMetrics::Get().StartHttpEndpoint(static_cast<uint32>(MetricsPort));
+	}
+
+	FCardanoFrameScheduler::Get().Start();
+	FCardanoWarmUp::Start();
 }
 
 void FCardanoPluginModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FTicker::GetCoreTicker().RemoveTicker(AllocationStatsHandle);
+	FCardanoMetrics::Get().OnCollect().Remove(AllocationMetricsHandle);
+	FCardanoMetrics::Get().StopHttpEndpoint();
+	FCardanoFrameScheduler::Get().Stop();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,613 @@
+#include "CardanoPoolRegistry.h"
+#include "CardanoBinaryCodec.h"
+#include "CardanoChainTip.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoLog.h"
+#include "Engine/Engine.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include <cardano/time.h>
+
+static const int32 KOIOS_PAGE_SIZE = 1000;
+
+static const uint8 POOL_REGISTRY_VERSION = 1;
+
+/** Bit of the flags byte of a saved pool. */
+static const uint8 POOL_FLAG_RETIRING = 1;
+
+struct UCardanoPoolRegistry::FRefreshState
+{
+    TArray<FCardanoStakePool> Pools;
+    int32 NetworkMagic = 0;
+    int64 EpochNo = 0;
+    int32 PendingSteps = 0;
+    FString FirstError;
+};
+
+static int32 GetCurrentNetworkMagic()
+{
+    UCardanoChainTip* ChainTip = UCardanoChainTip::Get();
+    return ChainTip ? ChainTip->GetNetworkMagic() : static_cast<int32>(CARDANO_NETWORK_MAGIC_MAINNET);
+}
+
+/** The epoch of the network at the current time, or UINT64_MAX on networks whose epochs are unknown. */
+static uint64_t GetCurrentEpoch(int32 NetworkMagic)
+{
+    return cardano_compute_epoch_from_unix_time(static_cast<cardano_network_magic_t>(NetworkMagic), static_cast<uint64_t>(FDateTime::UtcNow().ToUnixTimestamp()));
+}
+
+/** Checks the outcome of a Koios request, returning an error message on failure. */
+static FString CheckResponse(const FHttpResponsePtr& Response, bool Success)
+{
+    if (!Success || !Response.IsValid())
+    {
+        return TEXT("Network request failed");
+    }
+    if (Response->GetResponseCode() != 200)
+    {
+        return FString::Printf(TEXT("Koios returned HTTP %d"), Response->GetResponseCode());
+    }
+    return TEXT("");
+}
+
+static FString MakePoolInfoBody(const TArray<FString>& PoolIds)
+{
+    FString RequestBody;
+    RequestBody.Reserve(UCardanoKoiosClient::EstimateStringListBodyLength(PoolIds, 24));
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBody);
+
+    Writer->WriteObjectStart();
+    Writer->WriteArrayStart(TEXT("_pool_bech32_ids"));
+    for (const FString& PoolId : PoolIds)
+    {
+        Writer->WriteValue(PoolId);
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return RequestBody;
+}
+
+/** Koios sends lovelace amounts as strings, so they do not lose precision in JavaScript clients. */
+static int64 ReadLovelace(const FJsonObject& Row, const TCHAR* Field)
+{
+    FString Text;
+    if (Row.TryGetStringField(Field, Text))
+    {
+        return FCString::Atoi64(*Text);
+    }
+
+    int64 Value = 0;
+    Row.TryGetNumberField(Field, Value);
+    return Value;
+}
+
+/** Reads a pool_info row; returns false for rows without an id and pools that already retired. */
+static bool ParsePool(const FJsonObject& Row, FCardanoStakePool& OutPool)
+{
+    FString Status;
+    Row.TryGetStringField("pool_status", Status);
+    if (!Row.TryGetStringField("pool_id_bech32", OutPool.PoolId) || Status == TEXT("retired"))
+    {
+        return false;
+    }
+
+    double Margin = 0.0;
+    double Saturation = 0.0;
+    Row.TryGetNumberField("margin", Margin);
+    Row.TryGetNumberField("live_saturation", Saturation);
+    Row.TryGetNumberField("block_count", OutPool.BlocksMinted);
+    Row.TryGetNumberField("live_delegators", OutPool.Delegators);
+    OutPool.Margin = static_cast<float>(Margin);
+    OutPool.Saturation = static_cast<float>(Saturation);
+    OutPool.FixedCost = ReadLovelace(Row, TEXT("fixed_cost"));
+    OutPool.Pledge = ReadLovelace(Row, TEXT("pledge"));
+    OutPool.LiveStake = ReadLovelace(Row, TEXT("live_stake"));
+    OutPool.bRetiring = Status == TEXT("retiring");
+
+    // Null when the metadata could not be fetched or did not match its hash
+    const TSharedPtr<FJsonObject>* Metadata = nullptr;
+    if (Row.TryGetObjectField("meta_json", Metadata) && Metadata && Metadata->IsValid())
+    {
+        (*Metadata)->TryGetStringField("ticker", OutPool.Ticker);
+        (*Metadata)->TryGetStringField("name", OutPool.Name);
+        (*Metadata)->TryGetStringField("homepage", OutPool.Homepage);
+    }
+    return true;
+}
+
+/** Parses a pool_info body; runs on the thread pool for large responses, so it only touches Rows. */
+static bool DecodePoolRows(const TArray<uint8>& Content, TArray<FCardanoStakePool>& Rows)
+{
+    const FUTF8ToTCHAR Json(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+    TArray<TSharedPtr<FJsonValue>> JsonArray;
+    if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(FString(Json.Length(), Json.Get())), JsonArray))
+    {
+        return false;
+    }
+
+    Rows.Reserve(JsonArray.Num());
+    for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+    {
+        const TSharedPtr<FJsonObject> Row = Item.IsValid() ? Item->AsObject() : nullptr;
+        FCardanoStakePool Pool;
+        if (Row.IsValid() && ParsePool(*Row, Pool))
+        {
+            Rows.Add(MoveTemp(Pool));
+        }
+    }
+    return true;
+}
+
+/** Orders pools by one key, then by id so that pages stay stable between queries. */
+static bool IsOrderedBefore(const FCardanoStakePool& A, const FCardanoStakePool& B, ECardanoPoolSort SortBy)
+{
+    switch (SortBy)
+    {
+    case ECardanoPoolSort::Saturation:
+        if (A.Saturation != B.Saturation)
+        {
+            return A.Saturation < B.Saturation;
+        }
+        break;
+    case ECardanoPoolSort::Margin:
+        if (A.Margin != B.Margin)
+        {
+            return A.Margin < B.Margin;
+        }
+        break;
+    case ECardanoPoolSort::Pledge:
+        if (A.Pledge != B.Pledge)
+        {
+            return A.Pledge < B.Pledge;
+        }
+        break;
+    case ECardanoPoolSort::Performance:
+        if (A.BlocksMinted != B.BlocksMinted)
+        {
+            return A.BlocksMinted < B.BlocksMinted;
+        }
+        break;
+    }
+    return A.PoolId < B.PoolId;
+}
+
+static void SerializePool(FArchive& Ar, FCardanoStakePool& Pool)
+{
+    Ar << Pool.PoolId;
+    Ar << Pool.Ticker;
+    Ar << Pool.Name;
+    Ar << Pool.Homepage;
+    Ar << Pool.Margin;
+    Ar << Pool.Saturation;
+    SerializeVarInt(Ar, Pool.FixedCost);
+    SerializeVarInt(Ar, Pool.Pledge);
+    SerializeVarInt(Ar, Pool.LiveStake);
+
+    uint64 BlocksMinted = static_cast<uint64>(FMath::Max(Pool.BlocksMinted, 0));
+    uint64 Delegators = static_cast<uint64>(FMath::Max(Pool.Delegators, 0));
+    uint8 Flags = Pool.bRetiring ? POOL_FLAG_RETIRING : 0;
+    SerializeVarUInt(Ar, BlocksMinted);
+    SerializeVarUInt(Ar, Delegators);
+    Ar << Flags;
+
+    if (Ar.IsLoading())
+    {
+        Pool.BlocksMinted = static_cast<int32>(FMath::Min<uint64>(BlocksMinted, MAX_int32));
+        Pool.Delegators = static_cast<int32>(FMath::Min<uint64>(Delegators, MAX_int32));
+        Pool.bRetiring = (Flags & POOL_FLAG_RETIRING) != 0;
+    }
+}
+
+UCardanoPoolRegistry* UCardanoPoolRegistry::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoPoolRegistry>() : nullptr;
+}
+
+void UCardanoPoolRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Collection.InitializeDependency(UCardanoKoiosClient::StaticClass());
+    Collection.InitializeDependency(UCardanoChainTip::StaticClass());
+
+    LoadFromDisk();
+
+    if (!IsCurrent())
+    {
+        StartRefresh();
+    }
+
+    TickHandle = FTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UCardanoPoolRegistry::Tick), FMath::Max(EpochCheckIntervalSeconds, 1.0f));
+}
+
+void UCardanoPoolRegistry::Deinitialize()
+{
+    FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    Super::Deinitialize();
+}
+
+bool UCardanoPoolRegistry::Query(const FCardanoPoolQuery& Query, FCardanoPoolPage& OutPage) const
+{
+    OutPage = FCardanoPoolPage();
+    OutPage.EpochNo = static_cast<int32>(EpochNo);
+
+    const int32 SortIndex = static_cast<int32>(Query.SortBy);
+    if (Pools.Num() == 0 || SortIndex < 0 || SortIndex >= NumSortOrders)
+    {
+        return false;
+    }
+
+    const TArray<int32>& Index = Indexes[SortIndex];
+    const int32 Offset = FMath::Max(Query.Offset, 0);
+    const int32 Limit = FMath::Max(Query.Limit, 0);
+    OutPage.Pools.Reserve(FMath::Min(Limit, Index.Num()));
+
+    for (int32 i = 0; i < Index.Num(); ++i)
+    {
+        const FCardanoStakePool& Pool = Pools[Index[Query.bDescending ? Index.Num() - 1 - i : i]];
+        if (!Matches(Pool, Query))
+        {
+            continue;
+        }
+
+        if (OutPage.TotalMatches >= Offset && OutPage.Pools.Num() < Limit)
+        {
+            OutPage.Pools.Add(Pool);
+        }
+        ++OutPage.TotalMatches;
+    }
+    return true;
+}
+
+bool UCardanoPoolRegistry::FindPool(const FString& PoolId, FCardanoStakePool& OutPool) const
+{
+    const int32* Position = PoolsById.Find(PoolId);
+    if (!Position)
+    {
+        return false;
+    }
+
+    OutPool = Pools[*Position];
+    return true;
+}
+
+void UCardanoPoolRegistry::Refresh(const FOnPoolRegistryResult& OnComplete)
+{
+    PendingCallbacks.Add(OnComplete);
+    StartRefresh();
+}
+
+bool UCardanoPoolRegistry::Matches(const FCardanoStakePool& Pool, const FCardanoPoolQuery& Query)
+{
+    if ((Pool.bRetiring && !Query.bIncludeRetiring) || Pool.Margin > Query.MaxMargin || Pool.Pledge < Query.MinPledge)
+    {
+        return false;
+    }
+    if (Query.MaxSaturation > 0.0f && Pool.Saturation > Query.MaxSaturation)
+    {
+        return false;
+    }
+    return Query.Search.IsEmpty()
+        || Pool.Ticker.StartsWith(Query.Search, ESearchCase::IgnoreCase)
+        || Pool.Name.StartsWith(Query.Search, ESearchCase::IgnoreCase);
+}
+
+bool UCardanoPoolRegistry::Tick(float DeltaTime)
+{
+    if (!bRefreshInProgress && !IsCurrent())
+    {
+        StartRefresh();
+    }
+
+    return true;
+}
+
+bool UCardanoPoolRegistry::IsCurrent() const
+{
+    const int32 Magic = GetCurrentNetworkMagic();
+    if (Pools.Num() == 0 || NetworkMagic != Magic)
+    {
+        return false;
+    }
+
+    const uint64_t Epoch = GetCurrentEpoch(Magic);
+    if (Epoch == UINT64_MAX)
+    {
+        return LastRefreshTime > 0.0 && FPlatformTime::Seconds() - LastRefreshTime < FallbackRefreshSeconds;
+    }
+
+    return static_cast<uint64_t>(EpochNo) == Epoch;
+}
+
+void UCardanoPoolRegistry::StartRefresh()
+{
+    if (bRefreshInProgress)
+    {
+        return;
+    }
+
+    bRefreshInProgress = true;
+
+    TSharedRef<FRefreshState> Refresh = MakeShared<FRefreshState>();
+    Refresh->NetworkMagic = GetCurrentNetworkMagic();
+
+    const uint64_t Epoch = GetCurrentEpoch(Refresh->NetworkMagic);
+    Refresh->EpochNo = Epoch == UINT64_MAX ? 0 : static_cast<int64>(Epoch);
+
+    // Held until the pool list is complete, so the first page cannot finish the refresh
+    Refresh->PendingSteps = 1;
+    if (UCardanoKoiosClient::Get())
+    {
+        FetchPoolIds(Refresh, 0);
+    }
+    else
+    {
+        Refresh->FirstError = TEXT("Koios client is not available");
+    }
+    CompleteStep(Refresh);
+}
+
+void UCardanoPoolRegistry::FetchPoolIds(TSharedRef<FRefreshState> Refresh, int32 Offset)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+
+    // Ordered by id, which never changes, so pages do not shift while pools register
+    const FString Path = FString::Printf(TEXT("pool_list?select=pool_id_bech32&pool_status=in.(registered,retiring)&order=pool_id_bech32.asc&offset=%d&limit=%d"),
+        Offset, KOIOS_PAGE_SIZE);
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateRequest(TEXT("GET"), Path);
+
+    TWeakObjectPtr<UCardanoPoolRegistry> WeakThis(this);
+    ++Refresh->PendingSteps;
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Refresh, Offset](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            FString Error = CheckResponse(Response, Success);
+            if (Error.IsEmpty() && !ParseJsonArray(Response, JsonArray))
+            {
+                Error = TEXT("Invalid response format");
+            }
+            if (!Error.IsEmpty() && Refresh->FirstError.IsEmpty())
+            {
+                Refresh->FirstError = Error;
+            }
+
+            TArray<FString> PoolIds;
+            PoolIds.Reserve(JsonArray.Num());
+            for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+            {
+                const TSharedPtr<FJsonObject> Row = Item.IsValid() ? Item->AsObject() : nullptr;
+                FString PoolId;
+                if (Row.IsValid() && Row->TryGetStringField("pool_id_bech32", PoolId))
+                {
+                    PoolIds.Add(MoveTemp(PoolId));
+                }
+            }
+
+            // The details of a page are fetched while the next page of the list is
+            if (Refresh->FirstError.IsEmpty())
+            {
+                for (const TArray<FString>& Chunk : ChunkAddresses(PoolIds, UCardanoKoiosClient::Get()->GetMaxAddressesPerRequest()))
+                {
+                    WeakThis->FetchPoolInfo(Refresh, Chunk);
+                }
+                if (JsonArray.Num() >= KOIOS_PAGE_SIZE)
+                {
+                    WeakThis->FetchPoolIds(Refresh, Offset + JsonArray.Num());
+                }
+            }
+
+            WeakThis->CompleteStep(Refresh);
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::History);
+}
+
+void UCardanoPoolRegistry::FetchPoolInfo(TSharedRef<FRefreshState> Refresh, const TArray<FString>& PoolIds)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateJsonPost(TEXT("pool_info"), MakePoolInfoBody(PoolIds));
+
+    TWeakObjectPtr<UCardanoPoolRegistry> WeakThis(this);
+    ++Refresh->PendingSteps;
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Refresh](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            const FString Error = CheckResponse(Response, Success);
+            if (!Error.IsEmpty())
+            {
+                Refresh->FirstError = Refresh->FirstError.IsEmpty() ? Error : Refresh->FirstError;
+                WeakThis->CompleteStep(Refresh);
+                return;
+            }
+
+            // A page of pool_info runs to a few hundred kilobytes, so it is usually parsed off the game thread
+            TSharedRef<TArray<FCardanoStakePool>> Rows = MakeShared<TArray<FCardanoStakePool>>();
+            DecodeKoiosResponse(Response,
+                [Rows](const TArray<uint8>& Content)
+                {
+                    return DecodePoolRows(Content, *Rows);
+                },
+                [WeakThis, Refresh, Rows](bool bDecoded)
+                {
+                    if (!WeakThis.IsValid())
+                    {
+                        return;
+                    }
+
+                    if (!bDecoded)
+                    {
+                        Refresh->FirstError = Refresh->FirstError.IsEmpty() ? TEXT("Invalid response format") : Refresh->FirstError;
+                    }
+                    else
+                    {
+                        Refresh->Pools.Append(MoveTemp(*Rows));
+                    }
+
+                    WeakThis->CompleteStep(Refresh);
+                });
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::History);
+}
+
+void UCardanoPoolRegistry::CompleteStep(TSharedRef<FRefreshState> Refresh)
+{
+    if (--Refresh->PendingSteps > 0)
+    {
+        return;
+    }
+
+    bRefreshInProgress = false;
+    LastRefreshTime = FPlatformTime::Seconds();
+
+    FString Error = Refresh->FirstError;
+    if (Error.IsEmpty() && Refresh->Pools.Num() == 0)
+    {
+        Error = TEXT("Koios listed no registered pools");
+    }
+
+    // A partial registry would rank pools against a population missing some of them, so the previous one is kept
+    if (Error.IsEmpty())
+    {
+        Pools = MoveTemp(Refresh->Pools);
+        NetworkMagic = Refresh->NetworkMagic;
+        EpochNo = Refresh->EpochNo;
+        BuildIndexes();
+        SaveToDisk();
+        UE_LOG(LogCardano, Log, TEXT("Pool registry cached %d pools for epoch %lld"), Pools.Num(), EpochNo);
+    }
+    else
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Failed to refresh the pool registry: %s"), *Error);
+    }
+
+    TArray<FOnPoolRegistryResult> Callbacks = MoveTemp(PendingCallbacks);
+    PendingCallbacks.Reset();
+    for (const FOnPoolRegistryResult& Callback : Callbacks)
+    {
+        Callback.ExecuteIfBound(Error.IsEmpty(), Error);
+    }
+}
+
+void UCardanoPoolRegistry::BuildIndexes()
+{
+    PoolsById.Reset();
+    PoolsById.Reserve(Pools.Num());
+    for (int32 i = 0; i < Pools.Num(); ++i)
+    {
+        PoolsById.Add(Pools[i].PoolId, i);
+    }
+
+    for (int32 SortIndex = 0; SortIndex < NumSortOrders; ++SortIndex)
+    {
+        const ECardanoPoolSort SortBy = static_cast<ECardanoPoolSort>(SortIndex);
+        TArray<int32>& Index = Indexes[SortIndex];
+        Index.SetNumUninitialized(Pools.Num());
+        for (int32 i = 0; i < Pools.Num(); ++i)
+        {
+            Index[i] = i;
+        }
+
+        Index.Sort([this, SortBy](int32 A, int32 B)
+            {
+                return IsOrderedBefore(Pools[A], Pools[B], SortBy);
+            });
+    }
+}
+
+FString UCardanoPoolRegistry::GetCacheFilePath() const
+{
+    return FPaths::ProjectSavedDir() / TEXT("Cardano") / TEXT("PoolRegistry.bin");
+}
+
+void UCardanoPoolRegistry::SerializeRegistry(FArchive& Ar)
+{
+    uint8 Version = POOL_REGISTRY_VERSION;
+    Ar << Version;
+    Ar << NetworkMagic;
+    SerializeVarInt(Ar, EpochNo);
+
+    if (Ar.IsLoading() && (Ar.IsError() || Version != POOL_REGISTRY_VERSION))
+    {
+        Ar.SetError();
+        return;
+    }
+
+    int32 Count = Pools.Num();
+    if (!SerializeCount(Ar, Count))
+    {
+        return;
+    }
+
+    if (Ar.IsLoading())
+    {
+        Pools.SetNum(Count);
+    }
+    for (int32 i = 0; i < Count && !Ar.IsError(); ++i)
+    {
+        SerializePool(Ar, Pools[i]);
+    }
+}
+
+void UCardanoPoolRegistry::LoadFromDisk()
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *GetCacheFilePath(), FILEREAD_Silent))
+    {
+        return;
+    }
+
+    FMemoryReader Reader(Bytes);
+    SerializeRegistry(Reader);
+
+    // Pools of another network are useless, and a damaged file is fetched again
+    if (Reader.IsError() || NetworkMagic != GetCurrentNetworkMagic())
+    {
+        if (Reader.IsError())
+        {
+            UE_LOG(LogCardano, Warning, TEXT("Ignoring unreadable pool registry %s"), *GetCacheFilePath());
+        }
+        Pools.Reset();
+        EpochNo = 0;
+        NetworkMagic = 0;
+        return;
+    }
+
+    BuildIndexes();
+    UE_LOG(LogCardano, Log, TEXT("Loaded %d cached pools for epoch %lld"), Pools.Num(), EpochNo);
+}
+
+void UCardanoPoolRegistry::SaveToDisk()
+{
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+    SerializeRegistry(Writer);
+
+    // Written beside the target and moved over it, so a crash mid-write leaves the previous registry intact
+    const FString FilePath = GetCacheFilePath();
+    const FString TempPath = FilePath + TEXT(".tmp");
+    if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !IFileManager::Get().Move(*FilePath, *TempPath, true))
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Failed to persist the pool registry"));
+    }
+}
@@ -0,0 +1,238 @@
+#include "CardanoPrefetch.h"
+#include "CardanoChainTip.h"
+#include "CardanoLog.h"
+#include "CardanoMetrics.h"
+#include "CardanoProtocolParamsCache.h"
+#include "CardanoSendAction.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "CardanoUTxOCache.h"
+#include "Engine/Engine.h"
+
+namespace
+{
+    FCardanoCounter& take_counter(bool bHit)
+    {
+        static FCardanoCounter& Hits = FCardanoMetrics::Get().Counter(TEXT("cardano_prefetch_takes_total"),
+            TEXT("Sends that looked for a prebuilt transaction."), FCardanoMetrics::MakeLabels(TEXT("result"), TEXT("hit")));
+        static FCardanoCounter& Misses = FCardanoMetrics::Get().Counter(TEXT("cardano_prefetch_takes_total"),
+            TEXT("Sends that looked for a prebuilt transaction."), FCardanoMetrics::MakeLabels(TEXT("result"), TEXT("miss")));
+        return bHit ? Hits : Misses;
+    }
+
+    bool same_outputs(const TArray<FTransactionOutput>& A, const TArray<FTransactionOutput>& B)
+    {
+        if (A.Num() != B.Num())
+        {
+            return false;
+        }
+
+        for (int32 i = 0; i < A.Num(); ++i)
+        {
+            if (A[i].Address != B[i].Address || A[i].Value != B[i].Value || A[i].Assets.Num() != B[i].Assets.Num())
+            {
+                return false;
+            }
+
+            for (int32 j = 0; j < A[i].Assets.Num(); ++j)
+            {
+                const FTokenBalance& AssetA = A[i].Assets[j];
+                const FTokenBalance& AssetB = B[i].Assets[j];
+                if (AssetA.PolicyId != AssetB.PolicyId || AssetA.AssetName != AssetB.AssetName || AssetA.Quantity != AssetB.Quantity)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+UCardanoPrefetch* UCardanoPrefetch::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoPrefetch>() : nullptr;
+}
+
+void UCardanoPrefetch::Deinitialize()
+{
+    Prebuilts.Empty();
+    Super::Deinitialize();
+}
+
+void UCardanoPrefetch::PrefetchWallet(FCardanoWalletHandle Wallet)
+{
+    UCardanoWalletSubsystem* Wallets = UCardanoWalletSubsystem::Get();
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (!Wallets || !Cache || !Wallets->IsWalletValid(Wallet))
+    {
+        return;
+    }
+
+    // A wallet not downloaded yet is refreshed now; one already cached only has its next refresh brought forward
+    TMap<FString, FAddressUTxOs> UTxOs;
+    if (UCardanoSendAction::ReadWalletUTxOs(Wallet, UTxOs))
+    {
+        Wallets->RefreshWallet(Wallet);
+    }
+    else
+    {
+        FOnUTxOCacheRefreshed OnComplete;
+        OnComplete.BindDynamic(this, &UCardanoPrefetch::OnUTxOsRefreshed);
+        Cache->RefreshAll(OnComplete);
+    }
+
+    // Completes right away when the cached parameters belong to the current epoch
+    if (UCardanoProtocolParamsCache* ParamsCache = UCardanoProtocolParamsCache::Get())
+    {
+        FOnProtocolParametersResult OnComplete;
+        OnComplete.BindDynamic(this, &UCardanoPrefetch::OnParametersFetched);
+        ParamsCache->GetParameters(OnComplete);
+    }
+
+    // Reading the slot starts a sync when the tip is stale
+    if (UCardanoChainTip* ChainTip = UCardanoChainTip::Get())
+    {
+        if (!ChainTip->IsSynced())
+        {
+            ChainTip->Sync(FOnChainTipSynced());
+        }
+        else
+        {
+            ChainTip->GetCurrentSlot();
+        }
+    }
+}
+
+void UCardanoPrefetch::PrefetchSend(FCardanoWalletHandle Wallet, const TArray<FTransactionOutput>& Outputs)
+{
+    FPrebuilt& Prebuilt = Prebuilts.FindOrAdd(Wallet.Id);
+    const bool bSameOutputs = Prebuilt.Generation != 0 && same_outputs(Prebuilt.Outputs, Outputs);
+    if (!bSameOutputs || (!Prebuilt.bBuilding && !IsUsable(Prebuilt)))
+    {
+        Prebuilt = FPrebuilt();
+        Prebuilt.Outputs = Outputs;
+        Prebuilt.Generation = NextGeneration++;
+    }
+
+    PrefetchWallet(Wallet);
+    BuildPending();
+}
+
+bool UCardanoPrefetch::IsSendPrefetched(FCardanoWalletHandle Wallet, const TArray<FTransactionOutput>& Outputs) const
+{
+    const FPrebuilt* Prebuilt = Prebuilts.Find(Wallet.Id);
+    return Prebuilt && same_outputs(Prebuilt->Outputs, Outputs) && IsUsable(*Prebuilt);
+}
+
+bool UCardanoPrefetch::TakeTransaction(FCardanoWalletHandle Wallet, const TArray<FTransactionOutput>& Outputs, TArray<uint8>& OutUnsignedTransaction)
+{
+    FPrebuilt Prebuilt;
+    const bool bFound = Prebuilts.RemoveAndCopyValue(Wallet.Id, Prebuilt) && same_outputs(Prebuilt.Outputs, Outputs) && IsUsable(Prebuilt);
+    take_counter(bFound).Add();
+    if (!bFound)
+    {
+        return false;
+    }
+
+    OutUnsignedTransaction = MoveTemp(Prebuilt.Transaction);
+    return true;
+}
+
+bool UCardanoPrefetch::IsUsable(const FPrebuilt& Prebuilt) const
+{
+    if (Prebuilt.Transaction.Num() == 0 || FPlatformTime::Seconds() - Prebuilt.BuiltTime > PrebuiltLifetimeSeconds)
+    {
+        return false;
+    }
+
+    // Fees and deposits may change with the epoch
+    const UCardanoProtocolParamsCache* ParamsCache = UCardanoProtocolParamsCache::Get();
+    FCardanoProtocolParameters Parameters;
+    if (!ParamsCache || !ParamsCache->GetCachedParameters(Parameters) || Parameters.EpochNo != Prebuilt.EpochNo)
+    {
+        return false;
+    }
+
+    // Spent by a transaction since, whether ours, pending, or one seen in the mempool
+    const UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (!Cache)
+    {
+        return false;
+    }
+    for (const FCardanoUTxORef& Input : Prebuilt.Inputs)
+    {
+        FString Address;
+        if (!Cache->FindSpendableUTxOAddress(Input, Address) || Cache->IsSpentInMempool(Input.TxHash.ToHex(), static_cast<int32>(Input.TxIndex)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void UCardanoPrefetch::BuildPending()
+{
+    const UCardanoProtocolParamsCache* ParamsCache = UCardanoProtocolParamsCache::Get();
+    FCardanoProtocolParameters Parameters;
+    if (!ParamsCache || !ParamsCache->GetCachedParameters(Parameters))
+    {
+        return;
+    }
+
+    for (TPair<int32, FPrebuilt>& Pair : Prebuilts)
+    {
+        FPrebuilt& Prebuilt = Pair.Value;
+        FCardanoWalletHandle Wallet;
+        Wallet.Id = Pair.Key;
+
+        TMap<FString, FAddressUTxOs> UTxOs;
+        if (Prebuilt.bBuilding || Prebuilt.Transaction.Num() > 0 || !UCardanoSendAction::ReadWalletUTxOs(Wallet, UTxOs))
+        {
+            continue;
+        }
+
+        Prebuilt.bBuilding = true;
+        const uint32 Generation = Prebuilt.Generation;
+        const int32 EpochNo = Parameters.EpochNo;
+
+        TWeakObjectPtr<UCardanoPrefetch> WeakThis(this);
+        UCardanoSendAction::BuildPayment(Wallet, Prebuilt.Outputs, Parameters, UTxOs)
+            .Then([WeakThis, Wallet, Generation, EpochNo](TCardanoTaskResult<TArray<uint8>>&& Result)
+                {
+                    UCardanoPrefetch* This = WeakThis.Get();
+                    FPrebuilt* Current = This ? This->Prebuilts.Find(Wallet.Id) : nullptr;
+                    if (!Current || Current->Generation != Generation)
+                    {
+                        return;
+                    }
+
+                    Current->bBuilding = false;
+                    if (!Result.IsSuccess() || !read_spent_inputs(Result.Value.GetValue(), Current->Inputs))
+                    {
+                        // Kept without a transaction, so the next intent signal tries again
+                        UE_LOG(LogCardano, Verbose, TEXT("Prefetched send from wallet %d was not built: %s"), Wallet.Id, *Result.Error);
+                        Current->Inputs.Reset();
+                        return;
+                    }
+
+                    Current->Transaction = MoveTemp(Result.Value.GetValue());
+                    Current->EpochNo = EpochNo;
+                    Current->BuiltTime = FPlatformTime::Seconds();
+                });
+    }
+}
+
+void UCardanoPrefetch::OnParametersFetched(bool bSuccess, const FCardanoProtocolParameters& Parameters, const FString& ErrorMessage)
+{
+    if (bSuccess)
+    {
+        BuildPending();
+    }
+}
+
+void UCardanoPrefetch::OnUTxOsRefreshed(bool bSuccess, const FString& ErrorMessage)
+{
+    if (bSuccess)
+    {
+        BuildPending();
+    }
+}
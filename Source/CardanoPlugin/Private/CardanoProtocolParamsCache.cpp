@@ -0,0 +1,262 @@
+#include "CardanoProtocolParamsCache.h"
+#include "CardanoBlueprintLibrary.h"
+#include "CardanoChainTip.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoLog.h"
+#include "CardanoStats.h"
+#include "Engine/Engine.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include <cardano/time.h>
+
+/** The parameters take a few kilobytes of JSON. */
+static const int64 SHARED_CAPACITY = 64 * 1024;
+
+UCardanoProtocolParamsCache* UCardanoProtocolParamsCache::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoProtocolParamsCache>() : nullptr;
+}
+
+void UCardanoProtocolParamsCache::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Collection.InitializeDependency(UCardanoKoiosClient::StaticClass());
+    Collection.InitializeDependency(UCardanoChainTip::StaticClass());
+
+    LoadFromDisk();
+
+    if (!SharedMemoryName.IsEmpty())
+    {
+        SharedCache = FCardanoSharedCache::Open(SharedMemoryName, SHARED_CAPACITY, SharedWriterTimeoutSeconds);
+        if (SharedCache.IsValid())
+        {
+            TickSharedCache(0.0f);
+            SharedTickHandle = FTicker::GetCoreTicker().AddTicker(
+                FTickerDelegate::CreateUObject(this, &UCardanoProtocolParamsCache::TickSharedCache), 1.0f);
+        }
+    }
+
+    if (!IsCurrent() && !IsSharedReader())
+    {
+        StartFetch();
+    }
+
+    TickHandle = FTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UCardanoProtocolParamsCache::Tick), FMath::Max(EpochCheckIntervalSeconds, 1.0f));
+}
+
+void UCardanoProtocolParamsCache::Deinitialize()
+{
+    FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    FTicker::GetCoreTicker().RemoveTicker(SharedTickHandle);
+    SharedCache.Reset();
+    Super::Deinitialize();
+}
+
+bool UCardanoProtocolParamsCache::GetCachedParameters(FCardanoProtocolParameters& OutParameters) const
+{
+    if (!bHasParameters)
+    {
+        return false;
+    }
+
+    OutParameters = Cached;
+    return true;
+}
+
+void UCardanoProtocolParamsCache::GetParameters(const FOnProtocolParametersResult& OnComplete)
+{
+    if (IsSharedReader() && !IsCurrent())
+    {
+        AdoptSharedParameters();
+    }
+
+    if (bHasParameters && IsCurrent())
+    {
+        INC_DWORD_STAT(STAT_CardanoParamsCacheHits);
+        static FCardanoCounter& Hits = FCardanoMetrics::Get().Counter(TEXT("cardano_cache_lookups_total"), TEXT("Cache lookups by cache and result."),
+            FCardanoMetrics::MakeLabels(TEXT("cache"), TEXT("protocol_parameters"), TEXT("result"), TEXT("hit")));
+        Hits.Add();
+        OnComplete.ExecuteIfBound(true, Cached, TEXT(""));
+        return;
+    }
+
+    INC_DWORD_STAT(STAT_CardanoParamsCacheMisses);
+    static FCardanoCounter& Misses = FCardanoMetrics::Get().Counter(TEXT("cardano_cache_lookups_total"), TEXT("Cache lookups by cache and result."),
+        FCardanoMetrics::MakeLabels(TEXT("cache"), TEXT("protocol_parameters"), TEXT("result"), TEXT("miss")));
+    Misses.Add();
+    Refresh(OnComplete);
+}
+
+void UCardanoProtocolParamsCache::Refresh(const FOnProtocolParametersResult& OnComplete)
+{
+    PendingCallbacks.Add(OnComplete);
+    StartFetch();
+}
+
+bool UCardanoProtocolParamsCache::Tick(float DeltaTime)
+{
+    // Readers wait for the writer to publish the new epoch's parameters
+    if (!bFetchInProgress && !IsCurrent() && !IsSharedReader())
+    {
+        StartFetch();
+    }
+
+    return true;
+}
+
+bool UCardanoProtocolParamsCache::IsCurrent() const
+{
+    if (!bHasParameters)
+    {
+        return false;
+    }
+
+    UCardanoChainTip* ChainTip = UCardanoChainTip::Get();
+    const cardano_network_magic_t Magic = static_cast<cardano_network_magic_t>(ChainTip ? ChainTip->GetNetworkMagic() : CARDANO_NETWORK_MAGIC_MAINNET);
+    const uint64_t Epoch = cardano_compute_epoch_from_unix_time(Magic, static_cast<uint64_t>(FDateTime::UtcNow().ToUnixTimestamp()));
+
+    if (Epoch == UINT64_MAX)
+    {
+        return LastFetchTime > 0.0 && FPlatformTime::Seconds() - LastFetchTime < FallbackRefreshSeconds;
+    }
+
+    return static_cast<uint64_t>(Cached.EpochNo) == Epoch;
+}
+
+void UCardanoProtocolParamsCache::StartFetch()
+{
+    if (bFetchInProgress)
+    {
+        return;
+    }
+
+    bFetchInProgress = true;
+
+    FOnProtocolParametersResult OnFetchedDelegate;
+    OnFetchedDelegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UCardanoProtocolParamsCache, OnFetched));
+    UCardanoBlueprintLibrary::GetProtocolParameters(OnFetchedDelegate);
+}
+
+void UCardanoProtocolParamsCache::OnFetched(bool bSuccess, const FCardanoProtocolParameters& Parameters, const FString& ErrorMessage)
+{
+    bFetchInProgress = false;
+    LastFetchTime = FPlatformTime::Seconds();
+
+    if (bSuccess)
+    {
+        Cached = Parameters;
+        bHasParameters = true;
+        bSharedDirty = true;
+        PublishSharedParameters();
+
+        // The writer keeps the file, so that processes of the host do not write it at the same time
+        if (!IsSharedReader())
+        {
+            SaveToDisk();
+        }
+        UE_LOG(LogCardano, Log, TEXT("Protocol parameters cached for epoch %d"), Cached.EpochNo);
+    }
+    else
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Failed to refresh protocol parameters: %s"), *ErrorMessage);
+    }
+
+    // On failure callers still get the previous epoch's parameters, if any, to decide for themselves
+    TArray<FOnProtocolParametersResult> Callbacks = MoveTemp(PendingCallbacks);
+    PendingCallbacks.Reset();
+    for (const FOnProtocolParametersResult& Callback : Callbacks)
+    {
+        Callback.ExecuteIfBound(bSuccess, Cached, ErrorMessage);
+    }
+}
+
+FString UCardanoProtocolParamsCache::GetCacheFilePath() const
+{
+    return FPaths::ProjectSavedDir() / TEXT("Cardano") / TEXT("ProtocolParameters.json");
+}
+
+void UCardanoProtocolParamsCache::LoadFromDisk()
+{
+    FString JsonString;
+    if (!FFileHelper::LoadFileToString(JsonString, *GetCacheFilePath()))
+    {
+        return;
+    }
+
+    FCardanoProtocolParameters Loaded;
+    if (FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &Loaded, 0, 0) && Loaded.MinFeeA > 0)
+    {
+        Cached = Loaded;
+        bHasParameters = true;
+        bSharedDirty = true;
+        UE_LOG(LogCardano, Log, TEXT("Loaded cached protocol parameters for epoch %d"), Cached.EpochNo);
+    }
+}
+
+void UCardanoProtocolParamsCache::SaveToDisk() const
+{
+    FString JsonString;
+    if (!FJsonObjectConverter::UStructToJsonObjectString(Cached, JsonString) ||
+        !FFileHelper::SaveStringToFile(JsonString, *GetCacheFilePath()))
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Failed to persist protocol parameters"));
+    }
+}
+
+bool UCardanoProtocolParamsCache::TickSharedCache(float DeltaTime)
+{
+    if (!SharedCache->Heartbeat())
+    {
+        AdoptSharedParameters();
+    }
+    else if (bSharedDirty)
+    {
+        PublishSharedParameters();
+    }
+    return true;
+}
+
+void UCardanoProtocolParamsCache::AdoptSharedParameters()
+{
+    TArray<uint8> Bytes;
+    if (!SharedCache.IsValid() || !SharedCache->Read(SharedVersion, Bytes))
+    {
+        return;
+    }
+
+    const FUTF8ToTCHAR JsonString(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+    FCardanoProtocolParameters Shared;
+    if (!FJsonObjectConverter::JsonObjectStringToUStruct(FString(JsonString.Length(), JsonString.Get()), &Shared, 0, 0) || Shared.MinFeeA <= 0)
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Ignoring unreadable shared protocol parameters"));
+        return;
+    }
+
+    if (!bHasParameters || Shared.EpochNo >= Cached.EpochNo)
+    {
+        Cached = Shared;
+        bHasParameters = true;
+        LastFetchTime = FPlatformTime::Seconds();
+    }
+}
+
+void UCardanoProtocolParamsCache::PublishSharedParameters()
+{
+    if (!SharedCache.IsValid() || !SharedCache->IsWriter() || !bHasParameters)
+    {
+        return;
+    }
+
+    FString JsonString;
+    if (FJsonObjectConverter::UStructToJsonObjectString(Cached, JsonString))
+    {
+        const FTCHARToUTF8 JsonUtf8(*JsonString);
+        TArray<uint8> Bytes(reinterpret_cast<const uint8*>(JsonUtf8.Get()), JsonUtf8.Length());
+        if (SharedCache->Publish(Bytes))
+        {
+            bSharedDirty = false;
+        }
+    }
+}
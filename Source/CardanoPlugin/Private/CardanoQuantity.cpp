@@ -0,0 +1,472 @@
+#include "CardanoQuantity.h"
+#include "CardanoLog.h"
+
+namespace
+{
+    const uint64 SIGN_BIT = 1ull << 63;
+
+    /** Chunk size of decimal conversions: the largest power of ten divide_magnitude takes, as it is below 2^63. */
+    const uint64 CHUNK_DIVISOR = 1000000000000000000ull;
+
+    /** Most fractional digits FromDecimalString scales by, beyond which a 128-bit amount holds no integer part. */
+    const int32 MAX_DECIMALS = 38;
+
+    /** Unsigned 128-bit magnitude. */
+    struct FMagnitude
+    {
+        uint64 Low = 0;
+        uint64 High = 0;
+    };
+
+    FMagnitude get_magnitude(const FCardanoQuantity& Quantity)
+    {
+        FMagnitude Magnitude{ Quantity.Low, Quantity.High };
+        if (Quantity.IsNegative())
+        {
+            Magnitude.Low = ~Quantity.Low + 1;
+            Magnitude.High = ~Quantity.High + (Magnitude.Low == 0 ? 1 : 0);
+        }
+        return Magnitude;
+    }
+
+    /** Applies a sign to a magnitude; false if it does not fit, i.e. is above 2^127 - 1, or 2^127 when negative. */
+    bool from_magnitude(const FMagnitude& Magnitude, bool bNegative, FCardanoQuantity& OutQuantity)
+    {
+        const bool bFits = (Magnitude.High & SIGN_BIT) == 0 || (bNegative && Magnitude.High == SIGN_BIT && Magnitude.Low == 0);
+        if (!bFits)
+        {
+            return false;
+        }
+
+        OutQuantity.Low = Magnitude.Low;
+        OutQuantity.High = Magnitude.High;
+        if (bNegative)
+        {
+            OutQuantity.Low = ~Magnitude.Low + 1;
+            OutQuantity.High = ~Magnitude.High + (OutQuantity.Low == 0 ? 1 : 0);
+        }
+        return true;
+    }
+
+    /** Full 128-bit product of two words. */
+    void multiply_words(uint64 A, uint64 B, uint64& OutHigh, uint64& OutLow)
+    {
+        const uint64 ALow = A & 0xFFFFFFFFull, AHigh = A >> 32;
+        const uint64 BLow = B & 0xFFFFFFFFull, BHigh = B >> 32;
+
+        const uint64 LowLow = ALow * BLow;
+        const uint64 HighLow = AHigh * BLow;
+        const uint64 LowHigh = ALow * BHigh;
+        const uint64 HighHigh = AHigh * BHigh;
+
+        const uint64 Middle = (LowLow >> 32) + (HighLow & 0xFFFFFFFFull) + (LowHigh & 0xFFFFFFFFull);
+        OutLow = (Middle << 32) | (LowLow & 0xFFFFFFFFull);
+        OutHigh = HighHigh + (HighLow >> 32) + (LowHigh >> 32) + (Middle >> 32);
+    }
+
+    /** Magnitude * Factor; false on overflow of 128 bits. */
+    bool multiply_magnitude(const FMagnitude& Magnitude, uint64 Factor, FMagnitude& OutProduct)
+    {
+        uint64 LowCarry = 0, Low = 0, HighOverflow = 0, High = 0;
+        multiply_words(Magnitude.Low, Factor, LowCarry, Low);
+        multiply_words(Magnitude.High, Factor, HighOverflow, High);
+
+        const uint64 Sum = High + LowCarry;
+        if (HighOverflow != 0 || Sum < High)
+        {
+            return false;
+        }
+
+        OutProduct.Low = Low;
+        OutProduct.High = Sum;
+        return true;
+    }
+
+    /** Long division by a word of at most 2^63, so the running remainder never needs a 65th bit. */
+    uint64 divide_magnitude(const FMagnitude& Magnitude, uint64 Divisor, FMagnitude& OutQuotient)
+    {
+        check(Divisor != 0 && Divisor <= SIGN_BIT);
+
+        FMagnitude Quotient;
+        uint64 Remainder = 0;
+        for (int32 Bit = 127; Bit >= 0; --Bit)
+        {
+            const uint64 Word = Bit >= 64 ? Magnitude.High : Magnitude.Low;
+            Remainder = (Remainder << 1) | ((Word >> (Bit & 63)) & 1);
+            if (Remainder >= Divisor)
+            {
+                Remainder -= Divisor;
+                (Bit >= 64 ? Quotient.High : Quotient.Low) |= 1ull << (Bit & 63);
+            }
+        }
+
+        OutQuotient = Quotient;
+        return Remainder;
+    }
+
+    /** Decimal digits of a magnitude, most significant first. */
+    FString magnitude_to_string(FMagnitude Magnitude)
+    {
+        if (Magnitude.High == 0)
+        {
+            return FString::Printf(TEXT("%llu"), Magnitude.Low);
+        }
+
+        // Chunks of 18 digits, least significant first, until the rest fits a word
+        TArray<uint64, TInlineAllocator<3>> Chunks;
+        while (Magnitude.High != 0)
+        {
+            Chunks.Add(divide_magnitude(Magnitude, CHUNK_DIVISOR, Magnitude));
+        }
+
+        FString Text = FString::Printf(TEXT("%llu"), Magnitude.Low);
+        for (int32 Index = Chunks.Num() - 1; Index >= 0; --Index)
+        {
+            Text += FString::Printf(TEXT("%018llu"), Chunks[Index]);
+        }
+        return Text;
+    }
+
+    /** Clamps an overflowing Blueprint result to the end of the range it overflowed toward. */
+    FCardanoQuantity saturate(bool bPositive, const TCHAR* Operation)
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Quantity %s overflowed 128 bits"), Operation);
+
+        FCardanoQuantity Result;
+        Result.Low = bPositive ? MAX_uint64 : 0;
+        Result.High = bPositive ? ~SIGN_BIT : SIGN_BIT;
+        return Result;
+    }
+}
+
+FCardanoQuantity FCardanoQuantity::FromInt64(int64 Value)
+{
+    FCardanoQuantity Quantity;
+    Quantity.Low = static_cast<uint64>(Value);
+    Quantity.High = Value < 0 ? MAX_uint64 : 0;
+    return Quantity;
+}
+
+FCardanoQuantity FCardanoQuantity::FromUInt64(uint64 Value)
+{
+    FCardanoQuantity Quantity;
+    Quantity.Low = Value;
+    return Quantity;
+}
+
+bool FCardanoQuantity::FromString(const FString& Text, FCardanoQuantity& OutQuantity)
+{
+    const TCHAR* Chars = *Text;
+    const bool bNegative = *Chars == TEXT('-');
+    if (bNegative || *Chars == TEXT('+'))
+    {
+        ++Chars;
+    }
+
+    if (!FChar::IsDigit(*Chars))
+    {
+        return false;
+    }
+
+    FMagnitude Magnitude;
+    for (; *Chars; ++Chars)
+    {
+        if (!FChar::IsDigit(*Chars) || !multiply_magnitude(Magnitude, 10, Magnitude))
+        {
+            return false;
+        }
+
+        const uint64 Low = Magnitude.Low + static_cast<uint64>(*Chars - TEXT('0'));
+        if (Low < Magnitude.Low && ++Magnitude.High == 0)
+        {
+            return false;
+        }
+        Magnitude.Low = Low;
+    }
+
+    return from_magnitude(Magnitude, bNegative, OutQuantity);
+}
+
+bool FCardanoQuantity::FromDecimalString(const FString& Text, int32 Decimals, FCardanoQuantity& OutQuantity)
+{
+    Decimals = FMath::Clamp(Decimals, 0, MAX_DECIMALS);
+
+    FString Whole = Text;
+    FString Fraction;
+    if (Text.Split(TEXT("."), &Whole, &Fraction))
+    {
+        if (Fraction.Len() > Decimals || Fraction.IsEmpty())
+        {
+            return false;
+        }
+
+        for (const TCHAR Char : Fraction)
+        {
+            if (!FChar::IsDigit(Char))
+            {
+                return false;
+            }
+        }
+    }
+
+    return FromString(Whole + Fraction + FString::ChrN(Decimals - Fraction.Len(), TEXT('0')), OutQuantity);
+}
+
+bool FCardanoQuantity::FromBigint(cardano_bigint_t* Bigint, FCardanoQuantity& OutQuantity)
+{
+    const size_t Size = Bigint ? cardano_bigint_get_string_size(Bigint, 10) : 0;
+    if (Size == 0)
+    {
+        return false;
+    }
+
+    TArray<ANSICHAR, TInlineAllocator<48>> Chars;
+    Chars.SetNumZeroed(static_cast<int32>(Size));
+    if (cardano_bigint_to_string(Bigint, Chars.GetData(), Size, 10) != CARDANO_SUCCESS)
+    {
+        return false;
+    }
+
+    return FromString(FString(ANSI_TO_TCHAR(Chars.GetData())), OutQuantity);
+}
+
+FString FCardanoQuantity::ToString() const
+{
+    const FString Digits = magnitude_to_string(get_magnitude(*this));
+    return IsNegative() ? TEXT("-") + Digits : Digits;
+}
+
+FString FCardanoQuantity::ToDecimalString(int32 Decimals) const
+{
+    Decimals = FMath::Clamp(Decimals, 0, MAX_DECIMALS);
+
+    FString Digits = magnitude_to_string(get_magnitude(*this));
+    if (Digits.Len() <= Decimals)
+    {
+        Digits = FString::ChrN(Decimals + 1 - Digits.Len(), TEXT('0')) + Digits;
+    }
+
+    FString Whole = Digits.Left(Digits.Len() - Decimals);
+    FString Fraction = Digits.Right(Decimals);
+    while (Fraction.EndsWith(TEXT("0")))
+    {
+        Fraction.LeftChopInline(1, false);
+    }
+
+    FString Text = IsNegative() ? TEXT("-") + Whole : Whole;
+    if (!Fraction.IsEmpty())
+    {
+        Text += TEXT(".") + Fraction;
+    }
+    return Text;
+}
+
+bool FCardanoQuantity::ToInt64(int64& OutValue) const
+{
+    const bool bFits = IsNegative() ? (High == MAX_uint64 && (Low & SIGN_BIT) != 0) : (High == 0 && (Low & SIGN_BIT) == 0);
+    if (bFits)
+    {
+        OutValue = static_cast<int64>(Low);
+    }
+    return bFits;
+}
+
+bool FCardanoQuantity::ToUInt64(uint64& OutValue) const
+{
+    if (High != 0)
+    {
+        return false;
+    }
+    OutValue = Low;
+    return true;
+}
+
+bool FCardanoQuantity::ToBigint(cardano_bigint_t** OutBigint) const
+{
+    const FTCHARToUTF8 Text(*ToString());
+    return cardano_bigint_from_string(Text.Get(), Text.Length(), 10, OutBigint) == CARDANO_SUCCESS;
+}
+
+bool FCardanoQuantity::Add(const FCardanoQuantity& A, const FCardanoQuantity& B, FCardanoQuantity& OutResult)
+{
+    FCardanoQuantity Sum;
+    Sum.Low = A.Low + B.Low;
+    Sum.High = A.High + B.High + (Sum.Low < A.Low ? 1 : 0);
+
+    // Overflows only when both operands have the same sign and the sum has the other
+    if (A.IsNegative() == B.IsNegative() && Sum.IsNegative() != A.IsNegative())
+    {
+        return false;
+    }
+
+    OutResult = Sum;
+    return true;
+}
+
+bool FCardanoQuantity::Subtract(const FCardanoQuantity& A, const FCardanoQuantity& B, FCardanoQuantity& OutResult)
+{
+    FCardanoQuantity Difference;
+    Difference.Low = A.Low - B.Low;
+    Difference.High = A.High - B.High - (A.Low < B.Low ? 1 : 0);
+
+    if (A.IsNegative() != B.IsNegative() && Difference.IsNegative() != A.IsNegative())
+    {
+        return false;
+    }
+
+    OutResult = Difference;
+    return true;
+}
+
+bool FCardanoQuantity::Multiply(const FCardanoQuantity& A, int64 B, FCardanoQuantity& OutResult)
+{
+    const uint64 Factor = B < 0 ? ~static_cast<uint64>(B) + 1 : static_cast<uint64>(B);
+
+    FMagnitude Product;
+    return multiply_magnitude(get_magnitude(A), Factor, Product) &&
+        from_magnitude(Product, !(Product.Low == 0 && Product.High == 0) && (A.IsNegative() != (B < 0)), OutResult);
+}
+
+bool FCardanoQuantity::Divide(const FCardanoQuantity& A, int64 B, FCardanoQuantity& OutQuotient, FCardanoQuantity& OutRemainder)
+{
+    if (B == 0)
+    {
+        return false;
+    }
+
+    const uint64 Divisor = B < 0 ? ~static_cast<uint64>(B) + 1 : static_cast<uint64>(B);
+
+    FMagnitude Quotient;
+    const FMagnitude Remainder{ divide_magnitude(get_magnitude(A), Divisor, Quotient), 0 };
+
+    FCardanoQuantity SignedQuotient;
+    FCardanoQuantity SignedRemainder;
+    if (!from_magnitude(Quotient, A.IsNegative() != (B < 0), SignedQuotient) ||
+        !from_magnitude(Remainder, A.IsNegative(), SignedRemainder))
+    {
+        return false;
+    }
+
+    OutQuotient = SignedQuotient;
+    OutRemainder = SignedRemainder;
+    return true;
+}
+
+int32 FCardanoQuantity::Compare(const FCardanoQuantity& A, const FCardanoQuantity& B)
+{
+    if (A.High != B.High)
+    {
+        return static_cast<int64>(A.High) < static_cast<int64>(B.High) ? -1 : 1;
+    }
+    if (A.Low != B.Low)
+    {
+        return A.Low < B.Low ? -1 : 1;
+    }
+    return 0;
+}
+
+bool FCardanoQuantity::Serialize(FArchive& Ar)
+{
+    Ar << Low << High;
+    return true;
+}
+
+bool FCardanoQuantity::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar << Low << High;
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
+
+bool FCardanoQuantity::ExportTextItem(FString& ValueStr, const FCardanoQuantity& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const
+{
+    ValueStr += ToString();
+    return true;
+}
+
+bool FCardanoQuantity::ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText)
+{
+    int32 Length = (*Buffer == TEXT('-') || *Buffer == TEXT('+')) ? 1 : 0;
+    while (FChar::IsDigit(Buffer[Length]))
+    {
+        ++Length;
+    }
+
+    if (!FromString(FString(Length, Buffer), *this))
+    {
+        return false;
+    }
+
+    Buffer += Length;
+    return true;
+}
+
+bool UCardanoQuantityLibrary::MakeQuantityFromString(const FString& Text, FCardanoQuantity& OutQuantity)
+{
+    OutQuantity = FCardanoQuantity();
+    return FCardanoQuantity::FromString(Text, OutQuantity);
+}
+
+bool UCardanoQuantityLibrary::MakeQuantityFromDecimalString(const FString& Text, int32 Decimals, FCardanoQuantity& OutQuantity)
+{
+    OutQuantity = FCardanoQuantity();
+    return FCardanoQuantity::FromDecimalString(Text, Decimals, OutQuantity);
+}
+
+bool UCardanoQuantityLibrary::ToInt64(const FCardanoQuantity& Quantity, int64& OutValue)
+{
+    OutValue = 0;
+    return Quantity.ToInt64(OutValue);
+}
+
+FCardanoQuantity UCardanoQuantityLibrary::GetTokenQuantity(const FTokenBalance& Token)
+{
+    FCardanoQuantity Quantity;
+    FCardanoQuantity::FromString(Token.Quantity, Quantity);
+    return Quantity;
+}
+
+FCardanoQuantity UCardanoQuantityLibrary::SumTokenQuantity(const TArray<FTokenBalance>& Tokens, const FString& PolicyId, const FString& AssetName)
+{
+    FCardanoQuantity Total;
+    for (const FTokenBalance& Token : Tokens)
+    {
+        if (Token.PolicyId == PolicyId && Token.AssetName == AssetName)
+        {
+            Total = Add_QuantityQuantity(Total, GetTokenQuantity(Token));
+        }
+    }
+    return Total;
+}
+
+FCardanoQuantity UCardanoQuantityLibrary::Add_QuantityQuantity(const FCardanoQuantity& A, const FCardanoQuantity& B)
+{
+    FCardanoQuantity Result;
+    return FCardanoQuantity::Add(A, B, Result) ? Result : saturate(!A.IsNegative(), TEXT("addition"));
+}
+
+FCardanoQuantity UCardanoQuantityLibrary::Subtract_QuantityQuantity(const FCardanoQuantity& A, const FCardanoQuantity& B)
+{
+    FCardanoQuantity Result;
+    return FCardanoQuantity::Subtract(A, B, Result) ? Result : saturate(!A.IsNegative(), TEXT("subtraction"));
+}
+
+FCardanoQuantity UCardanoQuantityLibrary::Multiply_QuantityInt64(const FCardanoQuantity& A, int64 B)
+{
+    FCardanoQuantity Result;
+    return FCardanoQuantity::Multiply(A, B, Result) ? Result : saturate(A.IsNegative() == (B < 0), TEXT("multiplication"));
+}
+
+FCardanoQuantity UCardanoQuantityLibrary::Divide_QuantityInt64(const FCardanoQuantity& A, int64 B, FCardanoQuantity& Remainder)
+{
+    Remainder = FCardanoQuantity();
+    if (B == 0)
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Quantity division by zero"));
+        return FCardanoQuantity();
+    }
+
+    // Only the most negative quantity divided by -1 overflows
+    FCardanoQuantity Quotient;
+    return FCardanoQuantity::Divide(A, B, Quotient, Remainder) ? Quotient : saturate(true, TEXT("division"));
+}
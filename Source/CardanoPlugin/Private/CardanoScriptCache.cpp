@@ -0,0 +1,621 @@
+#include "CardanoScriptCache.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoLog.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "Engine/Engine.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IHttpResponse.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+struct UCardanoScriptCache::FFetchRequest
+{
+    FOnReferenceInputsResult OnComplete;
+    int32 PendingReferences = 0;
+    FString FirstError;
+};
+
+static FString MakeUTxOInfoBody(const TArray<FCardanoUTxORef>& Refs)
+{
+    FString RequestBody;
+    RequestBody.Reserve(64 + Refs.Num() * 72);
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBody);
+
+    Writer->WriteObjectStart();
+    Writer->WriteArrayStart(TEXT("_utxo_refs"));
+    for (const FCardanoUTxORef& Ref : Refs)
+    {
+        Writer->WriteValue(Ref.ToString());
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteValue(TEXT("_extended"), true);
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return RequestBody;
+}
+
+/** Hex of the CBOR Script is placed in a script reference with, or an empty string if it cannot be encoded. */
+static FString ScriptToCborHex(cardano_script_t* Script)
+{
+    FString Hex;
+    cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+    if (writer && cardano_script_to_cbor(Script, writer) == CARDANO_SUCCESS)
+    {
+        TArray<ANSICHAR> Buffer;
+        Buffer.SetNumZeroed(static_cast<int32>(cardano_cbor_writer_get_hex_size(writer)));
+        if (Buffer.Num() > 0 && cardano_cbor_writer_encode_hex(writer, Buffer.GetData(), Buffer.Num()) == CARDANO_SUCCESS)
+        {
+            Hex = ANSI_TO_TCHAR(Buffer.GetData());
+        }
+    }
+    cardano_cbor_writer_unref(&writer);
+    return Hex;
+}
+
+/** Creates the script of a Koios reference_script object: Plutus scripts from their bytes, native ones from their CBOR. */
+static cardano_error_t CreateKoiosScript(const FString& Type, const FString& BytesHex, cardano_script_t** OutScript)
+{
+    const FTCHARToUTF8 Hex(*BytesHex);
+    cardano_error_t result = CARDANO_ERROR_INVALID_ARGUMENT;
+
+    if (Type == TEXT("plutusV1"))
+    {
+        cardano_plutus_v1_script_t* plutus = nullptr;
+        result = cardano_plutus_v1_script_new_bytes_from_hex(Hex.Get(), Hex.Length(), &plutus);
+        if (result == CARDANO_SUCCESS) result = cardano_script_new_plutus_v1(plutus, OutScript);
+        cardano_plutus_v1_script_unref(&plutus);
+    }
+    else if (Type == TEXT("plutusV2"))
+    {
+        cardano_plutus_v2_script_t* plutus = nullptr;
+        result = cardano_plutus_v2_script_new_bytes_from_hex(Hex.Get(), Hex.Length(), &plutus);
+        if (result == CARDANO_SUCCESS) result = cardano_script_new_plutus_v2(plutus, OutScript);
+        cardano_plutus_v2_script_unref(&plutus);
+    }
+    else if (Type == TEXT("plutusV3"))
+    {
+        cardano_plutus_v3_script_t* plutus = nullptr;
+        result = cardano_plutus_v3_script_new_bytes_from_hex(Hex.Get(), Hex.Length(), &plutus);
+        if (result == CARDANO_SUCCESS) result = cardano_script_new_plutus_v3(plutus, OutScript);
+        cardano_plutus_v3_script_unref(&plutus);
+    }
+    else if (Type == TEXT("timelock") || Type == TEXT("multisig"))
+    {
+        cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(Hex.Get(), Hex.Length());
+        cardano_native_script_t* native = nullptr;
+        result = reader ? cardano_native_script_from_cbor(reader, &native) : CARDANO_ERROR_DECODING;
+        if (result == CARDANO_SUCCESS) result = cardano_script_new_native(native, OutScript);
+        cardano_native_script_unref(&native);
+        cardano_cbor_reader_unref(&reader);
+    }
+
+    return result;
+}
+
+/** Reads a utxo_info row into a record, and the script it carries into OutScript if it has one. */
+static FString ParseReferenceRow(const FJsonObject& Row, FCardanoCachedReferenceRecord& OutRecord, FCardanoCachedScriptRecord& OutScript)
+{
+    FUTxO UTxO;
+    if (!ParseUTxO(Row, UTxO) || !Row.TryGetStringField("address", OutRecord.Address))
+    {
+        return TEXT("Reference input is spent or incomplete");
+    }
+
+    OutRecord.TxHash = UTxO.TxHash.ToLower();
+    OutRecord.TxIndex = UTxO.TxIndex;
+    OutRecord.Value = UTxO.Value;
+    OutRecord.Assets = MoveTemp(UTxO.Assets);
+
+    const TSharedPtr<FJsonObject>* InlineDatum = nullptr;
+    if (Row.TryGetObjectField("inline_datum", InlineDatum) && InlineDatum)
+    {
+        (*InlineDatum)->TryGetStringField("bytes", OutRecord.InlineDatum);
+    }
+    else
+    {
+        Row.TryGetStringField("datum_hash", OutRecord.DatumHash);
+    }
+
+    const TSharedPtr<FJsonObject>* Script = nullptr;
+    if (!Row.TryGetObjectField("reference_script", Script) || !Script)
+    {
+        return FString();
+    }
+
+    FString Type;
+    FString Bytes;
+    if (!(*Script)->TryGetStringField("hash", OutRecord.ScriptHash) || !(*Script)->TryGetStringField("type", Type) || !(*Script)->TryGetStringField("bytes", Bytes))
+    {
+        return TEXT("Incomplete reference script");
+    }
+
+    cardano_script_t* script = nullptr;
+    if (CreateKoiosScript(Type, Bytes, &script) != CARDANO_SUCCESS)
+    {
+        return FString::Printf(TEXT("Unsupported or malformed %s reference script"), *Type);
+    }
+
+    OutRecord.ScriptHash = OutRecord.ScriptHash.ToLower();
+    OutScript.Hash = OutRecord.ScriptHash;
+    OutScript.Cbor = ScriptToCborHex(script);
+    cardano_script_unref(&script);
+    return FString();
+}
+
+UCardanoScriptCache* UCardanoScriptCache::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoScriptCache>() : nullptr;
+}
+
+void UCardanoScriptCache::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Collection.InitializeDependency(UCardanoKoiosClient::StaticClass());
+
+    LoadFromDisk();
+
+    // Failures are logged by CompleteReference; builders fetch what is still missing on demand
+    if (PrefetchReferenceInputs.Num() > 0)
+    {
+        FetchReferenceInputs(PrefetchReferenceInputs, FOnReferenceInputsResult());
+    }
+}
+
+void UCardanoScriptCache::Deinitialize()
+{
+    if (SaveHandle.IsValid())
+    {
+        FTicker::GetCoreTicker().RemoveTicker(SaveHandle);
+        SaveToDisk(0.0f);
+    }
+
+    InFlight.Empty();
+    ReleaseAll();
+
+    Super::Deinitialize();
+}
+
+bool UCardanoScriptCache::ParseReference(const FString& Reference, FCardanoUTxORef& OutRef)
+{
+    FString TxHash;
+    FString TxIndex;
+    if (!Reference.Split(TEXT("#"), &TxHash, &TxIndex) || TxIndex.IsEmpty() || !TxIndex.IsNumeric())
+    {
+        return false;
+    }
+
+    OutRef.TxIndex = static_cast<uint32>(FCString::Atoi64(*TxIndex));
+    return FCardanoHash32::FromHex(TxHash, OutRef.TxHash);
+}
+
+void UCardanoScriptCache::FetchReferenceInputs(const TArray<FString>& InReferences, const FOnReferenceInputsResult& OnComplete)
+{
+    TSharedRef<FFetchRequest> Request = MakeShared<FFetchRequest>();
+    Request->OnComplete = OnComplete;
+
+    TArray<FCardanoUTxORef> ToFetch;
+    for (const FString& Reference : InReferences)
+    {
+        FCardanoUTxORef Ref;
+        if (!ParseReference(Reference, Ref))
+        {
+            Request->FirstError = Request->FirstError.IsEmpty() ? FString::Printf(TEXT("Invalid reference %s"), *Reference) : Request->FirstError;
+            continue;
+        }
+        if (References.Contains(Ref))
+        {
+            continue;
+        }
+
+        TArray<TSharedRef<FFetchRequest>>* Waiting = InFlight.Find(Ref);
+        if (Waiting && Waiting->Contains(Request))
+        {
+            continue;
+        }
+
+        ++Request->PendingReferences;
+        if (Waiting)
+        {
+            Waiting->Add(Request);
+            continue;
+        }
+
+        InFlight.Add(Ref).Add(Request);
+        ToFetch.Add(Ref);
+    }
+
+    if (Request->PendingReferences == 0)
+    {
+        Request->OnComplete.ExecuteIfBound(Request->FirstError.IsEmpty(), Request->FirstError);
+        return;
+    }
+
+    const int32 ChunkSize = UCardanoKoiosClient::Get()->GetMaxAddressesPerRequest();
+    for (int32 Start = 0; Start < ToFetch.Num(); Start += ChunkSize)
+    {
+        FetchBatch(TArray<FCardanoUTxORef>(ToFetch.GetData() + Start, FMath::Min(ChunkSize, ToFetch.Num() - Start)));
+    }
+}
+
+bool UCardanoScriptCache::IsReferenceInputCached(const FString& Reference) const
+{
+    FCardanoUTxORef Ref;
+    return ParseReference(Reference, Ref) && References.Contains(Ref);
+}
+
+cardano_utxo_t* UCardanoScriptCache::FindReferenceInput(const FCardanoUTxORef& Ref) const
+{
+    const FReferenceEntry* Entry = References.Find(Ref);
+    if (!Entry)
+    {
+        return nullptr;
+    }
+
+    cardano_utxo_ref(Entry->UTxO);
+    return Entry->UTxO;
+}
+
+cardano_script_t* UCardanoScriptCache::FindScript(const FCardanoHash28& Hash) const
+{
+    const FScriptEntry* Entry = Scripts.Find(Hash);
+    if (!Entry)
+    {
+        return nullptr;
+    }
+
+    cardano_script_ref(Entry->Script);
+    return Entry->Script;
+}
+
+int32 UCardanoScriptCache::GetScriptSize(const FCardanoHash28& Hash) const
+{
+    const FScriptEntry* Entry = Scripts.Find(Hash);
+    return Entry ? Entry->Size : -1;
+}
+
+bool UCardanoScriptCache::AddScript(cardano_script_t* Script, FCardanoHash28& OutHash)
+{
+    cardano_blake2b_hash_t* hash = cardano_script_get_hash(Script);
+    if (!hash)
+    {
+        return false;
+    }
+
+    FCardanoCachedScriptRecord Record;
+    Record.Hash = hash_to_hex(hash);
+    Record.Cbor = ScriptToCborHex(Script);
+    cardano_blake2b_hash_unref(&hash);
+
+    if (!FCardanoHash28::FromHex(Record.Hash, OutHash) || !AddScriptRecord(Record))
+    {
+        return false;
+    }
+
+    ScheduleSave();
+    return true;
+}
+
+void UCardanoScriptCache::Clear()
+{
+    ReleaseAll();
+    IFileManager::Get().Delete(*GetCacheFilePath(), false, false, true);
+}
+
+bool UCardanoScriptCache::AddScriptRecord(const FCardanoCachedScriptRecord& Record)
+{
+    FCardanoHash28 Hash;
+    if (!FCardanoHash28::FromHex(Record.Hash, Hash))
+    {
+        return false;
+    }
+    if (Scripts.Contains(Hash))
+    {
+        return true;
+    }
+
+    // Decoded from CBOR rather than kept as built, so the script carries its encoding and re-serializes it as is
+    const FTCHARToUTF8 Cbor(*Record.Cbor);
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(Cbor.Get(), Cbor.Length());
+    cardano_script_t* script = nullptr;
+    cardano_error_t result = reader ? cardano_script_from_cbor(reader, &script) : CARDANO_ERROR_DECODING;
+    cardano_cbor_reader_unref(&reader);
+
+    // Content addressing only holds if the bytes hash to the key they are filed under
+    cardano_blake2b_hash_t* hash = result == CARDANO_SUCCESS ? cardano_script_get_hash(script) : nullptr;
+    const bool bHashMatches = hash && cardano_blake2b_hash_get_bytes_size(hash) == FCardanoHash28::Size
+        && FMemory::Memcmp(cardano_blake2b_hash_get_data(hash), Hash.Bytes, FCardanoHash28::Size) == 0;
+    cardano_blake2b_hash_unref(&hash);
+
+    size_t size = 0;
+    if (!bHashMatches || cardano_get_serialized_script_size(script, &size) != CARDANO_SUCCESS)
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Script %s does not decode to its hash"), *Record.Hash);
+        cardano_script_unref(&script);
+        return false;
+    }
+
+    cardano_script_freeze(script);
+
+    FScriptEntry& Entry = Scripts.Add(Hash);
+    Entry.Script = script;
+    Entry.Size = static_cast<int32>(size);
+    Entry.Record = Record;
+    return true;
+}
+
+bool UCardanoScriptCache::AddReferenceRecord(const FCardanoCachedReferenceRecord& Record)
+{
+    FCardanoUTxORef Ref;
+    FCardanoHash28 ScriptHash;
+    if (!FCardanoHash32::FromHex(Record.TxHash, Ref.TxHash))
+    {
+        return false;
+    }
+    Ref.TxIndex = static_cast<uint32>(Record.TxIndex);
+
+    const FScriptEntry* Script = nullptr;
+    if (!Record.ScriptHash.IsEmpty())
+    {
+        Script = FCardanoHash28::FromHex(Record.ScriptHash, ScriptHash) ? Scripts.Find(ScriptHash) : nullptr;
+        if (!Script)
+        {
+            return false;
+        }
+    }
+
+    FUTxO UTxO;
+    UTxO.TxHash = Record.TxHash;
+    UTxO.TxIndex = Record.TxIndex;
+    UTxO.Value = Record.Value;
+    UTxO.Assets = Record.Assets;
+
+    cardano_address_t* owner = nullptr;
+    cardano_utxo_t* utxo = nullptr;
+    cardano_transaction_output_t* output = nullptr;
+    cardano_plutus_data_t* data = nullptr;
+    cardano_datum_t* datum = nullptr;
+
+    const FTCHARToUTF8 Address(*Record.Address);
+    cardano_error_t result = cardano_address_from_string(Address.Get(), Address.Length(), &owner);
+    if (result == CARDANO_SUCCESS) result = create_utxo(owner, UTxO, &utxo);
+    if (result == CARDANO_SUCCESS)
+    {
+        output = cardano_utxo_get_output(utxo);
+        result = output ? CARDANO_SUCCESS : CARDANO_ERROR_POINTER_IS_NULL;
+    }
+
+    if (result == CARDANO_SUCCESS && !Record.InlineDatum.IsEmpty())
+    {
+        const FTCHARToUTF8 Cbor(*Record.InlineDatum);
+        cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(Cbor.Get(), Cbor.Length());
+        result = reader ? cardano_plutus_data_from_cbor(reader, &data) : CARDANO_ERROR_DECODING;
+        cardano_cbor_reader_unref(&reader);
+        if (result == CARDANO_SUCCESS) result = cardano_datum_new_inline_data(data, &datum);
+    }
+    else if (result == CARDANO_SUCCESS && !Record.DatumHash.IsEmpty())
+    {
+        const FTCHARToUTF8 Hex(*Record.DatumHash);
+        result = cardano_datum_new_data_hash_hex(Hex.Get(), Hex.Length(), &datum);
+    }
+
+    if (result == CARDANO_SUCCESS && datum) result = cardano_transaction_output_set_datum(output, datum);
+    if (result == CARDANO_SUCCESS && Script) result = cardano_transaction_output_set_script_ref(output, Script->Script);
+
+    cardano_datum_unref(&datum);
+    cardano_plutus_data_unref(&data);
+    cardano_transaction_output_unref(&output);
+    cardano_address_unref(&owner);
+
+    if (result != CARDANO_SUCCESS)
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Failed to build reference input %s#%d: %s"), *Record.TxHash, Record.TxIndex, UTF8_TO_TCHAR(cardano_error_to_string(result)));
+        cardano_utxo_unref(&utxo);
+        return false;
+    }
+
+    cardano_utxo_freeze(utxo);
+
+    FReferenceEntry* Existing = References.Find(Ref);
+    if (Existing)
+    {
+        cardano_utxo_unref(&Existing->UTxO);
+    }
+
+    FReferenceEntry& Entry = References.Add(Ref);
+    Entry.UTxO = utxo;
+    Entry.Record = Record;
+    return true;
+}
+
+void UCardanoScriptCache::FetchBatch(const TArray<FCardanoUTxORef>& Refs)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateJsonPost(TEXT("utxo_info"), MakeUTxOInfoBody(Refs));
+
+    TWeakObjectPtr<UCardanoScriptCache> WeakThis(this);
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Refs](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            FString Error;
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            if (!Success || !Response.IsValid())
+            {
+                Error = TEXT("Network request failed");
+            }
+            else if (Response->GetResponseCode() != 200)
+            {
+                Error = FString::Printf(TEXT("Koios returned HTTP %d"), Response->GetResponseCode());
+            }
+            else if (!ParseJsonArray(Response, JsonArray))
+            {
+                Error = TEXT("Invalid response format");
+            }
+
+            TMap<FCardanoUTxORef, TSharedPtr<FJsonObject>> Rows;
+            for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+            {
+                TSharedPtr<FJsonObject> Row = Item->AsObject();
+                FString TxHash;
+                int32 TxIndex = 0;
+                FCardanoUTxORef Ref;
+                if (Row.IsValid() && Row->TryGetStringField("tx_hash", TxHash) && Row->TryGetNumberField("tx_index", TxIndex)
+                    && FCardanoHash32::FromHex(TxHash, Ref.TxHash))
+                {
+                    Ref.TxIndex = static_cast<uint32>(TxIndex);
+                    Rows.Add(Ref, Row);
+                }
+            }
+
+            bool bAdded = false;
+            for (const FCardanoUTxORef& Ref : Refs)
+            {
+                const TSharedPtr<FJsonObject>* Row = Rows.Find(Ref);
+                if (!Error.IsEmpty() || !Row)
+                {
+                    WeakThis->CompleteReference(Ref, Error.IsEmpty() ? FString::Printf(TEXT("Reference input %s not found"), *Ref.ToString()) : Error);
+                    continue;
+                }
+
+                FCardanoCachedReferenceRecord Record;
+                FCardanoCachedScriptRecord Script;
+                FString RowError = ParseReferenceRow(**Row, Record, Script);
+                if (RowError.IsEmpty() && !Script.Hash.IsEmpty() && !WeakThis->AddScriptRecord(Script))
+                {
+                    RowError = FString::Printf(TEXT("Reference script %s does not match its hash"), *Script.Hash);
+                }
+                if (RowError.IsEmpty() && !WeakThis->AddReferenceRecord(Record))
+                {
+                    RowError = TEXT("Failed to build the reference input");
+                }
+
+                bAdded |= RowError.IsEmpty();
+                WeakThis->CompleteReference(Ref, RowError.IsEmpty() ? RowError : FString::Printf(TEXT("%s: %s"), *Ref.ToString(), *RowError));
+            }
+
+            if (bAdded)
+            {
+                WeakThis->ScheduleSave();
+            }
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+}
+
+void UCardanoScriptCache::CompleteReference(const FCardanoUTxORef& Ref, const FString& ErrorMessage)
+{
+    TArray<TSharedRef<FFetchRequest>> Waiting;
+    if (!InFlight.RemoveAndCopyValue(Ref, Waiting))
+    {
+        return;
+    }
+
+    if (!ErrorMessage.IsEmpty())
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Failed to fetch reference input: %s"), *ErrorMessage);
+    }
+
+    for (const TSharedRef<FFetchRequest>& Request : Waiting)
+    {
+        if (!ErrorMessage.IsEmpty() && Request->FirstError.IsEmpty())
+        {
+            Request->FirstError = ErrorMessage;
+        }
+        if (--Request->PendingReferences == 0)
+        {
+            Request->OnComplete.ExecuteIfBound(Request->FirstError.IsEmpty(), Request->FirstError);
+        }
+    }
+}
+
+FString UCardanoScriptCache::GetCacheFilePath() const
+{
+    return FPaths::ProjectSavedDir() / TEXT("Cardano") / TEXT("ReferenceScripts.json");
+}
+
+void UCardanoScriptCache::LoadFromDisk()
+{
+    FString JsonString;
+    if (!FFileHelper::LoadFileToString(JsonString, *GetCacheFilePath()))
+    {
+        return;
+    }
+
+    FCardanoScriptCacheFile Loaded;
+    if (!FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &Loaded, 0, 0))
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Ignoring unreadable reference script cache"));
+        return;
+    }
+
+    // Scripts first, since the reference inputs carrying them point at the decoded copies
+    for (const FCardanoCachedScriptRecord& Record : Loaded.Scripts)
+    {
+        AddScriptRecord(Record);
+    }
+    for (const FCardanoCachedReferenceRecord& Record : Loaded.References)
+    {
+        AddReferenceRecord(Record);
+    }
+    UE_LOG(LogCardano, Log, TEXT("Loaded %d cached scripts and %d reference inputs"), Scripts.Num(), References.Num());
+}
+
+void UCardanoScriptCache::ScheduleSave()
+{
+    if (!SaveHandle.IsValid())
+    {
+        SaveHandle = FTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &UCardanoScriptCache::SaveToDisk), 1.0f);
+    }
+}
+
+bool UCardanoScriptCache::SaveToDisk(float DeltaTime)
+{
+    SaveHandle.Reset();
+
+    FCardanoScriptCacheFile File;
+    File.Scripts.Reserve(Scripts.Num());
+    for (const TPair<FCardanoHash28, FScriptEntry>& Entry : Scripts)
+    {
+        File.Scripts.Add(Entry.Value.Record);
+    }
+    File.References.Reserve(References.Num());
+    for (const TPair<FCardanoUTxORef, FReferenceEntry>& Entry : References)
+    {
+        File.References.Add(Entry.Value.Record);
+    }
+
+    FString JsonString;
+    if (!FJsonObjectConverter::UStructToJsonObjectString(File, JsonString) ||
+        !FFileHelper::SaveStringToFile(JsonString, *GetCacheFilePath()))
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Failed to persist the reference script cache"));
+    }
+
+    // One-shot
+    return false;
+}
+
+void UCardanoScriptCache::ReleaseAll()
+{
+    for (TPair<FCardanoUTxORef, FReferenceEntry>& Entry : References)
+    {
+        cardano_utxo_unref(&Entry.Value.UTxO);
+    }
+    for (TPair<FCardanoHash28, FScriptEntry>& Entry : Scripts)
+    {
+        cardano_script_unref(&Entry.Value.Script);
+    }
+
+    References.Empty();
+    Scripts.Empty();
+}
@@ -0,0 +1,287 @@
+#include "CardanoSendAction.h"
+#include "CardanoChainTip.h"
+#include "CardanoLog.h"
+#include "CardanoMetrics.h"
+#include "CardanoNative.h"
+#include "CardanoPrefetch.h"
+#include "CardanoProtocolParamsCache.h"
+#include "CardanoUTxOCache.h"
+
+namespace
+{
+    FCardanoHistogram& submit_latency()
+    {
+        static FCardanoHistogram& Latency = FCardanoMetrics::Get().Histogram(TEXT("cardano_send_submit_duration_seconds"),
+            TEXT("Time from the start of a SendAsync flow to its transaction being queued for submission."));
+        return Latency;
+    }
+}
+
+UCardanoSendAction* UCardanoSendAction::SendAsync(FCardanoWalletHandle Wallet, const TArray<FTransactionOutput>& Outputs, const FString& Password)
+{
+    UCardanoSendAction* Action = NewObject<UCardanoSendAction>();
+    Action->Wallet = Wallet;
+    Action->Outputs = Outputs;
+    Action->Password = Password;
+    return Action;
+}
+
+void UCardanoSendAction::Activate()
+{
+    // Rooted until it finishes, since nothing else may reference the flow while it waits
+    AddToRoot();
+    StartTime = FPlatformTime::Seconds();
+
+    UCardanoWalletSubsystem* Wallets = UCardanoWalletSubsystem::Get();
+    if (!Wallets || !Wallets->IsWalletValid(Wallet))
+    {
+        Finish(OnFailure, ECardanoSubmitError::None, TEXT("Unknown wallet"));
+        return;
+    }
+
+    if (Wallets->IsWatchOnly(Wallet))
+    {
+        Finish(OnFailure, ECardanoSubmitError::None, TEXT("Wallet is watch-only"));
+        return;
+    }
+
+    TCardanoTask<TArray<uint8>> UnsignedTransaction;
+    TArray<uint8> Prefetched;
+    UCardanoPrefetch* Prefetch = UCardanoPrefetch::Get();
+    if (Prefetch && Prefetch->TakeTransaction(Wallet, Outputs, Prefetched))
+    {
+        UnsignedTransaction = TCardanoTask<TArray<uint8>>::FromValue(MoveTemp(Prefetched));
+    }
+    else
+    {
+        // Both fetches are started before either is waited for
+        const TCardanoTask<FCardanoProtocolParameters> Parameters = FetchParameters();
+        const TCardanoTask<TMap<FString, FAddressUTxOs>> UTxOs = FetchUTxOs();
+
+        UnsignedTransaction = CardanoWhenBoth(Parameters, UTxOs)
+            .Next([this](TTuple<FCardanoProtocolParameters, TMap<FString, FAddressUTxOs>>&& Inputs)
+                {
+                    return BuildPayment(Wallet, Outputs, Inputs.Get<0>(), Inputs.Get<1>());
+                });
+    }
+
+    UnsignedTransaction
+        .Next([this](TArray<uint8>&& Transaction)
+            {
+                return Sign(Transaction);
+            })
+        .Then([this](TCardanoTaskResult<TArray<uint8>>&& Signed)
+            {
+                if (!Signed.IsSuccess())
+                {
+                    Finish(OnFailure, ECardanoSubmitError::None, Signed.Error);
+                    return;
+                }
+                Submit(Signed.Value.GetValue());
+            });
+}
+
+TCardanoTask<FCardanoProtocolParameters> UCardanoSendAction::FetchParameters()
+{
+    UCardanoProtocolParamsCache* ParamsCache = UCardanoProtocolParamsCache::Get();
+    if (!ParamsCache)
+    {
+        return TCardanoTask<FCardanoProtocolParameters>::FromError(TEXT("Protocol parameters cache is not available"));
+    }
+
+    // Completes right away when the cached parameters belong to the current epoch
+    FOnProtocolParametersResult OnComplete;
+    OnComplete.BindDynamic(this, &UCardanoSendAction::OnParameters);
+    ParamsCache->GetParameters(OnComplete);
+    return ParametersTask;
+}
+
+TCardanoTask<TMap<FString, FAddressUTxOs>> UCardanoSendAction::FetchUTxOs()
+{
+    TMap<FString, FAddressUTxOs> UTxOs;
+    if (ReadWalletUTxOs(Wallet, UTxOs))
+    {
+        return TCardanoTask<TMap<FString, FAddressUTxOs>>::FromValue(MoveTemp(UTxOs));
+    }
+
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (!Cache)
+    {
+        return TCardanoTask<TMap<FString, FAddressUTxOs>>::FromError(TEXT("UTxO cache is not available"));
+    }
+
+    FOnUTxOCacheRefreshed OnComplete;
+    OnComplete.BindDynamic(this, &UCardanoSendAction::OnUTxOsRefreshed);
+    Cache->RefreshAll(OnComplete);
+    return UTxOsTask;
+}
+
+TCardanoTask<TArray<uint8>> UCardanoSendAction::BuildPayment(FCardanoWalletHandle Wallet, const TArray<FTransactionOutput>& Outputs,
+    const FCardanoProtocolParameters& Parameters, const TMap<FString, FAddressUTxOs>& UTxOs)
+{
+    UCardanoWalletSubsystem* Wallets = UCardanoWalletSubsystem::Get();
+    UCardanoChainTip* ChainTip = UCardanoChainTip::Get();
+    if (!Wallets || !ChainTip)
+    {
+        return TCardanoTask<TArray<uint8>>::FromError(TEXT("Wallet subsystem is not available"));
+    }
+
+    // Everything reading UObjects is done here, so only the balancing itself runs on the worker
+    FString Error;
+    const FCardanoProvider Provider = FCardanoProvider::CreateOffline(static_cast<cardano_network_magic_t>(ChainTip->GetNetworkMagic()));
+    FCardanoTxBuilder Builder = FCardanoTxBuilder::Create(Parameters, Provider, Error);
+    if (!Builder.IsValid())
+    {
+        return TCardanoTask<TArray<uint8>>::FromError(MoveTemp(Error));
+    }
+
+    const int64 Slot = ChainTip->GetTimeToLive(7200);
+    if (Slot <= 0)
+    {
+        return TCardanoTask<TArray<uint8>>::FromError(TEXT("Unable to compute a TTL for the transaction"));
+    }
+
+    Builder.SendOutputs(Outputs);
+    Builder.SetChangeAddress(Wallets->GetChangeAddress(Wallet));
+    Builder.SetUTxOs(UTxOs);
+    Builder.SetInvalidAfter(Slot);
+
+    return CardanoRunOnPool<TArray<uint8>>([Builder = MoveTemp(Builder)]() mutable
+        {
+            FString BuildError;
+            TArray<uint8> Cbor = Builder.BuildCbor(BuildError);
+            return Cbor.Num() > 0 ? TCardanoTaskResult<TArray<uint8>>::Success(MoveTemp(Cbor)) : TCardanoTaskResult<TArray<uint8>>::Failure(MoveTemp(BuildError));
+        });
+}
+
+TCardanoTask<TArray<uint8>> UCardanoSendAction::Sign(const TArray<uint8>& UnsignedTransaction)
+{
+    UCardanoWalletSubsystem* Wallets = UCardanoWalletSubsystem::Get();
+    if (!Wallets)
+    {
+        return TCardanoTask<TArray<uint8>>::FromError(TEXT("Wallet subsystem is not available"));
+    }
+
+    FOnWalletSigned OnComplete;
+    OnComplete.BindDynamic(this, &UCardanoSendAction::OnSigned);
+    Wallets->SignTransaction(Wallet, UnsignedTransaction, Password, OnComplete);
+    return SignTask;
+}
+
+void UCardanoSendAction::Submit(const TArray<uint8>& SignedTransaction)
+{
+    // The password is not needed past signing
+    Password.Empty();
+
+    UCardanoSubmissionQueue* Queue = UCardanoSubmissionQueue::Get();
+    if (!Queue)
+    {
+        Finish(OnFailure, ECardanoSubmitError::None, TEXT("Submission queue is not available"));
+        return;
+    }
+
+    FOnTransactionTracked OnComplete;
+    OnComplete.BindDynamic(this, &UCardanoSendAction::OnTracked);
+    TxHash = Queue->Enqueue(SignedTransaction, OnComplete);
+    if (bFinished)
+    {
+        return;
+    }
+
+    submit_latency().Observe(FPlatformTime::Seconds() - StartTime);
+    OnSubmitted.Broadcast(TxHash, ECardanoSubmitError::None, FString());
+}
+
+bool UCardanoSendAction::ReadWalletUTxOs(FCardanoWalletHandle Wallet, TMap<FString, FAddressUTxOs>& OutUTxOs)
+{
+    const UCardanoWalletSubsystem* Wallets = UCardanoWalletSubsystem::Get();
+    const UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    TArray<FString> Addresses;
+    if (!Wallets || !Cache || !Wallets->GetWalletAddresses(Wallet, Addresses))
+    {
+        return false;
+    }
+
+    TArray<FUTxO> UTxOs;
+    for (const FString& Address : Addresses)
+    {
+        if (!Cache->GetSpendableUTxOs(Address, UTxOs))
+        {
+            return false;
+        }
+        if (UTxOs.Num() > 0)
+        {
+            OutUTxOs.Add(Address).UTxOs = MoveTemp(UTxOs);
+        }
+    }
+    return true;
+}
+
+void UCardanoSendAction::OnParameters(bool bSuccess, const FCardanoProtocolParameters& Parameters, const FString& ErrorMessage)
+{
+    if (bSuccess)
+    {
+        ParametersTask.Succeed(Parameters);
+    }
+    else
+    {
+        ParametersTask.Fail(ErrorMessage);
+    }
+}
+
+void UCardanoSendAction::OnUTxOsRefreshed(bool bSuccess, const FString& ErrorMessage)
+{
+    TMap<FString, FAddressUTxOs> UTxOs;
+    if (!bSuccess)
+    {
+        UTxOsTask.Fail(ErrorMessage);
+    }
+    else if (!ReadWalletUTxOs(Wallet, UTxOs))
+    {
+        UTxOsTask.Fail(TEXT("The UTxOs of the wallet are not downloaded"));
+    }
+    else
+    {
+        UTxOsTask.Succeed(MoveTemp(UTxOs));
+    }
+}
+
+void UCardanoSendAction::OnSigned(bool bSuccess, const TArray<uint8>& SignedTransaction, const FString& ErrorMessage)
+{
+    if (bSuccess)
+    {
+        SignTask.Succeed(SignedTransaction);
+    }
+    else
+    {
+        SignTask.Fail(ErrorMessage);
+    }
+}
+
+void UCardanoSendAction::OnTracked(ECardanoTxOutcome Outcome, ECardanoSubmitError Error, const FString& InTxHash, const FString& ErrorMessage)
+{
+    if (!InTxHash.IsEmpty())
+    {
+        TxHash = InTxHash;
+    }
+    Finish(Outcome == ECardanoTxOutcome::Confirmed ? OnConfirmed : OnFailure, Error, ErrorMessage);
+}
+
+void UCardanoSendAction::Finish(const FOnCardanoSend& Delegate, ECardanoSubmitError Error, const FString& ErrorMessage)
+{
+    if (bFinished)
+    {
+        return;
+    }
+    bFinished = true;
+
+    if (&Delegate == &OnFailure)
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Send from wallet %d failed: %s"), Wallet.Id, *ErrorMessage);
+    }
+
+    Delegate.Broadcast(TxHash, Error, ErrorMessage);
+
+    SetReadyToDestroy();
+    RemoveFromRoot();
+}
@@ -0,0 +1,559 @@
+#include "CardanoSettlement.h"
+#include "CardanoBinaryCodec.h"
+#include "CardanoChainTip.h"
+#include "CardanoLog.h"
+#include "CardanoMetrics.h"
+#include "CardanoProtocolParamsCache.h"
+#include "CardanoSignDataVerifier.h"
+#include "CardanoSigningPipeline.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "CardanoUTxOCache.h"
+#include "Algo/StableSort.h"
+#include "Async/Async.h"
+
+// Validity window given to each payout, in slots past the tip
+static const int64 SETTLEMENT_TTL_SLOTS = 7200;
+
+static const uint8 SETTLEMENT_LEDGER_VERSION = 1;
+
+namespace
+{
+    FCardanoCounter& intent_counter(ECardanoIntentStatus Status)
+    {
+        static const TCHAR* Help = TEXT("Payment intents applied to a settlement ledger.");
+        static FCardanoCounter& Accepted = FCardanoMetrics::Get().Counter(TEXT("cardano_settlement_intents_total"), Help, FCardanoMetrics::MakeLabels(TEXT("result"), TEXT("accepted")));
+        static FCardanoCounter& Invalid = FCardanoMetrics::Get().Counter(TEXT("cardano_settlement_intents_total"), Help, FCardanoMetrics::MakeLabels(TEXT("result"), TEXT("invalid")));
+        static FCardanoCounter& BadSignature = FCardanoMetrics::Get().Counter(TEXT("cardano_settlement_intents_total"), Help, FCardanoMetrics::MakeLabels(TEXT("result"), TEXT("bad_signature")));
+        static FCardanoCounter& Replayed = FCardanoMetrics::Get().Counter(TEXT("cardano_settlement_intents_total"), Help, FCardanoMetrics::MakeLabels(TEXT("result"), TEXT("replayed")));
+        static FCardanoCounter& Insufficient = FCardanoMetrics::Get().Counter(TEXT("cardano_settlement_intents_total"), Help, FCardanoMetrics::MakeLabels(TEXT("result"), TEXT("insufficient_balance")));
+
+        switch (Status)
+        {
+        case ECardanoIntentStatus::Accepted: return Accepted;
+        case ECardanoIntentStatus::BadSignature: return BadSignature;
+        case ECardanoIntentStatus::Replayed: return Replayed;
+        case ECardanoIntentStatus::InsufficientBalance: return Insufficient;
+        default: return Invalid;
+        }
+    }
+
+    FCardanoCounter& payout_counter()
+    {
+        static FCardanoCounter& Payouts = FCardanoMetrics::Get().Counter(TEXT("cardano_settlement_payments_total"),
+            TEXT("Ledger accounts paid out by a queued settlement transaction."));
+        return Payouts;
+    }
+
+    void serialize_amounts(FArchive& Ar, TMap<FString, int64>& Amounts)
+    {
+        int32 Count = Amounts.Num();
+        if (!SerializeCount(Ar, Count))
+        {
+            return;
+        }
+
+        if (Ar.IsLoading())
+        {
+            Amounts.Reset();
+            for (int32 i = 0; i < Count && !Ar.IsError(); ++i)
+            {
+                FString Account;
+                int64 Amount = 0;
+                Ar << Account;
+                SerializeVarInt(Ar, Amount);
+                Amounts.Add(MoveTemp(Account), Amount);
+            }
+            return;
+        }
+
+        for (TPair<FString, int64>& Pair : Amounts)
+        {
+            Ar << Pair.Key;
+            SerializeVarInt(Ar, Pair.Value);
+        }
+    }
+
+    void serialize_payments(FArchive& Ar, TArray<FCardanoTxPayment>& Payments)
+    {
+        int32 Count = Payments.Num();
+        if (!SerializeCount(Ar, Count))
+        {
+            return;
+        }
+
+        if (Ar.IsLoading())
+        {
+            Payments.SetNum(Count);
+        }
+        for (int32 i = 0; i < Count && !Ar.IsError(); ++i)
+        {
+            Ar << Payments[i].Address;
+            SerializeVarInt(Ar, Payments[i].Lovelace);
+        }
+    }
+}
+
+FCardanoSettlementLedger::FCardanoSettlementLedger(const FString& InLedgerId, const FString& InTreasuryAccount)
+    : LedgerId(InLedgerId)
+    , TreasuryAccount(InTreasuryAccount)
+{
+}
+
+TArray<uint8> FCardanoSettlementLedger::MakeIntentPayload(const FString& LedgerId, const FString& From, const FString& To, int64 Lovelace, int64 Nonce)
+{
+    const FString Text = FString::Printf(TEXT("%s payment\nfrom: %s\nto: %s\nlovelace: %lld\nnonce: %lld"), *LedgerId, *From, *To, Lovelace, Nonce);
+    const FTCHARToUTF8 Utf8(*Text, Text.Len());
+    return TArray<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+}
+
+void FCardanoSettlementLedger::Credit(const FString& Account, int64 Lovelace)
+{
+    if (Lovelace > 0)
+    {
+        Balances.FindOrAdd(Account) += Lovelace;
+    }
+}
+
+void FCardanoSettlementLedger::ApplyIntents(const TArray<FCardanoPaymentIntent>& Intents, TArray<FCardanoIntentResult>& OutResults)
+{
+    OutResults.Reset(Intents.Num());
+    OutResults.SetNum(Intents.Num());
+
+    // Signatures are checked first, all in one batch, since they are what costs
+    TArray<FCardanoSignDataRequest> Requests;
+    TArray<int32> RequestIndices;
+    Requests.Reserve(Intents.Num());
+    RequestIndices.Init(INDEX_NONE, Intents.Num());
+    for (int32 i = 0; i < Intents.Num(); ++i)
+    {
+        const FCardanoPaymentIntent& Intent = Intents[i];
+        if (Intent.Lovelace <= 0 || Intent.From.IsEmpty() || Intent.To.IsEmpty() || Intent.From == Intent.To)
+        {
+            OutResults[i].Error = TEXT("An intent pays a positive amount to another account");
+            continue;
+        }
+
+        RequestIndices[i] = Requests.Num();
+        FCardanoSignDataRequest& Request = Requests.AddDefaulted_GetRef();
+        Request.Signature = Intent.Signature;
+        Request.Key = Intent.Key;
+        Request.Challenge = MakeIntentPayload(LedgerId, Intent.From, Intent.To, Intent.Lovelace, Intent.Nonce);
+        Request.ExpectedAddress = Intent.From;
+    }
+
+    TArray<FCardanoSignDataResult> Verified;
+    FCardanoSignDataVerifier::VerifyBatch(Requests, Verified);
+
+    // Then applied in order, so each one sees the balances and nonces the ones before it left
+    for (int32 i = 0; i < Intents.Num(); ++i)
+    {
+        const FCardanoPaymentIntent& Intent = Intents[i];
+        FCardanoIntentResult& Result = OutResults[i];
+
+        if (RequestIndices[i] != INDEX_NONE)
+        {
+            const FCardanoSignDataResult& Signature = Verified[RequestIndices[i]];
+            const int64* LastNonce = Nonces.Find(Intent.From);
+            int64* Balance = Balances.Find(Intent.From);
+
+            if (!Signature.bValid)
+            {
+                Result.Status = ECardanoIntentStatus::BadSignature;
+                Result.Error = Signature.Error;
+            }
+            else if (LastNonce && Intent.Nonce <= *LastNonce)
+            {
+                Result.Status = ECardanoIntentStatus::Replayed;
+                Result.Error = FString::Printf(TEXT("Nonce %lld is not above %lld"), Intent.Nonce, *LastNonce);
+            }
+            else if (!Balance || *Balance < Intent.Lovelace)
+            {
+                Result.Status = ECardanoIntentStatus::InsufficientBalance;
+                Result.Error = FString::Printf(TEXT("%s holds %lld lovelace"), *Intent.From, Balance ? *Balance : 0);
+            }
+            else
+            {
+                Result.Status = ECardanoIntentStatus::Accepted;
+                Nonces.Add(Intent.From, Intent.Nonce);
+                *Balance -= Intent.Lovelace;
+                if (*Balance == 0)
+                {
+                    Balances.Remove(Intent.From);
+                }
+                Balances.FindOrAdd(Intent.To) += Intent.Lovelace;
+            }
+        }
+
+        intent_counter(Result.Status).Add();
+    }
+}
+
+int64 FCardanoSettlementLedger::GetBalance(const FString& Account) const
+{
+    const int64* Balance = Balances.Find(Account);
+    return Balance ? *Balance : 0;
+}
+
+int64 FCardanoSettlementLedger::GetPendingPayout(const FString& Account) const
+{
+    int64 Pending = 0;
+    for (const TPair<FString, TArray<FCardanoTxPayment>>& Payout : PendingPayouts)
+    {
+        for (const FCardanoTxPayment& Payment : Payout.Value)
+        {
+            if (Payment.Address == Account)
+            {
+                Pending += Payment.Lovelace;
+            }
+        }
+    }
+    return Pending;
+}
+
+void FCardanoSettlementLedger::TakePayouts(int64 MinLovelace, int32 MaxPayments, TArray<FCardanoTxPayment>& OutPayments)
+{
+    OutPayments.Reset();
+    for (const TPair<FString, int64>& Pair : Balances)
+    {
+        if (Pair.Value >= MinLovelace && Pair.Key != TreasuryAccount)
+        {
+            FCardanoTxPayment& Payment = OutPayments.AddDefaulted_GetRef();
+            Payment.Address = Pair.Key;
+            Payment.Lovelace = Pair.Value;
+        }
+    }
+
+    // The largest debts are settled first when the settlement is capped
+    Algo::StableSort(OutPayments, [](const FCardanoTxPayment& A, const FCardanoTxPayment& B)
+        {
+            return A.Lovelace > B.Lovelace;
+        });
+    if (MaxPayments > 0 && OutPayments.Num() > MaxPayments)
+    {
+        OutPayments.SetNum(MaxPayments);
+    }
+
+    for (const FCardanoTxPayment& Payment : OutPayments)
+    {
+        Balances.Remove(Payment.Address);
+    }
+}
+
+void FCardanoSettlementLedger::AddPendingPayout(const FString& TxHash, TArray<FCardanoTxPayment> Payments)
+{
+    PendingPayouts.Add(TxHash.ToLower(), MoveTemp(Payments));
+}
+
+void FCardanoSettlementLedger::ResolvePayout(const FString& TxHash, bool bConfirmed)
+{
+    TArray<FCardanoTxPayment> Payments;
+    if (PendingPayouts.RemoveAndCopyValue(TxHash.ToLower(), Payments) && !bConfirmed)
+    {
+        ReturnPayments(Payments);
+    }
+}
+
+void FCardanoSettlementLedger::ReturnPayments(const TArray<FCardanoTxPayment>& Payments)
+{
+    for (const FCardanoTxPayment& Payment : Payments)
+    {
+        Credit(Payment.Address, Payment.Lovelace);
+    }
+}
+
+void FCardanoSettlementLedger::GetPendingPayoutHashes(TArray<FString>& OutTxHashes) const
+{
+    PendingPayouts.GetKeys(OutTxHashes);
+}
+
+void FCardanoSettlementLedger::Serialize(FArchive& Ar)
+{
+    uint8 Version = SETTLEMENT_LEDGER_VERSION;
+    FString SavedLedgerId = LedgerId;
+    Ar << Version;
+    Ar << SavedLedgerId;
+
+    // A save of another ledger would credit accounts with funds this treasury does not hold
+    if (Ar.IsLoading() && (Ar.IsError() || Version != SETTLEMENT_LEDGER_VERSION || SavedLedgerId != LedgerId))
+    {
+        Ar.SetError();
+        return;
+    }
+
+    serialize_amounts(Ar, Balances);
+    serialize_amounts(Ar, Nonces);
+
+    int32 Count = PendingPayouts.Num();
+    if (!SerializeCount(Ar, Count))
+    {
+        return;
+    }
+
+    if (Ar.IsLoading())
+    {
+        PendingPayouts.Reset();
+        for (int32 i = 0; i < Count && !Ar.IsError(); ++i)
+        {
+            FString TxHash;
+            TArray<FCardanoTxPayment> Payments;
+            SerializeHex(Ar, TxHash, 32);
+            serialize_payments(Ar, Payments);
+            PendingPayouts.Add(MoveTemp(TxHash), MoveTemp(Payments));
+        }
+        return;
+    }
+
+    for (TPair<FString, TArray<FCardanoTxPayment>>& Payout : PendingPayouts)
+    {
+        SerializeHex(Ar, Payout.Key, 32);
+        serialize_payments(Ar, Payout.Value);
+    }
+}
+
+UCardanoSettlementEngine* UCardanoSettlementEngine::Start(const FCardanoSettlementConfig& Config, FString& OutError)
+{
+    check(IsInGameThread());
+
+    if (Config.LedgerId.IsEmpty() || Config.TreasuryAddress.IsEmpty())
+    {
+        OutError = TEXT("A settlement engine needs a ledger id and a treasury address");
+        return nullptr;
+    }
+
+    if (!Config.KeyHandler || Config.DerivationPaths.Num() == 0)
+    {
+        OutError = TEXT("A settlement engine needs a key handler and the derivation paths of the treasury keys");
+        return nullptr;
+    }
+
+    UCardanoSettlementEngine* Engine = NewObject<UCardanoSettlementEngine>();
+    Engine->AddToRoot();
+    Engine->Config = Config;
+    Engine->Ledger = MakeUnique<FCardanoSettlementLedger>(Config.LedgerId, Config.TreasuryAddress);
+    cardano_secure_key_handler_ref(Engine->Config.KeyHandler);
+
+    Engine->TickHandle = FTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(Engine, &UCardanoSettlementEngine::Tick), FMath::Max(Config.SettlementIntervalSeconds, 1.0f));
+    return Engine;
+}
+
+void UCardanoSettlementEngine::Stop()
+{
+    if (!TickHandle.IsValid())
+    {
+        return;
+    }
+
+    FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    TickHandle.Reset();
+
+    // Kept alive while a payout may still be credited back to the ledger
+    if (!bSettling && QueuedPayments.Num() == 0)
+    {
+        ReleaseKeyHandler();
+        RemoveFromRoot();
+    }
+}
+
+void UCardanoSettlementEngine::BeginDestroy()
+{
+    if (TickHandle.IsValid())
+    {
+        FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        TickHandle.Reset();
+    }
+    ReleaseKeyHandler();
+    Super::BeginDestroy();
+}
+
+void UCardanoSettlementEngine::ReleaseKeyHandler()
+{
+    cardano_secure_key_handler_unref(&Config.KeyHandler);
+    Config.KeyHandler = nullptr;
+}
+
+bool UCardanoSettlementEngine::Tick(float DeltaTime)
+{
+    SettleNow();
+    return true;
+}
+
+bool UCardanoSettlementEngine::SettleNow()
+{
+    if (bSettling || !Config.KeyHandler)
+    {
+        return false;
+    }
+
+    const UCardanoProtocolParamsCache* ParamsCache = UCardanoProtocolParamsCache::Get();
+    const UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    UCardanoChainTip* ChainTip = UCardanoChainTip::Get();
+
+    FCardanoTxPlan Plan;
+    Plan.NetworkMagic = Config.NetworkMagic;
+    Plan.OwnerAddress = Config.TreasuryAddress;
+    Plan.ChangeAddress = Config.TreasuryAddress;
+    Plan.InvalidAfter = ChainTip ? ChainTip->GetTimeToLive(SETTLEMENT_TTL_SLOTS) : 0;
+    if (!ParamsCache || !ParamsCache->GetCachedParameters(Plan.Parameters) || !Cache || !Cache->GetSpendableUTxOs(Config.TreasuryAddress, Plan.UTxOs)
+        || Plan.UTxOs.Num() == 0 || Plan.InvalidAfter <= 0)
+    {
+        UE_LOG(LogCardano, Verbose, TEXT("Settlement of %s skipped: parameters, treasury UTxOs or chain tip not available"), *Config.LedgerId);
+        return true;
+    }
+
+    TArray<FCardanoTxPayment> Payments;
+    Ledger->TakePayouts(Config.MinPayoutLovelace, Config.MaxPaymentsPerSettlement, Payments);
+    if (Payments.Num() == 0)
+    {
+        return true;
+    }
+
+    UE_LOG(LogCardano, Log, TEXT("Settling %d accounts of %s from %d treasury UTxOs"), Payments.Num(), *Config.LedgerId, Plan.UTxOs.Num());
+    Plan.Payments = MoveTemp(Payments);
+    bSettling = true;
+
+    // One settlement runs at a time, so the key handler is never used by two workers at once
+    TWeakObjectPtr<UCardanoSettlementEngine> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Plan = MoveTemp(Plan), Options = Config.Options, KeyHandler = Config.KeyHandler,
+        DerivationPaths = Config.DerivationPaths]()
+        {
+            TArray<FCardanoPayoutTransaction> Transactions;
+            TArray<FSignedPayout> Signed;
+            TArray<FCardanoTxPayment> Unpaid;
+            FString Error;
+
+            if (!FCardanoTxPlanner::BuildPayouts(Plan, Options, Transactions, Error))
+            {
+                Unpaid = Plan.Payments;
+            }
+
+            TArray<TArray<uint8>> Unsigned;
+            for (FCardanoPayoutTransaction& Transaction : Transactions)
+            {
+                TArray<FCardanoTxPayment> Payments;
+                for (const int32 Index : Transaction.PaymentIndices)
+                {
+                    Payments.Add(Plan.Payments[Index]);
+                }
+
+                if (!Transaction.bSuccess)
+                {
+                    Unpaid.Append(MoveTemp(Payments));
+                    Error = Transaction.Error;
+                    continue;
+                }
+
+                Signed.AddDefaulted_GetRef().Payments = MoveTemp(Payments);
+                Unsigned.Add(MoveTemp(Transaction.Transaction));
+            }
+
+            TArray<TArray<uint8>> SignedTransactions;
+            if (Unsigned.Num() > 0 && !FCardanoSigningPipeline::SignTransactions(KeyHandler, Unsigned, DerivationPaths, SignedTransactions, Error))
+            {
+                for (FSignedPayout& Payout : Signed)
+                {
+                    Unpaid.Append(MoveTemp(Payout.Payments));
+                }
+                Signed.Reset();
+            }
+
+            for (int32 i = 0; i < Signed.Num(); ++i)
+            {
+                Signed[i].Transaction = MoveTemp(SignedTransactions[i]);
+
+                TArray<FCardanoUTxORef> SpentKeys;
+                TArray<TPair<FString, FUTxO>> Outputs;
+                if (!decode_transaction_utxos(Signed[i].Transaction, Signed[i].TxHash, SpentKeys, Outputs))
+                {
+                    Signed[i].TxHash.Reset();
+                }
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Signed = MoveTemp(Signed), Unpaid = MoveTemp(Unpaid), Error = MoveTemp(Error)]() mutable
+                {
+                    if (UCardanoSettlementEngine* This = WeakThis.Get())
+                    {
+                        This->OnSettlementSigned(MoveTemp(Signed), MoveTemp(Unpaid), MoveTemp(Error));
+                    }
+                });
+        });
+    return true;
+}
+
+void UCardanoSettlementEngine::OnSettlementSigned(TArray<FSignedPayout> Signed, TArray<FCardanoTxPayment> Unpaid, FString Error)
+{
+    bSettling = false;
+
+    if (Unpaid.Num() > 0)
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Settlement of %s left %d accounts for later: %s"), *Config.LedgerId, Unpaid.Num(), *Error);
+        Ledger->ReturnPayments(Unpaid);
+        OnPayoutFailed.Broadcast(FString(), Unpaid.Num(), Error);
+    }
+
+    UCardanoSubmissionQueue* Queue = UCardanoSubmissionQueue::Get();
+    for (FSignedPayout& Payout : Signed)
+    {
+        const int32 NumPayments = Payout.Payments.Num();
+        if (!Queue || Payout.TxHash.IsEmpty())
+        {
+            Ledger->ReturnPayments(Payout.Payments);
+            OnPayoutFailed.Broadcast(Payout.TxHash, NumPayments, Queue ? TEXT("Failed to decode a signed transaction") : TEXT("Submission queue is not available"));
+            continue;
+        }
+
+        // Recorded before queuing: the queue may report a rejection before Enqueue returns
+        const FString TxHash = Payout.TxHash.ToLower();
+        Ledger->AddPendingPayout(TxHash, MoveTemp(Payout.Payments));
+        QueuedPayments.Add(TxHash, NumPayments);
+        payout_counter().Add(NumPayments);
+
+        FOnTransactionTracked OnTracked;
+        OnTracked.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UCardanoSettlementEngine, OnPayoutTracked));
+        Queue->Enqueue(Payout.Transaction, OnTracked);
+
+        if (QueuedPayments.Contains(TxHash))
+        {
+            OnPayoutQueued.Broadcast(TxHash, NumPayments, FString());
+        }
+    }
+
+    if (!TickHandle.IsValid() && QueuedPayments.Num() == 0)
+    {
+        ReleaseKeyHandler();
+        RemoveFromRoot();
+    }
+}
+
+void UCardanoSettlementEngine::OnPayoutTracked(ECardanoTxOutcome Outcome, ECardanoSubmitError Error, const FString& TxHash, const FString& ErrorMessage)
+{
+    int32 NumPayments = 0;
+    if (!QueuedPayments.RemoveAndCopyValue(TxHash.ToLower(), NumPayments))
+    {
+        return;
+    }
+
+    if (Outcome == ECardanoTxOutcome::Confirmed)
+    {
+        Ledger->ResolvePayout(TxHash, true);
+        OnPayoutConfirmed.Broadcast(TxHash, NumPayments, FString());
+    }
+    else if (Outcome == ECardanoTxOutcome::Rejected)
+    {
+        Ledger->ResolvePayout(TxHash, false);
+        UE_LOG(LogCardano, Warning, TEXT("Settlement payout %s of %s rejected, %d accounts credited back: %s"), *TxHash, *Config.LedgerId, NumPayments, *ErrorMessage);
+        OnPayoutFailed.Broadcast(TxHash, NumPayments, ErrorMessage);
+    }
+    else
+    {
+        // Accepted by the node, so it may still land before its TTL: crediting it back could pay the accounts twice
+        UE_LOG(LogCardano, Warning, TEXT("Settlement payout %s of %s not confirmed in time, %d accounts left pending"), *TxHash, *Config.LedgerId, NumPayments);
+        OnPayoutFailed.Broadcast(TxHash, NumPayments, FString::Printf(TEXT("Transaction %s was not confirmed in time"), *TxHash));
+    }
+
+    if (!TickHandle.IsValid() && !bSettling && QueuedPayments.Num() == 0)
+    {
+        ReleaseKeyHandler();
+        RemoveFromRoot();
+    }
+}
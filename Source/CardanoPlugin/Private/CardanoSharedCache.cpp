@@ -0,0 +1,305 @@
+#include "CardanoSharedCache.h"
+#include "CardanoLog.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Guid.h"
+#include "Misc/ScopeLock.h"
+
+/*
+ * Segment layout: FHeader, then two slots of Capacity bytes each. Every field shared between processes is a
+ * 64-bit or 32-bit integer only accessed through FPlatformAtomics, which are address-free on every platform the
+ * plugin ships on.
+ * Slot sequence numbers are even when the slot is stable and odd while the writer fills it.
+ */
+static const int64 SEGMENT_MAGIC = 0x4843414348534743; // "CGSHCACH"
+static const int64 SEGMENT_LAYOUT = 1;
+static const int32 REQUEST_COUNT = 256;
+static const int32 MAX_REQUEST_SIZE = 120;
+static const int32 READ_ATTEMPTS = 8;
+
+/** Publishes finding the slot to fill still being written before it counts as abandoned by a dead writer. */
+static const int32 STUCK_SLOT_PUBLISHES = 3;
+
+/** Initialization states of a segment, in FHeader::State. */
+static const int64 STATE_EMPTY = 0;
+static const int64 STATE_INITIALIZING = 1;
+static const int64 STATE_READY = 2;
+
+/** States of a request entry. */
+static const int32 REQUEST_FREE = 0;
+static const int32 REQUEST_WRITING = 1;
+static const int32 REQUEST_READY = 2;
+
+struct FCardanoSharedCache::FHeader
+{
+    volatile int64 State;
+    int64 Magic;
+    int64 Layout;
+    int64 Capacity;
+
+    /** Process holding the writer role, or 0, and when it last renewed it, in milliseconds since the Unix epoch. */
+    volatile int64 WriterId;
+    volatile int64 WriterHeartbeat;
+
+    /** Slot readers are directed to, and the version of its payload; 0 before anything was published. */
+    volatile int64 ActiveSlot;
+    volatile int64 Version;
+
+    volatile int64 Sequences[2];
+    volatile int64 Sizes[2];
+
+    struct FRequest
+    {
+        volatile int32 State;
+        int32 Size;
+        uint8 Bytes[MAX_REQUEST_SIZE];
+    };
+
+    FRequest Requests[REQUEST_COUNT];
+};
+
+static int64 GetUnixMilliseconds()
+{
+    return (FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTicks() / ETimespan::TicksPerMillisecond;
+}
+
+static int64 MakeWriterId()
+{
+    const FGuid Guid = FGuid::NewGuid();
+    const int64 Id = (static_cast<int64>(Guid.A ^ Guid.C) << 32) | static_cast<int64>(Guid.B ^ Guid.D);
+    return Id != 0 ? Id : 1;
+}
+
+TUniquePtr<FCardanoSharedCache> FCardanoSharedCache::Open(const FString& Name, int64 CapacityBytes, double WriterTimeoutSeconds)
+{
+    // Regions stay mapped until the process exits: on Linux, unmapping a region this process created unlinks its
+    // name, after which processes started later would create a second segment instead of joining this one
+    static FCriticalSection RegionsLock;
+    static TMap<FString, FPlatformMemory::FSharedMemoryRegion*> Regions;
+
+    // The header is followed by the slots, kept cache line aligned
+    const int64 SlotsOffset = Align(static_cast<int64>(sizeof(FHeader)), 64);
+    const int64 Capacity = Align(FMath::Max<int64>(CapacityBytes, 1), 64);
+    const SIZE_T Size = static_cast<SIZE_T>(SlotsOffset + 2 * Capacity);
+    const uint32 Access = FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write;
+
+    FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+    bool bCreated = false;
+    {
+        FScopeLock ScopeLock(&RegionsLock);
+
+        if (FPlatformMemory::FSharedMemoryRegion** Mapped = Regions.Find(Name))
+        {
+            Region = *Mapped;
+        }
+        else
+        {
+            Region = FPlatformMemory::MapNamedSharedMemoryRegion(Name, false, Access, Size);
+            if (!Region)
+            {
+                Region = FPlatformMemory::MapNamedSharedMemoryRegion(Name, true, Access, Size);
+                bCreated = Region != nullptr;
+            }
+
+            if (!Region)
+            {
+                UE_LOG(LogCardano, Warning, TEXT("Shared cache: failed to map shared memory segment %s"), *Name);
+                return nullptr;
+            }
+        }
+    }
+
+    FHeader* Header = static_cast<FHeader*>(Region->GetAddress());
+
+    // A new segment is zero-filled; whichever process gets to it first lays it out
+    if (FPlatformAtomics::InterlockedCompareExchange(&Header->State, STATE_INITIALIZING, STATE_EMPTY) == STATE_EMPTY)
+    {
+        Header->Magic = SEGMENT_MAGIC;
+        Header->Layout = SEGMENT_LAYOUT;
+        Header->Capacity = Capacity;
+        FPlatformMisc::MemoryBarrier();
+        FPlatformAtomics::InterlockedExchange(&Header->State, STATE_READY);
+    }
+
+    for (int32 i = 0; i < 1000 && FPlatformAtomics::AtomicRead(&Header->State) != STATE_READY; ++i)
+    {
+        FPlatformProcess::Sleep(0.001f);
+    }
+
+    // Only the header is touched before the capacity is checked, since a smaller segment ends before our slots do
+    if (FPlatformAtomics::AtomicRead(&Header->State) != STATE_READY || Header->Magic != SEGMENT_MAGIC
+        || Header->Layout != SEGMENT_LAYOUT || Header->Capacity != Capacity)
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Shared cache: segment %s has another layout or capacity, not sharing it"), *Name);
+
+        FScopeLock ScopeLock(&RegionsLock);
+        if (!Regions.Contains(Name))
+        {
+            FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+        }
+        return nullptr;
+    }
+
+    {
+        FScopeLock ScopeLock(&RegionsLock);
+        Regions.Add(Name, Region);
+    }
+
+    UE_LOG(LogCardano, Log, TEXT("Shared cache: %s segment %s, %lld bytes per slot"), bCreated ? TEXT("created") : TEXT("joined"), *Name, Capacity);
+    return TUniquePtr<FCardanoSharedCache>(new FCardanoSharedCache(Header, static_cast<uint8*>(Region->GetAddress()) + SlotsOffset, Capacity, WriterTimeoutSeconds));
+}
+
+FCardanoSharedCache::FCardanoSharedCache(FHeader* InHeader, uint8* InSlots, int64 InCapacity, double InWriterTimeoutSeconds)
+    : Header(InHeader)
+    , Slots(InSlots)
+    , Capacity(InCapacity)
+    , WriterTimeoutSeconds(InWriterTimeoutSeconds)
+    , WriterId(MakeWriterId())
+{
+}
+
+FCardanoSharedCache::~FCardanoSharedCache()
+{
+    FPlatformAtomics::InterlockedCompareExchange(&Header->WriterId, 0, WriterId);
+}
+
+bool FCardanoSharedCache::Heartbeat()
+{
+    const int64 Now = GetUnixMilliseconds();
+    const int64 Current = FPlatformAtomics::AtomicRead(&Header->WriterId);
+
+    if (Current != WriterId)
+    {
+        const int64 LastHeartbeat = FPlatformAtomics::AtomicRead(&Header->WriterHeartbeat);
+        const bool bAbandoned = Current == 0 || Now - LastHeartbeat > static_cast<int64>(WriterTimeoutSeconds * 1000.0);
+
+        // Of several processes finding the writer gone, the exchange lets only one in
+        if (!bAbandoned || FPlatformAtomics::InterlockedCompareExchange(&Header->WriterId, WriterId, Current) != Current)
+        {
+            return false;
+        }
+
+        UE_LOG(LogCardano, Log, TEXT("Shared cache: this process is now the writer"));
+    }
+
+    FPlatformAtomics::InterlockedExchange(&Header->WriterHeartbeat, Now);
+    return true;
+}
+
+bool FCardanoSharedCache::IsWriter() const
+{
+    return FPlatformAtomics::AtomicRead(&Header->WriterId) == WriterId;
+}
+
+bool FCardanoSharedCache::Publish(const TArray<uint8>& Bytes)
+{
+    if (!IsWriter() || Bytes.Num() > Capacity)
+    {
+        return false;
+    }
+
+    const int64 Slot = 1 - FPlatformAtomics::AtomicRead(&Header->ActiveSlot);
+    int64 Sequence = FPlatformAtomics::AtomicRead(&Header->Sequences[Slot]);
+
+    // A writer that just lost its claim may still be filling the slot, but one that died never will
+    if ((Sequence & 1) != 0)
+    {
+        if (++BusySlotPublishes < STUCK_SLOT_PUBLISHES)
+        {
+            return false;
+        }
+
+        UE_LOG(LogCardano, Warning, TEXT("Shared cache: taking over a slot left half written"));
+        FPlatformAtomics::InterlockedCompareExchange(&Header->Sequences[Slot], Sequence + 1, Sequence);
+        Sequence = FPlatformAtomics::AtomicRead(&Header->Sequences[Slot]);
+    }
+    BusySlotPublishes = 0;
+
+    if ((Sequence & 1) != 0 || FPlatformAtomics::InterlockedCompareExchange(&Header->Sequences[Slot], Sequence + 1, Sequence) != Sequence)
+    {
+        return false;
+    }
+
+    FPlatformAtomics::InterlockedExchange(&Header->Sizes[Slot], static_cast<int64>(Bytes.Num()));
+    FMemory::Memcpy(Slots + Slot * Capacity, Bytes.GetData(), Bytes.Num());
+    FPlatformMisc::MemoryBarrier();
+
+    FPlatformAtomics::InterlockedExchange(&Header->Sequences[Slot], Sequence + 2);
+    FPlatformAtomics::InterlockedExchange(&Header->ActiveSlot, Slot);
+    FPlatformAtomics::InterlockedIncrement(&Header->Version);
+    return true;
+}
+
+bool FCardanoSharedCache::Read(uint64& InOutVersion, TArray<uint8>& OutBytes) const
+{
+    for (int32 Attempt = 0; Attempt < READ_ATTEMPTS; ++Attempt)
+    {
+        const int64 Version = FPlatformAtomics::AtomicRead(&Header->Version);
+        if (Version == 0 || static_cast<uint64>(Version) == InOutVersion)
+        {
+            return false;
+        }
+
+        const int64 Slot = FPlatformAtomics::AtomicRead(&Header->ActiveSlot) & 1;
+        const int64 Sequence = FPlatformAtomics::AtomicRead(&Header->Sequences[Slot]);
+        const int64 Size = FPlatformAtomics::AtomicRead(&Header->Sizes[Slot]);
+        if ((Sequence & 1) != 0 || Size < 0 || Size > Capacity)
+        {
+            FPlatformProcess::Yield();
+            continue;
+        }
+
+        OutBytes.SetNumUninitialized(static_cast<int32>(Size), false);
+        FMemory::Memcpy(OutBytes.GetData(), Slots + Slot * Capacity, Size);
+        FPlatformMisc::MemoryBarrier();
+
+        if (FPlatformAtomics::AtomicRead(&Header->Sequences[Slot]) == Sequence)
+        {
+            InOutVersion = static_cast<uint64>(Version);
+            return true;
+        }
+    }
+
+    OutBytes.Reset();
+    return false;
+}
+
+bool FCardanoSharedCache::Request(const FString& Key)
+{
+    const FTCHARToUTF8 KeyUtf8(*Key);
+    if (KeyUtf8.Length() > MAX_REQUEST_SIZE)
+    {
+        return false;
+    }
+
+    for (FHeader::FRequest& Entry : Header->Requests)
+    {
+        if (FPlatformAtomics::InterlockedCompareExchange(&Entry.State, REQUEST_WRITING, REQUEST_FREE) == REQUEST_FREE)
+        {
+            Entry.Size = KeyUtf8.Length();
+            FMemory::Memcpy(Entry.Bytes, KeyUtf8.Get(), KeyUtf8.Length());
+            FPlatformMisc::MemoryBarrier();
+            FPlatformAtomics::InterlockedExchange(&Entry.State, REQUEST_READY);
+            return true;
+        }
+    }
+    return false;
+}
+
+TArray<FString> FCardanoSharedCache::TakeRequests()
+{
+    TArray<FString> Keys;
+    for (FHeader::FRequest& Entry : Header->Requests)
+    {
+        if (FPlatformAtomics::AtomicRead(&Entry.State) != REQUEST_READY)
+        {
+            continue;
+        }
+
+        FPlatformMisc::MemoryBarrier();
+        const FUTF8ToTCHAR Key(reinterpret_cast<const ANSICHAR*>(Entry.Bytes), FMath::Clamp(Entry.Size, 0, MAX_REQUEST_SIZE));
+        Keys.Emplace(Key.Length(), Key.Get());
+        FPlatformAtomics::InterlockedExchange(&Entry.State, REQUEST_FREE);
+    }
+    return Keys;
+}
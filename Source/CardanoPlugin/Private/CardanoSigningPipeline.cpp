@@ -0,0 +1,230 @@
+#include "CardanoSigningPipeline.h"
+#include "CardanoHandle.h"
+#include "CardanoLog.h"
+#include "CardanoStats.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "Async/ParallelFor.h"
+#include <cardano/transaction/transaction.h>
+#include <cardano/witness_set/vkey_witness_set.h>
+
+static cardano_transaction_t* decode_transaction(TArrayView<const uint8> Bytes)
+{
+    CARDANO_SCOPE(CardanoSerialize);
+
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_new(Bytes.GetData(), Bytes.Num());
+    if (!reader)
+    {
+        return nullptr;
+    }
+
+    cardano_transaction_t* transaction = nullptr;
+    if (cardano_transaction_from_cbor(reader, &transaction) != CARDANO_SUCCESS)
+    {
+        transaction = nullptr;
+    }
+
+    cardano_cbor_reader_unref(&reader);
+    return transaction;
+}
+
+/** Witnesses transaction with SigningKey into a new witness set; the key is only read, so workers may share it. */
+static bool sign_with_key(const cardano_ed25519_signing_context_t* SigningKey, cardano_transaction_t* transaction, cardano_vkey_witness_set_t*& OutWitnesses)
+{
+    TCardanoRef<cardano_blake2b_hash_t> Hash(cardano_transaction_get_id(transaction));
+    TCardanoRef<cardano_ed25519_signature_t> Signature;
+    TCardanoRef<cardano_ed25519_public_key_t> PublicKey;
+    TCardanoRef<cardano_vkey_witness_t> Witness;
+    TCardanoRef<cardano_vkey_witness_set_t> Witnesses;
+
+    if (!Hash ||
+        cardano_ed25519_signing_context_sign(SigningKey, cardano_blake2b_hash_get_data(Hash.Get()), cardano_blake2b_hash_get_bytes_size(Hash.Get()), Signature.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_ed25519_signing_context_get_public_key(SigningKey, PublicKey.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_vkey_witness_new(PublicKey.Get(), Signature.Get(), Witness.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_vkey_witness_set_new(Witnesses.GetInitReference()) != CARDANO_SUCCESS ||
+        cardano_vkey_witness_set_add(Witnesses.Get(), Witness.Get()) != CARDANO_SUCCESS)
+    {
+        return false;
+    }
+
+    OutWitnesses = Witnesses.Release();
+    return true;
+}
+
+bool FCardanoSigningPipeline::SignTransactions(
+    cardano_secure_key_handler_t* KeyHandler,
+    const TArray<TArray<uint8>>& UnsignedTransactions,
+    TArrayView<const cardano_derivation_path_t> DerivationPaths,
+    TArray<TArray<uint8>>& OutSignedTransactions,
+    FString& OutError)
+{
+    OutSignedTransactions.Reset();
+
+    if (!KeyHandler || DerivationPaths.Num() == 0)
+    {
+        OutError = TEXT("A key handler and at least one derivation path are required");
+        return false;
+    }
+
+    const int32 Count = UnsignedTransactions.Num();
+    if (Count == 0)
+    {
+        return true;
+    }
+
+    // Every index owns its own transaction and witness set, so the parallel stages never share cardano-c objects.
+    // Decoding also hashes each body; the hash is kept with the body, so signing only reads it
+    TArray<cardano_transaction_t*> Transactions;
+    Transactions.SetNumZeroed(Count);
+
+    ParallelFor(Count, [&](int32 Index)
+        {
+            Transactions[Index] = decode_transaction(UnsignedTransactions[Index]);
+
+            cardano_blake2b_hash_t* hash = cardano_transaction_get_id(Transactions[Index]);
+            cardano_blake2b_hash_unref(&hash);
+        });
+
+    const int32 FirstInvalid = Transactions.IndexOfByKey(nullptr);
+    if (FirstInvalid != INDEX_NONE)
+    {
+        OutError = FString::Printf(TEXT("Transaction %d is not valid CBOR"), FirstInvalid);
+        for (cardano_transaction_t*& transaction : Transactions)
+        {
+            cardano_transaction_unref(&transaction);
+        }
+        return false;
+    }
+
+    TArray<cardano_vkey_witness_set_t*> WitnessSets;
+    WitnessSets.SetNumZeroed(Count);
+
+    // A handler that exports its signing key lets the workers sign too. Only with a single path, since outside an
+    // unlocked session each exported key costs a passphrase and decryption that the batch call pays once
+    TCardanoRef<cardano_ed25519_signing_context_t> SigningKey;
+    cardano_error_t result = DerivationPaths.Num() == 1
+        ? cardano_secure_key_handler_bip32_get_signing_context(KeyHandler, DerivationPaths[0], SigningKey.GetInitReference())
+        : CARDANO_ERROR_NOT_IMPLEMENTED;
+
+    if (result == CARDANO_SUCCESS)
+    {
+        CARDANO_SCOPE(CardanoSign);
+        TAtomic<bool> bSignFailed(false);
+
+        ParallelFor(Count, [&](int32 Index)
+            {
+                if (!sign_with_key(SigningKey.Get(), Transactions[Index], WitnessSets[Index]))
+                {
+                    bSignFailed = true;
+                }
+            });
+
+        if (bSignFailed)
+        {
+            result = CARDANO_ERROR_GENERIC;
+            for (cardano_vkey_witness_set_t*& witnesses : WitnessSets)
+            {
+                cardano_vkey_witness_set_unref(&witnesses);
+            }
+        }
+    }
+    else if (result == CARDANO_ERROR_NOT_IMPLEMENTED)
+    {
+        CARDANO_SCOPE(CardanoSign);
+        result = cardano_secure_key_handler_bip32_sign_transactions(
+            KeyHandler,
+            Transactions.GetData(),
+            Count,
+            DerivationPaths.GetData(),
+            DerivationPaths.Num(),
+            WitnessSets.GetData());
+    }
+
+    if (result != CARDANO_SUCCESS)
+    {
+        OutError = FString::Printf(TEXT("Failed to sign transactions: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+        UE_LOG(LogCardano, Error, TEXT("%s"), *OutError);
+        for (cardano_transaction_t*& transaction : Transactions)
+        {
+            cardano_transaction_unref(&transaction);
+        }
+        return false;
+    }
+
+    OutSignedTransactions.SetNum(Count);
+    TAtomic<bool> bFailed(false);
+
+    ParallelFor(Count, [&](int32 Index)
+        {
+            if (cardano_transaction_apply_vkey_witnesses(Transactions[Index], WitnessSets[Index]) != CARDANO_SUCCESS ||
+                !serialize_transaction(Transactions[Index], OutSignedTransactions[Index]))
+            {
+                bFailed = true;
+            }
+
+            cardano_vkey_witness_set_unref(&WitnessSets[Index]);
+            cardano_transaction_unref(&Transactions[Index]);
+        });
+
+    if (bFailed)
+    {
+        OutError = TEXT("Failed to attach witnesses to a transaction");
+        OutSignedTransactions.Reset();
+        return false;
+    }
+
+    UE_LOG(LogCardano, Log, TEXT("Signed %d transactions with %d keys each"), Count, DerivationPaths.Num());
+    return true;
+}
+
+bool FCardanoSigningPipeline::SignTransaction(
+    cardano_secure_key_handler_t* KeyHandler,
+    TArrayView<const uint8> UnsignedTransaction,
+    TArrayView<const cardano_derivation_path_t> DerivationPaths,
+    TArray<uint8>& OutSignedTransaction,
+    FString& OutError)
+{
+    OutSignedTransaction.Reset();
+
+    if (!KeyHandler || DerivationPaths.Num() == 0)
+    {
+        OutError = TEXT("A key handler and at least one derivation path are required");
+        return false;
+    }
+
+    TCardanoRef<cardano_transaction_t> Transaction(decode_transaction(UnsignedTransaction));
+    if (!Transaction)
+    {
+        OutError = TEXT("Transaction is not valid CBOR");
+        return false;
+    }
+
+    cardano_transaction_t* transactions[] = { Transaction.Get() };
+    TCardanoRef<cardano_vkey_witness_set_t> Witnesses;
+    cardano_error_t result;
+    {
+        CARDANO_SCOPE(CardanoSign);
+        result = cardano_secure_key_handler_bip32_sign_transactions(
+            KeyHandler,
+            transactions,
+            1,
+            DerivationPaths.GetData(),
+            DerivationPaths.Num(),
+            Witnesses.GetInitReference());
+    }
+
+    if (result != CARDANO_SUCCESS)
+    {
+        OutError = FString::Printf(TEXT("Failed to sign transaction: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+        UE_LOG(LogCardano, Error, TEXT("%s"), *OutError);
+        return false;
+    }
+
+    if (cardano_transaction_apply_vkey_witnesses(Transaction.Get(), Witnesses.Get()) != CARDANO_SUCCESS ||
+        !serialize_transaction(Transaction.Get(), OutSignedTransaction))
+    {
+        OutError = TEXT("Failed to attach witnesses to the transaction");
+        OutSignedTransaction.Reset();
+        return false;
+    }
+    return true;
+}
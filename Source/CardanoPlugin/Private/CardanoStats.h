@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+#include "CardanoMetrics.h"
+
+/**
+ * Profiling hooks for the plugin: a `stat Cardano` group and a `Cardano` Unreal Insights channel
+ * (`-trace=cpu,cardano`). Defined in CardanoPlugin.cpp.
+ *
+ * CARDANO_SCOPE(CardanoBuild) times the enclosing scope as an Insights CPU event, as STAT_CardanoBuild and into the
+ * cardano_phase_duration_seconds{phase="Build"} metric, so wrap the expensive phases (derivation, building, signing,
+ * serialization, parsing) with it rather than logging each step.
+ */
+DECLARE_STATS_GROUP(TEXT("Cardano"), STATGROUP_Cardano, STATCAT_Advanced);
+
+UE_TRACE_CHANNEL_EXTERN(CardanoChannel);
+
+#define CARDANO_SCOPE(Name) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, CardanoChannel); \
+    SCOPE_CYCLE_COUNTER(STAT_##Name); \
+    static FCardanoHistogram& Name##Histogram = FCardanoMetrics::Get().Histogram(TEXT("cardano_phase_duration_seconds"), \
+        TEXT("Duration of the plugin phases timed by CARDANO_SCOPE."), \
+        FCardanoMetrics::MakeLabels(TEXT("phase"), FString(TEXT(PREPROCESSOR_TO_STRING(Name))).RightChop(7))); \
+    FCardanoMetricsScope Name##MetricsScope(Name##Histogram)
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Key derivation"), STAT_CardanoKeyDerivation, STATGROUP_Cardano, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Transaction building"), STAT_CardanoBuild, STATGROUP_Cardano, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Signing"), STAT_CardanoSign, STATGROUP_Cardano, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CBOR serialization"), STAT_CardanoSerialize, STATGROUP_Cardano, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("JSON parsing"), STAT_CardanoParseJson, STATGROUP_Cardano, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HTTP response handling"), STAT_CardanoHttpResponse, STATGROUP_Cardano, );
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Requests queued"), STAT_CardanoRequestsQueued, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Requests in flight"), STAT_CardanoRequestsInFlight, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Requests sent"), STAT_CardanoRequestsSent, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Requests throttled"), STAT_CardanoRequestsThrottled, STATGROUP_Cardano, );
+DECLARE_QWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Bytes sent"), STAT_CardanoBytesSent, STATGROUP_Cardano, );
+DECLARE_QWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Bytes received"), STAT_CardanoBytesReceived, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Unchanged responses"), STAT_CardanoUnchangedResponses, STATGROUP_Cardano, );
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("UTxO cache hits"), STAT_CardanoUTxOCacheHits, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("UTxO cache misses"), STAT_CardanoUTxOCacheMisses, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Protocol parameters cache hits"), STAT_CardanoParamsCacheHits, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Protocol parameters cache misses"), STAT_CardanoParamsCacheMisses, STATGROUP_Cardano, );
+
+// Mirrors of the cardano-c allocation counters, sampled by the plugin module when the library is built with
+// LIB_CARDANO_C_ALLOCATION_TRACKING
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Live memory: CBOR"), STAT_CardanoLiveCbor, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Peak memory: CBOR"), STAT_CardanoPeakCbor, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live allocations: CBOR"), STAT_CardanoAllocationsCbor, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Live memory: JSON"), STAT_CardanoLiveJson, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Peak memory: JSON"), STAT_CardanoPeakJson, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live allocations: JSON"), STAT_CardanoAllocationsJson, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Live memory: crypto"), STAT_CardanoLiveCrypto, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Peak memory: crypto"), STAT_CardanoPeakCrypto, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live allocations: crypto"), STAT_CardanoAllocationsCrypto, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Live memory: builder"), STAT_CardanoLiveBuilder, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Peak memory: builder"), STAT_CardanoPeakBuilder, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live allocations: builder"), STAT_CardanoAllocationsBuilder, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Live memory: collections"), STAT_CardanoLiveCollections, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Peak memory: collections"), STAT_CardanoPeakCollections, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live allocations: collections"), STAT_CardanoAllocationsCollections, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Live memory: buffers"), STAT_CardanoLiveBuffer, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Peak memory: buffers"), STAT_CardanoPeakBuffer, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live allocations: buffers"), STAT_CardanoAllocationsBuffer, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Live memory: other"), STAT_CardanoLiveOther, STATGROUP_Cardano, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Peak memory: other"), STAT_CardanoPeakOther, STATGROUP_Cardano, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live allocations: other"), STAT_CardanoAllocationsOther, STATGROUP_Cardano, );
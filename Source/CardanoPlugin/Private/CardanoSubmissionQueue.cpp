@@ -0,0 +1,441 @@
+#include "CardanoSubmissionQueue.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoMetrics.h"
+#include "CardanoUTxOCache.h"
+#include "Engine/Engine.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/Crc.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include <cardano/transaction/transaction.h>
+
+/** Decodes a signed transaction and hex-encodes its ID; returns false if the bytes are not a transaction. */
+static bool GetTransactionHash(const TArray<uint8>& Bytes, FString& OutTxHash)
+{
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_new(Bytes.GetData(), Bytes.Num());
+    if (!reader)
+    {
+        return false;
+    }
+
+    cardano_transaction_t* transaction = nullptr;
+    const cardano_error_t result = cardano_transaction_from_cbor(reader, &transaction);
+    cardano_cbor_reader_unref(&reader);
+
+    if (result != CARDANO_SUCCESS)
+    {
+        return false;
+    }
+
+    cardano_blake2b_hash_t* tx_id = cardano_transaction_get_id(transaction);
+    cardano_transaction_unref(&transaction);
+
+    if (!tx_id)
+    {
+        return false;
+    }
+
+    char hex[65] = {};
+    const bool bEncoded = cardano_blake2b_hash_to_hex(tx_id, hex, sizeof(hex)) == CARDANO_SUCCESS;
+    cardano_blake2b_hash_unref(&tx_id);
+
+    OutTxHash = UTF8_TO_TCHAR(hex);
+    return bEncoded;
+}
+
+static FString MakeTxStatusBody(const TArray<FString>& TxHashes)
+{
+    FString RequestBody;
+    RequestBody.Reserve(UCardanoKoiosClient::EstimateStringListBodyLength(TxHashes, 24));
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBody);
+
+    Writer->WriteObjectStart();
+    Writer->WriteArrayStart(TEXT("_tx_hashes"));
+    for (const FString& TxHash : TxHashes)
+    {
+        Writer->WriteValue(TxHash);
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return RequestBody;
+}
+
+UCardanoSubmissionQueue* UCardanoSubmissionQueue::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoSubmissionQueue>() : nullptr;
+}
+
+void UCardanoSubmissionQueue::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Collection.InitializeDependency(UCardanoKoiosClient::StaticClass());
+    Collection.InitializeDependency(UCardanoUTxOCache::StaticClass());
+
+    PollHandle = FTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UCardanoSubmissionQueue::Poll), FMath::Max(PollIntervalSeconds, 1.0f));
+    MetricsHandle = FCardanoMetrics::Get().OnCollect().AddUObject(this, &UCardanoSubmissionQueue::CollectMetrics);
+}
+
+void UCardanoSubmissionQueue::Deinitialize()
+{
+    FCardanoMetrics::Get().OnCollect().Remove(MetricsHandle);
+    FTicker::GetCoreTicker().RemoveTicker(PollHandle);
+    Pending.Empty();
+    PendingByHash.Empty();
+    Finished.Empty();
+
+    Super::Deinitialize();
+}
+
+FString UCardanoSubmissionQueue::Enqueue(const TArray<uint8>& TransactionBytes, const FOnTransactionTracked& OnComplete)
+{
+    FString TxHash;
+    if (!GetTransactionHash(TransactionBytes, TxHash))
+    {
+        OnComplete.ExecuteIfBound(ECardanoTxOutcome::Rejected, ECardanoSubmitError::Other, TEXT(""), TEXT("Invalid transaction CBOR"));
+        return TEXT("");
+    }
+
+    // The id only hashes the body, so a copy signed again is the same transaction; the CRC tells the copies apart
+    const uint32 BytesCrc = FCrc::MemCrc32(TransactionBytes.GetData(), TransactionBytes.Num());
+    if (AttachDuplicate(TxHash, BytesCrc, OnComplete))
+    {
+        return TxHash;
+    }
+
+    TSharedRef<FPendingTx> Tx = MakeShared<FPendingTx>();
+    Tx->TxHash = TxHash;
+    Tx->Bytes = TransactionBytes;
+    Tx->BytesCrc = BytesCrc;
+    Tx->Callbacks.Add(OnComplete);
+    Pending.Add(Tx);
+    PendingByHash.Add(TxHash, Tx);
+
+    // Lets the next transaction spend this one's change before it confirms
+    if (UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get())
+    {
+        Cache->AddPendingTransaction(TransactionBytes, TxHash);
+    }
+
+    PumpSubmissions();
+    return TxHash;
+}
+
+void UCardanoSubmissionQueue::Track(const FString& TxHash, const FOnTransactionTracked& OnComplete)
+{
+    const FString Key = TxHash.ToLower();
+    if (AttachDuplicate(Key, 0, OnComplete))
+    {
+        return;
+    }
+
+    TSharedRef<FPendingTx> Tx = MakeShared<FPendingTx>();
+    Tx->TxHash = Key;
+    Tx->Callbacks.Add(OnComplete);
+    Pending.Add(Tx);
+    PendingByHash.Add(Key, Tx);
+
+    Accept(Tx);
+}
+
+bool UCardanoSubmissionQueue::AttachDuplicate(const FString& TxHash, uint32 BytesCrc, const FOnTransactionTracked& OnComplete)
+{
+    static FCardanoCounter& PendingDuplicates = FCardanoMetrics::Get().Counter(TEXT("cardano_submission_duplicates_total"),
+        TEXT("Submissions answered by a transaction already pending or finished, without a request."), FCardanoMetrics::MakeLabels(TEXT("state"), TEXT("pending")));
+    static FCardanoCounter& FinishedDuplicates = FCardanoMetrics::Get().Counter(TEXT("cardano_submission_duplicates_total"),
+        TEXT("Submissions answered by a transaction already pending or finished, without a request."), FCardanoMetrics::MakeLabels(TEXT("state"), TEXT("finished")));
+
+    if (const TSharedRef<FPendingTx>* Existing = PendingByHash.Find(TxHash))
+    {
+        (*Existing)->Callbacks.Add(OnComplete);
+        PendingDuplicates.Add();
+        return true;
+    }
+
+    const FFinishedTx* Done = Finished.Find(TxHash);
+    if (!Done || FPlatformTime::Seconds() - Done->FinishedTime > DedupeWindowSeconds
+        || (Done->Outcome != ECardanoTxOutcome::Confirmed && Done->BytesCrc != BytesCrc))
+    {
+        return false;
+    }
+
+    // Copied, since the delegate may submit again and change Finished
+    const FFinishedTx Outcome = *Done;
+    FinishedDuplicates.Add();
+    OnComplete.ExecuteIfBound(Outcome.Outcome, Outcome.Error, TxHash, Outcome.ErrorMessage);
+    return true;
+}
+
+void UCardanoSubmissionQueue::Remember(const FPendingTx& Tx, ECardanoTxOutcome Outcome, ECardanoSubmitError Error, const FString& ErrorMessage)
+{
+    // A timed out transaction may still land, and the errors worth retrying are left for the caller to retry
+    if (DedupeWindowSeconds <= 0.0f || Outcome == ECardanoTxOutcome::TimedOut
+        || Error == ECardanoSubmitError::NetworkError || Error == ECardanoSubmitError::ProviderError)
+    {
+        return;
+    }
+
+    FFinishedTx& Done = Finished.Add(Tx.TxHash);
+    Done.Outcome = Outcome;
+    Done.Error = Error;
+    Done.ErrorMessage = ErrorMessage;
+    Done.BytesCrc = Tx.BytesCrc;
+    Done.FinishedTime = FPlatformTime::Seconds();
+}
+
+void UCardanoSubmissionQueue::PumpSubmissions()
+{
+    // Iterate over a copy: a rejection reported synchronously removes its entry
+    const TArray<TSharedRef<FPendingTx>> Snapshot = Pending;
+    for (const TSharedRef<FPendingTx>& Tx : Snapshot)
+    {
+        if (SubmissionsInFlight >= FMath::Max(MaxConcurrentSubmissions, 1))
+        {
+            return;
+        }
+
+        if (!Tx->bSubmitting && !Tx->bAccepted && !IsWaitingForParent(Tx))
+        {
+            Submit(Tx);
+        }
+    }
+}
+
+bool UCardanoSubmissionQueue::IsWaitingForParent(const TSharedRef<FPendingTx>& Tx) const
+{
+    const UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (!Cache)
+    {
+        return false;
+    }
+
+    // A node rejects a transaction whose inputs it has not seen, so parents must be accepted first
+    for (const FString& Parent : Cache->GetPendingParents(Tx->TxHash))
+    {
+        const TSharedRef<FPendingTx>* Other = PendingByHash.Find(Parent);
+        if (Other && !(*Other)->bAccepted)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void UCardanoSubmissionQueue::Submit(const TSharedRef<FPendingTx>& Tx)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        Finish(Tx, ECardanoTxOutcome::Rejected, ECardanoSubmitError::ProviderError, TEXT("Koios client is not available"));
+        return;
+    }
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateRequest(TEXT("POST"), TEXT("submittx"));
+    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/cbor"));
+    HttpRequest->SetContent(Tx->Bytes);
+
+    Tx->bSubmitting = true;
+    ++SubmissionsInFlight;
+
+    TWeakObjectPtr<UCardanoSubmissionQueue> WeakThis(this);
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Tx](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            --WeakThis->SubmissionsInFlight;
+            Tx->bSubmitting = false;
+
+            const ECardanoSubmitError Error = ParseSubmitError(Response, Success);
+            if (Error == ECardanoSubmitError::None)
+            {
+                WeakThis->Accept(Tx);
+            }
+            else if (Error == ECardanoSubmitError::NetworkError)
+            {
+                WeakThis->Finish(Tx, ECardanoTxOutcome::Rejected, Error, TEXT("Network request failed"));
+            }
+            else
+            {
+                WeakThis->Finish(Tx, ECardanoTxOutcome::Rejected, Error,
+                    FString::Printf(TEXT("Koios returned HTTP %d: %s"), Response->GetResponseCode(), *Response->GetContentAsString()));
+            }
+
+            WeakThis->PumpSubmissions();
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Submission);
+}
+
+void UCardanoSubmissionQueue::Accept(const TSharedRef<FPendingTx>& Tx)
+{
+    Tx->bAccepted = true;
+    Tx->AcceptedTime = FPlatformTime::Seconds();
+    Tx->Bytes.Empty();
+}
+
+void UCardanoSubmissionQueue::CollectMetrics()
+{
+    static FCardanoGauge& Depth = FCardanoMetrics::Get().Gauge(TEXT("cardano_submission_queue_depth"), TEXT("Transactions submitted or waiting to be, not yet confirmed or rejected."));
+    Depth.Set(Pending.Num());
+}
+
+void UCardanoSubmissionQueue::Finish(const TSharedRef<FPendingTx>& Tx, ECardanoTxOutcome Outcome, ECardanoSubmitError Error, const FString& ErrorMessage)
+{
+    // Removed first, so a delegate that enqueues another transaction sees a consistent queue
+    if (Pending.Remove(Tx) == 0)
+    {
+        return;
+    }
+    PendingByHash.Remove(Tx->TxHash);
+    Remember(*Tx, Outcome, Error, ErrorMessage);
+
+    const TCHAR* OutcomeLabel = Outcome == ECardanoTxOutcome::Confirmed ? TEXT("confirmed")
+        : Outcome == ECardanoTxOutcome::Rejected ? TEXT("rejected") : TEXT("timed_out");
+    FCardanoMetrics::Get().Counter(TEXT("cardano_submissions_total"), TEXT("Tracked transactions by outcome."),
+        FCardanoMetrics::MakeLabels(TEXT("outcome"), OutcomeLabel)).Add();
+
+    TArray<FString> Orphans;
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (Cache && Outcome != ECardanoTxOutcome::Confirmed)
+    {
+        Orphans = Cache->RejectPendingTransaction(Tx->TxHash);
+    }
+
+    if (Error != ECardanoSubmitError::None)
+    {
+        FCardanoMetrics::Get().Counter(TEXT("cardano_submission_errors_total"), TEXT("Rejected submissions by reason."),
+            FCardanoMetrics::MakeLabels(TEXT("reason"), GetSubmitErrorName(Error))).Add();
+    }
+
+    for (const FOnTransactionTracked& OnComplete : Tx->Callbacks)
+    {
+        OnComplete.ExecuteIfBound(Outcome, Error, Tx->TxHash, ErrorMessage);
+    }
+
+    // Descendants spend outputs that will never exist, whether or not they were submitted already
+    const FString OrphanMessage = FString::Printf(TEXT("Parent transaction %s was not confirmed"), *Tx->TxHash);
+    for (const FString& Orphan : Orphans)
+    {
+        if (const TSharedRef<FPendingTx>* Child = PendingByHash.Find(Orphan))
+        {
+            Finish(TSharedRef<FPendingTx>(*Child), ECardanoTxOutcome::Rejected, ECardanoSubmitError::InputsSpent, OrphanMessage);
+        }
+    }
+}
+
+bool UCardanoSubmissionQueue::Poll(float DeltaTime)
+{
+    // A slow tx_status answer must not be overtaken by the next poll
+    if (PollsInFlight > 0)
+    {
+        return true;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    for (TMap<FString, FFinishedTx>::TIterator It = Finished.CreateIterator(); It; ++It)
+    {
+        if (Now - It.Value().FinishedTime > DedupeWindowSeconds)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    TArray<TSharedRef<FPendingTx>> Accepted;
+
+    const TArray<TSharedRef<FPendingTx>> Snapshot = Pending;
+    for (const TSharedRef<FPendingTx>& Tx : Snapshot)
+    {
+        if (!Tx->bAccepted)
+        {
+            continue;
+        }
+
+        if (ConfirmationTimeoutSeconds > 0.0f && Now - Tx->AcceptedTime > ConfirmationTimeoutSeconds)
+        {
+            Finish(Tx, ECardanoTxOutcome::TimedOut, ECardanoSubmitError::None, TEXT("Transaction was not confirmed in time"));
+            continue;
+        }
+
+        Accepted.Add(Tx);
+    }
+
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios || Accepted.Num() == 0)
+    {
+        return true;
+    }
+
+    const int32 BatchSize = Koios->GetMaxAddressesPerRequest();
+    TWeakObjectPtr<UCardanoSubmissionQueue> WeakThis(this);
+
+    for (int32 Start = 0; Start < Accepted.Num(); Start += BatchSize)
+    {
+        TArray<TSharedRef<FPendingTx>> Batch;
+        TArray<FString> TxHashes;
+        for (int32 i = Start; i < FMath::Min(Start + BatchSize, Accepted.Num()); i++)
+        {
+            Batch.Add(Accepted[i]);
+            TxHashes.Add(Accepted[i]->TxHash);
+        }
+
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
+            Koios->CreateJsonPost(TEXT("tx_status"), MakeTxStatusBody(TxHashes));
+
+        ++PollsInFlight;
+        HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Batch](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+            {
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->OnStatusFetched(Batch, Response, Success);
+                }
+            });
+
+        Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+    }
+
+    return true;
+}
+
+void UCardanoSubmissionQueue::OnStatusFetched(const TArray<TSharedRef<FPendingTx>>& Batch, FHttpResponsePtr Response, bool bSuccess)
+{
+    --PollsInFlight;
+
+    // A failed poll is simply retried on the next tick
+    TArray<TSharedPtr<FJsonValue>> JsonArray;
+    if (!bSuccess || !Response.IsValid() || Response->GetResponseCode() != 200 ||
+        !ParseJsonArray(Response, JsonArray))
+    {
+        return;
+    }
+
+    TMap<FString, int32> Confirmations;
+    for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+    {
+        TSharedPtr<FJsonObject> Row = Item->AsObject();
+        FString TxHash;
+        int32 NumConfirmations = 0;
+
+        // num_confirmations is null while the transaction is still in the mempool
+        if (Row.IsValid() && Row->TryGetStringField("tx_hash", TxHash) && Row->TryGetNumberField("num_confirmations", NumConfirmations))
+        {
+            Confirmations.Add(TxHash.ToLower(), NumConfirmations);
+        }
+    }
+
+    for (const TSharedRef<FPendingTx>& Tx : Batch)
+    {
+        const int32* NumConfirmations = Confirmations.Find(Tx->TxHash);
+        if (NumConfirmations && *NumConfirmations >= FMath::Max(RequiredConfirmations, 1))
+        {
+            Finish(Tx, ECardanoTxOutcome::Confirmed, ECardanoSubmitError::None, TEXT(""));
+        }
+    }
+}
@@ -0,0 +1,255 @@
+#include "CardanoTransactionCache.h"
+#include "CardanoMetrics.h"
+#include "CardanoStats.h"
+#include "CardanoTxHistory.h"
+#include "Engine/Engine.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    FCardanoCounter& lookup_counter(bool bHit)
+    {
+        static FCardanoCounter& Hits = FCardanoMetrics::Get().Counter(TEXT("cardano_tx_cache_lookups_total"),
+            TEXT("Decoded transaction cache lookups."), FCardanoMetrics::MakeLabels(TEXT("result"), TEXT("hit")));
+        static FCardanoCounter& Misses = FCardanoMetrics::Get().Counter(TEXT("cardano_tx_cache_lookups_total"),
+            TEXT("Decoded transaction cache lookups."), FCardanoMetrics::MakeLabels(TEXT("result"), TEXT("miss")));
+        return bHit ? Hits : Misses;
+    }
+
+    FCardanoGauge& bytes_gauge()
+    {
+        static FCardanoGauge& Bytes = FCardanoMetrics::Get().Gauge(TEXT("cardano_tx_cache_bytes"),
+            TEXT("Heap bytes of the decoded transactions cached."));
+        return Bytes;
+    }
+
+    /** Measured heap size of the transaction, and at least its encoded size, which the parts not measured are part of. */
+    int64 measure(cardano_transaction_t* transaction)
+    {
+        size_t cbor_size = 0U;
+        const int64 EncodedBytes = cardano_transaction_get_cbor_size(transaction, &cbor_size) == CARDANO_SUCCESS ? static_cast<int64>(cbor_size) : 0;
+
+        cardano_memory_footprint_t footprint = {};
+        if (cardano_transaction_get_memory_footprint(transaction, &footprint) != CARDANO_SUCCESS)
+        {
+            return EncodedBytes;
+        }
+        return FMath::Max(static_cast<int64>(footprint.heap_bytes), EncodedBytes);
+    }
+}
+
+UCardanoTransactionCache* UCardanoTransactionCache::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoTransactionCache>() : nullptr;
+}
+
+void UCardanoTransactionCache::Deinitialize()
+{
+    Clear();
+    Super::Deinitialize();
+}
+
+bool UCardanoTransactionCache::Read(const FCardanoHash32& TxHash, TFunctionRef<void(cardano_transaction_t*)> Reader)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (ReadLocked(TxHash, Reader))
+        {
+            lookup_counter(true).Add();
+            return true;
+        }
+    }
+
+    lookup_counter(false).Add();
+    TArray<uint8> Cbor;
+    if (!bReadTxHistoryStore || !UCardanoTxHistory::ReadStoredCbor(TxHash, Cbor))
+    {
+        return false;
+    }
+
+    FString Error;
+    cardano_transaction_t* transaction = DecodeFrozen(TxHash, Cbor, Error);
+    if (!transaction)
+    {
+        return false;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    AddLocked(TxHash, transaction);
+    return ReadLocked(TxHash, Reader);
+}
+
+bool UCardanoTransactionCache::ReadOrDecode(const FCardanoHash32& TxHash, const TArray<uint8>& Cbor, TFunctionRef<void(cardano_transaction_t*)> Reader, FString& OutError)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (ReadLocked(TxHash, Reader))
+        {
+            lookup_counter(true).Add();
+            return true;
+        }
+    }
+
+    lookup_counter(false).Add();
+    cardano_transaction_t* transaction = DecodeFrozen(TxHash, Cbor, OutError);
+    if (!transaction)
+    {
+        return false;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    AddLocked(TxHash, transaction);
+    return ReadLocked(TxHash, Reader);
+}
+
+bool UCardanoTransactionCache::Add(cardano_transaction_t* Transaction)
+{
+    if (!Transaction || cardano_transaction_freeze(Transaction) != CARDANO_SUCCESS)
+    {
+        return false;
+    }
+
+    cardano_blake2b_hash_t* id = cardano_transaction_get_id(Transaction);
+    if (!id || cardano_blake2b_hash_get_bytes_size(id) != FCardanoHash32::Size)
+    {
+        cardano_blake2b_hash_unref(&id);
+        return false;
+    }
+
+    FCardanoHash32 TxHash;
+    FMemory::Memcpy(TxHash.Bytes, cardano_blake2b_hash_get_data(id), FCardanoHash32::Size);
+    cardano_blake2b_hash_unref(&id);
+
+    FScopeLock ScopeLock(&Lock);
+    cardano_transaction_ref(Transaction);
+    AddLocked(TxHash, Transaction);
+    return true;
+}
+
+void UCardanoTransactionCache::Remove(const FCardanoHash32& TxHash)
+{
+    FScopeLock ScopeLock(&Lock);
+    RemoveLocked(TxHash);
+}
+
+void UCardanoTransactionCache::Clear()
+{
+    FScopeLock ScopeLock(&Lock);
+    for (TPair<FCardanoHash32, FEntry>& Pair : Entries)
+    {
+        cardano_transaction_unref(&Pair.Value.Transaction);
+    }
+    Entries.Empty();
+    Order.Empty();
+    bytes_gauge().Add(-MemoryBytes);
+    MemoryBytes = 0;
+}
+
+int32 UCardanoTransactionCache::Num() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return Entries.Num();
+}
+
+int64 UCardanoTransactionCache::GetMemoryBytes() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return MemoryBytes;
+}
+
+cardano_transaction_t* UCardanoTransactionCache::DecodeFrozen(const FCardanoHash32& TxHash, const TArray<uint8>& Cbor, FString& OutError)
+{
+    CARDANO_SCOPE(CardanoSerialize);
+
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_new(Cbor.GetData(), Cbor.Num());
+    cardano_transaction_t* transaction = nullptr;
+    cardano_error_t result = cardano_transaction_from_cbor_lazy(reader, &transaction);
+    cardano_cbor_reader_unref(&reader);
+
+    if (result != CARDANO_SUCCESS)
+    {
+        OutError = FString::Printf(TEXT("Failed to decode transaction %s: %s"), *TxHash.ToHex(), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+        return nullptr;
+    }
+
+    cardano_blake2b_hash_t* id = cardano_transaction_get_id(transaction);
+    const bool bMatches = id && cardano_blake2b_hash_get_bytes_size(id) == FCardanoHash32::Size
+        && FMemory::Memcmp(cardano_blake2b_hash_get_data(id), TxHash.Bytes, FCardanoHash32::Size) == 0;
+    cardano_blake2b_hash_unref(&id);
+
+    if (!bMatches)
+    {
+        OutError = FString::Printf(TEXT("CBOR given for transaction %s hashes to another id"), *TxHash.ToHex());
+        cardano_transaction_unref(&transaction);
+        return nullptr;
+    }
+
+    // Freezing decodes the witness set and auxiliary data kept lazily, so no reader ever writes to a cached transaction
+    result = cardano_transaction_freeze(transaction);
+    if (result != CARDANO_SUCCESS)
+    {
+        OutError = FString::Printf(TEXT("Failed to decode transaction %s: %s"), *TxHash.ToHex(), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+        cardano_transaction_unref(&transaction);
+        return nullptr;
+    }
+
+    return transaction;
+}
+
+bool UCardanoTransactionCache::ReadLocked(const FCardanoHash32& TxHash, TFunctionRef<void(cardano_transaction_t*)> Reader)
+{
+    FEntry* Entry = Entries.Find(TxHash);
+    if (!Entry)
+    {
+        return false;
+    }
+
+    if (Entry->Node != Order.GetHead())
+    {
+        Order.RemoveNode(Entry->Node, false);
+        Order.AddHead(Entry->Node);
+    }
+
+    Reader(Entry->Transaction);
+    return true;
+}
+
+void UCardanoTransactionCache::AddLocked(const FCardanoHash32& TxHash, cardano_transaction_t* Transaction)
+{
+    // Another thread may have decoded the same transaction meanwhile; the copy already cached stays
+    if (Entries.Contains(TxHash))
+    {
+        cardano_transaction_unref(&Transaction);
+        return;
+    }
+
+    FEntry& Entry = Entries.Add(TxHash);
+    Entry.Transaction = Transaction;
+    Entry.Bytes = measure(Transaction);
+    Order.AddHead(TxHash);
+    Entry.Node = Order.GetHead();
+    MemoryBytes += Entry.Bytes;
+    bytes_gauge().Add(Entry.Bytes);
+
+    // The newest entry is kept even if it alone exceeds the budget, so the reader that decoded it can use it
+    const int64 MaxBytes = static_cast<int64>(FMath::Max(MaxMemoryMegabytes, 1)) * 1024 * 1024;
+    while (MemoryBytes > MaxBytes && Order.Num() > 1)
+    {
+        const FCardanoHash32 Oldest = Order.GetTail()->GetValue();
+        RemoveLocked(Oldest);
+    }
+}
+
+void UCardanoTransactionCache::RemoveLocked(const FCardanoHash32& TxHash)
+{
+    FEntry Entry;
+    if (!Entries.RemoveAndCopyValue(TxHash, Entry))
+    {
+        return;
+    }
+
+    Order.RemoveNode(Entry.Node);
+    MemoryBytes -= Entry.Bytes;
+    bytes_gauge().Add(-Entry.Bytes);
+    cardano_transaction_unref(&Entry.Transaction);
+}
@@ -0,0 +1,385 @@
+#include "CardanoTransactionView.h"
+#include "CardanoLog.h"
+#include "CardanoStats.h"
+#include <cardano/cardano.h>
+#include <sodium.h>
+
+namespace
+{
+    const uint64 BODY_KEY_INPUTS = 0;
+    const uint64 BODY_KEY_FEE = 2;
+    const uint64 BODY_KEY_TTL = 3;
+    const uint64 BODY_KEY_VALIDITY_START = 8;
+    const uint64 BODY_KEY_MINT = 9;
+    const uint64 BODY_KEY_REFERENCE_INPUTS = 18;
+
+    int32 get_offset(cardano_cbor_reader_t* reader, int32 Size)
+    {
+        size_t remaining = 0;
+        cardano_cbor_reader_get_bytes_remaining(reader, &remaining);
+        return Size - static_cast<int32>(remaining);
+    }
+
+    bool is_at(cardano_cbor_reader_t* reader, cardano_cbor_reader_state_t expected)
+    {
+        cardano_cbor_reader_state_t state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+        return cardano_cbor_reader_peek_state(reader, &state) == CARDANO_SUCCESS && state == expected;
+    }
+
+    /** Whether the definite or indefinite container holding Count items, of which Read were read, has more. */
+    bool has_more(cardano_cbor_reader_t* reader, int64_t Count, int64_t Read, cardano_cbor_reader_state_t end_state)
+    {
+        return Count < 0 ? !is_at(reader, end_state) : Read < Count;
+    }
+
+    /** Reads an input set, tagged 258 since Conway, as "TxHash#TxIndex" strings. */
+    bool read_inputs(cardano_cbor_reader_t* reader, TArray<FString>& OutInputs)
+    {
+        cardano_cbor_tag_t tag;
+        bool bValid = !is_at(reader, CARDANO_CBOR_READER_STATE_TAG) || cardano_cbor_reader_read_tag(reader, &tag) == CARDANO_SUCCESS;
+
+        int64_t count = 0;
+        bValid = bValid && cardano_cbor_reader_read_start_array(reader, &count) == CARDANO_SUCCESS;
+        for (int64_t i = 0; bValid && has_more(reader, count, i, CARDANO_CBOR_READER_STATE_END_ARRAY); ++i)
+        {
+            const byte_t* hash = nullptr;
+            size_t hash_size = 0;
+            int64_t pair_size = 0;
+            uint64_t index = 0;
+
+            bValid = cardano_cbor_reader_read_start_array(reader, &pair_size) == CARDANO_SUCCESS &&
+                cardano_cbor_reader_read_bytestring_view(reader, &hash, &hash_size) == CARDANO_SUCCESS &&
+                hash_size == FCardanoHash32::Size &&
+                cardano_cbor_reader_read_uint(reader, &index) == CARDANO_SUCCESS &&
+                cardano_cbor_reader_read_end_array(reader) == CARDANO_SUCCESS;
+
+            if (bValid)
+            {
+                OutInputs.Add(FString::Printf(TEXT("%s#%llu"), *CardanoBytesToHex(hash, FCardanoHash32::Size), static_cast<unsigned long long>(index)));
+            }
+        }
+        return bValid && cardano_cbor_reader_read_end_array(reader) == CARDANO_SUCCESS;
+    }
+
+    /** Reads a mint map, policy id to asset name to signed quantity. */
+    bool read_mint(cardano_cbor_reader_t* reader, TArray<FTokenBalance>& OutMint)
+    {
+        int64_t policies = 0;
+        bool bValid = cardano_cbor_reader_read_start_map(reader, &policies) == CARDANO_SUCCESS;
+        for (int64_t p = 0; bValid && has_more(reader, policies, p, CARDANO_CBOR_READER_STATE_END_MAP); ++p)
+        {
+            const byte_t* policy_id = nullptr;
+            size_t policy_id_size = 0;
+            int64_t assets = 0;
+
+            bValid = cardano_cbor_reader_read_bytestring_view(reader, &policy_id, &policy_id_size) == CARDANO_SUCCESS &&
+                cardano_cbor_reader_read_start_map(reader, &assets) == CARDANO_SUCCESS;
+
+            const FString PolicyId = bValid ? CardanoBytesToHex(policy_id, static_cast<int32>(policy_id_size)) : FString();
+            for (int64_t a = 0; bValid && has_more(reader, assets, a, CARDANO_CBOR_READER_STATE_END_MAP); ++a)
+            {
+                const byte_t* name = nullptr;
+                size_t name_size = 0;
+                int64_t quantity = 0;
+
+                bValid = cardano_cbor_reader_read_bytestring_view(reader, &name, &name_size) == CARDANO_SUCCESS &&
+                    cardano_cbor_reader_read_int(reader, &quantity) == CARDANO_SUCCESS;
+
+                if (bValid)
+                {
+                    FTokenBalance& Token = OutMint.AddDefaulted_GetRef();
+                    Token.PolicyId = PolicyId;
+                    Token.AssetName = CardanoBytesToHex(name, static_cast<int32>(name_size));
+                    Token.Quantity = LexToString(quantity);
+                }
+            }
+            bValid = bValid && cardano_cbor_reader_read_end_map(reader) == CARDANO_SUCCESS;
+        }
+        return bValid && cardano_cbor_reader_read_end_map(reader) == CARDANO_SUCCESS;
+    }
+
+    cardano_error_t on_output(void* context, size_t, size_t, const byte_t* address_bytes, size_t address_size, uint64_t coin)
+    {
+        TArray<FCardanoTxOutputDetails>& Outputs = *static_cast<TArray<FCardanoTxOutputDetails>*>(context);
+        FCardanoTxOutputDetails& Output = Outputs.AddDefaulted_GetRef();
+        Output.Lovelace = static_cast<int64>(coin);
+
+        cardano_address_t* address = nullptr;
+        if (cardano_address_from_bytes(address_bytes, address_size, &address) == CARDANO_SUCCESS)
+        {
+            Output.Address = UTF8_TO_TCHAR(cardano_address_get_string(address));
+        }
+        cardano_address_unref(&address);
+        return CARDANO_SUCCESS;
+    }
+
+    cardano_error_t on_asset(void* context, size_t, size_t, const byte_t* policy_id, size_t policy_id_size,
+        const byte_t* asset_name, size_t asset_name_size, uint64_t quantity)
+    {
+        TArray<FCardanoTxOutputDetails>& Outputs = *static_cast<TArray<FCardanoTxOutputDetails>*>(context);
+        FTokenBalance& Token = Outputs.Last().Assets.AddDefaulted_GetRef();
+        Token.PolicyId = CardanoBytesToHex(policy_id, static_cast<int32>(policy_id_size));
+        Token.AssetName = CardanoBytesToHex(asset_name, static_cast<int32>(asset_name_size));
+        Token.Quantity = LexToString(quantity);
+        return CARDANO_SUCCESS;
+    }
+
+    cardano_error_t on_metadatum(void* context, size_t, uint64_t label, const byte_t* data, size_t size)
+    {
+        TArray<FCardanoTxMetadatum>& Metadata = *static_cast<TArray<FCardanoTxMetadatum>*>(context);
+        FCardanoTxMetadatum& Entry = Metadata.AddDefaulted_GetRef();
+        Entry.Label = static_cast<int64>(label);
+        Entry.Cbor = CardanoBytesToHex(data, static_cast<int32>(size));
+
+        cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(data, size);
+        cardano_metadatum_t* metadatum = nullptr;
+        if (reader && cardano_metadatum_from_cbor(reader, &metadatum) == CARDANO_SUCCESS)
+        {
+            const size_t json_size = cardano_metadatum_get_json_size(metadatum);
+            TArray<ANSICHAR> Json;
+            Json.SetNumUninitialized(static_cast<int32>(json_size));
+            if (json_size > 0 && cardano_metadatum_to_json(metadatum, Json.GetData(), json_size) == CARDANO_SUCCESS)
+            {
+                Entry.Json = UTF8_TO_TCHAR(Json.GetData());
+            }
+        }
+        cardano_metadatum_unref(&metadatum);
+        cardano_cbor_reader_unref(&reader);
+        return CARDANO_SUCCESS;
+    }
+}
+
+UCardanoTransactionView* UCardanoTransactionView::CreateTransactionView(const TArray<uint8>& Transaction, FString& OutError)
+{
+    UCardanoTransactionView* View = NewObject<UCardanoTransactionView>();
+    View->Transaction = Transaction;
+    return View->Index(OutError) ? View : nullptr;
+}
+
+bool UCardanoTransactionView::Index(FString& OutError)
+{
+    CARDANO_SCOPE(CardanoSerialize);
+
+    const int32 Size = Transaction.Num();
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(Transaction.GetData(), Size);
+    if (!reader)
+    {
+        OutError = TEXT("Failed to create CBOR reader");
+        return false;
+    }
+
+    int64_t tx_items = 0;
+    int64_t body_entries = 0;
+    bool bValid = cardano_cbor_reader_read_start_array(reader, &tx_items) == CARDANO_SUCCESS;
+    if (bValid)
+    {
+        Body.Offset = get_offset(reader, Size);
+        bValid = cardano_cbor_reader_read_start_map(reader, &body_entries) == CARDANO_SUCCESS;
+    }
+
+    // Each field is only stepped over: its span is all the getters need to decode it later
+    for (int64_t entry = 0; bValid && has_more(reader, body_entries, entry, CARDANO_CBOR_READER_STATE_END_MAP); ++entry)
+    {
+        uint64_t key = 0;
+        const byte_t* field = nullptr;
+        size_t field_size = 0;
+
+        bValid = cardano_cbor_reader_read_uint(reader, &key) == CARDANO_SUCCESS &&
+            cardano_cbor_reader_read_encoded_value_view(reader, &field, &field_size) == CARDANO_SUCCESS;
+
+        if (bValid && key < BODY_KEY_COUNT)
+        {
+            BodyFields[key].Offset = static_cast<int32>(field - Transaction.GetData());
+            BodyFields[key].Size = static_cast<int32>(field_size);
+        }
+    }
+
+    bValid = bValid && cardano_cbor_reader_read_end_map(reader) == CARDANO_SUCCESS;
+    Body.Size = get_offset(reader, Size) - Body.Offset;
+
+    // The witness set, then the phase-2 validity flag of post-Alonzo transactions
+    bool is_valid = true;
+    bValid = bValid && cardano_cbor_reader_skip_value(reader) == CARDANO_SUCCESS;
+    if (bValid && is_at(reader, CARDANO_CBOR_READER_STATE_BOOLEAN))
+    {
+        bValid = cardano_cbor_reader_read_bool(reader, &is_valid) == CARDANO_SUCCESS;
+    }
+
+    if (bValid && !is_at(reader, CARDANO_CBOR_READER_STATE_NULL) && !is_at(reader, CARDANO_CBOR_READER_STATE_END_ARRAY))
+    {
+        const byte_t* aux = nullptr;
+        size_t aux_size = 0;
+        bValid = cardano_cbor_reader_read_encoded_value_view(reader, &aux, &aux_size) == CARDANO_SUCCESS;
+        if (bValid)
+        {
+            AuxiliaryData.Offset = static_cast<int32>(aux - Transaction.GetData());
+            AuxiliaryData.Size = static_cast<int32>(aux_size);
+        }
+    }
+    else if (bValid && is_at(reader, CARDANO_CBOR_READER_STATE_NULL))
+    {
+        bValid = cardano_cbor_reader_read_null(reader) == CARDANO_SUCCESS;
+    }
+
+    bValid = bValid && cardano_cbor_reader_read_end_array(reader) == CARDANO_SUCCESS && get_offset(reader, Size) == Size;
+    cardano_cbor_reader_unref(&reader);
+
+    if (!bValid || !BodyFields[BODY_KEY_INPUTS].IsSet() || !BodyFields[BODY_KEY_FEE].IsSet())
+    {
+        OutError = TEXT("Not a transaction");
+        return false;
+    }
+    return true;
+}
+
+const UCardanoTransactionView::FSpan& UCardanoTransactionView::GetBodyField(uint64 Key) const
+{
+    static const FSpan None;
+    return Key < BODY_KEY_COUNT ? BodyFields[Key] : None;
+}
+
+uint64 UCardanoTransactionView::ReadBodyUInt(uint64 Key) const
+{
+    const FSpan& Field = GetBodyField(Key);
+    if (!Field.IsSet())
+    {
+        return 0;
+    }
+
+    uint64_t value = 0;
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(Transaction.GetData() + Field.Offset, Field.Size);
+    if (!reader || cardano_cbor_reader_read_uint(reader, &value) != CARDANO_SUCCESS)
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Transaction body field %llu is not an unsigned integer"), static_cast<unsigned long long>(Key));
+    }
+    cardano_cbor_reader_unref(&reader);
+    return value;
+}
+
+FString UCardanoTransactionView::GetTxHash() const
+{
+    if (!TxHash.IsSet())
+    {
+        FCardanoHash32& Hash = TxHash.Emplace();
+        crypto_generichash(Hash.Bytes, FCardanoHash32::Size, Transaction.GetData() + Body.Offset, Body.Size, nullptr, 0);
+    }
+    return TxHash->ToHex();
+}
+
+TArray<FString> UCardanoTransactionView::GetInputs() const
+{
+    if (!Inputs.IsSet())
+    {
+        CARDANO_SCOPE(CardanoSerialize);
+
+        const FSpan& Field = GetBodyField(BODY_KEY_INPUTS);
+        cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(Transaction.GetData() + Field.Offset, Field.Size);
+        if (!reader || !read_inputs(reader, Inputs.Emplace()))
+        {
+            UE_LOG(LogCardano, Warning, TEXT("Transaction %s has malformed inputs"), *GetTxHash());
+        }
+        cardano_cbor_reader_unref(&reader);
+    }
+    return Inputs.GetValue();
+}
+
+TArray<FString> UCardanoTransactionView::GetReferenceInputs() const
+{
+    if (!ReferenceInputs.IsSet())
+    {
+        CARDANO_SCOPE(CardanoSerialize);
+
+        const FSpan& Field = GetBodyField(BODY_KEY_REFERENCE_INPUTS);
+        TArray<FString>& Decoded = ReferenceInputs.Emplace();
+        if (Field.IsSet())
+        {
+            cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(Transaction.GetData() + Field.Offset, Field.Size);
+            if (!reader || !read_inputs(reader, Decoded))
+            {
+                UE_LOG(LogCardano, Warning, TEXT("Transaction %s has malformed reference inputs"), *GetTxHash());
+            }
+            cardano_cbor_reader_unref(&reader);
+        }
+    }
+    return ReferenceInputs.GetValue();
+}
+
+TArray<FCardanoTxOutputDetails> UCardanoTransactionView::GetOutputs() const
+{
+    if (!Outputs.IsSet())
+    {
+        CARDANO_SCOPE(CardanoSerialize);
+
+        // The visitor steps over everything but the outputs, and hands their addresses and assets over in place
+        cardano_transaction_visitor_t visitor = {};
+        visitor.context = &Outputs.Emplace();
+        visitor.output = on_output;
+        visitor.asset = on_asset;
+
+        if (cardano_transaction_visit(Transaction.GetData(), Transaction.Num(), &visitor) != CARDANO_SUCCESS)
+        {
+            UE_LOG(LogCardano, Warning, TEXT("Transaction %s has malformed outputs"), *GetTxHash());
+        }
+    }
+    return Outputs.GetValue();
+}
+
+TArray<FTokenBalance> UCardanoTransactionView::GetMint() const
+{
+    if (!Mint.IsSet())
+    {
+        CARDANO_SCOPE(CardanoSerialize);
+
+        const FSpan& Field = GetBodyField(BODY_KEY_MINT);
+        TArray<FTokenBalance>& Decoded = Mint.Emplace();
+        if (Field.IsSet())
+        {
+            cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(Transaction.GetData() + Field.Offset, Field.Size);
+            if (!reader || !read_mint(reader, Decoded))
+            {
+                UE_LOG(LogCardano, Warning, TEXT("Transaction %s has a malformed mint"), *GetTxHash());
+            }
+            cardano_cbor_reader_unref(&reader);
+        }
+    }
+    return Mint.GetValue();
+}
+
+int64 UCardanoTransactionView::GetFee() const
+{
+    // Single integers are cheaper to read again than to keep
+    return static_cast<int64>(ReadBodyUInt(BODY_KEY_FEE));
+}
+
+int64 UCardanoTransactionView::GetInvalidBefore() const
+{
+    return static_cast<int64>(ReadBodyUInt(BODY_KEY_VALIDITY_START));
+}
+
+int64 UCardanoTransactionView::GetInvalidAfter() const
+{
+    return static_cast<int64>(ReadBodyUInt(BODY_KEY_TTL));
+}
+
+TArray<FCardanoTxMetadatum> UCardanoTransactionView::GetMetadata() const
+{
+    if (!Metadata.IsSet())
+    {
+        CARDANO_SCOPE(CardanoSerialize);
+
+        TArray<FCardanoTxMetadatum>& Decoded = Metadata.Emplace();
+        if (AuxiliaryData.IsSet())
+        {
+            // The visitor knows the Shelley, Mary and Alonzo forms of the auxiliary data
+            cardano_transaction_visitor_t visitor = {};
+            visitor.context = &Decoded;
+            visitor.metadatum = on_metadatum;
+
+            if (cardano_transaction_visit(Transaction.GetData(), Transaction.Num(), &visitor) != CARDANO_SUCCESS)
+            {
+                UE_LOG(LogCardano, Warning, TEXT("Transaction %s has malformed metadata"), *GetTxHash());
+            }
+        }
+    }
+    return Metadata.GetValue();
+}
@@ -0,0 +1,91 @@
+#include "CardanoTxBuilder.h"
+#include "CardanoLog.h"
+#include "CardanoProtocolParamsCache.h"
+
+UCardanoTxBuilder* UCardanoTxBuilder::CreateTxBuilder(const FCardanoProtocolParameters& Parameters, int32 NetworkMagic)
+{
+    FString Error;
+    FCardanoTxBuilder Native = FCardanoTxBuilder::Create(Parameters, FCardanoProvider::CreateOffline(static_cast<cardano_network_magic_t>(NetworkMagic)), Error);
+    if (!Native.IsValid())
+    {
+        UE_LOG(LogCardano, Error, TEXT("%s"), *Error);
+        return nullptr;
+    }
+
+    UCardanoTxBuilder* TxBuilder = NewObject<UCardanoTxBuilder>();
+    TxBuilder->Native = MoveTemp(Native);
+    return TxBuilder;
+}
+
+UCardanoTxBuilder* UCardanoTxBuilder::CreateTxBuilderFromCache(int32 NetworkMagic)
+{
+    UCardanoProtocolParamsCache* Cache = UCardanoProtocolParamsCache::Get();
+    FCardanoProtocolParameters Parameters;
+    if (!Cache || !Cache->GetCachedParameters(Parameters))
+    {
+        UE_LOG(LogCardano, Error, TEXT("No cached protocol parameters available for the transaction builder"));
+        return nullptr;
+    }
+
+    return CreateTxBuilder(Parameters, NetworkMagic);
+}
+
+UCardanoTxBuilder* UCardanoTxBuilder::SendLovelace(const FString& Address, int64 Lovelace)
+{
+    Native.SendLovelace(Address, Lovelace);
+    return this;
+}
+
+UCardanoTxBuilder* UCardanoTxBuilder::SendValue(const FString& Address, int64 Lovelace, const TArray<FTokenBalance>& Assets)
+{
+    Native.SendValue(Address, Lovelace, Assets);
+    return this;
+}
+
+UCardanoTxBuilder* UCardanoTxBuilder::SendAssets(const FString& Address, int64 Lovelace, const TArray<FTokenBalance>& Assets)
+{
+    Native.SendAssets(Address, Lovelace, Assets);
+    return this;
+}
+
+UCardanoTxBuilder* UCardanoTxBuilder::SendOutputs(const TArray<FTransactionOutput>& Outputs)
+{
+    Native.SendOutputs(Outputs);
+    return this;
+}
+
+UCardanoTxBuilder* UCardanoTxBuilder::SetChangeAddress(const FString& Address)
+{
+    Native.SetChangeAddress(Address);
+    return this;
+}
+
+UCardanoTxBuilder* UCardanoTxBuilder::SetUTxOs(const FString& OwnerAddress, const TArray<FUTxO>& UTxOs)
+{
+    Native.SetUTxOs(OwnerAddress, UTxOs);
+    return this;
+}
+
+UCardanoTxBuilder* UCardanoTxBuilder::AddReferenceInput(const FString& TxHash, int32 TxIndex)
+{
+    Native.AddReferenceInput(FStringView(TxHash), TxIndex);
+    return this;
+}
+
+UCardanoTxBuilder* UCardanoTxBuilder::SetInvalidAfter(int64 Slot)
+{
+    Native.SetInvalidAfter(Slot);
+    return this;
+}
+
+bool UCardanoTxBuilder::Build(TArray<uint8>& OutTransaction, FString& OutError)
+{
+    OutTransaction = Native.BuildCbor(OutError);
+    return OutTransaction.Num() > 0;
+}
+
+void UCardanoTxBuilder::BeginDestroy()
+{
+    Native = FCardanoTxBuilder();
+    Super::BeginDestroy();
+}
@@ -0,0 +1,317 @@
+#include "CardanoTxBuilderHelpers.h"
+#include "CardanoHandle.h"
+#include "CardanoHash.h"
+#include "CardanoStats.h"
+#include <cardano/providers/provider.h>
+#include <cardano/providers/provider_impl.h>
+
+static cardano_error_t set_unit_interval(
+    cardano_protocol_parameters_t* params,
+    double value,
+    cardano_error_t (*setter)(cardano_protocol_parameters_t*, cardano_unit_interval_t*))
+{
+    TCardanoRef<cardano_unit_interval_t> Interval;
+    cardano_error_t result = cardano_unit_interval_from_double(value, Interval.GetInitReference());
+    if (result == CARDANO_SUCCESS)
+    {
+        result = setter(params, Interval.Get());
+    }
+    return result;
+}
+
+cardano_error_t create_protocol_parameters(const FCardanoProtocolParameters& Parameters, cardano_protocol_parameters_t** out_params)
+{
+    TCardanoRef<cardano_protocol_parameters_t> Params;
+    cardano_error_t result = cardano_protocol_parameters_new(Params.GetInitReference());
+    if (result != CARDANO_SUCCESS)
+    {
+        return result;
+    }
+
+    cardano_protocol_parameters_t* params = Params.Get();
+
+    result = cardano_protocol_parameters_set_min_fee_a(params, static_cast<uint64_t>(Parameters.MinFeeA));
+    if (result == CARDANO_SUCCESS) result = cardano_protocol_parameters_set_min_fee_b(params, static_cast<uint64_t>(Parameters.MinFeeB));
+    if (result == CARDANO_SUCCESS) result = cardano_protocol_parameters_set_max_tx_size(params, static_cast<uint64_t>(Parameters.MaxTxSize));
+    if (result == CARDANO_SUCCESS) result = cardano_protocol_parameters_set_max_value_size(params, static_cast<int64_t>(Parameters.MaxValueSize));
+    if (result == CARDANO_SUCCESS) result = cardano_protocol_parameters_set_ada_per_utxo_byte(params, static_cast<uint64_t>(Parameters.CoinsPerUTxOByte));
+    if (result == CARDANO_SUCCESS) result = cardano_protocol_parameters_set_key_deposit(params, static_cast<uint64_t>(Parameters.KeyDeposit));
+    if (result == CARDANO_SUCCESS) result = cardano_protocol_parameters_set_pool_deposit(params, static_cast<uint64_t>(Parameters.PoolDeposit));
+    if (result == CARDANO_SUCCESS) result = cardano_protocol_parameters_set_drep_deposit(params, static_cast<uint64_t>(Parameters.DRepDeposit));
+    if (result == CARDANO_SUCCESS) result = cardano_protocol_parameters_set_governance_action_deposit(params, static_cast<uint64_t>(Parameters.GovActionDeposit));
+    if (result == CARDANO_SUCCESS) result = cardano_protocol_parameters_set_collateral_percentage(params, static_cast<uint64_t>(Parameters.CollateralPercentage));
+    if (result == CARDANO_SUCCESS) result = cardano_protocol_parameters_set_max_collateral_inputs(params, static_cast<uint64_t>(Parameters.MaxCollateralInputs));
+    if (result == CARDANO_SUCCESS) result = set_unit_interval(params, Parameters.RefScriptCostPerByte, cardano_protocol_parameters_set_ref_script_cost_per_byte);
+
+    // The fee code dereferences the execution prices even for transactions without scripts
+    if (result == CARDANO_SUCCESS)
+    {
+        TCardanoRef<cardano_unit_interval_t> MemoryPrices;
+        TCardanoRef<cardano_unit_interval_t> StepsPrices;
+        TCardanoRef<cardano_ex_unit_prices_t> Prices;
+
+        result = cardano_unit_interval_from_double(Parameters.PriceMemory, MemoryPrices.GetInitReference());
+        if (result == CARDANO_SUCCESS) result = cardano_unit_interval_from_double(Parameters.PriceSteps, StepsPrices.GetInitReference());
+        if (result == CARDANO_SUCCESS) result = cardano_ex_unit_prices_new(MemoryPrices.Get(), StepsPrices.Get(), Prices.GetInitReference());
+        if (result == CARDANO_SUCCESS) result = cardano_protocol_parameters_set_execution_costs(params, Prices.Get());
+    }
+
+    if (result != CARDANO_SUCCESS)
+    {
+        return result;
+    }
+
+    *out_params = Params.Release();
+    return CARDANO_SUCCESS;
+}
+
+cardano_error_t create_offline_provider(cardano_network_magic_t magic, cardano_provider_t** out_provider)
+{
+    cardano_provider_impl_t impl = {};
+    FCStringAnsi::Strncpy(impl.name, "CardanoPlugin", sizeof(impl.name));
+    impl.network_magic = magic;
+
+    return cardano_provider_new(impl, out_provider);
+}
+
+cardano_error_t create_value(int64 Lovelace, TArrayView<const FTokenBalance> Assets, cardano_value_t** out_value)
+{
+    TCardanoRef<cardano_value_t> Value(cardano_value_new_from_coin(Lovelace));
+    if (!Value)
+    {
+        return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    for (const FTokenBalance& Asset : Assets)
+    {
+        // Decoded straight from the TCHAR digits, without a UTF-8 copy of each hex string
+        FCardanoHash28 PolicyId;
+        uint8 Name[32];
+        const int32 NameSize = Asset.AssetName.Len() / 2;
+        cardano_error_t result = FCardanoHash28::FromHex(Asset.PolicyId, PolicyId) && NameSize <= static_cast<int32>(sizeof(Name))
+            && CardanoHexToBytes(*Asset.AssetName, Asset.AssetName.Len(), Name) ? CARDANO_SUCCESS : CARDANO_ERROR_INVALID_ARGUMENT;
+
+        TCardanoRef<cardano_blake2b_hash_t> Policy;
+        TCardanoRef<cardano_asset_name_t> AssetName;
+        if (result == CARDANO_SUCCESS) result = cardano_blake2b_hash_from_bytes(PolicyId.Bytes, FCardanoHash28::Size, Policy.GetInitReference());
+        if (result == CARDANO_SUCCESS) result = cardano_asset_name_from_bytes(Name, NameSize, AssetName.GetInitReference());
+        if (result == CARDANO_SUCCESS) result = cardano_value_add_asset(Value.Get(), Policy.Get(), AssetName.Get(), FCString::Atoi64(*Asset.Quantity));
+
+        if (result != CARDANO_SUCCESS)
+        {
+            return result;
+        }
+    }
+
+    *out_value = Value.Release();
+    return CARDANO_SUCCESS;
+}
+
+cardano_error_t create_tx_hash(const FString& Hex, cardano_blake2b_hash_t** out_hash)
+{
+    FCardanoHash32 Hash;
+    if (!FCardanoHash32::FromHex(Hex, Hash))
+    {
+        return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+    return cardano_blake2b_hash_from_bytes(Hash.Bytes, FCardanoHash32::Size, out_hash);
+}
+
+cardano_error_t create_utxo(cardano_address_t* owner, const FUTxO& UTxO, cardano_utxo_t** out_utxo)
+{
+    TCardanoRef<cardano_blake2b_hash_t> TxHash;
+    TCardanoRef<cardano_transaction_input_t> Input;
+    TCardanoRef<cardano_transaction_output_t> Output;
+    TCardanoRef<cardano_value_t> Value;
+
+    cardano_error_t result = create_tx_hash(UTxO.TxHash, TxHash.GetInitReference());
+    if (result == CARDANO_SUCCESS) result = cardano_transaction_input_new(TxHash.Get(), UTxO.TxIndex, Input.GetInitReference());
+    if (result == CARDANO_SUCCESS) result = cardano_transaction_output_new(owner, static_cast<uint64_t>(UTxO.Value), Output.GetInitReference());
+    if (result == CARDANO_SUCCESS && UTxO.Assets.Num() > 0)
+    {
+        result = create_value(UTxO.Value, UTxO.Assets, Value.GetInitReference());
+        if (result == CARDANO_SUCCESS) result = cardano_transaction_output_set_value(Output.Get(), Value.Get());
+    }
+    if (result == CARDANO_SUCCESS) result = cardano_utxo_new(Input.Get(), Output.Get(), out_utxo);
+    return result;
+}
+
+bool serialize_transaction(cardano_transaction_t* transaction, TArray<uint8>& OutBytes)
+{
+    CARDANO_SCOPE(CardanoSerialize);
+
+    OutBytes.Reset();
+
+    const TCardanoRef<cardano_cbor_writer_t> Writer(cardano_cbor_writer_new());
+    TCardanoRef<cardano_buffer_t> Buffer;
+    if (!Writer ||
+        cardano_transaction_to_cbor(transaction, Writer.Get()) != CARDANO_SUCCESS ||
+        cardano_cbor_writer_encode_in_buffer(Writer.Get(), Buffer.GetInitReference()) != CARDANO_SUCCESS)
+    {
+        return false;
+    }
+
+    OutBytes.Append(cardano_buffer_get_data(Buffer.Get()), cardano_buffer_get_size(Buffer.Get()));
+    return true;
+}
+
+FString hash_to_hex(cardano_blake2b_hash_t* hash)
+{
+    char hex[65] = {};
+    const bool bEncoded = cardano_blake2b_hash_to_hex(hash, hex, sizeof(hex)) == CARDANO_SUCCESS;
+    return bEncoded ? FString(UTF8_TO_TCHAR(hex)) : FString();
+}
+
+bool read_spent_inputs(const TArray<uint8>& TransactionBytes, TSet<FCardanoUTxORef>& OutInputs)
+{
+    TCardanoRef<cardano_transaction_t> Transaction;
+    {
+        const TCardanoRef<cardano_cbor_reader_t> Reader(cardano_cbor_reader_new(TransactionBytes.GetData(), TransactionBytes.Num()));
+        if (!Reader || cardano_transaction_from_cbor_lazy(Reader.Get(), Transaction.GetInitReference()) != CARDANO_SUCCESS)
+        {
+            return false;
+        }
+    }
+
+    const TCardanoRef<cardano_transaction_body_t> Body(cardano_transaction_get_body(Transaction.Get()));
+    const TCardanoRef<cardano_transaction_input_set_t> Inputs(Body ? cardano_transaction_body_get_inputs(Body.Get()) : nullptr);
+    if (!Inputs)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < cardano_transaction_input_set_get_length(Inputs.Get()); i++)
+    {
+        TCardanoRef<cardano_transaction_input_t> Input;
+        if (cardano_transaction_input_set_get(Inputs.Get(), i, Input.GetInitReference()) != CARDANO_SUCCESS)
+        {
+            return false;
+        }
+
+        const TCardanoRef<cardano_blake2b_hash_t> InputId(cardano_transaction_input_get_id(Input.Get()));
+        if (!InputId || cardano_blake2b_hash_get_bytes_size(InputId.Get()) != FCardanoHash32::Size)
+        {
+            return false;
+        }
+
+        FCardanoUTxORef Key;
+        FMemory::Memcpy(Key.TxHash.Bytes, cardano_blake2b_hash_get_data(InputId.Get()), FCardanoHash32::Size);
+        Key.TxIndex = static_cast<uint32>(cardano_transaction_input_get_index(Input.Get()));
+        OutInputs.Add(Key);
+    }
+    return true;
+}
+
+bool read_output_value(cardano_transaction_output_t* output, int64& OutLovelace, TArray<FTokenBalance>& OutAssets)
+{
+    const TCardanoRef<cardano_value_t> Value(cardano_transaction_output_get_value(output));
+    if (!Value)
+    {
+        return false;
+    }
+
+    OutLovelace = cardano_value_get_coin(Value.Get());
+
+    const TCardanoRef<cardano_asset_id_map_t> Assets(cardano_value_as_assets_map(Value.Get()));
+    if (!Assets)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < cardano_asset_id_map_get_length(Assets.Get()); i++)
+    {
+        TCardanoRef<cardano_asset_id_t> AssetId;
+        int64_t quantity = 0;
+        if (cardano_asset_id_map_get_key_value_at(Assets.Get(), i, AssetId.GetInitReference(), &quantity) != CARDANO_SUCCESS)
+        {
+            return false;
+        }
+
+        if (cardano_asset_id_is_lovelace(AssetId.Get()))
+        {
+            continue;
+        }
+
+        const TCardanoRef<cardano_blake2b_hash_t> PolicyId(cardano_asset_id_get_policy_id(AssetId.Get()));
+        const TCardanoRef<cardano_asset_name_t> Name(cardano_asset_id_get_asset_name(AssetId.Get()));
+        if (!PolicyId || !Name)
+        {
+            return false;
+        }
+
+        FTokenBalance& Token = OutAssets.AddDefaulted_GetRef();
+        Token.PolicyId = hash_to_hex(PolicyId.Get());
+        Token.AssetName = UTF8_TO_TCHAR(cardano_asset_name_get_hex(Name.Get()));
+        Token.Quantity = FString::Printf(TEXT("%lld"), static_cast<long long>(quantity));
+    }
+    return true;
+}
+
+bool decode_transaction_utxos(const TArray<uint8>& Bytes, FString& OutTxHash, TArray<FCardanoUTxORef>& OutSpentKeys, TArray<TPair<FString, FUTxO>>& OutOutputs)
+{
+    TCardanoRef<cardano_transaction_t> Transaction;
+    {
+        const TCardanoRef<cardano_cbor_reader_t> Reader(cardano_cbor_reader_new(Bytes.GetData(), Bytes.Num()));
+        if (!Reader || cardano_transaction_from_cbor(Reader.Get(), Transaction.GetInitReference()) != CARDANO_SUCCESS)
+        {
+            return false;
+        }
+    }
+
+    const TCardanoRef<cardano_blake2b_hash_t> TxId(cardano_transaction_get_id(Transaction.Get()));
+    const TCardanoRef<cardano_transaction_body_t> Body(cardano_transaction_get_body(Transaction.Get()));
+    OutTxHash = TxId ? hash_to_hex(TxId.Get()) : FString();
+
+    const TCardanoRef<cardano_transaction_input_set_t> Inputs(Body ? cardano_transaction_body_get_inputs(Body.Get()) : nullptr);
+    const TCardanoRef<cardano_transaction_output_list_t> Outputs(Body ? cardano_transaction_body_get_outputs(Body.Get()) : nullptr);
+    if (OutTxHash.IsEmpty() || !Inputs || !Outputs)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < cardano_transaction_input_set_get_length(Inputs.Get()); i++)
+    {
+        TCardanoRef<cardano_transaction_input_t> Input;
+        if (cardano_transaction_input_set_get(Inputs.Get(), i, Input.GetInitReference()) != CARDANO_SUCCESS)
+        {
+            return false;
+        }
+
+        const TCardanoRef<cardano_blake2b_hash_t> InputId(cardano_transaction_input_get_id(Input.Get()));
+        if (!InputId || cardano_blake2b_hash_get_bytes_size(InputId.Get()) != FCardanoHash32::Size)
+        {
+            return false;
+        }
+
+        // Copied as bytes; the keys never go through hex
+        FCardanoUTxORef& Key = OutSpentKeys.AddDefaulted_GetRef();
+        FMemory::Memcpy(Key.TxHash.Bytes, cardano_blake2b_hash_get_data(InputId.Get()), FCardanoHash32::Size);
+        Key.TxIndex = static_cast<uint32>(cardano_transaction_input_get_index(Input.Get()));
+    }
+
+    for (size_t i = 0; i < cardano_transaction_output_list_get_length(Outputs.Get()); i++)
+    {
+        TCardanoRef<cardano_transaction_output_t> Output;
+        if (cardano_transaction_output_list_get(Outputs.Get(), i, Output.GetInitReference()) != CARDANO_SUCCESS)
+        {
+            return false;
+        }
+
+        const TCardanoRef<cardano_address_t> Address(cardano_transaction_output_get_address(Output.Get()));
+        if (!Address)
+        {
+            return false;
+        }
+
+        FUTxO UTxO;
+        UTxO.TxHash = OutTxHash;
+        UTxO.TxIndex = static_cast<int32>(i);
+        const bool bRead = read_output_value(Output.Get(), UTxO.Value, UTxO.Assets);
+        OutOutputs.Emplace(UTF8_TO_TCHAR(cardano_address_get_string(Address.Get())), MoveTemp(UTxO));
+        if (!bRead)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoTypes.h"
+#include "CardanoHash.h"
+#include <cardano/cardano.h>
+
+/**
+ * Conversions between plugin types and cardano-c objects, shared by UCardanoTxBuilder, FCardanoTxPlanner and the
+ * subsystems decoding transactions. Every function creates new objects and touches no global state, so it may run
+ * on any thread.
+ */
+
+/** Converts Parameters into a new protocol parameters object, execution prices included. */
+cardano_error_t create_protocol_parameters(const FCardanoProtocolParameters& Parameters, cardano_protocol_parameters_t** out_params);
+
+/** Provider without any backend: the plugin resolves UTxOs itself, the builder only needs the network magic. */
+cardano_error_t create_offline_provider(cardano_network_magic_t magic, cardano_provider_t** out_provider);
+
+/** Creates a value holding Lovelace plus the given native tokens; asset names are hex encoded. */
+cardano_error_t create_value(int64 Lovelace, TArrayView<const FTokenBalance> Assets, cardano_value_t** out_value);
+
+/** Creates the UTxO described by UTxO, locked at owner. */
+cardano_error_t create_utxo(cardano_address_t* owner, const FUTxO& UTxO, cardano_utxo_t** out_utxo);
+
+/** Creates a Blake2b-256 hash from 64 hex digits, decoded in place rather than through a UTF-8 copy. */
+cardano_error_t create_tx_hash(const FString& Hex, cardano_blake2b_hash_t** out_hash);
+
+/** Writes the CBOR of transaction to OutBytes. Returns false, leaving OutBytes empty, if it cannot be encoded. */
+bool serialize_transaction(cardano_transaction_t* transaction, TArray<uint8>& OutBytes);
+
+/** Lower-case hex of hash, or an empty string if it cannot be encoded. */
+FString hash_to_hex(cardano_blake2b_hash_t* hash);
+
+/** Reads the outputs a transaction spends; only its body is decoded. */
+bool read_spent_inputs(const TArray<uint8>& TransactionBytes, TSet<FCardanoUTxORef>& OutInputs);
+
+/** Reads the lovelace and native tokens of output into the shape Koios returns them in. */
+bool read_output_value(cardano_transaction_output_t* output, int64& OutLovelace, TArray<FTokenBalance>& OutAssets);
+
+/** Decodes a signed transaction into its hash, the outputs it spends and the outputs it creates, keyed by address. */
+bool decode_transaction_utxos(const TArray<uint8>& Bytes, FString& OutTxHash, TArray<FCardanoUTxORef>& OutSpentKeys, TArray<TPair<FString, FUTxO>>& OutOutputs);
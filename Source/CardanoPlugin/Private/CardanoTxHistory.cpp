@@ -0,0 +1,766 @@
+#include "CardanoTxHistory.h"
+#include "CardanoChainFollower.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoLog.h"
+#include "CardanoTransactionCache.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "CardanoTxStore.h"
+#include "Engine/Engine.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IHttpResponse.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+/** Koios never returns more rows than this per request. */
+static const int32 KOIOS_PAGE_SIZE = 1000;
+
+/** Opened by Initialize; outside the subsystem so UCardanoTransactionCache reads it from any thread. */
+static FCriticalSection GTxStoreLock;
+static TSharedPtr<FCardanoTxStore, ESPMode::ThreadSafe> GTxStore;
+
+static TSharedPtr<FCardanoTxStore, ESPMode::ThreadSafe> GetTxStore()
+{
+    FScopeLock ScopeLock(&GTxStoreLock);
+    return GTxStore;
+}
+
+struct UCardanoTxHistory::FRefreshState
+{
+    FString WalletId;
+    uint32 Generation = 0;
+
+    /** Addresses whose whole history is fetched by this refresh. */
+    TArray<FString> NewAddresses;
+
+    TMap<FString, FCardanoTxSummary> Found;
+    int32 PendingSteps = 0;
+    FString FirstError;
+};
+
+struct UCardanoTxHistory::FDetailsRequest
+{
+    TArray<FString> TxHashes;
+    FOnTxDetailsResult OnComplete;
+    int32 PendingSteps = 0;
+    FString FirstError;
+};
+
+static FString MakeAddressTxsBody(const TArray<FString>& Addresses, int64 AfterBlockHeight)
+{
+    FString RequestBody;
+    RequestBody.Reserve(UCardanoKoiosClient::EstimateStringListBodyLength(Addresses, 64));
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBody);
+
+    Writer->WriteObjectStart();
+    Writer->WriteArrayStart(TEXT("_addresses"));
+    for (const FString& Address : Addresses)
+    {
+        Writer->WriteValue(Address);
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteValue(TEXT("_after_block_height"), AfterBlockHeight);
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return RequestBody;
+}
+
+static FString MakeTxCborBody(const TArray<FString>& TxHashes)
+{
+    FString RequestBody;
+    RequestBody.Reserve(UCardanoKoiosClient::EstimateStringListBodyLength(TxHashes, 20));
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBody);
+
+    Writer->WriteObjectStart();
+    Writer->WriteArrayStart(TEXT("_tx_hashes"));
+    for (const FString& TxHash : TxHashes)
+    {
+        Writer->WriteValue(TxHash);
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return RequestBody;
+}
+
+/** Deserializes a Koios array response, returning an error message on failure. */
+static FString ReadJsonArray(const FHttpResponsePtr& Response, bool Success, TArray<TSharedPtr<FJsonValue>>& OutArray)
+{
+    if (!Success || !Response.IsValid())
+    {
+        return TEXT("Network request failed");
+    }
+    if (Response->GetResponseCode() != 200)
+    {
+        return FString::Printf(TEXT("Koios returned HTTP %d"), Response->GetResponseCode());
+    }
+    if (!ParseJsonArray(Response, OutArray))
+    {
+        return TEXT("Invalid response format");
+    }
+    return TEXT("");
+}
+
+/** Transaction hashes end up in file names, so anything but 64 hex digits is rejected. */
+static bool IsTxHash(const FString& TxHash)
+{
+    if (TxHash.Len() != 64)
+    {
+        return false;
+    }
+    for (const TCHAR Char : TxHash)
+    {
+        if (!FChar::IsHexDigit(Char))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Newest first; transactions of one block keep a stable order so pages do not shuffle between refreshes. */
+static bool IsNewer(const FCardanoTxSummary& A, const FCardanoTxSummary& B)
+{
+    if (A.BlockHeight != B.BlockHeight)
+    {
+        return A.BlockHeight > B.BlockHeight;
+    }
+    return A.TxHash < B.TxHash;
+}
+
+/** Reads the details of a decoded transaction from its body. */
+static void ReadDetails(cardano_transaction_t* transaction, const FCardanoHash32& TxHash, int32 SizeBytes, FCardanoTxDetails& OutDetails)
+{
+    cardano_transaction_body_t* body = cardano_transaction_get_body(transaction);
+    OutDetails.TxHash = TxHash.ToHex();
+    OutDetails.Fee = static_cast<int64>(cardano_transaction_body_get_fee(body));
+    OutDetails.SizeBytes = SizeBytes;
+
+    cardano_transaction_input_set_t* inputs = cardano_transaction_body_get_inputs(body);
+    const size_t input_count = cardano_transaction_input_set_get_length(inputs);
+    OutDetails.Inputs.Reserve(static_cast<int32>(input_count));
+    for (size_t i = 0; i < input_count; i++)
+    {
+        cardano_transaction_input_t* input = nullptr;
+        if (cardano_transaction_input_set_get(inputs, i, &input) != CARDANO_SUCCESS)
+        {
+            continue;
+        }
+
+        cardano_blake2b_hash_t* input_id = cardano_transaction_input_get_id(input);
+        OutDetails.Inputs.Add(FString::Printf(TEXT("%s#%llu"), *hash_to_hex(input_id),
+            static_cast<unsigned long long>(cardano_transaction_input_get_index(input))));
+        cardano_blake2b_hash_unref(&input_id);
+        cardano_transaction_input_unref(&input);
+    }
+    cardano_transaction_input_set_unref(&inputs);
+
+    cardano_transaction_output_list_t* outputs = cardano_transaction_body_get_outputs(body);
+    const size_t output_count = cardano_transaction_output_list_get_length(outputs);
+    OutDetails.Outputs.Reserve(static_cast<int32>(output_count));
+    for (size_t i = 0; i < output_count; i++)
+    {
+        cardano_transaction_output_t* output = nullptr;
+        if (cardano_transaction_output_list_get(outputs, i, &output) != CARDANO_SUCCESS)
+        {
+            continue;
+        }
+
+        FCardanoTxOutputDetails& Output = OutDetails.Outputs.AddDefaulted_GetRef();
+        cardano_address_t* address = cardano_transaction_output_get_address(output);
+        Output.Address = address ? FString(UTF8_TO_TCHAR(cardano_address_get_string(address))) : FString();
+        read_output_value(output, Output.Lovelace, Output.Assets);
+        cardano_address_unref(&address);
+        cardano_transaction_output_unref(&output);
+    }
+    cardano_transaction_output_list_unref(&outputs);
+
+    // The body commits to the auxiliary data by hash, so the metadata itself is not read
+    cardano_blake2b_hash_t* aux_data_hash = cardano_transaction_body_get_aux_data_hash(body);
+    OutDetails.bHasMetadata = aux_data_hash != nullptr;
+    cardano_blake2b_hash_unref(&aux_data_hash);
+
+    cardano_transaction_body_unref(&body);
+}
+
+/** Reads the details of a transaction from its CBOR, through the shared decoded transaction cache when there is one. */
+static bool DecodeTransaction(const FString& TxHash, const TArray<uint8>& Cbor, FCardanoTxDetails& OutDetails, FString& OutError)
+{
+    FCardanoHash32 Hash;
+    if (!FCardanoHash32::FromHex(TxHash, Hash))
+    {
+        OutError = FString::Printf(TEXT("Invalid transaction hash %s"), *TxHash);
+        return false;
+    }
+
+    if (UCardanoTransactionCache* Cache = UCardanoTransactionCache::Get())
+    {
+        return Cache->ReadOrDecode(Hash, Cbor, [&](cardano_transaction_t* transaction)
+        {
+            ReadDetails(transaction, Hash, Cbor.Num(), OutDetails);
+        }, OutError);
+    }
+
+    cardano_transaction_t* transaction = UCardanoTransactionCache::DecodeFrozen(Hash, Cbor, OutError);
+    if (!transaction)
+    {
+        return false;
+    }
+
+    ReadDetails(transaction, Hash, Cbor.Num(), OutDetails);
+    cardano_transaction_unref(&transaction);
+    return true;
+}
+
+UCardanoTxHistory* UCardanoTxHistory::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoTxHistory>() : nullptr;
+}
+
+void UCardanoTxHistory::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Collection.InitializeDependency(UCardanoKoiosClient::StaticClass());
+    Collection.InitializeDependency(UCardanoChainFollower::StaticClass());
+
+    if (UCardanoChainFollower* Follower = UCardanoChainFollower::Get())
+    {
+        Follower->OnRollback.AddDynamic(this, &UCardanoTxHistory::OnRollback);
+    }
+
+    // Segments of an eighth of the budget, so trimming it drops a small part of the history at a time
+    FCardanoTxStore::FOptions Options;
+    Options.MaxBytes = FMath::Max(MaxStoreMegabytes, 1) * 1024LL * 1024;
+    Options.SegmentBytes = FMath::Clamp<int64>(Options.MaxBytes / 8, 1024 * 1024, Options.SegmentBytes);
+
+    TSharedRef<FCardanoTxStore, ESPMode::ThreadSafe> Store = FCardanoTxStore::Open(FPaths::ProjectSavedDir() / TEXT("Cardano") / TEXT("TxStore"), Options);
+    FScopeLock ScopeLock(&GTxStoreLock);
+    GTxStore = Store;
+}
+
+void UCardanoTxHistory::Deinitialize()
+{
+    if (UCardanoChainFollower* Follower = UCardanoChainFollower::Get())
+    {
+        Follower->OnRollback.RemoveDynamic(this, &UCardanoTxHistory::OnRollback);
+    }
+
+    TSharedPtr<FCardanoTxStore, ESPMode::ThreadSafe> Store;
+    {
+        FScopeLock ScopeLock(&GTxStoreLock);
+        Store = MoveTemp(GTxStore);
+    }
+    if (Store.IsValid())
+    {
+        Store->Flush();
+    }
+
+    Super::Deinitialize();
+}
+
+void UCardanoTxHistory::RefreshWallet(const FString& WalletId, const TArray<FString>& Addresses, const FOnTxHistoryRefreshed& OnComplete)
+{
+    FWalletHistory& History = FindOrLoad(WalletId);
+    for (const FString& Address : Addresses)
+    {
+        if (!History.Addresses.Contains(Address))
+        {
+            History.PendingAddresses.Add(Address);
+        }
+    }
+
+    History.PendingCallbacks.Add(OnComplete);
+    if (History.bRefreshInProgress)
+    {
+        return;
+    }
+
+    History.bRefreshInProgress = true;
+    StartRefresh(WalletId);
+}
+
+bool UCardanoTxHistory::GetHistoryPage(const FString& WalletId, int32 PageIndex, int32 PageSize, TArray<FCardanoTxSummary>& OutEntries)
+{
+    OutEntries.Reset();
+
+    const FWalletHistory& History = FindOrLoad(WalletId);
+    if (History.Addresses.Num() == 0)
+    {
+        return false;
+    }
+
+    const int64 First = static_cast<int64>(FMath::Max(PageIndex, 0)) * FMath::Max(PageSize, 0);
+    const int32 Count = static_cast<int32>(FMath::Clamp<int64>(History.Entries.Num() - First, 0, FMath::Max(PageSize, 0)));
+    if (Count > 0)
+    {
+        OutEntries.Append(History.Entries.GetData() + First, Count);
+    }
+    return true;
+}
+
+int32 UCardanoTxHistory::GetHistoryCount(const FString& WalletId)
+{
+    return FindOrLoad(WalletId).Entries.Num();
+}
+
+void UCardanoTxHistory::ForgetWallet(const FString& WalletId)
+{
+    FWalletHistory History;
+    if (Wallets.RemoveAndCopyValue(WalletId, History))
+    {
+        for (const FOnTxHistoryRefreshed& Callback : History.PendingCallbacks)
+        {
+            Callback.ExecuteIfBound(false, TEXT("Wallet history was forgotten"));
+        }
+    }
+
+    IFileManager::Get().Delete(*GetWalletFilePath(WalletId), false, false, true);
+}
+
+UCardanoTxHistory::FWalletHistory& UCardanoTxHistory::FindOrLoad(const FString& WalletId)
+{
+    if (FWalletHistory* Existing = Wallets.Find(WalletId))
+    {
+        return *Existing;
+    }
+
+    FWalletHistory& History = Wallets.Add(WalletId);
+    History.Generation = ++NextGeneration;
+
+    FString JsonString;
+    FCardanoTxHistoryFile Loaded;
+    if (!FFileHelper::LoadFileToString(JsonString, *GetWalletFilePath(WalletId))
+        || !FJsonObjectConverter::JsonObjectStringToUStruct(JsonString, &Loaded, 0, 0)
+        || Loaded.WalletId != WalletId)
+    {
+        return History;
+    }
+
+    History.Entries = MoveTemp(Loaded.Entries);
+    History.Entries.Sort(IsNewer);
+    History.TxHashes.Reserve(History.Entries.Num());
+    for (const FCardanoTxSummary& Entry : History.Entries)
+    {
+        History.TxHashes.Add(Entry.TxHash);
+    }
+    History.Addresses.Append(Loaded.Addresses);
+    History.LastBlockHeight = Loaded.LastBlockHeight;
+
+    if (RolledBackTo != MAX_int64)
+    {
+        DropEntriesAbove(History, RolledBackTo);
+    }
+
+    UE_LOG(LogCardano, Verbose, TEXT("Loaded %d history entries of wallet %s"), History.Entries.Num(), *WalletId);
+    return History;
+}
+
+void UCardanoTxHistory::StartRefresh(const FString& WalletId)
+{
+    FWalletHistory& History = Wallets.FindChecked(WalletId);
+
+    TSharedRef<FRefreshState> Refresh = MakeShared<FRefreshState>();
+    Refresh->WalletId = WalletId;
+    Refresh->Generation = History.Generation;
+    Refresh->NewAddresses = History.PendingAddresses.Array();
+
+    const int32 ChunkSize = UCardanoKoiosClient::Get()->GetMaxAddressesPerRequest();
+
+    // Held until every request is sent, so a response arriving early cannot complete the refresh
+    Refresh->PendingSteps = 1;
+    for (const TArray<FString>& Chunk : ChunkAddresses(History.Addresses.Array(), ChunkSize))
+    {
+        FetchTransactions(Refresh, Chunk, History.LastBlockHeight, 0);
+    }
+    for (const TArray<FString>& Chunk : ChunkAddresses(Refresh->NewAddresses, ChunkSize))
+    {
+        FetchTransactions(Refresh, Chunk, 0, 0);
+    }
+    CompleteStep(Refresh);
+}
+
+void UCardanoTxHistory::FetchTransactions(TSharedRef<FRefreshState> Refresh, const TArray<FString>& Addresses, int64 AfterBlockHeight, int32 Offset)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+
+    // A total order keeps the pages consistent while new transactions are added at the top
+    const FString Path = FString::Printf(TEXT("address_txs?order=block_height.desc,tx_hash.asc&offset=%d&limit=%d"), Offset, KOIOS_PAGE_SIZE);
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateJsonPost(Path, MakeAddressTxsBody(Addresses, AfterBlockHeight));
+
+    TWeakObjectPtr<UCardanoTxHistory> WeakThis(this);
+    ++Refresh->PendingSteps;
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Refresh, Addresses, AfterBlockHeight, Offset](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            const FString Error = ReadJsonArray(Response, Success, JsonArray);
+            if (!Error.IsEmpty() && Refresh->FirstError.IsEmpty())
+            {
+                Refresh->FirstError = Error;
+            }
+
+            // A transaction touching several addresses of the wallet is listed once per address
+            for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+            {
+                TSharedPtr<FJsonObject> TxObject = Item->AsObject();
+                FCardanoTxSummary Summary;
+                if (!TxObject.IsValid() || !TxObject->TryGetStringField("tx_hash", Summary.TxHash)
+                    || !TxObject->TryGetNumberField("block_height", Summary.BlockHeight))
+                {
+                    continue;
+                }
+
+                TxObject->TryGetNumberField("block_time", Summary.BlockTime);
+                TxObject->TryGetNumberField("epoch_no", Summary.EpochNo);
+                Refresh->Found.Add(Summary.TxHash, Summary);
+            }
+
+            if (Refresh->FirstError.IsEmpty() && JsonArray.Num() >= KOIOS_PAGE_SIZE)
+            {
+                WeakThis->FetchTransactions(Refresh, Addresses, AfterBlockHeight, Offset + JsonArray.Num());
+            }
+
+            WeakThis->CompleteStep(Refresh);
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::History);
+}
+
+void UCardanoTxHistory::CompleteStep(TSharedRef<FRefreshState> Refresh)
+{
+    if (--Refresh->PendingSteps > 0)
+    {
+        return;
+    }
+
+    FWalletHistory* History = Wallets.Find(Refresh->WalletId);
+    if (!History || History->Generation != Refresh->Generation)
+    {
+        // Forgotten meanwhile, or rolled back under the refresh: what it found may belong to the old fork
+        if (History)
+        {
+            StartRefresh(Refresh->WalletId);
+        }
+        return;
+    }
+
+    if (!Refresh->FirstError.IsEmpty())
+    {
+        FinishRefresh(Refresh->WalletId, false, Refresh->FirstError);
+        return;
+    }
+
+    const int32 PreviousCount = History->Entries.Num();
+    for (TPair<FString, FCardanoTxSummary>& Entry : Refresh->Found)
+    {
+        bool bAlreadyKnown = false;
+        History->TxHashes.Add(Entry.Key, &bAlreadyKnown);
+        if (!bAlreadyKnown)
+        {
+            History->Entries.Add(MoveTemp(Entry.Value));
+        }
+    }
+
+    const bool bChanged = History->Entries.Num() != PreviousCount || Refresh->NewAddresses.Num() > 0;
+    if (History->Entries.Num() != PreviousCount)
+    {
+        History->Entries.Sort(IsNewer);
+        History->LastBlockHeight = FMath::Max(History->LastBlockHeight, History->Entries[0].BlockHeight);
+    }
+
+    for (const FString& Address : Refresh->NewAddresses)
+    {
+        History->Addresses.Add(Address);
+        History->PendingAddresses.Remove(Address);
+    }
+
+    if (bChanged)
+    {
+        SaveWallet(Refresh->WalletId, *History);
+    }
+
+    UE_LOG(LogCardano, Verbose, TEXT("Wallet %s history has %d entries, %d new"),
+        *Refresh->WalletId, History->Entries.Num(), History->Entries.Num() - PreviousCount);
+
+    // Addresses given by RefreshWallet calls made during this refresh still need their history
+    if (History->PendingAddresses.Num() > 0)
+    {
+        StartRefresh(Refresh->WalletId);
+        return;
+    }
+
+    FinishRefresh(Refresh->WalletId, true, TEXT(""));
+}
+
+void UCardanoTxHistory::FinishRefresh(const FString& WalletId, bool bSuccess, const FString& ErrorMessage)
+{
+    FWalletHistory& History = Wallets.FindChecked(WalletId);
+    History.bRefreshInProgress = false;
+
+    TArray<FOnTxHistoryRefreshed> Callbacks = MoveTemp(History.PendingCallbacks);
+    History.PendingCallbacks.Reset();
+    for (const FOnTxHistoryRefreshed& Callback : Callbacks)
+    {
+        Callback.ExecuteIfBound(bSuccess, ErrorMessage);
+    }
+}
+
+void UCardanoTxHistory::OnRollback(int64 BlockHeight)
+{
+    RolledBackTo = FMath::Min(RolledBackTo, BlockHeight);
+
+    for (TPair<FString, FWalletHistory>& Wallet : Wallets)
+    {
+        const int32 PreviousCount = Wallet.Value.Entries.Num();
+        const int64 PreviousHeight = Wallet.Value.LastBlockHeight;
+        DropEntriesAbove(Wallet.Value, BlockHeight);
+
+        if (Wallet.Value.Entries.Num() != PreviousCount || Wallet.Value.LastBlockHeight != PreviousHeight)
+        {
+            Wallet.Value.Generation = ++NextGeneration;
+            SaveWallet(Wallet.Key, Wallet.Value);
+        }
+    }
+}
+
+void UCardanoTxHistory::DropEntriesAbove(FWalletHistory& History, int64 BlockHeight)
+{
+    // Entries are newest first, so the dropped ones are a prefix
+    int32 Dropped = 0;
+    while (Dropped < History.Entries.Num() && History.Entries[Dropped].BlockHeight > BlockHeight)
+    {
+        History.TxHashes.Remove(History.Entries[Dropped].TxHash);
+        ++Dropped;
+    }
+
+    History.Entries.RemoveAt(0, Dropped);
+    History.LastBlockHeight = FMath::Min(History.LastBlockHeight, BlockHeight);
+}
+
+void UCardanoTxHistory::SaveWallet(const FString& WalletId, const FWalletHistory& History) const
+{
+    FCardanoTxHistoryFile File;
+    File.WalletId = WalletId;
+    File.Addresses = History.Addresses.Array();
+    File.LastBlockHeight = History.LastBlockHeight;
+    File.Entries = History.Entries;
+
+    FString JsonString;
+    if (!FJsonObjectConverter::UStructToJsonObjectString(File, JsonString) ||
+        !FFileHelper::SaveStringToFile(JsonString, *GetWalletFilePath(WalletId)))
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Failed to persist transaction history of wallet %s"), *WalletId);
+    }
+}
+
+void UCardanoTxHistory::GetTransactionDetails(const TArray<FString>& TxHashes, const FOnTxDetailsResult& OnComplete)
+{
+    TSharedRef<FDetailsRequest> Details = MakeShared<FDetailsRequest>();
+    Details->TxHashes = TxHashes;
+    Details->OnComplete = OnComplete;
+
+    TArray<FString> Missing;
+    TSet<FString> Seen;
+    for (const FString& TxHash : TxHashes)
+    {
+        bool bAlreadySeen = false;
+        Seen.Add(TxHash, &bAlreadySeen);
+        if (!bAlreadySeen && IsTxHash(TxHash) && !FindCbor(TxHash))
+        {
+            Missing.Add(TxHash);
+        }
+    }
+
+    if (Missing.Num() == 0)
+    {
+        FinishDetails(*Details);
+        return;
+    }
+
+    Details->PendingSteps = 1;
+    for (const TArray<FString>& Chunk : ChunkAddresses(Missing, UCardanoKoiosClient::Get()->GetMaxAddressesPerRequest()))
+    {
+        FetchCbor(Details, Chunk);
+    }
+
+    if (--Details->PendingSteps == 0)
+    {
+        FinishDetails(*Details);
+    }
+}
+
+void UCardanoTxHistory::FetchCbor(TSharedRef<FDetailsRequest> Details, const TArray<FString>& TxHashes)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateJsonPost(TEXT("tx_cbor"), MakeTxCborBody(TxHashes));
+
+    TWeakObjectPtr<UCardanoTxHistory> WeakThis(this);
+    ++Details->PendingSteps;
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Details](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            const FString Error = ReadJsonArray(Response, Success, JsonArray);
+            if (!Error.IsEmpty() && Details->FirstError.IsEmpty())
+            {
+                Details->FirstError = Error;
+            }
+
+            for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+            {
+                TSharedPtr<FJsonObject> TxObject = Item->AsObject();
+                FString TxHash;
+                FString CborHex;
+                if (!TxObject.IsValid() || !TxObject->TryGetStringField("tx_hash", TxHash) || !IsTxHash(TxHash)
+                    || !TxObject->TryGetStringField("cbor", CborHex) || CborHex.Len() % 2 != 0)
+                {
+                    continue;
+                }
+
+                TArray<uint8> Cbor;
+                Cbor.SetNumUninitialized(CborHex.Len() / 2);
+                if (HexToBytes(CborHex, Cbor.GetData()) != Cbor.Num())
+                {
+                    continue;
+                }
+
+                // Written by the store off the game thread; a block lost to a crash is only downloaded again
+                FCardanoHash32 Hash;
+                TSharedPtr<FCardanoTxStore, ESPMode::ThreadSafe> Store = GetTxStore();
+                if (Store.IsValid() && FCardanoHash32::FromHex(TxHash, Hash))
+                {
+                    Store->Append(Hash, Cbor);
+                }
+                WeakThis->AddCbor(TxHash, MoveTemp(Cbor));
+            }
+
+            if (--Details->PendingSteps == 0)
+            {
+                WeakThis->FinishDetails(*Details);
+            }
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::History);
+}
+
+void UCardanoTxHistory::FinishDetails(const FDetailsRequest& Details)
+{
+    FString ErrorMessage = Details.FirstError;
+    TArray<FCardanoTxDetails> Decoded;
+    Decoded.Reserve(Details.TxHashes.Num());
+
+    for (const FString& TxHash : Details.TxHashes)
+    {
+        FString Error;
+        const TArray<uint8>* Cbor = IsTxHash(TxHash) ? FindCbor(TxHash) : nullptr;
+        if (!Cbor)
+        {
+            Error = FString::Printf(TEXT("Transaction %s not found"), *TxHash);
+        }
+        else
+        {
+            FCardanoTxDetails TxDetails;
+            if (DecodeTransaction(TxHash, *Cbor, TxDetails, Error))
+            {
+                Decoded.Add(MoveTemp(TxDetails));
+            }
+        }
+
+        if (!Error.IsEmpty() && ErrorMessage.IsEmpty())
+        {
+            ErrorMessage = Error;
+        }
+    }
+
+    Details.OnComplete.ExecuteIfBound(ErrorMessage.IsEmpty(), Decoded, ErrorMessage);
+}
+
+const TArray<uint8>* UCardanoTxHistory::FindCbor(const FString& TxHash)
+{
+    const FString Key = TxHash.ToLower();
+    if (const TArray<uint8>* Cached = CborCache.Find(Key))
+    {
+        return Cached;
+    }
+
+    FCardanoHash32 Hash;
+    TArray<uint8> Cbor;
+    if (!FCardanoHash32::FromHex(Key, Hash))
+    {
+        return nullptr;
+    }
+
+    if (!ReadStoredCbor(Hash, Cbor))
+    {
+        const FString LegacyPath = GetLegacyCborFilePath(Key);
+        if (!FFileHelper::LoadFileToArray(Cbor, *LegacyPath, FILEREAD_Silent) || Cbor.Num() == 0)
+        {
+            return nullptr;
+        }
+
+        if (TSharedPtr<FCardanoTxStore, ESPMode::ThreadSafe> Store = GetTxStore())
+        {
+            Store->Append(Hash, Cbor);
+            IFileManager::Get().Delete(*LegacyPath, false, false, true);
+        }
+    }
+
+    AddCbor(Key, MoveTemp(Cbor));
+    return CborCache.Find(Key);
+}
+
+void UCardanoTxHistory::AddCbor(const FString& TxHash, TArray<uint8>&& Cbor)
+{
+    const FString Key = TxHash.ToLower();
+    if (TArray<uint8>* Existing = CborCache.Find(Key))
+    {
+        *Existing = MoveTemp(Cbor);
+        return;
+    }
+
+    CborCache.Add(Key, MoveTemp(Cbor));
+    CborOrder.Add(Key);
+
+    const int32 Excess = CborOrder.Num() - FMath::Max(MaxCachedTransactions, 1);
+    if (Excess > 0)
+    {
+        for (int32 i = 0; i < Excess; i++)
+        {
+            CborCache.Remove(CborOrder[i]);
+        }
+        CborOrder.RemoveAt(0, Excess);
+    }
+}
+
+FString UCardanoTxHistory::GetWalletFilePath(const FString& WalletId) const
+{
+    return FPaths::ProjectSavedDir() / TEXT("Cardano") / TEXT("TxHistory") / FMD5::HashAnsiString(*WalletId) + TEXT(".json");
+}
+
+bool UCardanoTxHistory::ReadStoredCbor(const FCardanoHash32& TxHash, TArray<uint8>& OutCbor)
+{
+    TSharedPtr<FCardanoTxStore, ESPMode::ThreadSafe> Store = GetTxStore();
+    return Store.IsValid() && Store->Read(TxHash, OutCbor);
+}
+
+FString UCardanoTxHistory::GetLegacyCborFilePath(const FString& TxHash)
+{
+    return FPaths::ProjectSavedDir() / TEXT("Cardano") / TEXT("TxCbor") / TxHash.ToLower() + TEXT(".cbor");
+}
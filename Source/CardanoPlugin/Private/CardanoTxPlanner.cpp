@@ -0,0 +1,2019 @@
+#include "CardanoTxPlanner.h"
+#include "CardanoChainTip.h"
+#include "CardanoLog.h"
+#include "CardanoMinAda.h"
+#include "CardanoProtocolParamsCache.h"
+#include "CardanoStats.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "CardanoUTxOCache.h"
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
+#include <cardano/cardano.h>
+#include <cardano/common/utxo_list.h>
+
+/** Bytes of a vkey witness, the only part of a signed transaction the unsigned one lacks, rounded up. */
+static const int32 WITNESS_RESERVE_BYTES = 128;
+
+/** Bytes a payout transaction keeps for its change output when funding it, on top of the 160 the ledger adds. */
+static const int64 CHANGE_OUTPUT_RESERVE_BYTES = 200;
+
+/** Bytes of a transaction input, its hash and index, rounded up. */
+static const int64 INPUT_BYTES = 40;
+
+/** Bytes a policy id and its map header add to an output value, and the most a token quantity takes on top of its name. */
+static const int64 POLICY_BYTES = 32;
+static const int64 TOKEN_QUANTITY_BYTES = 10;
+
+/** Metadata label of CIP-25 token metadata, and the version whose policy ids and asset names are byte strings. */
+static const uint64 CIP25_LABEL = 721;
+static const uint64 CIP25_VERSION = 2;
+
+/** Longest asset name, and longest metadata string before it is split into chunks. */
+static const int32 MAX_ASSET_NAME_BYTES = 32;
+static const int32 METADATA_CHUNK_BYTES = 64;
+
+/** Bytes of the pool key hash a bech32 pool id encodes. */
+static const int32 POOL_ID_BYTES = 28;
+
+/**
+ * Serializes every UTxO of Plan once; malformed entries are skipped, as UCardanoTxBuilder::SetUTxOs does.
+ * OutSourceIndices, when given, receives the index in Plan.UTxOs of each snapshot entry.
+ */
+static bool create_utxo_snapshot(const FCardanoTxPlan& Plan, TArray<TArray<uint8>>& OutSnapshot, FString& OutError, TArray<int32>* OutSourceIndices = nullptr)
+{
+    cardano_address_t* owner = nullptr;
+    FTCHARToUTF8 AddressUtf8(*Plan.OwnerAddress);
+    if (cardano_address_from_string(AddressUtf8.Get(), AddressUtf8.Length(), &owner) != CARDANO_SUCCESS)
+    {
+        OutError = FString::Printf(TEXT("Invalid UTxO owner address: %s"), *Plan.OwnerAddress);
+        return false;
+    }
+
+    OutSnapshot.Reset(Plan.UTxOs.Num());
+    if (OutSourceIndices)
+    {
+        OutSourceIndices->Reset(Plan.UTxOs.Num());
+    }
+
+    for (int32 SourceIndex = 0; SourceIndex < Plan.UTxOs.Num(); ++SourceIndex)
+    {
+        const FUTxO& UTxO = Plan.UTxOs[SourceIndex];
+        cardano_utxo_t* utxo = nullptr;
+        if (create_utxo(owner, UTxO, &utxo) != CARDANO_SUCCESS)
+        {
+            UE_LOG(LogCardano, Warning, TEXT("Skipping malformed UTxO %s#%d"), *UTxO.TxHash, UTxO.TxIndex);
+            continue;
+        }
+
+        cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+        cardano_buffer_t* buffer = nullptr;
+        const bool bEncoded = writer &&
+            cardano_utxo_to_cbor(utxo, writer) == CARDANO_SUCCESS &&
+            cardano_cbor_writer_encode_in_buffer(writer, &buffer) == CARDANO_SUCCESS;
+
+        if (bEncoded)
+        {
+            OutSnapshot.Emplace(cardano_buffer_get_data(buffer), static_cast<int32>(cardano_buffer_get_size(buffer)));
+            if (OutSourceIndices)
+            {
+                OutSourceIndices->Add(SourceIndex);
+            }
+        }
+
+        cardano_buffer_unref(&buffer);
+        cardano_cbor_writer_unref(&writer);
+        cardano_utxo_unref(&utxo);
+
+        if (!bEncoded)
+        {
+            OutError = TEXT("Failed to serialize the UTxO snapshot");
+            cardano_address_unref(&owner);
+            return false;
+        }
+    }
+
+    cardano_address_unref(&owner);
+    return true;
+}
+
+/** Decodes a private copy of the UTxO snapshot for one worker. */
+static cardano_error_t decode_utxo_snapshot(const TArray<TArray<uint8>>& Snapshot, cardano_utxo_list_t** out_utxos)
+{
+    cardano_utxo_list_t* utxos = nullptr;
+    cardano_error_t result = cardano_utxo_list_new(&utxos);
+    if (result == CARDANO_SUCCESS)
+    {
+        result = cardano_utxo_list_reserve(utxos, Snapshot.Num());
+    }
+
+    for (int32 Index = 0; Index < Snapshot.Num() && result == CARDANO_SUCCESS; ++Index)
+    {
+        cardano_cbor_reader_t* reader = cardano_cbor_reader_new(Snapshot[Index].GetData(), Snapshot[Index].Num());
+        cardano_utxo_t* utxo = nullptr;
+
+        result = reader ? cardano_utxo_from_cbor(reader, &utxo) : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+        if (result == CARDANO_SUCCESS)
+        {
+            result = cardano_utxo_list_add(utxos, utxo);
+        }
+
+        cardano_utxo_unref(&utxo);
+        cardano_cbor_reader_unref(&reader);
+    }
+
+    if (result != CARDANO_SUCCESS)
+    {
+        cardano_utxo_list_unref(&utxos);
+        return result;
+    }
+
+    *out_utxos = utxos;
+    return CARDANO_SUCCESS;
+}
+
+static cardano_error_t create_coin_selector(const FCardanoTxStrategy& Strategy, cardano_coin_selector_t** out_selector)
+{
+    switch (Strategy.CoinSelection)
+    {
+    case ECardanoCoinSelection::RandomImprove:
+        return cardano_random_improve_coin_selector_new_with_seed(Strategy.RandomSeed, out_selector);
+    case ECardanoCoinSelection::BranchAndBound:
+        return cardano_branch_and_bound_coin_selector_new(Strategy.ChangeTolerance, CARDANO_BRANCH_AND_BOUND_DEFAULT_MAX_NODES, nullptr, out_selector);
+    default:
+        return cardano_large_first_coin_selector_new(out_selector);
+    }
+}
+
+/** Adds Payments as outputs, merging the ones sent to the same address if the strategy asks for it. */
+static bool add_payments(cardano_tx_builder_t* builder, const TArray<FCardanoTxPayment>& Payments, const FCardanoTxStrategy& Strategy, FString& OutError)
+{
+    TArray<FString> Addresses;
+    TArray<cardano_value_t*> Values;
+    TMap<FString, int32> OutputByAddress;
+    bool bSuccess = true;
+
+    for (const FCardanoTxPayment& Payment : Payments)
+    {
+        cardano_value_t* value = nullptr;
+        if (create_value(Payment.Lovelace, Payment.Assets, &value) != CARDANO_SUCCESS)
+        {
+            OutError = FString::Printf(TEXT("Invalid asset in the payment to %s"), *Payment.Address);
+            bSuccess = false;
+            break;
+        }
+
+        const int32* Existing = Strategy.bMergePaymentsByAddress ? OutputByAddress.Find(Payment.Address) : nullptr;
+        if (!Existing)
+        {
+            OutputByAddress.Add(Payment.Address, Values.Num());
+            Addresses.Add(Payment.Address);
+            Values.Add(value);
+            continue;
+        }
+
+        cardano_value_t* merged = nullptr;
+        const cardano_error_t result = cardano_value_add(Values[*Existing], value, &merged);
+        cardano_value_unref(&value);
+
+        if (result != CARDANO_SUCCESS)
+        {
+            OutError = FString::Printf(TEXT("Failed to merge the payments to %s"), *Payment.Address);
+            bSuccess = false;
+            break;
+        }
+
+        cardano_value_unref(&Values[*Existing]);
+        Values[*Existing] = merged;
+    }
+
+    for (int32 Index = 0; Index < Values.Num(); ++Index)
+    {
+        if (bSuccess)
+        {
+            FTCHARToUTF8 AddressUtf8(*Addresses[Index]);
+            cardano_tx_builder_send_value_ex(builder, AddressUtf8.Get(), AddressUtf8.Length(), Values[Index]);
+        }
+        cardano_value_unref(&Values[Index]);
+    }
+
+    return bSuccess;
+}
+
+/** The policy of a mint drop, parsed and hashed once for all of its transactions. */
+struct FMintPolicy
+{
+    /** CBOR of the native script, decoded by each build, since no cardano-c object is shared between threads. */
+    TArray<uint8> Script;
+    FCardanoHash28 Id;
+    FString IdHex;
+
+    /** Signatures the script needs at least, on top of the UTxO owner's. */
+    int32 SignerCount = 0;
+
+    /** Slot before which the script is not satisfied, or 0. */
+    int64 InvalidBefore = 0;
+};
+
+/** The tokens one transaction of a mint drop mints. */
+struct FMintBatch
+{
+    const FMintPolicy* Policy = nullptr;
+    TArray<const FCardanoMintItem*> Items;
+};
+
+/** Attaches the policy script, mints the tokens of Batch and writes their CIP-25 metadata straight to CBOR. */
+static bool add_mint(cardano_tx_builder_t* builder, const FMintBatch& Batch, FString& OutError)
+{
+    const FMintPolicy& Policy = *Batch.Policy;
+
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_new(Policy.Script.GetData(), Policy.Script.Num());
+    cardano_native_script_t* native_script = nullptr;
+    cardano_compiled_native_script_t* compiled = nullptr;
+    cardano_error_t result = reader ? cardano_native_script_from_cbor(reader, &native_script) : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    if (result == CARDANO_SUCCESS) result = cardano_compiled_native_script_new(native_script, &compiled);
+    cardano_native_script_unref(&native_script);
+    cardano_cbor_reader_unref(&reader);
+
+    if (result != CARDANO_SUCCESS)
+    {
+        OutError = TEXT("Failed to decode the policy script");
+        return false;
+    }
+
+    // Counts the policy signatures in the fee along with the script itself
+    cardano_tx_builder_add_compiled_native_script(builder, compiled);
+    cardano_compiled_native_script_unref(&compiled);
+
+    if (Policy.InvalidBefore > 0)
+    {
+        cardano_tx_builder_set_invalid_before(builder, static_cast<uint64_t>(Policy.InvalidBefore));
+    }
+
+    // Names were validated with the batch, so they decode straight from their TCHAR digits
+    cardano_blake2b_hash_t* policy_id = nullptr;
+    result = cardano_blake2b_hash_from_bytes(Policy.Id.Bytes, FCardanoHash28::Size, &policy_id);
+    int32 DescribedCount = 0;
+    for (const FCardanoMintItem* Item : Batch.Items)
+    {
+        if (result != CARDANO_SUCCESS)
+        {
+            break;
+        }
+
+        uint8 Name[MAX_ASSET_NAME_BYTES];
+        cardano_asset_name_t* asset_name = nullptr;
+        result = CardanoHexToBytes(*Item->AssetName, Item->AssetName.Len(), Name) ? cardano_asset_name_from_bytes(Name, Item->AssetName.Len() / 2, &asset_name) : CARDANO_ERROR_INVALID_ARGUMENT;
+        if (result == CARDANO_SUCCESS) cardano_tx_builder_mint_token(builder, policy_id, asset_name, Item->Quantity, nullptr);
+        cardano_asset_name_unref(&asset_name);
+        DescribedCount += Item->Metadata.Num() > 0 ? 1 : 0;
+    }
+    cardano_blake2b_hash_unref(&policy_id);
+
+    if (result != CARDANO_SUCCESS)
+    {
+        OutError = FString::Printf(TEXT("Failed to add the tokens to mint: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+        return false;
+    }
+
+    if (DescribedCount == 0)
+    {
+        return true;
+    }
+
+    // { 721: { policy_id: { asset_name: { field: value, ... }, ... }, "version": 2 } }
+    cardano_metadata_encoder_t* encoder = nullptr;
+    result = cardano_metadata_encoder_new(1, &encoder);
+    if (result == CARDANO_SUCCESS) result = cardano_metadata_encoder_write_label(encoder, CIP25_LABEL);
+    if (result == CARDANO_SUCCESS) result = cardano_metadata_encoder_start_map(encoder, 2);
+    if (result == CARDANO_SUCCESS) result = cardano_metadata_encoder_write_bytes(encoder, Policy.Id.Bytes, FCardanoHash28::Size);
+    if (result == CARDANO_SUCCESS) result = cardano_metadata_encoder_start_map(encoder, DescribedCount);
+
+    for (const FCardanoMintItem* Item : Batch.Items)
+    {
+        if (result != CARDANO_SUCCESS)
+        {
+            break;
+        }
+
+        if (Item->Metadata.Num() == 0)
+        {
+            continue;
+        }
+
+        uint8 Name[MAX_ASSET_NAME_BYTES];
+        const int32 NameSize = Item->AssetName.Len() / 2;
+        result = CardanoHexToBytes(Item->AssetName, Name, NameSize) ? cardano_metadata_encoder_write_bytes(encoder, Name, NameSize) : CARDANO_ERROR_INVALID_ARGUMENT;
+        if (result == CARDANO_SUCCESS) result = cardano_metadata_encoder_start_map(encoder, Item->Metadata.Num());
+
+        for (const TPair<FString, FString>& Field : Item->Metadata)
+        {
+            const FTCHARToUTF8 KeyUtf8(*Field.Key);
+            const FTCHARToUTF8 ValueUtf8(*Field.Value);
+            if (result == CARDANO_SUCCESS) result = cardano_metadata_encoder_write_text(encoder, KeyUtf8.Get(), KeyUtf8.Length());
+            if (result == CARDANO_SUCCESS) result = cardano_metadata_encoder_write_text_chunked(encoder, ValueUtf8.Get(), ValueUtf8.Length());
+        }
+
+        if (result == CARDANO_SUCCESS) result = cardano_metadata_encoder_end_map(encoder);
+    }
+
+    if (result == CARDANO_SUCCESS) result = cardano_metadata_encoder_end_map(encoder);
+    if (result == CARDANO_SUCCESS) result = cardano_metadata_encoder_write_text(encoder, "version", 7);
+    if (result == CARDANO_SUCCESS) result = cardano_metadata_encoder_write_uint(encoder, CIP25_VERSION);
+    if (result == CARDANO_SUCCESS) result = cardano_metadata_encoder_end_map(encoder);
+
+    if (result == CARDANO_SUCCESS)
+    {
+        cardano_tx_builder_set_metadata_from_encoder(builder, encoder);
+    }
+    else
+    {
+        OutError = FString::Printf(TEXT("Failed to encode the token metadata: %s"),
+            encoder ? UTF8_TO_TCHAR(cardano_metadata_encoder_get_last_error(encoder)) : TEXT("out of memory"));
+    }
+
+    cardano_metadata_encoder_unref(&encoder);
+    return result == CARDANO_SUCCESS;
+}
+
+/** The certificates one transaction of a certificate batch carries, serialized once for the whole batch. */
+struct FCertificateBatch
+{
+    TArray<const TArray<uint8>*> Certificates;
+};
+
+/** Decodes the certificates of Batch and adds them to the transaction, in batch order. */
+static bool add_certificates(cardano_tx_builder_t* builder, const FCertificateBatch& Batch, FString& OutError)
+{
+    for (const TArray<uint8>* Cbor : Batch.Certificates)
+    {
+        cardano_cbor_reader_t* reader = cardano_cbor_reader_new(Cbor->GetData(), Cbor->Num());
+        cardano_certificate_t* certificate = nullptr;
+        const cardano_error_t result = reader ? cardano_certificate_from_cbor(reader, &certificate) : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+        cardano_cbor_reader_unref(&reader);
+
+        if (result != CARDANO_SUCCESS)
+        {
+            OutError = TEXT("Failed to decode a certificate");
+            return false;
+        }
+
+        cardano_tx_builder_add_certificate(builder, certificate, nullptr);
+        cardano_certificate_unref(&certificate);
+    }
+    return true;
+}
+
+/**
+ * Builds the plan with one strategy. Every cardano-c object used here is created by, and private to, this call.
+ * When bSpendAll is set, every UTxO of the snapshot is spent instead of leaving the choice to coin selection.
+ * Mint, when given, adds a mint and its metadata to the payments, and Certificates certificates.
+ */
+static void build_candidate(
+    const FCardanoTxPlan& Plan,
+    const TArray<TArray<uint8>>& Snapshot,
+    int64 InvalidAfter,
+    const FCardanoTxStrategy& Strategy,
+    FCardanoTxCandidate& OutCandidate,
+    bool bSpendAll = false,
+    const FMintBatch* Mint = nullptr,
+    const FCertificateBatch* Certificates = nullptr)
+{
+    CARDANO_SCOPE(CardanoBuild);
+
+    cardano_protocol_parameters_t* params = nullptr;
+    cardano_provider_t* provider = nullptr;
+    cardano_utxo_list_t* utxos = nullptr;
+    cardano_coin_selector_t* selector = nullptr;
+    const cardano_network_magic_t magic = static_cast<cardano_network_magic_t>(Plan.NetworkMagic);
+
+    if (create_protocol_parameters(Plan.Parameters, &params) != CARDANO_SUCCESS ||
+        create_offline_provider(magic, &provider) != CARDANO_SUCCESS ||
+        decode_utxo_snapshot(Snapshot, &utxos) != CARDANO_SUCCESS ||
+        create_coin_selector(Strategy, &selector) != CARDANO_SUCCESS)
+    {
+        OutCandidate.Error = TEXT("Failed to prepare the transaction builder");
+        cardano_coin_selector_unref(&selector);
+        cardano_utxo_list_unref(&utxos);
+        cardano_provider_unref(&provider);
+        cardano_protocol_parameters_unref(&params);
+        return;
+    }
+
+    // The builder keeps its own references to everything it is given
+    cardano_tx_builder_t* builder = cardano_tx_builder_new(params, provider);
+    cardano_provider_unref(&provider);
+    cardano_protocol_parameters_unref(&params);
+
+    if (!builder)
+    {
+        OutCandidate.Error = TEXT("Failed to create transaction builder");
+        cardano_coin_selector_unref(&selector);
+        cardano_utxo_list_unref(&utxos);
+        return;
+    }
+
+    FTCHARToUTF8 ChangeAddressUtf8(*Plan.ChangeAddress);
+    cardano_tx_builder_set_network_id(builder, magic == CARDANO_NETWORK_MAGIC_MAINNET ? CARDANO_NETWORK_ID_MAIN_NET : CARDANO_NETWORK_ID_TEST_NET);
+    cardano_tx_builder_set_coin_selector(builder, selector);
+    cardano_tx_builder_set_change_address_ex(builder, ChangeAddressUtf8.Get(), ChangeAddressUtf8.Length());
+    cardano_tx_builder_set_invalid_after(builder, static_cast<uint64_t>(InvalidAfter));
+    cardano_coin_selector_unref(&selector);
+
+    if (bSpendAll)
+    {
+        // Pre-selected inputs are always spent; coin selection is left an empty list to pick from
+        const size_t UTxOCount = cardano_utxo_list_get_length(utxos);
+        for (size_t Index = 0; Index < UTxOCount; ++Index)
+        {
+            cardano_tx_builder_add_input(builder, cardano_utxo_list_peek(utxos, Index), nullptr, nullptr);
+        }
+
+        cardano_utxo_list_t* none = nullptr;
+        if (cardano_utxo_list_new(&none) == CARDANO_SUCCESS)
+        {
+            cardano_tx_builder_set_utxos(builder, none);
+        }
+        cardano_utxo_list_unref(&none);
+    }
+    else
+    {
+        cardano_tx_builder_set_utxos(builder, utxos);
+    }
+    cardano_utxo_list_unref(&utxos);
+
+    cardano_transaction_t* transaction = nullptr;
+    if (!add_payments(builder, Plan.Payments, Strategy, OutCandidate.Error) ||
+        (Mint && !add_mint(builder, *Mint, OutCandidate.Error)) ||
+        (Certificates && !add_certificates(builder, *Certificates, OutCandidate.Error)))
+    {
+        cardano_tx_builder_unref(&builder);
+        return;
+    }
+
+    if (cardano_tx_builder_build(builder, &transaction) != CARDANO_SUCCESS)
+    {
+        OutCandidate.Error = UTF8_TO_TCHAR(cardano_tx_builder_get_last_error(builder));
+        cardano_tx_builder_unref(&builder);
+        return;
+    }
+
+    cardano_tx_builder_unref(&builder);
+
+    cardano_transaction_body_t* body = cardano_transaction_get_body(transaction);
+    OutCandidate.Fee = static_cast<int64>(cardano_transaction_body_get_fee(body));
+    cardano_transaction_body_unref(&body);
+
+    cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+    cardano_buffer_t* buffer = nullptr;
+    if (!writer ||
+        cardano_transaction_to_cbor(transaction, writer) != CARDANO_SUCCESS ||
+        cardano_cbor_writer_encode_in_buffer(writer, &buffer) != CARDANO_SUCCESS)
+    {
+        OutCandidate.Error = TEXT("Failed to serialize transaction");
+    }
+    else
+    {
+        OutCandidate.Transaction.Append(cardano_buffer_get_data(buffer), cardano_buffer_get_size(buffer));
+        OutCandidate.Size = OutCandidate.Transaction.Num();
+        OutCandidate.bSuccess = true;
+    }
+
+    cardano_buffer_unref(&buffer);
+    cardano_cbor_writer_unref(&writer);
+    cardano_transaction_unref(&transaction);
+}
+
+/** CBOR size of the output paying Payment, or INDEX_NONE if its address or assets are invalid. */
+static int32 get_payment_output_size(const FCardanoTxPayment& Payment)
+{
+    cardano_address_t* address = nullptr;
+    cardano_value_t* value = nullptr;
+    cardano_transaction_output_t* output = nullptr;
+    cardano_cbor_writer_t* writer = cardano_cbor_writer_new_size_only();
+
+    FTCHARToUTF8 AddressUtf8(*Payment.Address);
+    cardano_error_t result = writer ? cardano_address_from_string(AddressUtf8.Get(), AddressUtf8.Length(), &address) : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    if (result == CARDANO_SUCCESS) result = create_value(Payment.Lovelace, Payment.Assets, &value);
+    if (result == CARDANO_SUCCESS) result = cardano_transaction_output_new(address, static_cast<uint64_t>(Payment.Lovelace), &output);
+    if (result == CARDANO_SUCCESS) result = cardano_transaction_output_set_value(output, value);
+    if (result == CARDANO_SUCCESS) result = cardano_transaction_output_to_cbor(output, writer);
+
+    const int32 Size = result == CARDANO_SUCCESS ? static_cast<int32>(cardano_cbor_writer_get_encode_size(writer)) : INDEX_NONE;
+
+    cardano_cbor_writer_unref(&writer);
+    cardano_transaction_output_unref(&output);
+    cardano_value_unref(&value);
+    cardano_address_unref(&address);
+    return Size;
+}
+
+/** Lovelace and tokens a payout transaction must find in its inputs. */
+struct FPayoutNeed
+{
+    uint64 Lovelace = 0;
+
+    /** Keyed by policy id followed by asset name. */
+    TMap<FString, uint64> Tokens;
+};
+
+static FPayoutNeed get_payout_need(const FCardanoTxPlan& Plan, const TArray<int32>& PaymentIndices, uint64 FeeReserve)
+{
+    FPayoutNeed Need;
+    Need.Lovelace = FeeReserve;
+
+    for (const int32 Index : PaymentIndices)
+    {
+        const FCardanoTxPayment& Payment = Plan.Payments[Index];
+        Need.Lovelace += static_cast<uint64>(FMath::Max<int64>(Payment.Lovelace, 0));
+        for (const FTokenBalance& Asset : Payment.Assets)
+        {
+            Need.Tokens.FindOrAdd(Asset.PolicyId + Asset.AssetName) += FCString::Strtoui64(*Asset.Quantity, nullptr, 10);
+        }
+    }
+    return Need;
+}
+
+/**
+ * The coin selection of the whole batch: takes from Pool, which holds UTxO indices largest first, the UTxOs covering
+ * Need. UTxOs holding a missing token come first, then the largest ones until the lovelace is covered.
+ * Returns false, leaving Pool untouched, if the pool cannot cover Need.
+ */
+static bool take_payout_inputs(const TArray<FUTxO>& UTxOs, const FPayoutNeed& Need, TArray<int32>& Pool, TArray<int32>& OutInputs)
+{
+    OutInputs.Reset();
+    TMap<FString, uint64> Missing = Need.Tokens;
+    uint64 Lovelace = 0;
+    TBitArray<> Taken(false, Pool.Num());
+
+    for (int32 i = 0; i < Pool.Num() && Missing.Num() > 0; ++i)
+    {
+        const FUTxO& UTxO = UTxOs[Pool[i]];
+        bool bUseful = false;
+        for (const FTokenBalance& Asset : UTxO.Assets)
+        {
+            const FString Unit = Asset.PolicyId + Asset.AssetName;
+            if (uint64* Quantity = Missing.Find(Unit))
+            {
+                bUseful = true;
+                const uint64 Held = FCString::Strtoui64(*Asset.Quantity, nullptr, 10);
+                *Quantity = Held >= *Quantity ? 0 : *Quantity - Held;
+                if (*Quantity == 0)
+                {
+                    Missing.Remove(Unit);
+                }
+            }
+        }
+
+        if (bUseful)
+        {
+            Taken[i] = true;
+            OutInputs.Add(Pool[i]);
+            Lovelace += static_cast<uint64>(UTxO.Value);
+        }
+    }
+
+    for (int32 i = 0; i < Pool.Num() && Lovelace < Need.Lovelace; ++i)
+    {
+        if (!Taken[i])
+        {
+            Taken[i] = true;
+            OutInputs.Add(Pool[i]);
+            Lovelace += static_cast<uint64>(UTxOs[Pool[i]].Value);
+        }
+    }
+
+    if (Missing.Num() > 0 || Lovelace < Need.Lovelace)
+    {
+        OutInputs.Reset();
+        return false;
+    }
+
+    TArray<int32> Remaining;
+    Remaining.Reserve(Pool.Num() - OutInputs.Num());
+    for (int32 i = 0; i < Pool.Num(); ++i)
+    {
+        if (!Taken[i])
+        {
+            Remaining.Add(Pool[i]);
+        }
+    }
+    Pool = MoveTemp(Remaining);
+    return true;
+}
+
+/** Puts Inputs back into Pool, keeping it largest first. */
+static void return_payout_inputs(const TArray<FUTxO>& UTxOs, const TArray<int32>& Inputs, TArray<int32>& Pool)
+{
+    Pool.Append(Inputs);
+    Algo::StableSort(Pool, [&UTxOs](int32 A, int32 B) { return UTxOs[A].Value > UTxOs[B].Value; });
+}
+
+/** The TTL of the transactions built out of Plan. */
+static bool resolve_invalid_after(const FCardanoTxPlan& Plan, int64& OutInvalidAfter, FString& OutError)
+{
+    OutInvalidAfter = Plan.InvalidAfter;
+    if (OutInvalidAfter <= 0)
+    {
+        UCardanoChainTip* ChainTip = IsInGameThread() ? UCardanoChainTip::Get() : nullptr;
+        OutInvalidAfter = ChainTip ? ChainTip->GetTimeToLive(7200) : 0;
+        if (OutInvalidAfter <= 0)
+        {
+            OutError = TEXT("Unable to compute a TTL for the transaction");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FCardanoTxPlanner::BuildCandidates(
+    const FCardanoTxPlan& Plan,
+    const TArray<FCardanoTxStrategy>& Strategies,
+    TArray<FCardanoTxCandidate>& OutCandidates,
+    FString& OutError)
+{
+    OutCandidates.Reset();
+
+    if (Plan.Payments.Num() == 0 || Strategies.Num() == 0)
+    {
+        OutError = TEXT("A plan needs at least one payment and one strategy");
+        return false;
+    }
+
+    int64 InvalidAfter = 0;
+    if (!resolve_invalid_after(Plan, InvalidAfter, OutError))
+    {
+        return false;
+    }
+
+    TArray<TArray<uint8>> Snapshot;
+    if (!create_utxo_snapshot(Plan, Snapshot, OutError))
+    {
+        return false;
+    }
+
+    const int32 Count = Strategies.Num();
+    TArray<FCardanoTxCandidate> Candidates;
+    Candidates.SetNum(Count);
+
+    // Decoding outputs goes through the address cache when it is enabled, and the cache is not thread-safe
+    const bool bForceSingleThread = cardano_address_cache_is_enabled();
+
+    ParallelFor(Count, [&](int32 Index)
+        {
+            Candidates[Index].StrategyIndex = Index;
+            Candidates[Index].StrategyName = Strategies[Index].Name;
+            build_candidate(Plan, Snapshot, InvalidAfter, Strategies[Index], Candidates[Index]);
+        }, bForceSingleThread);
+
+    // Stable, so equal candidates keep the order of their strategies
+    Algo::StableSort(Candidates, [](const FCardanoTxCandidate& A, const FCardanoTxCandidate& B)
+        {
+            if (A.bSuccess != B.bSuccess)
+            {
+                return A.bSuccess;
+            }
+            if (!A.bSuccess || A.Fee != B.Fee)
+            {
+                return A.bSuccess && A.Fee < B.Fee;
+            }
+            return A.Size < B.Size;
+        });
+
+    OutCandidates = MoveTemp(Candidates);
+
+    UE_LOG(LogCardano, Log, TEXT("Built %d transaction candidates from %d UTxOs"), Count, Snapshot.Num());
+    return true;
+}
+
+
+bool FCardanoTxPlanner::BuildPayouts(
+    const FCardanoTxPlan& Plan,
+    const FCardanoPayoutOptions& Options,
+    TArray<FCardanoPayoutTransaction>& OutTransactions,
+    FString& OutError)
+{
+    OutTransactions.Reset();
+
+    if (Plan.Payments.Num() == 0)
+    {
+        OutError = TEXT("A payout needs at least one payment");
+        return false;
+    }
+
+    const int64 PaymentBudget = Plan.Parameters.MaxTxSize - Options.ReservedBytes;
+    if (PaymentBudget <= 0 || Options.ReservedBytes < 0)
+    {
+        OutError = FString::Printf(TEXT("ReservedBytes (%d) leaves no room in MaxTxSize (%lld)"), Options.ReservedBytes, Plan.Parameters.MaxTxSize);
+        return false;
+    }
+
+    int64 InvalidAfter = 0;
+    TArray<TArray<uint8>> Snapshot;
+    TArray<int32> SnapshotSources;
+    if (!resolve_invalid_after(Plan, InvalidAfter, OutError) || !create_utxo_snapshot(Plan, Snapshot, OutError, &SnapshotSources))
+    {
+        return false;
+    }
+
+    // Decoding outputs goes through the address cache when it is enabled, and the cache is not thread-safe
+    const bool bForceSingleThread = cardano_address_cache_is_enabled();
+
+    TArray<int32> OutputSizes;
+    OutputSizes.SetNumZeroed(Plan.Payments.Num());
+    ParallelFor(Plan.Payments.Num(), [&](int32 Index)
+        {
+            OutputSizes[Index] = get_payment_output_size(Plan.Payments[Index]);
+        }, bForceSingleThread);
+
+    // Payments are packed in plan order, so an ordered payout list keeps its order across the transactions
+    TArray<TArray<int32>> Pending;
+    int64 PendingBytes = 0;
+    for (int32 Index = 0; Index < Plan.Payments.Num(); ++Index)
+    {
+        if (OutputSizes[Index] == INDEX_NONE)
+        {
+            OutError = FString::Printf(TEXT("Invalid payment %d to %s"), Index, *Plan.Payments[Index].Address);
+            return false;
+        }
+
+        const bool bFull = Pending.Num() == 0 ||
+            PendingBytes + OutputSizes[Index] > PaymentBudget ||
+            (Options.MaxPaymentsPerTransaction > 0 && Pending.Last().Num() >= Options.MaxPaymentsPerTransaction);
+
+        if (bFull)
+        {
+            Pending.AddDefaulted();
+            PendingBytes = 0;
+        }
+
+        Pending.Last().Add(Index);
+        PendingBytes += OutputSizes[Index];
+    }
+
+    // Paid by every transaction on top of its payments: the fee of a full transaction and the minimum of its change
+    const uint64 FeeReserve = static_cast<uint64>(
+        Plan.Parameters.MinFeeA * Plan.Parameters.MaxTxSize + Plan.Parameters.MinFeeB +
+        Plan.Parameters.CoinsPerUTxOByte * (160 + CHANGE_OUTPUT_RESERVE_BYTES));
+
+    TArray<int32> Pool;
+    for (int32 Entry = 0; Entry < Snapshot.Num(); ++Entry)
+    {
+        Pool.Add(Entry);
+    }
+    Algo::StableSort(Pool, [&](int32 A, int32 B) { return Plan.UTxOs[SnapshotSources[A]].Value > Plan.UTxOs[SnapshotSources[B]].Value; });
+
+    // The selection works on snapshot entries, so it reads their source UTxOs through this view
+    TArray<FUTxO> SnapshotUTxOs;
+    SnapshotUTxOs.Reserve(Snapshot.Num());
+    for (const int32 Source : SnapshotSources)
+    {
+        SnapshotUTxOs.Add(Plan.UTxOs[Source]);
+    }
+
+    const int32 MaxSignedSize = static_cast<int32>(Plan.Parameters.MaxTxSize);
+    TArray<FCardanoPayoutTransaction> Done;
+
+    while (Pending.Num() > 0)
+    {
+        TArray<FCardanoPayoutTransaction> Round;
+        TArray<TArray<int32>> RoundInputs;
+        Round.SetNum(Pending.Num());
+        RoundInputs.SetNum(Pending.Num());
+
+        for (int32 i = 0; i < Pending.Num(); ++i)
+        {
+            Round[i].PaymentIndices = MoveTemp(Pending[i]);
+            const FPayoutNeed Need = get_payout_need(Plan, Round[i].PaymentIndices, FeeReserve);
+            if (!take_payout_inputs(SnapshotUTxOs, Need, Pool, RoundInputs[i]))
+            {
+                Round[i].Error = TEXT("Insufficient funds for the payments of this transaction");
+            }
+        }
+        Pending.Reset();
+
+        ParallelFor(Round.Num(), [&](int32 i)
+            {
+                if (RoundInputs[i].Num() == 0)
+                {
+                    return;
+                }
+
+                FCardanoTxPlan Part;
+                Part.Parameters = Plan.Parameters;
+                Part.NetworkMagic = Plan.NetworkMagic;
+                Part.ChangeAddress = Plan.ChangeAddress;
+                Part.OwnerAddress = Plan.OwnerAddress;
+                for (const int32 Index : Round[i].PaymentIndices)
+                {
+                    Part.Payments.Add(Plan.Payments[Index]);
+                }
+
+                TArray<TArray<uint8>> PartSnapshot;
+                for (const int32 Entry : RoundInputs[i])
+                {
+                    PartSnapshot.Add(Snapshot[Entry]);
+                }
+
+                FCardanoTxCandidate Candidate;
+                build_candidate(Part, PartSnapshot, InvalidAfter, Options.Strategy, Candidate);
+
+                Round[i].bSuccess = Candidate.bSuccess;
+                Round[i].Error = MoveTemp(Candidate.Error);
+                Round[i].Fee = Candidate.Fee;
+                Round[i].Size = Candidate.Size;
+                Round[i].Transaction = MoveTemp(Candidate.Transaction);
+            }, bForceSingleThread);
+
+        for (int32 i = 0; i < Round.Num(); ++i)
+        {
+            FCardanoPayoutTransaction& Transaction = Round[i];
+            const bool bOversized = Transaction.bSuccess && Transaction.Size + WITNESS_RESERVE_BYTES > MaxSignedSize;
+
+            // A transaction kept keeps every input it was given; the inputs of the others go back for the next round
+            if (!Transaction.bSuccess || bOversized)
+            {
+                return_payout_inputs(SnapshotUTxOs, RoundInputs[i], Pool);
+            }
+
+            if (bOversized && Transaction.PaymentIndices.Num() > 1)
+            {
+                const int32 Half = Transaction.PaymentIndices.Num() / 2;
+                Pending.Emplace(Transaction.PaymentIndices.GetData(), Half);
+                Pending.Emplace(Transaction.PaymentIndices.GetData() + Half, Transaction.PaymentIndices.Num() - Half);
+                continue;
+            }
+
+            if (bOversized)
+            {
+                Transaction.bSuccess = false;
+                Transaction.Error = FString::Printf(TEXT("Transaction of %d bytes exceeds the maximum of %d"), Transaction.Size, MaxSignedSize);
+                Transaction.Transaction.Reset();
+            }
+
+            Done.Add(MoveTemp(Transaction));
+        }
+    }
+
+    Algo::StableSort(Done, [](const FCardanoPayoutTransaction& A, const FCardanoPayoutTransaction& B)
+        {
+            return A.PaymentIndices[0] < B.PaymentIndices[0];
+        });
+
+    int64 TotalFee = 0;
+    int32 Built = 0;
+    for (const FCardanoPayoutTransaction& Transaction : Done)
+    {
+        TotalFee += Transaction.Fee;
+        Built += Transaction.bSuccess ? 1 : 0;
+    }
+
+    OutTransactions = MoveTemp(Done);
+
+    UE_LOG(LogCardano, Log, TEXT("Built %d of %d payout transactions for %d payments, %lld lovelace of fees"),
+        Built, OutTransactions.Num(), Plan.Payments.Num(), TotalFee);
+    return true;
+}
+
+/** A UTxO BuildConsolidation merges, and the token it is grouped by; dust holding no token has an empty GroupKey. */
+struct FMergeCandidate
+{
+    int32 Entry = INDEX_NONE;
+    FString GroupKey;
+    int64 Value = 0;
+};
+
+bool FCardanoTxPlanner::BuildConsolidation(
+    const FCardanoTxPlan& Plan,
+    const FCardanoConsolidationOptions& Options,
+    TArray<FCardanoConsolidationTransaction>& OutTransactions,
+    FString& OutError)
+{
+    OutTransactions.Reset();
+
+    const int64 InputBudget = Plan.Parameters.MaxTxSize - Options.ReservedBytes;
+    if (InputBudget <= INPUT_BYTES || Options.ReservedBytes < 0)
+    {
+        OutError = FString::Printf(TEXT("ReservedBytes (%d) leaves no room in MaxTxSize (%lld)"), Options.ReservedBytes, Plan.Parameters.MaxTxSize);
+        return false;
+    }
+
+    int64 InvalidAfter = 0;
+    TArray<TArray<uint8>> Snapshot;
+    TArray<int32> SnapshotSources;
+    if (!resolve_invalid_after(Plan, InvalidAfter, OutError) || !create_utxo_snapshot(Plan, Snapshot, OutError, &SnapshotSources))
+    {
+        return false;
+    }
+
+    // A token held by more than one UTxO is fragmented
+    TMap<FString, int32> Holders;
+    for (const int32 Source : SnapshotSources)
+    {
+        TSet<FString> Units;
+        for (const FTokenBalance& Asset : Plan.UTxOs[Source].Assets)
+        {
+            Units.Add(Asset.PolicyId + Asset.AssetName);
+        }
+        for (const FString& Unit : Units)
+        {
+            ++Holders.FindOrAdd(Unit);
+        }
+    }
+
+    TArray<FMergeCandidate> Candidates;
+    for (int32 Entry = 0; Entry < Snapshot.Num(); ++Entry)
+    {
+        const FUTxO& UTxO = Plan.UTxOs[SnapshotSources[Entry]];
+
+        FMergeCandidate Candidate;
+        Candidate.Entry = Entry;
+        Candidate.Value = UTxO.Value;
+
+        for (const FTokenBalance& Asset : UTxO.Assets)
+        {
+            const FString Unit = Asset.PolicyId + Asset.AssetName;
+            if (Options.bMergeFragmentedAssets && Holders[Unit] > 1 && (Candidate.GroupKey.IsEmpty() || Unit < Candidate.GroupKey))
+            {
+                Candidate.GroupKey = Unit;
+            }
+        }
+
+        const bool bDust = UTxO.Assets.Num() == 0 && UTxO.Value < Options.DustThreshold;
+        if (bDust || !Candidate.GroupKey.IsEmpty())
+        {
+            Candidates.Add(MoveTemp(Candidate));
+        }
+    }
+
+    if (Candidates.Num() < FMath::Max(Options.MinUTxOs, 2))
+    {
+        UE_LOG(LogCardano, Verbose, TEXT("No consolidation needed: %d of %d UTxOs to merge"), Candidates.Num(), Snapshot.Num());
+        return true;
+    }
+
+    // UTxOs sharing a token become adjacent, so they land in the same transaction; the dust follows, smallest first
+    Algo::StableSort(Candidates, [](const FMergeCandidate& A, const FMergeCandidate& B)
+        {
+            if (A.GroupKey.IsEmpty() != B.GroupKey.IsEmpty())
+            {
+                return !A.GroupKey.IsEmpty();
+            }
+            if (A.GroupKey != B.GroupKey)
+            {
+                return A.GroupKey < B.GroupKey;
+            }
+            return A.Value < B.Value;
+        });
+
+    // Every transaction has a single output holding all its tokens, which must fit MaxValueSize as well
+    const int64 ValueBudget = Plan.Parameters.MaxValueSize > 0 ? Plan.Parameters.MaxValueSize - TOKEN_QUANTITY_BYTES : MAX_int64;
+
+    TArray<TArray<int32>> Pending;
+    TSet<FString> Policies;
+    TSet<FString> Units;
+    int64 Bytes = 0;
+    int64 ValueBytes = 0;
+
+    const auto GetAddedValueBytes = [&](const FUTxO& UTxO)
+    {
+        int64 Added = 0;
+        TSet<FString> NewPolicies;
+        for (const FTokenBalance& Asset : UTxO.Assets)
+        {
+            if (!Units.Contains(Asset.PolicyId + Asset.AssetName))
+            {
+                Added += Asset.AssetName.Len() / 2 + TOKEN_QUANTITY_BYTES;
+            }
+            if (!Policies.Contains(Asset.PolicyId) && !NewPolicies.Contains(Asset.PolicyId))
+            {
+                NewPolicies.Add(Asset.PolicyId);
+                Added += POLICY_BYTES;
+            }
+        }
+        return Added;
+    };
+
+    for (const FMergeCandidate& Candidate : Candidates)
+    {
+        const FUTxO& UTxO = Plan.UTxOs[SnapshotSources[Candidate.Entry]];
+        int64 Added = GetAddedValueBytes(UTxO);
+
+        const bool bFull = Pending.Num() == 0 ||
+            Bytes + INPUT_BYTES + Added > InputBudget ||
+            ValueBytes + Added > ValueBudget ||
+            (Options.MaxInputsPerTransaction > 0 && Pending.Last().Num() >= Options.MaxInputsPerTransaction);
+
+        if (bFull)
+        {
+            Pending.AddDefaulted();
+            Policies.Reset();
+            Units.Reset();
+            Bytes = 0;
+            ValueBytes = 0;
+            Added = GetAddedValueBytes(UTxO);
+        }
+
+        Pending.Last().Add(Candidate.Entry);
+        Bytes += INPUT_BYTES + Added;
+        ValueBytes += Added;
+        for (const FTokenBalance& Asset : UTxO.Assets)
+        {
+            Policies.Add(Asset.PolicyId);
+            Units.Add(Asset.PolicyId + Asset.AssetName);
+        }
+    }
+
+    // A single UTxO, such as one holding more tokens than a transaction allows, gains nothing from being spent
+    Pending.RemoveAll([](const TArray<int32>& Entries) { return Entries.Num() < 2; });
+
+    // Decoding outputs goes through the address cache when it is enabled, and the cache is not thread-safe
+    const bool bForceSingleThread = cardano_address_cache_is_enabled();
+    const int32 MaxSignedSize = static_cast<int32>(Plan.Parameters.MaxTxSize);
+    TArray<FCardanoConsolidationTransaction> Done;
+
+    while (Pending.Num() > 0)
+    {
+        TArray<TArray<int32>> RoundEntries = MoveTemp(Pending);
+        TArray<FCardanoConsolidationTransaction> Round;
+        Round.SetNum(RoundEntries.Num());
+        Pending.Reset();
+
+        ParallelFor(Round.Num(), [&](int32 i)
+            {
+                FCardanoTxPlan Part;
+                Part.Parameters = Plan.Parameters;
+                Part.NetworkMagic = Plan.NetworkMagic;
+                Part.ChangeAddress = Plan.ChangeAddress;
+                Part.OwnerAddress = Plan.OwnerAddress;
+
+                TArray<TArray<uint8>> PartSnapshot;
+                for (const int32 Entry : RoundEntries[i])
+                {
+                    PartSnapshot.Add(Snapshot[Entry]);
+                    Round[i].UTxOIndices.Add(SnapshotSources[Entry]);
+                }
+
+                FCardanoTxCandidate Candidate;
+                build_candidate(Part, PartSnapshot, InvalidAfter, FCardanoTxStrategy(), Candidate, true);
+
+                Round[i].bSuccess = Candidate.bSuccess;
+                Round[i].Error = MoveTemp(Candidate.Error);
+                Round[i].Fee = Candidate.Fee;
+                Round[i].Size = Candidate.Size;
+                Round[i].Transaction = MoveTemp(Candidate.Transaction);
+            }, bForceSingleThread);
+
+        for (int32 i = 0; i < Round.Num(); ++i)
+        {
+            FCardanoConsolidationTransaction& Transaction = Round[i];
+            const bool bOversized = Transaction.bSuccess && Transaction.Size + WITNESS_RESERVE_BYTES > MaxSignedSize;
+
+            // Both halves still merge at least two UTxOs
+            if (bOversized && RoundEntries[i].Num() >= 4)
+            {
+                const int32 Half = RoundEntries[i].Num() / 2;
+                Pending.Emplace(RoundEntries[i].GetData(), Half);
+                Pending.Emplace(RoundEntries[i].GetData() + Half, RoundEntries[i].Num() - Half);
+                continue;
+            }
+
+            if (bOversized)
+            {
+                Transaction.bSuccess = false;
+                Transaction.Error = FString::Printf(TEXT("Transaction of %d bytes exceeds the maximum of %d"), Transaction.Size, MaxSignedSize);
+                Transaction.Transaction.Reset();
+            }
+
+            Done.Add(MoveTemp(Transaction));
+        }
+    }
+
+    Algo::StableSort(Done, [](const FCardanoConsolidationTransaction& A, const FCardanoConsolidationTransaction& B)
+        {
+            return A.UTxOIndices[0] < B.UTxOIndices[0];
+        });
+
+    int64 TotalFee = 0;
+    int32 Merged = 0;
+    for (const FCardanoConsolidationTransaction& Transaction : Done)
+    {
+        if (Transaction.bSuccess)
+        {
+            TotalFee += Transaction.Fee;
+            Merged += Transaction.UTxOIndices.Num();
+        }
+    }
+
+    OutTransactions = MoveTemp(Done);
+
+    UE_LOG(LogCardano, Log, TEXT("Planned %d consolidation transactions merging %d of %d UTxOs, %lld lovelace of fees"),
+        OutTransactions.Num(), Merged, Snapshot.Num(), TotalFee);
+    return true;
+}
+
+/** Parses PolicyScriptJson, a native script in cardano-cli JSON, into the policy shared by a mint drop. */
+static bool parse_mint_policy(const FString& PolicyScriptJson, FMintPolicy& OutPolicy, int64& OutInvalidHereafter, FString& OutError)
+{
+    const FTCHARToUTF8 JsonUtf8(*PolicyScriptJson);
+    cardano_native_script_t* native_script = nullptr;
+    cardano_compiled_native_script_t* compiled = nullptr;
+    cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+    cardano_buffer_t* buffer = nullptr;
+
+    cardano_error_t result = writer ? cardano_native_script_from_json(JsonUtf8.Get(), JsonUtf8.Length(), &native_script) : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    if (result == CARDANO_SUCCESS) result = cardano_compiled_native_script_new(native_script, &compiled);
+    if (result == CARDANO_SUCCESS) result = cardano_native_script_to_cbor(native_script, writer);
+    if (result == CARDANO_SUCCESS) result = cardano_cbor_writer_encode_in_buffer(writer, &buffer);
+
+    cardano_blake2b_hash_t* hash = result == CARDANO_SUCCESS ? cardano_compiled_native_script_get_hash(compiled) : nullptr;
+    const bool bParsed = hash && cardano_blake2b_hash_get_bytes_size(hash) == FCardanoHash28::Size;
+
+    if (bParsed)
+    {
+        OutPolicy.Script.Reset();
+        OutPolicy.Script.Append(cardano_buffer_get_data(buffer), cardano_buffer_get_size(buffer));
+        FMemory::Memcpy(OutPolicy.Id.Bytes, cardano_blake2b_hash_get_data(hash), FCardanoHash28::Size);
+        OutPolicy.IdHex = OutPolicy.Id.ToHex();
+
+        const size_t SignerCount = cardano_compiled_native_script_get_min_signer_count(compiled);
+        OutPolicy.SignerCount = SignerCount == SIZE_MAX ? INDEX_NONE : static_cast<int32>(SignerCount);
+
+        const uint64_t* invalid_before = cardano_compiled_native_script_get_invalid_before(compiled);
+        const uint64_t* invalid_hereafter = cardano_compiled_native_script_get_invalid_hereafter(compiled);
+        OutPolicy.InvalidBefore = invalid_before ? static_cast<int64>(*invalid_before) : 0;
+        OutInvalidHereafter = invalid_hereafter ? static_cast<int64>(*invalid_hereafter) : 0;
+    }
+
+    cardano_blake2b_hash_unref(&hash);
+    cardano_buffer_unref(&buffer);
+    cardano_cbor_writer_unref(&writer);
+    cardano_compiled_native_script_unref(&compiled);
+    cardano_native_script_unref(&native_script);
+
+    if (!bParsed)
+    {
+        OutError = TEXT("Invalid policy script");
+        return false;
+    }
+
+    if (OutPolicy.SignerCount == INDEX_NONE)
+    {
+        OutError = TEXT("The policy script can never be satisfied");
+        return false;
+    }
+    return true;
+}
+
+/** Bytes the CIP-25 metadata of Item adds to a transaction, counting one header per 64-byte chunk of each value. */
+static int64 get_mint_metadata_size(const FCardanoMintItem& Item)
+{
+    if (Item.Metadata.Num() == 0)
+    {
+        return 0;
+    }
+
+    int64 Size = 2 + Item.AssetName.Len() / 2 + 1;
+    for (const TPair<FString, FString>& Field : Item.Metadata)
+    {
+        const int64 ValueSize = FTCHARToUTF8(*Field.Value).Length();
+        Size += 2 + FTCHARToUTF8(*Field.Key).Length() + 3 + ValueSize + 2 * (ValueSize / METADATA_CHUNK_BYTES);
+    }
+    return Size;
+}
+
+bool FCardanoTxPlanner::BuildMintDrop(
+    const FCardanoTxPlan& Plan,
+    const FString& PolicyScriptJson,
+    const TArray<FCardanoMintItem>& Items,
+    const FCardanoMintDropOptions& Options,
+    TArray<FCardanoMintTransaction>& OutTransactions,
+    FString& OutError)
+{
+    OutTransactions.Reset();
+
+    if (Items.Num() == 0)
+    {
+        OutError = TEXT("A mint drop needs at least one item");
+        return false;
+    }
+
+    const int64 ItemBudget = Plan.Parameters.MaxTxSize - Options.ReservedBytes;
+    if (ItemBudget <= 0 || Options.ReservedBytes < 0)
+    {
+        OutError = FString::Printf(TEXT("ReservedBytes (%d) leaves no room in MaxTxSize (%lld)"), Options.ReservedBytes, Plan.Parameters.MaxTxSize);
+        return false;
+    }
+
+    FMintPolicy Policy;
+    int64 PolicyInvalidHereafter = 0;
+    int64 InvalidAfter = 0;
+    if (!parse_mint_policy(PolicyScriptJson, Policy, PolicyInvalidHereafter, OutError) || !resolve_invalid_after(Plan, InvalidAfter, OutError))
+    {
+        return false;
+    }
+
+    // A policy locked after some slot only accepts transactions expiring by then
+    if (PolicyInvalidHereafter > 0)
+    {
+        InvalidAfter = FMath::Min(InvalidAfter, PolicyInvalidHereafter);
+    }
+
+    if (InvalidAfter <= Policy.InvalidBefore)
+    {
+        OutError = FString::Printf(TEXT("The policy script only allows minting after slot %lld, past the TTL %lld"), Policy.InvalidBefore, InvalidAfter);
+        return false;
+    }
+
+    // Each token becomes a payment of itself and its minimum lovelace to its recipient
+    TArray<FCardanoTxPayment> Payments;
+    TSet<FString> AssetNames;
+    Payments.Reserve(Items.Num());
+    for (int32 Index = 0; Index < Items.Num(); ++Index)
+    {
+        const FCardanoMintItem& Item = Items[Index];
+        uint8 Name[MAX_ASSET_NAME_BYTES];
+        const int32 NameSize = Item.AssetName.Len() / 2;
+
+        bool bAlreadyInSet = false;
+        AssetNames.Add(Item.AssetName.ToLower(), &bAlreadyInSet);
+
+        const bool bValidName = Item.AssetName.Len() % 2 == 0 && NameSize <= MAX_ASSET_NAME_BYTES && CardanoHexToBytes(Item.AssetName, Name, NameSize);
+        const bool bValidKeys = !Item.Metadata.ContainsByPredicate([](const TPair<FString, FString>& Field)
+            {
+                return FTCHARToUTF8(*Field.Key).Length() > METADATA_CHUNK_BYTES;
+            });
+
+        if (!bValidName || bAlreadyInSet || Item.Quantity <= 0 || !bValidKeys)
+        {
+            OutError = FString::Printf(TEXT("Invalid item %d: %s"), Index,
+                !bValidName ? TEXT("the asset name is not hex of at most 32 bytes") :
+                bAlreadyInSet ? TEXT("the asset name is minted twice") :
+                Item.Quantity <= 0 ? TEXT("the quantity is not positive") : TEXT("a metadata key is over 64 bytes"));
+            return false;
+        }
+
+        FCardanoTxPayment& Payment = Payments.AddDefaulted_GetRef();
+        Payment.Address = Item.Recipient.IsEmpty() ? Plan.ChangeAddress : Item.Recipient;
+
+        FTokenBalance& Token = Payment.Assets.AddDefaulted_GetRef();
+        Token.PolicyId = Policy.IdHex;
+        Token.AssetName = Item.AssetName;
+        Token.Quantity = LexToString(Item.Quantity);
+
+        const int32 AddressSize = FCardanoMinAda::GetAddressSize(Payment.Address);
+        if (AddressSize <= 0)
+        {
+            OutError = FString::Printf(TEXT("Invalid recipient of item %d: %s"), Index, *Payment.Address);
+            return false;
+        }
+        Payment.Lovelace = FCardanoMinAda::GetMinLovelace(Plan.Parameters.CoinsPerUTxOByte, AddressSize, Payment.Assets);
+    }
+
+    TArray<TArray<uint8>> Snapshot;
+    TArray<int32> SnapshotSources;
+    if (!create_utxo_snapshot(Plan, Snapshot, OutError, &SnapshotSources))
+    {
+        return false;
+    }
+
+    // Decoding outputs goes through the address cache when it is enabled, and the cache is not thread-safe
+    const bool bForceSingleThread = cardano_address_cache_is_enabled();
+
+    // The output, the mint entry and the metadata of each token
+    TArray<int64> ItemSizes;
+    ItemSizes.SetNumZeroed(Items.Num());
+    ParallelFor(Items.Num(), [&](int32 Index)
+        {
+            const int32 OutputSize = get_payment_output_size(Payments[Index]);
+            ItemSizes[Index] = OutputSize == INDEX_NONE ? INDEX_NONE :
+                OutputSize + 1 + Items[Index].AssetName.Len() / 2 + TOKEN_QUANTITY_BYTES + get_mint_metadata_size(Items[Index]);
+        }, bForceSingleThread);
+
+    TArray<TArray<int32>> Pending;
+    int64 PendingBytes = 0;
+    for (int32 Index = 0; Index < Items.Num(); ++Index)
+    {
+        if (ItemSizes[Index] == INDEX_NONE)
+        {
+            OutError = FString::Printf(TEXT("Invalid item %d for %s"), Index, *Payments[Index].Address);
+            return false;
+        }
+
+        const bool bFull = Pending.Num() == 0 ||
+            PendingBytes + ItemSizes[Index] > ItemBudget ||
+            (Options.MaxItemsPerTransaction > 0 && Pending.Last().Num() >= Options.MaxItemsPerTransaction);
+
+        if (bFull)
+        {
+            Pending.AddDefaulted();
+            PendingBytes = 0;
+        }
+
+        Pending.Last().Add(Index);
+        PendingBytes += ItemSizes[Index];
+    }
+
+    const uint64 FeeReserve = static_cast<uint64>(
+        Plan.Parameters.MinFeeA * Plan.Parameters.MaxTxSize + Plan.Parameters.MinFeeB +
+        Plan.Parameters.CoinsPerUTxOByte * (160 + CHANGE_OUTPUT_RESERVE_BYTES));
+
+    TArray<int32> Pool;
+    for (int32 Entry = 0; Entry < Snapshot.Num(); ++Entry)
+    {
+        Pool.Add(Entry);
+    }
+    Algo::StableSort(Pool, [&](int32 A, int32 B) { return Plan.UTxOs[SnapshotSources[A]].Value > Plan.UTxOs[SnapshotSources[B]].Value; });
+
+    TArray<FUTxO> SnapshotUTxOs;
+    SnapshotUTxOs.Reserve(Snapshot.Num());
+    for (const int32 Source : SnapshotSources)
+    {
+        SnapshotUTxOs.Add(Plan.UTxOs[Source]);
+    }
+
+    // Every policy signature is a witness the unsigned transaction lacks, besides the owner's
+    const int32 MaxUnsignedSize = static_cast<int32>(Plan.Parameters.MaxTxSize) - WITNESS_RESERVE_BYTES * (1 + Policy.SignerCount);
+    TArray<FCardanoMintTransaction> Done;
+
+    while (Pending.Num() > 0)
+    {
+        TArray<FCardanoMintTransaction> Round;
+        TArray<TArray<int32>> RoundInputs;
+        Round.SetNum(Pending.Num());
+        RoundInputs.SetNum(Pending.Num());
+
+        for (int32 i = 0; i < Pending.Num(); ++i)
+        {
+            Round[i].ItemIndices = MoveTemp(Pending[i]);
+
+            // Minted tokens come from the mint, so only the lovelace has to be found in the inputs
+            FPayoutNeed Need;
+            Need.Lovelace = FeeReserve;
+            for (const int32 Index : Round[i].ItemIndices)
+            {
+                Need.Lovelace += static_cast<uint64>(Payments[Index].Lovelace);
+            }
+
+            if (!take_payout_inputs(SnapshotUTxOs, Need, Pool, RoundInputs[i]))
+            {
+                Round[i].Error = TEXT("Insufficient funds for the tokens of this transaction");
+                Round[i].bInsufficientFunds = true;
+            }
+        }
+        Pending.Reset();
+
+        ParallelFor(Round.Num(), [&](int32 i)
+            {
+                if (RoundInputs[i].Num() == 0)
+                {
+                    return;
+                }
+
+                FCardanoTxPlan Part;
+                Part.Parameters = Plan.Parameters;
+                Part.NetworkMagic = Plan.NetworkMagic;
+                Part.ChangeAddress = Plan.ChangeAddress;
+                Part.OwnerAddress = Plan.OwnerAddress;
+
+                FMintBatch Batch;
+                Batch.Policy = &Policy;
+                for (const int32 Index : Round[i].ItemIndices)
+                {
+                    Part.Payments.Add(Payments[Index]);
+                    Batch.Items.Add(&Items[Index]);
+                }
+
+                TArray<TArray<uint8>> PartSnapshot;
+                for (const int32 Entry : RoundInputs[i])
+                {
+                    PartSnapshot.Add(Snapshot[Entry]);
+                }
+
+                FCardanoTxCandidate Candidate;
+                build_candidate(Part, PartSnapshot, InvalidAfter, Options.Strategy, Candidate, false, &Batch);
+
+                Round[i].bSuccess = Candidate.bSuccess;
+                Round[i].Error = MoveTemp(Candidate.Error);
+                Round[i].Fee = Candidate.Fee;
+                Round[i].Size = Candidate.Size;
+                Round[i].Transaction = MoveTemp(Candidate.Transaction);
+            }, bForceSingleThread);
+
+        for (int32 i = 0; i < Round.Num(); ++i)
+        {
+            FCardanoMintTransaction& Transaction = Round[i];
+            const bool bOversized = Transaction.bSuccess && Transaction.Size > MaxUnsignedSize;
+
+            if (!Transaction.bSuccess || bOversized)
+            {
+                return_payout_inputs(SnapshotUTxOs, RoundInputs[i], Pool);
+            }
+
+            if (bOversized && Transaction.ItemIndices.Num() > 1)
+            {
+                const int32 Half = Transaction.ItemIndices.Num() / 2;
+                Pending.Emplace(Transaction.ItemIndices.GetData(), Half);
+                Pending.Emplace(Transaction.ItemIndices.GetData() + Half, Transaction.ItemIndices.Num() - Half);
+                continue;
+            }
+
+            if (bOversized)
+            {
+                Transaction.bSuccess = false;
+                Transaction.Error = FString::Printf(TEXT("Transaction of %d bytes exceeds the maximum of %d once signed"), Transaction.Size, MaxUnsignedSize);
+                Transaction.Transaction.Reset();
+            }
+
+            Done.Add(MoveTemp(Transaction));
+        }
+    }
+
+    Algo::StableSort(Done, [](const FCardanoMintTransaction& A, const FCardanoMintTransaction& B)
+        {
+            return A.ItemIndices[0] < B.ItemIndices[0];
+        });
+
+    int64 TotalFee = 0;
+    int32 Minted = 0;
+    for (const FCardanoMintTransaction& Transaction : Done)
+    {
+        if (Transaction.bSuccess)
+        {
+            TotalFee += Transaction.Fee;
+            Minted += Transaction.ItemIndices.Num();
+        }
+    }
+
+    OutTransactions = MoveTemp(Done);
+
+    UE_LOG(LogCardano, Log, TEXT("Built %d mint transactions for %d of %d tokens of policy %s, %lld lovelace of fees"),
+        OutTransactions.Num(), Minted, Items.Num(), *Policy.IdHex, TotalFee);
+    return true;
+}
+
+/**
+ * Builds and serializes the certificate Request asks for; registrations and deregistrations carry KeyDeposit.
+ * OutDeposit receives what the certificate adds to the deposits of its transaction, negative for a refund.
+ */
+static bool encode_certificate(const FCardanoCertificateRequest& Request, int64 KeyDeposit, TArray<uint8>& OutCbor, int64& OutDeposit, FString& OutError)
+{
+    const FTCHARToUTF8 AddressUtf8(*Request.StakeAddress);
+    cardano_reward_address_t* address = nullptr;
+    if (cardano_reward_address_from_bech32(AddressUtf8.Get(), AddressUtf8.Length(), &address) != CARDANO_SUCCESS)
+    {
+        OutError = TEXT("the stake address is not a bech32 reward address");
+        return false;
+    }
+
+    // The reference taken by the address is released with it
+    cardano_credential_t* credential = cardano_reward_address_get_credential(address);
+    cardano_credential_type_t type = CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH;
+    if (!credential || cardano_credential_get_type(credential, &type) != CARDANO_SUCCESS || type != CARDANO_CREDENTIAL_TYPE_KEY_HASH)
+    {
+        cardano_credential_unref(&credential);
+        cardano_reward_address_unref(&address);
+        OutError = TEXT("the stake address is not controlled by a key");
+        return false;
+    }
+
+    cardano_certificate_t* certificate = nullptr;
+    cardano_error_t result = CARDANO_SUCCESS;
+    OutDeposit = 0;
+
+    switch (Request.Action)
+    {
+    case ECardanoCertificateAction::RegisterStake:
+    {
+        cardano_registration_cert_t* registration = nullptr;
+        result = cardano_registration_cert_new(credential, static_cast<uint64_t>(KeyDeposit), &registration);
+        if (result == CARDANO_SUCCESS) result = cardano_certificate_new_registration(registration, &certificate);
+        cardano_registration_cert_unref(&registration);
+        OutDeposit = KeyDeposit;
+        break;
+    }
+    case ECardanoCertificateAction::DeregisterStake:
+    {
+        cardano_unregistration_cert_t* unregistration = nullptr;
+        result = cardano_unregistration_cert_new(credential, static_cast<uint64_t>(KeyDeposit), &unregistration);
+        if (result == CARDANO_SUCCESS) result = cardano_certificate_new_unregistration(unregistration, &certificate);
+        cardano_unregistration_cert_unref(&unregistration);
+        OutDeposit = -KeyDeposit;
+        break;
+    }
+    case ECardanoCertificateAction::DelegateStake:
+    {
+        const FTCHARToUTF8 PoolUtf8(*Request.PoolId);
+        uint8 PoolHash[POOL_ID_BYTES];
+        char Prefix[5] = { 0 };
+        cardano_blake2b_hash_t* pool = nullptr;
+        cardano_stake_delegation_cert_t* delegation = nullptr;
+
+        result = cardano_encoding_bech32_decode(PoolUtf8.Get(), PoolUtf8.Length(), Prefix, sizeof(Prefix), PoolHash, sizeof(PoolHash));
+        if (result == CARDANO_SUCCESS && FCStringAnsi::Strcmp(Prefix, "pool") != 0) result = CARDANO_ERROR_INVALID_ARGUMENT;
+        if (result != CARDANO_SUCCESS)
+        {
+            OutError = TEXT("the pool id is not a bech32 pool id");
+            break;
+        }
+
+        result = cardano_blake2b_hash_from_bytes(PoolHash, POOL_ID_BYTES, &pool);
+        if (result == CARDANO_SUCCESS) result = cardano_stake_delegation_cert_new(credential, pool, &delegation);
+        if (result == CARDANO_SUCCESS) result = cardano_certificate_new_stake_delegation(delegation, &certificate);
+        cardano_stake_delegation_cert_unref(&delegation);
+        cardano_blake2b_hash_unref(&pool);
+        break;
+    }
+    case ECardanoCertificateAction::DelegateVote:
+    {
+        cardano_drep_t* drep = nullptr;
+        cardano_vote_delegation_cert_t* delegation = nullptr;
+
+        if (Request.DRepId == TEXT("abstain") || Request.DRepId == TEXT("no_confidence"))
+        {
+            result = cardano_drep_new(Request.DRepId == TEXT("abstain") ? CARDANO_DREP_TYPE_ABSTAIN : CARDANO_DREP_TYPE_NO_CONFIDENCE, nullptr, &drep);
+        }
+        else
+        {
+            const FTCHARToUTF8 DRepUtf8(*Request.DRepId);
+            result = cardano_drep_from_string(DRepUtf8.Get(), DRepUtf8.Length(), &drep);
+        }
+
+        if (result != CARDANO_SUCCESS)
+        {
+            OutError = TEXT("the DRep id is not a CIP-105 or CIP-129 DRep id");
+            break;
+        }
+
+        result = cardano_vote_delegation_cert_new(credential, drep, &delegation);
+        if (result == CARDANO_SUCCESS) result = cardano_certificate_new_vote_delegation(delegation, &certificate);
+        cardano_vote_delegation_cert_unref(&delegation);
+        cardano_drep_unref(&drep);
+        break;
+    }
+    }
+
+    cardano_credential_unref(&credential);
+    cardano_reward_address_unref(&address);
+
+    cardano_cbor_writer_t* writer = result == CARDANO_SUCCESS ? cardano_cbor_writer_new() : nullptr;
+    cardano_buffer_t* buffer = nullptr;
+    if (result == CARDANO_SUCCESS) result = writer ? cardano_certificate_to_cbor(certificate, writer) : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    if (result == CARDANO_SUCCESS) result = cardano_cbor_writer_encode_in_buffer(writer, &buffer);
+
+    if (result == CARDANO_SUCCESS)
+    {
+        OutCbor.Reset();
+        OutCbor.Append(cardano_buffer_get_data(buffer), cardano_buffer_get_size(buffer));
+    }
+    else if (OutError.IsEmpty())
+    {
+        OutError = TEXT("failed to create the certificate");
+    }
+
+    cardano_buffer_unref(&buffer);
+    cardano_cbor_writer_unref(&writer);
+    cardano_certificate_unref(&certificate);
+    return result == CARDANO_SUCCESS;
+}
+
+/** Number of stake keys certified by CertificateIndices, each signing the transaction. */
+static int32 count_certifying_keys(const TArray<FCardanoCertificateRequest>& Certificates, const TArray<int32>& CertificateIndices)
+{
+    TSet<FString> Keys;
+    for (const int32 Index : CertificateIndices)
+    {
+        Keys.Add(Certificates[Index].StakeAddress);
+    }
+    return Keys.Num();
+}
+
+bool FCardanoTxPlanner::BuildCertificateBatch(
+    const FCardanoTxPlan& Plan,
+    const TArray<FCardanoCertificateRequest>& Certificates,
+    const FCardanoCertificateBatchOptions& Options,
+    TArray<FCardanoCertificateTransaction>& OutTransactions,
+    FString& OutError)
+{
+    OutTransactions.Reset();
+
+    if (Certificates.Num() == 0)
+    {
+        OutError = TEXT("A certificate batch needs at least one certificate");
+        return false;
+    }
+
+    const int64 CertificateBudget = Plan.Parameters.MaxTxSize - Options.ReservedBytes;
+    if (CertificateBudget <= 0 || Options.ReservedBytes < 0)
+    {
+        OutError = FString::Printf(TEXT("ReservedBytes (%d) leaves no room in MaxTxSize (%lld)"), Options.ReservedBytes, Plan.Parameters.MaxTxSize);
+        return false;
+    }
+
+    int64 InvalidAfter = 0;
+    if (!resolve_invalid_after(Plan, InvalidAfter, OutError))
+    {
+        return false;
+    }
+
+    // Built once, however the batch ends up split: each transaction only decodes its certificates
+    TArray<TArray<uint8>> Encoded;
+    TArray<int64> Deposits;
+    Encoded.SetNum(Certificates.Num());
+    Deposits.SetNumZeroed(Certificates.Num());
+    for (int32 Index = 0; Index < Certificates.Num(); ++Index)
+    {
+        FString Reason;
+        if (!encode_certificate(Certificates[Index], Plan.Parameters.KeyDeposit, Encoded[Index], Deposits[Index], Reason))
+        {
+            OutError = FString::Printf(TEXT("Invalid certificate %d for %s: %s"), Index, *Certificates[Index].StakeAddress, *Reason);
+            return false;
+        }
+    }
+
+    TArray<TArray<uint8>> Snapshot;
+    TArray<int32> SnapshotSources;
+    if (!create_utxo_snapshot(Plan, Snapshot, OutError, &SnapshotSources))
+    {
+        return false;
+    }
+
+    // The certificate and the witness of its stake key, counted even when the key already signs for another one
+    TArray<TArray<int32>> Pending;
+    int64 PendingBytes = 0;
+    for (int32 Index = 0; Index < Certificates.Num(); ++Index)
+    {
+        const int64 CertificateSize = Encoded[Index].Num() + WITNESS_RESERVE_BYTES;
+        const bool bFull = Pending.Num() == 0 ||
+            PendingBytes + CertificateSize > CertificateBudget ||
+            (Options.MaxCertificatesPerTransaction > 0 && Pending.Last().Num() >= Options.MaxCertificatesPerTransaction);
+
+        if (bFull)
+        {
+            Pending.AddDefaulted();
+            PendingBytes = 0;
+        }
+
+        Pending.Last().Add(Index);
+        PendingBytes += CertificateSize;
+    }
+
+    const uint64 FeeReserve = static_cast<uint64>(
+        Plan.Parameters.MinFeeA * Plan.Parameters.MaxTxSize + Plan.Parameters.MinFeeB +
+        Plan.Parameters.CoinsPerUTxOByte * (160 + CHANGE_OUTPUT_RESERVE_BYTES));
+
+    TArray<int32> Pool;
+    for (int32 Entry = 0; Entry < Snapshot.Num(); ++Entry)
+    {
+        Pool.Add(Entry);
+    }
+    Algo::StableSort(Pool, [&](int32 A, int32 B) { return Plan.UTxOs[SnapshotSources[A]].Value > Plan.UTxOs[SnapshotSources[B]].Value; });
+
+    TArray<FUTxO> SnapshotUTxOs;
+    SnapshotUTxOs.Reserve(Snapshot.Num());
+    for (const int32 Source : SnapshotSources)
+    {
+        SnapshotUTxOs.Add(Plan.UTxOs[Source]);
+    }
+
+    // Decoding outputs goes through the address cache when it is enabled, and the cache is not thread-safe
+    const bool bForceSingleThread = cardano_address_cache_is_enabled();
+    const int32 MaxSignedSize = static_cast<int32>(Plan.Parameters.MaxTxSize);
+    TArray<FCardanoCertificateTransaction> Done;
+
+    while (Pending.Num() > 0)
+    {
+        TArray<FCardanoCertificateTransaction> Round;
+        TArray<TArray<int32>> RoundInputs;
+        Round.SetNum(Pending.Num());
+        RoundInputs.SetNum(Pending.Num());
+
+        for (int32 i = 0; i < Pending.Num(); ++i)
+        {
+            Round[i].CertificateIndices = MoveTemp(Pending[i]);
+            for (const int32 Index : Round[i].CertificateIndices)
+            {
+                Round[i].Deposit += Deposits[Index];
+            }
+
+            // Refunds are only counted on once the transaction is built, so they never leave it short
+            FPayoutNeed Need;
+            Need.Lovelace = FeeReserve + static_cast<uint64>(FMath::Max<int64>(Round[i].Deposit, 0));
+
+            if (!take_payout_inputs(SnapshotUTxOs, Need, Pool, RoundInputs[i]))
+            {
+                Round[i].Error = TEXT("Insufficient funds for the fee and deposits of this transaction");
+                Round[i].bInsufficientFunds = true;
+            }
+        }
+        Pending.Reset();
+
+        ParallelFor(Round.Num(), [&](int32 i)
+            {
+                if (RoundInputs[i].Num() == 0)
+                {
+                    return;
+                }
+
+                FCardanoTxPlan Part;
+                Part.Parameters = Plan.Parameters;
+                Part.NetworkMagic = Plan.NetworkMagic;
+                Part.ChangeAddress = Plan.ChangeAddress;
+                Part.OwnerAddress = Plan.OwnerAddress;
+
+                FCertificateBatch Batch;
+                for (const int32 Index : Round[i].CertificateIndices)
+                {
+                    Batch.Certificates.Add(&Encoded[Index]);
+                }
+
+                TArray<TArray<uint8>> PartSnapshot;
+                for (const int32 Entry : RoundInputs[i])
+                {
+                    PartSnapshot.Add(Snapshot[Entry]);
+                }
+
+                FCardanoTxCandidate Candidate;
+                build_candidate(Part, PartSnapshot, InvalidAfter, Options.Strategy, Candidate, false, nullptr, &Batch);
+
+                Round[i].bSuccess = Candidate.bSuccess;
+                Round[i].Error = MoveTemp(Candidate.Error);
+                Round[i].Fee = Candidate.Fee;
+                Round[i].Size = Candidate.Size;
+                Round[i].Transaction = MoveTemp(Candidate.Transaction);
+            }, bForceSingleThread);
+
+        for (int32 i = 0; i < Round.Num(); ++i)
+        {
+            FCardanoCertificateTransaction& Transaction = Round[i];
+            const int32 Witnesses = 1 + count_certifying_keys(Certificates, Transaction.CertificateIndices);
+            const bool bOversized = Transaction.bSuccess && Transaction.Size + WITNESS_RESERVE_BYTES * Witnesses > MaxSignedSize;
+
+            if (!Transaction.bSuccess || bOversized)
+            {
+                return_payout_inputs(SnapshotUTxOs, RoundInputs[i], Pool);
+            }
+
+            if (bOversized && Transaction.CertificateIndices.Num() > 1)
+            {
+                const int32 Half = Transaction.CertificateIndices.Num() / 2;
+                Pending.Emplace(Transaction.CertificateIndices.GetData(), Half);
+                Pending.Emplace(Transaction.CertificateIndices.GetData() + Half, Transaction.CertificateIndices.Num() - Half);
+                continue;
+            }
+
+            if (bOversized)
+            {
+                Transaction.bSuccess = false;
+                Transaction.Error = FString::Printf(TEXT("Transaction of %d bytes exceeds the maximum of %d once signed"), Transaction.Size, MaxSignedSize);
+                Transaction.Transaction.Reset();
+            }
+
+            Done.Add(MoveTemp(Transaction));
+        }
+    }
+
+    Algo::StableSort(Done, [](const FCardanoCertificateTransaction& A, const FCardanoCertificateTransaction& B)
+        {
+            return A.CertificateIndices[0] < B.CertificateIndices[0];
+        });
+
+    int64 TotalFee = 0;
+    int64 TotalDeposit = 0;
+    int32 Certified = 0;
+    for (const FCardanoCertificateTransaction& Transaction : Done)
+    {
+        if (Transaction.bSuccess)
+        {
+            TotalFee += Transaction.Fee;
+            TotalDeposit += Transaction.Deposit;
+            Certified += Transaction.CertificateIndices.Num();
+        }
+    }
+
+    OutTransactions = MoveTemp(Done);
+
+    UE_LOG(LogCardano, Log, TEXT("Built %d certificate transactions for %d of %d certificates, %lld lovelace of fees and %lld of net deposits"),
+        OutTransactions.Num(), Certified, Certificates.Num(), TotalFee, TotalDeposit);
+    return true;
+}
+
+FCardanoFeeEstimator::~FCardanoFeeEstimator()
+{
+    Reset();
+}
+
+void FCardanoFeeEstimator::Reset()
+{
+    cardano_tx_builder_unref(&Builder);
+    Builder = nullptr;
+    cardano_vkey_witness_set_unref(&PlaceholderWitnesses);
+    cardano_address_unref(&ChangeAddress);
+    cardano_utxo_list_unref(&UTxOs);
+    cardano_provider_unref(&Provider);
+    cardano_protocol_parameters_unref(&Params);
+
+    PlaceholderWitnesses = nullptr;
+    ChangeAddress = nullptr;
+    UTxOs = nullptr;
+    Provider = nullptr;
+    Params = nullptr;
+}
+
+bool FCardanoFeeEstimator::Initialize(const FCardanoTxPlan& Plan, FString& OutError)
+{
+    Reset();
+
+    if (!resolve_invalid_after(Plan, InvalidAfter, OutError))
+    {
+        return false;
+    }
+
+    NetworkMagic = static_cast<cardano_network_magic_t>(Plan.NetworkMagic);
+
+    FTCHARToUTF8 OwnerUtf8(*Plan.OwnerAddress);
+    FTCHARToUTF8 ChangeUtf8(*Plan.ChangeAddress);
+    cardano_address_t* owner = nullptr;
+    if (cardano_address_from_string(OwnerUtf8.Get(), OwnerUtf8.Length(), &owner) != CARDANO_SUCCESS ||
+        cardano_address_from_string(ChangeUtf8.Get(), ChangeUtf8.Length(), &ChangeAddress) != CARDANO_SUCCESS)
+    {
+        OutError = FString::Printf(TEXT("Invalid address: %s"), owner ? *Plan.ChangeAddress : *Plan.OwnerAddress);
+        cardano_address_unref(&owner);
+        Reset();
+        return false;
+    }
+
+    bool bSuccess = create_protocol_parameters(Plan.Parameters, &Params) == CARDANO_SUCCESS &&
+        create_offline_provider(NetworkMagic, &Provider) == CARDANO_SUCCESS &&
+        cardano_utxo_list_new(&UTxOs) == CARDANO_SUCCESS &&
+        cardano_utxo_list_reserve(UTxOs, Plan.UTxOs.Num()) == CARDANO_SUCCESS;
+
+    for (int32 Index = 0; bSuccess && Index < Plan.UTxOs.Num(); ++Index)
+    {
+        cardano_utxo_t* utxo = nullptr;
+        if (create_utxo(owner, Plan.UTxOs[Index], &utxo) != CARDANO_SUCCESS)
+        {
+            UE_LOG(LogCardano, Warning, TEXT("Skipping malformed UTxO %s#%d"), *Plan.UTxOs[Index].TxHash, Plan.UTxOs[Index].TxIndex);
+            continue;
+        }
+
+        bSuccess = cardano_utxo_list_add(UTxOs, utxo) == CARDANO_SUCCESS;
+        cardano_utxo_unref(&utxo);
+    }
+    cardano_address_unref(&owner);
+
+    // Every UTxO is locked at the owner address, so the transaction needs exactly one vkey witness
+    static const uint8 ZeroKey[32] = {};
+    static const uint8 ZeroSignature[64] = {};
+    cardano_ed25519_public_key_t* key = nullptr;
+    cardano_ed25519_signature_t* signature = nullptr;
+    cardano_vkey_witness_t* witness = nullptr;
+
+    bSuccess = bSuccess &&
+        cardano_ed25519_public_key_from_bytes(ZeroKey, sizeof(ZeroKey), &key) == CARDANO_SUCCESS &&
+        cardano_ed25519_signature_from_bytes(ZeroSignature, sizeof(ZeroSignature), &signature) == CARDANO_SUCCESS &&
+        cardano_vkey_witness_new(key, signature, &witness) == CARDANO_SUCCESS &&
+        cardano_vkey_witness_set_new(&PlaceholderWitnesses) == CARDANO_SUCCESS &&
+        cardano_vkey_witness_set_add(PlaceholderWitnesses, witness) == CARDANO_SUCCESS;
+
+    cardano_vkey_witness_unref(&witness);
+    cardano_ed25519_signature_unref(&signature);
+    cardano_ed25519_public_key_unref(&key);
+
+    if (!bSuccess)
+    {
+        OutError = TEXT("Failed to prepare the fee estimator");
+        Reset();
+        return false;
+    }
+
+    // Each estimate gets a builder of its own, but they all read these; freezing guarantees none of them changes
+    cardano_protocol_parameters_freeze(Params);
+    cardano_utxo_list_freeze(UTxOs);
+    return true;
+}
+
+bool FCardanoFeeEstimator::InitializeFromCache(const FString& Address, int32 InNetworkMagic, FString& OutError)
+{
+    check(IsInGameThread());
+
+    UCardanoProtocolParamsCache* ParamsCache = UCardanoProtocolParamsCache::Get();
+    UCardanoUTxOCache* UTxOCache = UCardanoUTxOCache::Get();
+
+    FCardanoTxPlan Plan;
+    Plan.NetworkMagic = InNetworkMagic;
+    Plan.OwnerAddress = Address;
+    Plan.ChangeAddress = Address;
+
+    if (!ParamsCache || !ParamsCache->GetCachedParameters(Plan.Parameters))
+    {
+        OutError = TEXT("Protocol parameters are not cached yet");
+        return false;
+    }
+
+    if (!UTxOCache || !UTxOCache->GetSpendableUTxOs(Address, Plan.UTxOs))
+    {
+        OutError = FString::Printf(TEXT("UTxOs of %s are not cached yet"), *Address);
+        return false;
+    }
+
+    return Initialize(Plan, OutError);
+}
+
+bool FCardanoFeeEstimator::Estimate(const TArray<FCardanoTxPayment>& Payments, const FCardanoTxStrategy& Strategy, FCardanoFeeEstimate& OutEstimate) const
+{
+    CARDANO_SCOPE(CardanoBuild);
+
+    OutEstimate = FCardanoFeeEstimate();
+
+    if (!IsInitialized())
+    {
+        OutEstimate.Error = TEXT("The fee estimator is not initialized");
+        return false;
+    }
+
+    cardano_coin_selector_t* selector = nullptr;
+    if (create_coin_selector(Strategy, &selector) != CARDANO_SUCCESS)
+    {
+        OutEstimate.Error = TEXT("Failed to create the coin selector");
+        return false;
+    }
+
+    // One builder serves every estimate: resetting it keeps the parameters, UTxOs, change address and network id
+    if (Builder && cardano_tx_builder_reset(Builder) != CARDANO_SUCCESS)
+    {
+        cardano_tx_builder_unref(&Builder);
+        Builder = nullptr;
+    }
+
+    if (!Builder)
+    {
+        Builder = cardano_tx_builder_new(Params, Provider);
+        if (!Builder)
+        {
+            OutEstimate.Error = TEXT("Failed to create transaction builder");
+            cardano_coin_selector_unref(&selector);
+            return false;
+        }
+
+        cardano_tx_builder_set_network_id(Builder, NetworkMagic == CARDANO_NETWORK_MAGIC_MAINNET ? CARDANO_NETWORK_ID_MAIN_NET : CARDANO_NETWORK_ID_TEST_NET);
+        cardano_tx_builder_set_utxos(Builder, UTxOs);
+        cardano_tx_builder_set_change_address(Builder, ChangeAddress);
+    }
+
+    cardano_tx_builder_set_coin_selector(Builder, selector);
+    cardano_tx_builder_set_invalid_after(Builder, static_cast<uint64_t>(InvalidAfter));
+    cardano_coin_selector_unref(&selector);
+
+    cardano_transaction_t* transaction = nullptr;
+    if (!add_payments(Builder, Payments, Strategy, OutEstimate.Error))
+    {
+        return false;
+    }
+
+    if (cardano_tx_builder_build(Builder, &transaction) != CARDANO_SUCCESS)
+    {
+        OutEstimate.Error = UTF8_TO_TCHAR(cardano_tx_builder_get_last_error(Builder));
+        return false;
+    }
+
+    cardano_transaction_body_t* body = cardano_transaction_get_body(transaction);
+    cardano_transaction_input_set_t* inputs = cardano_transaction_body_get_inputs(body);
+    OutEstimate.Fee = static_cast<int64>(cardano_transaction_body_get_fee(body));
+
+    const size_t InputCount = cardano_transaction_input_set_get_length(inputs);
+    OutEstimate.Inputs.Reserve(static_cast<int32>(InputCount));
+    for (size_t Index = 0; Index < InputCount; ++Index)
+    {
+        cardano_transaction_input_t* input = cardano_transaction_input_set_peek(inputs, Index);
+        cardano_blake2b_hash_t* id = cardano_transaction_input_get_id(input);
+
+        FCardanoUTxORef& Ref = OutEstimate.Inputs.AddDefaulted_GetRef();
+        if (id && cardano_blake2b_hash_get_bytes_size(id) == FCardanoHash32::Size)
+        {
+            FMemory::Memcpy(Ref.TxHash.Bytes, cardano_blake2b_hash_get_data(id), FCardanoHash32::Size);
+        }
+        Ref.TxIndex = static_cast<uint32>(cardano_transaction_input_get_index(input));
+
+        cardano_blake2b_hash_unref(&id);
+    }
+
+    cardano_transaction_input_set_unref(&inputs);
+    cardano_transaction_body_unref(&body);
+
+    // Measured rather than encoded: the size is all the estimate needs from the serialized transaction
+    size_t Size = 0;
+    if (cardano_transaction_apply_vkey_witnesses(transaction, PlaceholderWitnesses) != CARDANO_SUCCESS ||
+        cardano_transaction_get_cbor_size(transaction, &Size) != CARDANO_SUCCESS)
+    {
+        OutEstimate.Error = TEXT("Failed to measure the transaction");
+        OutEstimate.Inputs.Reset();
+        cardano_transaction_unref(&transaction);
+        return false;
+    }
+
+    cardano_transaction_unref(&transaction);
+
+    OutEstimate.Size = static_cast<int32>(Size);
+    OutEstimate.bSuccess = true;
+    return true;
+}
@@ -0,0 +1,637 @@
+#include "CardanoTxStore.h"
+#include "CardanoFrameScheduler.h"
+#include "CardanoLog.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/Paths.h"
+
+static const uint32 SEGMENT_MAGIC = 0x53585443; // "CTXS"
+static const uint32 SEGMENT_VERSION = 1;
+static const int64 SEGMENT_HEADER_SIZE = 2 * sizeof(uint32);
+
+static const uint32 BLOCK_MAGIC = 0x4B4C4254; // "TBLK"
+static const uint32 BLOCK_COMPRESSED = 1;
+
+/** Hash, payload offset and size of one transaction of a block. */
+static const int64 BLOCK_ENTRY_SIZE = FCardanoHash32::Size + 2 * sizeof(uint32);
+
+/** Starts every block, followed by Count entries and StoredSize bytes of payload. */
+struct FCardanoTxBlockHeader
+{
+    uint32 Magic;
+    uint32 Count;
+    uint32 RawSize;
+    uint32 StoredSize;
+    /** Of the entries and the payload. */
+    uint32 Crc;
+    uint32 Flags;
+};
+
+static const int64 BLOCK_HEADER_SIZE = sizeof(FCardanoTxBlockHeader);
+
+static bool ReadBlockHeader(const uint8* Data, FCardanoTxBlockHeader& OutHeader)
+{
+    FMemory::Memcpy(&OutHeader, Data, sizeof(OutHeader));
+    return OutHeader.Magic == BLOCK_MAGIC;
+}
+
+TSharedRef<FCardanoTxStore, ESPMode::ThreadSafe> FCardanoTxStore::Open(const FString& Directory, const FOptions& Options)
+{
+    TSharedRef<FCardanoTxStore, ESPMode::ThreadSafe> Store = MakeShareable(new FCardanoTxStore(Directory, Options));
+    Store->LoadSegments();
+    Store->ScheduleCompaction();
+    return Store;
+}
+
+FCardanoTxStore::FCardanoTxStore(const FString& InDirectory, const FOptions& InOptions)
+    : Directory(InDirectory)
+    , Options(InOptions)
+{
+}
+
+FCardanoTxStore::~FCardanoTxStore()
+{
+    Flush();
+    delete WriteHandle;
+    for (FSegment& Segment : Segments)
+    {
+        CloseSegment(Segment);
+    }
+}
+
+bool FCardanoTxStore::Contains(const FCardanoHash32& TxHash) const
+{
+    FScopeLock ScopeLock(&Lock);
+    int32 Position = 0;
+    return Index.Contains(TxHash) || FindPending(TxHash, Position);
+}
+
+bool FCardanoTxStore::Read(const FCardanoHash32& TxHash, TArray<uint8>& OutCbor)
+{
+    FScopeLock ScopeLock(&Lock);
+    int32 Position = 0;
+    if (const FPendingBlock* Block = FindPending(TxHash, Position))
+    {
+        OutCbor = TArray<uint8>(Block->Data.GetData() + Block->Offsets[Position], Block->Sizes[Position]);
+        return true;
+    }
+
+    const FLocation* Location = Index.Find(TxHash);
+    if (!Location)
+    {
+        return false;
+    }
+
+    const TArray<uint8>* Payload = InflateBlock(Location->Segment, Location->BlockOffset);
+    if (!Payload || static_cast<int64>(Location->Offset) + Location->Size > Payload->Num())
+    {
+        // Dropped so the transaction is downloaded and appended again
+        UE_LOG(LogCardano, Warning, TEXT("Transaction %s is unreadable in segment %d of the transaction store"), *TxHash.ToHex(), Location->Segment);
+        Index.Remove(TxHash);
+        return false;
+    }
+
+    OutCbor = TArray<uint8>(Payload->GetData() + Location->Offset, Location->Size);
+    return true;
+}
+
+void FCardanoTxStore::Append(const FCardanoHash32& TxHash, const TArray<uint8>& Cbor)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        int32 Position = 0;
+        if (Cbor.Num() == 0 || Index.Contains(TxHash) || FindPending(TxHash, Position))
+        {
+            return;
+        }
+
+        if (!OpenBlock.IsValid())
+        {
+            OpenBlock = MakeShared<FPendingBlock, ESPMode::ThreadSafe>();
+        }
+
+        OpenBlock->Positions.Add(TxHash, OpenBlock->Hashes.Num());
+        OpenBlock->Hashes.Add(TxHash);
+        OpenBlock->Offsets.Add(OpenBlock->Data.Num());
+        OpenBlock->Sizes.Add(Cbor.Num());
+        OpenBlock->Data.Append(Cbor);
+        if (OpenBlock->Data.Num() < Options.BlockBytes)
+        {
+            return;
+        }
+
+        QueueOpenBlock();
+    }
+
+    FCardanoFrameScheduler::Get().RunInBackground(ECardanoWorkPriority::Low, [This = AsShared()]()
+        {
+            This->WriteQueuedBlocks();
+            This->ScheduleCompaction();
+        });
+}
+
+void FCardanoTxStore::Flush()
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        QueueOpenBlock();
+    }
+
+    WriteQueuedBlocks();
+}
+
+int32 FCardanoTxStore::Num() const
+{
+    FScopeLock ScopeLock(&Lock);
+    int32 Count = Index.Num() + (OpenBlock.IsValid() ? OpenBlock->Hashes.Num() : 0);
+    for (const TSharedPtr<FPendingBlock, ESPMode::ThreadSafe>& Block : QueuedBlocks)
+    {
+        Count += Block->Hashes.Num();
+    }
+    return Count;
+}
+
+int64 FCardanoTxStore::GetDiskBytes() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return DiskBytes;
+}
+
+void FCardanoTxStore::LoadSegments()
+{
+    IFileManager& FileManager = IFileManager::Get();
+    FileManager.MakeDirectory(*Directory, true);
+
+    TArray<FString> Files;
+    FileManager.FindFiles(Files, *(Directory / TEXT("*.seg")), true, false);
+
+    TArray<int32> Ids;
+    for (const FString& File : Files)
+    {
+        const FString Name = FPaths::GetBaseFilename(File);
+        if (Name.IsNumeric())
+        {
+            Ids.Add(FCString::Atoi(*Name));
+        }
+    }
+    Ids.Sort();
+
+    for (int32 i = 0; i < Ids.Num(); i++)
+    {
+        FSegment& Segment = Segments.AddDefaulted_GetRef();
+        Segment.Id = Ids[i];
+        Segment.Size = FMath::Max<int64>(FileManager.FileSize(*GetSegmentPath(Segment.Id)), 0);
+        Segment.bSealed = i < Ids.Num() - 1;
+        DiskBytes += Segment.Size;
+        if (Segment.bSealed)
+        {
+            MapSegment(Segment);
+        }
+
+        // Only the last segment was being appended to, so only it can end in a torn block; blocks of the
+        // others are checked as they are read
+        if (!IndexSegment(Segment, !Segment.bSealed) && !Segment.bSealed)
+        {
+            UE_LOG(LogCardano, Warning, TEXT("Transaction store segment %s ends in a damaged block; appending to a new one"), *GetSegmentPath(Segment.Id));
+            Segment.bSealed = true;
+            MapSegment(Segment);
+        }
+    }
+
+    if (Segments.Num() > 0 && !Segments.Last().bSealed)
+    {
+        FSegment& Last = Segments.Last();
+        Last.Reader.Reset();
+        WriteHandle = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*GetSegmentPath(Last.Id), true, true);
+        if (!WriteHandle)
+        {
+            Last.bSealed = true;
+            MapSegment(Last);
+        }
+    }
+
+    UE_LOG(LogCardano, Log, TEXT("Opened %d stored transactions in %d segments (%lld KB)"), Index.Num(), Segments.Num(), DiskBytes / 1024);
+}
+
+bool FCardanoTxStore::IndexSegment(FSegment& Segment, bool bVerify)
+{
+    TArray<uint8> Scratch;
+    const uint8* Data = ReadRange(Segment, 0, SEGMENT_HEADER_SIZE, Scratch);
+    uint32 Header[2] = { 0, 0 };
+    if (Data)
+    {
+        FMemory::Memcpy(Header, Data, sizeof(Header));
+    }
+    if (Header[0] != SEGMENT_MAGIC || Header[1] != SEGMENT_VERSION)
+    {
+        return false;
+    }
+
+    TArray<TPair<FCardanoHash32, FLocation>> Entries;
+    int64 Offset = SEGMENT_HEADER_SIZE;
+    while (Offset < Segment.Size)
+    {
+        FCardanoTxBlockHeader Block;
+        Data = ReadRange(Segment, Offset, BLOCK_HEADER_SIZE, Scratch);
+        if (!Data || !ReadBlockHeader(Data, Block))
+        {
+            return false;
+        }
+
+        const int64 EntriesSize = Block.Count * BLOCK_ENTRY_SIZE;
+        const int64 BlockSize = BLOCK_HEADER_SIZE + EntriesSize + Block.StoredSize;
+        const int64 BodySize = bVerify ? EntriesSize + Block.StoredSize : EntriesSize;
+        Data = Offset + BlockSize <= Segment.Size ? ReadRange(Segment, Offset + BLOCK_HEADER_SIZE, BodySize, Scratch) : nullptr;
+        if (!Data || (bVerify && FCrc::MemCrc32(Data, static_cast<int32>(BodySize)) != Block.Crc))
+        {
+            return false;
+        }
+
+        Entries.Reset();
+        for (uint32 i = 0; i < Block.Count; i++)
+        {
+            const uint8* Entry = Data + i * BLOCK_ENTRY_SIZE;
+            TPair<FCardanoHash32, FLocation>& Pair = Entries.AddDefaulted_GetRef();
+            FMemory::Memcpy(Pair.Key.Bytes, Entry, FCardanoHash32::Size);
+            FMemory::Memcpy(&Pair.Value.Offset, Entry + FCardanoHash32::Size, sizeof(uint32));
+            FMemory::Memcpy(&Pair.Value.Size, Entry + FCardanoHash32::Size + sizeof(uint32), sizeof(uint32));
+            Pair.Value.Segment = Segment.Id;
+            Pair.Value.BlockOffset = Offset;
+            if (static_cast<int64>(Pair.Value.Offset) + Pair.Value.Size > Block.RawSize)
+            {
+                return false;
+            }
+        }
+
+        for (const TPair<FCardanoHash32, FLocation>& Pair : Entries)
+        {
+            Index.Add(Pair.Key, Pair.Value);
+        }
+        Offset += BlockSize;
+    }
+
+    return true;
+}
+
+const FCardanoTxStore::FPendingBlock* FCardanoTxStore::FindPending(const FCardanoHash32& TxHash, int32& OutPosition) const
+{
+    if (OpenBlock.IsValid())
+    {
+        if (const int32* Position = OpenBlock->Positions.Find(TxHash))
+        {
+            OutPosition = *Position;
+            return OpenBlock.Get();
+        }
+    }
+
+    for (const TSharedPtr<FPendingBlock, ESPMode::ThreadSafe>& Block : QueuedBlocks)
+    {
+        if (const int32* Position = Block->Positions.Find(TxHash))
+        {
+            OutPosition = *Position;
+            return Block.Get();
+        }
+    }
+
+    return nullptr;
+}
+
+FCardanoTxStore::FSegment* FCardanoTxStore::FindSegment(int32 Id)
+{
+    return Segments.FindByPredicate([Id](const FSegment& Segment) { return Segment.Id == Id; });
+}
+
+FString FCardanoTxStore::GetSegmentPath(int32 Id) const
+{
+    return Directory / FString::Printf(TEXT("%08d.seg"), Id);
+}
+
+void FCardanoTxStore::MapSegment(FSegment& Segment)
+{
+    // Platforms without memory mapping read the segment through Reader instead
+    CloseSegment(Segment);
+    Segment.File = MakeShareable(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*GetSegmentPath(Segment.Id)));
+    if (Segment.File.IsValid() && Segment.Size > 0)
+    {
+        Segment.Region = MakeShareable(Segment.File->MapRegion(0, Segment.Size, true));
+    }
+}
+
+void FCardanoTxStore::CloseSegment(FSegment& Segment)
+{
+    // The region goes before the file it maps
+    Segment.Region.Reset();
+    Segment.File.Reset();
+    Segment.Reader.Reset();
+}
+
+const uint8* FCardanoTxStore::ReadRange(FSegment& Segment, int64 Offset, int64 Length, TArray<uint8>& Scratch)
+{
+    if (Offset < 0 || Length < 0 || Length > MAX_int32 || Offset + Length > Segment.Size)
+    {
+        return nullptr;
+    }
+
+    if (Segment.Region.IsValid())
+    {
+        return Offset + Length <= Segment.Region->GetMappedSize() ? Segment.Region->GetMappedPtr() + Offset : nullptr;
+    }
+
+    if (!Segment.Reader.IsValid())
+    {
+        Segment.Reader = MakeShareable(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*GetSegmentPath(Segment.Id), true));
+    }
+
+    Scratch.SetNumUninitialized(static_cast<int32>(Length), false);
+    if (!Segment.Reader.IsValid() || !Segment.Reader->Seek(Offset) || !Segment.Reader->Read(Scratch.GetData(), Length))
+    {
+        return nullptr;
+    }
+    return Scratch.GetData();
+}
+
+void FCardanoTxStore::QueueOpenBlock()
+{
+    if (OpenBlock.IsValid())
+    {
+        QueuedBlocks.Add(OpenBlock);
+        OpenBlock.Reset();
+    }
+}
+
+void FCardanoTxStore::WriteQueuedBlocks()
+{
+    FScopeLock WriteScope(&WriteLock);
+    for (;;)
+    {
+        TSharedPtr<FPendingBlock, ESPMode::ThreadSafe> Block;
+        {
+            FScopeLock ScopeLock(&Lock);
+            if (QueuedBlocks.Num() == 0)
+            {
+                break;
+            }
+            Block = QueuedBlocks[0];
+        }
+
+        // Compressed outside Lock so reads go on meanwhile; the block stays queued, and readable, until it is indexed
+        TArray<uint8> Encoded;
+        EncodeBlock(*Block, Encoded);
+
+        int32 SegmentId = 0;
+        int64 BlockOffset = 0;
+        const bool bWritten = WriteBlock(Encoded, SegmentId, BlockOffset);
+        if (!bWritten)
+        {
+            UE_LOG(LogCardano, Warning, TEXT("Could not write %d transactions to the transaction store in %s"), Block->Hashes.Num(), *Directory);
+        }
+
+        FScopeLock ScopeLock(&Lock);
+        QueuedBlocks.Remove(Block);
+        for (int32 i = 0; bWritten && i < Block->Hashes.Num(); i++)
+        {
+            FLocation& Location = Index.Add(Block->Hashes[i]);
+            Location.Segment = SegmentId;
+            Location.BlockOffset = BlockOffset;
+            Location.Offset = Block->Offsets[i];
+            Location.Size = Block->Sizes[i];
+        }
+    }
+}
+
+void FCardanoTxStore::EncodeBlock(const FPendingBlock& Block, TArray<uint8>& OutEncoded)
+{
+    const int32 RawSize = Block.Data.Num();
+    const int64 EntriesSize = Block.Hashes.Num() * BLOCK_ENTRY_SIZE;
+    int32 StoredSize = FMath::Max(FCompression::CompressMemoryBound(NAME_Zlib, RawSize), RawSize);
+    OutEncoded.SetNumUninitialized(static_cast<int32>(BLOCK_HEADER_SIZE + EntriesSize + StoredSize));
+
+    uint8* Entries = OutEncoded.GetData() + BLOCK_HEADER_SIZE;
+    for (int32 i = 0; i < Block.Hashes.Num(); i++)
+    {
+        uint8* Entry = Entries + i * BLOCK_ENTRY_SIZE;
+        FMemory::Memcpy(Entry, Block.Hashes[i].Bytes, FCardanoHash32::Size);
+        FMemory::Memcpy(Entry + FCardanoHash32::Size, &Block.Offsets[i], sizeof(uint32));
+        FMemory::Memcpy(Entry + FCardanoHash32::Size + sizeof(uint32), &Block.Sizes[i], sizeof(uint32));
+    }
+
+    // Neighbouring transactions share addresses, policy ids and scripts, so their CBOR compresses well together;
+    // a block that does not shrink is stored as it is
+    FCardanoTxBlockHeader Header;
+    Header.Flags = BLOCK_COMPRESSED;
+    uint8* Payload = Entries + EntriesSize;
+    if (!FCompression::CompressMemory(NAME_Zlib, Payload, StoredSize, Block.Data.GetData(), RawSize) || StoredSize >= RawSize)
+    {
+        FMemory::Memcpy(Payload, Block.Data.GetData(), RawSize);
+        StoredSize = RawSize;
+        Header.Flags = 0;
+    }
+    OutEncoded.SetNum(static_cast<int32>(BLOCK_HEADER_SIZE + EntriesSize + StoredSize), false);
+
+    Header.Magic = BLOCK_MAGIC;
+    Header.Count = Block.Hashes.Num();
+    Header.RawSize = RawSize;
+    Header.StoredSize = StoredSize;
+    Header.Crc = FCrc::MemCrc32(Entries, static_cast<int32>(EntriesSize + StoredSize));
+    FMemory::Memcpy(OutEncoded.GetData(), &Header, sizeof(Header));
+}
+
+bool FCardanoTxStore::WriteBlock(const TArray<uint8>& Encoded, int32& OutSegment, int64& OutBlockOffset)
+{
+    int64 SegmentSize = 0;
+    if (WriteHandle)
+    {
+        FScopeLock ScopeLock(&Lock);
+        SegmentSize = Segments.Last().Size;
+    }
+
+    if (!WriteHandle || (SegmentSize > SEGMENT_HEADER_SIZE && SegmentSize + Encoded.Num() > Options.SegmentBytes))
+    {
+        if (!StartSegment())
+        {
+            return false;
+        }
+        SegmentSize = SEGMENT_HEADER_SIZE;
+    }
+
+    if (!WriteHandle->Write(Encoded.GetData(), Encoded.Num()) || !WriteHandle->Flush())
+    {
+        // Whatever reached the file is a torn block, so the segment is sealed before it
+        delete WriteHandle;
+        WriteHandle = nullptr;
+        return false;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    FSegment& Segment = Segments.Last();
+    OutSegment = Segment.Id;
+    OutBlockOffset = SegmentSize;
+    Segment.Size += Encoded.Num();
+    DiskBytes += Encoded.Num();
+    return true;
+}
+
+bool FCardanoTxStore::StartSegment()
+{
+    delete WriteHandle;
+    WriteHandle = nullptr;
+
+    int32 Id = 1;
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (Segments.Num() > 0)
+        {
+            FSegment& Last = Segments.Last();
+            if (!Last.bSealed)
+            {
+                Last.bSealed = true;
+                MapSegment(Last);
+            }
+            Id = Last.Id + 1;
+        }
+    }
+
+    IFileHandle* Handle = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*GetSegmentPath(Id), false, true);
+    const uint32 Header[2] = { SEGMENT_MAGIC, SEGMENT_VERSION };
+    if (!Handle || !Handle->Write(reinterpret_cast<const uint8*>(Header), sizeof(Header)) || !Handle->Flush())
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Could not start transaction store segment %s"), *GetSegmentPath(Id));
+        delete Handle;
+        return false;
+    }
+    WriteHandle = Handle;
+
+    FScopeLock ScopeLock(&Lock);
+    FSegment& Segment = Segments.AddDefaulted_GetRef();
+    Segment.Id = Id;
+    Segment.Size = SEGMENT_HEADER_SIZE;
+    DiskBytes += SEGMENT_HEADER_SIZE;
+    return true;
+}
+
+const TArray<uint8>* FCardanoTxStore::InflateBlock(int32 SegmentId, int64 BlockOffset)
+{
+    for (int32 i = 0; i < BlockCache.Num(); i++)
+    {
+        if (BlockCache[i].Segment == SegmentId && BlockCache[i].BlockOffset == BlockOffset)
+        {
+            if (i > 0)
+            {
+                FCachedBlock Hit = MoveTemp(BlockCache[i]);
+                BlockCache.RemoveAt(i, 1, false);
+                BlockCache.Insert(MoveTemp(Hit), 0);
+            }
+            return &BlockCache[0].Data;
+        }
+    }
+
+    FSegment* Segment = FindSegment(SegmentId);
+    if (!Segment)
+    {
+        return nullptr;
+    }
+
+    TArray<uint8> Scratch;
+    FCardanoTxBlockHeader Header;
+    const uint8* Data = ReadRange(*Segment, BlockOffset, BLOCK_HEADER_SIZE, Scratch);
+    if (!Data || !ReadBlockHeader(Data, Header))
+    {
+        return nullptr;
+    }
+
+    const int64 EntriesSize = Header.Count * BLOCK_ENTRY_SIZE;
+    const int64 BodySize = EntriesSize + Header.StoredSize;
+    Data = ReadRange(*Segment, BlockOffset + BLOCK_HEADER_SIZE, BodySize, Scratch);
+    if (!Data || FCrc::MemCrc32(Data, static_cast<int32>(BodySize)) != Header.Crc || Header.RawSize > MAX_int32)
+    {
+        return nullptr;
+    }
+
+    FCachedBlock Inflated;
+    Inflated.Segment = SegmentId;
+    Inflated.BlockOffset = BlockOffset;
+    Inflated.Data.SetNumUninitialized(Header.RawSize);
+    const uint8* Stored = Data + EntriesSize;
+    if (Header.Flags & BLOCK_COMPRESSED)
+    {
+        if (!FCompression::UncompressMemory(NAME_Zlib, Inflated.Data.GetData(), Header.RawSize, Stored, Header.StoredSize))
+        {
+            return nullptr;
+        }
+    }
+    else if (Header.StoredSize == Header.RawSize)
+    {
+        FMemory::Memcpy(Inflated.Data.GetData(), Stored, Header.RawSize);
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    BlockCache.Insert(MoveTemp(Inflated), 0);
+    if (BlockCache.Num() > FMath::Max(Options.CachedBlocks, 1))
+    {
+        BlockCache.Pop(false);
+    }
+    return &BlockCache[0].Data;
+}
+
+void FCardanoTxStore::ScheduleCompaction()
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (bCompactionScheduled || DiskBytes <= Options.MaxBytes)
+        {
+            return;
+        }
+        bCompactionScheduled = true;
+    }
+
+    FCardanoFrameScheduler::Get().RunInBackground(ECardanoWorkPriority::Low, [This = AsShared()]()
+        {
+            This->Compact();
+        });
+}
+
+void FCardanoTxStore::Compact()
+{
+    FScopeLock ScopeLock(&Lock);
+    bCompactionScheduled = false;
+
+    // The segment being appended to is last and never sealed, so it is never dropped
+    TSet<int32> Dropped;
+    while (DiskBytes > Options.MaxBytes && Segments.Num() > 0 && Segments[0].bSealed)
+    {
+        FSegment& Segment = Segments[0];
+        CloseSegment(Segment);
+        if (!IFileManager::Get().Delete(*GetSegmentPath(Segment.Id), false, false, true))
+        {
+            UE_LOG(LogCardano, Warning, TEXT("Could not delete transaction store segment %s"), *GetSegmentPath(Segment.Id));
+            break;
+        }
+
+        DiskBytes -= Segment.Size;
+        Dropped.Add(Segment.Id);
+        Segments.RemoveAt(0);
+    }
+
+    if (Dropped.Num() == 0)
+    {
+        return;
+    }
+
+    for (TMap<FCardanoHash32, FLocation>::TIterator It = Index.CreateIterator(); It; ++It)
+    {
+        if (Dropped.Contains(It.Value().Segment))
+        {
+            It.RemoveCurrent();
+        }
+    }
+    BlockCache.RemoveAll([&Dropped](const FCachedBlock& Block) { return Dropped.Contains(Block.Segment); });
+
+    UE_LOG(LogCardano, Log, TEXT("Dropped %d transaction store segments over budget; %d transactions remain (%lld KB)"),
+        Dropped.Num(), Index.Num(), DiskBytes / 1024);
+}
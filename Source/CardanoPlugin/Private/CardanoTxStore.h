@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "CardanoHash.h"
+
+class IFileHandle;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Append-only store of transaction CBOR, bounded on disk, in numbered segment files under one directory.
+ * Transactions are gathered into a block, which a worker compresses and appends to the current segment once it holds
+ * BlockBytes; the segment is sealed once it reaches SegmentBytes. Each block starts with the hashes, offsets and
+ * sizes of its transactions, so opening the store only reads block headers, and reading a transaction inflates the
+ * one block holding it. Sealed segments are read through memory mapping, and the last few inflated blocks are kept,
+ * since a history page reads neighbouring transactions.
+ * Transactions are content addressed and never change, so there is nothing to rewrite: compaction drops the oldest
+ * sealed segments on a worker once the store outgrows MaxBytes, and their transactions are downloaded again if needed.
+ * A block torn by a crash fails its checksum, and the segment is sealed before it.
+ * Every method may be called from any thread.
+ */
+class FCardanoTxStore : public TSharedFromThis<FCardanoTxStore, ESPMode::ThreadSafe>
+{
+public:
+    struct FOptions
+    {
+        int32 BlockBytes = 64 * 1024;
+        int64 SegmentBytes = 16 * 1024 * 1024;
+        int64 MaxBytes = 512 * 1024 * 1024;
+        int32 CachedBlocks = 8;
+    };
+
+    /** Opens the store in Directory, creating the directory if needed, and indexes the segments it holds. */
+    static TSharedRef<FCardanoTxStore, ESPMode::ThreadSafe> Open(const FString& Directory, const FOptions& Options);
+
+    ~FCardanoTxStore();
+
+    bool Contains(const FCardanoHash32& TxHash) const;
+
+    /** Copies the CBOR of TxHash into OutCbor; false if the store does not hold it. */
+    bool Read(const FCardanoHash32& TxHash, TArray<uint8>& OutCbor);
+
+    /** Adds a transaction unless it is stored already. It can be read right away, and is on disk once its block is written. */
+    void Append(const FCardanoHash32& TxHash, const TArray<uint8>& Cbor);
+
+    /** Writes the block being gathered even if it is not full, along with the blocks waiting for a worker. */
+    void Flush();
+
+    int32 Num() const;
+
+    /** Bytes of the segment files. */
+    int64 GetDiskBytes() const;
+
+private:
+    struct FLocation
+    {
+        int32 Segment = 0;
+        int64 BlockOffset = 0;
+        uint32 Offset = 0;
+        uint32 Size = 0;
+    };
+
+    /** Transactions not written yet; Offsets index Data. */
+    struct FPendingBlock
+    {
+        TArray<uint8> Data;
+        TArray<FCardanoHash32> Hashes;
+        TArray<uint32> Offsets;
+        TArray<uint32> Sizes;
+        TMap<FCardanoHash32, int32> Positions;
+    };
+
+    struct FSegment
+    {
+        int32 Id = 0;
+        int64 Size = 0;
+        bool bSealed = false;
+        TSharedPtr<IMappedFileHandle> File;
+        TSharedPtr<IMappedFileRegion> Region;
+        /** Reads the segment while it is not mapped, such as the one being appended to. */
+        TSharedPtr<IFileHandle> Reader;
+    };
+
+    struct FCachedBlock
+    {
+        int32 Segment = 0;
+        int64 BlockOffset = 0;
+        TArray<uint8> Data;
+    };
+
+    FCardanoTxStore(const FString& InDirectory, const FOptions& InOptions);
+
+    void LoadSegments();
+    /** Indexes the blocks of Segment up to the first one that is cut short, or fails its checksum if bVerify; false if one is. */
+    bool IndexSegment(FSegment& Segment, bool bVerify);
+
+    const FPendingBlock* FindPending(const FCardanoHash32& TxHash, int32& OutPosition) const;
+    FSegment* FindSegment(int32 Id);
+    FString GetSegmentPath(int32 Id) const;
+    void MapSegment(FSegment& Segment);
+    void CloseSegment(FSegment& Segment);
+    /** Points at Length bytes of Segment from Offset, in its mapping or read into Scratch; nullptr past its end. */
+    const uint8* ReadRange(FSegment& Segment, int64 Offset, int64 Length, TArray<uint8>& Scratch);
+
+    /** Queues the gathered block for a worker. */
+    void QueueOpenBlock();
+    void WriteQueuedBlocks();
+    static void EncodeBlock(const FPendingBlock& Block, TArray<uint8>& OutEncoded);
+    /** Appends Encoded to the current segment, starting a new one if it would outgrow SegmentBytes. Needs WriteLock. */
+    bool WriteBlock(const TArray<uint8>& Encoded, int32& OutSegment, int64& OutBlockOffset);
+
+    /** Seals the last segment and starts the next one. Needs WriteLock. */
+    bool StartSegment();
+    const TArray<uint8>* InflateBlock(int32 SegmentId, int64 BlockOffset);
+
+    void ScheduleCompaction();
+    void Compact();
+
+    const FString Directory;
+    const FOptions Options;
+
+    /** Held while blocks are written, so they reach the segment in the order they were queued; guards WriteHandle. */
+    FCriticalSection WriteLock;
+
+    /** Appends to the last segment while it is not sealed. */
+    IFileHandle* WriteHandle = nullptr;
+
+    /** Guards everything below. */
+    mutable FCriticalSection Lock;
+
+    TMap<FCardanoHash32, FLocation> Index;
+    TArray<FSegment> Segments;
+    int64 DiskBytes = 0;
+
+    /** Shared with the worker writing them, which reads them outside Lock once queued. */
+    TSharedPtr<FPendingBlock, ESPMode::ThreadSafe> OpenBlock;
+    TArray<TSharedPtr<FPendingBlock, ESPMode::ThreadSafe>> QueuedBlocks;
+
+    /** Most recently read first. */
+    TArray<FCachedBlock> BlockCache;
+
+    bool bCompactionScheduled = false;
+};
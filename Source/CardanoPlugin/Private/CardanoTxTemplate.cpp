@@ -0,0 +1,359 @@
+#include "CardanoTxTemplate.h"
+#include "CardanoLog.h"
+#include "CardanoStats.h"
+#include <cardano/cardano.h>
+#include <sodium.h>
+
+namespace
+{
+    /** Body map keys of the patched fields. */
+    const uint64 BODY_KEY_INPUTS = 0;
+    const uint64 BODY_KEY_OUTPUTS = 1;
+    const uint64 BODY_KEY_FEE = 2;
+    const uint64 BODY_KEY_TTL = 3;
+
+    /** Key of the value in a post-Alonzo output map, and its position in a legacy output array. */
+    const uint64 OUTPUT_KEY_VALUE = 1;
+
+    int32 get_offset(cardano_cbor_reader_t* reader, int32 Size)
+    {
+        size_t remaining = 0;
+        cardano_cbor_reader_get_bytes_remaining(reader, &remaining);
+        return Size - static_cast<int32>(remaining);
+    }
+
+    bool is_at(cardano_cbor_reader_t* reader, cardano_cbor_reader_state_t expected)
+    {
+        cardano_cbor_reader_state_t state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+        return cardano_cbor_reader_peek_state(reader, &state) == CARDANO_SUCCESS && state == expected;
+    }
+
+    /** Whether the definite or indefinite container holding Count items, of which Read were read, has more. */
+    bool has_more(cardano_cbor_reader_t* reader, int64_t Count, int64_t Read, cardano_cbor_reader_state_t end_state)
+    {
+        return Count < 0 ? !is_at(reader, end_state) : Read < Count;
+    }
+
+    bool read_uint_at(cardano_cbor_reader_t* reader, int32 Size, int32& OutOffset, int32& OutWidth, uint64& OutValue)
+    {
+        OutOffset = get_offset(reader, Size);
+        uint64_t value = 0;
+        if (cardano_cbor_reader_read_uint(reader, &value) != CARDANO_SUCCESS)
+        {
+            return false;
+        }
+
+        OutWidth = get_offset(reader, Size) - OutOffset;
+        OutValue = value;
+        return true;
+    }
+
+    /** Reads the coin of a value, which is either a bare coin or a [coin, multiasset] pair. */
+    bool read_coin_at(cardano_cbor_reader_t* reader, int32 Size, int32& OutOffset, int32& OutWidth, uint64& OutValue)
+    {
+        if (!is_at(reader, CARDANO_CBOR_READER_STATE_START_ARRAY))
+        {
+            return read_uint_at(reader, Size, OutOffset, OutWidth, OutValue);
+        }
+
+        int64_t count = 0;
+        if (cardano_cbor_reader_read_start_array(reader, &count) != CARDANO_SUCCESS ||
+            !read_uint_at(reader, Size, OutOffset, OutWidth, OutValue))
+        {
+            return false;
+        }
+
+        for (int64_t i = 1; has_more(reader, count, i, CARDANO_CBOR_READER_STATE_END_ARRAY); ++i)
+        {
+            if (cardano_cbor_reader_skip_value(reader) != CARDANO_SUCCESS)
+            {
+                return false;
+            }
+        }
+        return cardano_cbor_reader_read_end_array(reader) == CARDANO_SUCCESS;
+    }
+
+    /** Bytes of the shortest CBOR head encoding Value, which is the one cardano-c writes. */
+    int32 get_uint_width(uint64 Value)
+    {
+        return Value < 24 ? 1 : Value <= MAX_uint8 ? 2 : Value <= MAX_uint16 ? 3 : Value <= MAX_uint32 ? 5 : 9;
+    }
+
+    void write_uint(uint8* Dest, int32 Width, uint64 Value)
+    {
+        static const uint8 LENGTH_INFO[] = { 0, 0, 24, 25, 0, 26, 0, 0, 0, 27 };
+
+        if (Width == 1)
+        {
+            Dest[0] = static_cast<uint8>(Value);
+            return;
+        }
+
+        Dest[0] = LENGTH_INFO[Width];
+        for (int32 i = Width - 1; i >= 1; --i)
+        {
+            Dest[i] = static_cast<uint8>(Value & 0xff);
+            Value >>= 8;
+        }
+    }
+
+    bool is_ascending(const TArray<FCardanoUTxORef>& Inputs)
+    {
+        for (int32 i = 1; i < Inputs.Num(); ++i)
+        {
+            const int32 Order = FMemory::Memcmp(Inputs[i - 1].TxHash.Bytes, Inputs[i].TxHash.Bytes, FCardanoHash32::Size);
+            if (Order > 0 || (Order == 0 && Inputs[i - 1].TxIndex >= Inputs[i].TxIndex))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+bool FCardanoTxTemplate::Initialize(const TArray<uint8>& InTransaction, FFullBuild InFullBuild, FString& OutError)
+{
+    FullBuild = MoveTemp(InFullBuild);
+    PatchedCount = 0;
+    FullBuildCount = 0;
+    return Record(InTransaction, OutError);
+}
+
+bool FCardanoTxTemplate::Record(const TArray<uint8>& InTransaction, FString& OutError)
+{
+    CARDANO_SCOPE(CardanoSerialize);
+
+    const int32 Size = InTransaction.Num();
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(InTransaction.GetData(), Size);
+    if (!reader)
+    {
+        OutError = TEXT("Failed to create CBOR reader");
+        return false;
+    }
+
+    FCardanoTxTemplateValues NewValues;
+    TArray<FInputField> NewInputs;
+    TArray<FUIntField> NewOutputs;
+    FUIntField NewFee;
+    FUIntField NewInvalidAfter;
+    int32 NewBodyOffset = 0;
+
+    int64_t tx_items = 0;
+    int64_t body_entries = 0;
+    bool bValid = cardano_cbor_reader_read_start_array(reader, &tx_items) == CARDANO_SUCCESS;
+    if (bValid)
+    {
+        NewBodyOffset = get_offset(reader, Size);
+        bValid = cardano_cbor_reader_read_start_map(reader, &body_entries) == CARDANO_SUCCESS;
+    }
+
+    for (int64_t entry = 0; bValid && has_more(reader, body_entries, entry, CARDANO_CBOR_READER_STATE_END_MAP); ++entry)
+    {
+        uint64_t key = 0;
+        bValid = cardano_cbor_reader_read_uint(reader, &key) == CARDANO_SUCCESS;
+        if (!bValid)
+        {
+            break;
+        }
+
+        if (key == BODY_KEY_INPUTS)
+        {
+            // Conway tags the input set with 258
+            cardano_cbor_tag_t tag;
+            if (is_at(reader, CARDANO_CBOR_READER_STATE_TAG))
+            {
+                bValid = cardano_cbor_reader_read_tag(reader, &tag) == CARDANO_SUCCESS;
+            }
+
+            int64_t count = 0;
+            bValid = bValid && cardano_cbor_reader_read_start_array(reader, &count) == CARDANO_SUCCESS;
+            for (int64_t i = 0; bValid && has_more(reader, count, i, CARDANO_CBOR_READER_STATE_END_ARRAY); ++i)
+            {
+                FInputField& Field = NewInputs.AddDefaulted_GetRef();
+                FCardanoUTxORef& Input = NewValues.Inputs.AddDefaulted_GetRef();
+                const byte_t* hash = nullptr;
+                size_t hash_size = 0;
+                int64_t pair_size = 0;
+                uint64 Index = 0;
+
+                bValid = cardano_cbor_reader_read_start_array(reader, &pair_size) == CARDANO_SUCCESS &&
+                    cardano_cbor_reader_read_bytestring_view(reader, &hash, &hash_size) == CARDANO_SUCCESS &&
+                    hash_size == FCardanoHash32::Size &&
+                    read_uint_at(reader, Size, Field.Index.Offset, Field.Index.Width, Index) &&
+                    Index <= MAX_uint32 &&
+                    cardano_cbor_reader_read_end_array(reader) == CARDANO_SUCCESS;
+
+                if (bValid)
+                {
+                    // The view points into the transaction, past the bytestring head
+                    Field.HashOffset = static_cast<int32>(hash - InTransaction.GetData());
+                    FMemory::Memcpy(Input.TxHash.Bytes, hash, FCardanoHash32::Size);
+                    Input.TxIndex = static_cast<uint32>(Index);
+                }
+            }
+            bValid = bValid && cardano_cbor_reader_read_end_array(reader) == CARDANO_SUCCESS;
+        }
+        else if (key == BODY_KEY_OUTPUTS)
+        {
+            int64_t count = 0;
+            bValid = cardano_cbor_reader_read_start_array(reader, &count) == CARDANO_SUCCESS;
+            for (int64_t i = 0; bValid && has_more(reader, count, i, CARDANO_CBOR_READER_STATE_END_ARRAY); ++i)
+            {
+                FUIntField& Field = NewOutputs.AddDefaulted_GetRef();
+                uint64& Lovelace = NewValues.OutputLovelace.AddZeroed_GetRef();
+                const bool bMap = is_at(reader, CARDANO_CBOR_READER_STATE_START_MAP);
+                const cardano_cbor_reader_state_t end_state = bMap ? CARDANO_CBOR_READER_STATE_END_MAP : CARDANO_CBOR_READER_STATE_END_ARRAY;
+
+                int64_t fields = 0;
+                bValid = (bMap ? cardano_cbor_reader_read_start_map(reader, &fields) : cardano_cbor_reader_read_start_array(reader, &fields)) == CARDANO_SUCCESS;
+
+                for (int64_t f = 0; bValid && has_more(reader, fields, f, end_state); ++f)
+                {
+                    uint64_t field_key = static_cast<uint64_t>(f);
+                    if (bMap)
+                    {
+                        bValid = cardano_cbor_reader_read_uint(reader, &field_key) == CARDANO_SUCCESS;
+                    }
+
+                    if (bValid && field_key == OUTPUT_KEY_VALUE)
+                    {
+                        bValid = read_coin_at(reader, Size, Field.Offset, Field.Width, Lovelace);
+                    }
+                    else if (bValid)
+                    {
+                        bValid = cardano_cbor_reader_skip_value(reader) == CARDANO_SUCCESS;
+                    }
+                }
+
+                bValid = bValid && Field.Offset != INDEX_NONE &&
+                    (bMap ? cardano_cbor_reader_read_end_map(reader) : cardano_cbor_reader_read_end_array(reader)) == CARDANO_SUCCESS;
+            }
+            bValid = bValid && cardano_cbor_reader_read_end_array(reader) == CARDANO_SUCCESS;
+        }
+        else if (key == BODY_KEY_FEE)
+        {
+            bValid = read_uint_at(reader, Size, NewFee.Offset, NewFee.Width, NewValues.Fee);
+        }
+        else if (key == BODY_KEY_TTL)
+        {
+            bValid = read_uint_at(reader, Size, NewInvalidAfter.Offset, NewInvalidAfter.Width, NewValues.InvalidAfter);
+        }
+        else
+        {
+            bValid = cardano_cbor_reader_skip_value(reader) == CARDANO_SUCCESS;
+        }
+    }
+
+    bValid = bValid && cardano_cbor_reader_read_end_map(reader) == CARDANO_SUCCESS;
+    const int32 NewBodySize = get_offset(reader, Size) - NewBodyOffset;
+    cardano_cbor_reader_unref(&reader);
+
+    if (!bValid || NewFee.Offset == INDEX_NONE || NewInputs.Num() == 0)
+    {
+        OutError = TEXT("Transaction body cannot be used as a template");
+        return false;
+    }
+
+    Transaction = InTransaction;
+    BodyOffset = NewBodyOffset;
+    BodySize = NewBodySize;
+    InputFields = MoveTemp(NewInputs);
+    OutputFields = MoveTemp(NewOutputs);
+    FeeField = NewFee;
+    InvalidAfterField = NewInvalidAfter;
+    Values = MoveTemp(NewValues);
+    return true;
+}
+
+bool FCardanoTxTemplate::CanPatch(const FCardanoTxTemplateValues& InValues) const
+{
+    if (InValues.Inputs.Num() != InputFields.Num() || InValues.OutputLovelace.Num() != OutputFields.Num() ||
+        get_uint_width(InValues.Fee) != FeeField.Width)
+    {
+        return false;
+    }
+
+    const bool bInvalidAfterFits = InvalidAfterField.Offset == INDEX_NONE
+        ? InValues.InvalidAfter == 0
+        : get_uint_width(InValues.InvalidAfter) == InvalidAfterField.Width;
+
+    // Inputs written out of order would move the ones redeemers point at
+    if (!bInvalidAfterFits || !is_ascending(InValues.Inputs))
+    {
+        return false;
+    }
+
+    for (int32 i = 0; i < InputFields.Num(); ++i)
+    {
+        if (get_uint_width(InValues.Inputs[i].TxIndex) != InputFields[i].Index.Width)
+        {
+            return false;
+        }
+    }
+
+    for (int32 i = 0; i < OutputFields.Num(); ++i)
+    {
+        if (get_uint_width(InValues.OutputLovelace[i]) != OutputFields[i].Width)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FCardanoTxTemplate::Instantiate(const FCardanoTxTemplateValues& InValues, TArray<uint8>& OutTransaction, FCardanoHash32& OutTxId, FString& OutError)
+{
+    if (!IsInitialized())
+    {
+        OutError = TEXT("Transaction template is not initialized");
+        return false;
+    }
+
+    if (CanPatch(InValues))
+    {
+        CARDANO_SCOPE(CardanoBuild);
+
+        OutTransaction = Transaction;
+        uint8* Bytes = OutTransaction.GetData();
+
+        for (int32 i = 0; i < InputFields.Num(); ++i)
+        {
+            FMemory::Memcpy(Bytes + InputFields[i].HashOffset, InValues.Inputs[i].TxHash.Bytes, FCardanoHash32::Size);
+            write_uint(Bytes + InputFields[i].Index.Offset, InputFields[i].Index.Width, InValues.Inputs[i].TxIndex);
+        }
+
+        for (int32 i = 0; i < OutputFields.Num(); ++i)
+        {
+            write_uint(Bytes + OutputFields[i].Offset, OutputFields[i].Width, InValues.OutputLovelace[i]);
+        }
+
+        write_uint(Bytes + FeeField.Offset, FeeField.Width, InValues.Fee);
+        if (InvalidAfterField.Offset != INDEX_NONE)
+        {
+            write_uint(Bytes + InvalidAfterField.Offset, InvalidAfterField.Width, InValues.InvalidAfter);
+        }
+
+        crypto_generichash(OutTxId.Bytes, FCardanoHash32::Size, Bytes + BodyOffset, BodySize, nullptr, 0);
+        ++PatchedCount;
+        return true;
+    }
+
+    if (!FullBuild)
+    {
+        OutError = TEXT("The values do not fit the transaction template");
+        return false;
+    }
+
+    TArray<uint8> Built;
+    if (!FullBuild(InValues, Built, OutError) || !Record(Built, OutError))
+    {
+        return false;
+    }
+
+    UE_LOG(LogCardano, Verbose, TEXT("Transaction template rebuilt after %d patched instances"), PatchedCount);
+
+    OutTransaction = Transaction;
+    crypto_generichash(OutTxId.Bytes, FCardanoHash32::Size, Transaction.GetData() + BodyOffset, BodySize, nullptr, 0);
+    ++FullBuildCount;
+    return true;
+}
@@ -0,0 +1,1540 @@
+#include "CardanoUTxOCache.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoKoiosParsing.h"
+#include "CardanoLog.h"
+#include "CardanoStats.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "Engine/Engine.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include <cardano/address/address.h>
+#include <cardano/transaction/transaction.h>
+
+/** Progress of one RefreshAll pass. Nothing is written to the cache until every request has succeeded. */
+struct UCardanoUTxOCache::FRefreshState
+{
+    int64 TipHeight = 0;
+    int64 MaxSeenHeight = 0;
+    int32 PendingSteps = 0;
+    FString FirstError;
+
+    /** Full UTxO sets of the addresses downloaded for the first time. */
+    TMap<FString, TMap<FCardanoUTxORef, FUTxO>> Snapshots;
+
+    /** Already initialized addresses brought forward with deltas. */
+    TSet<FString> DeltaAddresses;
+    TSet<FString> SeenTxHashes;
+    TSet<FCardanoUTxORef> SpentKeys;
+    TArray<TPair<FString, FUTxO>> CreatedOutputs;
+};
+
+/** Output references from Koios hex; a malformed hash leaves the zero hash, which no real output has. */
+/** Counts a lookup of the cached UTxO sets for cardano_cache_lookups_total. */
+static void CountUTxOLookup(bool bHit)
+{
+    static FCardanoCounter& Hits = FCardanoMetrics::Get().Counter(TEXT("cardano_cache_lookups_total"), TEXT("Cache lookups by cache and result."),
+        FCardanoMetrics::MakeLabels(TEXT("cache"), TEXT("utxo"), TEXT("result"), TEXT("hit")));
+    static FCardanoCounter& Misses = FCardanoMetrics::Get().Counter(TEXT("cardano_cache_lookups_total"), TEXT("Cache lookups by cache and result."),
+        FCardanoMetrics::MakeLabels(TEXT("cache"), TEXT("utxo"), TEXT("result"), TEXT("miss")));
+    (bHit ? Hits : Misses).Add();
+}
+
+static FCardanoUTxORef MakeUTxOKey(const FString& TxHash, int32 TxIndex)
+{
+    FCardanoUTxORef Key;
+    FCardanoHash32::FromHex(TxHash, Key.TxHash);
+    Key.TxIndex = static_cast<uint32>(TxIndex);
+    return Key;
+}
+
+void UCardanoUTxOCache::FAddressState::AddUTxO(const FCardanoUTxORef& Key, const FUTxO& UTxO)
+{
+    if (FUTxO* Existing = UTxOs.Find(Key))
+    {
+        Totals.Remove(*Existing);
+        *Existing = UTxO;
+    }
+    else
+    {
+        UTxOs.Add(Key, UTxO);
+    }
+    Totals.Add(UTxO);
+}
+
+bool UCardanoUTxOCache::FAddressState::RemoveUTxO(const FCardanoUTxORef& Key, FUTxO* OutRemoved)
+{
+    FUTxO Removed;
+    if (!UTxOs.RemoveAndCopyValue(Key, Removed))
+    {
+        return false;
+    }
+
+    Totals.Remove(Removed);
+    if (OutRemoved)
+    {
+        *OutRemoved = MoveTemp(Removed);
+    }
+    return true;
+}
+
+void UCardanoUTxOCache::FAddressState::SetUTxOs(const TMap<FCardanoUTxORef, FUTxO>& InUTxOs)
+{
+    UTxOs = InUTxOs;
+    Totals.Reset();
+    for (const TPair<FCardanoUTxORef, FUTxO>& Entry : UTxOs)
+    {
+        Totals.Add(Entry.Value);
+    }
+}
+
+static FString MakeAddressTxsBody(const TArray<FString>& Addresses, int64 AfterBlockHeight)
+{
+    FString RequestBody;
+    RequestBody.Reserve(UCardanoKoiosClient::EstimateStringListBodyLength(Addresses, 64));
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBody);
+
+    Writer->WriteObjectStart();
+    Writer->WriteArrayStart(TEXT("_addresses"));
+    for (const FString& Address : Addresses)
+    {
+        Writer->WriteValue(Address);
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteValue(TEXT("_after_block_height"), AfterBlockHeight);
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return RequestBody;
+}
+
+static FString MakeTxInfoBody(const TArray<FString>& TxHashes)
+{
+    FString RequestBody;
+    RequestBody.Reserve(UCardanoKoiosClient::EstimateStringListBodyLength(TxHashes, 48));
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestBody);
+
+    Writer->WriteObjectStart();
+    Writer->WriteArrayStart(TEXT("_tx_hashes"));
+    for (const FString& TxHash : TxHashes)
+    {
+        Writer->WriteValue(TxHash);
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteValue(TEXT("_inputs"), true);
+    Writer->WriteValue(TEXT("_assets"), true);
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return RequestBody;
+}
+
+/** Deserializes a Koios array response, returning an error message on failure. */
+static FString ReadJsonArray(const FHttpResponsePtr& Response, bool Success, TArray<TSharedPtr<FJsonValue>>& OutArray)
+{
+    if (!Success || !Response.IsValid())
+    {
+        return TEXT("Network request failed");
+    }
+    if (Response->GetResponseCode() != 200)
+    {
+        return FString::Printf(TEXT("Koios returned HTTP %d"), Response->GetResponseCode());
+    }
+    if (!ParseJsonArray(Response, OutArray))
+    {
+        return TEXT("Invalid response format");
+    }
+    return TEXT("");
+}
+
+/** Reads the bech32 payment address of a tx_info input or output row. */
+static bool GetPaymentAddress(const FJsonObject& Row, FString& OutAddress)
+{
+    const TSharedPtr<FJsonObject>* PaymentAddr = nullptr;
+    return Row.TryGetObjectField("payment_addr", PaymentAddr) && PaymentAddr
+        && (*PaymentAddr)->TryGetStringField("bech32", OutAddress);
+}
+
+void UCardanoUTxOCache::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Collection.InitializeDependency(UCardanoKoiosClient::StaticClass());
+
+    MetricsHandle = FCardanoMetrics::Get().OnCollect().AddUObject(this, &UCardanoUTxOCache::CollectMetrics);
+
+    if (bPersistSnapshot)
+    {
+        LoadSnapshot(GetSnapshotFilePath());
+    }
+
+    if (!SharedMemoryName.IsEmpty())
+    {
+        SharedCache = FCardanoSharedCache::Open(SharedMemoryName, static_cast<int64>(FMath::Max(SharedMemoryMegabytes, 1)) * 1024 * 1024, SharedWriterTimeoutSeconds);
+        if (SharedCache.IsValid())
+        {
+            TickSharedCache(0.0f);
+            SharedTickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UCardanoUTxOCache::TickSharedCache), 1.0f);
+        }
+    }
+}
+
+void UCardanoUTxOCache::Deinitialize()
+{
+    FCardanoMetrics::Get().OnCollect().Remove(MetricsHandle);
+    FTicker::GetCoreTicker().RemoveTicker(SharedTickHandle);
+
+    if (PendingSnapshotSave.IsValid())
+    {
+        PendingSnapshotSave.Wait();
+    }
+
+    if (bPersistSnapshot && bSnapshotDirty && !IsSharedReader() && !SaveSnapshot(GetSnapshotFilePath()))
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Failed to persist the UTxO cache snapshot"));
+    }
+
+    SharedCache.Reset();
+
+    Super::Deinitialize();
+}
+
+UCardanoUTxOCache* UCardanoUTxOCache::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoUTxOCache>() : nullptr;
+}
+
+/*
+ * Snapshot layout, little-endian:
+ *   header:  char[8] magic, uint32 version, uint32 address count, int64 tip height, uint32 CRC32 of the
+ *            payload, uint32 reserved
+ *   address: uint16 length, UTF-8 bech32, int64 last block height, uint32 UTxO count, UTxOs
+ *   UTxO:    uint8[32] tx hash, uint32 tx index, int64 lovelace, uint16 token count, tokens
+ *   token:   uint8[28] policy id, uint8 name length, name bytes, uint64 quantity
+ * Hashes and names are stored as bytes rather than hex, which halves the file and the pages to map.
+ */
+static const uint8 SNAPSHOT_MAGIC[8] = { 'C', 'U', 'T', 'X', 'O', 'S', 'N', 'P' };
+static const uint32 SNAPSHOT_VERSION = 1;
+static const int32 SNAPSHOT_HEADER_SIZE = 32;
+static const int32 TX_HASH_SIZE = 32;
+static const int32 POLICY_ID_SIZE = 28;
+static const int32 MAX_ASSET_NAME_SIZE = 32;
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "The UTxO snapshot is read and written in host byte order");
+
+template <typename T>
+static void AppendPod(TArray<uint8>& Out, T Value)
+{
+    Out.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+}
+
+/** Appends the bytes of a hex string, which must decode to Size bytes, or to at most MaxSize when Size is 0. */
+static bool AppendHex(TArray<uint8>& Out, const FString& Hex, int32 Size, int32 MaxSize = 0)
+{
+    const int32 ByteCount = Hex.Len() / 2;
+    if (Hex.Len() % 2 != 0 || (Size > 0 ? ByteCount != Size : ByteCount > MaxSize))
+    {
+        return false;
+    }
+
+    for (const TCHAR Char : Hex)
+    {
+        if (!FChar::IsHexDigit(Char))
+        {
+            return false;
+        }
+    }
+
+    const int32 Offset = Out.AddUninitialized(ByteCount);
+    HexToBytes(Hex, Out.GetData() + Offset);
+    return true;
+}
+
+/** Appends one address record, or nothing if a value does not fit the format; the address is then downloaded again. */
+static bool AppendAddress(TArray<uint8>& Out, const FString& Address, int64 LastBlockHeight, const TMap<FCardanoUTxORef, FUTxO>& UTxOs)
+{
+    const int32 Start = Out.Num();
+    const FTCHARToUTF8 AddressUtf8(*Address);
+
+    bool bFits = AddressUtf8.Length() <= MAX_uint16;
+    if (bFits)
+    {
+        AppendPod<uint16>(Out, static_cast<uint16>(AddressUtf8.Length()));
+        Out.Append(reinterpret_cast<const uint8*>(AddressUtf8.Get()), AddressUtf8.Length());
+        AppendPod<int64>(Out, LastBlockHeight);
+        AppendPod<uint32>(Out, static_cast<uint32>(UTxOs.Num()));
+    }
+
+    for (auto It = UTxOs.CreateConstIterator(); bFits && It; ++It)
+    {
+        const FUTxO& UTxO = It.Value();
+        bFits = UTxO.Assets.Num() <= MAX_uint16;
+        if (!bFits)
+        {
+            break;
+        }
+
+        Out.Append(It.Key().TxHash.Bytes, FCardanoHash32::Size);
+        AppendPod<uint32>(Out, It.Key().TxIndex);
+        AppendPod<int64>(Out, UTxO.Value);
+        AppendPod<uint16>(Out, static_cast<uint16>(UTxO.Assets.Num()));
+
+        for (int32 i = 0; bFits && i < UTxO.Assets.Num(); i++)
+        {
+            const FTokenBalance& Asset = UTxO.Assets[i];
+            const uint64 Quantity = FCString::Strtoui64(*Asset.Quantity, nullptr, 10);
+
+            bFits = AppendHex(Out, Asset.PolicyId, POLICY_ID_SIZE);
+            if (bFits)
+            {
+                AppendPod<uint8>(Out, static_cast<uint8>(Asset.AssetName.Len() / 2));
+                bFits = AppendHex(Out, Asset.AssetName, 0, MAX_ASSET_NAME_SIZE)
+                    && FString::Printf(TEXT("%llu"), Quantity) == Asset.Quantity;
+                AppendPod<uint64>(Out, Quantity);
+            }
+        }
+    }
+
+    if (!bFits)
+    {
+        Out.SetNum(Start, false);
+    }
+    return bFits;
+}
+
+/** Bounds-checked cursor over a snapshot; any read past the end clears bValid and returns zeroes. */
+struct FSnapshotReader
+{
+    const uint8* Data = nullptr;
+    int64 Size = 0;
+    int64 Offset = 0;
+    bool bValid = true;
+
+    const uint8* ReadBytes(int64 Count)
+    {
+        if (!bValid || Count > Size - Offset)
+        {
+            bValid = false;
+            return nullptr;
+        }
+
+        const uint8* Bytes = Data + Offset;
+        Offset += Count;
+        return Bytes;
+    }
+
+    template <typename T>
+    T Read()
+    {
+        T Value = T();
+        if (const uint8* Bytes = ReadBytes(sizeof(T)))
+        {
+            FMemory::Memcpy(&Value, Bytes, sizeof(T));
+        }
+        return Value;
+    }
+
+    FString ReadHex(int32 Count)
+    {
+        const uint8* Bytes = ReadBytes(Count);
+        return Bytes ? BytesToHex(Bytes, Count).ToLower() : FString();
+    }
+};
+
+static bool WriteSnapshotFile(const FString& FilePath, const TArray<uint8>& Bytes)
+{
+    // Written beside the target and moved over it, so a crash mid-write leaves the previous snapshot intact
+    const FString TempPath = FilePath + TEXT(".tmp");
+    return FFileHelper::SaveArrayToFile(Bytes, *TempPath) && IFileManager::Get().Move(*FilePath, *TempPath, true);
+}
+
+void UCardanoUTxOCache::WatchAddress(const FString& Address)
+{
+    if (!Watched.Contains(Address))
+    {
+        Watched.Add(Address);
+        ++WatchRevision;
+        WatchChanged.Broadcast(Address, true);
+
+        if (IsSharedReader())
+        {
+            SharedCache->Request(Address);
+        }
+    }
+}
+
+void UCardanoUTxOCache::UnwatchAddress(const FString& Address)
+{
+    if (Watched.Remove(Address) > 0)
+    {
+        bSnapshotDirty = true;
+        bSharedDirty = true;
+        ++WatchRevision;
+        WatchChanged.Broadcast(Address, false);
+    }
+}
+
+TArray<FString> UCardanoUTxOCache::GetWatchedAddresses() const
+{
+    TArray<FString> Addresses;
+    Watched.GetKeys(Addresses);
+    return Addresses;
+}
+
+int64 UCardanoUTxOCache::GetSyncedHeight(const FAddressState& State) const
+{
+    return bFollowing && State.bFollowed ? FMath::Max(State.LastBlockHeight, FollowHeight) : State.LastBlockHeight;
+}
+
+void UCardanoUTxOCache::InvalidateAddress(const FString& Address)
+{
+    if (FAddressState* State = Watched.Find(Address))
+    {
+        *State = FAddressState();
+        bSnapshotDirty = true;
+        bSharedDirty = true;
+    }
+}
+
+void UCardanoUTxOCache::RefreshAll(const FOnUTxOCacheRefreshed& OnComplete)
+{
+    PendingCallbacks.Add(OnComplete);
+    if (bRefreshInProgress)
+    {
+        return;
+    }
+
+    // The writer polls Koios for every process of the host
+    if (IsSharedReader())
+    {
+        AdoptSharedSnapshot(false);
+        FinishRefresh(true, TEXT(""));
+        return;
+    }
+
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    if (!Koios)
+    {
+        FinishRefresh(false, TEXT("Koios client is not available"));
+        return;
+    }
+
+    bRefreshInProgress = true;
+    TSharedRef<FRefreshState> Refresh = MakeShared<FRefreshState>();
+
+    // The tip is read before anything else, so transactions landing mid-refresh are picked up next time
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Koios->CreateRequest(TEXT("GET"), TEXT("tip"));
+    TWeakObjectPtr<UCardanoUTxOCache> WeakThis(this);
+    HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Refresh](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> JsonArray;
+            FString Error = ReadJsonArray(Response, Success, JsonArray);
+
+            int64 BlockHeight = 0;
+            TSharedPtr<FJsonObject> TipObject = JsonArray.Num() > 0 ? JsonArray[0]->AsObject() : nullptr;
+            if (Error.IsEmpty() && (!TipObject.IsValid() || !TipObject->TryGetNumberField("block_no", BlockHeight)))
+            {
+                Error = TEXT("Missing block_no in tip response");
+            }
+
+            if (!Error.IsEmpty())
+            {
+                WeakThis->FinishRefresh(false, Error);
+                return;
+            }
+
+            WeakThis->OnTipFetched(Refresh, BlockHeight);
+        });
+
+    Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+}
+
+void UCardanoUTxOCache::OnTipFetched(TSharedRef<FRefreshState> Refresh, int64 BlockHeight)
+{
+    Refresh->TipHeight = BlockHeight;
+    Refresh->MaxSeenHeight = BlockHeight;
+
+    TArray<FString> NewAddresses;
+    TMap<int64, TArray<FString>> AddressesByHeight;
+    for (const TPair<FString, FAddressState>& Entry : Watched)
+    {
+        if (!Entry.Value.bInitialized)
+        {
+            NewAddresses.Add(Entry.Key);
+        }
+        else if (!Entry.Value.bFollowed && Entry.Value.LastBlockHeight < BlockHeight)
+        {
+            AddressesByHeight.FindOrAdd(Entry.Value.LastBlockHeight).Add(Entry.Key);
+            Refresh->DeltaAddresses.Add(Entry.Key);
+        }
+    }
+
+    // Guards against completing while requests are still being issued
+    ++Refresh->PendingSteps;
+
+    FetchSnapshots(Refresh, NewAddresses);
+    for (const TPair<int64, TArray<FString>>& Group : AddressesByHeight)
+    {
+        FetchTransactions(Refresh, Group.Value, Group.Key);
+    }
+
+    CompleteStep(Refresh);
+}
+
+void UCardanoUTxOCache::FetchSnapshots(TSharedRef<FRefreshState> Refresh, const TArray<FString>& Addresses)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    TWeakObjectPtr<UCardanoUTxOCache> WeakThis(this);
+
+    for (const TArray<FString>& Chunk : ChunkAddresses(Addresses, Koios->GetMaxAddressesPerRequest()))
+    {
+        // Addresses without UTxOs still get an (empty) snapshot
+        for (const FString& Address : Chunk)
+        {
+            Refresh->Snapshots.Add(Address);
+        }
+
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
+            Koios->CreateJsonPost(TEXT("address_utxos"), UCardanoKoiosClient::MakeAddressesBody(Chunk, true));
+
+        ++Refresh->PendingSteps;
+        HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Refresh](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+            {
+                if (!WeakThis.IsValid())
+                {
+                    return;
+                }
+
+                TArray<TSharedPtr<FJsonValue>> JsonArray;
+                const FString Error = ReadJsonArray(Response, Success, JsonArray);
+                if (!Error.IsEmpty() && Refresh->FirstError.IsEmpty())
+                {
+                    Refresh->FirstError = Error;
+                }
+
+                for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+                {
+                    TSharedPtr<FJsonObject> UtxoObject = Item->AsObject();
+                    FString Address;
+                    FUTxO UTxO;
+                    if (UtxoObject.IsValid() && UtxoObject->TryGetStringField("address", Address) && ParseUTxO(*UtxoObject, UTxO))
+                    {
+                        Refresh->Snapshots.FindOrAdd(Address).Add(MakeUTxOKey(UTxO.TxHash, UTxO.TxIndex), UTxO);
+                    }
+                }
+
+                WeakThis->CompleteStep(Refresh);
+            });
+
+        Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::Balance);
+    }
+}
+
+void UCardanoUTxOCache::FetchTransactions(TSharedRef<FRefreshState> Refresh, const TArray<FString>& Addresses, int64 AfterBlockHeight)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    TWeakObjectPtr<UCardanoUTxOCache> WeakThis(this);
+
+    for (const TArray<FString>& Chunk : ChunkAddresses(Addresses, Koios->GetMaxAddressesPerRequest()))
+    {
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
+            Koios->CreateJsonPost(TEXT("address_txs"), MakeAddressTxsBody(Chunk, AfterBlockHeight));
+
+        ++Refresh->PendingSteps;
+        HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Refresh](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+            {
+                if (!WeakThis.IsValid())
+                {
+                    return;
+                }
+
+                TArray<TSharedPtr<FJsonValue>> JsonArray;
+                const FString Error = ReadJsonArray(Response, Success, JsonArray);
+                if (!Error.IsEmpty() && Refresh->FirstError.IsEmpty())
+                {
+                    Refresh->FirstError = Error;
+                }
+
+                // A transaction touching several watched addresses is only fetched once
+                TArray<FString> NewTxHashes;
+                for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+                {
+                    TSharedPtr<FJsonObject> TxObject = Item->AsObject();
+                    FString TxHash;
+                    if (!TxObject.IsValid() || !TxObject->TryGetStringField("tx_hash", TxHash))
+                    {
+                        continue;
+                    }
+
+                    int64 BlockHeight = 0;
+                    if (TxObject->TryGetNumberField("block_height", BlockHeight))
+                    {
+                        Refresh->MaxSeenHeight = FMath::Max(Refresh->MaxSeenHeight, BlockHeight);
+                    }
+
+                    bool bAlreadySeen = false;
+                    Refresh->SeenTxHashes.Add(TxHash, &bAlreadySeen);
+                    if (!bAlreadySeen)
+                    {
+                        NewTxHashes.Add(TxHash);
+                    }
+                }
+
+                if (Refresh->FirstError.IsEmpty() && NewTxHashes.Num() > 0)
+                {
+                    WeakThis->FetchTxUTxOs(Refresh, NewTxHashes);
+                }
+
+                WeakThis->CompleteStep(Refresh);
+            });
+
+        Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::History);
+    }
+}
+
+void UCardanoUTxOCache::FetchTxUTxOs(TSharedRef<FRefreshState> Refresh, const TArray<FString>& TxHashes)
+{
+    UCardanoKoiosClient* Koios = UCardanoKoiosClient::Get();
+    TWeakObjectPtr<UCardanoUTxOCache> WeakThis(this);
+
+    for (const TArray<FString>& Chunk : ChunkAddresses(TxHashes, Koios->GetMaxAddressesPerRequest()))
+    {
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest =
+            Koios->CreateJsonPost(TEXT("tx_info"), MakeTxInfoBody(Chunk));
+
+        ++Refresh->PendingSteps;
+        HttpRequest->OnProcessRequestComplete().BindLambda([WeakThis, Refresh](FHttpRequestPtr Request, FHttpResponsePtr Response, bool Success)
+            {
+                if (!WeakThis.IsValid())
+                {
+                    return;
+                }
+
+                TArray<TSharedPtr<FJsonValue>> JsonArray;
+                const FString Error = ReadJsonArray(Response, Success, JsonArray);
+                if (!Error.IsEmpty() && Refresh->FirstError.IsEmpty())
+                {
+                    Refresh->FirstError = Error;
+                }
+
+                for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+                {
+                    TSharedPtr<FJsonObject> TxObject = Item->AsObject();
+                    if (!TxObject.IsValid())
+                    {
+                        continue;
+                    }
+
+                    // Inputs are recorded by key only; an output spent later in the same pass cancels out
+                    const TArray<TSharedPtr<FJsonValue>>* Inputs = nullptr;
+                    if (TxObject->TryGetArrayField("inputs", Inputs) && Inputs)
+                    {
+                        for (const TSharedPtr<FJsonValue>& InputValue : *Inputs)
+                        {
+                            TSharedPtr<FJsonObject> InputObject = InputValue->AsObject();
+                            FString TxHash;
+                            int64 TxIndex = 0;
+                            if (InputObject.IsValid() && InputObject->TryGetStringField("tx_hash", TxHash) && InputObject->TryGetNumberField("tx_index", TxIndex))
+                            {
+                                Refresh->SpentKeys.Add(MakeUTxOKey(TxHash, static_cast<int32>(TxIndex)));
+                            }
+                        }
+                    }
+
+                    const TArray<TSharedPtr<FJsonValue>>* Outputs = nullptr;
+                    if (TxObject->TryGetArrayField("outputs", Outputs) && Outputs)
+                    {
+                        for (const TSharedPtr<FJsonValue>& OutputValue : *Outputs)
+                        {
+                            TSharedPtr<FJsonObject> OutputObject = OutputValue->AsObject();
+                            FString Address;
+                            FUTxO UTxO;
+                            if (OutputObject.IsValid() && GetPaymentAddress(*OutputObject, Address)
+                                && Refresh->DeltaAddresses.Contains(Address) && ParseUTxO(*OutputObject, UTxO))
+                            {
+                                Refresh->CreatedOutputs.Emplace(Address, UTxO);
+                            }
+                        }
+                    }
+                }
+
+                WeakThis->CompleteStep(Refresh);
+            });
+
+        Koios->ProcessRequest(HttpRequest, ECardanoRequestPriority::History);
+    }
+}
+
+void UCardanoUTxOCache::ApplyDeltas(const FRefreshState& Refresh)
+{
+    const int64 NewHeight = FMath::Max(Refresh.TipHeight, Refresh.MaxSeenHeight);
+    TSet<FString> Changed;
+
+    for (const TPair<FString, TMap<FCardanoUTxORef, FUTxO>>& Snapshot : Refresh.Snapshots)
+    {
+        // Skip addresses unwatched while the refresh was running
+        if (FAddressState* State = Watched.Find(Snapshot.Key))
+        {
+            Changed.Add(Snapshot.Key);
+            State->SetUTxOs(Snapshot.Value);
+            State->LastBlockHeight = Refresh.TipHeight;
+            State->bInitialized = true;
+            State->bFollowed = bFollowing && Refresh.TipHeight >= FollowHeight;
+        }
+    }
+
+    // Created outputs are added first and spent ones removed afterwards, so the result does not
+    // depend on the order Koios returned the transactions in; re-applied deltas are no-ops
+    for (const TPair<FString, FUTxO>& Created : Refresh.CreatedOutputs)
+    {
+        FAddressState* State = Watched.Find(Created.Key);
+        if (State && State->bInitialized && !State->bFollowed && Refresh.DeltaAddresses.Contains(Created.Key))
+        {
+            State->AddUTxO(MakeUTxOKey(Created.Value.TxHash, Created.Value.TxIndex), Created.Value);
+            Changed.Add(Created.Key);
+        }
+    }
+
+    for (const FString& Address : Refresh.DeltaAddresses)
+    {
+        FAddressState* State = Watched.Find(Address);
+        if (!State || !State->bInitialized || State->bFollowed)
+        {
+            continue;
+        }
+
+        for (const FCardanoUTxORef& SpentKey : Refresh.SpentKeys)
+        {
+            if (State->RemoveUTxO(SpentKey))
+            {
+                Changed.Add(Address);
+            }
+        }
+        State->LastBlockHeight = NewHeight;
+
+        // Blocks the follower already went through are covered; an address still short of them is polled again
+        State->bFollowed = bFollowing && NewHeight >= FollowHeight;
+    }
+
+    TipBlockHeight = NewHeight;
+    bSnapshotDirty = true;
+    bSharedDirty = true;
+    DropConfirmedPending(Refresh);
+
+    if (Changed.Num() > 0)
+    {
+        UTxOsChanged.Broadcast(Changed);
+    }
+}
+
+void UCardanoUTxOCache::DropConfirmedPending(const FRefreshState& Refresh)
+{
+    for (auto It = PendingTransactions.CreateIterator(); It; ++It)
+    {
+        // A snapshot does not name the transactions it covers, so its outputs showing up counts too
+        bool bOnChain = Refresh.SeenTxHashes.Contains(It.Key());
+        for (int32 i = 0; !bOnChain && i < It.Value().Outputs.Num(); i++)
+        {
+            const TPair<FString, FUTxO>& Output = It.Value().Outputs[i];
+            const FAddressState* State = Watched.Find(Output.Key);
+            bOnChain = State && State->UTxOs.Contains(MakeUTxOKey(Output.Value.TxHash, Output.Value.TxIndex));
+        }
+
+        if (bOnChain)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void UCardanoUTxOCache::CompleteStep(TSharedRef<FRefreshState> Refresh)
+{
+    if (--Refresh->PendingSteps > 0)
+    {
+        return;
+    }
+
+    if (!Refresh->FirstError.IsEmpty())
+    {
+        FinishRefresh(false, Refresh->FirstError);
+        return;
+    }
+
+    ApplyDeltas(*Refresh);
+    FinishRefresh(true, TEXT(""));
+}
+
+void UCardanoUTxOCache::FinishRefresh(bool bSuccess, const FString& ErrorMessage)
+{
+    bRefreshInProgress = false;
+
+    if (bSuccess && bPersistSnapshot && bSnapshotDirty && !IsSharedReader())
+    {
+        ScheduleSnapshotSave();
+    }
+
+    if (bSuccess && bSharedDirty)
+    {
+        PublishSharedSnapshot();
+    }
+
+    TArray<FOnUTxOCacheRefreshed> Callbacks = MoveTemp(PendingCallbacks);
+    PendingCallbacks.Reset();
+    for (const FOnUTxOCacheRefreshed& Callback : Callbacks)
+    {
+        Callback.ExecuteIfBound(bSuccess, ErrorMessage);
+    }
+}
+
+void UCardanoUTxOCache::CollectMetrics()
+{
+    static FCardanoGauge& Entries = FCardanoMetrics::Get().Gauge(TEXT("cardano_cache_entries"), TEXT("Entries held by each cache."),
+        FCardanoMetrics::MakeLabels(TEXT("cache"), TEXT("utxo")));
+    static FCardanoGauge& Memory = FCardanoMetrics::Get().Gauge(TEXT("cardano_cache_memory_bytes"), TEXT("Heap held by each cache, estimated from its containers."),
+        FCardanoMetrics::MakeLabels(TEXT("cache"), TEXT("utxo")));
+
+    int64 NumUTxOs = 0;
+    int64 Bytes = Watched.GetAllocatedSize() + PendingTransactions.GetAllocatedSize();
+    for (const TPair<FString, FAddressState>& Entry : Watched)
+    {
+        NumUTxOs += Entry.Value.UTxOs.Num();
+        Bytes += Entry.Key.GetAllocatedSize() + Entry.Value.UTxOs.GetAllocatedSize() + Entry.Value.Totals.GetAllocatedSize();
+        for (const TPair<FCardanoUTxORef, FUTxO>& UTxO : Entry.Value.UTxOs)
+        {
+            Bytes += UTxO.Value.TxHash.GetAllocatedSize() + UTxO.Value.Assets.GetAllocatedSize();
+            for (const FTokenBalance& Asset : UTxO.Value.Assets)
+            {
+                Bytes += Asset.PolicyId.GetAllocatedSize() + Asset.AssetName.GetAllocatedSize() + Asset.Quantity.GetAllocatedSize();
+            }
+        }
+    }
+
+    Entries.Set(NumUTxOs);
+    Memory.Set(Bytes);
+}
+
+bool UCardanoUTxOCache::GetCachedUTxOs(const FString& Address, TArray<FUTxO>& OutUTxOs) const
+{
+    OutUTxOs.Reset();
+
+    const FAddressState* State = Watched.Find(Address);
+    if (!State || !State->bInitialized)
+    {
+        INC_DWORD_STAT(STAT_CardanoUTxOCacheMisses);
+        CountUTxOLookup(false);
+        return false;
+    }
+
+    INC_DWORD_STAT(STAT_CardanoUTxOCacheHits);
+    CountUTxOLookup(true);
+    State->UTxOs.GenerateValueArray(OutUTxOs);
+    return true;
+}
+
+bool UCardanoUTxOCache::GetCachedBalance(const FString& Address, FAddressBalance& OutBalance) const
+{
+    OutBalance = FAddressBalance();
+
+    const FAddressState* State = Watched.Find(Address);
+    if (!State || !State->bInitialized)
+    {
+        INC_DWORD_STAT(STAT_CardanoUTxOCacheMisses);
+        CountUTxOLookup(false);
+        return false;
+    }
+
+    INC_DWORD_STAT(STAT_CardanoUTxOCacheHits);
+    CountUTxOLookup(true);
+
+    State->Totals.ToBalance(OutBalance);
+    return true;
+}
+
+bool UCardanoUTxOCache::AddPendingTransaction(const TArray<uint8>& TransactionBytes, FString& OutTxHash)
+{
+    FPendingTransaction Transaction;
+    if (!decode_transaction_utxos(TransactionBytes, OutTxHash, Transaction.SpentKeys, Transaction.Outputs))
+    {
+        return false;
+    }
+
+    PendingTransactions.Add(OutTxHash, MoveTemp(Transaction));
+    return true;
+}
+
+TArray<FString> UCardanoUTxOCache::RejectPendingTransaction(const FString& TxHash)
+{
+    TArray<FString> Dropped;
+    TArray<FString> ToDrop = { TxHash.ToLower() };
+
+    while (ToDrop.Num() > 0)
+    {
+        const FString Hash = ToDrop.Pop(false);
+        if (PendingTransactions.Remove(Hash) == 0)
+        {
+            continue;
+        }
+        Dropped.Add(Hash);
+
+        FCardanoHash32 HashBytes;
+        if (!FCardanoHash32::FromHex(Hash, HashBytes))
+        {
+            continue;
+        }
+
+        // Whatever spends the dropped outputs can never be valid either
+        for (const TPair<FString, FPendingTransaction>& Other : PendingTransactions)
+        {
+            if (Other.Value.SpentKeys.ContainsByPredicate([&HashBytes](const FCardanoUTxORef& Key) { return Key.TxHash == HashBytes; }))
+            {
+                ToDrop.AddUnique(Other.Key);
+            }
+        }
+    }
+
+    return Dropped;
+}
+
+TArray<FString> UCardanoUTxOCache::GetPendingParents(const FString& TxHash) const
+{
+    TArray<FString> Parents;
+
+    if (const FPendingTransaction* Transaction = PendingTransactions.Find(TxHash))
+    {
+        for (const FCardanoUTxORef& Key : Transaction->SpentKeys)
+        {
+            const FString Parent = Key.TxHash.ToHex();
+            if (PendingTransactions.Contains(Parent))
+            {
+                Parents.AddUnique(Parent);
+            }
+        }
+    }
+
+    return Parents;
+}
+
+void UCardanoUTxOCache::SetMempoolSpends(TMap<FCardanoUTxORef, FString> Spends)
+{
+    TSet<FCardanoUTxORef> ChangedKeys;
+    for (const TPair<FCardanoUTxORef, FString>& Spend : Spends)
+    {
+        if (!MempoolSpends.Contains(Spend.Key))
+        {
+            ChangedKeys.Add(Spend.Key);
+        }
+    }
+    for (const TPair<FCardanoUTxORef, FString>& Spend : MempoolSpends)
+    {
+        if (!Spends.Contains(Spend.Key))
+        {
+            ChangedKeys.Add(Spend.Key);
+        }
+    }
+
+    MempoolSpends = MoveTemp(Spends);
+    if (ChangedKeys.Num() == 0)
+    {
+        return;
+    }
+
+    // Outputs our own pending transactions spend were not spendable either way
+    TSet<FString> ChangedAddresses;
+    for (const FCardanoUTxORef& Key : ChangedKeys)
+    {
+        FString Address;
+        if (FindSpendableUTxOAddress(Key, Address))
+        {
+            ChangedAddresses.Add(Address);
+        }
+    }
+
+    if (ChangedAddresses.Num() > 0)
+    {
+        UTxOsChanged.Broadcast(ChangedAddresses);
+    }
+}
+
+bool UCardanoUTxOCache::IsSpentInMempool(const FString& TxHash, int32 TxIndex) const
+{
+    return MempoolSpends.Contains(MakeUTxOKey(TxHash, TxIndex));
+}
+
+bool UCardanoUTxOCache::GetSpendableUTxOs(const FString& Address, TArray<FUTxO>& OutUTxOs) const
+{
+    if (!GetCachedUTxOs(Address, OutUTxOs))
+    {
+        return false;
+    }
+
+    TSet<FCardanoUTxORef> SpentKeys;
+    MempoolSpends.GetKeys(SpentKeys);
+    for (const TPair<FString, FPendingTransaction>& Transaction : PendingTransactions)
+    {
+        SpentKeys.Append(Transaction.Value.SpentKeys);
+    }
+
+    OutUTxOs.RemoveAll([&SpentKeys](const FUTxO& UTxO) { return SpentKeys.Contains(MakeUTxOKey(UTxO.TxHash, UTxO.TxIndex)); });
+
+    for (const TPair<FString, FPendingTransaction>& Transaction : PendingTransactions)
+    {
+        for (const TPair<FString, FUTxO>& Output : Transaction.Value.Outputs)
+        {
+            if (Output.Key == Address && !SpentKeys.Contains(MakeUTxOKey(Output.Value.TxHash, Output.Value.TxIndex)))
+            {
+                OutUTxOs.Add(Output.Value);
+            }
+        }
+    }
+
+    return true;
+}
+
+const FCardanoBalanceTotals* UCardanoUTxOCache::FindCachedTotals(const FString& Address) const
+{
+    const FAddressState* State = Watched.Find(Address);
+    if (!State || !State->bInitialized)
+    {
+        INC_DWORD_STAT(STAT_CardanoUTxOCacheMisses);
+        CountUTxOLookup(false);
+        return nullptr;
+    }
+
+    INC_DWORD_STAT(STAT_CardanoUTxOCacheHits);
+    CountUTxOLookup(true);
+    return &State->Totals;
+}
+
+bool UCardanoUTxOCache::FindSpendableUTxOAddress(const FCardanoUTxORef& Ref, FString& OutAddress) const
+{
+    for (const TPair<FString, FPendingTransaction>& Transaction : PendingTransactions)
+    {
+        if (Transaction.Value.SpentKeys.Contains(Ref))
+        {
+            return false;
+        }
+    }
+
+    for (const TPair<FString, FPendingTransaction>& Transaction : PendingTransactions)
+    {
+        for (const TPair<FString, FUTxO>& Output : Transaction.Value.Outputs)
+        {
+            if (MakeUTxOKey(Output.Value.TxHash, Output.Value.TxIndex) == Ref)
+            {
+                OutAddress = Output.Key;
+                return true;
+            }
+        }
+    }
+
+    // A keyed lookup per address, without copying any UTxO set
+    for (const TPair<FString, FAddressState>& Entry : Watched)
+    {
+        if (Entry.Value.bInitialized && Entry.Value.UTxOs.Contains(Ref))
+        {
+            OutAddress = Entry.Key;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+FString UCardanoUTxOCache::GetSnapshotFilePath() const
+{
+    return FPaths::ProjectSavedDir() / TEXT("Cardano") / TEXT("UTxOCache.snapshot");
+}
+
+TArray<uint8> UCardanoUTxOCache::SerializeSnapshot() const
+{
+    TArray<uint8> Bytes;
+    Bytes.AddZeroed(SNAPSHOT_HEADER_SIZE);
+
+    uint32 AddressCount = 0;
+    for (const TPair<FString, FAddressState>& Entry : Watched)
+    {
+        if (Entry.Value.bInitialized && AppendAddress(Bytes, Entry.Key, GetSyncedHeight(Entry.Value), Entry.Value.UTxOs))
+        {
+            ++AddressCount;
+        }
+    }
+
+    TArray<uint8> Header;
+    Header.Append(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    AppendPod<uint32>(Header, SNAPSHOT_VERSION);
+    AppendPod<uint32>(Header, AddressCount);
+    AppendPod<int64>(Header, TipBlockHeight);
+    AppendPod<uint32>(Header, FCrc::MemCrc32(Bytes.GetData() + SNAPSHOT_HEADER_SIZE, Bytes.Num() - SNAPSHOT_HEADER_SIZE));
+    AppendPod<uint32>(Header, 0);
+    FMemory::Memcpy(Bytes.GetData(), Header.GetData(), SNAPSHOT_HEADER_SIZE);
+
+    return Bytes;
+}
+
+bool UCardanoUTxOCache::ParseSnapshot(const uint8* Data, int64 Size, TMap<FString, FAddressState>& OutAddresses, int64& OutTipHeight)
+{
+    FSnapshotReader Reader;
+    Reader.Data = Data;
+    Reader.Size = Size;
+
+    const uint8* Magic = Reader.ReadBytes(sizeof(SNAPSHOT_MAGIC));
+    if (!Magic || FMemory::Memcmp(Magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 || Reader.Read<uint32>() != SNAPSHOT_VERSION)
+    {
+        return false;
+    }
+
+    const uint32 AddressCount = Reader.Read<uint32>();
+    OutTipHeight = Reader.Read<int64>();
+    const uint32 Checksum = Reader.Read<uint32>();
+    Reader.Read<uint32>();
+
+    if (!Reader.bValid || FCrc::MemCrc32(Data + SNAPSHOT_HEADER_SIZE, static_cast<int32>(Size - SNAPSHOT_HEADER_SIZE)) != Checksum)
+    {
+        return false;
+    }
+
+    OutAddresses.Reserve(AddressCount);
+    for (uint32 AddressIndex = 0; AddressIndex < AddressCount && Reader.bValid; AddressIndex++)
+    {
+        const uint16 AddressLength = Reader.Read<uint16>();
+        const uint8* AddressBytes = Reader.ReadBytes(AddressLength);
+        if (!AddressBytes)
+        {
+            break;
+        }
+
+        const FUTF8ToTCHAR Address(reinterpret_cast<const ANSICHAR*>(AddressBytes), AddressLength);
+        FAddressState& State = OutAddresses.Add(FString(Address.Length(), Address.Get()));
+        State.LastBlockHeight = Reader.Read<int64>();
+        State.bInitialized = true;
+
+        const uint32 UTxOCount = Reader.Read<uint32>();
+        // Every UTxO takes at least 46 bytes, so a corrupt count cannot reserve more than the file's worth
+        State.UTxOs.Reserve(static_cast<int32>(FMath::Min<int64>(UTxOCount, (Size - Reader.Offset) / 46)));
+
+        for (uint32 i = 0; i < UTxOCount && Reader.bValid; i++)
+        {
+            FCardanoUTxORef Key;
+            if (const uint8* HashBytes = Reader.ReadBytes(TX_HASH_SIZE))
+            {
+                FMemory::Memcpy(Key.TxHash.Bytes, HashBytes, TX_HASH_SIZE);
+            }
+            Key.TxIndex = Reader.Read<uint32>();
+
+            FUTxO UTxO;
+            UTxO.TxHash = Key.TxHash.ToHex();
+            UTxO.TxIndex = static_cast<int32>(Key.TxIndex);
+            UTxO.Value = Reader.Read<int64>();
+
+            const uint16 AssetCount = Reader.Read<uint16>();
+            for (uint16 j = 0; j < AssetCount && Reader.bValid; j++)
+            {
+                FTokenBalance& Asset = UTxO.Assets.AddDefaulted_GetRef();
+                Asset.PolicyId = Reader.ReadHex(POLICY_ID_SIZE);
+                Asset.AssetName = Reader.ReadHex(Reader.Read<uint8>());
+                Asset.Quantity = FString::Printf(TEXT("%llu"), Reader.Read<uint64>());
+            }
+
+            State.AddUTxO(Key, UTxO);
+        }
+    }
+
+    return Reader.bValid && Reader.Offset == Size;
+}
+
+bool UCardanoUTxOCache::SaveSnapshot(const FString& FilePath) const
+{
+    return WriteSnapshotFile(FilePath, SerializeSnapshot());
+}
+
+bool UCardanoUTxOCache::LoadSnapshot(const FString& FilePath)
+{
+    // Parsed straight from the mapped pages; platforms without memory mapping read the file instead
+    TUniquePtr<IMappedFileHandle> File(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+    TUniquePtr<IMappedFileRegion> Region(File.IsValid() && File->GetFileSize() > 0 ? File->MapRegion(0, File->GetFileSize(), true) : nullptr);
+
+    TArray<uint8> FileBytes;
+    const uint8* Data = nullptr;
+    int64 Size = 0;
+    if (Region.IsValid())
+    {
+        Data = Region->GetMappedPtr();
+        Size = Region->GetMappedSize();
+    }
+    else if (FFileHelper::LoadFileToArray(FileBytes, *FilePath, FILEREAD_Silent))
+    {
+        Data = FileBytes.GetData();
+        Size = FileBytes.Num();
+    }
+    else
+    {
+        return false;
+    }
+
+    TMap<FString, FAddressState> Restored;
+    int64 SnapshotTipHeight = 0;
+    if (Size < SNAPSHOT_HEADER_SIZE || Size > MAX_int32 || !ParseSnapshot(Data, Size, Restored, SnapshotTipHeight))
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Ignoring unreadable UTxO cache snapshot %s"), *FilePath);
+        return false;
+    }
+
+    int32 UTxOCount = 0;
+    TSet<FString> Changed;
+    ++WatchRevision;
+    for (TPair<FString, FAddressState>& Entry : Restored)
+    {
+        if (!Watched.Contains(Entry.Key))
+        {
+            Watched.Add(Entry.Key);
+            WatchChanged.Broadcast(Entry.Key, true);
+        }
+
+        FAddressState& State = Watched[Entry.Key];
+        if (!State.bInitialized)
+        {
+            UTxOCount += Entry.Value.UTxOs.Num();
+            State = MoveTemp(Entry.Value);
+            Changed.Add(Entry.Key);
+        }
+    }
+
+    TipBlockHeight = FMath::Max(TipBlockHeight, SnapshotTipHeight);
+    UE_LOG(LogCardano, Log, TEXT("Restored %d addresses and %d UTxOs at block %lld from the UTxO cache snapshot"),
+        Restored.Num(), UTxOCount, SnapshotTipHeight);
+
+    if (Changed.Num() > 0)
+    {
+        bSharedDirty = true;
+        UTxOsChanged.Broadcast(Changed);
+    }
+    return true;
+}
+
+void UCardanoUTxOCache::ScheduleSnapshotSave()
+{
+    // A slow disk skips a save rather than queueing them; the cache stays dirty and the next refresh saves it
+    if (PendingSnapshotSave.IsValid() && !PendingSnapshotSave.IsReady())
+    {
+        return;
+    }
+
+    bSnapshotDirty = false;
+    PendingSnapshotSave = Async(EAsyncExecution::ThreadPool, [Bytes = SerializeSnapshot(), FilePath = GetSnapshotFilePath()]()
+        {
+            const bool bWritten = WriteSnapshotFile(FilePath, Bytes);
+            if (!bWritten)
+            {
+                UE_LOG(LogCardano, Warning, TEXT("Failed to persist the UTxO cache snapshot"));
+            }
+            return bWritten;
+        });
+}
+
+bool UCardanoUTxOCache::TickSharedCache(float DeltaTime)
+{
+    const bool bWriter = SharedCache->Heartbeat();
+    if (bWriter && !bSharedWriter)
+    {
+        // Taking over from a writer that stopped: keep covering every address it published, not only ours
+        AdoptSharedSnapshot(true);
+    }
+    bSharedWriter = bWriter;
+
+    if (!bWriter)
+    {
+        AdoptSharedSnapshot(false);
+        return true;
+    }
+
+    // Downloaded by the next refresh, then published to the readers that asked
+    for (const FString& Address : SharedCache->TakeRequests())
+    {
+        WatchAddress(Address);
+    }
+
+    if (bSharedDirty)
+    {
+        PublishSharedSnapshot();
+    }
+    return true;
+}
+
+void UCardanoUTxOCache::AdoptSharedSnapshot(bool bAllAddresses)
+{
+    uint64 Version = bAllAddresses ? 0 : SharedVersion;
+    TArray<uint8> Bytes;
+    if (!SharedCache.IsValid() || !SharedCache->Read(Version, Bytes))
+    {
+        return;
+    }
+    SharedVersion = Version;
+
+    TMap<FString, FAddressState> Shared;
+    int64 SharedTipHeight = 0;
+    if (Bytes.Num() < SNAPSHOT_HEADER_SIZE || !ParseSnapshot(Bytes.GetData(), Bytes.Num(), Shared, SharedTipHeight))
+    {
+        UE_LOG(LogCardano, Warning, TEXT("Ignoring unreadable shared UTxO cache snapshot"));
+        return;
+    }
+
+    TSet<FString> Changed;
+    for (TPair<FString, FAddressState>& Entry : Shared)
+    {
+        if (bAllAddresses)
+        {
+            WatchAddress(Entry.Key);
+        }
+
+        // Followed addresses are kept current block by block here already
+        FAddressState* State = Watched.Find(Entry.Key);
+        if (State && !State->bFollowed && (!State->bInitialized || Entry.Value.LastBlockHeight > State->LastBlockHeight))
+        {
+            *State = MoveTemp(Entry.Value);
+            Changed.Add(Entry.Key);
+        }
+    }
+
+    // Requests are not acknowledged: the ones lost to a full queue or a writer change are sent again with the next version
+    if (!bAllAddresses)
+    {
+        for (const TPair<FString, FAddressState>& Entry : Watched)
+        {
+            if (!Shared.Contains(Entry.Key))
+            {
+                SharedCache->Request(Entry.Key);
+            }
+        }
+    }
+
+    TipBlockHeight = FMath::Max(TipBlockHeight, SharedTipHeight);
+    DropConfirmedPending(FRefreshState());
+
+    if (Changed.Num() > 0)
+    {
+        UTxOsChanged.Broadcast(Changed);
+    }
+}
+
+void UCardanoUTxOCache::PublishSharedSnapshot()
+{
+    if (!SharedCache.IsValid() || !SharedCache->IsWriter())
+    {
+        return;
+    }
+
+    const TArray<uint8> Bytes = SerializeSnapshot();
+    if (Bytes.Num() > SharedCache->GetCapacity())
+    {
+        // Not retried until the cache changes again, rather than every tick
+        UE_LOG(LogCardano, Warning, TEXT("The UTxO cache snapshot takes %d bytes, more than SharedMemoryMegabytes holds"), Bytes.Num());
+        bSharedDirty = false;
+        return;
+    }
+
+    if (SharedCache->Publish(Bytes))
+    {
+        bSharedDirty = false;
+    }
+}
+
+void UCardanoUTxOCache::BeginFollowing(int64 BlockHeight, int32 MaxRollbackBlocks)
+{
+    StopFollowing();
+
+    bFollowing = true;
+    FollowHeight = BlockHeight;
+    MaxUndoBlocks = FMath::Max(MaxRollbackBlocks, 0);
+    TipBlockHeight = FMath::Max(TipBlockHeight, BlockHeight);
+
+    for (TPair<FString, FAddressState>& Entry : Watched)
+    {
+        Entry.Value.bFollowed = Entry.Value.bInitialized && Entry.Value.LastBlockHeight >= BlockHeight;
+    }
+}
+
+void UCardanoUTxOCache::StopFollowing()
+{
+    if (!bFollowing)
+    {
+        return;
+    }
+
+    for (TPair<FString, FAddressState>& Entry : Watched)
+    {
+        Entry.Value.LastBlockHeight = GetSyncedHeight(Entry.Value);
+        Entry.Value.bFollowed = false;
+    }
+
+    bFollowing = false;
+    UndoLog.Empty();
+}
+
+void UCardanoUTxOCache::ApplyBlock(const FCardanoBlockDelta& Block)
+{
+    if (!bFollowing || Block.BlockHeight <= FollowHeight)
+    {
+        return;
+    }
+
+    FBlockUndo Undo;
+    Undo.BlockHeight = Block.BlockHeight;
+
+    // An address is updated by the block only if it is followed and was not synced past the block already
+    TSet<FString> Touched;
+    auto FindUpdatable = [this, &Block, &Undo, &Touched](const FString& Address) -> FAddressState*
+    {
+        FAddressState* State = Watched.Find(Address);
+        if (!State || !State->bFollowed)
+        {
+            return nullptr;
+        }
+
+        if (!Touched.Contains(Address))
+        {
+            if (GetSyncedHeight(*State) >= Block.BlockHeight)
+            {
+                return nullptr;
+            }
+
+            Touched.Add(Address);
+            Undo.PreviousHeights.Emplace(Address, State->LastBlockHeight);
+        }
+
+        return State;
+    };
+
+    // Outputs go first, since a transaction may spend an output created earlier in the same block
+    for (const TPair<FString, FUTxO>& Created : Block.CreatedOutputs)
+    {
+        FAddressState* State = FindUpdatable(Created.Key);
+        const FCardanoUTxORef Key = MakeUTxOKey(Created.Value.TxHash, Created.Value.TxIndex);
+        if (State && !State->UTxOs.Contains(Key))
+        {
+            State->AddUTxO(Key, Created.Value);
+            Undo.AddedKeys.Emplace(Created.Key, Key);
+        }
+    }
+
+    for (const TPair<FString, FCardanoUTxORef>& Spent : Block.SpentInputs)
+    {
+        FAddressState* State = FindUpdatable(Spent.Key);
+        FUTxO UTxO;
+        if (State && State->RemoveUTxO(Spent.Value, &UTxO))
+        {
+            Undo.RemovedUTxOs.Emplace(Spent.Key, MoveTemp(UTxO));
+        }
+    }
+
+    for (const TPair<FString, int64>& Previous : Undo.PreviousHeights)
+    {
+        Watched[Previous.Key].LastBlockHeight = Block.BlockHeight;
+    }
+
+    for (const FString& TxHash : Block.TxHashes)
+    {
+        PendingTransactions.Remove(TxHash);
+    }
+
+    FollowHeight = Block.BlockHeight;
+    TipBlockHeight = FMath::Max(TipBlockHeight, FollowHeight);
+    bSnapshotDirty = true;
+    bSharedDirty = true;
+
+    // Most blocks touch no watched UTxO at all, and then nothing is broadcast
+    TSet<FString> Changed;
+    for (const TPair<FString, FCardanoUTxORef>& Added : Undo.AddedKeys)
+    {
+        Changed.Add(Added.Key);
+    }
+    for (const TPair<FString, FUTxO>& Removed : Undo.RemovedUTxOs)
+    {
+        Changed.Add(Removed.Key);
+    }
+
+    UndoLog.Add(MoveTemp(Undo));
+    if (UndoLog.Num() > MaxUndoBlocks)
+    {
+        UndoLog.RemoveAt(0, UndoLog.Num() - MaxUndoBlocks, false);
+    }
+
+    if (Changed.Num() > 0)
+    {
+        UTxOsChanged.Broadcast(Changed);
+    }
+}
+
+void UCardanoUTxOCache::RollBackTo(int64 BlockHeight)
+{
+    if (!bFollowing || BlockHeight >= FollowHeight)
+    {
+        return;
+    }
+
+    TSet<FString> Changed;
+    while (UndoLog.Num() > 0 && UndoLog.Last().BlockHeight > BlockHeight)
+    {
+        const FBlockUndo Undo = UndoLog.Pop(false);
+
+        for (const TPair<FString, FUTxO>& Removed : Undo.RemovedUTxOs)
+        {
+            if (FAddressState* State = Watched.Find(Removed.Key))
+            {
+                State->AddUTxO(MakeUTxOKey(Removed.Value.TxHash, Removed.Value.TxIndex), Removed.Value);
+                Changed.Add(Removed.Key);
+            }
+        }
+
+        for (const TPair<FString, FCardanoUTxORef>& Added : Undo.AddedKeys)
+        {
+            if (FAddressState* State = Watched.Find(Added.Key))
+            {
+                State->RemoveUTxO(Added.Value);
+                Changed.Add(Added.Key);
+            }
+        }
+
+        for (const TPair<FString, int64>& Previous : Undo.PreviousHeights)
+        {
+            if (FAddressState* State = Watched.Find(Previous.Key))
+            {
+                State->LastBlockHeight = Previous.Value;
+            }
+        }
+    }
+
+    FollowHeight = BlockHeight;
+    TipBlockHeight = BlockHeight;
+    bSnapshotDirty = true;
+    bSharedDirty = true;
+
+    // Whatever is still past the rollback point may hold transactions of the abandoned fork; rollbacks are
+    // rare enough for this pass over every address not to matter
+    for (TPair<FString, FAddressState>& Entry : Watched)
+    {
+        if (Entry.Value.bInitialized && Entry.Value.LastBlockHeight > BlockHeight)
+        {
+            Entry.Value = FAddressState();
+            Changed.Remove(Entry.Key);
+        }
+    }
+
+    // Addresses dropped above are reported once the next refresh downloads them again
+    if (Changed.Num() > 0)
+    {
+        UTxOsChanged.Broadcast(Changed);
+    }
+}
@@ -0,0 +1,484 @@
+#include "CardanoUTxOLanes.h"
+#include "CardanoLog.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "Algo/StableSort.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Guid.h"
+#include "Misc/ScopeLock.h"
+
+/** Pickings tried by Acquire while the backend reports lanes held by other nodes. */
+static const int32 RESERVE_ATTEMPTS = 4;
+
+/** How long a lane another node holds is skipped. */
+static const double HELD_ELSEWHERE_BACKOFF_SECONDS = 5.0;
+
+static bool get_utxo_ref(const FUTxO& UTxO, FCardanoUTxORef& OutRef)
+{
+    OutRef.TxIndex = static_cast<uint32>(UTxO.TxIndex);
+    return FCardanoHash32::FromHex(UTxO.TxHash, OutRef.TxHash);
+}
+
+/** Keyed by policy id followed by asset name. */
+static TMap<FString, uint64> get_token_amounts(const TArray<FTokenBalance>& Assets)
+{
+    TMap<FString, uint64> Amounts;
+    for (const FTokenBalance& Asset : Assets)
+    {
+        Amounts.FindOrAdd(Asset.PolicyId + Asset.AssetName) += FCString::Strtoui64(*Asset.Quantity, nullptr, 10);
+    }
+    return Amounts;
+}
+
+static bool covers(const FUTxO& UTxO, int64 Lovelace, const TMap<FString, uint64>& Tokens)
+{
+    if (UTxO.Value < Lovelace)
+    {
+        return false;
+    }
+
+    const TMap<FString, uint64> Held = get_token_amounts(UTxO.Assets);
+    for (const TPair<FString, uint64>& Token : Tokens)
+    {
+        const uint64* Amount = Held.Find(Token.Key);
+        if (!Amount || *Amount < Token.Value)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FCardanoUTxOLanes::FCardanoUTxOLanes(const FString& InOwnerAddress, TSharedPtr<ICardanoUTxOLeaseBackend, ESPMode::ThreadSafe> InBackend, const FString& InHolderId)
+    : OwnerAddress(InOwnerAddress)
+    , Backend(MoveTemp(InBackend))
+    , HolderId(InHolderId.IsEmpty() ? FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphens) : InHolderId)
+{
+}
+
+void FCardanoUTxOLanes::SetUTxOs(const TArray<FUTxO>& UTxOs)
+{
+    TArray<FCardanoUTxORef> Confirmed;
+
+    {
+        FScopeLock ScopeLock(&Lock);
+
+        TSet<FCardanoUTxORef> Listed;
+        Listed.Reserve(UTxOs.Num());
+
+        for (const FUTxO& UTxO : UTxOs)
+        {
+            FCardanoUTxORef Ref;
+            if (!get_utxo_ref(UTxO, Ref))
+            {
+                UE_LOG(LogCardano, Warning, TEXT("Skipping malformed UTxO %s#%d"), *UTxO.TxHash, UTxO.TxIndex);
+                continue;
+            }
+            Listed.Add(Ref);
+
+            // Spent by a committed transaction the chain has not caught up with yet
+            if (SpentBy.Contains(Ref))
+            {
+                continue;
+            }
+
+            if (FLane* Lane = Lanes.Find(Ref))
+            {
+                Lane->bUnconfirmed = false;
+                Lane->bStale = false;
+            }
+            else
+            {
+                FLane& NewLane = Lanes.Add(Ref);
+                NewLane.UTxO = UTxO;
+            }
+        }
+
+        for (auto It = Lanes.CreateIterator(); It; ++It)
+        {
+            FLane& Lane = It.Value();
+            if (Listed.Contains(It.Key()) || Lane.bUnconfirmed)
+            {
+                continue;
+            }
+
+            if (Lane.LeaseId != 0)
+            {
+                Lane.bStale = true;
+            }
+            else
+            {
+                It.RemoveCurrent();
+            }
+        }
+
+        // Once the chain lists none of its inputs, a committed transaction is in a block
+        for (auto It = Committed.CreateIterator(); It; ++It)
+        {
+            const bool bConfirmed = !It.Value().Spent.ContainsByPredicate([&Listed](const TPair<FCardanoUTxORef, FUTxO>& Input)
+                {
+                    return Listed.Contains(Input.Key);
+                });
+
+            if (bConfirmed)
+            {
+                for (const TPair<FCardanoUTxORef, FUTxO>& Input : It.Value().Spent)
+                {
+                    SpentBy.Remove(Input.Key);
+                    Confirmed.Add(Input.Key);
+                }
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    // Spent on chain, these inputs are never listed again: no lease can take them back
+    if (Backend && Confirmed.Num() > 0)
+    {
+        Backend->Release(HolderId, Confirmed);
+    }
+}
+
+bool FCardanoUTxOLanes::PickLanes(int64 Lovelace, TMap<FString, uint64> Missing, double Now, TArray<FCardanoUTxORef>& OutPicked) const
+{
+    TArray<FCardanoUTxORef> Free;
+    const FCardanoUTxORef* Best = nullptr;
+    for (const TPair<FCardanoUTxORef, FLane>& Entry : Lanes)
+    {
+        if (Entry.Value.LeaseId != 0 || Entry.Value.bStale || Entry.Value.HeldElsewhereUntil > Now)
+        {
+            continue;
+        }
+
+        Free.Add(Entry.Key);
+        if (covers(Entry.Value.UTxO, Lovelace, Missing) && (!Best || Entry.Value.UTxO.Value < Lanes[*Best].UTxO.Value))
+        {
+            Best = &Entry.Key;
+        }
+    }
+
+    if (Best)
+    {
+        OutPicked.Add(*Best);
+        return true;
+    }
+
+    Algo::StableSort(Free, [this](const FCardanoUTxORef& A, const FCardanoUTxORef& B) { return Lanes[A].UTxO.Value > Lanes[B].UTxO.Value; });
+
+    TBitArray<> Taken(false, Free.Num());
+    int64 Total = 0;
+
+    // Tokens first, from the largest lanes holding them, then lovelace from the largest lanes left
+    for (int32 i = 0; i < Free.Num() && Missing.Num() > 0; ++i)
+    {
+        bool bUseful = false;
+        for (const TPair<FString, uint64>& Held : get_token_amounts(Lanes[Free[i]].UTxO.Assets))
+        {
+            if (uint64* Amount = Missing.Find(Held.Key))
+            {
+                bUseful = true;
+                *Amount = Held.Value >= *Amount ? 0 : *Amount - Held.Value;
+                if (*Amount == 0)
+                {
+                    Missing.Remove(Held.Key);
+                }
+            }
+        }
+
+        if (bUseful)
+        {
+            Taken[i] = true;
+            OutPicked.Add(Free[i]);
+            Total += Lanes[Free[i]].UTxO.Value;
+        }
+    }
+
+    for (int32 i = 0; i < Free.Num() && Total < Lovelace; ++i)
+    {
+        if (!Taken[i])
+        {
+            OutPicked.Add(Free[i]);
+            Total += Lanes[Free[i]].UTxO.Value;
+        }
+    }
+
+    return Missing.Num() == 0 && Total >= Lovelace;
+}
+
+bool FCardanoUTxOLanes::Acquire(int64 Lovelace, const TArray<FTokenBalance>& Assets, FCardanoUTxOLease& OutLease)
+{
+    const TMap<FString, uint64> Tokens = get_token_amounts(Assets);
+
+    for (int32 Attempt = 0; Attempt < RESERVE_ATTEMPTS; ++Attempt)
+    {
+        OutLease = FCardanoUTxOLease();
+        TArray<FCardanoUTxORef> Picked;
+
+        {
+            FScopeLock ScopeLock(&Lock);
+
+            if (!PickLanes(Lovelace, Tokens, FPlatformTime::Seconds(), Picked))
+            {
+                return false;
+            }
+
+            OutLease.Id = NextLeaseId++;
+            for (const FCardanoUTxORef& Ref : Picked)
+            {
+                FLane& Lane = Lanes[Ref];
+                Lane.LeaseId = OutLease.Id;
+                OutLease.UTxOs.Add(Lane.UTxO);
+            }
+            Leases.Add(OutLease.Id, Picked);
+        }
+
+        // Reserved outside the lock, the lanes being leased already, so that other threads keep leasing meanwhile
+        TArray<FCardanoUTxORef> Conflicts;
+        if (!Backend || Backend->Reserve(HolderId, Picked, LeaseTtlSeconds, Conflicts))
+        {
+            return true;
+        }
+
+        {
+            FScopeLock ScopeLock(&Lock);
+
+            const double HeldUntil = FPlatformTime::Seconds() + HELD_ELSEWHERE_BACKOFF_SECONDS;
+            for (const FCardanoUTxORef& Ref : Conflicts)
+            {
+                if (FLane* Lane = Lanes.Find(Ref))
+                {
+                    Lane->HeldElsewhereUntil = HeldUntil;
+                }
+            }
+
+            // Reserve set nothing, so there is nothing to release from the backend
+            EndLease(OutLease.Id);
+        }
+
+        OutLease = FCardanoUTxOLease();
+        if (Conflicts.Num() == 0)
+        {
+            UE_LOG(LogCardano, Warning, TEXT("Lanes: the lease backend is unreachable, leasing nothing"));
+            return false;
+        }
+
+        UE_LOG(LogCardano, Verbose, TEXT("Lanes: %d lanes held by other nodes, picking again"), Conflicts.Num());
+    }
+
+    return false;
+}
+
+void FCardanoUTxOLanes::EndLease(int32 LeaseId)
+{
+    TArray<FCardanoUTxORef> Refs;
+    if (!Leases.RemoveAndCopyValue(LeaseId, Refs))
+    {
+        return;
+    }
+
+    for (const FCardanoUTxORef& Ref : Refs)
+    {
+        FLane* Lane = Lanes.Find(Ref);
+        if (!Lane || Lane->LeaseId != LeaseId)
+        {
+            continue;
+        }
+
+        if (Lane->bStale)
+        {
+            Lanes.Remove(Ref);
+        }
+        else
+        {
+            Lane->LeaseId = 0;
+        }
+    }
+}
+
+void FCardanoUTxOLanes::Release(int32 LeaseId)
+{
+    // Released from the backend while the lanes are still leased here, so that the release cannot drop the
+    // reservation of another lease taking them in the meantime
+    if (Backend)
+    {
+        TArray<FCardanoUTxORef> Refs;
+        {
+            FScopeLock ScopeLock(&Lock);
+            if (const TArray<FCardanoUTxORef>* Found = Leases.Find(LeaseId))
+            {
+                Refs = *Found;
+            }
+        }
+        Backend->Release(HolderId, Refs);
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    EndLease(LeaseId);
+}
+
+bool FCardanoUTxOLanes::Commit(int32 LeaseId, const TArray<uint8>& Transaction, FString& OutTxHash, FString& OutError)
+{
+    TArray<FCardanoUTxORef> SpentKeys;
+    TArray<TPair<FString, FUTxO>> Outputs;
+    const bool bDecoded = decode_transaction_utxos(Transaction, OutTxHash, SpentKeys, Outputs);
+
+    TArray<FCardanoUTxORef> Retired;
+    TArray<FCardanoUTxORef> Unspent;
+    int32 SpentCount = 0;
+    int32 CreatedCount = 0;
+
+    {
+        FScopeLock ScopeLock(&Lock);
+
+        const TArray<FCardanoUTxORef>* LeaseRefs = Leases.Find(LeaseId);
+        if (!LeaseRefs)
+        {
+            OutError = FString::Printf(TEXT("Lease %d is not held"), LeaseId);
+            return false;
+        }
+
+        if (bDecoded)
+        {
+            for (const FCardanoUTxORef& Ref : *LeaseRefs)
+            {
+                (SpentKeys.Contains(Ref) ? Retired : Unspent).Add(Ref);
+            }
+
+            FCommitted& Entry = Committed.FindOrAdd(OutTxHash);
+            for (const FCardanoUTxORef& Key : SpentKeys)
+            {
+                FLane Lane;
+                if (Lanes.RemoveAndCopyValue(Key, Lane))
+                {
+                    Entry.Spent.Emplace(Key, MoveTemp(Lane.UTxO));
+                    SpentBy.Add(Key, OutTxHash);
+                }
+            }
+
+            FCardanoHash32 TxHash;
+            FCardanoHash32::FromHex(OutTxHash, TxHash);
+            for (TPair<FString, FUTxO>& Output : Outputs)
+            {
+                if (Output.Key != OwnerAddress)
+                {
+                    continue;
+                }
+
+                const FCardanoUTxORef Ref(TxHash, static_cast<uint32>(Output.Value.TxIndex));
+                FLane& Lane = Lanes.Add(Ref);
+                Lane.UTxO = MoveTemp(Output.Value);
+                Lane.bUnconfirmed = true;
+                Entry.Created.Add(Ref);
+            }
+
+            SpentCount = Entry.Spent.Num();
+            CreatedCount = Entry.Created.Num();
+        }
+    }
+
+    if (!bDecoded)
+    {
+        Release(LeaseId);
+        OutError = TEXT("Failed to decode the transaction");
+        return false;
+    }
+
+    // Other nodes keep seeing the spent inputs on chain until the transaction confirms
+    if (Backend)
+    {
+        TArray<FCardanoUTxORef> Conflicts;
+        if (Retired.Num() > 0 && !Backend->Reserve(HolderId, Retired, SpentTtlSeconds, Conflicts))
+        {
+            UE_LOG(LogCardano, Warning, TEXT("Lanes: failed to keep the inputs of %s reserved"), *OutTxHash);
+        }
+        Backend->Release(HolderId, Unspent);
+    }
+
+    {
+        FScopeLock ScopeLock(&Lock);
+        EndLease(LeaseId);
+    }
+
+    UE_LOG(LogCardano, Verbose, TEXT("Lanes: committed %s, %d inputs retired, %d lanes created"), *OutTxHash, SpentCount, CreatedCount);
+    return true;
+}
+
+void FCardanoUTxOLanes::Reject(const FString& TxHash)
+{
+    FCommitted Entry;
+
+    {
+        FScopeLock ScopeLock(&Lock);
+
+        if (!Committed.RemoveAndCopyValue(TxHash.ToLower(), Entry))
+        {
+            return;
+        }
+
+        for (const FCardanoUTxORef& Ref : Entry.Created)
+        {
+            FLane* Lane = Lanes.Find(Ref);
+            if (Lane && Lane->LeaseId != 0)
+            {
+                Lane->bStale = true;
+            }
+            else
+            {
+                Lanes.Remove(Ref);
+            }
+        }
+    }
+
+    // Released before the inputs are lanes again, for the same reason as in Release; SpentBy keeps SetUTxOs from
+    // adding them back meanwhile
+    if (Backend)
+    {
+        TArray<FCardanoUTxORef> Refs;
+        Refs.Reserve(Entry.Spent.Num());
+        for (const TPair<FCardanoUTxORef, FUTxO>& Input : Entry.Spent)
+        {
+            Refs.Add(Input.Key);
+        }
+        Backend->Release(HolderId, Refs);
+    }
+
+    FScopeLock ScopeLock(&Lock);
+
+    for (TPair<FCardanoUTxORef, FUTxO>& Input : Entry.Spent)
+    {
+        SpentBy.Remove(Input.Key);
+        FLane& Lane = Lanes.Add(Input.Key);
+        Lane.UTxO = MoveTemp(Input.Value);
+    }
+}
+
+int32 FCardanoUTxOLanes::GetFreeCount() const
+{
+    FScopeLock ScopeLock(&Lock);
+
+    int32 Count = 0;
+    for (const TPair<FCardanoUTxORef, FLane>& Entry : Lanes)
+    {
+        Count += (Entry.Value.LeaseId == 0 && !Entry.Value.bStale) ? 1 : 0;
+    }
+    return Count;
+}
+
+int32 FCardanoUTxOLanes::GetLeasedCount() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return Leases.Num();
+}
+
+TArray<FCardanoTxPayment> FCardanoUTxOLanes::MakeSplitPayments(const FString& Address, int32 LaneCount, int64 LaneLovelace)
+{
+    TArray<FCardanoTxPayment> Payments;
+    Payments.Reserve(FMath::Max(LaneCount, 0));
+
+    for (int32 i = 0; i < LaneCount; ++i)
+    {
+        FCardanoTxPayment& Payment = Payments.AddDefaulted_GetRef();
+        Payment.Address = Address;
+        Payment.Lovelace = LaneLovelace;
+    }
+    return Payments;
+}
@@ -0,0 +1,337 @@
+#include "CardanoUTxOLeaseBackend.h"
+#include "CardanoLog.h"
+#include "HAL/PlatformTime.h"
+#include "IPAddress.h"
+#include "Misc/ScopeLock.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+static const int32 LOCAL_SWEEP_INTERVAL = 1024;
+
+/** Replies with the 1-based positions of the keys held by another holder, having set none, or an empty array. */
+static const char* RESERVE_SCRIPT =
+    "local conflicts = {}\n"
+    "for i, key in ipairs(KEYS) do\n"
+    "  local holder = redis.call('GET', key)\n"
+    "  if holder and holder ~= ARGV[1] then conflicts[#conflicts + 1] = i end\n"
+    "end\n"
+    "if #conflicts == 0 then\n"
+    "  for _, key in ipairs(KEYS) do redis.call('SET', key, ARGV[1], 'PX', ARGV[2]) end\n"
+    "end\n"
+    "return conflicts\n";
+
+static const char* RELEASE_SCRIPT =
+    "for _, key in ipairs(KEYS) do\n"
+    "  if redis.call('GET', key) == ARGV[1] then redis.call('DEL', key) end\n"
+    "end\n"
+    "return 0\n";
+
+bool FCardanoLocalUTxOLeaseBackend::Reserve(const FString& Holder, const TArray<FCardanoUTxORef>& Refs, double TtlSeconds, TArray<FCardanoUTxORef>& OutConflicts)
+{
+    OutConflicts.Reset();
+    const double Now = FPlatformTime::Seconds();
+
+    FScopeLock ScopeLock(&Lock);
+
+    if (++CallsSinceSweep >= LOCAL_SWEEP_INTERVAL)
+    {
+        CallsSinceSweep = 0;
+        for (auto It = Reservations.CreateIterator(); It; ++It)
+        {
+            if (It.Value().ExpiresAt <= Now)
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    for (const FCardanoUTxORef& Ref : Refs)
+    {
+        const FReservation* Reservation = Reservations.Find(Ref);
+        if (Reservation && Reservation->ExpiresAt > Now && Reservation->Holder != Holder)
+        {
+            OutConflicts.Add(Ref);
+        }
+    }
+
+    if (OutConflicts.Num() > 0)
+    {
+        return false;
+    }
+
+    for (const FCardanoUTxORef& Ref : Refs)
+    {
+        FReservation& Reservation = Reservations.FindOrAdd(Ref);
+        Reservation.Holder = Holder;
+        Reservation.ExpiresAt = Now + TtlSeconds;
+    }
+    return true;
+}
+
+void FCardanoLocalUTxOLeaseBackend::Release(const FString& Holder, const TArray<FCardanoUTxORef>& Refs)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    for (const FCardanoUTxORef& Ref : Refs)
+    {
+        const FReservation* Reservation = Reservations.Find(Ref);
+        if (Reservation && Reservation->Holder == Holder)
+        {
+            Reservations.Remove(Ref);
+        }
+    }
+}
+
+FCardanoRedisUTxOLeaseBackend::FCardanoRedisUTxOLeaseBackend(const FString& InHost, int32 InPort, const FString& InPassword, const FString& InKeyPrefix)
+    : Host(InHost)
+    , Port(InPort)
+    , Password(InPassword)
+    , KeyPrefix(InKeyPrefix)
+{
+}
+
+FCardanoRedisUTxOLeaseBackend::~FCardanoRedisUTxOLeaseBackend()
+{
+    Disconnect();
+}
+
+bool FCardanoRedisUTxOLeaseBackend::Reserve(const FString& Holder, const TArray<FCardanoUTxORef>& Refs, double TtlSeconds, TArray<FCardanoUTxORef>& OutConflicts)
+{
+    OutConflicts.Reset();
+    if (Refs.Num() == 0)
+    {
+        return true;
+    }
+
+    const int64 TtlMilliseconds = FMath::Max<int64>(1, static_cast<int64>(TtlSeconds * 1000.0));
+
+    FScopeLock ScopeLock(&Lock);
+
+    FReply Reply;
+    if (!RunScript(RESERVE_SCRIPT, Refs, { Holder, FString::Printf(TEXT("%lld"), TtlMilliseconds) }, Reply))
+    {
+        return false;
+    }
+
+    for (const int64 Position : Reply.Integers)
+    {
+        if (Position >= 1 && Position <= Refs.Num())
+        {
+            OutConflicts.Add(Refs[Position - 1]);
+        }
+    }
+    return Reply.Integers.Num() == 0;
+}
+
+void FCardanoRedisUTxOLeaseBackend::Release(const FString& Holder, const TArray<FCardanoUTxORef>& Refs)
+{
+    if (Refs.Num() == 0)
+    {
+        return;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+
+    // A release that does not make it only leaves the reservations to expire
+    FReply Reply;
+    RunScript(RELEASE_SCRIPT, Refs, { Holder }, Reply);
+}
+
+bool FCardanoRedisUTxOLeaseBackend::RunScript(const char* Script, const TArray<FCardanoUTxORef>& Refs, const TArray<FString>& Args, FReply& OutReply)
+{
+    TArray<FString> Command;
+    Command.Reserve(3 + Refs.Num() + Args.Num());
+    Command.Add(TEXT("EVAL"));
+    Command.Add(UTF8_TO_TCHAR(Script));
+    Command.Add(FString::FromInt(Refs.Num()));
+    for (const FCardanoUTxORef& Ref : Refs)
+    {
+        Command.Add(KeyPrefix + Ref.ToString());
+    }
+    Command.Append(Args);
+
+    // Scripts only check and set keys, so sending one again after a broken connection is harmless
+    for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+    {
+        if ((Socket || Connect()) && SendCommand(Command) && ReadReply(OutReply))
+        {
+            if (OutReply.bError)
+            {
+                UE_LOG(LogCardano, Warning, TEXT("UTxO leases: Redis error: %s"), *OutReply.Text);
+                return false;
+            }
+            return true;
+        }
+        Disconnect();
+    }
+
+    UE_LOG(LogCardano, Warning, TEXT("UTxO leases: Redis at %s:%d is unreachable"), *Host, Port);
+    return false;
+}
+
+bool FCardanoRedisUTxOLeaseBackend::Connect()
+{
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    if (!SocketSubsystem)
+    {
+        return false;
+    }
+
+    const FAddressInfoResult Resolved = SocketSubsystem->GetAddressInfo(*Host, nullptr, EAddressInfoFlags::Default, NAME_None, ESocketType::SOCKTYPE_Streaming);
+    if (Resolved.ReturnCode != SE_NO_ERROR || Resolved.Results.Num() == 0)
+    {
+        return false;
+    }
+
+    const TSharedRef<FInternetAddr> Address = Resolved.Results[0].Address;
+    Address->SetPort(Port);
+
+    Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("Cardano UTxO leases"), Address->GetProtocolType());
+    if (!Socket)
+    {
+        return false;
+    }
+
+    Socket->SetNoDelay(true);
+    if (!Socket->Connect(*Address))
+    {
+        Disconnect();
+        return false;
+    }
+
+    Pending.Reset();
+    if (!Password.IsEmpty())
+    {
+        FReply Reply;
+        if (!SendCommand({ TEXT("AUTH"), Password }) || !ReadReply(Reply) || Reply.bError)
+        {
+            UE_LOG(LogCardano, Warning, TEXT("UTxO leases: Redis authentication failed: %s"), *Reply.Text);
+            Disconnect();
+            return false;
+        }
+    }
+    return true;
+}
+
+void FCardanoRedisUTxOLeaseBackend::Disconnect()
+{
+    if (Socket)
+    {
+        Socket->Close();
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+        Socket = nullptr;
+    }
+    Pending.Reset();
+}
+
+bool FCardanoRedisUTxOLeaseBackend::SendCommand(const TArray<FString>& Args)
+{
+    // RESP: an array of bulk strings
+    TArray<uint8> Data;
+    auto Append = [&Data](const char* Bytes, int32 Size) { Data.Append(reinterpret_cast<const uint8*>(Bytes), Size); };
+
+    const FTCHARToUTF8 Count(*FString::Printf(TEXT("*%d\r\n"), Args.Num()));
+    Append(Count.Get(), Count.Length());
+    for (const FString& Arg : Args)
+    {
+        const FTCHARToUTF8 Value(*Arg);
+        const FTCHARToUTF8 Length(*FString::Printf(TEXT("$%d\r\n"), Value.Length()));
+        Append(Length.Get(), Length.Length());
+        Append(Value.Get(), Value.Length());
+        Append("\r\n", 2);
+    }
+
+    int32 Offset = 0;
+    while (Offset < Data.Num())
+    {
+        int32 Sent = 0;
+        if (!Socket->Send(Data.GetData() + Offset, Data.Num() - Offset, Sent) || Sent <= 0)
+        {
+            return false;
+        }
+        Offset += Sent;
+    }
+    return true;
+}
+
+bool FCardanoRedisUTxOLeaseBackend::ReadLine(FString& OutLine)
+{
+    for (;;)
+    {
+        for (int32 i = 0; i + 1 < Pending.Num(); ++i)
+        {
+            if (Pending[i] == '\r' && Pending[i + 1] == '\n')
+            {
+                const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Pending.GetData()), i);
+                OutLine = FString(Converted.Length(), Converted.Get());
+                Pending.RemoveAt(0, i + 2, false);
+                return true;
+            }
+        }
+
+        uint8 Buffer[4096];
+        int32 Received = 0;
+        if (!Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(TimeoutSeconds))
+            || !Socket->Recv(Buffer, sizeof(Buffer), Received) || Received <= 0)
+        {
+            return false;
+        }
+        Pending.Append(Buffer, Received);
+    }
+}
+
+bool FCardanoRedisUTxOLeaseBackend::ReadReply(FReply& OutReply)
+{
+    OutReply = FReply();
+
+    FString Line;
+    if (!ReadLine(Line) || Line.IsEmpty())
+    {
+        return false;
+    }
+
+    const TCHAR Type = Line[0];
+    const FString Value = Line.Mid(1);
+
+    switch (Type)
+    {
+    case TEXT('-'):
+        OutReply.bError = true;
+        OutReply.Text = Value;
+        return true;
+    case TEXT('+'):
+        OutReply.Text = Value;
+        return true;
+    case TEXT(':'):
+        OutReply.Integer = FCString::Atoi64(*Value);
+        return true;
+    case TEXT('*'):
+    {
+        // The scripts reply with arrays of integers only
+        const int32 Count = FCString::Atoi(*Value);
+        for (int32 i = 0; i < Count; ++i)
+        {
+            FReply Element;
+            if (!ReadReply(Element))
+            {
+                return false;
+            }
+            OutReply.Integers.Add(Element.Integer);
+        }
+        return true;
+    }
+    case TEXT('$'):
+    {
+        const int32 Length = FCString::Atoi(*Value);
+        if (Length < 0)
+        {
+            return true;
+        }
+
+        // Bulk strings are not expected; read it as a line, which it is on its own
+        return ReadLine(OutReply.Text);
+    }
+    default:
+        return false;
+    }
+}
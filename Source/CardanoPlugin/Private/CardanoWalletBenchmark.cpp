@@ -0,0 +1,210 @@
+#include "CardanoWalletBenchmark.h"
+#include "CardanoBlueprintLibrary.h"
+#include "CardanoLog.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include <cardano/bip39.h>
+#include <cardano/key_handlers/software_secure_key_handler.h>
+#include <sodium.h>
+
+// Defined in CardanoBlueprintLibrary.cpp; the benchmark times the exact code GenerateWallet runs
+cardano_address_t* create_address_from_derivation_paths(
+    cardano_secure_key_handler_t* key_handler,
+    cardano_account_derivation_path_t account_path,
+    uint32_t payment_index,
+    uint32_t stake_key_index);
+
+static const char* BENCHMARK_PASSPHRASE = "password";
+
+static int32_t get_benchmark_passphrase(byte_t* buffer, size_t buffer_len)
+{
+    const size_t PassphraseLen = strlen(BENCHMARK_PASSPHRASE);
+    if (buffer_len < PassphraseLen)
+    {
+        return -1;
+    }
+
+    FMemory::Memcpy(buffer, BENCHMARK_PASSPHRASE, PassphraseLen);
+    return static_cast<int32_t>(PassphraseLen);
+}
+
+namespace
+{
+    struct FStageTotals
+    {
+        double Mnemonic = 0.0;
+        double KeyHandler = 0.0;
+        double Address = 0.0;
+        int32 Wallets = 0;
+        int32 Failures = 0;
+    };
+
+    /** One full GenerateWallet pipeline, without the logging, adding each stage's duration to Totals. */
+    void generate_one_wallet(FStageTotals& Totals)
+    {
+        byte_t entropy[32];
+        const char* word_array[24] = { nullptr };
+        size_t word_count = 0;
+
+        double Start = FPlatformTime::Seconds();
+        randombytes_buf(entropy, sizeof(entropy));
+        cardano_error_t result = cardano_bip39_entropy_to_mnemonic_words(entropy, sizeof(entropy), word_array, &word_count);
+        double End = FPlatformTime::Seconds();
+        Totals.Mnemonic += End - Start;
+
+        if (result != CARDANO_SUCCESS)
+        {
+            sodium_memzero(entropy, sizeof(entropy));
+            Totals.Failures++;
+            return;
+        }
+
+        cardano_secure_key_handler_t* key_handler = nullptr;
+
+        Start = End;
+        result = cardano_software_secure_key_handler_new(
+            entropy,
+            sizeof(entropy),
+            (const byte_t*)BENCHMARK_PASSPHRASE,
+            strlen(BENCHMARK_PASSPHRASE),
+            &get_benchmark_passphrase,
+            &key_handler);
+        End = FPlatformTime::Seconds();
+        Totals.KeyHandler += End - Start;
+        sodium_memzero(entropy, sizeof(entropy));
+
+        if (result != CARDANO_SUCCESS || !key_handler)
+        {
+            Totals.Failures++;
+            return;
+        }
+
+        Start = End;
+        cardano_address_t* address = create_address_from_derivation_paths(key_handler, ACCOUNT_DERIVATION_PATH, 0, 0);
+        End = FPlatformTime::Seconds();
+        Totals.Address += End - Start;
+
+        if (address)
+        {
+            Totals.Wallets++;
+        }
+        else
+        {
+            Totals.Failures++;
+        }
+
+        cardano_address_unref(&address);
+        cardano_secure_key_handler_unref(&key_handler);
+    }
+}
+
+FCardanoWalletBenchmarkRun FCardanoWalletBenchmark::Run(int32 Threads, int32 WalletsPerThread)
+{
+    FCardanoWalletBenchmarkRun Result;
+    Result.Threads = FMath::Max(Threads, 1);
+
+    if (WalletsPerThread <= 0 || sodium_init() < 0)
+    {
+        return Result;
+    }
+
+    TArray<FStageTotals> Totals;
+    Totals.SetNum(Result.Threads);
+
+    TArray<TFuture<void>> Workers;
+    Workers.Reserve(Result.Threads);
+
+    // Dedicated threads rather than the task graph, so N really means N concurrent wallets
+    const double Start = FPlatformTime::Seconds();
+    for (int32 t = 0; t < Result.Threads; t++)
+    {
+        FStageTotals* WorkerTotals = &Totals[t];
+        Workers.Add(Async(EAsyncExecution::Thread, [WorkerTotals, WalletsPerThread]()
+            {
+                for (int32 i = 0; i < WalletsPerThread; i++)
+                {
+                    generate_one_wallet(*WorkerTotals);
+                }
+            }));
+    }
+
+    for (TFuture<void>& Worker : Workers)
+    {
+        Worker.Wait();
+    }
+    Result.WallSeconds = FPlatformTime::Seconds() - Start;
+
+    FStageTotals Sum;
+    for (const FStageTotals& WorkerTotals : Totals)
+    {
+        Sum.Mnemonic += WorkerTotals.Mnemonic;
+        Sum.KeyHandler += WorkerTotals.KeyHandler;
+        Sum.Address += WorkerTotals.Address;
+        Sum.Wallets += WorkerTotals.Wallets;
+        Sum.Failures += WorkerTotals.Failures;
+    }
+
+    const int32 Attempts = Result.Threads * WalletsPerThread;
+    Result.Wallets = Sum.Wallets;
+    Result.Failures = Sum.Failures;
+    Result.WalletsPerSecond = Result.WallSeconds > 0.0 ? Sum.Wallets / Result.WallSeconds : 0.0;
+    Result.MnemonicMicros = Sum.Mnemonic * 1.0e6 / Attempts;
+    Result.KeyHandlerMicros = Sum.KeyHandler * 1.0e6 / Attempts;
+    Result.AddressMicros = Sum.Address * 1.0e6 / Attempts;
+
+    return Result;
+}
+
+TArray<FCardanoWalletBenchmarkRun> FCardanoWalletBenchmark::RunScaling(int32 MaxThreads, int32 WalletsPerThread)
+{
+    if (MaxThreads <= 0)
+    {
+        MaxThreads = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+    }
+
+    TArray<FCardanoWalletBenchmarkRun> Runs;
+    for (int32 Threads = 1; Threads < MaxThreads; Threads *= 2)
+    {
+        Runs.Add(Run(Threads, WalletsPerThread));
+    }
+    Runs.Add(Run(MaxThreads, WalletsPerThread));
+
+    return Runs;
+}
+
+FString FCardanoWalletBenchmark::FormatReport(const TArray<FCardanoWalletBenchmarkRun>& Runs)
+{
+    FString Report = TEXT("threads  wallets  failed  wallets/s  mnemonic(us)  key_handler(us)  address(us)\n");
+    for (const FCardanoWalletBenchmarkRun& Run : Runs)
+    {
+        Report += FString::Printf(TEXT("%7d  %7d  %6d  %9.1f  %12.1f  %15.1f  %11.1f\n"),
+            Run.Threads, Run.Wallets, Run.Failures, Run.WalletsPerSecond,
+            Run.MnemonicMicros, Run.KeyHandlerMicros, Run.AddressMicros);
+    }
+    return Report;
+}
+
+static FAutoConsoleCommand BenchmarkWalletGenerationCommand(
+    TEXT("Cardano.BenchmarkWalletGeneration"),
+    TEXT("Measures wallets/second and per-stage timings of wallet generation across thread counts. ")
+    TEXT("Usage: Cardano.BenchmarkWalletGeneration [WalletsPerThread=20] [MaxThreads=all cores]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            const int32 WalletsPerThread = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 20;
+            const int32 MaxThreads = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 0;
+
+            // Keep the game thread responsive while the benchmark saturates the cores
+            Async(EAsyncExecution::Thread, [WalletsPerThread, MaxThreads]()
+                {
+                    const FString Report = FCardanoWalletBenchmark::FormatReport(FCardanoWalletBenchmark::RunScaling(MaxThreads, WalletsPerThread));
+
+                    TArray<FString> Lines;
+                    Report.ParseIntoArrayLines(Lines);
+                    for (const FString& Line : Lines)
+                    {
+                        UE_LOG(LogCardano, Log, TEXT("%s"), *Line);
+                    }
+                });
+        }));
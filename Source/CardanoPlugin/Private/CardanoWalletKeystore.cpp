@@ -0,0 +1,222 @@
+#include "CardanoWalletKeystore.h"
+#include "HAL/FileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+/*
+ * Keystore layout, little-endian:
+ *   header:  char[8] magic, uint32 version, int32 account index, uint32 CRC32 of the payload, uint32[3] reserved
+ *   payload: uint16 account key size, account key, uint32 key handler size, key handler, then both chains
+ *   chain:   int32 last used index, uint32 address count, addresses
+ *   address: uint16 length, UTF-8 bech32, uint8[28] payment key hash
+ */
+static const uint8 KEYSTORE_MAGIC[8] = { 'C', 'W', 'A', 'L', 'L', 'E', 'T', 'K' };
+static const uint32 KEYSTORE_VERSION = 1;
+static const int32 KEYSTORE_HEADER_SIZE = 32;
+static const TCHAR* KEYSTORE_EXTENSION = TEXT(".keystore");
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "Keystores are read and written in host byte order");
+
+namespace
+{
+    template <typename T>
+    void AppendPod(TArray<uint8>& Out, T Value)
+    {
+        Out.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+    }
+
+    struct FKeystoreReader
+    {
+        const uint8* Data = nullptr;
+        int64 Size = 0;
+        int64 Offset = 0;
+        bool bValid = true;
+
+        const uint8* ReadBytes(int64 Count)
+        {
+            if (!bValid || Count > Size - Offset)
+            {
+                bValid = false;
+                return nullptr;
+            }
+
+            const uint8* Bytes = Data + Offset;
+            Offset += Count;
+            return Bytes;
+        }
+
+        template <typename T>
+        T Read()
+        {
+            T Value = T();
+            if (const uint8* Bytes = ReadBytes(sizeof(T)))
+            {
+                FMemory::Memcpy(&Value, Bytes, sizeof(T));
+            }
+            return Value;
+        }
+    };
+}
+
+bool FCardanoWalletKeystore::IsValidName(const FString& Name)
+{
+    return !Name.IsEmpty() && Name.Len() <= 64 && FPaths::MakeValidFileName(Name) == Name && !Name.StartsWith(TEXT("."));
+}
+
+FString FCardanoWalletKeystore::GetDirectory()
+{
+    return FPaths::ProjectSavedDir() / TEXT("Cardano") / TEXT("Wallets");
+}
+
+FString FCardanoWalletKeystore::GetFilePath(const FString& Name)
+{
+    return GetDirectory() / (Name + KEYSTORE_EXTENSION);
+}
+
+TArray<uint8> FCardanoWalletKeystore::Serialize(const FCardanoKeystoreRecord& Record)
+{
+    TArray<uint8> Bytes;
+    Bytes.AddZeroed(KEYSTORE_HEADER_SIZE);
+
+    AppendPod<uint16>(Bytes, static_cast<uint16>(Record.AccountKey.Num()));
+    Bytes.Append(Record.AccountKey);
+    AppendPod<uint32>(Bytes, static_cast<uint32>(Record.KeyHandler.Num()));
+    Bytes.Append(Record.KeyHandler);
+
+    for (const FCardanoKeystoreRecord::FChain& Chain : Record.Chains)
+    {
+        check(Chain.Addresses.Num() == Chain.KeyHashes.Num());
+
+        AppendPod<int32>(Bytes, Chain.LastUsedIndex);
+        AppendPod<uint32>(Bytes, static_cast<uint32>(Chain.Addresses.Num()));
+
+        for (int32 i = 0; i < Chain.Addresses.Num(); i++)
+        {
+            // Bech32 addresses are ASCII and at most a hundred or so characters
+            const FTCHARToUTF8 Address(*Chain.Addresses[i]);
+            AppendPod<uint16>(Bytes, static_cast<uint16>(Address.Length()));
+            Bytes.Append(reinterpret_cast<const uint8*>(Address.Get()), Address.Length());
+            Bytes.Append(Chain.KeyHashes[i].Bytes, FCardanoHash28::Size);
+        }
+    }
+
+    TArray<uint8> Header;
+    Header.Append(KEYSTORE_MAGIC, sizeof(KEYSTORE_MAGIC));
+    AppendPod<uint32>(Header, KEYSTORE_VERSION);
+    AppendPod<int32>(Header, Record.AccountIndex);
+    AppendPod<uint32>(Header, FCrc::MemCrc32(Bytes.GetData() + KEYSTORE_HEADER_SIZE, Bytes.Num() - KEYSTORE_HEADER_SIZE));
+    FMemory::Memcpy(Bytes.GetData(), Header.GetData(), Header.Num());
+
+    return Bytes;
+}
+
+bool FCardanoWalletKeystore::Parse(const uint8* Data, int64 Size, FCardanoKeystoreRecord& OutRecord)
+{
+    if (Size < KEYSTORE_HEADER_SIZE || Size > MAX_int32)
+    {
+        return false;
+    }
+
+    FKeystoreReader Reader;
+    Reader.Data = Data;
+    Reader.Size = Size;
+
+    const uint8* Magic = Reader.ReadBytes(sizeof(KEYSTORE_MAGIC));
+    if (!Magic || FMemory::Memcmp(Magic, KEYSTORE_MAGIC, sizeof(KEYSTORE_MAGIC)) != 0 || Reader.Read<uint32>() != KEYSTORE_VERSION)
+    {
+        return false;
+    }
+
+    OutRecord.AccountIndex = Reader.Read<int32>();
+    const uint32 Checksum = Reader.Read<uint32>();
+    Reader.Offset = KEYSTORE_HEADER_SIZE;
+
+    if (FCrc::MemCrc32(Data + KEYSTORE_HEADER_SIZE, static_cast<int32>(Size - KEYSTORE_HEADER_SIZE)) != Checksum)
+    {
+        return false;
+    }
+
+    const uint16 AccountKeySize = Reader.Read<uint16>();
+    if (const uint8* AccountKey = Reader.ReadBytes(AccountKeySize))
+    {
+        OutRecord.AccountKey = TArray<uint8>(AccountKey, AccountKeySize);
+    }
+
+    const uint32 KeyHandlerSize = Reader.Read<uint32>();
+    if (const uint8* KeyHandler = Reader.ReadBytes(KeyHandlerSize))
+    {
+        OutRecord.KeyHandler = TArray<uint8>(KeyHandler, static_cast<int32>(KeyHandlerSize));
+    }
+
+    for (FCardanoKeystoreRecord::FChain& Chain : OutRecord.Chains)
+    {
+        Chain.LastUsedIndex = Reader.Read<int32>();
+        const uint32 AddressCount = Reader.Read<uint32>();
+
+        // Every address takes at least 30 bytes, so a corrupt count cannot reserve more than the file's worth
+        const int32 Reserved = static_cast<int32>(FMath::Min<int64>(AddressCount, (Size - Reader.Offset) / 30));
+        Chain.Addresses.Reserve(Reserved);
+        Chain.KeyHashes.Reserve(Reserved);
+
+        for (uint32 i = 0; i < AddressCount && Reader.bValid; i++)
+        {
+            const uint16 Length = Reader.Read<uint16>();
+            const uint8* Address = Reader.ReadBytes(Length);
+            const uint8* KeyHash = Reader.ReadBytes(FCardanoHash28::Size);
+            if (!Address || !KeyHash)
+            {
+                break;
+            }
+
+            const FUTF8ToTCHAR AddressString(reinterpret_cast<const ANSICHAR*>(Address), Length);
+            Chain.Addresses.Emplace(AddressString.Length(), AddressString.Get());
+            FMemory::Memcpy(Chain.KeyHashes.AddDefaulted_GetRef().Bytes, KeyHash, FCardanoHash28::Size);
+        }
+
+        Reader.bValid = Reader.bValid && Chain.LastUsedIndex >= INDEX_NONE && Chain.LastUsedIndex < Chain.Addresses.Num();
+    }
+
+    return Reader.bValid && Reader.Offset == Size && OutRecord.AccountKey.Num() > 0;
+}
+
+bool FCardanoWalletKeystore::Save(const FString& Name, const FCardanoKeystoreRecord& Record)
+{
+    if (!IsValidName(Name))
+    {
+        return false;
+    }
+
+    // Written beside the target and moved over it, so a crash mid-write leaves the previous keystore intact
+    const FString FilePath = GetFilePath(Name);
+    const FString TempPath = FilePath + TEXT(".tmp");
+    return FFileHelper::SaveArrayToFile(Serialize(Record), *TempPath) && IFileManager::Get().Move(*FilePath, *TempPath, true);
+}
+
+bool FCardanoWalletKeystore::Load(const FString& Name, FCardanoKeystoreRecord& OutRecord)
+{
+    TArray<uint8> Bytes;
+    return IsValidName(Name) &&
+        FFileHelper::LoadFileToArray(Bytes, *GetFilePath(Name), FILEREAD_Silent) &&
+        Parse(Bytes.GetData(), Bytes.Num(), OutRecord);
+}
+
+bool FCardanoWalletKeystore::Delete(const FString& Name)
+{
+    return IsValidName(Name) && IFileManager::Get().Delete(*GetFilePath(Name), false, false, true);
+}
+
+TArray<FString> FCardanoWalletKeystore::List()
+{
+    TArray<FString> Files;
+    IFileManager::Get().FindFiles(Files, *(GetDirectory() / (FString(TEXT("*")) + KEYSTORE_EXTENSION)), true, false);
+
+    TArray<FString> Names;
+    for (const FString& File : Files)
+    {
+        Names.Add(FPaths::GetBaseFilename(File));
+    }
+
+    Names.Sort();
+    return Names;
+}
@@ -0,0 +1,834 @@
+#include "CardanoWalletSubsystem.h"
+#include "CardanoBlueprintLibrary.h"
+#include "CardanoFrameScheduler.h"
+#include "CardanoHandle.h"
+#include "CardanoHash.h"
+#include "CardanoLog.h"
+#include "CardanoMnemonic.h"
+#include "CardanoSigningPipeline.h"
+#include "CardanoTxBuilderHelpers.h"
+#include "CardanoUTxOCache.h"
+#include "CardanoWalletKeystore.h"
+#include "CardanoWarmUp.h"
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SecureHash.h"
+#include <cardano/buffer.h>
+#include <cardano/common/network_id.h>
+#include <cardano/crypto/bip32_public_key.h>
+#include <cardano/key_handlers/remote_secure_key_handler.h>
+#include <cardano/key_handlers/software_secure_key_handler.h>
+#include <cardano/transaction/transaction.h>
+#include <sodium.h>
+
+// Defined in CardanoBlueprintLibrary.cpp; wallets are derived the way the Blueprint library does it
+bool derive_base_addresses(TArrayView<const uint8> AccountKey, int32 Role, int32 StartIndex, int32 Count, TArray<FString>& OutAddresses, TArray<FCardanoHash28>* OutKeyHashes,
+    cardano_network_id_t NetworkId);
+
+static const int32 NUM_CHAINS = 2;
+
+/** How often due wallets are looked for; their own intervals decide when they are refreshed. */
+static const float SCHEDULER_INTERVAL_SECONDS = 1.0f;
+
+/** The key handler of a wallet, shared with the signings running on worker threads. */
+struct UCardanoWalletSubsystem::FWalletKeys
+{
+    FCardanoKeyHandlerHandle KeyHandler;
+
+    /** cardano-c objects are not thread safe, so the signings of one wallet take turns. */
+    FCriticalSection Lock;
+};
+
+UCardanoWalletSubsystem* UCardanoWalletSubsystem::Get()
+{
+    return GEngine ? GEngine->GetEngineSubsystem<UCardanoWalletSubsystem>() : nullptr;
+}
+
+void UCardanoWalletSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    Collection.InitializeDependency(UCardanoUTxOCache::StaticClass());
+
+    TickHandle = FTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UCardanoWalletSubsystem::Tick), SCHEDULER_INTERVAL_SECONDS);
+}
+
+void UCardanoWalletSubsystem::Deinitialize()
+{
+    FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+    Wallets.Reset();
+    RefreshingWallets.Reset();
+
+    Super::Deinitialize();
+}
+
+void UCardanoWalletSubsystem::AddWallet(const TArray<FString>& MnemonicWords, const FString& Password, int32 AccountIndex, const FOnWalletAdded& OnComplete)
+{
+    if (AccountIndex < 0)
+    {
+        OnComplete.ExecuteIfBound(false, FCardanoWalletHandle(), TEXT("Invalid account index"));
+        return;
+    }
+
+    TWeakObjectPtr<UCardanoWalletSubsystem> WeakThis(this);
+    const int32 InitialCount = FMath::Max(GapLimit, 1);
+
+    // Creating the key handler and the hardened account derivation are the slow part, so neither runs on the game thread
+    Async(EAsyncExecution::ThreadPool, [WeakThis, MnemonicWords, Password, AccountIndex, InitialCount, OnComplete]()
+        {
+            FWallet Wallet;
+            Wallet.AccountIndex = AccountIndex;
+            Wallet.Keys = MakeShared<FWalletKeys, ESPMode::ThreadSafe>();
+
+            FString Error;
+            byte_t entropy[64] = { 0 };
+            size_t entropy_size = 0;
+
+            if (!FCardanoWarmUp::InitializeSodium())
+            {
+                Error = TEXT("Libsodium initialization failed");
+            }
+            else if (!mnemonic_to_entropy(MnemonicWords, entropy, sizeof(entropy), &entropy_size))
+            {
+                Error = TEXT("Invalid mnemonic");
+            }
+
+            if (Error.IsEmpty())
+            {
+                const FCardanoScopedPassphrase Passphrase(Password);
+                cardano_error_t result = cardano_software_secure_key_handler_new(
+                    entropy,
+                    entropy_size,
+                    Passphrase.GetData(),
+                    Passphrase.Num(),
+                    &get_scoped_passphrase,
+                    Wallet.Keys->KeyHandler.GetInitReference());
+
+                if (result == CARDANO_SUCCESS)
+                {
+                    LoadAccountKey(Wallet, Error);
+                }
+                else
+                {
+                    Error = FString::Printf(TEXT("Key handler creation failed: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+                }
+            }
+            sodium_memzero(entropy, sizeof(entropy));
+
+            if (Error.IsEmpty())
+            {
+                DeriveInitialChains(Wallet, InitialCount, Error);
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Wallet = MoveTemp(Wallet), Error, OnComplete]() mutable
+                {
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->FinishAddWallet(MoveTemp(Wallet), Error, OnComplete);
+                    }
+                });
+        });
+}
+
+void UCardanoWalletSubsystem::AddRemoteWallet(const FString& SignerSocketPath, int32 AccountIndex, const FOnWalletAdded& OnComplete)
+{
+    if (AccountIndex < 0)
+    {
+        OnComplete.ExecuteIfBound(false, FCardanoWalletHandle(), TEXT("Invalid account index"));
+        return;
+    }
+
+    TWeakObjectPtr<UCardanoWalletSubsystem> WeakThis(this);
+    const int32 InitialCount = FMath::Max(GapLimit, 1);
+
+    Async(EAsyncExecution::ThreadPool, [WeakThis, SignerSocketPath, AccountIndex, InitialCount, OnComplete]()
+        {
+            FWallet Wallet;
+            Wallet.AccountIndex = AccountIndex;
+            Wallet.Keys = MakeShared<FWalletKeys, ESPMode::ThreadSafe>();
+
+            FString Error;
+            const FTCHARToUTF8 Path(*SignerSocketPath);
+            const cardano_error_t result = cardano_remote_secure_key_handler_new(Path.Get(), Path.Length(), Wallet.Keys->KeyHandler.GetInitReference());
+
+            if (result == CARDANO_SUCCESS)
+            {
+                LoadAccountKey(Wallet, Error);
+            }
+            else
+            {
+                Error = FString::Printf(TEXT("Could not connect to the signer at %s: %s"), *SignerSocketPath, UTF8_TO_TCHAR(cardano_error_to_string(result)));
+            }
+
+            if (Error.IsEmpty())
+            {
+                DeriveInitialChains(Wallet, InitialCount, Error);
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Wallet = MoveTemp(Wallet), Error, OnComplete]() mutable
+                {
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->FinishAddWallet(MoveTemp(Wallet), Error, OnComplete);
+                    }
+                });
+        });
+}
+
+void UCardanoWalletSubsystem::AddWatchOnlyWallet(const FString& AccountPublicKey, const FOnWalletAdded& OnComplete)
+{
+    TWeakObjectPtr<UCardanoWalletSubsystem> WeakThis(this);
+    const int32 InitialCount = FMath::Max(GapLimit, 1);
+    const FString Key = AccountPublicKey.TrimStartAndEnd();
+
+    // Soft derivation from the account key is all it takes, yet deriving GapLimit addresses per chain stays off the game thread
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Key, InitialCount, OnComplete]()
+        {
+            FWallet Wallet;
+            FString Error;
+
+            const FTCHARToUTF8 Utf8(*Key);
+            TCardanoRef<cardano_bip32_public_key_t> AccountPublicKey;
+            const cardano_error_t result = Key.StartsWith(TEXT("acct_"))
+                ? cardano_bip32_public_key_from_bech32(Utf8.Get(), Utf8.Length(), AccountPublicKey.GetInitReference())
+                : cardano_bip32_public_key_from_hex(Utf8.Get(), Utf8.Length(), AccountPublicKey.GetInitReference());
+
+            if (result == CARDANO_SUCCESS)
+            {
+                Wallet.AccountKey.Append(cardano_bip32_public_key_get_data(AccountPublicKey.Get()), cardano_bip32_public_key_get_bytes_size(AccountPublicKey.Get()));
+                Wallet.AccountId = FMD5::HashBytes(Wallet.AccountKey.GetData(), Wallet.AccountKey.Num());
+                DeriveInitialChains(Wallet, InitialCount, Error);
+            }
+            else
+            {
+                Error = FString::Printf(TEXT("Invalid account public key: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Wallet = MoveTemp(Wallet), Error, OnComplete]() mutable
+                {
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->FinishAddWallet(MoveTemp(Wallet), Error, OnComplete);
+                    }
+                });
+        });
+}
+
+void UCardanoWalletSubsystem::FinishAddWallet(FWallet&& Wallet, const FString& Error, const FOnWalletAdded& OnComplete)
+{
+    if (!Error.IsEmpty())
+    {
+        UE_LOG(LogCardano, Error, TEXT("Failed to add wallet: %s"), *Error);
+        OnComplete.ExecuteIfBound(false, FCardanoWalletHandle(), Error);
+        return;
+    }
+
+    OnComplete.ExecuteIfBound(true, AddLoadedWallet(MoveTemp(Wallet)), FString());
+}
+
+void UCardanoWalletSubsystem::LoadAccountKey(FWallet& Wallet, FString& OutError)
+{
+    const cardano_account_derivation_path_t account_path = {
+        ACCOUNT_DERIVATION_PATH.purpose,
+        ACCOUNT_DERIVATION_PATH.coin_type,
+        static_cast<uint64_t>(Wallet.AccountIndex) | 0x80000000
+    };
+
+    TCardanoRef<cardano_bip32_public_key_t> AccountPublicKey;
+    const cardano_error_t result = cardano_secure_key_handler_bip32_get_extended_account_public_key(Wallet.Keys->KeyHandler.Get(), account_path, AccountPublicKey.GetInitReference());
+
+    if (result == CARDANO_SUCCESS)
+    {
+        Wallet.AccountKey.Append(cardano_bip32_public_key_get_data(AccountPublicKey.Get()), cardano_bip32_public_key_get_bytes_size(AccountPublicKey.Get()));
+        Wallet.AccountId = FMD5::HashBytes(Wallet.AccountKey.GetData(), Wallet.AccountKey.Num());
+    }
+    else
+    {
+        OutError = FString::Printf(TEXT("Key handler creation failed: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+    }
+}
+
+void UCardanoWalletSubsystem::DeriveInitialChains(FWallet& Wallet, int32 Count, FString& OutError)
+{
+    TArray<FCardanoHash28> KeyHashes;
+    for (int32 Role = 0; OutError.IsEmpty() && Role < NUM_CHAINS; Role++)
+    {
+        if (derive_base_addresses(Wallet.AccountKey, Role, 0, Count, Wallet.Chains[Role].Addresses, &KeyHashes, CARDANO_NETWORK_ID_MAIN_NET))
+        {
+            Wallet.PaymentKeys.AddRange(Wallet.AccountIndex, Role, 0, KeyHashes);
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("Address derivation failed for role %d"), Role);
+        }
+    }
+}
+
+FCardanoWalletHandle UCardanoWalletSubsystem::AddLoadedWallet(FWallet&& Wallet)
+{
+    FCardanoWalletHandle Handle;
+
+    for (TPair<int32, FWallet>& Entry : Wallets)
+    {
+        if (Entry.Value.AccountId == Wallet.AccountId)
+        {
+            // Restoring the keys of an account already watched makes that wallet able to sign
+            if (!Entry.Value.Keys.IsValid() && Wallet.Keys.IsValid())
+            {
+                Entry.Value.Keys = MoveTemp(Wallet.Keys);
+                Entry.Value.AccountIndex = Wallet.AccountIndex;
+            }
+
+            Handle.Id = Entry.Key;
+            return Handle;
+        }
+    }
+
+    Handle.Id = NextWalletId++;
+
+    // Due right away, so the first refresh downloads the new addresses
+    Wallet.RefreshInterval = DefaultRefreshIntervalSeconds;
+    Wallet.NextRefreshTime = 0.0;
+
+    for (const FAddressChain& Chain : Wallet.Chains)
+    {
+        WatchAddresses(Chain.Addresses);
+    }
+
+    if (Wallet.Keys.IsValid())
+    {
+        UE_LOG(LogCardano, Log, TEXT("Added wallet %d for account %d with %d addresses"),
+            Handle.Id, Wallet.AccountIndex, Wallet.Chains[0].Addresses.Num() + Wallet.Chains[1].Addresses.Num());
+    }
+    else
+    {
+        UE_LOG(LogCardano, Log, TEXT("Added watch-only wallet %d with %d addresses"),
+            Handle.Id, Wallet.Chains[0].Addresses.Num() + Wallet.Chains[1].Addresses.Num());
+    }
+
+    Wallets.Add(Handle.Id, MoveTemp(Wallet));
+    return Handle;
+}
+
+void UCardanoWalletSubsystem::SaveWallet(FCardanoWalletHandle Handle, const FString& Name, const FOnWalletSaved& OnComplete)
+{
+    const FWallet* Wallet = Wallets.Find(Handle.Id);
+    if (!Wallet)
+    {
+        OnComplete.ExecuteIfBound(false, TEXT("Wallet not loaded"));
+        return;
+    }
+
+    if (!FCardanoWalletKeystore::IsValidName(Name))
+    {
+        OnComplete.ExecuteIfBound(false, FString::Printf(TEXT("Invalid wallet name %s"), *Name));
+        return;
+    }
+
+    FCardanoKeystoreRecord Record;
+    Record.AccountIndex = Wallet->AccountIndex;
+    Record.AccountKey = Wallet->AccountKey;
+    for (int32 Role = 0; Role < NUM_CHAINS; Role++)
+    {
+        Record.Chains[Role].Addresses = Wallet->Chains[Role].Addresses;
+        Record.Chains[Role].LastUsedIndex = Wallet->Chains[Role].LastUsedIndex;
+    }
+
+    Async(EAsyncExecution::ThreadPool, [Keys = Wallet->Keys, Name, Record = MoveTemp(Record), OnComplete]() mutable
+        {
+            FString Error;
+            if (Keys.IsValid())
+            {
+                FScopeLock Lock(&Keys->Lock);
+
+                TCardanoRef<cardano_buffer_t> Buffer;
+                const cardano_error_t result = cardano_secure_key_handler_serialize(Keys->KeyHandler.Get(), Buffer.GetInitReference());
+                if (result == CARDANO_SUCCESS)
+                {
+                    Record.KeyHandler.Append(cardano_buffer_get_data(Buffer.Get()), cardano_buffer_get_size(Buffer.Get()));
+                }
+                else
+                {
+                    Error = FString::Printf(TEXT("The keys of this wallet cannot be saved: %s"), UTF8_TO_TCHAR(cardano_error_to_string(result)));
+                }
+            }
+
+            for (FCardanoKeystoreRecord::FChain& Chain : Record.Chains)
+            {
+                Chain.KeyHashes.SetNum(Chain.Addresses.Num());
+                for (int32 i = 0; Error.IsEmpty() && i < Chain.Addresses.Num(); i++)
+                {
+                    if (!FCardanoPaymentKeyIndex::ReadPaymentKeyHash(Chain.Addresses[i], Chain.KeyHashes[i]))
+                    {
+                        Error = FString::Printf(TEXT("Unreadable wallet address %s"), *Chain.Addresses[i]);
+                    }
+                }
+            }
+
+            if (Error.IsEmpty() && !FCardanoWalletKeystore::Save(Name, Record))
+            {
+                Error = FString::Printf(TEXT("Failed to write the saved wallet %s"), *Name);
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [OnComplete, Error]()
+                {
+                    if (!Error.IsEmpty())
+                    {
+                        UE_LOG(LogCardano, Error, TEXT("Failed to save wallet: %s"), *Error);
+                    }
+                    OnComplete.ExecuteIfBound(Error.IsEmpty(), Error);
+                });
+        });
+}
+
+void UCardanoWalletSubsystem::OpenSavedWallet(const FString& Name, bool bWatchOnly, const FOnWalletAdded& OnComplete)
+{
+    TWeakObjectPtr<UCardanoWalletSubsystem> WeakThis(this);
+
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Name, bWatchOnly, OnComplete]()
+        {
+            FWallet Wallet;
+            FString Error;
+            FCardanoKeystoreRecord Record;
+
+            if (!FCardanoWalletKeystore::Load(Name, Record))
+            {
+                Error = FString::Printf(TEXT("No readable saved wallet named %s"), *Name);
+            }
+            else if (!bWatchOnly && Record.KeyHandler.Num() > 0)
+            {
+                // The handler keeps its keys encrypted as they were saved; they are decrypted only to sign
+                Wallet.Keys = MakeShared<FWalletKeys, ESPMode::ThreadSafe>();
+                const cardano_error_t result = cardano_software_secure_key_handler_deserialize(
+                    Record.KeyHandler.GetData(),
+                    Record.KeyHandler.Num(),
+                    &get_scoped_passphrase,
+                    Wallet.Keys->KeyHandler.GetInitReference());
+
+                if (result != CARDANO_SUCCESS)
+                {
+                    Error = FString::Printf(TEXT("Unreadable keys in the saved wallet %s: %s"), *Name, UTF8_TO_TCHAR(cardano_error_to_string(result)));
+                }
+            }
+
+            if (Error.IsEmpty())
+            {
+                Wallet.AccountIndex = Record.AccountIndex;
+                Wallet.AccountKey = MoveTemp(Record.AccountKey);
+                Wallet.AccountId = FMD5::HashBytes(Wallet.AccountKey.GetData(), Wallet.AccountKey.Num());
+
+                for (int32 Role = 0; Role < NUM_CHAINS; Role++)
+                {
+                    Wallet.Chains[Role].Addresses = MoveTemp(Record.Chains[Role].Addresses);
+                    Wallet.Chains[Role].LastUsedIndex = Record.Chains[Role].LastUsedIndex;
+                    Wallet.PaymentKeys.AddRange(Wallet.AccountIndex, Role, 0, Record.Chains[Role].KeyHashes);
+                }
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Wallet = MoveTemp(Wallet), Error, OnComplete]() mutable
+                {
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->FinishAddWallet(MoveTemp(Wallet), Error, OnComplete);
+                    }
+                });
+        });
+}
+
+bool UCardanoWalletSubsystem::DeleteSavedWallet(const FString& Name)
+{
+    return FCardanoWalletKeystore::Delete(Name);
+}
+
+TArray<FString> UCardanoWalletSubsystem::GetSavedWallets() const
+{
+    return FCardanoWalletKeystore::List();
+}
+
+void UCardanoWalletSubsystem::RemoveWallet(FCardanoWalletHandle Wallet)
+{
+    FWallet Removed;
+    if (!Wallets.RemoveAndCopyValue(Wallet.Id, Removed))
+    {
+        return;
+    }
+
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (!Cache)
+    {
+        return;
+    }
+
+    TSet<FString> StillUsed;
+    for (const TPair<int32, FWallet>& Entry : Wallets)
+    {
+        for (const FAddressChain& Chain : Entry.Value.Chains)
+        {
+            StillUsed.Append(Chain.Addresses);
+        }
+    }
+
+    for (const FAddressChain& Chain : Removed.Chains)
+    {
+        for (const FString& Address : Chain.Addresses)
+        {
+            if (!StillUsed.Contains(Address))
+            {
+                Cache->UnwatchAddress(Address);
+            }
+        }
+    }
+}
+
+bool UCardanoWalletSubsystem::IsWatchOnly(FCardanoWalletHandle Wallet) const
+{
+    const FWallet* Found = Wallets.Find(Wallet.Id);
+    return Found && !Found->Keys.IsValid();
+}
+
+TArray<FCardanoWalletHandle> UCardanoWalletSubsystem::GetWallets() const
+{
+    TArray<FCardanoWalletHandle> Handles;
+    for (const TPair<int32, FWallet>& Entry : Wallets)
+    {
+        FCardanoWalletHandle& Handle = Handles.AddDefaulted_GetRef();
+        Handle.Id = Entry.Key;
+    }
+    return Handles;
+}
+
+bool UCardanoWalletSubsystem::GetWalletAddresses(FCardanoWalletHandle Wallet, TArray<FString>& OutAddresses) const
+{
+    OutAddresses.Reset();
+
+    const FWallet* Found = Wallets.Find(Wallet.Id);
+    if (!Found)
+    {
+        return false;
+    }
+
+    for (const FAddressChain& Chain : Found->Chains)
+    {
+        OutAddresses.Append(Chain.Addresses);
+    }
+    return true;
+}
+
+FString UCardanoWalletSubsystem::GetFirstUnused(FCardanoWalletHandle Wallet, int32 Role) const
+{
+    const FWallet* Found = Wallets.Find(Wallet.Id);
+    if (!Found)
+    {
+        return FString();
+    }
+
+    const FAddressChain& Chain = Found->Chains[Role];
+    const int32 Index = Chain.LastUsedIndex + 1;
+    return Chain.Addresses.IsValidIndex(Index) ? Chain.Addresses[Index] : FString();
+}
+
+FString UCardanoWalletSubsystem::GetReceiveAddress(FCardanoWalletHandle Wallet) const
+{
+    return GetFirstUnused(Wallet, CARDANO_CIP_1852_ROLE_EXTERNAL);
+}
+
+FString UCardanoWalletSubsystem::GetChangeAddress(FCardanoWalletHandle Wallet) const
+{
+    return GetFirstUnused(Wallet, CARDANO_CIP_1852_ROLE_INTERNAL);
+}
+
+bool UCardanoWalletSubsystem::GetWalletBalance(FCardanoWalletHandle Wallet, FAddressBalance& OutBalance) const
+{
+    OutBalance = FAddressBalance();
+
+    const FWallet* Found = Wallets.Find(Wallet.Id);
+    const UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (!Found || !Cache)
+    {
+        return false;
+    }
+
+    // The running totals of every address, merged without building a balance per address
+    FCardanoBalanceTotals Totals;
+    for (const FAddressChain& Chain : Found->Chains)
+    {
+        for (const FString& Address : Chain.Addresses)
+        {
+            const FCardanoBalanceTotals* AddressTotals = Cache->FindCachedTotals(Address);
+            if (!AddressTotals)
+            {
+                return false;
+            }
+            Totals.Append(*AddressTotals);
+        }
+    }
+
+    Totals.ToBalance(OutBalance);
+    return true;
+}
+
+bool UCardanoWalletSubsystem::GetSpendableUTxOs(FCardanoWalletHandle Wallet, TArray<FUTxO>& OutUTxOs) const
+{
+    OutUTxOs.Reset();
+
+    const FWallet* Found = Wallets.Find(Wallet.Id);
+    const UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (!Found || !Cache)
+    {
+        return false;
+    }
+
+    TArray<FUTxO> AddressUTxOs;
+    for (const FAddressChain& Chain : Found->Chains)
+    {
+        for (const FString& Address : Chain.Addresses)
+        {
+            if (!Cache->GetSpendableUTxOs(Address, AddressUTxOs))
+            {
+                OutUTxOs.Reset();
+                return false;
+            }
+            OutUTxOs.Append(MoveTemp(AddressUTxOs));
+        }
+    }
+
+    return true;
+}
+
+void UCardanoWalletSubsystem::RefreshWallet(FCardanoWalletHandle Wallet)
+{
+    if (FWallet* Found = Wallets.Find(Wallet.Id))
+    {
+        Found->NextRefreshTime = 0.0;
+    }
+}
+
+void UCardanoWalletSubsystem::SetRefreshInterval(FCardanoWalletHandle Wallet, float Seconds)
+{
+    FWallet* Found = Wallets.Find(Wallet.Id);
+    if (!Found)
+    {
+        return;
+    }
+
+    Found->RefreshInterval = FMath::Max(Seconds, 0.0f);
+
+    // A wallet already due keeps its turn
+    const double Now = FPlatformTime::Seconds();
+    if (Found->NextRefreshTime > Now)
+    {
+        Found->NextRefreshTime = Found->RefreshInterval > 0.0f ? Now + Found->RefreshInterval : DBL_MAX;
+    }
+}
+
+bool UCardanoWalletSubsystem::Tick(float DeltaTime)
+{
+    UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (bRefreshInProgress || !Cache)
+    {
+        return true;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    for (TPair<int32, FWallet>& Entry : Wallets)
+    {
+        FWallet& Wallet = Entry.Value;
+        if (Wallet.NextRefreshTime <= Now)
+        {
+            RefreshingWallets.Add(Entry.Key);
+            Wallet.NextRefreshTime = Wallet.RefreshInterval > 0.0f ? Now + Wallet.RefreshInterval : DBL_MAX;
+        }
+    }
+
+    if (RefreshingWallets.Num() == 0)
+    {
+        return true;
+    }
+
+    // One refresh covers every watched address, so all the wallets due share its batched queries
+    bRefreshInProgress = true;
+    FOnUTxOCacheRefreshed OnRefreshed;
+    OnRefreshed.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UCardanoWalletSubsystem, OnRefreshFinished));
+    Cache->RefreshAll(OnRefreshed);
+
+    return true;
+}
+
+void UCardanoWalletSubsystem::OnRefreshFinished(bool bSuccess, const FString& ErrorMessage)
+{
+    bRefreshInProgress = false;
+    const TArray<int32> Refreshed = MoveTemp(RefreshingWallets);
+    RefreshingWallets.Reset();
+
+    for (const int32 WalletId : Refreshed)
+    {
+        // Skip wallets removed while the refresh was running
+        if (!Wallets.Contains(WalletId))
+        {
+            continue;
+        }
+
+        if (bSuccess)
+        {
+            UpdateAddressPools(WalletId);
+        }
+
+        FCardanoWalletHandle Handle;
+        Handle.Id = WalletId;
+        OnWalletRefreshed.Broadcast(Handle, bSuccess, ErrorMessage);
+    }
+}
+
+void UCardanoWalletSubsystem::UpdateAddressPools(int32 WalletId)
+{
+    FWallet* Wallet = Wallets.Find(WalletId);
+    const UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (!Wallet || !Cache)
+    {
+        return;
+    }
+
+    TArray<FUTxO> UTxOs;
+    for (int32 Role = 0; Role < NUM_CHAINS; Role++)
+    {
+        FAddressChain& Chain = Wallet->Chains[Role];
+
+        // Addresses up to LastUsedIndex stay used, so only the ones after it are looked at
+        for (int32 i = Chain.LastUsedIndex + 1; i < Chain.Addresses.Num(); i++)
+        {
+            if (Cache->GetCachedUTxOs(Chain.Addresses[i], UTxOs) && UTxOs.Num() > 0)
+            {
+                Chain.LastUsedIndex = i;
+            }
+        }
+
+        const int32 Missing = Chain.LastUsedIndex + 1 + FMath::Max(GapLimit, 1) - Chain.Addresses.Num();
+        if (Missing > 0 && !Chain.bDeriving)
+        {
+            ExtendChain(WalletId, Role, Missing);
+        }
+    }
+}
+
+void UCardanoWalletSubsystem::ExtendChain(int32 WalletId, int32 Role, int32 Count)
+{
+    FWallet& Wallet = Wallets[WalletId];
+    FAddressChain& Chain = Wallet.Chains[Role];
+    Chain.bDeriving = true;
+
+    const int32 StartIndex = Chain.Addresses.Num();
+    TWeakObjectPtr<UCardanoWalletSubsystem> WeakThis(this);
+
+    FCardanoFrameScheduler::Get().RunInBackground(ECardanoWorkPriority::Low, [WeakThis, WalletId, Role, StartIndex, Count, AccountKey = Wallet.AccountKey]()
+        {
+            TArray<FString> Addresses;
+            TArray<FCardanoHash28> KeyHashes;
+            const bool bDerived = derive_base_addresses(AccountKey, Role, StartIndex, Count, Addresses, &KeyHashes, CARDANO_NETWORK_ID_MAIN_NET);
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, WalletId, Role, StartIndex, bDerived, Addresses = MoveTemp(Addresses), KeyHashes = MoveTemp(KeyHashes)]()
+                {
+                    FWallet* Wallet = WeakThis.IsValid() ? WeakThis->Wallets.Find(WalletId) : nullptr;
+                    if (!Wallet)
+                    {
+                        return;
+                    }
+
+                    FAddressChain& Chain = Wallet->Chains[Role];
+                    Chain.bDeriving = false;
+
+                    if (!bDerived || Chain.Addresses.Num() != StartIndex)
+                    {
+                        UE_LOG(LogCardano, Error, TEXT("Failed to extend the address pool of wallet %d, role %d"), WalletId, Role);
+                        return;
+                    }
+
+                    Chain.Addresses.Append(Addresses);
+                    Wallet->PaymentKeys.AddRange(Wallet->AccountIndex, Role, StartIndex, KeyHashes);
+                    WeakThis->WatchAddresses(Addresses);
+
+                    // Funds on the new addresses may reveal further used ones, as a gap-limit discovery would
+                    Wallet->NextRefreshTime = 0.0;
+                });
+        });
+}
+
+void UCardanoWalletSubsystem::WatchAddresses(const TArray<FString>& Addresses)
+{
+    if (UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get())
+    {
+        for (const FString& Address : Addresses)
+        {
+            Cache->WatchAddress(Address);
+        }
+    }
+}
+
+void UCardanoWalletSubsystem::SignTransaction(FCardanoWalletHandle Wallet, const TArray<uint8>& UnsignedTransaction, const FString& Password, const FOnWalletSigned& OnComplete)
+{
+    const FWallet* Found = Wallets.Find(Wallet.Id);
+    const UCardanoUTxOCache* Cache = UCardanoUTxOCache::Get();
+    if (!Found || !Cache)
+    {
+        OnComplete.ExecuteIfBound(false, TArray<uint8>(), TEXT("Unknown wallet"));
+        return;
+    }
+
+    if (!Found->Keys.IsValid())
+    {
+        OnComplete.ExecuteIfBound(false, TArray<uint8>(), TEXT("Wallet is watch-only"));
+        return;
+    }
+
+    TSet<FCardanoUTxORef> Inputs;
+    if (!read_spent_inputs(UnsignedTransaction, Inputs))
+    {
+        OnComplete.ExecuteIfBound(false, TArray<uint8>(), TEXT("Invalid transaction"));
+        return;
+    }
+
+    // One witness per key the transaction spends from, whatever the number of its inputs locked by it
+    TSet<FCardanoKeyLocation> Locations;
+    for (const FCardanoUTxORef& Input : Inputs)
+    {
+        FString Address;
+        FCardanoKeyLocation Location;
+        if (Cache->FindSpendableUTxOAddress(Input, Address) && Found->PaymentKeys.FindAddress(Address, Location))
+        {
+            // A watch-only wallet given its keys later learns its account index only then
+            Location.Account = Found->AccountIndex;
+            Locations.Add(Location);
+        }
+    }
+
+    TArray<cardano_derivation_path_t> Paths;
+    for (const FCardanoKeyLocation& Location : Locations)
+    {
+        Paths.Add(Location.ToDerivationPath());
+    }
+
+    if (Paths.Num() == 0)
+    {
+        OnComplete.ExecuteIfBound(false, TArray<uint8>(), TEXT("No input of the transaction belongs to the wallet"));
+        return;
+    }
+
+    TSharedPtr<FWalletKeys, ESPMode::ThreadSafe> Keys = Found->Keys;
+    Async(EAsyncExecution::ThreadPool, [Keys, UnsignedTransaction, Password, Paths = MoveTemp(Paths), OnComplete]()
+        {
+            TArray<uint8> Signed;
+            FString Error;
+            bool bSigned = false;
+            {
+                FScopeLock Lock(&Keys->Lock);
+                const FCardanoScopedPassphrase Passphrase(Password);
+                bSigned = FCardanoSigningPipeline::SignTransaction(Keys->KeyHandler.Get(), UnsignedTransaction, Paths, Signed, Error);
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [bSigned, Signed = MoveTemp(Signed), Error, OnComplete]()
+                {
+                    OnComplete.ExecuteIfBound(bSigned, Signed, Error);
+                });
+        });
+}
@@ -0,0 +1,67 @@
+#include "CardanoWarmUp.h"
+#include "CardanoLog.h"
+#include "Async/Async.h"
+#include "Misc/ConfigCacheIni.h"
+#include <cardano/bip39.h>
+#include <cardano/crypto/bip32_private_key.h>
+#include <cardano/crypto/bip32_public_key.h>
+#include <sodium.h>
+
+/** The account key path of the first wallet, 1852'/1815'/0', as RestoreWallet derives it. */
+static const uint32_t WARM_UP_ACCOUNT_PATH[] = { 0x80000000U | 1852U, 0x80000000U | 1815U, 0x80000000U };
+
+bool FCardanoWarmUp::InitializeSodium()
+{
+    // sodium_init takes a lock on every call, which is pointless once it succeeded
+    static const bool bInitialized = sodium_init() >= 0;
+    return bInitialized;
+}
+
+void FCardanoWarmUp::Start()
+{
+    bool bWarmUp = true;
+    if (GConfig)
+    {
+        GConfig->GetBool(TEXT("CardanoPlugin"), TEXT("bWarmUpOnStartup"), bWarmUp, GGameIni);
+    }
+
+    if (!bWarmUp)
+    {
+        return;
+    }
+
+    Async(EAsyncExecution::ThreadPool, []()
+        {
+            const double StartTime = FPlatformTime::Seconds();
+
+            if (!InitializeSodium())
+            {
+                UE_LOG(LogCardano, Error, TEXT("Libsodium initialization failed"));
+                return;
+            }
+
+            // The key is derived from an all-zero entropy and thrown away; it never leaves this scope
+            byte_t entropy[32] = { 0 };
+            const char* words[24] = { nullptr };
+            size_t word_count = 0;
+            size_t entropy_size = 0;
+            bool bSuccess = cardano_bip39_entropy_to_mnemonic_words(entropy, sizeof(entropy), words, &word_count) == CARDANO_SUCCESS &&
+                cardano_bip39_mnemonic_words_to_entropy(words, word_count, entropy, sizeof(entropy), &entropy_size) == CARDANO_SUCCESS;
+
+            cardano_bip32_private_key_t* root_key = nullptr;
+            cardano_bip32_private_key_t* account_key = nullptr;
+            cardano_bip32_public_key_t* public_key = nullptr;
+            bSuccess = bSuccess &&
+                cardano_bip32_private_key_from_bip39_entropy(nullptr, 0, entropy, entropy_size, &root_key) == CARDANO_SUCCESS &&
+                cardano_bip32_private_key_derive(root_key, WARM_UP_ACCOUNT_PATH, UE_ARRAY_COUNT(WARM_UP_ACCOUNT_PATH), &account_key) == CARDANO_SUCCESS &&
+                cardano_bip32_private_key_get_public_key(account_key, &public_key) == CARDANO_SUCCESS;
+
+            cardano_bip32_public_key_unref(&public_key);
+            cardano_bip32_private_key_unref(&account_key);
+            cardano_bip32_private_key_unref(&root_key);
+            sodium_memzero(entropy, sizeof(entropy));
+
+            UE_LOG(LogCardano, Log, TEXT("Cardano warm-up %s in %.1f ms"), bSuccess ? TEXT("finished") : TEXT("failed"),
+                (FPlatformTime::Seconds() - StartTime) * 1000.0);
+        });
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * One-time initialization the first wallet operation would otherwise pay for. libsodium is initialized once, and
+ * the warm-up started by the module runs a throwaway mnemonic round trip and key derivation on the thread pool, so
+ * the code and tables behind them are paged in and libsodium has picked its CPU-specific implementations. The Koios
+ * connection, cached protocol parameters and UTxO snapshot are already set up by their engine subsystems.
+ * Turned off with bWarmUpOnStartup=false in the [CardanoPlugin] section of DefaultGame.ini.
+ */
+struct FCardanoWarmUp
+{
+    /** Initializes libsodium on the first call and returns whether that succeeded. Safe from any thread. */
+    static bool InitializeSodium();
+
+    /** Runs the warm-up on the thread pool, unless disabled by config. */
+    static void Start();
+};
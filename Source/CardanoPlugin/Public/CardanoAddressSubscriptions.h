@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "CardanoHash.h"
+#include "CardanoTypes.h"
+#include "CardanoAddressSubscriptions.generated.h"
+
+/** The UTxOs Address gained and lost since the last update, and the balance they leave it with. */
+DECLARE_DYNAMIC_DELEGATE_FourParams(FOnCardanoAddressUpdate, const FString&, Address, const FAddressBalance&, Balance,
+    const TArray<FUTxO>&, AddedUTxOs, const TArray<FUTxO>&, SpentUTxOs);
+
+/**
+ * Pushes balance and UTxO changes of addresses to their subscribers, instead of each of them polling Koios.
+ * Subscribed addresses are watched in UCardanoUTxOCache, which UCardanoChainFollower keeps current block by block
+ * for a couple of requests per poll whatever the number of addresses. Whenever the cache reports that the UTxOs of
+ * an address may have changed, its set is compared with the one last delivered and the subscribers are only called
+ * if it differs, with the UTxOs added and spent since. The first update after subscribing holds every UTxO of the
+ * address as added, and comes on a later tick once the address is downloaded.
+ * All methods must be called on the game thread.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoAddressSubscriptions : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide subscriptions, or nullptr before the engine is initialized. */
+    static UCardanoAddressSubscriptions* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Calls OnUpdate whenever the UTxOs of Address change. Returns the subscription id, never 0. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Subscriptions")
+    int32 Subscribe(const FString& Address, const FOnCardanoAddressUpdate& OnUpdate);
+
+    /** Stops the updates of a subscription; the address is unwatched with its last subscriber if it was watched for it. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Subscriptions")
+    void Unsubscribe(int32 SubscriptionId);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Subscriptions")
+    int32 GetSubscriptionCount() const { return SubscriptionAddresses.Num(); }
+
+private:
+    struct FAddressSubscribers
+    {
+        TMap<int32, FOnCardanoAddressUpdate> Delegates;
+
+        /** Subscriptions still owed the full UTxO set, rather than what changed. */
+        TSet<int32> Joining;
+
+        /** What the subscribers were last told the address holds. */
+        TMap<FCardanoUTxORef, FUTxO> Delivered;
+        bool bDelivered = false;
+
+        /** The address was not watched before its first subscriber. */
+        bool bOwnsWatch = false;
+    };
+
+    void OnUTxOsChanged(const TSet<FString>& ChangedAddresses);
+
+    /** Brings the subscribers of Address up to the cache, if it has downloaded the address. */
+    void Deliver(const FString& Address);
+
+    /** Starts UCardanoChainFollower for the first subscription, if it is not running; otherwise subscriptions only see refreshes. */
+    UPROPERTY(Config)
+    bool bStartChainFollower = true;
+
+    TMap<FString, FAddressSubscribers> Addresses;
+    TMap<int32, FString> SubscriptionAddresses;
+    int32 NextSubscriptionId = 1;
+    FDelegateHandle UTxOsChangedHandle;
+};
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Containers/List.h"
+#include "Containers/Ticker.h"
+#include "CardanoTypes.h"
+#include "CardanoAssetMetadataCache.generated.h"
+
+UENUM(BlueprintType)
+enum class ECardanoAssetMetadataStandard : uint8
+{
+    /** Koios knows the asset but nothing describes it; only the fingerprint and the asset name are set. */
+    None,
+    /** Metadata label 721 of the minting transaction. */
+    Cip25,
+    /** Datum of the asset's (100) reference token. */
+    Cip68,
+    /** Cardano token registry entry. */
+    Registry,
+};
+
+/** What wallets show for a native token, whichever standard it comes from. */
+USTRUCT(BlueprintType)
+struct FCardanoAssetMetadata
+{
+    GENERATED_BODY()
+
+    /** Hex of the policy id followed by the asset name, the bytes of a cardano_asset_id_t. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|AssetMetadata")
+    FString AssetId;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|AssetMetadata")
+    FString PolicyId;
+
+    /** Hex encoded, as in FTokenBalance. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|AssetMetadata")
+    FString AssetName;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|AssetMetadata")
+    FString Fingerprint;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|AssetMetadata")
+    ECardanoAssetMetadataStandard Standard = ECardanoAssetMetadataStandard::None;
+
+    /** The metadata name, or the asset name itself when it is printable. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|AssetMetadata")
+    FString DisplayName;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|AssetMetadata")
+    FString Ticker;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|AssetMetadata")
+    FString Description;
+
+    /** As given by the metadata: ipfs://, https:// or data: URI. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|AssetMetadata")
+    FString Image;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|AssetMetadata")
+    FString MediaType;
+
+    /** Digits of Quantity after the decimal point when displayed. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|AssetMetadata")
+    int32 Decimals = 0;
+
+    /** Unix time the metadata was fetched at. */
+    UPROPERTY()
+    int64 FetchedAt = 0;
+};
+
+/** On-disk form of the cache. */
+USTRUCT()
+struct FCardanoAssetMetadataFile
+{
+    GENERATED_BODY()
+    UPROPERTY()
+    TArray<FCardanoAssetMetadata> Assets;
+};
+
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnAssetMetadataResult, bool, Success, const TArray<FCardanoAssetMetadata>&, Metadata, const FString&, ErrorMessage);
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnAssetImageResult, bool, Success, const TArray<uint8>&, ImageBytes, const FString&, ErrorMessage);
+
+/**
+ * Names, tickers and images of native tokens, fetched with Koios asset_info once and then served from memory and
+ * Saved/Cardano/AssetMetadata.json, so an inventory of hundreds of tokens does not cost a request per token.
+ * Unknown assets are fetched in batches; assets requested while a batch is running wait for it instead of being
+ * asked for twice. CIP-25 metadata is read from the minting transaction's label 721. For CIP-68 user and fungible
+ * tokens the reference token is fetched along and its datum decoded.
+ * Images are downloaded on demand, ipfs:// ones through IpfsGatewayUrl, and kept in a least recently used cache
+ * bounded by MaxImageCacheBytes.
+ * All methods must be called on the game thread.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoAssetMetadataCache : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide cache, or nullptr before the engine is initialized. */
+    static UCardanoAssetMetadataCache* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** The cache key of a token: its policy id followed by its hex asset name, lower case. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|AssetMetadata")
+    static FString MakeAssetId(const FString& PolicyId, const FString& AssetName);
+
+    /**
+     * Metadata of Assets in the same order, fetching those not cached or older than MaxAgeHours. On failure,
+     * Metadata holds the assets that were cached or fetched.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|AssetMetadata")
+    void GetMetadata(const TArray<FTokenBalance>& Assets, const FOnAssetMetadataResult& OnComplete);
+
+    /** Cached metadata only, without any request. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|AssetMetadata")
+    bool FindMetadata(const FString& PolicyId, const FString& AssetName, FCardanoAssetMetadata& OutMetadata) const;
+
+    /** Bytes of the asset's image, as encoded by its source (PNG, JPEG, SVG...). The metadata is fetched first if needed. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|AssetMetadata")
+    void GetImage(const FString& PolicyId, const FString& AssetName, const FOnAssetImageResult& OnComplete);
+
+    /** The URL an image is downloaded from: ipfs:// URIs go through IpfsGatewayUrl, others are unchanged. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|AssetMetadata")
+    FString ResolveImageUrl(const FString& Image) const;
+
+    /** Drops the cached metadata and images, in memory and on disk. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|AssetMetadata")
+    void Clear();
+
+private:
+    struct FMetadataRequest;
+
+    struct FImageDownload
+    {
+        FString Url;
+        TArray<FOnAssetImageResult> Callbacks;
+    };
+
+    struct FCachedImage
+    {
+        TArray<uint8> Bytes;
+        TDoubleLinkedList<FString>::TDoubleLinkedListNode* Node = nullptr;
+    };
+
+    bool IsFresh(const FCardanoAssetMetadata& Entry, int64 Now) const;
+    void FetchBatch(const TArray<FString>& AssetIds);
+    void CompleteAsset(const FString& AssetId, const FString& ErrorMessage);
+    void FinishRequest(const FMetadataRequest& Request);
+
+    void LoadFromDisk();
+
+    /** Saves at most once a second, however many batches complete meanwhile. */
+    void ScheduleSave();
+    bool SaveToDisk(float DeltaTime);
+
+    void RequestImage(const FString& Url, const FOnAssetImageResult& OnComplete);
+    void StartImageDownloads();
+    void OnImageDownloaded(const FString& Url, FHttpResponsePtr Response, bool Success);
+    const TArray<uint8>* FindImage(const FString& Url);
+    void AddImage(const FString& Url, TArray<uint8>&& Bytes);
+
+    FString GetCacheFilePath() const;
+
+    /** Reads CIP-68 metadata again after this long, since reference datums can be updated; other standards are immutable. */
+    UPROPERTY(Config)
+    int32 MaxAgeHours = 168;
+
+    UPROPERTY(Config)
+    FString IpfsGatewayUrl = TEXT("https://ipfs.io/ipfs/");
+
+    /** Bytes of images kept in memory; the least recently used ones are dropped above it. */
+    UPROPERTY(Config)
+    int64 MaxImageCacheBytes = 64 * 1024 * 1024;
+
+    /** Images larger than this are not downloaded. */
+    UPROPERTY(Config)
+    int32 MaxImageBytes = 4 * 1024 * 1024;
+
+    /** Image downloads running at once; the others wait their turn. */
+    UPROPERTY(Config)
+    int32 MaxConcurrentImageDownloads = 4;
+
+    TMap<FString, FCardanoAssetMetadata> Cached;
+
+    /** Asset ids being fetched, with the requests waiting for them. */
+    TMap<FString, TArray<TSharedRef<FMetadataRequest>>> InFlight;
+
+    TMap<FString, FCachedImage> Images;
+
+    /** Image URLs, most recently used first. */
+    TDoubleLinkedList<FString> ImageOrder;
+    int64 ImageCacheBytes = 0;
+
+    TMap<FString, FImageDownload> ImageDownloads;
+    TArray<FString> QueuedImageUrls;
+    int32 ActiveImageDownloads = 0;
+
+    FDelegateHandle SaveHandle;
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "CardanoTypes.h"
+#include "CardanoAsyncQueries.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCardanoBalanceQuery, const FAddressBalance&, Balance, const FString&, ErrorMessage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCardanoUTxOsQuery, const TArray<FUTxO>&, UTxOs, const FString&, ErrorMessage);
+
+/**
+ * Fetches the balance of an address into storage the query owns, unlike UCardanoBlueprintLibrary::GetAddressBalance
+ * which writes through a reference the caller must keep alive. The response is decoded into a private copy, off the
+ * game thread when large, and moved into the query once back on the game thread. The query keeps itself alive until
+ * it has broadcast, so any number can run concurrently. In C++, TakeBalance moves the result out from a handler.
+ * Queries for an address that already has one in flight join it: one request is sent and parsed for all of them.
+ */
+UCLASS()
+class CARDANOPLUGIN_API UCardanoGetAddressBalanceAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "Cardano", meta = (BlueprintInternalUseOnly = "true"))
+    static UCardanoGetAddressBalanceAction* GetAddressBalanceAsync(const FString& Address);
+
+    UPROPERTY(BlueprintAssignable)
+    FOnCardanoBalanceQuery OnSuccess;
+
+    UPROPERTY(BlueprintAssignable)
+    FOnCardanoBalanceQuery OnFailure;
+
+    virtual void Activate() override;
+
+    /**
+     * Abandons the query without broadcasting. The shared request is withdrawn from the Koios client, or aborted if
+     * already sent, once no other query waits on it, so its response is never parsed.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano")
+    void Cancel();
+
+    /** Moves the balance out of the query; valid once OnSuccess is broadcast. */
+    FAddressBalance TakeBalance() { return MoveTemp(Balance); }
+
+private:
+    friend struct FCardanoSharedQueries;
+
+    void Finish(bool bSuccess, const FString& ErrorMessage);
+
+    FString Address;
+    FAddressBalance Balance;
+    bool bFinished = false;
+};
+
+/**
+ * Fetches the UTxOs of an address into storage the query owns, unlike UCardanoBlueprintLibrary::GetAddressUTXOs
+ * which writes through a pointer the caller must keep alive. Works as UCardanoGetAddressBalanceAction; an address
+ * holding no UTxO succeeds with an empty array, and concurrent queries for one address share a request. In C++,
+ * TakeUTxOs moves the result out from a handler.
+ */
+UCLASS()
+class CARDANOPLUGIN_API UCardanoGetAddressUTxOsAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "Cardano", meta = (BlueprintInternalUseOnly = "true"))
+    static UCardanoGetAddressUTxOsAction* GetAddressUTxOsAsync(const FString& Address);
+
+    UPROPERTY(BlueprintAssignable)
+    FOnCardanoUTxOsQuery OnSuccess;
+
+    UPROPERTY(BlueprintAssignable)
+    FOnCardanoUTxOsQuery OnFailure;
+
+    virtual void Activate() override;
+
+    /**
+     * Abandons the query without broadcasting. The shared request is withdrawn from the Koios client, or aborted if
+     * already sent, once no other query waits on it, so its response is never parsed.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano")
+    void Cancel();
+
+    /** Moves the UTxOs out of the query; valid once OnSuccess is broadcast. */
+    TArray<FUTxO> TakeUTxOs() { return MoveTemp(UTxOs); }
+
+private:
+    friend struct FCardanoSharedQueries;
+
+    void Finish(bool bSuccess, const FString& ErrorMessage);
+
+    FString Address;
+    TArray<FUTxO> UTxOs;
+    bool bFinished = false;
+};
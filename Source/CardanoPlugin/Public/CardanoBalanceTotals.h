@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoTypes.h"
+#include "CardanoQuantity.h"
+
+/**
+ * Running lovelace and per-asset totals of a set of UTxOs, updated by each UTxO added or spent, so a balance is
+ * read in O(assets) without walking the UTxOs again, and holds each asset once however many UTxOs carry it.
+ * Quantities are parsed once as they are added and summed as FCardanoQuantity, exactly, however many UTxOs carry
+ * them; an asset is dropped when its total reaches zero.
+ * Not thread-safe.
+ */
+class CARDANOPLUGIN_API FCardanoBalanceTotals
+{
+public:
+    void Add(const FUTxO& UTxO);
+
+    /** Subtracts a UTxO previously added; totals never go below zero. */
+    void Remove(const FUTxO& UTxO);
+
+    void AddToken(const FTokenBalance& Token);
+    void RemoveToken(const FTokenBalance& Token);
+
+    /** Adds every total of Other, e.g. to sum the addresses of a wallet. */
+    void Append(const FCardanoBalanceTotals& Other);
+
+    void Reset();
+
+    int64 GetLovelace() const { return Lovelace; }
+    int32 NumAssets() const { return Assets.Num(); }
+
+    /** Total of one asset, zero if none is held. */
+    FCardanoQuantity GetQuantity(const FString& PolicyId, const FString& AssetName) const;
+
+    /** Writes the totals, one token per asset. */
+    void ToBalance(FAddressBalance& OutBalance) const;
+    void GetTokens(TArray<FTokenBalance>& OutTokens) const;
+
+    /** Merges the entries of Tokens that name the same asset, such as the per-UTxO asset lists of address_info. */
+    static void MergeTokens(TArray<FTokenBalance>& Tokens);
+
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    struct FAssetKey
+    {
+        FString PolicyId;
+        FString AssetName;
+
+        bool operator==(const FAssetKey& Other) const { return PolicyId == Other.PolicyId && AssetName == Other.AssetName; }
+
+        friend uint32 GetTypeHash(const FAssetKey& Key) { return HashCombine(GetTypeHash(Key.PolicyId), GetTypeHash(Key.AssetName)); }
+    };
+
+    void AddQuantity(const FString& PolicyId, const FString& AssetName, const FCardanoQuantity& Quantity);
+    void RemoveQuantity(const FString& PolicyId, const FString& AssetName, const FCardanoQuantity& Quantity);
+
+    int64 Lovelace = 0;
+    TMap<FAssetKey, FCardanoQuantity> Assets;
+};
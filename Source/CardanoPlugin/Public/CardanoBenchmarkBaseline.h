@@ -0,0 +1,147 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Repeated measurements of one benchmark, one value per repetition; lower is better for every unit. */
+struct CARDANOPLUGIN_API FCardanoBenchmarkSamples
+{
+    /** Case name, e.g. "coin_selection/large_first/1000" or "http/balance/p50". */
+    FString Name;
+
+    /** "ns" per operation, or "ms" of latency. */
+    FString Unit;
+
+    TArray<double> Values;
+
+    double GetMean() const;
+
+    /** Sample standard deviation; zero below two values. */
+    double GetStdDev() const;
+};
+
+/** A captured run of the suite on one machine profile. */
+struct CARDANOPLUGIN_API FCardanoBenchmarkBaseline
+{
+    FString Profile;
+
+    /** UTC, ISO 8601. */
+    FString Date;
+
+    /** cardano_get_lib_version() of the run. */
+    FString LibraryVersion;
+
+    TArray<FCardanoBenchmarkSamples> Benchmarks;
+};
+
+enum class ECardanoBenchmarkVerdict : uint8
+{
+    /** The confidence interval includes no change. */
+    Unchanged,
+    Faster,
+
+    /** Slower beyond the noise, but by less than the threshold. */
+    Slower,
+
+    /** Slower beyond the noise and by more than the threshold; fails the comparison. */
+    Regressed,
+
+    /** Run on only one side of the comparison. */
+    Missing,
+};
+
+/** One benchmark of an FCardanoBenchmarkComparison. Percentages are of the baseline mean; positive is slower. */
+struct CARDANOPLUGIN_API FCardanoBenchmarkDelta
+{
+    FString Name;
+    FString Unit;
+    double BaselineMean = 0.0;
+    double CurrentMean = 0.0;
+    double DeltaPercent = 0.0;
+
+    /** 95% confidence interval of DeltaPercent, from Welch's t-test over the repetitions of both runs. */
+    double LowPercent = 0.0;
+    double HighPercent = 0.0;
+
+    double ThresholdPercent = 0.0;
+    ECardanoBenchmarkVerdict Verdict = ECardanoBenchmarkVerdict::Unchanged;
+};
+
+struct CARDANOPLUGIN_API FCardanoBenchmarkComparison
+{
+    FString Profile;
+    FString BaselineDate;
+    FString BaselineLibraryVersion;
+    FString LibraryVersion;
+
+    /** In the order of the current run, then the benchmarks only the baseline has. */
+    TArray<FCardanoBenchmarkDelta> Deltas;
+
+    int32 Regressions = 0;
+};
+
+/** Slowdown allowed for the benchmarks whose name starts with Prefix; the longest matching prefix applies. */
+struct CARDANOPLUGIN_API FCardanoBenchmarkThreshold
+{
+    FString Prefix;
+    double Percent = 10.0;
+};
+
+/** Settings of one FCardanoBenchmarkSuite run. */
+struct CARDANOPLUGIN_API FCardanoBenchmarkSuiteConfig
+{
+    /** Runs of every case; the confidence intervals need at least two, and narrow as this grows. */
+    int32 Repetitions = 5;
+
+    /** Per case and repetition, as in FCardanoLibraryBenchmark::Run. */
+    double MinSecondsPerCase = 0.2;
+
+    /** Runs FCardanoLoadTest against the mock server once per repetition, for the latencies of the HTTP pipeline. */
+    bool bHttp = true;
+    int32 HttpWallets = 20;
+    float HttpSeconds = 10.0f;
+};
+
+DECLARE_DELEGATE_OneParam(FOnCardanoBenchmarkSuiteComplete, const TArray<FCardanoBenchmarkSamples>&);
+
+/**
+ * Catches slowdowns of the vendored cardano-c or of the plugin by comparing a run of the benchmarks against a baseline
+ * captured on the same machine profile. A run repeats every case of FCardanoLibraryBenchmark (CBOR, crypto,
+ * balancing), the Koios JSON decoders, and the per-stage latencies of FCardanoLoadTest against the mock server.
+ * The repetitions give each case a mean and a spread. A comparison reports each case's change with a 95%
+ * confidence interval, and fails on cases that are slower beyond the noise by more than their threshold.
+ *
+ * Baselines and compared runs are saved as JSON under Saved/Cardano/Benchmarks/<profile>. The profile names the
+ * platform, CPU, core count and build type, since numbers from different machines do not compare.
+ *
+ * Also available from the console as
+ * `Cardano.BenchmarkBaseline capture|compare [Repetitions] [profile=<name>] [threshold=[<prefix>:]<percent>...] [nohttp] [exit]`.
+ * With `exit`, the process exits once the run ends, with status 1 if a case regressed, for use from CI with -ExecCmds.
+ */
+class CARDANOPLUGIN_API FCardanoBenchmarkSuite
+{
+public:
+    /**
+     * Runs every case Config.Repetitions times: the cardano-c and JSON cases on a dedicated thread, then the load tests,
+     * one after the other. Start it from the game thread and keep ticking the engine; OnComplete is called on the game
+     * thread.
+     */
+    static void Run(const FCardanoBenchmarkSuiteConfig& Config, FOnCardanoBenchmarkSuiteComplete OnComplete);
+
+    /** Names this machine, e.g. "Windows-AMD_Ryzen_9_5950X_16-Core_Processor-32t-release". */
+    static FString GetMachineProfile();
+
+    /** Saved/Cardano/Benchmarks/<Profile>. */
+    static FString GetProfileDirectory(const FString& Profile);
+
+    static FString ToJson(const FCardanoBenchmarkBaseline& Baseline);
+    static bool FromJson(const FString& Json, FCardanoBenchmarkBaseline& OutBaseline);
+
+    /** 10% for the cardano-c and JSON cases and 25% for the noisier HTTP latencies. */
+    static TArray<FCardanoBenchmarkThreshold> GetDefaultThresholds();
+
+    static FCardanoBenchmarkComparison Compare(const FCardanoBenchmarkBaseline& Baseline, const FCardanoBenchmarkBaseline& Current,
+        const TArray<FCardanoBenchmarkThreshold>& Thresholds);
+
+    /** Formats a comparison as a fixed-width table, one line per case, followed by the number of regressions. */
+    static FString FormatComparison(const FCardanoBenchmarkComparison& Comparison);
+};
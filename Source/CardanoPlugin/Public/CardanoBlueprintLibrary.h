@@ -4,9 +4,14 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Http.h"
 #include "Json.h"
+#include "CardanoLog.h"
+#include "CardanoSubmissionQueue.h"
 #include "CardanoTypes.h"
+#include "CardanoWalletTypes.h"
+#include "CardanoWalletSubsystem.h"
 #include <cardano/cardano.h>
 #include <cardano/key_handlers/account_derivation_path.h>
+#include <cardano/key_handlers/secure_key_handler.h>
 #include "CardanoBlueprintLibrary.generated.h"
 
 /**
@@ -27,28 +32,18 @@ struct FTransactionInput
     FString TxHash;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|Wallet")
-    int32 TxIndex;
+    int32 TxIndex = 0;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|Wallet")
-    int64 Value;
+    int64 Value = 0;
 
+    /** Address of the output spent; its payment key is found among the addresses derived by DeriveAddresses and DiscoverWalletAddresses. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|Wallet")
     FString PaymentAddress;
 
+    /** External address index of account 0 whose key signs the input when PaymentAddress is not a derived one. */
     UPROPERTY(BlueprintReadWrite, Category = "TransactionInput")
-    int32 AddressIndex;
-};
-
-USTRUCT(BlueprintType)
-struct FTransactionOutput 
-{
-    GENERATED_BODY()
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|Wallet")
-    FString Address;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|Wallet")
-	int64 Value;
+    int32 AddressIndex = 0;
 };
 
 UCLASS()
@@ -60,15 +55,100 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
     static void GenerateWallet(TArray<FString>& OutMnemonicWords, FString& OutAddress);
 
+    /** Restores address 0/0 only; use DiscoverWalletAddresses to find the other addresses holding funds. */
     UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
     static void RestoreWallet(const TArray<FString>& MnemonicWords, FString& OutAddress, const FString& Password = TEXT("password"));
 
+    /**
+     * Runs GenerateWallet on a thread-pool worker and reports the result on the game thread.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    static void GenerateWalletAsync(const FOnWalletResult& OnComplete);
+
+    /**
+     * Runs RestoreWallet on a thread-pool worker and reports the result on the game thread.
+     * Several restores may be in flight at once; each one gets its own worker.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    static void RestoreWalletAsync(const TArray<FString>& MnemonicWords, const FOnWalletResult& OnComplete, const FString& Password = TEXT("password"));
+
+    /**
+     * Derives Count consecutive base addresses m/1852'/1815'/AccountIndex'/Role/(StartIndex + i), all sharing
+     * the stake key at index 0. The account key is derived once; each address costs only two soft derivations.
+     * Large batches are split across worker threads. Returns false if any address could not be derived.
+     * Their payment keys are indexed, so transactions spending from them are signed with the right keys.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    static bool DeriveAddresses(
+        const TArray<FString>& MnemonicWords,
+        int32 AccountIndex,
+        int32 Role,
+        int32 StartIndex,
+        int32 Count,
+        TArray<FString>& OutAddresses,
+        const FString& Password = TEXT("password"),
+        ECardanoNetwork Network = ECardanoNetwork::Mainnet);
+
+    /**
+     * Encodes one address per entry of Credentials, such as script addresses for test networks or many provisioned
+     * enterprise addresses. Credentials are the payment credentials, or the stake credentials of reward addresses.
+     * Base addresses take one stake credential per address, or a single one they share. Each address is encoded
+     * straight from the hashes, without cardano-c objects; large batches are split across worker threads.
+     * Returns false, with no addresses, if the stake credentials do not fit Kind.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    static bool MakeAddresses(
+        ECardanoAddressKind Kind,
+        ECardanoNetwork Network,
+        const TArray<FCardanoCredential>& Credentials,
+        const TArray<FCardanoCredential>& StakeCredentials,
+        TArray<FString>& OutAddresses);
+
+    /**
+     * Finds every used address of an account, as a restoring wallet must: RestoreWallet only yields address 0/0.
+     * The external and internal chains are scanned in windows of GapLimit addresses; all active chains' windows go
+     * to Koios in one address_info request per round (chunked by UCardanoKoiosClient::GetMaxAddressesPerRequest()),
+     * and the next window is derived on a worker thread while the current query is in flight. A chain stops after a
+     * window with no used address. An address counts as used if Koios knows it, even with a zero balance.
+     * The payment keys of every address scanned are indexed, as DeriveAddresses does.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    static void DiscoverWalletAddresses(
+        const TArray<FString>& MnemonicWords,
+        int32 AccountIndex,
+        const FOnWalletDiscoveryResult& OnComplete,
+        int32 GapLimit = 20,
+        const FString& Password = TEXT("password"));
+
     UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
     static void GetAddressBalance(const FString& Address, FAddressBalance& OutBalance, const FOnBalanceResult& OnComplete);
 
+    /**
+     * Fetches the balances of many addresses with one address_info request per chunk of
+     * UCardanoKoiosClient::GetMaxAddressesPerRequest() addresses. Chunks run concurrently.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    static void GetBalancesForAddresses(const TArray<FString>& Addresses, const FOnBalancesResult& OnComplete);
+
+    /**
+     * Fetches the UTxOs of many addresses with one address_utxos request per chunk of
+     * UCardanoKoiosClient::GetMaxAddressesPerRequest() addresses. Chunks run concurrently.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano")
+    static void GetUTxOsForAddresses(const TArray<FString>& Addresses, const FOnAddressUTxOsResult& OnComplete);
+
+    /**
+     * Submits a signed transaction once, without tracking it; see UCardanoSubmissionQueue to follow it until it
+     * confirms. OnComplete tells why a rejected transaction was refused, e.g. to select other inputs on InputsSpent.
+     */
     UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
-    static void SubmitTransactionWithKoios(const TArray<uint8>& TransactionBytes, const FString& KoiosApiEndpoint);
+    static void SubmitTransactionWithKoios(const TArray<uint8>& TransactionBytes, const FString& KoiosApiEndpoint, const FOnTransactionSubmitted& OnComplete);
 
+    /**
+     * TTL is an absolute slot; pass 0 to expire two hours after the current slot reported by UCardanoChainTip.
+     * Adds one witness per distinct key locking the inputs, located by FTransactionInput::PaymentAddress or else
+     * AddressIndex; fails if the key at that location does not match the payment credential of PaymentAddress.
+     */
     UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
     static TArray<uint8> BuildTransaction(
         const TArray<FTransactionInput>& Inputs,
@@ -78,15 +158,70 @@ public:
         int64 TTL, 
         const TArray<FString>& MnemonicWords);
 
+    /**
+     * Builds the transaction of BuildTransaction and signs it with the keys of a wallet loaded in
+     * UCardanoWalletSubsystem, whose key handler is set up once when the wallet is added instead of the spending
+     * key being derived again from the mnemonic on every call. The inputs must be among the wallet's cached UTxOs.
+     * Signing runs on a worker thread; OnComplete fires on the game thread.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    static void BuildWalletTransaction(
+        const TArray<FTransactionInput>& Inputs,
+        const FString& ReceiverAddress,
+        int64 AmountLovelace,
+        int64 FeeLovelace,
+        int64 TTL,
+        FCardanoWalletHandle Wallet,
+        const FString& Password,
+        const FOnWalletSigned& OnComplete);
+
+    /**
+     * Builds the transaction of BuildTransaction and signs it through KeyHandler with FCardanoSigningPipeline, one
+     * witness per derivation path. Empty DerivationPaths take the keys of the inputs, located as BuildTransaction
+     * does. Keep the key handler for the session rather than creating one per transaction.
+     * Blocks while signing; KeyHandler must not be used concurrently.
+     */
+    static TArray<uint8> BuildTransactionWithKeyHandler(
+        const TArray<FTransactionInput>& Inputs,
+        const FString& ReceiverAddress,
+        int64 AmountLovelace,
+        int64 FeeLovelace,
+        int64 TTL,
+        cardano_secure_key_handler_t* KeyHandler,
+        const TArray<cardano_derivation_path_t>& DerivationPaths,
+        FString& OutError);
+
     UFUNCTION(BlueprintCallable, Category = "Cardano")
     static void GetAddressUTXOs(const FString& Address, TArray<FUTxO>& OutUTxOs, const FOnUTxOsResult& OnComplete);
 
+    /**
+     * Fetches every UTxO of an address in pages of PageSize rows (Koios offset/limit), so addresses holding more
+     * rows than the server's response cap are returned completely. Each page is parsed with a streaming JSON reader
+     * directly into the result array; OnProgress fires after every page.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano")
+    static void GetAddressUTXOsPaged(const FString& Address, const FOnUTxOPageProgress& OnProgress, const FOnPagedUTxOsResult& OnComplete, int32 PageSize = 1000);
+
+    /** Fetches the current epoch's protocol parameters from Koios, for use with UCardanoTxBuilder. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano")
+    static void GetProtocolParameters(const FOnProtocolParametersResult& OnComplete);
+
+    /** Approximate: a float keeps about 7 significant digits. Use LovelaceToAdaString for amounts shown or compared. */
     UFUNCTION(BlueprintPure, Category = "Cardano|Math")
     static float LovelaceToAda(const int64 Lovelace);
 
+    /** Rounds to the nearest lovelace the float can tell apart; use AdaStringToLovelace for typed amounts. */
     UFUNCTION(BlueprintPure, Category = "Cardano|Math")
     static int64 AdaToLovelace(const float Ada);
 
+    /** Exact ada amount, such as "12.5" for 12500000 lovelace. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Math")
+    static FString LovelaceToAdaString(const int64 Lovelace);
+
+    /** Parses an exact ada amount with up to 6 decimals. Returns false, leaving 0, if Ada is not one or does not fit. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Math")
+    static bool AdaStringToLovelace(const FString& Ada, int64& OutLovelace);
+
     UFUNCTION(BlueprintCallable, Category = "Cardano")
     static TArray<FTransactionInput> ConvertUTxOsToInputs(const TArray<FUTxO>& UTxOs)
     {
@@ -99,7 +234,7 @@ public:
             Input.Value = UTxO.Value;
             Inputs.Add(Input);
         
-            UE_LOG(LogTemp, Log, TEXT("Converting UTXO to Input - Hash: %s, Index: %d, Value: %lld"),
+            UE_LOG(LogCardano, VeryVerbose, TEXT("Converting UTXO to Input - Hash: %s, Index: %d, Value: %lld"),
                 *Input.TxHash, Input.TxIndex, Input.Value);
         }
         return Inputs;
@@ -108,4 +243,7 @@ public:
 private:
     static int32 GetPassphrase(byte_t* buffer, size_t buffer_len);
 
+    /** Derives the extended public key of m/1852'/1815'/AccountIndex'; every address below it is a soft derivation. */
+    static bool DeriveAccountPublicKey(const TArray<FString>& MnemonicWords, int32 AccountIndex, const FString& Password, TArray<uint8>& OutAccountKey);
+
 };
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "CardanoCredentialFilter.h"
+#include "CardanoChainFollower.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnChainFollowerActivity, const FString&, Address, const FString&, TxHash, int64, BlockHeight);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnChainFollowerRollback, int64, BlockHeight);
+
+/**
+ * Follows the chain from the tip, one block at a time, and keeps UCardanoUTxOCache current from it.
+ * Every few seconds the blocks after the last one seen are listed through Koios, their transactions are
+ * read with block_tx_info, and each input and output is matched against the payment credentials and stake
+ * addresses of the watched addresses, kept in a FCardanoCredentialFilter that is updated as addresses are
+ * watched. The cost is a couple of requests per poll whatever the number of wallets, instead of a delta
+ * query per batch of addresses.
+ * The hashes of the last SecurityParameter blocks are kept: when Koios switches to another fork, the
+ * follower finds the last block both agree on, the cache undoes the blocks after it, and OnRollback fires.
+ * All methods must be called on the game thread.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoChainFollower : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide follower, or nullptr before the engine is initialized. */
+    static UCardanoChainFollower* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /**
+     * Starts following from the current tip and hands the UTxO cache over to it. The watched addresses
+     * not synced up to the tip yet are brought up to it by one UTxO cache refresh.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|ChainFollower")
+    void Start();
+
+    /** Stops following; the UTxO cache goes back to being brought up to date by RefreshAll. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|ChainFollower")
+    void Stop();
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|ChainFollower")
+    bool IsFollowing() const { return bFollowing; }
+
+    /** Height of the last block applied, or 0 before the first one. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|ChainFollower")
+    int64 GetBlockHeight() const { return RecentBlocks.Num() > 0 ? RecentBlocks.Last().Height : 0; }
+
+    /**
+     * Also matches the outputs and inputs of every address delegated to StakeAddress, e.g. to learn about
+     * payments to addresses of a wallet that are not watched yet through OnActivity.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|ChainFollower")
+    void WatchStakeAddress(const FString& StakeAddress);
+
+    UFUNCTION(BlueprintCallable, Category = "Cardano|ChainFollower")
+    void UnwatchStakeAddress(const FString& StakeAddress);
+
+    /**
+     * Fired once per matched address and transaction, after the block has been applied to the UTxO cache.
+     * Addresses matched only through their credentials are reported even when the cache does not watch them.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Cardano|ChainFollower")
+    FOnChainFollowerActivity OnActivity;
+
+    /** Fired after the blocks above BlockHeight were undone. */
+    UPROPERTY(BlueprintAssignable, Category = "Cardano|ChainFollower")
+    FOnChainFollowerRollback OnRollback;
+
+private:
+    struct FBlockHeader
+    {
+        int64 Height = 0;
+        FString Hash;
+        int32 TxCount = 0;
+    };
+
+    bool Poll(float DeltaTime);
+    void FetchTip();
+    void FetchNextBlocks();
+    void FindRollbackPoint(int64 HighestHeight);
+    void RollBack(int64 BlockHeight);
+    void FetchBlockTransactions(const TArray<FBlockHeader>& Blocks, int32 FirstBlock);
+    void ApplyBlocks(const TArray<FBlockHeader>& Blocks, const TArray<TSharedPtr<FJsonValue>>& Transactions);
+    void RebuildCredentialIndex();
+    void IndexAddress(const FString& Address, bool bWatched);
+    bool MatchesWatched(const FJsonObject& Row, FString& OutAddress) const;
+    void FinishPoll(const FString& ErrorMessage);
+
+    /** Seconds between two polls; blocks come every 20 seconds on average. */
+    UPROPERTY(Config)
+    float PollIntervalSeconds = 10.0f;
+
+    /** Deepest rollback that can be undone; Cardano's security parameter k. */
+    UPROPERTY(Config)
+    int32 SecurityParameter = 2160;
+
+    /** Blocks fetched per poll at most, so catching up after a pause is spread over several polls. */
+    UPROPERTY(Config)
+    int32 MaxBlocksPerPoll = 60;
+
+    /** Transactions asked from block_tx_info at once at most, below the Koios page size. */
+    UPROPERTY(Config)
+    int32 MaxTransactionsPerRequest = 900;
+
+    UPROPERTY(Config)
+    bool bStartOnInitialize = false;
+
+    /** The last SecurityParameter blocks applied, oldest first, at consecutive heights. */
+    TArray<FBlockHeader> RecentBlocks;
+
+    /** Credentials of the watched addresses, updated as the UTxO cache's watched set changes. */
+    FCardanoCredentialFilter PaymentCredentials;
+
+    /** Stake addresses matched, with the number of watched addresses and WatchStakeAddress calls naming each. */
+    TMap<FString, int32> StakeAddresses;
+    TSet<FString> CredentialLessAddresses;
+    TSet<FString> ExtraStakeAddresses;
+
+    /** Watch revision of the UTxO cache the last refresh was started at. */
+    uint32 RefreshedWatchRevision = 0;
+    FDelegateHandle WatchChangedHandle;
+
+    bool bFollowing = false;
+    bool bPollInProgress = false;
+
+    /** Incremented by Start and Stop, so responses to an earlier session are ignored. */
+    uint32 Session = 0;
+    FDelegateHandle PollHandle;
+};
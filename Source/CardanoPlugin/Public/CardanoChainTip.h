@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "CardanoChainTip.generated.h"
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnChainTipSynced, bool, Success, int64, Slot);
+
+/**
+ * Local clock for the chain tip.
+ * The tip is fetched from Koios once and the current slot is then extrapolated from wall-clock time,
+ * so computing a TTL never needs a network call. A background re-sync is started whenever the cached
+ * tip is older than ResyncIntervalSeconds. Before the first sync the slot is derived purely from the
+ * network's slot config through cardano_compute_slot_from_unix_time.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoChainTip : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide tip service, or nullptr before the engine is initialized. */
+    static UCardanoChainTip* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+    /** Fetches the tip now, regardless of how old the cached one is. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|ChainTip")
+    void Sync(const FOnChainTipSynced& OnComplete);
+
+    /** Current slot extrapolated from the cached tip; returns 0 if it cannot be computed for this network. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|ChainTip")
+    int64 GetCurrentSlot();
+
+    /** Slot to use as a transaction TTL so it stays valid for ValiditySeconds from now. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|ChainTip")
+    int64 GetTimeToLive(int64 ValiditySeconds = 7200);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|ChainTip")
+    bool IsSynced() const { return bSynced; }
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|ChainTip")
+    int32 GetNetworkMagic() const { return NetworkMagic; }
+
+private:
+    void StartSync();
+    void FinishSync(bool bSuccess);
+
+    /** Magic of the network queried through UCardanoKoiosClient. */
+    UPROPERTY(Config)
+    int32 NetworkMagic = 764824073;
+
+    /** Slot length used for extrapolation, for networks the C library has no slot config for. */
+    UPROPERTY(Config)
+    int32 SlotLengthMilliseconds = 1000;
+
+    UPROPERTY(Config)
+    float ResyncIntervalSeconds = 600.0f;
+
+    int64 TipSlot = 0;
+    int64 TipUnixTime = 0;
+    double LastSyncTime = 0.0;
+    bool bSynced = false;
+    bool bSyncInProgress = false;
+    TArray<FOnChainTipSynced> PendingCallbacks;
+};
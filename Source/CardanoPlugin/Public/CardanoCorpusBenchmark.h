@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Throughput of one stage of an FCardanoCorpusBenchmark run, over whole passes of the corpus. */
+struct FCardanoCorpusBenchmarkStage
+{
+    FString Name;
+    int32 Passes = 0;
+    int64 Transactions = 0;
+    int64 Failures = 0;
+    double TxPerSecond = 0.0;
+    double MBPerSecond = 0.0;
+};
+
+/** Outcome of an FCardanoCorpusBenchmark run. */
+struct FCardanoCorpusBenchmarkReport
+{
+    FString Directory;
+    bool bMemoryMapped = false;
+
+    /** Files loaded, and their total size in bytes of transaction CBOR. */
+    int32 Transactions = 0;
+    int64 Bytes = 0;
+
+    /** Files that could not be read, were not hex or did not decode as a transaction. */
+    TArray<FString> Rejected;
+
+    /**
+     * Transactions whose re-serialization, with the CBOR caches cleared, differs from the input bytes, or whose id
+     * changed. Mainnet carries non-canonical encodings (indefinite lengths, unsorted maps) that are expected here; a
+     * transaction that appears after a library update is an encoder regression.
+     */
+    TArray<FString> ReencodeMismatches;
+
+    /** Transactions whose cached encoding differs from the input; these are always bugs. */
+    TArray<FString> PreservedMismatches;
+
+    /** Decode, encode and hash, in that order. */
+    TArray<FCardanoCorpusBenchmarkStage> Stages;
+};
+
+/**
+ * Replays a fixed corpus of real transactions through cardano-c: every file is decoded, re-encoded and hashed, the
+ * round trips are checked byte for byte, and decoder and encoder throughput is reported in transactions and megabytes
+ * per second, so regressions show up on the transaction shapes mainnet actually has rather than on a synthetic one.
+ *
+ * The corpus is a directory of `.cbor` files (raw CBOR) and `.hex`/`.txt` files (hex encoded CBOR), read in file name
+ * order so every run is the same. The files are read in full, or memory-mapped when bMemoryMap is set (raw files only;
+ * hex files still need decoding into memory), before anything is timed, and the pages are touched once, so file I/O
+ * never lands in the numbers. Each stage repeats whole passes until it has taken at least MinSeconds.
+ *
+ * Runs are blocking; call them off the game thread. Also available from the console as
+ * `Cardano.BenchmarkCorpus <Directory> [MinSeconds] [mmap]`, which logs the report.
+ */
+class CARDANOPLUGIN_API FCardanoCorpusBenchmark
+{
+public:
+    /** Loads the corpus in Directory and runs every stage on it; fails only if no transaction could be loaded. */
+    static bool Run(const FString& Directory, double MinSeconds, bool bMemoryMap, FCardanoCorpusBenchmarkReport& OutReport);
+
+    /** Formats a report as a fixed-width table, one line per stage, followed by the round trip results. */
+    static FString FormatReport(const FCardanoCorpusBenchmarkReport& Report);
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Set of 28-byte Blake2b-224 credential hashes, tuned for asking "is this one of ours" about every output of a
+ * block when almost none are.
+ * A blocked bloom filter answers first: each hash owns one 64-byte block of the filter and eight bits in it, so a
+ * miss costs a single cache line and no hashing, since credential hashes are uniformly distributed already. Only
+ * the rare hits are confirmed against an exact hashed set, so Contains has no false positives.
+ * Credentials can be added and removed at any time. A credential added N times stays until it is removed N times,
+ * so several watched addresses can share one. Removed credentials keep their bits until the filter is rebuilt, which
+ * happens when it grows or when they outnumber the live ones.
+ * Not thread-safe.
+ */
+class CARDANOPLUGIN_API FCardanoCredentialFilter
+{
+public:
+    static constexpr int32 HashSize = 28;
+
+    explicit FCardanoCredentialFilter(int32 InitialCapacity = 1024);
+
+    void Add(const uint8* Hash);
+    void Remove(const uint8* Hash);
+
+    /** True if Hash was added more times than removed. */
+    bool Contains(const uint8* Hash) const;
+
+    /** Only the bloom filter pass: false means absent, true means probably present. */
+    bool MayContain(const uint8* Hash) const;
+
+    /** The same operations on 56-character hex hashes, as Koios returns them. Malformed hashes are never contained. */
+    bool AddHex(const FString& Hex);
+    bool RemoveHex(const FString& Hex);
+    bool ContainsHex(const FString& Hex) const;
+
+    void Reset();
+
+    /** Distinct credentials in the set. */
+    int32 Num() const { return Counts.Num(); }
+
+    /** Bytes held by the bloom filter. */
+    int64 GetFilterBytes() const { return Words.Num() * sizeof(uint64); }
+
+private:
+    struct FHash
+    {
+        uint8 Bytes[HashSize];
+
+        bool operator==(const FHash& Other) const { return FMemory::Memcmp(Bytes, Other.Bytes, HashSize) == 0; }
+
+        /** The bytes are a hash already; the filter uses the leading ones, so the set takes the trailing ones. */
+        friend uint32 GetTypeHash(const FHash& Hash)
+        {
+            uint32 Value = 0;
+            FMemory::Memcpy(&Value, Hash.Bytes + HashSize - sizeof(Value), sizeof(Value));
+            return Value;
+        }
+    };
+
+    static bool DecodeHex(const FString& Hex, FHash& OutHash);
+
+    void SetBits(const uint8* Hash);
+    void Rebuild(int32 Capacity);
+
+    /** Blocks of eight words; their number is a power of two. */
+    TArray<uint64> Words;
+    uint64 BlockMask = 0;
+
+    /** Credentials the filter can hold before its false positive rate degrades and it is grown. */
+    int32 Capacity = 0;
+
+    /** Credentials removed since the last rebuild, whose bits are still set. */
+    int32 StaleCount = 0;
+
+    TMap<FHash, int32> Counts;
+};
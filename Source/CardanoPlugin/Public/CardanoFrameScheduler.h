@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+
+enum class ECardanoWorkPriority : uint8
+{
+    /** Work a player is waiting on, such as the balance of the wallet on screen. */
+    High,
+    Normal,
+    /** Prefetching and cache maintenance. */
+    Low,
+
+    Count
+};
+
+/**
+ * Runs the plugin's background work without hitching the game on client machines, where large UTxO imports,
+ * history decodes and address discovery starve low-end CPUs even from worker threads.
+ * In frame-sliced mode, the default outside dedicated servers, game-thread jobs are split into steps that run within a
+ * per-frame budget, highest priority first and round-robin within a priority, and thread-pool jobs are queued by
+ * priority so at most MaxBackgroundJobs of them run at once and single-threaded. Otherwise, as on servers, game-thread
+ * jobs run to completion at once and thread-pool jobs are started right away, across every core.
+ * Configured in the [CardanoPlugin] section of DefaultGame.ini:
+ *
+ *     FrameSlicedWork=True
+ *     FrameBudgetMilliseconds=2.0
+ *     MaxBackgroundJobs=1
+ *
+ * Submit and ForEach must be called on the game thread; RunInBackground and IsFrameSliced may be called from any.
+ */
+class CARDANOPLUGIN_API FCardanoFrameScheduler
+{
+public:
+    static FCardanoFrameScheduler& Get();
+
+    /** Reads the configuration and starts ticking; called by the module. */
+    void Start();
+    void Stop();
+
+    bool IsFrameSliced() const { return bFrameSliced; }
+
+    /**
+     * Calls Step on the game thread until it returns true. Step does as much of its job as it can before Deadline, an
+     * FPlatformTime::Seconds() time, and then returns whether it finished. Each frame calls it at least once.
+     * Without frame slicing, Step is called with no deadline before Submit returns.
+     */
+    void Submit(ECardanoWorkPriority Priority, TUniqueFunction<bool(double Deadline)> Step);
+
+    /** Calls Body for every index below Count through Submit, then OnComplete, on the game thread. */
+    void ForEach(ECardanoWorkPriority Priority, int32 Count, TFunction<void(int32 Index)> Body, TUniqueFunction<void()> OnComplete);
+
+    /** Runs Work on the thread pool, queued behind the background jobs already running when frame-sliced. */
+    void RunInBackground(ECardanoWorkPriority Priority, TUniqueFunction<void()> Work);
+
+    /** Whether a background job should keep to its own thread rather than fan out over every core with ParallelFor. */
+    bool ShouldRunSingleThreaded() const { return bFrameSliced; }
+
+private:
+    bool Tick(float DeltaTime);
+
+    /** Starts queued background jobs while fewer than MaxBackgroundJobs run. Called with BackgroundLock held. */
+    void DispatchBackground();
+
+    bool bFrameSliced = false;
+    double BudgetSeconds = 0.002;
+    int32 MaxBackgroundJobs = 1;
+
+    /** Game-thread jobs by priority; the first of each array runs next. */
+    TArray<TUniqueFunction<bool(double)>> Jobs[static_cast<int32>(ECardanoWorkPriority::Count)];
+
+    FCriticalSection BackgroundLock;
+    TArray<TUniqueFunction<void()>> BackgroundJobs[static_cast<int32>(ECardanoWorkPriority::Count)];
+    int32 RunningBackgroundJobs = 0;
+
+    FDelegateHandle TickHandle;
+};
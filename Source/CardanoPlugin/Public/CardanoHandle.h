@@ -0,0 +1,163 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <cardano/cardano.h>
+#include <cardano/key_handlers/secure_key_handler.h>
+
+/** The ref and unref functions of a cardano-c type, specialized with CARDANO_REF_TRAITS for each type TCardanoRef holds. */
+template <typename T>
+struct TCardanoRefTraits;
+
+#define CARDANO_REF_TRAITS(Name) \
+    template <> \
+    struct TCardanoRefTraits<cardano_##Name##_t> \
+    { \
+        static void Ref(cardano_##Name##_t* Object) { cardano_##Name##_ref(Object); } \
+        static void Unref(cardano_##Name##_t** Object) { cardano_##Name##_unref(Object); } \
+    };
+
+CARDANO_REF_TRAITS(address)
+CARDANO_REF_TRAITS(asset_id)
+CARDANO_REF_TRAITS(asset_id_map)
+CARDANO_REF_TRAITS(asset_name)
+CARDANO_REF_TRAITS(base_address)
+CARDANO_REF_TRAITS(bip32_private_key)
+CARDANO_REF_TRAITS(bip32_public_key)
+CARDANO_REF_TRAITS(blake2b_hash)
+CARDANO_REF_TRAITS(buffer)
+CARDANO_REF_TRAITS(cbor_reader)
+CARDANO_REF_TRAITS(cbor_writer)
+CARDANO_REF_TRAITS(credential)
+CARDANO_REF_TRAITS(ed25519_private_key)
+CARDANO_REF_TRAITS(ed25519_public_key)
+CARDANO_REF_TRAITS(ed25519_signature)
+CARDANO_REF_TRAITS(ed25519_signing_context)
+CARDANO_REF_TRAITS(ex_unit_prices)
+CARDANO_REF_TRAITS(protocol_parameters)
+CARDANO_REF_TRAITS(provider)
+CARDANO_REF_TRAITS(secure_key_handler)
+CARDANO_REF_TRAITS(transaction)
+CARDANO_REF_TRAITS(transaction_body)
+CARDANO_REF_TRAITS(transaction_input)
+CARDANO_REF_TRAITS(transaction_input_set)
+CARDANO_REF_TRAITS(transaction_output)
+CARDANO_REF_TRAITS(transaction_output_list)
+CARDANO_REF_TRAITS(tx_builder)
+CARDANO_REF_TRAITS(unit_interval)
+CARDANO_REF_TRAITS(utxo)
+CARDANO_REF_TRAITS(utxo_list)
+CARDANO_REF_TRAITS(value)
+CARDANO_REF_TRAITS(vkey_witness)
+CARDANO_REF_TRAITS(vkey_witness_set)
+CARDANO_REF_TRAITS(witness_set)
+
+#undef CARDANO_REF_TRAITS
+
+/**
+ * Owns one reference to a cardano-c object and gives it back when it goes out of scope, so an early return never
+ * needs an unref cascade and no reference is given back twice. Moving hands the reference over without touching the
+ * count; copying takes a reference of its own. A cardano-c function that takes its own reference is given Get(), and
+ * one that creates an object writes it to GetInitReference().
+ */
+template <typename T>
+class TCardanoRef
+{
+public:
+    using FTraits = TCardanoRefTraits<T>;
+
+    TCardanoRef() = default;
+
+    /** Takes over a reference the caller owns, such as the one a cardano-c constructor or getter returned. */
+    explicit TCardanoRef(T* InObject)
+        : Object(InObject)
+    {
+    }
+
+    /** Takes a reference of its own to an object the caller only borrows. */
+    static TCardanoRef Share(T* InObject)
+    {
+        if (InObject)
+        {
+            FTraits::Ref(InObject);
+        }
+        return TCardanoRef(InObject);
+    }
+
+    ~TCardanoRef()
+    {
+        Reset();
+    }
+
+    TCardanoRef(TCardanoRef&& Other)
+        : Object(Other.Release())
+    {
+    }
+
+    TCardanoRef(const TCardanoRef& Other)
+        : Object(Other.Object)
+    {
+        if (Object)
+        {
+            FTraits::Ref(Object);
+        }
+    }
+
+    TCardanoRef& operator=(TCardanoRef&& Other)
+    {
+        if (this != &Other)
+        {
+            Reset(Other.Release());
+        }
+        return *this;
+    }
+
+    TCardanoRef& operator=(const TCardanoRef& Other)
+    {
+        if (Object != Other.Object)
+        {
+            *this = Share(Other.Object);
+        }
+        return *this;
+    }
+
+    T* Get() const { return Object; }
+    bool IsValid() const { return Object != nullptr; }
+    explicit operator bool() const { return Object != nullptr; }
+
+    /** Releases the object held, if any, and returns the address a cardano-c function writes a new one to. */
+    T** GetInitReference()
+    {
+        Reset();
+        return &Object;
+    }
+
+    /** Hands the reference over to the caller, who must unref it. */
+    T* Release()
+    {
+        T* Released = Object;
+        Object = nullptr;
+        return Released;
+    }
+
+    /** Gives back the reference held, if any, and takes over InObject's. */
+    void Reset(T* InObject = nullptr)
+    {
+        T* Previous = Object;
+        Object = InObject;
+        if (Previous)
+        {
+            FTraits::Unref(&Previous);
+        }
+    }
+
+private:
+    T* Object = nullptr;
+};
+
+using FCardanoAddressHandle = TCardanoRef<cardano_address_t>;
+using FCardanoKeyHandlerHandle = TCardanoRef<cardano_secure_key_handler_t>;
+using FCardanoProviderHandle = TCardanoRef<cardano_provider_t>;
+using FCardanoTransactionHandle = TCardanoRef<cardano_transaction_t>;
+using FCardanoTxBuilderHandle = TCardanoRef<cardano_tx_builder_t>;
+using FCardanoUTxOListHandle = TCardanoRef<cardano_utxo_list_t>;
+using FCardanoValueHandle = TCardanoRef<cardano_value_t>;
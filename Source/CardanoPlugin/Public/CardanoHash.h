@@ -0,0 +1,148 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "CardanoHash.generated.h"
+
+/** Writes Size bytes as lower-case hex. */
+CARDANOPLUGIN_API FString CardanoBytesToHex(const uint8* Bytes, int32 Size);
+
+/** Decodes exactly Size bytes of hex; OutBytes is left untouched on failure. */
+CARDANOPLUGIN_API bool CardanoHexToBytes(const FString& Hex, uint8* OutBytes, int32 Size);
+
+/** Decodes the Length / 2 bytes of the hex digits at Hex, of either case, without converting them to UTF-8 first. */
+CARDANOPLUGIN_API bool CardanoHexToBytes(const TCHAR* Hex, int32 Length, uint8* OutBytes);
+
+/**
+ * Blake2b-256 hash held inline, such as a transaction id: 32 bytes against the 128 bytes plus heap allocation of
+ * its hex FString. The hash is uniformly distributed already, so hashing it for a TMap reads four bytes.
+ * Exported to text, config and JSON as hex.
+ */
+USTRUCT(BlueprintType)
+struct CARDANOPLUGIN_API FCardanoHash32
+{
+    GENERATED_BODY()
+
+    static constexpr int32 Size = 32;
+
+    uint8 Bytes[Size];
+
+    FCardanoHash32() { FMemory::Memzero(Bytes, Size); }
+
+    static bool FromHex(const FString& Hex, FCardanoHash32& OutHash) { return CardanoHexToBytes(Hex, OutHash.Bytes, Size); }
+    FString ToHex() const { return CardanoBytesToHex(Bytes, Size); }
+
+    bool IsZero() const;
+
+    bool operator==(const FCardanoHash32& Other) const { return FMemory::Memcmp(Bytes, Other.Bytes, Size) == 0; }
+    bool operator!=(const FCardanoHash32& Other) const { return !(*this == Other); }
+
+    friend uint32 GetTypeHash(const FCardanoHash32& Hash)
+    {
+        uint32 Value = 0;
+        FMemory::Memcpy(&Value, Hash.Bytes, sizeof(Value));
+        return Value;
+    }
+
+    bool Serialize(FArchive& Ar);
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+    bool ExportTextItem(FString& ValueStr, const FCardanoHash32& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const;
+    bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCardanoHash32> : public TStructOpsTypeTraitsBase2<FCardanoHash32>
+{
+    enum
+    {
+        WithSerializer = true,
+        WithNetSerializer = true,
+        WithExportTextItem = true,
+        WithImportTextItem = true,
+        WithIdenticalViaEquality = true,
+    };
+};
+
+/** Blake2b-224 hash held inline, such as a policy id or a credential; see FCardanoHash32. */
+USTRUCT(BlueprintType)
+struct CARDANOPLUGIN_API FCardanoHash28
+{
+    GENERATED_BODY()
+
+    static constexpr int32 Size = 28;
+
+    uint8 Bytes[Size];
+
+    FCardanoHash28() { FMemory::Memzero(Bytes, Size); }
+
+    static bool FromHex(const FString& Hex, FCardanoHash28& OutHash) { return CardanoHexToBytes(Hex, OutHash.Bytes, Size); }
+    FString ToHex() const { return CardanoBytesToHex(Bytes, Size); }
+
+    bool IsZero() const;
+
+    bool operator==(const FCardanoHash28& Other) const { return FMemory::Memcmp(Bytes, Other.Bytes, Size) == 0; }
+    bool operator!=(const FCardanoHash28& Other) const { return !(*this == Other); }
+
+    friend uint32 GetTypeHash(const FCardanoHash28& Hash)
+    {
+        uint32 Value = 0;
+        FMemory::Memcpy(&Value, Hash.Bytes, sizeof(Value));
+        return Value;
+    }
+
+    bool Serialize(FArchive& Ar);
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+    bool ExportTextItem(FString& ValueStr, const FCardanoHash28& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const;
+    bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCardanoHash28> : public TStructOpsTypeTraitsBase2<FCardanoHash28>
+{
+    enum
+    {
+        WithSerializer = true,
+        WithNetSerializer = true,
+        WithExportTextItem = true,
+        WithImportTextItem = true,
+        WithIdenticalViaEquality = true,
+    };
+};
+
+/** Identity of a transaction output, 36 bytes inline; the binary counterpart of a "TxHash#TxIndex" string. */
+struct FCardanoUTxORef
+{
+    FCardanoHash32 TxHash;
+    uint32 TxIndex = 0;
+
+    FCardanoUTxORef() = default;
+    FCardanoUTxORef(const FCardanoHash32& InTxHash, uint32 InTxIndex) : TxHash(InTxHash), TxIndex(InTxIndex) {}
+
+    bool operator==(const FCardanoUTxORef& Other) const { return TxIndex == Other.TxIndex && TxHash == Other.TxHash; }
+
+    friend uint32 GetTypeHash(const FCardanoUTxORef& Ref) { return HashCombine(GetTypeHash(Ref.TxHash), Ref.TxIndex); }
+
+    FString ToString() const { return FString::Printf(TEXT("%s#%u"), *TxHash.ToHex(), TxIndex); }
+};
+
+/** Conversions of the inline hashes for Blueprints, which handle hashes as hex strings. */
+UCLASS()
+class CARDANOPLUGIN_API UCardanoHashLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintPure, Category = "Cardano|Hash", meta = (DisplayName = "To Hex (Hash32)", CompactNodeTitle = "->", BlueprintAutocast))
+    static FString Conv_Hash32ToHex(const FCardanoHash32& Hash) { return Hash.ToHex(); }
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Hash", meta = (DisplayName = "To Hex (Hash28)", CompactNodeTitle = "->", BlueprintAutocast))
+    static FString Conv_Hash28ToHex(const FCardanoHash28& Hash) { return Hash.ToHex(); }
+
+    /** Returns false, leaving a zero hash, if Hex is not 64 hex digits. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Hash")
+    static bool MakeHash32FromHex(const FString& Hex, FCardanoHash32& OutHash) { return FCardanoHash32::FromHex(Hex, OutHash); }
+
+    /** Returns false, leaving a zero hash, if Hex is not 56 hex digits. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Hash")
+    static bool MakeHash28FromHex(const FString& Hex, FCardanoHash28& OutHash) { return FCardanoHash28::FromHex(Hex, OutHash); }
+};
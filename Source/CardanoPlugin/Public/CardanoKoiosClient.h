@@ -0,0 +1,222 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpRequest.h"
+#include "CardanoTask.h"
+#include "CardanoKoiosClient.generated.h"
+
+/** Scheduling class of a Koios request. While the rate limit holds requests back, earlier classes are sent first. */
+enum class ECardanoRequestPriority : uint8
+{
+    Submission,
+    Balance,
+    History,
+};
+
+/** Counters of the requests sent through ProcessRequest since the last ResetStats, for load tests and diagnostics. */
+struct FCardanoKoiosClientStats
+{
+    /** Requests handed to ProcessRequest. */
+    int64 RequestsQueued = 0;
+
+    /** Requests put on the wire, retries included. */
+    int64 RequestsSent = 0;
+
+    /** Throttled (429 or 503) responses that were retried. */
+    int64 Retries = 0;
+
+    /** Requests reported to their caller without a response: connection, DNS or TLS failures and timeouts. */
+    int64 ConnectionFailures = 0;
+
+    /** Requests reported to their caller with a 4xx or 5xx status, after any retries. */
+    int64 ErrorResponses = 0;
+
+    /** Requests withdrawn through CancelRequest, whether they were still queued or already sent. */
+    int64 Cancelled = 0;
+
+    int64 BytesSent = 0;
+
+    /** Body bytes as they came over the wire, compressed or not. */
+    int64 BytesReceived = 0;
+
+    /** Size of the gzip bodies the client inflated itself, after inflating. */
+    int64 BytesInflated = 0;
+
+    /** Highest number of requests awaiting a response at once. */
+    int32 PeakInFlight = 0;
+
+    /** Highest number of requests held back by the rate limit at once. */
+    int32 PeakQueued = 0;
+};
+
+/**
+ * Shared Koios endpoint configuration used by every plugin query.
+ * Owns the base URL, auth token, default headers and timeout so callers can point the plugin
+ * at their own Koios instance. Defaults can be set in the [/Script/CardanoPlugin.CardanoKoiosClient]
+ * section of DefaultGame.ini.
+ *
+ * Requests sent through ProcessRequest share one token bucket sized to the instance's quota. Throttled
+ * responses (429 and 503) are retried after the server's Retry-After, or an exponential backoff, and
+ * halve the send rate, which then climbs back to RequestsPerSecond as requests succeed.
+ *
+ * Requests ask for gzip bodies. HTTP backends that do not inflate them transparently hand the client the compressed
+ * body, which it inflates before the completion delegate runs, on the thread pool for large bodies, so callers always
+ * read plain JSON. A body that fails to inflate completes the request with bSuccess false.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoKoiosClient : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide client, or nullptr before the engine is initialized. */
+    static UCardanoKoiosClient* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Koios")
+    void SetBaseUrl(const FString& InBaseUrl);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Koios")
+    const FString& GetBaseUrl() const { return BaseUrl; }
+
+    /** Bearer token sent with every request; pass an empty string to disable authentication. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Koios")
+    void SetAuthToken(const FString& InAuthToken);
+
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Koios")
+    void SetTimeout(float InTimeoutSeconds);
+
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Koios")
+    void SetDefaultHeader(const FString& Name, const FString& Value);
+
+    /** Largest number of addresses sent in one `_addresses` request body; bigger batches are chunked. */
+    int32 GetMaxAddressesPerRequest() const { return FMath::Max(MaxAddressesPerRequest, 1); }
+
+    /** Response bodies of at least this many bytes are decoded on the thread pool; see DecodeKoiosResponse. */
+    int32 GetAsyncDecodeThreshold() const { return FMath::Max(AsyncDecodeThresholdBytes, 0); }
+
+    /** Creates a request for BaseUrl/Path with the default headers applied. */
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateRequest(const FString& Verb, const FString& Path) const;
+
+    /** Creates a JSON POST request for BaseUrl/Path carrying Body. */
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateJsonPost(const FString& Path, const FString& Body) const;
+
+    /** Builds the {"_addresses": [...]} body shared by the address endpoints without going through a JSON DOM. */
+    static FString MakeAddressesBody(const TArray<FString>& Addresses, bool bExtended = false);
+
+    /**
+     * Upper bound on the length of a condensed JSON body listing Values as quoted strings, plus ExtraChars for the
+     * surrounding keys, so body builders can reserve the string once instead of growing it per element.
+     */
+    static int32 EstimateStringListBodyLength(const TArray<FString>& Values, int32 ExtraChars);
+
+    /**
+     * Sends Request once the rate limit allows it, ahead of any queued request of a later priority.
+     * The completion delegate bound on Request runs once, with the final response after any retries.
+     */
+    void ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, ECardanoRequestPriority Priority);
+
+    /**
+     * ProcessRequest for a flow of TCardanoTask steps, binding the completion delegate itself. The task succeeds with
+     * any response the server gave, whatever its status code, and fails only when none came back.
+     */
+    TCardanoTask<FHttpResponsePtr> ProcessRequestTask(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, ECardanoRequestPriority Priority);
+
+    /**
+     * Withdraws a request given to ProcessRequest. One still held back by the rate limit is dropped without using a
+     * token and its completion delegate never runs; one already sent is aborted, and its delegate then runs with a
+     * failed response. Does nothing for requests that already completed.
+     */
+    void CancelRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request);
+
+    const FCardanoKoiosClientStats& GetStats() const { return Stats; }
+
+    /** Zeroes the counters; the peaks restart from the requests currently in flight and queued. */
+    void ResetStats();
+
+private:
+    struct FQueuedRequest
+    {
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request;
+        FHttpRequestCompleteDelegate OnComplete;
+        ECardanoRequestPriority Priority;
+        int32 Retries = 0;
+
+        /** When the last attempt was put on the wire, for the request duration metric. */
+        double SentAt = 0.0;
+    };
+
+    static constexpr int32 NumPriorities = 3;
+
+    void PumpQueue();
+    void Send(const TSharedRef<FQueuedRequest>& Queued);
+    void OnResponse(const TSharedRef<FQueuedRequest>& Queued, FHttpResponsePtr Response, bool bSuccess);
+
+    /** Inflates Response if the backend left it gzip-compressed, then passes it on to OnResponse. */
+    void OnCompressedResponse(const TSharedRef<FQueuedRequest>& Queued, FHttpResponsePtr Response, bool bSuccess);
+    void RefillTokens(double Now);
+    void SchedulePump(double DelaySeconds);
+    bool PumpTick(float DeltaTime);
+    double GetRetryDelay(const FHttpResponsePtr& Response, int32 Retries) const;
+
+    /** Samples the queue gauges of FCardanoMetrics. */
+    void CollectMetrics();
+
+    UPROPERTY(Config)
+    FString BaseUrl = TEXT("https://api.koios.rest/api/v1");
+
+    UPROPERTY(Config)
+    FString AuthToken;
+
+    UPROPERTY(Config)
+    float TimeoutSeconds = 30.0f;
+
+    UPROPERTY(Config)
+    int32 MaxAddressesPerRequest = 100;
+
+    UPROPERTY(Config)
+    TMap<FString, FString> DefaultHeaders;
+
+    /** Sends Accept-Encoding: gzip. JSON compresses about tenfold, which matters most to mobile clients. */
+    UPROPERTY(Config)
+    bool bAcceptCompressedResponses = true;
+
+    /**
+     * Smaller bodies are decoded in the completion handler, where a worker round trip would cost more than the
+     * parse. 0 decodes every response on the thread pool, so no response JSON is parsed on the game thread.
+     */
+    UPROPERTY(Config)
+    int32 AsyncDecodeThresholdBytes = 64 * 1024;
+
+    /** Sustained request rate allowed by the instance's quota. */
+    UPROPERTY(Config)
+    float RequestsPerSecond = 10.0f;
+
+    /** Requests that may be sent back to back after an idle period. */
+    UPROPERTY(Config)
+    int32 BurstSize = 10;
+
+    /** Times a throttled request is retried before its throttled response is reported. */
+    UPROPERTY(Config)
+    int32 MaxRetries = 5;
+
+    /** Upper bound on the wait before a retry, including a server supplied Retry-After. */
+    UPROPERTY(Config)
+    float MaxBackoffSeconds = 30.0f;
+
+    TArray<TSharedRef<FQueuedRequest>> Queues[NumPriorities];
+    double Tokens = 0.0;
+    double CurrentRate = 0.0;
+    double LastRefillTime = 0.0;
+    double BlockedUntil = 0.0;
+    FDelegateHandle PumpHandle;
+    FDelegateHandle MetricsHandle;
+
+    FCardanoKoiosClientStats Stats;
+    int32 NumInFlight = 0;
+    int32 NumQueued = 0;
+};
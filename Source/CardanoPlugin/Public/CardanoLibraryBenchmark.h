@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Timing of one FCardanoLibraryBenchmark case. */
+struct FCardanoLibraryBenchmarkResult
+{
+    /** Case name, e.g. "coin_selection/large_first/1000". */
+    FString Name;
+
+    int64 Iterations = 0;
+    int64 Failures = 0;
+
+    /** Wall-clock nanoseconds per iteration. */
+    double NanosPerOp = 0.0;
+};
+
+/** Objects and heap bytes of one cardano_memory_footprint_type_t in an FCardanoMemoryFootprintResult. */
+struct FCardanoMemoryFootprintTypeEntry
+{
+    /** Type name, e.g. "hash". */
+    FString Type;
+
+    int64 Objects = 0;
+    int64 HeapBytes = 0;
+};
+
+/** Deep heap size of one object graph, see cardano_memory_footprint_t. */
+struct FCardanoMemoryFootprintResult
+{
+    /** Case name, e.g. "utxo_list/1000". */
+    FString Name;
+
+    /** Size of the CBOR the object was decoded from, for transactions; zero otherwise. */
+    int64 EncodedBytes = 0;
+
+    int64 HeapBytes = 0;
+    int64 Allocations = 0;
+    int64 Objects = 0;
+    int64 RefcountOverheadBytes = 0;
+    int64 LastErrorBytes = 0;
+    int64 SharedObjects = 0;
+
+    /** Sub-objects not descended into (certificates, metadata, ...); zero means HeapBytes is complete. */
+    int64 UnmeasuredObjects = 0;
+
+    /** Types with at least one object, largest first. */
+    TArray<FCardanoMemoryFootprintTypeEntry> ByType;
+};
+
+/**
+ * Micro-benchmarks of the cardano-c hot paths the plugin depends on (CBOR, transaction (de)serialization, hashing,
+ * signing, key derivation, bech32, building/balancing and every coin selector on 10, 1k and 100k UTxOs), so a library
+ * update that slows one of them down shows up as a number instead of as slower transactions in game.
+ *
+ * Each case runs in growing batches until it has taken at least MinSecondsPerCase. Runs are blocking and take a while;
+ * call them off the game thread.
+ *
+ * Also available from the console as `Cardano.BenchmarkLibrary [MinSecondsPerCase] [OutputFile] [TxCborHexFile...]`,
+ * which logs a table and the memory footprints and, when OutputFile is given, writes the timings there as JSON. The
+ * footprints alone are logged by `Cardano.MemoryFootprint [TxCborHexFile...]`.
+ */
+class CARDANOPLUGIN_API FCardanoLibraryBenchmark
+{
+public:
+    /**
+     * Runs every case. Transactions are CBOR encoded transactions (for instance real mainnet transactions) to
+     * benchmark decoding and encoding on; a transaction built from synthetic UTxOs is always included.
+     */
+    static TArray<FCardanoLibraryBenchmarkResult> Run(double MinSecondsPerCase, const TArray<TArray<uint8>>& Transactions);
+
+    /** Formats results as a fixed-width table, one line per case. */
+    static FString FormatReport(const TArray<FCardanoLibraryBenchmarkResult>& Results);
+
+    /**
+     * Measures the deep heap size of the UTxO sets and transactions the cases run on, plus a value and an address, so
+     * the per-object overhead of cardano-c (reference counts and last-error buffers) can be weighed against payloads.
+     */
+    static TArray<FCardanoMemoryFootprintResult> MeasureFootprints(const TArray<TArray<uint8>>& Transactions);
+
+    /** Formats footprints as a fixed-width table, one line per case followed by its breakdown by type. */
+    static FString FormatFootprintReport(const TArray<FCardanoMemoryFootprintResult>& Results);
+
+    /** Serializes results in the Google Benchmark JSON layout ("context" plus a "benchmarks" array), for tooling. */
+    static FString ToJson(const TArray<FCardanoLibraryBenchmarkResult>& Results);
+};
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoKoiosClient.h"
+#include "CardanoTypes.h"
+#include <cardano/cardano.h>
+#include <cardano/key_handlers/secure_key_handler.h>
+
+class FCardanoMockKoiosServer;
+
+/** Settings of one FCardanoLoadTest run. */
+struct CARDANOPLUGIN_API FCardanoLoadTestConfig
+{
+    /** Simulated players, each with its own freshly generated wallet. */
+    int32 Wallets = 50;
+
+    /** No wallet starts a new iteration after this; the run ends once the iterations in progress finish. */
+    float DurationSeconds = 60.0f;
+
+    /** Pause of each wallet between two iterations. */
+    float ThinkTimeSeconds = 1.0f;
+
+    /** Koios base URL to test against. Ignored, and the current client URL left alone, when bMockServer is set. */
+    FString Endpoint;
+
+    /** Serves the endpoints from an in-process mock on localhost instead of a real Koios instance. */
+    bool bMockServer = true;
+    uint32 MockPort = 8089;
+
+    /** Delay the mock adds to every response. */
+    float MockLatencySeconds = 0.05f;
+
+    /** UTxOs the mock reports for every address. */
+    int32 MockUTxOsPerWallet = 5;
+
+    /**
+     * Posts the signed transactions to submittx. Always done against the mock; against a real endpoint the wallets
+     * are unfunded and their transactions are built on synthetic UTxOs, so it is off unless asked for.
+     */
+    bool bSubmit = false;
+
+    /** Lovelace each wallet sends to itself per iteration. */
+    int64 PaymentLovelace = 2000000;
+};
+
+/**
+ * Latencies of one stage of the wallet loop, from the start of the stage to its result on the game thread, so the
+ * rate limit queue and the thread pool hand-offs are included. Only successful stages are sampled.
+ */
+struct CARDANOPLUGIN_API FCardanoLoadTestStageStats
+{
+    FString Name;
+    int32 Count = 0;
+    int32 Failures = 0;
+    double MeanMs = 0.0;
+    double P50Ms = 0.0;
+    double P90Ms = 0.0;
+    double P99Ms = 0.0;
+    double MaxMs = 0.0;
+};
+
+/** Outcome of an FCardanoLoadTest run. */
+struct CARDANOPLUGIN_API FCardanoLoadTestReport
+{
+    FString Endpoint;
+    int32 Wallets = 0;
+    double ElapsedSeconds = 0.0;
+
+    /** Wallet iterations that went through every stage. */
+    int32 Iterations = 0;
+    double IterationsPerSecond = 0.0;
+
+    /** Balance, UTxO refresh, build, sign and submit, in loop order. */
+    TArray<FCardanoLoadTestStageStats> Stages;
+
+    /** Koios client counters over the run. */
+    FCardanoKoiosClientStats Http;
+
+    /** Requests the mock server answered; zero against a real endpoint. */
+    int64 MockRequestsServed = 0;
+
+    /** First error seen, to tell a misconfigured run from a slow one. */
+    FString FirstError;
+};
+
+DECLARE_DELEGATE_OneParam(FOnCardanoLoadTestComplete, const FCardanoLoadTestReport&);
+
+/**
+ * Simulates many concurrent players against a Koios endpoint to size it and catch regressions in the plugin's
+ * request and transaction pipeline. Every wallet loops over the calls a game makes: a balance poll (address_info), a
+ * UTxO refresh (address_utxos), a build on the thread pool, a sign with its own key handler on the thread pool, and
+ * optionally a submission, all through UCardanoKoiosClient so its rate limit and retries are part of the measurement.
+ *
+ * The run is driven by HTTP callbacks and the core ticker; start it from the game thread and keep ticking the engine.
+ * Also available from the console as `Cardano.LoadTest [Wallets] [DurationSeconds] [Endpoint|mock] [ThinkTimeSeconds]`,
+ * which logs the report when the run ends, and `Cardano.LoadTestStop` to end it early.
+ */
+class CARDANOPLUGIN_API FCardanoLoadTest : public TSharedFromThis<FCardanoLoadTest, ESPMode::ThreadSafe>
+{
+public:
+    ~FCardanoLoadTest();
+
+    /** Starts a run; OnComplete is called on the game thread with the report. Returns nullptr if a run is already going. */
+    static TSharedPtr<FCardanoLoadTest, ESPMode::ThreadSafe> Start(const FCardanoLoadTestConfig& Config, FOnCardanoLoadTestComplete OnComplete);
+
+    /** Ends the run early; wallets finish the stage they are in, then the report is delivered as usual. */
+    void Stop();
+
+    /** The run in progress, if any. */
+    static TSharedPtr<FCardanoLoadTest, ESPMode::ThreadSafe> GetRunning() { return Running.Pin(); }
+
+    /** Formats a report as a fixed-width table, one line per stage, followed by the HTTP counters. */
+    static FString FormatReport(const FCardanoLoadTestReport& Report);
+
+private:
+    enum class EStage : uint8
+    {
+        Balance,
+        UTxOs,
+        Build,
+        Sign,
+        Submit,
+        Count
+    };
+
+    struct FWallet
+    {
+        FString Address;
+        cardano_secure_key_handler_t* KeyHandler = nullptr;
+        TArray<FUTxO> UTxOs;
+        TArray<uint8> Transaction;
+        double StageStart = 0.0;
+    };
+
+    FCardanoLoadTest() = default;
+
+    void Begin();
+    void FetchNetworkState();
+    void StartWallets();
+    void StartIteration(int32 WalletIndex);
+    void FinishStage(int32 WalletIndex, EStage Stage, bool bSuccess, const FString& Error = FString());
+    void EndIteration(int32 WalletIndex);
+    void Finish();
+
+    void RunBalance(int32 WalletIndex);
+    void RunUTxOs(int32 WalletIndex);
+    void RunBuild(int32 WalletIndex);
+    void RunSign(int32 WalletIndex);
+    void RunSubmit(int32 WalletIndex);
+
+    void Fail(const FString& Error);
+
+    FCardanoLoadTestConfig Config;
+    FOnCardanoLoadTestComplete OnComplete;
+    TUniquePtr<FCardanoMockKoiosServer> MockServer;
+    FString PreviousBaseUrl;
+
+    TArray<FWallet> Wallets;
+    FCardanoProtocolParameters Parameters;
+    int64 InvalidAfter = 0;
+
+    TArray<double> Latencies[static_cast<int32>(EStage::Count)];
+    int32 Failures[static_cast<int32>(EStage::Count)] = {};
+    int32 Iterations = 0;
+    FString FirstError;
+
+    double StartTime = 0.0;
+    double EndTime = 0.0;
+    int32 ActiveWallets = 0;
+    bool bStopping = false;
+    bool bFinished = false;
+
+    static TWeakPtr<FCardanoLoadTest, ESPMode::ThreadSafe> Running;
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+/**
+ * Log category of the plugin. Per-item and per-step lines are Verbose or VeryVerbose; enable them at runtime with
+ * `Log LogCardano VeryVerbose`. Shipping builds compile them out, so their arguments are never even formatted.
+ */
+#if UE_BUILD_SHIPPING
+CARDANOPLUGIN_API DECLARE_LOG_CATEGORY_EXTERN(LogCardano, Log, Log);
+#else
+CARDANOPLUGIN_API DECLARE_LOG_CATEGORY_EXTERN(LogCardano, Log, All);
+#endif
+
+/**
+ * Logs one summary line per operation instead of a line per step, e.g.
+ * `BuildTransaction: ok in 4.21 ms (inputs=3 outputs=2 bytes=412)`.
+ *
+ * The line is written when Finish is called or, for operations that return early, when the object is destroyed, in
+ * which case the operation is reported as failed. Keep it in a TSharedRef to time an asynchronous operation.
+ */
+class FCardanoOperationLog
+{
+public:
+    explicit FCardanoOperationLog(const TCHAR* InOperation)
+        : Operation(InOperation)
+        , StartSeconds(FPlatformTime::Seconds())
+    {
+    }
+
+    ~FCardanoOperationLog()
+    {
+        Finish(false);
+    }
+
+    FCardanoOperationLog(const FCardanoOperationLog&) = delete;
+    FCardanoOperationLog& operator=(const FCardanoOperationLog&) = delete;
+
+    /** Adds a `Key=Value` pair to the summary line. */
+    void Add(const TCHAR* Key, int64 Value)
+    {
+        Details += FString::Printf(TEXT("%s%s=%lld"), Details.IsEmpty() ? TEXT("") : TEXT(" "), Key, Value);
+    }
+
+    void Add(const TCHAR* Key, const FString& Value)
+    {
+        Details += FString::Printf(TEXT("%s%s=%s"), Details.IsEmpty() ? TEXT("") : TEXT(" "), Key, *Value);
+    }
+
+    /** Writes the summary line; later calls do nothing. */
+    void Finish(bool bSucceeded)
+    {
+        if (bFinished)
+        {
+            return;
+        }
+
+        bFinished = true;
+        UE_LOG(LogCardano, Log, TEXT("%s: %s in %.2f ms%s%s%s"),
+            Operation,
+            bSucceeded ? TEXT("ok") : TEXT("failed"),
+            (FPlatformTime::Seconds() - StartSeconds) * 1000.0,
+            Details.IsEmpty() ? TEXT("") : TEXT(" ("),
+            *Details,
+            Details.IsEmpty() ? TEXT("") : TEXT(")"));
+    }
+
+private:
+    const TCHAR* Operation;
+    double StartSeconds;
+    FString Details;
+    bool bFinished = false;
+};
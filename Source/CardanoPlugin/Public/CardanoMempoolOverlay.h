@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpRequest.h"
+#include "CardanoHash.h"
+#include "CardanoMempoolOverlay.generated.h"
+
+/**
+ * Keeps UCardanoUTxOCache aware of the watched outputs spent by transactions still in the mempool, such as ones
+ * submitted by another session or device of the same wallet, so coin selection stops building on them before the
+ * submission fails. Koios has no mempool endpoint, so the overlay queries a Blockfrost-compatible API at MempoolUrl:
+ * every PollIntervalSeconds it lists the mempool transactions of each watched address, reads the inputs of the ones
+ * it has not seen yet, and hands every output they spend to UCardanoUTxOCache::SetMempoolSpends. Transactions gone
+ * from the mempool, confirmed or dropped, are forgotten on the next poll that lists every address. Transactions this
+ * process added to the cache as pending are skipped: the cache overlays them already.
+ * Disabled while MempoolUrl is empty. All methods must be called on the game thread.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoMempoolOverlay : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide overlay, or nullptr before the engine is initialized. */
+    static UCardanoMempoolOverlay* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Mempool")
+    bool IsEnabled() const { return !MempoolUrl.IsEmpty(); }
+
+    /** Polls now, unless a poll is already running. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Mempool")
+    void PollNow();
+
+    /** Mempool transactions spending watched outputs, as of the last poll. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Mempool")
+    int32 GetTransactionCount() const { return Transactions.Num(); }
+
+private:
+    struct FPollRound;
+
+    bool Tick(float DeltaTime);
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateRequest(const FString& Path) const;
+    void OnAddressListed(TSharedRef<FPollRound> Round, FHttpResponsePtr Response, bool bSuccess);
+    void FetchTransactions(TSharedRef<FPollRound> Round);
+    void OnTransactionFetched(TSharedRef<FPollRound> Round, const FString& TxHash, FHttpResponsePtr Response, bool bSuccess);
+    void FinishRound(TSharedRef<FPollRound> Round);
+
+    /** Base URL of a Blockfrost-compatible API, such as https://cardano-mainnet.blockfrost.io/api/v0; empty to disable. */
+    UPROPERTY(Config)
+    FString MempoolUrl;
+
+    /** Sent as the project_id header when set. */
+    UPROPERTY(Config)
+    FString ProjectId;
+
+    UPROPERTY(Config)
+    float PollIntervalSeconds = 10.0f;
+
+    /** Transactions read per poll at most; the others are read by the next polls. */
+    UPROPERTY(Config)
+    int32 MaxTransactionsPerPoll = 50;
+
+    /** Outputs each known mempool transaction spends, keyed by its hash. */
+    TMap<FString, TArray<FCardanoUTxORef>> Transactions;
+
+    FDelegateHandle TickHandle;
+    bool bPollInProgress = false;
+};
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Atomic.h"
+
+enum class ECardanoMetricType : uint8
+{
+    Counter,
+    Gauge,
+    Histogram,
+};
+
+/** Monotonic count, such as requests sent. */
+class CARDANOPLUGIN_API FCardanoCounter
+{
+public:
+    void Add(int64 Delta = 1) { Value += Delta; }
+    int64 Get() const { return Value.Load(EMemoryOrder::Relaxed); }
+
+private:
+    TAtomic<int64> Value { 0 };
+};
+
+/** Current level, such as a queue depth or the memory a cache holds. */
+class CARDANOPLUGIN_API FCardanoGauge
+{
+public:
+    void Set(int64 InValue) { Value.Store(InValue, EMemoryOrder::Relaxed); }
+    void Add(int64 Delta) { Value += Delta; }
+    int64 Get() const { return Value.Load(EMemoryOrder::Relaxed); }
+
+private:
+    TAtomic<int64> Value { 0 };
+};
+
+/** Distribution of observed values over fixed bucket bounds, such as durations in seconds. */
+class CARDANOPLUGIN_API FCardanoHistogram
+{
+public:
+    static constexpr int32 MaxBuckets = 16;
+
+    explicit FCardanoHistogram(TArrayView<const double> InBounds);
+
+    void Observe(double Value);
+
+    TArrayView<const double> GetBounds() const { return MakeArrayView(Bounds, BoundCount); }
+
+    /** Observations up to and including each bound, then the total count. */
+    void GetCumulativeCounts(TArray<uint64>& OutCounts) const;
+    double GetSum() const;
+
+private:
+    double Bounds[MaxBuckets];
+    int32 BoundCount = 0;
+
+    /** Per bucket, the last one counting the values above every bound. */
+    TAtomic<uint64> Counts[MaxBuckets + 1];
+
+    /** Bits of the double sum, updated by compare-exchange. */
+    TAtomic<uint64> SumBits { 0 };
+};
+
+/** One series as handed to FCardanoMetrics::Visit. */
+struct FCardanoMetricSample
+{
+    const FString* Name = nullptr;
+    const FString* Help = nullptr;
+
+    /** Formatted as in the exposition format, e.g. endpoint="tip",status="200"; empty without labels. */
+    const FString* Labels = nullptr;
+
+    ECardanoMetricType Type = ECardanoMetricType::Counter;
+
+    /** Counter and gauge value. */
+    int64 Value = 0;
+
+    /** Histogram buckets, cumulative, with their upper bounds; the last count is the total. */
+    TArrayView<const double> Bounds;
+    TArray<uint64> CumulativeCounts;
+    double Sum = 0.0;
+};
+
+/**
+ * Always-on metrics of the plugin and of cardano-c, unlike `stat Cardano`, which shipping builds compile out.
+ * Series are registered by name and labels the first time they are asked for and live as long as the process, so
+ * callers keep the reference, e.g. in a function-local static, and then update it without a lookup or a lock.
+ * Metrics are read either through Visit, to forward them to any metrics stack, or as Prometheus text from
+ * ExportPrometheus, which the module also serves over HTTP when MetricsPort is set in the [CardanoPlugin] section
+ * of DefaultGame.ini.
+ * Series may be registered and updated from any thread; Visit and ExportPrometheus run the collectors, which read
+ * subsystems, so they must be called on the game thread.
+ */
+class CARDANOPLUGIN_API FCardanoMetrics
+{
+public:
+    static FCardanoMetrics& Get();
+
+    FCardanoMetrics();
+    ~FCardanoMetrics();
+
+    /** Bounds for durations in seconds, from 100 microseconds to 10 seconds. */
+    static TArrayView<const double> GetDurationBounds();
+
+    /** Labels formatted for registration, with Value escaped. */
+    static FString MakeLabels(const TCHAR* Key, const FString& Value);
+    static FString MakeLabels(const TCHAR* Key1, const FString& Value1, const TCHAR* Key2, const FString& Value2);
+
+    /**
+     * Returns the series of family Name with Labels, creating it on the first call. Every series of a family must be
+     * of the same type; Help and Bounds are taken from the first registration of the family.
+     */
+    FCardanoCounter& Counter(const FString& Name, const FString& Help, const FString& Labels = FString());
+    FCardanoGauge& Gauge(const FString& Name, const FString& Help, const FString& Labels = FString());
+    FCardanoHistogram& Histogram(const FString& Name, const FString& Help, const FString& Labels = FString(), TArrayView<const double> Bounds = GetDurationBounds());
+
+    /** Broadcast before metrics are read, for gauges that are sampled rather than kept up to date, such as cache sizes. */
+    FSimpleMulticastDelegate& OnCollect() { return Collect; }
+
+    /**
+     * Runs the collectors, then calls Visitor once per series, grouped by family in registration order. Visitor must
+     * not register series.
+     */
+    void Visit(TFunctionRef<void(const FCardanoMetricSample& Sample)> Visitor);
+
+    /** Every series in the Prometheus text exposition format (version 0.0.4). */
+    FString ExportPrometheus();
+
+    /** Serves ExportPrometheus at Path on Port through the HTTPServer module. Returns false if the route could not be bound. */
+    bool StartHttpEndpoint(uint32 Port, const FString& Path = TEXT("/metrics"));
+    void StopHttpEndpoint();
+
+private:
+    struct FSeries
+    {
+        FString Labels;
+        TUniquePtr<FCardanoCounter> Counter;
+        TUniquePtr<FCardanoGauge> Gauge;
+        TUniquePtr<FCardanoHistogram> Histogram;
+    };
+
+    struct FFamily
+    {
+        FString Name;
+        FString Help;
+        ECardanoMetricType Type = ECardanoMetricType::Counter;
+        TArray<TUniquePtr<FSeries>> Series;
+    };
+
+    FSeries& FindOrAddSeries(const FString& Name, const FString& Help, const FString& Labels, ECardanoMetricType Type);
+
+    FCriticalSection Lock;
+    TArray<TUniquePtr<FFamily>> Families;
+    TMap<FString, FFamily*> FamiliesByName;
+
+    FSimpleMulticastDelegate Collect;
+
+    /** Route of StartHttpEndpoint; kept out of this header, which does not depend on the HTTPServer module. */
+    struct FHttpEndpoint;
+    TUniquePtr<FHttpEndpoint> HttpEndpoint;
+};
+
+/** Times the enclosing scope into Histogram; what CARDANO_SCOPE does for the phases of CardanoStats.h. */
+struct FCardanoMetricsScope
+{
+    explicit FCardanoMetricsScope(FCardanoHistogram& InHistogram) : Histogram(InHistogram), StartTime(FPlatformTime::Seconds()) {}
+    ~FCardanoMetricsScope() { Histogram.Observe(FPlatformTime::Seconds() - StartTime); }
+
+    FCardanoHistogram& Histogram;
+    const double StartTime;
+};
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "Containers/StringView.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "CardanoTypes.h"
+#include "CardanoMinAda.generated.h"
+
+/** Shelley address kinds that can hold outputs; whether the credentials are keys or scripts does not change the size. */
+UENUM(BlueprintType)
+enum class ECardanoOutputAddressType : uint8
+{
+    /** Payment and stake credentials, 57 bytes: the addr1q... addresses wallets hand out. */
+    Base,
+    /** Payment credential only, 29 bytes: addr1v... addresses. */
+    Enterprise,
+};
+
+/** What the minimum lovelace of an output depends on, for pricing an output before its exact tokens are known. */
+USTRUCT(BlueprintType)
+struct CARDANOPLUGIN_API FCardanoOutputShape
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|MinAda")
+    ECardanoOutputAddressType AddressType = ECardanoOutputAddressType::Base;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|MinAda")
+    int32 PolicyCount = 0;
+
+    /** Distinct tokens across all policies, assumed spread evenly over them. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|MinAda")
+    int32 AssetCount = 0;
+
+    /** Sum of the lengths of the asset names, in bytes rather than hex digits. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|MinAda")
+    int32 AssetNameBytes = 0;
+
+    /** Largest quantity of any one token; larger quantities take more bytes. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|MinAda")
+    int64 MaxQuantity = 1;
+
+    /** Size of the CBOR of an inline datum, or 0 for none. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|MinAda")
+    int32 InlineDatumBytes = 0;
+
+    /** Carries a datum hash instead; ignored with an inline datum. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|MinAda")
+    bool bDatumHash = false;
+};
+
+/**
+ * Minimum lovelace of transaction outputs by arithmetic alone: (160 + output size) * coins per UTxO byte, the
+ * Babbage ledger rule cardano_compute_min_ada_required applies, with the size added up from CBOR header lengths
+ * instead of serializing the output. Matches cardano-c byte for byte for the map-form outputs it writes.
+ * Pure functions of their arguments; safe from any thread.
+ */
+struct CARDANOPLUGIN_API FCardanoMinAda
+{
+    /** Size in bytes of the raw form of a bech32 or Base58 address; -1 if it is neither. */
+    static int32 GetAddressSize(FStringView Address);
+
+    static int32 GetAddressSize(ECardanoOutputAddressType AddressType);
+
+    /**
+     * Serialized size of an output holding Lovelace and Assets at an address of AddressSize bytes. Assets with the
+     * same policy and name are added together. InlineDatumBytes is the CBOR size of an inline datum, 0 for none.
+     */
+    static int64 GetOutputSize(int32 AddressSize, int64 Lovelace, const TArray<FTokenBalance>& Assets, int32 InlineDatumBytes = 0, bool bDatumHash = false);
+
+    /** Minimum lovelace of an output of Assets at an address of AddressSize bytes, counting the size of that amount itself. */
+    static int64 GetMinLovelace(int64 CoinsPerUTxOByte, int32 AddressSize, TArrayView<const FTokenBalance> Assets, int32 InlineDatumBytes = 0, bool bDatumHash = false);
+
+    /** Minimum lovelace of any output of Shape with asset names under 24 bytes each, the usual case. */
+    static int64 GetMinLovelace(int64 CoinsPerUTxOByte, const FCardanoOutputShape& Shape);
+
+    /** Serialized size of a value of Lovelace and Assets, which the ledger caps at the MaxValueSize protocol parameter. */
+    static int64 GetValueSize(int64 Lovelace, const TArray<FTokenBalance>& Assets);
+
+    /**
+     * Splits Assets into the fewest groups whose values, with any lovelace amount, stay within MaxValueSize, one per
+     * output. Assets with the same policy and name are added together first. The tokens of a policy stay in one group
+     * when they fit, since each group a policy is spread over repeats its 28-byte id; larger policies are placed first.
+     * A MaxValueSize of 0 or less keeps everything in one group.
+     */
+    static void PackAssets(TArrayView<const FTokenBalance> Assets, int64 MaxValueSize, TArray<TArray<FTokenBalance>>& OutGroups);
+};
+
+/** Min-ada pricing for Blueprints, such as the ada a shop adds to a bundle of tokens it sends. */
+UCLASS()
+class CARDANOPLUGIN_API UCardanoMinAdaLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Minimum lovelace of an output sending Assets to Address, with the coins per UTxO byte of the current protocol
+     * parameters. Returns 0 if Address is not a bech32 or Base58 address.
+     */
+    UFUNCTION(BlueprintPure, Category = "Cardano|MinAda")
+    static int64 GetMinLovelaceForOutput(const FString& Address, const TArray<FTokenBalance>& Assets, int64 CoinsPerUTxOByte, int32 InlineDatumBytes = 0);
+
+    /** Minimum lovelace of any output of Shape, for pricing bundles before their tokens are picked. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|MinAda")
+    static int64 GetMinLovelaceForShape(const FCardanoOutputShape& Shape, int64 CoinsPerUTxOByte) { return FCardanoMinAda::GetMinLovelace(CoinsPerUTxOByte, Shape); }
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "CardanoSubmissionQueue.h"
+#include "CardanoTxPlanner.h"
+#include <cardano/cardano.h>
+#include <cardano/key_handlers/secure_key_handler.h>
+#include "CardanoMintDrop.generated.h"
+
+/** Where a mint drop stands. Once it is over, ConfirmedItems and FailedItems add up to TotalItems. */
+USTRUCT(BlueprintType)
+struct CARDANOPLUGIN_API FCardanoMintDropProgress
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|MintDrop")
+    int32 TotalItems = 0;
+
+    /** Tokens whose transaction is signed and handed to UCardanoSubmissionQueue, including the confirmed ones. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|MintDrop")
+    int32 QueuedItems = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|MintDrop")
+    int32 ConfirmedItems = 0;
+
+    /** Tokens that could not be built, or whose transaction was rejected or timed out. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|MintDrop")
+    int32 FailedItems = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|MintDrop")
+    int32 QueuedTransactions = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|MintDrop")
+    int32 ConfirmedTransactions = 0;
+
+    /** Fees of the queued transactions. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|MintDrop")
+    int64 TotalFee = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|MintDrop")
+    FString LastError;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCardanoMintDropProgress, const FCardanoMintDropProgress&, Progress);
+
+/** Everything one mint drop needs. */
+struct CARDANOPLUGIN_API FCardanoMintDropConfig
+{
+    /** Parameters, addresses and funding UTxOs of the drop; Payments is ignored. A zero InvalidAfter is taken from UCardanoChainTip. */
+    FCardanoTxPlan Plan;
+
+    /** The minting policy, a native script in cardano-cli JSON. */
+    FString PolicyScriptJson;
+
+    TArray<FCardanoMintItem> Items;
+    FCardanoMintDropOptions Options;
+
+    /** Signs every transaction; referenced for the duration of the drop and used by one worker at a time. */
+    cardano_secure_key_handler_t* KeyHandler = nullptr;
+
+    /** Keys signing each transaction: the one of the funding UTxOs and the ones the policy needs. */
+    TArray<cardano_derivation_path_t> DerivationPaths;
+};
+
+/**
+ * Mints a large token drop, such as a 10k NFT collection, end to end. The items are packed into full transactions by
+ * FCardanoTxPlanner::BuildMintDrop, built in parallel and signed in one batch by FCardanoSigningPipeline on the thread
+ * pool, then all handed to UCardanoSubmissionQueue at once. When the funding UTxOs run out, the tokens left over are
+ * built in a next wave on the change of the transactions already queued, which the queue submits after their parents.
+ * OnProgress is broadcast on the game thread whenever a wave is queued or a transaction is confirmed or fails, and
+ * OnComplete once every token is confirmed or failed. The drop keeps itself alive until then.
+ * Start must be called on the game thread.
+ */
+UCLASS(BlueprintType)
+class CARDANOPLUGIN_API UCardanoMintDrop : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Starts a drop; returns nullptr with OutError if it lacks items, keys or a TTL. A policy or an item that turns
+     * out invalid fails every token through OnComplete. Bind the delegates right after: nothing is broadcast before.
+     */
+    static UCardanoMintDrop* Start(const FCardanoMintDropConfig& Config, FString& OutError);
+
+    UPROPERTY(BlueprintAssignable, Category = "Cardano|MintDrop")
+    FOnCardanoMintDropProgress OnProgress;
+
+    UPROPERTY(BlueprintAssignable, Category = "Cardano|MintDrop")
+    FOnCardanoMintDropProgress OnComplete;
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|MintDrop")
+    FCardanoMintDropProgress GetProgress() const { return Progress; }
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|MintDrop")
+    bool IsFinished() const { return bFinished; }
+
+    /** Hash of the transaction minting each item, in item order; empty for the items never queued. */
+    const TArray<FString>& GetItemTxHashes() const { return ItemTxHashes; }
+
+    virtual void BeginDestroy() override;
+
+private:
+    /** A transaction of a wave, signed on the worker. */
+    struct FSignedMint
+    {
+        FString TxHash;
+        TArray<int32> ItemIndices;
+        TArray<uint8> Transaction;
+        int64 Fee = 0;
+    };
+
+    /** Builds and signs ItemIndices on the thread pool, funded by UTxOs. */
+    void RunWave(TArray<FUTxO> UTxOs, TArray<int32> ItemIndices);
+
+    void OnWaveSigned(TArray<FSignedMint> Signed, TArray<int32> Retry, TArray<int32> Failed, FString Error, TArray<FUTxO> NextUTxOs);
+
+    UFUNCTION()
+    void OnTransactionTracked(ECardanoTxOutcome Outcome, ECardanoSubmitError Error, const FString& TxHash, const FString& ErrorMessage);
+
+    void FailItems(int32 Count, const FString& Error);
+    void UpdateProgress();
+    void ReleaseKeyHandler();
+
+    FCardanoMintDropConfig Config;
+    FCardanoMintDropProgress Progress;
+
+    /** Items of each queued transaction not reported yet, keyed by lower-case hash. */
+    TMap<FString, TArray<int32>> PendingItems;
+    TArray<FString> ItemTxHashes;
+
+    bool bFinished = false;
+};
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include "Containers/StringView.h"
+#include "CardanoHandle.h"
+#include "CardanoHash.h"
+#include "CardanoTypes.h"
+#include "CardanoWalletTypes.h"
+
+/**
+ * Native C++ counterparts of the Blueprint entry points, for server code that has no use for reflection: they take
+ * views instead of arrays and strings to copy, hand results over by move and own their cardano-c objects through
+ * TCardanoRef. UCardanoTxBuilder and UCardanoBlueprintLibrary are thin adapters on top of them.
+ * None of them touches UObjects. An object must not be used from two threads at once, but separate objects may.
+ */
+
+/** A cardano-c provider, which gives a transaction builder its network and any chain queries it makes. */
+class CARDANOPLUGIN_API FCardanoProvider
+{
+public:
+    FCardanoProvider() = default;
+    explicit FCardanoProvider(FCardanoProviderHandle&& InProvider) : Provider(MoveTemp(InProvider)) {}
+
+    /** A provider with no backend: the plugin resolves UTxOs itself and the builder only needs the network magic. */
+    static FCardanoProvider CreateOffline(cardano_network_magic_t NetworkMagic);
+
+    bool IsValid() const { return Provider.IsValid(); }
+    cardano_provider_t* Get() const { return Provider.Get(); }
+    cardano_network_magic_t GetNetworkMagic() const;
+
+private:
+    FCardanoProviderHandle Provider;
+};
+
+/**
+ * A cardano_tx_builder_t, with the calls of UCardanoTxBuilder taking views. Inputs are picked by the library's coin
+ * selector, and the fee, change and min-UTxO amounts computed from the protocol parameters it was created with.
+ * Errors of the setters are deferred and reported by Build, so calls need no checks in between.
+ */
+class CARDANOPLUGIN_API FCardanoTxBuilder
+{
+public:
+    FCardanoTxBuilder() = default;
+    FCardanoTxBuilder(FCardanoTxBuilder&&) = default;
+    FCardanoTxBuilder& operator=(FCardanoTxBuilder&&) = default;
+
+    /** Creates a builder for the network of Provider, or an invalid one, setting OutError, if Parameters do not convert. */
+    static FCardanoTxBuilder Create(const FCardanoProtocolParameters& Parameters, const FCardanoProvider& Provider, FString& OutError);
+
+    bool IsValid() const { return Builder.IsValid(); }
+    cardano_tx_builder_t* Get() const { return Builder.Get(); }
+
+    void SendLovelace(FStringView Address, int64 Lovelace);
+
+    /** Sends Lovelace plus the given native tokens; asset names are hex encoded, as returned by Koios. */
+    void SendValue(FStringView Address, int64 Lovelace, TArrayView<const FTokenBalance> Assets);
+
+    /** Sends Assets in as few outputs as MaxValueSize allows, as UCardanoTxBuilder::SendAssets does. */
+    void SendAssets(FStringView Address, int64 Lovelace, TArrayView<const FTokenBalance> Assets);
+
+    /** Sends every entry of Outputs with SendAssets, merging the entries to the same address first. */
+    void SendOutputs(TArrayView<const FTransactionOutput> Outputs);
+
+    void SetChangeAddress(FStringView Address);
+
+    /** Sets the UTxOs coin selection may spend; OwnerAddress is the address they are locked at. */
+    void SetUTxOs(FStringView OwnerAddress, TArrayView<const FUTxO> UTxOs);
+
+    /** SetUTxOs of the UTxOs of several addresses, such as every address of a wallet, keyed by the address they are locked at. */
+    void SetUTxOs(const TMap<FString, FAddressUTxOs>& UTxOsByAddress);
+
+    /** Adds Ref as a reference input, with the script and datum it carries, from UCardanoScriptCache. */
+    void AddReferenceInput(const FCardanoUTxORef& Ref);
+
+    /** AddReferenceInput of TxHash#TxIndex, with the 64 hex digits of the hash; a malformed one is reported by Build. */
+    void AddReferenceInput(FStringView TxHash, int32 TxIndex);
+
+    /** Sets the TTL slot. When never called, Build uses two hours from the slot reported by UCardanoChainTip. */
+    void SetInvalidAfter(int64 Slot);
+
+    /** Balances the transaction. Returns an empty handle, setting OutError, on failure. The builder is used up either way. */
+    FCardanoTransactionHandle Build(FString& OutError);
+
+    /** Balances the transaction and returns its unsigned CBOR, or an empty array, setting OutError, on failure. */
+    TArray<uint8> BuildCbor(FString& OutError);
+
+private:
+    /** Keeps the first error of a setter for Build to report. */
+    void Defer(FString&& Error);
+
+    /** Appends UTxOs, locked at OwnerAddress, to UTxOList; false, with the error deferred, if the address is invalid. */
+    bool AddUTxOs(cardano_utxo_list_t* UTxOList, FStringView OwnerAddress, TArrayView<const FUTxO> UTxOs);
+
+    FCardanoTxBuilderHandle Builder;
+
+    /** Of the protocol parameters the builder was created with, for packing and pricing outputs. */
+    int64 MaxValueSize = 0;
+    int64 CoinsPerUTxOByte = 0;
+
+    FString DeferredError;
+    bool bHasInvalidAfter = false;
+    bool bBuilt = false;
+};
+
+/**
+ * The key handler of one CIP-1852 account and its extended public key, created once from a mnemonic instead of on
+ * every call. The spending password is not stored: the keys are held encrypted with it, and every call decrypting
+ * them takes it again.
+ */
+class CARDANOPLUGIN_API FCardanoWallet
+{
+public:
+    FCardanoWallet() = default;
+    FCardanoWallet(FCardanoWallet&&) = default;
+    FCardanoWallet& operator=(FCardanoWallet&&) = default;
+
+    /**
+     * Creates the key handler of a 24-word mnemonic, encrypted with Password, and derives the public key of account
+     * AccountIndex. Returns an invalid wallet, setting OutError, on failure.
+     */
+    static FCardanoWallet FromMnemonic(TArrayView<const FString> MnemonicWords, FStringView Password, int32 AccountIndex, FString& OutError);
+
+    bool IsValid() const { return KeyHandler.IsValid(); }
+    cardano_secure_key_handler_t* GetKeyHandler() const { return KeyHandler.Get(); }
+    int32 GetAccountIndex() const { return AccountIndex; }
+
+    /** The 64-byte extended public key of the account; every address below it is a soft derivation. */
+    TArrayView<const uint8> GetAccountPublicKey() const { return AccountKey; }
+
+    /**
+     * Derives Count base addresses Role/(StartIndex + i), sharing the stake key at index 0, into OutAddresses, with
+     * the hashes of their payment keys in OutKeyHashes if not null. Needs no password.
+     */
+    bool DeriveAddresses(int32 Role, int32 StartIndex, int32 Count, ECardanoNetwork Network, TArray<FString>& OutAddresses, TArray<FCardanoHash28>* OutKeyHashes = nullptr) const;
+
+    /** Adds one witness per path to UnsignedTransaction. Returns its signed CBOR, or an empty array, setting OutError. */
+    TArray<uint8> SignTransaction(TArrayView<const uint8> UnsignedTransaction, TArrayView<const cardano_derivation_path_t> DerivationPaths, FStringView Password, FString& OutError) const;
+
+private:
+    FCardanoKeyHandlerHandle KeyHandler;
+    TArray<uint8> AccountKey;
+    int32 AccountIndex = 0;
+};
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Settings of one FCardanoParserFuzzer run. */
+struct FCardanoParserFuzzConfig
+{
+    /** Mutated inputs generated per input kind (CBOR and JSON), on top of the adversarial generators. */
+    int32 RandomInputs = 2000;
+
+    /** Seeds the mutator, so a run, and any finding, can be reproduced. */
+    int32 Seed = 1;
+
+    /** Largest input generated; the default is the mainnet transaction size limit. */
+    int32 MaxInputBytes = 16384;
+
+    /**
+     * An input is flagged when its cost per byte, in time or in allocated bytes, exceeds this many times the median
+     * cost per byte of the seed inputs on the same target.
+     */
+    double CostRatio = 8.0;
+
+    /** Absolute limits on top of CostRatio, in nanoseconds and allocated bytes per input byte; zero disables them. */
+    double MaxNanosPerByte = 0.0;
+    double MaxAllocatedBytesPerByte = 0.0;
+
+    /**
+     * Inputs shorter than this are costed as if they had this size, so the fixed cost of creating a reader does not
+     * flag every tiny input.
+     */
+    int32 CostFloorBytes = 256;
+
+    /**
+     * An adversarial generator is flagged as superlinear when its cost per byte at the largest size exceeds this many
+     * times its cost per byte at the smallest.
+     */
+    double GrowthRatio = 4.0;
+
+    /** Extra seeds, e.g. real transactions; a built-in transaction and Koios responses are always used. */
+    TArray<TArray<uint8>> CborSeeds;
+    TArray<FString> JsonSeeds;
+
+    /** Flagged inputs are written here, one file per finding, when set. */
+    FString OutputDirectory;
+};
+
+/** An input whose cost crossed a threshold. */
+struct FCardanoParserFuzzFinding
+{
+    FString Target;
+
+    /** The generator, e.g. "deep_arrays/16384", or "mutation/<n>" for a random input. */
+    FString Input;
+
+    int32 Size = 0;
+    double NanosPerByte = 0.0;
+    double AllocatedBytesPerByte = 0.0;
+    FString Reason;
+
+    /** Where the input was saved, if OutputDirectory was set. */
+    FString SavedTo;
+};
+
+/** Costs seen on one parser entry point. */
+struct FCardanoParserFuzzTargetStats
+{
+    FString Name;
+    int32 Inputs = 0;
+
+    /** Median cost per byte of the seeds, the reference of CostRatio. */
+    double BaselineNanosPerByte = 0.0;
+    double BaselineAllocatedBytesPerByte = 0.0;
+
+    double WorstNanosPerByte = 0.0;
+    FString WorstTimeInput;
+    double WorstAllocatedBytesPerByte = 0.0;
+    FString WorstAllocationInput;
+};
+
+/** Outcome of an FCardanoParserFuzzer run. */
+struct FCardanoParserFuzzReport
+{
+    /** Allocation costs are only measured when cardano-c is built with LIB_CARDANO_C_ALLOCATION_TRACKING. */
+    bool bAllocationTracking = false;
+
+    double ElapsedSeconds = 0.0;
+    TArray<FCardanoParserFuzzTargetStats> Targets;
+
+    /** The first findings, capped; FindingCount has them all. */
+    TArray<FCardanoParserFuzzFinding> Findings;
+    int32 FindingCount = 0;
+};
+
+/**
+ * Guards the cost, not the correctness, of the cardano-c parsers against adversarial input: deep nesting, huge
+ * declared lengths, long escape runs and random mutations of real inputs are fed to the CBOR reader (well-formedness
+ * check, skip_value, transaction decoding) and to the JSON parser, and every input whose time or allocated bytes per
+ * input byte exceeds the thresholds is reported, so decode cost on untrusted uploads stays bounded by their size.
+ *
+ * Each adversarial generator also runs at growing sizes, and is flagged when its cost per byte grows with the size.
+ * Runs are deterministic for a given Seed, blocking, and take a few seconds; call them off the game thread, with no
+ * other cardano-c work going on when allocation tracking is used, since its counters are global.
+ *
+ * Also available from the console as
+ * `Cardano.FuzzParsers [RandomInputs] [Seed] [CostRatio] [OutputDirectory] [SeedFile...]`, which logs the report.
+ */
+class CARDANOPLUGIN_API FCardanoParserFuzzer
+{
+public:
+    static FCardanoParserFuzzReport Run(const FCardanoParserFuzzConfig& Config);
+
+    /** Formats a report as a fixed-width table, one line per target, followed by the findings. */
+    static FString FormatReport(const FCardanoParserFuzzReport& Report);
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoHash.h"
+#include <cardano/cardano.h>
+#include <cardano/key_handlers/derivation_path.h>
+
+/** Position of a payment key in a CIP-1852 wallet: m/1852'/1815'/Account'/Role/Index. */
+struct FCardanoKeyLocation
+{
+    int32 Account = 0;
+    int32 Role = 0;
+    int32 Index = 0;
+
+    cardano_derivation_path_t ToDerivationPath() const;
+
+    bool operator==(const FCardanoKeyLocation& Other) const { return Account == Other.Account && Role == Other.Role && Index == Other.Index; }
+
+    friend uint32 GetTypeHash(const FCardanoKeyLocation& Location)
+    {
+        return HashCombine(HashCombine(::GetTypeHash(Location.Account), ::GetTypeHash(Location.Role)), ::GetTypeHash(Location.Index));
+    }
+};
+
+/**
+ * Reverse index from the Blake2b-224 hash of a payment key to where the key is derived, filled as addresses are
+ * derived, since the hashes are computed for the addresses anyway. Working out which key signs an input then takes
+ * one lookup of the payment credential of its address instead of deriving keys until one matches.
+ * Only key-hash payment credentials are indexed; script-locked and Byron addresses are never found.
+ * Not thread-safe.
+ */
+class CARDANOPLUGIN_API FCardanoPaymentKeyIndex
+{
+public:
+    /** Indexes the key hashes of Account/Role/(StartIndex + i), in the order derive_base_addresses returns them. */
+    void AddRange(int32 Account, int32 Role, int32 StartIndex, TArrayView<const FCardanoHash28> KeyHashes);
+
+    bool Find(const FCardanoHash28& KeyHash, FCardanoKeyLocation& OutLocation) const;
+
+    /** Looks up the payment credential of a bech32 base, enterprise or pointer address. */
+    bool FindAddress(const FString& Address, FCardanoKeyLocation& OutLocation) const;
+
+    /** Reads the payment key hash of an address; false if it is malformed or its payment credential is a script. */
+    static bool ReadPaymentKeyHash(const FString& Address, FCardanoHash28& OutKeyHash);
+
+    void Reset() { Locations.Reset(); }
+
+    int32 Num() const { return Locations.Num(); }
+
+private:
+    TMap<FCardanoHash28, FCardanoKeyLocation> Locations;
+};
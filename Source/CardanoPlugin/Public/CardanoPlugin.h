@@ -12,4 +12,11 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	/** Samples the cardano-c allocation counters into the Cardano stat group. */
+	FDelegateHandle AllocationStatsHandle;
+
+	/** Samples them into FCardanoMetrics as well, when it is read. */
+	FDelegateHandle AllocationMetricsHandle;
 };
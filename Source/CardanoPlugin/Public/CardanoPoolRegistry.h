@@ -0,0 +1,197 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Containers/Ticker.h"
+#include "CardanoPoolRegistry.generated.h"
+
+/** Orders of the ranked pool lists; each one has an index built when the registry is loaded. */
+UENUM(BlueprintType)
+enum class ECardanoPoolSort : uint8
+{
+    /** Live stake over the saturation point, in percent. */
+    Saturation,
+    Margin,
+    Pledge,
+    /** Blocks minted over the lifetime of the pool. */
+    Performance,
+};
+
+/** What delegation screens show of a registered stake pool. */
+USTRUCT(BlueprintType)
+struct FCardanoStakePool
+{
+    GENERATED_BODY()
+
+    /** Bech32, pool1... */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    FString PoolId;
+
+    /** From the pool's metadata; empty when it has none or it could not be fetched. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    FString Ticker;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    FString Name;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    FString Homepage;
+
+    /** Fraction of the rewards kept by the operator, between 0 and 1. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    float Margin = 0.0f;
+
+    /** In lovelace, as are the other amounts. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    int64 FixedCost = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    int64 Pledge = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    int64 LiveStake = 0;
+
+    /** Live stake over the saturation point, in percent; above 100 rewards are capped. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    float Saturation = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    int32 BlocksMinted = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    int32 Delegators = 0;
+
+    /** The pool announced its retirement; delegating to it stops earning rewards when it retires. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    bool bRetiring = false;
+};
+
+/** A ranked, filtered page of the registry. Limits left at their defaults do not filter. */
+USTRUCT(BlueprintType)
+struct FCardanoPoolQuery
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "Cardano|Pools")
+    ECardanoPoolSort SortBy = ECardanoPoolSort::Saturation;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Cardano|Pools")
+    bool bDescending = true;
+
+    /** Case-insensitive prefix of the ticker or the name; empty matches every pool. */
+    UPROPERTY(BlueprintReadWrite, Category = "Cardano|Pools")
+    FString Search;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Cardano|Pools")
+    float MaxMargin = 1.0f;
+    UPROPERTY(BlueprintReadWrite, Category = "Cardano|Pools")
+    int64 MinPledge = 0;
+
+    /** 0 for no limit. */
+    UPROPERTY(BlueprintReadWrite, Category = "Cardano|Pools")
+    float MaxSaturation = 0.0f;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Cardano|Pools")
+    bool bIncludeRetiring = false;
+
+    /** Matching pools skipped before the page starts. */
+    UPROPERTY(BlueprintReadWrite, Category = "Cardano|Pools")
+    int32 Offset = 0;
+    UPROPERTY(BlueprintReadWrite, Category = "Cardano|Pools")
+    int32 Limit = 20;
+};
+
+USTRUCT(BlueprintType)
+struct FCardanoPoolPage
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    TArray<FCardanoStakePool> Pools;
+
+    /** Pools matching the filters across every page. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    int32 TotalMatches = 0;
+
+    /** Epoch the registry was fetched in. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Pools")
+    int32 EpochNo = 0;
+};
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnPoolRegistryResult, bool, Success, const FString&, ErrorMessage);
+
+/**
+ * Every registered stake pool of the network, fetched with Koios pool_list and pool_info once per epoch and then
+ * served from memory and Saved/Cardano/PoolRegistry.bin, so delegation screens rank, filter and page through pools
+ * without a request or decoding per view. Pool parameters only change at epoch boundaries; live stake and block
+ * counts drift during the epoch, but rank well enough until the next refresh.
+ * One index per ECardanoPoolSort is built when pools are loaded, so a query only walks its order, filtering as it
+ * goes, and copies out the pools of the requested page.
+ * All methods must be called on the game thread.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoPoolRegistry : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide registry, or nullptr before the engine is initialized. */
+    static UCardanoPoolRegistry* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** True once pools were loaded from disk or fetched, even from an earlier epoch. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Pools")
+    bool HasPools() const { return Pools.Num() > 0; }
+
+    /** Fills OutPage from the pools in memory, without any request; false if none are loaded yet. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Pools")
+    bool Query(const FCardanoPoolQuery& Query, FCardanoPoolPage& OutPage) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Pools")
+    bool FindPool(const FString& PoolId, FCardanoStakePool& OutPool) const;
+
+    /** Fetches the registry again, even if it is current; callers asking while a refresh runs wait for it. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Pools")
+    void Refresh(const FOnPoolRegistryResult& OnComplete);
+
+private:
+    struct FRefreshState;
+
+    static constexpr int32 NumSortOrders = 4;
+
+    bool Tick(float DeltaTime);
+    bool IsCurrent() const;
+    void StartRefresh();
+    void FetchPoolIds(TSharedRef<FRefreshState> Refresh, int32 Offset);
+    void FetchPoolInfo(TSharedRef<FRefreshState> Refresh, const TArray<FString>& PoolIds);
+    void CompleteStep(TSharedRef<FRefreshState> Refresh);
+
+    void BuildIndexes();
+    static bool Matches(const FCardanoStakePool& Pool, const FCardanoPoolQuery& Query);
+
+    FString GetCacheFilePath() const;
+    /** Reads or writes the on-disk form of the registry, depending on Ar.IsLoading(). */
+    void SerializeRegistry(FArchive& Ar);
+    void LoadFromDisk();
+    void SaveToDisk();
+
+    /** How often the epoch boundary is checked. */
+    UPROPERTY(Config)
+    float EpochCheckIntervalSeconds = 60.0f;
+
+    /** Refresh period for networks whose epoch cannot be computed locally. */
+    UPROPERTY(Config)
+    float FallbackRefreshSeconds = 6 * 3600.0f;
+
+    TArray<FCardanoStakePool> Pools;
+
+    /** Positions in Pools, in ascending order of each ECardanoPoolSort. */
+    TArray<int32> Indexes[NumSortOrders];
+
+    TMap<FString, int32> PoolsById;
+
+    int64 EpochNo = 0;
+    int32 NetworkMagic = 0;
+    double LastRefreshTime = 0.0;
+
+    bool bRefreshInProgress = false;
+    TArray<FOnPoolRegistryResult> PendingCallbacks;
+    FDelegateHandle TickHandle;
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "CardanoHash.h"
+#include "CardanoTypes.h"
+#include "CardanoWalletSubsystem.h"
+#include "CardanoPrefetch.generated.h"
+
+/**
+ * Speculative warm-up of what a payment from a wallet needs, for game code to call on a sign of intent such as a shop
+ * item hovered, a menu opened or a match started, so pressing "buy" does not wait on the network.
+ * PrefetchWallet brings the wallet's UTxOs, the protocol parameters and the chain tip up to date. PrefetchSend also
+ * runs coin selection for a likely payment once they are in, building its unsigned transaction on a worker thread;
+ * UCardanoSendAction takes that transaction when asked for the same outputs, leaving only signing and submission.
+ * One payment is kept per wallet. It is dropped when another one is prefetched for the wallet, when one of its inputs
+ * stops being spendable, when the epoch changes or PrebuiltLifetimeSeconds after it was built.
+ * Calls are cheap to repeat on every intent signal: fetches in flight are joined, and a payment already prebuilt or
+ * being built is not built again.
+ * All methods must be called on the game thread.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoPrefetch : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide prefetcher, or nullptr before the engine is initialized. */
+    static UCardanoPrefetch* Get();
+
+    virtual void Deinitialize() override;
+
+    /** Refreshes the UTxOs of Wallet, the protocol parameters and the chain tip, each only if not already current. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Prefetch")
+    void PrefetchWallet(FCardanoWalletHandle Wallet);
+
+    /** PrefetchWallet, then prebuilds the transaction paying Outputs from Wallet as soon as its inputs are in. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Prefetch")
+    void PrefetchSend(FCardanoWalletHandle Wallet, const TArray<FTransactionOutput>& Outputs);
+
+    /** True while a transaction paying Outputs from Wallet is prebuilt and still valid. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Prefetch")
+    bool IsSendPrefetched(FCardanoWalletHandle Wallet, const TArray<FTransactionOutput>& Outputs) const;
+
+    /**
+     * Moves out the prebuilt unsigned transaction paying Outputs from Wallet. Returns false if there is none, or it
+     * pays other outputs or is no longer valid; it is used once either way.
+     */
+    bool TakeTransaction(FCardanoWalletHandle Wallet, const TArray<FTransactionOutput>& Outputs, TArray<uint8>& OutUnsignedTransaction);
+
+private:
+    struct FPrebuilt
+    {
+        TArray<FTransactionOutput> Outputs;
+
+        /** Empty until built. */
+        TArray<uint8> Transaction;
+        TSet<FCardanoUTxORef> Inputs;
+        int32 EpochNo = 0;
+        double BuiltTime = 0.0;
+
+        /** Tells a build finishing apart from one started for outputs prefetched later. */
+        uint32 Generation = 0;
+        bool bBuilding = false;
+    };
+
+    bool IsUsable(const FPrebuilt& Prebuilt) const;
+
+    /** Starts building every prefetched payment whose protocol parameters and UTxOs are in. */
+    void BuildPending();
+
+    UFUNCTION()
+    void OnParametersFetched(bool bSuccess, const FCardanoProtocolParameters& Parameters, const FString& ErrorMessage);
+
+    UFUNCTION()
+    void OnUTxOsRefreshed(bool bSuccess, const FString& ErrorMessage);
+
+    /** Seconds a prebuilt transaction is used for; it is built with two hours of validity. */
+    UPROPERTY(Config)
+    float PrebuiltLifetimeSeconds = 120.0f;
+
+    /** Keyed by wallet id. */
+    TMap<int32, FPrebuilt> Prebuilts;
+    uint32 NextGeneration = 1;
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Containers/Ticker.h"
+#include "CardanoSharedCache.h"
+#include "CardanoTypes.h"
+#include "CardanoProtocolParamsCache.generated.h"
+
+/**
+ * Process-wide copy of the current epoch's protocol parameters, shared by every transaction builder.
+ * Parameters are fetched once per epoch, refreshed in the background when the epoch boundary passes,
+ * and persisted under Saved/Cardano so a cold start can build transactions before the network answers.
+ * With SharedMemoryName set, the server processes of a host share them: one writer process fetches and publishes
+ * them to shared memory, and the others take them from there, only fetching themselves when asked for parameters
+ * the writer has not caught up with yet.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoProtocolParamsCache : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide cache, or nullptr before the engine is initialized. */
+    static UCardanoProtocolParamsCache* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Returns the cached parameters without blocking; false if none have been loaded or fetched yet. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|ProtocolParameters")
+    bool GetCachedParameters(FCardanoProtocolParameters& OutParameters) const;
+
+    /** Completes immediately with the cached parameters when they belong to the current epoch, otherwise fetches them first. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|ProtocolParameters")
+    void GetParameters(const FOnProtocolParametersResult& OnComplete);
+
+    /** Fetches the parameters again even if the cached ones are current. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|ProtocolParameters")
+    void Refresh(const FOnProtocolParametersResult& OnComplete);
+
+private:
+    bool Tick(float DeltaTime);
+    bool IsCurrent() const;
+    void StartFetch();
+
+    UFUNCTION()
+    void OnFetched(bool bSuccess, const FCardanoProtocolParameters& Parameters, const FString& ErrorMessage);
+
+    FString GetCacheFilePath() const;
+    void LoadFromDisk();
+    void SaveToDisk() const;
+
+    bool TickSharedCache(float DeltaTime);
+
+    /** True in the processes reading the shared parameters rather than fetching them. */
+    bool IsSharedReader() const { return SharedCache.IsValid() && !SharedCache->IsWriter(); }
+
+    void AdoptSharedParameters();
+    void PublishSharedParameters();
+
+    /** How often the epoch boundary is checked. */
+    UPROPERTY(Config)
+    float EpochCheckIntervalSeconds = 60.0f;
+
+    /** Refresh period for networks whose epoch cannot be computed locally. */
+    UPROPERTY(Config)
+    float FallbackRefreshSeconds = 3600.0f;
+
+    /** Shared memory segment to share the parameters through with the other processes of the host; empty to keep them private. */
+    UPROPERTY(Config)
+    FString SharedMemoryName;
+
+    /** Seconds without a heartbeat after which another process takes over as the writer. */
+    UPROPERTY(Config)
+    float SharedWriterTimeoutSeconds = 15.0f;
+
+    FCardanoProtocolParameters Cached;
+    bool bHasParameters = false;
+    bool bFetchInProgress = false;
+    double LastFetchTime = 0.0;
+    TArray<FOnProtocolParametersResult> PendingCallbacks;
+    FDelegateHandle TickHandle;
+
+    TUniquePtr<FCardanoSharedCache> SharedCache;
+    FDelegateHandle SharedTickHandle;
+
+    /** Version of the shared parameters last adopted; set when the parameters changed since they were last published. */
+    uint64 SharedVersion = 0;
+    bool bSharedDirty = false;
+};
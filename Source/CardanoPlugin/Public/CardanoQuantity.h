@@ -0,0 +1,165 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "CardanoTypes.h"
+#include <cardano/common/bigint.h>
+#include "CardanoQuantity.generated.h"
+
+/**
+ * Exact signed 128-bit amount of lovelace or of a token, for inventory math without float rounding or re-parsing
+ * the decimal strings Koios returns: sums of any number of uint64 token quantities stay exact, and mint quantities
+ * may be negative. Arithmetic is checked; see UCardanoQuantityLibrary for Blueprints.
+ * Exported to text, config and JSON as a decimal integer.
+ */
+USTRUCT(BlueprintType)
+struct CARDANOPLUGIN_API FCardanoQuantity
+{
+    GENERATED_BODY()
+
+    /** Two's complement, in two words. */
+    uint64 Low = 0;
+    uint64 High = 0;
+
+    FCardanoQuantity() = default;
+
+    static FCardanoQuantity FromInt64(int64 Value);
+    static FCardanoQuantity FromUInt64(uint64 Value);
+
+    /** Parses a decimal integer with an optional sign. Returns false, leaving OutQuantity untouched, on anything else or on overflow. */
+    static bool FromString(const FString& Text, FCardanoQuantity& OutQuantity);
+
+    /**
+     * Parses a decimal number with at most Decimals fractional digits, scaled to an integer of the smallest unit:
+     * "12.5" ada with 6 decimals is 12500000 lovelace.
+     */
+    static bool FromDecimalString(const FString& Text, int32 Decimals, FCardanoQuantity& OutQuantity);
+
+    /** Reads a cardano-c big integer; false if it does not fit 128 bits. */
+    static bool FromBigint(cardano_bigint_t* Bigint, FCardanoQuantity& OutQuantity);
+
+    FString ToString() const;
+
+    /** Inverse of FromDecimalString, without trailing fractional zeros: 12500000 with 6 decimals is "12.5". */
+    FString ToDecimalString(int32 Decimals) const;
+
+    /** Returns false, leaving OutValue untouched, if the quantity does not fit. */
+    bool ToInt64(int64& OutValue) const;
+    bool ToUInt64(uint64& OutValue) const;
+
+    /** Creates a cardano-c big integer of the same value, to be released with cardano_bigint_unref. */
+    bool ToBigint(cardano_bigint_t** OutBigint) const;
+
+    bool IsZero() const { return Low == 0 && High == 0; }
+    bool IsNegative() const { return (High >> 63) != 0; }
+
+    /** Checked arithmetic: returns false, leaving OutResult untouched, if the result does not fit 128 bits. */
+    static bool Add(const FCardanoQuantity& A, const FCardanoQuantity& B, FCardanoQuantity& OutResult);
+    static bool Subtract(const FCardanoQuantity& A, const FCardanoQuantity& B, FCardanoQuantity& OutResult);
+    static bool Multiply(const FCardanoQuantity& A, int64 B, FCardanoQuantity& OutResult);
+
+    /** Truncates toward zero; the remainder has the sign of A. Returns false if B is zero or on overflow. */
+    static bool Divide(const FCardanoQuantity& A, int64 B, FCardanoQuantity& OutQuotient, FCardanoQuantity& OutRemainder);
+
+    /** Negative, zero or positive as A is less than, equal to or greater than B. */
+    static int32 Compare(const FCardanoQuantity& A, const FCardanoQuantity& B);
+
+    bool operator==(const FCardanoQuantity& Other) const { return Low == Other.Low && High == Other.High; }
+    bool operator!=(const FCardanoQuantity& Other) const { return !(*this == Other); }
+    bool operator<(const FCardanoQuantity& Other) const { return Compare(*this, Other) < 0; }
+    bool operator<=(const FCardanoQuantity& Other) const { return Compare(*this, Other) <= 0; }
+
+    friend uint32 GetTypeHash(const FCardanoQuantity& Quantity) { return HashCombine(GetTypeHash(Quantity.Low), GetTypeHash(Quantity.High)); }
+
+    bool Serialize(FArchive& Ar);
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+    bool ExportTextItem(FString& ValueStr, const FCardanoQuantity& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const;
+    bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCardanoQuantity> : public TStructOpsTypeTraitsBase2<FCardanoQuantity>
+{
+    enum
+    {
+        WithSerializer = true,
+        WithNetSerializer = true,
+        WithExportTextItem = true,
+        WithImportTextItem = true,
+        WithIdenticalViaEquality = true,
+    };
+};
+
+/**
+ * Math nodes over FCardanoQuantity. An overflowing result is clamped to the nearest representable value and logged;
+ * amounts that can exist on chain are far from the 128-bit range.
+ */
+UCLASS()
+class CARDANOPLUGIN_API UCardanoQuantityLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity", meta = (DisplayName = "To Quantity (Int64)", CompactNodeTitle = "->", BlueprintAutocast))
+    static FCardanoQuantity Conv_Int64ToQuantity(int64 Value) { return FCardanoQuantity::FromInt64(Value); }
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity", meta = (DisplayName = "To String (Quantity)", CompactNodeTitle = "->", BlueprintAutocast))
+    static FString Conv_QuantityToString(const FCardanoQuantity& Quantity) { return Quantity.ToString(); }
+
+    /** Returns false, leaving zero, if Text is not a decimal integer. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity")
+    static bool MakeQuantityFromString(const FString& Text, FCardanoQuantity& OutQuantity);
+
+    /** Parses "12.5" with 6 decimals as 12500000; false, leaving zero, if Text has more decimals or is not a number. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity")
+    static bool MakeQuantityFromDecimalString(const FString& Text, int32 Decimals, FCardanoQuantity& OutQuantity);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity")
+    static FString ToDecimalString(const FCardanoQuantity& Quantity, int32 Decimals) { return Quantity.ToDecimalString(Decimals); }
+
+    /** Returns false, leaving zero, if the quantity does not fit an int64. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity")
+    static bool ToInt64(const FCardanoQuantity& Quantity, int64& OutValue);
+
+    /** The quantity of Token, parsed once. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity")
+    static FCardanoQuantity GetTokenQuantity(const FTokenBalance& Token);
+
+    /** Total of the entries of Tokens naming PolicyId and AssetName, such as across the UTxOs of a wallet. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity")
+    static FCardanoQuantity SumTokenQuantity(const TArray<FTokenBalance>& Tokens, const FString& PolicyId, const FString& AssetName);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity", meta = (DisplayName = "quantity + quantity", CompactNodeTitle = "+"))
+    static FCardanoQuantity Add_QuantityQuantity(const FCardanoQuantity& A, const FCardanoQuantity& B);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity", meta = (DisplayName = "quantity - quantity", CompactNodeTitle = "-"))
+    static FCardanoQuantity Subtract_QuantityQuantity(const FCardanoQuantity& A, const FCardanoQuantity& B);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity", meta = (DisplayName = "quantity * int64", CompactNodeTitle = "*"))
+    static FCardanoQuantity Multiply_QuantityInt64(const FCardanoQuantity& A, int64 B);
+
+    /** Truncates toward zero; dividing by zero returns zero and is logged. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity", meta = (DisplayName = "quantity / int64", CompactNodeTitle = "/"))
+    static FCardanoQuantity Divide_QuantityInt64(const FCardanoQuantity& A, int64 B, FCardanoQuantity& Remainder);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity", meta = (DisplayName = "quantity == quantity", CompactNodeTitle = "=="))
+    static bool EqualEqual_QuantityQuantity(const FCardanoQuantity& A, const FCardanoQuantity& B) { return A == B; }
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity", meta = (DisplayName = "quantity < quantity", CompactNodeTitle = "<"))
+    static bool Less_QuantityQuantity(const FCardanoQuantity& A, const FCardanoQuantity& B) { return FCardanoQuantity::Compare(A, B) < 0; }
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity", meta = (DisplayName = "quantity <= quantity", CompactNodeTitle = "<="))
+    static bool LessEqual_QuantityQuantity(const FCardanoQuantity& A, const FCardanoQuantity& B) { return FCardanoQuantity::Compare(A, B) <= 0; }
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity", meta = (DisplayName = "quantity > quantity", CompactNodeTitle = ">"))
+    static bool Greater_QuantityQuantity(const FCardanoQuantity& A, const FCardanoQuantity& B) { return FCardanoQuantity::Compare(A, B) > 0; }
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity", meta = (DisplayName = "quantity >= quantity", CompactNodeTitle = ">="))
+    static bool GreaterEqual_QuantityQuantity(const FCardanoQuantity& A, const FCardanoQuantity& B) { return FCardanoQuantity::Compare(A, B) >= 0; }
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity")
+    static bool IsZero(const FCardanoQuantity& Quantity) { return Quantity.IsZero(); }
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Quantity")
+    static bool IsNegative(const FCardanoQuantity& Quantity) { return Quantity.IsNegative(); }
+};
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Containers/Ticker.h"
+#include "CardanoHash.h"
+#include "CardanoTypes.h"
+#include <cardano/cardano.h>
+#include "CardanoScriptCache.generated.h"
+
+/** On-disk form of a cached script: the CBOR of its script reference, keyed by its hash. */
+USTRUCT()
+struct FCardanoCachedScriptRecord
+{
+    GENERATED_BODY()
+    UPROPERTY()
+    FString Hash;
+    UPROPERTY()
+    FString Cbor;
+};
+
+/** On-disk form of a cached reference input. Its script, if any, is stored once with the scripts, by hash. */
+USTRUCT()
+struct FCardanoCachedReferenceRecord
+{
+    GENERATED_BODY()
+    UPROPERTY()
+    FString TxHash;
+    UPROPERTY()
+    int32 TxIndex = 0;
+    UPROPERTY()
+    FString Address;
+    UPROPERTY()
+    int64 Value = 0;
+    UPROPERTY()
+    TArray<FTokenBalance> Assets;
+    UPROPERTY()
+    FString DatumHash;
+
+    /** CBOR hex of the inline datum, if the output has one. */
+    UPROPERTY()
+    FString InlineDatum;
+    UPROPERTY()
+    FString ScriptHash;
+};
+
+/** On-disk form of the cache. */
+USTRUCT()
+struct FCardanoScriptCacheFile
+{
+    GENERATED_BODY()
+    UPROPERTY()
+    TArray<FCardanoCachedScriptRecord> Scripts;
+    UPROPERTY()
+    TArray<FCardanoCachedReferenceRecord> References;
+};
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnReferenceInputsResult, bool, Success, const FString&, ErrorMessage);
+
+/**
+ * Reference inputs and the scripts they carry, fetched with Koios utxo_info once, decoded once and then served from
+ * memory and Saved/Cardano/ReferenceScripts.json, so a Plutus interaction does not fetch and decode a 10+ KB script
+ * for every transaction it builds.
+ * Scripts are content-addressed by hash, so outputs carrying the same script share one decoded cardano_script_t, and
+ * its hash and serialized size are computed when it is cached. The cached scripts and reference UTxOs are frozen, so
+ * builders on any thread may use them at once.
+ * The references listed in PrefetchReferenceInputs, such as the deployed scripts of the protocols a game talks to,
+ * are fetched at startup; others are fetched on demand with FetchReferenceInputs. Outputs are never spent and
+ * re-created with the same reference, so cached entries do not expire.
+ * All methods must be called on the game thread.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoScriptCache : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide cache, or nullptr before the engine is initialized. */
+    static UCardanoScriptCache* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Parses a "TxHash#TxIndex" reference. */
+    static bool ParseReference(const FString& Reference, FCardanoUTxORef& OutRef);
+
+    /** Fetches the outputs of References ("TxHash#TxIndex") that are not cached yet, with their scripts. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|ScriptCache")
+    void FetchReferenceInputs(const TArray<FString>& References, const FOnReferenceInputsResult& OnComplete);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|ScriptCache")
+    bool IsReferenceInputCached(const FString& Reference) const;
+
+    /** New reference to the frozen UTxO of Ref, script and datum attached, or nullptr if it is not cached. */
+    cardano_utxo_t* FindReferenceInput(const FCardanoUTxORef& Ref) const;
+
+    /** New reference to the frozen script with hash Hash, or nullptr if it is not cached. */
+    cardano_script_t* FindScript(const FCardanoHash28& Hash) const;
+
+    /** Serialized size of the script, as the reference script fee counts it, or -1 if it is not cached. */
+    int32 GetScriptSize(const FCardanoHash28& Hash) const;
+
+    /**
+     * Caches Script, e.g. one shipped with the game rather than referenced on chain, and returns its hash. The cache
+     * keeps a decoded copy of its own; Script is left untouched.
+     */
+    bool AddScript(cardano_script_t* Script, FCardanoHash28& OutHash);
+
+    /** Drops every cached entry, in memory and on disk. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|ScriptCache")
+    void Clear();
+
+private:
+    struct FFetchRequest;
+
+    struct FScriptEntry
+    {
+        cardano_script_t* Script = nullptr;
+        int32 Size = 0;
+        FCardanoCachedScriptRecord Record;
+    };
+
+    struct FReferenceEntry
+    {
+        cardano_utxo_t* UTxO = nullptr;
+        FCardanoCachedReferenceRecord Record;
+    };
+
+    /** Decodes Record and caches it under its hash, unless already cached. Returns false if it does not decode to it. */
+    bool AddScriptRecord(const FCardanoCachedScriptRecord& Record);
+
+    /** Builds and caches the UTxO of Record, whose script must be cached already if it has one. */
+    bool AddReferenceRecord(const FCardanoCachedReferenceRecord& Record);
+
+    void FetchBatch(const TArray<FCardanoUTxORef>& Refs);
+    void CompleteReference(const FCardanoUTxORef& Ref, const FString& ErrorMessage);
+
+    void LoadFromDisk();
+
+    /** Saves at most once a second, however many batches complete meanwhile. */
+    void ScheduleSave();
+    bool SaveToDisk(float DeltaTime);
+
+    void ReleaseAll();
+
+    FString GetCacheFilePath() const;
+
+    /** "TxHash#TxIndex" references fetched at startup unless cached already. */
+    UPROPERTY(Config)
+    TArray<FString> PrefetchReferenceInputs;
+
+    TMap<FCardanoHash28, FScriptEntry> Scripts;
+    TMap<FCardanoUTxORef, FReferenceEntry> References;
+
+    /** References being fetched, with the requests waiting for them. */
+    TMap<FCardanoUTxORef, TArray<TSharedRef<FFetchRequest>>> InFlight;
+
+    FDelegateHandle SaveHandle;
+};
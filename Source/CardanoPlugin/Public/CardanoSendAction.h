@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "CardanoSubmissionQueue.h"
+#include "CardanoTask.h"
+#include "CardanoTypes.h"
+#include "CardanoWalletSubsystem.h"
+#include "CardanoSendAction.generated.h"
+
+/** TxHash is empty, and Error None, when the flow stopped before the transaction was submitted. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnCardanoSend, const FString&, TxHash, ECardanoSubmitError, Error, const FString&, ErrorMessage);
+
+/**
+ * Pays Outputs from a wallet of UCardanoWalletSubsystem in one node, instead of a Blueprint chaining the fetch, build,
+ * sign and submit callbacks and carrying their state by hand. The protocol parameters and the wallet's UTxOs are
+ * fetched at once, as neither needs the other, so the flow waits for the slower of the two rather than for both in
+ * turn; every step after them needs the one before. The transaction is built on a worker thread with
+ * FCardanoTxBuilder, its change going to the wallet's change address, signed by the wallet and queued on
+ * UCardanoSubmissionQueue. OnSubmitted fires once it is queued, which lets the next send spend its change, and
+ * OnConfirmed once it reaches the queue's confirmations. OnFailure fires instead of either when a step fails.
+ * The UTxOs are those cached by UCardanoUTxOCache, with pending transactions applied; the cache is only refreshed
+ * first when an address of the wallet has not been downloaded yet. A transaction prebuilt by UCardanoPrefetch for the
+ * same outputs skips the fetches and the build.
+ */
+UCLASS()
+class CARDANOPLUGIN_API UCardanoSendAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet", meta = (BlueprintInternalUseOnly = "true"))
+    static UCardanoSendAction* SendAsync(FCardanoWalletHandle Wallet, const TArray<FTransactionOutput>& Outputs, const FString& Password);
+
+    UPROPERTY(BlueprintAssignable)
+    FOnCardanoSend OnSubmitted;
+
+    UPROPERTY(BlueprintAssignable)
+    FOnCardanoSend OnConfirmed;
+
+    UPROPERTY(BlueprintAssignable)
+    FOnCardanoSend OnFailure;
+
+    virtual void Activate() override;
+
+    /**
+     * Builds the unsigned transaction paying Outputs from Wallet on a worker thread, with its change to the wallet's
+     * change address and a TTL two hours ahead. Called on the game thread.
+     */
+    static TCardanoTask<TArray<uint8>> BuildPayment(FCardanoWalletHandle Wallet, const TArray<FTransactionOutput>& Outputs,
+        const FCardanoProtocolParameters& Parameters, const TMap<FString, FAddressUTxOs>& UTxOs);
+
+    /** The spendable UTxOs of every address of Wallet holding any; false while one is not downloaded yet. */
+    static bool ReadWalletUTxOs(FCardanoWalletHandle Wallet, TMap<FString, FAddressUTxOs>& OutUTxOs);
+
+private:
+    TCardanoTask<FCardanoProtocolParameters> FetchParameters();
+    TCardanoTask<TMap<FString, FAddressUTxOs>> FetchUTxOs();
+    TCardanoTask<TArray<uint8>> Sign(const TArray<uint8>& UnsignedTransaction);
+    void Submit(const TArray<uint8>& SignedTransaction);
+
+    UFUNCTION()
+    void OnParameters(bool bSuccess, const FCardanoProtocolParameters& Parameters, const FString& ErrorMessage);
+
+    UFUNCTION()
+    void OnUTxOsRefreshed(bool bSuccess, const FString& ErrorMessage);
+
+    UFUNCTION()
+    void OnSigned(bool bSuccess, const TArray<uint8>& SignedTransaction, const FString& ErrorMessage);
+
+    UFUNCTION()
+    void OnTracked(ECardanoTxOutcome Outcome, ECardanoSubmitError Error, const FString& TxHash, const FString& ErrorMessage);
+
+    void Finish(const FOnCardanoSend& Delegate, ECardanoSubmitError Error, const FString& ErrorMessage);
+
+    FCardanoWalletHandle Wallet;
+    TArray<FTransactionOutput> Outputs;
+    FString Password;
+
+    /** Finished by the delegates above, which the steps waiting on them continue from. */
+    TCardanoTask<FCardanoProtocolParameters> ParametersTask;
+    TCardanoTask<TMap<FString, FAddressUTxOs>> UTxOsTask;
+    TCardanoTask<TArray<uint8>> SignTask;
+
+    FString TxHash;
+    double StartTime = 0.0;
+    bool bFinished = false;
+};
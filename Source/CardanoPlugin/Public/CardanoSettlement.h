@@ -0,0 +1,232 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Containers/Ticker.h"
+#include "CardanoSubmissionQueue.h"
+#include "CardanoTxPlanner.h"
+#include <cardano/cardano.h>
+#include <cardano/key_handlers/secure_key_handler.h>
+#include "CardanoSettlement.generated.h"
+
+/**
+ * A micro-payment a player signed with CIP-30 signData: Lovelace moved off-chain from the ledger account From to the
+ * account To, which may be the treasury's. The payload signed must be FCardanoSettlementLedger::MakeIntentPayload of
+ * the same fields, signed for the address From.
+ */
+struct CARDANOPLUGIN_API FCardanoPaymentIntent
+{
+    FString From;
+    FString To;
+    int64 Lovelace = 0;
+
+    /** Greater than the nonce of every intent of From accepted before, so a signed intent cannot be replayed. */
+    int64 Nonce = 0;
+
+    /** COSE_Sign1 and COSE_Key CBOR of the DataSignature. */
+    TArray<uint8> Signature;
+    TArray<uint8> Key;
+};
+
+enum class ECardanoIntentStatus : uint8
+{
+    Accepted,
+
+    /** Not a positive amount, or from and to the same account. */
+    Invalid,
+
+    /** The signature does not verify, or is not for From or for this intent. */
+    BadSignature,
+
+    /** The nonce is not greater than the last one accepted from From. */
+    Replayed,
+
+    /** From does not hold Lovelace, counting the intents accepted before it. */
+    InsufficientBalance
+};
+
+struct CARDANOPLUGIN_API FCardanoIntentResult
+{
+    ECardanoIntentStatus Status = ECardanoIntentStatus::Invalid;
+    FString Error;
+};
+
+/**
+ * Off-chain balances of the players paying each other and the treasury in amounts too small to be worth a
+ * transaction each, such as tips, rentals and entry fees. Accounts are bech32 addresses. Lovelace enters through
+ * Credit, for deposits seen on chain and rewards the treasury grants, moves between accounts through signed intents,
+ * and leaves through TakePayouts, which nets everything an account received and spent since its last payout into one
+ * payment. The treasury's own account is never paid out: it is the revenue of the intents paying it.
+ * Does not touch UObjects and is not thread-safe.
+ */
+class CARDANOPLUGIN_API FCardanoSettlementLedger
+{
+public:
+    /** LedgerId is part of every intent payload, so intents signed for another ledger or game are rejected. */
+    FCardanoSettlementLedger(const FString& InLedgerId, const FString& InTreasuryAccount);
+
+    /** The UTF-8 text a player signs to pay Lovelace from From to To; readable in the wallet's signing prompt. */
+    static TArray<uint8> MakeIntentPayload(const FString& LedgerId, const FString& From, const FString& To, int64 Lovelace, int64 Nonce);
+
+    const FString& GetLedgerId() const { return LedgerId; }
+    const FString& GetTreasuryAccount() const { return TreasuryAccount; }
+
+    /** Adds Lovelace to Account without a signature, for deposits and treasury grants. */
+    void Credit(const FString& Account, int64 Lovelace);
+
+    /**
+     * Verifies the signatures of Intents in one batch, on worker threads, then applies the valid ones in order.
+     * Writes one result per intent, in order; an intent rejected leaves every balance as it was.
+     */
+    void ApplyIntents(const TArray<FCardanoPaymentIntent>& Intents, TArray<FCardanoIntentResult>& OutResults);
+
+    /** Lovelace Account holds off-chain, not counting what is being paid out to it. */
+    int64 GetBalance(const FString& Account) const;
+
+    /** Lovelace of Account in payout transactions not confirmed yet. */
+    int64 GetPendingPayout(const FString& Account) const;
+
+    /**
+     * Moves the whole balance of every account holding at least MinLovelace out of the ledger, into one payment per
+     * account, largest first and at most MaxPayments of them, or all when it is 0. The treasury is skipped. The
+     * payments must then be given to AddPendingPayout once their transaction is known, or to ReturnPayments.
+     */
+    void TakePayouts(int64 MinLovelace, int32 MaxPayments, TArray<FCardanoTxPayment>& OutPayments);
+
+    /** Records Payments as paid by the transaction TxHash until ResolvePayout is called for it. */
+    void AddPendingPayout(const FString& TxHash, TArray<FCardanoTxPayment> Payments);
+
+    /** Drops the pending payout TxHash once confirmed, or credits its payments back otherwise. */
+    void ResolvePayout(const FString& TxHash, bool bConfirmed);
+
+    /** Credits back payments taken by TakePayouts that no transaction made. */
+    void ReturnPayments(const TArray<FCardanoTxPayment>& Payments);
+
+    /** Hashes of the payout transactions not resolved yet, such as those loaded from a save made while they were. */
+    void GetPendingPayoutHashes(TArray<FString>& OutTxHashes) const;
+
+    /**
+     * Saves or loads the balances, nonces and pending payouts, in the compact form of CardanoBinaryCodec. Loading
+     * replaces the whole ledger, and flags malformed input with Ar.SetError().
+     */
+    void Serialize(FArchive& Ar);
+
+private:
+    FString LedgerId;
+    FString TreasuryAccount;
+
+    TMap<FString, int64> Balances;
+
+    /** Last nonce accepted from each account. */
+    TMap<FString, int64> Nonces;
+
+    /** Keyed by lower-case transaction hash. */
+    TMap<FString, TArray<FCardanoTxPayment>> PendingPayouts;
+};
+
+/** A payout transaction of UCardanoSettlementEngine: TxHash, its number of payments, and why it failed if it did. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnCardanoSettlementPayout, const FString&, TxHash, int32, Payments, const FString&, ErrorMessage);
+
+/** Everything a settlement engine needs. */
+struct CARDANOPLUGIN_API FCardanoSettlementConfig
+{
+    FString LedgerId;
+
+    /** Address holding the funds of the ledger; payouts spend its UTxOs and send their change back to it. */
+    FString TreasuryAddress;
+
+    int32 NetworkMagic = 764824073;
+
+    /** Signs the payouts; referenced for the life of the engine and used by one worker at a time. */
+    cardano_secure_key_handler_t* KeyHandler = nullptr;
+
+    /** Keys signing each payout, those of the treasury's UTxOs. */
+    TArray<cardano_derivation_path_t> DerivationPaths;
+
+    FCardanoPayoutOptions Options;
+
+    float SettlementIntervalSeconds = 60.0f;
+
+    /** Accounts owed less wait for a later settlement; also keeps every output above the minimum UTxO value. */
+    int64 MinPayoutLovelace = 5000000;
+
+    /** Caps the accounts paid by one settlement; 0 pays all of them. */
+    int32 MaxPaymentsPerSettlement = 0;
+};
+
+/**
+ * Runs an FCardanoSettlementLedger and settles it on chain every SettlementIntervalSeconds: the accounts owed enough
+ * are paid from the treasury with FCardanoTxPlanner::BuildPayouts, which packs them into as few transactions as the
+ * size limit allows, signed in one batch by FCardanoSigningPipeline on the thread pool and handed to
+ * UCardanoSubmissionQueue. Thousands of intents a minute thus become a handful of transactions, one output per
+ * account however many intents it took part in. A payout that is rejected is credited back and paid by a later
+ * settlement.
+ * The treasury's UTxOs and the protocol parameters are read from UCardanoUTxOCache and UCardanoProtocolParamsCache;
+ * a settlement due while either is empty, or while the previous one is still being built, is skipped.
+ * Every method must be called on the game thread. The engine keeps itself alive until Stop, and then until its
+ * queued payouts are resolved.
+ */
+UCLASS(BlueprintType)
+class CARDANOPLUGIN_API UCardanoSettlementEngine : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /** Starts settling; returns nullptr with OutError if the config lacks a ledger id, treasury or keys. */
+    static UCardanoSettlementEngine* Start(const FCardanoSettlementConfig& Config, FString& OutError);
+
+    /** Stops settling. Payouts already queued are still resolved; the ledger stays readable. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Settlement")
+    void Stop();
+
+    /** Fires once a payout transaction is queued. */
+    UPROPERTY(BlueprintAssignable, Category = "Cardano|Settlement")
+    FOnCardanoSettlementPayout OnPayoutQueued;
+
+    UPROPERTY(BlueprintAssignable, Category = "Cardano|Settlement")
+    FOnCardanoSettlementPayout OnPayoutConfirmed;
+
+    /**
+     * Fires for payments that could not be built or signed, with an empty TxHash, and for a payout rejected by the
+     * node; their payments are back in the ledger. Also fires for a payout not confirmed in time, which may still
+     * land before its TTL and so stays pending in the ledger until given to FCardanoSettlementLedger::ResolvePayout.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Cardano|Settlement")
+    FOnCardanoSettlementPayout OnPayoutFailed;
+
+    FCardanoSettlementLedger& GetLedger() { return *Ledger; }
+    const FCardanoSettlementLedger& GetLedger() const { return *Ledger; }
+
+    /** Settles now rather than at the next interval. Returns false if a settlement is already being built. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Settlement")
+    bool SettleNow();
+
+    virtual void BeginDestroy() override;
+
+private:
+    /** A payout transaction signed on the worker. */
+    struct FSignedPayout
+    {
+        FString TxHash;
+        TArray<FCardanoTxPayment> Payments;
+        TArray<uint8> Transaction;
+    };
+
+    bool Tick(float DeltaTime);
+
+    void OnSettlementSigned(TArray<FSignedPayout> Signed, TArray<FCardanoTxPayment> Unpaid, FString Error);
+
+    UFUNCTION()
+    void OnPayoutTracked(ECardanoTxOutcome Outcome, ECardanoSubmitError Error, const FString& TxHash, const FString& ErrorMessage);
+
+    void ReleaseKeyHandler();
+
+    FCardanoSettlementConfig Config;
+    TUniquePtr<FCardanoSettlementLedger> Ledger;
+
+    /** Payments of each queued payout, for the delegates; the ledger holds the same as pending. */
+    TMap<FString, int32> QueuedPayments;
+
+    FDelegateHandle TickHandle;
+    bool bSettling = false;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Named shared memory segment through which the server processes of one host share a cache: one process, the
+ * writer, fetches and publishes the payload, and the others read it instead of polling Koios themselves.
+ * The payload is double-buffered: the writer fills the slot readers are not directed to, then flips them over to it.
+ * Readers copy a slot out under a sequence lock and retry if it was rewritten meanwhile, so they take no lock and
+ * never stall the writer.
+ * The writer role goes to whichever process finds no live writer. The writer renews its claim with Heartbeat, and
+ * another process takes over once it has not done so for the writer timeout.
+ * Readers ask the writer for keys it should cover, such as addresses to watch, through a small queue in the segment.
+ * Every method may be called from any thread, Publish from one thread at a time.
+ */
+class CARDANOPLUGIN_API FCardanoSharedCache
+{
+public:
+    /**
+     * Opens segment Name, creating it if no process has. Returns null if it cannot be mapped or was created with
+     * another capacity; every process sharing a segment must open it with the same CapacityBytes.
+     */
+    static TUniquePtr<FCardanoSharedCache> Open(const FString& Name, int64 CapacityBytes, double WriterTimeoutSeconds = 15.0);
+
+    /** Hands the writer role over right away, if this process holds it. */
+    ~FCardanoSharedCache();
+
+    /** Claims the writer role if no live writer holds it, or renews it. Returns whether this process is the writer. */
+    bool Heartbeat();
+
+    bool IsWriter() const;
+
+    /** Publishes Bytes as the new payload. Fails if this process is not the writer or Bytes exceed the capacity. */
+    bool Publish(const TArray<uint8>& Bytes);
+
+    /**
+     * Copies the payload out if its version is not InOutVersion, and sets InOutVersion to it. Returns false if
+     * nothing was published since, or if the writer kept rewriting the payload while it was being copied.
+     */
+    bool Read(uint64& InOutVersion, TArray<uint8>& OutBytes) const;
+
+    /** Queues Key for the writer. Returns false if Key is too long or the queue is full. */
+    bool Request(const FString& Key);
+
+    /** Dequeues the keys readers requested. */
+    TArray<FString> TakeRequests();
+
+    int64 GetCapacity() const { return Capacity; }
+
+private:
+    struct FHeader;
+
+    FCardanoSharedCache(FHeader* InHeader, uint8* InSlots, int64 InCapacity, double InWriterTimeoutSeconds);
+
+    FHeader* const Header;
+    uint8* const Slots;
+    const int64 Capacity;
+    const double WriterTimeoutSeconds;
+
+    /** Identifies this process in the writer claim. */
+    const int64 WriterId;
+
+    /** Publishes in a row that found the slot to fill still being written. */
+    int32 BusySlotPublishes = 0;
+};
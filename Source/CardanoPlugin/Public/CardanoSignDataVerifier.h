@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoHash.h"
+
+/** What a CIP-30 wallet returned from signData, and what the server expects it to have signed. */
+struct CARDANOPLUGIN_API FCardanoSignDataRequest
+{
+    /** COSE_Sign1 CBOR, the decoded "signature" field of the DataSignature. */
+    TArray<uint8> Signature;
+
+    /** COSE_Key CBOR, the decoded "key" field of the DataSignature. */
+    TArray<uint8> Key;
+
+    /**
+     * The challenge the player was asked to sign. The payload must be these bytes, or their Blake2b-224 hash when the
+     * wallet set the "hashed" header; a detached payload is taken to be them. Empty accepts any payload.
+     */
+    TArray<uint8> Challenge;
+
+    /** Bech32 address the player claims, which must be the one signed for; empty accepts any address the key controls. */
+    FString ExpectedAddress;
+};
+
+/** Outcome of one FCardanoSignDataRequest. */
+struct CARDANOPLUGIN_API FCardanoSignDataResult
+{
+    bool bValid = false;
+
+    /** Why the request was rejected; empty when it is valid. */
+    FString Error;
+
+    /** Bech32 address from the protected header, set once it was parsed, even if the signature then failed. */
+    FString Address;
+
+    /** Blake2b-224 hash of the signing key: the payment credential of the address, or its stake credential for a reward address. */
+    FCardanoHash28 KeyHash;
+};
+
+/**
+ * Verifies CIP-8 message signatures, as produced by CIP-30 signData, for login challenges. Each COSE_Sign1 and
+ * COSE_Key is parsed in place with a view CBOR reader, nothing but the signed Sig_structure being copied; the payload
+ * is matched against the challenge and the key hash against the credential of the signed address. The signatures
+ * that pass are then checked chunk by chunk, and the chunks run in parallel across worker threads, so throughput
+ * scales with cores.
+ * Does not touch UObjects; may be called from any thread.
+ */
+class CARDANOPLUGIN_API FCardanoSignDataVerifier
+{
+public:
+    /** Requests parsed and verified by one worker. */
+    static constexpr int32 ChunkSize = 64;
+
+    /** Writes one result per request, in request order. */
+    static void VerifyBatch(const TArray<FCardanoSignDataRequest>& Requests, TArray<FCardanoSignDataResult>& OutResults);
+
+    /** Verifies a single request, without a batch or worker threads. */
+    static FCardanoSignDataResult Verify(const FCardanoSignDataRequest& Request);
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <cardano/cardano.h>
+#include <cardano/key_handlers/secure_key_handler.h>
+
+/**
+ * Signs many unsigned transactions with the same keys in one pass.
+ * The transactions are decoded, their bodies hashed, and re-serialized on worker threads. With a single derivation
+ * path and a key handler that exports its signing keys (the software handler), the workers also sign, so throughput
+ * scales with cores. Otherwise, such as with several paths or a remote or hardware signer, the key handler signs the
+ * whole batch in one call on the calling thread. Either way its key material is decrypted once and each derivation
+ * path is derived once regardless of N.
+ * Does not touch UObjects and may be called from any thread, as long as KeyHandler is not used concurrently.
+ */
+class CARDANOPLUGIN_API FCardanoSigningPipeline
+{
+public:
+    /**
+     * Adds a vkey witness for every path in DerivationPaths to each transaction in UnsignedTransactions (full
+     * transaction CBOR, as returned by UCardanoTxBuilder::Build). OutSignedTransactions keeps the input order.
+     * Returns false and leaves OutSignedTransactions empty if any transaction could not be decoded or signed.
+     */
+    static bool SignTransactions(
+        cardano_secure_key_handler_t* KeyHandler,
+        const TArray<TArray<uint8>>& UnsignedTransactions,
+        TArrayView<const cardano_derivation_path_t> DerivationPaths,
+        TArray<TArray<uint8>>& OutSignedTransactions,
+        FString& OutError);
+
+    /** SignTransactions for a single transaction, without the copies and worker threads a batch of one would cost. */
+    static bool SignTransaction(
+        cardano_secure_key_handler_t* KeyHandler,
+        TArrayView<const uint8> UnsignedTransaction,
+        TArrayView<const cardano_derivation_path_t> DerivationPaths,
+        TArray<uint8>& OutSignedTransaction,
+        FString& OutError);
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoTypes.h"
+
+/**
+ * Delta encoding of wallet state against a snapshot both sides already hold, for replicating it from dedicated
+ * servers to clients and between nodes. A UTxO never changes once created, so a UTxO set delta is the indices of
+ * the spent ones in the previous snapshot plus the new ones in full: a block touching one output of a wallet of
+ * thousands costs a few dozen bytes. Balances send the lovelace difference and the tokens that changed.
+ * Writers and readers must agree on Previous; callers pair each delta with the revision it was made against.
+ * Read functions return false, and leave the output unchanged, on malformed input.
+ */
+struct CARDANOPLUGIN_API FCardanoStateDelta
+{
+    static void WriteUTxOs(FArchive& Ar, const TArray<FUTxO>& Previous, const TArray<FUTxO>& Current);
+
+    /** OutCurrent holds the UTxOs of Previous that are left, in their order, followed by the new ones. */
+    static bool ReadUTxOs(FArchive& Ar, const TArray<FUTxO>& Previous, TArray<FUTxO>& OutCurrent);
+
+    static void WriteBalance(FArchive& Ar, const FAddressBalance& Previous, const FAddressBalance& Current);
+
+    /** OutCurrent holds the tokens of Previous that are left, in their order, followed by the new ones. */
+    static bool ReadBalance(FArchive& Ar, const FAddressBalance& Previous, FAddressBalance& OutCurrent);
+};
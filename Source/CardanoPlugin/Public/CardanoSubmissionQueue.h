@@ -0,0 +1,178 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpRequest.h"
+#include "CardanoSubmissionQueue.generated.h"
+
+UENUM(BlueprintType)
+enum class ECardanoTxOutcome : uint8
+{
+    Confirmed,
+    Rejected,
+    TimedOut,
+};
+
+/**
+ * Why a submission was refused, read from the ledger rule the node reports, so a caller knows what to change before
+ * trying again instead of retrying blindly.
+ */
+UENUM(BlueprintType)
+enum class ECardanoSubmitError : uint8
+{
+    None,
+
+    /** No answer came back; the same transaction can be submitted again. */
+    NetworkError,
+
+    /** The provider failed or kept throttling; the same transaction can be submitted again later. */
+    ProviderError,
+
+    /** An input is already spent or never existed: select other inputs. */
+    InputsSpent,
+
+    /** The fee is below the minimum: build again with a higher one. */
+    FeeTooSmall,
+
+    /** The current slot is outside the validity interval: build again with a new TTL. */
+    Expired,
+
+    /** Inputs do not match outputs, fee and deposits. */
+    ValueNotConserved,
+
+    /** An output holds less than the minimum ada. */
+    OutputTooSmall,
+
+    /** The transaction or one of its values is larger than the protocol allows. */
+    TooLarge,
+
+    /** A witness is missing or does not verify: sign again. */
+    MissingWitnesses,
+
+    /** A script, its redeemers, budget or collateral were rejected. */
+    ScriptFailure,
+
+    /** Refused for another reason; see the message. */
+    Other,
+};
+
+/** Error is None when the transaction was accepted; TxHash is then the id the provider returned. */
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnTransactionSubmitted, ECardanoSubmitError, Error, const FString&, TxHash, const FString&, ErrorMessage);
+DECLARE_DYNAMIC_DELEGATE_FourParams(FOnTransactionTracked, ECardanoTxOutcome, Outcome, ECardanoSubmitError, Error, const FString&, TxHash, const FString&, ErrorMessage);
+
+/**
+ * Submits signed transactions to Koios and follows them until they land on chain.
+ * At most MaxConcurrentSubmissions submittx requests are in flight; the rest wait in order. Every accepted
+ * transaction is then tracked by one shared polling loop that asks tx_status about all of them at once,
+ * and each transaction's delegate fires exactly once: when it reaches RequiredConfirmations, when Koios
+ * rejects it, with the reason as an ECardanoSubmitError, or when ConfirmationTimeoutSeconds pass without it
+ * being confirmed.
+ * Queued transactions are overlaid on UCardanoUTxOCache, so a transaction may spend the outputs of one still
+ * in the queue: it is held back until its parent is accepted, and rejected along with it if the parent fails.
+ * Submissions are deduplicated by transaction id, so retries upstream cost no extra submittx or tx_status: enqueuing
+ * or tracking a transaction already pending adds its delegate to the pending one, and one that finished within
+ * DedupeWindowSeconds gets the same outcome right away. Rejections are only replayed for the very same bytes, since
+ * a copy with other witnesses may be accepted, and never for errors worth retrying.
+ * All methods must be called on the game thread.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoSubmissionQueue : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide queue, or nullptr before the engine is initialized. */
+    static UCardanoSubmissionQueue* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /**
+     * Queues a signed transaction for submission and returns its hash. Transactions that cannot be decoded
+     * are rejected right away and yield an empty hash. A transaction already queued is not submitted again.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Submission")
+    FString Enqueue(const TArray<uint8>& TransactionBytes, const FOnTransactionTracked& OnComplete);
+
+    /** Tracks a transaction submitted elsewhere, as if it had been accepted by this queue just now. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Submission")
+    void Track(const FString& TxHash, const FOnTransactionTracked& OnComplete);
+
+    /** Transactions that are waiting, being submitted or awaiting confirmation. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Submission")
+    int32 GetPendingCount() const { return Pending.Num(); }
+
+private:
+    struct FPendingTx
+    {
+        FString TxHash;
+        TArray<uint8> Bytes;
+
+        /** Of Bytes, so a rejection is only replayed for the same witnesses; 0 for tracked transactions. */
+        uint32 BytesCrc = 0;
+
+        /** One per Enqueue or Track of the transaction. */
+        TArray<FOnTransactionTracked> Callbacks;
+        double AcceptedTime = 0.0;
+        bool bSubmitting = false;
+        bool bAccepted = false;
+    };
+
+    /** How a transaction finished, replayed to duplicates within DedupeWindowSeconds. */
+    struct FFinishedTx
+    {
+        ECardanoTxOutcome Outcome = ECardanoTxOutcome::Confirmed;
+        ECardanoSubmitError Error = ECardanoSubmitError::None;
+        FString ErrorMessage;
+        uint32 BytesCrc = 0;
+        double FinishedTime = 0.0;
+    };
+
+    /** Adds OnComplete to the pending or finished transaction TxHash, if there is one; false to queue it. */
+    bool AttachDuplicate(const FString& TxHash, uint32 BytesCrc, const FOnTransactionTracked& OnComplete);
+    void Remember(const FPendingTx& Tx, ECardanoTxOutcome Outcome, ECardanoSubmitError Error, const FString& ErrorMessage);
+
+    void PumpSubmissions();
+    bool IsWaitingForParent(const TSharedRef<FPendingTx>& Tx) const;
+    void Submit(const TSharedRef<FPendingTx>& Tx);
+    void Accept(const TSharedRef<FPendingTx>& Tx);
+    void Finish(const TSharedRef<FPendingTx>& Tx, ECardanoTxOutcome Outcome, ECardanoSubmitError Error, const FString& ErrorMessage);
+    bool Poll(float DeltaTime);
+
+    /** Samples the queue depth gauge of FCardanoMetrics. */
+    void CollectMetrics();
+    void OnStatusFetched(const TArray<TSharedRef<FPendingTx>>& Batch, FHttpResponsePtr Response, bool bSuccess);
+
+    /** Largest number of submittx requests in flight at once. */
+    UPROPERTY(Config)
+    int32 MaxConcurrentSubmissions = 4;
+
+    /** Seconds between two tx_status polls. */
+    UPROPERTY(Config)
+    float PollIntervalSeconds = 5.0f;
+
+    /** Confirmations after which a transaction is reported as confirmed. */
+    UPROPERTY(Config)
+    int32 RequiredConfirmations = 1;
+
+    /** Seconds an accepted transaction may go unconfirmed before it is reported as timed out. */
+    UPROPERTY(Config)
+    float ConfirmationTimeoutSeconds = 600.0f;
+
+    /** Seconds a finished transaction is remembered, so submitting it again returns its outcome; 0 to forget at once. */
+    UPROPERTY(Config)
+    float DedupeWindowSeconds = 900.0f;
+
+    /** Every transaction not reported yet, in submission order. */
+    TArray<TSharedRef<FPendingTx>> Pending;
+
+    /** Pending by transaction id. */
+    TMap<FString, TSharedRef<FPendingTx>> PendingByHash;
+
+    TMap<FString, FFinishedTx> Finished;
+    int32 SubmissionsInFlight = 0;
+    int32 PollsInFlight = 0;
+    FDelegateHandle PollHandle;
+    FDelegateHandle MetricsHandle;
+};
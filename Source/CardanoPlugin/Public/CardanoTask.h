@@ -0,0 +1,217 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/Tuple.h"
+
+/** What a TCardanoTask finished with: its value, or the error of the step that failed. */
+template <typename T>
+struct TCardanoTaskResult
+{
+    TOptional<T> Value;
+    FString Error;
+
+    static TCardanoTaskResult Success(T&& InValue)
+    {
+        TCardanoTaskResult Result;
+        Result.Value.Emplace(MoveTemp(InValue));
+        return Result;
+    }
+
+    static TCardanoTaskResult Failure(FString&& InError)
+    {
+        TCardanoTaskResult Result;
+        Result.Error = MoveTemp(InError);
+        return Result;
+    }
+
+    bool IsSuccess() const { return Value.IsSet(); }
+};
+
+/**
+ * The future value of one step of an asynchronous flow, such as an HTTP request or a worker-pool job, so a flow is
+ * written as a chain of steps instead of callbacks carrying its state by hand. Copies share the same task.
+ * A task is finished once, from any thread; the first Finish wins and later ones are ignored. Its continuation, set
+ * once with Then or Next, always runs on the game thread, right away if the task finished already, so flows may touch
+ * UObjects between steps. A task nobody continues just drops its result.
+ */
+template <typename T>
+class TCardanoTask
+{
+public:
+    using FResult = TCardanoTaskResult<T>;
+
+    TCardanoTask()
+        : State(MakeShared<FState, ESPMode::ThreadSafe>())
+    {
+    }
+
+    static TCardanoTask FromValue(T Value)
+    {
+        TCardanoTask Task;
+        Task.Succeed(MoveTemp(Value));
+        return Task;
+    }
+
+    static TCardanoTask FromError(FString Error)
+    {
+        TCardanoTask Task;
+        Task.Fail(MoveTemp(Error));
+        return Task;
+    }
+
+    void Succeed(T Value) const { Finish(FResult::Success(MoveTemp(Value))); }
+    void Fail(FString Error) const { Finish(FResult::Failure(MoveTemp(Error))); }
+
+    void Finish(FResult&& Result) const
+    {
+        TUniqueFunction<void(FResult&&)> Continuation;
+        {
+            FScopeLock Lock(&State->Lock);
+            if (State->bFinished)
+            {
+                return;
+            }
+            State->bFinished = true;
+            if (!State->Continuation)
+            {
+                State->Result = MoveTemp(Result);
+                return;
+            }
+            Continuation = MoveTemp(State->Continuation);
+        }
+        RunOnGameThread(MoveTemp(Continuation), MoveTemp(Result));
+    }
+
+    bool IsFinished() const
+    {
+        FScopeLock Lock(&State->Lock);
+        return State->bFinished;
+    }
+
+    /** Runs Continuation with the result on the game thread once the task finishes. */
+    void Then(TUniqueFunction<void(FResult&&)> Continuation) const
+    {
+        {
+            FScopeLock Lock(&State->Lock);
+            check(!State->Continuation && !State->bContinued);
+            State->bContinued = true;
+            if (!State->bFinished)
+            {
+                State->Continuation = MoveTemp(Continuation);
+                return;
+            }
+        }
+        RunOnGameThread(MoveTemp(Continuation), MoveTemp(State->Result));
+    }
+
+    /**
+     * Starts the next step with the value once the task succeeds: Step takes a T and returns the TCardanoTask<U> of
+     * that step, whose result the returned task finishes with. A failure skips Step and is passed on as is.
+     */
+    template <typename StepType, typename NextTask = decltype(DeclVal<StepType>()(DeclVal<T&&>()))>
+    NextTask Next(StepType&& Step) const
+    {
+        NextTask Chained;
+        Then([Chained, Step = Forward<StepType>(Step)](FResult&& Result) mutable
+            {
+                if (!Result.IsSuccess())
+                {
+                    Chained.Fail(MoveTemp(Result.Error));
+                    return;
+                }
+                Step(MoveTemp(Result.Value.GetValue())).Then([Chained](typename NextTask::FResult&& StepResult)
+                    {
+                        Chained.Finish(MoveTemp(StepResult));
+                    });
+            });
+        return Chained;
+    }
+
+private:
+    struct FState
+    {
+        FCriticalSection Lock;
+        FResult Result;
+        TUniqueFunction<void(FResult&&)> Continuation;
+        bool bFinished = false;
+        bool bContinued = false;
+    };
+
+    static void RunOnGameThread(TUniqueFunction<void(FResult&&)>&& Continuation, FResult&& Result)
+    {
+        if (IsInGameThread())
+        {
+            Continuation(MoveTemp(Result));
+            return;
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [Continuation = MoveTemp(Continuation), Result = MoveTemp(Result)]() mutable
+            {
+                Continuation(MoveTemp(Result));
+            });
+    }
+
+    TSharedRef<FState, ESPMode::ThreadSafe> State;
+};
+
+/** Runs Job on the worker pool; the task finishes with the result it returns. Job must not touch UObjects. */
+template <typename T>
+TCardanoTask<T> CardanoRunOnPool(TUniqueFunction<TCardanoTaskResult<T>()> Job)
+{
+    TCardanoTask<T> Task;
+    Async(EAsyncExecution::ThreadPool, [Task, Job = MoveTemp(Job)]() mutable
+        {
+            Task.Finish(Job());
+        });
+    return Task;
+}
+
+/**
+ * Waits for two independent steps started at once, so a flow takes as long as the slower of them rather than their
+ * sum. Finishes with both values, or with the first error, without waiting for the other step.
+ */
+template <typename A, typename B>
+TCardanoTask<TTuple<A, B>> CardanoWhenBoth(const TCardanoTask<A>& First, const TCardanoTask<B>& Second)
+{
+    struct FJoin
+    {
+        TOptional<A> First;
+        TOptional<B> Second;
+    };
+
+    // Both continuations run on the game thread, so the join needs no lock
+    TCardanoTask<TTuple<A, B>> Joined;
+    TSharedRef<FJoin, ESPMode::ThreadSafe> Join = MakeShared<FJoin, ESPMode::ThreadSafe>();
+
+    First.Then([Joined, Join](TCardanoTaskResult<A>&& Result)
+        {
+            if (!Result.IsSuccess())
+            {
+                Joined.Fail(MoveTemp(Result.Error));
+                return;
+            }
+            Join->First = MoveTemp(Result.Value);
+            if (Join->Second.IsSet())
+            {
+                Joined.Succeed(MakeTuple(MoveTemp(Join->First.GetValue()), MoveTemp(Join->Second.GetValue())));
+            }
+        });
+
+    Second.Then([Joined, Join](TCardanoTaskResult<B>&& Result)
+        {
+            if (!Result.IsSuccess())
+            {
+                Joined.Fail(MoveTemp(Result.Error));
+                return;
+            }
+            Join->Second = MoveTemp(Result.Value);
+            if (Join->First.IsSet())
+            {
+                Joined.Succeed(MakeTuple(MoveTemp(Join->First.GetValue()), MoveTemp(Join->Second.GetValue())));
+            }
+        });
+
+    return Joined;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Containers/List.h"
+#include "CardanoHash.h"
+#include <cardano/cardano.h>
+#include "CardanoTransactionCache.generated.h"
+
+/**
+ * Decoded transactions by hash, shared by the history, marketplace and inspection code that keeps decoding the same
+ * ones, so showing a transaction again costs a hash lookup. Entries are frozen (cardano_transaction_freeze) and the
+ * least recently read ones are dropped once their measured heap size exceeds MaxMemoryMegabytes. A transaction not
+ * in memory is read back from the CBOR UCardanoTxHistory keeps under Saved/Cardano/TxStore, unless
+ * bReadTxHistoryStore is off.
+ * Thread-safe. Reference counts of cardano-c objects are not atomic in every build, so transactions are only handed
+ * to a reader function run under the cache's lock, which must not keep a reference past its return.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoTransactionCache : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide cache, or nullptr before the engine is initialized. */
+    static UCardanoTransactionCache* Get();
+
+    virtual void Deinitialize() override;
+
+    /**
+     * Runs Reader on the cached transaction TxHash, reading it from the history store on a miss. Returns false,
+     * without running Reader, if the transaction is neither cached nor stored.
+     */
+    bool Read(const FCardanoHash32& TxHash, TFunctionRef<void(cardano_transaction_t*)> Reader);
+
+    /**
+     * Runs Reader on the cached transaction TxHash, or on Cbor decoded and cached on a miss. Returns false, setting
+     * OutError, if Cbor does not decode to a transaction with that hash.
+     */
+    bool ReadOrDecode(const FCardanoHash32& TxHash, const TArray<uint8>& Cbor, TFunctionRef<void(cardano_transaction_t*)> Reader, FString& OutError);
+
+    /** Freezes Transaction and caches it under its id; the cache takes a reference of its own. */
+    bool Add(cardano_transaction_t* Transaction);
+
+    void Remove(const FCardanoHash32& TxHash);
+    void Clear();
+
+    int32 Num() const;
+
+    /** Heap bytes of the cached transactions, as cardano_transaction_get_memory_footprint measured them. */
+    int64 GetMemoryBytes() const;
+
+    /** Decodes and freezes Cbor, checking that it hashes to TxHash. Returns nullptr, setting OutError, otherwise. */
+    static cardano_transaction_t* DecodeFrozen(const FCardanoHash32& TxHash, const TArray<uint8>& Cbor, FString& OutError);
+
+private:
+    struct FEntry
+    {
+        cardano_transaction_t* Transaction = nullptr;
+        int64 Bytes = 0;
+        TDoubleLinkedList<FCardanoHash32>::TDoubleLinkedListNode* Node = nullptr;
+    };
+
+    /** Runs Reader on the entry of TxHash and marks it most recently used, if it is cached. Called under Lock. */
+    bool ReadLocked(const FCardanoHash32& TxHash, TFunctionRef<void(cardano_transaction_t*)> Reader);
+
+    /** Caches Transaction, already frozen, taking over the caller's reference, then trims to the budget. Called under Lock. */
+    void AddLocked(const FCardanoHash32& TxHash, cardano_transaction_t* Transaction);
+
+    void RemoveLocked(const FCardanoHash32& TxHash);
+
+    UPROPERTY(Config)
+    int32 MaxMemoryMegabytes = 64;
+
+    /** Whether a miss reads the CBOR UCardanoTxHistory saved for the transaction. */
+    UPROPERTY(Config)
+    bool bReadTxHistoryStore = true;
+
+    mutable FCriticalSection Lock;
+    TMap<FCardanoHash32, FEntry> Entries;
+
+    /** Cached hashes, most recently read first. */
+    TDoubleLinkedList<FCardanoHash32> Order;
+
+    int64 MemoryBytes = 0;
+};
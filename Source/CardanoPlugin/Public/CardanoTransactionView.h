@@ -0,0 +1,115 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "CardanoHash.h"
+#include "CardanoTxHistory.h"
+#include "CardanoTransactionView.generated.h"
+
+/** A metadata entry of a transaction. */
+USTRUCT(BlueprintType)
+struct FCardanoTxMetadatum
+{
+    GENERATED_BODY()
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TransactionView")
+    int64 Label = 0;
+
+    /** The metadatum as JSON, or empty if it holds byte strings or maps with non-text keys, which JSON cannot show. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TransactionView")
+    FString Json;
+
+    /** The metadatum as hex CBOR, always set. */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TransactionView")
+    FString Cbor;
+};
+
+/**
+ * Read-only view of an encoded transaction, to show what it does before it is signed.
+ * Opening a view makes one pass over the CBOR that records where each body field and the auxiliary data are, without
+ * decoding or allocating anything else. Each section is decoded from the bytes in place the first time it is asked
+ * for and kept, so a marketplace transaction with hundreds of outputs opens as fast as a transfer, and only what is
+ * shown is ever paid for. Inputs carry no value: it is not part of the transaction.
+ * Not thread-safe: the lazily filled sections are written by the getters.
+ */
+UCLASS(BlueprintType)
+class CARDANOPLUGIN_API UCardanoTransactionView : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /** Opens a view over a copy of Transaction. Returns nullptr with OutError if it is not a transaction. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TransactionView")
+    static UCardanoTransactionView* CreateTransactionView(const TArray<uint8>& Transaction, FString& OutError);
+
+    /** The transaction id: the Blake2b-256 hash of the body, in hex. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|TransactionView")
+    FString GetTxHash() const;
+
+    /** Spent outputs as "TxHash#TxIndex", in the order of the body. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|TransactionView")
+    TArray<FString> GetInputs() const;
+
+    /** Outputs read but not spent, as "TxHash#TxIndex". */
+    UFUNCTION(BlueprintPure, Category = "Cardano|TransactionView")
+    TArray<FString> GetReferenceInputs() const;
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|TransactionView")
+    TArray<FCardanoTxOutputDetails> GetOutputs() const;
+
+    /** Tokens minted, with a positive quantity, and burnt, with a negative one. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|TransactionView")
+    TArray<FTokenBalance> GetMint() const;
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|TransactionView")
+    int64 GetFee() const;
+
+    /** First slot the transaction is valid in, or 0 if it has no lower bound. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|TransactionView")
+    int64 GetInvalidBefore() const;
+
+    /** TTL slot, or 0 if it has no upper bound. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|TransactionView")
+    int64 GetInvalidAfter() const;
+
+    /** Whether the transaction carries auxiliary data, without decoding it; it may hold only scripts. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|TransactionView")
+    bool HasMetadata() const { return AuxiliaryData.IsSet(); }
+
+    /** Metadata entries by label, in the order of the transaction. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|TransactionView")
+    TArray<FCardanoTxMetadatum> GetMetadata() const;
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|TransactionView")
+    int32 GetSizeBytes() const { return Transaction.Num(); }
+
+    const TArray<uint8>& GetTransaction() const { return Transaction; }
+
+private:
+    /** Bytes of an item within Transaction. */
+    struct FSpan
+    {
+        int32 Offset = INDEX_NONE;
+        int32 Size = 0;
+
+        bool IsSet() const { return Offset != INDEX_NONE; }
+    };
+
+    /** Body map keys up to the Conway ones; later keys are not recorded. */
+    static constexpr int32 BODY_KEY_COUNT = 23;
+
+    bool Index(FString& OutError);
+    const FSpan& GetBodyField(uint64 Key) const;
+    uint64 ReadBodyUInt(uint64 Key) const;
+
+    TArray<uint8> Transaction;
+    FSpan Body;
+    FSpan BodyFields[BODY_KEY_COUNT];
+    FSpan AuxiliaryData;
+
+    mutable TOptional<FCardanoHash32> TxHash;
+    mutable TOptional<TArray<FString>> Inputs;
+    mutable TOptional<TArray<FString>> ReferenceInputs;
+    mutable TOptional<TArray<FCardanoTxOutputDetails>> Outputs;
+    mutable TOptional<TArray<FTokenBalance>> Mint;
+    mutable TOptional<TArray<FCardanoTxMetadatum>> Metadata;
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "CardanoNative.h"
+#include "CardanoTypes.h"
+#include "CardanoTxBuilder.generated.h"
+
+/**
+ * Blueprint wrapper around FCardanoTxBuilder, which native code can use directly.
+ * Inputs are picked by the library's coin selector (large first by default), and the fee, change and
+ * min-UTxO amounts are computed from the protocol parameters the builder was created with.
+ * Every setter returns the builder so calls can be chained; errors are reported by Build.
+ */
+UCLASS(BlueprintType)
+class CARDANOPLUGIN_API UCardanoTxBuilder : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /** Creates a builder for the network identified by NetworkMagic. Returns nullptr if Parameters cannot be converted. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxBuilder")
+    static UCardanoTxBuilder* CreateTxBuilder(const FCardanoProtocolParameters& Parameters, int32 NetworkMagic = 764824073);
+
+    /**
+     * Creates a builder from the parameters held by UCardanoProtocolParamsCache, without a network call.
+     * Returns nullptr if the cache has not been filled yet.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxBuilder")
+    static UCardanoTxBuilder* CreateTxBuilderFromCache(int32 NetworkMagic = 764824073);
+
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxBuilder")
+    UCardanoTxBuilder* SendLovelace(const FString& Address, int64 Lovelace);
+
+    /** Sends Lovelace plus the given native tokens; asset names are hex encoded, as returned by Koios. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxBuilder")
+    UCardanoTxBuilder* SendValue(const FString& Address, int64 Lovelace, const TArray<FTokenBalance>& Assets);
+
+    /**
+     * Sends Assets to Address in as few outputs as the MaxValueSize protocol parameter allows, packed by
+     * FCardanoMinAda::PackAssets. Each output gets the minimum lovelace of its tokens; the first one gets Lovelace
+     * instead when that is more.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxBuilder")
+    UCardanoTxBuilder* SendAssets(const FString& Address, int64 Lovelace, const TArray<FTokenBalance>& Assets);
+
+    /**
+     * Sends every entry of Outputs with SendAssets, merging the entries to the same address first, so moving a whole
+     * inventory takes one transaction with the fewest outputs. An address receiving no assets gets a single output.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxBuilder")
+    UCardanoTxBuilder* SendOutputs(const TArray<FTransactionOutput>& Outputs);
+
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxBuilder")
+    UCardanoTxBuilder* SetChangeAddress(const FString& Address);
+
+    /** Sets the UTxOs coin selection may spend; OwnerAddress is the address they are locked at. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxBuilder")
+    UCardanoTxBuilder* SetUTxOs(const FString& OwnerAddress, const TArray<FUTxO>& UTxOs);
+
+    /**
+     * Adds the output TxHash#TxIndex as a reference input, with the script and datum it carries, from
+     * UCardanoScriptCache. Build fails if the cache does not hold it; fetch it first with FetchReferenceInputs.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxBuilder")
+    UCardanoTxBuilder* AddReferenceInput(const FString& TxHash, int32 TxIndex);
+
+    /** Sets the TTL slot. When never called, Build uses two hours from the slot reported by UCardanoChainTip. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxBuilder")
+    UCardanoTxBuilder* SetInvalidAfter(int64 Slot);
+
+    /** Balances the transaction and returns its unsigned CBOR. The builder cannot be reused afterwards. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxBuilder")
+    bool Build(TArray<uint8>& OutTransaction, FString& OutError);
+
+    virtual void BeginDestroy() override;
+
+private:
+    FCardanoTxBuilder Native;
+};
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "CardanoHash.h"
+#include "CardanoTypes.h"
+#include "CardanoTxHistory.generated.h"
+
+/** A transaction of a wallet's history, as listed by Koios address_txs. */
+USTRUCT(BlueprintType)
+struct FCardanoTxSummary
+{
+    GENERATED_BODY()
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    FString TxHash;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    int64 BlockHeight = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    int64 BlockTime = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    int32 EpochNo = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FCardanoTxOutputDetails
+{
+    GENERATED_BODY()
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    FString Address;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    int64 Lovelace = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    TArray<FTokenBalance> Assets;
+};
+
+/** What a transaction's CBOR says about it; input values are not part of it. */
+USTRUCT(BlueprintType)
+struct FCardanoTxDetails
+{
+    GENERATED_BODY()
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    FString TxHash;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    int64 Fee = 0;
+
+    /** Spent outputs as "TxHash#TxIndex". */
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    TArray<FString> Inputs;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    TArray<FCardanoTxOutputDetails> Outputs;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    bool bHasMetadata = false;
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|TxHistory")
+    int32 SizeBytes = 0;
+};
+
+/** On-disk form of one wallet's history. */
+USTRUCT()
+struct FCardanoTxHistoryFile
+{
+    GENERATED_BODY()
+    UPROPERTY()
+    FString WalletId;
+    UPROPERTY()
+    TArray<FString> Addresses;
+    UPROPERTY()
+    int64 LastBlockHeight = 0;
+    UPROPERTY()
+    TArray<FCardanoTxSummary> Entries;
+};
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnTxHistoryRefreshed, bool, Success, const FString&, ErrorMessage);
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnTxDetailsResult, bool, Success, const TArray<FCardanoTxDetails>&, Details, const FString&, ErrorMessage);
+
+/**
+ * Transaction history of wallets, kept locally so UI screens page through it without calling Koios.
+ * A wallet is any set of addresses under an id of the caller's choosing. Its first refresh lists every
+ * transaction of its addresses; later ones only ask address_txs for the blocks after the newest entry,
+ * plus the full history of addresses added to the wallet since. Histories are persisted under
+ * Saved/Cardano/TxHistory and loaded on first use.
+ * Details are decoded from the transaction CBOR with cardano_transaction_from_cbor when asked for; the
+ * CBOR is downloaded once with tx_cbor and kept in memory and in the compressed store under Saved/Cardano/TxStore,
+ * which drops its oldest transactions beyond MaxStoreMegabytes.
+ * Entries above a rollback reported by UCardanoChainFollower are dropped and fetched again.
+ * All methods must be called on the game thread.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoTxHistory : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide history, or nullptr before the engine is initialized. */
+    static UCardanoTxHistory* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /**
+     * Adds Addresses to the wallet and fetches the transactions newer than its last entry, along with the
+     * whole history of the addresses it did not have. Calls made while a refresh of the same wallet is
+     * running complete once their addresses were fetched too.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxHistory")
+    void RefreshWallet(const FString& WalletId, const TArray<FString>& Addresses, const FOnTxHistoryRefreshed& OnComplete);
+
+    /** Entries of the wallet, newest first. Returns false if the wallet has never been refreshed. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxHistory")
+    bool GetHistoryPage(const FString& WalletId, int32 PageIndex, int32 PageSize, TArray<FCardanoTxSummary>& OutEntries);
+
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxHistory")
+    int32 GetHistoryCount(const FString& WalletId);
+
+    /**
+     * Decodes the given transactions, downloading the CBOR of those never seen before. Details keep the order
+     * of TxHashes; on failure they hold the transactions that could be decoded.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxHistory")
+    void GetTransactionDetails(const TArray<FString>& TxHashes, const FOnTxDetailsResult& OnComplete);
+
+    /** Copies the stored CBOR of a transaction downloaded before; UCardanoTransactionCache reads it back from there. May be called from any thread. */
+    static bool ReadStoredCbor(const FCardanoHash32& TxHash, TArray<uint8>& OutCbor);
+
+    /** Drops the wallet from memory and from disk. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|TxHistory")
+    void ForgetWallet(const FString& WalletId);
+
+private:
+    struct FWalletHistory
+    {
+        /** Newest first. */
+        TArray<FCardanoTxSummary> Entries;
+        TSet<FString> TxHashes;
+        TSet<FString> Addresses;
+
+        /** Addresses given to RefreshWallet whose history has not been fetched yet. */
+        TSet<FString> PendingAddresses;
+
+        /** Height of the newest entry; the next refresh starts from it. */
+        int64 LastBlockHeight = 0;
+
+        /** Changed when entries are dropped, so a refresh started before is run again instead of merged. */
+        uint32 Generation = 0;
+
+        bool bRefreshInProgress = false;
+        TArray<FOnTxHistoryRefreshed> PendingCallbacks;
+    };
+
+    struct FRefreshState;
+    struct FDetailsRequest;
+
+    FWalletHistory& FindOrLoad(const FString& WalletId);
+    void StartRefresh(const FString& WalletId);
+    void FetchTransactions(TSharedRef<FRefreshState> Refresh, const TArray<FString>& Addresses, int64 AfterBlockHeight, int32 Offset);
+    void CompleteStep(TSharedRef<FRefreshState> Refresh);
+    void FinishRefresh(const FString& WalletId, bool bSuccess, const FString& ErrorMessage);
+    void DropEntriesAbove(FWalletHistory& History, int64 BlockHeight);
+    void SaveWallet(const FString& WalletId, const FWalletHistory& History) const;
+
+    void FetchCbor(TSharedRef<FDetailsRequest> Details, const TArray<FString>& TxHashes);
+    void FinishDetails(const FDetailsRequest& Details);
+    const TArray<uint8>* FindCbor(const FString& TxHash);
+    void AddCbor(const FString& TxHash, TArray<uint8>&& Cbor);
+
+    UFUNCTION()
+    void OnRollback(int64 BlockHeight);
+
+    FString GetWalletFilePath(const FString& WalletId) const;
+
+    /** Where earlier versions saved each CBOR; such files are moved into the store as they are read. */
+    static FString GetLegacyCborFilePath(const FString& TxHash);
+
+    /** Transaction CBORs kept in memory; older ones are read back from disk when needed again. */
+    UPROPERTY(Config)
+    int32 MaxCachedTransactions = 4096;
+
+    /** Disk budget of the CBOR store; the oldest transactions past it are downloaded again if needed. */
+    UPROPERTY(Config)
+    int32 MaxStoreMegabytes = 512;
+
+    TMap<FString, FWalletHistory> Wallets;
+    TMap<FString, TArray<uint8>> CborCache;
+
+    /** CborCache keys, oldest first. */
+    TArray<FString> CborOrder;
+
+    /** Lowest height rolled back to this session, applied to histories loaded from disk afterwards. */
+    int64 RolledBackTo = MAX_int64;
+
+    uint32 NextGeneration = 0;
+};
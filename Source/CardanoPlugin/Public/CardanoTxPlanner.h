@@ -0,0 +1,396 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoTypes.h"
+#include "CardanoHash.h"
+#include <cardano/cardano.h>
+
+/** Coin selection algorithm used by a what-if build. */
+enum class ECardanoCoinSelection : uint8
+{
+    LargeFirst,
+    RandomImprove,
+    BranchAndBound
+};
+
+/** One payment of a what-if build; asset names are hex encoded, as returned by Koios. */
+struct CARDANOPLUGIN_API FCardanoTxPayment
+{
+    FString Address;
+    int64 Lovelace = 0;
+    TArray<FTokenBalance> Assets;
+};
+
+/** Everything the candidates of a what-if build have in common. */
+struct CARDANOPLUGIN_API FCardanoTxPlan
+{
+    FCardanoProtocolParameters Parameters;
+    int32 NetworkMagic = 764824073;
+    FString ChangeAddress;
+
+    /** Address the UTxOs are locked at. */
+    FString OwnerAddress;
+    TArray<FUTxO> UTxOs;
+    TArray<FCardanoTxPayment> Payments;
+
+    /** TTL slot. When zero, it is taken from UCardanoChainTip, which requires calling from the game thread. */
+    int64 InvalidAfter = 0;
+};
+
+/** How one candidate is built out of the plan. */
+struct CARDANOPLUGIN_API FCardanoTxStrategy
+{
+    FString Name;
+    ECardanoCoinSelection CoinSelection = ECardanoCoinSelection::LargeFirst;
+
+    /** Merges the payments sent to the same address into a single output, summing lovelace and assets. */
+    bool bMergePaymentsByAddress = false;
+
+    /** Seed of the random improve selector, so a strategy always yields the same candidate. */
+    uint64 RandomSeed = 0;
+
+    /** Lovelace the branch and bound selector may spend above the target instead of adding change. */
+    uint64 ChangeTolerance = 0;
+};
+
+/** Result of building the plan with one strategy. */
+struct CARDANOPLUGIN_API FCardanoTxCandidate
+{
+    int32 StrategyIndex = INDEX_NONE;
+    FString StrategyName;
+    bool bSuccess = false;
+    FString Error;
+    int64 Fee = 0;
+    int32 Size = 0;
+
+    /** Unsigned transaction CBOR, as returned by UCardanoTxBuilder::Build. */
+    TArray<uint8> Transaction;
+};
+
+/** How FCardanoTxPlanner::BuildPayouts splits the payments of a plan into transactions. */
+struct CARDANOPLUGIN_API FCardanoPayoutOptions
+{
+    /** Coin selection and output merging of every transaction of the batch. */
+    FCardanoTxStrategy Strategy;
+
+    /** Caps the payments per transaction; 0 packs as many as MaxTxSize allows. */
+    int32 MaxPaymentsPerTransaction = 0;
+
+    /** Bytes of each transaction kept out of MaxTxSize for its inputs, change output and fields other than the payments. */
+    int32 ReservedBytes = 2048;
+};
+
+/** One transaction of a payout batch. */
+struct CARDANOPLUGIN_API FCardanoPayoutTransaction
+{
+    /** Indices into FCardanoTxPlan::Payments of the payments made by this transaction, in plan order. */
+    TArray<int32> PaymentIndices;
+
+    bool bSuccess = false;
+    FString Error;
+    int64 Fee = 0;
+    int32 Size = 0;
+
+    /** Unsigned transaction CBOR, as returned by UCardanoTxBuilder::Build. */
+    TArray<uint8> Transaction;
+};
+
+/** Which UTxOs FCardanoTxPlanner::BuildConsolidation merges, and into how large transactions. */
+struct CARDANOPLUGIN_API FCardanoConsolidationOptions
+{
+    /** UTxOs holding only lovelace, and less than this, are dust to merge. */
+    int64 DustThreshold = 5000000;
+
+    /** Also merges the UTxOs holding a token that is spread over several UTxOs. */
+    bool bMergeFragmentedAssets = true;
+
+    /** Nothing is planned while fewer UTxOs than this would be merged. */
+    int32 MinUTxOs = 10;
+
+    /** Caps the inputs per transaction; 0 packs as many as MaxTxSize allows. */
+    int32 MaxInputsPerTransaction = 0;
+
+    /** Bytes of each transaction kept out of MaxTxSize for everything but its inputs and the tokens of its output. */
+    int32 ReservedBytes = 1024;
+};
+
+/** One transaction of a consolidation. */
+struct CARDANOPLUGIN_API FCardanoConsolidationTransaction
+{
+    /** Indices into FCardanoTxPlan::UTxOs of the UTxOs merged by this transaction. */
+    TArray<int32> UTxOIndices;
+
+    bool bSuccess = false;
+    FString Error;
+    int64 Fee = 0;
+    int32 Size = 0;
+
+    /** Unsigned transaction CBOR, as returned by UCardanoTxBuilder::Build. */
+    TArray<uint8> Transaction;
+};
+
+/** One token of a mint drop; the asset name is hex encoded, as returned by Koios. */
+struct CARDANOPLUGIN_API FCardanoMintItem
+{
+    FString AssetName;
+    int64 Quantity = 1;
+
+    /** Address receiving the token; empty sends it to the change address of the plan. */
+    FString Recipient;
+
+    /**
+     * CIP-25 fields of the token, such as name, image and mediaType, in the order they are written. Keys are at most
+     * 64 bytes; longer values are split into 64-byte chunks. A token without fields gets no metadata.
+     */
+    TArray<TPair<FString, FString>> Metadata;
+};
+
+/** How FCardanoTxPlanner::BuildMintDrop splits a drop into transactions. */
+struct CARDANOPLUGIN_API FCardanoMintDropOptions
+{
+    /** Coin selection and output merging of every transaction of the drop. */
+    FCardanoTxStrategy Strategy;
+
+    /** Caps the tokens per transaction; 0 packs as many as MaxTxSize allows. */
+    int32 MaxItemsPerTransaction = 0;
+
+    /** Bytes of each transaction kept out of MaxTxSize for its inputs, change, policy script and witnesses. */
+    int32 ReservedBytes = 2048;
+};
+
+/** One transaction of a mint drop. */
+struct CARDANOPLUGIN_API FCardanoMintTransaction
+{
+    /** Indices into the drop's items of the tokens minted by this transaction, in drop order. */
+    TArray<int32> ItemIndices;
+
+    bool bSuccess = false;
+    FString Error;
+
+    /** Failed only because the UTxOs left after the other transactions could not fund it. */
+    bool bInsufficientFunds = false;
+
+    int64 Fee = 0;
+    int32 Size = 0;
+
+    /** Unsigned transaction CBOR, as returned by UCardanoTxBuilder::Build. */
+    TArray<uint8> Transaction;
+};
+
+/** What a certificate of FCardanoTxPlanner::BuildCertificateBatch does to its stake address. */
+enum class ECardanoCertificateAction : uint8
+{
+    /** Registers the stake key, paying the key deposit. */
+    RegisterStake,
+
+    /** Deregisters the stake key, refunding the key deposit. */
+    DeregisterStake,
+
+    /** Delegates the stake to a pool. */
+    DelegateStake,
+
+    /** Delegates the voting power to a DRep. */
+    DelegateVote
+};
+
+/** One certificate of a certificate batch, for a stake address controlled by a key. */
+struct CARDANOPLUGIN_API FCardanoCertificateRequest
+{
+    ECardanoCertificateAction Action = ECardanoCertificateAction::DelegateStake;
+
+    /** Bech32 stake address of the account. */
+    FString StakeAddress;
+
+    /** Bech32 id of the pool, for DelegateStake. */
+    FString PoolId;
+
+    /** CIP-105 or CIP-129 id of the DRep, or "abstain" or "no_confidence", for DelegateVote. */
+    FString DRepId;
+};
+
+/** How FCardanoTxPlanner::BuildCertificateBatch splits certificates into transactions. */
+struct CARDANOPLUGIN_API FCardanoCertificateBatchOptions
+{
+    /** Coin selection of every transaction of the batch. */
+    FCardanoTxStrategy Strategy;
+
+    /** Caps the certificates per transaction; 0 packs as many as MaxTxSize allows. */
+    int32 MaxCertificatesPerTransaction = 0;
+
+    /** Bytes of each transaction kept out of MaxTxSize for its inputs, change output and the UTxO owner's witness. */
+    int32 ReservedBytes = 1024;
+};
+
+/** One transaction of a certificate batch. */
+struct CARDANOPLUGIN_API FCardanoCertificateTransaction
+{
+    /** Indices into the batch's certificates of the ones this transaction carries, in batch order. */
+    TArray<int32> CertificateIndices;
+
+    bool bSuccess = false;
+    FString Error;
+
+    /** Failed only because the UTxOs left after the other transactions could not fund it. */
+    bool bInsufficientFunds = false;
+
+    int64 Fee = 0;
+
+    /** Key deposits paid by the registrations less the ones refunded by the deregistrations; negative for a refund. */
+    int64 Deposit = 0;
+
+    int32 Size = 0;
+
+    /** Unsigned transaction CBOR, as returned by UCardanoTxBuilder::Build. */
+    TArray<uint8> Transaction;
+};
+
+/**
+ * Builds one transaction plan with several strategies at once, to pick the cheapest before submitting.
+ * The UTxOs are converted and serialized once into a frozen snapshot; each strategy then runs on its own worker,
+ * decoding its own copy of the snapshot, so no cardano-c object is shared between threads.
+ * Does not touch UObjects unless Plan.InvalidAfter is zero.
+ */
+class CARDANOPLUGIN_API FCardanoTxPlanner
+{
+public:
+    /**
+     * Builds a candidate per entry of Strategies. OutCandidates holds the successful candidates ranked by fee, then
+     * size, then strategy order, followed by the failed ones in strategy order with their errors.
+     * Returns false and leaves OutCandidates empty if the plan itself is invalid; a strategy that fails to build does
+     * not make the call fail.
+     */
+    static bool BuildCandidates(
+        const FCardanoTxPlan& Plan,
+        const TArray<FCardanoTxStrategy>& Strategies,
+        TArray<FCardanoTxCandidate>& OutCandidates,
+        FString& OutError);
+
+    /**
+     * Pays every entry of Plan.Payments with as few transactions as possible: payments are packed in plan order into
+     * transactions filling MaxTxSize, and one coin selection over the whole batch gives each transaction its own
+     * UTxOs, so none of them spend the same input and all can be submitted at once. The transactions are built in
+     * parallel; one that turns out larger than MaxTxSize is split in two and built again.
+     * OutTransactions is ordered by first payment. Returns false and leaves it empty if the plan itself is invalid;
+     * a transaction failing to build, such as for lack of funds, does not make the call fail.
+     */
+    static bool BuildPayouts(
+        const FCardanoTxPlan& Plan,
+        const FCardanoPayoutOptions& Options,
+        TArray<FCardanoPayoutTransaction>& OutTransactions,
+        FString& OutError);
+
+    /**
+     * Merges the dust and the fragmented tokens of Plan.UTxOs into as few UTxOs as possible, so later coin selection
+     * has fewer, larger UTxOs to go through and later transactions fewer inputs. Each transaction spends a group of
+     * UTxOs entirely and sends everything but its fee to Plan.ChangeAddress; UTxOs sharing a token are grouped
+     * together, so each token ends up in as few outputs as the transaction size allows. Plan.Payments is ignored.
+     * The transactions spend disjoint UTxOs and are built in parallel; one larger than MaxTxSize is split in two.
+     * OutTransactions is left empty when fewer than Options.MinUTxOs UTxOs need merging, which makes it cheap to call
+     * periodically. Since a consolidation spends UTxOs a payment might pick too, run it while the wallet is idle,
+     * such as when UCardanoSubmissionQueue has nothing pending. Returns false only if the plan itself is invalid.
+     */
+    static bool BuildConsolidation(
+        const FCardanoTxPlan& Plan,
+        const FCardanoConsolidationOptions& Options,
+        TArray<FCardanoConsolidationTransaction>& OutTransactions,
+        FString& OutError);
+
+    /**
+     * Mints Items under the native script policy PolicyScriptJson (cardano-cli JSON), packing them in drop order into
+     * transactions filling MaxTxSize, each sending every token to its recipient with the minimum lovelace and carrying
+     * the CIP-25 version 2 metadata of its tokens. The policy is parsed and hashed once, and its timelocks narrow the
+     * validity interval of every transaction. The transactions are funded from disjoint UTxOs, as by BuildPayouts,
+     * and built in parallel; one larger than MaxTxSize is split in two. The witnesses of the UTxO owner and of the
+     * policy keys are accounted for in the fees, so the transactions are to be signed by both.
+     * OutTransactions is ordered by first item. Returns false and leaves it empty if the plan, the policy or an item
+     * is invalid; Plan.Payments is ignored.
+     */
+    static bool BuildMintDrop(
+        const FCardanoTxPlan& Plan,
+        const FString& PolicyScriptJson,
+        const TArray<FCardanoMintItem>& Items,
+        const FCardanoMintDropOptions& Options,
+        TArray<FCardanoMintTransaction>& OutTransactions,
+        FString& OutError);
+
+    /**
+     * Registers, deregisters and delegates many stake addresses, such as when moving custodial accounts to a new pool
+     * or DRep, packing the certificates in batch order into transactions filling MaxTxSize. Every certificate is
+     * built, serialized and given its deposit once, so the transactions only decode them; the net deposit of each
+     * transaction is known before coin selection, which funds the transactions from disjoint UTxOs as BuildPayouts
+     * does. They are built in parallel; one larger than MaxTxSize once signed by the UTxO owner and every stake key
+     * it certifies is split in two. Plan.Payments is ignored.
+     * OutTransactions is ordered by first certificate. Returns false and leaves it empty if the plan or a certificate
+     * is invalid; a transaction failing to build, such as for lack of funds, does not make the call fail.
+     */
+    static bool BuildCertificateBatch(
+        const FCardanoTxPlan& Plan,
+        const TArray<FCardanoCertificateRequest>& Certificates,
+        const FCardanoCertificateBatchOptions& Options,
+        TArray<FCardanoCertificateTransaction>& OutTransactions,
+        FString& OutError);
+};
+
+/** Result of FCardanoFeeEstimator::Estimate. */
+struct CARDANOPLUGIN_API FCardanoFeeEstimate
+{
+    bool bSuccess = false;
+    FString Error;
+    int64 Fee = 0;
+
+    /** Bytes of the transaction once signed. */
+    int32 Size = 0;
+
+    /** UTxOs picked by coin selection, in the order of the transaction body. */
+    TArray<FCardanoUTxORef> Inputs;
+};
+
+/**
+ * Estimates the fee and size of payments while they are being edited, such as while the player types an amount.
+ * Coin selection and balancing run exactly as for UCardanoTxBuilder::Build, but the result is neither serialized
+ * nor signed, and no key is ever needed: the signature is accounted for by a placeholder vkey witness of the size of
+ * a real one. The protocol parameters, UTxOs and change address are converted once by Initialize and frozen, so each
+ * estimate only resets and runs the same builder.
+ * Does not touch UObjects after initialization; an instance may be used from any thread, but not from several at once.
+ */
+class CARDANOPLUGIN_API FCardanoFeeEstimator
+{
+public:
+    FCardanoFeeEstimator() = default;
+    ~FCardanoFeeEstimator();
+
+    FCardanoFeeEstimator(const FCardanoFeeEstimator&) = delete;
+    FCardanoFeeEstimator& operator=(const FCardanoFeeEstimator&) = delete;
+
+    /** Prepares estimates spending the UTxOs of Plan; its payments are ignored. Discards any previous preparation. */
+    bool Initialize(const FCardanoTxPlan& Plan, FString& OutError);
+
+    /**
+     * Prepares estimates spending the UTxOs UCardanoUTxOCache holds as spendable for Address, with the parameters of
+     * UCardanoProtocolParamsCache and the change sent back to Address. Must be called on the game thread, and fails
+     * while either cache is still empty.
+     */
+    bool InitializeFromCache(const FString& Address, int32 NetworkMagic, FString& OutError);
+
+    bool IsInitialized() const { return Params != nullptr; }
+
+    /** Balances Payments with Strategy. Returns OutEstimate.bSuccess, with the builder's error when it is false. */
+    bool Estimate(const TArray<FCardanoTxPayment>& Payments, const FCardanoTxStrategy& Strategy, FCardanoFeeEstimate& OutEstimate) const;
+
+private:
+    void Reset();
+
+    cardano_protocol_parameters_t* Params = nullptr;
+    cardano_provider_t* Provider = nullptr;
+    cardano_utxo_list_t* UTxOs = nullptr;
+    cardano_address_t* ChangeAddress = nullptr;
+
+    /** Reset between estimates rather than created for each. */
+    mutable cardano_tx_builder_t* Builder = nullptr;
+
+    /** Holds one vkey witness of zeroes, standing for the signature of the UTxO owner. */
+    cardano_vkey_witness_set_t* PlaceholderWitnesses = nullptr;
+
+    cardano_network_magic_t NetworkMagic = CARDANO_NETWORK_MAGIC_MAINNET;
+    int64 InvalidAfter = 0;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoHash.h"
+#include "Templates/Function.h"
+
+/** The fields a transaction template lets change between instances, in the order they appear in the body. */
+struct CARDANOPLUGIN_API FCardanoTxTemplateValues
+{
+    /** Outputs spent, in the order of the body; the ledger reads inputs sorted, so they must be strictly ascending. */
+    TArray<FCardanoUTxORef> Inputs;
+
+    /** Lovelace of each output; the assets, datums and scripts of the outputs are part of the template. */
+    TArray<uint64> OutputLovelace;
+
+    uint64 Fee = 0;
+
+    /** TTL slot, or 0 for a transaction without one. */
+    uint64 InvalidAfter = 0;
+};
+
+/**
+ * A built transaction reused as the shape of many others, for high-rate transfers repeating the same script and
+ * outputs. The byte offsets of the fields in FCardanoTxTemplateValues are recorded once; each instance then copies
+ * the template, overwrites those fields in place and hashes the body again, without decoding or building anything.
+ * Patching never changes the size of the transaction, so its fee stays sufficient; keeping inputs minus outputs
+ * equal to the fee is up to the caller.
+ * When a value no longer fits the bytes of its field, or the number of inputs or outputs changes, the instance is
+ * built in full by the FFullBuild given at initialization and becomes the template of the next ones.
+ * Does not touch UObjects; an instance may be used from any thread, but not from several at once.
+ */
+class CARDANOPLUGIN_API FCardanoTxTemplate
+{
+public:
+    /** Builds the unsigned CBOR of a transaction with the given values, as UCardanoTxBuilder::Build returns it. */
+    using FFullBuild = TFunction<bool(const FCardanoTxTemplateValues& Values, TArray<uint8>& OutTransaction, FString& OutError)>;
+
+    /**
+     * Records the fields of Transaction, an unsigned transaction as returned by UCardanoTxBuilder::Build.
+     * FullBuild may be empty, in which case values that do not fit make Instantiate fail instead.
+     */
+    bool Initialize(const TArray<uint8>& Transaction, FFullBuild InFullBuild, FString& OutError);
+
+    bool IsInitialized() const { return Transaction.Num() > 0; }
+
+    /** The values of the current template, to copy and change for the next instance. */
+    const FCardanoTxTemplateValues& GetValues() const { return Values; }
+
+    /** Writes the transaction with Values into OutTransaction and its id, the hash of its body, into OutTxId. */
+    bool Instantiate(const FCardanoTxTemplateValues& InValues, TArray<uint8>& OutTransaction, FCardanoHash32& OutTxId, FString& OutError);
+
+    /** Instances patched in place and instances built in full, since initialization. */
+    int32 GetPatchedCount() const { return PatchedCount; }
+    int32 GetFullBuildCount() const { return FullBuildCount; }
+
+private:
+    /** A CBOR unsigned integer within Transaction, header included. */
+    struct FUIntField
+    {
+        int32 Offset = INDEX_NONE;
+        int32 Width = 0;
+    };
+
+    struct FInputField
+    {
+        int32 HashOffset = INDEX_NONE;
+        FUIntField Index;
+    };
+
+    bool Record(const TArray<uint8>& InTransaction, FString& OutError);
+    bool CanPatch(const FCardanoTxTemplateValues& InValues) const;
+
+    TArray<uint8> Transaction;
+    int32 BodyOffset = 0;
+    int32 BodySize = 0;
+
+    TArray<FInputField> InputFields;
+    TArray<FUIntField> OutputFields;
+    FUIntField FeeField;
+    FUIntField InvalidAfterField;
+
+    FCardanoTxTemplateValues Values;
+    FFullBuild FullBuild;
+
+    int32 PatchedCount = 0;
+    int32 FullBuildCount = 0;
+};
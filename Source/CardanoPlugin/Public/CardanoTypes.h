@@ -17,6 +17,23 @@ struct FTokenBalance
     FString AssetName;
     UPROPERTY(BlueprintReadOnly)
     FString Quantity;
+
+    /**
+     * Compact binary form: the policy id as 28 raw bytes, the asset name as its bytes and the quantity as a varint.
+     * Fields that are not the hex or decimal strings Koios returns are kept as strings, so any value round-trips.
+     */
+    bool Serialize(FArchive& Ar);
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FTokenBalance> : public TStructOpsTypeTraitsBase2<FTokenBalance>
+{
+    enum
+    {
+        WithSerializer = true,
+        WithNetSerializer = true,
+    };
 };
 
 USTRUCT(BlueprintType)
@@ -27,6 +44,20 @@ struct FAddressBalance
     int64 Lovelace = 0;
     UPROPERTY(BlueprintReadOnly)
     TArray<FTokenBalance> Tokens;
+
+    /** Varint lovelace and compact tokens; see FCardanoStateDelta to send only what changed since a previous balance. */
+    bool Serialize(FArchive& Ar);
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FAddressBalance> : public TStructOpsTypeTraitsBase2<FAddressBalance>
+{
+    enum
+    {
+        WithSerializer = true,
+        WithNetSerializer = true,
+    };
 };
 
 USTRUCT(BlueprintType)
@@ -39,8 +70,59 @@ struct FUTxO
     int32 TxIndex;
     UPROPERTY(BlueprintReadWrite, Category = "UTxO")
     int64 Value;
+    UPROPERTY(BlueprintReadWrite, Category = "UTxO")
+    TArray<FTokenBalance> Assets;
+
+    /** The transaction hash as 32 raw bytes, varint index and value, compact tokens: about 40 bytes for a plain output. */
+    bool Serialize(FArchive& Ar);
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FUTxO> : public TStructOpsTypeTraitsBase2<FUTxO>
+{
+    enum
+    {
+        WithSerializer = true,
+        WithNetSerializer = true,
+    };
+};
+
+// UTxOs of a single address, wrapped so they can be stored as a map value
+USTRUCT(BlueprintType)
+struct FAddressUTxOs
+{
+    GENERATED_BODY()
+    UPROPERTY(BlueprintReadOnly, Category = "UTxO")
+    TArray<FUTxO> UTxOs;
 };
 
+/** A payment to one address; see UCardanoTxBuilder::SendOutputs. */
+USTRUCT(BlueprintType)
+struct FTransactionOutput
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|Wallet")
+    FString Address;
+
+    /** Lovelace to send; raised to the minimum of the outputs holding Assets. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|Wallet")
+    int64 Value = 0;
+
+    /** Native tokens to send; asset names are hex encoded, as returned by Koios. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cardano|Wallet")
+    TArray<FTokenBalance> Assets;
+};
+
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnBalancesResult, bool, Success, const TMap<FString, FAddressBalance>&, Balances, const FString&, ErrorMessage);
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnAddressUTxOsResult, bool, Success, const TMap<FString, FAddressUTxOs>&, UTxOsByAddress, const FString&, ErrorMessage);
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnUTxOPageProgress, int32, PagesFetched, int32, UTxOsFetched);
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnPagedUTxOsResult, bool, Success, const TArray<FUTxO>&, UTxOs, const FString&, ErrorMessage);
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnUTxOCacheRefreshed, bool, Success, const FString&, ErrorMessage);
+
 USTRUCT(BlueprintType)
 struct FUTxOResult
 {
@@ -49,4 +131,46 @@ struct FUTxOResult
     bool bSuccess;
     UPROPERTY(BlueprintReadOnly)
     FString Message;
-};
\ No newline at end of file
+};
+// Subset of the epoch protocol parameters needed to balance and fee a transaction
+USTRUCT(BlueprintType)
+struct FCardanoProtocolParameters
+{
+    GENERATED_BODY()
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int32 EpochNo = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int64 MinFeeA = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int64 MinFeeB = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int64 MaxTxSize = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int64 MaxValueSize = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int64 CoinsPerUTxOByte = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int64 KeyDeposit = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int64 PoolDeposit = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int64 DRepDeposit = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int64 GovActionDeposit = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int32 CollateralPercentage = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int32 MaxCollateralInputs = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int32 ProtocolMajor = 0;
+    UPROPERTY(BlueprintReadOnly, Category = "ProtocolParameters")
+    int32 ProtocolMinor = 0;
+    UPROPERTY()
+    double PriceMemory = 0.0;
+    UPROPERTY()
+    double PriceSteps = 0.0;
+    UPROPERTY()
+    double RefScriptCostPerByte = 0.0;
+};
+
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnProtocolParametersResult, bool, Success, const FCardanoProtocolParameters&, Parameters, const FString&, ErrorMessage);
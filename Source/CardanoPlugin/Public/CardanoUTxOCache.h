@@ -0,0 +1,325 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "CardanoBalanceTotals.h"
+#include "CardanoHash.h"
+#include "CardanoSharedCache.h"
+#include "CardanoTypes.h"
+#include "CardanoUTxOCache.generated.h"
+
+/** UTxO changes of one block to the watched addresses, as applied by UCardanoChainFollower. */
+struct FCardanoBlockDelta
+{
+    int64 BlockHeight = 0;
+
+    /** Transactions of the block that touch a watched address. */
+    TArray<FString> TxHashes;
+
+    /** Inputs spent from watched addresses, with their addresses. */
+    TArray<TPair<FString, FCardanoUTxORef>> SpentInputs;
+
+    /** Outputs created on watched addresses, with their addresses. */
+    TArray<TPair<FString, FUTxO>> CreatedOutputs;
+};
+
+/** Fired with true when an address starts being watched, and with false when it stops. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnUTxOCacheWatchChanged, const FString& /* Address */, bool /* bWatched */);
+
+/** Fired with the downloaded addresses whose UTxO set may have changed; some may turn out unchanged. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnUTxOCacheUTxOsChanged, const TSet<FString>& /* Addresses */);
+
+/**
+ * In-memory UTxO set of a group of watched addresses.
+ * The first refresh of an address downloads its full UTxO set; later refreshes only ask Koios for the
+ * transactions made after the last seen block height and apply their spent inputs and created outputs,
+ * so polling a wallet costs a few small requests instead of re-downloading every UTxO.
+ * Transactions submitted but not yet on chain can be overlaid on top, so their change can be spent
+ * by the next transaction without waiting for a block.
+ * The chain state of the watched addresses is persisted as a binary snapshot under Saved/Cardano after
+ * every refresh and restored when the engine starts, so a restarted server only fetches the deltas since
+ * the snapshot instead of every UTxO of every wallet. Pending transactions are not persisted.
+ * While a chain follower drives the cache, downloaded addresses are kept current block by block and
+ * refreshes only download the addresses watched since; see BeginFollowing.
+ * With SharedMemoryName set, the server processes of a host share one cache: a single writer process polls Koios
+ * and publishes the snapshot to shared memory, and the other processes take the state of the addresses they watch
+ * from it instead, asking the writer to watch the ones it does not cover yet. On those readers RefreshAll makes no
+ * request, an address first appears once the writer has downloaded it, and no snapshot is persisted. A reader takes
+ * over as the writer if the writer stops. Pending transactions stay private to each process.
+ * All methods must be called on the game thread.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoUTxOCache : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /** Returns the engine-wide cache, or nullptr before the engine is initialized. */
+    static UCardanoUTxOCache* Get();
+
+    /** Adds Address to the watched set; its UTxOs are downloaded on the next refresh. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|UTxOCache")
+    void WatchAddress(const FString& Address);
+
+    UFUNCTION(BlueprintCallable, Category = "Cardano|UTxOCache")
+    void UnwatchAddress(const FString& Address);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|UTxOCache")
+    bool IsWatched(const FString& Address) const { return Watched.Contains(Address); }
+
+    TArray<FString> GetWatchedAddresses() const;
+
+    /** Changes whenever an address is watched or unwatched. */
+    uint32 GetWatchRevision() const { return WatchRevision; }
+
+    /** Lets indexes over the watched set, such as the chain follower's credential filter, be updated in place. */
+    FOnUTxOCacheWatchChanged& OnWatchChanged() { return WatchChanged; }
+
+    /** Broadcast after a refresh, a followed block, a rollback or a restored snapshot changed cached UTxOs. */
+    FOnUTxOCacheUTxOsChanged& OnUTxOsChanged() { return UTxOsChanged; }
+
+    /** Drops the cached UTxOs of Address so the next refresh downloads them again, e.g. after a rollback. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|UTxOCache")
+    void InvalidateAddress(const FString& Address);
+
+    /**
+     * Brings every watched address up to the current chain tip. Calls made while a refresh is already
+     * running are completed together with it.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|UTxOCache")
+    void RefreshAll(const FOnUTxOCacheRefreshed& OnComplete);
+
+    /** Returns false if Address has not been downloaded yet. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|UTxOCache")
+    bool GetCachedUTxOs(const FString& Address, TArray<FUTxO>& OutUTxOs) const;
+
+    /** Running totals of the cached UTxOs of Address, one token per policy and asset name. Returns false if Address has not been downloaded yet. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|UTxOCache")
+    bool GetCachedBalance(const FString& Address, FAddressBalance& OutBalance) const;
+
+    /** Block height the cache was last brought up to, or 0 before the first refresh. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|UTxOCache")
+    int64 GetLastBlockHeight() const { return TipBlockHeight; }
+
+    /**
+     * Overlays a signed transaction that is not on chain yet: GetSpendableUTxOs stops returning the outputs
+     * it spends and starts returning the ones it creates. The overlay is dropped once a refresh sees the
+     * transaction on chain. Returns false if TransactionBytes is not a transaction.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|UTxOCache")
+    bool AddPendingTransaction(const TArray<uint8>& TransactionBytes, FString& OutTxHash);
+
+    /**
+     * Drops a pending transaction that will not reach the chain, along with every pending transaction
+     * spending its outputs, directly or through others. Returns the dropped hashes, TxHash first.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|UTxOCache")
+    TArray<FString> RejectPendingTransaction(const FString& TxHash);
+
+    /** Hashes of the pending transactions whose outputs the pending transaction TxHash spends. */
+    TArray<FString> GetPendingParents(const FString& TxHash) const;
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|UTxOCache")
+    bool IsPendingTransaction(const FString& TxHash) const { return PendingTransactions.Contains(TxHash); }
+
+    /**
+     * Replaces the outputs known to be spent by transactions in the mempool, such as ones submitted from another
+     * session, keyed by output with the hash of the spending transaction; see UCardanoMempoolOverlay. Spendable UTxOs
+     * leave them out, so coin selection does not build on them. Broadcasts OnUTxOsChanged for the addresses affected.
+     */
+    void SetMempoolSpends(TMap<FCardanoUTxORef, FString> Spends);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|UTxOCache")
+    bool IsSpentInMempool(const FString& TxHash, int32 TxIndex) const;
+
+    /** GetCachedUTxOs with the pending transactions and the mempool spends applied. Returns false if Address has not been downloaded yet. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|UTxOCache")
+    bool GetSpendableUTxOs(const FString& Address, TArray<FUTxO>& OutUTxOs) const;
+
+    /**
+     * The running totals GetCachedBalance reads, for summing several addresses without building a balance for each.
+     * Returns nullptr if Address has not been downloaded yet.
+     */
+    const FCardanoBalanceTotals* FindCachedTotals(const FString& Address) const;
+
+    /**
+     * The watched address holding the spendable output Ref, pending outputs included; false if none does. Mempool
+     * spends are not left out, so a transaction built before one was seen can still be signed.
+     */
+    bool FindSpendableUTxOAddress(const FCardanoUTxORef& Ref, FString& OutAddress) const;
+
+    /**
+     * Hands block-by-block updates over to a chain follower whose last block is BlockHeight. From then on
+     * the addresses synced up to the follower's block are kept current by ApplyBlock instead of being
+     * polled by RefreshAll, which only brings the others up to it, and the last MaxRollbackBlocks blocks
+     * can be undone by RollBackTo.
+     */
+    void BeginFollowing(int64 BlockHeight, int32 MaxRollbackBlocks);
+
+    /** Returns to polling; the followed addresses keep the height the follower brought them to. */
+    void StopFollowing();
+
+    bool IsFollowing() const { return bFollowing; }
+
+    /**
+     * Applies the next block after the follower's last one. Addresses already synced past the block, e.g. by
+     * a refresh that raced ahead of the follower, are left alone. Pending transactions in the block are dropped.
+     */
+    void ApplyBlock(const FCardanoBlockDelta& Block);
+
+    /**
+     * Undoes the blocks after BlockHeight. Addresses whose state cannot be rewound, because a refresh
+     * synced them past BlockHeight or the rollback is deeper than MaxRollbackBlocks, are invalidated so the
+     * next refresh downloads them again.
+     */
+    void RollBackTo(int64 BlockHeight);
+
+    /**
+     * Writes the UTxOs, tokens and last synced block of every downloaded address to FilePath, replacing it
+     * only once the new file is complete. Returns false if the file could not be written.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|UTxOCache")
+    bool SaveSnapshot(const FString& FilePath) const;
+
+    /**
+     * Restores the addresses of a snapshot written by SaveSnapshot: they become watched and downloaded,
+     * and the next refresh only fetches the transactions after their saved block height. Addresses already
+     * downloaded keep their state. Returns false if the file is missing, of another version or corrupt.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|UTxOCache")
+    bool LoadSnapshot(const FString& FilePath);
+
+private:
+    struct FAddressState
+    {
+        /** Unspent outputs keyed by their output reference; changed through AddUTxO, RemoveUTxO and SetUTxOs only. */
+        TMap<FCardanoUTxORef, FUTxO> UTxOs;
+
+        /** Lovelace and asset totals of UTxOs, kept current by every change to them. */
+        FCardanoBalanceTotals Totals;
+
+        /** Transactions up to and including this height are reflected in UTxOs. */
+        int64 LastBlockHeight = 0;
+
+        bool bInitialized = false;
+
+        /** Kept current by the chain follower; set once the address is synced up to the follower's block. */
+        bool bFollowed = false;
+
+        /** Adds or replaces the UTxO at Key. */
+        void AddUTxO(const FCardanoUTxORef& Key, const FUTxO& UTxO);
+
+        /** Removes the UTxO at Key, copying it to OutRemoved if given. Returns false if there is none. */
+        bool RemoveUTxO(const FCardanoUTxORef& Key, FUTxO* OutRemoved = nullptr);
+
+        void SetUTxOs(const TMap<FCardanoUTxORef, FUTxO>& InUTxOs);
+    };
+
+    struct FPendingTransaction
+    {
+        /** Outputs the transaction spends. */
+        TArray<FCardanoUTxORef> SpentKeys;
+
+        /** Outputs the transaction creates, with their addresses. */
+        TArray<TPair<FString, FUTxO>> Outputs;
+    };
+
+    /** What ApplyBlock changed, so RollBackTo can restore it. */
+    struct FBlockUndo
+    {
+        int64 BlockHeight = 0;
+        TArray<TPair<FString, FUTxO>> RemovedUTxOs;
+        TArray<TPair<FString, FCardanoUTxORef>> AddedKeys;
+        TArray<TPair<FString, int64>> PreviousHeights;
+    };
+
+    struct FRefreshState;
+
+    /** Height State reflects; followed addresses are current up to the follower's last block. */
+    int64 GetSyncedHeight(const FAddressState& State) const;
+
+    void OnTipFetched(TSharedRef<FRefreshState> Refresh, int64 BlockHeight);
+    void FetchSnapshots(TSharedRef<FRefreshState> Refresh, const TArray<FString>& Addresses);
+    void FetchTransactions(TSharedRef<FRefreshState> Refresh, const TArray<FString>& Addresses, int64 AfterBlockHeight);
+    void FetchTxUTxOs(TSharedRef<FRefreshState> Refresh, const TArray<FString>& TxHashes);
+    void ApplyDeltas(const FRefreshState& Refresh);
+    void DropConfirmedPending(const FRefreshState& Refresh);
+    void CompleteStep(TSharedRef<FRefreshState> Refresh);
+    void FinishRefresh(bool bSuccess, const FString& ErrorMessage);
+
+    FString GetSnapshotFilePath() const;
+    TArray<uint8> SerializeSnapshot() const;
+    static bool ParseSnapshot(const uint8* Data, int64 Size, TMap<FString, FAddressState>& OutAddresses, int64& OutTipHeight);
+    void ScheduleSnapshotSave();
+
+    /** Saves a snapshot after every refresh that changed the cache, and restores it on startup. */
+    UPROPERTY(Config)
+    bool bPersistSnapshot = true;
+
+    /** Shared memory segment to share the cache through with the other processes of the host; empty to keep it private. */
+    UPROPERTY(Config)
+    FString SharedMemoryName;
+
+    /** Largest snapshot the segment holds; the segment takes twice as much. Must match across the processes sharing it. */
+    UPROPERTY(Config)
+    int32 SharedMemoryMegabytes = 64;
+
+    /** Seconds without a heartbeat after which another process takes over as the writer. */
+    UPROPERTY(Config)
+    float SharedWriterTimeoutSeconds = 15.0f;
+
+    bool TickSharedCache(float DeltaTime);
+
+    /** True in the processes reading the shared cache rather than writing it. */
+    bool IsSharedReader() const { return SharedCache.IsValid() && !SharedCache->IsWriter(); }
+
+    /** Takes the addresses this process watches from the latest shared snapshot, or every address of it if bAllAddresses. */
+    void AdoptSharedSnapshot(bool bAllAddresses);
+    void PublishSharedSnapshot();
+
+    /** Samples the entry and memory gauges of FCardanoMetrics. */
+    void CollectMetrics();
+    FDelegateHandle MetricsHandle;
+
+    TMap<FString, FAddressState> Watched;
+
+    /** Transactions overlaid on the chain state, keyed by hash. */
+    TMap<FString, FPendingTransaction> PendingTransactions;
+
+    /** Outputs spent in the mempool, with the spending transaction; set by SetMempoolSpends. */
+    TMap<FCardanoUTxORef, FString> MempoolSpends;
+    TArray<FOnUTxOCacheRefreshed> PendingCallbacks;
+    int64 TipBlockHeight = 0;
+    bool bRefreshInProgress = false;
+
+    /** Set when the cache changed since the last snapshot was written. */
+    bool bSnapshotDirty = false;
+
+    /** The snapshot being written on the thread pool, if any. */
+    TFuture<bool> PendingSnapshotSave;
+
+    TUniquePtr<FCardanoSharedCache> SharedCache;
+    FDelegateHandle SharedTickHandle;
+
+    /** Version of the shared snapshot last adopted; set when the cache changed since the last one was published. */
+    uint64 SharedVersion = 0;
+    bool bSharedDirty = false;
+    bool bSharedWriter = false;
+
+    uint32 WatchRevision = 0;
+    FOnUTxOCacheWatchChanged WatchChanged;
+    FOnUTxOCacheUTxOsChanged UTxOsChanged;
+
+    /** The followed addresses are current up to FollowHeight, the follower's last block. */
+    bool bFollowing = false;
+    int64 FollowHeight = 0;
+    int32 MaxUndoBlocks = 0;
+
+    /** Undo records of the last MaxUndoBlocks applied blocks, oldest first. */
+    TArray<FBlockUndo> UndoLog;
+};
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoHash.h"
+#include "CardanoTypes.h"
+#include "CardanoTxPlanner.h"
+#include "CardanoUTxOLeaseBackend.h"
+#include "HAL/CriticalSection.h"
+
+/** UTxOs handed out by FCardanoUTxOLanes::Acquire, spent by no other lease until released or committed. */
+struct CARDANOPLUGIN_API FCardanoUTxOLease
+{
+    /** Zero for a lease that failed to be acquired. */
+    int32 Id = 0;
+
+    /** Locked at the owner address of the lanes; give them to UCardanoTxBuilder::SetUTxOs. */
+    TArray<FUTxO> UTxOs;
+
+    bool IsValid() const { return Id != 0; }
+};
+
+/**
+ * Hands the UTxOs of one address out to concurrent transactions, such as server threads paying players at the same
+ * time, so that no two of them spend the same input. Each UTxO is a lane: a builder leases the few lanes covering
+ * its payment, builds with them alone, then commits the transaction, which frees its change as a new lane right away,
+ * or releases the lease if the build failed. Chained through their change, lanes sustain as many transactions per
+ * block as there are lanes.
+ * Lanes are best split beforehand into UTxOs of about the size of one payment: MakeSplitPayments gives the payments
+ * of such a split, to build with FCardanoTxPlanner and commit like any other transaction.
+ * Several server nodes spending from the same address share a lease backend, such as FCardanoRedisUTxOLeaseBackend:
+ * every lease is then reserved there too, lanes another node holds are skipped for a few seconds, and the inputs of
+ * committed transactions stay reserved until they confirm. Without a backend, leases are only known to this instance.
+ * Does not touch UObjects; every method may be called from any thread.
+ */
+class CARDANOPLUGIN_API FCardanoUTxOLanes
+{
+public:
+    /** InHolderId names this instance in the backend, unique across nodes; a new GUID if empty. */
+    explicit FCardanoUTxOLanes(const FString& InOwnerAddress, TSharedPtr<ICardanoUTxOLeaseBackend, ESPMode::ThreadSafe> InBackend = nullptr, const FString& InHolderId = FString());
+
+    const FString& GetOwnerAddress() const { return OwnerAddress; }
+    const FString& GetHolderId() const { return HolderId; }
+
+    /**
+     * How long the backend keeps the inputs of a lease reserved: longer than building and submitting a transaction
+     * takes, since another node may take them once it expires. Set before the first Acquire.
+     */
+    double LeaseTtlSeconds = 120.0;
+
+    /** How long the backend keeps the inputs of a committed transaction reserved, for the other nodes to see it confirm. */
+    double SpentTtlSeconds = 600.0;
+
+    /**
+     * Reconciles the lanes with UTxOs, the UTxOs of the owner address as known on chain, such as from
+     * UCardanoUTxOCache::GetCachedUTxOs after a refresh. New UTxOs become free lanes and the ones gone are dropped,
+     * except the change of committed transactions not confirmed yet. A committed transaction is confirmed once none
+     * of its inputs is listed any more. Leased lanes gone are dropped when their lease ends.
+     */
+    void SetUTxOs(const TArray<FUTxO>& UTxOs);
+
+    /**
+     * Leases free lanes holding at least Lovelace and Assets: the smallest lane covering everything if there is one,
+     * otherwise lanes holding the missing tokens, then the largest ones. Returns false, leasing nothing, if the free
+     * lanes cannot cover the amount, or if the lease backend is unreachable or keeps reporting the lanes picked as
+     * held by other nodes.
+     */
+    bool Acquire(int64 Lovelace, const TArray<FTokenBalance>& Assets, FCardanoUTxOLease& OutLease);
+
+    /** Frees the lanes of a lease whose transaction was not built or not submitted. */
+    void Release(int32 LeaseId);
+
+    /**
+     * Ends a lease with the signed transaction built out of it: the lanes it spends are retired, the others freed,
+     * and its outputs to the owner address become free lanes, to chain on before the transaction confirms.
+     * Fails, releasing the lease, if Transaction cannot be decoded.
+     */
+    bool Commit(int32 LeaseId, const TArray<uint8>& Transaction, FString& OutTxHash, FString& OutError);
+
+    /**
+     * Undoes Commit for a transaction the node rejected: its inputs become free lanes again and its outputs are
+     * dropped. Transactions chained on those outputs are doomed too and must be rejected as well, such as each of
+     * the hashes UCardanoUTxOCache::RejectPendingTransaction returns.
+     */
+    void Reject(const FString& TxHash);
+
+    int32 GetFreeCount() const;
+    int32 GetLeasedCount() const;
+
+    /** Payments from and to Address splitting funds into LaneCount lanes of LaneLovelace each. */
+    static TArray<FCardanoTxPayment> MakeSplitPayments(const FString& Address, int32 LaneCount, int64 LaneLovelace);
+
+private:
+    struct FLane
+    {
+        FUTxO UTxO;
+
+        /** Lease holding the lane, or 0 for a free lane. */
+        int32 LeaseId = 0;
+
+        /** Output of a committed transaction the chain does not list yet. */
+        bool bUnconfirmed = false;
+
+        /** No longer on chain while leased; dropped when the lease ends. */
+        bool bStale = false;
+
+        /** Reserved by another node in the backend; not picked before then. */
+        double HeldElsewhereUntil = 0.0;
+    };
+
+    struct FCommitted
+    {
+        /** Lanes the transaction spent, restored if it is rejected. */
+        TArray<TPair<FCardanoUTxORef, FUTxO>> Spent;
+        TArray<FCardanoUTxORef> Created;
+    };
+
+    /** Picks the free lanes Acquire leases, in Lanes. Called with Lock held. */
+    bool PickLanes(int64 Lovelace, TMap<FString, uint64> Missing, double Now, TArray<FCardanoUTxORef>& OutPicked) const;
+
+    /** Called with Lock held. */
+    void EndLease(int32 LeaseId);
+
+    const FString OwnerAddress;
+    const TSharedPtr<ICardanoUTxOLeaseBackend, ESPMode::ThreadSafe> Backend;
+    const FString HolderId;
+
+    mutable FCriticalSection Lock;
+    TMap<FCardanoUTxORef, FLane> Lanes;
+    TMap<int32, TArray<FCardanoUTxORef>> Leases;
+
+    /** Keyed by lower-case transaction hash. */
+    TMap<FString, FCommitted> Committed;
+
+    /** Inputs of the committed transactions, with the hash of the transaction spending them. */
+    TMap<FCardanoUTxORef, FString> SpentBy;
+
+    int32 NextLeaseId = 1;
+};
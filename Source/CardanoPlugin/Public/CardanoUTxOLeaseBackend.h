@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoHash.h"
+#include "HAL/CriticalSection.h"
+
+class FSocket;
+
+/**
+ * Shared record of which node holds which UTxO, so that several server nodes spending from the same address never
+ * pick the same input. FCardanoUTxOLanes reserves the inputs of every lease here before handing them out, keeps the
+ * inputs of committed transactions reserved until they confirm, and releases the rest.
+ * Implement it over any store able to check and set several keys atomically, with expiry. Every method may be called
+ * from any thread and may block on the store.
+ */
+class CARDANOPLUGIN_API ICardanoUTxOLeaseBackend
+{
+public:
+    virtual ~ICardanoUTxOLeaseBackend() = default;
+
+    /**
+     * Reserves every input of Refs for Holder during TtlSeconds, renewing those Holder holds already, or none of them
+     * if another holder has an unexpired reservation on any. Returns false and lists the inputs held by others in
+     * OutConflicts; OutConflicts is left empty if the store could not be reached.
+     */
+    virtual bool Reserve(const FString& Holder, const TArray<FCardanoUTxORef>& Refs, double TtlSeconds, TArray<FCardanoUTxORef>& OutConflicts) = 0;
+
+    /** Drops the reservations Holder has on Refs; reservations of other holders are kept. */
+    virtual void Release(const FString& Holder, const TArray<FCardanoUTxORef>& Refs) = 0;
+};
+
+/** In-process reservations, for several FCardanoUTxOLanes of the same process sharing an address. */
+class CARDANOPLUGIN_API FCardanoLocalUTxOLeaseBackend : public ICardanoUTxOLeaseBackend
+{
+public:
+    virtual bool Reserve(const FString& Holder, const TArray<FCardanoUTxORef>& Refs, double TtlSeconds, TArray<FCardanoUTxORef>& OutConflicts) override;
+    virtual void Release(const FString& Holder, const TArray<FCardanoUTxORef>& Refs) override;
+
+private:
+    struct FReservation
+    {
+        FString Holder;
+        double ExpiresAt = 0.0;
+    };
+
+    FCriticalSection Lock;
+    TMap<FCardanoUTxORef, FReservation> Reservations;
+
+    /** Reservations are swept of expired entries every so many calls, so the map does not grow with the chain. */
+    int32 CallsSinceSweep = 0;
+};
+
+/**
+ * Reservations held in Redis, one key per input ("<KeyPrefix><tx hash>#<index>", holding the holder id and expiring
+ * with the reservation). Reserve and Release each run as a single Lua script, so checking and setting several inputs
+ * is atomic. With Redis Cluster, put a hash tag in KeyPrefix, such as "{cardano}:lease:", so that every key of a
+ * script lands in the same slot.
+ * Calls are serialized over one connection, reopened once if it broke.
+ */
+class CARDANOPLUGIN_API FCardanoRedisUTxOLeaseBackend : public ICardanoUTxOLeaseBackend
+{
+public:
+    FCardanoRedisUTxOLeaseBackend(const FString& InHost, int32 InPort = 6379, const FString& InPassword = FString(), const FString& InKeyPrefix = TEXT("cardano:utxo-lease:"));
+    virtual ~FCardanoRedisUTxOLeaseBackend();
+
+    virtual bool Reserve(const FString& Holder, const TArray<FCardanoUTxORef>& Refs, double TtlSeconds, TArray<FCardanoUTxORef>& OutConflicts) override;
+    virtual void Release(const FString& Holder, const TArray<FCardanoUTxORef>& Refs) override;
+
+    /** How long a reply is waited for before the store counts as unreachable. */
+    float TimeoutSeconds = 2.0f;
+
+private:
+    struct FReply
+    {
+        bool bError = false;
+        int64 Integer = 0;
+        TArray<int64> Integers;
+        FString Text;
+    };
+
+    /** Runs a Lua script with a key per input of Refs; connects or reconnects as needed. Called with Lock held. */
+    bool RunScript(const char* Script, const TArray<FCardanoUTxORef>& Refs, const TArray<FString>& Args, FReply& OutReply);
+
+    bool Connect();
+    void Disconnect();
+    bool SendCommand(const TArray<FString>& Args);
+    bool ReadLine(FString& OutLine);
+    bool ReadReply(FReply& OutReply);
+
+    const FString Host;
+    const int32 Port;
+    const FString Password;
+    const FString KeyPrefix;
+
+    FCriticalSection Lock;
+    FSocket* Socket = nullptr;
+
+    /** Bytes received past the last reply read. */
+    TArray<uint8> Pending;
+};
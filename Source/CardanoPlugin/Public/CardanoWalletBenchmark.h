@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Timings of one FCardanoWalletBenchmark run at a fixed thread count. Stage times are per-wallet averages. */
+struct FCardanoWalletBenchmarkRun
+{
+    int32 Threads = 0;
+    int32 Wallets = 0;
+    int32 Failures = 0;
+    double WallSeconds = 0.0;
+    double WalletsPerSecond = 0.0;
+
+    /** cardano_bip39_entropy_to_mnemonic_words, including drawing the entropy. */
+    double MnemonicMicros = 0.0;
+
+    /** cardano_software_secure_key_handler_new, dominated by the EMIP-3 PBKDF2 encryption. */
+    double KeyHandlerMicros = 0.0;
+
+    /** create_address_from_derivation_paths: EMIP-3 decryption, account derivation and the base address. */
+    double AddressMicros = 0.0;
+};
+
+/**
+ * Measures how GenerateWallet's pipeline (entropy -> mnemonic -> key handler -> address) scales with threads, so
+ * regressions in the crypto path show up as numbers rather than as slower restores on players' machines.
+ * Each worker runs on its own dedicated thread. Runs are blocking and may take seconds; call them off the game thread.
+ *
+ * Also available from the console as `Cardano.BenchmarkWalletGeneration [WalletsPerThread] [MaxThreads]`, which
+ * logs one row per thread count.
+ */
+class CARDANOPLUGIN_API FCardanoWalletBenchmark
+{
+public:
+    /** Generates WalletsPerThread wallets on each of Threads threads and returns the aggregated timings. */
+    static FCardanoWalletBenchmarkRun Run(int32 Threads, int32 WalletsPerThread);
+
+    /**
+     * Runs the benchmark at 1, 2, 4, ... threads up to MaxThreads (MaxThreads itself is always included).
+     * MaxThreads <= 0 means the number of logical cores.
+     */
+    static TArray<FCardanoWalletBenchmarkRun> RunScaling(int32 MaxThreads, int32 WalletsPerThread);
+
+    /** Formats runs as a fixed-width table, one line per run. */
+    static FString FormatReport(const TArray<FCardanoWalletBenchmarkRun>& Runs);
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoHash.h"
+
+/** Everything needed to reopen a wallet without its mnemonic: keys as stored by cardano-c, and what was derived from them. */
+struct CARDANOPLUGIN_API FCardanoKeystoreRecord
+{
+    struct FChain
+    {
+        TArray<FString> Addresses;
+
+        /** Payment key hash of every address, in the same order. */
+        TArray<FCardanoHash28> KeyHashes;
+
+        int32 LastUsedIndex = INDEX_NONE;
+    };
+
+    int32 AccountIndex = 0;
+
+    /** Extended account public key, so the account needs no hardened derivation, and no decryption, to be opened. */
+    TArray<uint8> AccountKey;
+
+    /** Output of cardano_secure_key_handler_serialize, still encrypted with the spending password; empty for watch-only wallets. */
+    TArray<uint8> KeyHandler;
+
+    /** Indexed by CIP-1852 role: 0 external, 1 internal. */
+    FChain Chains[2];
+};
+
+/**
+ * Wallets saved under Saved/Cardano/Wallets, one file per name.
+ * The key material in a file is the software key handler's own EMIP-3 encrypted format, so it is as safe at rest
+ * as the spending password; account keys and addresses are stored in the clear, as they are public to the chain.
+ * Files are written beside their target and moved over it, and carry a CRC32 so a torn or corrupt file is refused.
+ * Thread-safe; every call touches the disk.
+ */
+class CARDANOPLUGIN_API FCardanoWalletKeystore
+{
+public:
+    /** Names are file names: non-empty, and without path separators or characters a file system rejects. */
+    static bool IsValidName(const FString& Name);
+
+    static bool Save(const FString& Name, const FCardanoKeystoreRecord& Record);
+    static bool Load(const FString& Name, FCardanoKeystoreRecord& OutRecord);
+    static bool Delete(const FString& Name);
+
+    /** Names of every saved wallet, sorted. */
+    static TArray<FString> List();
+
+    static TArray<uint8> Serialize(const FCardanoKeystoreRecord& Record);
+    static bool Parse(const uint8* Data, int64 Size, FCardanoKeystoreRecord& OutRecord);
+
+private:
+    static FString GetDirectory();
+    static FString GetFilePath(const FString& Name);
+};
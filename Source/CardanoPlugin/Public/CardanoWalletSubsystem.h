@@ -0,0 +1,231 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Containers/Ticker.h"
+#include "CardanoPaymentKeyIndex.h"
+#include "CardanoTypes.h"
+#include "CardanoWalletSubsystem.generated.h"
+
+/** Refers to a wallet managed by UCardanoWalletSubsystem; zero is never a valid wallet. */
+USTRUCT(BlueprintType)
+struct FCardanoWalletHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Cardano|Wallet")
+    int32 Id = 0;
+
+    bool IsValid() const { return Id != 0; }
+
+    bool operator==(const FCardanoWalletHandle& Other) const { return Id == Other.Id; }
+
+    friend uint32 GetTypeHash(const FCardanoWalletHandle& Handle) { return ::GetTypeHash(Handle.Id); }
+};
+
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnWalletAdded, bool, Success, FCardanoWalletHandle, Wallet, const FString&, ErrorMessage);
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnWalletSaved, bool, Success, const FString&, ErrorMessage);
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnWalletSigned, bool, Success, const TArray<uint8>&, SignedTransaction, const FString&, ErrorMessage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnWalletRefreshed, FCardanoWalletHandle, Wallet, bool, Success, const FString&, ErrorMessage);
+
+/**
+ * Keeps any number of HD wallets loaded for the lifetime of the engine, so Blueprints hold a handle instead of
+ * passing mnemonic words to every call and rebuilding keys, addresses and balances each time.
+ * Each wallet owns its key handler, the extended public key of its account and a pool of external and internal
+ * addresses kept GapLimit addresses ahead of the last one holding funds. Every address of every wallet is
+ * watched by UCardanoUTxOCache, which balances and spendable UTxOs are read from.
+ * Refreshes are scheduled per wallet but run on one ticker: all wallets due in the same tick share a single
+ * UTxO cache refresh, whose Koios queries batch the addresses of every wallet together.
+ * The spending password is never stored; it is asked for again by SignTransaction.
+ * Wallets saved with SaveWallet are reopened by name in later sessions, without their mnemonic.
+ * Watch-only wallets are loaded from an account public key alone: they track addresses and funds exactly like
+ * the others, without any key handler to create, decrypt or keep in memory, but cannot sign.
+ * All methods must be called on the game thread.
+ */
+UCLASS(Config = Game)
+class CARDANOPLUGIN_API UCardanoWalletSubsystem : public UEngineSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns the engine-wide wallet manager, or nullptr before the engine is initialized. */
+    static UCardanoWalletSubsystem* Get();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    /**
+     * Loads the wallet of a 24-word mnemonic: its key handler is created and its first addresses derived on a
+     * worker thread, then they are watched and refreshed. Password encrypts the keys held in memory and must be
+     * given again to sign. Adding an account already loaded returns its existing handle.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    void AddWallet(const TArray<FString>& MnemonicWords, const FString& Password, int32 AccountIndex, const FOnWalletAdded& OnComplete);
+
+    /**
+     * Loads a wallet whose keys are held by a cardano-signer service listening on the Unix socket SignerSocketPath,
+     * so that several server processes share one unlocked signer and none holds key material. Behaves as AddWallet,
+     * except that SignTransaction ignores its Password. Not available on Windows.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    void AddRemoteWallet(const FString& SignerSocketPath, int32 AccountIndex, const FOnWalletAdded& OnComplete);
+
+    /**
+     * Loads a watch-only wallet from its extended account public key, either bech32 ("acct_xvk1...") or 128 hex
+     * digits. Its addresses are derived on a worker thread, then watched and refreshed as for AddWallet.
+     * Adding an account already loaded, watch-only or not, returns its existing handle; adding it later with
+     * AddWallet gives that same wallet its keys.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    void AddWatchOnlyWallet(const FString& AccountPublicKey, const FOnWalletAdded& OnComplete);
+
+    /**
+     * Saves a loaded wallet under Name with FCardanoWalletKeystore, on a worker thread: its key handler in the
+     * library's encrypted format, its account public key and every address derived so far. Wallets whose keys are
+     * held by a signer service cannot be saved. Saving again under the same name replaces the file.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    void SaveWallet(FCardanoWalletHandle Wallet, const FString& Name, const FOnWalletSaved& OnComplete);
+
+    /**
+     * Loads a wallet saved by SaveWallet without its mnemonic: nothing is decoded, decrypted or derived, so this
+     * takes one file read, and the password is only needed again by SignTransaction. With bWatchOnly the saved
+     * keys are left on disk and the wallet is loaded as by AddWatchOnlyWallet.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    void OpenSavedWallet(const FString& Name, bool bWatchOnly, const FOnWalletAdded& OnComplete);
+
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    bool DeleteSavedWallet(const FString& Name);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Wallet")
+    TArray<FString> GetSavedWallets() const;
+
+    /** Unloads a wallet and stops watching the addresses no other wallet shares. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    void RemoveWallet(FCardanoWalletHandle Wallet);
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Wallet")
+    bool IsWalletValid(FCardanoWalletHandle Wallet) const { return Wallets.Contains(Wallet.Id); }
+
+    /** True for a wallet added by AddWatchOnlyWallet, which SignTransaction refuses. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Wallet")
+    bool IsWatchOnly(FCardanoWalletHandle Wallet) const;
+
+    UFUNCTION(BlueprintPure, Category = "Cardano|Wallet")
+    TArray<FCardanoWalletHandle> GetWallets() const;
+
+    /** Every address derived so far, external ones first, in index order. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    bool GetWalletAddresses(FCardanoWalletHandle Wallet, TArray<FString>& OutAddresses) const;
+
+    /** The first external address that never held funds; empty if the wallet is not loaded. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Wallet")
+    FString GetReceiveAddress(FCardanoWalletHandle Wallet) const;
+
+    /** The first internal address that never held funds, for transaction change. */
+    UFUNCTION(BlueprintPure, Category = "Cardano|Wallet")
+    FString GetChangeAddress(FCardanoWalletHandle Wallet) const;
+
+    /** Sums the cached UTxOs of every address of the wallet. Returns false while any of them is not downloaded yet. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    bool GetWalletBalance(FCardanoWalletHandle Wallet, FAddressBalance& OutBalance) const;
+
+    /** The cached UTxOs of every address of the wallet, with pending transactions applied. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    bool GetSpendableUTxOs(FCardanoWalletHandle Wallet, TArray<FUTxO>& OutUTxOs) const;
+
+    /** Makes the wallet due now; it is refreshed on the next tick, together with any other wallet due. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    void RefreshWallet(FCardanoWalletHandle Wallet);
+
+    /** Seconds between automatic refreshes of the wallet; 0 refreshes it only when RefreshWallet is called. */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    void SetRefreshInterval(FCardanoWalletHandle Wallet, float Seconds);
+
+    /**
+     * Adds the witnesses of the wallet's keys for every input of UnsignedTransaction spending one of its cached
+     * UTxOs, on a worker thread. Fails if no input belongs to the wallet or Password does not decrypt its keys.
+     * The key of each input is found with one lookup of the payment credential of its address, in an index the
+     * wallet fills as it derives addresses.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Cardano|Wallet")
+    void SignTransaction(FCardanoWalletHandle Wallet, const TArray<uint8>& UnsignedTransaction, const FString& Password, const FOnWalletSigned& OnComplete);
+
+    /** Fired for each wallet taking part in a refresh once it finished. */
+    UPROPERTY(BlueprintAssignable, Category = "Cardano|Wallet")
+    FOnWalletRefreshed OnWalletRefreshed;
+
+private:
+    struct FWalletKeys;
+
+    struct FAddressChain
+    {
+        TArray<FString> Addresses;
+
+        /** Highest index seen holding funds, or INDEX_NONE. An address keeps counting as used once emptied. */
+        int32 LastUsedIndex = INDEX_NONE;
+
+        /** Set while more addresses are being derived on a worker thread. */
+        bool bDeriving = false;
+    };
+
+    struct FWallet
+    {
+        /** Fingerprint of the account public key, to recognize an account loaded twice. */
+        FString AccountId;
+
+        /** Null for watch-only wallets. */
+        TSharedPtr<FWalletKeys, ESPMode::ThreadSafe> Keys;
+        TArray<uint8> AccountKey;
+
+        /** Unknown, and left at 0, for watch-only wallets. */
+        int32 AccountIndex = 0;
+
+        /** Indexed by CIP-1852 role: 0 external, 1 internal. */
+        FAddressChain Chains[2];
+
+        /** Role and index of the payment key of every address in Chains; the account is AccountIndex. */
+        FCardanoPaymentKeyIndex PaymentKeys;
+
+        float RefreshInterval = 0.0f;
+        double NextRefreshTime = 0.0;
+    };
+
+    FCardanoWalletHandle AddLoadedWallet(FWallet&& Wallet);
+    void FinishAddWallet(FWallet&& Wallet, const FString& Error, const FOnWalletAdded& OnComplete);
+
+    /** Reads the extended account public key of Wallet from its key handler; runs on any thread. */
+    static void LoadAccountKey(FWallet& Wallet, FString& OutError);
+
+    /** Derives the first Count addresses of both chains from the account key of Wallet; runs on any thread. */
+    static void DeriveInitialChains(FWallet& Wallet, int32 Count, FString& OutError);
+
+    bool Tick(float DeltaTime);
+
+    UFUNCTION()
+    void OnRefreshFinished(bool bSuccess, const FString& ErrorMessage);
+
+    /** Marks the addresses holding funds as used and derives more where fewer than GapLimit unused ones are left. */
+    void UpdateAddressPools(int32 WalletId);
+    void ExtendChain(int32 WalletId, int32 Role, int32 Count);
+    void WatchAddresses(const TArray<FString>& Addresses);
+    FString GetFirstUnused(FCardanoWalletHandle Wallet, int32 Role) const;
+
+    /** Unused addresses derived past the last used one, per chain. */
+    UPROPERTY(Config)
+    int32 GapLimit = 20;
+
+    /** Refresh interval given to wallets when they are added. */
+    UPROPERTY(Config)
+    float DefaultRefreshIntervalSeconds = 20.0f;
+
+    TMap<int32, FWallet> Wallets;
+    int32 NextWalletId = 1;
+
+    /** Wallets taking part in the running refresh; wallets falling due meanwhile wait for the next tick. */
+    TArray<int32> RefreshingWallets;
+    bool bRefreshInProgress = false;
+
+    FDelegateHandle TickHandle;
+};
@@ -1,8 +1,46 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "CardanoHash.h"
+#include "CardanoTypes.h"
 #include "CardanoWalletTypes.generated.h"
 
+/** Network an address is encoded for: its header's network id and its bech32 prefix. */
+UENUM(BlueprintType)
+enum class ECardanoNetwork : uint8
+{
+    /** addr1... and stake1... */
+    Mainnet,
+    /** addr_test1... and stake_test1..., for preprod, preview and local test networks alike. */
+    Testnet,
+};
+
+/** Shelley address kinds made by UCardanoBlueprintLibrary::MakeAddresses. */
+UENUM(BlueprintType)
+enum class ECardanoAddressKind : uint8
+{
+    /** Payment and stake credentials. */
+    Base,
+    /** Payment credential only. */
+    Enterprise,
+    /** Stake credential only: the address rewards are withdrawn from. */
+    Reward,
+};
+
+/** The Blake2b-224 hash of a verification key or of a script, as credentials appear in addresses. */
+USTRUCT(BlueprintType)
+struct FCardanoCredential
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Cardano|Wallet")
+    FCardanoHash28 Hash;
+
+    // Set for a script hash, such as the policy of a script-locked address
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Cardano|Wallet")
+    bool bScript = false;
+};
+
 /**
  * Holds the data for a freshly created wallet:
  * - A set of mnemonic words (seed phrase)
@@ -22,3 +60,54 @@ struct FCardanoWalletInfo
     FString PaymentAddress;
 };
 
+// Fired on the game thread once an async wallet generation or restoration finishes
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnWalletResult, bool, Success, const FCardanoWalletInfo&, Wallet, const FString&, ErrorMessage);
+
+/**
+ * A CIP-1852 address found to have on-chain history during wallet discovery.
+ */
+USTRUCT(BlueprintType)
+struct FCardanoDiscoveredAddress
+{
+    GENERATED_BODY()
+
+    // The bech32 base address
+    UPROPERTY(BlueprintReadOnly, Category="Cardano|Wallet")
+    FString Address;
+
+    // 0 for the external (receiving) chain, 1 for the internal (change) chain
+    UPROPERTY(BlueprintReadOnly, Category="Cardano|Wallet")
+    int32 Role = 0;
+
+    // The address index within its chain
+    UPROPERTY(BlueprintReadOnly, Category="Cardano|Wallet")
+    int32 Index = 0;
+
+    // The balance reported by Koios when the address was discovered
+    UPROPERTY(BlueprintReadOnly, Category="Cardano|Wallet")
+    FAddressBalance Balance;
+};
+
+/**
+ * The outcome of a gap-limit address discovery over one account.
+ */
+USTRUCT(BlueprintType)
+struct FCardanoWalletDiscovery
+{
+    GENERATED_BODY()
+
+    // Every used address, ordered by role and then by index
+    UPROPERTY(BlueprintReadOnly, Category="Cardano|Wallet")
+    TArray<FCardanoDiscoveredAddress> UsedAddresses;
+
+    // The first external index after the last used one; the next receiving address to hand out
+    UPROPERTY(BlueprintReadOnly, Category="Cardano|Wallet")
+    int32 NextExternalIndex = 0;
+
+    // The first internal index after the last used one; the next change address to use
+    UPROPERTY(BlueprintReadOnly, Category="Cardano|Wallet")
+    int32 NextInternalIndex = 0;
+};
+
+// Fired on the game thread once an address discovery finishes
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnWalletDiscoveryResult, bool, Success, const FCardanoWalletDiscovery&, Discovery, const FString&, ErrorMessage);
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CardanoHash.h"
+#include <cardano/cardano.h>
+
+/**
+ * Collects the vkey witnesses of every cosigner of one transaction, such as a multisig treasury spend, and attaches
+ * them all at once. The transaction is decoded and its id computed once; witnesses are deduplicated by key hash as
+ * they arrive, so a signer answering twice, or a key already witnessing the transaction, costs nothing more.
+ * Finalize checks all new signatures against the transaction id, merges the valid ones into the witness set in one
+ * operation and serializes the transaction once, instead of a decode, merge and encode per cosigner.
+ * Does not touch UObjects; an instance may be used from any thread, but not from several at once.
+ */
+class CARDANOPLUGIN_API FCardanoWitnessAggregator
+{
+public:
+    FCardanoWitnessAggregator() = default;
+    ~FCardanoWitnessAggregator();
+
+    FCardanoWitnessAggregator(const FCardanoWitnessAggregator&) = delete;
+    FCardanoWitnessAggregator& operator=(const FCardanoWitnessAggregator&) = delete;
+
+    /**
+     * Starts collecting witnesses for Transaction, full transaction CBOR as returned by UCardanoTxBuilder::Build,
+     * which may already carry some. Discards whatever was collected for a previous transaction.
+     */
+    bool Initialize(const TArray<uint8>& Transaction, FString& OutError);
+
+    bool IsInitialized() const { return Transaction != nullptr; }
+
+    /** The id of the transaction, the hash every witness must sign. */
+    const FCardanoHash32& GetTransactionId() const { return TransactionId; }
+
+    /**
+     * Adds the witness of one cosigner: its 32-byte Ed25519 public key and its 64-byte signature of the transaction
+     * id. Fails only for a key or signature of the wrong size; signatures are checked by Finalize. When a key is
+     * already collected or already witnesses the transaction, the first witness is kept and this one ignored.
+     */
+    bool AddWitness(const TArray<uint8>& PublicKey, const TArray<uint8>& Signature, FString& OutError);
+
+    /** Adds every vkey witness of WitnessSet, the witness set CBOR a CIP-30 wallet returns from signTx. Other witnesses are ignored. */
+    bool AddWitnessSet(const TArray<uint8>& WitnessSet, FString& OutError);
+
+    /** Witnesses collected since the last Finalize. */
+    int32 GetPendingCount() const { return Pending.Num(); }
+
+    /** True if the key of KeyHash witnesses the transaction or is pending. */
+    bool HasWitness(const FCardanoHash28& KeyHash) const { return Attached.Contains(KeyHash) || Pending.Contains(KeyHash); }
+
+    /**
+     * Verifies the pending witnesses against the transaction id, attaches the valid ones and writes the
+     * transaction into OutTransaction. The key hashes of invalid witnesses are written to OutRejected; they are
+     * dropped without failing the call, and may be added again. More witnesses may be added after Finalize.
+     */
+    bool Finalize(TArray<uint8>& OutTransaction, TArray<FCardanoHash28>& OutRejected, FString& OutError);
+
+private:
+    struct FPendingWitness
+    {
+        uint8 PublicKey[32];
+        uint8 Signature[64];
+    };
+
+    void AddPending(const uint8* PublicKey, const uint8* Signature);
+    void Reset();
+
+    cardano_transaction_t* Transaction = nullptr;
+    FCardanoHash32 TransactionId;
+
+    /** Key hashes of the vkey witnesses in Transaction. */
+    TSet<FCardanoHash28> Attached;
+    TMap<FCardanoHash28, FPendingWitness> Pending;
+};
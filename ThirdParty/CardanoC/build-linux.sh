@@ -0,0 +1,92 @@
+#!/usr/bin/env bash
+#
+# Builds the static cardano-c library, with the bundled libsodium and mini-gmp, for the Linux targets of the plugin:
+#
+#   lib/Linux/x86_64-unknown-linux-gnu/libcardano-c.a
+#   lib/Linux/aarch64-unknown-linux-gnueabi/libcardano-c.a
+#
+# CardanoPlugin.Build.cs links these for Linux and LinuxAArch64 targets, such as dedicated servers, and refuses to
+# build against one whose sources have changed since, from the hash of sources-hash.sh kept next to it in
+# libcardano-c.sources. The cardano-signer signing service (tools/cardano_signer) is linked against each of them into
+# bin/Linux/<triple>/cardano-signer.
+#
+# With LINUX_MULTIARCH_ROOT set (the Unreal Engine cross-compile toolchain, as used by UnrealBuildTool), both
+# architectures are built with its clang and sysroots. Without it, the host compiler ($CC, or cc) builds the host
+# architecture only. A list of target triples may be passed to build a subset.
+#
+# libsodium is compiled without ./configure: its SSE/AVX2/AVX-512 code paths are enabled from the compiler (see
+# private/common.h) and chosen at runtime with CPUID, so one x86_64 library runs on any x86_64 server and uses the
+# fastest code the CPU supports. The macros below stand in for what ./configure detects on Linux.
+
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+JOBS="${JOBS:-$(nproc)}"
+
+COMMON_FLAGS="-O3 -fPIC -fvisibility=hidden -ffunction-sections -fdata-sections -pthread -DNDEBUG"
+
+SODIUM_FLAGS="-DNATIVE_LITTLE_ENDIAN=1 -DHAVE_PTHREAD=1 -DHAVE_GCC_MEMORY_FENCES=1 -DHAVE_WEAK_SYMBOLS=1 \
+-DHAVE_SYS_MMAN_H=1 -DHAVE_MMAP=1 -DHAVE_SYSCONF=1 -DHAVE_MPROTECT=1 -DHAVE_MLOCK=1 -DHAVE_MADVISE=1 -DHAVE_POSIX_MEMALIGN=1 \
+-DHAVE_SYS_RANDOM_H=1 -DHAVE_GETRANDOM=1 -DHAVE_EXPLICIT_BZERO=1 -DHAVE_SYS_AUXV_H=1 -DHAVE_GETAUXVAL=1 \
+-I${ROOT}/external/libsodium/include/sodium -I${ROOT}/external/libsodium/include -I${ROOT}"
+
+CARDANO_FLAGS="-std=c11 -I${ROOT}/include -I${ROOT} -I${ROOT}/src"
+
+if [ "$#" -gt 0 ]; then
+  TARGETS=("$@")
+elif [ -n "${LINUX_MULTIARCH_ROOT:-}" ]; then
+  TARGETS=(x86_64-unknown-linux-gnu aarch64-unknown-linux-gnueabi)
+else
+  case "$(uname -m)" in
+    x86_64) TARGETS=(x86_64-unknown-linux-gnu) ;;
+    aarch64 | arm64) TARGETS=(aarch64-unknown-linux-gnueabi) ;;
+    *) echo "Unsupported host architecture $(uname -m)" >&2; exit 1 ;;
+  esac
+fi
+
+for TARGET in "${TARGETS[@]}"; do
+  if [ -n "${LINUX_MULTIARCH_ROOT:-}" ]; then
+    TOOLCHAIN="${LINUX_MULTIARCH_ROOT%/}/${TARGET}"
+    CC_CMD="${TOOLCHAIN}/bin/clang --target=${TARGET} --sysroot=${TOOLCHAIN}"
+    AR_CMD="${TOOLCHAIN}/bin/llvm-ar"
+    [ -x "${AR_CMD}" ] || AR_CMD="${TOOLCHAIN}/bin/${TARGET}-ar"
+  else
+    CC_CMD="${CC:-cc}"
+    AR_CMD="${AR:-ar}"
+  fi
+
+  BUILD_DIR="${ROOT}/build/Linux/${TARGET}"
+  OUTPUT_DIR="${ROOT}/lib/Linux/${TARGET}"
+
+  rm -rf "${BUILD_DIR}"
+  mkdir -p "${BUILD_DIR}" "${OUTPUT_DIR}"
+
+  echo "Building cardano-c for ${TARGET} with ${CC_CMD%% *}"
+
+  export CC_CMD COMMON_FLAGS SODIUM_FLAGS CARDANO_FLAGS BUILD_DIR
+
+  (cd "${ROOT}" && find src external -name '*.c' | sort) | xargs -P "${JOBS}" -I{} sh -c '
+    source="$1"
+    object="${BUILD_DIR}/$(echo "${source}" | tr "/" "_").o"
+    case "${source}" in
+      external/libsodium/*) flags="${SODIUM_FLAGS} -w" ;;
+      *) flags="${CARDANO_FLAGS}" ;;
+    esac
+    ${CC_CMD} ${COMMON_FLAGS} ${flags} -c "'"${ROOT}"'/${source}" -o "${object}"
+  ' _ {}
+
+  rm -f "${OUTPUT_DIR}/libcardano-c.a"
+  ${AR_CMD} rcs "${OUTPUT_DIR}/libcardano-c.a" "${BUILD_DIR}"/*.o
+
+  "${ROOT}/sources-hash.sh" > "${OUTPUT_DIR}/libcardano-c.sources"
+
+  echo "Wrote ${OUTPUT_DIR}/libcardano-c.a"
+
+  BIN_DIR="${ROOT}/bin/Linux/${TARGET}"
+  mkdir -p "${BIN_DIR}"
+
+  ${CC_CMD} ${COMMON_FLAGS} ${CARDANO_FLAGS} -Wl,--gc-sections "${ROOT}/tools/cardano_signer/cardano_signer.c" \
+    "${OUTPUT_DIR}/libcardano-c.a" -lm -o "${BIN_DIR}/cardano-signer"
+
+  echo "Wrote ${BIN_DIR}/cardano-signer"
+done
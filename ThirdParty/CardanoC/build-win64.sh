@@ -0,0 +1,78 @@
+#!/usr/bin/env bash
+#
+# Builds the cardano-c DLL, with the bundled libsodium and mini-gmp, for the Win64 targets of the plugin:
+#
+#   lib/Win64/libcardano-c.dll
+#   lib/Win64/libcardano-c.dll.a
+#
+# CardanoPlugin.Build.cs links the import library and stages the DLL, next to libgcc_s_seh-1.dll from the same
+# toolchain. Like build-linux.sh, it records in lib/Win64/libcardano-c.sources the hash of the sources the DLL was
+# built from, and Build.cs refuses to build against a DLL whose sources have changed since.
+#
+# Needs a MinGW-w64 GCC: the x86_64-w64-mingw32 cross compiler on Linux (e.g. the gcc-mingw-w64-x86-64 package), or
+# the native gcc of an MSYS2 MINGW64 shell. Set $CC to use another one.
+#
+# libsodium is compiled without ./configure, as in build-linux.sh; the macros below stand in for what ./configure
+# detects on Windows. Every function is exported, as the headers do not mark them for GCC.
+
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+JOBS="${JOBS:-$(nproc)}"
+
+if [ -n "${CC:-}" ]; then
+  CC_CMD="${CC}"
+elif command -v x86_64-w64-mingw32-gcc > /dev/null; then
+  CC_CMD="x86_64-w64-mingw32-gcc"
+else
+  CC_CMD="gcc"
+fi
+
+if ! ${CC_CMD} -dumpmachine | grep -q "mingw32"; then
+  echo "${CC_CMD} does not target MinGW-w64; install x86_64-w64-mingw32-gcc or set CC" >&2
+  exit 1
+fi
+
+COMMON_FLAGS="-O3 -ffunction-sections -fdata-sections -DNDEBUG -D_WIN32_WINNT=0x0601"
+
+SODIUM_FLAGS="-DSODIUM_STATIC=1 -DNATIVE_LITTLE_ENDIAN=1 -DHAVE_GCC_MEMORY_FENCES=1 -DHAVE_INTRIN_H=1 \
+-I${ROOT}/external/libsodium/include/sodium -I${ROOT}/external/libsodium/include -I${ROOT}"
+
+CARDANO_FLAGS="-std=c11 -DSODIUM_STATIC=1 -I${ROOT}/include -I${ROOT} -I${ROOT}/src"
+
+BUILD_DIR="${ROOT}/build/Win64"
+OUTPUT_DIR="${ROOT}/lib/Win64"
+
+rm -rf "${BUILD_DIR}"
+mkdir -p "${BUILD_DIR}" "${OUTPUT_DIR}"
+
+echo "Building cardano-c for Win64 with ${CC_CMD%% *}"
+
+export CC_CMD COMMON_FLAGS SODIUM_FLAGS CARDANO_FLAGS BUILD_DIR
+
+(cd "${ROOT}" && find src external -name '*.c' | sort) | xargs -P "${JOBS}" -I{} sh -c '
+  source="$1"
+  object="${BUILD_DIR}/$(echo "${source}" | tr "/" "_").o"
+  case "${source}" in
+    external/libsodium/*) flags="${SODIUM_FLAGS} -w" ;;
+    *) flags="${CARDANO_FLAGS}" ;;
+  esac
+  ${CC_CMD} ${COMMON_FLAGS} ${flags} -c "'"${ROOT}"'/${source}" -o "${object}"
+' _ {}
+
+rm -f "${OUTPUT_DIR}/libcardano-c.dll" "${OUTPUT_DIR}/libcardano-c.dll.a"
+${CC_CMD} -shared -Wl,--gc-sections -Wl,--export-all-symbols -Wl,--out-implib,"${OUTPUT_DIR}/libcardano-c.dll.a" \
+  "${BUILD_DIR}"/*.o -ladvapi32 -o "${OUTPUT_DIR}/libcardano-c.dll"
+
+# Cross compilers keep the GCC runtime with their libraries, MSYS2 next to gcc.exe
+GCC_RUNTIME="$(${CC_CMD} -print-file-name=libgcc_s_seh-1.dll)"
+[ -f "${GCC_RUNTIME}" ] || GCC_RUNTIME="$(dirname "$(command -v "${CC_CMD%% *}")")/libgcc_s_seh-1.dll"
+if [ -f "${GCC_RUNTIME}" ]; then
+  cp "${GCC_RUNTIME}" "${OUTPUT_DIR}/libgcc_s_seh-1.dll"
+else
+  echo "libgcc_s_seh-1.dll not found; keeping ${OUTPUT_DIR}/libgcc_s_seh-1.dll" >&2
+fi
+
+"${ROOT}/sources-hash.sh" > "${OUTPUT_DIR}/libcardano-c.sources"
+
+echo "Wrote ${OUTPUT_DIR}/libcardano-c.dll"
@@ -791,6 +791,106 @@ ge25519_double_scalarmult_vartime(ge25519_p2 *r, const unsigned char *a,
     }
 }
 
+/*
+ r = a[0] * A[0] + ... + a[n-1] * A[n-1] + b * B
+ where every scalar is 32 bytes, little-endian.
+ B is the Ed25519 base point (x,4/5) with x positive.
+
+ Straus' method: every point gets a width-5 NAF and its own table of odd
+ multiples, and all of them share a single chain of doublings.
+ Ai must have room for 8 * n cached points and aslide for 256 * n digits.
+
+ Only used for batch signature verification.
+ */
+
+void
+ge25519_multi_scalarmult_vartime(ge25519_p3 *r, const unsigned char *a,
+                                 const ge25519_p3 *A, size_t n,
+                                 const unsigned char *b,
+                                 ge25519_cached *Ai, signed char *aslide)
+{
+    static const ge25519_precomp Bi[8] = {
+#ifdef HAVE_TI_MODE
+# include "fe_51/base2.h"
+#else
+# include "fe_25_5/base2.h"
+#endif
+    };
+    signed char    bslide[256];
+    ge25519_p2     acc;
+    ge25519_p1p1   t;
+    ge25519_p3     u;
+    ge25519_p3     A2;
+    size_t         j;
+    int            i;
+    int            k;
+
+    slide_vartime(bslide, b);
+
+    for (j = 0; j < n; ++j) {
+        slide_vartime(&aslide[256 * j], &a[32 * j]);
+
+        ge25519_p3_to_cached(&Ai[8 * j], &A[j]);
+        ge25519_p3_dbl(&t, &A[j]);
+        ge25519_p1p1_to_p3(&A2, &t);
+
+        for (k = 1; k < 8; ++k) {
+            ge25519_add(&t, &A2, &Ai[8 * j + k - 1]);
+            ge25519_p1p1_to_p3(&u, &t);
+            ge25519_p3_to_cached(&Ai[8 * j + k], &u);
+        }
+    }
+
+    for (i = 255; i >= 0; --i) {
+        if (bslide[i]) {
+            break;
+        }
+        for (j = 0; j < n; ++j) {
+            if (aslide[256 * j + i]) {
+                break;
+            }
+        }
+        if (j < n) {
+            break;
+        }
+    }
+
+    ge25519_p2_0(&acc);
+
+    if (i < 0) {
+        ge25519_p3_0(r);
+        return;
+    }
+
+    for (; i >= 0; --i) {
+        ge25519_p2_dbl(&t, &acc);
+
+        for (j = 0; j < n; ++j) {
+            const signed char d = aslide[256 * j + i];
+
+            if (d > 0) {
+                ge25519_p1p1_to_p3(&u, &t);
+                ge25519_add(&t, &u, &Ai[8 * j + d / 2]);
+            } else if (d < 0) {
+                ge25519_p1p1_to_p3(&u, &t);
+                ge25519_sub(&t, &u, &Ai[8 * j + (-d) / 2]);
+            }
+        }
+
+        if (bslide[i] > 0) {
+            ge25519_p1p1_to_p3(&u, &t);
+            ge25519_madd(&t, &u, &Bi[bslide[i] / 2]);
+        } else if (bslide[i] < 0) {
+            ge25519_p1p1_to_p3(&u, &t);
+            ge25519_msub(&t, &u, &Bi[(-bslide[i]) / 2]);
+        }
+
+        ge25519_p1p1_to_p2(&acc, &t);
+    }
+
+    ge25519_p1p1_to_p3(r, &t);
+}
+
 /*
  h = a * p
  where a = a[0]+256*a[1]+...+256^31 a[31]
@@ -103,4 +103,17 @@ int blake2b_compress_sse41(blake2b_state *S,
 int blake2b_compress_avx2(blake2b_state *S,
                           const uint8_t  block[BLAKE2B_BLOCKBYTES]);
 
+/* Multi-buffer API: n unkeyed hashes of outlen bytes, written back to back */
+int blake2b_many(uint8_t *out, const uint8_t outlen, const uint8_t *const *in,
+                 const uint64_t *inlen, size_t n);
+
+typedef int (*blake2b_many_fn)(uint8_t *out, const uint8_t outlen,
+                               const uint8_t *const *in, const uint64_t *inlen,
+                               size_t n);
+int blake2b_many_ref(uint8_t *out, const uint8_t outlen,
+                     const uint8_t *const *in, const uint64_t *inlen, size_t n);
+int blake2b_many_avx2(uint8_t *out, const uint8_t outlen,
+                      const uint8_t *const *in, const uint64_t *inlen,
+                      size_t n);
+
 #endif
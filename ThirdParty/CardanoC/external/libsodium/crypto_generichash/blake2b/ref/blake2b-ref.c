@@ -26,6 +26,7 @@
 #include "utils.h"
 
 static blake2b_compress_fn blake2b_compress = blake2b_compress_ref;
+static blake2b_many_fn     blake2b_many_impl = blake2b_many_ref;
 
 static const uint64_t blake2b_IV[8] = {
     0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL,
@@ -407,6 +408,30 @@ blake2b_salt_personal(uint8_t *out, const void *in, const void *key,
     return 0;
 }
 
+int
+blake2b_many_ref(uint8_t *out, const uint8_t outlen, const uint8_t *const *in,
+                 const uint64_t *inlen, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++) {
+        if (blake2b(out + i * outlen, in[i], NULL, outlen, inlen[i], 0) != 0) {
+            return -1; /* LCOV_EXCL_LINE */
+        }
+    }
+    return 0;
+}
+
+int
+blake2b_many(uint8_t *out, const uint8_t outlen, const uint8_t *const *in,
+             const uint64_t *inlen, size_t n)
+{
+    if (!outlen || outlen > BLAKE2B_OUTBYTES) {
+        sodium_misuse();
+    }
+    return blake2b_many_impl(out, outlen, in, inlen, n);
+}
+
 int
 blake2b_pick_best_implementation(void)
 {
@@ -414,7 +439,8 @@ blake2b_pick_best_implementation(void)
 #if defined(HAVE_AVX2INTRIN_H) && defined(HAVE_TMMINTRIN_H) && \
     defined(HAVE_SMMINTRIN_H)
     if (sodium_runtime_has_avx2()) {
-        blake2b_compress = blake2b_compress_avx2;
+        blake2b_compress  = blake2b_compress_avx2;
+        blake2b_many_impl = blake2b_many_avx2;
         return 0;
     }
 #endif
@@ -431,7 +457,8 @@ blake2b_pick_best_implementation(void)
         return 0;
     }
 #endif
-    blake2b_compress = blake2b_compress_ref;
+    blake2b_compress  = blake2b_compress_ref;
+    blake2b_many_impl = blake2b_many_ref;
 
     return 0;
     /* LCOV_EXCL_STOP */
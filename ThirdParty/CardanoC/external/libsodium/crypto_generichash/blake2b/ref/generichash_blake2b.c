@@ -42,6 +42,22 @@ crypto_generichash_blake2b_salt_personal(
                                  personal);
 }
 
+int
+crypto_generichash_blake2b_many(unsigned char *out, size_t outlen,
+                                const unsigned char * const *in,
+                                const unsigned long long *inlen, size_t n)
+{
+    if (outlen <= 0U || outlen > BLAKE2B_OUTBYTES) {
+        return -1;
+    }
+    assert(outlen <= UINT8_MAX);
+    COMPILER_ASSERT(sizeof(unsigned long long) == sizeof(uint64_t));
+
+    return blake2b_many((uint8_t *) out, (uint8_t) outlen,
+                        (const uint8_t * const *) in,
+                        (const uint64_t *) (const void *) inlen, n);
+}
+
 int
 crypto_generichash_blake2b_init(crypto_generichash_blake2b_state *state,
                                 const unsigned char *key, const size_t keylen,
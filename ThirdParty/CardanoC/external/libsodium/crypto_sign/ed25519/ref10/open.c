@@ -1,11 +1,13 @@
 
 #include <limits.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "crypto_hash_sha512.h"
 #include "crypto_sign_ed25519.h"
 #include "crypto_verify_32.h"
+#include "randombytes.h"
 #include "sign_ed25519_ref10.h"
 #include "private/common.h"
 #include "private/ed25519_ref10.h"
@@ -65,6 +67,164 @@ crypto_sign_ed25519_verify_detached(const unsigned char *sig,
     return _crypto_sign_ed25519_verify_detached(sig, m, mlen, pk, 0);
 }
 
+/*
+ Batch verification checks the single random linear combination
+
+   8 * ((sum z_i S_i) B - sum (z_i h_i) A_i - sum z_i R_i) == 0
+
+ with 128-bit random z_i, using one multi-scalar multiplication per chunk.
+ Signatures the per-item check would reject up front (non-canonical S, R or
+ A, small-order R or A) never enter the batch, and a chunk whose equation
+ fails is re-checked one signature at a time to find the culprits.
+
+ The factor 8 clears torsion, while the per-item check R == S B - h A does
+ not: a signature passes the batch but fails crypto_sign_ed25519_verify_detached
+ exactly when the torsion components of R and h A do not cancel, i.e. when
+ R + (h mod 8) A lies outside the prime-order subgroup. That point is checked
+ for every signature before it enters the batch (one multiplication by the
+ group order), and those that fail are checked one at a time instead.
+ ge25519_is_on_main_subgroup() is not used for this, as it also accepts
+ points whose torsion component has order 2.
+ */
+
+#define VERIFY_BATCH_CHUNK 64
+
+int
+crypto_sign_ed25519_verify_batch(int *results,
+                                 const unsigned char * const *sigs,
+                                 const unsigned char * const *ms,
+                                 const unsigned long long *mlens,
+                                 const unsigned char * const *pks,
+                                 size_t n)
+{
+    static const unsigned char identity[32] = { 1 };
+    static const unsigned char zero[32];
+    static const unsigned char order[32] = {
+        0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+        0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+    };
+    crypto_hash_sha512_state   hs;
+    unsigned char              h[64];
+    unsigned char              z[32];
+    unsigned char              b[32];
+    unsigned char              qbytes[32];
+    unsigned char              ebytes[32];
+    ge25519_cached             qc;
+    ge25519_cached             ac;
+    ge25519_p1p1               t;
+    ge25519_p3                 q;
+    ge25519_p3                 e;
+    ge25519_p2                 el;
+    ge25519_p3                *points;
+    unsigned char             *scalars;
+    ge25519_cached            *tables;
+    signed char               *slides;
+    size_t                     idx[VERIFY_BATCH_CHUNK];
+    size_t                     off;
+    size_t                     i;
+    size_t                     c;
+    int                        k;
+    int                        ret = 0;
+
+    points  = (ge25519_p3 *) malloc(2 * VERIFY_BATCH_CHUNK * sizeof *points);
+    scalars = (unsigned char *) malloc(2 * VERIFY_BATCH_CHUNK * 32);
+    tables  = (ge25519_cached *) malloc(2 * VERIFY_BATCH_CHUNK * 8 * sizeof *tables);
+    slides  = (signed char *) malloc(2 * VERIFY_BATCH_CHUNK * 256);
+
+    for (off = 0; off < n; off += VERIFY_BATCH_CHUNK) {
+        const size_t m = n - off < VERIFY_BATCH_CHUNK ? n - off : VERIFY_BATCH_CHUNK;
+
+        memset(b, 0, sizeof b);
+        c = 0;
+
+        for (i = off; i < off + m; ++i) {
+            const unsigned char *sig = sigs[i];
+            const unsigned char *pk  = pks[i];
+
+            if (points == NULL || scalars == NULL || tables == NULL || slides == NULL ||
+                sc25519_is_canonical(sig + 32) == 0 ||
+                ge25519_is_canonical(sig) == 0 || ge25519_has_small_order(sig) != 0 ||
+                ge25519_is_canonical(pk) == 0 || ge25519_has_small_order(pk) != 0 ||
+                ge25519_frombytes_negate_vartime(&points[2 * c], pk) != 0 ||
+                ge25519_frombytes_negate_vartime(&points[2 * c + 1], sig) != 0) {
+                results[i] = crypto_sign_ed25519_verify_detached(sig, ms[i], mlens[i], pk);
+                continue;
+            }
+
+            _crypto_sign_ed25519_ref10_hinit(&hs, 0);
+            crypto_hash_sha512_update(&hs, sig, 32);
+            crypto_hash_sha512_update(&hs, pk, 32);
+            crypto_hash_sha512_update(&hs, ms[i], mlens[i]);
+            crypto_hash_sha512_final(&hs, h);
+            sc25519_reduce(h);
+
+            /* -(R + (h mod 8) A) */
+            e = points[2 * c + 1];
+            ge25519_p3_to_cached(&ac, &points[2 * c]);
+            for (k = 0; k < (h[0] & 7); ++k) {
+                ge25519_add(&t, &e, &ac);
+                ge25519_p1p1_to_p3(&e, &t);
+            }
+            ge25519_double_scalarmult_vartime(&el, order, &e, zero);
+            ge25519_tobytes(ebytes, &el);
+            if (crypto_verify_32(ebytes, identity) != 0) {
+                results[i] = crypto_sign_ed25519_verify_detached(sig, ms[i], mlens[i], pk);
+                continue;
+            }
+
+            memset(z, 0, sizeof z);
+            randombytes_buf(z, 16);
+            z[0] |= 1;
+
+            sc25519_mul(&scalars[32 * (2 * c)], z, h);
+            memcpy(&scalars[32 * (2 * c + 1)], z, 32);
+            sc25519_muladd(b, z, sig + 32, b);
+
+            idx[c++] = i;
+        }
+
+        if (c == 0) {
+            continue;
+        }
+
+        ge25519_multi_scalarmult_vartime(&q, scalars, points, 2 * c, b, tables, slides);
+
+        for (k = 0; k < 3; ++k) {
+            ge25519_p3_to_cached(&qc, &q);
+            ge25519_add(&t, &q, &qc);
+            ge25519_p1p1_to_p3(&q, &t);
+        }
+        ge25519_p3_tobytes(qbytes, &q);
+
+        for (i = 0; i < c; ++i) {
+            const size_t j = idx[i];
+
+            if (crypto_verify_32(qbytes, identity) == 0) {
+                results[j] = 0;
+            } else {
+                results[j] = crypto_sign_ed25519_verify_detached(sigs[j], ms[j], mlens[j], pks[j]);
+            }
+        }
+    }
+
+    for (i = 0; i < n; ++i) {
+        if (results[i] != 0) {
+            results[i] = -1;
+            ret = -1;
+        }
+    }
+
+    sodium_memzero(z, sizeof z);
+    free(slides);
+    free(tables);
+    free(scalars);
+    free(points);
+
+    return ret;
+}
+
 int
 crypto_sign_ed25519_open(unsigned char *m, unsigned long long *mlen_p,
                          const unsigned char *sm, unsigned long long smlen,
@@ -22,6 +22,50 @@
 
 #define COMPILER_ASSERT(X) (void) sizeof(char[(X) ? 1 : -1])
 
+/*
+ * Builds that do not go through ./configure (cardano-c compiles these
+ * sources directly, including with MinGW) get none of the HAVE_* feature
+ * macros, which silently selects the portable 32-bit field arithmetic and
+ * disables every SIMD code path. Derive what the compiler already tells us.
+ * The intrinsics headers only make the SIMD code available; the actual
+ * choice is still made at runtime via sodium_runtime_has_*().
+ */
+#if (!defined(CONFIGURED) || CONFIGURED != 1) && !defined(_MSC_VER) && \
+    (defined(__GNUC__) || defined(__clang__))
+# if defined(__SIZEOF_INT128__) && !defined(HAVE_TI_MODE)
+#  define HAVE_TI_MODE 1
+# endif
+# if defined(__x86_64__) || defined(__i386__)
+#  ifndef HAVE_CPUID
+#   define HAVE_CPUID 1
+#  endif
+#  ifndef HAVE_MMINTRIN_H
+#   define HAVE_MMINTRIN_H 1
+#  endif
+#  ifndef HAVE_EMMINTRIN_H
+#   define HAVE_EMMINTRIN_H 1
+#  endif
+#  ifndef HAVE_PMMINTRIN_H
+#   define HAVE_PMMINTRIN_H 1
+#  endif
+#  ifndef HAVE_TMMINTRIN_H
+#   define HAVE_TMMINTRIN_H 1
+#  endif
+#  ifndef HAVE_SMMINTRIN_H
+#   define HAVE_SMMINTRIN_H 1
+#  endif
+#  ifndef HAVE_AVXINTRIN_H
+#   define HAVE_AVXINTRIN_H 1
+#  endif
+#  ifndef HAVE_AVX2INTRIN_H
+#   define HAVE_AVX2INTRIN_H 1
+#  endif
+#  ifndef HAVE_WMMINTRIN_H
+#   define HAVE_WMMINTRIN_H 1
+#  endif
+# endif
+#endif
+
 #ifdef HAVE_TI_MODE
 # if defined(__SIZEOF_INT128__)
 typedef unsigned __int128 uint128_t;
@@ -4,6 +4,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "private/common.h"
+
 /*
  fe means field element.
  Here the field is \Z/(2^255-19).
@@ -97,6 +99,11 @@ void ge25519_double_scalarmult_vartime(ge25519_p2 *r, const unsigned char *a,
                                        const ge25519_p3 *A,
                                        const unsigned char *b);
 
+void ge25519_multi_scalarmult_vartime(ge25519_p3 *r, const unsigned char *a,
+                                      const ge25519_p3 *A, size_t n,
+                                      const unsigned char *b,
+                                      ge25519_cached *Ai, signed char *aslide);
+
 void ge25519_scalarmult(ge25519_p3 *h, const unsigned char *a,
                         const ge25519_p3 *p);
 
@@ -286,6 +286,54 @@ CARDANO_EXPORT cardano_error_t cardano_address_from_string(
   size_t              size,
   cardano_address_t** address);
 
+/**
+ * \brief Creates several Cardano addresses from their string representations in one call.
+ *
+ * Each string is parsed as by \ref cardano_address_from_string. The call either succeeds for every string or
+ * creates nothing: if any string fails to parse, the addresses already created are released, every entry of
+ * \p addresses is left NULL and the error of the failing string is returned.
+ *
+ * \param[in] strings An array of \p count pointers to the address strings.
+ * \param[in] sizes An array of \p count lengths, one per string, not including the null terminator.
+ * \param[in] count The number of strings to parse.
+ * \param[out] addresses An array of \p count pointers that receive the new address objects. The caller is
+ *                       responsible for releasing each of them with \ref cardano_address_unref.
+ * \param[out] failed_index Optional; if not NULL and parsing fails, receives the index of the failing string.
+ *
+ * \return \ref CARDANO_SUCCESS if every address was created, \ref CARDANO_ERROR_POINTER_IS_NULL if \p strings,
+ *         \p sizes or \p addresses is NULL, or the error returned by \ref cardano_address_from_string for the
+ *         first string that could not be parsed.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const char*        strings[2]   = { first_address, second_address };
+ * const size_t       sizes[2]     = { strlen(first_address), strlen(second_address) };
+ * cardano_address_t* addresses[2] = { NULL, NULL };
+ * size_t             failed_index = 0U;
+ *
+ * cardano_error_t result = cardano_address_from_strings(strings, sizes, 2U, addresses, &failed_index);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // Use the addresses
+ *
+ *   cardano_address_unref(&addresses[0]);
+ *   cardano_address_unref(&addresses[1]);
+ * }
+ * else
+ * {
+ *   printf("Failed to parse address %zu: %d\n", failed_index, result);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_address_from_strings(
+  const char* const*  strings,
+  const size_t*       sizes,
+  size_t              count,
+  cardano_address_t** addresses,
+  size_t*             failed_index);
+
 /**
  * \brief Retrieves the size needed for the string representation of a Cardano address.
  *
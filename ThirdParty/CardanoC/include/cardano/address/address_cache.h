@@ -0,0 +1,156 @@
+/**
+ * \file address_cache.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_ADDRESS_CACHE_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_ADDRESS_CACHE_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/address/address.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/typedefs.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Default number of addresses kept by the address cache.
+ */
+#define CARDANO_ADDRESS_CACHE_DEFAULT_CAPACITY 64U
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Enables the global address cache.
+ *
+ * While the cache is enabled, \ref cardano_address_intern_from_string and \ref cardano_address_intern_from_bytes
+ * hand out shared instances for addresses they have already seen, instead of decoding them again. Loading a large
+ * UTxO set whose outputs share a few addresses then decodes each address once and keeps a single copy of it in
+ * memory. When the cache is full, the least recently used address is dropped.
+ *
+ * Calling this function while the cache is already enabled empties it and applies the new capacity.
+ *
+ * \warning The cache is global state. Like \ref cardano_set_allocators, it is not thread-safe: it must not be used
+ * from several threads at the same time.
+ *
+ * \param[in] capacity The maximum number of addresses to keep, or zero to use
+ *                     \ref CARDANO_ADDRESS_CACHE_DEFAULT_CAPACITY.
+ *
+ * \return \ref CARDANO_SUCCESS if the cache was enabled, \ref CARDANO_ERROR_ILLEGAL_STATE if an arena scope is
+ *         active on the calling thread, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the table could not be
+ *         allocated.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_address_cache_enable(size_t capacity);
+
+/**
+ * \brief Disables the global address cache and releases the cache's references to the addresses it holds.
+ *
+ * Addresses handed out earlier stay valid for as long as their callers hold a reference to them.
+ */
+CARDANO_EXPORT void cardano_address_cache_disable(void);
+
+/**
+ * \brief Removes every address from the global address cache, keeping it enabled.
+ */
+CARDANO_EXPORT void cardano_address_cache_clear(void);
+
+/**
+ * \brief Tells whether the global address cache is enabled.
+ *
+ * \return true if the cache is enabled, false otherwise.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_address_cache_is_enabled(void);
+
+/**
+ * \brief Gets the number of addresses currently held by the global address cache.
+ *
+ * \return The number of cached addresses, or zero if the cache is disabled.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_address_cache_get_size(void);
+
+/**
+ * \brief Gets a shared address instance for a string, decoding it only if it is not cached yet.
+ *
+ * Behaves like \ref cardano_address_from_string, except that the returned object may be shared with other callers.
+ * Addresses have no setters, so sharing them is safe. If the cache is disabled, or an arena scope is active on the
+ * calling thread, the string is always decoded and the result is not cached.
+ *
+ * \param[in] data A pointer to the string representation of the address, in bech32 or base58.
+ * \param[in] size The length of the string, not including the null terminator.
+ * \param[out] address On success, a new reference to the address. The caller must release it with
+ *                     \ref cardano_address_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error returned by \ref cardano_address_from_string.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_error_t result = cardano_address_cache_enable(0U);
+ *
+ * for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < row_count); ++i)
+ * {
+ *   cardano_address_t* address = NULL;
+ *
+ *   result = cardano_address_intern_from_string(rows[i].address, strlen(rows[i].address), &address);
+ *
+ *   // Use the address
+ *
+ *   cardano_address_unref(&address);
+ * }
+ *
+ * cardano_address_cache_disable();
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_address_intern_from_string(
+  const char*         data,
+  size_t              size,
+  cardano_address_t** address);
+
+/**
+ * \brief Gets a shared address instance for its raw bytes, decoding them only if they are not cached yet.
+ *
+ * Behaves like \ref cardano_address_from_bytes, with the same sharing rules as \ref cardano_address_intern_from_string.
+ *
+ * \param[in] data A pointer to the raw address bytes.
+ * \param[in] size The number of bytes.
+ * \param[out] address On success, a new reference to the address. The caller must release it with
+ *                     \ref cardano_address_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error returned by \ref cardano_address_from_bytes.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_address_intern_from_bytes(
+  const byte_t*       data,
+  size_t              size,
+  cardano_address_t** address);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_ADDRESS_CACHE_H
@@ -0,0 +1,209 @@
+/**
+ * \file address_factory.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_ADDRESS_FACTORY_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_ADDRESS_FACTORY_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/common/credential.h>
+#include <cardano/common/credential_type.h>
+#include <cardano/common/network_id.h>
+#include <cardano/crypto/ed25519_public_key.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief The kinds of Shelley address the address factory creates.
+ *
+ * Whether an address has key or script credentials comes from its credentials, so one kind covers, for example, all
+ * four types of base address.
+ */
+typedef enum
+{
+  /**
+   * \brief A payment credential and a stake credential.
+   */
+  CARDANO_ADDRESS_FACTORY_KIND_BASE = 0,
+
+  /**
+   * \brief A payment credential only.
+   */
+  CARDANO_ADDRESS_FACTORY_KIND_ENTERPRISE = 1,
+
+  /**
+   * \brief A stake credential only.
+   */
+  CARDANO_ADDRESS_FACTORY_KIND_REWARD = 2
+} cardano_address_factory_kind_t;
+
+/**
+ * \brief Gets the size of the buffer slot each address takes in the output of the address factory.
+ *
+ * Every address of a given kind and network has the same bech32 length, so the factory writes address \c i at offset
+ * <tt>i * size</tt> of its output buffer, null terminated.
+ *
+ * \param[in] kind The kind of address.
+ * \param[in] network_id The network the addresses are for.
+ *
+ * \return The length of one bech32 address, including its null terminator, or zero if \p kind is not valid.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_address_factory_get_string_size(
+  cardano_address_factory_kind_t kind,
+  cardano_network_id_t           network_id);
+
+/**
+ * \brief Creates the bech32 strings of many addresses from their raw credential hashes.
+ *
+ * Each address is built in a stack buffer and encoded straight into \p output, so no object or heap memory is
+ * allocated. For a reward address, \p hashes holds the stake credentials.
+ *
+ * \param[in] kind The kind of address to create.
+ * \param[in] network_id The network the addresses are for.
+ * \param[in] hashes \p count Blake2b-224 hashes of 28 bytes each, back to back.
+ * \param[in] type The type of the credentials in \p hashes.
+ * \param[in] count The number of addresses to create.
+ * \param[in] stake_hashes The stake credential hashes of base addresses, back to back; NULL for other kinds.
+ * \param[in] stake_type The type of the credentials in \p stake_hashes.
+ * \param[in] stake_count The number of hashes in \p stake_hashes: \p count, or 1 for addresses that share one stake
+ *                        credential. Must be zero for other kinds than base.
+ * \param[out] output The buffer the addresses are written to, one slot of
+ *                    \ref cardano_address_factory_get_string_size bytes each.
+ * \param[in] output_size The size of \p output, at least \p count slots.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if a required pointer is NULL,
+ *         \ref CARDANO_ERROR_INVALID_ARGUMENT if \p kind or \p stake_count is not valid, or
+ *         \ref CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE if \p output is too small. Nothing is written on failure.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const size_t slot_size = cardano_address_factory_get_string_size(CARDANO_ADDRESS_FACTORY_KIND_ENTERPRISE, CARDANO_NETWORK_ID_TEST_NET);
+ * char*        addresses = (char*)malloc(slot_size * count);
+ *
+ * cardano_error_t result = cardano_address_factory_from_hashes(
+ *   CARDANO_ADDRESS_FACTORY_KIND_ENTERPRISE,
+ *   CARDANO_NETWORK_ID_TEST_NET,
+ *   script_hashes,
+ *   CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH,
+ *   count,
+ *   NULL,
+ *   CARDANO_CREDENTIAL_TYPE_KEY_HASH,
+ *   0U,
+ *   addresses,
+ *   slot_size * count);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   printf("First address: %s\n", addresses);
+ * }
+ *
+ * free(addresses);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_address_factory_from_hashes(
+  cardano_address_factory_kind_t kind,
+  cardano_network_id_t           network_id,
+  const byte_t*                  hashes,
+  cardano_credential_type_t      type,
+  size_t                         count,
+  const byte_t*                  stake_hashes,
+  cardano_credential_type_t      stake_type,
+  size_t                         stake_count,
+  char*                          output,
+  size_t                         output_size);
+
+/**
+ * \brief Creates the bech32 strings of many addresses from credential objects.
+ *
+ * Behaves like \ref cardano_address_factory_from_hashes, except that every credential brings its own type, so key
+ * and script credentials may be mixed.
+ *
+ * \param[in] kind The kind of address to create.
+ * \param[in] network_id The network the addresses are for.
+ * \param[in] credentials \p count credentials: the payment credentials, or the stake credentials of reward addresses.
+ * \param[in] count The number of addresses to create.
+ * \param[in] stake_credentials The stake credentials of base addresses; NULL for other kinds.
+ * \param[in] stake_count The number of entries in \p stake_credentials: \p count, 1, or zero for other kinds than base.
+ * \param[out] output The buffer the addresses are written to, one slot of
+ *                    \ref cardano_address_factory_get_string_size bytes each.
+ * \param[in] output_size The size of \p output, at least \p count slots.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the errors of \ref cardano_address_factory_from_hashes. Nothing is
+ *         written on failure.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_address_factory_from_credentials(
+  cardano_address_factory_kind_t     kind,
+  cardano_network_id_t               network_id,
+  const cardano_credential_t* const* credentials,
+  size_t                             count,
+  const cardano_credential_t* const* stake_credentials,
+  size_t                             stake_count,
+  char*                              output,
+  size_t                             output_size);
+
+/**
+ * \brief Creates the bech32 strings of many key addresses from Ed25519 public keys.
+ *
+ * The keys are hashed into a fixed stack buffer, a batch at a time, with the multi-buffer Blake2b of libsodium; no
+ * credential, hash or address object is created. A shared stake key is hashed only once.
+ *
+ * \param[in] kind The kind of address to create.
+ * \param[in] network_id The network the addresses are for.
+ * \param[in] keys \p count public keys: the payment keys, or the stake keys of reward addresses.
+ * \param[in] count The number of addresses to create.
+ * \param[in] stake_keys The stake keys of base addresses; NULL for other kinds.
+ * \param[in] stake_count The number of entries in \p stake_keys: \p count, 1, or zero for other kinds than base.
+ * \param[out] key_hashes If not NULL, receives the 28-byte hashes of \p keys, back to back, such as to index the
+ *                        payment keys of the addresses.
+ * \param[out] output The buffer the addresses are written to, one slot of
+ *                    \ref cardano_address_factory_get_string_size bytes each.
+ * \param[in] output_size The size of \p output, at least \p count slots.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_GENERIC if the keys could not be hashed, or the errors
+ *         of \ref cardano_address_factory_from_hashes. \p output may be partly written on failure.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_address_factory_from_keys(
+  cardano_address_factory_kind_t             kind,
+  cardano_network_id_t                       network_id,
+  const cardano_ed25519_public_key_t* const* keys,
+  size_t                                     count,
+  const cardano_ed25519_public_key_t* const* stake_keys,
+  size_t                                     stake_count,
+  byte_t*                                    key_hashes,
+  char*                                      output,
+  size_t                                     output_size);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_ADDRESS_FACTORY_H
@@ -0,0 +1,180 @@
+/**
+ * \file allocation_stats.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_ALLOCATION_STATS_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_ALLOCATION_STATS_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief The library subsystem a heap allocation is attributed to.
+ *
+ * Allocations are attributed to the subsystem whose source file requested them: a transaction decoded from CBOR is
+ * counted under the types that hold it, while the scratch memory of the CBOR reader itself is counted under
+ * \ref CARDANO_ALLOCATION_TAG_CBOR.
+ */
+typedef enum
+{
+  /**
+   * \brief Everything not covered by another tag (addresses, certificates, scripts, witnesses, ...).
+   */
+  CARDANO_ALLOCATION_TAG_OTHER = 0,
+
+  /**
+   * \brief The CBOR reader and writer.
+   */
+  CARDANO_ALLOCATION_TAG_CBOR = 1,
+
+  /**
+   * \brief The JSON reader, writer and object model.
+   */
+  CARDANO_ALLOCATION_TAG_JSON = 2,
+
+  /**
+   * \brief Keys, hashes, signatures and the key handlers.
+   */
+  CARDANO_ALLOCATION_TAG_CRYPTO = 3,
+
+  /**
+   * \brief The transaction builder, including balancing, coin selection and evaluation.
+   */
+  CARDANO_ALLOCATION_TAG_BUILDER = 4,
+
+  /**
+   * \brief The arrays and sets backing every list, set and map type.
+   */
+  CARDANO_ALLOCATION_TAG_COLLECTIONS = 5,
+
+  /**
+   * \brief Byte buffers, such as the output of the CBOR writer.
+   */
+  CARDANO_ALLOCATION_TAG_BUFFER = 6,
+
+  /**
+   * \brief The number of tags; not a valid tag.
+   */
+  CARDANO_ALLOCATION_TAG_COUNT = 7
+} cardano_allocation_tag_t;
+
+/**
+ * \brief Allocation counters of one tag.
+ */
+typedef struct cardano_allocation_stats_t
+{
+    /**
+     * \brief Allocations made since the counters were last reset, reallocations not included.
+     */
+    uint64_t allocation_count;
+
+    /**
+     * \brief Bytes requested since the counters were last reset, including the growth of reallocations.
+     */
+    uint64_t allocated_bytes;
+
+    /**
+     * \brief Allocations currently alive.
+     */
+    uint64_t live_count;
+
+    /**
+     * \brief Bytes currently alive.
+     */
+    uint64_t live_bytes;
+
+    /**
+     * \brief The highest value `live_bytes` reached since the counters were last reset.
+     */
+    uint64_t peak_bytes;
+} cardano_allocation_stats_t;
+
+/**
+ * \brief Tells whether the library was built with allocation tracking.
+ *
+ * Tracking is a build option (`LIB_CARDANO_C_ALLOCATION_TRACKING`), off by default, because it stores a small header
+ * in front of every heap allocation. Memory served by an arena (see \ref cardano_arena_begin) is not tracked; use
+ * \ref cardano_arena_get_used_size for it.
+ *
+ * \return \c true if the allocation counters are maintained, \c false otherwise.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_allocation_tracking_is_enabled(void);
+
+/**
+ * \brief Reads the allocation counters of a tag.
+ *
+ * The counters are updated atomically, but are read one by one, so a snapshot taken while other threads allocate may
+ * be slightly inconsistent.
+ *
+ * \param[in] tag The tag to read.
+ * \param[out] stats On success, the counters of the tag. Zeroed if tracking is disabled.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if `stats` is NULL,
+ *         \ref CARDANO_ERROR_INVALID_ARGUMENT if `tag` is out of range, or \ref CARDANO_ERROR_NOT_IMPLEMENTED if the
+ *         library was built without allocation tracking.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_allocation_stats_t stats = { 0 };
+ *
+ * cardano_allocation_stats_reset();
+ * ... // Build a transaction
+ *
+ * if (cardano_allocation_stats_get(CARDANO_ALLOCATION_TAG_BUILDER, &stats) == CARDANO_SUCCESS)
+ * {
+ *   printf("builder: %llu allocations, peak %llu bytes\n", stats.allocation_count, stats.peak_bytes);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_allocation_stats_get(cardano_allocation_tag_t tag, cardano_allocation_stats_t* stats);
+
+/**
+ * \brief Resets the cumulative counters of every tag and brings each peak down to the bytes currently alive.
+ *
+ * Live counts and bytes are not affected. Does nothing if tracking is disabled.
+ */
+CARDANO_EXPORT void cardano_allocation_stats_reset(void);
+
+/**
+ * \brief Converts an allocation tag to its name, e.g. "cbor".
+ *
+ * \param[in] tag The tag.
+ *
+ * \return The name of the tag, or "unknown" if `tag` is out of range.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_allocation_tag_to_string(cardano_allocation_tag_t tag);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_ALLOCATION_STATS_H
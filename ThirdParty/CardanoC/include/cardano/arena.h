@@ -0,0 +1,163 @@
+/**
+ * \file arena.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_ARENA_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_ARENA_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/typedefs.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Default size in bytes of the blocks an arena reserves from the heap.
+ */
+#define CARDANO_ARENA_DEFAULT_BLOCK_SIZE (64U * 1024U)
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief A bump allocator that serves every libcardano-c allocation made while it is active.
+ *
+ * Building or decoding a transaction creates hundreds of small reference counted objects. Inside an arena scope those
+ * objects are carved out of a few large blocks and released all at once when the scope ends, instead of going through
+ * the heap one by one.
+ *
+ * The arena is not a reference counted object: it is created with \ref cardano_arena_new and released with
+ * \ref cardano_arena_free.
+ */
+typedef struct cardano_arena_t cardano_arena_t;
+
+/**
+ * \brief Creates a new arena.
+ *
+ * No memory is reserved until the arena is first used.
+ *
+ * \param[in] block_size The size in bytes of the blocks the arena reserves from the heap, or zero to use
+ *                       \ref CARDANO_ARENA_DEFAULT_BLOCK_SIZE. Allocations larger than a block get a block of their own.
+ * \param[out] arena On success, the new arena. It must be released with \ref cardano_arena_free.
+ *
+ * \return \ref CARDANO_SUCCESS if the arena was created, \ref CARDANO_ERROR_POINTER_IS_NULL if `arena` is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the arena could not be allocated.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_arena_new(size_t block_size, cardano_arena_t** arena);
+
+/**
+ * \brief Makes the arena the allocator of the calling thread.
+ *
+ * Until \ref cardano_arena_end is called, every allocation libcardano-c makes on this thread is served by the arena,
+ * and freeing memory that came from the arena does nothing. Memory allocated before the scope began is still
+ * returned to the heap when freed inside it. Other threads are not affected.
+ *
+ * Scopes can be nested with different arenas; ending the inner one makes the outer one active again. Memory from
+ * an outer arena may be freed or resized inside an inner scope: it stays in the outer arena, and is released when
+ * that arena's scope ends.
+ *
+ * \param[in] arena The arena to activate.
+ *
+ * \return \ref CARDANO_SUCCESS if the scope began, \ref CARDANO_ERROR_POINTER_IS_NULL if `arena` is NULL, or
+ *         \ref CARDANO_ERROR_ILLEGAL_STATE if the arena is already in use.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_arena_t* arena = NULL;
+ *
+ * if (cardano_arena_new(0U, &arena) != CARDANO_SUCCESS)
+ * {
+ *   return;
+ * }
+ *
+ * for (size_t i = 0U; i < tx_count; ++i)
+ * {
+ *   cardano_cbor_reader_t* reader = NULL;
+ *   cardano_transaction_t* tx     = NULL;
+ *
+ *   if (cardano_arena_begin(arena) != CARDANO_SUCCESS)
+ *   {
+ *     break;
+ *   }
+ *
+ *   reader = cardano_cbor_reader_new(tx_bytes[i], tx_sizes[i]);
+ *
+ *   if (cardano_transaction_from_cbor(reader, &tx) == CARDANO_SUCCESS)
+ *   {
+ *     process_transaction(tx);
+ *   }
+ *
+ *   // No need to unref reader or tx: ending the scope releases them.
+ *   cardano_arena_end(arena);
+ * }
+ *
+ * cardano_arena_free(&arena);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_arena_begin(cardano_arena_t* arena);
+
+/**
+ * \brief Ends the arena scope of the calling thread and releases everything allocated inside it.
+ *
+ * Every object created inside the scope is gone once this function returns, whatever its reference count. They must
+ * not be used, referenced from objects that outlive the scope, or unreferenced afterwards. Anything that has to
+ * survive the scope must be created outside of it, or copied out as plain data (for instance with `*_to_cbor`) into
+ * caller-owned memory.
+ *
+ * The blocks of the arena are kept so the next scope can reuse them without touching the heap.
+ *
+ * \param[in] arena The arena to deactivate; it must be the innermost active arena of the calling thread.
+ *
+ * \return \ref CARDANO_SUCCESS if the scope ended, \ref CARDANO_ERROR_POINTER_IS_NULL if `arena` is NULL, or
+ *         \ref CARDANO_ERROR_ILLEGAL_STATE if `arena` is not the innermost active arena of the calling thread.
+ */
+CARDANO_EXPORT cardano_error_t cardano_arena_end(cardano_arena_t* arena);
+
+/**
+ * \brief Gets the number of bytes currently handed out by the arena, including per-allocation bookkeeping.
+ *
+ * \param[in] arena The arena to query.
+ *
+ * \return The number of bytes in use, or zero if `arena` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_arena_get_used_size(const cardano_arena_t* arena);
+
+/**
+ * \brief Releases an arena and all the blocks it holds.
+ *
+ * The arena must not be active on any thread. After the call `*arena` is set to NULL.
+ *
+ * \param[in,out] arena A pointer to the arena to release.
+ */
+CARDANO_EXPORT void cardano_arena_free(cardano_arena_t** arena);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_ARENA_H
@@ -150,6 +150,34 @@ CARDANO_EXPORT size_t cardano_asset_id_list_get_length(const cardano_asset_id_li
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_asset_id_list_get(const cardano_asset_id_list_t* asset_id_list, size_t index, cardano_asset_id_t** element);
 
+/**
+ * \brief Retrieves an element from a asset id list by index, without taking a reference to it.
+ *
+ * This function behaves like \ref cardano_asset_id_list_get, but leaves the reference count of the element untouched. It is
+ * meant for loops that only read the elements, which would otherwise pay for a ref/unref pair per element.
+ *
+ * \param[in] asset_id_list A constant pointer to the \ref cardano_asset_id_list_t object from which the element is to be retrieved.
+ * \param[in] index The index of the element to retrieve. Indexing starts at 0.
+ *
+ * \return A borrowed pointer to the element, or NULL if `asset_id_list` is NULL or `index` is out of bounds. The element is
+ *         owned by the asset id list and is only valid while it remains in it; the caller must not call
+ *         \ref cardano_asset_id_unref on it.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const size_t length = cardano_asset_id_list_get_length(asset_id_list);
+ *
+ * for (size_t i = 0U; i < length; ++i)
+ * {
+ *   cardano_asset_id_t* asset_id = cardano_asset_id_list_peek(asset_id_list, i);
+ *
+ *   // Read the element, no need to unref it
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_asset_id_t* cardano_asset_id_list_peek(const cardano_asset_id_list_t* asset_id_list, size_t index);
+
 /**
  * \brief Adds an element to a asset id list.
  *
@@ -101,6 +101,18 @@ cardano_asset_id_map_new(cardano_asset_id_map_t** asset_id_map);
 CARDANO_NODISCARD
 CARDANO_EXPORT size_t cardano_asset_id_map_get_length(const cardano_asset_id_map_t* asset_id_map);
 
+/**
+ * \brief Makes room for a number of asset ids, so that adding that many does not reallocate the map.
+ *
+ * \param[in] asset_id_map The map.
+ * \param[in] capacity The number of asset ids the map must hold without growing. The map never shrinks.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p asset_id_map is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED, in which case the map is left as it was.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_asset_id_map_reserve(cardano_asset_id_map_t* asset_id_map, size_t capacity);
+
 /**
  * \brief Retrieves the value associated with a given key in the asset id map.
  *
@@ -189,6 +189,18 @@ CARDANO_EXPORT cardano_error_t cardano_asset_name_map_to_cbor(
 CARDANO_NODISCARD
 CARDANO_EXPORT size_t cardano_asset_name_map_get_length(const cardano_asset_name_map_t* asset_name_map);
 
+/**
+ * \brief Makes room for a number of asset names, so that adding that many does not reallocate the map.
+ *
+ * \param[in] asset_name_map The map.
+ * \param[in] capacity The number of asset names the map must hold without growing. The map never shrinks.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p asset_name_map is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED, in which case the map is left as it was.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_asset_name_map_reserve(cardano_asset_name_map_t* asset_name_map, size_t capacity);
+
 /**
  * \brief Retrieves the value associated with a given key in the asset name map.
  *
@@ -510,6 +522,39 @@ CARDANO_EXPORT cardano_error_t cardano_asset_name_map_add(
   const cardano_asset_name_map_t* rhs,
   cardano_asset_name_map_t**      result);
 
+/**
+ * \brief Adds the quantities of an asset name map to another one, in place.
+ *
+ * This function has the same result as \ref cardano_asset_name_map_add, but accumulates into \p lhs instead of
+ * building a new map. Amounts of asset names already in \p lhs are updated where they are, so summing many maps with
+ * the same assets allocates nothing; only asset names new to \p lhs are allocated. Assets whose quantity becomes zero
+ * are removed.
+ *
+ * \param[in,out] lhs The map to add to. It must not be shared with other objects that do not expect it to change.
+ * \param[in] rhs The map whose quantities are added. It can be \p lhs itself, doubling every quantity.
+ *
+ * \return \ref CARDANO_SUCCESS if the quantities were added, \ref CARDANO_ERROR_POINTER_IS_NULL if any of the
+ *         pointers is NULL, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED. On failure \p lhs may hold part of
+ *         the sum.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_asset_name_map_t* total = NULL;
+ * cardano_error_t result = cardano_asset_name_map_new(&total);
+ *
+ * for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < count); ++i)
+ * {
+ *   result = cardano_asset_name_map_add_assign(total, maps[i]);
+ * }
+ *
+ * cardano_asset_name_map_unref(&total);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_asset_name_map_add_assign(
+  cardano_asset_name_map_t*       lhs,
+  const cardano_asset_name_map_t* rhs);
+
 /**
  * \brief Subtracts the quantities of assets under each asset name from one asset name map to another.
  *
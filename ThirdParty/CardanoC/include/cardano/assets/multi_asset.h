@@ -199,6 +199,18 @@ CARDANO_NODISCARD
 CARDANO_EXPORT size_t cardano_multi_asset_get_policy_count(
   const cardano_multi_asset_t* multi_asset);
 
+/**
+ * \brief Makes room for a number of policies, so that adding that many does not reallocate the multi-asset.
+ *
+ * \param[in] multi_asset The multi-asset.
+ * \param[in] capacity The number of policies the multi-asset must hold without growing. The multi-asset never shrinks.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p multi_asset is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED, in which case the multi-asset is left as it was.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_multi_asset_reserve(cardano_multi_asset_t* multi_asset, size_t capacity);
+
 /**
  * \brief Inserts assets under a specific policy ID into a multi-asset container.
  *
@@ -527,6 +539,56 @@ CARDANO_EXPORT cardano_error_t cardano_multi_asset_add(
   const cardano_multi_asset_t* rhs,
   cardano_multi_asset_t**      result);
 
+/**
+ * \brief Adds the assets of a multi-asset container to another one, in place.
+ *
+ * This function has the same result as \ref cardano_multi_asset_add, but accumulates into \p lhs instead of
+ * building a new container. Quantities of assets already in \p lhs are updated where they are, so summing many
+ * containers holding the same assets allocates nothing; only policies and asset names new to \p lhs are allocated.
+ * Assets whose quantity becomes zero, and policies left without assets, are removed.
+ *
+ * The asset name maps of \p lhs that are shared with other objects, for instance after
+ * \ref cardano_multi_asset_insert_assets, are copied before they are changed, so those objects are never affected.
+ *
+ * \param[in,out] lhs The multi-asset container to add to.
+ * \param[in] rhs The multi-asset container whose assets are added. It can be \p lhs itself.
+ *
+ * \return \ref CARDANO_SUCCESS if the assets were added, \ref CARDANO_ERROR_POINTER_IS_NULL if any of the
+ *         pointers is NULL, \ref CARDANO_ERROR_OBJECT_IS_FROZEN if \p lhs is frozen, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED. On failure \p lhs may hold part of the sum.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_multi_asset_t* total = NULL;
+ * cardano_error_t result = cardano_multi_asset_new(&total);
+ *
+ * for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < count); ++i)
+ * {
+ *   result = cardano_multi_asset_add_assign(total, multi_assets[i]);
+ * }
+ *
+ * cardano_multi_asset_unref(&total);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_multi_asset_add_assign(
+  cardano_multi_asset_t*       lhs,
+  const cardano_multi_asset_t* rhs);
+
+/**
+ * \brief Removes every policy from a multi-asset container.
+ *
+ * The container keeps the room it had for its policies, so it can be filled again, for instance with
+ * \ref cardano_multi_asset_add_assign, without growing.
+ *
+ * \param[in,out] multi_asset The multi-asset container to empty.
+ *
+ * \return \ref CARDANO_SUCCESS if the container was emptied, \ref CARDANO_ERROR_POINTER_IS_NULL if
+ *         \p multi_asset is NULL, or \ref CARDANO_ERROR_OBJECT_IS_FROZEN if it is frozen.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_multi_asset_clear(cardano_multi_asset_t* multi_asset);
+
 /**
  * \brief Subtracts the quantities of assets under each policy from one multi-asset container to another.
  *
@@ -0,0 +1,313 @@
+/**
+ * \file metadata_encoder.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_METADATA_ENCODER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_METADATA_ENCODER_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/buffer.h>
+#include <cardano/crypto/blake2b_hash.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Writes transaction metadata straight to auxiliary data CBOR.
+ *
+ * Building metadata with \ref cardano_metadatum_t allocates a reference counted object per node, which dominates the
+ * cost of large mint batches (CIP-25 and CIP-68 metadata for hundreds of assets). The encoder instead writes each
+ * value to its output as it is given, checking the structure as it goes: every map and list is declared with its
+ * size, and exactly that many items must be written before it is closed. Text and byte strings over 64 bytes are
+ * rejected, or split into a list of 64-byte chunks by the `_chunked` writers, following the metadata size rules.
+ * Labels must be written in ascending order, which is the order transaction metadata keeps them in.
+ *
+ * The output is the encoding of auxiliary data holding only the metadata, byte for byte what
+ * \ref cardano_auxiliary_data_to_cbor writes for the same content, together with its hash.
+ *
+ * \code{.c}
+ * cardano_metadata_encoder_t* encoder = NULL;
+ *
+ * cardano_error_t result = cardano_metadata_encoder_new(1U, &encoder);
+ *
+ * result = cardano_metadata_encoder_write_label(encoder, 721U);
+ * result = cardano_metadata_encoder_start_map(encoder, 1U);
+ * result = cardano_metadata_encoder_write_text(encoder, policy_id_hex, 56U);
+ * result = cardano_metadata_encoder_write_map_entries(encoder, asset_count, write_asset, assets);
+ * result = cardano_metadata_encoder_end_map(encoder);
+ *
+ * cardano_buffer_t*       auxiliary_data_cbor = NULL;
+ * cardano_blake2b_hash_t* hash                = NULL;
+ *
+ * result = cardano_metadata_encoder_finish(encoder, &auxiliary_data_cbor, &hash);
+ * \endcode
+ */
+typedef struct cardano_metadata_encoder_t cardano_metadata_encoder_t;
+
+/**
+ * \brief Writes one entry of a map: a key followed by a value.
+ *
+ * \param[in] context The context given to \ref cardano_metadata_encoder_write_map_entries.
+ * \param[in] index The index of the entry, from zero.
+ * \param[in] encoder The encoder to write the entry to.
+ *
+ * \return \ref CARDANO_SUCCESS if the entry was written; any other value stops the map and is returned to the caller.
+ */
+typedef cardano_error_t (*cardano_metadata_entry_writer_t)(void* context, size_t index, cardano_metadata_encoder_t* encoder);
+
+/**
+ * \brief Creates a metadata encoder.
+ *
+ * \param[in] label_count The number of metadata labels that will be written.
+ * \param[out] encoder On success, the new encoder.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p encoder is NULL, or
+ * \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_new(size_t label_count, cardano_metadata_encoder_t** encoder);
+
+/**
+ * \brief Starts the metadata of a label. Exactly one value must follow.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] label The metadata label (for instance 721 for CIP-25).
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_ILLEGAL_STATE if a label is not expected here or
+ * \p label is not greater than the previous label.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_write_label(cardano_metadata_encoder_t* encoder, uint64_t label);
+
+/**
+ * \brief Writes a signed integer.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] value The value.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_ILLEGAL_STATE if no value is expected here.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_write_int(cardano_metadata_encoder_t* encoder, int64_t value);
+
+/**
+ * \brief Writes an unsigned integer.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] value The value.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_ILLEGAL_STATE if no value is expected here.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_write_uint(cardano_metadata_encoder_t* encoder, uint64_t value);
+
+/**
+ * \brief Writes a text string of at most 64 bytes.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] text The UTF-8 text. It does not need to be NULL-terminated.
+ * \param[in] size The size of the text in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_METADATUM_TEXT_STRING_SIZE if the text is longer
+ * than 64 bytes, or \ref CARDANO_ERROR_ILLEGAL_STATE if no value is expected here.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_write_text(cardano_metadata_encoder_t* encoder, const char* text, size_t size);
+
+/**
+ * \brief Writes a text string of any length, as a list of chunks of at most 64 bytes if it does not fit in one.
+ *
+ * Chunks are cut on UTF-8 character boundaries, which is how CIP-25 expects long values such as image URIs. Text of
+ * up to 64 bytes is written as a plain string, exactly like \ref cardano_metadata_encoder_write_text.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] text The UTF-8 text. It does not need to be NULL-terminated.
+ * \param[in] size The size of the text in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_ILLEGAL_STATE if no value is expected here.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_write_text_chunked(cardano_metadata_encoder_t* encoder, const char* text, size_t size);
+
+/**
+ * \brief Writes a byte string of at most 64 bytes.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] data The bytes. May be NULL if \p size is zero.
+ * \param[in] size The number of bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_METADATUM_BOUNDED_BYTES_SIZE if there are more
+ * than 64 bytes, or \ref CARDANO_ERROR_ILLEGAL_STATE if no value is expected here.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_write_bytes(cardano_metadata_encoder_t* encoder, const byte_t* data, size_t size);
+
+/**
+ * \brief Writes a byte string of any length, as a list of chunks of at most 64 bytes if it does not fit in one.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] data The bytes. May be NULL if \p size is zero.
+ * \param[in] size The number of bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_ILLEGAL_STATE if no value is expected here.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_write_bytes_chunked(cardano_metadata_encoder_t* encoder, const byte_t* data, size_t size);
+
+/**
+ * \brief Starts a map of \p size entries. Each entry is a key followed by a value.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] size The number of entries.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_ILLEGAL_STATE if no value is expected here or the
+ * maps and lists are nested too deeply.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_start_map(cardano_metadata_encoder_t* encoder, size_t size);
+
+/**
+ * \brief Closes the map started last.
+ *
+ * \param[in] encoder The encoder.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_ILLEGAL_STATE if the innermost container is not a
+ * map or has not received all its entries.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_end_map(cardano_metadata_encoder_t* encoder);
+
+/**
+ * \brief Starts a list of \p size values.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] size The number of values.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_ILLEGAL_STATE if no value is expected here or the
+ * maps and lists are nested too deeply.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_start_list(cardano_metadata_encoder_t* encoder, size_t size);
+
+/**
+ * \brief Closes the list started last.
+ *
+ * \param[in] encoder The encoder.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_ILLEGAL_STATE if the innermost container is not a
+ * list or has not received all its values.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_end_list(cardano_metadata_encoder_t* encoder);
+
+/**
+ * \brief Writes a map of \p count entries produced by a callback, one call per entry.
+ *
+ * This is the usual way to write a batch of records, such as the assets of a policy in CIP-25 metadata: no record
+ * needs to be held in memory beyond its own call. Each call must write exactly one key and one value.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] count The number of entries.
+ * \param[in] entry_writer The callback writing each entry.
+ * \param[in] context An opaque pointer passed to the callback.
+ *
+ * \return \ref CARDANO_SUCCESS on success, the first error returned by the callback, or
+ * \ref CARDANO_ERROR_ILLEGAL_STATE if a call did not write exactly one entry.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_write_map_entries(
+  cardano_metadata_encoder_t*     encoder,
+  size_t                          count,
+  cardano_metadata_entry_writer_t entry_writer,
+  void*                           context);
+
+/**
+ * \brief Completes the metadata and returns the auxiliary data encoding and its hash.
+ *
+ * The encoder cannot be written to afterwards. The encoding can be attached to a transaction with
+ * \ref cardano_transaction_set_auxiliary_data_cbor, and the hash is the auxiliary data hash of its body.
+ *
+ * \param[in] encoder The encoder.
+ * \param[out] auxiliary_data_cbor On success, the encoded auxiliary data.
+ * \param[out] hash On success, the BLAKE2b-256 hash of the encoding. May be NULL if the hash is not needed.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p encoder or
+ * \p auxiliary_data_cbor is NULL, or \ref CARDANO_ERROR_ILLEGAL_STATE if labels, maps or lists are incomplete.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadata_encoder_finish(
+  cardano_metadata_encoder_t* encoder,
+  cardano_buffer_t**          auxiliary_data_cbor,
+  cardano_blake2b_hash_t**    hash);
+
+/**
+ * \brief Decrements the reference count of a metadata encoder, freeing it when it reaches zero.
+ *
+ * \param[in,out] encoder A pointer to the encoder pointer, set to NULL when the encoder is freed.
+ */
+CARDANO_EXPORT void cardano_metadata_encoder_unref(cardano_metadata_encoder_t** encoder);
+
+/**
+ * \brief Increments the reference count of a metadata encoder.
+ *
+ * \param[in] encoder The encoder.
+ */
+CARDANO_EXPORT void cardano_metadata_encoder_ref(cardano_metadata_encoder_t* encoder);
+
+/**
+ * \brief Retrieves the reference count of a metadata encoder.
+ *
+ * \param[in] encoder The encoder.
+ *
+ * \return The reference count, or zero if \p encoder is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_metadata_encoder_refcount(const cardano_metadata_encoder_t* encoder);
+
+/**
+ * \brief Records an error message on a metadata encoder.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] message The message, truncated to 1023 characters. NULL clears the message.
+ */
+CARDANO_EXPORT void cardano_metadata_encoder_set_last_error(cardano_metadata_encoder_t* encoder, const char* message);
+
+/**
+ * \brief Retrieves the last error message recorded on a metadata encoder.
+ *
+ * \param[in] encoder The encoder.
+ *
+ * \return The message, or an empty string if none was recorded. NULL if \p encoder is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_metadata_encoder_get_last_error(const cardano_metadata_encoder_t* encoder);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_METADATA_ENCODER_H
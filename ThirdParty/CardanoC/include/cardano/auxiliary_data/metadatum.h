@@ -31,6 +31,7 @@
 #include <cardano/common/bigint.h>
 #include <cardano/error.h>
 #include <cardano/export.h>
+#include <cardano/json/json_writer.h>
 #include <cardano/typedefs.h>
 
 /* DECLARATIONS **************************************************************/
@@ -646,6 +647,48 @@ CARDANO_EXPORT cardano_error_t cardano_metadatum_to_json(
   char*                json,
   size_t               json_size);
 
+/**
+ * \brief Writes the JSON representation of a metadatum into an existing JSON writer.
+ *
+ * Unlike \ref cardano_metadatum_to_json, which creates a writer per call, this lets a single writer be reused across
+ * many documents: call \ref cardano_json_writer_reset between them, and the writer keeps the memory it has already
+ * grown to. Before writing, the size of the document is computed and reserved in the writer, so the writer does not
+ * reallocate while the metadatum is written.
+ *
+ * \param[in] metadatum The metadatum to write. Byte strings and maps with non-text keys cannot be written.
+ * \param[in] writer The JSON writer, positioned where a value is expected.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL,
+ *         \ref CARDANO_ERROR_INVALID_METADATUM_CONVERSION if the metadatum has no JSON representation, or another error
+ *         code on failure. Errors raised by the writer itself are reported by \ref cardano_json_writer_encode.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_json_writer_t* writer = cardano_json_writer_new(CARDANO_JSON_FORMAT_COMPACT);
+ *
+ * for (size_t i = 0U; i < nft_count; ++i)
+ * {
+ *   cardano_error_t result = cardano_json_writer_reset(writer);
+ *
+ *   if (result == CARDANO_SUCCESS)
+ *   {
+ *     result = cardano_metadatum_write_json(nft_metadata[i], writer);
+ *   }
+ *
+ *   if (result == CARDANO_SUCCESS)
+ *   {
+ *     result = cardano_json_writer_encode(writer, json, json_capacity);
+ *   }
+ *
+ *   // Use json
+ * }
+ *
+ * cardano_json_writer_unref(&writer);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadatum_write_json(cardano_metadatum_t* metadatum, cardano_json_writer_t* writer);
+
 /**
  * \brief Serializes a metadatum into CBOR format using a CBOR writer.
  *
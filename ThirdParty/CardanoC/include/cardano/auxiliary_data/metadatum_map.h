@@ -379,6 +379,44 @@ CARDANO_EXPORT cardano_error_t cardano_metadatum_map_get_keys(cardano_metadatum_
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_metadatum_map_get_values(cardano_metadatum_map_t* metadatum_map, cardano_metadatum_list_t** values);
 
+/**
+ * \brief Retrieves the key and value at the specified index of a metadatum map.
+ *
+ * Unlike \ref cardano_metadatum_map_get_keys and \ref cardano_metadatum_map_get_values, this does not build new
+ * lists, which makes it the cheap way to walk every entry of a map.
+ *
+ * \param[in]  metadatum_map Pointer to the metadatum map.
+ * \param[in]  index         The index of the entry, in insertion order.
+ * \param[out] key           On success, the key at \p index. The caller must release it with \ref cardano_metadatum_unref.
+ * \param[out] value         On success, the value at \p index. The caller must release it with \ref cardano_metadatum_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any pointer is NULL, or
+ *         \ref CARDANO_ERROR_INDEX_OUT_OF_BOUNDS if \p index is not less than the length of the map.
+ *
+ * Usage Example:
+ * \code{.c}
+ * for (size_t i = 0U; i < cardano_metadatum_map_get_length(metadatum_map); ++i)
+ * {
+ *   cardano_metadatum_t* key   = NULL;
+ *   cardano_metadatum_t* value = NULL;
+ *
+ *   if (cardano_metadatum_map_get_key_value_at(metadatum_map, i, &key, &value) == CARDANO_SUCCESS)
+ *   {
+ *     // Use the key and the value
+ *
+ *     cardano_metadatum_unref(&key);
+ *     cardano_metadatum_unref(&value);
+ *   }
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_metadatum_map_get_key_value_at(
+  const cardano_metadatum_map_t* metadatum_map,
+  size_t                         index,
+  cardano_metadatum_t**          key,
+  cardano_metadatum_t**          value);
+
 /**
  * \brief Checks if two metadatum maps are equal.
  *
@@ -34,6 +34,88 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/**
+ * \brief The number of words of every BIP-39 wordlist.
+ */
+#define CARDANO_BIP39_WORDLIST_SIZE 2048U
+
+/**
+ * \brief A BIP-39 wordlist, indexed for lookups.
+ *
+ * The English wordlist is built into the library and used whenever a function of this header is given a NULL
+ * wordlist. The other languages of the BIP-39 specification (Japanese, Spanish, Chinese, French, Italian, Korean,
+ * Czech and Portuguese) are not embedded; applications load the list they need and create a wordlist from it once.
+ *
+ * Creating a wordlist copies and sorts its words, so looking up a word afterwards is a binary search of at most 11
+ * comparisons rather than a scan of the whole list.
+ */
+typedef struct cardano_bip39_wordlist_t cardano_bip39_wordlist_t;
+
+/**
+ * \brief Creates a BIP-39 wordlist from its 2048 words.
+ *
+ * \param[in] words The words, in the order of the BIP-39 specification for their language, as NFKD-normalized UTF-8
+ *                  strings. The strings are copied and need not outlive the call.
+ * \param[in] word_count The number of words. Must be \ref CARDANO_BIP39_WORDLIST_SIZE.
+ * \param[out] wordlist On success, the new wordlist. Release it with \ref cardano_bip39_wordlist_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if an argument or a word is NULL,
+ * \ref CARDANO_ERROR_INVALID_ARGUMENT if there are not 2048 words, one of them is empty or longer than 64 bytes, or
+ * two of them are the same, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ *
+ * \note Mnemonics are compared byte for byte, so they must be normalized to NFKD like the words of the list.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const char*               spanish[CARDANO_BIP39_WORDLIST_SIZE] = { ... }; // Loaded by the application
+ * cardano_bip39_wordlist_t* wordlist = NULL;
+ *
+ * cardano_error_t result = cardano_bip39_wordlist_new(spanish, CARDANO_BIP39_WORDLIST_SIZE, &wordlist);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   const char* words[24]  = { 0 };
+ *   size_t      word_count = 0U;
+ *
+ *   result = cardano_bip39_entropy_to_mnemonic_words_ex(wordlist, entropy, sizeof(entropy), words, &word_count);
+ * }
+ *
+ * cardano_bip39_wordlist_unref(&wordlist);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_bip39_wordlist_new(
+  const char* const*         words,
+  size_t                     word_count,
+  cardano_bip39_wordlist_t** wordlist);
+
+/**
+ * \brief Gets a word of a wordlist by its index.
+ *
+ * \param[in] wordlist The wordlist, or NULL for the English one.
+ * \param[in] index The index of the word, below \ref CARDANO_BIP39_WORDLIST_SIZE.
+ *
+ * \return The word, owned by the wordlist, or NULL if \p index is out of range.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_bip39_wordlist_get_word(const cardano_bip39_wordlist_t* wordlist, size_t index);
+
+/**
+ * \brief Finds the index of a word in a wordlist.
+ *
+ * \param[in] wordlist The wordlist, or NULL for the English one.
+ * \param[in] word The word to find, compared byte for byte.
+ * \param[out] index On success, the index of the word, as used in the mnemonic encoding.
+ *
+ * \return \ref CARDANO_SUCCESS if the word was found, \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if it is not in the
+ * wordlist, or \ref CARDANO_ERROR_POINTER_IS_NULL if \p word or \p index is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_bip39_wordlist_find(
+  const cardano_bip39_wordlist_t* wordlist,
+  const char*                     word,
+  size_t*                         index);
+
 /**
  * \brief Converts entropy into a BIP-39 mnemonic word sequence.
  *
@@ -59,7 +141,7 @@ extern "C" {
  * reason for failure.
  *
  * \note
- * - This function only supports the **English BIP-39 wordlist**.
+ * - This function uses the **English BIP-39 wordlist**; see \ref cardano_bip39_entropy_to_mnemonic_words_ex for others.
  * - The function does not allocate memory for the words; it simply assigns pointers
  *   to statically allocated strings from the preloaded English wordlist.
  * - The caller must not free the pointers in the `words` array as they point to
@@ -96,6 +178,29 @@ CARDANO_EXPORT cardano_error_t cardano_bip39_entropy_to_mnemonic_words(
   const char**  words,
   size_t*       word_count);
 
+/**
+ * \brief Converts entropy into a BIP-39 mnemonic word sequence of any wordlist.
+ *
+ * Behaves as \ref cardano_bip39_entropy_to_mnemonic_words, with the words taken from \p wordlist.
+ *
+ * \param[in] wordlist The wordlist, or NULL for the English one.
+ * \param[in] entropy Pointer to the entropy buffer. Must not be NULL.
+ * \param[in] entropy_size Size of the entropy in bytes: 16, 20, 24, 28 or 32.
+ * \param[out] words Array of at least 24 pointers receiving the words. They point into \p wordlist and remain valid
+ *                   while the caller holds a reference to it.
+ * \param[out] word_count On success, the number of words, from 12 to 24.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if a pointer argument other than
+ * \p wordlist is NULL, or \ref CARDANO_ERROR_INVALID_ARGUMENT if \p entropy_size is not supported.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_bip39_entropy_to_mnemonic_words_ex(
+  const cardano_bip39_wordlist_t* wordlist,
+  const byte_t*                   entropy,
+  size_t                          entropy_size,
+  const char**                    words,
+  size_t*                         word_count);
+
 /**
  * \brief Converts a BIP-39 mnemonic word sequence back into entropy.
  *
@@ -124,7 +229,8 @@ CARDANO_EXPORT cardano_error_t cardano_bip39_entropy_to_mnemonic_words(
  * reason for failure.
  *
  * \note
- * - This function only supports the **English BIP-39 wordlist**.
+ * - This function uses the **English BIP-39 wordlist**; see \ref cardano_bip39_mnemonic_words_to_entropy_ex for others.
+ * - Each word is found by binary search over the sorted wordlist.
  * - The provided mnemonic words must be valid and match the BIP-39 specification.
  * - The caller must ensure the entropy buffer is large enough to accommodate the resulting entropy.
  *
@@ -170,6 +276,74 @@ cardano_bip39_mnemonic_words_to_entropy(
   size_t       entropy_buf_size,
   size_t*      entropy_size);
 
+/**
+ * \brief Converts a BIP-39 mnemonic word sequence of any wordlist back into entropy.
+ *
+ * Behaves as \ref cardano_bip39_mnemonic_words_to_entropy, with the words looked up in \p wordlist.
+ *
+ * \param[in] wordlist The wordlist, or NULL for the English one.
+ * \param[in] words The mnemonic words, NFKD-normalized like the words of \p wordlist. Must not be NULL.
+ * \param[in] word_count The number of words: 12, 15, 18, 21 or 24.
+ * \param[out] entropy The buffer receiving the entropy. Must not be NULL.
+ * \param[in] entropy_buf_size The size of \p entropy, at least the entropy size of \p word_count words.
+ * \param[out] entropy_size On success, the size of the entropy in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if a pointer argument other than
+ * \p wordlist is NULL, \ref CARDANO_ERROR_INVALID_ARGUMENT if \p word_count is not supported or a word is not in
+ * \p wordlist, \ref CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE if \p entropy is too small, or
+ * \ref CARDANO_ERROR_INVALID_CHECKSUM if the checksum of the mnemonic does not match.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_bip39_mnemonic_words_to_entropy_ex(
+  const cardano_bip39_wordlist_t* wordlist,
+  const char**                    words,
+  size_t                          word_count,
+  byte_t*                         entropy,
+  size_t                          entropy_buf_size,
+  size_t*                         entropy_size);
+
+/**
+ * \brief Decrements the reference count of a wordlist, freeing it when it reaches zero.
+ *
+ * \param[in,out] wordlist A pointer to the wordlist pointer, set to NULL when it is freed.
+ */
+CARDANO_EXPORT void cardano_bip39_wordlist_unref(cardano_bip39_wordlist_t** wordlist);
+
+/**
+ * \brief Increments the reference count of a wordlist.
+ *
+ * \param[in] wordlist The wordlist.
+ */
+CARDANO_EXPORT void cardano_bip39_wordlist_ref(cardano_bip39_wordlist_t* wordlist);
+
+/**
+ * \brief Retrieves the reference count of a wordlist.
+ *
+ * \param[in] wordlist The wordlist.
+ *
+ * \return The reference count, or zero if \p wordlist is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_bip39_wordlist_refcount(const cardano_bip39_wordlist_t* wordlist);
+
+/**
+ * \brief Records an error message on a wordlist.
+ *
+ * \param[in] wordlist The wordlist.
+ * \param[in] message The message, truncated to 1023 characters. NULL clears the message.
+ */
+CARDANO_EXPORT void cardano_bip39_wordlist_set_last_error(cardano_bip39_wordlist_t* wordlist, const char* message);
+
+/**
+ * \brief Retrieves the last error message recorded on a wordlist.
+ *
+ * \param[in] wordlist The wordlist.
+ *
+ * \return The message, or an empty string if none was recorded.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_bip39_wordlist_get_last_error(const cardano_bip39_wordlist_t* wordlist);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -34,6 +34,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The number of accounts requested per batch of a rewards query for several addresses.
+ */
+#define BLOCKFROST_REWARDS_BATCH_SIZE 64U
+
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
@@ -52,10 +59,15 @@ cardano_blockfrost_context_new(void)
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
-  data->base.deallocator   = free;
+  data->base.last_error    = NULL;
+  data->base.deallocator   = cardano_blockfrost_context_deallocate;
 
-  data->network = CARDANO_NETWORK_MAGIC_PREPROD;
+  data->network                 = CARDANO_NETWORK_MAGIC_PREPROD;
+  data->curl                    = NULL;
+  data->curl_multi              = NULL;
+  data->max_concurrent_requests = CARDANO_BLOCKFROST_MAX_CONCURRENT_REQUESTS;
+  data->headers[0]              = NULL;
+  data->headers[1]              = NULL;
 
   CARDANO_UNUSED(memset(data->project_id, 0, sizeof(data->project_id)));
 
@@ -80,13 +92,17 @@ cardano_blockfrost_context_new(void)
 static cardano_error_t
 get_parameters(cardano_provider_impl_t* provider_impl, cardano_protocol_parameters_t** parameters)
 {
-  blockfrost_context_t* context         = (blockfrost_context_t*)provider_impl->context;
-  char*                 url             = cardano_blockfrost_get_endpoint_url(context->network, "epochs/latest/parameters");
-  cardano_buffer_t*     response_buffer = NULL;
-  uint64_t              response_code   = 0;
+  blockfrost_context_t*            context         = (blockfrost_context_t*)provider_impl->context;
+  cardano_blockfrost_url_builder_t url             = { 0 };
+  cardano_buffer_t*                response_buffer = NULL;
+  uint64_t                         response_code   = 0;
 
-  cardano_error_t result = cardano_blockfrost_http_get(provider_impl, url, cardano_utils_safe_strlen(url, 256U), &response_code, &response_buffer);
-  free(url);
+  if (cardano_blockfrost_build_endpoint_url(&url, context->network, "epochs/latest/parameters") == NULL)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  cardano_error_t result = cardano_blockfrost_http_get(provider_impl, url.url, url.size, &response_code, &response_buffer);
 
   if ((response_code != 200U) || (result != CARDANO_SUCCESS))
   {
@@ -110,90 +126,242 @@ get_parameters(cardano_provider_impl_t* provider_impl, cardano_protocol_paramete
 }
 
 /**
- * \brief Retrieves the unspent transaction outputs (UTXOs) for a given address.
+ * \brief Appends one page of a UTxO query to a list.
  *
- * This function fetches the unspent transaction outputs (UTXOs) associated with the specified Cardano address using the provided provider implementation.
- * The UTXOs are returned as a \ref cardano_utxo_list_t object.
+ * \param[in] provider_impl The Blockfrost provider implementation.
+ * \param[in] response_code The HTTP status code of the page. A 404 is treated as an empty page.
+ * \param[in] response_buffer The body of the page.
+ * \param[in,out] utxo_list The list the UTxOs of the page are appended to.
+ * \param[out] page_length The number of UTxOs on the page.
  *
- * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context for querying the blockchain.
- *                          This parameter must not be NULL.
- * \param[in] address A pointer to an initialized \ref cardano_address_t object representing the Cardano address for which UTXOs are being retrieved.
- *                    This parameter must not be NULL.
- * \param[out] utxo_list On successful execution, this will point to a newly created \ref cardano_utxo_list_t object containing the list of UTXOs for the specified address.
- *                       The caller is responsible for managing the lifecycle of this object and must call \ref cardano_utxo_list_unref when it is no longer needed.
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+append_utxo_page(
+  cardano_provider_impl_t* provider_impl,
+  const uint64_t           response_code,
+  cardano_buffer_t*        response_buffer,
+  cardano_utxo_list_t**    utxo_list,
+  size_t*                  page_length)
+{
+  *page_length = 0U;
+
+  if (response_code == 404U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  if (response_code != 200U)
+  {
+    cardano_blockfrost_parse_error(provider_impl, response_buffer);
+
+    return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+  }
+
+  cardano_utxo_list_t* current_list = NULL;
+  cardano_error_t      result       = cardano_blockfrost_parse_unspent_outputs(provider_impl, (char*)cardano_buffer_get_data(response_buffer), cardano_buffer_get_size(response_buffer), &current_list);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  *page_length = cardano_utxo_list_get_length(current_list);
+
+  cardano_utxo_list_t* tmp_list = *utxo_list;
+
+  *utxo_list = cardano_utxo_list_concat(tmp_list, current_list);
+
+  cardano_utxo_list_unref(&tmp_list);
+  cardano_utxo_list_unref(&current_list);
+
+  return (*utxo_list == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Retrieves every page of the UTxOs of an address, optionally restricted to an asset.
  *
- * \return \ref cardano_error_t indicating the outcome of the operation. Returns \ref CARDANO_SUCCESS if the UTXOs were successfully retrieved,
- *         or an appropriate error code if an error occurred (e.g., if the query failed or the address is invalid).
+ * The first page is fetched on its own, as most addresses fit in it. While pages come back full, the following ones
+ * are then fetched concurrently in batches of `max_concurrent_requests` of the context, and appended in page order. The
+ * pages of a batch that follow the first short page are discarded.
+ *
+ * The URL prefix, up to the page number, is formatted once into a builder per slot of a batch, so each page only
+ * rewrites its number; no memory is allocated per page for URLs.
+ *
+ * \param[in] provider_impl The Blockfrost provider implementation.
+ * \param[in] address The bech32 address.
+ * \param[in] asset_id The hex asset ID to filter by, or `NULL` for every UTxO.
+ * \param[out] utxo_list On success, the UTxOs. The caller must release the list with \ref cardano_utxo_list_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
  */
 static cardano_error_t
-get_unspent_outputs(
+get_paged_unspent_outputs(
   cardano_provider_impl_t* provider_impl,
-  cardano_address_t*       address,
+  const char*              address,
+  const char*              asset_id,
   cardano_utxo_list_t**    utxo_list)
 {
-  size_t page         = 1;
-  size_t max_results  = 100;
-  size_t last_results = 0;
+  blockfrost_context_t* context     = (blockfrost_context_t*)provider_impl->context;
+  const size_t          max_results = 100U;
+  const size_t          max_batch   = (context->max_concurrent_requests > 0U) ? context->max_concurrent_requests : 1U;
 
-  cardano_error_t result = CARDANO_SUCCESS;
+  cardano_error_t result = cardano_utxo_list_new(utxo_list);
 
-  do
+  if (result != CARDANO_SUCCESS)
   {
-    char*             url             = cardano_blockfrost_build_utxo_url(provider_impl, cardano_address_get_string(address), page, max_results);
-    cardano_buffer_t* response_buffer = NULL;
-    uint64_t          response_code   = 0;
+    return result;
+  }
 
-    result = cardano_blockfrost_http_get(provider_impl, url, cardano_utils_safe_strlen(url, 256U), &response_code, &response_buffer);
-    free(url);
+  cardano_blockfrost_url_builder_t* builders = malloc(max_batch * sizeof(cardano_blockfrost_url_builder_t));
+  const char**                      urls     = calloc(max_batch, sizeof(char*));
+  uint64_t*                         codes    = calloc(max_batch, sizeof(uint64_t));
+  cardano_buffer_t**                buffers  = calloc(max_batch, sizeof(cardano_buffer_t*));
 
-    if (response_code == 404U)
-    {
-      cardano_buffer_unref(&response_buffer);
-      return cardano_utxo_list_new(utxo_list);
-    }
+  if ((builders == NULL) || (urls == NULL) || (codes == NULL) || (buffers == NULL))
+  {
+    free(builders);
+    free(urls);
+    free(codes);
+    free(buffers);
+    cardano_utxo_list_unref(utxo_list);
 
-    if ((response_code != 200U) || (result != CARDANO_SUCCESS))
-    {
-      cardano_blockfrost_parse_error(provider_impl, response_buffer);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
 
-      cardano_buffer_unref(&response_buffer);
+  if (!cardano_blockfrost_build_utxo_url(&builders[0], provider_impl, address, asset_id, max_results))
+  {
+    free(builders);
+    free(urls);
+    free(codes);
+    free(buffers);
+    cardano_utxo_list_unref(utxo_list);
 
-      return CARDANO_ERROR_INVALID_HTTP_REQUEST;
-    }
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
 
-    cardano_utxo_list_t* current_list = NULL;
-    result                            = cardano_blockfrost_parse_unspent_outputs(provider_impl, (char*)cardano_buffer_get_data(response_buffer), cardano_buffer_get_size(response_buffer), &current_list);
+  for (size_t i = 1U; i < max_batch; ++i)
+  {
+    builders[i] = builders[0];
+  }
 
-    cardano_buffer_unref(&response_buffer);
+  size_t page       = 1U;
+  size_t batch_size = 1U;
+  bool   done       = false;
 
-    if (result != CARDANO_SUCCESS)
+  while (!done && (result == CARDANO_SUCCESS))
+  {
+    for (size_t i = 0U; i < batch_size; ++i)
     {
-      cardano_utxo_list_unref(utxo_list);
-    }
+      cardano_blockfrost_url_builder_set_suffix_number(&builders[i], page + i);
+      urls[i] = cardano_blockfrost_url_builder_get_url(&builders[i]);
 
-    last_results = cardano_utxo_list_get_length(current_list);
+      if (urls[i] == NULL)
+      {
+        result = CARDANO_ERROR_INVALID_ARGUMENT;
+      }
+    }
 
-    if (*utxo_list == NULL)
+    if ((result == CARDANO_SUCCESS) && (batch_size == 1U))
     {
-      *utxo_list = current_list;
+      // A lone page goes through the shared handle, so it reuses the connection of the previous requests.
+      result = cardano_blockfrost_http_get(provider_impl, urls[0], builders[0].size, &codes[0], &buffers[0]);
     }
-    else
+    else if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_blockfrost_http_get_many(provider_impl, urls, batch_size, codes, buffers);
+    }
+
+    for (size_t i = 0U; i < batch_size; ++i)
     {
-      cardano_utxo_list_t* tmp_list = *utxo_list;
+      if (!done && (result == CARDANO_SUCCESS))
+      {
+        size_t page_length = 0U;
 
-      *utxo_list = cardano_utxo_list_concat(tmp_list, current_list);
+        result = append_utxo_page(provider_impl, codes[i], buffers[i], utxo_list, &page_length);
+        done   = (page_length < max_results);
+      }
 
-      cardano_utxo_list_unref(&tmp_list);
-      cardano_utxo_list_unref(&current_list);
+      cardano_buffer_unref(&buffers[i]);
+      urls[i] = NULL;
     }
 
-    ++page;
+    page       += batch_size;
+    batch_size  = max_batch;
+  }
+
+  free(builders);
+  free(urls);
+  free(codes);
+  free(buffers);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(utxo_list);
   }
-  while (last_results == max_results);
 
   return result;
 }
 
+/**
+ * \brief Retrieves the unspent transaction outputs (UTXOs) for a given address.
+ *
+ * This function fetches the unspent transaction outputs (UTXOs) associated with the specified Cardano address using the provided provider implementation.
+ * The UTXOs are returned as a \ref cardano_utxo_list_t object.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context for querying the blockchain.
+ *                          This parameter must not be NULL.
+ * \param[in] address A pointer to an initialized \ref cardano_address_t object representing the Cardano address for which UTXOs are being retrieved.
+ *                    This parameter must not be NULL.
+ * \param[out] utxo_list On successful execution, this will point to a newly created \ref cardano_utxo_list_t object containing the list of UTXOs for the specified address.
+ *                       The caller is responsible for managing the lifecycle of this object and must call \ref cardano_utxo_list_unref when it is no longer needed.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation. Returns \ref CARDANO_SUCCESS if the UTXOs were successfully retrieved,
+ *         or an appropriate error code if an error occurred (e.g., if the query failed or the address is invalid).
+ */
+static cardano_error_t
+get_unspent_outputs(
+  cardano_provider_impl_t* provider_impl,
+  cardano_address_t*       address,
+  cardano_utxo_list_t**    utxo_list)
+{
+  return get_paged_unspent_outputs(provider_impl, cardano_address_get_string(address), NULL, utxo_list);
+}
+
+/**
+ * \brief Reads the rewards balance out of the response to an account request.
+ *
+ * \param[in] provider_impl The Blockfrost provider implementation, used for error reporting.
+ * \param[in] response_code The HTTP status code of the response.
+ * \param[in] response_buffer The response body.
+ * \param[out] rewards On success, the rewards balance; 0 for an account Blockfrost does not know.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+read_rewards_response(
+  cardano_provider_impl_t* provider_impl,
+  const uint64_t           response_code,
+  cardano_buffer_t*        response_buffer,
+  uint64_t*                rewards)
+{
+  if (response_code == 404U)
+  {
+    *rewards = 0;
+
+    return CARDANO_SUCCESS;
+  }
+
+  if (response_code != 200U)
+  {
+    cardano_blockfrost_parse_error(provider_impl, response_buffer);
+
+    return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+  }
+
+  return cardano_blockfrost_parse_rewards(provider_impl, (char*)cardano_buffer_get_data(response_buffer), cardano_buffer_get_size(response_buffer), rewards);
+}
+
 /**
  * \brief Retrieves the staking rewards balance for a given reward address.
  *
@@ -212,123 +380,151 @@ get_unspent_outputs(
 static cardano_error_t
 get_rewards_balance(cardano_provider_impl_t* provider_impl, cardano_reward_address_t* address, uint64_t* rewards)
 {
-  char*             url             = cardano_blockfrost_build_rewards_url(provider_impl, cardano_reward_address_get_string(address));
-  cardano_buffer_t* response_buffer = NULL;
-  uint64_t          response_code   = 0;
+  cardano_blockfrost_url_builder_t url             = { 0 };
+  cardano_buffer_t*                response_buffer = NULL;
+  uint64_t                         response_code   = 0;
 
-  cardano_error_t result = cardano_blockfrost_http_get(provider_impl, url, cardano_utils_safe_strlen(url, 256U), &response_code, &response_buffer);
-  free(url);
-
-  if (response_code == 404U)
+  if (cardano_blockfrost_build_rewards_url(&url, provider_impl, cardano_reward_address_get_string(address)) == NULL)
   {
-    *rewards = 0;
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
 
-    cardano_buffer_unref(&response_buffer);
+  cardano_error_t result = cardano_blockfrost_http_get(provider_impl, url.url, url.size, &response_code, &response_buffer);
 
-    return CARDANO_SUCCESS;
+  if (result == CARDANO_SUCCESS)
+  {
+    result = read_rewards_response(provider_impl, response_code, response_buffer, rewards);
   }
-
-  if ((response_code != 200U) || (result != CARDANO_SUCCESS))
+  else
   {
     cardano_blockfrost_parse_error(provider_impl, response_buffer);
-
-    cardano_buffer_unref(&response_buffer);
-
-    return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+    result = CARDANO_ERROR_INVALID_HTTP_REQUEST;
   }
 
-  result = cardano_blockfrost_parse_rewards(provider_impl, (char*)cardano_buffer_get_data(response_buffer), cardano_buffer_get_size(response_buffer), rewards);
-
   cardano_buffer_unref(&response_buffer);
 
   return result;
 }
 
 /**
- * \brief Retrieves the unspent transaction outputs (UTXOs) associated with a given address and asset ID.
+ * \brief Retrieves the staking rewards balances of several reward addresses.
  *
- * This function queries the UTXOs associated with a specified address and filters them by the provided asset ID. The results are stored in a UTXO list.
+ * The account of every address is requested concurrently, `max_concurrent_requests` of the context at a time, in
+ * batches of \ref BLOCKFROST_REWARDS_BATCH_SIZE addresses. The URL builders of a batch are allocated once for the
+ * whole query, and hold the `accounts/` prefix; each address only replaces their suffix.
  *
- * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context for querying the UTXOs.
- *                          This parameter must not be NULL.
- * \param[in] address A pointer to an initialized \ref cardano_address_t object representing the address to query for UTXOs. This parameter must not be NULL.
- * \param[in] asset_id A pointer to an initialized \ref cardano_asset_id_t object representing the asset ID used to filter the UTXOs. This parameter must not be NULL.
- * \param[out] utxo_list A pointer to a pointer of \ref cardano_utxo_list_t that will be populated with the filtered UTXOs.
- *                       The caller must manage the lifecycle of this list and free it when no longer needed.
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] addresses The reward addresses to query. This parameter must not be NULL.
+ * \param[out] rewards On success, the rewards balance of each address, in the order of \p addresses.
  *
- * \return \ref cardano_error_t indicating the outcome of the operation. Returns \ref CARDANO_SUCCESS if the UTXOs were successfully retrieved,
- *         or an appropriate error code if an error occurred (e.g., if the query failed or the address/asset ID is invalid).
+ * \return \ref cardano_error_t indicating the outcome of the operation.
  */
 static cardano_error_t
-get_unspent_outputs_with_asset(
-  cardano_provider_impl_t* provider_impl,
-  cardano_address_t*       address,
-  cardano_asset_id_t*      asset_id,
-  cardano_utxo_list_t**    utxo_list)
+get_rewards_balances(cardano_provider_impl_t* provider_impl, cardano_reward_address_list_t* addresses, uint64_t* rewards)
 {
-  size_t page         = 1;
-  size_t max_results  = 100;
-  size_t last_results = 0;
-
+  const size_t    count  = cardano_reward_address_list_get_length(addresses);
   cardano_error_t result = CARDANO_SUCCESS;
 
-  do
+  if (count == 0U)
   {
-    char*             url             = cardano_blockfrost_build_utxo_with_asset_url(provider_impl, cardano_address_get_string(address), cardano_asset_id_get_hex(asset_id), page, max_results);
-    cardano_buffer_t* response_buffer = NULL;
-    uint64_t          response_code   = 0;
+    return CARDANO_SUCCESS;
+  }
 
-    result = cardano_blockfrost_http_get(provider_impl, url, cardano_utils_safe_strlen(url, 256U), &response_code, &response_buffer);
-    free(url);
+  const size_t                      max_batch = (count < BLOCKFROST_REWARDS_BATCH_SIZE) ? count : BLOCKFROST_REWARDS_BATCH_SIZE;
+  cardano_blockfrost_url_builder_t* builders  = malloc(max_batch * sizeof(cardano_blockfrost_url_builder_t));
 
-    if (response_code == 404U)
-    {
-      cardano_buffer_unref(&response_buffer);
-      return cardano_utxo_list_new(utxo_list);
-    }
+  if (builders == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
 
-    if ((response_code != 200U) || (result != CARDANO_SUCCESS))
+  if (cardano_blockfrost_build_rewards_url(&builders[0], provider_impl, NULL) == NULL)
+  {
+    free(builders);
+
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  for (size_t i = 1U; i < max_batch; ++i)
+  {
+    builders[i] = builders[0];
+  }
+
+  for (size_t first = 0U; (first < count) && (result == CARDANO_SUCCESS); first += BLOCKFROST_REWARDS_BATCH_SIZE)
+  {
+    const char*       urls[BLOCKFROST_REWARDS_BATCH_SIZE]    = { 0 };
+    uint64_t          codes[BLOCKFROST_REWARDS_BATCH_SIZE]   = { 0 };
+    cardano_buffer_t* buffers[BLOCKFROST_REWARDS_BATCH_SIZE] = { 0 };
+    const size_t      batch_size                             = ((count - first) < BLOCKFROST_REWARDS_BATCH_SIZE) ? (count - first) : BLOCKFROST_REWARDS_BATCH_SIZE;
+
+    for (size_t i = 0U; (i < batch_size) && (result == CARDANO_SUCCESS); ++i)
     {
-      cardano_blockfrost_parse_error(provider_impl, response_buffer);
+      cardano_reward_address_t* address = NULL;
 
-      cardano_buffer_unref(&response_buffer);
+      result = cardano_reward_address_list_get(addresses, first + i, &address);
 
-      return CARDANO_ERROR_INVALID_HTTP_REQUEST;
-    }
+      if (result != CARDANO_SUCCESS)
+      {
+        break;
+      }
 
-    cardano_utxo_list_t* current_list = NULL;
-    result                            = cardano_blockfrost_parse_unspent_outputs(provider_impl, (char*)cardano_buffer_get_data(response_buffer), cardano_buffer_get_size(response_buffer), &current_list);
+      cardano_blockfrost_url_builder_set_suffix(&builders[i], cardano_reward_address_get_string(address));
+      cardano_reward_address_unref(&address);
 
-    cardano_buffer_unref(&response_buffer);
+      urls[i] = cardano_blockfrost_url_builder_get_url(&builders[i]);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_utxo_list_unref(utxo_list);
+      if (urls[i] == NULL)
+      {
+        result = CARDANO_ERROR_INVALID_ARGUMENT;
+      }
     }
 
-    last_results = cardano_utxo_list_get_length(current_list);
-
-    if (*utxo_list == NULL)
+    if (result == CARDANO_SUCCESS)
     {
-      *utxo_list = current_list;
+      result = cardano_blockfrost_http_get_many(provider_impl, urls, batch_size, codes, buffers);
     }
-    else
-    {
-      cardano_utxo_list_t* tmp_list = *utxo_list;
 
-      *utxo_list = cardano_utxo_list_concat(tmp_list, current_list);
+    for (size_t i = 0U; i < batch_size; ++i)
+    {
+      if (result == CARDANO_SUCCESS)
+      {
+        result = read_rewards_response(provider_impl, codes[i], buffers[i], &rewards[first + i]);
+      }
 
-      cardano_utxo_list_unref(&tmp_list);
-      cardano_utxo_list_unref(&current_list);
+      cardano_buffer_unref(&buffers[i]);
     }
-
-    ++page;
   }
-  while (last_results == max_results);
+
+  free(builders);
 
   return result;
 }
 
+/**
+ * \brief Retrieves the unspent transaction outputs (UTXOs) associated with a given address and asset ID.
+ *
+ * This function queries the UTXOs associated with a specified address and filters them by the provided asset ID. The results are stored in a UTXO list.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context for querying the UTXOs.
+ *                          This parameter must not be NULL.
+ * \param[in] address A pointer to an initialized \ref cardano_address_t object representing the address to query for UTXOs. This parameter must not be NULL.
+ * \param[in] asset_id A pointer to an initialized \ref cardano_asset_id_t object representing the asset ID used to filter the UTXOs. This parameter must not be NULL.
+ * \param[out] utxo_list A pointer to a pointer of \ref cardano_utxo_list_t that will be populated with the filtered UTXOs.
+ *                       The caller must manage the lifecycle of this list and free it when no longer needed.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation. Returns \ref CARDANO_SUCCESS if the UTXOs were successfully retrieved,
+ *         or an appropriate error code if an error occurred (e.g., if the query failed or the address/asset ID is invalid).
+ */
+static cardano_error_t
+get_unspent_outputs_with_asset(
+  cardano_provider_impl_t* provider_impl,
+  cardano_address_t*       address,
+  cardano_asset_id_t*      asset_id,
+  cardano_utxo_list_t**    utxo_list)
+{
+  return get_paged_unspent_outputs(provider_impl, cardano_address_get_string(address), cardano_asset_id_get_hex(asset_id), utxo_list);
+}
+
 /**
  * \brief Retrieves the unspent transaction output (UTXO) associated with a specific NFT (Non-Fungible Token).
  *
@@ -349,12 +545,16 @@ get_unspent_output_by_nft(
   cardano_asset_id_t*      asset_id,
   cardano_utxo_t**         utxo)
 {
-  char*             url             = cardano_blockfrost_build_addresses_with_asset_url(provider_impl, cardano_asset_id_get_hex(asset_id));
-  cardano_buffer_t* response_buffer = NULL;
-  uint64_t          response_code   = 0;
+  cardano_blockfrost_url_builder_t url             = { 0 };
+  cardano_buffer_t*                response_buffer = NULL;
+  uint64_t                         response_code   = 0;
+
+  if (cardano_blockfrost_build_addresses_with_asset_url(&url, provider_impl, cardano_asset_id_get_hex(asset_id)) == NULL)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
 
-  cardano_error_t result = cardano_blockfrost_http_get(provider_impl, url, cardano_utils_safe_strlen(url, 256U), &response_code, &response_buffer);
-  free(url);
+  cardano_error_t result = cardano_blockfrost_http_get(provider_impl, url.url, url.size, &response_code, &response_buffer);
 
   if ((response_code != 200U) || (result != CARDANO_SUCCESS))
   {
@@ -543,15 +743,21 @@ resolve_unspent_outputs(
       return result;
     }
 
-    char* url = cardano_blockfrost_build_transaction_utxos_url(provider_impl, tx_id_hex);
+    cardano_blockfrost_url_builder_t url = { 0 };
 
     cardano_buffer_t* response_buffer = NULL;
 
     uint64_t response_code = 0;
 
-    result = cardano_blockfrost_http_get(provider_impl, url, cardano_utils_safe_strlen(url, 256U), &response_code, &response_buffer);
+    if (cardano_blockfrost_build_transaction_utxos_url(&url, provider_impl, tx_id_hex) == NULL)
+    {
+      cardano_utxo_list_unref(utxo_list);
+      free(tx_id_hex);
+
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
 
-    free(url);
+    result = cardano_blockfrost_http_get(provider_impl, url.url, url.size, &response_code, &response_buffer);
 
     if ((response_code != 200U) || (result != CARDANO_SUCCESS))
     {
@@ -702,14 +908,19 @@ resolve_datum(
     return result;
   }
 
-  char*             url             = cardano_blockfrost_build_datum_url(provider_impl, hash);
-  cardano_buffer_t* response_buffer = NULL;
-  uint64_t          response_code   = 0U;
+  cardano_blockfrost_url_builder_t url             = { 0 };
+  cardano_buffer_t*                response_buffer = NULL;
+  uint64_t                         response_code   = 0U;
 
+  const bool is_built = (cardano_blockfrost_build_datum_url(&url, provider_impl, hash) != NULL);
   free(hash);
 
-  result = cardano_blockfrost_http_get(provider_impl, url, cardano_utils_safe_strlen(url, 256U), &response_code, &response_buffer);
-  free(url);
+  if (!is_built)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  result = cardano_blockfrost_http_get(provider_impl, url.url, url.size, &response_code, &response_buffer);
 
   if ((response_code != 200U) || (result != CARDANO_SUCCESS))
   {
@@ -769,16 +980,16 @@ await_transaction_confirmation(
     return result;
   }
 
-  char* url = cardano_blockfrost_build_tx_metadata_cbor_url(provider_impl, hash);
+  cardano_blockfrost_url_builder_t url = { 0 };
 
-  if ((hash == NULL) || (url == NULL))
-  {
-    free(hash);
-    free(url);
+  const bool is_built = (cardano_blockfrost_build_tx_metadata_cbor_url(&url, provider_impl, hash) != NULL);
+  free(hash);
 
+  if (!is_built)
+  {
     *confirmed = false;
 
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    return CARDANO_ERROR_INVALID_ARGUMENT;
   }
 
   do
@@ -798,7 +1009,7 @@ await_transaction_confirmation(
     cardano_buffer_t* response_buffer = NULL;
     uint64_t          response_code   = 0U;
 
-    result = cardano_blockfrost_http_get(provider_impl, url, cardano_utils_safe_strlen(url, 256U), &response_code, &response_buffer);
+    result = cardano_blockfrost_http_get(provider_impl, url.url, url.size, &response_code, &response_buffer);
 
     if (result != CARDANO_SUCCESS)
     {
@@ -806,8 +1017,6 @@ await_transaction_confirmation(
       cardano_blockfrost_parse_error(provider_impl, response_buffer);
 
       cardano_buffer_unref(&response_buffer);
-      free(hash);
-      free(url);
 
       return CARDANO_ERROR_INVALID_HTTP_REQUEST;
     }
@@ -824,9 +1033,6 @@ await_transaction_confirmation(
   }
   while (!(*confirmed) && (remaining_time_ms > 0U));
 
-  free(hash);
-  free(url);
-
   return result;
 }
 
@@ -853,16 +1059,16 @@ post_transaction_to_chain(
   cardano_transaction_t*   tx,
   cardano_blake2b_hash_t** tx_id)
 {
-  blockfrost_context_t* context         = (blockfrost_context_t*)provider_impl->context;
-  char*                 base_path       = cardano_blockfrost_get_endpoint_url(context->network, "tx/submit");
-  cardano_buffer_t*     response_buffer = NULL;
-  uint64_t              response_code   = 0U;
+  blockfrost_context_t*            context         = (blockfrost_context_t*)provider_impl->context;
+  cardano_blockfrost_url_builder_t url             = { 0 };
+  const char*                      base_path       = cardano_blockfrost_build_endpoint_url(&url, context->network, "tx/submit");
+  cardano_buffer_t*                response_buffer = NULL;
+  uint64_t                         response_code   = 0U;
 
   cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
 
   if (writer == NULL)
   {
-    free(base_path);
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
@@ -872,7 +1078,6 @@ post_transaction_to_chain(
   {
     cardano_cbor_writer_unref(&writer);
 
-    free(base_path);
     return result;
   }
 
@@ -881,7 +1086,6 @@ post_transaction_to_chain(
 
   if (cbor_data == NULL)
   {
-    free(base_path);
     cardano_cbor_writer_unref(&writer);
 
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
@@ -892,7 +1096,6 @@ post_transaction_to_chain(
   if (result != CARDANO_SUCCESS)
   {
     free(cbor_data);
-    free(base_path);
     cardano_cbor_writer_unref(&writer);
 
     return result;
@@ -904,7 +1107,6 @@ post_transaction_to_chain(
   if (tx_encoded == NULL)
   {
     free(cbor_data);
-    free(base_path);
     cardano_cbor_writer_unref(&writer);
 
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
@@ -917,7 +1119,6 @@ post_transaction_to_chain(
   {
     free(tx_encoded);
     free(cbor_data);
-    free(base_path);
 
     return result;
   }
@@ -928,14 +1129,13 @@ post_transaction_to_chain(
   result = cardano_blockfrost_http_post(
     provider_impl,
     base_path,
-    cardano_utils_safe_strlen(base_path, 256U),
+    url.size,
     cbor_data,
     cbor_size,
     CARDANO_BLOCKFROST_CONTENT_TYPE_CBOR,
     &response_code,
     &response_buffer);
 
-  free(base_path);
   free(cbor_data);
 
   if ((response_code != 200U) || (result != CARDANO_SUCCESS))
@@ -1005,10 +1205,11 @@ evaluate_transaction(
   cardano_utxo_list_t*      additional_utxos,
   cardano_redeemer_list_t** redeemers)
 {
-  blockfrost_context_t* context         = (blockfrost_context_t*)provider_impl->context;
-  char*                 base_path       = cardano_blockfrost_get_endpoint_url(context->network, "/utils/txs/evaluate/utxos");
-  cardano_buffer_t*     response_buffer = NULL;
-  uint64_t              response_code   = 0;
+  blockfrost_context_t*            context         = (blockfrost_context_t*)provider_impl->context;
+  cardano_blockfrost_url_builder_t url             = { 0 };
+  const char*                      base_path       = cardano_blockfrost_build_endpoint_url(&url, context->network, "/utils/txs/evaluate/utxos");
+  cardano_buffer_t*                response_buffer = NULL;
+  uint64_t                         response_code   = 0;
 
   char*           json_payload = NULL;
   size_t          json_size    = 0;
@@ -1016,7 +1217,6 @@ evaluate_transaction(
 
   if (result != CARDANO_SUCCESS)
   {
-    free(base_path);
 
     return result;
   }
@@ -1024,14 +1224,13 @@ evaluate_transaction(
   result = cardano_blockfrost_http_post(
     provider_impl,
     base_path,
-    cardano_utils_safe_strlen(base_path, 256U),
+    url.size,
     (byte_t*)json_payload,
     json_size,
     CARDANO_BLOCKFROST_CONTENT_TYPE_JSON,
     &response_code,
     &response_buffer);
 
-  free(base_path);
   free(json_payload);
 
   if ((response_code != 200U) || (result != CARDANO_SUCCESS))
@@ -1108,6 +1307,7 @@ create_blockfrost_provider(
   impl.get_parameters                 = get_parameters;
   impl.get_unspent_outputs            = get_unspent_outputs;
   impl.get_rewards_balance            = get_rewards_balance;
+  impl.get_rewards_balances           = get_rewards_balances;
   impl.get_unspent_outputs_with_asset = get_unspent_outputs_with_asset;
   impl.get_unspent_output_by_nft      = get_unspent_output_by_nft;
   impl.resolve_unspent_outputs        = resolve_unspent_outputs;
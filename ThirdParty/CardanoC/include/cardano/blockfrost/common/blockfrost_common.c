@@ -29,12 +29,202 @@
 
 #include <cardano/json/json_object.h>
 #include <curl/curl.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Sets the transport options shared by every request of a provider.
+ *
+ * \param[in] curl The handle to configure.
+ */
+static void
+set_transport_options(CURL* curl)
+{
+  curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+  curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
+
+#if LIBCURL_VERSION_NUM >= 0x072F00
+  // Negotiates HTTP/2 through ALPN and falls back to HTTP/1.1 when the server or libcurl build does not support it.
+  curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+#endif
+}
+
+/**
+ * \brief Gets the cached request headers of a provider for a content type.
+ *
+ * \param[in] context The provider context.
+ * \param[in] content_type The content type of the request.
+ *
+ * \return The headers, owned by the context, or `NULL` if they could not be built.
+ */
+static struct curl_slist*
+get_cached_headers(blockfrost_context_t* context, const cardano_blockfrost_content_type_t content_type)
+{
+  const size_t index = (content_type == CARDANO_BLOCKFROST_CONTENT_TYPE_CBOR) ? 1U : 0U;
+
+  if (context->headers[index] == NULL)
+  {
+    context->headers[index] = cardano_blockfrost_get_headers(context->project_id, context->project_id_size, content_type);
+  }
+
+  return context->headers[index];
+}
+
+/**
+ * \brief Gets the libcurl handle of a provider, ready for a new request.
+ *
+ * The handle is created on first use and reset on later ones. Resetting clears the options of the previous request
+ * but keeps its live connections and its DNS and TLS session caches, so the next request to the same host reuses
+ * them.
+ *
+ * \param[in] provider_impl The provider implementation; the handle is stored in its context.
+ *
+ * \return The handle, or `NULL` if libcurl could not be initialized.
+ */
+static CURL*
+get_curl_handle(cardano_provider_impl_t* provider_impl)
+{
+  blockfrost_context_t* context = (blockfrost_context_t*)provider_impl->context;
+
+  if (context->curl == NULL)
+  {
+    if (curl_global_init(CURL_GLOBAL_DEFAULT) != CURLE_OK)
+    {
+      return NULL;
+    }
+
+    context->curl = curl_easy_init();
+
+    if (context->curl == NULL)
+    {
+      curl_global_cleanup();
+
+      return NULL;
+    }
+  }
+  else
+  {
+    curl_easy_reset(context->curl);
+  }
+
+  CURL* curl = context->curl;
+
+  set_transport_options(curl);
+
+  return curl;
+}
+
+/**
+ * \brief Gets the libcurl multi handle of a provider, creating it on first use.
+ *
+ * \param[in] context The provider context; the handle is stored in it.
+ *
+ * \return The handle, or `NULL` if libcurl could not be initialized.
+ */
+static CURLM*
+get_curl_multi_handle(blockfrost_context_t* context)
+{
+  if (context->curl_multi != NULL)
+  {
+    return context->curl_multi;
+  }
+
+  if (curl_global_init(CURL_GLOBAL_DEFAULT) != CURLE_OK)
+  {
+    return NULL;
+  }
+
+  CURLM* multi = curl_multi_init();
+
+  if (multi == NULL)
+  {
+    curl_global_cleanup();
+
+    return NULL;
+  }
+
+  curl_multi_setopt(multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, (long)context->max_concurrent_requests);
+
+#if LIBCURL_VERSION_NUM >= 0x072B00
+  // Lets concurrent requests share one HTTP/2 connection instead of opening one connection each.
+  curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#endif
+
+  context->curl_multi = multi;
+
+  return multi;
+}
+
+/**
+ * \brief Creates a libcurl easy handle for one request of a concurrent batch.
+ *
+ * \param[in] context The provider context.
+ * \param[in] url The URL to request.
+ * \param[in] index The position of the request in the batch, stored as the private data of the handle.
+ * \param[in] response_buffer The buffer the response body is written to.
+ *
+ * \return The handle, or `NULL` if it could not be created.
+ */
+static CURL*
+new_batch_handle(blockfrost_context_t* context, const char* url, const size_t index, cardano_buffer_t* response_buffer)
+{
+  CURL* curl = curl_easy_init();
+
+  if (curl == NULL)
+  {
+    return NULL;
+  }
+
+  set_transport_options(curl);
+
+  curl_easy_setopt(curl, CURLOPT_URL, url);
+  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, get_cached_headers(context, CARDANO_BLOCKFROST_CONTENT_TYPE_JSON));
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, cardano_blockfrost_handle_response);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void*)response_buffer);
+  curl_easy_setopt(curl, CURLOPT_PRIVATE, (void*)(uintptr_t)index);
+
+#if LIBCURL_VERSION_NUM >= 0x072B00
+  // Waits for an existing connection to confirm HTTP/2 rather than opening a parallel one next to it.
+  curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+#endif
+
+  return curl;
+}
+
 /* DEFINITIONS ***************************************************************/
 
+void
+cardano_blockfrost_context_deallocate(void* object)
+{
+  blockfrost_context_t* context = (blockfrost_context_t*)object;
+
+  if (context == NULL)
+  {
+    return;
+  }
+
+  if (context->curl_multi != NULL)
+  {
+    curl_multi_cleanup(context->curl_multi);
+    curl_global_cleanup();
+  }
+
+  curl_slist_free_all(context->headers[0]);
+  curl_slist_free_all(context->headers[1]);
+
+  if (context->curl != NULL)
+  {
+    curl_easy_cleanup(context->curl);
+    curl_global_cleanup();
+  }
+
+  free(context);
+}
+
 struct curl_slist*
 cardano_blockfrost_get_headers(
   const char*                             project_id,
@@ -149,8 +339,7 @@ cardano_blockfrost_http_get(cardano_provider_impl_t* provider_impl, const char*
   *response_buffer              = cardano_buffer_new(1024);
   *response_code                = 0;
 
-  curl_global_init(CURL_GLOBAL_DEFAULT);
-  CURL* curl = curl_easy_init();
+  CURL* curl = get_curl_handle(provider_impl);
 
   if (!curl)
   {
@@ -162,7 +351,7 @@ cardano_blockfrost_http_get(cardano_provider_impl_t* provider_impl, const char*
 
   curl_easy_setopt(curl, CURLOPT_URL, url);
 
-  struct curl_slist* headers = cardano_blockfrost_get_headers(context->project_id, context->project_id_size, CARDANO_BLOCKFROST_CONTENT_TYPE_JSON);
+  struct curl_slist* headers = get_cached_headers(context, CARDANO_BLOCKFROST_CONTENT_TYPE_JSON);
 
   curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
   curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, cardano_blockfrost_handle_response);
@@ -177,20 +366,131 @@ cardano_blockfrost_http_get(cardano_provider_impl_t* provider_impl, const char*
     cardano_utils_set_error_message(provider_impl, curl_easy_strerror(res));
 
     cardano_buffer_unref(response_buffer);
-    curl_slist_free_all(headers);
-    curl_easy_cleanup(curl);
 
     return CARDANO_ERROR_GENERIC;
   }
 
   curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, response_code);
 
-  curl_slist_free_all(headers);
-  curl_easy_cleanup(curl);
-
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_blockfrost_http_get_many(
+  cardano_provider_impl_t* provider_impl,
+  const char* const*       urls,
+  const size_t             count,
+  uint64_t*                response_codes,
+  cardano_buffer_t**       response_buffers)
+{
+  blockfrost_context_t* context    = (blockfrost_context_t*)provider_impl->context;
+  CURLM*                multi      = get_curl_multi_handle(context);
+  CURL**                handles    = calloc((count > 0U) ? count : 1U, sizeof(CURL*));
+  const size_t          max_active = (context->max_concurrent_requests > 0U) ? context->max_concurrent_requests : 1U;
+  cardano_error_t       result     = CARDANO_SUCCESS;
+  size_t                started    = 0U;
+  size_t                finished   = 0U;
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    response_buffers[i] = NULL;
+    response_codes[i]   = 0U;
+  }
+
+  if ((multi == NULL) || (handles == NULL))
+  {
+    free(handles);
+    cardano_utils_set_error_message(provider_impl, "Failed to initialize libcurl");
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  while ((result == CARDANO_SUCCESS) && (finished < count))
+  {
+    // Keeps the window full: a new request starts as soon as one completes, never exceeding the cap.
+    while ((started < count) && ((started - finished) < max_active))
+    {
+      response_buffers[started] = cardano_buffer_new(1024);
+      handles[started]          = (response_buffers[started] != NULL) ? new_batch_handle(context, urls[started], started, response_buffers[started]) : NULL;
+
+      if ((handles[started] == NULL) || (curl_multi_add_handle(multi, handles[started]) != CURLM_OK))
+      {
+        cardano_utils_set_error_message(provider_impl, "Failed to initialize libcurl");
+        result = CARDANO_ERROR_GENERIC;
+
+        break;
+      }
+
+      console_debug("Sending GET request to endpoint: %s", urls[started]);
+
+      ++started;
+    }
+
+    int       running      = 0;
+    CURLMcode multi_result = (result == CARDANO_SUCCESS) ? curl_multi_perform(multi, &running) : CURLM_OK;
+
+    CURLMsg* message   = NULL;
+    int      remaining = 0;
+
+    while ((message = curl_multi_info_read(multi, &remaining)) != NULL)
+    {
+      if (message->msg != CURLMSG_DONE)
+      {
+        continue;
+      }
+
+      if ((message->data.result != CURLE_OK) && (result == CARDANO_SUCCESS))
+      {
+        cardano_utils_set_error_message(provider_impl, curl_easy_strerror(message->data.result));
+        result = CARDANO_ERROR_GENERIC;
+      }
+
+      void* index         = NULL;
+      long  response_code = 0;
+
+      curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &index);
+      curl_easy_getinfo(message->easy_handle, CURLINFO_RESPONSE_CODE, &response_code);
+
+      response_codes[(uintptr_t)index] = (uint64_t)response_code;
+
+      ++finished;
+    }
+
+    if ((multi_result == CURLM_OK) && (running > 0) && (result == CARDANO_SUCCESS))
+    {
+#if LIBCURL_VERSION_NUM >= 0x074200
+      multi_result = curl_multi_poll(multi, NULL, 0, 1000, NULL);
+#else
+      multi_result = curl_multi_wait(multi, NULL, 0, 1000, NULL);
+#endif
+    }
+
+    if ((multi_result != CURLM_OK) && (result == CARDANO_SUCCESS))
+    {
+      cardano_utils_set_error_message(provider_impl, curl_multi_strerror(multi_result));
+      result = CARDANO_ERROR_GENERIC;
+    }
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    if (handles[i] != NULL)
+    {
+      CARDANO_UNUSED(curl_multi_remove_handle(multi, handles[i]));
+      curl_easy_cleanup(handles[i]);
+    }
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_buffer_unref(&response_buffers[i]);
+    }
+  }
+
+  free(handles);
+
+  return result;
+}
+
 cardano_error_t
 cardano_blockfrost_http_post(
   cardano_provider_impl_t*          provider_impl,
@@ -208,8 +508,7 @@ cardano_blockfrost_http_post(
   *response_buffer              = cardano_buffer_new(1024);
   *response_code                = 0;
 
-  curl_global_init(CURL_GLOBAL_DEFAULT);
-  CURL* curl = curl_easy_init();
+  CURL* curl = get_curl_handle(provider_impl);
 
   if (!curl)
   {
@@ -221,7 +520,7 @@ cardano_blockfrost_http_post(
 
   curl_easy_setopt(curl, CURLOPT_URL, url);
 
-  struct curl_slist* headers = cardano_blockfrost_get_headers(context->project_id, context->project_id_size, content_type);
+  struct curl_slist* headers = get_cached_headers(context, content_type);
 
   curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
   curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, cardano_blockfrost_handle_response);
@@ -240,16 +539,11 @@ cardano_blockfrost_http_post(
     cardano_utils_set_error_message(provider_impl, curl_easy_strerror(res));
 
     cardano_buffer_unref(response_buffer);
-    curl_slist_free_all(headers);
-    curl_easy_cleanup(curl);
 
     return CARDANO_ERROR_GENERIC;
   }
 
   curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, response_code);
 
-  curl_slist_free_all(headers);
-  curl_easy_cleanup(curl);
-
   return CARDANO_SUCCESS;
 }
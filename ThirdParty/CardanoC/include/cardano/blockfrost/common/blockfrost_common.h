@@ -34,6 +34,17 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/* CONSTANTS ****************************************************************/
+
+/**
+ * \brief The default number of requests a Blockfrost provider keeps in flight when prefetching result pages.
+ *
+ * Every request counts against the rate limit of the Blockfrost plan, so builds on a lower tier can lower it.
+ */
+#ifndef CARDANO_BLOCKFROST_MAX_CONCURRENT_REQUESTS
+#define CARDANO_BLOCKFROST_MAX_CONCURRENT_REQUESTS 4U
+#endif
+
 /* STRUCTURES ***************************************************************/
 
 /**
@@ -51,6 +62,22 @@ extern "C" {
  * \var project_id_size
  * The size (in bytes) of the project ID stored in `project_id`. It represents the actual length of the
  * project ID string, not the full size of the array.
+ *
+ * \var curl
+ * The libcurl easy handle shared by every request of the provider, or `NULL` until the first request. Reusing it
+ * keeps the connection, DNS and TLS session caches warm across requests, so paginated fetches do not pay for a new
+ * TCP and TLS handshake per page.
+ *
+ * \var curl_multi
+ * The libcurl multi handle used by \ref cardano_blockfrost_http_get_many, or `NULL` until first used. It owns the
+ * connection pool of the concurrent requests, so consecutive batches reuse their connections.
+ *
+ * \var max_concurrent_requests
+ * The maximum number of requests \ref cardano_blockfrost_http_get_many keeps in flight. Defaults to
+ * \ref CARDANO_BLOCKFROST_MAX_CONCURRENT_REQUESTS.
+ *
+ * \var headers
+ * The request headers for each \ref cardano_blockfrost_content_type_t, built on first use.
  */
 typedef struct blockfrost_context_t
 {
@@ -58,6 +85,10 @@ typedef struct blockfrost_context_t
     cardano_network_magic_t network;
     char                    project_id[64];
     size_t                  project_id_size;
+    void*                   curl;
+    void*                   curl_multi;
+    size_t                  max_concurrent_requests;
+    struct curl_slist*      headers[2];
 } blockfrost_context_t;
 
 /* ENUMERATIONS *************************************************************/
@@ -99,6 +130,16 @@ typedef enum
 struct curl_slist*
 cardano_blockfrost_get_headers(const char* project_id, size_t project_id_size, cardano_blockfrost_content_type_t content_type);
 
+/**
+ * \brief Releases a Blockfrost context, its libcurl handle and its cached headers.
+ *
+ * This is the deallocator of \ref blockfrost_context_t objects.
+ *
+ * \param[in] object A pointer to the \ref blockfrost_context_t to release.
+ */
+void
+cardano_blockfrost_context_deallocate(void* object);
+
 /**
  * \brief Parses the error response from a Cardano provider and extracts the error message.
  *
@@ -164,6 +205,30 @@ cardano_blockfrost_http_get(
   uint64_t*                response_code,
   cardano_buffer_t**       response_buffer);
 
+/**
+ * \brief Performs several HTTP GET requests against the Blockfrost API concurrently.
+ *
+ * At most `max_concurrent_requests` of the provider context are in flight at once; the rest start as earlier ones
+ * complete. The responses are returned in the order of the URLs, whatever order they arrive in.
+ *
+ * \param[in]  provider_impl    The Blockfrost provider implementation. Must not be `NULL`.
+ * \param[in]  urls             The null-terminated URLs to request. Must not be `NULL`.
+ * \param[in]  count            The number of URLs.
+ * \param[out] response_codes   An array of `count` entries that receives the HTTP status code of each response.
+ * \param[out] response_buffers An array of `count` entries that receives the body of each response. The caller must
+ *                              release each of them with \ref cardano_buffer_unref.
+ *
+ * \return \ref CARDANO_SUCCESS if every request received a response, whatever its status code. Otherwise an error code
+ *         is returned and every entry of `response_buffers` is set to `NULL`.
+ */
+cardano_error_t
+cardano_blockfrost_http_get_many(
+  cardano_provider_impl_t* provider_impl,
+  const char* const*       urls,
+  size_t                   count,
+  uint64_t*                response_codes,
+  cardano_buffer_t**       response_buffers);
+
 /**
  * \brief Sends an HTTP POST request to the Blockfrost API.
  *
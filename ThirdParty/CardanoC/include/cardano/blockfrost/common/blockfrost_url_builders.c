@@ -25,12 +25,71 @@
 #include "blockfrost_common.h"
 #include "../../utils.h"
 
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-
 /* STATIC FUNCTIONS **********************************************************/
 
+/**
+ * \brief Writes text at an offset of the URL of a builder, making it invalid if it does not fit.
+ *
+ * \param[in,out] builder The URL builder.
+ * \param[in] offset Where the text goes; the URL ends after it.
+ * \param[in] text The text to write.
+ */
+static void
+write_at(cardano_blockfrost_url_builder_t* builder, const size_t offset, const char* text)
+{
+  if (!builder->is_valid || (text == NULL))
+  {
+    builder->is_valid = false;
+
+    return;
+  }
+
+  const size_t text_size = cardano_utils_safe_strlen(text, CARDANO_BLOCKFROST_URL_CAPACITY);
+
+  if ((offset + text_size) >= CARDANO_BLOCKFROST_URL_CAPACITY)
+  {
+    builder->is_valid = false;
+
+    return;
+  }
+
+  cardano_utils_safe_memcpy(&builder->url[offset], CARDANO_BLOCKFROST_URL_CAPACITY - offset, text, text_size);
+
+  builder->size               = offset + text_size;
+  builder->url[builder->size] = '\0';
+}
+
+/**
+ * \brief Formats the decimal digits of a number.
+ *
+ * \param[in] value The number.
+ * \param[out] digits A buffer of at least 21 bytes, which receives the null-terminated digits.
+ */
+static void
+format_number(const size_t value, char* digits)
+{
+  char   reversed[20] = { 0 };
+  size_t count        = 0U;
+  size_t remaining    = value;
+
+  do
+  {
+    reversed[count] = (char)('0' + (remaining % 10U));
+    remaining      /= 10U;
+    ++count;
+  }
+  while (remaining > 0U);
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    digits[i] = reversed[count - 1U - i];
+  }
+
+  digits[count] = '\0';
+}
+
+/* DEFINITIONS ****************************************************************/
+
 const char*
 cardano_blockfrost_get_network_base_url(const cardano_network_magic_t network)
 {
@@ -49,251 +108,180 @@ cardano_blockfrost_get_network_base_url(const cardano_network_magic_t network)
   }
 }
 
-char*
-cardano_blockfrost_get_endpoint_url(const cardano_network_magic_t network, const char* endpoint)
+void
+cardano_blockfrost_url_builder_init(cardano_blockfrost_url_builder_t* builder, const cardano_network_magic_t network)
 {
-  const char* base_url = cardano_blockfrost_get_network_base_url(network);
-
-  if (base_url == NULL)
-  {
-    return NULL;
-  }
-
-  const size_t base_url_size = cardano_utils_safe_strlen(base_url, 256U);
-  const size_t endpoint_size = cardano_utils_safe_strlen(endpoint, 256U);
-
-  char* url = malloc(256);
-  memset(url, 0, 256);
+  builder->url[0]      = '\0';
+  builder->prefix_size = 0U;
+  builder->size        = 0U;
+  builder->is_valid    = true;
 
-  if (url == NULL)
-  {
-    return NULL;
-  }
+  cardano_blockfrost_url_builder_append(builder, cardano_blockfrost_get_network_base_url(network));
+}
 
-  cardano_utils_safe_memcpy(url, base_url_size + endpoint_size + 1U, base_url, base_url_size);
-  cardano_utils_safe_memcpy(url + base_url_size, endpoint_size + 1U, endpoint, endpoint_size);
-  url[base_url_size + endpoint_size] = '\0';
+void
+cardano_blockfrost_url_builder_append(cardano_blockfrost_url_builder_t* builder, const char* text)
+{
+  write_at(builder, builder->size, text);
 
-  return url;
+  builder->prefix_size = builder->size;
 }
 
-char*
-cardano_blockfrost_build_utxo_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              bech32,
-  const size_t             page,
-  const size_t             max_results)
+void
+cardano_blockfrost_url_builder_append_number(cardano_blockfrost_url_builder_t* builder, const size_t value)
 {
-  blockfrost_context_t* context = (blockfrost_context_t*)provider_impl->context;
+  char digits[21] = { 0 };
 
-  char* base_path = cardano_blockfrost_get_endpoint_url(context->network, "addresses/");
+  format_number(value, digits);
+  cardano_blockfrost_url_builder_append(builder, digits);
+}
 
-  const size_t base_path_len  = cardano_utils_safe_strlen(base_path, 256U);
-  const size_t bech32_len     = cardano_utils_safe_strlen(bech32, 256U);
-  const size_t pagination_len = 50U;
-  const size_t url_len        = base_path_len + bech32_len + pagination_len + 20U;
+void
+cardano_blockfrost_url_builder_set_suffix(cardano_blockfrost_url_builder_t* builder, const char* text)
+{
+  write_at(builder, builder->prefix_size, text);
+}
 
-  char* url = malloc(256);
-  memset(url, 0, 256);
+void
+cardano_blockfrost_url_builder_set_suffix_number(cardano_blockfrost_url_builder_t* builder, const size_t value)
+{
+  char digits[21] = { 0 };
 
-  if (!url)
-  {
-    free(base_path);
+  format_number(value, digits);
+  write_at(builder, builder->prefix_size, digits);
+}
 
-    return NULL;
-  }
+const char*
+cardano_blockfrost_url_builder_get_url(const cardano_blockfrost_url_builder_t* builder)
+{
+  return builder->is_valid ? builder->url : NULL;
+}
 
-  CARDANO_UNUSED(snprintf(url, url_len, "%s%s/utxos?count=%zu&page=%zu", base_path, bech32, max_results, page));
+size_t
+cardano_blockfrost_url_builder_get_size(const cardano_blockfrost_url_builder_t* builder)
+{
+  return builder->is_valid ? builder->size : 0U;
+}
 
-  free(base_path);
+const char*
+cardano_blockfrost_build_endpoint_url(
+  cardano_blockfrost_url_builder_t* builder,
+  const cardano_network_magic_t     network,
+  const char*                       endpoint)
+{
+  cardano_blockfrost_url_builder_init(builder, network);
+  cardano_blockfrost_url_builder_append(builder, endpoint);
 
-  return url;
+  return cardano_blockfrost_url_builder_get_url(builder);
 }
 
-char*
-cardano_blockfrost_build_utxo_with_asset_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              bech32,
-  const char*              asset_id,
-  const size_t             page,
-  const size_t             max_results)
+bool
+cardano_blockfrost_build_utxo_url(
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       bech32,
+  const char*                       asset_id,
+  const size_t                      max_results)
 {
   blockfrost_context_t* context = (blockfrost_context_t*)provider_impl->context;
 
-  char* base_path = cardano_blockfrost_get_endpoint_url(context->network, "addresses/");
+  cardano_blockfrost_url_builder_init(builder, context->network);
+  cardano_blockfrost_url_builder_append(builder, "addresses/");
+  cardano_blockfrost_url_builder_append(builder, bech32);
+  cardano_blockfrost_url_builder_append(builder, "/utxos");
 
-  const size_t base_path_len  = cardano_utils_safe_strlen(base_path, 256U);
-  const size_t bech32_len     = cardano_utils_safe_strlen(bech32, 256U);
-  const size_t asset_id_len   = cardano_utils_safe_strlen(asset_id, 256U);
-  const size_t pagination_len = 50U;
-  const size_t url_len        = base_path_len + bech32_len + pagination_len + asset_id_len + 20U;
-
-  char* url = malloc(256);
-  memset(url, 0, 256);
-
-  if (!url)
+  if (asset_id != NULL)
   {
-    free(base_path);
-
-    return NULL;
+    cardano_blockfrost_url_builder_append(builder, "/");
+    cardano_blockfrost_url_builder_append(builder, asset_id);
   }
 
-  CARDANO_UNUSED(snprintf(url, url_len, "%s%s/utxos/%s?count=%zu&page=%zu", base_path, bech32, asset_id, max_results, page));
-
-  free(base_path);
+  cardano_blockfrost_url_builder_append(builder, "?count=");
+  cardano_blockfrost_url_builder_append_number(builder, max_results);
+  cardano_blockfrost_url_builder_append(builder, "&page=");
 
-  return url;
+  return builder->is_valid;
 }
 
-char*
-cardano_blockfrost_build_addresses_with_asset_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              asset_id)
+const char*
+cardano_blockfrost_build_rewards_url(
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       bech32)
 {
   blockfrost_context_t* context = (blockfrost_context_t*)provider_impl->context;
 
-  char* base_path = cardano_blockfrost_get_endpoint_url(context->network, "assets/");
+  cardano_blockfrost_url_builder_init(builder, context->network);
+  cardano_blockfrost_url_builder_append(builder, "accounts/");
 
-  const size_t base_path_len  = cardano_utils_safe_strlen(base_path, 256U);
-  const size_t asset_id_len   = cardano_utils_safe_strlen(asset_id, 256U);
-  const size_t pagination_len = 50U;
-  const size_t url_len        = base_path_len + pagination_len + asset_id_len + 1U;
-
-  char* url = malloc(256);
-  memset(url, 0, 256);
-
-  if (!url)
+  if (bech32 != NULL)
   {
-    free(base_path);
-
-    return NULL;
+    cardano_blockfrost_url_builder_set_suffix(builder, bech32);
   }
 
-  CARDANO_UNUSED(snprintf(url, url_len, "%s%s/addresses", base_path, asset_id));
-
-  free(base_path);
-
-  return url;
+  return cardano_blockfrost_url_builder_get_url(builder);
 }
 
-char*
-cardano_blockfrost_build_transaction_utxos_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              tx_id)
+const char*
+cardano_blockfrost_build_addresses_with_asset_url(
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       asset_id)
 {
   blockfrost_context_t* context = (blockfrost_context_t*)provider_impl->context;
 
-  char* base_path = cardano_blockfrost_get_endpoint_url(context->network, "txs/");
-
-  const size_t base_path_len = cardano_utils_safe_strlen(base_path, 256U);
-  const size_t tx_id_len     = cardano_utils_safe_strlen(tx_id, 256U);
-  const size_t url_len       = base_path_len + tx_id_len + 10U;
-
-  char* url = malloc(256);
-  memset(url, 0, 256);
-
-  if (!url)
-  {
-    free(base_path);
-
-    return NULL;
-  }
-
-  CARDANO_UNUSED(snprintf(url, url_len, "%s%s/utxos", base_path, tx_id));
-
-  free(base_path);
+  cardano_blockfrost_url_builder_init(builder, context->network);
+  cardano_blockfrost_url_builder_append(builder, "assets/");
+  cardano_blockfrost_url_builder_append(builder, asset_id);
+  cardano_blockfrost_url_builder_append(builder, "/addresses");
 
-  return url;
+  return cardano_blockfrost_url_builder_get_url(builder);
 }
 
-char*
-cardano_blockfrost_build_datum_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              datum_hash)
+const char*
+cardano_blockfrost_build_transaction_utxos_url(
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       tx_id)
 {
   blockfrost_context_t* context = (blockfrost_context_t*)provider_impl->context;
 
-  char* base_path = cardano_blockfrost_get_endpoint_url(context->network, "scripts/datum/");
-
-  const size_t base_path_len  = cardano_utils_safe_strlen(base_path, 256U);
-  const size_t datum_hash_len = cardano_utils_safe_strlen(datum_hash, 256U);
-  const size_t url_len        = base_path_len + datum_hash_len + 6U;
-
-  char* url = malloc(256);
-  memset(url, 0, 256);
+  cardano_blockfrost_url_builder_init(builder, context->network);
+  cardano_blockfrost_url_builder_append(builder, "txs/");
+  cardano_blockfrost_url_builder_append(builder, tx_id);
+  cardano_blockfrost_url_builder_append(builder, "/utxos");
 
-  if (!url)
-  {
-    free(base_path);
-
-    return NULL;
-  }
-
-  CARDANO_UNUSED(snprintf(url, url_len, "%s%s/cbor", base_path, datum_hash));
-
-  free(base_path);
-
-  return url;
+  return cardano_blockfrost_url_builder_get_url(builder);
 }
 
-char*
-cardano_blockfrost_build_rewards_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              bech32)
+const char*
+cardano_blockfrost_build_datum_url(
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       datum_hash)
 {
   blockfrost_context_t* context = (blockfrost_context_t*)provider_impl->context;
 
-  char* base_path = cardano_blockfrost_get_endpoint_url(context->network, "accounts/");
-
-  const size_t base_path_len = cardano_utils_safe_strlen(base_path, 256U);
-  const size_t bech32_len    = cardano_utils_safe_strlen(bech32, 256U);
-  ;
-  const size_t url_len = base_path_len + bech32_len + 1U;
-
-  char* url = malloc(256);
-  memset(url, 0, 256);
-
-  if (!url)
-  {
-    free(base_path);
-
-    return NULL;
-  }
-
-  CARDANO_UNUSED(snprintf(url, url_len, "%s%s", base_path, bech32));
+  cardano_blockfrost_url_builder_init(builder, context->network);
+  cardano_blockfrost_url_builder_append(builder, "scripts/datum/");
+  cardano_blockfrost_url_builder_append(builder, datum_hash);
+  cardano_blockfrost_url_builder_append(builder, "/cbor");
 
-  free(base_path);
-
-  return url;
+  return cardano_blockfrost_url_builder_get_url(builder);
 }
 
-char*
+const char*
 cardano_blockfrost_build_tx_metadata_cbor_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              hash)
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       hash)
 {
   blockfrost_context_t* context = (blockfrost_context_t*)provider_impl->context;
 
-  char* base_path = cardano_blockfrost_get_endpoint_url(context->network, "txs/");
-
-  const size_t base_path_len = cardano_utils_safe_strlen(base_path, 256U);
-  const size_t hash_len      = cardano_utils_safe_strlen(hash, 256U);
-  const size_t url_len       = base_path_len + hash_len + 20U;
-
-  char* url = malloc(256);
-
-  if (!url)
-  {
-    free(base_path);
-
-    return NULL;
-  }
-
-  memset(url, 0, 256);
+  cardano_blockfrost_url_builder_init(builder, context->network);
+  cardano_blockfrost_url_builder_append(builder, "txs/");
+  cardano_blockfrost_url_builder_append(builder, hash);
+  cardano_blockfrost_url_builder_append(builder, "/metadata/cbor");
 
-  CARDANO_UNUSED(snprintf(url, url_len, "%s%s/metadata/cbor", base_path, hash));
-
-  free(base_path);
-
-  return url;
-}
\ No newline at end of file
+  return cardano_blockfrost_url_builder_get_url(builder);
+}
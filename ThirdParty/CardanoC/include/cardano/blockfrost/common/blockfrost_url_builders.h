@@ -30,6 +30,31 @@
 #include <cardano/providers/provider_impl.h>
 #include <cardano/typedefs.h>
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The size of the buffer a URL builder formats a Blockfrost URL into, null terminator included.
+ */
+#define CARDANO_BLOCKFROST_URL_CAPACITY 256U
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A Blockfrost URL formatted in place, in two parts: a prefix, such as the base URL and path of a paged query,
+ * built once, and a suffix, such as the page number, rewritten for each request.
+ *
+ * Builders live on the stack or in an array kept for a whole query, so building the URL of a request allocates
+ * nothing. A URL that does not fit in \ref CARDANO_BLOCKFROST_URL_CAPACITY bytes, or the base URL of an unknown
+ * network, leaves the builder invalid, and every later call does nothing.
+ */
+typedef struct cardano_blockfrost_url_builder_t
+{
+    char   url[CARDANO_BLOCKFROST_URL_CAPACITY];
+    size_t prefix_size;
+    size_t size;
+    bool   is_valid;
+} cardano_blockfrost_url_builder_t;
+
 /* DECLARATIONS **************************************************************/
 
 #ifdef __cplusplus
@@ -39,169 +64,195 @@ extern "C" {
 /**
  * \brief Retrieves the base URL for the Blockfrost API corresponding to the specified Cardano network.
  *
- * This function returns the appropriate base URL for the Blockfrost API based on the Cardano network specified
- * by the `network` parameter. It selects the URL for either the mainnet or testnet based on the network magic value.
+ * \param[in] network A `cardano_network_magic_t` enum specifying the network type.
  *
- * \param[in] network A `cardano_network_magic_t` enum specifying the network type. Typically, mainnet and testnet
- *                    networks have different magic values.
- *
- * \return A pointer to a constant string containing the base URL for the specified network.
- *         The returned string is either the URL for the mainnet or testnet.
- *
- * \note The returned URL is a constant string and should not be modified or freed.
+ * \return A pointer to a constant string containing the base URL for the specified network, or NULL for an unknown
+ *         network. The returned URL is a constant string and should not be modified or freed.
  */
 const char*
 cardano_blockfrost_get_network_base_url(cardano_network_magic_t network);
 
 /**
- * \brief Constructs the full URL for a given endpoint on the Blockfrost API based on the specified Cardano network.
+ * \brief Starts a URL with the base URL of the Blockfrost API for a network, as its prefix.
+ *
+ * \param[out] builder The builder to initialize.
+ * \param[in] network The Cardano network the URL is for.
+ */
+void
+cardano_blockfrost_url_builder_init(cardano_blockfrost_url_builder_t* builder, cardano_network_magic_t network);
+
+/**
+ * \brief Appends a null-terminated string to the prefix of a URL.
  *
- * This function combines the base URL for the specified network (mainnet or testnet) with the provided API endpoint.
- * The full URL is dynamically allocated and should be freed by the caller.
+ * The prefix ends after the appended text, so a suffix set before is kept as part of it.
  *
- * \param[in] network  A `cardano_network_magic_t` enum specifying the Cardano network (mainnet or testnet).
- * \param[in] endpoint A pointer to a null-terminated string that specifies the API endpoint (e.g., "/blocks/latest").
+ * \param[in,out] builder The URL builder.
+ * \param[in] text The text to append.
+ */
+void
+cardano_blockfrost_url_builder_append(cardano_blockfrost_url_builder_t* builder, const char* text);
+
+/**
+ * \brief Appends the decimal digits of a number to the prefix of a URL.
  *
- * \return A dynamically allocated string containing the full URL for the specified endpoint on the network.
- *         The caller is responsible for freeing the returned string.
+ * \param[in,out] builder The URL builder.
+ * \param[in] value The number to append.
+ */
+void
+cardano_blockfrost_url_builder_append_number(cardano_blockfrost_url_builder_t* builder, size_t value);
+
+/**
+ * \brief Replaces the suffix of a URL, whatever follows its prefix, with a null-terminated string.
  *
- * \note If memory allocation fails, this function returns `NULL`.
+ * \param[in,out] builder The URL builder.
+ * \param[in] text The new suffix; an empty string leaves the prefix alone.
  */
-char*
-cardano_blockfrost_get_endpoint_url(cardano_network_magic_t network, const char* endpoint);
+void
+cardano_blockfrost_url_builder_set_suffix(cardano_blockfrost_url_builder_t* builder, const char* text);
 
 /**
- * \brief Constructs a URL string for retrieving UTXOs for a given address.
+ * \brief Replaces the suffix of a URL, whatever follows its prefix, with the decimal digits of a number.
  *
- * The function constructs the URL string for a Cardano API request that retrieves the UTXOs
- * associated with a Bech32 address. The URL includes pagination parameters (`count` and `page`).
+ * \param[in,out] builder The URL builder.
+ * \param[in] value The number, such as the page of a paged query.
+ */
+void
+cardano_blockfrost_url_builder_set_suffix_number(cardano_blockfrost_url_builder_t* builder, size_t value);
+
+/**
+ * \brief Gets the URL a builder formatted.
  *
- * \param[in]  provider_impl Pointer to the provider implementation instance.
- * \param[in]  bech32        Bech32 address for which to retrieve UTXOs.
- * \param[in]  page          The current page of results.
- * \param[in]  max_results   The maximum number of results to return.
+ * \param[in] builder The URL builder.
  *
- * \return A dynamically allocated string containing the full URL.
- *         The caller is responsible for freeing the returned string.
+ * \return The null-terminated URL, owned by the builder, or NULL if it did not fit or its network is unknown.
  */
-char*
-cardano_blockfrost_build_utxo_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              bech32,
-  size_t                   page,
-  size_t                   max_results);
+const char*
+cardano_blockfrost_url_builder_get_url(const cardano_blockfrost_url_builder_t* builder);
 
 /**
- * \brief Constructs the URL for retrieving staking rewards from the Blockfrost API for a given Bech32 address.
+ * \brief Gets the length of the URL a builder formatted, without its null terminator.
+ *
+ * \param[in] builder The URL builder.
  *
- * This function constructs a URL used to query the Blockfrost API for the staking rewards associated with the specified Bech32 address.
+ * \return The length of the URL, or zero if the builder is invalid.
+ */
+size_t
+cardano_blockfrost_url_builder_get_size(const cardano_blockfrost_url_builder_t* builder);
+
+/**
+ * \brief Builds the URL of an endpoint of the Blockfrost API, such as `tx/submit`, with nothing left to add.
  *
- * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context (e.g., API base URL).
- *                          This parameter must not be NULL.
- * \param[in] bech32 A pointer to a null-terminated string containing the Bech32 address for which to retrieve rewards.
- *                   This parameter must not be NULL.
+ * \param[out] builder The builder to initialize.
+ * \param[in] network The Cardano network the URL is for.
+ * \param[in] endpoint The path of the endpoint, relative to the base URL.
  *
- * \return A dynamically allocated string containing the full URL for querying rewards. The caller is responsible for freeing the returned string
- *         using \c free when it is no longer needed. Returns NULL if the URL could not be constructed (e.g., due to invalid input).
+ * \return The URL, owned by \p builder, or NULL if it could not be built.
  */
-char*
-cardano_blockfrost_build_rewards_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              bech32);
+const char*
+cardano_blockfrost_build_endpoint_url(
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_network_magic_t           network,
+  const char*                       endpoint);
 
 /**
- * \brief Constructs the URL for retrieving UTXOs associated with a given Bech32 address and asset ID from the Blockfrost API.
+ * \brief Builds the prefix of the URLs of the pages of the UTxOs of an address, optionally restricted to an asset.
  *
- * This function constructs a URL used to query the Blockfrost API for the UTXOs that are associated with the specified Bech32 address and asset ID.
- * The URL will also include pagination parameters, allowing the user to specify the page and the maximum number of results per page.
+ * The prefix ends with `page=`, so each page only sets its number with
+ * \ref cardano_blockfrost_url_builder_set_suffix_number.
  *
- * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context (e.g., API base URL).
- *                          This parameter must not be NULL.
- * \param[in] bech32 A pointer to a null-terminated string containing the Bech32 address for which to retrieve UTXOs. This parameter must not be NULL.
- * \param[in] asset_id A pointer to a null-terminated string containing the asset ID to filter the UTXOs by. This parameter must not be NULL.
- * \param[in] page The page number to retrieve. Used for pagination.
- * \param[in] max_results The maximum number of results to retrieve per page.
+ * \param[out] builder The builder to initialize.
+ * \param[in] provider_impl Pointer to the provider implementation instance.
+ * \param[in] bech32 Bech32 address for which to retrieve UTxOs.
+ * \param[in] asset_id The hex asset ID to filter the UTxOs by, or NULL for every UTxO.
+ * \param[in] max_results The maximum number of results of a page.
  *
- * \return A dynamically allocated string containing the full URL for querying UTXOs with the specified asset. The caller is responsible for freeing the
- *         returned string using \c free when it is no longer needed. Returns NULL if the URL could not be constructed (e.g., due to invalid input).
+ * \return True if the prefix fits in the builder, false otherwise.
  */
-char*
-cardano_blockfrost_build_utxo_with_asset_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              bech32,
-  const char*              asset_id,
-  size_t                   page,
-  size_t                   max_results);
+bool
+cardano_blockfrost_build_utxo_url(
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       bech32,
+  const char*                       asset_id,
+  size_t                            max_results);
 
 /**
- * \brief Constructs the URL for retrieving addresses associated with a given asset ID from the Blockfrost API.
+ * \brief Builds the URL for retrieving the staking rewards of a Bech32 reward address.
  *
- * This function constructs a URL used to query the Blockfrost API for the addresses that hold the specified asset.
+ * The prefix of the URL ends before the address, so the URLs of several accounts can replace just that with
+ * \ref cardano_blockfrost_url_builder_set_suffix.
  *
- * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context (e.g., API base URL).
- *                          This parameter must not be NULL.
- * \param[in] asset_id A pointer to a null-terminated string containing the asset ID to query for addresses. This parameter must not be NULL.
+ * \param[out] builder The builder to initialize.
+ * \param[in] provider_impl Pointer to the provider implementation instance.
+ * \param[in] bech32 The reward address, or NULL to build the prefix only.
  *
- * \return A dynamically allocated string containing the full URL for querying addresses holding the specified asset. The caller is responsible for freeing the
- *         returned string using \c free when it is no longer needed. Returns NULL if the URL could not be constructed (e.g., due to invalid input).
+ * \return The URL, owned by \p builder, or NULL if it could not be built.
  */
-char*
-cardano_blockfrost_build_addresses_with_asset_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              asset_id);
+const char*
+cardano_blockfrost_build_rewards_url(
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       bech32);
 
 /**
- * \brief Constructs a URL for retrieving UTXOs from a transaction.
+ * \brief Builds the URL for retrieving the addresses holding an asset.
  *
- * This function constructs the URL required to fetch the UTXOs associated with a given transaction ID.
- * The URL is built based on the Blockfrost API and the network details provided in the `provider_impl`.
+ * \param[out] builder The builder to initialize.
+ * \param[in] provider_impl Pointer to the provider implementation instance.
+ * \param[in] asset_id The hex asset ID.
  *
- * \param[in] provider_impl A pointer to the provider implementation that contains network information.
- * \param[in] tx_id         A string representing the transaction ID.
+ * \return The URL, owned by \p builder, or NULL if it could not be built.
+ */
+const char*
+cardano_blockfrost_build_addresses_with_asset_url(
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       asset_id);
+
+/**
+ * \brief Builds the URL for retrieving the UTxOs of a transaction.
+ *
+ * \param[out] builder The builder to initialize.
+ * \param[in] provider_impl Pointer to the provider implementation instance.
+ * \param[in] tx_id The hex transaction ID.
  *
- * \return A dynamically allocated string containing the constructed URL, or NULL if memory allocation fails.
- *         The caller is responsible for freeing the memory returned by this function.
+ * \return The URL, owned by \p builder, or NULL if it could not be built.
  */
-char*
+const char*
 cardano_blockfrost_build_transaction_utxos_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              tx_id);
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       tx_id);
 
 /**
- * \brief Constructs a URL to query a datum by its hash from the Blockfrost API.
- *
- * This function constructs a URL string that can be used to retrieve a datum from the Blockfrost API by providing its hash.
+ * \brief Builds the URL for retrieving the CBOR of a datum by its hash.
  *
- * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object that contains the necessary context for building the URL.
- *                          This parameter must not be NULL.
- * \param[in] datum_hash A pointer to a null-terminated string representing the datum hash. This parameter must not be NULL.
+ * \param[out] builder The builder to initialize.
+ * \param[in] provider_impl Pointer to the provider implementation instance.
+ * \param[in] datum_hash The hex datum hash.
  *
- * \return A pointer to a dynamically allocated string containing the URL to query the datum. The caller is responsible for freeing
- *         the returned string using \c free when it is no longer needed. If an error occurs (e.g., invalid parameters), the function returns NULL.
+ * \return The URL, owned by \p builder, or NULL if it could not be built.
  */
-char*
+const char*
 cardano_blockfrost_build_datum_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              datum_hash);
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       datum_hash);
 
 /**
- * \brief Constructs a URL to query transaction metadata in CBOR format from the Blockfrost API.
+ * \brief Builds the URL for retrieving the metadata of a transaction in CBOR format.
  *
- * This function builds a URL string that can be used to retrieve transaction metadata (in CBOR format) from the Blockfrost API
- * by providing the transaction hash.
+ * \param[out] builder The builder to initialize.
+ * \param[in] provider_impl Pointer to the provider implementation instance.
+ * \param[in] hash The hex transaction hash.
  *
- * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object that contains the necessary context for building the URL.
- *                          This parameter must not be NULL.
- * \param[in] hash A pointer to a null-terminated string representing the transaction hash. This parameter must not be NULL.
- *
- * \return A pointer to a dynamically allocated string containing the URL to query the transaction metadata in CBOR format.
- *         The caller is responsible for freeing the returned string using \c free when it is no longer needed.
- *         If an error occurs (e.g., invalid parameters), the function returns NULL.
+ * \return The URL, owned by \p builder, or NULL if it could not be built.
  */
-char*
+const char*
 cardano_blockfrost_build_tx_metadata_cbor_url(
-  cardano_provider_impl_t* provider_impl,
-  const char*              hash);
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       hash);
 
 #ifdef __cplusplus
 }
@@ -24,7 +24,7 @@
 #include "blockfrost_parsers.h"
 #include "../../utils.h"
 
-#include <cardano/json/json_object.h>
+#include <cardano/json/json_reader.h>
 #include <string.h>
 
 /* STATIC FUNCTIONS **********************************************************/
@@ -36,35 +36,54 @@ cardano_blockfrost_parse_datum(
   const size_t             size,
   cardano_plutus_data_t**  datum)
 {
-  cardano_json_object_t* parsed_json = cardano_json_object_parse(json, size);
+  cardano_json_reader_t*    json_reader = cardano_json_reader_new(json, size);
+  cardano_json_token_type_t token       = CARDANO_JSON_TOKEN_TYPE_NONE;
 
-  if (parsed_json == NULL)
+  if ((json_reader == NULL) || (cardano_json_reader_read(json_reader, &token) != CARDANO_SUCCESS) || (token != CARDANO_JSON_TOKEN_TYPE_START_OBJECT))
   {
     cardano_utils_set_error_message(provider, "Failed to parse JSON response");
-    cardano_json_object_unref(&parsed_json);
+    cardano_json_reader_unref(&json_reader);
 
     return CARDANO_ERROR_INVALID_JSON;
   }
 
-  cardano_json_object_t* datum_obj = NULL;
+  const char* datum_data = NULL;
+  size_t      datum_len  = 0U;
+
+  while ((datum_data == NULL) && (cardano_json_reader_read(json_reader, &token) == CARDANO_SUCCESS) && (token == CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME))
+  {
+    if (!cardano_json_reader_property_equals(json_reader, "cbor", 4))
+    {
+      if (cardano_json_reader_skip(json_reader) != CARDANO_SUCCESS)
+      {
+        break;
+      }
+
+      continue;
+    }
+
+    if ((cardano_json_reader_read(json_reader, &token) != CARDANO_SUCCESS) || (token != CARDANO_JSON_TOKEN_TYPE_STRING))
+    {
+      break;
+    }
+
+    datum_data = cardano_json_reader_get_string(json_reader, &datum_len);
+  }
 
-  if (!cardano_json_object_get_ex(parsed_json, "cbor", 4, &datum_obj))
+  if (datum_data == NULL)
   {
     cardano_utils_set_error_message(provider, "Failed to parse datum from JSON response");
-    cardano_json_object_unref(&parsed_json);
+    cardano_json_reader_unref(&json_reader);
 
     return CARDANO_ERROR_INVALID_JSON;
   }
 
-  size_t      datum_len  = 0U;
-  const char* datum_data = cardano_json_object_get_string(datum_obj, &datum_len);
-
-  cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(datum_data, datum_len - 1U);
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(datum_data, datum_len);
 
   if (!reader)
   {
     cardano_utils_set_error_message(provider, "Failed to parse datum from JSON response");
-    cardano_json_object_unref(&parsed_json);
+    cardano_json_reader_unref(&json_reader);
 
     return CARDANO_ERROR_INVALID_JSON;
   }
@@ -72,7 +91,7 @@ cardano_blockfrost_parse_datum(
   cardano_error_t error = cardano_plutus_data_from_cbor(reader, datum);
 
   cardano_cbor_reader_unref(&reader);
-  cardano_json_object_unref(&parsed_json);
+  cardano_json_reader_unref(&json_reader);
 
   return error;
 }
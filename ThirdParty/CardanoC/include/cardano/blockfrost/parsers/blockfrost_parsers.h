@@ -116,7 +116,7 @@ cardano_blockfrost_parse_tx_unspent_outputs(
  * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object that contains the necessary context for querying the Blockfrost API.
  *                          This parameter must not be NULL.
  * \param[in] script_hash A pointer to a character array representing the script hash, which is used to identify the script on the blockchain.
- *                        This string must be null-terminated.
+ *                        It does not need to be null-terminated.
  * \param[in] script_hash_len The length of the \p script_hash string.
  * \param[out] script On successful execution, this will point to a newly created \ref cardano_script_t object representing the script retrieved from the Blockfrost API.
  *                    The caller is responsible for managing the lifecycle of this object and must call \ref cardano_script_unref when it is no longer needed.
@@ -23,7 +23,7 @@
 
 #include "../../utils.h"
 
-#include <cardano/json/json_object.h>
+#include <cardano/json/json_reader.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -34,12 +34,12 @@
  *
  * This typedef defines a function pointer type for handling various types of protocol
  * parameters during JSON parsing. The handler function is responsible for extracting
- * the relevant parameter from the JSON object and applying the appropriate setter
+ * the relevant parameter from the JSON reader and applying the appropriate setter
  * function to store the parameter in the protocol parameters structure.
  *
  * \param[in] key         The key identifying the parameter in the JSON object.
  * \param[in] parameters   A pointer to the cardano_protocol_parameters_t structure where the parameter will be set.
- * \param[in] json_obj     The JSON object containing the parameter value to be processed.
+ * \param[in] reader       The JSON reader, positioned at the parameter value. Values that are `null` never reach the handler.
  * \param[in] setter_func  A function pointer to the appropriate setter function for the parameter.
  *
  * \return CARDANO_SUCCESS on success, or an appropriate error code on failure.
@@ -47,7 +47,7 @@
 typedef cardano_error_t (*parameter_handler_t)(
   const char*                    key,
   cardano_protocol_parameters_t* parameters,
-  cardano_json_object_t*         json_obj,
+  cardano_json_reader_t*         reader,
   void*                          setter_func);
 
 /* STRUCTURES ****************************************************************/
@@ -82,11 +82,11 @@ typedef struct
 /**
  * \brief Processes a cost model from a JSON array for a given Plutus language version.
  *
- * This function extracts the cost model data from a JSON array, which contains the cost parameters
+ * This function reads the cost model data from a JSON array, which contains the cost parameters
  * for the specified Plutus language version. The extracted values are used to create a
  * \ref cardano_cost_model_t object that is associated with the corresponding language version.
  *
- * \param[in]  json_array       The JSON array containing the cost model values.
+ * \param[in]  reader           The JSON reader, positioned at the property holding the cost model array.
  * \param[in]  language_version The Plutus language version for which the cost model is being processed.
  *                              This should be one of the \ref cardano_plutus_language_version_t values (e.g., V1, V2, V3).
  * \param[out] cost_model       A pointer to a pointer of the \ref cardano_cost_model_t structure,
@@ -98,31 +98,64 @@ typedef struct
  */
 static cardano_error_t
 process_cost_model(
-  cardano_json_object_t*                  json_array,
+  cardano_json_reader_t*                  reader,
   const cardano_plutus_language_version_t language_version,
   cardano_cost_model_t**                  cost_model)
 {
-  const size_t array_len  = cardano_json_object_array_get_length(json_array);
-  int64_t*     cost_array = malloc(array_len * sizeof(int64_t));
+  cardano_json_token_type_t token = CARDANO_JSON_TOKEN_TYPE_NONE;
+
+  if ((cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS) || (token != CARDANO_JSON_TOKEN_TYPE_START_ARRAY))
+  {
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  // Current cost models have a few hundred entries, so the array rarely needs to grow.
+  size_t   capacity   = 512U;
+  size_t   array_len  = 0U;
+  int64_t* cost_array = malloc(capacity * sizeof(int64_t));
 
   if (cost_array == NULL)
   {
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  for (size_t i = 0U; i < array_len; ++i)
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  while (result == CARDANO_SUCCESS)
   {
-    cardano_json_object_t* item   = cardano_json_object_array_get_ex(json_array, i);
-    cardano_error_t        result = cardano_json_object_get_signed_int(item, &cost_array[i]);
+    if (cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS)
+    {
+      result = CARDANO_ERROR_INVALID_JSON;
+      break;
+    }
+
+    if (token == CARDANO_JSON_TOKEN_TYPE_END_ARRAY)
+    {
+      break;
+    }
 
-    if (result != CARDANO_SUCCESS)
+    if (array_len == capacity)
     {
-      free(cost_array);
-      return result;
+      int64_t* grown = realloc(cost_array, (capacity * 2U) * sizeof(int64_t));
+
+      if (grown == NULL)
+      {
+        result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+        break;
+      }
+
+      cost_array = grown;
+      capacity *= 2U;
     }
+
+    result = cardano_json_reader_get_signed_int(reader, &cost_array[array_len]);
+    ++array_len;
   }
 
-  cardano_error_t result = cardano_cost_model_new(language_version, cost_array, array_len, cost_model);
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cost_model_new(language_version, cost_array, array_len, cost_model);
+  }
 
   free(cost_array);
 
@@ -139,7 +172,7 @@ process_cost_model(
  * \param[in]  key         The JSON key associated with the parameter to extract.
  * \param[in]  parameters  A pointer to the \ref cardano_protocol_parameters_t structure that holds
  *                         the protocol parameters to be updated.
- * \param[in]  json_obj    A pointer to the JSON object from which the `uint64_t` value will be extracted.
+ * \param[in]  reader      A pointer to the JSON reader, positioned at the value from which the `uint64_t` value will be extracted.
  * \param[in]  setter_func A function pointer to the setter function that takes the extracted `uint64_t`
  *                         value and applies it to the \ref cardano_protocol_parameters_t structure.
  *
@@ -150,14 +183,14 @@ static cardano_error_t
 handle_uint64(
   const char*                    key,
   cardano_protocol_parameters_t* parameters,
-  cardano_json_object_t*         json_obj,
+  cardano_json_reader_t*         reader,
   cardano_error_t (*setter_func)(cardano_protocol_parameters_t*, uint64_t))
 {
   CARDANO_UNUSED(key);
 
   uint64_t value = 0U;
 
-  cardano_error_t result = cardano_json_object_get_uint(json_obj, &value);
+  cardano_error_t result = cardano_json_reader_get_uint(reader, &value);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -177,7 +210,7 @@ handle_uint64(
  * \param[in]  key         The JSON key associated with the unit interval parameter to extract.
  * \param[in]  parameters  A pointer to the \ref cardano_protocol_parameters_t structure that holds
  *                         the protocol parameters to be updated.
- * \param[in]  json_obj    A pointer to the JSON object from which the unit interval will be extracted.
+ * \param[in]  reader      A pointer to the JSON reader, positioned at the value from which the unit interval will be extracted.
  * \param[in]  setter_func A function pointer to the setter function that takes the extracted
  *                         `cardano_unit_interval_t` value and applies it to the \ref cardano_protocol_parameters_t structure.
  *
@@ -188,13 +221,13 @@ static cardano_error_t
 handle_unit_interval(
   const char*                    key,
   cardano_protocol_parameters_t* parameters,
-  cardano_json_object_t*         json_obj,
+  cardano_json_reader_t*         reader,
   cardano_error_t (*setter_func)(cardano_protocol_parameters_t*, cardano_unit_interval_t*))
 {
   CARDANO_UNUSED(key);
 
   double          value  = 0.0;
-  cardano_error_t result = cardano_json_object_get_double(json_obj, &value);
+  cardano_error_t result = cardano_json_reader_get_double(reader, &value);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -226,7 +259,7 @@ handle_unit_interval(
  * \param[in]  key         The JSON key associated with the version parameter to extract.
  * \param[in]  parameters  A pointer to the \ref cardano_protocol_parameters_t structure that holds
  *                         the protocol parameters to be updated.
- * \param[in]  json_obj    A pointer to the JSON object from which the version information will be extracted.
+ * \param[in]  reader      A pointer to the JSON reader, positioned at the value from which the version information will be extracted.
  * \param[in]  setter_func A function pointer to the setter function that takes the constructed
  *                         \ref cardano_protocol_version_t and applies it to the \ref cardano_protocol_parameters_t structure.
  *
@@ -237,11 +270,11 @@ static cardano_error_t
 handle_version(
   const char*                    key,
   cardano_protocol_parameters_t* parameters,
-  cardano_json_object_t*         json_obj,
+  cardano_json_reader_t*         reader,
   cardano_error_t (*setter_func)(cardano_protocol_parameters_t*, cardano_protocol_version_t*))
 {
   uint64_t        value  = 0U;
-  cardano_error_t result = cardano_json_object_get_uint(json_obj, &value);
+  cardano_error_t result = cardano_json_reader_get_uint(reader, &value);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -288,7 +321,7 @@ handle_version(
  *                         This is expected to differentiate between the "price_mem" and "price_step" fields.
  * \param[in]  parameters  A pointer to the \ref cardano_protocol_parameters_t structure
  *                         that holds the protocol parameters to be updated.
- * \param[in]  json_obj    A pointer to the JSON object from which the price information
+ * \param[in]  reader      A pointer to the JSON reader, positioned at the value from which the price information
  *                         (for both memory and steps) will be extracted.
  * \param[in]  setter_func A function pointer to the setter function that takes the constructed
  *                         \ref cardano_ex_unit_prices_t structure and applies it to the \ref cardano_protocol_parameters_t structure.
@@ -300,12 +333,12 @@ static cardano_error_t
 handle_prices(
   const char*                    key,
   cardano_protocol_parameters_t* parameters,
-  cardano_json_object_t*         json_obj,
+  cardano_json_reader_t*         reader,
   cardano_error_t (*setter_func)(cardano_protocol_parameters_t*, cardano_ex_unit_prices_t*))
 {
   double value = 0.0;
 
-  cardano_error_t result = cardano_json_object_get_double(json_obj, &value);
+  cardano_error_t result = cardano_json_reader_get_double(reader, &value);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -362,7 +395,7 @@ handle_prices(
  *
  * \param[in]  key         The JSON key associated with the execution units to extract (e.g., "max_tx_ex_mem", "max_tx_ex_steps").
  * \param[in]  parameters  A pointer to the \ref cardano_protocol_parameters_t structure that holds the protocol parameters to be updated.
- * \param[in]  json_obj    A pointer to the JSON object from which the maximum execution units will be extracted.
+ * \param[in]  reader      A pointer to the JSON reader, positioned at the value from which the maximum execution units will be extracted.
  * \param[in]  setter_func A function pointer to the setter function that takes the constructed
  *                         \ref cardano_ex_units_t structure and applies it to the \ref cardano_protocol_parameters_t structure.
  *
@@ -373,12 +406,12 @@ static cardano_error_t
 handle_max_ex(
   const char*                    key,
   cardano_protocol_parameters_t* parameters,
-  cardano_json_object_t*         json_obj,
+  cardano_json_reader_t*         reader,
   cardano_error_t (*setter_func)(cardano_protocol_parameters_t*, cardano_ex_units_t*))
 {
   uint64_t value = 0U;
 
-  cardano_error_t result = cardano_json_object_get_uint(json_obj, &value);
+  cardano_error_t result = cardano_json_reader_get_uint(reader, &value);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -427,7 +460,7 @@ handle_max_ex(
  *
  * \param[in]  key         The JSON key associated with the specific pool voting threshold to extract.
  * \param[in]  parameters  A pointer to the \ref cardano_protocol_parameters_t structure that holds the protocol parameters to be updated.
- * \param[in]  json_obj    A pointer to the JSON object from which the pool voting threshold will be extracted.
+ * \param[in]  reader      A pointer to the JSON reader, positioned at the value from which the pool voting threshold will be extracted.
  * \param[in]  setter_func A function pointer to the setter function that takes the constructed
  *                         \ref cardano_pool_voting_thresholds_t structure and applies it to the \ref cardano_protocol_parameters_t structure.
  *
@@ -438,12 +471,12 @@ static cardano_error_t
 handle_pvt(
   const char*                    key,
   cardano_protocol_parameters_t* parameters,
-  cardano_json_object_t*         json_obj,
+  cardano_json_reader_t*         reader,
   cardano_error_t (*setter_func)(cardano_protocol_parameters_t*, cardano_pool_voting_thresholds_t*))
 {
   double value = 0.0;
 
-  cardano_error_t result = cardano_json_object_get_double(json_obj, &value);
+  cardano_error_t result = cardano_json_reader_get_double(reader, &value);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -512,7 +545,7 @@ handle_pvt(
  *
  * \param[in]  key         The JSON key associated with the specific DRep voting threshold to extract.
  * \param[in]  parameters  A pointer to the \ref cardano_protocol_parameters_t structure that holds the protocol parameters to be updated.
- * \param[in]  json_obj    A pointer to the JSON object from which the DRep voting threshold will be extracted.
+ * \param[in]  reader      A pointer to the JSON reader, positioned at the value from which the DRep voting threshold will be extracted.
  * \param[in]  setter_func A function pointer to the setter function that takes the constructed
  *                         \ref cardano_drep_voting_thresholds_t structure and applies it to the \ref cardano_protocol_parameters_t structure.
  *
@@ -523,12 +556,12 @@ static cardano_error_t
 handle_dvt(
   const char*                    key,
   cardano_protocol_parameters_t* parameters,
-  cardano_json_object_t*         json_obj,
+  cardano_json_reader_t*         reader,
   cardano_error_t (*setter_func)(cardano_protocol_parameters_t*, cardano_drep_voting_thresholds_t*))
 {
   double value = 0.0;
 
-  cardano_error_t result = cardano_json_object_get_double(json_obj, &value);
+  cardano_error_t result = cardano_json_reader_get_double(reader, &value);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -617,7 +650,7 @@ handle_dvt(
  *
  * \param[in]  key         The JSON key associated with the buffer to extract.
  * \param[in]  parameters  A pointer to the \ref cardano_protocol_parameters_t structure that holds the protocol parameters to be updated.
- * \param[in]  json_obj    A pointer to the JSON object from which the buffer will be extracted.
+ * \param[in]  reader      A pointer to the JSON reader, positioned at the value from which the buffer will be extracted.
  * \param[in]  setter_func A function pointer to the setter function that takes the constructed
  *                         \ref cardano_buffer_t structure and applies it to the \ref cardano_protocol_parameters_t structure.
  *
@@ -628,15 +661,20 @@ static cardano_error_t
 handle_buffer(
   const char*                    key,
   cardano_protocol_parameters_t* parameters,
-  cardano_json_object_t*         json_obj,
+  cardano_json_reader_t*         reader,
   cardano_error_t (*setter_func)(cardano_protocol_parameters_t*, cardano_buffer_t*))
 {
   CARDANO_UNUSED(key);
 
   size_t      value_len = 0U;
-  const char* value     = cardano_json_object_get_string(json_obj, &value_len);
+  const char* value     = cardano_json_reader_get_string(reader, &value_len);
+
+  if (cardano_json_reader_get_token_type(reader) != CARDANO_JSON_TOKEN_TYPE_STRING)
+  {
+    return CARDANO_ERROR_JSON_TYPE_MISMATCH;
+  }
 
-  cardano_buffer_t* entropy = cardano_buffer_from_hex(value, value_len - 1U);
+  cardano_buffer_t* entropy = cardano_buffer_from_hex(value, value_len);
 
   if (entropy == NULL)
   {
@@ -649,61 +687,16 @@ handle_buffer(
   return result;
 }
 
-/**
- * \brief Processes a cost model from a JSON object and inserts it into the cost models container.
- *
- * This function extracts the cost model for a specific Plutus language version from the given JSON object,
- * processes the cost model, and inserts it into the provided cost models container.
- *
- * \param[in]  json_obj         The JSON object that contains the cost model array associated with the Plutus version.
- * \param[in]  version_key      The JSON key used to identify the cost model in the JSON object (e.g., "PlutusV1", "PlutusV2").
- * \param[in]  language_version The Plutus language version identifier (e.g., `CARDANO_PLUTUS_LANGUAGE_VERSION_V1`).
- * \param[out] cost_models      The container to which the processed cost model will be inserted.
- *
- * \return A \ref cardano_error_t indicating the success or failure of the operation.
- *         - Other error codes depending on the cost model processing and insertion logic.
- */
-static cardano_error_t
-process_and_insert_cost_model(
-  cardano_json_object_t* json_obj,
-  const char*            version_key,
-  int                    language_version,
-  cardano_costmdls_t*    cost_models)
-{
-  cardano_json_object_t* json_version = NULL;
-
-  if (cardano_json_object_get_ex(json_obj, version_key, strlen(version_key), &json_version))
-  {
-    cardano_cost_model_t* cost_model = NULL;
-    cardano_error_t       result     = process_cost_model(json_version, language_version, &cost_model);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      return result;
-    }
-
-    result = cardano_costmdls_insert(cost_models, cost_model);
-    cardano_cost_model_unref(&cost_model);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      return result;
-    }
-  }
-
-  return CARDANO_SUCCESS;
-}
-
 /**
  * \brief Handles the parsing, processing, and setting of cost models from a JSON object.
  *
- * This function extracts and processes the cost models (e.g., Plutus V1, V2, V3) from the provided JSON object,
+ * This function reads the cost models (e.g., Plutus V1, V2, V3) from the JSON object the reader is positioned at,
  * creates the corresponding \ref cardano_costmdls_t structure, and uses the provided setter function to
- * assign the cost models to the protocol parameters.
+ * assign the cost models to the protocol parameters. Languages this library does not know are skipped.
  *
  * \param[in]  key               The JSON key associated with the cost models (e.g., "cost_models_raw").
  * \param[in]  parameters        A pointer to the \ref cardano_protocol_parameters_t structure where the cost models will be set.
- * \param[in]  json_obj          The JSON object containing the cost models.
+ * \param[in]  reader            The JSON reader, positioned at the start of the object containing the cost models.
  * \param[in]  setter_func       A function pointer that sets the processed cost models in the protocol parameters.
  *
  * \return A \ref cardano_error_t indicating the success or failure of the operation.
@@ -713,11 +706,16 @@ static cardano_error_t
 handle_cost_models(
   const char*                    key,
   cardano_protocol_parameters_t* parameters,
-  cardano_json_object_t*         json_obj,
+  cardano_json_reader_t*         reader,
   cardano_error_t (*setter_func)(cardano_protocol_parameters_t*, cardano_costmdls_t*))
 {
   CARDANO_UNUSED(key);
 
+  if (cardano_json_reader_get_token_type(reader) != CARDANO_JSON_TOKEN_TYPE_START_OBJECT)
+  {
+    return CARDANO_ERROR_JSON_TYPE_MISMATCH;
+  }
+
   cardano_costmdls_t* cost_models = NULL;
   cardano_error_t     result      = cardano_costmdls_new(&cost_models);
 
@@ -726,31 +724,57 @@ handle_cost_models(
     return result;
   }
 
-  result = process_and_insert_cost_model(json_obj, "PlutusV1", CARDANO_PLUTUS_LANGUAGE_VERSION_V1, cost_models);
+  cardano_json_token_type_t token = CARDANO_JSON_TOKEN_TYPE_NONE;
 
-  if (result != CARDANO_SUCCESS)
+  while (result == CARDANO_SUCCESS)
   {
-    cardano_costmdls_unref(&cost_models);
-    return result;
-  }
+    if (cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS)
+    {
+      result = CARDANO_ERROR_INVALID_JSON;
+      break;
+    }
 
-  result = process_and_insert_cost_model(json_obj, "PlutusV2", CARDANO_PLUTUS_LANGUAGE_VERSION_V2, cost_models);
+    if (token == CARDANO_JSON_TOKEN_TYPE_END_OBJECT)
+    {
+      break;
+    }
 
-  if (result != CARDANO_SUCCESS)
-  {
-    cardano_costmdls_unref(&cost_models);
-    return result;
-  }
+    cardano_plutus_language_version_t language_version = CARDANO_PLUTUS_LANGUAGE_VERSION_V1;
 
-  result = process_and_insert_cost_model(json_obj, "PlutusV3", CARDANO_PLUTUS_LANGUAGE_VERSION_V3, cost_models);
+    if (cardano_json_reader_property_equals(reader, "PlutusV1", 8))
+    {
+      language_version = CARDANO_PLUTUS_LANGUAGE_VERSION_V1;
+    }
+    else if (cardano_json_reader_property_equals(reader, "PlutusV2", 8))
+    {
+      language_version = CARDANO_PLUTUS_LANGUAGE_VERSION_V2;
+    }
+    else if (cardano_json_reader_property_equals(reader, "PlutusV3", 8))
+    {
+      language_version = CARDANO_PLUTUS_LANGUAGE_VERSION_V3;
+    }
+    else
+    {
+      result = cardano_json_reader_skip(reader);
+      continue;
+    }
 
-  if (result != CARDANO_SUCCESS)
+    cardano_cost_model_t* cost_model = NULL;
+    result                           = process_cost_model(reader, language_version, &cost_model);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_costmdls_insert(cost_models, cost_model);
+    }
+
+    cardano_cost_model_unref(&cost_model);
+  }
+
+  if (result == CARDANO_SUCCESS)
   {
-    cardano_costmdls_unref(&cost_models);
-    return result;
+    result = setter_func(parameters, cost_models);
   }
 
-  result = setter_func(parameters, cost_models);
   cardano_costmdls_unref(&cost_models);
 
   return result;
@@ -824,42 +848,68 @@ cardano_blockfrost_parse_protocol_parameters(
   const size_t                    size,
   cardano_protocol_parameters_t** parameters)
 {
-  cardano_json_object_t* parsed_json = cardano_json_object_parse(json, size);
+  cardano_json_reader_t*    reader = cardano_json_reader_new(json, size);
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
 
-  if (parsed_json == NULL)
+  if ((reader == NULL) || (cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS) || (token != CARDANO_JSON_TOKEN_TYPE_START_OBJECT))
   {
     cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+    cardano_json_reader_unref(&reader);
 
     return CARDANO_ERROR_INVALID_JSON;
   }
 
   cardano_error_t result = cardano_protocol_parameters_new(parameters);
-  if (result != CARDANO_SUCCESS)
+
+  while (result == CARDANO_SUCCESS)
   {
-    cardano_json_object_unref(&parsed_json);
+    if (cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS)
+    {
+      result = CARDANO_ERROR_INVALID_JSON;
+      break;
+    }
 
-    return result;
-  }
+    if (token == CARDANO_JSON_TOKEN_TYPE_END_OBJECT)
+    {
+      break;
+    }
 
-  for (parameter_map_entry_t* entry = parameter_map; entry->key != NULL; ++entry)
-  {
-    cardano_json_object_t* json_obj = NULL;
+    const parameter_map_entry_t* entry = parameter_map;
+
+    while ((entry->key != NULL) && !cardano_json_reader_property_equals(reader, entry->key, strlen(entry->key)))
+    {
+      ++entry;
+    }
 
-    if (!cardano_json_object_get_ex(parsed_json, entry->key, strlen(entry->key), &json_obj))
+    if (entry->key == NULL)
     {
+      result = cardano_json_reader_skip(reader);
       continue;
     }
 
-    result = entry->handler(entry->key, *parameters, json_obj, entry->setter_func);
+    if (cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS)
+    {
+      result = CARDANO_ERROR_INVALID_JSON;
+      break;
+    }
 
-    if (result != CARDANO_SUCCESS)
+    if (token != CARDANO_JSON_TOKEN_TYPE_NULL)
     {
-      cardano_json_object_unref(&parsed_json);
-      return result;
+      result = entry->handler(entry->key, *parameters, reader, entry->setter_func);
     }
   }
 
-  cardano_json_object_unref(&parsed_json);
+  if (result == CARDANO_ERROR_INVALID_JSON)
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_protocol_parameters_unref(parameters);
+  }
 
-  return CARDANO_SUCCESS;
-}
\ No newline at end of file
+  cardano_json_reader_unref(&reader);
+
+  return result;
+}
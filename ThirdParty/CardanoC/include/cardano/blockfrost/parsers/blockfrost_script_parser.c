@@ -34,53 +34,38 @@
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
- * \brief Constructs a URL string for a given script hash and optional path suffix.
+ * \brief Builds the prefix of the URLs of a script, up to its hash, which the requests for its type, JSON and CBOR
+ * then complete with their suffixes.
  *
- * This function constructs a URL string for the Blockfrost , including
- * optional path suffixes such as `/json` or `/cbor` for different representations of the script.
- *
- * \param[in]  provider_impl  Pointer to the provider implementation instance.
- * \param[in]  script_hash    Pointer to the script hash string to append to the URL.
+ * \param[out] builder The builder to initialize.
+ * \param[in]  provider_impl Pointer to the provider implementation instance.
+ * \param[in]  script_hash Pointer to the script hash string to append to the URL.
  * \param[in]  script_hash_len The length of the script hash string.
- * \param[in]  path_suffix    Optional path suffix to append to the URL (e.g., "/json", "/cbor").
- *                            Can be NULL or an empty string if no suffix is required.
- * \return A dynamically allocated string containing the constructed URL. The caller is responsible for freeing the returned string.
+ *
+ * \return True if the URL fits in the builder, false otherwise.
  */
-static char*
-construct_script_url_with_suffix(
-  cardano_provider_impl_t* provider_impl,
-  const char*              script_hash,
-  const size_t             script_hash_len,
-  const char*              path_suffix)
+static bool
+build_script_url(
+  cardano_blockfrost_url_builder_t* builder,
+  cardano_provider_impl_t*          provider_impl,
+  const char*                       script_hash,
+  const size_t                      script_hash_len)
 {
-  blockfrost_context_t* context = (blockfrost_context_t*)provider_impl->context;
-
-  char* base_path = cardano_blockfrost_get_endpoint_url(context->network, "scripts/");
+  blockfrost_context_t* context                               = (blockfrost_context_t*)provider_impl->context;
+  char                  hash[CARDANO_BLOCKFROST_URL_CAPACITY] = { 0 };
 
-  if (!base_path)
+  if (script_hash_len >= sizeof(hash))
   {
-    return NULL;
+    return false;
   }
 
-  const char* suffix     = path_suffix ? path_suffix : "";
-  size_t      suffix_len = cardano_utils_safe_strlen(suffix, 256U);
+  cardano_utils_safe_memcpy(hash, sizeof(hash), script_hash, script_hash_len);
 
-  size_t base_path_len = cardano_utils_safe_strlen(base_path, 256U);
-  size_t url_len       = base_path_len + script_hash_len + suffix_len + 1;
+  cardano_blockfrost_url_builder_init(builder, context->network);
+  cardano_blockfrost_url_builder_append(builder, "scripts/");
+  cardano_blockfrost_url_builder_append(builder, hash);
 
-  char* url = malloc(url_len);
-
-  if (!url)
-  {
-    free(base_path);
-    return NULL;
-  }
-
-  snprintf(url, url_len, "%s%s%s", base_path, script_hash, suffix);
-
-  free(base_path);
-
-  return url;
+  return builder->is_valid;
 }
 
 /**
@@ -338,13 +323,17 @@ cardano_blockfrost_get_script(
   const size_t             script_hash_len,
   cardano_script_t**       script)
 {
-  char* get_script_type_url = construct_script_url_with_suffix(provider_impl, script_hash, script_hash_len, NULL);
+  cardano_blockfrost_url_builder_t url = { 0 };
+
+  if (!build_script_url(&url, provider_impl, script_hash, script_hash_len))
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
 
   cardano_buffer_t* response_buffer = NULL;
   uint64_t          response_code   = 0U;
 
-  cardano_error_t result = cardano_blockfrost_http_get(provider_impl, get_script_type_url, cardano_utils_safe_strlen(get_script_type_url, 256U), &response_code, &response_buffer);
-  free(get_script_type_url);
+  cardano_error_t result = cardano_blockfrost_http_get(provider_impl, url.url, url.size, &response_code, &response_buffer);
 
   if ((response_code != 200U) || (result != CARDANO_SUCCESS))
   {
@@ -367,9 +356,8 @@ cardano_blockfrost_get_script(
 
   if (language == CARDANO_SCRIPT_LANGUAGE_NATIVE)
   {
-    char* get_script_json_url = construct_script_url_with_suffix(provider_impl, script_hash, script_hash_len, "/json");
-    result                    = cardano_blockfrost_http_get(provider_impl, get_script_json_url, cardano_utils_safe_strlen(get_script_json_url, 256U), &response_code, &response_buffer);
-    free(get_script_json_url);
+    cardano_blockfrost_url_builder_set_suffix(&url, "/json");
+    result = cardano_blockfrost_http_get(provider_impl, url.url, url.size, &response_code, &response_buffer);
 
     if ((response_code != 200U) || (result != CARDANO_SUCCESS))
     {
@@ -386,9 +374,8 @@ cardano_blockfrost_get_script(
   }
   else
   {
-    char* get_script_cbor_url = construct_script_url_with_suffix(provider_impl, script_hash, script_hash_len, "/cbor");
-    result                    = cardano_blockfrost_http_get(provider_impl, get_script_cbor_url, cardano_utils_safe_strlen(get_script_cbor_url, 256U), &response_code, &response_buffer);
-    free(get_script_cbor_url);
+    cardano_blockfrost_url_builder_set_suffix(&url, "/cbor");
+    result = cardano_blockfrost_http_get(provider_impl, url.url, url.size, &response_code, &response_buffer);
 
     if ((response_code != 200U) || (result != CARDANO_SUCCESS))
     {
@@ -421,32 +421,14 @@ transaction_input_to_json(
   const uint64_t          index = cardano_transaction_input_get_index(input);
   cardano_blake2b_hash_t* hash  = cardano_transaction_input_get_id(input);
 
-  const size_t hash_size = cardano_blake2b_hash_get_hex_size(hash);
-  char*        hash_str  = malloc(hash_size);
-
-  if (hash_str == NULL)
-  {
-    cardano_blake2b_hash_unref(&hash);
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
+  cardano_json_writer_write_property_name(writer, "id", strlen("id"));
+  cardano_json_writer_write_hex(writer, cardano_blake2b_hash_get_data(hash), cardano_blake2b_hash_get_bytes_size(hash));
 
-  cardano_error_t result = cardano_blake2b_hash_to_hex(hash, hash_str, hash_size);
   cardano_blake2b_hash_unref(&hash);
 
-  if (result != CARDANO_SUCCESS)
-  {
-    free(hash_str);
-    return result;
-  }
-
-  cardano_json_writer_write_property_name(writer, "id", strlen("id"));
-  cardano_json_writer_write_string(writer, hash_str, strlen(hash_str));
-
   cardano_json_writer_write_property_name(writer, "index", strlen("index"));
   cardano_json_writer_write_uint(writer, index);
 
-  free(hash_str);
-
   return CARDANO_SUCCESS;
 }
 
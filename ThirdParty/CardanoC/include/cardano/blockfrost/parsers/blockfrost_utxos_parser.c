@@ -21,7 +21,8 @@
 
 /* INCLUDES ******************************************************************/
 
-#include <cardano/json/json_object.h>
+#include <cardano/address/address_cache.h>
+#include <cardano/json/json_reader.h>
 
 #include "blockfrost_parsers.h"
 #include "../../utils.h"
@@ -31,84 +32,58 @@
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
- * \brief Parses an address from a JSON object and returns a \ref cardano_address_t object.
+ * \brief Reads a string property value, which Blockfrost may also send as `null`.
  *
- * This static function parses an address from the provided JSON object and converts it into a \ref cardano_address_t object.
+ * \param[in] provider A pointer to an initialized \ref cardano_provider_impl_t object used to report errors.
+ * \param[in] reader The JSON reader, positioned at a property name.
+ * \param[out] value On success, a view of the string, not null-terminated, or NULL if the value is `null`. The view is
+ *                   valid until the next read.
+ * \param[out] value_len The length of \p value.
  *
- * \param[in] provider A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context for parsing.
- *                     This parameter must not be NULL.
- * \param[in] address_obj A pointer to a \ref cardano_json_object_t representing the address in JSON format.
- *                        The object must contain the necessary fields to parse the address.
- * \param[out] address On successful parsing, this will point to a newly created \ref cardano_address_t object
- *                     representing the parsed address. The caller is responsible for managing the lifecycle of this object
- *                     and must call \ref cardano_address_unref when it is no longer needed.
- *
- * \return \ref cardano_error_t indicating the outcome of the operation. Returns \ref CARDANO_SUCCESS if the address
- *         was successfully parsed, or an appropriate error code if an error occurred (e.g., if the JSON object format is invalid).
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_INVALID_JSON if the value is neither a string nor `null`.
  */
 static cardano_error_t
-parse_address(
+read_string_value(
   cardano_provider_impl_t* provider,
-  cardano_json_object_t*   address_obj,
-  cardano_address_t**      address)
+  cardano_json_reader_t*   reader,
+  const char**             value,
+  size_t*                  value_len)
 {
-  size_t      address_len  = 0U;
-  const char* address_data = cardano_json_object_get_string(address_obj, &address_len);
+  cardano_json_token_type_t token = CARDANO_JSON_TOKEN_TYPE_NONE;
 
-  cardano_error_t result = cardano_address_from_string(address_data, address_len - 1U, address);
+  *value     = NULL;
+  *value_len = 0U;
 
-  if (result != CARDANO_SUCCESS)
+  if (cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS)
   {
-    cardano_utils_set_error_message(provider, "Failed to parse address from JSON response");
-  }
-
-  return result;
-}
-
-/**
- * \brief Parses a transaction hash from a JSON object and returns a \ref cardano_blake2b_hash_t object.
- *
- * This static function parses a transaction hash (TxHash) from the given JSON object and converts it into a \ref cardano_blake2b_hash_t object.
- *
- * \param[in] provider A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context for parsing.
- *                     This parameter must not be NULL.
- * \param[in] tx_hash_obj A pointer to a \ref cardano_json_object_t representing the transaction hash in JSON format.
- *                        The object must contain the transaction hash as expected by the parser.
- * \param[out] tx_id On successful parsing, this will point to a newly created \ref cardano_blake2b_hash_t object
- *                   representing the parsed transaction ID. The caller is responsible for managing the lifecycle of this object
- *                   and must call \ref cardano_blake2b_hash_unref when it is no longer needed.
- *
- * \return \ref cardano_error_t indicating the outcome of the operation. Returns \ref CARDANO_SUCCESS if the transaction hash
- *         was successfully parsed, or an appropriate error code if an error occurred (e.g., if the JSON object format is invalid).
- */
-static cardano_error_t
-parse_tx_hash(
-  cardano_provider_impl_t* provider,
-  cardano_json_object_t*   tx_hash_obj,
-  cardano_blake2b_hash_t** tx_id)
-{
-  size_t      tx_hash_len = 0U;
-  const char* tx_hash     = cardano_json_object_get_string(tx_hash_obj, &tx_hash_len);
+    cardano_utils_set_error_message(provider, "Failed to parse JSON response");
 
-  cardano_error_t result = cardano_blake2b_hash_from_hex(tx_hash, tx_hash_len - 1U, tx_id);
+    return CARDANO_ERROR_INVALID_JSON;
+  }
 
-  if (result != CARDANO_SUCCESS)
+  if (token == CARDANO_JSON_TOKEN_TYPE_STRING)
   {
-    cardano_utils_set_error_message(provider, "Failed to parse tx_hash from JSON response");
+    *value = cardano_json_reader_get_string(reader, value_len);
   }
+  else if (token != CARDANO_JSON_TOKEN_TYPE_NULL)
+  {
+    cardano_utils_set_error_message(provider, "Unexpected value type in JSON response");
 
-  return result;
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  return CARDANO_SUCCESS;
 }
 
 /**
  * \brief Parses an amount from a JSON array and returns a \ref cardano_value_t object.
  *
- * This static function parses a Cardano amount, which is encoded in a JSON array, and converts it into a \ref cardano_value_t object.
+ * The array holds `{ "unit": ..., "quantity": ... }` objects, where the unit is either `lovelace` or the hex-encoded
+ * asset id, and the quantity is a decimal string.
  *
  * \param[in] provider A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context for parsing.
  *                     This parameter must not be NULL.
- * \param[in] amount_array A pointer to a \ref cardano_json_object_t representing the amount in a JSON array format. The array contains
- *                         the amount in lovelaces (ADA) and, optionally, other assets.
+ * \param[in] reader The JSON reader, positioned at the `amount` property name.
  * \param[out] value On successful parsing, this will point to a newly created \ref cardano_value_t object representing
  *                   the parsed amount, including ADA and multi-assets. The caller is responsible for managing the lifecycle
  *                   of this object and must call \ref cardano_value_unref when it is no longer needed.
@@ -117,12 +92,21 @@ parse_tx_hash(
  *         successfully parsed, or an appropriate error code if an error occurred (e.g., if the JSON array format is invalid).
  */
 static cardano_error_t
-parse_amount(cardano_provider_impl_t* provider, cardano_json_object_t* amount_array, cardano_value_t** value)
+parse_amount(cardano_provider_impl_t* provider, cardano_json_reader_t* reader, cardano_value_t** value)
 {
-  size_t                  amount_len   = cardano_json_object_array_get_length(amount_array);
+  cardano_json_token_type_t token = CARDANO_JSON_TOKEN_TYPE_NONE;
+
+  if ((cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS) || (token != CARDANO_JSON_TOKEN_TYPE_START_ARRAY))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse amount from JSON response");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
   cardano_asset_id_map_t* asset_id_map = NULL;
 
   cardano_error_t result = cardano_asset_id_map_new(&asset_id_map);
+
   if (result != CARDANO_SUCCESS)
   {
     cardano_utils_set_error_message(provider, "Failed to allocate memory for asset_id_map");
@@ -130,480 +114,418 @@ parse_amount(cardano_provider_impl_t* provider, cardano_json_object_t* amount_ar
     return result;
   }
 
-  for (size_t j = 0U; j < amount_len; ++j)
+  cardano_asset_id_t* asset_id = NULL;
+
+  while (result == CARDANO_SUCCESS)
   {
-    cardano_json_object_t* amount_obj = cardano_json_object_array_get_ex(amount_array, j);
-    cardano_json_object_t* unit_obj;
-    cardano_json_object_t* quantity_obj;
+    if (cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS)
+    {
+      result = CARDANO_ERROR_INVALID_JSON;
+      break;
+    }
 
-    uint64_t            quantity = 0;
-    cardano_asset_id_t* asset_id = NULL;
+    if (token == CARDANO_JSON_TOKEN_TYPE_END_ARRAY)
+    {
+      break;
+    }
 
-    if (cardano_json_object_get_ex(amount_obj, "unit", 4, &unit_obj))
+    if (token != CARDANO_JSON_TOKEN_TYPE_START_OBJECT)
     {
-      size_t      unit_len = 0;
-      const char* unit     = cardano_json_object_get_string(unit_obj, &unit_len);
+      result = CARDANO_ERROR_INVALID_JSON;
+      break;
+    }
+
+    uint64_t quantity = 0U;
 
-      if (strcmp(unit, "lovelace") == 0)
+    while (result == CARDANO_SUCCESS)
+    {
+      if (cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS)
       {
-        result = cardano_asset_id_new_lovelace(&asset_id);
+        result = CARDANO_ERROR_INVALID_JSON;
+        break;
       }
-      else
+
+      if (token == CARDANO_JSON_TOKEN_TYPE_END_OBJECT)
       {
-        result = cardano_asset_id_from_hex(unit, unit_len - 1U, &asset_id);
+        break;
       }
 
-      if (result != CARDANO_SUCCESS)
+      if (cardano_json_reader_property_equals(reader, "unit", 4))
       {
-        cardano_utils_set_error_message(provider, "Failed to parse asset_id from JSON response");
-        cardano_asset_id_map_unref(&asset_id_map);
-
-        return result;
+        const char* unit     = NULL;
+        size_t      unit_len = 0U;
+
+        result = read_string_value(provider, reader, &unit, &unit_len);
+
+        if ((result == CARDANO_SUCCESS) && (unit != NULL))
+        {
+          cardano_asset_id_unref(&asset_id);
+
+          if ((unit_len == 8U) && (memcmp(unit, "lovelace", 8U) == 0))
+          {
+            result = cardano_asset_id_new_lovelace(&asset_id);
+          }
+          else
+          {
+            result = cardano_asset_id_from_hex(unit, unit_len, &asset_id);
+          }
+
+          if (result != CARDANO_SUCCESS)
+          {
+            cardano_utils_set_error_message(provider, "Failed to parse asset_id from JSON response");
+          }
+        }
       }
-    }
-
-    if (cardano_json_object_get_ex(amount_obj, "quantity", 8, &quantity_obj))
-    {
-      size_t      quantity_len = 0U;
-      const char* quantity_str = cardano_json_object_get_string(quantity_obj, &quantity_len);
-
-      cardano_bigint_t* bigint = NULL;
-      result                   = cardano_bigint_from_string(quantity_str, quantity_len - 1U, 10, &bigint);
-
-      if (result != CARDANO_SUCCESS)
+      else if (cardano_json_reader_property_equals(reader, "quantity", 8))
       {
-        cardano_utils_set_error_message(provider, "Failed to parse quantity from JSON response");
-        cardano_asset_id_map_unref(&asset_id_map);
-
-        return result;
+        if ((cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS) || (cardano_json_reader_get_uint(reader, &quantity) != CARDANO_SUCCESS))
+        {
+          cardano_utils_set_error_message(provider, "Failed to parse quantity from JSON response");
+          result = CARDANO_ERROR_INVALID_JSON;
+        }
+      }
+      else if (cardano_json_reader_skip(reader) != CARDANO_SUCCESS)
+      {
+        result = CARDANO_ERROR_INVALID_JSON;
       }
+    }
 
-      quantity = cardano_bigint_to_unsigned_int(bigint);
-      cardano_bigint_unref(&bigint);
+    if (result != CARDANO_SUCCESS)
+    {
+      break;
     }
 
     result = cardano_asset_id_map_insert(asset_id_map, asset_id, (int64_t)quantity);
     cardano_asset_id_unref(&asset_id);
+    asset_id = NULL;
 
     if (result != CARDANO_SUCCESS)
     {
       cardano_utils_set_error_message(provider, "Failed to insert asset_id into asset_id_map");
-      cardano_asset_id_map_unref(&asset_id_map);
-
-      return result;
     }
   }
 
-  result = cardano_value_from_asset_map(asset_id_map, value);
-  cardano_asset_id_map_unref(&asset_id_map);
-
-  if (result != CARDANO_SUCCESS)
-  {
-    cardano_utils_set_error_message(provider, "Failed to create value from asset_id_map");
-  }
-
-  return result;
-}
-
-/**
- * \brief Parses a data hash from a JSON object and returns a \ref cardano_blake2b_hash_t object.
- *
- * This static function parses a data hash from the given JSON object and converts it into a \ref cardano_blake2b_hash_t object.
- *
- * \param[in] provider A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context for parsing.
- *                     This parameter must not be NULL.
- * \param[in] data_hash_obj A pointer to a \ref cardano_json_object_t representing the data hash in JSON format. The object must contain
- *                          the necessary fields to parse the hash.
- * \param[out] data_hash On successful parsing, this will point to a newly created \ref cardano_blake2b_hash_t object
- *                       representing the parsed data hash. The caller is responsible for managing the lifecycle of this object
- *                       and must call \ref cardano_blake2b_hash_unref when it is no longer needed.
- *
- * \return \ref cardano_error_t indicating the outcome of the operation. Returns \ref CARDANO_SUCCESS if the data hash
- *         was successfully parsed, or an appropriate error code if an error occurred (e.g., if the JSON object format is invalid).
- */
-static cardano_error_t
-parse_data_hash(
-  cardano_provider_impl_t* provider,
-  cardano_json_object_t*   data_hash_obj,
-  cardano_blake2b_hash_t** data_hash)
-{
-  size_t      data_hash_len = 0U;
-  const char* data_hash_str = cardano_json_object_get_string(data_hash_obj, &data_hash_len);
+  cardano_asset_id_unref(&asset_id);
 
-  if ((data_hash_str != NULL) && (data_hash_len > 0U))
+  if (result == CARDANO_SUCCESS)
   {
-    cardano_error_t result = cardano_blake2b_hash_from_hex(data_hash_str, data_hash_len - 1U, data_hash);
+    result = cardano_value_from_asset_map(asset_id_map, value);
 
     if (result != CARDANO_SUCCESS)
     {
-      cardano_utils_set_error_message(provider, "Failed to parse data_hash from JSON response");
-
-      return result;
+      cardano_utils_set_error_message(provider, "Failed to create value from asset_id_map");
     }
   }
+  else if (result == CARDANO_ERROR_INVALID_JSON)
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse amount from JSON response");
+  }
 
-  return CARDANO_SUCCESS;
+  cardano_asset_id_map_unref(&asset_id_map);
+
+  return result;
 }
 
 /**
- * \brief Parses an inline datum from a JSON object and returns a \ref cardano_plutus_data_t object.
- *
- * This static function parses an inline datum, which is encoded in a JSON object, and converts it into a \ref cardano_plutus_data_t object.
+ * \brief Parses an inline datum from its hex-encoded CBOR and returns a \ref cardano_plutus_data_t object.
  *
  * \param[in] provider A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context for parsing.
  *                     This parameter must not be NULL.
- * \param[in] inline_datum_obj A pointer to a \ref cardano_json_object_t representing the inline datum in JSON format.
- *                             This object must contain the necessary datum fields required for parsing.
+ * \param[in] inline_datum The hex-encoded CBOR of the datum. It does not need to be null-terminated.
+ * \param[in] inline_datum_len The length of \p inline_datum.
  * \param[out] plutus_data On successful parsing, this will point to a newly created \ref cardano_plutus_data_t object
  *                         representing the parsed Plutus data. The caller is responsible for managing the lifecycle of this object
  *                         and must call \ref cardano_plutus_data_unref when it is no longer needed.
  *
  * \return \ref cardano_error_t indicating the outcome of the operation. Returns \ref CARDANO_SUCCESS if the inline datum
- *         was successfully parsed, or an appropriate error code if an error occurred (e.g., if the JSON object format is invalid).
+ *         was successfully parsed, or an appropriate error code if an error occurred (e.g., if the CBOR is invalid).
  */
 static cardano_error_t
 parse_inline_datum(
   cardano_provider_impl_t* provider,
-  cardano_json_object_t*   inline_datum_obj,
+  const char*              inline_datum,
+  const size_t             inline_datum_len,
   cardano_plutus_data_t**  plutus_data)
 {
-  size_t      inline_datum_len = 0U;
-  const char* inline_datum     = cardano_json_object_get_string(inline_datum_obj, &inline_datum_len);
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(inline_datum, inline_datum_len);
 
-  if ((inline_datum != NULL) && (inline_datum_len > 0U))
+  if (!reader)
   {
-    cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(inline_datum, inline_datum_len - 1U);
-
-    if (!reader)
-    {
-      cardano_utils_set_error_message(provider, "Failed to create CBOR reader for inline_datum");
+    cardano_utils_set_error_message(provider, "Failed to create CBOR reader for inline_datum");
 
-      return CARDANO_ERROR_INVALID_JSON;
-    }
-
-    cardano_error_t result = cardano_plutus_data_from_cbor(reader, plutus_data);
-    cardano_cbor_reader_unref(&reader);
+    return CARDANO_ERROR_INVALID_JSON;
+  }
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_utils_set_error_message(provider, "Failed to parse inline_datum from JSON response");
+  cardano_error_t result = cardano_plutus_data_from_cbor(reader, plutus_data);
+  cardano_cbor_reader_unref(&reader);
 
-      return result;
-    }
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse inline_datum from JSON response");
   }
 
-  return CARDANO_SUCCESS;
+  return result;
 }
 
 /**
- * \brief Parses a reference script from a JSON object and returns a \ref cardano_script_t object.
+ * \brief Builds a \ref cardano_utxo_t from its parsed parts.
  *
- * This static function parses a reference script from the given JSON object, which typically includes a script hash.
+ * \param[in] tx_id The hash of the transaction that created the output.
+ * \param[in] tx_index The index of the output in the transaction.
+ * \param[in] address The address of the output.
+ * \param[in] value The value of the output.
+ * \param[in] plutus_data_hash The datum hash of the output, or NULL.
+ * \param[in] plutus_data The inline datum of the output, or NULL.
+ * \param[in] reference_script The reference script of the output, or NULL.
+ * \param[out] utxo On success, the new UTxO.
  *
- * \param[in] provider A pointer to an initialized \ref cardano_provider_impl_t object that interacts with the blockchain API.
- *                     This parameter must not be NULL.
- * \param[in] script_hash_obj A pointer to a \ref cardano_json_object_t representing the script hash in JSON format. This object must contain
- *                            the script hash data required to parse the reference script.
- * \param[out] reference_script On successful parsing, this will point to the newly created \ref cardano_script_t object
- *                              representing the reference script. The caller is responsible for managing the lifecycle of the script
- *                              and must call \ref cardano_script_unref when it is no longer needed.
- *
- * \return \ref cardano_error_t indicating the outcome of the operation. Returns \ref CARDANO_SUCCESS if the reference script
- *         was successfully parsed, or an appropriate error code if an error occurred (e.g., if the JSON object format is invalid).
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
  */
 static cardano_error_t
-parse_reference_script(
-  cardano_provider_impl_t* provider,
-  cardano_json_object_t*   script_hash_obj,
-  cardano_script_t**       reference_script)
+build_utxo(
+  cardano_blake2b_hash_t* tx_id,
+  const uint64_t          tx_index,
+  cardano_address_t*      address,
+  cardano_value_t*        value,
+  cardano_blake2b_hash_t* plutus_data_hash,
+  cardano_plutus_data_t*  plutus_data,
+  cardano_script_t*       reference_script,
+  cardano_utxo_t**        utxo)
 {
-  size_t      reference_script_hash_hex_len = 0U;
-  const char* reference_script_hash_hex     = cardano_json_object_get_string(script_hash_obj, &reference_script_hash_hex_len);
+  cardano_transaction_input_t*  input  = NULL;
+  cardano_transaction_output_t* output = NULL;
+  cardano_datum_t*              datum  = NULL;
 
-  if ((reference_script_hash_hex != NULL) && (reference_script_hash_hex_len > 0U))
-  {
-    cardano_error_t result = cardano_blockfrost_get_script(provider, reference_script_hash_hex, reference_script_hash_hex_len - 1, reference_script);
+  cardano_error_t result = cardano_transaction_input_new(tx_id, tx_index, &input);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_utils_set_error_message(provider, "Failed to retrieve reference script from JSON response");
-
-      return result;
-    }
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_transaction_output_new(address, 0, &output);
   }
 
-  return CARDANO_SUCCESS;
-}
-
-/* IMPLEMENTATION *************************************************************/
-
-cardano_error_t
-cardano_blockfrost_parse_unspent_outputs(
-  cardano_provider_impl_t* provider,
-  const char*              json,
-  size_t                   size,
-  cardano_utxo_list_t**    utxo_list)
-{
-  cardano_json_object_t* parsed_json = cardano_json_object_parse(json, size);
-
-  if (parsed_json == NULL)
+  if (result == CARDANO_SUCCESS)
   {
-    cardano_utils_set_error_message(provider, "Failed to parse JSON response");
-    return CARDANO_ERROR_INVALID_JSON;
+    result = cardano_transaction_output_set_value(output, value);
   }
 
-  cardano_error_t result = cardano_utxo_list_new(utxo_list);
-
-  if (result != CARDANO_SUCCESS)
+  if (result == CARDANO_SUCCESS)
   {
-    cardano_utils_set_error_message(provider, "Failed to allocate memory for UTXO list");
-    cardano_json_object_unref(&parsed_json);
-
-    return result;
+    result = cardano_transaction_output_set_script_ref(output, reference_script);
   }
 
-  size_t array_len = cardano_json_object_array_get_length(parsed_json);
-
-  uint64_t                      tx_index;
-  cardano_blake2b_hash_t*       tx_id            = NULL;
-  cardano_address_t*            address          = NULL;
-  cardano_value_t*              value            = NULL;
-  cardano_blake2b_hash_t*       plutus_data_hash = NULL;
-  cardano_plutus_data_t*        plutus_data      = NULL;
-  cardano_script_t*             reference_script = NULL;
-  cardano_transaction_input_t*  input            = NULL;
-  cardano_transaction_output_t* output           = NULL;
-  cardano_utxo_t*               utxo             = NULL;
-
-  for (size_t i = 0U; i < array_len; ++i)
+  if ((result == CARDANO_SUCCESS) && (plutus_data_hash != NULL))
   {
-    // These are always freed at the end of the loop iteration,
-    // so we can safely set them to NULL here.
-    tx_id            = NULL;
-    tx_index         = 0;
-    address          = NULL;
-    value            = NULL;
-    plutus_data_hash = NULL;
-    plutus_data      = NULL;
-    reference_script = NULL;
-    input            = NULL;
-    output           = NULL;
-    utxo             = NULL;
-
-    cardano_json_object_t* tx_output = cardano_json_object_array_get(parsed_json, i);
-
-    cardano_json_object_t* address_obj = NULL;
-
-    if (cardano_json_object_get_ex(tx_output, "address", 7, &address_obj))
-    {
-      result = parse_address(provider, address_obj, &address);
+    result = cardano_datum_new_data_hash(plutus_data_hash, &datum);
 
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_transaction_output_set_datum(output, datum);
     }
 
-    cardano_json_object_t* tx_hash_obj = NULL;
+    cardano_datum_unref(&datum);
+  }
 
-    if (cardano_json_object_get_ex(tx_output, "tx_hash", 7, &tx_hash_obj))
-    {
-      result = parse_tx_hash(provider, tx_hash_obj, &tx_id);
+  if ((result == CARDANO_SUCCESS) && (plutus_data != NULL))
+  {
+    result = cardano_datum_new_inline_data(plutus_data, &datum);
 
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_transaction_output_set_datum(output, datum);
     }
 
-    cardano_json_object_t* output_index_obj = NULL;
-
-    if (cardano_json_object_get_ex(tx_output, "output_index", 12, &output_index_obj))
-    {
-      tx_index = 0;
+    cardano_datum_unref(&datum);
+  }
 
-      result = cardano_json_object_get_uint(output_index_obj, &tx_index);
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_utxo_new(input, output, utxo);
+  }
 
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
-    }
+  cardano_transaction_input_unref(&input);
+  cardano_transaction_output_unref(&output);
 
-    cardano_json_object_t* amount_array = NULL;
+  return result;
+}
 
-    if (cardano_json_object_get_ex(tx_output, "amount", 6, &amount_array))
+/**
+ * \brief Parses one output object of a Blockfrost UTxO array.
+ *
+ * \param[in] provider A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context for parsing.
+ * \param[in] reader The JSON reader, positioned right after the opening brace of the output.
+ * \param[in] tx_id The hash of the transaction that created the output, or NULL to read it from the `tx_hash` property.
+ * \param[out] utxo On success, the new UTxO.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+parse_unspent_output(
+  cardano_provider_impl_t* provider,
+  cardano_json_reader_t*   reader,
+  cardano_blake2b_hash_t*  tx_id,
+  cardano_utxo_t**         utxo)
+{
+  uint64_t                  tx_index         = 0U;
+  cardano_blake2b_hash_t*   parsed_tx_id     = NULL;
+  cardano_address_t*        address          = NULL;
+  cardano_value_t*          value            = NULL;
+  cardano_blake2b_hash_t*   plutus_data_hash = NULL;
+  cardano_plutus_data_t*    plutus_data      = NULL;
+  cardano_script_t*         reference_script = NULL;
+  cardano_json_token_type_t token            = CARDANO_JSON_TOKEN_TYPE_NONE;
+  cardano_error_t           result           = CARDANO_SUCCESS;
+
+  while (result == CARDANO_SUCCESS)
+  {
+    if (cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS)
     {
-      result = parse_amount(provider, amount_array, &value);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
+      cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+      result = CARDANO_ERROR_INVALID_JSON;
+      break;
     }
 
-    cardano_json_object_t* data_hash_obj = NULL;
-
-    if (cardano_json_object_get_ex(tx_output, "data_hash", 9, &data_hash_obj))
+    if (token == CARDANO_JSON_TOKEN_TYPE_END_OBJECT)
     {
-      result = parse_data_hash(provider, data_hash_obj, &plutus_data_hash);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
+      break;
     }
 
-    cardano_json_object_t* inline_datum_obj = NULL;
+    const char* text     = NULL;
+    size_t      text_len = 0U;
 
-    if (cardano_json_object_get_ex(tx_output, "inline_datum", 12, &inline_datum_obj))
+    if (cardano_json_reader_property_equals(reader, "address", 7))
     {
-      result = parse_inline_datum(provider, inline_datum_obj, &plutus_data);
+      result = read_string_value(provider, reader, &text, &text_len);
 
-      if (result != CARDANO_SUCCESS)
+      if ((result == CARDANO_SUCCESS) && (text != NULL))
       {
-        goto cleanup;
+        cardano_address_unref(&address);
+        result = cardano_address_intern_from_string(text, text_len, &address);
+
+        if (result != CARDANO_SUCCESS)
+        {
+          cardano_utils_set_error_message(provider, "Failed to parse address from JSON response");
+        }
       }
     }
-
-    cardano_json_object_t* reference_script_hash_obj = NULL;
-
-    if (cardano_json_object_get_ex(tx_output, "reference_script_hash", 21, &reference_script_hash_obj))
+    else if ((tx_id == NULL) && cardano_json_reader_property_equals(reader, "tx_hash", 7))
     {
-      result = parse_reference_script(provider, reference_script_hash_obj, &reference_script);
+      result = read_string_value(provider, reader, &text, &text_len);
 
-      if (result != CARDANO_SUCCESS)
+      if ((result == CARDANO_SUCCESS) && (text != NULL))
       {
-        goto cleanup;
+        cardano_blake2b_hash_unref(&parsed_tx_id);
+        result = cardano_blake2b_hash_from_hex(text, text_len, &parsed_tx_id);
+
+        if (result != CARDANO_SUCCESS)
+        {
+          cardano_utils_set_error_message(provider, "Failed to parse tx_hash from JSON response");
+        }
       }
     }
-
-    result = cardano_transaction_input_new(tx_id, tx_index, &input);
-
-    if (result != CARDANO_SUCCESS)
+    else if (cardano_json_reader_property_equals(reader, "output_index", 12))
     {
-      goto cleanup;
+      if ((cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS) || (cardano_json_reader_get_uint(reader, &tx_index) != CARDANO_SUCCESS))
+      {
+        cardano_utils_set_error_message(provider, "Failed to parse output_index from JSON response");
+        result = CARDANO_ERROR_INVALID_JSON;
+      }
     }
-
-    result = cardano_transaction_output_new(address, 0, &output);
-
-    if (result != CARDANO_SUCCESS)
+    else if (cardano_json_reader_property_equals(reader, "amount", 6))
     {
-      goto cleanup;
+      cardano_value_unref(&value);
+      result = parse_amount(provider, reader, &value);
     }
-
-    result = cardano_transaction_output_set_value(output, value);
-
-    if (result != CARDANO_SUCCESS)
+    else if (cardano_json_reader_property_equals(reader, "data_hash", 9))
     {
-      goto cleanup;
-    }
+      result = read_string_value(provider, reader, &text, &text_len);
 
-    result = cardano_transaction_output_set_script_ref(output, reference_script);
+      if ((result == CARDANO_SUCCESS) && (text != NULL))
+      {
+        cardano_blake2b_hash_unref(&plutus_data_hash);
+        result = cardano_blake2b_hash_from_hex(text, text_len, &plutus_data_hash);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      goto cleanup;
+        if (result != CARDANO_SUCCESS)
+        {
+          cardano_utils_set_error_message(provider, "Failed to parse data_hash from JSON response");
+        }
+      }
     }
-
-    if (plutus_data_hash != NULL)
+    else if (cardano_json_reader_property_equals(reader, "inline_datum", 12))
     {
-      cardano_datum_t* datum = NULL;
-      result                 = cardano_datum_new_data_hash(plutus_data_hash, &datum);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
-
-      result = cardano_transaction_output_set_datum(output, datum);
-      cardano_datum_unref(&datum);
+      result = read_string_value(provider, reader, &text, &text_len);
 
-      if (result != CARDANO_SUCCESS)
+      if ((result == CARDANO_SUCCESS) && (text != NULL))
       {
-        goto cleanup;
+        cardano_plutus_data_unref(&plutus_data);
+        result = parse_inline_datum(provider, text, text_len, &plutus_data);
       }
     }
-
-    if (plutus_data != NULL)
+    else if (cardano_json_reader_property_equals(reader, "reference_script_hash", 21))
     {
-      cardano_datum_t* datum = NULL;
-      result                 = cardano_datum_new_inline_data(plutus_data, &datum);
+      result = read_string_value(provider, reader, &text, &text_len);
 
-      if (result != CARDANO_SUCCESS)
+      if ((result == CARDANO_SUCCESS) && (text != NULL))
       {
-        goto cleanup;
-      }
+        cardano_script_unref(&reference_script);
+        result = cardano_blockfrost_get_script(provider, text, text_len, &reference_script);
 
-      result = cardano_transaction_output_set_datum(output, datum);
-      cardano_datum_unref(&datum);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
+        if (result != CARDANO_SUCCESS)
+        {
+          cardano_utils_set_error_message(provider, "Failed to retrieve reference script from JSON response");
+        }
       }
     }
-
-    result = cardano_utxo_new(input, output, &utxo);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      goto cleanup;
-    }
-
-    result = cardano_utxo_list_add(*utxo_list, utxo);
-
-    if (result != CARDANO_SUCCESS)
+    else if (cardano_json_reader_skip(reader) != CARDANO_SUCCESS)
     {
-      goto cleanup;
+      cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+      result = CARDANO_ERROR_INVALID_JSON;
     }
-
-    // Clean up allocated resources for this loop iteration
-    cardano_transaction_input_unref(&input);
-    cardano_transaction_output_unref(&output);
-    cardano_utxo_unref(&utxo);
-    cardano_blake2b_hash_unref(&tx_id);
-    cardano_address_unref(&address);
-    cardano_value_unref(&value);
-    cardano_blake2b_hash_unref(&plutus_data_hash);
-    cardano_plutus_data_unref(&plutus_data);
-    cardano_script_unref(&reference_script);
   }
 
-cleanup:
-  if (result != CARDANO_SUCCESS)
+  if (result == CARDANO_SUCCESS)
   {
-    cardano_utxo_list_unref(utxo_list);
-    cardano_transaction_input_unref(&input);
-    cardano_transaction_output_unref(&output);
-    cardano_utxo_unref(&utxo);
-    cardano_blake2b_hash_unref(&tx_id);
-    cardano_address_unref(&address);
-    cardano_value_unref(&value);
-    cardano_blake2b_hash_unref(&plutus_data_hash);
-    cardano_plutus_data_unref(&plutus_data);
-    cardano_script_unref(&reference_script);
+    result = build_utxo((tx_id != NULL) ? tx_id : parsed_tx_id, tx_index, address, value, plutus_data_hash, plutus_data, reference_script, utxo);
   }
 
-  cardano_json_object_unref(&parsed_json);
+  cardano_blake2b_hash_unref(&parsed_tx_id);
+  cardano_address_unref(&address);
+  cardano_value_unref(&value);
+  cardano_blake2b_hash_unref(&plutus_data_hash);
+  cardano_plutus_data_unref(&plutus_data);
+  cardano_script_unref(&reference_script);
 
   return result;
 }
 
-cardano_error_t
-cardano_blockfrost_parse_tx_unspent_outputs(
+/**
+ * \brief Parses a Blockfrost array of outputs into a \ref cardano_utxo_list_t.
+ *
+ * The array is read in a single forward pass, so no JSON tree is built, whatever the size of the response.
+ *
+ * \param[in] provider A pointer to an initialized \ref cardano_provider_impl_t object that provides the necessary context for parsing.
+ * \param[in] json The JSON response.
+ * \param[in] size The size of \p json in bytes.
+ * \param[in] tx_id The hash of the transaction all the outputs belong to, or NULL if every output has a `tx_hash` property.
+ * \param[out] utxo_list On success, the new UTxO list.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+parse_unspent_output_array(
   cardano_provider_impl_t* provider,
   const char*              json,
   const size_t             size,
-  const char*              tx_hash,
-  const size_t             tx_hash_len,
+  cardano_blake2b_hash_t*  tx_id,
   cardano_utxo_list_t**    utxo_list)
 {
-  cardano_json_object_t* parsed_json = cardano_json_object_parse(json, size);
+  cardano_json_reader_t*    reader = cardano_json_reader_new(json, size);
+  cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
 
-  if (parsed_json == NULL)
+  if ((reader == NULL) || (cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS) || (token != CARDANO_JSON_TOKEN_TYPE_START_ARRAY))
   {
     cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+    cardano_json_reader_unref(&reader);
+
     return CARDANO_ERROR_INVALID_JSON;
   }
 
@@ -612,231 +534,94 @@ cardano_blockfrost_parse_tx_unspent_outputs(
   if (result != CARDANO_SUCCESS)
   {
     cardano_utils_set_error_message(provider, "Failed to allocate memory for UTXO list");
-    cardano_json_object_unref(&parsed_json);
+    cardano_json_reader_unref(&reader);
 
     return result;
   }
 
-  size_t array_len = cardano_json_object_array_get_length(parsed_json);
-
-  uint64_t                      tx_index;
-  cardano_blake2b_hash_t*       tx_id            = NULL;
-  cardano_address_t*            address          = NULL;
-  cardano_value_t*              value            = NULL;
-  cardano_blake2b_hash_t*       plutus_data_hash = NULL;
-  cardano_plutus_data_t*        plutus_data      = NULL;
-  cardano_script_t*             reference_script = NULL;
-  cardano_transaction_input_t*  input            = NULL;
-  cardano_transaction_output_t* output           = NULL;
-  cardano_utxo_t*               utxo             = NULL;
-
-  for (size_t i = 0U; i < array_len; ++i)
+  while (result == CARDANO_SUCCESS)
   {
-    // These are always freed at the end of the loop iteration,
-    // so we can safely set them to NULL here.
-    tx_id            = NULL;
-    tx_index         = 0;
-    address          = NULL;
-    value            = NULL;
-    plutus_data_hash = NULL;
-    plutus_data      = NULL;
-    reference_script = NULL;
-    input            = NULL;
-    output           = NULL;
-    utxo             = NULL;
-
-    result = cardano_blake2b_hash_from_hex(tx_hash, tx_hash_len, &tx_id);
-
-    if (result != CARDANO_SUCCESS)
+    if (cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS)
     {
-      cardano_utils_set_error_message(provider, "Failed to parse tx_hash from JSON response");
-      goto cleanup;
-    }
-
-    cardano_json_object_t* tx_output = cardano_json_object_array_get(parsed_json, i);
-
-    cardano_json_object_t* address_obj = NULL;
-
-    if (cardano_json_object_get_ex(tx_output, "address", 7, &address_obj))
-    {
-      result = parse_address(provider, address_obj, &address);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
+      cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+      result = CARDANO_ERROR_INVALID_JSON;
+      break;
     }
 
-    cardano_json_object_t* output_index_obj = NULL;
-
-    if (cardano_json_object_get_ex(tx_output, "output_index", 12, &output_index_obj))
+    if (token == CARDANO_JSON_TOKEN_TYPE_END_ARRAY)
     {
-      tx_index = 0U;
-
-      result = cardano_json_object_get_uint(output_index_obj, &tx_index);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
+      break;
     }
 
-    cardano_json_object_t* amount_array = NULL;
-
-    if (cardano_json_object_get_ex(tx_output, "amount", 6, &amount_array))
+    if (token != CARDANO_JSON_TOKEN_TYPE_START_OBJECT)
     {
-      result = parse_amount(provider, amount_array, &value);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
+      cardano_utils_set_error_message(provider, "Unexpected value type in JSON response");
+      result = CARDANO_ERROR_INVALID_JSON;
+      break;
     }
 
-    cardano_json_object_t* data_hash_obj = NULL;
-
-    if (cardano_json_object_get_ex(tx_output, "data_hash", 9, &data_hash_obj))
-    {
-      result = parse_data_hash(provider, data_hash_obj, &plutus_data_hash);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
-    }
+    cardano_utxo_t* utxo = NULL;
 
-    cardano_json_object_t* inline_datum_obj = NULL;
+    result = parse_unspent_output(provider, reader, tx_id, &utxo);
 
-    if (cardano_json_object_get_ex(tx_output, "inline_datum", 12, &inline_datum_obj))
+    if (result == CARDANO_SUCCESS)
     {
-      result = parse_inline_datum(provider, inline_datum_obj, &plutus_data);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
+      result = cardano_utxo_list_add(*utxo_list, utxo);
     }
 
-    cardano_json_object_t* reference_script_hash_obj = NULL;
-
-    if (cardano_json_object_get_ex(tx_output, "reference_script_hash", 21, &reference_script_hash_obj))
-    {
-      result = parse_reference_script(provider, reference_script_hash_obj, &reference_script);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
-    }
-
-    result = cardano_transaction_input_new(tx_id, tx_index, &input);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      goto cleanup;
-    }
-
-    result = cardano_transaction_output_new(address, 0, &output);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      goto cleanup;
-    }
-
-    result = cardano_transaction_output_set_value(output, value);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      goto cleanup;
-    }
-
-    result = cardano_transaction_output_set_script_ref(output, reference_script);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      goto cleanup;
-    }
-
-    if (plutus_data_hash != NULL)
-    {
-      cardano_datum_t* datum = NULL;
-      result                 = cardano_datum_new_data_hash(plutus_data_hash, &datum);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
-
-      result = cardano_transaction_output_set_datum(output, datum);
-      cardano_datum_unref(&datum);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
-    }
-
-    if (plutus_data != NULL)
-    {
-      cardano_datum_t* datum = NULL;
-      result                 = cardano_datum_new_inline_data(plutus_data, &datum);
+    cardano_utxo_unref(&utxo);
+  }
 
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
+  if ((result == CARDANO_SUCCESS) && ((cardano_json_reader_read(reader, &token) != CARDANO_SUCCESS) || (token != CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT)))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+    result = CARDANO_ERROR_INVALID_JSON;
+  }
 
-      result = cardano_transaction_output_set_datum(output, datum);
-      cardano_datum_unref(&datum);
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(utxo_list);
+  }
 
-      if (result != CARDANO_SUCCESS)
-      {
-        goto cleanup;
-      }
-    }
+  cardano_json_reader_unref(&reader);
 
-    result = cardano_utxo_new(input, output, &utxo);
+  return result;
+}
 
-    if (result != CARDANO_SUCCESS)
-    {
-      goto cleanup;
-    }
+/* IMPLEMENTATION *************************************************************/
 
-    result = cardano_utxo_list_add(*utxo_list, utxo);
+cardano_error_t
+cardano_blockfrost_parse_unspent_outputs(
+  cardano_provider_impl_t* provider,
+  const char*              json,
+  size_t                   size,
+  cardano_utxo_list_t**    utxo_list)
+{
+  return parse_unspent_output_array(provider, json, size, NULL, utxo_list);
+}
 
-    if (result != CARDANO_SUCCESS)
-    {
-      goto cleanup;
-    }
+cardano_error_t
+cardano_blockfrost_parse_tx_unspent_outputs(
+  cardano_provider_impl_t* provider,
+  const char*              json,
+  const size_t             size,
+  const char*              tx_hash,
+  const size_t             tx_hash_len,
+  cardano_utxo_list_t**    utxo_list)
+{
+  cardano_blake2b_hash_t* tx_id = NULL;
 
-    // Clean up allocated resources for this loop iteration
-    cardano_transaction_input_unref(&input);
-    cardano_transaction_output_unref(&output);
-    cardano_utxo_unref(&utxo);
-    cardano_blake2b_hash_unref(&tx_id);
-    cardano_address_unref(&address);
-    cardano_value_unref(&value);
-    cardano_blake2b_hash_unref(&plutus_data_hash);
-    cardano_plutus_data_unref(&plutus_data);
-    cardano_script_unref(&reference_script);
-  }
+  cardano_error_t result = cardano_blake2b_hash_from_hex(tx_hash, tx_hash_len, &tx_id);
 
-cleanup:
   if (result != CARDANO_SUCCESS)
   {
-    cardano_utxo_list_unref(utxo_list);
-    cardano_transaction_input_unref(&input);
-    cardano_transaction_output_unref(&output);
-    cardano_utxo_unref(&utxo);
-    cardano_blake2b_hash_unref(&tx_id);
-    cardano_address_unref(&address);
-    cardano_value_unref(&value);
-    cardano_blake2b_hash_unref(&plutus_data_hash);
-    cardano_plutus_data_unref(&plutus_data);
-    cardano_script_unref(&reference_script);
+    cardano_utils_set_error_message(provider, "Failed to parse tx_hash from JSON response");
+
+    return result;
   }
 
-  cardano_json_object_unref(&parsed_json);
+  result = parse_unspent_output_array(provider, json, size, tx_id, utxo_list);
+  cardano_blake2b_hash_unref(&tx_id);
 
   return result;
 }
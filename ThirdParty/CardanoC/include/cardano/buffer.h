@@ -124,6 +124,61 @@ CARDANO_EXPORT cardano_buffer_t* cardano_buffer_concat(const cardano_buffer_t* l
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_buffer_t* cardano_buffer_slice(const cardano_buffer_t* buffer, size_t start, size_t end);
 
+/**
+ * \brief Creates a buffer that views a range of another buffer's storage, without copying it.
+ *
+ * The view holds a reference to the buffer that owns the storage, which therefore lives as long as the view: a small
+ * view keeps all of a large buffer in memory. A view of a view refers to the owning buffer directly.
+ *
+ * The storage is copied on write instead of being shared: writing to, growing or zeroing either the view or the
+ * buffer it was made from first gives that one a copy of its own, so neither ever sees the changes of the other.
+ * Code that modifies bytes through \ref cardano_buffer_get_data must call \ref cardano_buffer_make_unique first.
+ *
+ * \param[in] buffer The source buffer.
+ * \param[in] start The starting index of the range, inclusive.
+ * \param[in] end The ending index of the range, exclusive, no smaller than \p start and no greater than the size of
+ *                \p buffer.
+ *
+ * \return A new buffer over the range, or NULL if the input is invalid or memory allocation fails. An empty range
+ * gives an empty buffer of its own. The caller must release it with \ref cardano_buffer_unref.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_buffer_t* body = cardano_buffer_slice_view(transaction_cbor, body_start, body_end);
+ *
+ * // body reads the bytes of transaction_cbor in place
+ *
+ * cardano_buffer_unref(&body);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_buffer_t* cardano_buffer_slice_view(cardano_buffer_t* buffer, size_t start, size_t end);
+
+/**
+ * \brief Checks whether a buffer is a view into the storage of another buffer.
+ *
+ * \param[in] buffer The buffer to check.
+ *
+ * \return \c true if \p buffer was made by \ref cardano_buffer_slice_view and has not been copied on write since;
+ *         \c false otherwise, or if \p buffer is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_buffer_is_view(const cardano_buffer_t* buffer);
+
+/**
+ * \brief Makes sure no other buffer shares the storage of a buffer, copying it if needed.
+ *
+ * Returns at once for a buffer whose storage is its own. Call it before modifying bytes in place through
+ * \ref cardano_buffer_get_data; the write and zeroing functions of this API do so themselves.
+ *
+ * \param[in] buffer The buffer about to be modified.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p buffer is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the copy could not be allocated.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_buffer_make_unique(cardano_buffer_t* buffer);
+
 /**
  * \brief Creates a new buffer by decoding a given hex string.
  *
@@ -493,6 +548,9 @@ CARDANO_EXPORT cardano_error_t cardano_buffer_set_size(cardano_buffer_t* buffer,
  * It is especially important to call this function before freeing memory that contains sensitive information, such as
  * cryptographic keys or decrypted data, to prevent the data from remaining in memory.
  *
+ * Storage shared with views (see \ref cardano_buffer_slice_view) is erased in place, so the buffers sharing the
+ * bytes see zeros as well. Storage a buffer gave up while views still referenced it is erased when it is freed.
+ *
  * \param[in] buffer A pointer to the buffer whose contents should be securely erased.
  *
  * \see cardano_buffer_unref() for releasing the buffer after calling this function.
@@ -27,6 +27,8 @@
 /* INCLUDES ******************************************************************/
 
 #include <cardano/address/address.h>
+#include <cardano/address/address_cache.h>
+#include <cardano/address/address_factory.h>
 #include <cardano/address/address_type.h>
 #include <cardano/address/base_address.h>
 #include <cardano/address/byron_address.h>
@@ -36,6 +38,8 @@
 #include <cardano/address/pointer_address.h>
 #include <cardano/address/reward_address.h>
 #include <cardano/address/stake_pointer.h>
+#include <cardano/allocation_stats.h>
+#include <cardano/arena.h>
 #include <cardano/assets/asset_id.h>
 #include <cardano/assets/asset_id_list.h>
 #include <cardano/assets/asset_id_map.h>
@@ -45,6 +49,7 @@
 #include <cardano/assets/multi_asset.h>
 #include <cardano/assets/policy_id_list.h>
 #include <cardano/auxiliary_data/auxiliary_data.h>
+#include <cardano/auxiliary_data/metadata_encoder.h>
 #include <cardano/auxiliary_data/metadatum.h>
 #include <cardano/auxiliary_data/metadatum_kind.h>
 #include <cardano/auxiliary_data/metadatum_label_list.h>
@@ -61,6 +66,7 @@
 #include <cardano/cbor/cbor_reader_state.h>
 #include <cardano/cbor/cbor_simple_value.h>
 #include <cardano/cbor/cbor_tag.h>
+#include <cardano/cbor/cbor_well_formed.h>
 #include <cardano/cbor/cbor_writer.h>
 #include <cardano/certs/auth_committee_hot_cert.h>
 #include <cardano/certs/cert_type.h>
@@ -106,6 +112,7 @@
 #include <cardano/common/unit_interval.h>
 #include <cardano/common/utxo.h>
 #include <cardano/common/withdrawal_map.h>
+#include <cardano/crypto/bip32_derivation_cache.h>
 #include <cardano/crypto/bip32_private_key.h>
 #include <cardano/crypto/bip32_public_key.h>
 #include <cardano/crypto/blake2b_hash.h>
@@ -114,6 +121,7 @@
 #include <cardano/crypto/crc32.h>
 #include <cardano/crypto/ed25519_private_key.h>
 #include <cardano/crypto/ed25519_public_key.h>
+#include <cardano/crypto/ed25519_signing_context.h>
 #include <cardano/crypto/ed25519_signature.h>
 #include <cardano/crypto/emip3.h>
 #include <cardano/crypto/pbkdf2.h>
@@ -125,18 +133,25 @@
 #include <cardano/json/json_format.h>
 #include <cardano/json/json_object.h>
 #include <cardano/json/json_object_type.h>
+#include <cardano/json/json_reader.h>
+#include <cardano/json/json_token_type.h>
 #include <cardano/json/json_writer.h>
 #include <cardano/key_handlers/account_derivation_path.h>
 #include <cardano/key_handlers/cip_1852_constants.h>
 #include <cardano/key_handlers/derivation_path.h>
+#include <cardano/key_handlers/memory_secure_key_handler.h>
+#include <cardano/key_handlers/remote_secure_key_handler.h>
 #include <cardano/key_handlers/secure_key_handler.h>
 #include <cardano/key_handlers/secure_key_handler_impl.h>
 #include <cardano/key_handlers/secure_key_handler_type.h>
 #include <cardano/key_handlers/software_secure_key_handler.h>
+#include <cardano/memory_footprint.h>
 #include <cardano/object.h>
 #include <cardano/plutus_data/constr_plutus_data.h>
+#include <cardano/plutus_data/datum_schema.h>
 #include <cardano/plutus_data/plutus_data.h>
 #include <cardano/plutus_data/plutus_data_kind.h>
+#include <cardano/plutus_data/plutus_data_view.h>
 #include <cardano/plutus_data/plutus_list.h>
 #include <cardano/plutus_data/plutus_map.h>
 #include <cardano/pool_params/ipv4.h>
@@ -172,6 +187,7 @@
 #include <cardano/protocol_params/proposed_param_updates.h>
 #include <cardano/protocol_params/protocol_param_update.h>
 #include <cardano/protocol_params/update.h>
+#include <cardano/scripts/native_scripts/compiled_native_script.h>
 #include <cardano/scripts/native_scripts/native_script.h>
 #include <cardano/scripts/native_scripts/native_script_list.h>
 #include <cardano/scripts/native_scripts/native_script_type.h>
@@ -189,6 +205,7 @@
 #include <cardano/scripts/script_language.h>
 #include <cardano/time.h>
 #include <cardano/transaction/transaction.h>
+#include <cardano/transaction/transaction_visitor.h>
 #include <cardano/transaction_body/transaction_body.h>
 #include <cardano/transaction_body/transaction_input.h>
 #include <cardano/transaction_body/transaction_input_set.h>
@@ -198,9 +215,13 @@
 #include <cardano/transaction_builder/balancing/implicit_coin.h>
 #include <cardano/transaction_builder/balancing/input_to_redeemer_map.h>
 #include <cardano/transaction_builder/balancing/transaction_balancing.h>
+#include <cardano/transaction_builder/build_profile.h>
+#include <cardano/transaction_builder/coin_selection/branch_and_bound_coin_selector.h>
 #include <cardano/transaction_builder/coin_selection/coin_selector.h>
 #include <cardano/transaction_builder/coin_selection/coin_selector_impl.h>
 #include <cardano/transaction_builder/coin_selection/large_first_coin_selector.h>
+#include <cardano/transaction_builder/coin_selection/random_improve_coin_selector.h>
+#include <cardano/transaction_builder/evaluation/local_tx_evaluator.h>
 #include <cardano/transaction_builder/evaluation/provider_tx_evaluator.h>
 #include <cardano/transaction_builder/evaluation/tx_evaluator.h>
 #include <cardano/transaction_builder/evaluation/tx_evaluator_impl.h>
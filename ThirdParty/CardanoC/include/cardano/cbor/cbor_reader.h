@@ -107,6 +107,37 @@ CARDANO_EXPORT cardano_cbor_reader_t* cardano_cbor_reader_new(const byte_t* cbor
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_cbor_reader_t* cardano_cbor_reader_from_hex(const char* hex_string, size_t size);
 
+/**
+ * \brief Creates a CBOR reader that reads directly from caller-owned memory, without copying it.
+ *
+ * \ref cardano_cbor_reader_new copies its input, which for large blocks or transactions is a significant part of the
+ * decoding cost. A view reader borrows `cbor_data` instead: it is read in place, and the slices returned by
+ * \ref cardano_cbor_reader_read_bytestring_view and \ref cardano_cbor_reader_read_textstring_view point into it.
+ *
+ * \param[in] cbor_data Pointer to the CBOR encoded data. It must stay alive and unmodified for as long as the reader,
+ *                      any clone of it, or any view obtained from them is in use.
+ * \param[in] size The size of the data in bytes.
+ *
+ * \return A pointer to the newly created \ref cardano_cbor_reader_t object, or NULL if `cbor_data` is NULL, `size`
+ * is zero or memory could not be allocated. The caller must release it by calling \ref cardano_cbor_reader_unref.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(block_bytes, block_size);
+ *
+ * if (reader)
+ * {
+ *   // Decode as with any other reader; every read happens in place
+ *
+ *   cardano_cbor_reader_unref(&reader);
+ * }
+ *
+ * // Only now may block_bytes be released
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_cbor_reader_t* cardano_cbor_reader_from_view(const byte_t* cbor_data, size_t size);
+
 /**
  * \brief Decrements the reference count of a CBOR reader object.
  *
@@ -329,6 +360,11 @@ CARDANO_EXPORT cardano_error_t cardano_cbor_reader_clone(cardano_cbor_reader_t*
 /**
  * \brief Skips the next CBOR data item and advances the reader.
  *
+ * The item is not decoded: strings are jumped over by their declared length and arrays and maps by counting their
+ * items, in a single pass over the headers that allocates nothing. The structure of the item is still checked (lengths
+ * within the input, no reserved headers, terminated indefinite-length items), but not its contents, such as the UTF-8
+ * validity of text strings.
+ *
  * \param[in] reader A pointer to the \ref cardano_cbor_reader_t instance from which the next CBOR data item
  * is to be skipped.
  *
@@ -392,6 +428,89 @@ CARDANO_EXPORT cardano_error_t cardano_cbor_reader_skip_value(cardano_cbor_reade
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_cbor_reader_read_encoded_value(cardano_cbor_reader_t* reader, cardano_buffer_t** encoded_value);
 
+/**
+ * \brief Reads the next CBOR data item and returns a view over its encoding, without copying it.
+ *
+ * This function behaves like \ref cardano_cbor_reader_read_encoded_value, but instead of allocating a buffer it
+ * returns a pointer into the data being read. For a reader created with \ref cardano_cbor_reader_from_view that is
+ * the caller's memory; otherwise it is the reader's own copy of the input.
+ *
+ * \param[in] reader A pointer to the \ref cardano_cbor_reader_t instance from which the next CBOR data item is read.
+ * \param[out] data On success, a pointer to the first byte of the encoded data item. It stays valid for as long as the
+ *                  reader (or, for a view reader, the viewed memory) is alive.
+ * \param[out] size On success, the size of the encoded data item in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code if the data item is malformed.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const byte_t* metadatum      = NULL;
+ * size_t        metadatum_size = 0U;
+ *
+ * cardano_error_t error = cardano_cbor_reader_read_encoded_value_view(reader, &metadatum, &metadatum_size);
+ *
+ * if (error == CARDANO_SUCCESS)
+ * {
+ *   // metadatum points at the encoded value inside the reader's input
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_cbor_reader_read_encoded_value_view(
+  cardano_cbor_reader_t* reader,
+  const byte_t**         data,
+  size_t*                size);
+
+/**
+ * \brief Locates a data item nested in the next CBOR data item by its path, without decoding anything on the way.
+ *
+ * The path is a list of segments separated by dots; a segment in brackets may also follow another one directly.
+ * Each segment selects an element of the current array or map:
+ *
+ * - in an array, a number selects the element at that index;
+ * - in a map, a number selects the value whose key is that (possibly negative) integer, and any other segment the
+ *   value whose key is that text string.
+ *
+ * Tags in front of an array or a map are looked through. An empty path selects the next data item itself. For
+ * example, `0.1[3].1` selects the value of the output at index 3 of a transaction, and `3.0.674`, in an Alonzo-era
+ * auxiliary data, the metadatum of label 674.
+ *
+ * The elements on the way are skipped as by \ref cardano_cbor_reader_skip_value, so locating a field costs a fraction
+ * of decoding the enclosing object. `reader` itself is not advanced.
+ *
+ * \param[in] reader The reader positioned at the data item to search.
+ * \param[in] path The path of the data item to locate. It does not need to be NULL-terminated.
+ * \param[in] path_size The size of the path in bytes.
+ * \param[out] field On success, a new reader over the located data item only. It reads the memory of `reader` in place
+ *                   (see \ref cardano_cbor_reader_from_view), so it must not outlive it. The caller must release it
+ *                   with \ref cardano_cbor_reader_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ARGUMENT if the path is malformed,
+ *         \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if an element of the path does not exist, or
+ *         \ref CARDANO_ERROR_DECODING if the data is malformed.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_cbor_reader_t* amount = NULL;
+ *
+ * cardano_error_t error = cardano_cbor_reader_seek(reader, "0.1[3].1", 8, &amount);
+ *
+ * if (error == CARDANO_SUCCESS)
+ * {
+ *   cardano_value_t* value = NULL;
+ *   error = cardano_value_from_cbor(amount, &value);
+ *
+ *   cardano_cbor_reader_unref(&amount);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_cbor_reader_seek(
+  cardano_cbor_reader_t*  reader,
+  const char*             path,
+  size_t                  path_size,
+  cardano_cbor_reader_t** field);
+
 /**
  * \brief Reads the next data item as the start of an array (major type 4).
  *
@@ -869,6 +988,53 @@ CARDANO_EXPORT cardano_error_t cardano_cbor_reader_read_bytestring(cardano_cbor_
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_cbor_reader_read_textstring(cardano_cbor_reader_t* reader, cardano_buffer_t** text_string);
 
+/**
+ * \brief Reads the next data item as a byte string (major type 2), returning a slice of the reader's data.
+ *
+ * Unlike \ref cardano_cbor_reader_read_bytestring, no buffer is allocated and nothing is copied: `data` points into
+ * the memory being read. For readers created with \ref cardano_cbor_reader_from_view the slice stays valid while
+ * that memory lives; for other readers it stays valid while the reader (not any clone of it) lives.
+ *
+ * \param[in] reader A pointer to the \ref cardano_cbor_reader_t instance.
+ * \param[out] data On success, a pointer to the first byte of the string. It is not NULL-terminated and may point
+ *                  past the end of the data for empty strings; read at most `size` bytes from it.
+ * \param[out] size On success, the length of the string in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS if the byte string was read. Indefinite length byte strings are stored in chunks and
+ * cannot be returned as a single slice: they fail with \ref CARDANO_ERROR_DECODING without advancing the reader, and
+ * can still be read with \ref cardano_cbor_reader_read_bytestring.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const byte_t* hash      = NULL;
+ * size_t        hash_size = 0U;
+ *
+ * if (cardano_cbor_reader_read_bytestring_view(reader, &hash, &hash_size) == CARDANO_SUCCESS)
+ * {
+ *   // Use hash[0 .. hash_size)
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_cbor_reader_read_bytestring_view(cardano_cbor_reader_t* reader, const byte_t** data, size_t* size);
+
+/**
+ * \brief Reads the next data item as a text string (major type 3), returning a slice of the reader's data.
+ *
+ * This is the text string counterpart of \ref cardano_cbor_reader_read_bytestring_view, with the same lifetime
+ * rules. The returned text is not NULL-terminated.
+ *
+ * \param[in] reader A pointer to the \ref cardano_cbor_reader_t instance.
+ * \param[out] data On success, a pointer to the first UTF-8 byte of the string.
+ * \param[out] size On success, the length of the string in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS if the text string was read. Indefinite length text strings fail with
+ * \ref CARDANO_ERROR_DECODING without advancing the reader, and can still be read with
+ * \ref cardano_cbor_reader_read_textstring.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_cbor_reader_read_textstring_view(cardano_cbor_reader_t* reader, const char** data, size_t* size);
+
 /**
  * \brief Reads the next data item as a semantic tag (major type 6), advancing the reader.
  *
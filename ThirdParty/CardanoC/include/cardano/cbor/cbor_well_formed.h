@@ -0,0 +1,100 @@
+/**
+ * \file cbor_well_formed.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_CBOR_WELL_FORMED_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_CBOR_WELL_FORMED_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/typedefs.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The deepest nesting of arrays, maps, tags and indefinite-length strings accepted by
+ * \ref cardano_cbor_validate_well_formed.
+ */
+#define CARDANO_CBOR_WELL_FORMED_MAX_DEPTH (256U)
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Checks that a buffer holds exactly one well-formed CBOR data item.
+ *
+ * This function is meant as a cheap first line of defense for untrusted input, such as transactions uploaded by
+ * clients, before the (much more expensive) object decoding. It makes a single pass over the bytes, without
+ * allocating and without recursion, and checks:
+ *
+ * - every initial byte: reserved additional information values (28 to 30) are rejected, as are indefinite lengths on
+ *   integers and tags, and two-byte simple values below 32;
+ * - every argument and string length fits in the remaining input;
+ * - the declared element count of every array and map could fit in the remaining input (each element takes at least
+ *   one byte), so oversized headers are rejected immediately, without walking them;
+ * - indefinite-length strings only contain definite-length chunks of their own major type, and every indefinite-length
+ *   item is terminated by a break, with an even number of items for maps; stray breaks are rejected;
+ * - the nesting depth stays within `max_depth`;
+ * - the item spans the whole buffer, with no trailing bytes.
+ *
+ * It does not check the semantics of the data (map key uniqueness, UTF-8 validity of text strings, expected
+ * structure); the decoders still do that.
+ *
+ * \param[in] data The bytes to check.
+ * \param[in] size The size of `data` in bytes.
+ * \param[in] max_depth The maximum nesting depth allowed. Zero, or a value larger than
+ *                      \ref CARDANO_CBOR_WELL_FORMED_MAX_DEPTH, selects \ref CARDANO_CBOR_WELL_FORMED_MAX_DEPTH.
+ * \param[out] error_offset Optional. If the data is malformed, set to the offset of the offending byte (or `size` if
+ *                          the data is truncated). May be NULL.
+ *
+ * \return \ref CARDANO_SUCCESS if the data is well formed, \ref CARDANO_ERROR_POINTER_IS_NULL if `data` is NULL, or
+ *         \ref CARDANO_ERROR_DECODING if it is malformed, truncated, too deeply nested or followed by trailing bytes.
+ *
+ * Usage Example:
+ * \code{.c}
+ * size_t error_offset = 0U;
+ *
+ * if (cardano_cbor_validate_well_formed(upload, upload_size, 0U, &error_offset) != CARDANO_SUCCESS)
+ * {
+ *   printf("Rejected malformed transaction at byte %zu\n", error_offset);
+ *   return;
+ * }
+ *
+ * cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(upload, upload_size);
+ * // ...
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_cbor_validate_well_formed(
+  const byte_t* data,
+  size_t        size,
+  size_t        max_depth,
+  size_t*       error_offset);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_CBOR_WELL_FORMED_H
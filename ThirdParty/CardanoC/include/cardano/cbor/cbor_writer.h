@@ -77,6 +77,66 @@ typedef struct cardano_cbor_writer_t cardano_cbor_writer_t;
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_cbor_writer_t* cardano_cbor_writer_new(void);
 
+/**
+ * \brief Creates a new CBOR writer whose output buffer is pre-sized to a given capacity.
+ *
+ * This function behaves like \ref cardano_cbor_writer_new, but allocates \p capacity bytes up front. When the size
+ * of the output is known in advance (for instance from \ref cardano_transaction_get_cbor_size), the encoding runs
+ * without reallocating the buffer.
+ *
+ * \param[in] capacity The initial capacity of the output buffer, in bytes. The buffer still grows if more data is
+ *                     written.
+ *
+ * \return A pointer to the newly created \ref cardano_cbor_writer_t object, or `NULL` if memory could not be
+ *         allocated. The caller must release it with \ref cardano_cbor_writer_unref.
+ *
+ * Usage Example:
+ * \code{.c}
+ * size_t cbor_size = 0U;
+ *
+ * if (cardano_transaction_get_cbor_size(transaction, &cbor_size) == CARDANO_SUCCESS)
+ * {
+ *   cardano_cbor_writer_t* writer = cardano_cbor_writer_new_with_capacity(cbor_size);
+ *
+ *   // A single allocation holds the whole transaction
+ *   cardano_error_t result = cardano_transaction_to_cbor(transaction, writer);
+ *
+ *   cardano_cbor_writer_unref(&writer);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_cbor_writer_t* cardano_cbor_writer_new_with_capacity(size_t capacity);
+
+/**
+ * \brief Creates a new CBOR writer that only measures the size of the encoding.
+ *
+ * A size-only writer accepts every write like a regular writer, but discards the bytes and only accumulates
+ * their count, so it never allocates an output buffer. After serializing an object into it,
+ * \ref cardano_cbor_writer_get_encode_size returns the exact number of bytes a regular writer would have produced.
+ *
+ * A size-only writer holds no data: \ref cardano_cbor_writer_encode, \ref cardano_cbor_writer_encode_in_buffer and
+ * \ref cardano_cbor_writer_encode_hex return \ref CARDANO_ERROR_ILLEGAL_STATE, and
+ * \ref cardano_cbor_writer_get_hex_size returns zero. \ref cardano_cbor_writer_reset sets the count back to zero.
+ *
+ * \return A pointer to the newly created \ref cardano_cbor_writer_t object, or `NULL` if memory could not be
+ *         allocated. The caller must release it with \ref cardano_cbor_writer_unref.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_cbor_writer_t* sizer = cardano_cbor_writer_new_size_only();
+ *
+ * if (cardano_transaction_output_to_cbor(output, sizer) == CARDANO_SUCCESS)
+ * {
+ *   printf("Output size: %zu bytes\n", cardano_cbor_writer_get_encode_size(sizer));
+ * }
+ *
+ * cardano_cbor_writer_unref(&sizer);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_cbor_writer_t* cardano_cbor_writer_new_size_only(void);
+
 /**
  * \brief Decrements the reference count of a CBOR writer object.
  *
@@ -910,6 +970,9 @@ CARDANO_EXPORT cardano_error_t cardano_cbor_writer_encode_hex(const cardano_cbor
  * This is useful for reusing a writer instance without needing to create a new one, especially when working with
  * sequences of data encoding tasks.
  *
+ * The output buffer keeps its capacity, so a writer reused across many encodings stops reallocating once it has
+ * held its largest output.
+ *
  * \param[in] writer The CBOR writer instance to reset.
  *
  * \return A cardano_error_t indicating the outcome of the operation. CARDANO_SUCCESS is returned if the writer is
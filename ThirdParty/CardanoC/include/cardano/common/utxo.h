@@ -386,6 +386,27 @@ cardano_utxo_set_output(cardano_utxo_t* utxo, cardano_transaction_output_t* outp
 CARDANO_NODISCARD
 CARDANO_EXPORT bool cardano_utxo_equals(const cardano_utxo_t* lhs, const cardano_utxo_t* rhs);
 
+/**
+ * \brief Freezes a UTxO, making it immutable.
+ *
+ * The input and output of the UTxO are frozen too. Replacing either of them, or modifying them in place, fails with \ref CARDANO_ERROR_OBJECT_IS_FROZEN.
+ *
+ * Freezing cannot be undone, and the cached CBOR encoding is kept as is.
+ *
+ * \param[in] utxo The UTxO to freeze. If NULL, the function has no effect.
+ */
+CARDANO_EXPORT void cardano_utxo_freeze(cardano_utxo_t* utxo);
+
+/**
+ * \brief Checks whether a UTxO has been frozen with \ref cardano_utxo_freeze.
+ *
+ * \param[in] utxo The UTxO to check.
+ *
+ * \return \c true if the UTxO is frozen; \c false otherwise, or if `utxo` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_utxo_is_frozen(const cardano_utxo_t* utxo);
+
 /**
  * \brief Decrements the reference count of a cardano_utxo_t object.
  *
@@ -109,6 +109,44 @@ CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t
 cardano_utxo_list_new(cardano_utxo_list_t** utxo_list);
 
+/**
+ * \brief Decodes a raw CBOR dump of UTxOs into a new utxo_list.
+ *
+ * Accepts the layouts node tooling produces for a set of unspent outputs:
+ *
+ * - a map of transaction inputs to transaction outputs, as written by `cardano-cli query utxo --output-cbor`;
+ * - an array of `[input, output]` pairs, of definite or indefinite length;
+ * - a concatenated sequence of `[input, output]` pairs, with nothing around them.
+ *
+ * The data is read in place rather than copied, and for definite length maps and arrays the list is allocated
+ * once for the announced number of entries. The function touches no shared state, so independent dumps may be
+ * decoded on separate threads.
+ *
+ * \param[in] data Pointer to the CBOR encoded dump. It is only read during the call.
+ * \param[in] size The size of the data in bytes.
+ * \param[out] utxo_list On success, a newly created \ref cardano_utxo_list_t holding the UTxOs in the order they
+ *             appear in the dump. The caller must release it by calling \ref cardano_utxo_list_unref.
+ *
+ * \return \ref CARDANO_SUCCESS if the whole dump was decoded, or the error of the first entry that failed to
+ *         decode, in which case no list is returned. Trailing bytes after a map or array are an error.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_utxo_list_t* utxo_list = NULL;
+ * cardano_error_t      result    = cardano_utxo_list_from_cbor_stream(dump, dump_size, &utxo_list);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   printf("Loaded %zu UTxOs\n", cardano_utxo_list_get_length(utxo_list));
+ *
+ *   cardano_utxo_list_unref(&utxo_list);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_utxo_list_from_cbor_stream(const byte_t* data, size_t size, cardano_utxo_list_t** utxo_list);
+
 /**
  * \brief Retrieves the length of a UTxO list.
  *
@@ -134,6 +172,18 @@ cardano_utxo_list_new(cardano_utxo_list_t** utxo_list);
 CARDANO_NODISCARD
 CARDANO_EXPORT size_t cardano_utxo_list_get_length(const cardano_utxo_list_t* utxo_list);
 
+/**
+ * \brief Makes room for a number of UTxOs, so that adding that many does not reallocate the list.
+ *
+ * \param[in] utxo_list The list.
+ * \param[in] capacity The number of UTxOs the list must hold without growing. The list never shrinks.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p utxo_list is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED, in which case the list is left as it was.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_utxo_list_reserve(cardano_utxo_list_t* utxo_list, size_t capacity);
+
 /**
  * \brief Retrieves an element from a UTxO list by index.
  *
@@ -174,6 +224,34 @@ CARDANO_EXPORT size_t cardano_utxo_list_get_length(const cardano_utxo_list_t* ut
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_utxo_list_get(const cardano_utxo_list_t* utxo_list, size_t index, cardano_utxo_t** element);
 
+/**
+ * \brief Retrieves an element from a UTxO list by index, without taking a reference to it.
+ *
+ * This function behaves like \ref cardano_utxo_list_get, but leaves the reference count of the element untouched. It is
+ * meant for loops that only read the elements, which would otherwise pay for a ref/unref pair per element.
+ *
+ * \param[in] utxo_list A constant pointer to the \ref cardano_utxo_list_t object from which the element is to be retrieved.
+ * \param[in] index The index of the element to retrieve. Indexing starts at 0.
+ *
+ * \return A borrowed pointer to the element, or NULL if `utxo_list` is NULL or `index` is out of bounds. The element is
+ *         owned by the UTxO list and is only valid while it remains in it; the caller must not call
+ *         \ref cardano_utxo_unref on it.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const size_t length = cardano_utxo_list_get_length(utxo_list);
+ *
+ * for (size_t i = 0U; i < length; ++i)
+ * {
+ *   cardano_utxo_t* utxo = cardano_utxo_list_peek(utxo_list, i);
+ *
+ *   // Read the element, no need to unref it
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_utxo_t* cardano_utxo_list_peek(const cardano_utxo_list_t* utxo_list, size_t index);
+
 /**
  * \brief Adds an element to a UTxO list.
  *
@@ -392,6 +470,27 @@ CARDANO_EXPORT cardano_utxo_list_t* cardano_utxo_list_erase(
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_utxo_list_t* cardano_utxo_list_clone(cardano_utxo_list_t* utxo_list);
 
+/**
+ * \brief Freezes a UTxO list, making it immutable.
+ *
+ * Every UTxO in the list is frozen too, along with its input and output, so the list can back a cache shared by worker threads: adding, removing, sorting or clearing entries fails with \ref CARDANO_ERROR_OBJECT_IS_FROZEN.
+ *
+ * Freezing cannot be undone, and the cached CBOR encoding is kept as is.
+ *
+ * \param[in] utxo_list The UTxO list to freeze. If NULL, the function has no effect.
+ */
+CARDANO_EXPORT void cardano_utxo_list_freeze(cardano_utxo_list_t* utxo_list);
+
+/**
+ * \brief Checks whether a UTxO list has been frozen with \ref cardano_utxo_list_freeze.
+ *
+ * \param[in] utxo_list The UTxO list to check.
+ *
+ * \return \c true if the UTxO list is frozen; \c false otherwise, or if `utxo_list` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_utxo_list_is_frozen(const cardano_utxo_list_t* utxo_list);
+
 /**
  * \brief Decrements the reference count of a utxo_list object.
  *
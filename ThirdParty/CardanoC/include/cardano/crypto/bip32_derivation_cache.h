@@ -0,0 +1,196 @@
+/**
+ * \file bip32_derivation_cache.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_CRYPTO_BIP32_DERIVATION_CACHE_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_CRYPTO_BIP32_DERIVATION_CACHE_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/crypto/bip32_private_key.h>
+#include <cardano/crypto/bip32_public_key.h>
+#include <cardano/error.h>
+#include <cardano/typedefs.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The number of nodes a derivation cache holds when it is created with a capacity of zero.
+ */
+#define CARDANO_BIP32_DERIVATION_CACHE_DEFAULT_CAPACITY 32U
+
+/**
+ * \brief The deepest intermediate node a derivation cache keeps. Deeper nodes are still derived, just not cached.
+ */
+#define CARDANO_BIP32_DERIVATION_CACHE_MAX_DEPTH 8U
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief A least-recently-used cache of intermediate BIP32 nodes, keyed by root key and path prefix.
+ *
+ * \ref cardano_bip32_private_key_derive and \ref cardano_bip32_public_key_derive always start from the key they are
+ * given, so deriving `m/1852'/1815'/0'/0/0` and then `m/1852'/1815'/0'/0/1` repeats the first four steps. Deriving
+ * through a cache keeps every intermediate node it computes, and later derivations resume from the longest cached
+ * prefix of their path: siblings only pay for the final step.
+ *
+ * Final nodes are not cached, so deriving many leaves does not evict the shared prefixes they descend from. Nodes
+ * are keyed by a fingerprint of the root key as well as the path, so one cache may serve several roots.
+ *
+ * Cached private nodes are key material: they are wiped when evicted, when the cache is cleared, and when it is
+ * released. A cache is not thread safe; use one cache per thread.
+ */
+typedef struct cardano_bip32_derivation_cache_t cardano_bip32_derivation_cache_t;
+
+/**
+ * \brief Creates a new BIP32 derivation cache.
+ *
+ * \param[in] capacity The maximum number of intermediate nodes to keep, or 0 for
+ *                     \ref CARDANO_BIP32_DERIVATION_CACHE_DEFAULT_CAPACITY.
+ * \param[out] cache On success, the new cache. The caller must release it with \ref cardano_bip32_derivation_cache_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_bip32_derivation_cache_t* cache = NULL;
+ *
+ * if (cardano_bip32_derivation_cache_new(0U, &cache) == CARDANO_SUCCESS)
+ * {
+ *   for (uint32_t i = 0U; i < 20U; ++i)
+ *   {
+ *     const uint32_t             path[] = { 0U, i };
+ *     cardano_bip32_public_key_t* child = NULL;
+ *
+ *     // Only the first iteration derives the role node; the others derive just the address index.
+ *     if (cardano_bip32_derivation_cache_derive_public(cache, account_key, path, 2U, &child) == CARDANO_SUCCESS)
+ *     {
+ *       // Use the child key
+ *       cardano_bip32_public_key_unref(&child);
+ *     }
+ *   }
+ *
+ *   cardano_bip32_derivation_cache_unref(&cache);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_bip32_derivation_cache_new(size_t capacity, cardano_bip32_derivation_cache_t** cache);
+
+/**
+ * \brief Derives a BIP32 private key, reusing and populating the cached intermediate nodes.
+ *
+ * The result is identical to \ref cardano_bip32_private_key_derive with the same arguments.
+ *
+ * \param[in] cache The derivation cache.
+ * \param[in] root_private_key The key the path is relative to.
+ * \param[in] indices The derivation indices. Hardened indices must already be hardened.
+ * \param[in] indices_count The number of indices. Must be greater than zero.
+ * \param[out] derived_private_key On success, the derived key. The caller must release it with
+ *                                 \ref cardano_bip32_private_key_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_bip32_derivation_cache_derive_private(
+  cardano_bip32_derivation_cache_t*  cache,
+  const cardano_bip32_private_key_t* root_private_key,
+  const uint32_t*                    indices,
+  size_t                             indices_count,
+  cardano_bip32_private_key_t**      derived_private_key);
+
+/**
+ * \brief Derives a BIP32 public key, reusing and populating the cached intermediate nodes.
+ *
+ * The result is identical to \ref cardano_bip32_public_key_derive with the same arguments. Hardened indices fail
+ * as they do there.
+ *
+ * \param[in] cache The derivation cache.
+ * \param[in] root_public_key The key the path is relative to.
+ * \param[in] indices The derivation indices.
+ * \param[in] indices_count The number of indices. Must be greater than zero.
+ * \param[out] derived_public_key On success, the derived key. The caller must release it with
+ *                                \ref cardano_bip32_public_key_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_bip32_derivation_cache_derive_public(
+  cardano_bip32_derivation_cache_t* cache,
+  const cardano_bip32_public_key_t* root_public_key,
+  const uint32_t*                   indices,
+  size_t                            indices_count,
+  cardano_bip32_public_key_t**      derived_public_key);
+
+/**
+ * \brief Retrieves the number of intermediate nodes currently held by the cache.
+ *
+ * \param[in] cache The derivation cache.
+ *
+ * \return The number of cached nodes, or 0 if `cache` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_bip32_derivation_cache_get_size(const cardano_bip32_derivation_cache_t* cache);
+
+/**
+ * \brief Removes every node from the cache, wiping cached private keys.
+ *
+ * \param[in] cache The derivation cache.
+ */
+CARDANO_EXPORT void cardano_bip32_derivation_cache_clear(cardano_bip32_derivation_cache_t* cache);
+
+/**
+ * \brief Decrements the reference count of a derivation cache.
+ *
+ * When the reference count reaches zero the cache is cleared and deallocated.
+ *
+ * \param[in,out] cache A pointer to the pointer of the derivation cache. It is set to NULL afterwards.
+ */
+CARDANO_EXPORT void cardano_bip32_derivation_cache_unref(cardano_bip32_derivation_cache_t** cache);
+
+/**
+ * \brief Increases the reference count of a derivation cache.
+ *
+ * \param[in,out] cache The derivation cache.
+ *
+ * \note Every call to \ref cardano_bip32_derivation_cache_ref must be matched by a call to
+ *       \ref cardano_bip32_derivation_cache_unref.
+ */
+CARDANO_EXPORT void cardano_bip32_derivation_cache_ref(cardano_bip32_derivation_cache_t* cache);
+
+/**
+ * \brief Retrieves the current reference count of a derivation cache.
+ *
+ * \param[in] cache The derivation cache.
+ *
+ * \return The number of active references, or 0 if `cache` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_bip32_derivation_cache_refcount(const cardano_bip32_derivation_cache_t* cache);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_CRYPTO_BIP32_DERIVATION_CACHE_H
@@ -124,6 +124,49 @@ CARDANO_EXPORT cardano_error_t cardano_bip32_public_key_from_hex(
   size_t                       hex_length,
   cardano_bip32_public_key_t** key);
 
+/**
+ * \brief Creates a BIP32 public key object from its bech32 encoding.
+ *
+ * This function decodes an extended account public key as exported by wallets and `cardano-address`,
+ * with the `acct_xvk` human-readable part (or `acct_shared_xvk` for shared wallets), into a
+ * `cardano_bip32_public_key_t` object. Such a key derives every payment and stake key of the account
+ * without any private key material, which is what watch-only wallets are built from.
+ *
+ * \param[in] bech32 A pointer to the string containing the bech32 encoded public key.
+ * \param[in] bech32_length The length of the string, excluding any null terminator.
+ * \param[out] key A pointer to a pointer to `cardano_bip32_public_key_t` where the address of
+ *            the newly created public key object will be stored. It is the caller's responsibility
+ *            to manage the lifecycle of the created object, including its deallocation through
+ *            the appropriate API function to prevent memory leaks.
+ *
+ * \return A `cardano_error_t` indicating the result of the operation. On success, the function
+ *         returns `CARDANO_SUCCESS`, and the `key` parameter is updated to point to the newly created
+ *         public key object. \ref CARDANO_ERROR_DECODING is returned if the string is not valid bech32
+ *         or its prefix is not one of an account public key, and \ref CARDANO_ERROR_INVALID_BIP32_PUBLIC_KEY_SIZE
+ *         if its payload is not 64 bytes. On failure the value pointed to by `key` is set to `NULL`.
+ *
+ * Example Usage:
+ * \code
+ * const char* account_key = "acct_xvk1..."; // Extended account public key
+ * cardano_bip32_public_key_t* public_key = NULL;
+ *
+ * cardano_error_t error = cardano_bip32_public_key_from_bech32(account_key, strlen(account_key), &public_key);
+ *
+ * if (error == CARDANO_SUCCESS)
+ * {
+ *   // Payment and stake keys of the account can now be derived from `public_key`
+ * }
+ *
+ * // Clean up
+ * cardano_bip32_public_key_unref(&public_key);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_bip32_public_key_from_bech32(
+  const char*                  bech32,
+  size_t                       bech32_length,
+  cardano_bip32_public_key_t** key);
+
 /**
  * \brief Decrements the reference count of a BIP32 public key object.
  *
@@ -252,6 +252,49 @@ CARDANO_EXPORT bool cardano_ed25519_public_verify(
   const byte_t*                       message,
   size_t                              message_len);
 
+/**
+ * \brief Verifies several signatures at once using batch Ed25519 verification.
+ *
+ * All signatures in the batch are checked together with a single multi-scalar multiplication. If the batch
+ * check fails, the signatures are re-checked one by one so every entry of `results` is exact.
+ * Signatures with a non-canonical or small-order point, or whose R and public key carry torsion components
+ * that \ref cardano_ed25519_public_verify would reject, are always checked individually, so `results[i]`
+ * matches \ref cardano_ed25519_public_verify for every entry.
+ *
+ * Ruling out torsion costs one scalar multiplication per signature, so a batch is not cheaper than verifying
+ * each signature with \ref cardano_ed25519_public_verify, and is usually slightly slower.
+ *
+ * \param[in] public_keys An array of `count` public keys.
+ * \param[in] signatures An array of `count` signatures; `signatures[i]` is checked against `public_keys[i]`.
+ * \param[in] messages An array of `count` messages.
+ * \param[in] message_lengths An array of `count` message lengths in bytes.
+ * \param[in] count The number of signatures in the batch.
+ * \param[out] results An array of `count` booleans receiving the outcome of each verification.
+ *
+ * \return \ref CARDANO_SUCCESS if the batch was processed, in which case `results` holds the individual outcomes;
+ *         \ref CARDANO_ERROR_POINTER_IS_NULL if any array or element is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if scratch memory could not be allocated.
+ *
+ * Example Usage:
+ * \code
+ * const cardano_ed25519_public_key_t* keys[2] = { key_a, key_b };
+ * const cardano_ed25519_signature_t*  sigs[2] = { sig_a, sig_b };
+ * const byte_t*                       msgs[2] = { body_hash, body_hash };
+ * const size_t                        lens[2] = { 32, 32 };
+ * bool                                valid[2];
+ *
+ * cardano_error_t result = cardano_ed25519_batch_verify(keys, sigs, msgs, lens, 2, valid);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_ed25519_batch_verify(
+  const cardano_ed25519_public_key_t* const* public_keys,
+  const cardano_ed25519_signature_t* const*  signatures,
+  const byte_t* const*                       messages,
+  const size_t*                              message_lengths,
+  size_t                                     count,
+  bool*                                      results);
+
 /**
  * \brief Retrieves a direct pointer to the internal data of a Ed25519 public key object.
  *
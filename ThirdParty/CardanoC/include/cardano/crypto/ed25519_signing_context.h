@@ -0,0 +1,163 @@
+/**
+ * \file ed25519_signing_context.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_CRYPTO_ED25519_SIGNING_CONTEXT_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_CRYPTO_ED25519_SIGNING_CONTEXT_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/crypto/ed25519_private_key.h>
+#include <cardano/crypto/ed25519_public_key.h>
+#include <cardano/crypto/ed25519_signature.h>
+#include <cardano/error.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief A precomputed Ed25519 signing key.
+ *
+ * \ref cardano_ed25519_private_key_sign expands the private key into its signing scalar and nonce prefix, and
+ * recomputes the public key from the scalar, on every call. A signing context performs that work once and keeps
+ * the results, so each signature only costs the two SHA-512 passes and the single base point multiplication that
+ * Ed25519 signing inherently requires.
+ *
+ * The scalar and prefix live in memory allocated with `sodium_malloc`: it is locked (never swapped to disk),
+ * surrounded by guard pages, read-only after creation, and wiped when the context is released.
+ *
+ * Signing does not modify the context, so one context may be used from several threads at the same time.
+ */
+typedef struct cardano_ed25519_signing_context_t cardano_ed25519_signing_context_t;
+
+/**
+ * \brief Creates a signing context from an Ed25519 private key.
+ *
+ * Both normal (32-byte seed) and extended (64-byte scalar and IV, as produced by BIP32-Ed25519 derivation) private
+ * keys are supported. Signatures produced by the context are identical to the ones \ref cardano_ed25519_private_key_sign
+ * produces with the same key.
+ *
+ * \param[in] private_key The private key to precompute. The context keeps its own copy of the expanded key, so
+ *                        `private_key` may be released right after this call.
+ * \param[out] context On success, the newly created signing context. The caller must release it with
+ *                     \ref cardano_ed25519_signing_context_unref.
+ *
+ * \return \ref CARDANO_SUCCESS if the context was created, or an error code otherwise. On failure `context` is set
+ *         to NULL.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_ed25519_signing_context_t* context = NULL;
+ *
+ * if (cardano_ed25519_signing_context_new(private_key, &context) == CARDANO_SUCCESS)
+ * {
+ *   for (size_t i = 0U; i < tx_count; ++i)
+ *   {
+ *     cardano_ed25519_signature_t* signature = NULL;
+ *
+ *     if (cardano_ed25519_signing_context_sign(context, tx_hashes[i], 32U, &signature) == CARDANO_SUCCESS)
+ *     {
+ *       // Use the signature
+ *       cardano_ed25519_signature_unref(&signature);
+ *     }
+ *   }
+ *
+ *   cardano_ed25519_signing_context_unref(&context);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_ed25519_signing_context_new(
+  const cardano_ed25519_private_key_t* private_key,
+  cardano_ed25519_signing_context_t**  context);
+
+/**
+ * \brief Signs a message with a precomputed signing key.
+ *
+ * \param[in] context The signing context.
+ * \param[in] message A pointer to the message to sign. May be NULL only if `message_length` is 0.
+ * \param[in] message_length The length of the message in bytes.
+ * \param[out] signature On success, the newly created signature. The caller must release it with
+ *                       \ref cardano_ed25519_signature_unref.
+ *
+ * \return \ref CARDANO_SUCCESS if the message was signed, or an error code otherwise. On failure `signature` is
+ *         set to NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_ed25519_signing_context_sign(
+  const cardano_ed25519_signing_context_t* context,
+  const byte_t*                            message,
+  size_t                                   message_length,
+  cardano_ed25519_signature_t**            signature);
+
+/**
+ * \brief Retrieves the public key of a signing context.
+ *
+ * The public key is computed when the context is created, so this call only copies it.
+ *
+ * \param[in] context The signing context.
+ * \param[out] public_key On success, a new public key object. The caller must release it with
+ *                        \ref cardano_ed25519_public_key_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code otherwise.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_ed25519_signing_context_get_public_key(
+  const cardano_ed25519_signing_context_t* context,
+  cardano_ed25519_public_key_t**           public_key);
+
+/**
+ * \brief Decrements the reference count of a signing context.
+ *
+ * When the reference count reaches zero the expanded key material is wiped and the context is deallocated.
+ *
+ * \param[in,out] context A pointer to the pointer of the signing context. It is set to NULL afterwards.
+ */
+CARDANO_EXPORT void cardano_ed25519_signing_context_unref(cardano_ed25519_signing_context_t** context);
+
+/**
+ * \brief Increases the reference count of a signing context.
+ *
+ * \param[in,out] context The signing context.
+ *
+ * \note Every call to \ref cardano_ed25519_signing_context_ref must be matched by a call to
+ *       \ref cardano_ed25519_signing_context_unref.
+ */
+CARDANO_EXPORT void cardano_ed25519_signing_context_ref(cardano_ed25519_signing_context_t* context);
+
+/**
+ * \brief Retrieves the current reference count of a signing context.
+ *
+ * \param[in] context The signing context.
+ *
+ * \return The number of active references, or 0 if `context` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_ed25519_signing_context_refcount(const cardano_ed25519_signing_context_t* context);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_CRYPTO_ED25519_SIGNING_CONTEXT_H
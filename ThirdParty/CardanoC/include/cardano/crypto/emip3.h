@@ -109,6 +109,34 @@ CARDANO_EXPORT cardano_error_t cardano_crypto_emip3_encrypt(
   size_t             passphrase_length,
   cardano_buffer_t** encrypted_data);
 
+/**
+ * \brief Encrypts data in the EMIP-003 format, but with a caller-chosen PBKDF2 iteration count.
+ *
+ * The output layout is the same as \ref cardano_crypto_emip3_encrypt produces, but the iteration count is not
+ * recorded in it: the data can only be decrypted with \ref cardano_crypto_emip3_decrypt_with_iterations and the
+ * same count. Only use this for local storage formats that never leave the application, where the count can be
+ * tuned to the hardware. Data meant to be exchanged with other wallets must use \ref cardano_crypto_emip3_encrypt.
+ *
+ * \param[in] data The raw data to be encrypted.
+ * \param[in] data_length The length of the raw data.
+ * \param[in] passphrase The user-provided passphrase used for deriving the encryption key.
+ * \param[in] passphrase_length The length of the passphrase.
+ * \param[in] iterations The number of PBKDF2 iterations. Must be greater than zero. EMIP-003 uses 19,162; lower values
+ *                       make unlocking faster and brute-forcing the passphrase cheaper in the same proportion.
+ * \param[out] encrypted_data A pointer to a buffer where the resulting encrypted byte array will be stored.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ARGUMENT if `iterations` is zero, or another
+ *         error code on failure.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_crypto_emip3_encrypt_with_iterations(
+  const byte_t*      data,
+  size_t             data_length,
+  const byte_t*      passphrase,
+  size_t             passphrase_length,
+  uint32_t           iterations,
+  cardano_buffer_t** encrypted_data);
+
 /**
  * \brief Decrypts data that was encrypted using the EMIP-003 standard encryption format.
  *
@@ -183,6 +211,58 @@ CARDANO_EXPORT cardano_error_t cardano_crypto_emip3_decrypt(
   size_t             passphrase_length,
   cardano_buffer_t** data);
 
+/**
+ * \brief Decrypts data encrypted by \ref cardano_crypto_emip3_encrypt_with_iterations.
+ *
+ * \param[in] encrypted_data The encrypted data to be decrypted.
+ * \param[in] encrypted_data_length The length of the encrypted data.
+ * \param[in] passphrase The user-provided passphrase used for deriving the decryption key.
+ * \param[in] passphrase_length The length of the passphrase.
+ * \param[in] iterations The PBKDF2 iteration count the data was encrypted with. Must be greater than zero.
+ * \param[out] data A pointer to a buffer where the resulting decrypted byte array will be stored. Wipe it with
+ *                  `cardano_buffer_memzero` before releasing it.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ARGUMENT if the input is too short or
+ *         `iterations` is zero, or \ref CARDANO_ERROR_GENERIC if the passphrase or iteration count is wrong.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_crypto_emip3_decrypt_with_iterations(
+  const byte_t*      encrypted_data,
+  size_t             encrypted_data_length,
+  const byte_t*      passphrase,
+  size_t             passphrase_length,
+  uint32_t           iterations,
+  cardano_buffer_t** data);
+
+/**
+ * \brief Decrypts data encrypted by \ref cardano_crypto_emip3_encrypt into memory the caller owns.
+ *
+ * Unlike \ref cardano_crypto_emip3_decrypt, no buffer is allocated for the plaintext, so it can be written to
+ * locked memory reused across operations instead of the general heap.
+ *
+ * \param[in] encrypted_data The encrypted data to be decrypted.
+ * \param[in] encrypted_data_length The length of the encrypted data.
+ * \param[in] passphrase The user-provided passphrase used for deriving the decryption key.
+ * \param[in] passphrase_length The length of the passphrase.
+ * \param[out] data Receives the decrypted bytes. Wiped on failure; the caller wipes it once done with it.
+ * \param[in] data_capacity The size of `data`. The plaintext is as long as the encrypted data minus 60 bytes of
+ *                          salt, nonce and tag.
+ * \param[out] data_length Receives the length of the decrypted bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ARGUMENT if the input is too short,
+ *         \ref CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE if the plaintext does not fit in `data`, or
+ *         \ref CARDANO_ERROR_GENERIC if the passphrase is wrong.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_crypto_emip3_decrypt_to(
+  const byte_t* encrypted_data,
+  size_t        encrypted_data_length,
+  const byte_t* passphrase,
+  size_t        passphrase_length,
+  byte_t*       data,
+  size_t        data_capacity,
+  size_t*       data_length);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -157,6 +157,11 @@ typedef enum
    */
   CARDANO_ERROR_JSON_TYPE_MISMATCH = 23,
 
+  /**
+   * \brief The object is frozen and cannot be modified.
+   */
+  CARDANO_ERROR_OBJECT_IS_FROZEN = 24,
+
   /* Serialization errors */
 
   /**
@@ -0,0 +1,637 @@
+/**
+ * \file hydra_common.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "hydra_common.h"
+#include "../../console.h"
+#include "../../utils.h"
+
+#include <cardano/crypto/blake2b_hash.h>
+#include <cardano/export.h>
+
+#include <curl/curl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief libcurl 7.86.0 is the first release with the WebSocket API.
+ */
+#if defined(LIBCURL_VERSION_NUM) && (LIBCURL_VERSION_NUM >= 0x075600)
+#define HYDRA_HAS_WEBSOCKETS 1
+#else
+#define HYDRA_HAS_WEBSOCKETS 0
+#endif
+
+/**
+ * \brief The time slept between two reads of a WebSocket connection with no data, in milliseconds.
+ */
+static const uint64_t HYDRA_WS_POLL_INTERVAL_MS = 2U;
+
+/**
+ * \brief The time allowed for the WebSocket handshake, in seconds.
+ */
+static const long HYDRA_WS_CONNECT_TIMEOUT_SEC = 10L;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Gets the libcurl handle of the HTTP requests of a head, ready for a new request.
+ *
+ * The handle is created on first use and reset on later ones, which keeps its live connection to the node.
+ *
+ * \param[in] head The head.
+ *
+ * \return The handle, or `NULL` if libcurl could not be initialized.
+ */
+static CURL*
+get_curl_handle(hydra_head_t* head)
+{
+  if (head->curl == NULL)
+  {
+    if (curl_global_init(CURL_GLOBAL_DEFAULT) != CURLE_OK)
+    {
+      return NULL;
+    }
+
+    head->curl = curl_easy_init();
+
+    if (head->curl == NULL)
+    {
+      curl_global_cleanup();
+
+      return NULL;
+    }
+  }
+  else
+  {
+    curl_easy_reset(head->curl);
+  }
+
+  CURL* curl = head->curl;
+
+  curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+  curl_easy_setopt(curl, CURLOPT_TCP_NODELAY, 1L);
+
+  if (head->headers == NULL)
+  {
+    head->headers = curl_slist_append(NULL, "Accept: application/json");
+    head->headers = curl_slist_append(head->headers, "Content-Type: application/json");
+  }
+
+  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, head->headers);
+
+  return curl;
+}
+
+/**
+ * \brief libcurl write callback appending the received data to a \ref cardano_buffer_t.
+ *
+ * \param[in] contents      A pointer to the raw data received from the server.
+ * \param[in] size          The size of each data chunk received.
+ * \param[in] count         The number of data chunks received.
+ * \param[in] user_provided The \ref cardano_buffer_t the data is appended to.
+ *
+ * \return The number of bytes processed, `size * count`.
+ */
+static size_t
+handle_response(void* contents, const size_t size, const size_t count, void* user_provided)
+{
+  const size_t      total_size = size * count;
+  cardano_buffer_t* buffer     = (cardano_buffer_t*)user_provided;
+
+  cardano_error_t result = cardano_buffer_write(buffer, contents, total_size);
+
+  CARDANO_UNUSED(result);
+
+  return total_size;
+}
+
+/**
+ * \brief Performs a prepared HTTP request and reads its status code.
+ *
+ * \param[in] provider_impl The provider implementation.
+ * \param[in] curl The prepared handle.
+ * \param[out] response_code The HTTP status code of the response.
+ * \param[in,out] response_buffer The response body; released if the request fails.
+ *
+ * \return \ref CARDANO_SUCCESS if a response was received, or \ref CARDANO_ERROR_GENERIC otherwise.
+ */
+static cardano_error_t
+perform_request(
+  cardano_provider_impl_t* provider_impl,
+  CURL*                    curl,
+  uint64_t*                response_code,
+  cardano_buffer_t**       response_buffer)
+{
+  CURLcode res = curl_easy_perform(curl);
+
+  if (res != CURLE_OK)
+  {
+    cardano_utils_set_error_message(provider_impl, curl_easy_strerror(res));
+
+    cardano_buffer_unref(response_buffer);
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  long code = 0;
+  curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &code);
+
+  *response_code = (uint64_t)code;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Drops the WebSocket connection of a head.
+ *
+ * \param[in] head The head.
+ */
+static void
+close_websocket(hydra_head_t* head)
+{
+  if (head->ws == NULL)
+  {
+    return;
+  }
+
+  curl_easy_cleanup(head->ws);
+  curl_global_cleanup();
+
+  head->ws = NULL;
+}
+
+/**
+ * \brief Records the id of a transaction of a confirmed snapshot.
+ *
+ * \param[in] head The head.
+ * \param[in] tx_id_hex The hex id of the transaction.
+ * \param[in] tx_id_hex_size The size of the id, excluding the null terminator.
+ */
+static void
+record_confirmed_transaction(hydra_head_t* head, const char* tx_id_hex, const size_t tx_id_hex_size)
+{
+  cardano_blake2b_hash_t* tx_id = NULL;
+
+  if (cardano_blake2b_hash_from_hex(tx_id_hex, tx_id_hex_size, &tx_id) != CARDANO_SUCCESS)
+  {
+    return;
+  }
+
+  if (cardano_blake2b_hash_get_bytes_size(tx_id) == sizeof(head->confirmed[0]))
+  {
+    cardano_utils_safe_memcpy(
+      head->confirmed[head->confirmed_count % HYDRA_CONFIRMED_TX_CAPACITY],
+      sizeof(head->confirmed[0]),
+      cardano_blake2b_hash_get_data(tx_id),
+      sizeof(head->confirmed[0]));
+
+    ++head->confirmed_count;
+  }
+
+  cardano_blake2b_hash_unref(&tx_id);
+}
+
+/**
+ * \brief Records the transactions of a `SnapshotConfirmed` server output.
+ *
+ * Recent nodes list the confirmed transactions in full under `snapshot.confirmed`, older ones list their ids under
+ * `snapshot.confirmedTransactions`; both are read.
+ *
+ * \param[in] head The head.
+ * \param[in] message The server output.
+ */
+static void
+record_confirmed_snapshot(hydra_head_t* head, cardano_json_object_t* message)
+{
+  cardano_json_object_t* snapshot = NULL;
+
+  if (!cardano_json_object_get_ex(message, "snapshot", 8, &snapshot))
+  {
+    return;
+  }
+
+  cardano_json_object_t* transactions = NULL;
+
+  if (!cardano_json_object_get_ex(snapshot, "confirmed", 9, &transactions)
+    && !cardano_json_object_get_ex(snapshot, "confirmedTransactions", 21, &transactions))
+  {
+    return;
+  }
+
+  const size_t count = cardano_json_object_array_get_length(transactions);
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    cardano_json_object_t* transaction = cardano_json_object_array_get_ex(transactions, i);
+    cardano_json_object_t* tx_id       = transaction;
+
+    if ((cardano_json_object_get_type(transaction) == CARDANO_JSON_OBJECT_TYPE_OBJECT)
+      && !cardano_json_object_get_ex(transaction, "txId", 4, &tx_id))
+    {
+      continue;
+    }
+
+    if (cardano_json_object_get_type(tx_id) != CARDANO_JSON_OBJECT_TYPE_STRING)
+    {
+      continue;
+    }
+
+    size_t      tx_id_size = 0U;
+    const char* tx_id_hex  = cardano_json_object_get_string(tx_id, &tx_id_size);
+
+    if ((tx_id_hex != NULL) && (tx_id_size > 1U))
+    {
+      record_confirmed_transaction(head, tx_id_hex, tx_id_size - 1U);
+    }
+  }
+}
+
+#if HYDRA_HAS_WEBSOCKETS
+
+/**
+ * \brief Opens the WebSocket connection of a head, unless it is already open.
+ *
+ * \param[in] provider_impl The provider implementation, whose context is the head.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_GENERIC if the handshake failed.
+ */
+static cardano_error_t
+open_websocket(cardano_provider_impl_t* provider_impl)
+{
+  hydra_head_t* head = (hydra_head_t*)provider_impl->context;
+
+  if (head->ws != NULL)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  if (curl_global_init(CURL_GLOBAL_DEFAULT) != CURLE_OK)
+  {
+    cardano_utils_set_error_message(provider_impl, "Failed to initialize libcurl");
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  CURL* ws = curl_easy_init();
+
+  if (ws == NULL)
+  {
+    curl_global_cleanup();
+    cardano_utils_set_error_message(provider_impl, "Failed to initialize libcurl");
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  // Mode 2 makes curl_easy_perform stop after the handshake and leave the connection to curl_ws_send and curl_ws_recv
+  curl_easy_setopt(ws, CURLOPT_URL, head->ws_url);
+  curl_easy_setopt(ws, CURLOPT_CONNECT_ONLY, 2L);
+  curl_easy_setopt(ws, CURLOPT_CONNECTTIMEOUT, HYDRA_WS_CONNECT_TIMEOUT_SEC);
+  curl_easy_setopt(ws, CURLOPT_TCP_KEEPALIVE, 1L);
+  curl_easy_setopt(ws, CURLOPT_TCP_NODELAY, 1L);
+
+  console_debug("Connecting to WebSocket: %s", head->ws_url);
+
+  CURLcode res = curl_easy_perform(ws);
+
+  if (res != CURLE_OK)
+  {
+    cardano_utils_set_error_message(provider_impl, curl_easy_strerror(res));
+
+    curl_easy_cleanup(ws);
+    curl_global_cleanup();
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  head->ws = ws;
+
+  return CARDANO_SUCCESS;
+}
+
+#endif
+
+/* DEFINITIONS ***************************************************************/
+
+char*
+cardano_hydra_get_endpoint_url(const hydra_head_t* head, const char* endpoint)
+{
+  const size_t base_url_size = cardano_utils_safe_strlen(head->base_url, sizeof(head->base_url));
+  const size_t endpoint_size = cardano_utils_safe_strlen(endpoint, 1024U);
+  const size_t url_size      = base_url_size + endpoint_size + 1U;
+
+  char* url = malloc(url_size);
+
+  if (url == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_utils_safe_memcpy(url, url_size, head->base_url, base_url_size);
+  cardano_utils_safe_memcpy(url + base_url_size, url_size - base_url_size, endpoint, endpoint_size);
+  url[base_url_size + endpoint_size] = '\0';
+
+  return url;
+}
+
+void
+cardano_hydra_head_deallocate(void* object)
+{
+  hydra_head_t* head = (hydra_head_t*)object;
+
+  if (head == NULL)
+  {
+    return;
+  }
+
+  close_websocket(head);
+  curl_slist_free_all(head->headers);
+
+  if (head->curl != NULL)
+  {
+    curl_easy_cleanup(head->curl);
+    curl_global_cleanup();
+  }
+
+  free(head);
+}
+
+void
+cardano_hydra_parse_error(cardano_provider_impl_t* provider, const uint64_t response_code, cardano_buffer_t* buffer)
+{
+  if ((response_code == 0U) && (provider->error_message[0] != '\0'))
+  {
+    /* The request failed before any response, the libcurl error is more useful than a status code. */
+    return;
+  }
+
+  if ((buffer == NULL) || (cardano_buffer_get_size(buffer) == 0U))
+  {
+    CARDANO_UNUSED(snprintf(provider->error_message, 1024, "hydra-node returned HTTP %lu", (unsigned long)response_code));
+    return;
+  }
+
+  const char*  body      = (const char*)cardano_buffer_get_data(buffer);
+  const size_t body_size = cardano_buffer_get_size(buffer);
+
+  CARDANO_UNUSED(snprintf(provider->error_message, 1024, "%lu - %.*s", (unsigned long)response_code, (int)body_size, body));
+}
+
+cardano_error_t
+cardano_hydra_http_get(
+  cardano_provider_impl_t* provider_impl,
+  const char*              url,
+  uint64_t*                response_code,
+  cardano_buffer_t**       response_buffer)
+{
+  hydra_head_t* head = (hydra_head_t*)provider_impl->context;
+  *response_buffer   = cardano_buffer_new(4096);
+  *response_code     = 0;
+
+  CURL* curl = get_curl_handle(head);
+
+  if ((curl == NULL) || (*response_buffer == NULL))
+  {
+    cardano_buffer_unref(response_buffer);
+    cardano_utils_set_error_message(provider_impl, "Failed to initialize libcurl");
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  curl_easy_setopt(curl, CURLOPT_URL, url);
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, handle_response);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void*)(*response_buffer));
+
+  console_debug("Sending GET request to endpoint: %s", url);
+
+  return perform_request(provider_impl, curl, response_code, response_buffer);
+}
+
+cardano_error_t
+cardano_hydra_http_post(
+  cardano_provider_impl_t* provider_impl,
+  const char*              url,
+  const byte_t*            body,
+  const size_t             body_size,
+  uint64_t*                response_code,
+  cardano_buffer_t**       response_buffer)
+{
+  hydra_head_t* head = (hydra_head_t*)provider_impl->context;
+  *response_buffer   = cardano_buffer_new(4096);
+  *response_code     = 0;
+
+  CURL* curl = get_curl_handle(head);
+
+  if ((curl == NULL) || (*response_buffer == NULL))
+  {
+    cardano_buffer_unref(response_buffer);
+    cardano_utils_set_error_message(provider_impl, "Failed to initialize libcurl");
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  curl_easy_setopt(curl, CURLOPT_URL, url);
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, handle_response);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void*)(*response_buffer));
+  curl_easy_setopt(curl, CURLOPT_POST, 1L);
+  curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body);
+  curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, (long)body_size);
+
+  console_debug("Sending POST request to endpoint: %s", url);
+
+  return perform_request(provider_impl, curl, response_code, response_buffer);
+}
+
+cardano_error_t
+cardano_hydra_ws_send(cardano_provider_impl_t* provider_impl, const char* message, const size_t message_size)
+{
+#if HYDRA_HAS_WEBSOCKETS
+  hydra_head_t*   head   = (hydra_head_t*)provider_impl->context;
+  cardano_error_t result = open_websocket(provider_impl);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  size_t offset = 0U;
+
+  while (offset < message_size)
+  {
+    size_t   sent = 0U;
+    CURLcode res  = curl_ws_send(head->ws, message + offset, message_size - offset, &sent, 0, CURLWS_TEXT);
+
+    offset += sent;
+
+    if (res == CURLE_AGAIN)
+    {
+      cardano_utils_sleep(HYDRA_WS_POLL_INTERVAL_MS);
+    }
+    else if (res != CURLE_OK)
+    {
+      cardano_utils_set_error_message(provider_impl, curl_easy_strerror(res));
+      close_websocket(head);
+
+      return CARDANO_ERROR_GENERIC;
+    }
+  }
+
+  return CARDANO_SUCCESS;
+#else
+  CARDANO_UNUSED(message);
+  CARDANO_UNUSED(message_size);
+
+  cardano_utils_set_error_message(provider_impl, "libcurl was built without WebSocket support");
+
+  return CARDANO_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+cardano_error_t
+cardano_hydra_ws_receive(cardano_provider_impl_t* provider_impl, const uint64_t timeout_ms, cardano_json_object_t** message)
+{
+  *message = NULL;
+
+#if HYDRA_HAS_WEBSOCKETS
+  hydra_head_t* head = (hydra_head_t*)provider_impl->context;
+
+  if (head->ws == NULL)
+  {
+    cardano_utils_set_error_message(provider_impl, "The WebSocket connection to the hydra-node is closed");
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  cardano_buffer_t* frame = cardano_buffer_new(4096);
+
+  if (frame == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  uint64_t waited_ms = 0U;
+
+  while (*message == NULL)
+  {
+    byte_t                      chunk[4096];
+    size_t                      received = 0U;
+    struct curl_ws_frame*       meta     = NULL;
+    CURLcode                    res      = curl_ws_recv(head->ws, chunk, sizeof(chunk), &received, &meta);
+
+    if (res == CURLE_AGAIN)
+    {
+      if (waited_ms >= timeout_ms)
+      {
+        break;
+      }
+
+      cardano_utils_sleep(HYDRA_WS_POLL_INTERVAL_MS);
+      waited_ms += HYDRA_WS_POLL_INTERVAL_MS;
+
+      continue;
+    }
+
+    if ((res != CURLE_OK) || ((meta != NULL) && ((meta->flags & CURLWS_CLOSE) != 0)))
+    {
+      cardano_utils_set_error_message(provider_impl, (res != CURLE_OK) ? curl_easy_strerror(res) : "The hydra-node closed the WebSocket connection");
+      cardano_buffer_unref(&frame);
+      close_websocket(head);
+
+      return CARDANO_ERROR_GENERIC;
+    }
+
+    // libcurl answers pings itself; only the text frames of server outputs are read
+    if ((meta == NULL) || ((meta->flags & (CURLWS_TEXT | CURLWS_CONT)) == 0))
+    {
+      continue;
+    }
+
+    if (cardano_buffer_write(frame, chunk, received) != CARDANO_SUCCESS)
+    {
+      cardano_buffer_unref(&frame);
+
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    if ((meta->bytesleft > 0) || ((meta->flags & CURLWS_CONT) != 0))
+    {
+      continue;
+    }
+
+    *message = cardano_json_object_parse((const char*)cardano_buffer_get_data(frame), cardano_buffer_get_size(frame));
+
+    cardano_error_t reset_result = cardano_buffer_set_size(frame, 0U);
+
+    CARDANO_UNUSED(reset_result);
+
+    if ((*message != NULL) && (strcmp(cardano_hydra_get_message_tag(*message), "SnapshotConfirmed") == 0))
+    {
+      record_confirmed_snapshot(head, *message);
+    }
+  }
+
+  cardano_buffer_unref(&frame);
+
+  return CARDANO_SUCCESS;
+#else
+  CARDANO_UNUSED(timeout_ms);
+
+  cardano_utils_set_error_message(provider_impl, "libcurl was built without WebSocket support");
+
+  return CARDANO_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+const char*
+cardano_hydra_get_message_tag(cardano_json_object_t* message)
+{
+  cardano_json_object_t* tag = NULL;
+
+  if ((message == NULL) || !cardano_json_object_get_ex(message, "tag", 3, &tag) || (cardano_json_object_get_type(tag) != CARDANO_JSON_OBJECT_TYPE_STRING))
+  {
+    return "";
+  }
+
+  size_t      tag_size = 0U;
+  const char* string   = cardano_json_object_get_string(tag, &tag_size);
+
+  return (string != NULL) ? string : "";
+}
+
+bool
+cardano_hydra_is_confirmed(const hydra_head_t* head, const byte_t* tx_id)
+{
+  const size_t count = (head->confirmed_count < HYDRA_CONFIRMED_TX_CAPACITY) ? head->confirmed_count : HYDRA_CONFIRMED_TX_CAPACITY;
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    if (memcmp(head->confirmed[i], tx_id, sizeof(head->confirmed[i])) == 0)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
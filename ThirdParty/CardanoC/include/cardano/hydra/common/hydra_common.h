@@ -0,0 +1,217 @@
+/**
+ * \file hydra_common.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_HYDRA_COMMON_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_HYDRA_COMMON_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/common/network_magic.h>
+#include <cardano/json/json_object.h>
+#include <cardano/providers/provider.h>
+#include <cardano/typedefs.h>
+
+#include "../hydra_provider.h"
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The number of transaction ids kept from the confirmed snapshots seen on the WebSocket API.
+ */
+#define HYDRA_CONFIRMED_TX_CAPACITY 256U
+
+/* STRUCTURES ***************************************************************/
+
+/**
+ * \brief The state of a connection to a hydra-node; also the context of the providers created from it.
+ *
+ * \var network
+ * The layer 1 network the head was opened on.
+ *
+ * \var base_url
+ * The base URL of the HTTP API, ending with a slash, e.g. "http://127.0.0.1:4001/".
+ *
+ * \var ws_url
+ * The URL of the WebSocket API, without history replay nor snapshot UTxOs in the messages.
+ *
+ * \var curl
+ * The libcurl easy handle of the HTTP requests, or `NULL` until the first request.
+ *
+ * \var ws
+ * The libcurl easy handle of the WebSocket connection, or `NULL` while not connected.
+ *
+ * \var headers
+ * The HTTP request headers, built on first use.
+ *
+ * \var confirmed
+ * The ids of the last transactions seen in a confirmed snapshot, written round-robin.
+ *
+ * \var confirmed_count
+ * The number of ids ever written to `confirmed`.
+ */
+struct hydra_head_t
+{
+    cardano_object_t        base;
+    cardano_network_magic_t network;
+    char                    base_url[256];
+    char                    ws_url[320];
+    void*                   curl;
+    void*                   ws;
+    struct curl_slist*      headers;
+    byte_t                  confirmed[HYDRA_CONFIRMED_TX_CAPACITY][32];
+    size_t                  confirmed_count;
+};
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Builds the URL of an endpoint of the HTTP API of a node.
+ *
+ * \param[in] head The head holding the base URL.
+ * \param[in] endpoint The endpoint path relative to the base URL, e.g. "snapshot/utxo".
+ *
+ * \return The URL, which the caller must release with `free`, or `NULL` if memory allocation fails.
+ */
+char*
+cardano_hydra_get_endpoint_url(const hydra_head_t* head, const char* endpoint);
+
+/**
+ * \brief Releases a head, closing its connections.
+ *
+ * This is the deallocator of \ref hydra_head_t objects.
+ *
+ * \param[in] object A pointer to the \ref hydra_head_t to release.
+ */
+void
+cardano_hydra_head_deallocate(void* object);
+
+/**
+ * \brief Stores the error message of a failed HTTP response of a node in the provider.
+ *
+ * \param[in] provider The provider implementation where the error message will be stored.
+ * \param[in] response_code The HTTP status code of the response.
+ * \param[in] buffer The response body, or `NULL`.
+ */
+void
+cardano_hydra_parse_error(cardano_provider_impl_t* provider, uint64_t response_code, cardano_buffer_t* buffer);
+
+/**
+ * \brief Performs an HTTP GET request against the API of a node.
+ *
+ * \param[in]  provider_impl   The provider implementation, whose context is the head. Must not be `NULL`.
+ * \param[in]  url             The null-terminated URL to request. Must not be `NULL`.
+ * \param[out] response_code   The HTTP status code of the response.
+ * \param[out] response_buffer The response body. The caller must release it with \ref cardano_buffer_unref.
+ *
+ * \return \ref CARDANO_SUCCESS if a response was received, whatever its status code, or an error code if the request
+ *         could not be performed.
+ */
+cardano_error_t
+cardano_hydra_http_get(
+  cardano_provider_impl_t* provider_impl,
+  const char*              url,
+  uint64_t*                response_code,
+  cardano_buffer_t**       response_buffer);
+
+/**
+ * \brief Performs an HTTP POST request with a JSON body against the API of a node.
+ *
+ * \param[in]  provider_impl   The provider implementation, whose context is the head. Must not be `NULL`.
+ * \param[in]  url             The null-terminated URL to post to. Must not be `NULL`.
+ * \param[in]  body            The JSON body.
+ * \param[in]  body_size       The size of the body in bytes.
+ * \param[out] response_code   The HTTP status code of the response.
+ * \param[out] response_buffer The response body. The caller must release it with \ref cardano_buffer_unref.
+ *
+ * \return \ref CARDANO_SUCCESS if a response was received, whatever its status code, or an error code if the request
+ *         could not be performed.
+ */
+cardano_error_t
+cardano_hydra_http_post(
+  cardano_provider_impl_t* provider_impl,
+  const char*              url,
+  const byte_t*            body,
+  size_t                   body_size,
+  uint64_t*                response_code,
+  cardano_buffer_t**       response_buffer);
+
+/**
+ * \brief Sends a client input to the WebSocket API of a node, connecting first if needed.
+ *
+ * \param[in] provider_impl The provider implementation, whose context is the head. Must not be `NULL`.
+ * \param[in] message       The JSON of the client input.
+ * \param[in] message_size  The size of the JSON in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_NOT_IMPLEMENTED if libcurl was built without WebSocket
+ *         support, or \ref CARDANO_ERROR_GENERIC if the message could not be sent.
+ */
+cardano_error_t
+cardano_hydra_ws_send(cardano_provider_impl_t* provider_impl, const char* message, size_t message_size);
+
+/**
+ * \brief Waits for the next server output of the WebSocket API of a node.
+ *
+ * The ids of the transactions of every `SnapshotConfirmed` output read are recorded in the head, whoever waits for
+ * it, so \ref cardano_hydra_is_confirmed knows of them.
+ *
+ * \param[in] provider_impl The provider implementation, whose context is the head. Must not be `NULL`.
+ * \param[in] timeout_ms    The maximum time to wait, in milliseconds.
+ * \param[out] message      On success, the output, or `NULL` if none arrived in time. The caller must release it with
+ *                          \ref cardano_json_object_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, including when the wait timed out, or an error code if the connection
+ *         failed; it is then dropped and reopened by the next \ref cardano_hydra_ws_send.
+ */
+cardano_error_t
+cardano_hydra_ws_receive(cardano_provider_impl_t* provider_impl, uint64_t timeout_ms, cardano_json_object_t** message);
+
+/**
+ * \brief Gets the `tag` of a server output.
+ *
+ * \param[in] message The server output.
+ *
+ * \return The tag, owned by \p message, or an empty string if it has none.
+ */
+const char*
+cardano_hydra_get_message_tag(cardano_json_object_t* message);
+
+/**
+ * \brief Checks whether a transaction was seen in a snapshot confirmed since the connection was opened.
+ *
+ * \param[in] head  The head.
+ * \param[in] tx_id The 32 bytes of the transaction id.
+ *
+ * \return `true` if one of the last \ref HYDRA_CONFIRMED_TX_CAPACITY confirmed transactions has this id.
+ */
+bool
+cardano_hydra_is_confirmed(const hydra_head_t* head, const byte_t* tx_id);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_HYDRA_COMMON_H
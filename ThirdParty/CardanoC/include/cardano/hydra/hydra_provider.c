@@ -0,0 +1,1188 @@
+/**
+ * \file hydra_provider.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/json/json_object.h>
+#include <cardano/json/json_writer.h>
+
+#include "hydra_provider.h"
+
+#include "../utils.h"
+#include "common/hydra_common.h"
+#include "parsers/hydra_parsers.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The time a submission waits for the node to validate the transaction against the head state.
+ *
+ * The node answers with `TxValid` or `TxInvalid` as soon as it applied the transaction locally, well before the
+ * snapshot holding it is confirmed.
+ */
+static const uint64_t HYDRA_SUBMIT_TIMEOUT_MS = 30000U;
+
+/**
+ * \brief The interval between two `snapshot/utxo` queries while waiting for a confirmation without a WebSocket
+ * connection.
+ */
+static const uint64_t HYDRA_SNAPSHOT_POLL_INTERVAL_MS = 1000U;
+
+/**
+ * \brief The size of a "<tx id>#<index>" reference, with the null terminator.
+ */
+#define HYDRA_UTXO_REF_SIZE 88U
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief The context of the filter selecting the outputs of an address and, optionally, holding an asset.
+ *
+ * \var address
+ * The bech32 or base58 address the outputs must be locked at, or `NULL` for any address.
+ *
+ * \var policy_id
+ * The hex policy id of the asset the outputs must hold, or `NULL` for any output.
+ *
+ * \var asset_name
+ * The hex name of the asset the outputs must hold, meaningful only with `policy_id`.
+ */
+typedef struct
+{
+    const char* address;
+    const char* policy_id;
+    const char* asset_name;
+} hydra_output_filter_t;
+
+/**
+ * \brief The context of the filter selecting the outputs spent by a set of inputs.
+ *
+ * \var refs
+ * The "<tx id>#<index>" references of the inputs.
+ *
+ * \var count
+ * The number of references.
+ */
+typedef struct
+{
+    char (*refs)[HYDRA_UTXO_REF_SIZE];
+    size_t count;
+} hydra_input_filter_t;
+
+/**
+ * \brief The context of the filter looking for the outputs of a transaction.
+ *
+ * \var prefix
+ * The "<tx id>#" prefix of the references of the outputs.
+ *
+ * \var found
+ * Set once an output of the transaction was seen.
+ */
+typedef struct
+{
+    char prefix[66];
+    bool found;
+} hydra_tx_filter_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Gets a string property of a JSON object.
+ *
+ * \param[in] object The JSON object.
+ * \param[in] key The null-terminated property name.
+ *
+ * \return The string, owned by \p object, or `NULL` if the property is missing or not a string.
+ */
+static const char*
+get_string_property(cardano_json_object_t* object, const char* key)
+{
+  cardano_json_object_t* value = NULL;
+
+  if ((object == NULL) || !cardano_json_object_get_ex(object, key, strlen(key), &value) || (cardano_json_object_get_type(value) != CARDANO_JSON_OBJECT_TYPE_STRING))
+  {
+    return NULL;
+  }
+
+  size_t size = 0U;
+
+  return cardano_json_object_get_string(value, &size);
+}
+
+/**
+ * \brief Gets an object property of a JSON object.
+ *
+ * \param[in] object The JSON object.
+ * \param[in] key The null-terminated property name.
+ *
+ * \return The property, owned by \p object, or `NULL` if it is missing or not an object.
+ */
+static cardano_json_object_t*
+get_object_property(cardano_json_object_t* object, const char* key)
+{
+  cardano_json_object_t* value = NULL;
+
+  if ((object == NULL) || !cardano_json_object_get_ex(object, key, strlen(key), &value) || (cardano_json_object_get_type(value) != CARDANO_JSON_OBJECT_TYPE_OBJECT))
+  {
+    return NULL;
+  }
+
+  return value;
+}
+
+/**
+ * \brief Selects the outputs matching a \ref hydra_output_filter_t.
+ *
+ * \param[in] ref The reference of the entry.
+ * \param[in] ref_size The size of the reference.
+ * \param[in] output The JSON of the output.
+ * \param[in] context The \ref hydra_output_filter_t.
+ *
+ * \return `true` if the output matches.
+ */
+static bool
+output_filter(const char* ref, const size_t ref_size, cardano_json_object_t* output, void* context)
+{
+  CARDANO_UNUSED(ref);
+  CARDANO_UNUSED(ref_size);
+
+  const hydra_output_filter_t* filter = (const hydra_output_filter_t*)context;
+
+  if (filter->address != NULL)
+  {
+    const char* address = get_string_property(output, "address");
+
+    if ((address == NULL) || (strcmp(address, filter->address) != 0))
+    {
+      return false;
+    }
+  }
+
+  if (filter->policy_id == NULL)
+  {
+    return true;
+  }
+
+  cardano_json_object_t* assets = get_object_property(get_object_property(output, "value"), filter->policy_id);
+
+  /* Asset names may be empty, which cardano_json_object_get does not look up, so the names are compared one by one. */
+  for (size_t i = 0U; i < cardano_json_object_get_property_count(assets); ++i)
+  {
+    size_t      name_size = 0U;
+    const char* name      = cardano_json_object_get_key_at(assets, i, &name_size);
+
+    if ((name != NULL) && (strcmp(name, filter->asset_name) == 0))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * \brief Selects the outputs spent by the inputs of a \ref hydra_input_filter_t.
+ *
+ * \param[in] ref The reference of the entry.
+ * \param[in] ref_size The size of the reference.
+ * \param[in] output The JSON of the output.
+ * \param[in] context The \ref hydra_input_filter_t.
+ *
+ * \return `true` if one of the inputs spends the output.
+ */
+static bool
+input_filter(const char* ref, const size_t ref_size, cardano_json_object_t* output, void* context)
+{
+  CARDANO_UNUSED(output);
+
+  const hydra_input_filter_t* filter = (const hydra_input_filter_t*)context;
+
+  for (size_t i = 0U; i < filter->count; ++i)
+  {
+    if ((strlen(filter->refs[i]) == ref_size) && (memcmp(filter->refs[i], ref, ref_size) == 0))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * \brief Looks for the outputs of the transaction of a \ref hydra_tx_filter_t without decoding any entry.
+ *
+ * \param[in] ref The reference of the entry.
+ * \param[in] ref_size The size of the reference.
+ * \param[in] output The JSON of the output.
+ * \param[in] context The \ref hydra_tx_filter_t.
+ *
+ * \return `false`, the outputs are only looked for.
+ */
+static bool
+tx_filter(const char* ref, const size_t ref_size, cardano_json_object_t* output, void* context)
+{
+  CARDANO_UNUSED(output);
+
+  hydra_tx_filter_t* filter = (hydra_tx_filter_t*)context;
+  const size_t       size   = strlen(filter->prefix);
+
+  if ((ref_size > size) && (memcmp(ref, filter->prefix, size) == 0))
+  {
+    filter->found = true;
+  }
+
+  return false;
+}
+
+/**
+ * \brief Queries the UTxO set of the last confirmed snapshot of the head.
+ *
+ * \param[in] provider_impl The provider implementation. Must not be `NULL`.
+ * \param[in] filter The filter selecting the outputs to decode.
+ * \param[in] filter_context The context given to \p filter.
+ * \param[out] utxo_list On success, the selected UTxOs. The caller must release the list with \ref cardano_utxo_list_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+query_snapshot_utxos(
+  cardano_provider_impl_t*    provider_impl,
+  cardano_hydra_utxo_filter_t filter,
+  void*                       filter_context,
+  cardano_utxo_list_t**       utxo_list)
+{
+  hydra_head_t*     head            = (hydra_head_t*)provider_impl->context;
+  char*             url             = cardano_hydra_get_endpoint_url(head, "snapshot/utxo");
+  cardano_buffer_t* response_buffer = NULL;
+  uint64_t          response_code   = 0U;
+
+  if (url == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_hydra_http_get(provider_impl, url, &response_code, &response_buffer);
+  free(url);
+
+  if ((response_code != 200U) || (result != CARDANO_SUCCESS))
+  {
+    cardano_hydra_parse_error(provider_impl, response_code, response_buffer);
+
+    cardano_buffer_unref(&response_buffer);
+
+    return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+  }
+
+  result = cardano_hydra_parse_utxo_set(
+    provider_impl,
+    (char*)cardano_buffer_get_data(response_buffer),
+    cardano_buffer_get_size(response_buffer),
+    filter,
+    filter_context,
+    utxo_list);
+
+  cardano_buffer_unref(&response_buffer);
+
+  return result;
+}
+
+/**
+ * \brief Checks whether a server output refers to a transaction, through its `transactionId` or `transaction.txId`.
+ *
+ * \param[in] message The server output.
+ * \param[in] tx_id_hex The hex id of the transaction.
+ *
+ * \return `true` if the output refers to the transaction.
+ */
+static bool
+is_output_for_transaction(cardano_json_object_t* message, const char* tx_id_hex)
+{
+  const char* id = get_string_property(message, "transactionId");
+
+  if (id == NULL)
+  {
+    id = get_string_property(get_object_property(message, "transaction"), "txId");
+  }
+
+  return (id != NULL) && (strcmp(id, tx_id_hex) == 0);
+}
+
+/**
+ * \brief Checks whether a `CommandFailed` server output answers a client input.
+ *
+ * \param[in] message The server output.
+ * \param[in] input_tag The tag of the client input.
+ *
+ * \return `true` if \p message reports the failure of a \p input_tag input.
+ */
+static bool
+is_failure_of(cardano_json_object_t* message, const char* input_tag)
+{
+  if (strcmp(cardano_hydra_get_message_tag(message), "CommandFailed") != 0)
+  {
+    return false;
+  }
+
+  return strcmp(cardano_hydra_get_message_tag(get_object_property(message, "clientInput")), input_tag) == 0;
+}
+
+/**
+ * \brief Gets the time left before a deadline.
+ *
+ * \param[in] start_time_sec The time the wait started at, in seconds.
+ * \param[in] timeout_ms The length of the wait, in milliseconds.
+ *
+ * \return The time left, in milliseconds.
+ */
+static uint64_t
+get_remaining_time_ms(const uint64_t start_time_sec, const uint64_t timeout_ms)
+{
+  const uint64_t elapsed_time_ms = cardano_utils_get_elapsed_time_since(start_time_sec) * 1000U;
+
+  return (elapsed_time_ms >= timeout_ms) ? 0U : (timeout_ms - elapsed_time_ms);
+}
+
+/**
+ * \brief Sends a head lifecycle command and waits for the head to report its outcome.
+ *
+ * \param[in] provider_impl The provider implementation, whose context is the head. Must not be `NULL`.
+ * \param[in] input_tag The tag of the client input, e.g. "Close".
+ * \param[in] expected_tag The tag of the server output reporting the success of the command, e.g. "HeadIsClosed".
+ * \param[in] timeout_ms The maximum time to wait, in milliseconds.
+ *
+ * \return \ref CARDANO_SUCCESS once \p expected_tag was received, \ref CARDANO_ERROR_INVALID_HTTP_REQUEST if the node
+ *         refused the command or failed to post its layer 1 transaction, \ref CARDANO_ERROR_GENERIC on timeout, or
+ *         another error code on failure.
+ */
+static cardano_error_t
+run_head_command(
+  cardano_provider_impl_t* provider_impl,
+  const char*              input_tag,
+  const char*              expected_tag,
+  const uint64_t           timeout_ms)
+{
+  char message[64] = { 0 };
+  int  size        = snprintf(message, sizeof(message), "{\"tag\":\"%s\"}", input_tag);
+
+  cardano_error_t result = cardano_hydra_ws_send(provider_impl, message, (size_t)size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const uint64_t start_time_sec    = cardano_utils_get_time();
+  uint64_t       remaining_time_ms = timeout_ms;
+
+  do
+  {
+    cardano_json_object_t* output = NULL;
+
+    result = cardano_hydra_ws_receive(provider_impl, remaining_time_ms, &output);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    const char* tag = cardano_hydra_get_message_tag(output);
+
+    if (strcmp(tag, expected_tag) == 0)
+    {
+      cardano_json_object_unref(&output);
+
+      return CARDANO_SUCCESS;
+    }
+
+    if (is_failure_of(output, input_tag) || (strcmp(tag, "PostTxOnChainFailed") == 0))
+    {
+      CARDANO_UNUSED(snprintf(provider_impl->error_message, 1024, "The hydra-node failed to run the %s command (%s)", input_tag, tag));
+      cardano_json_object_unref(&output);
+
+      return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+    }
+
+    cardano_json_object_unref(&output);
+
+    remaining_time_ms = get_remaining_time_ms(start_time_sec, timeout_ms);
+  }
+  while (remaining_time_ms > 0U);
+
+  CARDANO_UNUSED(snprintf(provider_impl->error_message, 1024, "Timed out waiting for %s", expected_tag));
+
+  return CARDANO_ERROR_GENERIC;
+}
+
+/**
+ * \brief Records the error message of a head lifecycle helper in the head.
+ *
+ * \param[in] head The head.
+ * \param[in] impl The provider implementation the helper ran with.
+ * \param[in] result The outcome of the helper.
+ *
+ * \return \p result.
+ */
+static cardano_error_t
+keep_last_error(hydra_head_t* head, const cardano_provider_impl_t* impl, const cardano_error_t result)
+{
+  cardano_object_set_last_error(&head->base, (result == CARDANO_SUCCESS) ? NULL : impl->error_message);
+
+  return result;
+}
+
+/**
+ * \brief Retrieves the protocol parameters of the head, which may differ from the ones of layer 1.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[out] parameters On success, the protocol parameters. The caller must release them with \ref cardano_protocol_parameters_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+get_parameters(cardano_provider_impl_t* provider_impl, cardano_protocol_parameters_t** parameters)
+{
+  hydra_head_t*     head            = (hydra_head_t*)provider_impl->context;
+  char*             url             = cardano_hydra_get_endpoint_url(head, "protocol-parameters");
+  cardano_buffer_t* response_buffer = NULL;
+  uint64_t          response_code   = 0U;
+
+  if (url == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_hydra_http_get(provider_impl, url, &response_code, &response_buffer);
+  free(url);
+
+  if ((response_code != 200U) || (result != CARDANO_SUCCESS))
+  {
+    cardano_hydra_parse_error(provider_impl, response_code, response_buffer);
+
+    cardano_buffer_unref(&response_buffer);
+
+    return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+  }
+
+  result = cardano_hydra_parse_protocol_parameters(provider_impl, (char*)cardano_buffer_get_data(response_buffer), cardano_buffer_get_size(response_buffer), parameters);
+
+  cardano_buffer_unref(&response_buffer);
+
+  return result;
+}
+
+/**
+ * \brief Retrieves the outputs locked at an address in the last confirmed snapshot of the head.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] address The address to query. This parameter must not be NULL.
+ * \param[out] utxo_list On success, the UTXOs of the address. The caller must release the list with \ref cardano_utxo_list_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+get_unspent_outputs(
+  cardano_provider_impl_t* provider_impl,
+  cardano_address_t*       address,
+  cardano_utxo_list_t**    utxo_list)
+{
+  hydra_output_filter_t filter = { cardano_address_get_string(address), NULL, NULL };
+
+  if (filter.address == NULL)
+  {
+    return CARDANO_ERROR_INVALID_ADDRESS_FORMAT;
+  }
+
+  return query_snapshot_utxos(provider_impl, output_filter, &filter, utxo_list);
+}
+
+/**
+ * \brief Retrieves the outputs locked at an address and holding an asset in the last confirmed snapshot of the head.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] address The address to query. This parameter must not be NULL.
+ * \param[in] asset_id The asset the outputs must hold. Lovelace matches every output of the address.
+ * \param[out] utxo_list On success, the matching UTXOs. The caller must release the list with \ref cardano_utxo_list_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+get_unspent_outputs_with_asset(
+  cardano_provider_impl_t* provider_impl,
+  cardano_address_t*       address,
+  cardano_asset_id_t*      asset_id,
+  cardano_utxo_list_t**    utxo_list)
+{
+  hydra_output_filter_t filter = { cardano_address_get_string(address), NULL, NULL };
+
+  if (filter.address == NULL)
+  {
+    return CARDANO_ERROR_INVALID_ADDRESS_FORMAT;
+  }
+
+  if (cardano_asset_id_is_lovelace(asset_id))
+  {
+    return query_snapshot_utxos(provider_impl, output_filter, &filter, utxo_list);
+  }
+
+  cardano_blake2b_hash_t* policy_id  = cardano_asset_id_get_policy_id(asset_id);
+  cardano_asset_name_t*   asset_name = cardano_asset_id_get_asset_name(asset_id);
+  char                    policy_hex[57] = { 0 };
+
+  cardano_error_t result = cardano_blake2b_hash_to_hex(policy_id, policy_hex, sizeof(policy_hex));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    filter.policy_id  = policy_hex;
+    filter.asset_name = cardano_asset_name_get_hex(asset_name);
+
+    result = query_snapshot_utxos(provider_impl, output_filter, &filter, utxo_list);
+  }
+
+  cardano_asset_name_unref(&asset_name);
+  cardano_blake2b_hash_unref(&policy_id);
+
+  return result;
+}
+
+/**
+ * \brief Retrieves the output holding an NFT in the last confirmed snapshot of the head.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] asset_id The asset id of the NFT. This parameter must not be NULL.
+ * \param[out] utxo On success, the UTXO holding the NFT. The caller must release it with \ref cardano_utxo_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation. Returns \ref CARDANO_ERROR_ELEMENT_NOT_FOUND
+ *         if no output holds the asset, or \ref CARDANO_ERROR_INVALID_ARGUMENT if several do.
+ */
+static cardano_error_t
+get_unspent_output_by_nft(
+  cardano_provider_impl_t* provider_impl,
+  cardano_asset_id_t*      asset_id,
+  cardano_utxo_t**         utxo)
+{
+  if (cardano_asset_id_is_lovelace(asset_id))
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  cardano_blake2b_hash_t* policy_id      = cardano_asset_id_get_policy_id(asset_id);
+  cardano_asset_name_t*   asset_name     = cardano_asset_id_get_asset_name(asset_id);
+  cardano_utxo_list_t*    utxo_list      = NULL;
+  char                    policy_hex[57] = { 0 };
+
+  cardano_error_t result = cardano_blake2b_hash_to_hex(policy_id, policy_hex, sizeof(policy_hex));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    hydra_output_filter_t filter = { NULL, policy_hex, cardano_asset_name_get_hex(asset_name) };
+
+    result = query_snapshot_utxos(provider_impl, output_filter, &filter, &utxo_list);
+  }
+
+  cardano_asset_name_unref(&asset_name);
+  cardano_blake2b_hash_unref(&policy_id);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const size_t count = cardano_utxo_list_get_length(utxo_list);
+
+  if (count == 0U)
+  {
+    cardano_utxo_list_unref(&utxo_list);
+
+    cardano_utils_set_error_message(provider_impl, "No asset found for the specified asset ID");
+
+    return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  }
+
+  if (count != 1U)
+  {
+    cardano_utxo_list_unref(&utxo_list);
+
+    cardano_utils_set_error_message(provider_impl, "Asset is not an NFT. Multiple assets found for the specified asset ID");
+
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  result = cardano_utxo_list_get(utxo_list, 0U, utxo);
+
+  cardano_utxo_list_unref(&utxo_list);
+
+  return result;
+}
+
+/**
+ * \brief Resolves transaction inputs against the last confirmed snapshot of the head.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] tx_ins The inputs to resolve. This parameter must not be NULL.
+ * \param[out] utxo_list On success, the outputs spent by the inputs that are in the head. The caller must release the
+ *                       list with \ref cardano_utxo_list_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+resolve_unspent_outputs(
+  cardano_provider_impl_t*         provider_impl,
+  cardano_transaction_input_set_t* tx_ins,
+  cardano_utxo_list_t**            utxo_list)
+{
+  hydra_input_filter_t filter = { NULL, cardano_transaction_input_set_get_length(tx_ins) };
+
+  filter.refs = malloc((filter.count > 0U ? filter.count : 1U) * HYDRA_UTXO_REF_SIZE);
+
+  if (filter.refs == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < filter.count); ++i)
+  {
+    cardano_transaction_input_t* input = NULL;
+
+    result = cardano_transaction_input_set_get(tx_ins, i, &input);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      break;
+    }
+
+    cardano_blake2b_hash_t* id = cardano_transaction_input_get_id(input);
+    char                    hash[65] = { 0 };
+
+    result = cardano_blake2b_hash_to_hex(id, hash, sizeof(hash));
+
+    CARDANO_UNUSED(snprintf(filter.refs[i], HYDRA_UTXO_REF_SIZE, "%s#%llu", hash, (unsigned long long)cardano_transaction_input_get_index(input)));
+
+    cardano_blake2b_hash_unref(&id);
+    cardano_transaction_input_unref(&input);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = query_snapshot_utxos(provider_impl, input_filter, &filter, utxo_list);
+  }
+
+  free(filter.refs);
+
+  return result;
+}
+
+/**
+ * \brief Waits for a transaction to be part of a confirmed snapshot of the head.
+ *
+ * Snapshots confirmed on the WebSocket connection are checked first; without an open connection the UTxO set of the
+ * last snapshot is polled for the outputs of the transaction instead.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] tx_id The ID of the transaction to wait for. This parameter must not be NULL.
+ * \param[in] timeout_ms The maximum amount of time, in milliseconds, to wait for the transaction to be confirmed.
+ * \param[out] confirmed Set to \c true if the transaction is confirmed before the timeout, or \c false otherwise.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+await_transaction_confirmation(
+  cardano_provider_impl_t* provider_impl,
+  cardano_blake2b_hash_t*  tx_id,
+  const uint64_t           timeout_ms,
+  bool*                    confirmed)
+{
+  hydra_head_t*     head           = (hydra_head_t*)provider_impl->context;
+  const byte_t*     tx_id_data     = cardano_blake2b_hash_get_data(tx_id);
+  const uint64_t    start_time_sec = cardano_utils_get_time();
+  hydra_tx_filter_t filter         = { { 0 }, false };
+  char              hash[65]       = { 0 };
+
+  *confirmed = false;
+
+  cardano_error_t result = cardano_blake2b_hash_to_hex(tx_id, hash, sizeof(hash));
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  CARDANO_UNUSED(snprintf(filter.prefix, sizeof(filter.prefix), "%s#", hash));
+
+  uint64_t remaining_time_ms = timeout_ms;
+  bool     check_snapshot    = true;
+
+  while (true)
+  {
+    if (cardano_hydra_is_confirmed(head, tx_id_data))
+    {
+      *confirmed = true;
+
+      return CARDANO_SUCCESS;
+    }
+
+    if (check_snapshot)
+    {
+      cardano_utxo_list_t* utxo_list = NULL;
+
+      result = query_snapshot_utxos(provider_impl, tx_filter, &filter, &utxo_list);
+      cardano_utxo_list_unref(&utxo_list);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        return result;
+      }
+
+      if (filter.found)
+      {
+        *confirmed = true;
+
+        return CARDANO_SUCCESS;
+      }
+    }
+
+    if (remaining_time_ms == 0U)
+    {
+      return CARDANO_SUCCESS;
+    }
+
+    if (head->ws != NULL)
+    {
+      cardano_json_object_t* output = NULL;
+
+      check_snapshot = (cardano_hydra_ws_receive(provider_impl, remaining_time_ms, &output) != CARDANO_SUCCESS);
+      cardano_json_object_unref(&output);
+    }
+    else
+    {
+      cardano_utils_sleep((remaining_time_ms > HYDRA_SNAPSHOT_POLL_INTERVAL_MS) ? HYDRA_SNAPSHOT_POLL_INTERVAL_MS : remaining_time_ms);
+      check_snapshot = true;
+    }
+
+    remaining_time_ms = get_remaining_time_ms(start_time_sec, timeout_ms);
+  }
+}
+
+/**
+ * \brief Submits a signed transaction to the head with a `NewTx` command.
+ *
+ * The node applies the transaction to its local state right away and answers with `TxValid` or `TxInvalid`; the
+ * confirmation by the other parties comes later, see \ref await_transaction_confirmation.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] tx The signed transaction to submit. This parameter must not be NULL.
+ * \param[out] tx_id On success, the ID of the submitted transaction. The caller must release it with \ref cardano_blake2b_hash_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation. Returns \ref CARDANO_ERROR_INVALID_HTTP_REQUEST
+ *         if the node rejected the transaction, with the reason available through \ref cardano_provider_get_last_error.
+ */
+static cardano_error_t
+post_transaction_to_chain(
+  cardano_provider_impl_t* provider_impl,
+  cardano_transaction_t*   tx,
+  cardano_blake2b_hash_t** tx_id)
+{
+  cardano_cbor_writer_t* cbor_writer = cardano_cbor_writer_new();
+
+  if (cbor_writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_transaction_to_cbor(tx, cbor_writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_cbor_writer_unref(&cbor_writer);
+
+    return result;
+  }
+
+  const size_t cbor_hex_size = cardano_cbor_writer_get_hex_size(cbor_writer);
+  char*        cbor_hex      = malloc(cbor_hex_size);
+
+  if (cbor_hex == NULL)
+  {
+    cardano_cbor_writer_unref(&cbor_writer);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  result = cardano_cbor_writer_encode_hex(cbor_writer, cbor_hex, cbor_hex_size);
+  cardano_cbor_writer_unref(&cbor_writer);
+
+  cardano_json_writer_t* writer = cardano_json_writer_new(CARDANO_JSON_FORMAT_COMPACT);
+
+  if ((result != CARDANO_SUCCESS) || (writer == NULL))
+  {
+    free(cbor_hex);
+    cardano_json_writer_unref(&writer);
+
+    return (result != CARDANO_SUCCESS) ? result : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_json_writer_write_start_object(writer);
+  cardano_json_writer_write_property_name(writer, "tag", strlen("tag"));
+  cardano_json_writer_write_string(writer, "NewTx", strlen("NewTx"));
+  cardano_json_writer_write_property_name(writer, "transaction", strlen("transaction"));
+  cardano_json_writer_write_start_object(writer);
+  cardano_json_writer_write_property_name(writer, "type", strlen("type"));
+  cardano_json_writer_write_string(writer, "Tx ConwayEra", strlen("Tx ConwayEra"));
+  cardano_json_writer_write_property_name(writer, "description", strlen("description"));
+  cardano_json_writer_write_string(writer, "", 0U);
+  cardano_json_writer_write_property_name(writer, "cborHex", strlen("cborHex"));
+  cardano_json_writer_write_string(writer, cbor_hex, cbor_hex_size - 1U);
+  cardano_json_writer_write_end_object(writer);
+  cardano_json_writer_write_end_object(writer);
+
+  free(cbor_hex);
+
+  const size_t message_size = cardano_json_writer_get_encoded_size(writer);
+  char*        message      = malloc(message_size);
+
+  if (message == NULL)
+  {
+    cardano_json_writer_unref(&writer);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  result = cardano_json_writer_encode(writer, message, message_size);
+  cardano_json_writer_unref(&writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_hydra_ws_send(provider_impl, message, message_size - 1U);
+  }
+
+  free(message);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_blake2b_hash_t* id       = cardano_transaction_get_id(tx);
+  char                    hash[65] = { 0 };
+
+  if (id == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  result = cardano_blake2b_hash_to_hex(id, hash, sizeof(hash));
+
+  const uint64_t start_time_sec    = cardano_utils_get_time();
+  uint64_t       remaining_time_ms = HYDRA_SUBMIT_TIMEOUT_MS;
+
+  while ((result == CARDANO_SUCCESS) && (remaining_time_ms > 0U))
+  {
+    cardano_json_object_t* output = NULL;
+
+    result = cardano_hydra_ws_receive(provider_impl, remaining_time_ms, &output);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      break;
+    }
+
+    const char* tag = cardano_hydra_get_message_tag(output);
+
+    if ((strcmp(tag, "TxValid") == 0) && is_output_for_transaction(output, hash))
+    {
+      cardano_json_object_unref(&output);
+      *tx_id = id;
+
+      return CARDANO_SUCCESS;
+    }
+
+    if ((strcmp(tag, "TxInvalid") == 0) && is_output_for_transaction(output, hash))
+    {
+      const char* reason = get_string_property(get_object_property(output, "validationError"), "reason");
+
+      cardano_utils_set_error_message(provider_impl, (reason != NULL) ? reason : "The hydra-node rejected the transaction");
+      result = CARDANO_ERROR_INVALID_HTTP_REQUEST;
+    }
+    else if (is_failure_of(output, "NewTx"))
+    {
+      cardano_utils_set_error_message(provider_impl, "The hydra-node refused the transaction, the head is not open");
+      result = CARDANO_ERROR_INVALID_HTTP_REQUEST;
+    }
+
+    cardano_json_object_unref(&output);
+
+    remaining_time_ms = get_remaining_time_ms(start_time_sec, HYDRA_SUBMIT_TIMEOUT_MS);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider_impl, "Timed out waiting for the hydra-node to validate the transaction");
+    result = CARDANO_ERROR_GENERIC;
+  }
+
+  cardano_blake2b_hash_unref(&id);
+
+  return result;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+hydra_head_new(
+  const cardano_network_magic_t network,
+  const char*                   api_url,
+  const size_t                  api_url_size,
+  hydra_head_t**                head)
+{
+  if ((api_url == NULL) || (head == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const bool is_https = (api_url_size > 8U) && (strncmp(api_url, "https://", 8) == 0);
+  const bool is_http  = (api_url_size > 7U) && (strncmp(api_url, "http://", 7) == 0);
+
+  if ((!is_https && !is_http) || (api_url_size > 200U))
+  {
+    return CARDANO_ERROR_INVALID_URL;
+  }
+
+  hydra_head_t* data = malloc(sizeof(hydra_head_t));
+
+  if (data == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(data, 0, sizeof(hydra_head_t)));
+
+  data->base.ref_count   = 1;
+  data->base.last_error  = NULL;
+  data->base.deallocator = cardano_hydra_head_deallocate;
+  data->network          = network;
+
+  const bool   has_slash = api_url[api_url_size - 1U] == '/';
+  const size_t host_size = has_slash ? (api_url_size - 1U) : api_url_size;
+  const char*  host      = api_url + (is_https ? 8U : 7U);
+  const int    host_len  = (int)(host_size - (is_https ? 8U : 7U));
+
+  CARDANO_UNUSED(snprintf(data->base_url, sizeof(data->base_url), "%.*s/", (int)host_size, api_url));
+  CARDANO_UNUSED(snprintf(data->ws_url, sizeof(data->ws_url), "%s://%.*s/?history=no&snapshot-utxo=no", is_https ? "wss" : "ws", host_len, host));
+
+  *head = data;
+
+  return CARDANO_SUCCESS;
+}
+
+void
+hydra_head_unref(hydra_head_t** head)
+{
+  if ((head == NULL) || (*head == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*head)->base;
+
+  cardano_object_unref(&object);
+
+  *head = NULL;
+}
+
+const char*
+hydra_head_get_last_error(const hydra_head_t* head)
+{
+  if (head == NULL)
+  {
+    return "";
+  }
+
+  const char* message = cardano_object_get_last_error(&head->base);
+
+  return (message != NULL) ? message : "";
+}
+
+cardano_error_t
+hydra_head_create_provider(hydra_head_t* head, cardano_provider_t** provider)
+{
+  if ((head == NULL) || (provider == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_provider_impl_t impl = { 0 };
+
+  CARDANO_UNUSED(snprintf(impl.name, 256, "hydra-%s", cardano_network_magic_to_string(head->network)));
+
+  impl.get_parameters                 = get_parameters;
+  impl.get_unspent_outputs            = get_unspent_outputs;
+  impl.get_unspent_outputs_with_asset = get_unspent_outputs_with_asset;
+  impl.get_unspent_output_by_nft      = get_unspent_output_by_nft;
+  impl.resolve_unspent_outputs        = resolve_unspent_outputs;
+  impl.await_transaction_confirmation = await_transaction_confirmation;
+  impl.post_transaction_to_chain      = post_transaction_to_chain;
+  impl.network_magic                  = head->network;
+
+  cardano_object_ref(&head->base);
+  impl.context = &head->base;
+
+  return cardano_provider_new(impl, provider);
+}
+
+cardano_error_t
+create_hydra_provider(
+  const cardano_network_magic_t network,
+  const char*                   api_url,
+  const size_t                  api_url_size,
+  cardano_provider_t**          provider)
+{
+  hydra_head_t*   head   = NULL;
+  cardano_error_t result = hydra_head_new(network, api_url, api_url_size, &head);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = hydra_head_create_provider(head, provider);
+
+  hydra_head_unref(&head);
+
+  return result;
+}
+
+cardano_error_t
+hydra_head_draft_commit(hydra_head_t* head, cardano_utxo_list_t* utxos, cardano_transaction_t** commit_tx)
+{
+  if ((head == NULL) || (utxos == NULL) || (commit_tx == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_provider_impl_t impl      = { 0 };
+  char*                   body      = NULL;
+  size_t                  body_size = 0U;
+
+  impl.context = &head->base;
+
+  cardano_error_t result = cardano_hydra_utxo_list_to_json(&impl, utxos, &body, &body_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return keep_last_error(head, &impl, result);
+  }
+
+  char* url = cardano_hydra_get_endpoint_url(head, "commit");
+
+  if (url == NULL)
+  {
+    free(body);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_buffer_t* response_buffer = NULL;
+  uint64_t          response_code   = 0U;
+
+  result = cardano_hydra_http_post(&impl, url, (const byte_t*)body, body_size, &response_code, &response_buffer);
+
+  free(url);
+  free(body);
+
+  if ((response_code != 200U) || (result != CARDANO_SUCCESS))
+  {
+    cardano_hydra_parse_error(&impl, response_code, response_buffer);
+    cardano_buffer_unref(&response_buffer);
+
+    return keep_last_error(head, &impl, CARDANO_ERROR_INVALID_HTTP_REQUEST);
+  }
+
+  cardano_json_object_t* parsed_json = cardano_json_object_parse((char*)cardano_buffer_get_data(response_buffer), cardano_buffer_get_size(response_buffer));
+
+  cardano_buffer_unref(&response_buffer);
+
+  cardano_json_object_t* cbor_hex_obj = NULL;
+
+  if ((parsed_json == NULL) || !cardano_json_object_get_ex(parsed_json, "cborHex", 7, &cbor_hex_obj) || (cardano_json_object_get_type(cbor_hex_obj) != CARDANO_JSON_OBJECT_TYPE_STRING))
+  {
+    cardano_json_object_unref(&parsed_json);
+    cardano_utils_set_error_message(&impl, "Invalid JSON response");
+
+    return keep_last_error(head, &impl, CARDANO_ERROR_INVALID_JSON);
+  }
+
+  size_t                 cbor_hex_size = 0U;
+  const char*            cbor_hex      = cardano_json_object_get_string(cbor_hex_obj, &cbor_hex_size);
+  cardano_cbor_reader_t* reader        = cardano_cbor_reader_from_hex(cbor_hex, cbor_hex_size - 1U);
+
+  cardano_json_object_unref(&parsed_json);
+
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  result = cardano_transaction_from_cbor(reader, commit_tx);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(&impl, cardano_cbor_reader_get_last_error(reader));
+  }
+
+  cardano_cbor_reader_unref(&reader);
+
+  return keep_last_error(head, &impl, result);
+}
+
+cardano_error_t
+hydra_head_close(hydra_head_t* head, const uint64_t timeout_ms)
+{
+  if (head == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_provider_impl_t impl = { 0 };
+
+  impl.context = &head->base;
+
+  return keep_last_error(head, &impl, run_head_command(&impl, "Close", "HeadIsClosed", timeout_ms));
+}
+
+cardano_error_t
+hydra_head_fanout(hydra_head_t* head, const uint64_t timeout_ms)
+{
+  if (head == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_provider_impl_t impl = { 0 };
+
+  impl.context = &head->base;
+
+  return keep_last_error(head, &impl, run_head_command(&impl, "Fanout", "HeadIsFinalized", timeout_ms));
+}
@@ -0,0 +1,171 @@
+/**
+ * \file hydra_provider.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_HYDRA_PROVIDER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_HYDRA_PROVIDER_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/common/network_magic.h>
+#include <cardano/error.h>
+#include <cardano/providers/provider.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief A connection to the API of a hydra-node, shared by the providers created from it and by the head lifecycle
+ * helpers.
+ *
+ * Queries go through the HTTP API of the node and commands through its WebSocket API, over one connection kept open
+ * for the life of the head. A head, and the providers created from it, must not be used from several threads at once.
+ */
+typedef struct hydra_head_t hydra_head_t;
+
+/**
+ * \brief Connects to the API of a hydra-node.
+ *
+ * No request is made until the head or one of its providers is first used.
+ *
+ * \param[in] network      The layer 1 network the head was opened on.
+ * \param[in] api_url      The URL of the API of the node, e.g. "http://127.0.0.1:4001". "https" URLs use "wss" for
+ *                         the WebSocket API.
+ * \param[in] api_url_size The size of the URL in bytes, excluding the null terminator.
+ * \param[out] head        On success, the new head. The caller must release it with \ref hydra_head_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_URL if the URL is not an "http" or "https" URL
+ *         or is too long, or another error code on failure.
+ */
+cardano_error_t
+hydra_head_new(
+  cardano_network_magic_t network,
+  const char*             api_url,
+  size_t                  api_url_size,
+  hydra_head_t**          head);
+
+/**
+ * \brief Releases a reference to a head. The connection is closed once the head and its providers are all released.
+ *
+ * \param[in,out] head The head to release; set to `NULL`.
+ */
+void
+hydra_head_unref(hydra_head_t** head);
+
+/**
+ * \brief Gets the error message of the last head lifecycle helper that failed.
+ *
+ * \param[in] head The head.
+ *
+ * \return The message, owned by the head, or an empty string.
+ */
+const char*
+hydra_head_get_last_error(const hydra_head_t* head);
+
+/**
+ * \brief Creates a \ref cardano_provider_t reading and writing the state of an open head.
+ *
+ * The provider answers the UTxO queries from the confirmed snapshot of the head, so wallets, coin selection and the
+ * transaction builder work on layer 2 as they do on layer 1. Protocol parameters are those the head was opened with.
+ * Transactions are submitted with a `NewTx` command and are accepted once the node reports them valid; they are
+ * confirmed once a snapshot including them is, usually within milliseconds. Rewards, datum resolution and script
+ * evaluation have no layer 2 equivalent and report \ref CARDANO_ERROR_NOT_IMPLEMENTED.
+ *
+ * \param[in] head      The head. The provider keeps a reference to it.
+ * \param[out] provider On success, the new provider. The caller must release it with \ref cardano_provider_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+cardano_error_t
+hydra_head_create_provider(hydra_head_t* head, cardano_provider_t** provider);
+
+/**
+ * \brief Creates a \ref cardano_provider_t for the head served by a hydra-node, without keeping the head.
+ *
+ * Equivalent to \ref hydra_head_new followed by \ref hydra_head_create_provider, for callers with no use for the head
+ * lifecycle helpers.
+ *
+ * \param[in] network      The layer 1 network the head was opened on.
+ * \param[in] api_url      The URL of the API of the node.
+ * \param[in] api_url_size The size of the URL in bytes, excluding the null terminator.
+ * \param[out] provider    On success, the new provider. The caller must release it with \ref cardano_provider_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+cardano_error_t
+create_hydra_provider(
+  cardano_network_magic_t network,
+  const char*             api_url,
+  size_t                  api_url_size,
+  cardano_provider_t**    provider);
+
+/**
+ * \brief Asks the node for the layer 1 transaction committing a set of UTxOs into the head while it is initializing.
+ *
+ * The draft spends \p utxos and must be signed with their keys and submitted on layer 1 through a layer 1 provider;
+ * the UTxOs become spendable in the head once every participant has committed. Outputs with a reference script are
+ * not supported.
+ *
+ * \param[in] head       The head.
+ * \param[in] utxos      The layer 1 UTxOs to commit. May be empty to commit nothing.
+ * \param[out] commit_tx On success, the unsigned commit transaction. The caller must release it with
+ *                       \ref cardano_transaction_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_HTTP_REQUEST if the node refused the commit,
+ *         with its reason available through \ref hydra_head_get_last_error, or another error code on failure.
+ */
+cardano_error_t
+hydra_head_draft_commit(hydra_head_t* head, cardano_utxo_list_t* utxos, cardano_transaction_t** commit_tx);
+
+/**
+ * \brief Closes the head with its latest confirmed snapshot and waits for the close to be observed on layer 1.
+ *
+ * Once closed, the contestation period of the head must elapse before \ref hydra_head_fanout can succeed.
+ *
+ * \param[in] head       The head.
+ * \param[in] timeout_ms The maximum time to wait for the close, in milliseconds.
+ *
+ * \return \ref CARDANO_SUCCESS once the head is closed, \ref CARDANO_ERROR_INVALID_HTTP_REQUEST if the node refused
+ *         the command, \ref CARDANO_ERROR_GENERIC if the close was not observed in time, or another error code.
+ */
+cardano_error_t
+hydra_head_close(hydra_head_t* head, uint64_t timeout_ms);
+
+/**
+ * \brief Distributes the final UTxO set of a closed head on layer 1 and waits for the head to be finalized.
+ *
+ * \param[in] head       The head.
+ * \param[in] timeout_ms The maximum time to wait for the fanout, in milliseconds.
+ *
+ * \return \ref CARDANO_SUCCESS once the head is finalized, \ref CARDANO_ERROR_INVALID_HTTP_REQUEST if the node
+ *         refused the command, such as before the contestation period elapsed, \ref CARDANO_ERROR_GENERIC if the
+ *         fanout was not observed in time, or another error code.
+ */
+cardano_error_t
+hydra_head_fanout(hydra_head_t* head, uint64_t timeout_ms);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_HYDRA_PROVIDER_H
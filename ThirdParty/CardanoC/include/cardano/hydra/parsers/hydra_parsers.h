@@ -0,0 +1,117 @@
+/**
+ * \file hydra_parsers.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_HYDRA_PARSERS_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_HYDRA_PARSERS_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/json/json_object.h>
+#include <cardano/providers/provider_impl.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Selects the entries of a UTxO set to decode.
+ *
+ * \param[in] ref      The key of the entry, "<tx id>#<index>".
+ * \param[in] ref_size The size of the key, excluding the null terminator.
+ * \param[in] output   The JSON of the output of the entry.
+ * \param[in] context  The context given along with the filter.
+ *
+ * \return `true` to decode the entry into the result.
+ */
+typedef bool (*cardano_hydra_utxo_filter_t)(const char* ref, size_t ref_size, cardano_json_object_t* output, void* context);
+
+/**
+ * \brief Parses the protocol parameters of a head, as returned by the `protocol-parameters` endpoint.
+ *
+ * The response uses the JSON layout of the ledger, the one of `cardano-cli query protocol-parameters`.
+ *
+ * \param[in] provider     The provider implementation used for error reporting.
+ * \param[in] json         The raw JSON response.
+ * \param[in] size         The size of the JSON string.
+ * \param[out] parameters  On success, the parsed protocol parameters. The caller must release them with
+ *                         \ref cardano_protocol_parameters_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+cardano_error_t
+cardano_hydra_parse_protocol_parameters(
+  cardano_provider_impl_t*        provider,
+  const char*                     json,
+  size_t                          size,
+  cardano_protocol_parameters_t** parameters);
+
+/**
+ * \brief Parses a UTxO set in the JSON layout of `cardano-api`, such as the response of the `snapshot/utxo` endpoint.
+ *
+ * The set is an object keyed by "<tx id>#<index>"; only the entries \p filter selects are decoded.
+ *
+ * \param[in] provider       The provider implementation used for error reporting.
+ * \param[in] json           The raw JSON response.
+ * \param[in] size           The size of the JSON string.
+ * \param[in] filter         The filter selecting the entries to decode, or `NULL` to decode them all.
+ * \param[in] filter_context The context given to \p filter.
+ * \param[out] utxo_list     On success, the selected UTxOs. The caller must release the list with
+ *                           \ref cardano_utxo_list_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+cardano_error_t
+cardano_hydra_parse_utxo_set(
+  cardano_provider_impl_t*    provider,
+  const char*                 json,
+  size_t                      size,
+  cardano_hydra_utxo_filter_t filter,
+  void*                       filter_context,
+  cardano_utxo_list_t**       utxo_list);
+
+/**
+ * \brief Serializes UTxOs into a UTxO set in the JSON layout of `cardano-api`, as accepted by the `commit` endpoint.
+ *
+ * \param[in] provider   The provider implementation used for error reporting.
+ * \param[in] utxos      The UTxOs. Outputs with a reference script are not supported.
+ * \param[out] json      On success, the null-terminated JSON. The caller must release it with `free`.
+ * \param[out] json_size On success, the size of the JSON, excluding the null terminator.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_NOT_IMPLEMENTED if an output has a reference script,
+ *         or another error code on failure.
+ */
+cardano_error_t
+cardano_hydra_utxo_list_to_json(
+  cardano_provider_impl_t* provider,
+  cardano_utxo_list_t*     utxos,
+  char**                   json,
+  size_t*                  json_size);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_HYDRA_PARSERS_H
@@ -0,0 +1,591 @@
+/**
+ * \file hydra_pparam_parser.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "hydra_parsers.h"
+#include "../../utils.h"
+
+#include <cardano/json/json_object.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* CALLBACKS PROTOTYPES ******************************************************/
+
+/**
+ * \brief Function pointer type for handling the protocol parameters of one JSON property.
+ *
+ * \param[in] parameters   The protocol parameters being built.
+ * \param[in] json_obj     The JSON value of the property.
+ * \param[in] setter_func  The setter of the parameter, for the handlers shared by several parameters.
+ *
+ * \return CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+typedef cardano_error_t (*parameter_handler_t)(
+  cardano_protocol_parameters_t* parameters,
+  cardano_json_object_t*         json_obj,
+  void*                          setter_func);
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Maps a JSON property of the ledger layout to its handler and setter.
+ *
+ * \var key
+ * The JSON property.
+ *
+ * \var handler
+ * The function reading the value of the property.
+ *
+ * \var setter_func
+ * The setter the handler stores the value with, or `NULL` for the handlers of nested objects.
+ */
+typedef struct
+{
+    const char*         key;
+    parameter_handler_t handler;
+    void*               setter_func;
+} parameter_map_entry_t;
+
+/**
+ * \brief Maps a JSON property of a voting thresholds object to the setter of the threshold.
+ *
+ * \var key
+ * The JSON property.
+ *
+ * \var setter_func
+ * The setter of the threshold in \ref cardano_pool_voting_thresholds_t or \ref cardano_drep_voting_thresholds_t.
+ */
+typedef struct
+{
+    const char* key;
+    void*       setter_func;
+} threshold_map_entry_t;
+
+/* STATIC VARIABLES **********************************************************/
+
+/**
+ * \brief The properties of `poolVotingThresholds`.
+ */
+static const threshold_map_entry_t pool_threshold_map[] = {
+  { "motionNoConfidence", (void*)cardano_pool_voting_thresholds_set_motion_no_confidence },
+  { "committeeNormal", (void*)cardano_pool_voting_thresholds_set_committee_normal },
+  { "committeeNoConfidence", (void*)cardano_pool_voting_thresholds_set_committee_no_confidence },
+  { "hardForkInitiation", (void*)cardano_pool_voting_thresholds_set_hard_fork_initiation },
+  { "ppSecurityGroup", (void*)cardano_pool_voting_thresholds_set_security_relevant_param },
+  { NULL, NULL }
+};
+
+/**
+ * \brief The properties of `dRepVotingThresholds`.
+ */
+static const threshold_map_entry_t drep_threshold_map[] = {
+  { "motionNoConfidence", (void*)cardano_drep_voting_thresholds_set_motion_no_confidence },
+  { "committeeNormal", (void*)cardano_drep_voting_thresholds_set_committee_normal },
+  { "committeeNoConfidence", (void*)cardano_drep_voting_thresholds_set_committee_no_confidence },
+  { "updateToConstitution", (void*)cardano_drep_voting_thresholds_set_update_constitution },
+  { "hardForkInitiation", (void*)cardano_drep_voting_thresholds_set_hard_fork_initiation },
+  { "ppNetworkGroup", (void*)cardano_drep_voting_thresholds_set_pp_network_group },
+  { "ppEconomicGroup", (void*)cardano_drep_voting_thresholds_set_pp_economic_group },
+  { "ppTechnicalGroup", (void*)cardano_drep_voting_thresholds_set_pp_technical_group },
+  { "ppGovGroup", (void*)cardano_drep_voting_thresholds_set_pp_governance_group },
+  { "treasuryWithdrawal", (void*)cardano_drep_voting_thresholds_set_treasury_withdrawal },
+  { NULL, NULL }
+};
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Reads a unit interval encoded as a JSON number.
+ *
+ * \param[in] json_obj The JSON value.
+ * \param[out] interval On success, the interval. The caller must release it with \ref cardano_unit_interval_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+parse_unit_interval(cardano_json_object_t* json_obj, cardano_unit_interval_t** interval)
+{
+  double          value  = 0.0;
+  cardano_error_t result = cardano_json_object_get_double(json_obj, &value);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return cardano_unit_interval_from_double(value, interval);
+}
+
+/**
+ * \brief Reads an unsigned integer parameter.
+ *
+ * \param[in] parameters The protocol parameters being built.
+ * \param[in] json_obj The JSON value.
+ * \param[in] setter_func The setter of the parameter.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+handle_uint64(
+  cardano_protocol_parameters_t* parameters,
+  cardano_json_object_t*         json_obj,
+  cardano_error_t (*setter_func)(cardano_protocol_parameters_t*, uint64_t))
+{
+  uint64_t        value  = 0U;
+  cardano_error_t result = cardano_json_object_get_uint(json_obj, &value);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return setter_func(parameters, value);
+}
+
+/**
+ * \brief Reads a unit interval parameter.
+ *
+ * \param[in] parameters The protocol parameters being built.
+ * \param[in] json_obj The JSON value.
+ * \param[in] setter_func The setter of the parameter.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+handle_unit_interval(
+  cardano_protocol_parameters_t* parameters,
+  cardano_json_object_t*         json_obj,
+  cardano_error_t (*setter_func)(cardano_protocol_parameters_t*, cardano_unit_interval_t*))
+{
+  cardano_unit_interval_t* interval = NULL;
+  cardano_error_t          result   = parse_unit_interval(json_obj, &interval);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = setter_func(parameters, interval);
+  }
+
+  cardano_unit_interval_unref(&interval);
+
+  return result;
+}
+
+/**
+ * \brief Reads `protocolVersion`, `{"major": n, "minor": n}`.
+ *
+ * \param[in] parameters The protocol parameters being built.
+ * \param[in] json_obj The JSON value.
+ * \param[in] setter_func Unused.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+handle_version(cardano_protocol_parameters_t* parameters, cardano_json_object_t* json_obj, void* setter_func)
+{
+  CARDANO_UNUSED(setter_func);
+
+  cardano_json_object_t* major_obj = NULL;
+  cardano_json_object_t* minor_obj = NULL;
+  uint64_t               major     = 0U;
+  uint64_t               minor     = 0U;
+
+  if (!cardano_json_object_get_ex(json_obj, "major", 5, &major_obj) || !cardano_json_object_get_ex(json_obj, "minor", 5, &minor_obj)
+    || (cardano_json_object_get_uint(major_obj, &major) != CARDANO_SUCCESS) || (cardano_json_object_get_uint(minor_obj, &minor) != CARDANO_SUCCESS))
+  {
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_protocol_version_t* version = NULL;
+  cardano_error_t             result  = cardano_protocol_version_new(major, minor, &version);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_protocol_parameters_set_protocol_version(parameters, version);
+  }
+
+  cardano_protocol_version_unref(&version);
+
+  return result;
+}
+
+/**
+ * \brief Reads `executionUnitPrices`, `{"priceMemory": x, "priceSteps": x}`.
+ *
+ * \param[in] parameters The protocol parameters being built.
+ * \param[in] json_obj The JSON value.
+ * \param[in] setter_func Unused.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+handle_prices(cardano_protocol_parameters_t* parameters, cardano_json_object_t* json_obj, void* setter_func)
+{
+  CARDANO_UNUSED(setter_func);
+
+  cardano_json_object_t*   memory_obj = NULL;
+  cardano_json_object_t*   steps_obj  = NULL;
+  cardano_unit_interval_t* memory     = NULL;
+  cardano_unit_interval_t* steps      = NULL;
+  cardano_ex_unit_prices_t* prices    = NULL;
+
+  if (!cardano_json_object_get_ex(json_obj, "priceMemory", 11, &memory_obj) || !cardano_json_object_get_ex(json_obj, "priceSteps", 10, &steps_obj))
+  {
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_error_t result = parse_unit_interval(memory_obj, &memory);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = parse_unit_interval(steps_obj, &steps);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_ex_unit_prices_new(memory, steps, &prices);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_protocol_parameters_set_execution_costs(parameters, prices);
+  }
+
+  cardano_ex_unit_prices_unref(&prices);
+  cardano_unit_interval_unref(&steps);
+  cardano_unit_interval_unref(&memory);
+
+  return result;
+}
+
+/**
+ * \brief Reads an execution units object, `{"memory": n, "steps": n}`.
+ *
+ * \param[in] parameters The protocol parameters being built.
+ * \param[in] json_obj The JSON value.
+ * \param[in] setter_func The setter of the execution units.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+handle_ex_units(
+  cardano_protocol_parameters_t* parameters,
+  cardano_json_object_t*         json_obj,
+  cardano_error_t (*setter_func)(cardano_protocol_parameters_t*, cardano_ex_units_t*))
+{
+  cardano_json_object_t* memory_obj = NULL;
+  cardano_json_object_t* steps_obj  = NULL;
+  uint64_t               memory     = 0U;
+  uint64_t               steps      = 0U;
+
+  if (!cardano_json_object_get_ex(json_obj, "memory", 6, &memory_obj) || !cardano_json_object_get_ex(json_obj, "steps", 5, &steps_obj)
+    || (cardano_json_object_get_uint(memory_obj, &memory) != CARDANO_SUCCESS) || (cardano_json_object_get_uint(steps_obj, &steps) != CARDANO_SUCCESS))
+  {
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_ex_units_t* units  = NULL;
+  cardano_error_t     result = cardano_ex_units_new(memory, steps, &units);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = setter_func(parameters, units);
+  }
+
+  cardano_ex_units_unref(&units);
+
+  return result;
+}
+
+/**
+ * \brief Reads `costModels`, `{"PlutusV1": [n, ...], ...}`.
+ *
+ * \param[in] parameters The protocol parameters being built.
+ * \param[in] json_obj The JSON value.
+ * \param[in] setter_func Unused.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+handle_cost_models(cardano_protocol_parameters_t* parameters, cardano_json_object_t* json_obj, void* setter_func)
+{
+  CARDANO_UNUSED(setter_func);
+
+  static const struct
+  {
+      const char*                       key;
+      cardano_plutus_language_version_t version;
+  } languages[] = {
+    { "PlutusV1", CARDANO_PLUTUS_LANGUAGE_VERSION_V1 },
+    { "PlutusV2", CARDANO_PLUTUS_LANGUAGE_VERSION_V2 },
+    { "PlutusV3", CARDANO_PLUTUS_LANGUAGE_VERSION_V3 },
+  };
+
+  cardano_costmdls_t* cost_models = NULL;
+  cardano_error_t     result      = cardano_costmdls_new(&cost_models);
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < (sizeof(languages) / sizeof(languages[0]))); ++i)
+  {
+    cardano_json_object_t* costs = NULL;
+
+    if (!cardano_json_object_get_ex(json_obj, languages[i].key, strlen(languages[i].key), &costs) || (cardano_json_object_get_type(costs) != CARDANO_JSON_OBJECT_TYPE_ARRAY))
+    {
+      continue;
+    }
+
+    const size_t count      = cardano_json_object_array_get_length(costs);
+    int64_t*     cost_array = malloc((count > 0U ? count : 1U) * sizeof(int64_t));
+
+    if (cost_array == NULL)
+    {
+      result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+
+      break;
+    }
+
+    for (size_t j = 0U; (result == CARDANO_SUCCESS) && (j < count); ++j)
+    {
+      result = cardano_json_object_get_signed_int(cardano_json_object_array_get_ex(costs, j), &cost_array[j]);
+    }
+
+    cardano_cost_model_t* cost_model = NULL;
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cost_model_new(languages[i].version, cost_array, count, &cost_model);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_costmdls_insert(cost_models, cost_model);
+    }
+
+    cardano_cost_model_unref(&cost_model);
+    free(cost_array);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_protocol_parameters_set_cost_models(parameters, cost_models);
+  }
+
+  cardano_costmdls_unref(&cost_models);
+
+  return result;
+}
+
+/**
+ * \brief Reads the thresholds of a voting thresholds object into the thresholds held by the parameters.
+ *
+ * \param[in] json_obj The JSON value.
+ * \param[in] map The properties of the object and the setters of their thresholds.
+ * \param[in] thresholds The thresholds, a \ref cardano_pool_voting_thresholds_t or \ref cardano_drep_voting_thresholds_t.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+read_thresholds(cardano_json_object_t* json_obj, const threshold_map_entry_t* map, void* thresholds)
+{
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  for (const threshold_map_entry_t* entry = map; (result == CARDANO_SUCCESS) && (entry->key != NULL); ++entry)
+  {
+    cardano_json_object_t*   value    = NULL;
+    cardano_unit_interval_t* interval = NULL;
+
+    if (!cardano_json_object_get_ex(json_obj, entry->key, strlen(entry->key), &value))
+    {
+      continue;
+    }
+
+    result = parse_unit_interval(value, &interval);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = ((cardano_error_t(*)(void*, cardano_unit_interval_t*))entry->setter_func)(thresholds, interval);
+    }
+
+    cardano_unit_interval_unref(&interval);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Reads `poolVotingThresholds`.
+ *
+ * \param[in] parameters The protocol parameters being built.
+ * \param[in] json_obj The JSON value.
+ * \param[in] setter_func Unused.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+handle_pool_thresholds(cardano_protocol_parameters_t* parameters, cardano_json_object_t* json_obj, void* setter_func)
+{
+  CARDANO_UNUSED(setter_func);
+
+  cardano_pool_voting_thresholds_t* thresholds = cardano_protocol_parameters_get_pool_voting_thresholds(parameters);
+
+  if (thresholds == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = read_thresholds(json_obj, pool_threshold_map, thresholds);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_protocol_parameters_set_pool_voting_thresholds(parameters, thresholds);
+  }
+
+  cardano_pool_voting_thresholds_unref(&thresholds);
+
+  return result;
+}
+
+/**
+ * \brief Reads `dRepVotingThresholds`.
+ *
+ * \param[in] parameters The protocol parameters being built.
+ * \param[in] json_obj The JSON value.
+ * \param[in] setter_func Unused.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+handle_drep_thresholds(cardano_protocol_parameters_t* parameters, cardano_json_object_t* json_obj, void* setter_func)
+{
+  CARDANO_UNUSED(setter_func);
+
+  cardano_drep_voting_thresholds_t* thresholds = cardano_protocol_parameters_get_drep_voting_thresholds(parameters);
+
+  if (thresholds == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = read_thresholds(json_obj, drep_threshold_map, thresholds);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_protocol_parameters_set_drep_voting_thresholds(parameters, thresholds);
+  }
+
+  cardano_drep_voting_thresholds_unref(&thresholds);
+
+  return result;
+}
+
+/* STATIC VARIABLES **********************************************************/
+
+/**
+ * \brief Mapping between the JSON properties of the ledger layout and the protocol parameters.
+ */
+static const parameter_map_entry_t parameter_map[] = {
+  { "txFeePerByte", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_min_fee_a },
+  { "txFeeFixed", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_min_fee_b },
+  { "maxBlockBodySize", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_max_block_body_size },
+  { "maxTxSize", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_max_tx_size },
+  { "maxBlockHeaderSize", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_max_block_header_size },
+  { "stakeAddressDeposit", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_key_deposit },
+  { "stakePoolDeposit", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_pool_deposit },
+  { "poolRetireMaxEpoch", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_max_epoch },
+  { "stakePoolTargetNum", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_n_opt },
+  { "poolPledgeInfluence", (parameter_handler_t)handle_unit_interval, (void*)cardano_protocol_parameters_set_pool_pledge_influence },
+  { "monetaryExpansion", (parameter_handler_t)handle_unit_interval, (void*)cardano_protocol_parameters_set_expansion_rate },
+  { "treasuryCut", (parameter_handler_t)handle_unit_interval, (void*)cardano_protocol_parameters_set_treasury_growth_rate },
+  { "protocolVersion", handle_version, NULL },
+  { "minPoolCost", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_min_pool_cost },
+  { "utxoCostPerByte", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_ada_per_utxo_byte },
+  { "costModels", handle_cost_models, NULL },
+  { "executionUnitPrices", handle_prices, NULL },
+  { "maxTxExecutionUnits", (parameter_handler_t)handle_ex_units, (void*)cardano_protocol_parameters_set_max_tx_ex_units },
+  { "maxBlockExecutionUnits", (parameter_handler_t)handle_ex_units, (void*)cardano_protocol_parameters_set_max_block_ex_units },
+  { "maxValueSize", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_max_value_size },
+  { "collateralPercentage", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_collateral_percentage },
+  { "maxCollateralInputs", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_max_collateral_inputs },
+  { "poolVotingThresholds", handle_pool_thresholds, NULL },
+  { "dRepVotingThresholds", handle_drep_thresholds, NULL },
+  { "committeeMinSize", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_min_committee_size },
+  { "committeeMaxTermLength", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_committee_term_limit },
+  { "govActionLifetime", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_governance_action_validity_period },
+  { "govActionDeposit", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_governance_action_deposit },
+  { "dRepDeposit", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_drep_deposit },
+  { "dRepActivity", (parameter_handler_t)handle_uint64, (void*)cardano_protocol_parameters_set_drep_inactivity_period },
+  { "minFeeRefScriptCostPerByte", (parameter_handler_t)handle_unit_interval, (void*)cardano_protocol_parameters_set_ref_script_cost_per_byte },
+  { NULL, NULL, NULL }
+};
+
+/* IMPLEMENTATION *************************************************************/
+
+cardano_error_t
+cardano_hydra_parse_protocol_parameters(
+  cardano_provider_impl_t*        provider,
+  const char*                     json,
+  const size_t                    size,
+  cardano_protocol_parameters_t** parameters)
+{
+  cardano_json_object_t* parsed_json = cardano_json_object_parse(json, size);
+
+  if ((parsed_json == NULL) || (cardano_json_object_get_type(parsed_json) != CARDANO_JSON_OBJECT_TYPE_OBJECT))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+    cardano_json_object_unref(&parsed_json);
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_error_t result = cardano_protocol_parameters_new(parameters);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_json_object_unref(&parsed_json);
+
+    return result;
+  }
+
+  for (const parameter_map_entry_t* entry = parameter_map; entry->key != NULL; ++entry)
+  {
+    cardano_json_object_t* json_obj = NULL;
+
+    if (!cardano_json_object_get_ex(parsed_json, entry->key, strlen(entry->key), &json_obj) || (cardano_json_object_get_type(json_obj) == CARDANO_JSON_OBJECT_TYPE_NULL))
+    {
+      continue;
+    }
+
+    result = entry->handler(*parameters, json_obj, entry->setter_func);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      CARDANO_UNUSED(snprintf(provider->error_message, 1024, "Failed to parse protocol parameter %s from JSON response", entry->key));
+      cardano_json_object_unref(&parsed_json);
+      cardano_protocol_parameters_unref(parameters);
+
+      return result;
+    }
+  }
+
+  cardano_json_object_unref(&parsed_json);
+
+  return CARDANO_SUCCESS;
+}
@@ -0,0 +1,818 @@
+/**
+ * \file hydra_utxos_parser.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/address/address_cache.h>
+#include <cardano/json/json_object.h>
+#include <cardano/json/json_writer.h>
+
+#include "hydra_parsers.h"
+#include "../../utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Gets a string property of a JSON object.
+ *
+ * \param[in] object The JSON object.
+ * \param[in] key The property name.
+ * \param[out] size The length of the string, excluding the null terminator.
+ *
+ * \return The string, or `NULL` if the property is missing, null or not a string.
+ */
+static const char*
+get_string_property(cardano_json_object_t* object, const char* key, size_t* size)
+{
+  cardano_json_object_t* value = NULL;
+
+  *size = 0U;
+
+  if (!cardano_json_object_get_ex(object, key, strlen(key), &value) || (cardano_json_object_get_type(value) != CARDANO_JSON_OBJECT_TYPE_STRING))
+  {
+    return NULL;
+  }
+
+  size_t      length = 0U;
+  const char* string = cardano_json_object_get_string(value, &length);
+
+  if ((string == NULL) || (length == 0U))
+  {
+    return NULL;
+  }
+
+  *size = length - 1U;
+
+  return string;
+}
+
+/**
+ * \brief Builds the value of an output out of its `value` object, `{"lovelace": n, "<policy>": {"<name>": n}}`.
+ *
+ * \param[in] provider The provider implementation used for error reporting.
+ * \param[in] output The JSON of the output.
+ * \param[out] value On success, the value of the output.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+parse_value(cardano_provider_impl_t* provider, cardano_json_object_t* output, cardano_value_t** value)
+{
+  cardano_json_object_t* value_obj = NULL;
+
+  if (!cardano_json_object_get_ex(output, "value", 5, &value_obj) || (cardano_json_object_get_type(value_obj) != CARDANO_JSON_OBJECT_TYPE_OBJECT))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse value from JSON response");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  *value = cardano_value_new_zero();
+
+  if (*value == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  const size_t    policy_count = cardano_json_object_get_property_count(value_obj);
+  cardano_error_t result       = CARDANO_SUCCESS;
+
+  for (size_t i = 0U; (i < policy_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    size_t                 key_size = 0U;
+    const char*            key      = cardano_json_object_get_key_at(value_obj, i, &key_size);
+    cardano_json_object_t* entry    = cardano_json_object_get_value_at_ex(value_obj, i);
+
+    if ((key != NULL) && (strcmp(key, "lovelace") == 0))
+    {
+      uint64_t lovelace = 0U;
+
+      result = cardano_json_object_get_uint(entry, &lovelace);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_value_set_coin(*value, (int64_t)lovelace);
+      }
+
+      continue;
+    }
+
+    if ((key == NULL) || (cardano_json_object_get_type(entry) != CARDANO_JSON_OBJECT_TYPE_OBJECT))
+    {
+      result = CARDANO_ERROR_INVALID_JSON;
+
+      continue;
+    }
+
+    const size_t asset_count = cardano_json_object_get_property_count(entry);
+
+    for (size_t j = 0U; (j < asset_count) && (result == CARDANO_SUCCESS); ++j)
+    {
+      size_t      asset_name_size = 0U;
+      const char* asset_name      = cardano_json_object_get_key_at(entry, j, &asset_name_size);
+      uint64_t    quantity        = 0U;
+
+      result = cardano_json_object_get_uint(cardano_json_object_get_value_at_ex(entry, j), &quantity);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_value_add_asset_ex(*value, key, key_size, (asset_name != NULL) ? asset_name : "", asset_name_size, (int64_t)quantity);
+      }
+    }
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse value from JSON response");
+    cardano_value_unref(value);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Builds the datum of an output, preferring its inline datum over its datum hash.
+ *
+ * Inline datums are read from `inlineDatumRaw`, the CBOR the datum hash was computed over; the `inlineDatum` JSON
+ * rendering does not preserve it.
+ *
+ * \param[in] provider The provider implementation used for error reporting.
+ * \param[in] output The JSON of the output.
+ * \param[out] datum On success, the datum of the output, or `NULL` if it has none.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+parse_datum(cardano_provider_impl_t* provider, cardano_json_object_t* output, cardano_datum_t** datum)
+{
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  *datum = NULL;
+
+  size_t      raw_size = 0U;
+  const char* raw      = get_string_property(output, "inlineDatumRaw", &raw_size);
+
+  if (raw != NULL)
+  {
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(raw, raw_size);
+
+    if (reader == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    cardano_plutus_data_t* plutus_data = NULL;
+    result                             = cardano_plutus_data_from_cbor(reader, &plutus_data);
+    cardano_cbor_reader_unref(&reader);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_utils_set_error_message(provider, "Failed to decode inlineDatumRaw from JSON response");
+
+      return result;
+    }
+
+    result = cardano_datum_new_inline_data(plutus_data, datum);
+    cardano_plutus_data_unref(&plutus_data);
+
+    return result;
+  }
+
+  cardano_json_object_t* inline_datum = NULL;
+
+  if (cardano_json_object_get_ex(output, "inlineDatum", 11, &inline_datum) && (cardano_json_object_get_type(inline_datum) != CARDANO_JSON_OBJECT_TYPE_NULL))
+  {
+    cardano_utils_set_error_message(provider, "Output has an inline datum without inlineDatumRaw; the hydra-node is too old");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  size_t      data_hash_size = 0U;
+  const char* data_hash      = get_string_property(output, "datumhash", &data_hash_size);
+
+  if (data_hash == NULL)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_blake2b_hash_t* hash = NULL;
+  result                       = cardano_blake2b_hash_from_hex(data_hash, data_hash_size, &hash);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse datumhash from JSON response");
+
+    return result;
+  }
+
+  result = cardano_datum_new_data_hash(hash, datum);
+  cardano_blake2b_hash_unref(&hash);
+
+  return result;
+}
+
+/**
+ * \brief Builds the reference script of an output out of its `referenceScript` text envelope.
+ *
+ * \param[in] provider The provider implementation used for error reporting.
+ * \param[in] output The JSON of the output.
+ * \param[out] script On success, the reference script of the output, or `NULL` if it has none.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+parse_reference_script(cardano_provider_impl_t* provider, cardano_json_object_t* output, cardano_script_t** script)
+{
+  cardano_json_object_t* reference_script = NULL;
+  cardano_json_object_t* envelope         = NULL;
+
+  *script = NULL;
+
+  if (!cardano_json_object_get_ex(output, "referenceScript", 15, &reference_script) || (cardano_json_object_get_type(reference_script) != CARDANO_JSON_OBJECT_TYPE_OBJECT))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  size_t      type_size     = 0U;
+  size_t      cbor_hex_size = 0U;
+  const char* type          = NULL;
+  const char* cbor_hex      = NULL;
+
+  if (cardano_json_object_get_ex(reference_script, "script", 6, &envelope))
+  {
+    type     = get_string_property(envelope, "type", &type_size);
+    cbor_hex = get_string_property(envelope, "cborHex", &cbor_hex_size);
+  }
+
+  if ((type == NULL) || (cbor_hex == NULL))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse referenceScript from JSON response");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(cbor_hex, cbor_hex_size);
+
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  // The text envelope holds the script bytes wrapped in a CBOR byte string, or the CBOR of a native script
+  if (strcmp(type, "PlutusScriptV1") == 0)
+  {
+    cardano_plutus_v1_script_t* plutus_script = NULL;
+    result                                    = cardano_plutus_v1_script_from_cbor(reader, &plutus_script);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_script_new_plutus_v1(plutus_script, script);
+    }
+
+    cardano_plutus_v1_script_unref(&plutus_script);
+  }
+  else if (strcmp(type, "PlutusScriptV2") == 0)
+  {
+    cardano_plutus_v2_script_t* plutus_script = NULL;
+    result                                    = cardano_plutus_v2_script_from_cbor(reader, &plutus_script);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_script_new_plutus_v2(plutus_script, script);
+    }
+
+    cardano_plutus_v2_script_unref(&plutus_script);
+  }
+  else if (strcmp(type, "PlutusScriptV3") == 0)
+  {
+    cardano_plutus_v3_script_t* plutus_script = NULL;
+    result                                    = cardano_plutus_v3_script_from_cbor(reader, &plutus_script);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_script_new_plutus_v3(plutus_script, script);
+    }
+
+    cardano_plutus_v3_script_unref(&plutus_script);
+  }
+  else if (strcmp(type, "SimpleScript") == 0)
+  {
+    cardano_native_script_t* native_script = NULL;
+    result                                 = cardano_native_script_from_cbor(reader, &native_script);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_script_new_native(native_script, script);
+    }
+
+    cardano_native_script_unref(&native_script);
+  }
+  else
+  {
+    cardano_cbor_reader_unref(&reader);
+    cardano_utils_set_error_message(provider, "Unknown referenceScript type in JSON response");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_cbor_reader_unref(&reader);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider, "Failed to decode referenceScript from JSON response");
+  }
+
+  return result;
+}
+
+/**
+ * \brief Builds a UTxO out of one entry of a UTxO set.
+ *
+ * \param[in] provider The provider implementation used for error reporting.
+ * \param[in] ref The key of the entry, "<tx id>#<index>".
+ * \param[in] ref_size The size of the key.
+ * \param[in] output The JSON of the output.
+ * \param[out] utxo On success, the UTxO.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+parse_utxo(cardano_provider_impl_t* provider, const char* ref, const size_t ref_size, cardano_json_object_t* output, cardano_utxo_t** utxo)
+{
+  const char* separator    = memchr(ref, '#', ref_size);
+  size_t      address_size = 0U;
+  const char* address_str  = get_string_property(output, "address", &address_size);
+
+  if ((separator == NULL) || (address_str == NULL))
+  {
+    cardano_utils_set_error_message(provider, "UTxO entry is missing its reference or address");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  char*          end      = NULL;
+  const uint64_t tx_index = (uint64_t)strtoull(separator + 1, &end, 10);
+
+  if ((end == (separator + 1)) || (end != (ref + ref_size)))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse UTxO reference from JSON response");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_blake2b_hash_t*       tx_id       = NULL;
+  cardano_address_t*            address     = NULL;
+  cardano_value_t*              value       = NULL;
+  cardano_datum_t*              datum       = NULL;
+  cardano_script_t*             script      = NULL;
+  cardano_transaction_input_t*  input       = NULL;
+  cardano_transaction_output_t* transaction = NULL;
+
+  cardano_error_t result = cardano_blake2b_hash_from_hex(ref, (size_t)(separator - ref), &tx_id);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse UTxO transaction id from JSON response");
+    goto cleanup;
+  }
+
+  result = cardano_address_intern_from_string(address_str, address_size, &address);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse address from JSON response");
+    goto cleanup;
+  }
+
+  result = parse_value(provider, output, &value);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    goto cleanup;
+  }
+
+  result = parse_datum(provider, output, &datum);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    goto cleanup;
+  }
+
+  result = parse_reference_script(provider, output, &script);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    goto cleanup;
+  }
+
+  result = cardano_transaction_input_new(tx_id, tx_index, &input);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    goto cleanup;
+  }
+
+  result = cardano_transaction_output_new(address, 0, &transaction);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    goto cleanup;
+  }
+
+  result = cardano_transaction_output_set_value(transaction, value);
+
+  if ((result == CARDANO_SUCCESS) && (datum != NULL))
+  {
+    result = cardano_transaction_output_set_datum(transaction, datum);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (script != NULL))
+  {
+    result = cardano_transaction_output_set_script_ref(transaction, script);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_utxo_new(input, transaction, utxo);
+  }
+
+cleanup:
+  cardano_blake2b_hash_unref(&tx_id);
+  cardano_address_unref(&address);
+  cardano_value_unref(&value);
+  cardano_datum_unref(&datum);
+  cardano_script_unref(&script);
+  cardano_transaction_input_unref(&input);
+  cardano_transaction_output_unref(&transaction);
+
+  return result;
+}
+
+/**
+ * \brief Writes the `value` object of an output.
+ *
+ * \param[in] writer The JSON writer.
+ * \param[in] value The value of the output.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+write_value(cardano_json_writer_t* writer, cardano_value_t* value)
+{
+  cardano_json_writer_write_property_name(writer, "value", 5);
+  cardano_json_writer_write_start_object(writer);
+  cardano_json_writer_write_property_name(writer, "lovelace", 8);
+  cardano_json_writer_write_uint(writer, (uint64_t)cardano_value_get_coin(value));
+
+  cardano_multi_asset_t* multi_asset = cardano_value_get_multi_asset(value);
+  cardano_multi_asset_unref(&multi_asset);
+
+  cardano_policy_id_list_t* policies = NULL;
+  cardano_error_t           result   = (multi_asset != NULL) ? cardano_multi_asset_get_keys(multi_asset, &policies) : CARDANO_SUCCESS;
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < cardano_policy_id_list_get_length(policies)); ++i)
+  {
+    cardano_blake2b_hash_t*    policy_id = NULL;
+    cardano_asset_name_map_t*  assets    = NULL;
+    cardano_asset_name_list_t* names     = NULL;
+    char                       policy_hex[57] = { 0 };
+
+    result = cardano_policy_id_list_get(policies, i, &policy_id);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_blake2b_hash_to_hex(policy_id, policy_hex, sizeof(policy_hex));
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_multi_asset_get_assets(multi_asset, policy_id, &assets);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_asset_name_map_get_keys(assets, &names);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      cardano_json_writer_write_property_name(writer, policy_hex, strlen(policy_hex));
+      cardano_json_writer_write_start_object(writer);
+
+      for (size_t j = 0U; (result == CARDANO_SUCCESS) && (j < cardano_asset_name_list_get_length(names)); ++j)
+      {
+        cardano_asset_name_t* name     = NULL;
+        int64_t               quantity = 0;
+
+        result = cardano_asset_name_list_get(names, j, &name);
+
+        if (result == CARDANO_SUCCESS)
+        {
+          result = cardano_asset_name_map_get(assets, name, &quantity);
+        }
+
+        if (result == CARDANO_SUCCESS)
+        {
+          cardano_json_writer_write_property_name(writer, cardano_asset_name_get_hex(name), cardano_asset_name_get_hex_size(name) - 1U);
+          cardano_json_writer_write_uint(writer, (uint64_t)quantity);
+        }
+
+        cardano_asset_name_unref(&name);
+      }
+
+      cardano_json_writer_write_end_object(writer);
+    }
+
+    cardano_asset_name_list_unref(&names);
+    cardano_asset_name_map_unref(&assets);
+    cardano_blake2b_hash_unref(&policy_id);
+  }
+
+  cardano_policy_id_list_unref(&policies);
+  cardano_json_writer_write_end_object(writer);
+
+  return result;
+}
+
+/**
+ * \brief Writes the datum properties of an output.
+ *
+ * \param[in] writer The JSON writer.
+ * \param[in] datum The datum of the output, or `NULL`.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+write_datum(cardano_json_writer_t* writer, cardano_datum_t* datum)
+{
+  cardano_datum_type_t type   = CARDANO_DATUM_TYPE_DATA_HASH;
+  cardano_error_t      result = (datum != NULL) ? cardano_datum_get_type(datum, &type) : CARDANO_SUCCESS;
+
+  if ((result != CARDANO_SUCCESS) || (datum == NULL))
+  {
+    return result;
+  }
+
+  if (type == CARDANO_DATUM_TYPE_DATA_HASH)
+  {
+    cardano_json_writer_write_property_name(writer, "datumhash", 9);
+    cardano_json_writer_write_string(writer, cardano_datum_get_data_hash_hex(datum), cardano_datum_get_data_hash_hex_size(datum) - 1U);
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_plutus_data_t* data = cardano_datum_get_inline_data(datum);
+  cardano_plutus_data_unref(&data);
+
+  cardano_cbor_writer_t* cbor = cardano_cbor_writer_new();
+
+  if (cbor == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  result = cardano_plutus_data_to_cbor(data, cbor);
+
+  const size_t hex_size = cardano_cbor_writer_get_hex_size(cbor);
+  char*        hex      = (result == CARDANO_SUCCESS) ? malloc(hex_size) : NULL;
+
+  if ((result == CARDANO_SUCCESS) && (hex == NULL))
+  {
+    result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_encode_hex(cbor, hex, hex_size);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    cardano_json_writer_write_property_name(writer, "inlineDatumRaw", 14);
+    cardano_json_writer_write_string(writer, hex, hex_size - 1U);
+  }
+
+  free(hex);
+  cardano_cbor_writer_unref(&cbor);
+
+  return result;
+}
+
+/* IMPLEMENTATION *************************************************************/
+
+cardano_error_t
+cardano_hydra_parse_utxo_set(
+  cardano_provider_impl_t*          provider,
+  const char*                       json,
+  const size_t                      size,
+  const cardano_hydra_utxo_filter_t filter,
+  void*                             filter_context,
+  cardano_utxo_list_t**             utxo_list)
+{
+  cardano_json_object_t* parsed_json = cardano_json_object_parse(json, size);
+
+  if ((parsed_json == NULL) || (cardano_json_object_get_type(parsed_json) != CARDANO_JSON_OBJECT_TYPE_OBJECT))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+    cardano_json_object_unref(&parsed_json);
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_error_t result = cardano_utxo_list_new(utxo_list);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider, "Failed to allocate memory for UTXO list");
+    cardano_json_object_unref(&parsed_json);
+
+    return result;
+  }
+
+  const size_t entries = cardano_json_object_get_property_count(parsed_json);
+
+  for (size_t i = 0U; i < entries; ++i)
+  {
+    size_t                 ref_size = 0U;
+    const char*            ref      = cardano_json_object_get_key_at(parsed_json, i, &ref_size);
+    cardano_json_object_t* output   = cardano_json_object_get_value_at_ex(parsed_json, i);
+    cardano_utxo_t*        utxo     = NULL;
+
+    if ((ref == NULL) || (output == NULL) || ((filter != NULL) && !filter(ref, ref_size, output, filter_context)))
+    {
+      continue;
+    }
+
+    result = parse_utxo(provider, ref, ref_size, output, &utxo);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_utxo_list_add(*utxo_list, utxo);
+    }
+
+    cardano_utxo_unref(&utxo);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_utxo_list_unref(utxo_list);
+      cardano_json_object_unref(&parsed_json);
+
+      return result;
+    }
+  }
+
+  cardano_json_object_unref(&parsed_json);
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_hydra_utxo_list_to_json(
+  cardano_provider_impl_t* provider,
+  cardano_utxo_list_t*     utxos,
+  char**                   json,
+  size_t*                  json_size)
+{
+  cardano_json_writer_t* writer = cardano_json_writer_new(CARDANO_JSON_FORMAT_COMPACT);
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  cardano_json_writer_write_start_object(writer);
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < cardano_utxo_list_get_length(utxos)); ++i)
+  {
+    cardano_utxo_t* utxo = NULL;
+
+    result = cardano_utxo_list_get(utxos, i, &utxo);
+    cardano_utxo_unref(&utxo);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      break;
+    }
+
+    // The list keeps the UTxO, and so its input and output, alive after these references are released
+    cardano_transaction_input_t*  input  = cardano_utxo_get_input(utxo);
+    cardano_transaction_output_t* output = cardano_utxo_get_output(utxo);
+    cardano_transaction_input_unref(&input);
+    cardano_transaction_output_unref(&output);
+
+    cardano_script_t* script = cardano_transaction_output_get_script_ref(output);
+
+    if (script != NULL)
+    {
+      cardano_script_unref(&script);
+      cardano_utils_set_error_message(provider, "Committing outputs with a reference script is not supported");
+      result = CARDANO_ERROR_NOT_IMPLEMENTED;
+
+      break;
+    }
+
+    cardano_blake2b_hash_t* tx_id = cardano_transaction_input_get_id(input);
+    char                    hash[65] = { 0 };
+
+    result = cardano_blake2b_hash_to_hex(tx_id, hash, sizeof(hash));
+    cardano_blake2b_hash_unref(&tx_id);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      break;
+    }
+
+    char ref[96] = { 0 };
+
+    CARDANO_UNUSED(snprintf(ref, sizeof(ref), "%s#%lu", hash, (unsigned long)cardano_transaction_input_get_index(input)));
+
+    cardano_address_t* address = cardano_transaction_output_get_address(output);
+    cardano_address_unref(&address);
+
+    const char* address_str = cardano_address_get_string(address);
+
+    if (address_str == NULL)
+    {
+      result = CARDANO_ERROR_INVALID_ADDRESS_FORMAT;
+
+      break;
+    }
+
+    cardano_json_writer_write_property_name(writer, ref, strlen(ref));
+    cardano_json_writer_write_start_object(writer);
+    cardano_json_writer_write_property_name(writer, "address", 7);
+    cardano_json_writer_write_string(writer, address_str, strlen(address_str));
+
+    cardano_value_t* value = cardano_transaction_output_get_value(output);
+    cardano_value_unref(&value);
+
+    result = write_value(writer, value);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      cardano_datum_t* datum = cardano_transaction_output_get_datum(output);
+      cardano_datum_unref(&datum);
+
+      result = write_datum(writer, datum);
+    }
+
+    cardano_json_writer_write_end_object(writer);
+  }
+
+  cardano_json_writer_write_end_object(writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    *json_size = cardano_json_writer_get_encoded_size(writer);
+    *json      = malloc(*json_size);
+
+    if (*json == NULL)
+    {
+      result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+    else
+    {
+      result = cardano_json_writer_encode(writer, *json, *json_size);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        free(*json);
+        *json = NULL;
+      }
+      else
+      {
+        *json_size -= 1U;
+      }
+    }
+  }
+
+  cardano_json_writer_unref(&writer);
+
+  return result;
+}
@@ -0,0 +1,248 @@
+/**
+ * \file json_reader.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_JSON_READER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_JSON_READER_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/json/json_token_type.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Provides a forward-only, pull-style reader of UTF-8 encoded JSON text.
+ *
+ * Unlike \ref cardano_json_object_parse, the reader does not build a tree: every call to \ref cardano_json_reader_read
+ * yields the next token, and strings and numbers are handed out as views into the input. Only strings containing escape
+ * sequences are decoded, into a scratch buffer reused for the whole document, so reading a document of any size costs
+ * a constant number of allocations.
+ */
+typedef struct cardano_json_reader_t cardano_json_reader_t;
+
+/**
+ * \brief Creates a JSON reader over a document.
+ *
+ * \param[in] json The JSON text. It is not copied, and must outlive the reader and every view it hands out.
+ * \param[in] size The size of the text in bytes, without any null terminator.
+ *
+ * \return The new reader, or NULL if \p json is NULL, \p size is zero or memory could not be allocated. The caller must
+ *         release it with \ref cardano_json_reader_unref.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_json_reader_t*    reader = cardano_json_reader_new(json, json_size);
+ * cardano_json_token_type_t token  = CARDANO_JSON_TOKEN_TYPE_NONE;
+ *
+ * while ((cardano_json_reader_read(reader, &token) == CARDANO_SUCCESS) && (token != CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT))
+ * {
+ *   if ((token == CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME) && cardano_json_reader_property_equals(reader, "fee", 3))
+ *   {
+ *     uint64_t fee = 0U;
+ *
+ *     if ((cardano_json_reader_read(reader, &token) == CARDANO_SUCCESS) && (cardano_json_reader_get_uint(reader, &fee) == CARDANO_SUCCESS))
+ *     {
+ *       printf("Fee: %llu\n", (unsigned long long)fee);
+ *     }
+ *   }
+ * }
+ *
+ * cardano_json_reader_unref(&reader);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_json_reader_t* cardano_json_reader_new(const char* json, size_t size);
+
+/**
+ * \brief Reads the next token of the document.
+ *
+ * Separators are consumed along the way, and the structure of the document is validated as it is read: an error is
+ * reported as soon as the text stops being valid JSON. After \ref CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT, further
+ * calls keep returning it.
+ *
+ * \param[in] reader The reader.
+ * \param[out] token The type of the token read.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_JSON if the text is malformed, or another error
+ *         code on failure. Once an error is returned, every later call returns it too.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_reader_read(cardano_json_reader_t* reader, cardano_json_token_type_t* token);
+
+/**
+ * \brief Skips the value the reader is positioned at.
+ *
+ * After a \ref CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME, reads the property value, including all of its children. After a
+ * \ref CARDANO_JSON_TOKEN_TYPE_START_OBJECT or \ref CARDANO_JSON_TOKEN_TYPE_START_ARRAY, reads up to and including the
+ * matching end token. After any other token, does nothing.
+ *
+ * \param[in] reader The reader.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of \ref cardano_json_reader_read.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_reader_skip(cardano_json_reader_t* reader);
+
+/**
+ * \brief Gets the type of the last token read.
+ *
+ * \param[in] reader The reader.
+ *
+ * \return The type of the last token, or \ref CARDANO_JSON_TOKEN_TYPE_NONE if nothing was read yet or \p reader is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_json_token_type_t cardano_json_reader_get_token_type(const cardano_json_reader_t* reader);
+
+/**
+ * \brief Gets the text of the last string, property name or number read.
+ *
+ * \param[in] reader The reader.
+ * \param[out] size The size of the text in bytes. May be NULL.
+ *
+ * \return A view of the text, or NULL if the last token has no text. The view is not null-terminated, and stays valid
+ *         until the next call to \ref cardano_json_reader_read or \ref cardano_json_reader_skip.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_json_reader_get_string(const cardano_json_reader_t* reader, size_t* size);
+
+/**
+ * \brief Checks whether the last token is a property with the given name.
+ *
+ * \param[in] reader The reader.
+ * \param[in] name The name to compare with. It does not need to be null-terminated.
+ * \param[in] name_size The size of \p name in bytes.
+ *
+ * \return `true` if the last token is a \ref CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME equal to \p name.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_json_reader_property_equals(const cardano_json_reader_t* reader, const char* name, size_t name_size);
+
+/**
+ * \brief Gets the last number read as an unsigned integer.
+ *
+ * As with \ref cardano_json_object_get_uint, a string holding a number is accepted too.
+ *
+ * \param[in] reader The reader.
+ * \param[out] value The value.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_JSON_TYPE_MISMATCH if the last token is neither a number
+ *         nor a string, or a decoding error if it does not hold an unsigned integer.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_reader_get_uint(const cardano_json_reader_t* reader, uint64_t* value);
+
+/**
+ * \brief Gets the last number read as a signed integer.
+ *
+ * \param[in] reader The reader.
+ * \param[out] value The value.
+ *
+ * \return The same as \ref cardano_json_reader_get_uint.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_reader_get_signed_int(const cardano_json_reader_t* reader, int64_t* value);
+
+/**
+ * \brief Gets the last number read as a double.
+ *
+ * \param[in] reader The reader.
+ * \param[out] value The value.
+ *
+ * \return The same as \ref cardano_json_reader_get_uint.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_reader_get_double(const cardano_json_reader_t* reader, double* value);
+
+/**
+ * \brief Gets the last boolean read.
+ *
+ * \param[in] reader The reader.
+ * \param[out] value The value.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_JSON_TYPE_MISMATCH if the last token is not a boolean.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_reader_get_boolean(const cardano_json_reader_t* reader, bool* value);
+
+/**
+ * \brief Gets how many objects and arrays enclose the reader position.
+ *
+ * \param[in] reader The reader.
+ *
+ * \return The depth: zero at the top level, one right after the outermost start token, and so on.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_json_reader_get_depth(const cardano_json_reader_t* reader);
+
+/**
+ * \brief Decrements the reference count of a JSON reader, and releases it when it reaches zero.
+ *
+ * \param[in,out] reader A pointer to the reader. It is set to NULL once the reader is released.
+ */
+CARDANO_EXPORT void cardano_json_reader_unref(cardano_json_reader_t** reader);
+
+/**
+ * \brief Increments the reference count of a JSON reader.
+ *
+ * \param[in] reader The reader.
+ */
+CARDANO_EXPORT void cardano_json_reader_ref(cardano_json_reader_t* reader);
+
+/**
+ * \brief Gets the reference count of a JSON reader.
+ *
+ * \param[in] reader The reader.
+ *
+ * \return The reference count, or zero if \p reader is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_json_reader_refcount(const cardano_json_reader_t* reader);
+
+/**
+ * \brief Sets the last error message of a JSON reader.
+ *
+ * \param[in] reader The reader.
+ * \param[in] message The null-terminated message, truncated to 1023 characters. NULL clears it.
+ */
+CARDANO_EXPORT void cardano_json_reader_set_last_error(cardano_json_reader_t* reader, const char* message);
+
+/**
+ * \brief Gets the last error message of a JSON reader, such as the description of a syntax error.
+ *
+ * \param[in] reader The reader.
+ *
+ * \return The null-terminated message, owned by the reader.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_json_reader_get_last_error(const cardano_json_reader_t* reader);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_JSON_READER_H
@@ -0,0 +1,100 @@
+/**
+ * \file json_token_type.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_JSON_TOKEN_TYPE_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_JSON_TOKEN_TYPE_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/export.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Enumerates the tokens a \ref cardano_json_reader_t can read.
+ */
+typedef enum
+{
+  /**
+   * \brief No token has been read yet.
+   */
+  CARDANO_JSON_TOKEN_TYPE_NONE,
+
+  /**
+   * \brief The opening brace of an object.
+   */
+  CARDANO_JSON_TOKEN_TYPE_START_OBJECT,
+
+  /**
+   * \brief The closing brace of an object.
+   */
+  CARDANO_JSON_TOKEN_TYPE_END_OBJECT,
+
+  /**
+   * \brief The opening bracket of an array.
+   */
+  CARDANO_JSON_TOKEN_TYPE_START_ARRAY,
+
+  /**
+   * \brief The closing bracket of an array.
+   */
+  CARDANO_JSON_TOKEN_TYPE_END_ARRAY,
+
+  /**
+   * \brief The name of an object property; its value is the next token.
+   */
+  CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME,
+
+  /**
+   * \brief A string value.
+   */
+  CARDANO_JSON_TOKEN_TYPE_STRING,
+
+  /**
+   * \brief A number value.
+   */
+  CARDANO_JSON_TOKEN_TYPE_NUMBER,
+
+  /**
+   * \brief A `true` or `false` value.
+   */
+  CARDANO_JSON_TOKEN_TYPE_BOOLEAN,
+
+  /**
+   * \brief A `null` value.
+   */
+  CARDANO_JSON_TOKEN_TYPE_NULL,
+
+  /**
+   * \brief The whole document has been read.
+   */
+  CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT
+} cardano_json_token_type_t;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_JSON_TOKEN_TYPE_H
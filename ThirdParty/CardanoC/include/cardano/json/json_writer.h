@@ -1036,6 +1036,44 @@ CARDANO_EXPORT void cardano_json_writer_write_string(
   const char*            value,
   size_t                 value_size);
 
+/**
+ * \brief Writes bytes as a lowercase hexadecimal JSON string.
+ *
+ * Equivalent to hex-encoding \p data and passing the result to \ref cardano_json_writer_write_string, but the digits
+ * are written straight into the writer, without an intermediate allocation or escaping pass. This is the fast path for
+ * hashes, policy ids and CBOR payloads.
+ *
+ * \param[in] writer A pointer to the \ref cardano_json_writer_t instance.
+ * \param[in] data The bytes to encode. May be NULL only if \p data_size is zero.
+ * \param[in] data_size The number of bytes in \p data.
+ *
+ * \pre The writer must be expecting a value: in an array, after a property name, or at the root of an empty document.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_json_writer_write_property_name(writer, "id", 2);
+ * cardano_json_writer_write_hex(writer, cardano_blake2b_hash_get_data(hash), cardano_blake2b_hash_get_bytes_size(hash));
+ * \endcode
+ */
+CARDANO_EXPORT void cardano_json_writer_write_hex(
+  cardano_json_writer_t* writer,
+  const byte_t*          data,
+  size_t                 data_size);
+
+/**
+ * \brief Computes how many bytes \ref cardano_json_writer_write_string adds for a string.
+ *
+ * Meant for size estimation passes that preallocate the writer with \ref cardano_json_writer_reserve. Separators,
+ * new lines and indentation are not included.
+ *
+ * \param[in] value The string. It does not need to be null-terminated.
+ * \param[in] value_size The size of \p value in bytes.
+ *
+ * \return The size of the written string in bytes, its quotes and escape sequences included.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_json_writer_get_string_size(const char* value, size_t value_size);
+
 /**
  * \brief Gets the current context of the JSON writer.
  *
@@ -1204,7 +1242,8 @@ CARDANO_EXPORT cardano_error_t cardano_json_writer_encode_in_buffer(
  *
  * This function resets the internal state of the JSON writer, effectively removing any data that has been written to it.
  * This is useful for reusing a writer instance without needing to create a new one, especially when working with
- * sequences of data encoding tasks.
+ * sequences of data encoding tasks. The memory already allocated for the output is kept, so a writer reused for
+ * documents of similar size stops allocating after the first few.
  *
  * \param[in] writer The JSON writer instance to reset.
  *
@@ -1236,6 +1275,32 @@ CARDANO_EXPORT cardano_error_t cardano_json_writer_encode_in_buffer(
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_json_writer_reset(cardano_json_writer_t* writer);
 
+/**
+ * \brief Preallocates room for the output of the JSON writer.
+ *
+ * Ensures the writer can hold \p size bytes of output in total, bytes already written included, without growing its
+ * buffer again. Call it with an estimate of the document size before writing a large document; it never shrinks the
+ * buffer, and survives \ref cardano_json_writer_reset.
+ *
+ * \param[in] writer The JSON writer instance.
+ * \param[in] size The number of output bytes to make room for, without the null terminator.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p writer is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the memory could not be allocated.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_json_writer_t* writer = cardano_json_writer_new(CARDANO_JSON_FORMAT_COMPACT);
+ *
+ * if (cardano_json_writer_reserve(writer, 64U * 1024U) == CARDANO_SUCCESS)
+ * {
+ *   // Documents up to 64 KiB are now written without reallocating
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_json_writer_reserve(cardano_json_writer_t* writer, size_t size);
+
 /**
  * \brief Decrements the reference count of a JSON writer object.
  *
@@ -0,0 +1,92 @@
+/**
+ * \file memory_secure_key_handler.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_MEMORY_SECURE_KEY_HANDLER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_MEMORY_SECURE_KEY_HANDLER_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/crypto/ed25519_private_key.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/key_handlers/secure_key_handler.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Creates a new in-memory secure key handler for an Ed25519 private key.
+ *
+ * The `cardano_memory_secure_key_handler_ed25519_new` function initializes an Ed25519 secure key handler meant for
+ * short-lived keys that never leave the process, such as server-side session keys. Instead of encrypting the key with
+ * a passphrase (EMIP-3), the handler expands it once into a \ref cardano_ed25519_signing_context_t, whose key material
+ * lives in `sodium_malloc` guarded pages that are made read-only where the platform supports it.
+ *
+ * Signing therefore never retrieves a passphrase or runs PBKDF2, and does not expand the key again: each signature
+ * costs a single Ed25519 signing operation. The handler implements the same \ref cardano_secure_key_handler_t
+ * interface as the software handler, so the transaction builder and the signers use it transparently.
+ *
+ * Because the key is never encrypted, the handler cannot be serialized: \ref cardano_secure_key_handler_serialize
+ * returns \ref CARDANO_ERROR_NOT_IMPLEMENTED. \ref cardano_secure_key_handler_unlock and
+ * \ref cardano_secure_key_handler_lock succeed without effect, since the key is always available. The key material is
+ * wiped when the handler is released.
+ *
+ * \param[in] ed25519_private_key The Ed25519 private key, in normal (32 bytes) or extended (64 bytes) form. The handler
+ *                                does not keep a reference to it; the caller still owns it and should release it as
+ *                                soon as possible.
+ * \param[out] secure_key_handler On success, the new key handler. The caller must release it with
+ *                                \ref cardano_secure_key_handler_unref.
+ *
+ * \returns \ref CARDANO_SUCCESS on success, or an error code on failure.
+ *
+ * Example:
+ * \code
+ * cardano_ed25519_private_key_t* session_key    = ...; // Freshly generated, never written to disk
+ * cardano_secure_key_handler_t*  secure_handler = NULL;
+ *
+ * cardano_error_t result = cardano_memory_secure_key_handler_ed25519_new(session_key, &secure_handler);
+ *
+ * // The handler holds its own copy of the expanded key.
+ * cardano_ed25519_private_key_unref(&session_key);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // Sign with cardano_secure_key_handler_ed25519_sign_transaction...
+ *   cardano_secure_key_handler_unref(&secure_handler);
+ * }
+ * \endcode
+ *
+ * \see cardano_software_secure_key_handler_ed25519_new for keys that must be persisted or protected by a passphrase.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_memory_secure_key_handler_ed25519_new(
+  const cardano_ed25519_private_key_t* ed25519_private_key,
+  cardano_secure_key_handler_t**       secure_key_handler);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_MEMORY_SECURE_KEY_HANDLER_H
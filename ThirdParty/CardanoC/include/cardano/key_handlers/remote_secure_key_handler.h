@@ -0,0 +1,167 @@
+/**
+ * \file remote_secure_key_handler.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_REMOTE_SECURE_KEY_HANDLER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_REMOTE_SECURE_KEY_HANDLER_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/key_handlers/secure_key_handler.h>
+#include <cardano/typedefs.h>
+
+/* CONSTANTS *****************************************************************/
+
+/*
+ * Wire format of the signing service (see tools/cardano-signer). Every integer is little endian.
+ *
+ * A frame is a 12 byte header followed by `payload_size` bytes:
+ *
+ *   uint32 magic | uint16 version | uint16 operation | uint32 payload_size
+ *
+ * Responses echo the magic, version and operation of the request, and their payload starts with a uint32
+ * `cardano_error_t` status; the rest of the payload is only present when the status is CARDANO_SUCCESS.
+ *
+ * A derivation path is encoded as five uint32 values: purpose, coin type, account, role and index, with the
+ * hardening bit set where it applies.
+ *
+ * CARDANO_SIGNING_SERVICE_OP_SIGN
+ *   request:  uint32 count, then `count` items of { 32 byte hash, derivation path }
+ *   response: status, then `count` items of { 32 byte Ed25519 public key, 64 byte Ed25519 signature }, in order
+ *
+ * CARDANO_SIGNING_SERVICE_OP_GET_ACCOUNT_PUBLIC_KEY
+ *   request:  derivation path (role and index are ignored)
+ *   response: status, then the 64 byte BIP32 extended account public key
+ */
+
+/**
+ * \brief Magic number opening every frame of the signing service protocol ("CSGN").
+ */
+#define CARDANO_SIGNING_SERVICE_MAGIC 0x4E475343U
+
+/**
+ * \brief Version of the signing service protocol.
+ */
+#define CARDANO_SIGNING_SERVICE_VERSION 1U
+
+/**
+ * \brief Size in bytes of a frame header.
+ */
+#define CARDANO_SIGNING_SERVICE_HEADER_SIZE 12U
+
+/**
+ * \brief Operation signing a batch of hashes.
+ */
+#define CARDANO_SIGNING_SERVICE_OP_SIGN 1U
+
+/**
+ * \brief Operation retrieving an extended account public key.
+ */
+#define CARDANO_SIGNING_SERVICE_OP_GET_ACCOUNT_PUBLIC_KEY 2U
+
+/**
+ * \brief Size in bytes of an encoded derivation path.
+ */
+#define CARDANO_SIGNING_SERVICE_PATH_SIZE 20U
+
+/**
+ * \brief Size in bytes of an item of a sign request.
+ */
+#define CARDANO_SIGNING_SERVICE_SIGN_REQUEST_ITEM_SIZE (32U + CARDANO_SIGNING_SERVICE_PATH_SIZE)
+
+/**
+ * \brief Size in bytes of an item of a sign response.
+ */
+#define CARDANO_SIGNING_SERVICE_SIGN_RESPONSE_ITEM_SIZE (32U + 64U)
+
+/**
+ * \brief Maximum number of signatures in a single sign request.
+ *
+ * Larger batches are split into several requests by the remote key handler.
+ */
+#ifndef CARDANO_SIGNING_SERVICE_MAX_BATCH_SIZE
+#define CARDANO_SIGNING_SERVICE_MAX_BATCH_SIZE 4096U
+#endif
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Creates a secure key handler that signs through a signing service running in another process.
+ *
+ * The `cardano_remote_secure_key_handler_new` function connects to a signing service (such as the `cardano-signer`
+ * daemon) listening on a local (Unix domain) socket. The service holds the unlocked BIP32 keys; the handler only
+ * sends it the hashes to sign with their derivation paths, and builds the vkey witnesses from the public keys and
+ * signatures it returns. Key material never enters the calling process, and every process connected to the same
+ * service shares its unlocked session and its derived keys.
+ *
+ * \ref cardano_secure_key_handler_bip32_sign_transactions sends a whole batch, every transaction with every
+ * derivation path, in a single round trip. \ref cardano_secure_key_handler_bip32_get_extended_account_public_key is
+ * forwarded to the service as well.
+ *
+ * The handler is of type \ref CARDANO_SECURE_KEY_HANDLER_TYPE_BIP32. Since the keys are held by the service, it cannot
+ * be serialized and does not export signing keys: \ref cardano_secure_key_handler_serialize and
+ * \ref cardano_secure_key_handler_bip32_get_signing_context return \ref CARDANO_ERROR_NOT_IMPLEMENTED, while
+ * \ref cardano_secure_key_handler_unlock and \ref cardano_secure_key_handler_lock succeed without effect.
+ *
+ * The connection is opened by this function and kept for the lifetime of the handler. If it breaks (for instance
+ * when the service restarts), the next request reconnects once before failing. Like other key handlers, a handler
+ * must not be used from several threads at the same time; create one per thread to sign concurrently.
+ *
+ * \param[in] socket_path The path of the socket the service listens on.
+ * \param[in] socket_path_size The length of `socket_path`, without a null terminator.
+ * \param[out] secure_key_handler On success, the new key handler. The caller must release it with
+ *                                \ref cardano_secure_key_handler_unref.
+ *
+ * \returns \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ARGUMENT if the path does not fit in a socket
+ *          address, \ref CARDANO_ERROR_GENERIC if the service could not be reached, or
+ *          \ref CARDANO_ERROR_NOT_IMPLEMENTED on platforms without Unix domain sockets (Windows builds).
+ *
+ * Example:
+ * \code
+ * static const char* socket_path = "/run/cardano-signer/signer.sock";
+ *
+ * cardano_secure_key_handler_t* secure_handler = NULL;
+ *
+ * cardano_error_t result = cardano_remote_secure_key_handler_new(socket_path, strlen(socket_path), &secure_handler);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // Sign with cardano_secure_key_handler_bip32_sign_transaction(s), exactly as with a local handler...
+ *   cardano_secure_key_handler_unref(&secure_handler);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_remote_secure_key_handler_new(
+  const char*                    socket_path,
+  size_t                         socket_path_size,
+  cardano_secure_key_handler_t** secure_key_handler);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_REMOTE_SECURE_KEY_HANDLER_H
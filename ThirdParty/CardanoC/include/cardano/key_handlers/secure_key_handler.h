@@ -145,6 +145,32 @@ CARDANO_EXPORT cardano_error_t cardano_secure_key_handler_bip32_sign_transaction
   size_t                           num_paths,
   cardano_vkey_witness_set_t**     vkey_witness_set);
 
+/**
+ * \brief Signs several transactions with the same BIP32 Hierarchical Deterministic (HD) keys.
+ *
+ * Equivalent to calling \ref cardano_secure_key_handler_bip32_sign_transaction for every transaction, except that
+ * handlers supporting batches access the key material and derive each key in `derivation_paths` only once.
+ *
+ * \param[in] secure_key_handler A pointer to the secure key handler managing the cryptographic key operations.
+ * \param[in] txs The transactions to be signed.
+ * \param[in] num_txs The number of transactions in the `txs` array.
+ * \param[in] derivation_paths An array of BIP32 derivation paths used to derive the private keys signing every transaction.
+ * \param[in] num_paths The number of derivation paths provided in the `derivation_paths` array.
+ * \param[out] vkey_witness_sets An array of `num_txs` entries that receives the witness set of each transaction, in order.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered during signing.
+ *
+ * \note On failure every entry of `vkey_witness_sets` is NULL. On success the caller must release each of them.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_secure_key_handler_bip32_sign_transactions(
+  cardano_secure_key_handler_t*    secure_key_handler,
+  cardano_transaction_t* const*    txs,
+  size_t                           num_txs,
+  const cardano_derivation_path_t* derivation_paths,
+  size_t                           num_paths,
+  cardano_vkey_witness_set_t**     vkey_witness_sets);
+
 /**
  * \brief Retrieves the extended BIP32 account public key for a given derivation path.
  *
@@ -209,6 +235,89 @@ CARDANO_EXPORT cardano_error_t cardano_secure_key_handler_ed25519_get_public_key
   cardano_secure_key_handler_t*  secure_key_handler,
   cardano_ed25519_public_key_t** public_key);
 
+/**
+ * \brief Retrieves a precomputed signing key for a BIP32 derivation path.
+ *
+ * The returned context holds the expanded private key at `derivation_path` in locked memory and signs without going
+ * through the key handler again, so a hot key can sign any number of transactions after a single derivation. Keep
+ * it only for as long as the key is needed; releasing it wipes the key material.
+ *
+ * While an unlocked session is open, handlers may serve repeated requests for the same path from the session
+ * without deriving the key again.
+ *
+ * \param[in] secure_key_handler A pointer to the secure key handler managing the cryptographic key operations.
+ * \param[in] derivation_path The BIP32 derivation path of the signing key.
+ * \param[out] signing_context On success, the signing context. The caller must release it with
+ *                             \ref cardano_ed25519_signing_context_unref.
+ *
+ * \returns \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_NOT_IMPLEMENTED if the handler cannot export signing
+ *          keys (e.g. hardware wallets), or another error code otherwise.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_secure_key_handler_bip32_get_signing_context(
+  cardano_secure_key_handler_t*       secure_key_handler,
+  cardano_derivation_path_t           derivation_path,
+  cardano_ed25519_signing_context_t** signing_context);
+
+/**
+ * \brief Retrieves a precomputed signing key for the Ed25519 key managed by the handler.
+ *
+ * \param[in] secure_key_handler A pointer to the secure key handler managing the Ed25519 cryptographic operations.
+ * \param[out] signing_context On success, the signing context. The caller must release it with
+ *                             \ref cardano_ed25519_signing_context_unref.
+ *
+ * \returns \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_NOT_IMPLEMENTED if the handler cannot export signing
+ *          keys, or another error code otherwise.
+ *
+ * \see cardano_secure_key_handler_bip32_get_signing_context
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_secure_key_handler_ed25519_get_signing_context(
+  cardano_secure_key_handler_t*       secure_key_handler,
+  cardano_ed25519_signing_context_t** signing_context);
+
+/**
+ * \brief Opens an unlocked session on the secure key handler.
+ *
+ * While the session is open the handler keeps the decrypted key material in locked, access-protected memory, so
+ * signing and key derivation no longer invoke the passphrase callback nor repeat the key stretching on every call.
+ * The key material is wiped when the session expires, when `max_operations` operations have been served, when
+ * \ref cardano_secure_key_handler_lock is called, or when the handler is deallocated.
+ *
+ * Calling this function while a session is already open replaces the previous session.
+ *
+ * \param[in] secure_key_handler A pointer to the secure key handler.
+ * \param[in] ttl_seconds The session lifetime in seconds, or 0 for a session that does not expire with time.
+ * \param[in] max_operations The number of operations the session serves before it is wiped, or 0 for no limit.
+ *
+ * \returns \ref CARDANO_SUCCESS if the session was opened, \ref CARDANO_ERROR_NOT_IMPLEMENTED if the handler does not
+ *          support sessions, or another error code if the key material could not be decrypted.
+ *
+ * Usage Example:
+ * \code{.c}
+ * // Keep the keys unlocked for at most 60 seconds or 100 signatures, whichever comes first.
+ * cardano_error_t result = cardano_secure_key_handler_unlock(secure_key_handler, 60U, 100U);
+ *
+ * // ... sign transactions ...
+ *
+ * cardano_secure_key_handler_lock(secure_key_handler);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_secure_key_handler_unlock(
+  cardano_secure_key_handler_t* secure_key_handler,
+  uint64_t                      ttl_seconds,
+  uint64_t                      max_operations);
+
+/**
+ * \brief Closes the unlocked session of the secure key handler, if any, and wipes the cached key material.
+ *
+ * \param[in] secure_key_handler A pointer to the secure key handler.
+ *
+ * \returns \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_NOT_IMPLEMENTED if the handler does not support sessions.
+ */
+CARDANO_EXPORT cardano_error_t cardano_secure_key_handler_lock(cardano_secure_key_handler_t* secure_key_handler);
+
 /**
  * \brief Decrements the reference count of a cardano_secure_key_handler_t object.
  *
@@ -26,6 +26,7 @@
 
 #include <cardano/crypto/bip32_public_key.h>
 #include <cardano/crypto/ed25519_public_key.h>
+#include <cardano/crypto/ed25519_signing_context.h>
 #include <cardano/key_handlers/account_derivation_path.h>
 #include <cardano/key_handlers/derivation_path.h>
 #include <cardano/key_handlers/secure_key_handler_type.h>
@@ -92,6 +93,32 @@ typedef cardano_error_t (*cardano_bip32_sign_transaction_func_t)(
   size_t                             num_paths,
   cardano_vkey_witness_set_t**       vkey_witness_set);
 
+/**
+ * \brief Callback function type for signing several transactions with the same BIP32 keys.
+ *
+ * The `cardano_bip32_sign_transactions_func_t` typedef defines the signature for a callback function that signs a batch
+ * of transactions with the keys at the given derivation paths, accessing the key material and deriving each key only once
+ * for the whole batch.
+ *
+ * \param secure_key_handler_impl A pointer to the secure key handler implementation that manages cryptographic operations.
+ * \param txs The transactions to be signed.
+ * \param num_txs The number of transactions in the `txs` array.
+ * \param derivation_paths An array of BIP32 derivation paths used to derive the private keys signing every transaction.
+ * \param num_paths The number of derivation paths provided in the `derivation_paths` array.
+ * \param vkey_witness_sets An array of `num_txs` entries that receives the witness set of each transaction, in order.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered during signing.
+ *
+ * \note On failure no witness set is returned; on success the caller must release every entry of `vkey_witness_sets`.
+ */
+typedef cardano_error_t (*cardano_bip32_sign_transactions_func_t)(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  cardano_transaction_t* const*      txs,
+  size_t                             num_txs,
+  const cardano_derivation_path_t*   derivation_paths,
+  size_t                             num_paths,
+  cardano_vkey_witness_set_t**       vkey_witness_sets);
+
 /**
  * \brief Callback function type for retrieving a BIP32 extended account public key.
  *
@@ -189,6 +216,71 @@ typedef cardano_error_t (*cardano_serialize_secure_key_handler_func_t)(
   cardano_secure_key_handler_impl_t* secure_key_handler_impl,
   cardano_buffer_t**                 serialized_data);
 
+/**
+ * \brief Callback function type for opening an unlocked session on a secure key handler.
+ *
+ * The `cardano_unlock_secure_key_handler_func_t` typedef defines the signature for a callback function that keeps the
+ * decrypted key material available for a limited time or number of operations, so that subsequent signing and derivation
+ * calls do not need to retrieve the passphrase and re-run the key stretching again.
+ *
+ * This function is expected to:
+ * - Decrypt the key material once and keep it in protected memory that is locked and inaccessible while idle.
+ * - Wipe the key material as soon as the session expires, its operation budget is exhausted, or the lock callback is invoked.
+ *
+ * \param secure_key_handler_impl A pointer to the secure key handler implementation that manages cryptographic operations.
+ * \param ttl_seconds The session lifetime in seconds. A value of 0 means the session does not expire with time.
+ * \param max_operations The number of operations served from the session before it is wiped. A value of 0 means unlimited.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered while opening the session.
+ */
+typedef cardano_error_t (*cardano_unlock_secure_key_handler_func_t)(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  uint64_t                           ttl_seconds,
+  uint64_t                           max_operations);
+
+/**
+ * \brief Callback function type for closing an unlocked session on a secure key handler.
+ *
+ * The `cardano_lock_secure_key_handler_func_t` typedef defines the signature for a callback function that wipes any
+ * key material kept by a previous call to the unlock callback. Calling it when no session is open must succeed.
+ *
+ * \param secure_key_handler_impl A pointer to the secure key handler implementation that manages cryptographic operations.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered while closing the session.
+ */
+typedef cardano_error_t (*cardano_lock_secure_key_handler_func_t)(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl);
+
+/**
+ * \brief Callback function type for retrieving a precomputed signing key for a BIP32 derivation path.
+ *
+ * The `cardano_bip32_get_signing_context_func_t` typedef defines the signature for a callback function that derives the
+ * key at `derivation_path` and returns it as a \ref cardano_ed25519_signing_context_t, which the caller can keep and use
+ * to sign any number of messages without going through the key handler again.
+ *
+ * \param secure_key_handler_impl A pointer to the secure key handler implementation that manages cryptographic operations.
+ * \param derivation_path The BIP32 derivation path of the signing key.
+ * \param signing_context On success, the signing context. The caller must release it with \ref cardano_ed25519_signing_context_unref.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+typedef cardano_error_t (*cardano_bip32_get_signing_context_func_t)(
+  cardano_secure_key_handler_impl_t*  secure_key_handler_impl,
+  cardano_derivation_path_t           derivation_path,
+  cardano_ed25519_signing_context_t** signing_context);
+
+/**
+ * \brief Callback function type for retrieving a precomputed signing key for the Ed25519 key of the handler.
+ *
+ * \param secure_key_handler_impl A pointer to the secure key handler implementation that manages cryptographic operations.
+ * \param signing_context On success, the signing context. The caller must release it with \ref cardano_ed25519_signing_context_unref.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+typedef cardano_error_t (*cardano_ed25519_get_signing_context_func_t)(
+  cardano_secure_key_handler_impl_t*  secure_key_handler_impl,
+  cardano_ed25519_signing_context_t** signing_context);
+
 /* STRUCTURES ****************************************************************/
 
 /**
@@ -300,6 +392,44 @@ typedef struct cardano_secure_key_handler_impl_t
      * \see cardano_serialize_secure_key_handler_func_t for more details on the function signature.
      */
     cardano_serialize_secure_key_handler_func_t serialize;
+
+    /**
+     * \brief Optional callback function to open an unlocked session.
+     *
+     * \see cardano_unlock_secure_key_handler_func_t for more details on the function signature.
+     */
+    cardano_unlock_secure_key_handler_func_t unlock;
+
+    /**
+     * \brief Optional callback function to close an unlocked session.
+     *
+     * \see cardano_lock_secure_key_handler_func_t for more details on the function signature.
+     */
+    cardano_lock_secure_key_handler_func_t lock;
+
+    /**
+     * \brief Optional callback function to sign several transactions at once using BIP32 keys.
+     *
+     * When NULL, \ref cardano_secure_key_handler_bip32_sign_transactions falls back to calling `bip32_sign_transaction`
+     * once per transaction.
+     *
+     * \see cardano_bip32_sign_transactions_func_t for more details on the function signature.
+     */
+    cardano_bip32_sign_transactions_func_t bip32_sign_transactions;
+
+    /**
+     * \brief Optional callback function to retrieve a precomputed signing key for a BIP32 derivation path.
+     *
+     * \see cardano_bip32_get_signing_context_func_t for more details on the function signature.
+     */
+    cardano_bip32_get_signing_context_func_t bip32_get_signing_context;
+
+    /**
+     * \brief Optional callback function to retrieve a precomputed signing key for the Ed25519 key of the handler.
+     *
+     * \see cardano_ed25519_get_signing_context_func_t for more details on the function signature.
+     */
+    cardano_ed25519_get_signing_context_func_t ed25519_get_signing_context;
 } cardano_secure_key_handler_impl_t;
 
 #ifdef __cplusplus
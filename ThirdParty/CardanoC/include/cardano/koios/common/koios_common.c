@@ -0,0 +1,356 @@
+/**
+ * \file koios_common.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "koios_common.h"
+#include "../../console.h"
+#include "../../utils.h"
+
+#include <cardano/export.h>
+
+#include <cardano/json/json_object.h>
+#include <curl/curl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Gets the libcurl handle of a provider, ready for a new request.
+ *
+ * The handle is created on first use and reset on later ones, which keeps its live connections and its DNS and TLS
+ * session caches for the next request.
+ *
+ * \param[in] provider_impl The provider implementation; the handle is stored in its context.
+ *
+ * \return The handle, or `NULL` if libcurl could not be initialized.
+ */
+static CURL*
+get_curl_handle(cardano_provider_impl_t* provider_impl)
+{
+  koios_context_t* context = (koios_context_t*)provider_impl->context;
+
+  if (context->curl == NULL)
+  {
+    if (curl_global_init(CURL_GLOBAL_DEFAULT) != CURLE_OK)
+    {
+      return NULL;
+    }
+
+    context->curl = curl_easy_init();
+
+    if (context->curl == NULL)
+    {
+      curl_global_cleanup();
+
+      return NULL;
+    }
+  }
+  else
+  {
+    curl_easy_reset(context->curl);
+  }
+
+  CURL* curl = context->curl;
+
+  curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+  curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
+
+#if LIBCURL_VERSION_NUM >= 0x072F00
+  curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+#endif
+
+  return curl;
+}
+
+/**
+ * \brief Builds the request headers of a provider for a content type.
+ *
+ * \param[in] context The provider context.
+ * \param[in] content_type The content type of the request.
+ *
+ * \return The headers, or `NULL` if they could not be built. They must be freed with `curl_slist_free_all()`.
+ */
+static struct curl_slist*
+build_headers(const koios_context_t* context, const cardano_koios_content_type_t content_type)
+{
+  struct curl_slist* headers = curl_slist_append(NULL, "Accept: application/json");
+
+  if (content_type == CARDANO_KOIOS_CONTENT_TYPE_CBOR)
+  {
+    headers = curl_slist_append(headers, "Content-Type: application/cbor");
+  }
+  else
+  {
+    headers = curl_slist_append(headers, "Content-Type: application/json");
+  }
+
+  if (context->api_token_size > 0U)
+  {
+    char authorization[sizeof(context->api_token) + 32U] = { 0 };
+
+    CARDANO_UNUSED(snprintf(authorization, sizeof(authorization), "Authorization: Bearer %.*s", (int)context->api_token_size, context->api_token));
+
+    headers = curl_slist_append(headers, authorization);
+  }
+
+  return headers;
+}
+
+/**
+ * \brief Gets the cached request headers of a provider for a content type.
+ *
+ * \param[in] context The provider context.
+ * \param[in] content_type The content type of the request.
+ *
+ * \return The headers, owned by the context, or `NULL` if they could not be built.
+ */
+static struct curl_slist*
+get_cached_headers(koios_context_t* context, const cardano_koios_content_type_t content_type)
+{
+  const size_t index = (content_type == CARDANO_KOIOS_CONTENT_TYPE_CBOR) ? 1U : 0U;
+
+  if (context->headers[index] == NULL)
+  {
+    context->headers[index] = build_headers(context, content_type);
+  }
+
+  return context->headers[index];
+}
+
+/**
+ * \brief Performs a prepared request and reads its status code.
+ *
+ * \param[in] provider_impl The provider implementation.
+ * \param[in] curl The prepared handle.
+ * \param[out] response_code The HTTP status code of the response.
+ * \param[in,out] response_buffer The response body; released if the request fails.
+ *
+ * \return \ref CARDANO_SUCCESS if a response was received, or \ref CARDANO_ERROR_GENERIC otherwise.
+ */
+static cardano_error_t
+perform_request(
+  cardano_provider_impl_t* provider_impl,
+  CURL*                    curl,
+  uint64_t*                response_code,
+  cardano_buffer_t**       response_buffer)
+{
+  CURLcode res = curl_easy_perform(curl);
+
+  if (res != CURLE_OK)
+  {
+    cardano_utils_set_error_message(provider_impl, curl_easy_strerror(res));
+
+    cardano_buffer_unref(response_buffer);
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  long code = 0;
+  curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &code);
+
+  *response_code = (uint64_t)code;
+
+  return CARDANO_SUCCESS;
+}
+
+/* DEFINITIONS ***************************************************************/
+
+const char*
+cardano_koios_get_network_base_url(const cardano_network_magic_t network)
+{
+  switch (network)
+  {
+    case CARDANO_NETWORK_MAGIC_MAINNET:
+      return "https://api.koios.rest/api/v1/";
+    case CARDANO_NETWORK_MAGIC_PREPROD:
+      return "https://preprod.koios.rest/api/v1/";
+    case CARDANO_NETWORK_MAGIC_PREVIEW:
+      return "https://preview.koios.rest/api/v1/";
+    case CARDANO_NETWORK_MAGIC_SANCHONET:
+      return "https://sancho.koios.rest/api/v1/";
+    default:
+      return NULL;
+  }
+}
+
+char*
+cardano_koios_get_endpoint_url(const koios_context_t* context, const char* endpoint)
+{
+  const size_t base_url_size = cardano_utils_safe_strlen(context->base_url, sizeof(context->base_url));
+  const size_t endpoint_size = cardano_utils_safe_strlen(endpoint, 1024U);
+  const size_t url_size      = base_url_size + endpoint_size + 1U;
+
+  char* url = malloc(url_size);
+
+  if (url == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_utils_safe_memcpy(url, url_size, context->base_url, base_url_size);
+  cardano_utils_safe_memcpy(url + base_url_size, url_size - base_url_size, endpoint, endpoint_size);
+  url[base_url_size + endpoint_size] = '\0';
+
+  return url;
+}
+
+void
+cardano_koios_context_deallocate(void* object)
+{
+  koios_context_t* context = (koios_context_t*)object;
+
+  if (context == NULL)
+  {
+    return;
+  }
+
+  curl_slist_free_all(context->headers[0]);
+  curl_slist_free_all(context->headers[1]);
+
+  if (context->curl != NULL)
+  {
+    curl_easy_cleanup(context->curl);
+    curl_global_cleanup();
+  }
+
+  free(context);
+}
+
+void
+cardano_koios_parse_error(cardano_provider_impl_t* provider, const uint64_t response_code, cardano_buffer_t* buffer)
+{
+  if ((buffer == NULL) || (cardano_buffer_get_size(buffer) == 0U))
+  {
+    CARDANO_UNUSED(snprintf(provider->error_message, 1024, "Koios returned HTTP %lu", (unsigned long)response_code));
+    return;
+  }
+
+  const char*  body      = (const char*)cardano_buffer_get_data(buffer);
+  const size_t body_size = cardano_buffer_get_size(buffer);
+
+  cardano_json_object_t* parsed_json = cardano_json_object_parse(body, body_size);
+  cardano_json_object_t* message     = NULL;
+
+  if ((parsed_json != NULL) && cardano_json_object_get_ex(parsed_json, "message", 7, &message) && (cardano_json_object_get_type(message) == CARDANO_JSON_OBJECT_TYPE_STRING))
+  {
+    size_t message_size = 0U;
+
+    CARDANO_UNUSED(snprintf(provider->error_message, 1024, "%lu - %s", (unsigned long)response_code, cardano_json_object_get_string(message, &message_size)));
+  }
+  else
+  {
+    CARDANO_UNUSED(snprintf(provider->error_message, 1024, "%lu - %.*s", (unsigned long)response_code, (int)body_size, body));
+  }
+
+  cardano_json_object_unref(&parsed_json);
+}
+
+size_t
+cardano_koios_handle_response(void* contents, const size_t size, const size_t count, void* user_provided)
+{
+  const size_t      total_size = size * count;
+  cardano_buffer_t* buffer     = (cardano_buffer_t*)user_provided;
+
+  cardano_error_t result = cardano_buffer_write(buffer, contents, total_size);
+
+  console_debug("Received response of %lu bytes", total_size);
+
+  CARDANO_UNUSED(result);
+
+  return total_size;
+}
+
+cardano_error_t
+cardano_koios_http_get(
+  cardano_provider_impl_t* provider_impl,
+  const char*              url,
+  const size_t             url_size,
+  uint64_t*                response_code,
+  cardano_buffer_t**       response_buffer)
+{
+  CARDANO_UNUSED(url_size);
+
+  koios_context_t* context = (koios_context_t*)provider_impl->context;
+  *response_buffer         = cardano_buffer_new(1024);
+  *response_code           = 0;
+
+  CURL* curl = get_curl_handle(provider_impl);
+
+  if (!curl)
+  {
+    cardano_buffer_unref(response_buffer);
+    cardano_utils_set_error_message(provider_impl, "Failed to initialize libcurl");
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  curl_easy_setopt(curl, CURLOPT_URL, url);
+  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, get_cached_headers(context, CARDANO_KOIOS_CONTENT_TYPE_JSON));
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, cardano_koios_handle_response);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void*)(*response_buffer));
+
+  console_debug("Sending GET request to endpoint: %s", url);
+
+  return perform_request(provider_impl, curl, response_code, response_buffer);
+}
+
+cardano_error_t
+cardano_koios_http_post(
+  cardano_provider_impl_t*           provider_impl,
+  const char*                        url,
+  const size_t                       url_size,
+  const byte_t*                      body,
+  const size_t                       body_size,
+  const cardano_koios_content_type_t content_type,
+  uint64_t*                          response_code,
+  cardano_buffer_t**                 response_buffer)
+{
+  CARDANO_UNUSED(url_size);
+
+  koios_context_t* context = (koios_context_t*)provider_impl->context;
+  *response_buffer         = cardano_buffer_new(1024);
+  *response_code           = 0;
+
+  CURL* curl = get_curl_handle(provider_impl);
+
+  if (!curl)
+  {
+    cardano_buffer_unref(response_buffer);
+    cardano_utils_set_error_message(provider_impl, "Failed to initialize libcurl");
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  curl_easy_setopt(curl, CURLOPT_URL, url);
+  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, get_cached_headers(context, content_type));
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, cardano_koios_handle_response);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void*)(*response_buffer));
+  curl_easy_setopt(curl, CURLOPT_POST, 1L);
+  curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body);
+  curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, (long)body_size);
+
+  console_debug("Sending POST request to endpoint: %s", url);
+
+  return perform_request(provider_impl, curl, response_code, response_buffer);
+}
@@ -0,0 +1,198 @@
+/**
+ * \file koios_common.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_KOIOS_COMMON_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_KOIOS_COMMON_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/common/network_magic.h>
+#include <cardano/providers/provider.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* STRUCTURES ***************************************************************/
+
+/**
+ * \brief A context structure for managing Koios provider details.
+ *
+ * \var network
+ * The Cardano network magic number used to identify the specific network (mainnet, testnet, etc.).
+ *
+ * \var base_url
+ * The base URL of the Koios instance, ending with a slash, e.g. "https://api.koios.rest/api/v1/".
+ *
+ * \var api_token
+ * The optional Koios API token, sent as a bearer token. Empty when the free tier is used.
+ *
+ * \var api_token_size
+ * The size (in bytes) of the token stored in `api_token`.
+ *
+ * \var curl
+ * The libcurl easy handle shared by every request of the provider, or `NULL` until the first request.
+ *
+ * \var headers
+ * The request headers for each \ref cardano_koios_content_type_t, built on first use.
+ */
+typedef struct koios_context_t
+{
+    cardano_object_t        base;
+    cardano_network_magic_t network;
+    char                    base_url[256];
+    char                    api_token[1024];
+    size_t                  api_token_size;
+    void*                   curl;
+    struct curl_slist*      headers[2];
+} koios_context_t;
+
+/* ENUMERATIONS *************************************************************/
+
+/**
+ * \brief Enumerates the content types of the request bodies sent to Koios.
+ */
+typedef enum
+{
+  /**
+   * JSON content type, used by the query endpoints.
+   */
+  CARDANO_KOIOS_CONTENT_TYPE_JSON = 0,
+
+  /**
+   * CBOR content type, used by the transaction submission endpoint.
+   */
+  CARDANO_KOIOS_CONTENT_TYPE_CBOR = 1,
+} cardano_koios_content_type_t;
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Gets the base URL of the public Koios instance of a network.
+ *
+ * \param[in] network The network magic.
+ *
+ * \return The base URL, ending with a slash, or `NULL` if Koios has no public instance for the network.
+ */
+const char*
+cardano_koios_get_network_base_url(cardano_network_magic_t network);
+
+/**
+ * \brief Builds the URL of a Koios endpoint.
+ *
+ * \param[in] context The provider context holding the base URL.
+ * \param[in] endpoint The endpoint path relative to the base URL, including its query string if any.
+ *
+ * \return The URL, which the caller must release with `free`, or `NULL` if memory allocation fails.
+ */
+char*
+cardano_koios_get_endpoint_url(const koios_context_t* context, const char* endpoint);
+
+/**
+ * \brief Releases a Koios context, its libcurl handle and its cached headers.
+ *
+ * This is the deallocator of \ref koios_context_t objects.
+ *
+ * \param[in] object A pointer to the \ref koios_context_t to release.
+ */
+void
+cardano_koios_context_deallocate(void* object);
+
+/**
+ * \brief Extracts the error message of a failed Koios response and stores it in the provider.
+ *
+ * Koios reports query errors as PostgREST JSON objects with a `message` field, and submission errors as the plain
+ * text returned by the node. Both are handled.
+ *
+ * \param[in] provider The provider implementation where the error message will be stored.
+ * \param[in] response_code The HTTP status code of the response.
+ * \param[in] buffer The response body, or `NULL`.
+ */
+void
+cardano_koios_parse_error(cardano_provider_impl_t* provider, uint64_t response_code, cardano_buffer_t* buffer);
+
+/**
+ * \brief libcurl write callback appending the received data to a \ref cardano_buffer_t.
+ *
+ * \param[in] contents      A pointer to the raw data received from the server.
+ * \param[in] size          The size of each data chunk received.
+ * \param[in] count         The number of data chunks received.
+ * \param[in] user_provided The \ref cardano_buffer_t the data is appended to.
+ *
+ * \return The number of bytes processed, `size * count`.
+ */
+size_t
+cardano_koios_handle_response(void* contents, size_t size, size_t count, void* user_provided);
+
+/**
+ * \brief Performs an HTTP GET request against Koios.
+ *
+ * \param[in]  provider_impl   The Koios provider implementation. Must not be `NULL`.
+ * \param[in]  url             The null-terminated URL to request. Must not be `NULL`.
+ * \param[in]  url_size        The size of the URL string in bytes (excluding the null terminator).
+ * \param[out] response_code   The HTTP status code of the response.
+ * \param[out] response_buffer The response body. The caller must release it with \ref cardano_buffer_unref.
+ *
+ * \return \ref CARDANO_SUCCESS if a response was received, whatever its status code, or an error code if the request
+ *         could not be performed.
+ */
+cardano_error_t
+cardano_koios_http_get(
+  cardano_provider_impl_t* provider_impl,
+  const char*              url,
+  size_t                   url_size,
+  uint64_t*                response_code,
+  cardano_buffer_t**       response_buffer);
+
+/**
+ * \brief Performs an HTTP POST request against Koios.
+ *
+ * \param[in]  provider_impl   The Koios provider implementation. Must not be `NULL`.
+ * \param[in]  url             The null-terminated URL to post to. Must not be `NULL`.
+ * \param[in]  url_size        The size of the URL string in bytes (excluding the null terminator).
+ * \param[in]  body            The request body.
+ * \param[in]  body_size       The size of the body in bytes.
+ * \param[in]  content_type    The content type of the body.
+ * \param[out] response_code   The HTTP status code of the response.
+ * \param[out] response_buffer The response body. The caller must release it with \ref cardano_buffer_unref.
+ *
+ * \return \ref CARDANO_SUCCESS if a response was received, whatever its status code, or an error code if the request
+ *         could not be performed.
+ */
+cardano_error_t
+cardano_koios_http_post(
+  cardano_provider_impl_t*     provider_impl,
+  const char*                  url,
+  size_t                       url_size,
+  const byte_t*                body,
+  size_t                       body_size,
+  cardano_koios_content_type_t content_type,
+  uint64_t*                    response_code,
+  cardano_buffer_t**           response_buffer);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_KOIOS_COMMON_H
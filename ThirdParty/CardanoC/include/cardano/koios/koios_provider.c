@@ -0,0 +1,1055 @@
+/**
+ * \file koios_provider.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/json/json_object.h>
+#include <cardano/json/json_writer.h>
+
+#include "koios_provider.h"
+
+#include "../utils.h"
+#include "common/koios_common.h"
+#include "parsers/koios_parsers.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The number of rows requested per page of a UTxO query.
+ *
+ * Koios caps responses at 1000 rows, so a page holding that many rows may be followed by another one.
+ */
+static const size_t KOIOS_PAGE_SIZE = 1000U;
+
+/**
+ * \brief The number of stake addresses sent per `account_info` request.
+ */
+#define KOIOS_ACCOUNT_BATCH_SIZE 100U
+
+/**
+ * \brief The number of datum hashes sent per `datum_info` request.
+ */
+#define KOIOS_DATUM_BATCH_SIZE 100U
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Creates a new Koios context object.
+ *
+ * \return A pointer to the newly created Koios context object, or `NULL` if the operation failed.
+ */
+static koios_context_t*
+cardano_koios_context_new(void)
+{
+  koios_context_t* data = malloc(sizeof(koios_context_t));
+
+  if (data == NULL)
+  {
+    return NULL;
+  }
+
+  data->base.ref_count     = 1;
+  data->base.last_error    = NULL;
+  data->base.deallocator   = cardano_koios_context_deallocate;
+
+  data->network        = CARDANO_NETWORK_MAGIC_PREPROD;
+  data->api_token_size = 0U;
+  data->curl           = NULL;
+  data->headers[0]     = NULL;
+  data->headers[1]     = NULL;
+
+  CARDANO_UNUSED(memset(data->base_url, 0, sizeof(data->base_url)));
+  CARDANO_UNUSED(memset(data->api_token, 0, sizeof(data->api_token)));
+
+  return data;
+}
+
+/**
+ * \brief Posts the JSON written so far by a writer to a Koios endpoint.
+ *
+ * \param[in] provider_impl    The Koios provider implementation.
+ * \param[in] endpoint         The endpoint, relative to the base URL of the instance, query string included.
+ * \param[in] writer           The writer holding a complete JSON document. It is not released.
+ * \param[out] response_code   The HTTP status code of the response.
+ * \param[out] response_buffer The response body. The caller must release it with \ref cardano_buffer_unref.
+ *
+ * \return \ref CARDANO_SUCCESS if a response was received, whatever its status code, or an error code if the body
+ *         could not be encoded or the request could not be performed.
+ */
+static cardano_error_t
+post_json(
+  cardano_provider_impl_t* provider_impl,
+  const char*              endpoint,
+  cardano_json_writer_t*   writer,
+  uint64_t*                response_code,
+  cardano_buffer_t**       response_buffer)
+{
+  koios_context_t* context   = (koios_context_t*)provider_impl->context;
+  const size_t     body_size = cardano_json_writer_get_encoded_size(writer);
+
+  if (body_size == 0U)
+  {
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  char* body = malloc(body_size);
+
+  if (body == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_json_writer_encode(writer, body, body_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    free(body);
+
+    return result;
+  }
+
+  char* url = cardano_koios_get_endpoint_url(context, endpoint);
+
+  if (url == NULL)
+  {
+    free(body);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  result = cardano_koios_http_post(
+    provider_impl,
+    url,
+    cardano_utils_safe_strlen(url, 1024U),
+    (const byte_t*)body,
+    body_size - 1U,
+    CARDANO_KOIOS_CONTENT_TYPE_JSON,
+    response_code,
+    response_buffer);
+
+  free(url);
+  free(body);
+
+  return result;
+}
+
+/**
+ * \brief Runs a paginated Koios UTxO query and collects every unspent row.
+ *
+ * \param[in] provider_impl The Koios provider implementation.
+ * \param[in] endpoint      The endpoint of the query, without query string, e.g. "address_utxos".
+ * \param[in] writer        The writer holding the JSON body of the query, sent unchanged with every page.
+ * \param[out] utxo_list    On success, the unspent outputs of every page. The caller must release the list with
+ *                          \ref cardano_utxo_list_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+query_unspent_outputs(
+  cardano_provider_impl_t* provider_impl,
+  const char*              endpoint,
+  cardano_json_writer_t*   writer,
+  cardano_utxo_list_t**    utxo_list)
+{
+  cardano_error_t result = cardano_utxo_list_new(utxo_list);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  size_t offset    = 0U;
+  size_t row_count = 0U;
+
+  do
+  {
+    char paged_endpoint[128] = { 0 };
+
+    CARDANO_UNUSED(snprintf(paged_endpoint, sizeof(paged_endpoint), "%s?offset=%zu&limit=%zu", endpoint, offset, KOIOS_PAGE_SIZE));
+
+    cardano_buffer_t* response_buffer = NULL;
+    uint64_t          response_code   = 0U;
+
+    result = post_json(provider_impl, paged_endpoint, writer, &response_code, &response_buffer);
+
+    if ((response_code != 200U) || (result != CARDANO_SUCCESS))
+    {
+      cardano_koios_parse_error(provider_impl, response_code, response_buffer);
+
+      cardano_buffer_unref(&response_buffer);
+      cardano_utxo_list_unref(utxo_list);
+
+      return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+    }
+
+    cardano_utxo_list_t* current_list = NULL;
+
+    result = cardano_koios_parse_unspent_outputs(provider_impl, (char*)cardano_buffer_get_data(response_buffer), cardano_buffer_get_size(response_buffer), &current_list, &row_count);
+
+    cardano_buffer_unref(&response_buffer);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_utxo_list_unref(utxo_list);
+
+      return result;
+    }
+
+    cardano_utxo_list_t* tmp_list = *utxo_list;
+
+    *utxo_list = cardano_utxo_list_concat(tmp_list, current_list);
+
+    cardano_utxo_list_unref(&tmp_list);
+    cardano_utxo_list_unref(&current_list);
+
+    if (*utxo_list == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    offset += row_count;
+  }
+  while (row_count == KOIOS_PAGE_SIZE);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Retrieves the protocol parameters of the latest epoch from Koios.
+ *
+ * \param[in] provider_impl  A pointer to the `cardano_provider_impl_t` structure, which contains provider-specific data and logic.
+ * \param[out] parameters    On success, the protocol parameters. The caller must release them with \ref cardano_protocol_parameters_unref.
+ *
+ * \return `CARDANO_SUCCESS` if the parameters were successfully retrieved and parsed; otherwise, an appropriate `cardano_error_t`
+ *         error code is returned, indicating the failure reason (e.g., network errors, parsing errors).
+ */
+static cardano_error_t
+get_parameters(cardano_provider_impl_t* provider_impl, cardano_protocol_parameters_t** parameters)
+{
+  koios_context_t*  context         = (koios_context_t*)provider_impl->context;
+  char*             url             = cardano_koios_get_endpoint_url(context, "epoch_params?limit=1&order=epoch_no.desc");
+  cardano_buffer_t* response_buffer = NULL;
+  uint64_t          response_code   = 0U;
+
+  if (url == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_koios_http_get(provider_impl, url, cardano_utils_safe_strlen(url, 1024U), &response_code, &response_buffer);
+  free(url);
+
+  if ((response_code != 200U) || (result != CARDANO_SUCCESS))
+  {
+    cardano_koios_parse_error(provider_impl, response_code, response_buffer);
+
+    cardano_buffer_unref(&response_buffer);
+
+    return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+  }
+
+  result = cardano_koios_parse_protocol_parameters(provider_impl, (char*)cardano_buffer_get_data(response_buffer), cardano_buffer_get_size(response_buffer), parameters);
+
+  cardano_buffer_unref(&response_buffer);
+
+  return result;
+}
+
+/**
+ * \brief Retrieves the unspent transaction outputs (UTXOs) locked at a given address.
+ *
+ * The outputs are requested in their extended form, so every row carries its assets, datum and reference script and
+ * no additional query is needed per output.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] address A pointer to an initialized \ref cardano_address_t object representing the address to query.
+ *                    This parameter must not be NULL.
+ * \param[out] utxo_list On success, the UTXOs of the address. The caller must release the list with \ref cardano_utxo_list_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+get_unspent_outputs(
+  cardano_provider_impl_t* provider_impl,
+  cardano_address_t*       address,
+  cardano_utxo_list_t**    utxo_list)
+{
+  const char* address_str = cardano_address_get_string(address);
+
+  if (address_str == NULL)
+  {
+    return CARDANO_ERROR_INVALID_ADDRESS_FORMAT;
+  }
+
+  cardano_json_writer_t* writer = cardano_json_writer_new(CARDANO_JSON_FORMAT_COMPACT);
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_json_writer_write_start_object(writer);
+  cardano_json_writer_write_property_name(writer, "_addresses", strlen("_addresses"));
+  cardano_json_writer_write_start_array(writer);
+  cardano_json_writer_write_string(writer, address_str, strlen(address_str));
+  cardano_json_writer_write_end_array(writer);
+  cardano_json_writer_write_property_name(writer, "_extended", strlen("_extended"));
+  cardano_json_writer_write_bool(writer, true);
+  cardano_json_writer_write_end_object(writer);
+
+  cardano_error_t result = query_unspent_outputs(provider_impl, "address_utxos", writer, utxo_list);
+
+  cardano_json_writer_unref(&writer);
+
+  return result;
+}
+
+/**
+ * \brief Retrieves the rewards available to a batch of stake addresses with a single `account_info` request.
+ *
+ * \param[in] provider_impl   A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] stake_addresses The bech32 stake addresses, at most \ref KOIOS_ACCOUNT_BATCH_SIZE of them.
+ * \param[in] address_count   The number of stake addresses.
+ * \param[out] rewards        On success, the rewards (in Lovelace) of each address, in the order of \p stake_addresses.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+query_account_rewards(
+  cardano_provider_impl_t* provider_impl,
+  const char* const*       stake_addresses,
+  const size_t             address_count,
+  uint64_t*                rewards)
+{
+  cardano_json_writer_t* writer = cardano_json_writer_new(CARDANO_JSON_FORMAT_COMPACT);
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_json_writer_write_start_object(writer);
+  cardano_json_writer_write_property_name(writer, "_stake_addresses", strlen("_stake_addresses"));
+  cardano_json_writer_write_start_array(writer);
+
+  for (size_t i = 0U; i < address_count; ++i)
+  {
+    cardano_json_writer_write_string(writer, stake_addresses[i], strlen(stake_addresses[i]));
+  }
+
+  cardano_json_writer_write_end_array(writer);
+  cardano_json_writer_write_end_object(writer);
+
+  cardano_buffer_t* response_buffer = NULL;
+  uint64_t          response_code   = 0U;
+
+  cardano_error_t result = post_json(provider_impl, "account_info", writer, &response_code, &response_buffer);
+
+  cardano_json_writer_unref(&writer);
+
+  if ((response_code != 200U) || (result != CARDANO_SUCCESS))
+  {
+    cardano_koios_parse_error(provider_impl, response_code, response_buffer);
+
+    cardano_buffer_unref(&response_buffer);
+
+    return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+  }
+
+  result = cardano_koios_parse_account_rewards(
+    provider_impl,
+    (char*)cardano_buffer_get_data(response_buffer),
+    cardano_buffer_get_size(response_buffer),
+    stake_addresses,
+    address_count,
+    rewards);
+
+  cardano_buffer_unref(&response_buffer);
+
+  return result;
+}
+
+/**
+ * \brief Retrieves the rewards available to a stake address.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] address The reward address to query. This parameter must not be NULL.
+ * \param[out] rewards On success, the rewards available to the address, in Lovelace.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+get_rewards_balance(cardano_provider_impl_t* provider_impl, cardano_reward_address_t* address, uint64_t* rewards)
+{
+  const char* stake_address = cardano_reward_address_get_string(address);
+
+  if (stake_address == NULL)
+  {
+    return CARDANO_ERROR_INVALID_ADDRESS_FORMAT;
+  }
+
+  return query_account_rewards(provider_impl, &stake_address, 1U, rewards);
+}
+
+/**
+ * \brief Retrieves the rewards available to several stake addresses, \ref KOIOS_ACCOUNT_BATCH_SIZE per request.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] addresses The reward addresses to query. This parameter must not be NULL.
+ * \param[out] rewards On success, the rewards available to each address, in Lovelace, in the order of \p addresses.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+get_rewards_balances(cardano_provider_impl_t* provider_impl, cardano_reward_address_list_t* addresses, uint64_t* rewards)
+{
+  const size_t    count  = cardano_reward_address_list_get_length(addresses);
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  for (size_t first = 0U; (first < count) && (result == CARDANO_SUCCESS); first += KOIOS_ACCOUNT_BATCH_SIZE)
+  {
+    const char*  stake_addresses[KOIOS_ACCOUNT_BATCH_SIZE] = { 0 };
+    const size_t batch_size                                = ((count - first) < KOIOS_ACCOUNT_BATCH_SIZE) ? (count - first) : KOIOS_ACCOUNT_BATCH_SIZE;
+
+    for (size_t i = 0U; (i < batch_size) && (result == CARDANO_SUCCESS); ++i)
+    {
+      cardano_reward_address_t* address = NULL;
+
+      result = cardano_reward_address_list_get(addresses, first + i, &address);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        break;
+      }
+
+      // The list keeps the address, and so its string, alive after this reference is released
+      stake_addresses[i] = cardano_reward_address_get_string(address);
+      cardano_reward_address_unref(&address);
+
+      if (stake_addresses[i] == NULL)
+      {
+        result = CARDANO_ERROR_INVALID_ADDRESS_FORMAT;
+      }
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = query_account_rewards(provider_impl, stake_addresses, batch_size, &rewards[first]);
+    }
+  }
+
+  return result;
+}
+
+/**
+ * \brief Resolves the outputs referenced by a set of transaction inputs.
+ *
+ * Every input is resolved by a single `utxo_info` query. Inputs whose outputs have already been spent are left out
+ * of the result.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] tx_ins The transaction inputs to resolve. This parameter must not be NULL.
+ * \param[out] utxo_list On success, the resolved UTXOs. The caller must release the list with \ref cardano_utxo_list_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+resolve_unspent_outputs(
+  cardano_provider_impl_t*         provider_impl,
+  cardano_transaction_input_set_t* tx_ins,
+  cardano_utxo_list_t**            utxo_list)
+{
+  cardano_json_writer_t* writer = cardano_json_writer_new(CARDANO_JSON_FORMAT_COMPACT);
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_json_writer_write_start_object(writer);
+  cardano_json_writer_write_property_name(writer, "_utxo_refs", strlen("_utxo_refs"));
+  cardano_json_writer_write_start_array(writer);
+
+  for (size_t i = 0U; i < cardano_transaction_input_set_get_length(tx_ins); ++i)
+  {
+    cardano_transaction_input_t* tx_in  = NULL;
+    cardano_error_t              result = cardano_transaction_input_set_get(tx_ins, i, &tx_in);
+    cardano_transaction_input_unref(&tx_in);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_utils_set_error_message(provider_impl, "Failed to get transaction input");
+      cardano_json_writer_unref(&writer);
+
+      return result;
+    }
+
+    cardano_blake2b_hash_t* tx_id = cardano_transaction_input_get_id(tx_in);
+    cardano_blake2b_hash_unref(&tx_id);
+
+    char hash[65] = { 0 };
+    result        = cardano_blake2b_hash_to_hex(tx_id, hash, sizeof(hash));
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_json_writer_unref(&writer);
+
+      return result;
+    }
+
+    char utxo_ref[96] = { 0 };
+
+    CARDANO_UNUSED(snprintf(utxo_ref, sizeof(utxo_ref), "%s#%lu", hash, cardano_transaction_input_get_index(tx_in)));
+
+    cardano_json_writer_write_string(writer, utxo_ref, strlen(utxo_ref));
+  }
+
+  cardano_json_writer_write_end_array(writer);
+  cardano_json_writer_write_property_name(writer, "_extended", strlen("_extended"));
+  cardano_json_writer_write_bool(writer, true);
+  cardano_json_writer_write_end_object(writer);
+
+  cardano_error_t result = query_unspent_outputs(provider_impl, "utxo_info", writer, utxo_list);
+
+  cardano_json_writer_unref(&writer);
+
+  return result;
+}
+
+/**
+ * \brief Resolves datums with a single `datum_info` request.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] datum_hashes The hex hashes of the datums, at most \ref KOIOS_DATUM_BATCH_SIZE of them.
+ * \param[in] hash_count The number of hashes.
+ * \param[out] datums On success, the datum of each hash, in the order of \p datum_hashes.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+query_datums(
+  cardano_provider_impl_t* provider_impl,
+  const char* const*       datum_hashes,
+  const size_t             hash_count,
+  cardano_plutus_data_t**  datums)
+{
+  cardano_json_writer_t* writer = cardano_json_writer_new(CARDANO_JSON_FORMAT_COMPACT);
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_json_writer_write_start_object(writer);
+  cardano_json_writer_write_property_name(writer, "_datum_hashes", strlen("_datum_hashes"));
+  cardano_json_writer_write_start_array(writer);
+
+  for (size_t i = 0U; i < hash_count; ++i)
+  {
+    cardano_json_writer_write_string(writer, datum_hashes[i], strlen(datum_hashes[i]));
+  }
+
+  cardano_json_writer_write_end_array(writer);
+  cardano_json_writer_write_end_object(writer);
+
+  cardano_buffer_t* response_buffer = NULL;
+  uint64_t          response_code   = 0U;
+
+  cardano_error_t result = post_json(provider_impl, "datum_info", writer, &response_code, &response_buffer);
+
+  cardano_json_writer_unref(&writer);
+
+  if ((response_code != 200U) || (result != CARDANO_SUCCESS))
+  {
+    cardano_koios_parse_error(provider_impl, response_code, response_buffer);
+
+    cardano_buffer_unref(&response_buffer);
+
+    return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+  }
+
+  result = cardano_koios_parse_datums(
+    provider_impl,
+    (char*)cardano_buffer_get_data(response_buffer),
+    cardano_buffer_get_size(response_buffer),
+    datum_hashes,
+    hash_count,
+    datums);
+
+  cardano_buffer_unref(&response_buffer);
+
+  return result;
+}
+
+/**
+ * \brief Resolves a datum from its hash.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] datum_hash The hash of the datum. This parameter must not be NULL.
+ * \param[out] datum On success, the datum. The caller must release it with \ref cardano_plutus_data_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+resolve_datum(cardano_provider_impl_t* provider_impl, cardano_blake2b_hash_t* datum_hash, cardano_plutus_data_t** datum)
+{
+  char        hash[65]  = { 0 };
+  const char* hashes[1] = { hash };
+
+  cardano_error_t result = cardano_blake2b_hash_to_hex(datum_hash, hash, sizeof(hash));
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return query_datums(provider_impl, hashes, 1U, datum);
+}
+
+/**
+ * \brief Resolves several datums, \ref KOIOS_DATUM_BATCH_SIZE per request.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] datum_hashes The hashes of the datums. This parameter must not be NULL.
+ * \param[out] datums On success, the datum of each hash, in the order of \p datum_hashes. The caller must release the
+ *                    list with \ref cardano_plutus_list_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+resolve_datums(cardano_provider_impl_t* provider_impl, cardano_blake2b_hash_set_t* datum_hashes, cardano_plutus_list_t** datums)
+{
+  const size_t    count  = cardano_blake2b_hash_set_get_length(datum_hashes);
+  cardano_error_t result = cardano_plutus_list_new(datums);
+
+  for (size_t first = 0U; (first < count) && (result == CARDANO_SUCCESS); first += KOIOS_DATUM_BATCH_SIZE)
+  {
+    char                   hashes[KOIOS_DATUM_BATCH_SIZE][65] = { { 0 } };
+    const char*            hash_ptrs[KOIOS_DATUM_BATCH_SIZE]  = { 0 };
+    cardano_plutus_data_t* batch[KOIOS_DATUM_BATCH_SIZE]      = { 0 };
+    const size_t           batch_size                         = ((count - first) < KOIOS_DATUM_BATCH_SIZE) ? (count - first) : KOIOS_DATUM_BATCH_SIZE;
+
+    for (size_t i = 0U; (i < batch_size) && (result == CARDANO_SUCCESS); ++i)
+    {
+      cardano_blake2b_hash_t* datum_hash = NULL;
+
+      result = cardano_blake2b_hash_set_get(datum_hashes, first + i, &datum_hash);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_blake2b_hash_to_hex(datum_hash, hashes[i], sizeof(hashes[i]));
+      }
+
+      hash_ptrs[i] = hashes[i];
+      cardano_blake2b_hash_unref(&datum_hash);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = query_datums(provider_impl, hash_ptrs, batch_size, batch);
+    }
+
+    for (size_t i = 0U; (i < batch_size) && (result == CARDANO_SUCCESS); ++i)
+    {
+      result = cardano_plutus_list_add(*datums, batch[i]);
+    }
+
+    for (size_t i = 0U; i < batch_size; ++i)
+    {
+      cardano_plutus_data_unref(&batch[i]);
+    }
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_plutus_list_unref(datums);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Awaits confirmation of a transaction on the blockchain within a specified timeout.
+ *
+ * The `tx_status` endpoint is polled until the transaction has at least one confirmation or the timeout is reached.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] tx_id The ID of the transaction to wait for. This parameter must not be NULL.
+ * \param[in] timeout_ms The maximum amount of time, in milliseconds, to wait for the transaction to be confirmed.
+ * \param[out] confirmed Set to \c true if the transaction is confirmed before the timeout, or \c false otherwise.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+await_transaction_confirmation(
+  cardano_provider_impl_t* provider_impl,
+  cardano_blake2b_hash_t*  tx_id,
+  const uint64_t           timeout_ms,
+  bool*                    confirmed)
+{
+  uint64_t remaining_time_ms = timeout_ms;
+  uint64_t start_time_sec    = cardano_utils_get_time();
+  char     hash[65]          = { 0 };
+
+  *confirmed = false;
+
+  cardano_error_t result = cardano_blake2b_hash_to_hex(tx_id, hash, sizeof(hash));
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_json_writer_t* writer = cardano_json_writer_new(CARDANO_JSON_FORMAT_COMPACT);
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_json_writer_write_start_object(writer);
+  cardano_json_writer_write_property_name(writer, "_tx_hashes", strlen("_tx_hashes"));
+  cardano_json_writer_write_start_array(writer);
+  cardano_json_writer_write_string(writer, hash, strlen(hash));
+  cardano_json_writer_write_end_array(writer);
+  cardano_json_writer_write_end_object(writer);
+
+  do
+  {
+    uint64_t elapsed_time_ms = cardano_utils_get_elapsed_time_since(start_time_sec) * 1000U;
+
+    remaining_time_ms = (elapsed_time_ms >= timeout_ms) ? 0U : (timeout_ms - elapsed_time_ms);
+
+    cardano_buffer_t* response_buffer = NULL;
+    uint64_t          response_code   = 0U;
+
+    result = post_json(provider_impl, "tx_status", writer, &response_code, &response_buffer);
+
+    if ((response_code != 200U) || (result != CARDANO_SUCCESS))
+    {
+      cardano_koios_parse_error(provider_impl, response_code, response_buffer);
+
+      cardano_buffer_unref(&response_buffer);
+      cardano_json_writer_unref(&writer);
+
+      return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+    }
+
+    result = cardano_koios_parse_tx_status(provider_impl, (char*)cardano_buffer_get_data(response_buffer), cardano_buffer_get_size(response_buffer), confirmed);
+
+    cardano_buffer_unref(&response_buffer);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_json_writer_unref(&writer);
+
+      return result;
+    }
+
+    if (!(*confirmed) && (remaining_time_ms > 0U))
+    {
+      uint64_t sleep_time_ms = (remaining_time_ms > 20000U) ? 20000U : remaining_time_ms;
+      cardano_utils_sleep(sleep_time_ms);
+    }
+  }
+  while (!(*confirmed) && (remaining_time_ms > 0U));
+
+  cardano_json_writer_unref(&writer);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Submits a signed transaction through the `submittx` endpoint of Koios.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object. This parameter must not be NULL.
+ * \param[in] tx The signed transaction to submit. This parameter must not be NULL.
+ * \param[out] tx_id On success, the ID of the submitted transaction. The caller must release it with \ref cardano_blake2b_hash_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation.
+ */
+static cardano_error_t
+post_transaction_to_chain(
+  cardano_provider_impl_t* provider_impl,
+  cardano_transaction_t*   tx,
+  cardano_blake2b_hash_t** tx_id)
+{
+  koios_context_t*       context = (koios_context_t*)provider_impl->context;
+  cardano_cbor_writer_t* writer  = cardano_cbor_writer_new();
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_transaction_to_cbor(tx, writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_cbor_writer_unref(&writer);
+
+    return result;
+  }
+
+  const size_t cbor_size = cardano_cbor_writer_get_encode_size(writer);
+  byte_t*      cbor_data = malloc(cbor_size);
+
+  if (cbor_data == NULL)
+  {
+    cardano_cbor_writer_unref(&writer);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  result = cardano_cbor_writer_encode(writer, cbor_data, cbor_size);
+  cardano_cbor_writer_unref(&writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    free(cbor_data);
+
+    return result;
+  }
+
+  char* url = cardano_koios_get_endpoint_url(context, "submittx");
+
+  if (url == NULL)
+  {
+    free(cbor_data);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_buffer_t* response_buffer = NULL;
+  uint64_t          response_code   = 0U;
+
+  result = cardano_koios_http_post(
+    provider_impl,
+    url,
+    cardano_utils_safe_strlen(url, 1024U),
+    cbor_data,
+    cbor_size,
+    CARDANO_KOIOS_CONTENT_TYPE_CBOR,
+    &response_code,
+    &response_buffer);
+
+  free(url);
+  free(cbor_data);
+
+  if (((response_code != 200U) && (response_code != 202U)) || (result != CARDANO_SUCCESS))
+  {
+    cardano_koios_parse_error(provider_impl, response_code, response_buffer);
+
+    cardano_buffer_unref(&response_buffer);
+
+    return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+  }
+
+  cardano_json_object_t* parsed_json = cardano_json_object_parse((char*)cardano_buffer_get_data(response_buffer), (int32_t)cardano_buffer_get_size(response_buffer));
+
+  cardano_buffer_unref(&response_buffer);
+
+  if (parsed_json == NULL)
+  {
+    cardano_utils_set_error_message(provider_impl, "Failed to parse JSON response");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  if (cardano_json_object_get_type(parsed_json) != CARDANO_JSON_OBJECT_TYPE_STRING)
+  {
+    cardano_json_object_unref(&parsed_json);
+
+    cardano_utils_set_error_message(provider_impl, "Invalid JSON response");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  size_t      hex_len    = 0U;
+  const char* hex_string = cardano_json_object_get_string(parsed_json, &hex_len);
+
+  result = cardano_blake2b_hash_from_hex(hex_string, hex_len - 1U, tx_id);
+
+  cardano_json_object_unref(&parsed_json);
+
+  return result;
+}
+
+/**
+ * \brief Evaluates the scripts of a transaction through the Ogmios endpoint of Koios.
+ *
+ * \param[in] provider_impl A pointer to an initialized \ref cardano_provider_impl_t object representing the provider. This must not be NULL.
+ * \param[in] tx The transaction to evaluate. This must not be NULL.
+ * \param[in] additional_utxos The outputs spent or referenced by the transaction that the node may not know about yet.
+ *                             May be NULL.
+ * \param[out] redeemers On success, a copy of the redeemers of the transaction with their execution units set to the
+ *                       evaluated budgets. The caller must release it with \ref cardano_redeemer_list_unref.
+ *
+ * \return \ref cardano_error_t indicating the outcome of the operation. Returns \ref CARDANO_ERROR_SCRIPT_EVALUATION_FAILURE
+ *         if a script failed, with the reason available through \ref cardano_provider_get_last_error.
+ */
+static cardano_error_t
+evaluate_transaction(
+  cardano_provider_impl_t*  provider_impl,
+  cardano_transaction_t*    tx,
+  cardano_utxo_list_t*      additional_utxos,
+  cardano_redeemer_list_t** redeemers)
+{
+  cardano_witness_set_t* witness_set = cardano_transaction_get_witness_set(tx);
+  cardano_witness_set_unref(&witness_set);
+
+  if (witness_set == NULL)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  cardano_redeemer_list_t* original_redeemers = cardano_witness_set_get_redeemers(witness_set);
+  cardano_redeemer_list_unref(&original_redeemers);
+
+  if (original_redeemers == NULL)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  koios_context_t* context      = (koios_context_t*)provider_impl->context;
+  char*            json_payload = NULL;
+  size_t           json_size    = 0U;
+  cardano_error_t  result       = cardano_koios_evaluate_params_to_json(tx, additional_utxos, &json_payload, &json_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  char* url = cardano_koios_get_endpoint_url(context, "ogmios");
+
+  if (url == NULL)
+  {
+    free(json_payload);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_buffer_t* response_buffer = NULL;
+  uint64_t          response_code   = 0U;
+
+  result = cardano_koios_http_post(
+    provider_impl,
+    url,
+    cardano_utils_safe_strlen(url, 1024U),
+    (byte_t*)json_payload,
+    json_size,
+    CARDANO_KOIOS_CONTENT_TYPE_JSON,
+    &response_code,
+    &response_buffer);
+
+  free(url);
+  free(json_payload);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_buffer_unref(&response_buffer);
+
+    return CARDANO_ERROR_INVALID_HTTP_REQUEST;
+  }
+
+  // Ogmios reports script failures as a JSON-RPC error with a 4xx status, so the body is parsed whatever the status.
+  result = cardano_koios_parse_tx_eval_response(provider_impl, (char*)cardano_buffer_get_data(response_buffer), cardano_buffer_get_size(response_buffer), original_redeemers, redeemers);
+
+  if ((result == CARDANO_ERROR_INVALID_JSON) && (response_code != 200U))
+  {
+    cardano_koios_parse_error(provider_impl, response_code, response_buffer);
+
+    result = CARDANO_ERROR_INVALID_HTTP_REQUEST;
+  }
+
+  cardano_buffer_unref(&response_buffer);
+
+  return result;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+create_koios_provider(
+  const cardano_network_magic_t network,
+  const char*                   api_token,
+  const size_t                  api_token_size,
+  cardano_provider_t**          provider)
+{
+  if (provider == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const char* base_url = cardano_koios_get_network_base_url(network);
+
+  if (base_url == NULL)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  if ((api_token != NULL) && (api_token_size >= 1024U))
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  cardano_provider_impl_t impl = { 0 };
+
+  CARDANO_UNUSED(snprintf(impl.name, 256, "koios-%s", cardano_network_magic_to_string(network)));
+
+  koios_context_t* context = cardano_koios_context_new();
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_utils_safe_memcpy(context->base_url, sizeof(context->base_url), base_url, cardano_utils_safe_strlen(base_url, sizeof(context->base_url) - 1U));
+
+  if (api_token != NULL)
+  {
+    cardano_utils_safe_memcpy(context->api_token, sizeof(context->api_token), api_token, api_token_size);
+    context->api_token_size = api_token_size;
+  }
+
+  context->network = network;
+
+  impl.get_parameters                 = get_parameters;
+  impl.get_unspent_outputs            = get_unspent_outputs;
+  impl.get_rewards_balance            = get_rewards_balance;
+  impl.get_rewards_balances           = get_rewards_balances;
+  impl.resolve_unspent_outputs        = resolve_unspent_outputs;
+  impl.resolve_datum                  = resolve_datum;
+  impl.resolve_datums                 = resolve_datums;
+  impl.await_transaction_confirmation = await_transaction_confirmation;
+  impl.post_transaction_to_chain      = post_transaction_to_chain;
+  impl.evaluate_transaction           = evaluate_transaction;
+  impl.network_magic                  = network;
+
+  impl.context = (cardano_object_t*)context;
+
+  return cardano_provider_new(impl, provider);
+}
@@ -0,0 +1,65 @@
+/**
+ * \file koios_provider.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_KOIOS_PROVIDER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_KOIOS_PROVIDER_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/common/network_magic.h>
+#include <cardano/error.h>
+#include <cardano/providers/provider.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Creates a \ref cardano_provider_t backed by the public Koios instance of a network.
+ *
+ * The provider implements the parameter, UTxO, rewards, datum, submission, evaluation and confirmation queries. UTxOs
+ * are requested in their extended form and decoded straight into \ref cardano_utxo_list_t, so they can be handed to
+ * the transaction builder as they are. Rewards of many stake addresses are read with one `account_info` request per
+ * hundred addresses, and datums with one `datum_info` request per hundred hashes. Scripts are evaluated through the
+ * Ogmios endpoint of the instance.
+ *
+ * \param[in] network        The network to connect to.
+ * \param[in] api_token      The Koios API token, sent as a bearer token. May be `NULL` to use the free tier.
+ * \param[in] api_token_size The size of the token in bytes, excluding the null terminator.
+ * \param[out] provider      On success, the new provider. The caller must release it with \ref cardano_provider_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ARGUMENT if the network has no public Koios
+ *         instance or the token is too long, or another error code on failure.
+ */
+cardano_error_t
+create_koios_provider(
+  cardano_network_magic_t network,
+  const char*             api_token,
+  size_t                  api_token_size,
+  cardano_provider_t**    provider);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_KOIOS_PROVIDER_H
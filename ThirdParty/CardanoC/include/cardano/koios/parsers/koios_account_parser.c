@@ -0,0 +1,140 @@
+/**
+ * \file koios_account_parser.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/json/json_object.h>
+
+#include "koios_parsers.h"
+#include "../../utils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Reads the Lovelace amount Koios encodes as a decimal string.
+ *
+ * \param[in] object The JSON value.
+ * \param[out] quantity The amount.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_INVALID_JSON if the value is not a valid amount.
+ */
+static cardano_error_t
+parse_lovelace(cardano_json_object_t* object, uint64_t* quantity)
+{
+  if (cardano_json_object_get_type(object) == CARDANO_JSON_OBJECT_TYPE_NUMBER)
+  {
+    return cardano_json_object_get_uint(object, quantity);
+  }
+
+  if (cardano_json_object_get_type(object) != CARDANO_JSON_OBJECT_TYPE_STRING)
+  {
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  size_t      length = 0U;
+  const char* string = cardano_json_object_get_string(object, &length);
+
+  if ((string == NULL) || (length <= 1U))
+  {
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  char*                    end   = NULL;
+  const unsigned long long value = strtoull(string, &end, 10);
+
+  if ((end == NULL) || (*end != '\0') || (string[0] == '-'))
+  {
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  *quantity = (uint64_t)value;
+
+  return CARDANO_SUCCESS;
+}
+
+/* IMPLEMENTATION *************************************************************/
+
+cardano_error_t
+cardano_koios_parse_account_rewards(
+  cardano_provider_impl_t* provider,
+  const char*              json,
+  const size_t             size,
+  const char* const*       stake_addresses,
+  const size_t             address_count,
+  uint64_t*                rewards)
+{
+  cardano_json_object_t* parsed_json = cardano_json_object_parse(json, size);
+
+  if ((parsed_json == NULL) || (cardano_json_object_get_type(parsed_json) != CARDANO_JSON_OBJECT_TYPE_ARRAY))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+    cardano_json_object_unref(&parsed_json);
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  // Koios leaves out the accounts it has never seen, such as unregistered stake keys
+  for (size_t i = 0U; i < address_count; ++i)
+  {
+    rewards[i] = 0U;
+  }
+
+  const size_t row_count = cardano_json_object_array_get_length(parsed_json);
+
+  for (size_t i = 0U; i < row_count; ++i)
+  {
+    cardano_json_object_t* row       = cardano_json_object_array_get_ex(parsed_json, i);
+    cardano_json_object_t* address   = NULL;
+    cardano_json_object_t* available = NULL;
+    uint64_t               amount    = 0U;
+
+    if ((row == NULL) || !cardano_json_object_get_ex(row, "stake_address", 13, &address) || (cardano_json_object_get_type(address) != CARDANO_JSON_OBJECT_TYPE_STRING))
+    {
+      continue;
+    }
+
+    if (!cardano_json_object_get_ex(row, "rewards_available", 17, &available) || (parse_lovelace(available, &amount) != CARDANO_SUCCESS))
+    {
+      cardano_utils_set_error_message(provider, "Invalid rewards_available in account_info response");
+      cardano_json_object_unref(&parsed_json);
+
+      return CARDANO_ERROR_INVALID_JSON;
+    }
+
+    const char* stake_address = cardano_json_object_get_string(address, NULL);
+
+    // Rows come in no guaranteed order and a list may repeat an address, so every match is filled
+    for (size_t j = 0U; j < address_count; ++j)
+    {
+      if (strcmp(stake_addresses[j], stake_address) == 0)
+      {
+        rewards[j] = amount;
+      }
+    }
+  }
+
+  cardano_json_object_unref(&parsed_json);
+
+  return CARDANO_SUCCESS;
+}
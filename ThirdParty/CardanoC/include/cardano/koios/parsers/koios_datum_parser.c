@@ -0,0 +1,132 @@
+/**
+ * \file koios_datum_parser.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/cbor/cbor_reader.h>
+#include <cardano/json/json_object.h>
+
+#include "koios_parsers.h"
+#include "../../utils.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* IMPLEMENTATION *************************************************************/
+
+cardano_error_t
+cardano_koios_parse_datums(
+  cardano_provider_impl_t* provider,
+  const char*              json,
+  const size_t             size,
+  const char* const*       datum_hashes,
+  const size_t             hash_count,
+  cardano_plutus_data_t**  datums)
+{
+  cardano_json_object_t* parsed_json = cardano_json_object_parse(json, size);
+
+  if ((parsed_json == NULL) || (cardano_json_object_get_type(parsed_json) != CARDANO_JSON_OBJECT_TYPE_ARRAY))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+    cardano_json_object_unref(&parsed_json);
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  for (size_t i = 0U; i < hash_count; ++i)
+  {
+    datums[i] = NULL;
+  }
+
+  cardano_error_t result    = CARDANO_SUCCESS;
+  const size_t    row_count = cardano_json_object_array_get_length(parsed_json);
+
+  for (size_t i = 0U; (i < row_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_json_object_t* row   = cardano_json_object_array_get_ex(parsed_json, i);
+    cardano_json_object_t* hash  = NULL;
+    cardano_json_object_t* bytes = NULL;
+
+    if ((row == NULL) || !cardano_json_object_get_ex(row, "datum_hash", 10, &hash) || (cardano_json_object_get_type(hash) != CARDANO_JSON_OBJECT_TYPE_STRING))
+    {
+      continue;
+    }
+
+    if (!cardano_json_object_get_ex(row, "bytes", 5, &bytes) || (cardano_json_object_get_type(bytes) != CARDANO_JSON_OBJECT_TYPE_STRING))
+    {
+      cardano_utils_set_error_message(provider, "Invalid bytes in datum_info response");
+      result = CARDANO_ERROR_INVALID_JSON;
+
+      break;
+    }
+
+    const char* datum_hash = cardano_json_object_get_string(hash, NULL);
+    size_t      cbor_size  = 0U;
+    const char* cbor_hex   = cardano_json_object_get_string(bytes, &cbor_size);
+
+    for (size_t j = 0U; (j < hash_count) && (result == CARDANO_SUCCESS); ++j)
+    {
+      if ((datums[j] != NULL) || (strcmp(datum_hashes[j], datum_hash) != 0))
+      {
+        continue;
+      }
+
+      cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(cbor_hex, cbor_size - 1U);
+
+      if (reader == NULL)
+      {
+        result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+
+        break;
+      }
+
+      result = cardano_plutus_data_from_cbor(reader, &datums[j]);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        cardano_utils_set_error_message(provider, "Invalid datum CBOR in datum_info response");
+      }
+
+      cardano_cbor_reader_unref(&reader);
+    }
+  }
+
+  cardano_json_object_unref(&parsed_json);
+
+  for (size_t i = 0U; (i < hash_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    if (datums[i] == NULL)
+    {
+      CARDANO_UNUSED(snprintf(provider->error_message, 1024, "Datum %s not found", datum_hashes[i]));
+      result = CARDANO_ERROR_ELEMENT_NOT_FOUND;
+    }
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    for (size_t i = 0U; i < hash_count; ++i)
+    {
+      cardano_plutus_data_unref(&datums[i]);
+    }
+  }
+
+  return result;
+}
@@ -0,0 +1,189 @@
+/**
+ * \file koios_parsers.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_KOIOS_PARSERS_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_KOIOS_PARSERS_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/providers/provider_impl.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Parses the protocol parameters from a Koios `epoch_params` response.
+ *
+ * The response is an array of epoch rows; the first row is used.
+ *
+ * \param[in] provider     The provider implementation used for error reporting.
+ * \param[in] json         The raw JSON response.
+ * \param[in] size         The size of the JSON string.
+ * \param[out] parameters  On success, the parsed protocol parameters. The caller must release them with
+ *                         \ref cardano_protocol_parameters_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+cardano_error_t
+cardano_koios_parse_protocol_parameters(
+  cardano_provider_impl_t*        provider,
+  const char*                     json,
+  size_t                          size,
+  cardano_protocol_parameters_t** parameters);
+
+/**
+ * \brief Parses the unspent outputs of a Koios `address_utxos` or `utxo_info` response.
+ *
+ * The rows must have been requested with `_extended` set, so they carry their assets, datum and reference script.
+ * Each row is decoded straight into a \ref cardano_utxo_t; rows flagged as spent are skipped.
+ *
+ * \param[in] provider   The provider implementation used for error reporting.
+ * \param[in] json       The raw JSON response.
+ * \param[in] size       The size of the JSON string.
+ * \param[out] utxo_list On success, the unspent outputs. The caller must release the list with \ref cardano_utxo_list_unref.
+ * \param[out] row_count On success, the number of rows in the response, spent ones included, so the caller can tell
+ *                       whether more pages follow. May be `NULL`.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+cardano_error_t
+cardano_koios_parse_unspent_outputs(
+  cardano_provider_impl_t* provider,
+  const char*              json,
+  size_t                   size,
+  cardano_utxo_list_t**    utxo_list,
+  size_t*                  row_count);
+
+/**
+ * \brief Reads whether a transaction of a Koios `tx_status` response has been included in a block.
+ *
+ * \param[in] provider   The provider implementation used for error reporting.
+ * \param[in] json       The raw JSON response.
+ * \param[in] size       The size of the JSON string.
+ * \param[out] confirmed Set to `true` if the first row has at least one confirmation.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+cardano_error_t
+cardano_koios_parse_tx_status(
+  cardano_provider_impl_t* provider,
+  const char*              json,
+  size_t                   size,
+  bool*                    confirmed);
+
+/**
+ * \brief Reads the rewards available to each stake address of a Koios `account_info` response.
+ *
+ * Rows are matched to the requested addresses by `stake_address`; an address without a row, such as a stake key
+ * that was never registered, gets 0.
+ *
+ * \param[in] provider        The provider implementation used for error reporting.
+ * \param[in] json            The raw JSON response.
+ * \param[in] size            The size of the JSON string.
+ * \param[in] stake_addresses The bech32 stake addresses the request was made for.
+ * \param[in] address_count   The number of entries of \p stake_addresses.
+ * \param[out] rewards        On success, the rewards (in Lovelace) of each address, in the order of \p stake_addresses.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+cardano_error_t
+cardano_koios_parse_account_rewards(
+  cardano_provider_impl_t* provider,
+  const char*              json,
+  size_t                   size,
+  const char* const*       stake_addresses,
+  size_t                   address_count,
+  uint64_t*                rewards);
+
+/**
+ * \brief Reads the datums of a Koios `datum_info` response.
+ *
+ * Rows are matched to the requested hashes by `datum_hash`, and their `bytes` decoded as Plutus data.
+ *
+ * \param[in] provider     The provider implementation used for error reporting.
+ * \param[in] json         The raw JSON response.
+ * \param[in] size         The size of the JSON string.
+ * \param[in] datum_hashes The hex hashes the request was made for.
+ * \param[in] hash_count   The number of entries of \p datum_hashes.
+ * \param[out] datums      On success, the datum of each hash, in the order of \p datum_hashes. The caller must release
+ *                         each with \ref cardano_plutus_data_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if a hash has no row, or another error
+ *         code on failure.
+ */
+cardano_error_t
+cardano_koios_parse_datums(
+  cardano_provider_impl_t* provider,
+  const char*              json,
+  size_t                   size,
+  const char* const*       datum_hashes,
+  size_t                   hash_count,
+  cardano_plutus_data_t**  datums);
+
+/**
+ * \brief Serializes an Ogmios `evaluateTransaction` JSON-RPC request, as accepted by the Koios `ogmios` endpoint.
+ *
+ * \param[in] transaction The transaction to evaluate.
+ * \param[in] utxos       Additional unspent outputs the evaluation needs, or `NULL`.
+ * \param[out] json       On success, the null-terminated request body. The caller must release it with `free`.
+ * \param[out] json_size  On success, the size of the body, excluding the null terminator.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+cardano_error_t
+cardano_koios_evaluate_params_to_json(
+  cardano_transaction_t* transaction,
+  cardano_utxo_list_t*   utxos,
+  char**                 json,
+  size_t*                json_size);
+
+/**
+ * \brief Parses an Ogmios `evaluateTransaction` JSON-RPC response and sets the execution units of the redeemers.
+ *
+ * \param[in] provider           The provider implementation used for error reporting.
+ * \param[in] json               The raw JSON response.
+ * \param[in] size               The size of the JSON string.
+ * \param[in] original_redeemers The redeemers of the evaluated transaction.
+ * \param[out] redeemers         On success, a copy of \p original_redeemers with the evaluated execution units. The
+ *                               caller must release it with \ref cardano_redeemer_list_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_SCRIPT_EVALUATION_FAILURE if a script failed, or another
+ *         error code on failure.
+ */
+cardano_error_t
+cardano_koios_parse_tx_eval_response(
+  cardano_provider_impl_t*  provider,
+  const char*               json,
+  size_t                    size,
+  cardano_redeemer_list_t*  original_redeemers,
+  cardano_redeemer_list_t** redeemers);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_KOIOS_PARSERS_H
@@ -0,0 +1,64 @@
+/**
+ * \file koios_tx_status_parser.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/json/json_object.h>
+
+#include "koios_parsers.h"
+#include "../../utils.h"
+
+/* IMPLEMENTATION *************************************************************/
+
+cardano_error_t
+cardano_koios_parse_tx_status(
+  cardano_provider_impl_t* provider,
+  const char*              json,
+  const size_t             size,
+  bool*                    confirmed)
+{
+  cardano_json_object_t* parsed_json = cardano_json_object_parse(json, size);
+
+  *confirmed = false;
+
+  if ((parsed_json == NULL) || (cardano_json_object_get_type(parsed_json) != CARDANO_JSON_OBJECT_TYPE_ARRAY))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+    cardano_json_object_unref(&parsed_json);
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_json_object_t* row           = cardano_json_object_array_get_ex(parsed_json, 0U);
+  cardano_json_object_t* confirmations = NULL;
+
+  // Koios reports a null confirmation count for transactions it has not seen in a block yet.
+  if ((row != NULL) && cardano_json_object_get_ex(row, "num_confirmations", 17, &confirmations) && (cardano_json_object_get_type(confirmations) == CARDANO_JSON_OBJECT_TYPE_NUMBER))
+  {
+    uint64_t count = 0U;
+
+    *confirmed = (cardano_json_object_get_uint(confirmations, &count) == CARDANO_SUCCESS) && (count > 0U);
+  }
+
+  cardano_json_object_unref(&parsed_json);
+
+  return CARDANO_SUCCESS;
+}
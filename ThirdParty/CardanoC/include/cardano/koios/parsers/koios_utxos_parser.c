@@ -0,0 +1,581 @@
+/**
+ * \file koios_utxos_parser.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/address/address_cache.h>
+#include <cardano/json/json_object.h>
+
+#include "koios_parsers.h"
+#include "../../utils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Gets a string property of a JSON object.
+ *
+ * \param[in] object The JSON object.
+ * \param[in] key The property name.
+ * \param[out] size The length of the string, excluding the null terminator.
+ *
+ * \return The string, or `NULL` if the property is missing, null or not a string.
+ */
+static const char*
+get_string_property(cardano_json_object_t* object, const char* key, size_t* size)
+{
+  cardano_json_object_t* value = NULL;
+
+  *size = 0U;
+
+  if (!cardano_json_object_get_ex(object, key, strlen(key), &value) || (cardano_json_object_get_type(value) != CARDANO_JSON_OBJECT_TYPE_STRING))
+  {
+    return NULL;
+  }
+
+  size_t      length = 0U;
+  const char* string = cardano_json_object_get_string(value, &length);
+
+  if ((string == NULL) || (length == 0U))
+  {
+    return NULL;
+  }
+
+  *size = length - 1U;
+
+  return string;
+}
+
+/**
+ * \brief Reads an unsigned quantity that Koios encodes either as a JSON number or as a decimal string.
+ *
+ * \param[in] object The JSON value.
+ * \param[out] quantity The quantity.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_INVALID_JSON if the value is not a valid quantity.
+ */
+static cardano_error_t
+parse_quantity(cardano_json_object_t* object, uint64_t* quantity)
+{
+  if (cardano_json_object_get_type(object) == CARDANO_JSON_OBJECT_TYPE_NUMBER)
+  {
+    return cardano_json_object_get_uint(object, quantity);
+  }
+
+  if (cardano_json_object_get_type(object) != CARDANO_JSON_OBJECT_TYPE_STRING)
+  {
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  size_t      length = 0U;
+  const char* string = cardano_json_object_get_string(object, &length);
+
+  if ((string == NULL) || (length <= 1U))
+  {
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  char*                    end   = NULL;
+  const unsigned long long value = strtoull(string, &end, 10);
+
+  if ((end == NULL) || (*end != '\0') || (string[0] == '-'))
+  {
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  *quantity = (uint64_t)value;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Builds the value of a UTxO row out of its `value` and `asset_list` properties.
+ *
+ * \param[in] provider The provider implementation used for error reporting.
+ * \param[in] row The UTxO row.
+ * \param[out] value On success, the value of the output.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+parse_value(cardano_provider_impl_t* provider, cardano_json_object_t* row, cardano_value_t** value)
+{
+  cardano_json_object_t* lovelace_obj = NULL;
+  uint64_t               lovelace     = 0U;
+
+  if (!cardano_json_object_get_ex(row, "value", 5, &lovelace_obj) || (parse_quantity(lovelace_obj, &lovelace) != CARDANO_SUCCESS))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse value from JSON response");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  *value = cardano_value_new_zero();
+
+  if (*value == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_value_set_coin(*value, (int64_t)lovelace);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_value_unref(value);
+
+    return result;
+  }
+
+  cardano_json_object_t* asset_list = NULL;
+
+  if (!cardano_json_object_get_ex(row, "asset_list", 10, &asset_list) || (cardano_json_object_get_type(asset_list) != CARDANO_JSON_OBJECT_TYPE_ARRAY))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  const size_t asset_count = cardano_json_object_array_get_length(asset_list);
+
+  for (size_t i = 0U; i < asset_count; ++i)
+  {
+    cardano_json_object_t* asset = cardano_json_object_array_get_ex(asset_list, i);
+
+    size_t      policy_id_size  = 0U;
+    size_t      asset_name_size = 0U;
+    const char* policy_id       = get_string_property(asset, "policy_id", &policy_id_size);
+    const char* asset_name      = get_string_property(asset, "asset_name", &asset_name_size);
+
+    cardano_json_object_t* quantity_obj = NULL;
+    uint64_t               quantity     = 0U;
+
+    if ((policy_id == NULL) || !cardano_json_object_get_ex(asset, "quantity", 8, &quantity_obj) || (parse_quantity(quantity_obj, &quantity) != CARDANO_SUCCESS))
+    {
+      cardano_utils_set_error_message(provider, "Failed to parse asset_list from JSON response");
+      cardano_value_unref(value);
+
+      return CARDANO_ERROR_INVALID_JSON;
+    }
+
+    result = cardano_value_add_asset_ex(*value, policy_id, policy_id_size, (asset_name != NULL) ? asset_name : "", asset_name_size, (int64_t)quantity);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_utils_set_error_message(provider, "Failed to add asset to UTxO value");
+      cardano_value_unref(value);
+
+      return result;
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Builds the datum of a UTxO row, preferring its inline datum over its datum hash.
+ *
+ * \param[in] provider The provider implementation used for error reporting.
+ * \param[in] row The UTxO row.
+ * \param[out] datum On success, the datum of the output, or `NULL` if it has none.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+parse_datum(cardano_provider_impl_t* provider, cardano_json_object_t* row, cardano_datum_t** datum)
+{
+  cardano_json_object_t* inline_datum = NULL;
+  cardano_error_t        result       = CARDANO_SUCCESS;
+
+  *datum = NULL;
+
+  if (cardano_json_object_get_ex(row, "inline_datum", 12, &inline_datum) && (cardano_json_object_get_type(inline_datum) == CARDANO_JSON_OBJECT_TYPE_OBJECT))
+  {
+    size_t      bytes_size = 0U;
+    const char* bytes      = get_string_property(inline_datum, "bytes", &bytes_size);
+
+    if (bytes == NULL)
+    {
+      cardano_utils_set_error_message(provider, "Failed to parse inline_datum from JSON response");
+
+      return CARDANO_ERROR_INVALID_JSON;
+    }
+
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(bytes, bytes_size);
+
+    if (reader == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    cardano_plutus_data_t* plutus_data = NULL;
+    result                             = cardano_plutus_data_from_cbor(reader, &plutus_data);
+    cardano_cbor_reader_unref(&reader);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_utils_set_error_message(provider, "Failed to decode inline_datum from JSON response");
+
+      return result;
+    }
+
+    result = cardano_datum_new_inline_data(plutus_data, datum);
+    cardano_plutus_data_unref(&plutus_data);
+
+    return result;
+  }
+
+  size_t      data_hash_size = 0U;
+  const char* data_hash      = get_string_property(row, "datum_hash", &data_hash_size);
+
+  if (data_hash == NULL)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_blake2b_hash_t* hash = NULL;
+  result                       = cardano_blake2b_hash_from_hex(data_hash, data_hash_size, &hash);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse datum_hash from JSON response");
+
+    return result;
+  }
+
+  result = cardano_datum_new_data_hash(hash, datum);
+  cardano_blake2b_hash_unref(&hash);
+
+  return result;
+}
+
+/**
+ * \brief Builds the reference script of a UTxO row out of its `reference_script` property.
+ *
+ * Koios embeds the script bytes in the row, so no further request is needed, unlike Blockfrost.
+ *
+ * \param[in] provider The provider implementation used for error reporting.
+ * \param[in] row The UTxO row.
+ * \param[out] script On success, the reference script of the output, or `NULL` if it has none.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+parse_reference_script(cardano_provider_impl_t* provider, cardano_json_object_t* row, cardano_script_t** script)
+{
+  cardano_json_object_t* reference_script = NULL;
+
+  *script = NULL;
+
+  if (!cardano_json_object_get_ex(row, "reference_script", 16, &reference_script) || (cardano_json_object_get_type(reference_script) != CARDANO_JSON_OBJECT_TYPE_OBJECT))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  size_t      type_size  = 0U;
+  size_t      bytes_size = 0U;
+  const char* type       = get_string_property(reference_script, "type", &type_size);
+  const char* bytes      = get_string_property(reference_script, "bytes", &bytes_size);
+
+  if ((type == NULL) || (bytes == NULL))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse reference_script from JSON response");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (strcmp(type, "plutusV1") == 0)
+  {
+    cardano_plutus_v1_script_t* plutus_script = NULL;
+    result                                    = cardano_plutus_v1_script_new_bytes_from_hex(bytes, bytes_size, &plutus_script);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_script_new_plutus_v1(plutus_script, script);
+    }
+
+    cardano_plutus_v1_script_unref(&plutus_script);
+  }
+  else if (strcmp(type, "plutusV2") == 0)
+  {
+    cardano_plutus_v2_script_t* plutus_script = NULL;
+    result                                    = cardano_plutus_v2_script_new_bytes_from_hex(bytes, bytes_size, &plutus_script);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_script_new_plutus_v2(plutus_script, script);
+    }
+
+    cardano_plutus_v2_script_unref(&plutus_script);
+  }
+  else if (strcmp(type, "plutusV3") == 0)
+  {
+    cardano_plutus_v3_script_t* plutus_script = NULL;
+    result                                    = cardano_plutus_v3_script_new_bytes_from_hex(bytes, bytes_size, &plutus_script);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_script_new_plutus_v3(plutus_script, script);
+    }
+
+    cardano_plutus_v3_script_unref(&plutus_script);
+  }
+  else if ((strcmp(type, "timelock") == 0) || (strcmp(type, "multisig") == 0))
+  {
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_from_hex(bytes, bytes_size);
+
+    if (reader == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    cardano_native_script_t* native_script = NULL;
+    result                                 = cardano_native_script_from_cbor(reader, &native_script);
+    cardano_cbor_reader_unref(&reader);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_script_new_native(native_script, script);
+    }
+
+    cardano_native_script_unref(&native_script);
+  }
+  else
+  {
+    cardano_utils_set_error_message(provider, "Unknown reference_script type in JSON response");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider, "Failed to decode reference_script from JSON response");
+  }
+
+  return result;
+}
+
+/**
+ * \brief Builds a UTxO out of one Koios row.
+ *
+ * \param[in] provider The provider implementation used for error reporting.
+ * \param[in] row The UTxO row.
+ * \param[out] utxo On success, the UTxO.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+parse_utxo(cardano_provider_impl_t* provider, cardano_json_object_t* row, cardano_utxo_t** utxo)
+{
+  size_t      tx_hash_size = 0U;
+  size_t      address_size = 0U;
+  const char* tx_hash      = get_string_property(row, "tx_hash", &tx_hash_size);
+  const char* address_str  = get_string_property(row, "address", &address_size);
+
+  cardano_json_object_t* tx_index_obj = NULL;
+  uint64_t               tx_index     = 0U;
+
+  if ((tx_hash == NULL) || (address_str == NULL) || !cardano_json_object_get_ex(row, "tx_index", 8, &tx_index_obj) || (cardano_json_object_get_uint(tx_index_obj, &tx_index) != CARDANO_SUCCESS))
+  {
+    cardano_utils_set_error_message(provider, "UTxO row is missing tx_hash, tx_index or address");
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_blake2b_hash_t*       tx_id   = NULL;
+  cardano_address_t*            address = NULL;
+  cardano_value_t*              value   = NULL;
+  cardano_datum_t*              datum   = NULL;
+  cardano_script_t*             script  = NULL;
+  cardano_transaction_input_t*  input   = NULL;
+  cardano_transaction_output_t* output  = NULL;
+
+  cardano_error_t result = cardano_blake2b_hash_from_hex(tx_hash, tx_hash_size, &tx_id);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse tx_hash from JSON response");
+    goto cleanup;
+  }
+
+  result = cardano_address_intern_from_string(address_str, address_size, &address);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse address from JSON response");
+    goto cleanup;
+  }
+
+  result = parse_value(provider, row, &value);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    goto cleanup;
+  }
+
+  result = parse_datum(provider, row, &datum);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    goto cleanup;
+  }
+
+  result = parse_reference_script(provider, row, &script);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    goto cleanup;
+  }
+
+  result = cardano_transaction_input_new(tx_id, tx_index, &input);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    goto cleanup;
+  }
+
+  result = cardano_transaction_output_new(address, 0, &output);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    goto cleanup;
+  }
+
+  result = cardano_transaction_output_set_value(output, value);
+
+  if ((result == CARDANO_SUCCESS) && (datum != NULL))
+  {
+    result = cardano_transaction_output_set_datum(output, datum);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (script != NULL))
+  {
+    result = cardano_transaction_output_set_script_ref(output, script);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_utxo_new(input, output, utxo);
+  }
+
+cleanup:
+  cardano_blake2b_hash_unref(&tx_id);
+  cardano_address_unref(&address);
+  cardano_value_unref(&value);
+  cardano_datum_unref(&datum);
+  cardano_script_unref(&script);
+  cardano_transaction_input_unref(&input);
+  cardano_transaction_output_unref(&output);
+
+  return result;
+}
+
+/**
+ * \brief Checks whether a UTxO row is flagged as spent.
+ *
+ * \param[in] row The UTxO row.
+ *
+ * \return `true` if the row has `is_spent` set to true.
+ */
+static bool
+is_spent(cardano_json_object_t* row)
+{
+  cardano_json_object_t* is_spent_obj = NULL;
+  bool                   spent        = false;
+
+  if (!cardano_json_object_get_ex(row, "is_spent", 8, &is_spent_obj) || (cardano_json_object_get_type(is_spent_obj) != CARDANO_JSON_OBJECT_TYPE_BOOLEAN))
+  {
+    return false;
+  }
+
+  return (cardano_json_object_get_boolean(is_spent_obj, &spent) == CARDANO_SUCCESS) && spent;
+}
+
+/* IMPLEMENTATION *************************************************************/
+
+cardano_error_t
+cardano_koios_parse_unspent_outputs(
+  cardano_provider_impl_t* provider,
+  const char*              json,
+  const size_t             size,
+  cardano_utxo_list_t**    utxo_list,
+  size_t*                  row_count)
+{
+  cardano_json_object_t* parsed_json = cardano_json_object_parse(json, size);
+
+  if ((parsed_json == NULL) || (cardano_json_object_get_type(parsed_json) != CARDANO_JSON_OBJECT_TYPE_ARRAY))
+  {
+    cardano_utils_set_error_message(provider, "Failed to parse JSON response");
+    cardano_json_object_unref(&parsed_json);
+
+    return CARDANO_ERROR_INVALID_JSON;
+  }
+
+  cardano_error_t result = cardano_utxo_list_new(utxo_list);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utils_set_error_message(provider, "Failed to allocate memory for UTXO list");
+    cardano_json_object_unref(&parsed_json);
+
+    return result;
+  }
+
+  const size_t rows = cardano_json_object_array_get_length(parsed_json);
+
+  for (size_t i = 0U; i < rows; ++i)
+  {
+    cardano_json_object_t* row  = cardano_json_object_array_get_ex(parsed_json, i);
+    cardano_utxo_t*        utxo = NULL;
+
+    if (is_spent(row))
+    {
+      continue;
+    }
+
+    result = parse_utxo(provider, row, &utxo);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_utxo_list_add(*utxo_list, utxo);
+    }
+
+    cardano_utxo_unref(&utxo);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_utxo_list_unref(utxo_list);
+      cardano_json_object_unref(&parsed_json);
+
+      return result;
+    }
+  }
+
+  if (row_count != NULL)
+  {
+    *row_count = rows;
+  }
+
+  cardano_json_object_unref(&parsed_json);
+
+  return CARDANO_SUCCESS;
+}
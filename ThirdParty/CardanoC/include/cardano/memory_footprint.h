@@ -0,0 +1,312 @@
+/**
+ * \file memory_footprint.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_MEMORY_FOOTPRINT_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_MEMORY_FOOTPRINT_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/address/address.h>
+#include <cardano/assets/multi_asset.h>
+#include <cardano/common/utxo.h>
+#include <cardano/common/utxo_list.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/transaction/transaction.h>
+#include <cardano/transaction_body/transaction_output.h>
+#include <cardano/transaction_body/value.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief The kinds of objects a memory footprint is broken down by.
+ */
+typedef enum
+{
+  /**
+   * \brief Objects of the other kinds.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_OTHER = 0,
+
+  /**
+   * \brief The arrays behind lists, sets and maps, the typed list and set objects wrapping them, and map entries.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION = 1,
+
+  /**
+   * \brief Byte buffers and their storage: hash bytes, key material, compiled scripts and cached CBOR encodings.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_BUFFER = 2,
+
+  /**
+   * \brief Blake2b hashes (transaction ids, policy ids, script and data hashes).
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_HASH = 3,
+
+  /**
+   * \brief Multi-assets, asset name maps and asset names.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_ASSET = 4,
+
+  /**
+   * \brief Values.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_VALUE = 5,
+
+  /**
+   * \brief Addresses and their credentials, network ids, stake pointers and Byron contents.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_ADDRESS = 6,
+
+  /**
+   * \brief Transaction inputs.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_TRANSACTION_INPUT = 7,
+
+  /**
+   * \brief Transaction outputs.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_TRANSACTION_OUTPUT = 8,
+
+  /**
+   * \brief Datums.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_DATUM = 9,
+
+  /**
+   * \brief Plutus data, plutus lists, maps (and their lookup indexes), constructors and big integers.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_PLUTUS_DATA = 10,
+
+  /**
+   * \brief Scripts, native and Plutus.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_SCRIPT = 11,
+
+  /**
+   * \brief UTxOs and UTxO lists.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_UTXO = 12,
+
+  /**
+   * \brief Transactions, transaction bodies and their optional integer fields.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_TRANSACTION = 13,
+
+  /**
+   * \brief Witness sets, vkey witnesses with their keys and signatures, redeemers and execution units.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_WITNESS = 14,
+
+  /**
+   * \brief Auxiliary data.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_AUXILIARY_DATA = 15,
+
+  /**
+   * \brief The number of types; not a valid type.
+   */
+  CARDANO_MEMORY_FOOTPRINT_TYPE_COUNT = 16
+} cardano_memory_footprint_type_t;
+
+/**
+ * \brief Objects and heap bytes of one \ref cardano_memory_footprint_type_t.
+ */
+typedef struct cardano_memory_footprint_entry_t
+{
+    /**
+     * \brief Objects of this type. Each carries the fixed overhead of \ref cardano_object_t.
+     */
+    uint64_t object_count;
+
+    /**
+     * \brief Heap bytes of these objects and of the storage they own that is not an object itself.
+     */
+    uint64_t heap_bytes;
+} cardano_memory_footprint_entry_t;
+
+/**
+ * \brief The heap memory an object graph holds.
+ *
+ * Sizes are the bytes requested from the allocator; the allocator's own per-block overhead comes on top, roughly one
+ * or two words per allocation on common implementations, so `allocation_count` is reported as well. Objects reachable
+ * along several paths, such as an address shared through \ref cardano_address_cache_get, are counted once, and
+ * `shared_object_count` tells how many objects were referenced from elsewhere too, so releasing the measured graph
+ * would not free them.
+ */
+typedef struct cardano_memory_footprint_t
+{
+    /**
+     * \brief Total heap bytes of the graph.
+     */
+    uint64_t heap_bytes;
+
+    /**
+     * \brief Heap blocks in the graph, objects included.
+     */
+    uint64_t allocation_count;
+
+    /**
+     * \brief Objects in the graph.
+     */
+    uint64_t object_count;
+
+    /**
+     * \brief Bytes of the reference counts and deallocator pointers of every object.
+     */
+    uint64_t refcount_overhead_bytes;
+
+    /**
+     * \brief Bytes of the last-error pointers of every object, and of the error messages recorded on them.
+     */
+    uint64_t last_error_bytes;
+
+    /**
+     * \brief Objects with more than one reference, which may be owned by other graphs too.
+     */
+    uint64_t shared_object_count;
+
+    /**
+     * \brief Sub-objects the footprint does not descend into (certificates, governance procedures, withdrawals,
+     *        metadata, native script trees, auxiliary data script lists and bootstrap witnesses). Their memory is not
+     *        included; zero means the footprint is complete.
+     */
+    uint64_t unmeasured_object_count;
+
+    /**
+     * \brief The breakdown by type, indexed by \ref cardano_memory_footprint_type_t.
+     */
+    cardano_memory_footprint_entry_t by_type[CARDANO_MEMORY_FOOTPRINT_TYPE_COUNT];
+} cardano_memory_footprint_t;
+
+/**
+ * \brief Computes the heap memory held by a UTxO list and every UTxO in it.
+ *
+ * \param[in] utxo_list The list to measure.
+ * \param[out] footprint On success, the footprint of the list; overwritten.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if an argument is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the set used to count shared objects once could not be
+ *         allocated.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_memory_footprint_t footprint = { 0 };
+ *
+ * if (cardano_utxo_list_get_memory_footprint(utxos, &footprint) == CARDANO_SUCCESS)
+ * {
+ *   printf("%llu bytes in %llu objects, %llu of them last-error buffers\n",
+ *     footprint.heap_bytes, footprint.object_count, footprint.last_error_bytes);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_utxo_list_get_memory_footprint(const cardano_utxo_list_t* utxo_list, cardano_memory_footprint_t* footprint);
+
+/**
+ * \brief Computes the heap memory held by a UTxO, its input and its output.
+ *
+ * \param[in] utxo The UTxO to measure.
+ * \param[out] footprint On success, the footprint of the UTxO; overwritten.
+ *
+ * \return See \ref cardano_utxo_list_get_memory_footprint.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_utxo_get_memory_footprint(const cardano_utxo_t* utxo, cardano_memory_footprint_t* footprint);
+
+/**
+ * \brief Computes the heap memory held by a transaction output, with its address, value, datum and script.
+ *
+ * \param[in] output The output to measure.
+ * \param[out] footprint On success, the footprint of the output; overwritten.
+ *
+ * \return See \ref cardano_utxo_list_get_memory_footprint.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_output_get_memory_footprint(const cardano_transaction_output_t* output, cardano_memory_footprint_t* footprint);
+
+/**
+ * \brief Computes the heap memory held by a value and its multi-asset.
+ *
+ * \param[in] value The value to measure.
+ * \param[out] footprint On success, the footprint of the value; overwritten.
+ *
+ * \return See \ref cardano_utxo_list_get_memory_footprint.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_value_get_memory_footprint(const cardano_value_t* value, cardano_memory_footprint_t* footprint);
+
+/**
+ * \brief Computes the heap memory held by a multi-asset, its policy ids and asset names.
+ *
+ * \param[in] multi_asset The multi-asset to measure.
+ * \param[out] footprint On success, the footprint of the multi-asset; overwritten.
+ *
+ * \return See \ref cardano_utxo_list_get_memory_footprint.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_multi_asset_get_memory_footprint(const cardano_multi_asset_t* multi_asset, cardano_memory_footprint_t* footprint);
+
+/**
+ * \brief Computes the heap memory held by an address and its credentials.
+ *
+ * \param[in] address The address to measure.
+ * \param[out] footprint On success, the footprint of the address; overwritten.
+ *
+ * \return See \ref cardano_utxo_list_get_memory_footprint.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_address_get_memory_footprint(const cardano_address_t* address, cardano_memory_footprint_t* footprint);
+
+/**
+ * \brief Computes the heap memory held by a transaction: its body, witness set, auxiliary data and cached encodings.
+ *
+ * Certificates, governance procedures, withdrawals, protocol updates, metadata, native script trees, auxiliary data
+ * script lists and bootstrap witnesses are not descended into; they are counted in `unmeasured_object_count`.
+ *
+ * \param[in] transaction The transaction to measure.
+ * \param[out] footprint On success, the footprint of the transaction; overwritten.
+ *
+ * \return See \ref cardano_utxo_list_get_memory_footprint.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_get_memory_footprint(const cardano_transaction_t* transaction, cardano_memory_footprint_t* footprint);
+
+/**
+ * \brief Converts a footprint type to its name, e.g. "hash".
+ *
+ * \param[in] type The type.
+ *
+ * \return The name of the type, or "unknown" if `type` is out of range.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_memory_footprint_type_to_string(cardano_memory_footprint_type_t type);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_MEMORY_FOOTPRINT_H
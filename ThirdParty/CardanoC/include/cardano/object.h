@@ -54,12 +54,22 @@ typedef void (*cardano_object_deallocator_t)(void* data);
  * \brief Base object type.
  *
  * All objects in the library are derived from this type.
+ *
+ * The reference count must only be changed through \ref cardano_object_ref and \ref cardano_object_unref. When the
+ * library is built with `LIB_CARDANO_C_ATOMIC_REFCOUNT` defined, both functions update it atomically, so references
+ * to the same object can be taken and released from several threads at once (see
+ * \ref cardano_object_is_refcount_atomic).
+ *
+ * `last_error` is NULL until an error message is first recorded with \ref cardano_object_set_last_error, which
+ * allocates just enough storage for it; \ref cardano_object_unref releases that storage with the object, before
+ * calling the deallocator. Constructors must initialize it to NULL, and it must only be accessed through
+ * \ref cardano_object_set_last_error and \ref cardano_object_get_last_error.
  */
 typedef struct cardano_object_t
 {
     size_t                       ref_count;
     cardano_object_deallocator_t deallocator;
-    char                         last_error[1024];
+    char*                        last_error;
 } cardano_object_t;
 
 /**
@@ -67,6 +77,9 @@ typedef struct cardano_object_t
  *
  * If the reference count reaches zero, the object memory is deallocated.
  *
+ * With atomic reference counting the decrement has release semantics, and the thread releasing the last reference
+ * synchronizes with every other release before deallocating the object.
+ *
  * \param[in] object Pointer to the object whose reference count is to be decremented.
  */
 CARDANO_EXPORT void cardano_object_unref(cardano_object_t** object);
@@ -90,14 +103,55 @@ CARDANO_EXPORT void cardano_object_ref(cardano_object_t* object);
  */
 CARDANO_EXPORT size_t cardano_object_refcount(const cardano_object_t* object);
 
+/**
+ * \brief Freezes an object, making it immutable for the rest of its lifetime.
+ *
+ * The setters of a frozen object fail with \ref CARDANO_ERROR_OBJECT_IS_FROZEN, and its cached CBOR encoding is kept
+ * as is, so a frozen object can be read from several threads without locking. Freezing cannot be undone; to modify
+ * the value again, make a copy (for instance by round-tripping it through CBOR).
+ *
+ * This function only freezes the given object. Types whose objects own other objects, such as
+ * \ref cardano_utxo_list_freeze or \ref cardano_protocol_parameters_freeze, provide their own function that freezes
+ * the whole graph.
+ *
+ * \param[in] object The object to freeze. If NULL, the function has no effect.
+ */
+CARDANO_EXPORT void cardano_object_freeze(cardano_object_t* object);
+
+/**
+ * \brief Tells whether an object has been frozen with \ref cardano_object_freeze.
+ *
+ * \param[in] object The object to check.
+ *
+ * \return \c true if the object is frozen; \c false otherwise, or if `object` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_object_is_frozen(const cardano_object_t* object);
+
+/**
+ * \brief Tells whether the library was built with atomic reference counting.
+ *
+ * When it was, \ref cardano_object_ref and \ref cardano_object_unref can be called concurrently on the same object
+ * from different threads, so a fully built object that is no longer modified (for instance protocol parameters, an
+ * address or a UTxO list) can be shared between worker threads instead of being copied for each one.
+ *
+ * \note Only the reference count is synchronized. Calling setters, or functions that fill an internal cache (such as
+ * the lazily decoded parts of a transaction or \ref cardano_object_set_last_error), while other threads use the same
+ * object still requires external synchronization.
+ *
+ * \return \c true if reference counting is atomic; \c false otherwise.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_object_is_refcount_atomic(void);
+
 /**
  * \brief Sets the last error message for a given object.
  *
  * This function records an error message in the object's last_error buffer,
- * overwriting any previous message. The message is truncated if it exceeds
- * the buffer size. This function is typically used to store descriptive
- * error information that can be retrieved later with
- * cardano_object_get_last_error.
+ * overwriting any previous message. The buffer is allocated on the first
+ * message, sized to fit it, and an empty message releases it again. This
+ * function is typically used to store descriptive error information that can
+ * be retrieved later with cardano_object_get_last_error.
  *
  * \param[in,out] object A pointer to the cardano_object_t instance whose last error
  *               message is to be set. If the object is NULL, the function
@@ -106,9 +160,9 @@ CARDANO_EXPORT size_t cardano_object_refcount(const cardano_object_t* object);
  *                recorded. If the message is NULL, the object's last_error
  *                will be set to an empty string, indicating no error.
  *
- * \note The error message is limited to 1023 characters due to the fixed size
- *       of the last_error buffer (1024 characters), including the null
- *       terminator. Messages longer than this limit will be truncated.
+ * \note The error message is limited to 1023 characters. Messages longer than
+ *       this limit will be truncated. If the buffer cannot be allocated, the
+ *       object keeps no message.
  */
 CARDANO_EXPORT void cardano_object_set_last_error(cardano_object_t* object, const char* message);
 
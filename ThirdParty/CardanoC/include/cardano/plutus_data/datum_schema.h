@@ -0,0 +1,280 @@
+/**
+ * \file datum_schema.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_DATUM_SCHEMA_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_DATUM_SCHEMA_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/cbor/cbor_reader.h>
+#include <cardano/cbor/cbor_writer.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/typedefs.h>
+
+#include <stddef.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The largest byte string a \ref cardano_datum_bytes_t can hold.
+ *
+ * This is the size of one plutus bounded bytes chunk, which covers hashes, policy ids and asset names.
+ */
+#define CARDANO_DATUM_BYTES_MAX_SIZE 64U
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief The type of a field in a datum schema, and the C type of the struct member it maps to.
+ */
+typedef enum
+{
+  /**
+   * \brief A plutus integer stored in an `int64_t`.
+   */
+  CARDANO_DATUM_FIELD_TYPE_INTEGER = 0,
+
+  /**
+   * \brief A non-negative plutus integer stored in a `uint64_t`.
+   */
+  CARDANO_DATUM_FIELD_TYPE_UNSIGNED_INTEGER = 1,
+
+  /**
+   * \brief A plutus byte string stored in a \ref cardano_datum_bytes_t.
+   */
+  CARDANO_DATUM_FIELD_TYPE_BYTES = 2,
+
+  /**
+   * \brief A plutus boolean (`False` is constructor 0, `True` is constructor 1, both without fields) stored in a
+   * `bool`.
+   */
+  CARDANO_DATUM_FIELD_TYPE_BOOL = 3,
+
+  /**
+   * \brief A nested constructor stored as an embedded struct described by its own schema.
+   */
+  CARDANO_DATUM_FIELD_TYPE_CONSTR = 4,
+
+  /**
+   * \brief A plutus `Maybe` (`Just x` is constructor 0 with one field, `Nothing` is constructor 1 without fields).
+   *
+   * The member the field points at is a `bool` telling whether the value is present, and the value itself is
+   * described by a second field.
+   */
+  CARDANO_DATUM_FIELD_TYPE_OPTION = 5
+} cardano_datum_field_type_t;
+
+/**
+ * \brief A byte string held inline in a datum struct.
+ */
+typedef struct cardano_datum_bytes_t
+{
+    byte_t data[CARDANO_DATUM_BYTES_MAX_SIZE];
+    size_t size;
+} cardano_datum_bytes_t;
+
+struct cardano_datum_schema_t;
+
+/**
+ * \brief Describes how one constructor field maps to a member of a C struct.
+ *
+ * Fields are normally declared with the `CARDANO_DATUM_*_FIELD` macros below rather than filled in by hand.
+ */
+typedef struct cardano_datum_field_t
+{
+    /**
+     * \brief The type of the field.
+     */
+    cardano_datum_field_type_t type;
+
+    /**
+     * \brief The offset of the member in the struct. For options, the offset of the presence flag.
+     */
+    size_t offset;
+
+    /**
+     * \brief The schema of the nested struct, for \ref CARDANO_DATUM_FIELD_TYPE_CONSTR fields.
+     */
+    const struct cardano_datum_schema_t* schema;
+
+    /**
+     * \brief The field holding the value, for \ref CARDANO_DATUM_FIELD_TYPE_OPTION fields.
+     */
+    const struct cardano_datum_field_t* item;
+} cardano_datum_field_t;
+
+/**
+ * \brief Describes a plutus constructor and the C struct it is read into and written from.
+ *
+ * A schema is plain constant data, usually declared `static const` next to the struct it describes, so a datum type
+ * is defined once at compile time and no plutus data tree is built to encode or decode it:
+ *
+ * \code{.c}
+ * typedef struct listing_t
+ * {
+ *   cardano_datum_bytes_t seller;
+ *   int64_t               price;
+ *   bool                  has_deadline;
+ *   int64_t               deadline;
+ * } listing_t;
+ *
+ * static const cardano_datum_field_t LISTING_DEADLINE = CARDANO_DATUM_INTEGER_FIELD(listing_t, deadline);
+ *
+ * static const cardano_datum_field_t LISTING_FIELDS[] = {
+ *   CARDANO_DATUM_BYTES_FIELD(listing_t, seller),
+ *   CARDANO_DATUM_INTEGER_FIELD(listing_t, price),
+ *   CARDANO_DATUM_OPTION_FIELD(listing_t, has_deadline, LISTING_DEADLINE),
+ * };
+ *
+ * static const cardano_datum_schema_t LISTING_SCHEMA = CARDANO_DATUM_SCHEMA(0U, LISTING_FIELDS);
+ * \endcode
+ */
+typedef struct cardano_datum_schema_t
+{
+    /**
+     * \brief The constructor alternative.
+     */
+    uint64_t alternative;
+
+    /**
+     * \brief The fields of the constructor, in order. May be NULL if \ref field_count is zero.
+     */
+    const cardano_datum_field_t* fields;
+
+    /**
+     * \brief The number of fields.
+     */
+    size_t field_count;
+} cardano_datum_schema_t;
+
+/**
+ * \brief Declares an `int64_t` member as an integer field.
+ */
+#define CARDANO_DATUM_INTEGER_FIELD(type, member) \
+  { CARDANO_DATUM_FIELD_TYPE_INTEGER, offsetof(type, member), NULL, NULL }
+
+/**
+ * \brief Declares a `uint64_t` member as a non-negative integer field.
+ */
+#define CARDANO_DATUM_UNSIGNED_INTEGER_FIELD(type, member) \
+  { CARDANO_DATUM_FIELD_TYPE_UNSIGNED_INTEGER, offsetof(type, member), NULL, NULL }
+
+/**
+ * \brief Declares a \ref cardano_datum_bytes_t member as a byte string field.
+ */
+#define CARDANO_DATUM_BYTES_FIELD(type, member) \
+  { CARDANO_DATUM_FIELD_TYPE_BYTES, offsetof(type, member), NULL, NULL }
+
+/**
+ * \brief Declares a `bool` member as a boolean field.
+ */
+#define CARDANO_DATUM_BOOL_FIELD(type, member) \
+  { CARDANO_DATUM_FIELD_TYPE_BOOL, offsetof(type, member), NULL, NULL }
+
+/**
+ * \brief Declares an embedded struct member as a nested constructor described by \p nested_schema.
+ */
+#define CARDANO_DATUM_CONSTR_FIELD(type, member, nested_schema) \
+  { CARDANO_DATUM_FIELD_TYPE_CONSTR, offsetof(type, member), &(nested_schema), NULL }
+
+/**
+ * \brief Declares an optional field whose presence is stored in the `bool` member \p present_member and whose value
+ * is described by the field \p item_field.
+ */
+#define CARDANO_DATUM_OPTION_FIELD(type, present_member, item_field) \
+  { CARDANO_DATUM_FIELD_TYPE_OPTION, offsetof(type, present_member), NULL, &(item_field) }
+
+/**
+ * \brief Declares a schema for constructor \p alt with the fields in the array \p field_array.
+ */
+#define CARDANO_DATUM_SCHEMA(alt, field_array) \
+  { (alt), (field_array), sizeof(field_array) / sizeof((field_array)[0]) }
+
+/**
+ * \brief Encodes a struct as the plutus data constructor described by a schema.
+ *
+ * The CBOR is written straight to \p writer, and is byte for byte what \ref cardano_plutus_data_to_cbor produces for
+ * the equivalent plutus data: compact constructor tags, indefinite length field arrays for non-empty constructors and
+ * the smallest integer encodings.
+ *
+ * \param[in] schema The schema describing the struct.
+ * \param[in] value A pointer to the struct.
+ * \param[in] writer The writer the CBOR is written to.
+ *
+ * \return \ref CARDANO_SUCCESS if the struct was encoded, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL,
+ * or \ref CARDANO_ERROR_ENCODING if the schema is malformed or a byte string is longer than
+ * \ref CARDANO_DATUM_BYTES_MAX_SIZE.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_datum_schema_to_cbor(
+  const cardano_datum_schema_t* schema,
+  const void*                   value,
+  cardano_cbor_writer_t*        writer);
+
+/**
+ * \brief Decodes the plutus data constructor at the current position of a reader into a struct.
+ *
+ * The fields are read straight into the struct members. Both the compact and the general constructor forms, and
+ * definite and indefinite length arrays and byte strings are accepted. Members of absent optional values are left
+ * untouched.
+ *
+ * \param[in] schema The schema describing the struct.
+ * \param[in] reader The reader positioned at the constructor.
+ * \param[out] value A pointer to the struct to fill in.
+ *
+ * \return \ref CARDANO_SUCCESS if the struct was decoded, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL,
+ * a decoding error if the data does not match the schema (wrong constructor, wrong number of fields or a field of the
+ * wrong type), \ref CARDANO_ERROR_INTEGER_OVERFLOW or \ref CARDANO_ERROR_INTEGER_UNDERFLOW if an integer does not
+ * fit its member, or \ref CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE if a byte string is longer than
+ * \ref CARDANO_DATUM_BYTES_MAX_SIZE. On failure the reader's last error describes the problem and the struct may be
+ * partially filled in.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_datum_schema_from_cbor(
+  const cardano_datum_schema_t* schema,
+  cardano_cbor_reader_t*        reader,
+  void*                         value);
+
+/**
+ * \brief Reads the alternative of the plutus data constructor at the current position of a reader without consuming
+ * it.
+ *
+ * This lets a caller pick the schema of a sum type (such as a redeemer with several actions) before decoding it.
+ *
+ * \param[in] reader The reader positioned at the constructor.
+ * \param[out] alternative On success, the constructor alternative.
+ *
+ * \return \ref CARDANO_SUCCESS if the alternative was read, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is
+ * NULL, or a decoding error if the next value is not a constructor.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_datum_schema_peek_alternative(cardano_cbor_reader_t* reader, uint64_t* alternative);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_DATUM_SCHEMA_H
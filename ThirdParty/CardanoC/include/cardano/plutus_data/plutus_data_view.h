@@ -0,0 +1,280 @@
+/**
+ * \file plutus_data_view.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_PLUTUS_DATA_VIEW_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_PLUTUS_DATA_VIEW_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/buffer.h>
+#include <cardano/cbor/cbor_reader.h>
+#include <cardano/common/bigint.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/plutus_data/plutus_data.h>
+#include <cardano/plutus_data/plutus_data_kind.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief A read-only, lazily decoded view of a plutus data.
+ *
+ * Unlike \ref cardano_plutus_data_from_cbor, which decodes a whole datum into nested lists and maps up front, a view
+ * keeps the original CBOR and decodes only what is asked for. The fields of a constructor, the elements of a list and
+ * the entries of a map are indexed the first time they are accessed, after which any of them is reached in constant
+ * time; every child is itself a view sharing the same CBOR. Reading one or two fields out of a large datum therefore
+ * costs a fraction of a full decode.
+ *
+ * Views are not thread-safe: indexes are built on first access and stored in the view.
+ */
+typedef struct cardano_plutus_data_view_t cardano_plutus_data_view_t;
+
+/**
+ * \brief Creates a view of the plutus data at the current position of a CBOR reader.
+ *
+ * The encoded value is copied out of the reader and checked to be well-formed CBOR, but only its outermost item is
+ * decoded. The reader is advanced past the value.
+ *
+ * \param[in] reader The CBOR reader.
+ * \param[out] view On success, the new view. The caller must release it with \ref cardano_plutus_data_view_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL,
+ *         \ref CARDANO_ERROR_DECODING if the value is not plutus data, or another decoding error.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_cbor_reader_t*      reader = cardano_cbor_reader_new(datum_cbor, datum_cbor_size);
+ * cardano_plutus_data_view_t* datum  = NULL;
+ * cardano_plutus_data_view_t* price  = NULL;
+ * cardano_bigint_t*           amount = NULL;
+ *
+ * if ((cardano_plutus_data_view_from_cbor(reader, &datum) == CARDANO_SUCCESS)
+ *   && (cardano_plutus_data_view_get_item(datum, 2, &price) == CARDANO_SUCCESS)
+ *   && (cardano_plutus_data_view_to_integer(price, &amount) == CARDANO_SUCCESS))
+ * {
+ *   // Only the outer constructor and its third field were decoded
+ * }
+ *
+ * cardano_bigint_unref(&amount);
+ * cardano_plutus_data_view_unref(&price);
+ * cardano_plutus_data_view_unref(&datum);
+ * cardano_cbor_reader_unref(&reader);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_plutus_data_view_from_cbor(cardano_cbor_reader_t* reader, cardano_plutus_data_view_t** view);
+
+/**
+ * \brief Gets the kind of the plutus data a view refers to.
+ *
+ * \param[in] view The view.
+ * \param[out] kind The kind.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_plutus_data_view_get_kind(const cardano_plutus_data_view_t* view, cardano_plutus_data_kind_t* kind);
+
+/**
+ * \brief Gets the constructor alternative of a constructor view.
+ *
+ * \param[in] view The view.
+ * \param[out] alternative The alternative.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL, or
+ *         \ref CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION if the view is not a constructor.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_plutus_data_view_get_alternative(const cardano_plutus_data_view_t* view, uint64_t* alternative);
+
+/**
+ * \brief Gets the number of fields of a constructor, elements of a list or entries of a map.
+ *
+ * \param[in] view The view.
+ * \param[out] length The number of children.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL,
+ *         \ref CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION if the view is an integer or bytes, or a decoding error.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_plutus_data_view_get_length(cardano_plutus_data_view_t* view, size_t* length);
+
+/**
+ * \brief Gets a field of a constructor or an element of a list.
+ *
+ * \param[in] view The view of the constructor or list.
+ * \param[in] index The position of the field or element.
+ * \param[out] item On success, a view of the field or element. The caller must release it with
+ *                  \ref cardano_plutus_data_view_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any pointer is NULL,
+ *         \ref CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION if the view is neither a constructor nor a list,
+ *         \ref CARDANO_ERROR_INDEX_OUT_OF_BOUNDS if \p index is not less than the length, or a decoding error.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_plutus_data_view_get_item(
+  cardano_plutus_data_view_t*  view,
+  size_t                       index,
+  cardano_plutus_data_view_t** item);
+
+/**
+ * \brief Gets the key and value of an entry of a map.
+ *
+ * \param[in] view The view of the map.
+ * \param[in] index The position of the entry.
+ * \param[out] key On success, a view of the key. The caller must release it with \ref cardano_plutus_data_view_unref.
+ * \param[out] value On success, a view of the value. The caller must release it with \ref cardano_plutus_data_view_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any pointer is NULL,
+ *         \ref CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION if the view is not a map,
+ *         \ref CARDANO_ERROR_INDEX_OUT_OF_BOUNDS if \p index is not less than the length, or a decoding error.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_plutus_data_view_get_entry(
+  cardano_plutus_data_view_t*  view,
+  size_t                       index,
+  cardano_plutus_data_view_t** key,
+  cardano_plutus_data_view_t** value);
+
+/**
+ * \brief Looks up the value of a key in a map.
+ *
+ * Keys are matched on their CBOR encoding: \p key is serialized with \ref cardano_plutus_data_to_cbor and compared with
+ * the encoded keys of the map, which avoids decoding them. Keys decoded from the same source, or built from values
+ * and encoded canonically as usual, match as expected. The first lookup on a map of eight or more entries builds a
+ * hashed index of its keys, so later lookups take constant time on average. When several entries have the same key,
+ * the first one is returned.
+ *
+ * \param[in] view The view of the map.
+ * \param[in] key The key to look for.
+ * \param[out] value On success, a view of the value. The caller must release it with \ref cardano_plutus_data_view_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL,
+ *         \ref CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION if the view is not a map,
+ *         \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if no entry has the key, or another error code on failure.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_plutus_data_view_find(
+  cardano_plutus_data_view_t*  view,
+  cardano_plutus_data_t*       key,
+  cardano_plutus_data_view_t** value);
+
+/**
+ * \brief Gets the value of an integer view.
+ *
+ * \param[in] view The view.
+ * \param[out] integer On success, the value. The caller must release it with \ref cardano_bigint_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL,
+ *         \ref CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION if the view is not an integer, or a decoding error.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_plutus_data_view_to_integer(const cardano_plutus_data_view_t* view, cardano_bigint_t** integer);
+
+/**
+ * \brief Gets the bytes of a bytes view.
+ *
+ * \param[in] view The view.
+ * \param[out] bounded_bytes On success, the bytes. The caller must release them with \ref cardano_buffer_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL,
+ *         \ref CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION if the view is not bytes, or a decoding error.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_plutus_data_view_to_bounded_bytes(const cardano_plutus_data_view_t* view, cardano_buffer_t** bounded_bytes);
+
+/**
+ * \brief Fully decodes the plutus data a view refers to.
+ *
+ * \param[in] view The view.
+ * \param[out] plutus_data On success, the decoded plutus data, which keeps the original encoding. The caller must
+ *                         release it with \ref cardano_plutus_data_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL, or the error of
+ *         \ref cardano_plutus_data_from_cbor.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_plutus_data_view_to_plutus_data(const cardano_plutus_data_view_t* view, cardano_plutus_data_t** plutus_data);
+
+/**
+ * \brief Gets the CBOR encoding of the plutus data a view refers to.
+ *
+ * \param[in] view The view.
+ * \param[out] data The encoding, owned by the view and valid for as long as it is.
+ * \param[out] size The size of the encoding in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_plutus_data_view_get_cbor(const cardano_plutus_data_view_t* view, const byte_t** data, size_t* size);
+
+/**
+ * \brief Decrements the reference count of a plutus data view, and releases it when it reaches zero.
+ *
+ * \param[in,out] view A pointer to the view. It is set to NULL once the view is released.
+ */
+CARDANO_EXPORT void cardano_plutus_data_view_unref(cardano_plutus_data_view_t** view);
+
+/**
+ * \brief Increments the reference count of a plutus data view.
+ *
+ * \param[in] view The view.
+ */
+CARDANO_EXPORT void cardano_plutus_data_view_ref(cardano_plutus_data_view_t* view);
+
+/**
+ * \brief Gets the reference count of a plutus data view.
+ *
+ * \param[in] view The view.
+ *
+ * \return The reference count, or zero if \p view is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_plutus_data_view_refcount(const cardano_plutus_data_view_t* view);
+
+/**
+ * \brief Sets the last error message of a plutus data view.
+ *
+ * \param[in] view The view.
+ * \param[in] message The null-terminated message, truncated to 1023 characters. NULL clears it.
+ */
+CARDANO_EXPORT void cardano_plutus_data_view_set_last_error(cardano_plutus_data_view_t* view, const char* message);
+
+/**
+ * \brief Gets the last error message of a plutus data view, such as the reason an index could not be built.
+ *
+ * \param[in] view The view.
+ *
+ * \return The null-terminated message, owned by the view.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_plutus_data_view_get_last_error(const cardano_plutus_data_view_t* view);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_PLUTUS_DATA_VIEW_H
@@ -221,6 +221,10 @@ CARDANO_EXPORT size_t cardano_plutus_map_get_length(const cardano_plutus_map_t*
  * It returns the value through the output parameter `element`. If the key is not found in the plutus map,
  * the output parameter `element` will be set to NULL.
  *
+ * Small maps are searched linearly. Once a map has eight or more entries, the first lookup builds a hashed index of
+ * its keys, which later lookups and insertions reuse, so each lookup takes constant time on average. When several
+ * entries have equal keys, the first one is returned. Keys must not be modified while they are in the map.
+ *
  * \param[in] plutus_map A constant pointer to the \ref cardano_plutus_map_t object from which
  *                       the value is to be retrieved.
  * \param[in] key The key whose associated value is to be retrieved from the plutus_map.
@@ -391,6 +395,44 @@ CARDANO_EXPORT cardano_error_t cardano_plutus_map_get_keys(cardano_plutus_map_t*
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_plutus_map_get_values(cardano_plutus_map_t* plutus_map, cardano_plutus_list_t** values);
 
+/**
+ * \brief Retrieves the key and value at the specified index of a plutus map.
+ *
+ * Unlike \ref cardano_plutus_map_get_keys and \ref cardano_plutus_map_get_values, this does not build new lists,
+ * which makes it the cheap way to walk every entry of a map.
+ *
+ * \param[in]  plutus_map Pointer to the plutus map.
+ * \param[in]  index      The index of the entry, in insertion order.
+ * \param[out] key        On success, the key at \p index. The caller must release it with \ref cardano_plutus_data_unref.
+ * \param[out] value      On success, the value at \p index. The caller must release it with \ref cardano_plutus_data_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any pointer is NULL, or
+ *         \ref CARDANO_ERROR_INDEX_OUT_OF_BOUNDS if \p index is not less than the length of the map.
+ *
+ * Usage Example:
+ * \code{.c}
+ * for (size_t i = 0U; i < cardano_plutus_map_get_length(plutus_map); ++i)
+ * {
+ *   cardano_plutus_data_t* key   = NULL;
+ *   cardano_plutus_data_t* value = NULL;
+ *
+ *   if (cardano_plutus_map_get_key_value_at(plutus_map, i, &key, &value) == CARDANO_SUCCESS)
+ *   {
+ *     // Use the key and the value
+ *
+ *     cardano_plutus_data_unref(&key);
+ *     cardano_plutus_data_unref(&value);
+ *   }
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_plutus_map_get_key_value_at(
+  const cardano_plutus_map_t* plutus_map,
+  size_t                      index,
+  cardano_plutus_data_t**     key,
+  cardano_plutus_data_t**     value);
+
 /**
  * \brief Checks if two plutus maps are equal.
  *
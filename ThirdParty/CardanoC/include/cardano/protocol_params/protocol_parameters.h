@@ -85,6 +85,77 @@ CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t
 cardano_protocol_parameters_new(cardano_protocol_parameters_t** protocol_parameters);
 
+/**
+ * \brief Decodes protocol parameters from a CBOR snapshot.
+ *
+ * The snapshot is the 31 element array in which a Conway node reports its current protocol parameters (the
+ * `PParams` of the ledger, as returned by the local state query), and which \ref cardano_protocol_parameters_to_cbor
+ * writes. Decentralisation and extra entropy are not part of it and keep their defaults.
+ *
+ * Only script transactions need the cost models, so they are checked to be a well formed map but are only decoded
+ * the first time \ref cardano_protocol_parameters_get_cost_models or \ref cardano_protocol_parameters_freeze is
+ * called. Encoding the parameters again before then writes the original bytes back.
+ *
+ * \param[in] reader The reader positioned at the snapshot.
+ * \param[out] protocol_parameters On success, the decoded protocol parameters. The caller must release them with
+ *                                 \ref cardano_protocol_parameters_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure; the reader then holds the error message.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_cbor_reader_t* reader = cardano_cbor_reader_new(snapshot, snapshot_size);
+ * cardano_protocol_parameters_t* protocol_parameters = NULL;
+ *
+ * cardano_error_t result = cardano_protocol_parameters_from_cbor(reader, &protocol_parameters);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // Use the protocol_parameters
+ *
+ *   cardano_protocol_parameters_unref(&protocol_parameters);
+ * }
+ * else
+ * {
+ *   printf("Failed to decode protocol parameters: %s\n", cardano_cbor_reader_get_last_error(reader));
+ * }
+ *
+ * cardano_cbor_reader_unref(&reader);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_protocol_parameters_from_cbor(cardano_cbor_reader_t* reader, cardano_protocol_parameters_t** protocol_parameters);
+
+/**
+ * \brief Encodes protocol parameters into a CBOR snapshot.
+ *
+ * The layout is the one described in \ref cardano_protocol_parameters_from_cbor, so a snapshot can be cached on
+ * disk and decoded much faster than the JSON of a provider.
+ *
+ * \param[in] protocol_parameters The protocol parameters to encode.
+ * \param[out] writer The writer the snapshot is written to.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if an argument is NULL, or the
+ *         error of the writer.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+ *
+ * if (cardano_protocol_parameters_to_cbor(protocol_parameters, writer) == CARDANO_SUCCESS)
+ * {
+ *   // Store the encoded snapshot of the writer
+ * }
+ *
+ * cardano_cbor_writer_unref(&writer);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_protocol_parameters_to_cbor(
+  const cardano_protocol_parameters_t* protocol_parameters,
+  cardano_cbor_writer_t*               writer);
+
 /**
  * \brief Retrieves the linear minimum fee coefficient (a) from the protocol parameters.
  *
@@ -645,7 +716,8 @@ CARDANO_EXPORT uint64_t cardano_protocol_parameters_get_ada_per_utxo_byte(
  *                                This parameter must not be NULL.
  *
  * \return A pointer to a \ref cardano_costmdls_t object representing the cost models.
- *         If the \p protocol_parameters pointer is NULL, the function will return NULL.
+ *         If the \p protocol_parameters pointer is NULL, or the cost models of a snapshot decoded by
+ *         \ref cardano_protocol_parameters_from_cbor are invalid, the function will return NULL.
  *
  * \note The caller is responsible for managing the lifecycle of the returned \ref cardano_costmdls_t object.
  *       Specifically, the caller must release the object by calling \ref cardano_costmdls_unref when it is no longer needed.
@@ -2531,6 +2603,28 @@ CARDANO_EXPORT cardano_error_t cardano_protocol_parameters_set_ref_script_cost_p
   cardano_protocol_parameters_t* protocol_parameters,
   cardano_unit_interval_t*       ref_script_cost_per_byte);
 
+/**
+ * \brief Freezes a set of protocol parameters, making it immutable.
+ *
+ * The nested objects (unit intervals, cost models, execution prices and units, protocol version, voting thresholds and extra entropy) are frozen too. Every setter fails with \ref CARDANO_ERROR_OBJECT_IS_FROZEN, so one parameter set can be shared by every thread building transactions.
+ *
+ * Freezing cannot be undone, and the cached CBOR encoding is kept as is. Cost models still encoded after
+ * \ref cardano_protocol_parameters_from_cbor are decoded first, so a frozen set is never modified by its getters.
+ *
+ * \param[in] protocol_parameters The set of protocol parameters to freeze. If NULL, the function has no effect.
+ */
+CARDANO_EXPORT void cardano_protocol_parameters_freeze(cardano_protocol_parameters_t* protocol_parameters);
+
+/**
+ * \brief Checks whether a set of protocol parameters has been frozen with \ref cardano_protocol_parameters_freeze.
+ *
+ * \param[in] protocol_parameters The set of protocol parameters to check.
+ *
+ * \return \c true if the set of protocol parameters is frozen; \c false otherwise, or if `protocol_parameters` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_protocol_parameters_is_frozen(const cardano_protocol_parameters_t* protocol_parameters);
+
 /**
  * \brief Decrements the reference count of a cardano_protocol_parameters_t object.
  *
@@ -0,0 +1,257 @@
+/**
+ * \file async_provider.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_ASYNC_PROVIDER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_ASYNC_PROVIDER_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/providers/async_provider_impl.h>
+#include <cardano/providers/provider_request.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Non-blocking counterpart of \ref cardano_provider_t.
+ *
+ * Each call starts a query and returns at once; the answer is delivered to a completion callback when the
+ * implementation completes the request, so no thread is held for the network round trip. The callback runs on
+ * whichever thread the implementation completes the request from, possibly before the call returns. The provider and
+ * its requests are not thread safe: callers must not use them from several threads at once.
+ */
+typedef struct cardano_async_provider_t cardano_async_provider_t;
+
+/**
+ * \brief Creates a new asynchronous provider from its implementation.
+ *
+ * \param[in] impl The implementation. The provider takes ownership of `impl.context`.
+ * \param[out] provider On success, the new provider. The caller must release it with \ref cardano_async_provider_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_async_provider_new(
+  cardano_async_provider_impl_t impl,
+  cardano_async_provider_t**    provider);
+
+/**
+ * \brief Retrieves the name of an asynchronous provider.
+ *
+ * \param[in] provider The provider.
+ *
+ * \return The name of the provider, or an empty string if \p provider is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_async_provider_get_name(const cardano_async_provider_t* provider);
+
+/**
+ * \brief Retrieves the network magic of an asynchronous provider.
+ *
+ * \param[in] provider The provider.
+ *
+ * \return The network magic of the provider.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_network_magic_t cardano_async_provider_get_network_magic(const cardano_async_provider_t* provider);
+
+/**
+ * \brief Starts retrieving the current protocol parameters.
+ *
+ * If a parameters query of this provider is still in flight, the new request joins it instead of reaching the
+ * implementation, and completes with the same answer. Each joined request keeps its own callback and can be
+ * cancelled on its own; the shared query is only cancelled once every request waiting on it is.
+ *
+ * \param[in] provider The provider.
+ * \param[in] callback The function to call with the parameters once they arrive.
+ * \param[in] user_data A pointer passed to \p callback.
+ * \param[out] request On success, the request of the query, or NULL if the caller does not need it. The caller must
+ *                     release it with \ref cardano_provider_request_unref.
+ *
+ * \return \ref CARDANO_SUCCESS if the query started, or the error that kept it from starting, in which case
+ *         \p callback never runs and the error message is available through \ref cardano_async_provider_get_last_error.
+ *
+ * Usage Example:
+ * \code{.c}
+ * static void
+ * on_parameters(cardano_provider_request_t* request, cardano_error_t result, cardano_protocol_parameters_t* parameters, void* user_data)
+ * {
+ *   if (result != CARDANO_SUCCESS)
+ *   {
+ *     printf("Error: %s\n", cardano_provider_request_get_last_error(request));
+ *     return;
+ *   }
+ *
+ *   cardano_protocol_parameters_ref(parameters); // Keep them beyond the callback
+ *   ...
+ * }
+ *
+ * cardano_provider_request_t* request = NULL;
+ * cardano_error_t result = cardano_async_provider_get_parameters(provider, on_parameters, NULL, &request);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_async_provider_get_parameters(
+  cardano_async_provider_t*     provider,
+  cardano_parameters_callback_t callback,
+  void*                         user_data,
+  cardano_provider_request_t**  request);
+
+/**
+ * \brief Starts retrieving the unspent outputs of an address.
+ *
+ * Like \ref cardano_async_provider_get_parameters, the request joins a query for the same address that is still in
+ * flight, if any. The joined requests are handed the same list, which their callbacks must not modify.
+ *
+ * \param[in] provider The provider.
+ * \param[in] address The address to query.
+ * \param[in] callback The function to call with the unspent outputs once they arrive.
+ * \param[in] user_data A pointer passed to \p callback.
+ * \param[out] request On success, the request of the query, or NULL if the caller does not need it.
+ *
+ * \return The same as \ref cardano_async_provider_get_parameters.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_async_provider_get_unspent_outputs(
+  cardano_async_provider_t*    provider,
+  cardano_address_t*           address,
+  cardano_utxo_list_callback_t callback,
+  void*                        user_data,
+  cardano_provider_request_t** request);
+
+/**
+ * \brief Starts submitting a transaction to the network.
+ *
+ * \param[in] provider The provider.
+ * \param[in] tx The transaction to submit.
+ * \param[in] callback The function to call with the transaction id once the submission is accepted.
+ * \param[in] user_data A pointer passed to \p callback.
+ * \param[out] request On success, the request of the submission, or NULL if the caller does not need it.
+ *
+ * \return The same as \ref cardano_async_provider_get_parameters.
+ *
+ * \note Cancelling a submission only stops waiting for its answer; the transaction may still reach the network.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_async_provider_submit_transaction(
+  cardano_async_provider_t*    provider,
+  cardano_transaction_t*       tx,
+  cardano_tx_id_callback_t     callback,
+  void*                        user_data,
+  cardano_provider_request_t** request);
+
+/**
+ * \brief Starts evaluating the execution units of a transaction.
+ *
+ * \param[in] provider The provider.
+ * \param[in] tx The transaction to evaluate.
+ * \param[in] additional_utxos Additional UTXOs required for evaluation, or NULL.
+ * \param[in] callback The function to call with the evaluated redeemers.
+ * \param[in] user_data A pointer passed to \p callback.
+ * \param[out] request On success, the request of the evaluation, or NULL if the caller does not need it.
+ *
+ * \return The same as \ref cardano_async_provider_get_parameters.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_async_provider_evaluate_transaction(
+  cardano_async_provider_t*        provider,
+  cardano_transaction_t*           tx,
+  cardano_utxo_list_t*             additional_utxos,
+  cardano_redeemer_list_callback_t callback,
+  void*                            user_data,
+  cardano_provider_request_t**     request);
+
+/**
+ * \brief Starts waiting for a transaction to be included in a block.
+ *
+ * \param[in] provider The provider.
+ * \param[in] tx_id The id of the transaction.
+ * \param[in] timeout_ms How long to wait, in milliseconds, before completing the request as not confirmed.
+ * \param[in] callback The function to call once the transaction is confirmed or the timeout expires.
+ * \param[in] user_data A pointer passed to \p callback.
+ * \param[out] request On success, the request of the wait, or NULL if the caller does not need it.
+ *
+ * \return The same as \ref cardano_async_provider_get_parameters.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_async_provider_confirm_transaction(
+  cardano_async_provider_t*       provider,
+  cardano_blake2b_hash_t*         tx_id,
+  uint64_t                        timeout_ms,
+  cardano_confirmation_callback_t callback,
+  void*                           user_data,
+  cardano_provider_request_t**    request);
+
+/**
+ * \brief Decrements the reference count of an asynchronous provider and sets `*provider` to NULL.
+ *
+ * Requests already started keep running; whether they may outlive the provider depends on its implementation.
+ *
+ * \param[in,out] provider A pointer to the provider pointer.
+ */
+CARDANO_EXPORT void cardano_async_provider_unref(cardano_async_provider_t** provider);
+
+/**
+ * \brief Increases the reference count of an asynchronous provider.
+ *
+ * \param[in] provider The provider.
+ */
+CARDANO_EXPORT void cardano_async_provider_ref(cardano_async_provider_t* provider);
+
+/**
+ * \brief Retrieves the current reference count of an asynchronous provider.
+ *
+ * \param[in] provider The provider.
+ *
+ * \return The number of references to the provider, or zero if \p provider is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_async_provider_refcount(const cardano_async_provider_t* provider);
+
+/**
+ * \brief Sets the last error message of an asynchronous provider.
+ *
+ * \param[in] provider The provider. If NULL, the function does nothing.
+ * \param[in] message A null-terminated message. If NULL, the last error is left unchanged. Messages longer than
+ *                    1023 characters are truncated.
+ */
+CARDANO_EXPORT void cardano_async_provider_set_last_error(cardano_async_provider_t* provider, const char* message);
+
+/**
+ * \brief Retrieves the last error message of an asynchronous provider.
+ *
+ * \param[in] provider The provider.
+ *
+ * \return The last error message, an empty string if there is none, or "Object is NULL." if \p provider is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_async_provider_get_last_error(const cardano_async_provider_t* provider);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_ASYNC_PROVIDER_H
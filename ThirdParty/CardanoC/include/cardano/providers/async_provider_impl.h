@@ -0,0 +1,208 @@
+/**
+ * \file async_provider_impl.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_ASYNC_PROVIDER_IMPL_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_ASYNC_PROVIDER_IMPL_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/address/address.h>
+#include <cardano/common/network_magic.h>
+#include <cardano/common/utxo_list.h>
+#include <cardano/crypto/blake2b_hash.h>
+#include <cardano/error.h>
+#include <cardano/object.h>
+#include <cardano/providers/provider_request.h>
+#include <cardano/transaction/transaction.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* FORWARD DECLARATIONS *******************************************************/
+
+/**
+ * \brief Opaque structure representing the implementation details of an asynchronous Cardano data provider.
+ *
+ * \note Users should interact with asynchronous providers through the \ref cardano_async_provider_t API functions and
+ *       should not attempt to manipulate this structure directly.
+ */
+typedef struct cardano_async_provider_impl_t cardano_async_provider_impl_t;
+
+/* CALLBACKS *****************************************************************/
+
+/*
+ * Every function below starts a query and returns without waiting for it. The implementation receives a pending
+ * request and must later complete it exactly once, with the matching cardano_provider_request_complete_* function or
+ * with \ref cardano_provider_request_fail. It may do so before returning. To complete it after returning, the
+ * implementation takes a reference with \ref cardano_provider_request_ref and releases it once done.
+ *
+ * If a function returns an error, the query did not start: the request must be left pending and its callback will
+ * never run.
+ */
+
+/**
+ * \brief Function pointer type for starting a protocol parameters query.
+ *
+ * \param[in] provider_impl Pointer to the provider implementation instance.
+ * \param[in] request       The request to complete with \ref cardano_provider_request_complete_parameters.
+ *
+ * \return \ref CARDANO_SUCCESS if the query started, or the error that kept it from starting.
+ */
+typedef cardano_error_t (*cardano_async_get_parameters_func_t)(
+  cardano_async_provider_impl_t* provider_impl,
+  cardano_provider_request_t*    request);
+
+/**
+ * \brief Function pointer type for starting an unspent outputs query.
+ *
+ * \param[in] provider_impl Pointer to the provider implementation instance.
+ * \param[in] request       The request to complete with \ref cardano_provider_request_complete_utxo_list.
+ * \param[in] address       Address to query.
+ *
+ * \return \ref CARDANO_SUCCESS if the query started, or the error that kept it from starting.
+ */
+typedef cardano_error_t (*cardano_async_get_unspent_outputs_func_t)(
+  cardano_async_provider_impl_t* provider_impl,
+  cardano_provider_request_t*    request,
+  cardano_address_t*             address);
+
+/**
+ * \brief Function pointer type for starting a transaction submission.
+ *
+ * \param[in] provider_impl Pointer to the provider implementation instance.
+ * \param[in] request       The request to complete with \ref cardano_provider_request_complete_tx_id.
+ * \param[in] tx            Transaction to submit.
+ *
+ * \return \ref CARDANO_SUCCESS if the submission started, or the error that kept it from starting.
+ */
+typedef cardano_error_t (*cardano_async_submit_transaction_func_t)(
+  cardano_async_provider_impl_t* provider_impl,
+  cardano_provider_request_t*    request,
+  cardano_transaction_t*         tx);
+
+/**
+ * \brief Function pointer type for starting a transaction evaluation.
+ *
+ * \param[in] provider_impl    Pointer to the provider implementation instance.
+ * \param[in] request          The request to complete with \ref cardano_provider_request_complete_redeemers.
+ * \param[in] tx               Transaction to evaluate.
+ * \param[in] additional_utxos Additional UTXOs required for evaluation (optional).
+ *
+ * \return \ref CARDANO_SUCCESS if the evaluation started, or the error that kept it from starting.
+ */
+typedef cardano_error_t (*cardano_async_evaluate_transaction_func_t)(
+  cardano_async_provider_impl_t* provider_impl,
+  cardano_provider_request_t*    request,
+  cardano_transaction_t*         tx,
+  cardano_utxo_list_t*           additional_utxos);
+
+/**
+ * \brief Function pointer type for starting to wait for a transaction confirmation.
+ *
+ * \param[in] provider_impl Pointer to the provider implementation instance.
+ * \param[in] request       The request to complete with \ref cardano_provider_request_complete_confirmation.
+ * \param[in] tx_id         Transaction ID to confirm.
+ * \param[in] timeout_ms    Timeout in milliseconds to wait for confirmation.
+ *
+ * \return \ref CARDANO_SUCCESS if the wait started, or the error that kept it from starting.
+ */
+typedef cardano_error_t (*cardano_async_confirm_transaction_func_t)(
+  cardano_async_provider_impl_t* provider_impl,
+  cardano_provider_request_t*    request,
+  cardano_blake2b_hash_t*        tx_id,
+  uint64_t                       timeout_ms);
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Implementation of the asynchronous Cardano provider interface.
+ *
+ * This is the non-blocking counterpart of \ref cardano_provider_impl_t. It is a separate table so that existing
+ * blocking implementations keep their layout; an implementation that supports both fills in one of each.
+ */
+typedef struct cardano_async_provider_impl_t
+{
+    /**
+     * \brief Name of the provider implementation.
+     */
+    char name[256];
+
+    /**
+     * \brief Error message buffer for errors that keep a query from starting.
+     */
+    char error_message[1024];
+
+    /**
+     * \brief Cardano network magic number this provider is connected to.
+     */
+    cardano_network_magic_t network_magic;
+
+    /**
+     * \brief Opaque pointer to the implementation-specific context.
+     *
+     * Users should not access or modify this directly.
+     */
+    cardano_object_t* context;
+
+    /**
+     * \brief Function to start a protocol parameters query.
+     *
+     * \see cardano_async_get_parameters_func_t
+     */
+    cardano_async_get_parameters_func_t get_parameters;
+
+    /**
+     * \brief Function to start an unspent outputs query.
+     *
+     * \see cardano_async_get_unspent_outputs_func_t
+     */
+    cardano_async_get_unspent_outputs_func_t get_unspent_outputs;
+
+    /**
+     * \brief Function to start a transaction submission.
+     *
+     * \see cardano_async_submit_transaction_func_t
+     */
+    cardano_async_submit_transaction_func_t post_transaction_to_chain;
+
+    /**
+     * \brief Function to start a transaction evaluation.
+     *
+     * \see cardano_async_evaluate_transaction_func_t
+     */
+    cardano_async_evaluate_transaction_func_t evaluate_transaction;
+
+    /**
+     * \brief Function to start waiting for a transaction confirmation.
+     *
+     * \see cardano_async_confirm_transaction_func_t
+     */
+    cardano_async_confirm_transaction_func_t await_transaction_confirmation;
+} cardano_async_provider_impl_t;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_ASYNC_PROVIDER_IMPL_H
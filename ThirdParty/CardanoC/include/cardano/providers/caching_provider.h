@@ -0,0 +1,147 @@
+/**
+ * \file caching_provider.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_CACHING_PROVIDER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_CACHING_PROVIDER_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/providers/provider.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* CALLBACKS *****************************************************************/
+
+/**
+ * \brief Clock used by a caching provider to expire its entries.
+ *
+ * \param[in] clock_data The pointer given in \ref cardano_caching_provider_options_t.
+ *
+ * \return The current time in milliseconds. Only differences between two readings are used, so any epoch will do.
+ */
+typedef uint64_t (*cardano_caching_provider_clock_func_t)(void* clock_data);
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Options of a caching provider.
+ *
+ * A time to live of zero disables caching for that query, which is then always forwarded.
+ */
+typedef struct cardano_caching_provider_options_t
+{
+    /**
+     * \brief How long protocol parameters are served from the cache, in milliseconds.
+     */
+    uint64_t parameters_ttl_ms;
+
+    /**
+     * \brief How long the UTxOs of an address, with or without an asset filter, are served from the cache.
+     */
+    uint64_t unspent_outputs_ttl_ms;
+
+    /**
+     * \brief How long the UTxO holding an NFT is served from the cache.
+     */
+    uint64_t unspent_output_by_nft_ttl_ms;
+
+    /**
+     * \brief How long the rewards balance of a stake address is served from the cache.
+     */
+    uint64_t rewards_ttl_ms;
+
+    /**
+     * \brief Serve rewards balances until the current epoch ends, instead of for \ref rewards_ttl_ms.
+     *
+     * Rewards are only paid at epoch boundaries, so a balance cannot change before the next epoch starts. The end of
+     * the epoch is computed from the system clock and the network of the wrapped provider; on a network whose epochs
+     * are unknown, \ref rewards_ttl_ms is used instead. A \ref rewards_ttl_ms of zero still disables caching.
+     */
+    bool rewards_until_epoch_end;
+
+    /**
+     * \brief The maximum number of entries kept; the entry closest to expiring is evicted first. Zero means no limit.
+     */
+    size_t max_entries;
+
+    /**
+     * \brief The clock entries expire against, or NULL to use the system clock.
+     */
+    cardano_caching_provider_clock_func_t clock;
+
+    /**
+     * \brief The pointer passed to \ref clock.
+     */
+    void* clock_data;
+} cardano_caching_provider_options_t;
+
+/* FUNCTIONS *****************************************************************/
+
+/**
+ * \brief Fills caching provider options with their defaults.
+ *
+ * Protocol parameters are kept for a minute, rewards for 20 seconds, and UTxO queries for 2 seconds, long enough
+ * for the systems of one frame to share a single answer. Rewards are not kept until the end of their epoch unless asked. At most 4096 entries are kept, against the system clock.
+ *
+ * \param[out] options The options to fill. If NULL, the function has no effect.
+ */
+CARDANO_EXPORT void cardano_caching_provider_options_init(cardano_caching_provider_options_t* options);
+
+/**
+ * \brief Creates a provider that caches the answers of another one.
+ *
+ * Queries whose answer can change are served from the cache until their time to live runs out. Datums resolved by
+ * hash and outputs resolved by transaction ID and index are content addressed, so they are kept indefinitely, and
+ * a resolution only queries the inputs that are not cached yet, as does a batched rewards query for the
+ * addresses. Submitting a transaction through the caching
+ * provider drops every UTxO and rewards entry, as they may no longer hold. Evaluation and confirmation are always
+ * forwarded.
+ *
+ * Cached protocol parameters and UTxOs are frozen before they are shared, so every caller may keep them but none
+ * can modify them (see \ref cardano_object_freeze); each UTxO query returns its own list. Resolved datums are
+ * shared as they are and must not be modified.
+ *
+ * Like any \ref cardano_provider_t, the caching provider is not thread safe. Concurrent identical queries are
+ * coalesced by \ref cardano_async_provider_t instead.
+ *
+ * \param[in] provider The provider to forward cache misses to. The caching provider takes a reference to it.
+ * \param[in] options The cache options, or NULL for the defaults of \ref cardano_caching_provider_options_init.
+ * \param[out] caching_provider On success, the new provider. The caller must release it with \ref cardano_provider_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_caching_provider_new(
+  cardano_provider_t*                       provider,
+  const cardano_caching_provider_options_t* options,
+  cardano_provider_t**                      caching_provider);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_CACHING_PROVIDER_H
@@ -0,0 +1,155 @@
+/**
+ * \file multi_provider.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_MULTI_PROVIDER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_MULTI_PROVIDER_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/providers/async_provider.h>
+#include <cardano/providers/provider.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The largest number of endpoints a multi-endpoint provider can route between.
+ */
+#define CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS 8U
+
+/* CALLBACKS *****************************************************************/
+
+/**
+ * \brief Clock used by a multi-endpoint provider to time its endpoints.
+ *
+ * \param[in] clock_data The pointer given in \ref cardano_multi_provider_options_t.
+ *
+ * \return The current time in milliseconds. Only differences between two readings are used, so any epoch will do.
+ */
+typedef uint64_t (*cardano_multi_provider_clock_func_t)(void* clock_data);
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Options of a multi-endpoint provider.
+ */
+typedef struct cardano_multi_provider_options_t
+{
+    /**
+     * \brief Failures in a row after which an endpoint is set aside. Zero never sets one aside.
+     */
+    size_t max_consecutive_failures;
+
+    /**
+     * \brief How long an endpoint that was set aside is only used when every other endpoint is set aside too.
+     */
+    uint64_t failure_cooldown_ms;
+
+    /**
+     * \brief How many endpoints an asynchronous unspent outputs query is sent to at once; the first answer wins.
+     *
+     * One disables hedging. Blocking providers cannot hedge and ignore this option.
+     */
+    size_t hedge_count;
+
+    /**
+     * \brief The clock latencies are measured against, or NULL to use the system clock.
+     */
+    cardano_multi_provider_clock_func_t clock;
+
+    /**
+     * \brief The pointer passed to \ref clock.
+     */
+    void* clock_data;
+} cardano_multi_provider_options_t;
+
+/* FUNCTIONS *****************************************************************/
+
+/**
+ * \brief Fills multi-endpoint provider options with their defaults.
+ *
+ * An endpoint is set aside for 30 seconds after 3 failures in a row, and UTxO queries are hedged across the two
+ * best endpoints, against the system clock.
+ *
+ * \param[out] options The options to fill. If NULL, the function has no effect.
+ */
+CARDANO_EXPORT void cardano_multi_provider_options_init(cardano_multi_provider_options_t* options);
+
+/**
+ * \brief Creates a provider that routes each call to the best of several providers.
+ *
+ * The provider keeps the median and 99th percentile latency of the recent answers of every endpoint, along with a
+ * decaying error rate, and tries the endpoints from the fastest healthy one down: a call that fails on an endpoint
+ * is retried on the next. Endpoints that have not answered yet are tried first, so each gets measured.
+ *
+ * A transaction is submitted to every endpoint, and the submission succeeds if any of them accepts it. Rejections
+ * are not held against an endpoint, as a fanned out transaction is expected to be rejected as a duplicate.
+ *
+ * \param[in] providers The providers to route between. The new provider takes a reference to each.
+ * \param[in] provider_count The number of providers, between 1 and \ref CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS.
+ * \param[in] options The routing options, or NULL for the defaults of \ref cardano_multi_provider_options_init.
+ * \param[out] multi_provider On success, the new provider. The caller must release it with \ref cardano_provider_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ARGUMENT if the number of providers is out of
+ *         range, or another error code on failure.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_multi_provider_new(
+  cardano_provider_t**                    providers,
+  size_t                                  provider_count,
+  const cardano_multi_provider_options_t* options,
+  cardano_provider_t**                    multi_provider);
+
+/**
+ * \brief Creates an asynchronous provider that routes each query to the best of several asynchronous providers.
+ *
+ * Endpoints are ranked as in \ref cardano_multi_provider_new, and a failed query moves on to the next endpoint.
+ * Unspent outputs queries, which usually come right before building a transaction, are sent to the
+ * \ref cardano_multi_provider_options_t::hedge_count best endpoints at once; the first answer completes the request
+ * and the others are cancelled. Submissions start on every endpoint at once and complete with the first acceptance.
+ *
+ * \param[in] providers The providers to route between. The new provider takes a reference to each.
+ * \param[in] provider_count The number of providers, between 1 and \ref CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS.
+ * \param[in] options The routing options, or NULL for the defaults of \ref cardano_multi_provider_options_init.
+ * \param[out] multi_provider On success, the new provider. The caller must release it with
+ *                            \ref cardano_async_provider_unref.
+ *
+ * \return The same as \ref cardano_multi_provider_new.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_multi_async_provider_new(
+  cardano_async_provider_t**              providers,
+  size_t                                  provider_count,
+  const cardano_multi_provider_options_t* options,
+  cardano_async_provider_t**              multi_provider);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_MULTI_PROVIDER_H
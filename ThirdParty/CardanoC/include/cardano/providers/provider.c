@@ -91,7 +91,7 @@ cardano_provider_new(
 
   (*provider)->base.deallocator   = cardano_provider_deallocate;
   (*provider)->base.ref_count     = 1;
-  (*provider)->base.last_error[0] = '\0';
+  (*provider)->base.last_error    = NULL;
 
   (*provider)->impl = impl;
 
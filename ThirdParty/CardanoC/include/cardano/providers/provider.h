@@ -276,6 +276,48 @@ CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t
 cardano_provider_get_rewards_available(cardano_provider_t* provider, cardano_reward_address_t* address, uint64_t* rewards);
 
+/**
+ * \brief Retrieves the staking rewards of several addresses at once.
+ *
+ * Providers that can query many stake addresses per request, such as Koios with `account_info`, or that can run
+ * requests concurrently, such as Blockfrost, answer the whole list in as few round trips as they can. Other
+ * providers are queried once per address with \ref cardano_provider_get_rewards_available.
+ *
+ * \param[in]  provider     Pointer to the \ref cardano_provider_t instance. Must not be `NULL`.
+ * \param[in]  addresses    The reward addresses for which to retrieve staking rewards. Must not be `NULL`.
+ * \param[out] rewards      An array where the function will store the rewards (in Lovelace) of each address, in the
+ *                          order of `addresses`. An address that never received rewards gets 0. Must not be `NULL`.
+ * \param[in]  rewards_size The number of entries of `rewards`, at least the length of `addresses`.
+ *
+ * \returns \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE if `rewards` is too small,
+ *          or another error code for provider-specific failures, in which case the content of `rewards` is undefined.
+ *
+ * Example:
+ * \code{.c}
+ * const size_t count   = cardano_reward_address_list_get_length(addresses);
+ * uint64_t*    rewards = malloc(count * sizeof(uint64_t));
+ *
+ * cardano_error_t result = cardano_provider_get_rewards_available_batch(provider, addresses, rewards, count);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   for (size_t i = 0; i < count; ++i)
+ *   {
+ *     printf("Rewards: %llu Lovelace\n", rewards[i]);
+ *   }
+ * }
+ *
+ * free(rewards);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_provider_get_rewards_available_batch(
+  cardano_provider_t*            provider,
+  cardano_reward_address_list_t* addresses,
+  uint64_t*                      rewards,
+  size_t                         rewards_size);
+
 /**
  * \brief Retrieves unspent transaction outputs (UTXOs) for a given address that contain a specific asset.
  *
@@ -470,6 +512,43 @@ CARDANO_EXPORT cardano_error_t cardano_provider_resolve_unspent_outputs(
 CARDANO_EXPORT cardano_error_t
 cardano_provider_resolve_datum(cardano_provider_t* provider, cardano_blake2b_hash_t* datum_hash, cardano_plutus_data_t** datum);
 
+/**
+ * \brief Resolves several Plutus datums from their hashes at once.
+ *
+ * Providers that accept many datum hashes per request, such as Koios with `datum_info`, answer the whole set in as
+ * few round trips as they can. Other providers are queried once per hash with \ref cardano_provider_resolve_datum.
+ *
+ * \param[in]  provider     Pointer to the \ref cardano_provider_t instance. Must not be `NULL`.
+ * \param[in]  datum_hashes The hashes of the datums to resolve. Must not be `NULL`.
+ * \param[out] datums       On success, a new list holding one datum per hash, in the order of `datum_hashes`. The
+ *                          caller must release it with \ref cardano_plutus_list_unref.
+ *
+ * \returns \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if one of the datums is unknown to
+ *          the provider, or another error code for provider-specific failures.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_plutus_list_t* datums = NULL;
+ * cardano_error_t result = cardano_provider_resolve_datums(provider, datum_hashes, &datums);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   for (size_t i = 0; i < cardano_plutus_list_get_length(datums); ++i)
+ *   {
+ *     // The datum of the i-th hash
+ *   }
+ *
+ *   cardano_plutus_list_unref(&datums);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_provider_resolve_datums(
+  cardano_provider_t*         provider,
+  cardano_blake2b_hash_set_t* datum_hashes,
+  cardano_plutus_list_t**     datums);
+
 /**
  * \brief Confirms the inclusion of a transaction in the blockchain within a specified timeout period.
  *
@@ -27,11 +27,14 @@
 #include <cardano/address/address.h>
 #include <cardano/assets/asset_id.h>
 #include <cardano/common/network_magic.h>
+#include <cardano/common/reward_address_list.h>
 #include <cardano/common/utxo.h>
 #include <cardano/common/utxo_list.h>
 #include <cardano/crypto/blake2b_hash.h>
+#include <cardano/crypto/blake2b_hash_set.h>
 #include <cardano/error.h>
 #include <cardano/object.h>
+#include <cardano/plutus_data/plutus_list.h>
 #include <cardano/protocol_params/protocol_parameters.h>
 #include <cardano/transaction/transaction.h>
 #include <cardano/transaction_body/transaction_input_set.h>
@@ -108,6 +111,23 @@ typedef cardano_error_t (*cardano_get_rewards_balance_func_t)(
   cardano_reward_address_t* address,
   uint64_t*                 rewards);
 
+/**
+ * \brief Function pointer type for retrieving the staking rewards of several addresses at once.
+ *
+ * \param[in]  provider_impl Pointer to the provider implementation instance.
+ *                           Must not be `NULL`.
+ * \param[in]  addresses     The reward addresses for which to retrieve staking rewards. Must not be `NULL`.
+ * \param[out] rewards       An array of one entry per address, in the order of `addresses`, where the function will
+ *                           store the amount of rewards (in Lovelace) of each. An address without rewards gets 0.
+ *
+ * \returns A \ref cardano_error_t indicating success or failure of the operation.
+ *          - Other error codes for provider-specific failures.
+ */
+typedef cardano_error_t (*cardano_get_rewards_balances_func_t)(
+  cardano_provider_impl_t*       provider_impl,
+  cardano_reward_address_list_t* addresses,
+  uint64_t*                      rewards);
+
 /**
  * \brief Function pointer type for retrieving unspent outputs for an address and specific asset.
  *
@@ -171,6 +191,22 @@ typedef cardano_error_t (*cardano_resolve_datum_func_t)(
   cardano_blake2b_hash_t*  datum_hash,
   cardano_plutus_data_t**  datum);
 
+/**
+ * \brief Function pointer type for resolving several Plutus datums from their hashes at once.
+ *
+ * \param[in]  provider_impl Pointer to the provider implementation instance.
+ * \param[in]  datum_hashes  The hashes of the datums to resolve. Must not be `NULL`.
+ * \param[out] datums        On success, a new list holding one datum per hash, in the order of `datum_hashes`.
+ *
+ * \returns A \ref cardano_error_t indicating success or failure of the operation.
+ *          - \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if one of the datums is unknown to the provider.
+ *          - Other error codes for provider-specific failures.
+ */
+typedef cardano_error_t (*cardano_resolve_datums_func_t)(
+  cardano_provider_impl_t*    provider_impl,
+  cardano_blake2b_hash_set_t* datum_hashes,
+  cardano_plutus_list_t**     datums);
+
 /**
  * \brief Function pointer type for confirming a transaction's inclusion in the blockchain.
  *
@@ -324,6 +360,24 @@ typedef struct cardano_provider_impl_t
      * \see cardano_evaluate_transaction_func_t
      */
     cardano_evaluate_transaction_func_t evaluate_transaction;
+
+    /**
+     * \brief Function to retrieve the staking rewards of several addresses in as few requests as the backend allows.
+     *
+     * Optional: when `NULL`, \ref get_rewards_balance is called for each address instead.
+     *
+     * \see cardano_get_rewards_balances_func_t
+     */
+    cardano_get_rewards_balances_func_t get_rewards_balances;
+
+    /**
+     * \brief Function to resolve several datums in as few requests as the backend allows.
+     *
+     * Optional: when `NULL`, \ref resolve_datum is called for each hash instead.
+     *
+     * \see cardano_resolve_datums_func_t
+     */
+    cardano_resolve_datums_func_t resolve_datums;
 } cardano_provider_impl_t;
 
 #ifdef __cplusplus
@@ -0,0 +1,387 @@
+/**
+ * \file provider_request.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_PROVIDER_REQUEST_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_PROVIDER_REQUEST_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/common/utxo_list.h>
+#include <cardano/crypto/blake2b_hash.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/protocol_params/protocol_parameters.h>
+#include <cardano/typedefs.h>
+#include <cardano/witness_set/redeemer_list.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Handle to one in-flight query of an asynchronous provider.
+ *
+ * A request is created when an asynchronous provider call starts and is completed exactly once, either by the
+ * provider implementation when the answer arrives or by \ref cardano_provider_request_cancel. The completion callback
+ * given when the call started runs when the implementation completes the request, unless it was cancelled first.
+ */
+typedef struct cardano_provider_request_t cardano_provider_request_t;
+
+/* ENUMERATIONS **************************************************************/
+
+/**
+ * \brief The operation a provider request performs.
+ */
+typedef enum
+{
+  /**
+   * \brief Retrieves the protocol parameters.
+   */
+  CARDANO_PROVIDER_REQUEST_TYPE_GET_PARAMETERS = 0,
+
+  /**
+   * \brief Retrieves the unspent outputs of an address.
+   */
+  CARDANO_PROVIDER_REQUEST_TYPE_GET_UNSPENT_OUTPUTS = 1,
+
+  /**
+   * \brief Submits a transaction to the network.
+   */
+  CARDANO_PROVIDER_REQUEST_TYPE_SUBMIT_TRANSACTION = 2,
+
+  /**
+   * \brief Evaluates the execution units of a transaction.
+   */
+  CARDANO_PROVIDER_REQUEST_TYPE_EVALUATE_TRANSACTION = 3,
+
+  /**
+   * \brief Waits for a transaction to be included in a block.
+   */
+  CARDANO_PROVIDER_REQUEST_TYPE_CONFIRM_TRANSACTION = 4,
+} cardano_provider_request_type_t;
+
+/**
+ * \brief The state of a provider request.
+ */
+typedef enum
+{
+  /**
+   * \brief The request is in flight.
+   */
+  CARDANO_PROVIDER_REQUEST_STATE_PENDING = 0,
+
+  /**
+   * \brief The request completed successfully and its callback ran.
+   */
+  CARDANO_PROVIDER_REQUEST_STATE_COMPLETED = 1,
+
+  /**
+   * \brief The request failed and its callback ran with the error.
+   */
+  CARDANO_PROVIDER_REQUEST_STATE_FAILED = 2,
+
+  /**
+   * \brief The request was cancelled before it completed; its callback never runs.
+   */
+  CARDANO_PROVIDER_REQUEST_STATE_CANCELLED = 3,
+} cardano_provider_request_state_t;
+
+/* CALLBACKS *****************************************************************/
+
+/**
+ * \brief Completion callback of an asynchronous protocol parameters query.
+ *
+ * \param[in] request The completed request.
+ * \param[in] result \ref CARDANO_SUCCESS, or the error the query failed with. The error message is available through
+ *                   \ref cardano_provider_request_get_last_error.
+ * \param[in] parameters The protocol parameters, or NULL on failure. The callback does not own them; it must take a
+ *                       reference to keep them beyond the call.
+ * \param[in] user_data The pointer given when the query started.
+ */
+typedef void (*cardano_parameters_callback_t)(
+  cardano_provider_request_t*    request,
+  cardano_error_t                result,
+  cardano_protocol_parameters_t* parameters,
+  void*                          user_data);
+
+/**
+ * \brief Completion callback of an asynchronous unspent outputs query.
+ *
+ * \param[in] request The completed request.
+ * \param[in] result \ref CARDANO_SUCCESS, or the error the query failed with.
+ * \param[in] utxo_list The unspent outputs, or NULL on failure. The callback does not own the list.
+ * \param[in] user_data The pointer given when the query started.
+ */
+typedef void (*cardano_utxo_list_callback_t)(
+  cardano_provider_request_t* request,
+  cardano_error_t             result,
+  cardano_utxo_list_t*        utxo_list,
+  void*                       user_data);
+
+/**
+ * \brief Completion callback of an asynchronous transaction submission.
+ *
+ * \param[in] request The completed request.
+ * \param[in] result \ref CARDANO_SUCCESS, or the error the submission failed with.
+ * \param[in] tx_id The id of the submitted transaction, or NULL on failure. The callback does not own the hash.
+ * \param[in] user_data The pointer given when the submission started.
+ */
+typedef void (*cardano_tx_id_callback_t)(
+  cardano_provider_request_t* request,
+  cardano_error_t             result,
+  cardano_blake2b_hash_t*     tx_id,
+  void*                       user_data);
+
+/**
+ * \brief Completion callback of an asynchronous transaction evaluation.
+ *
+ * \param[in] request The completed request.
+ * \param[in] result \ref CARDANO_SUCCESS, or the error the evaluation failed with.
+ * \param[in] redeemers The redeemers with their execution units, or NULL on failure. The callback does not own the
+ *                      list.
+ * \param[in] user_data The pointer given when the evaluation started.
+ */
+typedef void (*cardano_redeemer_list_callback_t)(
+  cardano_provider_request_t* request,
+  cardano_error_t             result,
+  cardano_redeemer_list_t*    redeemers,
+  void*                       user_data);
+
+/**
+ * \brief Completion callback of an asynchronous transaction confirmation.
+ *
+ * \param[in] request The completed request.
+ * \param[in] result \ref CARDANO_SUCCESS, or the error the confirmation failed with.
+ * \param[in] confirmed Whether the transaction was included in a block before the timeout.
+ * \param[in] user_data The pointer given when the confirmation started.
+ */
+typedef void (*cardano_confirmation_callback_t)(
+  cardano_provider_request_t* request,
+  cardano_error_t             result,
+  bool                        confirmed,
+  void*                       user_data);
+
+/**
+ * \brief Function a provider implementation registers to abort the work behind a request.
+ *
+ * \param[in] request The request being cancelled.
+ * \param[in] cancel_data The pointer given to \ref cardano_provider_request_set_cancel_handler.
+ */
+typedef void (*cardano_provider_request_cancel_func_t)(cardano_provider_request_t* request, void* cancel_data);
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Gets the operation a request performs.
+ *
+ * \param[in] request The request.
+ *
+ * \return The type of the request, or \ref CARDANO_PROVIDER_REQUEST_TYPE_GET_PARAMETERS if \p request is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_provider_request_type_t cardano_provider_request_get_type(const cardano_provider_request_t* request);
+
+/**
+ * \brief Gets the state of a request.
+ *
+ * \param[in] request The request.
+ *
+ * \return The state of the request, or \ref CARDANO_PROVIDER_REQUEST_STATE_CANCELLED if \p request is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_provider_request_state_t cardano_provider_request_get_state(const cardano_provider_request_t* request);
+
+/**
+ * \brief Gets the result a request completed with.
+ *
+ * \param[in] request The request.
+ *
+ * \return \ref CARDANO_SUCCESS if the request completed successfully, the error it failed with, \ref CARDANO_ERROR_ILLEGAL_STATE
+ *         if it is still pending or was cancelled, or \ref CARDANO_ERROR_POINTER_IS_NULL if \p request is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_provider_request_get_result(const cardano_provider_request_t* request);
+
+/**
+ * \brief Cancels a pending request.
+ *
+ * The request moves to \ref CARDANO_PROVIDER_REQUEST_STATE_CANCELLED and its completion callback will not run. If the
+ * implementation registered a cancel handler, it is called so the underlying work can be aborted. Cancelling a request
+ * that already completed does nothing.
+ *
+ * \param[in] request The request to cancel.
+ *
+ * \return \ref CARDANO_SUCCESS if the request was cancelled or had already completed, or
+ *         \ref CARDANO_ERROR_POINTER_IS_NULL if \p request is NULL.
+ */
+CARDANO_EXPORT cardano_error_t cardano_provider_request_cancel(cardano_provider_request_t* request);
+
+/**
+ * \brief Registers the function that aborts the work behind a request.
+ *
+ * Provider implementations call this when they start the work, for example to cancel the HTTP request carrying the
+ * query. The handler runs at most once, from \ref cardano_provider_request_cancel.
+ *
+ * \param[in] request The request.
+ * \param[in] cancel The handler, or NULL to remove it.
+ * \param[in] cancel_data A pointer passed to the handler.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_POINTER_IS_NULL if \p request is NULL.
+ */
+CARDANO_EXPORT cardano_error_t cardano_provider_request_set_cancel_handler(
+  cardano_provider_request_t*            request,
+  cardano_provider_request_cancel_func_t cancel,
+  void*                                  cancel_data);
+
+/**
+ * \brief Completes a protocol parameters request and runs its callback.
+ *
+ * Provider implementations call this once the answer has arrived. The request does not keep the parameters; they are
+ * only lent to the callback.
+ *
+ * \param[in] request The request to complete.
+ * \param[in] parameters The protocol parameters.
+ *
+ * \return \ref CARDANO_SUCCESS if the request was completed or had been cancelled, \ref CARDANO_ERROR_INVALID_ARGUMENT
+ *         if the request is of another type, \ref CARDANO_ERROR_ILLEGAL_STATE if it already completed, or
+ *         \ref CARDANO_ERROR_POINTER_IS_NULL if an argument is NULL.
+ */
+CARDANO_EXPORT cardano_error_t cardano_provider_request_complete_parameters(
+  cardano_provider_request_t*    request,
+  cardano_protocol_parameters_t* parameters);
+
+/**
+ * \brief Completes an unspent outputs request and runs its callback.
+ *
+ * \param[in] request The request to complete.
+ * \param[in] utxo_list The unspent outputs.
+ *
+ * \return The same as \ref cardano_provider_request_complete_parameters.
+ */
+CARDANO_EXPORT cardano_error_t cardano_provider_request_complete_utxo_list(
+  cardano_provider_request_t* request,
+  cardano_utxo_list_t*        utxo_list);
+
+/**
+ * \brief Completes a transaction submission request and runs its callback.
+ *
+ * \param[in] request The request to complete.
+ * \param[in] tx_id The id of the submitted transaction.
+ *
+ * \return The same as \ref cardano_provider_request_complete_parameters.
+ */
+CARDANO_EXPORT cardano_error_t cardano_provider_request_complete_tx_id(
+  cardano_provider_request_t* request,
+  cardano_blake2b_hash_t*     tx_id);
+
+/**
+ * \brief Completes a transaction evaluation request and runs its callback.
+ *
+ * \param[in] request The request to complete.
+ * \param[in] redeemers The redeemers with their execution units.
+ *
+ * \return The same as \ref cardano_provider_request_complete_parameters.
+ */
+CARDANO_EXPORT cardano_error_t cardano_provider_request_complete_redeemers(
+  cardano_provider_request_t* request,
+  cardano_redeemer_list_t*    redeemers);
+
+/**
+ * \brief Completes a transaction confirmation request and runs its callback.
+ *
+ * \param[in] request The request to complete.
+ * \param[in] confirmed Whether the transaction was included in a block before the timeout.
+ *
+ * \return The same as \ref cardano_provider_request_complete_parameters.
+ */
+CARDANO_EXPORT cardano_error_t cardano_provider_request_complete_confirmation(
+  cardano_provider_request_t* request,
+  bool                        confirmed);
+
+/**
+ * \brief Fails a request of any type and runs its callback with the error and no result.
+ *
+ * \param[in] request The request to fail.
+ * \param[in] error The error the request failed with; must not be \ref CARDANO_SUCCESS.
+ * \param[in] message A description of the failure, stored as the last error of the request, or NULL.
+ *
+ * \return \ref CARDANO_SUCCESS if the request was failed or had been cancelled, \ref CARDANO_ERROR_INVALID_ARGUMENT
+ *         if \p error is \ref CARDANO_SUCCESS, \ref CARDANO_ERROR_ILLEGAL_STATE if the request already completed, or
+ *         \ref CARDANO_ERROR_POINTER_IS_NULL if \p request is NULL.
+ */
+CARDANO_EXPORT cardano_error_t cardano_provider_request_fail(
+  cardano_provider_request_t* request,
+  cardano_error_t             error,
+  const char*                 message);
+
+/**
+ * \brief Decrements the reference count of a provider request and sets `*request` to NULL.
+ *
+ * When the reference count reaches zero the request is deallocated. Releasing a pending request does not cancel it;
+ * the provider implementation holds its own reference until it completes the request.
+ *
+ * \param[in,out] request A pointer to the request pointer.
+ */
+CARDANO_EXPORT void cardano_provider_request_unref(cardano_provider_request_t** request);
+
+/**
+ * \brief Increases the reference count of a provider request.
+ *
+ * \param[in] request The request.
+ */
+CARDANO_EXPORT void cardano_provider_request_ref(cardano_provider_request_t* request);
+
+/**
+ * \brief Retrieves the current reference count of a provider request.
+ *
+ * \param[in] request The request.
+ *
+ * \return The number of references to the request, or zero if \p request is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_provider_request_refcount(const cardano_provider_request_t* request);
+
+/**
+ * \brief Sets the last error message of a provider request.
+ *
+ * \param[in] request The request. If NULL, the function does nothing.
+ * \param[in] message A null-terminated message. If NULL, the last error is left unchanged. Messages longer than
+ *                    1023 characters are truncated.
+ */
+CARDANO_EXPORT void cardano_provider_request_set_last_error(cardano_provider_request_t* request, const char* message);
+
+/**
+ * \brief Retrieves the last error message of a provider request.
+ *
+ * \param[in] request The request.
+ *
+ * \return The last error message, an empty string if there is none, or "Object is NULL." if \p request is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_provider_request_get_last_error(const cardano_provider_request_t* request);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_PROVIDER_REQUEST_H
@@ -0,0 +1,230 @@
+/**
+ * \file compiled_native_script.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_COMPILED_NATIVE_SCRIPT_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_COMPILED_NATIVE_SCRIPT_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/crypto/blake2b_hash.h>
+#include <cardano/crypto/blake2b_hash_set.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/scripts/native_scripts/native_script.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief A native script prepared once for repeated use.
+ *
+ * Compiling a native script takes an immutable snapshot of it and derives, in a single pass, everything spending from
+ * it needs: its hash, the set of key hashes it refers to, the smallest number of signatures that can satisfy it, and
+ * the slot bounds of its timelocks. These are then returned without walking or encoding the script again, which
+ * matters for wallets such as n-of-k multisig treasuries that spend from the same script in every transaction.
+ *
+ * Later changes to the script it was compiled from are not reflected; compile the script again instead.
+ */
+typedef struct cardano_compiled_native_script_t cardano_compiled_native_script_t;
+
+/**
+ * \brief Compiles a native script.
+ *
+ * \param[in] native_script The native script to compile. It is not modified.
+ * \param[out] compiled_native_script On success, the compiled script.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL, or the error
+ * raised while encoding or decoding the script.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_native_script_t*          treasury = ...; // Assume an n-of-k script
+ * cardano_compiled_native_script_t* compiled = NULL;
+ *
+ * cardano_error_t result = cardano_compiled_native_script_new(treasury, &compiled);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   printf("Signatures needed: %zu\n", cardano_compiled_native_script_get_min_signer_count(compiled));
+ * }
+ *
+ * cardano_compiled_native_script_unref(&compiled);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_compiled_native_script_new(
+  cardano_native_script_t*           native_script,
+  cardano_compiled_native_script_t** compiled_native_script);
+
+/**
+ * \brief Gets the snapshot of the native script that was compiled.
+ *
+ * The script is frozen, so it can be shared freely and its hash is not computed again.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ *
+ * \return A new reference to the native script, or NULL if \p compiled_native_script is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_native_script_t* cardano_compiled_native_script_get_script(
+  cardano_compiled_native_script_t* compiled_native_script);
+
+/**
+ * \brief Gets the hash of the compiled script.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ *
+ * \return A new reference to the hash, or NULL if \p compiled_native_script is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_blake2b_hash_t* cardano_compiled_native_script_get_hash(
+  cardano_compiled_native_script_t* compiled_native_script);
+
+/**
+ * \brief Gets the key hashes the compiled script refers to, each listed once.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ *
+ * \return A new reference to the set of key hashes, or NULL if \p compiled_native_script is NULL. The set is shared
+ * by every caller and must not be modified.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_blake2b_hash_set_t* cardano_compiled_native_script_get_key_hashes(
+  cardano_compiled_native_script_t* compiled_native_script);
+
+/**
+ * \brief Gets the number of signatures needed to satisfy the compiled script, assuming its timelocks are met.
+ *
+ * This is the number of verification key witnesses fee estimation should account for when spending from the script.
+ * It is exact when no key appears in more than one branch (for an n-of-k script over distinct keys it is n), and
+ * otherwise may overshoot the true minimum, but never exceeds the number of distinct keys in the script.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ *
+ * \return The number of signatures, or `SIZE_MAX` if no set of signatures satisfies the script (for instance an `any`
+ * script without sub-scripts). Zero if \p compiled_native_script is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_compiled_native_script_get_min_signer_count(
+  const cardano_compiled_native_script_t* compiled_native_script);
+
+/**
+ * \brief Gets the latest `invalid before` slot found in the compiled script.
+ *
+ * A transaction whose validity interval starts at this slot (or later) satisfies every `invalid before` timelock of
+ * the script.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ *
+ * \return A pointer to the slot, owned by the compiled script, or NULL if the script has no such timelock.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const uint64_t* cardano_compiled_native_script_get_invalid_before(
+  const cardano_compiled_native_script_t* compiled_native_script);
+
+/**
+ * \brief Gets the earliest `invalid hereafter` slot found in the compiled script.
+ *
+ * A transaction whose validity interval ends at this slot (or earlier) satisfies every `invalid hereafter` timelock
+ * of the script.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ *
+ * \return A pointer to the slot, owned by the compiled script, or NULL if the script has no such timelock.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const uint64_t* cardano_compiled_native_script_get_invalid_hereafter(
+  const cardano_compiled_native_script_t* compiled_native_script);
+
+/**
+ * \brief Evaluates the compiled script against a set of signers and a validity interval, as the ledger does.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ * \param[in] signers The key hashes of the signatures the transaction carries. May be NULL if there are none.
+ * \param[in] invalid_before The first slot of the validity interval, or NULL if the interval is unbounded below.
+ * \param[in] invalid_hereafter The slot the validity interval ends at, or NULL if the interval is unbounded above.
+ * \param[out] is_satisfied On success, whether the script is satisfied.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p compiled_native_script or
+ * \p is_satisfied is NULL, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_compiled_native_script_evaluate(
+  const cardano_compiled_native_script_t* compiled_native_script,
+  const cardano_blake2b_hash_set_t*       signers,
+  const uint64_t*                         invalid_before,
+  const uint64_t*                         invalid_hereafter,
+  bool*                                   is_satisfied);
+
+/**
+ * \brief Decrements the reference count of a compiled native script, freeing it when it reaches zero.
+ *
+ * \param[in,out] compiled_native_script A pointer to the compiled script pointer, set to NULL when it is freed.
+ */
+CARDANO_EXPORT void cardano_compiled_native_script_unref(cardano_compiled_native_script_t** compiled_native_script);
+
+/**
+ * \brief Increments the reference count of a compiled native script.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ */
+CARDANO_EXPORT void cardano_compiled_native_script_ref(cardano_compiled_native_script_t* compiled_native_script);
+
+/**
+ * \brief Retrieves the reference count of a compiled native script.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ *
+ * \return The reference count, or zero if \p compiled_native_script is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_compiled_native_script_refcount(const cardano_compiled_native_script_t* compiled_native_script);
+
+/**
+ * \brief Records an error message on a compiled native script.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ * \param[in] message The message, truncated to 1023 characters. NULL clears the message.
+ */
+CARDANO_EXPORT void cardano_compiled_native_script_set_last_error(
+  cardano_compiled_native_script_t* compiled_native_script,
+  const char*                       message);
+
+/**
+ * \brief Retrieves the last error message recorded on a compiled native script.
+ *
+ * \param[in] compiled_native_script The compiled script.
+ *
+ * \return The message, or an empty string if none was recorded. NULL if \p compiled_native_script is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT const char* cardano_compiled_native_script_get_last_error(
+  const cardano_compiled_native_script_t* compiled_native_script);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_COMPILED_NATIVE_SCRIPT_H
@@ -786,7 +786,8 @@ CARDANO_EXPORT cardano_error_t cardano_native_script_to_invalid_before(
 /**
  * \brief Retrieves the hash associated with a native_script.
  *
- * This computes and returns the hash of a \ref cardano_native_script_t object.
+ * This computes and returns the hash of a \ref cardano_native_script_t object. Frozen scripts return the hash computed
+ * by \ref cardano_native_script_freeze instead of serializing and hashing the script again.
  * It returns a new reference to a \ref cardano_blake2b_hash_t object representing the hash.
  *
  * \param native_script A constant pointer to the \ref cardano_native_script_t object from which
@@ -852,6 +853,28 @@ CARDANO_EXPORT bool cardano_native_script_equals(
   const cardano_native_script_t* lhs,
   const cardano_native_script_t* rhs);
 
+/**
+ * \brief Freezes a native script, making it immutable.
+ *
+ * Nested scripts of `all`, `any` and `n of k` scripts are frozen recursively, together with their lists, so changing a slot, a required count or a list of scripts anywhere in the tree fails with \ref CARDANO_ERROR_OBJECT_IS_FROZEN.
+ *
+ * Freezing cannot be undone, and the cached CBOR encoding is kept as is. The hash of the script is computed at this
+ * point and returned from a cache by later calls to the hash getter.
+ *
+ * \param[in] native_script The native script to freeze. If NULL, the function has no effect.
+ */
+CARDANO_EXPORT void cardano_native_script_freeze(cardano_native_script_t* native_script);
+
+/**
+ * \brief Checks whether a native script has been frozen with \ref cardano_native_script_freeze.
+ *
+ * \param[in] native_script The native script to check.
+ *
+ * \return \c true if the native script is frozen; \c false otherwise, or if `native_script` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_native_script_is_frozen(const cardano_native_script_t* native_script);
+
 /**
  * \brief Decrements the reference count of a native_script object.
  *
@@ -285,7 +285,8 @@ CARDANO_EXPORT cardano_error_t cardano_plutus_v2_script_to_raw_bytes(
 /**
  * \brief Retrieves the hash associated with a plutus_v2_script.
  *
- * This function computes the hash of a \ref cardano_plutus_v2_script_t object.
+ * This function computes the hash of a \ref cardano_plutus_v2_script_t object. The compiled code cannot change, so the
+ * hash is computed on the first call and returned from a cache afterwards.
  * It returns a new reference to a \ref cardano_blake2b_hash_t object representing the hash.
  * It the caller's responsibility to release it by calling \ref cardano_blake2b_hash_unref when
  * it is no longer needed.
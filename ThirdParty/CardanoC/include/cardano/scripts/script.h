@@ -618,6 +618,28 @@ CARDANO_EXPORT cardano_blake2b_hash_t* cardano_script_get_hash(const cardano_scr
 CARDANO_NODISCARD
 CARDANO_EXPORT bool cardano_script_equals(const cardano_script_t* lhs, const cardano_script_t* rhs);
 
+/**
+ * \brief Freezes a script, making it immutable.
+ *
+ * The wrapped native or Plutus script is frozen too; for native scripts this includes every nested script, so the setters of any of them fail with \ref CARDANO_ERROR_OBJECT_IS_FROZEN.
+ *
+ * Freezing cannot be undone, and the cached CBOR encoding is kept as is. The hash of the script is computed at this
+ * point and returned from a cache by later calls to the hash getter.
+ *
+ * \param[in] script The script to freeze. If NULL, the function has no effect.
+ */
+CARDANO_EXPORT void cardano_script_freeze(cardano_script_t* script);
+
+/**
+ * \brief Checks whether a script has been frozen with \ref cardano_script_freeze.
+ *
+ * \param[in] script The script to check.
+ *
+ * \return \c true if the script is frozen; \c false otherwise, or if `script` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_script_is_frozen(const cardano_script_t* script);
+
 /**
  * \brief Decrements the reference count of a script object.
  *
@@ -116,6 +116,29 @@ CARDANO_EXPORT uint64_t cardano_compute_unix_time_from_slot(cardano_network_magi
 CARDANO_NODISCARD
 CARDANO_EXPORT uint64_t cardano_compute_epoch_from_unix_time(cardano_network_magic_t magic, uint64_t unix_time);
 
+/**
+ * \brief Computes the Unix time at which a given epoch starts.
+ *
+ * This is the inverse of \ref cardano_compute_epoch_from_unix_time: the start of the epoch after the current one is
+ * when rewards and stake distributions next change.
+ *
+ * \param[in] magic The \ref cardano_network_magic_t that specifies the network identifier.
+ * \param[in] epoch The epoch number. Epochs before the first one the network configuration describes (the start of
+ *                  Shelley on mainnet) map to the start of that one.
+ *
+ * \return The Unix timestamp in seconds at which the epoch starts, or `UINT64_MAX` if the network is unknown.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const uint64_t epoch      = cardano_compute_epoch_from_unix_time(CARDANO_NETWORK_MAGIC_MAINNET, time(NULL));
+ * const uint64_t next_epoch = cardano_compute_unix_time_from_epoch(CARDANO_NETWORK_MAGIC_MAINNET, epoch + 1U);
+ *
+ * printf("Epoch %llu ends at %llu\n", epoch, next_epoch);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT uint64_t cardano_compute_unix_time_from_epoch(cardano_network_magic_t magic, uint64_t epoch);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -33,12 +33,44 @@
 #include <cardano/typedefs.h>
 #include <cardano/witness_set/witness_set.h>
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Size in bytes from which \ref cardano_transaction_from_cbor_parallel hands the parts of a transaction to its
+ *        parallel-for. Smaller transactions decode faster on the calling thread than the tasks would cost to schedule.
+ */
+#ifndef CARDANO_TRANSACTION_PARALLEL_DECODE_MIN_SIZE
+#define CARDANO_TRANSACTION_PARALLEL_DECODE_MIN_SIZE 16384U
+#endif
+
 /* DECLARATIONS **************************************************************/
 
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
+/**
+ * \brief One task of a \ref cardano_parallel_for_t call.
+ *
+ * \param[in] data The data given to the parallel-for along with the task.
+ * \param[in] index The index of the task, from zero to the task count excluded.
+ */
+typedef void (*cardano_parallel_task_t)(void* data, size_t index);
+
+/**
+ * \brief Runs `count` independent tasks, possibly concurrently, and returns once they have all completed.
+ *
+ * The library has no threads of its own: a function of this type lets the application run work on the threads it
+ * already has, such as a thread pool, OpenMP or Unreal Engine's `ParallelFor`. Running the tasks one after the other
+ * on the calling thread is a valid implementation.
+ *
+ * \param[in] context The context given along with the function.
+ * \param[in] count The number of tasks.
+ * \param[in] task The task to call once for every index in `[0, count)`.
+ * \param[in] data The data to pass to every call of `task`.
+ */
+typedef void (*cardano_parallel_for_t)(void* context, size_t count, cardano_parallel_task_t task, void* data);
+
 /**
  * \brief A transaction is a record of value transfer between two or more addresses on the network. It represents a request
  * to modify the state of the blockchain, by transferring a certain amount of ADA or a native asset from one address
@@ -153,6 +185,147 @@ CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t
 cardano_transaction_from_cbor(cardano_cbor_reader_t* reader, cardano_transaction_t** transaction);
 
+/**
+ * \brief Creates a \ref cardano_transaction_t from a CBOR reader, deferring the decoding of the witness set and the
+ *        auxiliary data.
+ *
+ * This function behaves like \ref cardano_transaction_from_cbor, but only the transaction body is decoded right away.
+ * The witness set and the auxiliary data, usually the bulk of a transaction (scripts, plutus data, metadata), are
+ * kept as their original CBOR encoding and decoded the first time they are accessed through
+ * \ref cardano_transaction_get_witness_set or \ref cardano_transaction_get_auxiliary_data (or any function using
+ * them). Until then, \ref cardano_transaction_to_cbor writes the retained bytes unchanged.
+ *
+ * This makes read-mostly workloads, such as computing the transaction id with \ref cardano_transaction_get_id or
+ * forwarding a transaction, much cheaper.
+ *
+ * \param[in] reader A pointer to an initialized \ref cardano_cbor_reader_t that is ready to read the CBOR-encoded data.
+ * \param[out] transaction A pointer to a pointer of \ref cardano_transaction_t that will be set to the address
+ *                        of the newly created transaction object upon successful decoding.
+ *
+ * \return A \ref cardano_error_t value indicating the outcome of the operation. Returns \ref CARDANO_SUCCESS
+ *         if the transaction were successfully created, or an appropriate error code if an error occurred.
+ *
+ * \note The deferred parts are only checked to be well-formed CBOR by this function. If decoding one of them fails
+ *       later, its getter returns NULL and the reason can be retrieved with \ref cardano_transaction_get_last_error.
+ *       \ref cardano_transaction_clear_cbor_cache decodes both parts before clearing the caches.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_cbor_reader_t* reader      = cardano_cbor_reader_new(cbor_data, data_size);
+ * cardano_transaction_t* transaction = NULL;
+ *
+ * cardano_error_t result = cardano_transaction_from_cbor_lazy(reader, &transaction);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   // Only the body is hashed; the witness set is never decoded.
+ *   cardano_blake2b_hash_t* id = cardano_transaction_get_id(transaction);
+ *
+ *   cardano_blake2b_hash_unref(&id);
+ *   cardano_transaction_unref(&transaction);
+ * }
+ *
+ * cardano_cbor_reader_unref(&reader);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_transaction_from_cbor_lazy(cardano_cbor_reader_t* reader, cardano_transaction_t** transaction);
+
+/**
+ * \brief Creates a \ref cardano_transaction_t from a CBOR reader, decoding its body, witness set and auxiliary data
+ *        concurrently.
+ *
+ * The three parts of a transaction are independent CBOR items. This function first locates their boundaries with a
+ * skip scan, which only reads the headers of the items, then decodes each part from its own reader as one task of
+ * `parallel_for`. Large smart contract transactions, whose witness set holds big scripts, datums and redeemers, decode
+ * with a lower latency. The result is the same as the one of \ref cardano_transaction_from_cbor.
+ *
+ * Transactions smaller than \ref CARDANO_TRANSACTION_PARALLEL_DECODE_MIN_SIZE bytes, or a NULL `parallel_for`, are
+ * decoded on the calling thread.
+ *
+ * \param[in] reader A pointer to an initialized \ref cardano_cbor_reader_t that is ready to read the CBOR-encoded data.
+ * \param[in] parallel_for Runs the decoding tasks, or NULL to decode on the calling thread.
+ * \param[in] context The context passed to `parallel_for`.
+ * \param[out] transaction On success, the decoded transaction.
+ *
+ * \return \ref CARDANO_SUCCESS if the transaction was decoded, or the error of the first part that failed, in body,
+ *         witness set, auxiliary data order. Its message is recorded as the last error of `reader`.
+ *
+ * \note The tasks only allocate memory and must not run inside an arena scope (see \ref cardano_arena_begin) of
+ *       another thread. Objects are not reference counted atomically: the transaction must only be shared between
+ *       threads once this function returned. With allocation tracking enabled, the counters of allocations made on
+ *       the worker threads are not synchronized.
+ *
+ * Usage Example:
+ * \code{.cpp}
+ * static void parallel_for(void* context, size_t count, cardano_parallel_task_t task, void* data)
+ * {
+ *   ParallelFor(static_cast<int32>(count), [task, data](int32 index) { task(data, index); });
+ * }
+ *
+ * cardano_transaction_t* transaction = nullptr;
+ * cardano_error_t result = cardano_transaction_from_cbor_parallel(reader, parallel_for, nullptr, &transaction);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_from_cbor_parallel(
+  cardano_cbor_reader_t*  reader,
+  cardano_parallel_for_t  parallel_for,
+  void*                   context,
+  cardano_transaction_t** transaction);
+
+/**
+ * \brief Locates a field of an encoded transaction by a named path, without decoding the transaction.
+ *
+ * This is \ref cardano_cbor_reader_seek with the field names of the transaction, its body, witness set, outputs and
+ * inputs and auxiliary data, in the snake case of the getters of this library. For example `body.outputs[3].amount`
+ * selects the value of the output at index 3, `body.fee` the fee, `witness_set.redeemers` the redeemers and
+ * `auxiliary_data.metadata.674` the metadatum of label 674, whatever the era format of the auxiliary data.
+ *
+ * A name is looked up among the fields of the previous name, as are the names after list indices, so
+ * `body.inputs[0].index` is the index of the first input. Numbers select elements by index or integer key as in
+ * \ref cardano_cbor_reader_seek, and any other segment a text key, as in metadata maps.
+ *
+ * Body fields: `inputs`, `outputs`, `fee`, `invalid_after`, `certificates`, `withdrawals`, `update`, `aux_data_hash`,
+ * `invalid_before`, `mint`, `script_data_hash`, `collateral`, `required_signers`, `network_id`, `collateral_return`,
+ * `total_collateral`, `reference_inputs`, `voting_procedures`, `proposal_procedures`, `treasury_value` and `donation`.
+ * Output fields: `address`, `amount` (or `value`), `datum` and `script_ref`. Input fields: `transaction_id` and
+ * `index`. Witness set fields: `vkeys`, `native_scripts`, `bootstrap`, `plutus_v1_scripts`, `plutus_data`,
+ * `redeemers`, `plutus_v2_scripts` and `plutus_v3_scripts`. Auxiliary data fields: `metadata`, `native_scripts`,
+ * `plutus_v1_scripts`, `plutus_v2_scripts` and `plutus_v3_scripts`.
+ *
+ * \param[in] reader The reader positioned at the transaction. It is not advanced.
+ * \param[in] path The path of the field. It does not need to be NULL-terminated.
+ * \param[in] path_size The size of the path in bytes.
+ * \param[out] field On success, a new reader over the field only, reading the memory of `reader` in place; it must
+ *                   not outlive `reader`. The caller must release it with \ref cardano_cbor_reader_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_ARGUMENT if the path is malformed,
+ *         \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if the transaction has no such field, or \ref CARDANO_ERROR_DECODING
+ *         if the data is malformed. The reason is recorded as the last error of `reader`.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_cbor_reader_t* fee_reader = NULL;
+ * uint64_t               fee        = 0U;
+ *
+ * cardano_error_t result = cardano_transaction_seek(reader, "body.fee", 8, &fee_reader);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   result = cardano_cbor_reader_read_uint(fee_reader, &fee);
+ *   cardano_cbor_reader_unref(&fee_reader);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_seek(
+  cardano_cbor_reader_t*  reader,
+  const char*             path,
+  size_t                  path_size,
+  cardano_cbor_reader_t** field);
+
 /**
  * \brief Serializes transaction into CBOR format using a CBOR writer.
  *
@@ -202,6 +375,43 @@ CARDANO_EXPORT cardano_error_t cardano_transaction_to_cbor(
   const cardano_transaction_t* transaction,
   cardano_cbor_writer_t*       writer);
 
+/**
+ * \brief Computes the size of the CBOR encoding of a transaction without producing it.
+ *
+ * This function runs \ref cardano_transaction_to_cbor against a size-only writer
+ * (\ref cardano_cbor_writer_new_size_only), so it allocates no output buffer. The result is exactly the number of
+ * bytes \ref cardano_transaction_to_cbor appends to a writer, including any cached original CBOR, which lets callers
+ * allocate the output once.
+ *
+ * Serializing thousands of transactions usually pairs this with \ref cardano_cbor_writer_new_with_capacity, or
+ * with a writer that is reused through \ref cardano_cbor_writer_reset.
+ *
+ * \param[in] transaction A constant pointer to the \ref cardano_transaction_t object to measure.
+ * \param[out] size On success, the size of the encoding in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL, or the error
+ *         returned by the serialization.
+ *
+ * Usage Example:
+ * \code{.c}
+ * size_t size = 0U;
+ *
+ * if (cardano_transaction_get_cbor_size(transaction, &size) == CARDANO_SUCCESS)
+ * {
+ *   cardano_cbor_writer_t* writer = cardano_cbor_writer_new_with_capacity(size);
+ *   cardano_error_t        result = cardano_transaction_to_cbor(transaction, writer);
+ *
+ *   // ...
+ *
+ *   cardano_cbor_writer_unref(&writer);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_get_cbor_size(
+  const cardano_transaction_t* transaction,
+  size_t*                      size);
+
 /**
  * \brief Retrieves the transaction body from a transaction object.
  *
@@ -436,6 +646,40 @@ CARDANO_EXPORT cardano_auxiliary_data_t* cardano_transaction_get_auxiliary_data(
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_transaction_set_auxiliary_data(cardano_transaction_t* transaction, cardano_auxiliary_data_t* auxiliary_data);
 
+/**
+ * \brief Sets the auxiliary data of a transaction from its encoding.
+ *
+ * The encoding is retained as is and written back unchanged when the transaction is serialized, so auxiliary data
+ * produced by \ref cardano_metadata_encoder_finish keeps the hash computed alongside it. It is only decoded if
+ * \ref cardano_transaction_get_auxiliary_data is called. Any auxiliary data previously set is replaced.
+ *
+ * \param[in,out] transaction The transaction. This parameter must not be NULL.
+ * \param[in] auxiliary_data_cbor The encoded auxiliary data. This parameter must not be NULL.
+ *
+ * \return \ref CARDANO_SUCCESS if the auxiliary data was set, \ref CARDANO_ERROR_POINTER_IS_NULL if either argument is
+ *         NULL, or \ref CARDANO_ERROR_DECODING if \p auxiliary_data_cbor is not a single well-formed CBOR data item.
+ *
+ * \note This function increases the reference count of \p auxiliary_data_cbor; the caller must still release its own
+ *       reference.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_buffer_t*       auxiliary_data_cbor = NULL;
+ * cardano_blake2b_hash_t* hash                = NULL;
+ *
+ * cardano_error_t result = cardano_metadata_encoder_finish(encoder, &auxiliary_data_cbor, &hash);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   result = cardano_transaction_set_auxiliary_data_cbor(transaction, auxiliary_data_cbor);
+ * }
+ *
+ * cardano_buffer_unref(&auxiliary_data_cbor);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_set_auxiliary_data_cbor(cardano_transaction_t* transaction, cardano_buffer_t* auxiliary_data_cbor);
+
 /**
  * \brief Gets whether the transaction is expected to fail Plutus script validation.
  *
@@ -614,6 +858,35 @@ CARDANO_EXPORT cardano_blake2b_hash_t* cardano_transaction_get_id(cardano_transa
  */
 CARDANO_EXPORT void cardano_transaction_clear_cbor_cache(cardano_transaction_t* transaction);
 
+/**
+ * \brief Freezes a transaction, so it can be shared between threads, such as by a cache of decoded transactions.
+ *
+ * The parts \ref cardano_transaction_from_cbor_lazy deferred are decoded first, since their getters would otherwise
+ * decode them on first access. The body is then frozen with \ref cardano_transaction_body_freeze, and the witness set
+ * and auxiliary data objects are marked frozen. The setters of the transaction, \ref cardano_transaction_apply_vkey_witnesses
+ * included, then fail with \ref CARDANO_ERROR_OBJECT_IS_FROZEN, and \ref cardano_transaction_clear_cbor_cache does
+ * nothing, so the transaction keeps serializing to the bytes it was decoded from.
+ *
+ * Freezing cannot be undone; to modify the transaction again, decode a copy of its CBOR.
+ *
+ * \param[in] transaction The transaction to freeze.
+ *
+ * \return \ref CARDANO_SUCCESS if the transaction was frozen, \ref CARDANO_ERROR_POINTER_IS_NULL if it is NULL, or
+ *         the error of decoding a deferred part, in which case the transaction is left unfrozen.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_freeze(cardano_transaction_t* transaction);
+
+/**
+ * \brief Checks whether a transaction has been frozen with \ref cardano_transaction_freeze.
+ *
+ * \param[in] transaction The transaction to check.
+ *
+ * \return \c true if the transaction is frozen; \c false otherwise, or if `transaction` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_transaction_is_frozen(const cardano_transaction_t* transaction);
+
 /**
  * \brief Applies verification key (vkey) witnesses to a transaction.
  *
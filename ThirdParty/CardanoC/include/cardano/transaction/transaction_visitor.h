@@ -0,0 +1,247 @@
+/**
+ * \file transaction_visitor.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_TRANSACTION_VISITOR_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_TRANSACTION_VISITOR_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Callback invoked for every transaction output.
+ *
+ * \param context The `context` pointer of the \ref cardano_transaction_visitor_t.
+ * \param tx_index The index of the transaction in the block, or zero when visiting a single transaction.
+ * \param output_index The index of the output in the transaction body.
+ * \param address The raw bytes of the output address. Borrowed: only valid during the visit.
+ * \param address_size The size of the address in bytes.
+ * \param coin The amount of lovelace held by the output.
+ *
+ * \returns \ref CARDANO_SUCCESS to continue visiting; any other value stops the visit and is returned to the caller.
+ */
+typedef cardano_error_t (*cardano_transaction_visitor_output_func_t)(
+  void*         context,
+  size_t        tx_index,
+  size_t        output_index,
+  const byte_t* address,
+  size_t        address_size,
+  uint64_t      coin);
+
+/**
+ * \brief Callback invoked for every native asset held by a transaction output.
+ *
+ * The assets of an output are reported right after the output itself.
+ *
+ * \param context The `context` pointer of the \ref cardano_transaction_visitor_t.
+ * \param tx_index The index of the transaction in the block, or zero when visiting a single transaction.
+ * \param output_index The index of the output holding the asset.
+ * \param policy_id The raw bytes of the policy id. Borrowed: only valid during the visit.
+ * \param policy_id_size The size of the policy id in bytes.
+ * \param asset_name The raw bytes of the asset name. Borrowed: only valid during the visit.
+ * \param asset_name_size The size of the asset name in bytes, possibly zero.
+ * \param quantity The quantity of the asset held by the output.
+ *
+ * \returns \ref CARDANO_SUCCESS to continue visiting; any other value stops the visit and is returned to the caller.
+ */
+typedef cardano_error_t (*cardano_transaction_visitor_asset_func_t)(
+  void*         context,
+  size_t        tx_index,
+  size_t        output_index,
+  const byte_t* policy_id,
+  size_t        policy_id_size,
+  const byte_t* asset_name,
+  size_t        asset_name_size,
+  uint64_t      quantity);
+
+/**
+ * \brief Callback invoked once a transaction body has been visited.
+ *
+ * The callback receives the encoded body exactly as it appears on chain, so the transaction id can be computed by
+ * hashing it with Blake2b-256.
+ *
+ * \param context The `context` pointer of the \ref cardano_transaction_visitor_t.
+ * \param tx_index The index of the transaction in the block, or zero when visiting a single transaction.
+ * \param body The CBOR encoding of the body. Borrowed: only valid during the visit.
+ * \param body_size The size of the encoded body in bytes.
+ *
+ * \returns \ref CARDANO_SUCCESS to continue visiting; any other value stops the visit and is returned to the caller.
+ */
+typedef cardano_error_t (*cardano_transaction_visitor_body_func_t)(
+  void*         context,
+  size_t        tx_index,
+  const byte_t* body,
+  size_t        body_size);
+
+/**
+ * \brief Callback invoked for every entry of the transaction metadata.
+ *
+ * \param context The `context` pointer of the \ref cardano_transaction_visitor_t.
+ * \param tx_index The index of the transaction in the block, or zero when visiting a single transaction.
+ * \param label The metadata label.
+ * \param metadatum The CBOR encoding of the metadatum. Borrowed: only valid during the visit. It can be decoded, if
+ *                  needed, with a reader created by \ref cardano_cbor_reader_from_view.
+ * \param metadatum_size The size of the encoded metadatum in bytes.
+ *
+ * \returns \ref CARDANO_SUCCESS to continue visiting; any other value stops the visit and is returned to the caller.
+ */
+typedef cardano_error_t (*cardano_transaction_visitor_metadatum_func_t)(
+  void*         context,
+  size_t        tx_index,
+  uint64_t      label,
+  const byte_t* metadatum,
+  size_t        metadatum_size);
+
+/**
+ * \brief Callback invoked for every transaction that failed phase-2 validation.
+ *
+ * The outputs of such a transaction are reported like any other, but they are never created on chain: only its
+ * collateral return is.
+ *
+ * \param context The `context` pointer of the \ref cardano_transaction_visitor_t.
+ * \param tx_index The index of the transaction in the block, or zero when visiting a single transaction.
+ *
+ * \returns \ref CARDANO_SUCCESS to continue visiting; any other value stops the visit and is returned to the caller.
+ */
+typedef cardano_error_t (*cardano_transaction_visitor_invalid_func_t)(
+  void*  context,
+  size_t tx_index);
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Set of callbacks invoked by \ref cardano_transaction_visit and \ref cardano_block_visit.
+ *
+ * Every callback is optional; unset callbacks are skipped, and so is the decoding that only they need. The visitor
+ * never builds the object model: everything passed to the callbacks is a borrowed view into the input, so visiting
+ * does not allocate beyond a single CBOR reader.
+ */
+typedef struct cardano_transaction_visitor_t
+{
+    /**
+     * \brief Opaque pointer passed back to every callback.
+     */
+    void* context;
+
+    /**
+     * \brief Called for every transaction output.
+     */
+    cardano_transaction_visitor_output_func_t output;
+
+    /**
+     * \brief Called for every native asset of every transaction output.
+     */
+    cardano_transaction_visitor_asset_func_t asset;
+
+    /**
+     * \brief Called once each transaction body has been visited.
+     */
+    cardano_transaction_visitor_body_func_t body;
+
+    /**
+     * \brief Called for every metadata entry.
+     */
+    cardano_transaction_visitor_metadatum_func_t metadatum;
+
+    /**
+     * \brief Called for every transaction that failed phase-2 validation.
+     */
+    cardano_transaction_visitor_invalid_func_t invalid_transaction;
+} cardano_transaction_visitor_t;
+
+/**
+ * \brief Visits an encoded transaction, invoking the visitor callbacks without decoding it into objects.
+ *
+ * The transaction is read in place, in a single pass. For every transaction body, the callbacks are invoked in this
+ * order: \ref cardano_transaction_visitor_t::output followed by the \ref cardano_transaction_visitor_t::asset
+ * callbacks of that output, for each output; then \ref cardano_transaction_visitor_t::body. The metadata is reported
+ * after the body, and \ref cardano_transaction_visitor_t::invalid_transaction last.
+ *
+ * Both the pre-Alonzo `[body, witness_set, auxiliary_data]` form and the `[body, witness_set, is_valid,
+ * auxiliary_data]` form are accepted; the auxiliary data may be in any of the Shelley, Allegra/Mary or Alonzo formats.
+ *
+ * \param[in] cbor The CBOR encoded transaction. It must stay alive until the function returns.
+ * \param[in] size The size of `cbor` in bytes.
+ * \param[in] visitor The callbacks to invoke.
+ *
+ * \return \ref CARDANO_SUCCESS if the whole transaction was visited, \ref CARDANO_ERROR_DECODING if it is malformed,
+ *         or the first error returned by a callback.
+ *
+ * Usage Example:
+ * \code{.c}
+ * static cardano_error_t
+ * on_output(void* context, size_t tx_index, size_t output_index, const byte_t* address, size_t address_size, uint64_t coin)
+ * {
+ *   uint64_t* total = (uint64_t*)context;
+ *   *total += coin;
+ *
+ *   return CARDANO_SUCCESS;
+ * }
+ *
+ * uint64_t                      total   = 0U;
+ * cardano_transaction_visitor_t visitor = { 0 };
+ *
+ * visitor.context = &total;
+ * visitor.output  = on_output;
+ *
+ * cardano_error_t result = cardano_transaction_visit(tx_bytes, tx_size, &visitor);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_visit(
+  const byte_t*                        cbor,
+  size_t                               size,
+  const cardano_transaction_visitor_t* visitor);
+
+/**
+ * \brief Visits every transaction of an encoded block, invoking the visitor callbacks without decoding it into objects.
+ *
+ * Accepts Shelley-era and later blocks (`[header, transaction_bodies, transaction_witness_sets, auxiliary_data_set
+ * (, invalid_transactions)]`), optionally wrapped in the `[era, block]` envelope used by chain-sync. The block header
+ * and the witness sets are skipped. The bodies are visited first, in order, as described in
+ * \ref cardano_transaction_visit; then the metadata of every transaction that has any; then the invalid transactions.
+ *
+ * \param[in] cbor The CBOR encoded block. It must stay alive until the function returns.
+ * \param[in] size The size of `cbor` in bytes.
+ * \param[in] visitor The callbacks to invoke.
+ *
+ * \return \ref CARDANO_SUCCESS if the whole block was visited, \ref CARDANO_ERROR_DECODING if it is malformed or is a
+ *         Byron block, or the first error returned by a callback.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_block_visit(
+  const byte_t*                        cbor,
+  size_t                               size,
+  const cardano_transaction_visitor_t* visitor);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_TRANSACTION_VISITOR_H
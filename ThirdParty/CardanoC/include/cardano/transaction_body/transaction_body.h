@@ -215,6 +215,40 @@ CARDANO_EXPORT cardano_error_t cardano_transaction_body_to_cbor(
   const cardano_transaction_body_t* transaction_body,
   cardano_cbor_writer_t*            writer);
 
+/**
+ * \brief Computes the size of the CBOR encoding of a transaction body without producing it.
+ *
+ * This function runs \ref cardano_transaction_body_to_cbor against a size-only writer
+ * (\ref cardano_cbor_writer_new_size_only), so it allocates no output buffer. The result is exactly the number of
+ * bytes \ref cardano_transaction_body_to_cbor appends to a writer, including any cached original CBOR, which lets callers
+ * allocate the output once.
+ *
+ * \param[in] transaction_body A constant pointer to the \ref cardano_transaction_body_t object to measure.
+ * \param[out] size On success, the size of the encoding in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL, or the error
+ *         returned by the serialization.
+ *
+ * Usage Example:
+ * \code{.c}
+ * size_t size = 0U;
+ *
+ * if (cardano_transaction_body_get_cbor_size(transaction_body, &size) == CARDANO_SUCCESS)
+ * {
+ *   cardano_cbor_writer_t* writer = cardano_cbor_writer_new_with_capacity(size);
+ *   cardano_error_t        result = cardano_transaction_body_to_cbor(transaction_body, writer);
+ *
+ *   // ...
+ *
+ *   cardano_cbor_writer_unref(&writer);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_body_get_cbor_size(
+  const cardano_transaction_body_t* transaction_body,
+  size_t*                           size);
+
 /**
  * \brief Retrieves the set of transaction inputs from a transaction body.
  *
@@ -1766,6 +1800,11 @@ cardano_transaction_body_set_donation(cardano_transaction_body_t* transaction_bo
  * This function computes and returns the hash of the given \ref cardano_transaction_body_t object. The hash is a unique identifier for the transaction body,
  * which can be used to reference the transaction in other parts of the blockchain.
  *
+ * For a body decoded with \ref cardano_transaction_body_from_cbor, the Blake2b-256 hash is computed from the original
+ * CBOR bytes once and memoized, so signing and reporting the transaction ID share one computation. The memoized hash
+ * is dropped by \ref cardano_transaction_body_clear_cbor_cache. Bodies built in memory are serialized and hashed on
+ * every call, since their fields may change in between.
+ *
  * \param[in] transaction_body A pointer to an initialized \ref cardano_transaction_body_t object. The object must be valid and not NULL.
  *
  * \return A pointer to a \ref cardano_blake2b_hash_t object representing the transaction body hash. The returned object is a new reference, and
@@ -1888,6 +1927,29 @@ CARDANO_EXPORT bool cardano_transaction_body_has_tagged_sets(cardano_transaction
  */
 CARDANO_EXPORT void cardano_transaction_body_clear_cbor_cache(cardano_transaction_body_t* transaction_body);
 
+/**
+ * \brief Freezes a transaction body, making it immutable.
+ *
+ * Its inputs, collateral and reference inputs, outputs, collateral return and mint are frozen too, so the setters of
+ * the body and of those objects fail with \ref CARDANO_ERROR_OBJECT_IS_FROZEN. The hash of the body is computed and
+ * kept first, so \ref cardano_transaction_body_get_hash does not hash it again on every call.
+ *
+ * Freezing cannot be undone, and the cached CBOR encoding is kept as is.
+ *
+ * \param[in] transaction_body The transaction body to freeze. If NULL, the function has no effect.
+ */
+CARDANO_EXPORT void cardano_transaction_body_freeze(cardano_transaction_body_t* transaction_body);
+
+/**
+ * \brief Checks whether a transaction body has been frozen with \ref cardano_transaction_body_freeze.
+ *
+ * \param[in] transaction_body The transaction body to check.
+ *
+ * \return \c true if the transaction body is frozen; \c false otherwise, or if `transaction_body` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_transaction_body_is_frozen(const cardano_transaction_body_t* transaction_body);
+
 /**
  * \brief Decrements the reference count of a cardano_transaction_body_t object.
  *
@@ -431,6 +431,27 @@ CARDANO_EXPORT int32_t cardano_transaction_input_compare(
   const cardano_transaction_input_t* lhs,
   const cardano_transaction_input_t* rhs);
 
+/**
+ * \brief Freezes a transaction input, making it immutable.
+ *
+ * Changing the transaction id or the index of a frozen input fails with \ref CARDANO_ERROR_OBJECT_IS_FROZEN.
+ *
+ * Freezing cannot be undone, and the cached CBOR encoding is kept as is.
+ *
+ * \param[in] transaction_input The transaction input to freeze. If NULL, the function has no effect.
+ */
+CARDANO_EXPORT void cardano_transaction_input_freeze(cardano_transaction_input_t* transaction_input);
+
+/**
+ * \brief Checks whether a transaction input has been frozen with \ref cardano_transaction_input_freeze.
+ *
+ * \param[in] transaction_input The transaction input to check.
+ *
+ * \return \c true if the transaction input is frozen; \c false otherwise, or if `transaction_input` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_transaction_input_is_frozen(const cardano_transaction_input_t* transaction_input);
+
 /**
  * \brief Decrements the reference count of a cardano_transaction_input_t object.
  *
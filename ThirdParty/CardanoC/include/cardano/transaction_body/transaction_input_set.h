@@ -195,6 +195,18 @@ CARDANO_EXPORT cardano_error_t cardano_transaction_input_set_to_cbor(
 CARDANO_NODISCARD
 CARDANO_EXPORT size_t cardano_transaction_input_set_get_length(const cardano_transaction_input_set_t* transaction_input_set);
 
+/**
+ * \brief Makes room for a number of inputs, so that adding that many does not reallocate the set.
+ *
+ * \param[in] transaction_input_set The set.
+ * \param[in] capacity The number of inputs the set must hold without growing. The set never shrinks.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p transaction_input_set is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED, in which case the set is left as it was.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_input_set_reserve(cardano_transaction_input_set_t* transaction_input_set, size_t capacity);
+
 /**
  * \brief Retrieves an element from a transaction_input list by index.
  *
@@ -235,6 +247,34 @@ CARDANO_EXPORT size_t cardano_transaction_input_set_get_length(const cardano_tra
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_transaction_input_set_get(const cardano_transaction_input_set_t* transaction_input_set, size_t index, cardano_transaction_input_t** element);
 
+/**
+ * \brief Retrieves an element from a transaction input set by index, without taking a reference to it.
+ *
+ * This function behaves like \ref cardano_transaction_input_set_get, but leaves the reference count of the element untouched. It is
+ * meant for loops that only read the elements, which would otherwise pay for a ref/unref pair per element.
+ *
+ * \param[in] transaction_input_set A constant pointer to the \ref cardano_transaction_input_set_t object from which the element is to be retrieved.
+ * \param[in] index The index of the element to retrieve. Indexing starts at 0.
+ *
+ * \return A borrowed pointer to the element, or NULL if `transaction_input_set` is NULL or `index` is out of bounds. The element is
+ *         owned by the transaction input set and is only valid while it remains in it; the caller must not call
+ *         \ref cardano_transaction_input_unref on it.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const size_t length = cardano_transaction_input_set_get_length(transaction_input_set);
+ *
+ * for (size_t i = 0U; i < length; ++i)
+ * {
+ *   cardano_transaction_input_t* input = cardano_transaction_input_set_peek(transaction_input_set, i);
+ *
+ *   // Read the element, no need to unref it
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_transaction_input_t* cardano_transaction_input_set_peek(const cardano_transaction_input_set_t* transaction_input_set, size_t index);
+
 /**
  * \brief Adds an element to a transaction_input list.
  *
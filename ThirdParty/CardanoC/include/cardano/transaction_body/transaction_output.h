@@ -502,6 +502,27 @@ CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t
 cardano_transaction_output_set_script_ref(cardano_transaction_output_t* output, cardano_script_t* script_ref);
 
+/**
+ * \brief Freezes a transaction output, making it immutable.
+ *
+ * The value, address, datum and script reference of the output are frozen too, so none of its setters, nor those of its value, can modify it; they fail with \ref CARDANO_ERROR_OBJECT_IS_FROZEN.
+ *
+ * Freezing cannot be undone, and the cached CBOR encoding is kept as is.
+ *
+ * \param[in] transaction_output The transaction output to freeze. If NULL, the function has no effect.
+ */
+CARDANO_EXPORT void cardano_transaction_output_freeze(cardano_transaction_output_t* transaction_output);
+
+/**
+ * \brief Checks whether a transaction output has been frozen with \ref cardano_transaction_output_freeze.
+ *
+ * \param[in] transaction_output The transaction output to check.
+ *
+ * \return \c true if the transaction output is frozen; \c false otherwise, or if `transaction_output` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_transaction_output_is_frozen(const cardano_transaction_output_t* transaction_output);
+
 /**
  * \brief Decrements the reference count of a cardano_transaction_output_t object.
  *
@@ -195,6 +195,18 @@ CARDANO_EXPORT cardano_error_t cardano_transaction_output_list_to_cbor(
 CARDANO_NODISCARD
 CARDANO_EXPORT size_t cardano_transaction_output_list_get_length(const cardano_transaction_output_list_t* transaction_output_list);
 
+/**
+ * \brief Makes room for a number of outputs, so that adding that many does not reallocate the list.
+ *
+ * \param[in] transaction_output_list The list.
+ * \param[in] capacity The number of outputs the list must hold without growing. The list never shrinks.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if \p transaction_output_list is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED, in which case the list is left as it was.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_transaction_output_list_reserve(cardano_transaction_output_list_t* transaction_output_list, size_t capacity);
+
 /**
  * \brief Retrieves an element from a transaction output list by index.
  *
@@ -235,6 +247,34 @@ CARDANO_EXPORT size_t cardano_transaction_output_list_get_length(const cardano_t
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_transaction_output_list_get(const cardano_transaction_output_list_t* transaction_output_list, size_t index, cardano_transaction_output_t** element);
 
+/**
+ * \brief Retrieves an element from a transaction output list by index, without taking a reference to it.
+ *
+ * This function behaves like \ref cardano_transaction_output_list_get, but leaves the reference count of the element untouched. It is
+ * meant for loops that only read the elements, which would otherwise pay for a ref/unref pair per element.
+ *
+ * \param[in] transaction_output_list A constant pointer to the \ref cardano_transaction_output_list_t object from which the element is to be retrieved.
+ * \param[in] index The index of the element to retrieve. Indexing starts at 0.
+ *
+ * \return A borrowed pointer to the element, or NULL if `transaction_output_list` is NULL or `index` is out of bounds. The element is
+ *         owned by the transaction output list and is only valid while it remains in it; the caller must not call
+ *         \ref cardano_transaction_output_unref on it.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const size_t length = cardano_transaction_output_list_get_length(transaction_output_list);
+ *
+ * for (size_t i = 0U; i < length; ++i)
+ * {
+ *   cardano_transaction_output_t* output = cardano_transaction_output_list_peek(transaction_output_list, i);
+ *
+ *   // Read the element, no need to unref it
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_transaction_output_t* cardano_transaction_output_list_peek(const cardano_transaction_output_list_t* transaction_output_list, size_t index);
+
 /**
  * \brief Adds an element to a transaction output list.
  *
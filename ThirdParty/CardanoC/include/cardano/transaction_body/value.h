@@ -811,6 +811,52 @@ CARDANO_EXPORT cardano_error_t cardano_value_add_asset_with_id_ex(
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_value_add(cardano_value_t* lhs, cardano_value_t* rhs, cardano_value_t** result);
 
+/**
+ * \brief Adds a Cardano value to another one, in place.
+ *
+ * This function has the same result as \ref cardano_value_add, but accumulates into \p value instead of creating
+ * a new value, which makes it suited to summing many values, such as every output of a transaction, into one
+ * accumulator. The coin is added directly, and the assets with \ref cardano_multi_asset_add_assign, so only assets
+ * that are new to \p value allocate. If the multi-asset of \p value is shared with other objects, it is copied the
+ * first time assets are added to it, so those objects are never affected.
+ *
+ * \param[in,out] value The value to add to.
+ * \param[in] rhs The value that is added. It can be \p value itself.
+ *
+ * \return \ref CARDANO_SUCCESS if the value was added, \ref CARDANO_ERROR_POINTER_IS_NULL if any of the pointers
+ *         is NULL, \ref CARDANO_ERROR_OBJECT_IS_FROZEN if \p value is frozen, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED. On failure \p value may hold part of the sum.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_value_t* total = cardano_value_new_zero();
+ * cardano_error_t result = (total != NULL) ? CARDANO_SUCCESS : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+ *
+ * for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < count); ++i)
+ * {
+ *   result = cardano_value_add_assign(total, values[i]);
+ * }
+ *
+ * cardano_value_unref(&total);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_value_add_assign(cardano_value_t* value, const cardano_value_t* rhs);
+
+/**
+ * \brief Sets a Cardano value back to zero, so it can be reused as an accumulator.
+ *
+ * The coin is set to zero and every asset is removed. The multi-asset of \p value keeps the room it had for its
+ * policies, unless it is shared with other objects, in which case \p value is given a new empty one instead.
+ *
+ * \param[in,out] value The value to reset.
+ *
+ * \return \ref CARDANO_SUCCESS if the value was reset, \ref CARDANO_ERROR_POINTER_IS_NULL if \p value is NULL,
+ *         \ref CARDANO_ERROR_OBJECT_IS_FROZEN if it is frozen, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_value_clear(cardano_value_t* value);
+
 /**
  * \brief Subtracts one Cardano value from another, resulting in a new value.
  *
@@ -1089,6 +1135,27 @@ CARDANO_EXPORT bool cardano_value_is_zero(const cardano_value_t* value);
 CARDANO_NODISCARD
 CARDANO_EXPORT bool cardano_value_equals(const cardano_value_t* lhs, const cardano_value_t* rhs);
 
+/**
+ * \brief Freezes a value, making it immutable.
+ *
+ * Its multi-asset is frozen too. Setting, adding or subtracting coins or assets in place fails with \ref CARDANO_ERROR_OBJECT_IS_FROZEN; \ref cardano_value_add and \ref cardano_value_subtract still work, since they produce a new value.
+ *
+ * Freezing cannot be undone, and the cached CBOR encoding is kept as is.
+ *
+ * \param[in] value The value to freeze. If NULL, the function has no effect.
+ */
+CARDANO_EXPORT void cardano_value_freeze(cardano_value_t* value);
+
+/**
+ * \brief Checks whether a value has been frozen with \ref cardano_value_freeze.
+ *
+ * \param[in] value The value to check.
+ *
+ * \return \c true if the value is frozen; \c false otherwise, or if `value` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT bool cardano_value_is_frozen(const cardano_value_t* value);
+
 /**
  * \brief Decrements the reference count of a cardano_value_t object.
  *
@@ -0,0 +1,111 @@
+/**
+ * \file build_profile.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_BUILD_PROFILE_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_BUILD_PROFILE_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Where the time of one \ref cardano_tx_builder_build call went.
+ *
+ * Filled in by the builder and the balancer when profiling is enabled on the builder (see
+ * \ref cardano_tx_builder_set_profiling_enabled), and read back with \ref cardano_tx_builder_get_build_profile,
+ * alongside \ref cardano_tx_builder_get_last_error. Times are wall-clock nanoseconds.
+ *
+ * Serializations and hashes are counted on the thread that runs the build, for the duration of the build, so they
+ * include those made by a custom coin selector or evaluator running on that thread, but not those of work it hands to
+ * other threads.
+ */
+typedef struct cardano_tx_build_profile_t
+{
+    /**
+     * \brief The whole build, validation and script data hash included.
+     */
+    uint64_t total_ns;
+
+    /**
+     * \brief Time in \ref cardano_balance_transaction.
+     */
+    uint64_t balancing_ns;
+
+    /**
+     * \brief Passes of the balancing loop. Each extra pass is a restart, after a fee increase or a change output that
+     *        could not cover its minimum ada.
+     */
+    uint64_t balancing_iterations;
+
+    /**
+     * \brief Passes restarted because the computed fee was higher than the one the pass started with.
+     */
+    uint64_t fee_iterations;
+
+    /**
+     * \brief Calls to the coin selector, and the time spent in them.
+     */
+    uint64_t selection_count;
+    uint64_t selection_ns;
+
+    /**
+     * \brief Calls to the transaction evaluator, and the time spent in them. For a provider evaluator, each call is a
+     *        network round trip. A pass of a transaction with redeemers calls it only if its inputs, collateral,
+     *        number of outputs or redeemer pointers differ from the last evaluated pass.
+     */
+    uint64_t evaluation_count;
+    uint64_t evaluation_ns;
+
+    /**
+     * \brief Fee computations, from the size model and from full serializations, and the time spent in them.
+     */
+    uint64_t fee_computation_count;
+    uint64_t fee_computation_ns;
+
+    /**
+     * \brief CBOR serializations, size-only ones included, and the bytes they produced. Each writer is counted once,
+     *        when it is reset or released.
+     */
+    uint64_t serialization_count;
+    uint64_t serialized_bytes;
+
+    /**
+     * \brief Blake2b hashes computed.
+     */
+    uint64_t hash_count;
+
+    /**
+     * \brief Passes of a transaction with redeemers that reused the execution units of the previous evaluation.
+     */
+    uint64_t evaluation_cache_hits;
+} cardano_tx_build_profile_t;
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_BUILD_PROFILE_H
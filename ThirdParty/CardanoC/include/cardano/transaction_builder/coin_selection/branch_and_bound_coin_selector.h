@@ -0,0 +1,101 @@
+/**
+ * \file branch_and_bound_coin_selector.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_BRANCH_AND_BOUND_COIN_SELECTOR_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_BRANCH_AND_BOUND_COIN_SELECTOR_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/transaction_builder/coin_selection/coin_selector.h>
+#include <cardano/typedefs.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Default number of search nodes the branch and bound selector explores before giving up.
+ */
+#define CARDANO_BRANCH_AND_BOUND_DEFAULT_MAX_NODES 100000U
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Creates a new coin selector that looks for a changeless selection with a branch and bound search.
+ *
+ * A selection is changeless when it covers the target's lovelace with at most `tolerance` lovelace to spare and
+ * leaves no native assets over. Skipping the change output makes the transaction smaller and cheaper, and does not
+ * add a new UTXO to the ledger.
+ *
+ * The transaction balancer still returns any spare lovelace as change, so a `tolerance` of zero is what guarantees
+ * that balanced transactions get no change output. A positive tolerance finds matches more often, for callers that
+ * fold the spare lovelace into the fee themselves.
+ *
+ * The search runs over the available UTXOs that hold only lovelace, largest first. It prunes branches that overshoot
+ * the window or can no longer reach it, and keeps the match with the least spare lovelace. It only applies to targets
+ * without native assets and when the pre-selected UTXOs hold no native assets either.
+ *
+ * If no changeless selection exists, or none is found within `max_nodes` search steps, the selection is delegated to
+ * `fallback`. The budget is a node count rather than a time limit so the result does not depend on the machine.
+ *
+ * \param[in] tolerance The maximum lovelace above the target that a changeless selection may spend.
+ * \param[in] max_nodes The search budget in nodes, or zero to use \ref CARDANO_BRANCH_AND_BOUND_DEFAULT_MAX_NODES.
+ * \param[in] fallback The selector used when no changeless selection is found, or NULL to use the "large first"
+ *                     selector. The new selector keeps its own reference to it.
+ * \param[out] coin_selector A pointer to the coin selector object that will be created and returned by this function.
+ *
+ * \return \ref CARDANO_SUCCESS if the coin selector was successfully created, or an appropriate error code indicating failure.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_coin_selector_t* fallback      = NULL;
+ * cardano_coin_selector_t* coin_selector = NULL;
+ *
+ * cardano_error_t result = cardano_random_improve_coin_selector_new(&fallback);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   result = cardano_branch_and_bound_coin_selector_new(0U, 0U, fallback, &coin_selector);
+ * }
+ *
+ * cardano_coin_selector_unref(&fallback);
+ *
+ * // Use coin_selector
+ *
+ * cardano_coin_selector_unref(&coin_selector);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_branch_and_bound_coin_selector_new(
+  uint64_t                  tolerance,
+  size_t                    max_nodes,
+  cardano_coin_selector_t*  fallback,
+  cardano_coin_selector_t** coin_selector);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_BRANCH_AND_BOUND_COIN_SELECTOR_H
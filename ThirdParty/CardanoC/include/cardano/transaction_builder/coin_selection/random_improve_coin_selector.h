@@ -0,0 +1,108 @@
+/**
+ * \file random_improve_coin_selector.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_RANDOM_IMPROVE_COIN_SELECTOR_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_RANDOM_IMPROVE_COIN_SELECTOR_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/transaction_builder/coin_selection/coin_selector.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Creates a new coin selector using the CIP-2 "random improve" strategy.
+ *
+ * The selection runs in two phases, first for every native asset of the target and then for lovelace:
+ *
+ * - **Random selection:** UTXOs holding the asset are picked at random until the target amount is covered.
+ * - **Improvement:** further random UTXOs holding the asset are added while each one brings the selected amount
+ *   closer to twice the target, without exceeding three times the target. The surplus ends up in a change output
+ *   of a size similar to the payment.
+ *
+ * Unlike the "large first" strategy, which keeps spending the largest UTXOs and leaves the wallet with a growing
+ * amount of dust, this keeps the distribution of UTXO sizes close to the distribution of payments, so later
+ * transactions keep needing few inputs.
+ *
+ * The selector is seeded from the system random number generator. Use
+ * \ref cardano_random_improve_coin_selector_new_with_seed for reproducible selections.
+ *
+ * \param[out] coin_selector A pointer to the coin selector object that will be created and returned by this function.
+ *
+ * \return \ref CARDANO_SUCCESS if the coin selector was successfully created, or an appropriate error code indicating failure.
+ *
+ * \note The caller is responsible for managing the memory of the created `coin_selector` object, and must ensure
+ *       it is properly freed when no longer needed using \ref cardano_coin_selector_unref.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_random_improve_coin_selector_new(
+  cardano_coin_selector_t** coin_selector);
+
+/**
+ * \brief Creates a new "random improve" coin selector with a fixed seed.
+ *
+ * Two selectors created with the same seed make the same choices when given the same sequence of inputs, which
+ * makes selections reproducible in tests. Each selection advances the selector's random state.
+ *
+ * \param[in] seed The seed of the selector's random number generator.
+ * \param[out] coin_selector A pointer to the coin selector object that will be created and returned by this function.
+ *
+ * \return \ref CARDANO_SUCCESS if the coin selector was successfully created, or an appropriate error code indicating failure.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_coin_selector_t* coin_selector = NULL;
+ *
+ * cardano_error_t result = cardano_random_improve_coin_selector_new_with_seed(42U, &coin_selector);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   cardano_utxo_list_t* selection = NULL;
+ *   cardano_utxo_list_t* remaining = NULL;
+ *
+ *   result = cardano_coin_selector_select(coin_selector, NULL, available_utxos, target, &selection, &remaining);
+ *
+ *   // Use the selection
+ *
+ *   cardano_utxo_list_unref(&selection);
+ *   cardano_utxo_list_unref(&remaining);
+ * }
+ *
+ * cardano_coin_selector_unref(&coin_selector);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_random_improve_coin_selector_new_with_seed(
+  uint64_t                  seed,
+  cardano_coin_selector_t** coin_selector);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_RANDOM_IMPROVE_COIN_SELECTOR_H
@@ -0,0 +1,166 @@
+/**
+ * \file local_tx_evaluator.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_LOCAL_TX_EVALUATOR_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_LOCAL_TX_EVALUATOR_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/common/utxo_list.h>
+#include <cardano/crypto/blake2b_hash.h>
+#include <cardano/error.h>
+#include <cardano/export.h>
+#include <cardano/transaction/transaction.h>
+#include <cardano/transaction_builder/evaluation/tx_evaluator.h>
+#include <cardano/typedefs.h>
+#include <cardano/witness_set/redeemer.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* CALLBACKS *****************************************************************/
+
+/**
+ * \brief Computes the execution units of one redeemer in-process.
+ *
+ * This is the extension point for a local script machine: an embedded UPLC evaluator, or a table of budgets
+ * measured ahead of time for the scripts an application ships with.
+ *
+ * \param[in] context The pointer given to \ref cardano_local_tx_evaluator_new.
+ * \param[in] redeemer The redeemer to evaluate; its tag and index tell which script purpose it serves.
+ * \param[in] script_hash The hash of the script the redeemer runs, or NULL if it cannot be told from the transaction
+ *                        alone (certificates, votes, proposals, or a spent input missing from \p resolved_inputs).
+ * \param[in] tx The transaction being evaluated.
+ * \param[in] resolved_inputs The outputs spent by the transaction, as given to the evaluator. May be NULL.
+ * \param[out] memory The memory units the redeemer needs.
+ * \param[out] cpu_steps The CPU steps the redeemer needs.
+ *
+ * \return \ref CARDANO_SUCCESS if the units were computed, \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if this backend does
+ *         not know the script and the fallback evaluator should be asked, or another error code to fail the evaluation.
+ */
+typedef cardano_error_t (*cardano_script_evaluate_func_t)(
+  void*                   context,
+  cardano_redeemer_t*     redeemer,
+  cardano_blake2b_hash_t* script_hash,
+  cardano_transaction_t*  tx,
+  cardano_utxo_list_t*    resolved_inputs,
+  uint64_t*               memory,
+  uint64_t*               cpu_steps);
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief The execution budget of one script, used by \ref cardano_budget_tx_evaluator_new.
+ */
+typedef struct cardano_script_budget_t
+{
+    /**
+     * \brief The hex-encoded hash of the script.
+     */
+    const char* script_hash_hex;
+
+    /**
+     * \brief The memory units every redeemer of the script is given.
+     */
+    uint64_t memory;
+
+    /**
+     * \brief The CPU steps every redeemer of the script is given.
+     */
+    uint64_t cpu_steps;
+} cardano_script_budget_t;
+
+/* FUNCTIONS *****************************************************************/
+
+/**
+ * \brief Creates a transaction evaluator that computes execution units in-process.
+ *
+ * Each redeemer of the transaction is handed to \p evaluate_script together with the hash of the script it runs.
+ * Redeemers the callback does not know are costed by \p fallback in a single call, so a transaction that only uses
+ * known scripts is evaluated without leaving the process, and balancing passes cost no round trips.
+ *
+ * \param[in] evaluate_script The function computing the units of one redeemer.
+ * \param[in] context An opaque pointer handed to \p evaluate_script. It must outlive the evaluator.
+ * \param[in] fallback The evaluator asked about the redeemers \p evaluate_script does not know, or NULL to fail the
+ *                     evaluation instead. The new evaluator takes a reference to it.
+ * \param[out] tx_evaluator On success, the new evaluator. The caller must release it with \ref cardano_tx_evaluator_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_tx_evaluator_t* remote    = NULL;
+ * cardano_tx_evaluator_t* evaluator = NULL;
+ *
+ * cardano_error_t result = cardano_tx_evaluator_from_provider(provider, &remote);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   result = cardano_local_tx_evaluator_new(uplc_evaluate, machine, remote, &evaluator);
+ * }
+ *
+ * cardano_tx_evaluator_unref(&remote);
+ *
+ * if (result == CARDANO_SUCCESS)
+ * {
+ *   result = cardano_tx_builder_set_tx_evaluator(builder, evaluator);
+ * }
+ *
+ * cardano_tx_evaluator_unref(&evaluator);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_local_tx_evaluator_new(
+  cardano_script_evaluate_func_t evaluate_script,
+  void*                          context,
+  cardano_tx_evaluator_t*        fallback,
+  cardano_tx_evaluator_t**       tx_evaluator);
+
+/**
+ * \brief Creates a local transaction evaluator that gives every redeemer a fixed budget per script.
+ *
+ * Meant for applications that interact with a known set of scripts, whose worst case budgets are measured once
+ * (for example on a testnet) and shipped with the application. A budget that is too small makes the node reject the
+ * transaction and take its collateral, so the budgets should include a safety margin.
+ *
+ * \param[in] budgets The budgets, copied by the evaluator.
+ * \param[in] budget_count The number of budgets.
+ * \param[in] fallback As in \ref cardano_local_tx_evaluator_new.
+ * \param[out] tx_evaluator On success, the new evaluator. The caller must release it with \ref cardano_tx_evaluator_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_INVALID_BLAKE2B_HASH_SIZE or a decoding error if a script
+ *         hash is not a 28 byte hex string, or another error code on failure.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_budget_tx_evaluator_new(
+  const cardano_script_budget_t* budgets,
+  size_t                         budget_count,
+  cardano_tx_evaluator_t*        fallback,
+  cardano_tx_evaluator_t**       tx_evaluator);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_LOCAL_TX_EVALUATOR_H
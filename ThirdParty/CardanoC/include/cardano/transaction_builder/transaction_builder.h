@@ -24,10 +24,13 @@
 
 /* INCLUDES ******************************************************************/
 
+#include <cardano/auxiliary_data/metadata_encoder.h>
 #include <cardano/common/drep.h>
 #include <cardano/error.h>
 #include <cardano/proposal_procedures/constitution.h>
+#include <cardano/scripts/native_scripts/compiled_native_script.h>
 #include <cardano/providers/provider.h>
+#include <cardano/transaction_builder/build_profile.h>
 #include <cardano/transaction_builder/coin_selection/coin_selector.h>
 #include <cardano/transaction_builder/evaluation/tx_evaluator.h>
 #include <cardano/typedefs.h>
@@ -94,6 +97,59 @@ CARDANO_EXPORT cardano_tx_builder_t* cardano_tx_builder_new(
   cardano_protocol_parameters_t* params,
   cardano_provider_t*            provider);
 
+/**
+ * \brief Prepares a transaction builder for building another transaction with the same configuration.
+ *
+ * A builder can only build once. Rather than creating a new builder for every transaction, a worker building many
+ * transactions with the same settings can reset the one it has: everything describing the transaction being built
+ * is discarded, while the configuration of the builder is kept.
+ *
+ * Kept: the protocol parameters, the provider, the coin selector, the transaction evaluator, the change address,
+ * the available UTxOs, the collateral UTxOs and collateral change address, the network ID and the profiling setting.
+ * The UTxO list is kept by reference, so a frozen list stays shared by every build.
+ *
+ * Discarded: the transaction skeleton (outputs, inputs added explicitly, validity interval, metadata, certificates,
+ * withdrawals, mints, votes and proposals), the pre-selected and reference inputs, the redeemers, the native script
+ * hashes and signature counts, and any error left by the previous calls. The lists of pre-selected and reference inputs
+ * are emptied in place, keeping their capacity.
+ *
+ * The transaction returned by a previous \ref cardano_tx_builder_build is not affected: the builder starts a new one.
+ *
+ * \param[in,out] builder The builder to reset.
+ *
+ * \return \ref CARDANO_SUCCESS if the builder is ready for a new transaction, \ref CARDANO_ERROR_POINTER_IS_NULL if
+ *         `builder` is NULL, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the new transaction could not be
+ *         allocated, in which case the builder is left as it was.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_tx_builder_t* builder = cardano_tx_builder_new(protocol_params, provider);
+ *
+ * cardano_tx_builder_set_utxos(builder, frozen_utxos);
+ * cardano_tx_builder_set_change_address(builder, change_address);
+ *
+ * for (size_t i = 0U; i < payout_count; ++i)
+ * {
+ *   cardano_transaction_t* transaction = NULL;
+ *
+ *   cardano_tx_builder_send_lovelace(builder, payouts[i].address, payouts[i].amount);
+ *   cardano_tx_builder_set_invalid_after(builder, ttl);
+ *
+ *   if (cardano_tx_builder_build(builder, &transaction) == CARDANO_SUCCESS)
+ *   {
+ *     // Sign and submit the transaction
+ *     cardano_transaction_unref(&transaction);
+ *   }
+ *
+ *   cardano_error_t result = cardano_tx_builder_reset(builder);
+ * }
+ *
+ * cardano_tx_builder_unref(&builder);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_tx_builder_reset(cardano_tx_builder_t* builder);
+
 /**
  * \brief Sets the coin selector for the transaction builder.
  *
@@ -460,6 +516,29 @@ CARDANO_EXPORT void cardano_tx_builder_set_invalid_before_ex(cardano_tx_builder_
  */
 CARDANO_EXPORT void cardano_tx_builder_add_reference_input(cardano_tx_builder_t* builder, cardano_utxo_t* utxo);
 
+/**
+ * \brief Adds a reference input whose output is resolved through the provider when the transaction is built.
+ *
+ * All the inputs added with this function and \ref cardano_tx_builder_add_unresolved_input are resolved together
+ * with a single \ref cardano_provider_resolve_unspent_outputs call, instead of one call per input.
+ *
+ * \param[in] builder A pointer to the \ref cardano_tx_builder_t instance in which to add the reference input.
+ * \param[in] input A pointer to the \ref cardano_transaction_input_t to reference.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_tx_builder_t* tx_builder = ...;          // Initialized transaction builder
+ * cardano_transaction_input_t* script_input = ...; // Input holding a reference script
+ *
+ * cardano_tx_builder_add_unresolved_reference_input(tx_builder, script_input);
+ * \endcode
+ *
+ * \note If the input cannot be resolved, \ref cardano_tx_builder_build fails with \ref CARDANO_ERROR_ELEMENT_NOT_FOUND.
+ */
+CARDANO_EXPORT void cardano_tx_builder_add_unresolved_reference_input(
+  cardano_tx_builder_t*        builder,
+  cardano_transaction_input_t* input);
+
 /**
  * \brief Sends a specified amount of lovelace to a given address.
  *
@@ -715,6 +794,36 @@ CARDANO_EXPORT void cardano_tx_builder_add_input(
   cardano_plutus_data_t* redeemer,
   cardano_plutus_data_t* datum);
 
+/**
+ * \brief Adds an input whose output is resolved through the provider when the transaction is built.
+ *
+ * The inputs are resolved together with a single \ref cardano_provider_resolve_unspent_outputs call. When \p datum
+ * is `NULL` and the resolved output only carries a datum hash, the datum is resolved as well; the datums of all such
+ * inputs are fetched with a single \ref cardano_provider_resolve_datums call.
+ *
+ * \param[in] builder A pointer to the \ref cardano_tx_builder_t instance in which to add the input.
+ * \param[in] input A pointer to the \ref cardano_transaction_input_t to spend.
+ * \param[in] redeemer A pointer to the \ref cardano_plutus_data_t structure representing the redeemer for the Plutus script (optional; can be NULL).
+ * \param[in] datum A pointer to the \ref cardano_plutus_data_t structure representing the datum for the Plutus script (optional; can be NULL).
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_tx_builder_t* tx_builder = ...;   // Initialized transaction builder
+ * cardano_transaction_input_t* input = ...; // Script output to spend
+ * cardano_plutus_data_t* redeemer = ...;    // Redeemer for the input
+ *
+ * cardano_tx_builder_add_unresolved_input(tx_builder, input, redeemer, NULL);
+ * \endcode
+ *
+ * \note If the input or its datum cannot be resolved, \ref cardano_tx_builder_build fails with
+ *       \ref CARDANO_ERROR_ELEMENT_NOT_FOUND.
+ */
+CARDANO_EXPORT void cardano_tx_builder_add_unresolved_input(
+  cardano_tx_builder_t*        builder,
+  cardano_transaction_input_t* input,
+  cardano_plutus_data_t*       redeemer,
+  cardano_plutus_data_t*       datum);
+
 /**
  * \brief Adds an output to the transaction.
  *
@@ -790,6 +899,32 @@ CARDANO_EXPORT void cardano_tx_builder_set_metadata_ex(
   const char*           metadata_json,
   size_t                json_size);
 
+/**
+ * \brief Sets the metadata of a transaction builder from a finished stream of metadata.
+ *
+ * This function completes \p encoder and attaches its output as the auxiliary data of the transaction, setting the
+ * auxiliary data hash of the body to the hash computed with it. It is meant for large metadata, such as the CIP-25 or
+ * CIP-68 records of a mint batch, where building a \ref cardano_metadatum_t tree would be costly.
+ *
+ * \param[in] builder A pointer to the \ref cardano_tx_builder_t instance where the metadata will be set.
+ * \param[in] encoder The metadata encoder holding all the metadata labels of the transaction.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_tx_builder_t*       tx_builder = ...; // Initialized transaction builder
+ * cardano_metadata_encoder_t* encoder    = ...; // Encoder with every label written
+ *
+ * cardano_tx_builder_set_metadata_from_encoder(tx_builder, encoder);
+ * cardano_metadata_encoder_unref(&encoder);
+ * \endcode
+ *
+ * \note This replaces any auxiliary data set before, including metadata added with \ref cardano_tx_builder_set_metadata.
+ * Errors, such as incomplete metadata, will be deferred until `cardano_tx_builder_build` is called.
+ */
+CARDANO_EXPORT void cardano_tx_builder_set_metadata_from_encoder(
+  cardano_tx_builder_t*       builder,
+  cardano_metadata_encoder_t* encoder);
+
 /**
  * \brief Adds a token minting operation to the transaction builder.
  *
@@ -1589,6 +1724,61 @@ CARDANO_EXPORT void cardano_tx_builder_vote(
   cardano_voting_procedure_t*     vote,
   cardano_plutus_data_t*          redeemer);
 
+/**
+ * \brief One vote of a \ref cardano_tx_builder_vote_batch call, with the arguments of \ref cardano_tx_builder_vote.
+ */
+typedef struct cardano_tx_builder_vote_t
+{
+    /**
+     * \brief The voter casting the vote.
+     */
+    cardano_voter_t* voter;
+
+    /**
+     * \brief The governance action voted on.
+     */
+    cardano_governance_action_id_t* action_id;
+
+    /**
+     * \brief The vote, and its optional anchor.
+     */
+    cardano_voting_procedure_t* vote;
+
+    /**
+     * \brief The redeemer of a script voter, or NULL.
+     */
+    cardano_plutus_data_t* redeemer;
+} cardano_tx_builder_vote_t;
+
+/**
+ * \brief Registers many votes at once, such as every vote a DRep casts in an epoch.
+ *
+ * Each entry is added as by \ref cardano_tx_builder_vote; a voter voting again on the same governance action replaces
+ * its earlier vote. Once all are inserted, the voting procedures of the transaction are sorted in canonical order (see
+ * \ref cardano_voting_procedures_sort), together with any vote added before, so the transaction body encodes them as
+ * canonical CBOR maps. Inserting costs constant time per vote and sorting O(n log n) for the whole batch.
+ *
+ * \param[in] builder A pointer to the \ref cardano_tx_builder_t instance managing the transaction.
+ * \param[in] votes The votes to register. The builder references the objects they point to; the array itself is not kept.
+ * \param[in] count The number of votes.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_tx_builder_vote_t votes[2] = {
+ *   { drep, action_id_1, yes, NULL },
+ *   { drep, action_id_2, no, NULL },
+ * };
+ *
+ * cardano_tx_builder_vote_batch(tx_builder, votes, 2);
+ * \endcode
+ *
+ * \note The entries are all checked before any is added. Errors are deferred until `cardano_tx_builder_build` is called.
+ */
+CARDANO_EXPORT void cardano_tx_builder_vote_batch(
+  cardano_tx_builder_t*            builder,
+  const cardano_tx_builder_vote_t* votes,
+  size_t                           count);
+
 /**
  * \brief Adds a certificate to the transaction.
  *
@@ -1648,6 +1838,39 @@ CARDANO_EXPORT void cardano_tx_builder_add_script(
   cardano_tx_builder_t* builder,
   cardano_script_t*     script);
 
+/**
+ * \brief Adds a compiled native script to the transaction builder and accounts for the signatures it needs.
+ *
+ * The script is added to the witness set like \ref cardano_tx_builder_add_script does, and the smallest number of
+ * signatures that satisfies it (see \ref cardano_compiled_native_script_get_min_signer_count) is included in the fee
+ * estimate. Those signatures come on top of the count set with \ref cardano_tx_builder_pad_signer_count, since the
+ * signers of a native script cannot be told from the transaction inputs. Adding the same script twice counts its
+ * signatures once.
+ *
+ * The timelocks of the script are not applied to the transaction; use
+ * \ref cardano_compiled_native_script_get_invalid_before and \ref cardano_compiled_native_script_get_invalid_hereafter
+ * to pick a validity interval that satisfies them.
+ *
+ * \param[in] builder A pointer to the \ref cardano_tx_builder_t instance managing the transaction details.
+ * \param[in] compiled_native_script The compiled script to add.
+ *
+ * \note Errors are deferred until `cardano_tx_builder_build` is called.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_tx_builder_t*             tx_builder = ...; // Initialized transaction builder
+ * cardano_compiled_native_script_t* treasury   = ...; // Compiled once, reused for every spend
+ *
+ * cardano_tx_builder_add_input(tx_builder, treasury_utxo, NULL, NULL);
+ * cardano_tx_builder_add_compiled_native_script(tx_builder, treasury);
+ *
+ * cardano_error_t result = cardano_tx_builder_build(tx_builder, &transaction);
+ * \endcode
+ */
+CARDANO_EXPORT void cardano_tx_builder_add_compiled_native_script(
+  cardano_tx_builder_t*             builder,
+  cardano_compiled_native_script_t* compiled_native_script);
+
 /**
  * \brief Proposes a parameter change within a Cardano transaction.
  *
@@ -2466,6 +2689,50 @@ CARDANO_NODISCARD
 CARDANO_EXPORT const char* cardano_tx_builder_get_last_error(
   const cardano_tx_builder_t* transaction_builder);
 
+/**
+ * \brief Enables or disables the build profile of a transaction builder.
+ *
+ * When enabled, \ref cardano_tx_builder_build records where its time went (balancing passes, coin selection,
+ * evaluation, fee computation, serializations and hashes) into a \ref cardano_tx_build_profile_t, which can then be
+ * read with \ref cardano_tx_builder_get_build_profile, whether the build succeeded or not. Disabled by default; when
+ * disabled, the build does not read the clock.
+ *
+ * \param[in] transaction_builder The builder. If \c NULL, the function does nothing.
+ * \param[in] enabled \c true to profile the next build, \c false otherwise.
+ */
+CARDANO_EXPORT void cardano_tx_builder_set_profiling_enabled(
+  cardano_tx_builder_t* transaction_builder,
+  bool                  enabled);
+
+/**
+ * \brief Retrieves the profile of the last \ref cardano_tx_builder_build call of a transaction builder.
+ *
+ * \param[in] transaction_builder The builder.
+ * \param[out] profile On success, the profile of the last build, or all zeros if no build was profiled.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_POINTER_IS_NULL if either argument is \c NULL.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_tx_builder_set_profiling_enabled(tx_builder, true);
+ *
+ * cardano_error_t result = cardano_tx_builder_build(tx_builder, &transaction);
+ *
+ * cardano_tx_build_profile_t profile = { 0 };
+ *
+ * if (cardano_tx_builder_get_build_profile(tx_builder, &profile) == CARDANO_SUCCESS)
+ * {
+ *   printf("%s: %llu passes, %llu ns selecting, %llu ns evaluating\n",
+ *     (result == CARDANO_SUCCESS) ? "built" : cardano_tx_builder_get_last_error(tx_builder),
+ *     profile.balancing_iterations, profile.selection_ns, profile.evaluation_ns);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_tx_builder_get_build_profile(
+  const cardano_tx_builder_t* transaction_builder,
+  cardano_tx_build_profile_t* profile);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -176,7 +176,8 @@ CARDANO_EXPORT cardano_error_t cardano_voting_procedures_to_cbor(
  *
  * This function inserts a new entry into the \ref cardano_voting_procedures_t map, linking a voter and a governance action ID
  * to a specific voting procedure. Each component (voter, governance action ID, and voting procedure) is added as a reference,
- * and the reference count for each is incremented to manage their lifecycles within the map.
+ * and the reference count for each is incremented to manage their lifecycles within the map. A vote the voter already
+ * cast on the same governance action is replaced.
  *
  * \param[in] voting_procedures A pointer to an initialized \ref cardano_voting_procedures_t object, representing the map
  *                              where the new voting procedure entry will be inserted.
@@ -368,6 +369,29 @@ CARDANO_EXPORT cardano_error_t cardano_voting_procedures_get_governance_ids_by_v
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_voting_procedures_get_voters(cardano_voting_procedures_t* voting_procedures, cardano_voter_list_t** voters);
 
+/**
+ * \brief Sorts the voters, and the governance actions each of them votes on, in canonical order.
+ *
+ * Voting procedures are encoded in the order the votes were inserted, which is also the order they keep when decoded.
+ * This function sorts the voters by type and then credential hash, and the governance action ids of each voter by
+ * transaction hash and then index. That is the order of their encoded keys under the core deterministic encoding of
+ * RFC 8949, section 4.2.1, so \ref cardano_voting_procedures_to_cbor then writes canonical maps directly.
+ *
+ * Sorting once after inserting many votes costs O(n log n) in their number, rather than keeping the maps sorted on
+ * every insertion.
+ *
+ * \param[in,out] voting_procedures A pointer to an initialized \ref cardano_voting_procedures_t object.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_voting_procedures_t* voting_procedures = ...;
+ *
+ * // Insert every vote first
+ * cardano_voting_procedures_sort(voting_procedures);
+ * \endcode
+ */
+CARDANO_EXPORT void cardano_voting_procedures_sort(cardano_voting_procedures_t* voting_procedures);
+
 /**
  * \brief Decrements the reference count of a voting_procedures object.
  *
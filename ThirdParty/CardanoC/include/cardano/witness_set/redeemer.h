@@ -451,6 +451,39 @@ CARDANO_EXPORT cardano_ex_units_t* cardano_redeemer_get_ex_units(cardano_redeeme
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_redeemer_set_ex_units(cardano_redeemer_t* redeemer, cardano_ex_units_t* ex_units);
 
+/**
+ * \brief Updates the execution units of a redeemer in place.
+ *
+ * This function writes new memory and CPU step values into the execution units the redeemer already holds. When the
+ * redeemer keeps the CBOR it was decoded from, only the execution units are rewritten in that encoding, as long as
+ * the new values encode to the same number of bytes; the rest (in particular the encoded redeemer data) is reused.
+ * Otherwise the cached encoding is dropped and the redeemer is encoded again when serialized.
+ *
+ * \param[in,out] redeemer A pointer to an initialized \ref cardano_redeemer_t object. This parameter must not be NULL.
+ * \param[in] memory The memory units.
+ * \param[in] cpu_steps The CPU steps.
+ *
+ * \return \ref CARDANO_SUCCESS if the execution units were updated, or \ref CARDANO_ERROR_POINTER_IS_NULL if
+ *         \p redeemer is NULL or has no execution units.
+ *
+ * \note The execution units object is modified, not replaced, so any other holder of a reference to it (for instance
+ *       one obtained with \ref cardano_redeemer_get_ex_units) sees the new values.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_redeemer_t* redeemer = ...; // Assume redeemer is already initialized
+ *
+ * cardano_error_t result = cardano_redeemer_update_ex_units(redeemer, 14000000U, 10000000000U);
+ *
+ * if (result != CARDANO_SUCCESS)
+ * {
+ *   printf("Failed to update the execution units.\n");
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_redeemer_update_ex_units(cardano_redeemer_t* redeemer, uint64_t memory, uint64_t cpu_steps);
+
 /**
  * \brief Clears the cached CBOR representation from a redeemer.
  *
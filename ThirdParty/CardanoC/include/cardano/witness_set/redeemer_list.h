@@ -249,6 +249,34 @@ CARDANO_EXPORT size_t cardano_redeemer_list_get_length(const cardano_redeemer_li
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_redeemer_list_get(const cardano_redeemer_list_t* redeemer_list, size_t index, cardano_redeemer_t** element);
 
+/**
+ * \brief Retrieves an element from a redeemer list by index, without taking a reference to it.
+ *
+ * This function behaves like \ref cardano_redeemer_list_get, but leaves the reference count of the element untouched. It is
+ * meant for loops that only read the elements, which would otherwise pay for a ref/unref pair per element.
+ *
+ * \param[in] redeemer_list A constant pointer to the \ref cardano_redeemer_list_t object from which the element is to be retrieved.
+ * \param[in] index The index of the element to retrieve. Indexing starts at 0.
+ *
+ * \return A borrowed pointer to the element, or NULL if `redeemer_list` is NULL or `index` is out of bounds. The element is
+ *         owned by the redeemer list and is only valid while it remains in it; the caller must not call
+ *         \ref cardano_redeemer_unref on it.
+ *
+ * Usage Example:
+ * \code{.c}
+ * const size_t length = cardano_redeemer_list_get_length(redeemer_list);
+ *
+ * for (size_t i = 0U; i < length; ++i)
+ * {
+ *   cardano_redeemer_t* redeemer = cardano_redeemer_list_peek(redeemer_list, i);
+ *
+ *   // Read the element, no need to unref it
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_redeemer_t* cardano_redeemer_list_peek(const cardano_redeemer_list_t* redeemer_list, size_t index);
+
 /**
  * \brief Adds an element to a redeemer list.
  *
@@ -289,6 +317,11 @@ CARDANO_EXPORT cardano_error_t cardano_redeemer_list_add(cardano_redeemer_list_t
  *
  * This function sets the execution units (memory and steps) for a given redeemer identified by its tag and index within the \ref cardano_redeemer_list_t.
  *
+ * If the list keeps the CBOR it was decoded from, the execution units are rewritten in that encoding in place when the
+ * new values encode to the same number of bytes, so re-evaluating a transaction does not re-encode its redeemers (nor
+ * their data, when the script data hash is recomputed). Otherwise the cached encoding is dropped and the list is encoded
+ * again when serialized.
+ *
  * \param[in,out] redeemer_list A pointer to an initialized \ref cardano_redeemer_list_t object where the execution units will be set.
  *                              This parameter must not be NULL.
  * \param[in] tag The \ref cardano_redeemer_tag_t representing the type of the redeemer (e.g., spending, minting).
@@ -327,6 +360,50 @@ CARDANO_EXPORT cardano_error_t cardano_redeemer_list_set_ex_units(
   uint64_t                 mem,
   uint64_t                 steps);
 
+/**
+ * \brief Finds the redeemer with the given tag and index.
+ *
+ * Lists with more than a handful of redeemers keep a hashed (tag, index) index, so the lookup, like
+ * \ref cardano_redeemer_list_set_ex_units, does not scan the list.
+ *
+ * \param[in] redeemer_list A pointer to an initialized \ref cardano_redeemer_list_t object. This parameter must not be NULL.
+ * \param[in] tag The tag of the redeemer.
+ * \param[in] index The index of the redeemer.
+ * \param[out] redeemer On success, the redeemer. The caller must release it with \ref cardano_redeemer_unref.
+ *
+ * \return \ref CARDANO_SUCCESS if the redeemer was found, \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if the list has no such
+ *         redeemer, or another error code on failure.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_redeemer_list_t* redeemer_list = ...; // Assume redeemer_list is initialized
+ * cardano_redeemer_t* redeemer = NULL;
+ *
+ * if (cardano_redeemer_list_find(redeemer_list, CARDANO_REDEEMER_TAG_SPEND, 2, &redeemer) == CARDANO_SUCCESS)
+ * {
+ *   // Use the redeemer
+ *   cardano_redeemer_unref(&redeemer);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_redeemer_list_find(
+  cardano_redeemer_list_t* redeemer_list,
+  cardano_redeemer_tag_t   tag,
+  uint64_t                 index,
+  cardano_redeemer_t**     redeemer);
+
+/**
+ * \brief Restores the order and the (tag, index) index of a list after the indices of its redeemers changed.
+ *
+ * Call this after changing redeemers of the list with \ref cardano_redeemer_set_index, such as when the inputs of a
+ * transaction change and its spend redeemers are renumbered. Lookups stay correct without it, but fall back to a
+ * linear search until the index is rebuilt. The cached CBOR encoding of the list no longer matches and is dropped.
+ *
+ * \param[in,out] redeemer_list A pointer to an initialized \ref cardano_redeemer_list_t object.
+ */
+CARDANO_EXPORT void cardano_redeemer_list_reindex(cardano_redeemer_list_t* redeemer_list);
+
 /**
  * \brief Deep clones a redeemer list.
  *
@@ -192,6 +192,40 @@ CARDANO_EXPORT cardano_error_t cardano_witness_set_to_cbor(
   const cardano_witness_set_t* witness_set,
   cardano_cbor_writer_t*       writer);
 
+/**
+ * \brief Computes the size of the CBOR encoding of a witness set without producing it.
+ *
+ * This function runs \ref cardano_witness_set_to_cbor against a size-only writer
+ * (\ref cardano_cbor_writer_new_size_only), so it allocates no output buffer. The result is exactly the number of
+ * bytes \ref cardano_witness_set_to_cbor appends to a writer, including any cached original CBOR, which lets callers
+ * allocate the output once.
+ *
+ * \param[in] witness_set A constant pointer to the \ref cardano_witness_set_t object to measure.
+ * \param[out] size On success, the size of the encoding in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any argument is NULL, or the error
+ *         returned by the serialization.
+ *
+ * Usage Example:
+ * \code{.c}
+ * size_t size = 0U;
+ *
+ * if (cardano_witness_set_get_cbor_size(witness_set, &size) == CARDANO_SUCCESS)
+ * {
+ *   cardano_cbor_writer_t* writer = cardano_cbor_writer_new_with_capacity(size);
+ *   cardano_error_t        result = cardano_witness_set_to_cbor(witness_set, writer);
+ *
+ *   // ...
+ *
+ *   cardano_cbor_writer_unref(&writer);
+ * }
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_witness_set_get_cbor_size(
+  const cardano_witness_set_t* witness_set,
+  size_t*                      size);
+
 /**
  * \brief Retrieves the vkey (verification key) witness set from a witness set.
  *
@@ -879,6 +913,43 @@ CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t
 cardano_witness_set_add_script(cardano_witness_set_t* witness_set, cardano_script_t* script);
 
+/**
+ * \brief Verifies every vkey witness of a witness set against a transaction body hash.
+ *
+ * All signatures are checked in one batch with \ref cardano_ed25519_batch_verify, with the same outcome as
+ * verifying each witness with \ref cardano_ed25519_public_verify.
+ *
+ * \param[in] witness_set A pointer to the \ref cardano_witness_set_t whose vkey witnesses are verified.
+ * \param[in] tx_body_hash The hash of the transaction body the witnesses must sign.
+ * \param[out] all_valid Set to `true` if every vkey witness carries a valid signature (or there are none),
+ *                       `false` otherwise.
+ *
+ * \return \ref CARDANO_SUCCESS if the witnesses could be checked, in which case `all_valid` holds the outcome,
+ *         or an appropriate error code otherwise.
+ *
+ * Usage Example:
+ * \code{.c}
+ * cardano_witness_set_t* witness_set = ...;
+ * cardano_blake2b_hash_t* body_hash = cardano_transaction_get_id(transaction);
+ * bool all_valid = false;
+ *
+ * cardano_error_t result = cardano_witness_set_verify_vkeys(witness_set, body_hash, &all_valid);
+ *
+ * if ((result == CARDANO_SUCCESS) && all_valid)
+ * {
+ *   printf("All signatures are valid.\n");
+ * }
+ *
+ * cardano_blake2b_hash_unref(&body_hash);
+ * \endcode
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t
+cardano_witness_set_verify_vkeys(
+  cardano_witness_set_t*        witness_set,
+  const cardano_blake2b_hash_t* tx_body_hash,
+  bool*                         all_valid);
+
 /**
  * \brief Decrements the reference count of a cardano_witness_set_t object.
  *
@@ -86,6 +86,16 @@ int crypto_generichash_blake2b_salt_personal(unsigned char *out, size_t outlen,
                                              const unsigned char *personal)
             __attribute__ ((nonnull(1)));
 
+/*
+ * Computes n unkeyed hashes of outlen bytes each; hash i is written to
+ * out + i * outlen. Faster than n separate calls for short inputs.
+ */
+SODIUM_EXPORT
+int crypto_generichash_blake2b_many(unsigned char *out, size_t outlen,
+                                    const unsigned char * const *in,
+                                    const unsigned long long *inlen, size_t n)
+            __attribute__ ((nonnull(1)));
+
 SODIUM_EXPORT
 int crypto_generichash_blake2b_init(crypto_generichash_blake2b_state *state,
                                     const unsigned char *key,
@@ -66,6 +66,19 @@ int crypto_sign_ed25519_verify_detached(const unsigned char *sig,
                                         const unsigned char *pk)
             __attribute__ ((warn_unused_result)) __attribute__ ((nonnull(1, 4)));
 
+/*
+ * Verifies n detached signatures at once. results[i] is set to 0 for a valid
+ * signature and -1 otherwise; the function returns 0 only if all are valid.
+ */
+SODIUM_EXPORT
+int crypto_sign_ed25519_verify_batch(int *results,
+                                     const unsigned char * const *sigs,
+                                     const unsigned char * const *ms,
+                                     const unsigned long long *mlens,
+                                     const unsigned char * const *pks,
+                                     size_t n)
+            __attribute__ ((nonnull(1)));
+
 SODIUM_EXPORT
 int crypto_sign_ed25519_keypair(unsigned char *pk, unsigned char *sk)
             __attribute__ ((nonnull));
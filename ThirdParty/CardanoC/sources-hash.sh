@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+#
+# Prints the hash of the cardano-c sources that build-linux.sh and build-win64.sh record next to the libraries they
+# build, and that CardanoPlugin.Build.cs compares against the sources in the tree: the SHA-256 of every .c and .h file
+# under src, include and external, in byte order of their paths, each as its path, a newline, and its content with
+# carriage returns removed, so checkouts with Windows line endings hash the same.
+
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+
+cd "${ROOT}"
+find src include external -type f \( -name '*.c' -o -name '*.h' \) | LC_ALL=C sort | while IFS= read -r source; do
+  printf '%s\n' "${source}"
+  tr -d '\r' < "${source}"
+done | sha256sum | cut -d ' ' -f 1
@@ -35,11 +35,81 @@
 #include <cardano/object.h>
 
 #include "../allocators.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
 #include "./internals/addr_common.h"
 
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Size of the stack buffer used for the human-readable part of a bech32 address.
+ *
+ * Bech32 strings are at most 90 characters long, so the human-readable part of any well-formed address fits.
+ */
+#define BECH32_HRP_STACK_SIZE 84U
+
+/**
+ * \brief Size of the stack buffer used for the decoded payload of a bech32 address.
+ *
+ * Covers every Shelley address type; longer payloads fall back to the heap.
+ */
+#define BECH32_DATA_STACK_SIZE 128U
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Decodes a bech32 address string, using stack buffers for the human-readable part and the payload.
+ *
+ * \param[in] data The bech32 string.
+ * \param[in] size The length of the string.
+ * \param[out] address On success, the decoded address.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error returned by the decoder.
+ */
+static cardano_error_t
+decode_bech32_address(const char* data, const size_t size, cardano_address_t** address)
+{
+  char   hrp_buffer[BECH32_HRP_STACK_SIZE];
+  byte_t data_buffer[BECH32_DATA_STACK_SIZE];
+
+  size_t       hrp_size    = 0;
+  const size_t data_length = cardano_encoding_bech32_get_decoded_length(data, size, &hrp_size);
+
+  if ((hrp_size == 0U) || (data_length == 0U))
+  {
+    return CARDANO_ERROR_INVALID_ADDRESS_FORMAT;
+  }
+
+  char*   hrp          = (hrp_size <= sizeof(hrp_buffer)) ? hrp_buffer : (char*)_cardano_malloc(hrp_size);
+  byte_t* decoded_data = (data_length <= sizeof(data_buffer)) ? data_buffer : (byte_t*)_cardano_malloc(data_length);
+
+  cardano_error_t result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+
+  if ((hrp != NULL) && (decoded_data != NULL))
+  {
+    result = cardano_encoding_bech32_decode(data, size, hrp, hrp_size, decoded_data, data_length);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_address_from_bytes(decoded_data, data_length, address);
+    }
+  }
+
+  if (hrp != hrp_buffer)
+  {
+    _cardano_free(hrp);
+  }
+
+  if (decoded_data != data_buffer)
+  {
+    _cardano_free(decoded_data);
+  }
+
+  return result;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -202,43 +272,7 @@ cardano_address_from_string(const char* data, const size_t size, cardano_address
 
   if (_cardano_has_valid_bech32_prefix(data, size))
   {
-    size_t       hrp_size    = 0;
-    const size_t data_length = cardano_encoding_bech32_get_decoded_length(data, size, &hrp_size);
-    char*        hrp         = (char*)_cardano_malloc(hrp_size);
-
-    if ((hrp_size == 0U) || (hrp == NULL))
-    {
-      _cardano_free(hrp);
-
-      return CARDANO_ERROR_INVALID_ADDRESS_FORMAT;
-    }
-
-    byte_t* decoded_data = (byte_t*)_cardano_malloc(data_length);
-
-    if ((data_length == 0U) || (decoded_data == NULL))
-    {
-      _cardano_free(hrp);
-      _cardano_free(decoded_data);
-
-      return CARDANO_ERROR_INVALID_ADDRESS_FORMAT;
-    }
-
-    cardano_error_t result = cardano_encoding_bech32_decode(data, size, hrp, hrp_size, decoded_data, data_length);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      _cardano_free(hrp);
-      _cardano_free(decoded_data);
-
-      return result;
-    }
-
-    result = cardano_address_from_bytes(decoded_data, data_length, address);
-
-    _cardano_free(hrp);
-    _cardano_free(decoded_data);
-
-    return result;
+    return decode_bech32_address(data, size, address);
   }
 
   const size_t base58_data_length = cardano_encoding_base58_get_decoded_length(data, size);
@@ -265,6 +299,47 @@ cardano_address_from_string(const char* data, const size_t size, cardano_address
   return result;
 }
 
+cardano_error_t
+cardano_address_from_strings(
+  const char* const*  strings,
+  const size_t*       sizes,
+  const size_t        count,
+  cardano_address_t** addresses,
+  size_t*             failed_index)
+{
+  if ((strings == NULL) || (sizes == NULL) || (addresses == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    addresses[i] = NULL;
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    cardano_error_t result = cardano_address_from_string(strings[i], sizes[i], &addresses[i]);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      for (size_t j = 0U; j < i; ++j)
+      {
+        cardano_address_unref(&addresses[j]);
+      }
+
+      if (failed_index != NULL)
+      {
+        *failed_index = i;
+      }
+
+      return result;
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
 size_t
 cardano_address_get_string_size(const cardano_address_t* address)
 {
@@ -320,42 +395,14 @@ cardano_address_get_string(const cardano_address_t* address)
 bool
 cardano_address_is_valid_bech32(const char* data, const size_t size)
 {
-  size_t       hrp_size    = 0;
-  const size_t data_length = cardano_encoding_bech32_get_decoded_length(data, size, &hrp_size);
-  char*        hrp         = (char*)_cardano_malloc(hrp_size);
-
-  if ((hrp_size == 0U) || (hrp == NULL))
-  {
-    _cardano_free(hrp);
-
-    return false;
-  }
-
-  byte_t* decoded_data = (byte_t*)_cardano_malloc(data_length);
-
-  if ((data_length == 0U) || (decoded_data == NULL))
+  if ((data == NULL) || (size == 0U))
   {
-    _cardano_free(hrp);
-    _cardano_free(decoded_data);
-
-    return false;
-  }
-
-  cardano_error_t result = cardano_encoding_bech32_decode(data, size, hrp, hrp_size, decoded_data, data_length);
-
-  if (result != CARDANO_SUCCESS)
-  {
-    _cardano_free(hrp);
-    _cardano_free(decoded_data);
-
     return false;
   }
 
   cardano_address_t* address = NULL;
-  result                     = cardano_address_from_bytes(decoded_data, data_length, &address);
+  cardano_error_t    result  = decode_bech32_address(data, size, &address);
 
-  _cardano_free(hrp);
-  _cardano_free(decoded_data);
   cardano_address_unref(&address);
 
   return result == CARDANO_SUCCESS;
@@ -621,3 +668,30 @@ cardano_address_get_last_error(const cardano_address_t* address)
 {
   return cardano_object_get_last_error(&address->base);
 }
+
+void
+_cardano_address_add_footprint(const cardano_address_t* address, cardano_footprint_context_t* context)
+{
+  if ((address == NULL) || !_cardano_footprint_visit(context, &address->base, CARDANO_MEMORY_FOOTPRINT_TYPE_ADDRESS, sizeof(cardano_address_t)))
+  {
+    return;
+  }
+
+  if (address->network_id != NULL)
+  {
+    _cardano_footprint_add_block(context, CARDANO_MEMORY_FOOTPRINT_TYPE_ADDRESS, sizeof(cardano_network_id_t));
+  }
+
+  if (address->stake_pointer != NULL)
+  {
+    _cardano_footprint_add_block(context, CARDANO_MEMORY_FOOTPRINT_TYPE_ADDRESS, sizeof(cardano_stake_pointer_t));
+  }
+
+  if (address->byron_content != NULL)
+  {
+    _cardano_footprint_add_block(context, CARDANO_MEMORY_FOOTPRINT_TYPE_ADDRESS, sizeof(cardano_byron_address_content_t));
+  }
+
+  _cardano_credential_add_footprint(address->payment_credential, context);
+  _cardano_credential_add_footprint(address->stake_credential, context);
+}
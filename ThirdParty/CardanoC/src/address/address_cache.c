@@ -0,0 +1,350 @@
+/**
+ * \file address_cache.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/address/address.h>
+#include <cardano/address/address_cache.h>
+
+#include "../allocators.h"
+
+#include <string.h>
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A cached address with the hashes of both of its lookup keys.
+ */
+typedef struct address_cache_entry_t
+{
+    cardano_address_t* address;
+    uint64_t           string_hash;
+    uint64_t           bytes_hash;
+    uint64_t           last_used;
+} address_cache_entry_t;
+
+/**
+ * \brief The global address cache.
+ *
+ * Capacities are small, so lookups scan the table and compare the stored hashes before the keys themselves.
+ */
+typedef struct address_cache_t
+{
+    address_cache_entry_t* entries;
+    size_t                 capacity;
+    size_t                 size;
+    uint64_t               clock;
+} address_cache_t;
+
+/* STATIC DECLARATIONS *******************************************************/
+
+static address_cache_t s_address_cache = { NULL, 0U, 0U, 0U };
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Computes the 64-bit FNV-1a hash of a buffer.
+ *
+ * \param[in] data The buffer to hash.
+ * \param[in] size The size of the buffer.
+ *
+ * \return The hash of the buffer.
+ */
+static uint64_t
+hash_bytes(const byte_t* data, const size_t size)
+{
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (size_t i = 0U; i < size; ++i)
+  {
+    hash ^= (uint64_t)data[i];
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+/**
+ * \brief Tells whether the cache can be used by the calling thread right now.
+ *
+ * Addresses created inside an arena scope are released when the scope ends, so they must never enter the cache, and
+ * references taken inside a scope are never given back.
+ *
+ * \return true if the cache is enabled and no arena scope is active.
+ */
+static bool
+is_cache_usable(void)
+{
+  return (s_address_cache.entries != NULL) && !_cardano_is_arena_active();
+}
+
+/**
+ * \brief Marks an entry as used and returns a new reference to its address.
+ *
+ * \param[in] entry The entry that was hit.
+ * \param[out] address Receives the new reference.
+ */
+static void
+take_entry(address_cache_entry_t* entry, cardano_address_t** address)
+{
+  ++s_address_cache.clock;
+  entry->last_used = s_address_cache.clock;
+
+  cardano_address_ref(entry->address);
+  *address = entry->address;
+}
+
+/**
+ * \brief Finds the cached address whose string representation matches the given string.
+ *
+ * \param[in] data The string to look for.
+ * \param[in] size The length of the string.
+ * \param[in] hash The hash of the string.
+ *
+ * \return The matching entry, or NULL if there is none.
+ */
+static address_cache_entry_t*
+find_by_string(const char* data, const size_t size, const uint64_t hash)
+{
+  for (size_t i = 0U; i < s_address_cache.size; ++i)
+  {
+    address_cache_entry_t* entry = &s_address_cache.entries[i];
+
+    if (entry->string_hash != hash)
+    {
+      continue;
+    }
+
+    const char* string = cardano_address_get_string(entry->address);
+
+    if ((cardano_address_get_string_size(entry->address) == (size + 1U)) && (memcmp(string, data, size) == 0))
+    {
+      return entry;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Finds the cached address whose raw bytes match the given buffer.
+ *
+ * \param[in] data The bytes to look for.
+ * \param[in] size The number of bytes.
+ * \param[in] hash The hash of the bytes.
+ *
+ * \return The matching entry, or NULL if there is none.
+ */
+static address_cache_entry_t*
+find_by_bytes(const byte_t* data, const size_t size, const uint64_t hash)
+{
+  for (size_t i = 0U; i < s_address_cache.size; ++i)
+  {
+    address_cache_entry_t* entry = &s_address_cache.entries[i];
+
+    if (entry->bytes_hash != hash)
+    {
+      continue;
+    }
+
+    const byte_t* bytes = cardano_address_get_bytes(entry->address);
+
+    if ((cardano_address_get_bytes_size(entry->address) == size) && (memcmp(bytes, data, size) == 0))
+    {
+      return entry;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Adds a freshly decoded address to the cache, or swaps it for an equal address that is already cached.
+ *
+ * A string lookup misses when the same address is spelled differently (for instance in upper case), so the bytes
+ * are checked before inserting to keep a single instance per address.
+ *
+ * \param[in,out] address The decoded address. If an equal address is cached, it is released and replaced by a new
+ *                        reference to the cached one.
+ */
+static void
+insert_address(cardano_address_t** address)
+{
+  const byte_t*  bytes      = cardano_address_get_bytes(*address);
+  const size_t   bytes_size = cardano_address_get_bytes_size(*address);
+  const uint64_t bytes_hash = hash_bytes(bytes, bytes_size);
+
+  address_cache_entry_t* entry = find_by_bytes(bytes, bytes_size, bytes_hash);
+
+  if (entry != NULL)
+  {
+    cardano_address_unref(address);
+    take_entry(entry, address);
+
+    return;
+  }
+
+  if (s_address_cache.size < s_address_cache.capacity)
+  {
+    entry = &s_address_cache.entries[s_address_cache.size];
+    ++s_address_cache.size;
+  }
+  else
+  {
+    entry = &s_address_cache.entries[0];
+
+    for (size_t i = 1U; i < s_address_cache.size; ++i)
+    {
+      if (s_address_cache.entries[i].last_used < entry->last_used)
+      {
+        entry = &s_address_cache.entries[i];
+      }
+    }
+
+    cardano_address_unref(&entry->address);
+  }
+
+  const char* string = cardano_address_get_string(*address);
+
+  entry->address     = *address;
+  entry->string_hash = hash_bytes((const byte_t*)((const void*)string), cardano_address_get_string_size(*address) - 1U);
+  entry->bytes_hash  = bytes_hash;
+
+  ++s_address_cache.clock;
+  entry->last_used = s_address_cache.clock;
+
+  cardano_address_ref(*address);
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_address_cache_enable(const size_t capacity)
+{
+  if (_cardano_is_arena_active())
+  {
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  const size_t           new_capacity = (capacity == 0U) ? CARDANO_ADDRESS_CACHE_DEFAULT_CAPACITY : capacity;
+  address_cache_entry_t* entries      = (address_cache_entry_t*)_cardano_malloc(new_capacity * sizeof(address_cache_entry_t));
+
+  if (entries == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_address_cache_disable();
+
+  s_address_cache.entries  = entries;
+  s_address_cache.capacity = new_capacity;
+
+  return CARDANO_SUCCESS;
+}
+
+void
+cardano_address_cache_disable(void)
+{
+  cardano_address_cache_clear();
+
+  _cardano_free(s_address_cache.entries);
+
+  s_address_cache.entries  = NULL;
+  s_address_cache.capacity = 0U;
+  s_address_cache.clock    = 0U;
+}
+
+void
+cardano_address_cache_clear(void)
+{
+  for (size_t i = 0U; i < s_address_cache.size; ++i)
+  {
+    cardano_address_unref(&s_address_cache.entries[i].address);
+  }
+
+  s_address_cache.size = 0U;
+}
+
+bool
+cardano_address_cache_is_enabled(void)
+{
+  return s_address_cache.entries != NULL;
+}
+
+size_t
+cardano_address_cache_get_size(void)
+{
+  return s_address_cache.size;
+}
+
+cardano_error_t
+cardano_address_intern_from_string(const char* data, const size_t size, cardano_address_t** address)
+{
+  if ((data == NULL) || (address == NULL) || !is_cache_usable())
+  {
+    return cardano_address_from_string(data, size, address);
+  }
+
+  address_cache_entry_t* entry = find_by_string(data, size, hash_bytes((const byte_t*)((const void*)data), size));
+
+  if (entry != NULL)
+  {
+    take_entry(entry, address);
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_error_t result = cardano_address_from_string(data, size, address);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    insert_address(address);
+  }
+
+  return result;
+}
+
+cardano_error_t
+cardano_address_intern_from_bytes(const byte_t* data, const size_t size, cardano_address_t** address)
+{
+  if ((data == NULL) || (address == NULL) || !is_cache_usable())
+  {
+    return cardano_address_from_bytes(data, size, address);
+  }
+
+  address_cache_entry_t* entry = find_by_bytes(data, size, hash_bytes(data, size));
+
+  if (entry != NULL)
+  {
+    take_entry(entry, address);
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_error_t result = cardano_address_from_bytes(data, size, address);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    insert_address(address);
+  }
+
+  return result;
+}
@@ -0,0 +1,467 @@
+/**
+ * \file address_factory.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/address/address_factory.h>
+#include <cardano/address/address_type.h>
+#include <cardano/crypto/blake2b_hash_size.h>
+#include <cardano/encoding/bech32.h>
+
+#include "../build_profile.h"
+#include "./internals/addr_common.h"
+
+#include <sodium.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Size of a credential hash.
+ */
+#define CREDENTIAL_HASH_SIZE ((size_t)CARDANO_BLAKE2B_HASH_SIZE_224)
+
+/**
+ * \brief Size of an Ed25519 public key.
+ */
+#define PUBLIC_KEY_SIZE 32U
+
+/**
+ * \brief Size of a base address: a header byte and two credential hashes.
+ */
+#define BASE_ADDRESS_SIZE (1U + (2U * CREDENTIAL_HASH_SIZE))
+
+/**
+ * \brief Size of an enterprise or reward address: a header byte and one credential hash.
+ */
+#define SINGLE_CREDENTIAL_ADDRESS_SIZE (1U + CREDENTIAL_HASH_SIZE)
+
+/**
+ * \brief Number of addresses whose keys are hashed together by \ref cardano_address_factory_from_keys.
+ */
+#define KEY_BATCH_SIZE 32U
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Gets the size of the raw bytes of an address of the given kind.
+ *
+ * \param[in] kind The kind of address.
+ *
+ * \return The size in bytes, or zero if the kind is not valid.
+ */
+static size_t
+get_data_size(const cardano_address_factory_kind_t kind)
+{
+  switch (kind)
+  {
+    case CARDANO_ADDRESS_FACTORY_KIND_BASE:
+      return BASE_ADDRESS_SIZE;
+    case CARDANO_ADDRESS_FACTORY_KIND_ENTERPRISE:
+    case CARDANO_ADDRESS_FACTORY_KIND_REWARD:
+      return SINGLE_CREDENTIAL_ADDRESS_SIZE;
+    default:
+      return 0U;
+  }
+}
+
+/**
+ * \brief Gets the address type of an address of the given kind and credential types.
+ *
+ * \param[in] kind The kind of address.
+ * \param[in] type The type of the payment credential, or of the stake credential of a reward address.
+ * \param[in] stake_type The type of the stake credential of a base address.
+ *
+ * \return The address type.
+ */
+static cardano_address_type_t
+get_address_type(
+  const cardano_address_factory_kind_t kind,
+  const cardano_credential_type_t      type,
+  const cardano_credential_type_t      stake_type)
+{
+  const uint32_t script_bit = (type == CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH) ? 1U : 0U;
+
+  switch (kind)
+  {
+    case CARDANO_ADDRESS_FACTORY_KIND_ENTERPRISE:
+      return (cardano_address_type_t)((uint32_t)CARDANO_ADDRESS_TYPE_ENTERPRISE_KEY | script_bit);
+    case CARDANO_ADDRESS_FACTORY_KIND_REWARD:
+      return (cardano_address_type_t)((uint32_t)CARDANO_ADDRESS_TYPE_REWARD_KEY | script_bit);
+    case CARDANO_ADDRESS_FACTORY_KIND_BASE:
+    default:
+      return (cardano_address_type_t)(script_bit | ((stake_type == CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH) ? 2U : 0U));
+  }
+}
+
+/**
+ * \brief Checks the arguments shared by the factory functions.
+ *
+ * \param[in] kind The kind of address.
+ * \param[in] network_id The network of the addresses.
+ * \param[in] count The number of addresses.
+ * \param[in] has_stake Whether stake credentials were given.
+ * \param[in] stake_count The number of stake credentials.
+ * \param[in] output The output buffer.
+ * \param[in] output_size The size of the output buffer.
+ *
+ * \return \ref CARDANO_SUCCESS if the arguments are valid, or the error to report.
+ */
+static cardano_error_t
+validate_arguments(
+  const cardano_address_factory_kind_t kind,
+  const cardano_network_id_t           network_id,
+  const size_t                         count,
+  const bool                           has_stake,
+  const size_t                         stake_count,
+  const char*                          output,
+  const size_t                         output_size)
+{
+  const size_t slot_size = cardano_address_factory_get_string_size(kind, network_id);
+
+  if ((slot_size == 0U) || ((uint32_t)network_id > 0x0FU))
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (kind == CARDANO_ADDRESS_FACTORY_KIND_BASE)
+  {
+    if ((count > 0U) && !has_stake)
+    {
+      return CARDANO_ERROR_POINTER_IS_NULL;
+    }
+
+    if ((count > 0U) && (stake_count != 1U) && (stake_count != count))
+    {
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+  }
+  else if (stake_count != 0U)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (count == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  if (output == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((count > (SIZE_MAX / slot_size)) || (output_size < (count * slot_size)))
+  {
+    return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Encodes one address into its slot of the output buffer.
+ *
+ * \param[in] kind The kind of address.
+ * \param[in] network_id The network of the address.
+ * \param[in] hash The payment credential hash, or the stake credential hash of a reward address.
+ * \param[in] type The type of \p hash.
+ * \param[in] stake_hash The stake credential hash of a base address, NULL otherwise.
+ * \param[in] stake_type The type of \p stake_hash.
+ * \param[out] output The slot to write to.
+ * \param[in] output_size The size of the slot.
+ */
+static void
+encode_address(
+  const cardano_address_factory_kind_t kind,
+  const cardano_network_id_t           network_id,
+  const byte_t*                        hash,
+  const cardano_credential_type_t      type,
+  const byte_t*                        stake_hash,
+  const cardano_credential_type_t      stake_type,
+  char*                                output,
+  const size_t                         output_size)
+{
+  byte_t         data[BASE_ADDRESS_SIZE];
+  const size_t   data_size    = get_data_size(kind);
+  const uint32_t address_type = (uint32_t)get_address_type(kind, type, stake_type);
+
+  data[0] = (byte_t)((address_type << 4U) | ((uint32_t)network_id & 0x0FU));
+  memcpy(&data[1], hash, CREDENTIAL_HASH_SIZE);
+
+  if (kind == CARDANO_ADDRESS_FACTORY_KIND_BASE)
+  {
+    memcpy(&data[1U + CREDENTIAL_HASH_SIZE], stake_hash, CREDENTIAL_HASH_SIZE);
+  }
+
+  _cardano_to_bech32_addr(data, data_size, network_id, (cardano_address_type_t)address_type, output, output_size);
+}
+
+/* DEFINITIONS ***************************************************************/
+
+size_t
+cardano_address_factory_get_string_size(const cardano_address_factory_kind_t kind, const cardano_network_id_t network_id)
+{
+  static const byte_t empty[BASE_ADDRESS_SIZE] = { 0 };
+
+  const size_t data_size = get_data_size(kind);
+
+  if (data_size == 0U)
+  {
+    return 0U;
+  }
+
+  const cardano_address_type_t type = get_address_type(kind, CARDANO_CREDENTIAL_TYPE_KEY_HASH, CARDANO_CREDENTIAL_TYPE_KEY_HASH);
+
+  size_t      hrp_size = 0U;
+  const char* hrp      = _cardano_get_bech32_prefix(type, network_id, &hrp_size);
+
+  return cardano_encoding_bech32_get_encoded_length(hrp, hrp_size, empty, data_size);
+}
+
+cardano_error_t
+cardano_address_factory_from_hashes(
+  const cardano_address_factory_kind_t kind,
+  const cardano_network_id_t           network_id,
+  const byte_t*                        hashes,
+  const cardano_credential_type_t      type,
+  const size_t                         count,
+  const byte_t*                        stake_hashes,
+  const cardano_credential_type_t      stake_type,
+  const size_t                         stake_count,
+  char*                                output,
+  const size_t                         output_size)
+{
+  cardano_error_t result = validate_arguments(kind, network_id, count, stake_hashes != NULL, stake_count, output, output_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if ((count > 0U) && (hashes == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const size_t slot_size = cardano_address_factory_get_string_size(kind, network_id);
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    const byte_t* stake_hash = (stake_count == 0U) ? NULL : &stake_hashes[(stake_count == 1U) ? 0U : (i * CREDENTIAL_HASH_SIZE)];
+
+    encode_address(kind, network_id, &hashes[i * CREDENTIAL_HASH_SIZE], type, stake_hash, stake_type, &output[i * slot_size], slot_size);
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_address_factory_from_credentials(
+  const cardano_address_factory_kind_t kind,
+  const cardano_network_id_t           network_id,
+  const cardano_credential_t* const*   credentials,
+  const size_t                         count,
+  const cardano_credential_t* const*   stake_credentials,
+  const size_t                         stake_count,
+  char*                                output,
+  const size_t                         output_size)
+{
+  cardano_error_t result = validate_arguments(kind, network_id, count, stake_credentials != NULL, stake_count, output, output_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if ((count > 0U) && (credentials == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  // Every credential is checked before the first address is written, so a failure leaves the output untouched
+  for (size_t i = 0U; i < (count + stake_count); ++i)
+  {
+    const cardano_credential_t* credential = (i < count) ? credentials[i] : stake_credentials[i - count];
+
+    if (credential == NULL)
+    {
+      return CARDANO_ERROR_POINTER_IS_NULL;
+    }
+
+    if (cardano_credential_get_hash_bytes_size(credential) != CREDENTIAL_HASH_SIZE)
+    {
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+  }
+
+  const size_t slot_size = cardano_address_factory_get_string_size(kind, network_id);
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    const cardano_credential_t* stake      = (stake_count == 0U) ? NULL : stake_credentials[(stake_count == 1U) ? 0U : i];
+    cardano_credential_type_t   type       = CARDANO_CREDENTIAL_TYPE_KEY_HASH;
+    cardano_credential_type_t   stake_type = CARDANO_CREDENTIAL_TYPE_KEY_HASH;
+
+    // Cannot fail on the credentials checked above
+    result = cardano_credential_get_type(credentials[i], &type);
+
+    if (stake != NULL)
+    {
+      result = cardano_credential_get_type(stake, &stake_type);
+    }
+
+    CARDANO_UNUSED(result);
+
+    encode_address(
+      kind,
+      network_id,
+      cardano_credential_get_hash_bytes(credentials[i]),
+      type,
+      (stake != NULL) ? cardano_credential_get_hash_bytes(stake) : NULL,
+      stake_type,
+      &output[i * slot_size],
+      slot_size);
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_address_factory_from_keys(
+  const cardano_address_factory_kind_t       kind,
+  const cardano_network_id_t                 network_id,
+  const cardano_ed25519_public_key_t* const* keys,
+  const size_t                               count,
+  const cardano_ed25519_public_key_t* const* stake_keys,
+  const size_t                               stake_count,
+  byte_t*                                    key_hashes,
+  char*                                      output,
+  const size_t                               output_size)
+{
+  cardano_error_t result = validate_arguments(kind, network_id, count, stake_keys != NULL, stake_count, output, output_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (count == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  if (keys == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  for (size_t i = 0U; i < (count + stake_count); ++i)
+  {
+    if (((i < count) ? keys[i] : stake_keys[i - count]) == NULL)
+    {
+      return CARDANO_ERROR_POINTER_IS_NULL;
+    }
+  }
+
+  if (sodium_init() == -1)
+  {
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  // The one scratch buffer: a batch of payment key hashes followed by their stake key hashes
+  byte_t               digests[2U * KEY_BATCH_SIZE * CREDENTIAL_HASH_SIZE];
+  const unsigned char* inputs[2U * KEY_BATCH_SIZE];
+  unsigned long long   lengths[2U * KEY_BATCH_SIZE];
+  byte_t               shared_stake_hash[CREDENTIAL_HASH_SIZE];
+
+  if (stake_count == 1U)
+  {
+    if (crypto_generichash(shared_stake_hash, CREDENTIAL_HASH_SIZE, cardano_ed25519_public_key_get_data(stake_keys[0]), PUBLIC_KEY_SIZE, NULL, 0U) == -1)
+    {
+      return CARDANO_ERROR_GENERIC;
+    }
+
+    _cardano_build_profile_count_hash();
+  }
+
+  const size_t slot_size = cardano_address_factory_get_string_size(kind, network_id);
+
+  for (size_t first = 0U; first < count; first += KEY_BATCH_SIZE)
+  {
+    const size_t batch_size   = ((count - first) < KEY_BATCH_SIZE) ? (count - first) : KEY_BATCH_SIZE;
+    const size_t stake_hashes = (stake_count == count) ? batch_size : 0U;
+
+    for (size_t i = 0U; i < batch_size; ++i)
+    {
+      inputs[i]  = cardano_ed25519_public_key_get_data(keys[first + i]);
+      lengths[i] = PUBLIC_KEY_SIZE;
+    }
+
+    for (size_t i = 0U; i < stake_hashes; ++i)
+    {
+      inputs[batch_size + i]  = cardano_ed25519_public_key_get_data(stake_keys[first + i]);
+      lengths[batch_size + i] = PUBLIC_KEY_SIZE;
+    }
+
+    if (crypto_generichash_blake2b_many(digests, CREDENTIAL_HASH_SIZE, inputs, lengths, batch_size + stake_hashes) == -1)
+    {
+      return CARDANO_ERROR_GENERIC;
+    }
+
+    for (size_t i = 0U; i < (batch_size + stake_hashes); ++i)
+    {
+      _cardano_build_profile_count_hash();
+    }
+
+    for (size_t i = 0U; i < batch_size; ++i)
+    {
+      const byte_t* hash       = &digests[i * CREDENTIAL_HASH_SIZE];
+      const byte_t* stake_hash = NULL;
+
+      if (stake_count == 1U)
+      {
+        stake_hash = shared_stake_hash;
+      }
+      else if (stake_hashes > 0U)
+      {
+        stake_hash = &digests[(batch_size + i) * CREDENTIAL_HASH_SIZE];
+      }
+
+      encode_address(
+        kind,
+        network_id,
+        hash,
+        CARDANO_CREDENTIAL_TYPE_KEY_HASH,
+        stake_hash,
+        CARDANO_CREDENTIAL_TYPE_KEY_HASH,
+        &output[(first + i) * slot_size],
+        slot_size);
+
+      if (key_hashes != NULL)
+      {
+        memcpy(&key_hashes[(first + i) * CREDENTIAL_HASH_SIZE], hash, CREDENTIAL_HASH_SIZE);
+      }
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
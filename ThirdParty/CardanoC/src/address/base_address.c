@@ -69,7 +69,7 @@ cardano_base_address_from_credentials(
   }
 
   address->base.ref_count     = 1;
-  address->base.last_error[0] = '\0';
+  address->base.last_error    = NULL;
   address->base.deallocator   = _cardano_address_deallocate;
 
   const cardano_error_t result = _cardano_get_base_address_type(payment, stake, &address->type);
@@ -69,7 +69,7 @@ cardano_byron_address_from_credentials(
   }
 
   address->base.ref_count            = 1;
-  address->base.last_error[0]        = '\0';
+  address->base.last_error           = NULL;
   address->base.deallocator          = _cardano_address_deallocate;
   address->type                      = CARDANO_ADDRESS_TYPE_BYRON;
   address->network_id                = NULL;
@@ -64,7 +64,7 @@ cardano_pointer_address_from_credentials(
   }
 
   address->base.ref_count     = 1;
-  address->base.last_error[0] = '\0';
+  address->base.last_error    = NULL;
   address->base.deallocator   = _cardano_address_deallocate;
 
   cardano_credential_type_t credential_type = CARDANO_CREDENTIAL_TYPE_KEY_HASH;
@@ -23,30 +23,875 @@
 
 #include "allocators.h"
 
+#include <cardano/allocation_stats.h>
+#include <cardano/arena.h>
+
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
-/* DEFINITIONS ***************************************************************/
+#if defined(LIB_CARDANO_C_ALLOCATION_TRACKING) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/* The definitions below are the ones the tracking macros of allocators.h stand in for. */
+#undef _cardano_malloc
+#undef _cardano_realloc
+
+/* CONSTANTS *****************************************************************/
+
+#if defined(_MSC_VER)
+#define CARDANO_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+#define CARDANO_THREAD_LOCAL _Thread_local
+#else
+#define CARDANO_THREAD_LOCAL __thread
+#endif
+
+static const size_t ARENA_ALIGNMENT = 16U;
+
+#ifdef LIB_CARDANO_C_ALLOCATION_TRACKING
+static const size_t TRACKING_HEADER_SIZE = 16U;
+#endif
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A contiguous chunk of memory from which arena allocations are carved.
+ */
+typedef struct arena_block_t
+{
+    struct arena_block_t* next;
+    size_t                capacity;
+    size_t                offset;
+    byte_t*               data;
+} arena_block_t;
+
+/**
+ * \brief A bump allocator serving every allocation of the thread it is active on.
+ */
+typedef struct cardano_arena_t
+{
+    size_t           block_size;
+    arena_block_t*   blocks;
+    arena_block_t*   spare_blocks;
+    size_t           used;
+    bool             active;
+    cardano_arena_t* previous;
+} cardano_arena_t;
+
+#ifdef LIB_CARDANO_C_ALLOCATION_TRACKING
+
+/**
+ * \brief The counters of one allocation tag, only ever updated atomically.
+ */
+typedef struct allocation_counters_t
+{
+    size_t allocation_count;
+    size_t allocated_bytes;
+    size_t live_count;
+    size_t live_bytes;
+    size_t peak_bytes;
+} allocation_counters_t;
+
+/**
+ * \brief Maps the directory right below `src` to the tag of the allocations made by its files.
+ */
+typedef struct tag_directory_t
+{
+    const char*              name;
+    cardano_allocation_tag_t tag;
+} tag_directory_t;
+
+#endif
+
+/* STATIC DECLARATIONS *******************************************************/
 
 static _cardano_malloc_t  s_cardano_malloc  = malloc;
 static _cardano_realloc_t s_cardano_realloc = realloc;
 static _cardano_free_t    s_cardano_free    = free;
 
+static CARDANO_THREAD_LOCAL cardano_arena_t* s_current_arena = NULL;
+
+#ifdef LIB_CARDANO_C_ALLOCATION_TRACKING
+
+static allocation_counters_t s_allocation_counters[CARDANO_ALLOCATION_TAG_COUNT];
+
+static const tag_directory_t TAG_DIRECTORIES[] = {
+  { "buffer", CARDANO_ALLOCATION_TAG_BUFFER },
+  { "cbor", CARDANO_ALLOCATION_TAG_CBOR },
+  { "collections", CARDANO_ALLOCATION_TAG_COLLECTIONS },
+  { "crypto", CARDANO_ALLOCATION_TAG_CRYPTO },
+  { "json", CARDANO_ALLOCATION_TAG_JSON },
+  { "key_handlers", CARDANO_ALLOCATION_TAG_CRYPTO },
+  { "transaction_builder", CARDANO_ALLOCATION_TAG_BUILDER },
+};
+
+#endif
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Rounds a size up to the arena alignment.
+ *
+ * \param size The size to round.
+ *
+ * \return The rounded size, or zero on overflow.
+ */
+static size_t
+align_size(const size_t size)
+{
+  if (size > (SIZE_MAX - ARENA_ALIGNMENT))
+  {
+    return 0U;
+  }
+
+  return (size + ARENA_ALIGNMENT - 1U) & ~(ARENA_ALIGNMENT - 1U);
+}
+
+/**
+ * \brief Gets a block able to hold at least `size` bytes, reusing a spare one when possible.
+ *
+ * \param arena The arena that will own the block.
+ * \param size The number of bytes the block must hold.
+ *
+ * \return The block, already linked at the head of the arena blocks, or NULL if it could not be allocated.
+ */
+static arena_block_t*
+acquire_block(cardano_arena_t* arena, const size_t size)
+{
+  arena_block_t* block = NULL;
+
+  if ((size <= arena->block_size) && (arena->spare_blocks != NULL))
+  {
+    block               = arena->spare_blocks;
+    arena->spare_blocks = block->next;
+  }
+  else
+  {
+    const size_t capacity = (size > arena->block_size) ? size : arena->block_size;
+    const size_t header   = align_size(sizeof(arena_block_t));
+
+    if (capacity > (SIZE_MAX - header))
+    {
+      return NULL;
+    }
+
+    block = (arena_block_t*)s_cardano_malloc(header + capacity);
+
+    if (block == NULL)
+    {
+      return NULL;
+    }
+
+    block->capacity = capacity;
+    block->data     = (byte_t*)block + header;
+  }
+
+  block->offset = 0U;
+  block->next   = arena->blocks;
+  arena->blocks = block;
+
+  return block;
+}
+
+/**
+ * \brief Serves an allocation from the arena.
+ *
+ * Every allocation is preceded by a header recording its size, so it can be reallocated later.
+ *
+ * \param arena The arena to allocate from.
+ * \param size The number of bytes requested.
+ *
+ * \return A pointer aligned to \ref ARENA_ALIGNMENT, or NULL if the arena could not grow.
+ */
+static void*
+arena_malloc(cardano_arena_t* arena, const size_t size)
+{
+  const size_t   payload = align_size(size);
+  arena_block_t* block   = arena->blocks;
+  byte_t*        header  = NULL;
+
+  if ((payload == 0U) && (size != 0U))
+  {
+    return NULL;
+  }
+
+  if (payload > (SIZE_MAX - ARENA_ALIGNMENT))
+  {
+    return NULL;
+  }
+
+  if ((block == NULL) || ((block->capacity - block->offset) < (ARENA_ALIGNMENT + payload)))
+  {
+    block = acquire_block(arena, ARENA_ALIGNMENT + payload);
+
+    if (block == NULL)
+    {
+      return NULL;
+    }
+  }
+
+  header = &block->data[block->offset];
+
+  block->offset += ARENA_ALIGNMENT + payload;
+  arena->used   += ARENA_ALIGNMENT + payload;
+
+  (void)memcpy(header, &payload, sizeof(payload));
+
+  return header + ARENA_ALIGNMENT;
+}
+
+/**
+ * \brief Checks whether a pointer was handed out by the arena.
+ *
+ * \param arena The arena to search.
+ * \param ptr The pointer to look for.
+ *
+ * \return The block holding the pointer, or NULL if it came from the heap.
+ */
+static arena_block_t*
+arena_find_block(const cardano_arena_t* arena, const void* ptr)
+{
+  const uintptr_t address = (uintptr_t)ptr;
+
+  for (arena_block_t* block = arena->blocks; block != NULL; block = block->next)
+  {
+    const uintptr_t start = (uintptr_t)block->data;
+
+    if ((address > start) && (address < (start + block->offset)))
+    {
+      return block;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Finds which of the arenas active on the calling thread, the current one or one it was nested in, holds a
+ * pointer.
+ *
+ * \param ptr The pointer to look for.
+ * \param block Receives the block holding the pointer.
+ *
+ * \return The arena holding the pointer, or NULL if it came from the heap.
+ */
+static cardano_arena_t*
+arena_find_owner(const void* ptr, arena_block_t** block)
+{
+  for (cardano_arena_t* arena = s_current_arena; arena != NULL; arena = arena->previous)
+  {
+    *block = arena_find_block(arena, ptr);
+
+    if (*block != NULL)
+    {
+      return arena;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Resizes an arena allocation.
+ *
+ * The last allocation of the current block is grown or shrunk in place, which makes growing buffers cheap; any other
+ * allocation is moved to a new one.
+ *
+ * \param arena The arena that owns `ptr`.
+ * \param block The block that holds `ptr`.
+ * \param ptr The allocation to resize.
+ * \param size The new size in bytes.
+ *
+ * \return The resized allocation, or NULL if the arena could not grow.
+ */
+static void*
+arena_realloc(cardano_arena_t* arena, arena_block_t* block, void* ptr, const size_t size)
+{
+  byte_t*      header   = (byte_t*)ptr - ARENA_ALIGNMENT;
+  const size_t payload  = align_size(size);
+  size_t       previous = 0U;
+  void*        moved    = NULL;
+
+  if ((payload == 0U) && (size != 0U))
+  {
+    return NULL;
+  }
+
+  (void)memcpy(&previous, header, sizeof(previous));
+
+  if ((block == arena->blocks) && (((byte_t*)ptr + previous) == &block->data[block->offset]))
+  {
+    const size_t start = (size_t)((byte_t*)ptr - block->data);
+
+    if (payload <= (block->capacity - start))
+    {
+      block->offset = start + payload;
+      arena->used   = (arena->used - previous) + payload;
+
+      (void)memcpy(header, &payload, sizeof(payload));
+
+      return ptr;
+    }
+  }
+
+  if (payload <= previous)
+  {
+    return ptr;
+  }
+
+  moved = arena_malloc(arena, size);
+
+  if (moved != NULL)
+  {
+    (void)memcpy(moved, ptr, previous);
+  }
+
+  return moved;
+}
+
+/**
+ * \brief Gives the arena blocks back to the spare list, or to the heap for the ones larger than the block size.
+ *
+ * \param arena The arena to reset.
+ */
+static void
+arena_reset(cardano_arena_t* arena)
+{
+  arena_block_t* block = arena->blocks;
+
+  while (block != NULL)
+  {
+    arena_block_t* next = block->next;
+
+    if (block->capacity > arena->block_size)
+    {
+      s_cardano_free(block);
+    }
+    else
+    {
+      block->next         = arena->spare_blocks;
+      arena->spare_blocks = block;
+    }
+
+    block = next;
+  }
+
+  arena->blocks = NULL;
+  arena->used   = 0U;
+}
+
+/**
+ * \brief Frees a linked list of blocks.
+ *
+ * \param block The first block of the list.
+ */
+static void
+free_blocks(arena_block_t* block)
+{
+  while (block != NULL)
+  {
+    arena_block_t* next = block->next;
+
+    s_cardano_free(block);
+    block = next;
+  }
+}
+
+#ifdef LIB_CARDANO_C_ALLOCATION_TRACKING
+
+/**
+ * \brief Atomically adds to a counter.
+ *
+ * \param counter The counter to update.
+ * \param delta The amount to add; subtracting is adding the two's complement.
+ *
+ * \return The value of the counter after the update.
+ */
+static size_t
+counter_add(size_t* counter, const size_t delta)
+{
+#if defined(_MSC_VER) && defined(_WIN64)
+  return (size_t)_InterlockedExchangeAdd64((volatile __int64*)counter, (__int64)delta) + delta;
+#elif defined(_MSC_VER)
+  return (size_t)_InterlockedExchangeAdd((volatile long*)counter, (long)delta) + delta;
+#else
+  return __atomic_add_fetch(counter, delta, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ * \brief Atomically reads a counter.
+ *
+ * \param counter The counter to read.
+ *
+ * \return The value of the counter.
+ */
+static size_t
+counter_load(size_t* counter)
+{
+#if defined(_MSC_VER)
+  return counter_add(counter, 0U);
+#else
+  return __atomic_load_n(counter, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ * \brief Atomically replaces a counter if it still holds the expected value.
+ *
+ * \param counter The counter to update.
+ * \param expected The value the counter must hold.
+ * \param desired The value to store.
+ *
+ * \return The value the counter held before the call; the update happened if it equals `expected`.
+ */
+static size_t
+counter_compare_exchange(size_t* counter, const size_t expected, const size_t desired)
+{
+#if defined(_MSC_VER) && defined(_WIN64)
+  return (size_t)_InterlockedCompareExchange64((volatile __int64*)counter, (__int64)desired, (__int64)expected);
+#elif defined(_MSC_VER)
+  return (size_t)_InterlockedCompareExchange((volatile long*)counter, (long)desired, (long)expected);
+#else
+  size_t previous = expected;
+
+  (void)__atomic_compare_exchange_n(counter, &previous, desired, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+
+  return previous;
+#endif
+}
+
+/**
+ * \brief Raises a peak counter to a new value if it is higher.
+ *
+ * \param peak The peak counter.
+ * \param value The value just reached.
+ */
+static void
+counter_raise(size_t* peak, const size_t value)
+{
+  size_t current = counter_load(peak);
+
+  while (current < value)
+  {
+    const size_t previous = counter_compare_exchange(peak, current, value);
+
+    if (previous == current)
+    {
+      break;
+    }
+
+    current = previous;
+  }
+}
+
+/**
+ * \brief Finds the tag of the allocations made by a source file, from the directory right below `src` in its path.
+ *
+ * \param file The path of the source file, or NULL.
+ *
+ * \return The tag, or \ref CARDANO_ALLOCATION_TAG_OTHER if the file is not in a tagged directory.
+ */
+static cardano_allocation_tag_t
+tag_from_file(const char* file)
+{
+  const char* directory = NULL;
+
+  if (file == NULL)
+  {
+    return CARDANO_ALLOCATION_TAG_OTHER;
+  }
+
+  for (const char* cursor = file; *cursor != '\0'; ++cursor)
+  {
+    const bool is_component = (cursor == file) || (cursor[-1] == '/') || (cursor[-1] == '\\');
+
+    if (is_component && (strncmp(cursor, "src", 3U) == 0) && ((cursor[3] == '/') || (cursor[3] == '\\')))
+    {
+      directory = &cursor[4];
+    }
+  }
+
+  if (directory == NULL)
+  {
+    return CARDANO_ALLOCATION_TAG_OTHER;
+  }
+
+  for (size_t i = 0U; i < (sizeof(TAG_DIRECTORIES) / sizeof(TAG_DIRECTORIES[0])); ++i)
+  {
+    const size_t length = strlen(TAG_DIRECTORIES[i].name);
+
+    if ((strncmp(directory, TAG_DIRECTORIES[i].name, length) == 0) && ((directory[length] == '/') || (directory[length] == '\\')))
+    {
+      return TAG_DIRECTORIES[i].tag;
+    }
+  }
+
+  return CARDANO_ALLOCATION_TAG_OTHER;
+}
+
+/**
+ * \brief Writes the header that precedes a tracked heap allocation.
+ *
+ * \param block The start of the heap block.
+ * \param size The size requested by the caller.
+ * \param tag The tag the allocation is counted under.
+ */
+static void
+write_header(byte_t* block, const size_t size, const cardano_allocation_tag_t tag)
+{
+  const size_t tag_value = (size_t)tag;
+
+  (void)memcpy(block, &size, sizeof(size));
+  (void)memcpy(&block[sizeof(size)], &tag_value, sizeof(tag_value));
+}
+
+/**
+ * \brief Reads the header that precedes a tracked heap allocation.
+ *
+ * \param block The start of the heap block.
+ * \param size On output, the size requested by the caller.
+ * \param tag On output, the tag the allocation is counted under.
+ */
+static void
+read_header(const byte_t* block, size_t* size, cardano_allocation_tag_t* tag)
+{
+  size_t tag_value = 0U;
+
+  (void)memcpy(size, block, sizeof(*size));
+  (void)memcpy(&tag_value, &block[sizeof(*size)], sizeof(tag_value));
+
+  *tag = (cardano_allocation_tag_t)tag_value;
+}
+
+#endif
+
+/**
+ * \brief Allocates memory from the heap, counting it under the subsystem of `file` when tracking is enabled.
+ *
+ * \param size The number of bytes requested.
+ * \param file The path of the source file making the allocation, or NULL.
+ *
+ * \return The allocation, or NULL if the heap is exhausted.
+ */
+static void*
+heap_malloc(const size_t size, const char* file)
+{
+#ifdef LIB_CARDANO_C_ALLOCATION_TRACKING
+  const cardano_allocation_tag_t tag      = tag_from_file(file);
+  allocation_counters_t*         counters = &s_allocation_counters[tag];
+  byte_t*                        block    = NULL;
+
+  if (size > (SIZE_MAX - TRACKING_HEADER_SIZE))
+  {
+    return NULL;
+  }
+
+  block = (byte_t*)s_cardano_malloc(TRACKING_HEADER_SIZE + size);
+
+  if (block == NULL)
+  {
+    return NULL;
+  }
+
+  write_header(block, size, tag);
+
+  (void)counter_add(&counters->allocation_count, 1U);
+  (void)counter_add(&counters->allocated_bytes, size);
+  (void)counter_add(&counters->live_count, 1U);
+  counter_raise(&counters->peak_bytes, counter_add(&counters->live_bytes, size));
+
+  return block + TRACKING_HEADER_SIZE;
+#else
+  (void)file;
+
+  return s_cardano_malloc(size);
+#endif
+}
+
+/**
+ * \brief Resizes a heap allocation, which keeps the tag it was allocated with.
+ *
+ * \param ptr The allocation to resize, or NULL to allocate.
+ * \param size The new size in bytes.
+ * \param file The path of the source file making the allocation, or NULL.
+ *
+ * \return The resized allocation, or NULL if the heap is exhausted, in which case `ptr` is left untouched.
+ */
+static void*
+heap_realloc(void* ptr, const size_t size, const char* file)
+{
+#ifdef LIB_CARDANO_C_ALLOCATION_TRACKING
+  byte_t*                  block    = NULL;
+  size_t                   previous = 0U;
+  cardano_allocation_tag_t tag      = CARDANO_ALLOCATION_TAG_OTHER;
+  allocation_counters_t*   counters = NULL;
+
+  if (ptr == NULL)
+  {
+    return heap_malloc(size, file);
+  }
+
+  if (size > (SIZE_MAX - TRACKING_HEADER_SIZE))
+  {
+    return NULL;
+  }
+
+  read_header((byte_t*)ptr - TRACKING_HEADER_SIZE, &previous, &tag);
+
+  block = (byte_t*)s_cardano_realloc((byte_t*)ptr - TRACKING_HEADER_SIZE, TRACKING_HEADER_SIZE + size);
+
+  if (block == NULL)
+  {
+    return NULL;
+  }
+
+  write_header(block, size, tag);
+
+  counters = &s_allocation_counters[tag];
+
+  if (size > previous)
+  {
+    (void)counter_add(&counters->allocated_bytes, size - previous);
+    counter_raise(&counters->peak_bytes, counter_add(&counters->live_bytes, size - previous));
+  }
+  else
+  {
+    (void)counter_add(&counters->live_bytes, (size_t)0U - (previous - size));
+  }
+
+  return block + TRACKING_HEADER_SIZE;
+#else
+  (void)file;
+
+  return s_cardano_realloc(ptr, size);
+#endif
+}
+
+/**
+ * \brief Returns a heap allocation to the heap.
+ *
+ * \param ptr The allocation to free, or NULL.
+ */
+static void
+heap_free(void* ptr)
+{
+#ifdef LIB_CARDANO_C_ALLOCATION_TRACKING
+  size_t                   size     = 0U;
+  cardano_allocation_tag_t tag      = CARDANO_ALLOCATION_TAG_OTHER;
+  allocation_counters_t*   counters = NULL;
+
+  if (ptr == NULL)
+  {
+    return;
+  }
+
+  read_header((byte_t*)ptr - TRACKING_HEADER_SIZE, &size, &tag);
+
+  counters = &s_allocation_counters[tag];
+
+  (void)counter_add(&counters->live_count, (size_t)0U - 1U);
+  (void)counter_add(&counters->live_bytes, (size_t)0U - size);
+
+  s_cardano_free((byte_t*)ptr - TRACKING_HEADER_SIZE);
+#else
+  s_cardano_free(ptr);
+#endif
+}
+
+/**
+ * \brief Serves an allocation from the arena of the calling thread, or from the heap when there is none.
+ *
+ * \param size The number of bytes requested.
+ * \param file The path of the source file making the allocation, or NULL.
+ *
+ * \return The allocation, or NULL if it could not be served.
+ */
+static void*
+allocate(const size_t size, const char* file)
+{
+  if (s_current_arena != NULL)
+  {
+    return arena_malloc(s_current_arena, size);
+  }
+
+  return heap_malloc(size, file);
+}
+
+/**
+ * \brief Resizes an allocation in whichever of the active arenas or the heap it came from.
+ *
+ * \param ptr The allocation to resize, or NULL to allocate.
+ * \param size The new size in bytes.
+ * \param file The path of the source file making the allocation, or NULL.
+ *
+ * \return The resized allocation, or NULL if it could not be served.
+ */
+static void*
+reallocate(void* ptr, const size_t size, const char* file)
+{
+  arena_block_t*   block = NULL;
+  cardano_arena_t* owner = NULL;
+
+  if (ptr == NULL)
+  {
+    return allocate(size, file);
+  }
+
+  owner = arena_find_owner(ptr, &block);
+
+  if (owner != NULL)
+  {
+    return arena_realloc(owner, block, ptr, size);
+  }
+
+  return heap_realloc(ptr, size, file);
+}
+
+/* DEFINITIONS ***************************************************************/
+
 void*
 _cardano_malloc(size_t size)
 {
-  return s_cardano_malloc(size);
+  return allocate(size, NULL);
 }
 
 void*
 _cardano_realloc(void* ptr, size_t size)
 {
-  return s_cardano_realloc(ptr, size);
+  return reallocate(ptr, size, NULL);
 }
 
 void
 _cardano_free(void* ptr)
 {
-  s_cardano_free(ptr);
+  arena_block_t* block = NULL;
+
+  if ((ptr != NULL) && (arena_find_owner(ptr, &block) != NULL))
+  {
+    return;
+  }
+
+  heap_free(ptr);
+}
+
+#ifdef LIB_CARDANO_C_ALLOCATION_TRACKING
+
+void*
+_cardano_tracked_malloc(size_t size, const char* file)
+{
+  return allocate(size, file);
+}
+
+void*
+_cardano_tracked_realloc(void* ptr, size_t size, const char* file)
+{
+  return reallocate(ptr, size, file);
+}
+
+#endif
+
+bool
+cardano_allocation_tracking_is_enabled(void)
+{
+#ifdef LIB_CARDANO_C_ALLOCATION_TRACKING
+  return true;
+#else
+  return false;
+#endif
+}
+
+cardano_error_t
+cardano_allocation_stats_get(const cardano_allocation_tag_t tag, cardano_allocation_stats_t* stats)
+{
+  if (stats == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  (void)memset(stats, 0, sizeof(*stats));
+
+  if (((int32_t)tag < 0) || (tag >= CARDANO_ALLOCATION_TAG_COUNT))
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+#ifdef LIB_CARDANO_C_ALLOCATION_TRACKING
+  allocation_counters_t* counters = &s_allocation_counters[tag];
+
+  stats->allocation_count = counter_load(&counters->allocation_count);
+  stats->allocated_bytes  = counter_load(&counters->allocated_bytes);
+  stats->live_count       = counter_load(&counters->live_count);
+  stats->live_bytes       = counter_load(&counters->live_bytes);
+  stats->peak_bytes       = counter_load(&counters->peak_bytes);
+
+  return CARDANO_SUCCESS;
+#else
+  return CARDANO_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+void
+cardano_allocation_stats_reset(void)
+{
+#ifdef LIB_CARDANO_C_ALLOCATION_TRACKING
+  for (size_t i = 0U; i < (size_t)CARDANO_ALLOCATION_TAG_COUNT; ++i)
+  {
+    allocation_counters_t* counters = &s_allocation_counters[i];
+    const size_t           live     = counter_load(&counters->live_bytes);
+
+    (void)counter_add(&counters->allocation_count, (size_t)0U - counter_load(&counters->allocation_count));
+    (void)counter_add(&counters->allocated_bytes, (size_t)0U - counter_load(&counters->allocated_bytes));
+    (void)counter_compare_exchange(&counters->peak_bytes, counter_load(&counters->peak_bytes), live);
+  }
+#endif
+}
+
+const char*
+cardano_allocation_tag_to_string(const cardano_allocation_tag_t tag)
+{
+  switch (tag)
+  {
+    case CARDANO_ALLOCATION_TAG_OTHER:
+      return "other";
+    case CARDANO_ALLOCATION_TAG_CBOR:
+      return "cbor";
+    case CARDANO_ALLOCATION_TAG_JSON:
+      return "json";
+    case CARDANO_ALLOCATION_TAG_CRYPTO:
+      return "crypto";
+    case CARDANO_ALLOCATION_TAG_BUILDER:
+      return "builder";
+    case CARDANO_ALLOCATION_TAG_COLLECTIONS:
+      return "collections";
+    case CARDANO_ALLOCATION_TAG_BUFFER:
+      return "buffer";
+    default:
+      return "unknown";
+  }
+}
+
+bool
+_cardano_is_arena_active(void)
+{
+  return s_current_arena != NULL;
+}
+
+void*
+_cardano_malloc_alongside(const void* owner, const size_t size)
+{
+  for (cardano_arena_t* arena = s_current_arena; (arena != NULL) && (owner != NULL); arena = arena->previous)
+  {
+    if (arena_find_block(arena, owner) != NULL)
+    {
+      return arena_malloc(arena, size);
+    }
+  }
+
+  return heap_malloc(size, NULL);
 }
 
 void
@@ -55,4 +900,105 @@ cardano_set_allocators(_cardano_malloc_t custom_malloc, _cardano_realloc_t custo
   s_cardano_malloc  = custom_malloc;
   s_cardano_realloc = custom_realloc;
   s_cardano_free    = custom_free;
-}
\ No newline at end of file
+}
+
+cardano_error_t
+cardano_arena_new(const size_t block_size, cardano_arena_t** arena)
+{
+  if (arena == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *arena = (cardano_arena_t*)s_cardano_malloc(sizeof(cardano_arena_t));
+
+  if (*arena == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  (*arena)->block_size   = (block_size == 0U) ? CARDANO_ARENA_DEFAULT_BLOCK_SIZE : align_size(block_size);
+  (*arena)->blocks       = NULL;
+  (*arena)->spare_blocks = NULL;
+  (*arena)->used         = 0U;
+  (*arena)->active       = false;
+  (*arena)->previous     = NULL;
+
+  if ((*arena)->block_size == 0U)
+  {
+    s_cardano_free(*arena);
+    *arena = NULL;
+
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_arena_begin(cardano_arena_t* arena)
+{
+  if (arena == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (arena->active)
+  {
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  arena->active   = true;
+  arena->previous = s_current_arena;
+  s_current_arena = arena;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_arena_end(cardano_arena_t* arena)
+{
+  if (arena == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (s_current_arena != arena)
+  {
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  s_current_arena = arena->previous;
+  arena->previous = NULL;
+  arena->active   = false;
+
+  arena_reset(arena);
+
+  return CARDANO_SUCCESS;
+}
+
+size_t
+cardano_arena_get_used_size(const cardano_arena_t* arena)
+{
+  if (arena == NULL)
+  {
+    return 0U;
+  }
+
+  return arena->used;
+}
+
+void
+cardano_arena_free(cardano_arena_t** arena)
+{
+  if ((arena == NULL) || (*arena == NULL))
+  {
+    return;
+  }
+
+  free_blocks((*arena)->blocks);
+  free_blocks((*arena)->spare_blocks);
+
+  s_cardano_free(*arena);
+  *arena = NULL;
+}
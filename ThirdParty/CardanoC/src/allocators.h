@@ -27,6 +27,8 @@
 #include <cardano/export.h>
 #include <cardano/typedefs.h>
 
+#include "config.h"
+
 /* DECLARATIONS **************************************************************/
 
 #ifdef __cplusplus
@@ -87,6 +89,31 @@ CARDANO_EXPORT void* _cardano_realloc(void* ptr, size_t size);
  */
 CARDANO_EXPORT void _cardano_free(void* ptr);
 
+/**
+ * \brief Tells whether an arena scope is active on the calling thread.
+ *
+ * Memory allocated while a scope is active is released when the scope ends, so code that keeps objects alive past
+ * the current call (caches, global tables) must not retain anything created inside a scope.
+ *
+ * \return true if \ref _cardano_malloc is currently served by an arena on this thread, false otherwise.
+ */
+CARDANO_EXPORT bool _cardano_is_arena_active(void);
+
+/**
+ * \brief Allocates memory that lives and dies with another allocation.
+ *
+ * The memory comes from the arena `owner` was carved from, if any of the scopes active on the calling thread owns it,
+ * and from the heap otherwise, whether or not a scope is active. Storage attached to an object after it was created,
+ * such as its last error message, is thereby released with the arena when the object is, and does not dangle when
+ * the object outlives an unrelated scope. Release it with \ref _cardano_free.
+ *
+ * \param owner The allocation the memory belongs to, or NULL for the heap.
+ * \param size The size in bytes to allocate.
+ *
+ * \return A pointer to the allocated memory, or NULL if the allocation fails.
+ */
+CARDANO_EXPORT void* _cardano_malloc_alongside(const void* owner, size_t size);
+
 /**
  * \brief Sets the memory management routines to use.
  *
@@ -106,6 +133,40 @@ CARDANO_EXPORT void _cardano_free(void* ptr);
  */
 CARDANO_EXPORT void cardano_set_allocators(_cardano_malloc_t custom_malloc, _cardano_realloc_t custom_realloc, _cardano_free_t custom_free);
 
+#ifdef LIB_CARDANO_C_ALLOCATION_TRACKING
+
+/**
+ * \brief Allocates memory on behalf of a library source file.
+ *
+ * The allocation is counted under the subsystem the file belongs to (see \ref cardano_allocation_tag_t). Library code
+ * does not call this directly: when allocation tracking is enabled, \ref _cardano_malloc expands to it.
+ *
+ * \param size The size in bytes to allocate.
+ * \param file The path of the source file making the allocation, as given by `__FILE__`.
+ *
+ * \return A pointer to the allocated memory, or NULL if the allocation fails.
+ */
+CARDANO_EXPORT void* _cardano_tracked_malloc(size_t size, const char* file);
+
+/**
+ * \brief Reallocates memory on behalf of a library source file.
+ *
+ * A block keeps the tag it was first allocated with. When `ptr` is NULL the new block is counted under the subsystem
+ * of `file`. When allocation tracking is enabled, \ref _cardano_realloc expands to it.
+ *
+ * \param ptr Pointer to the previously allocated memory block, or NULL.
+ * \param size The new size in bytes for the memory block.
+ * \param file The path of the source file making the allocation, as given by `__FILE__`.
+ *
+ * \return A pointer to the reallocated memory, or NULL if the reallocation fails.
+ */
+CARDANO_EXPORT void* _cardano_tracked_realloc(void* ptr, size_t size, const char* file);
+
+#define _cardano_malloc(size)       _cardano_tracked_malloc((size), __FILE__)
+#define _cardano_realloc(ptr, size) _cardano_tracked_realloc((ptr), (size), __FILE__)
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
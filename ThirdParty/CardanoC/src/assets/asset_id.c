@@ -25,11 +25,10 @@
 #include <cardano/object.h>
 
 #include "../allocators.h"
+#include "../encoding/internals/hex_codec.h"
 #include "../string_safe.h"
 
 #include <assert.h>
-#include <sodium/core.h>
-#include <sodium/utils.h>
 #include <string.h>
 
 /* STRUCTURES ****************************************************************/
@@ -98,17 +97,13 @@ to_hex_string(const byte_t* data, const size_t data_size, char* hex_buffer, cons
   assert(hex_buffer_size >= (data_size * 2U));
   assert(data_size > 0U);
 
-  int init_result = sodium_init();
-
-  if (init_result == -1)
+  if (hex_buffer_size < ((data_size * 2U) + 1U))
   {
-    return CARDANO_ERROR_GENERIC;
+    return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
   }
 
-  if (sodium_bin2hex(hex_buffer, hex_buffer_size, data, data_size) < 0)
-  {
-    return CARDANO_ERROR_GENERIC;
-  }
+  cardano_hex_encode(data, data_size, hex_buffer);
+  hex_buffer[data_size * 2U] = '\0';
 
   return CARDANO_SUCCESS;
 }
@@ -146,7 +141,7 @@ cardano_asset_id_new(cardano_blake2b_hash_t* policy_id, cardano_asset_name_t* as
   }
 
   new_asset_id->base.deallocator   = cardano_asset_id_deallocate;
-  new_asset_id->base.last_error[0] = '\0';
+  new_asset_id->base.last_error    = NULL;
   new_asset_id->base.ref_count     = 1;
 
   cardano_blake2b_hash_ref(policy_id);
@@ -197,7 +192,7 @@ cardano_asset_id_new_lovelace(cardano_asset_id_t** asset_id)
   }
 
   new_asset_id->base.deallocator   = cardano_asset_id_deallocate;
-  new_asset_id->base.last_error[0] = '\0';
+  new_asset_id->base.last_error    = NULL;
   new_asset_id->base.ref_count     = 1;
   new_asset_id->policy_id          = NULL;
   new_asset_id->asset_name         = NULL;
@@ -283,7 +278,7 @@ cardano_asset_id_from_hex(
     return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
   }
 
-  if ((size % 2U) != 0U)
+  if (((size % 2U) != 0U) || (size > 120U))
   {
     return CARDANO_ERROR_INVALID_ARGUMENT;
   }
@@ -295,14 +290,7 @@ cardano_asset_id_from_hex(
 
   byte_t data[60] = { 0 };
 
-  int init_result = sodium_init();
-
-  if (init_result == -1)
-  {
-    return CARDANO_ERROR_GENERIC;
-  }
-
-  if (sodium_hex2bin(data, 60, hex_string, size, NULL, NULL, NULL) < 0)
+  if (!cardano_hex_decode(hex_string, size, data))
   {
     return CARDANO_ERROR_INVALID_ARGUMENT;
   }
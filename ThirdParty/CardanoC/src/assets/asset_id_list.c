@@ -90,7 +90,7 @@ cardano_asset_id_list_new(cardano_asset_id_list_t** asset_id)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_asset_id_list_deallocate;
 
   list->array = cardano_array_new(128);
@@ -145,6 +145,17 @@ cardano_asset_id_list_get(
   return CARDANO_SUCCESS;
 }
 
+cardano_asset_id_t*
+cardano_asset_id_list_peek(const cardano_asset_id_list_t* asset_id_list, const size_t index)
+{
+  if (asset_id_list == NULL)
+  {
+    return NULL;
+  }
+
+  return (cardano_asset_id_t*)((void*)cardano_array_peek(asset_id_list->array, index));
+}
+
 cardano_error_t
 cardano_asset_id_list_add(cardano_asset_id_list_t* asset_id_list, cardano_asset_id_t* element)
 {
@@ -189,24 +189,176 @@ compare_by_bytes(const cardano_object_t* lhs, const cardano_object_t* rhs, void*
 }
 
 /**
- * \brief Predicate function that returns true if the value of the cardano_asset_id_map_kvp_t object is different than zero.
+ * \brief Compares the key of a cardano_asset_id_map_kvp_t object against an asset id.
  *
- * @param element Pointer to the cardano_object_t object.
- * @return true if the value of the cardano_asset_id_map_kvp_t object is different than zero, false otherwise.
+ * The order is the same as \ref compare_by_bytes, so it can be used to search the sorted map.
+ *
+ * \param[in] item Pointer to the cardano_asset_id_map_kvp_t object.
+ * \param[in] key Pointer to the cardano_asset_id_t to compare against.
+ *
+ * \return A negative value if the key of the pair orders before `key`, zero if they are equal,
+ *         and a positive value if it orders after `key`.
  */
-static bool
-different_than_zero(const cardano_object_t* element, const void* context)
+static int32_t
+compare_with_key(const cardano_object_t* item, const void* key)
 {
-  CARDANO_UNUSED(context);
+  assert(item != NULL);
+  assert(key != NULL);
+
+  const cardano_asset_id_map_kvp_t* kvp      = (const cardano_asset_id_map_kvp_t*)((const void*)item);
+  const cardano_asset_id_t*         asset_id = (const cardano_asset_id_t*)key;
 
-  const cardano_asset_id_map_kvp_t* kvp = (const cardano_asset_id_map_kvp_t*)((const void*)element);
+  const size_t lhs_size = cardano_asset_id_get_bytes_size(kvp->key);
+  const size_t rhs_size = cardano_asset_id_get_bytes_size(asset_id);
+
+  if (lhs_size != rhs_size)
+  {
+    return (lhs_size < rhs_size) ? -1 : 1;
+  }
+
+  return memcmp(cardano_asset_id_get_bytes(kvp->key), cardano_asset_id_get_bytes(asset_id), lhs_size);
+}
+
+/**
+ * \brief Creates a key value pair and inserts it in the map at the given position.
+ *
+ * \param[in] map The map to insert into.
+ * \param[in] index The position that keeps the map sorted.
+ * \param[in] key The asset id.
+ * \param[in] value The amount.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+insert_kvp_at(cardano_asset_id_map_t* map, const size_t index, cardano_asset_id_t* key, const int64_t value)
+{
+  cardano_asset_id_map_kvp_t* kvp = _cardano_malloc(sizeof(cardano_asset_id_map_kvp_t));
 
   if (kvp == NULL)
   {
-    return false;
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  kvp->base.ref_count     = 0;
+  kvp->base.last_error    = NULL;
+  kvp->base.deallocator   = cardano_asset_id_map_kvp_deallocate;
+  kvp->key                = key;
+  kvp->value              = value;
+
+  cardano_asset_id_ref(key);
+
+  const size_t old_size = cardano_array_get_size(map->array);
+  const size_t new_size = cardano_array_insert(map->array, index, (cardano_object_t*)((void*)kvp));
+
+  if (new_size != (old_size + 1U))
+  {
+    cardano_asset_id_map_kvp_deallocate(kvp);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Merges two sorted maps, adding or subtracting the amounts of matching asset ids.
+ *
+ * Both maps are walked once, in order, so the result is built already sorted in O(n + m). Entries whose amount ends
+ * up being zero are left out.
+ *
+ * \param[in] lhs The left-hand side map.
+ * \param[in] rhs The right-hand side map.
+ * \param[in] subtract Whether the amounts of `rhs` are subtracted instead of added.
+ * \param[out] result On success, the merged map.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+merge(
+  const cardano_asset_id_map_t* lhs,
+  const cardano_asset_id_map_t* rhs,
+  const bool                    subtract,
+  cardano_asset_id_map_t**      result)
+{
+  cardano_asset_id_map_t* map = NULL;
+
+  cardano_error_t create_result = cardano_asset_id_map_new(&map);
+
+  if (create_result != CARDANO_SUCCESS)
+  {
+    return create_result;
+  }
+
+  const size_t lhs_size = cardano_array_get_size(lhs->array);
+  const size_t rhs_size = cardano_array_get_size(rhs->array);
+  size_t       i        = 0U;
+  size_t       j        = 0U;
+
+  while ((i < lhs_size) || (j < rhs_size))
+  {
+    cardano_object_t* lhs_object = (i < lhs_size) ? cardano_array_get(lhs->array, i) : NULL;
+    cardano_object_t* rhs_object = (j < rhs_size) ? cardano_array_get(rhs->array, j) : NULL;
+
+    cardano_object_unref(&lhs_object);
+    cardano_object_unref(&rhs_object);
+
+    const cardano_asset_id_map_kvp_t* lhs_kvp = (const cardano_asset_id_map_kvp_t*)((void*)lhs_object);
+    const cardano_asset_id_map_kvp_t* rhs_kvp = (const cardano_asset_id_map_kvp_t*)((void*)rhs_object);
+
+    int32_t order = 0;
+
+    if (lhs_kvp == NULL)
+    {
+      order = 1;
+    }
+    else if (rhs_kvp == NULL)
+    {
+      order = -1;
+    }
+    else
+    {
+      order = compare_by_bytes(lhs_object, rhs_object, NULL);
+    }
+
+    cardano_asset_id_t* key   = NULL;
+    int64_t             value = 0;
+
+    if (order < 0)
+    {
+      key   = lhs_kvp->key;
+      value = lhs_kvp->value;
+      ++i;
+    }
+    else if (order > 0)
+    {
+      key   = rhs_kvp->key;
+      value = subtract ? -rhs_kvp->value : rhs_kvp->value;
+      ++j;
+    }
+    else
+    {
+      key   = lhs_kvp->key;
+      value = subtract ? (lhs_kvp->value - rhs_kvp->value) : (lhs_kvp->value + rhs_kvp->value);
+      ++i;
+      ++j;
+    }
+
+    if (value == 0)
+    {
+      continue;
+    }
+
+    cardano_error_t insert_result = insert_kvp_at(map, cardano_array_get_size(map->array), key, value);
+
+    if (insert_result != CARDANO_SUCCESS)
+    {
+      cardano_asset_id_map_unref(&map);
+      return insert_result;
+    }
   }
 
-  return kvp->value != 0;
+  *result = map;
+
+  return CARDANO_SUCCESS;
 }
 
 /* DEFINITIONS ****************************************************************/
@@ -227,7 +379,7 @@ cardano_asset_id_map_new(cardano_asset_id_map_t** asset_id_map)
   }
 
   map->base.ref_count     = 1;
-  map->base.last_error[0] = '\0';
+  map->base.last_error    = NULL;
   map->base.deallocator   = cardano_asset_id_map_deallocate;
 
   map->array = cardano_array_new(32);
@@ -254,6 +406,17 @@ cardano_asset_id_map_get_length(const cardano_asset_id_map_t* asset_id_map)
   return cardano_array_get_size(asset_id_map->array);
 }
 
+cardano_error_t
+cardano_asset_id_map_reserve(cardano_asset_id_map_t* asset_id_map, const size_t capacity)
+{
+  if (asset_id_map == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return cardano_array_reserve(asset_id_map->array, capacity);
+}
+
 cardano_error_t
 cardano_asset_id_map_get(cardano_asset_id_map_t* asset_id_map, cardano_asset_id_t* key, int64_t* element)
 {
@@ -272,23 +435,22 @@ cardano_asset_id_map_get(cardano_asset_id_map_t* asset_id_map, cardano_asset_id_
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  for (size_t i = 0; i < cardano_array_get_size(asset_id_map->array); ++i)
+  bool         found = false;
+  const size_t index = cardano_array_lower_bound(asset_id_map->array, compare_with_key, key, &found);
+
+  if (!found)
   {
-    cardano_object_t*           object = cardano_array_get(asset_id_map->array, i);
-    cardano_asset_id_map_kvp_t* kvp    = (cardano_asset_id_map_kvp_t*)((void*)object);
+    return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  }
 
-    if (asset_id_equals(kvp->key, key))
-    {
-      *element = kvp->value;
+  cardano_object_t*           object = cardano_array_get(asset_id_map->array, index);
+  cardano_asset_id_map_kvp_t* kvp    = (cardano_asset_id_map_kvp_t*)((void*)object);
 
-      cardano_object_unref(&object);
-      return CARDANO_SUCCESS;
-    }
+  *element = kvp->value;
 
-    cardano_object_unref(&object);
-  }
+  cardano_object_unref(&object);
 
-  return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  return CARDANO_SUCCESS;
 }
 
 cardano_error_t
@@ -307,47 +469,22 @@ cardano_asset_id_map_insert(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  for (size_t i = 0; i < cardano_array_get_size(asset_id_map->array); ++i)
+  bool         found = false;
+  const size_t index = cardano_array_lower_bound(asset_id_map->array, compare_with_key, key, &found);
+
+  if (found)
   {
-    cardano_object_t*           object = cardano_array_get(asset_id_map->array, i);
+    cardano_object_t*           object = cardano_array_get(asset_id_map->array, index);
     cardano_asset_id_map_kvp_t* kvp    = (cardano_asset_id_map_kvp_t*)((void*)object);
 
     cardano_object_unref(&object);
 
-    if (asset_id_equals(kvp->key, key))
-    {
-      kvp->value = value;
+    kvp->value = value;
 
-      return CARDANO_SUCCESS;
-    }
+    return CARDANO_SUCCESS;
   }
 
-  cardano_asset_id_map_kvp_t* kvp = _cardano_malloc(sizeof(cardano_asset_id_map_kvp_t));
-
-  if (kvp == NULL)
-  {
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
-
-  kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
-  kvp->base.deallocator   = cardano_asset_id_map_kvp_deallocate;
-  kvp->key                = key;
-  kvp->value              = value;
-
-  cardano_asset_id_ref(key);
-
-  const size_t old_size = cardano_array_get_size(asset_id_map->array);
-  const size_t new_size = cardano_array_push(asset_id_map->array, (cardano_object_t*)((void*)kvp));
-
-  assert((old_size + 1U) == new_size);
-
-  CARDANO_UNUSED(old_size);
-  CARDANO_UNUSED(new_size);
-
-  cardano_array_sort(asset_id_map->array, compare_by_bytes, NULL);
-
-  return CARDANO_SUCCESS;
+  return insert_kvp_at(asset_id_map, index, key, value);
 }
 
 cardano_error_t
@@ -519,72 +656,7 @@ cardano_asset_id_map_add(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_asset_id_map_t* map = NULL;
-
-  cardano_error_t create_result = cardano_asset_id_map_new(&map);
-
-  if (create_result != CARDANO_SUCCESS)
-  {
-    return create_result;
-  }
-
-  for (size_t i = 0; i < cardano_array_get_size(lhs->array); ++i)
-  {
-    cardano_object_t*           object = cardano_array_get(lhs->array, i);
-    cardano_asset_id_map_kvp_t* kvp    = (cardano_asset_id_map_kvp_t*)((void*)object);
-    cardano_object_unref(&object);
-
-    cardano_error_t insert_result = cardano_asset_id_map_insert(map, kvp->key, kvp->value);
-
-    if (insert_result != CARDANO_SUCCESS)
-    {
-      cardano_asset_id_map_unref(&map);
-      return insert_result;
-    }
-  }
-
-  for (size_t i = 0; i < cardano_array_get_size(rhs->array); ++i)
-  {
-    cardano_object_t*           object = cardano_array_get(rhs->array, i);
-    cardano_asset_id_map_kvp_t* kvp    = (cardano_asset_id_map_kvp_t*)((void*)object);
-    cardano_object_unref(&object);
-
-    int64_t value = 0;
-
-    cardano_error_t get_result = cardano_asset_id_map_get(map, kvp->key, &value);
-
-    if (get_result == CARDANO_SUCCESS)
-    {
-      value += kvp->value;
-
-      cardano_error_t insert_result = cardano_asset_id_map_insert(map, kvp->key, value);
-
-      if (insert_result != CARDANO_SUCCESS)
-      {
-        cardano_asset_id_map_unref(&map);
-        return insert_result;
-      }
-    }
-    else
-    {
-      cardano_error_t insert_result = cardano_asset_id_map_insert(map, kvp->key, kvp->value);
-
-      if (insert_result != CARDANO_SUCCESS)
-      {
-        cardano_asset_id_map_unref(&map);
-        return insert_result;
-      }
-    }
-  }
-
-  cardano_array_t* filtered = cardano_array_filter(map->array, different_than_zero, NULL);
-
-  cardano_array_unref(&map->array);
-  map->array = filtered;
-
-  *result = map;
-
-  return CARDANO_SUCCESS;
+  return merge(lhs, rhs, false, result);
 }
 
 cardano_error_t
@@ -608,72 +680,7 @@ cardano_asset_id_map_subtract(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_asset_id_map_t* map = NULL;
-
-  cardano_error_t create_result = cardano_asset_id_map_new(&map);
-
-  if (create_result != CARDANO_SUCCESS)
-  {
-    return create_result;
-  }
-
-  for (size_t i = 0; i < cardano_array_get_size(lhs->array); ++i)
-  {
-    cardano_object_t*           object = cardano_array_get(lhs->array, i);
-    cardano_asset_id_map_kvp_t* kvp    = (cardano_asset_id_map_kvp_t*)((void*)object);
-    cardano_object_unref(&object);
-
-    cardano_error_t insert_result = cardano_asset_id_map_insert(map, kvp->key, kvp->value);
-
-    if (insert_result != CARDANO_SUCCESS)
-    {
-      cardano_asset_id_map_unref(&map);
-      return insert_result;
-    }
-  }
-
-  for (size_t i = 0; i < cardano_array_get_size(rhs->array); ++i)
-  {
-    cardano_object_t*           object = cardano_array_get(rhs->array, i);
-    cardano_asset_id_map_kvp_t* kvp    = (cardano_asset_id_map_kvp_t*)((void*)object);
-    cardano_object_unref(&object);
-
-    int64_t value = 0;
-
-    cardano_error_t get_result = cardano_asset_id_map_get(map, kvp->key, &value);
-
-    if (get_result == CARDANO_SUCCESS)
-    {
-      value -= kvp->value;
-
-      cardano_error_t insert_result = cardano_asset_id_map_insert(map, kvp->key, value);
-
-      if (insert_result != CARDANO_SUCCESS)
-      {
-        cardano_asset_id_map_unref(&map);
-        return insert_result;
-      }
-    }
-    else
-    {
-      cardano_error_t insert_result = cardano_asset_id_map_insert(map, kvp->key, -kvp->value);
-
-      if (insert_result != CARDANO_SUCCESS)
-      {
-        cardano_asset_id_map_unref(&map);
-        return insert_result;
-      }
-    }
-  }
-
-  cardano_array_t* filtered = cardano_array_filter(map->array, different_than_zero, NULL);
-
-  cardano_array_unref(&map->array);
-  map->array = filtered;
-
-  *result = map;
-
-  return CARDANO_SUCCESS;
+  return merge(lhs, rhs, true, result);
 }
 
 bool
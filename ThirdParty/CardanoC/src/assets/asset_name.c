@@ -25,11 +25,11 @@
 #include <cardano/object.h>
 
 #include "../allocators.h"
+#include "../encoding/internals/hex_codec.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
 
 #include <assert.h>
-#include <sodium/core.h>
-#include <sodium/utils.h>
 #include <string.h>
 
 /* STRUCTURES ****************************************************************/
@@ -89,17 +89,13 @@ to_hex_string(const byte_t* data, const size_t data_size, char* hex_buffer, cons
     return CARDANO_SUCCESS;
   }
 
-  int init_result = sodium_init();
-
-  if (init_result == -1)
+  if (hex_buffer_size < ((data_size * 2U) + 1U))
   {
-    return CARDANO_ERROR_GENERIC;
+    return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
   }
 
-  if (sodium_bin2hex(hex_buffer, hex_buffer_size, data, data_size) < 0)
-  {
-    return CARDANO_ERROR_GENERIC;
-  }
+  cardano_hex_encode(data, data_size, hex_buffer);
+  hex_buffer[data_size * 2U] = '\0';
 
   return CARDANO_SUCCESS;
 }
@@ -135,7 +131,7 @@ cardano_asset_name_from_bytes(
   }
 
   new_asset_name->base.deallocator   = cardano_asset_name_deallocate;
-  new_asset_name->base.last_error[0] = '\0';
+  new_asset_name->base.last_error    = NULL;
   new_asset_name->base.ref_count     = 1;
 
   CARDANO_UNUSED(memset(new_asset_name->data, 0, 32));
@@ -181,14 +177,7 @@ cardano_asset_name_from_hex(
 
   byte_t data[32] = { 0 };
 
-  int init_result = sodium_init();
-
-  if (init_result == -1)
-  {
-    return CARDANO_ERROR_GENERIC;
-  }
-
-  if (sodium_hex2bin(data, 32, hex, size, NULL, NULL, NULL) < 0)
+  if (!cardano_hex_decode(hex, size, data))
   {
     return CARDANO_ERROR_INVALID_ARGUMENT;
   }
@@ -378,4 +367,15 @@ const char*
 cardano_asset_name_get_last_error(const cardano_asset_name_t* asset_name)
 {
   return cardano_object_get_last_error(&asset_name->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_asset_name_add_footprint(const cardano_asset_name_t* asset_name, cardano_footprint_context_t* context)
+{
+  if (asset_name == NULL)
+  {
+    return;
+  }
+
+  CARDANO_UNUSED(_cardano_footprint_visit(context, &asset_name->base, CARDANO_MEMORY_FOOTPRINT_TYPE_ASSET, sizeof(cardano_asset_name_t)));
+}
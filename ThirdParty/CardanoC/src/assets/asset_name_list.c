@@ -90,7 +90,7 @@ cardano_asset_name_list_new(cardano_asset_name_list_t** asset_name)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_asset_name_list_deallocate;
 
   list->array = cardano_array_new(128);
@@ -28,6 +28,7 @@
 
 #include "../allocators.h"
 #include "../collections/array.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
@@ -148,24 +149,272 @@ compare_by_hash(const cardano_object_t* lhs, const cardano_object_t* rhs, void*
 }
 
 /**
- * \brief Predicate function that returns true if the value of the cardano_multi_asset_kvp_t object is different than empty.
+ * \brief Compares the policy id of a cardano_multi_asset_kvp_t object against a policy id.
  *
- * @param element Pointer to the cardano_object_t object.
- * @return true if the value of the cardano_multi_asset_kvp_t object is different than empty, false otherwise.
+ * The order is the same as \ref compare_by_hash, so it can be used to search the sorted map.
+ *
+ * \param[in] item Pointer to the cardano_multi_asset_kvp_t object.
+ * \param[in] key Pointer to the cardano_blake2b_hash_t policy id to compare against.
+ *
+ * \return A negative value if the policy id of the pair orders before `key`, zero if they are equal,
+ *         and a positive value if it orders after `key`.
  */
-static bool
-different_than_empty(const cardano_object_t* element, const void* context)
+static int32_t
+compare_with_key(const cardano_object_t* item, const void* key)
 {
-  CARDANO_UNUSED(context);
+  assert(item != NULL);
+  assert(key != NULL);
+
+  const cardano_multi_asset_kvp_t* kvp = (const cardano_multi_asset_kvp_t*)((const void*)item);
+
+  return cardano_blake2b_hash_compare(kvp->key, (const cardano_blake2b_hash_t*)key);
+}
 
-  const cardano_multi_asset_kvp_t* kvp = (const cardano_multi_asset_kvp_t*)((const void*)element);
+/**
+ * \brief Creates a key value pair and inserts it in the multi asset at the given position.
+ *
+ * \param[in] multi_asset The multi asset to insert into.
+ * \param[in] index The position that keeps the policies sorted.
+ * \param[in] policy_id The policy id.
+ * \param[in] assets The assets of the policy.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+insert_kvp_at(
+  cardano_multi_asset_t*    multi_asset,
+  const size_t              index,
+  cardano_blake2b_hash_t*   policy_id,
+  cardano_asset_name_map_t* assets)
+{
+  cardano_multi_asset_kvp_t* kvp = _cardano_malloc(sizeof(cardano_multi_asset_kvp_t));
 
   if (kvp == NULL)
   {
-    return false;
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  return cardano_asset_name_map_get_length(kvp->value) > 0U;
+  kvp->base.ref_count     = 0;
+  kvp->base.last_error    = NULL;
+  kvp->base.deallocator   = cardano_multi_asset_kvp_deallocate;
+  kvp->key                = policy_id;
+  kvp->value              = assets;
+
+  cardano_blake2b_hash_ref(policy_id);
+  cardano_asset_name_map_ref(assets);
+
+  const size_t old_size = cardano_array_get_size(multi_asset->array);
+  const size_t new_size = cardano_array_insert(multi_asset->array, index, (cardano_object_t*)((void*)kvp));
+
+  if (new_size != (old_size + 1U))
+  {
+    cardano_multi_asset_kvp_deallocate(kvp);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Gives a policy assets of its own, copying them if they are shared, so they can be updated in place.
+ *
+ * \param[in,out] kvp The policy whose assets are about to change.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+make_assets_unique(cardano_multi_asset_kvp_t* kvp)
+{
+  if (cardano_asset_name_map_refcount(kvp->value) <= 1U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_asset_name_map_t* copy = NULL;
+
+  cardano_error_t create_result = cardano_asset_name_map_new(&copy);
+
+  if (create_result == CARDANO_SUCCESS)
+  {
+    create_result = cardano_asset_name_map_reserve(copy, cardano_asset_name_map_get_length(kvp->value));
+  }
+
+  if (create_result != CARDANO_SUCCESS)
+  {
+    cardano_asset_name_map_unref(&copy);
+    return create_result;
+  }
+
+  cardano_error_t copy_result = cardano_asset_name_map_add_assign(copy, kvp->value);
+
+  if (copy_result != CARDANO_SUCCESS)
+  {
+    cardano_asset_name_map_unref(&copy);
+    return copy_result;
+  }
+
+  cardano_asset_name_map_unref(&kvp->value);
+  kvp->value = copy;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Combines the assets of a policy present on one or both sides of an addition or subtraction.
+ *
+ * \param[in] lhs The assets of the left-hand side, or NULL if the policy is only in the right-hand side.
+ * \param[in] rhs The assets of the right-hand side, or NULL if the policy is only in the left-hand side.
+ * \param[in] subtract Whether `rhs` is subtracted instead of added.
+ * \param[out] assets On success, the combined assets. The caller must release them.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error returned by the asset name map arithmetic.
+ */
+static cardano_error_t
+combine_assets(
+  cardano_asset_name_map_t*  lhs,
+  cardano_asset_name_map_t*  rhs,
+  const bool                 subtract,
+  cardano_asset_name_map_t** assets)
+{
+  if (rhs == NULL)
+  {
+    cardano_asset_name_map_ref(lhs);
+    *assets = lhs;
+
+    return CARDANO_SUCCESS;
+  }
+
+  if ((lhs == NULL) && !subtract)
+  {
+    cardano_asset_name_map_ref(rhs);
+    *assets = rhs;
+
+    return CARDANO_SUCCESS;
+  }
+
+  if (lhs == NULL)
+  {
+    cardano_asset_name_map_t* empty_map = NULL;
+
+    cardano_error_t create_empty_result = cardano_asset_name_map_new(&empty_map);
+
+    if (create_empty_result != CARDANO_SUCCESS)
+    {
+      return create_empty_result;
+    }
+
+    cardano_error_t subtract_result = cardano_asset_name_map_subtract(empty_map, rhs, assets);
+
+    cardano_asset_name_map_unref(&empty_map);
+
+    return subtract_result;
+  }
+
+  return subtract ? cardano_asset_name_map_subtract(lhs, rhs, assets) : cardano_asset_name_map_add(lhs, rhs, assets);
+}
+
+/**
+ * \brief Merges two sorted multi assets, adding or subtracting the assets of matching policies.
+ *
+ * Both sides are walked once, in policy id order, so the result is built already sorted in O(n + m) policy
+ * operations. Policies left without assets are left out.
+ *
+ * \param[in] lhs The left-hand side multi asset.
+ * \param[in] rhs The right-hand side multi asset.
+ * \param[in] subtract Whether the assets of `rhs` are subtracted instead of added.
+ * \param[out] result On success, the merged multi asset.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+merge(
+  const cardano_multi_asset_t* lhs,
+  const cardano_multi_asset_t* rhs,
+  const bool                   subtract,
+  cardano_multi_asset_t**      result)
+{
+  cardano_multi_asset_t* map = NULL;
+
+  cardano_error_t create_result = cardano_multi_asset_new(&map);
+
+  if (create_result != CARDANO_SUCCESS)
+  {
+    return create_result;
+  }
+
+  const size_t lhs_size = cardano_array_get_size(lhs->array);
+  const size_t rhs_size = cardano_array_get_size(rhs->array);
+  size_t       i        = 0U;
+  size_t       j        = 0U;
+
+  // The merged map has at most the entries of both sides
+  if (cardano_array_reserve(map->array, lhs_size + rhs_size) != CARDANO_SUCCESS)
+  {
+    cardano_multi_asset_unref(&map);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  while ((i < lhs_size) || (j < rhs_size))
+  {
+    cardano_object_t* lhs_object = (i < lhs_size) ? cardano_array_get(lhs->array, i) : NULL;
+    cardano_object_t* rhs_object = (j < rhs_size) ? cardano_array_get(rhs->array, j) : NULL;
+
+    cardano_object_unref(&lhs_object);
+    cardano_object_unref(&rhs_object);
+
+    const cardano_multi_asset_kvp_t* lhs_kvp = (const cardano_multi_asset_kvp_t*)((void*)lhs_object);
+    const cardano_multi_asset_kvp_t* rhs_kvp = (const cardano_multi_asset_kvp_t*)((void*)rhs_object);
+
+    int32_t order = 0;
+
+    if (lhs_kvp == NULL)
+    {
+      order = 1;
+    }
+    else if (rhs_kvp == NULL)
+    {
+      order = -1;
+    }
+    else
+    {
+      order = compare_by_hash(lhs_object, rhs_object, NULL);
+    }
+
+    cardano_blake2b_hash_t*   policy_id  = (order > 0) ? rhs_kvp->key : lhs_kvp->key;
+    cardano_asset_name_map_t* lhs_assets = (order <= 0) ? lhs_kvp->value : NULL;
+    cardano_asset_name_map_t* rhs_assets = (order >= 0) ? rhs_kvp->value : NULL;
+
+    i += (order <= 0) ? 1U : 0U;
+    j += (order >= 0) ? 1U : 0U;
+
+    cardano_asset_name_map_t* assets         = NULL;
+    cardano_error_t           combine_result = combine_assets(lhs_assets, rhs_assets, subtract, &assets);
+
+    if (combine_result != CARDANO_SUCCESS)
+    {
+      cardano_multi_asset_unref(&map);
+      return combine_result;
+    }
+
+    cardano_error_t insert_result = CARDANO_SUCCESS;
+
+    if (cardano_asset_name_map_get_length(assets) > 0U)
+    {
+      insert_result = insert_kvp_at(map, cardano_array_get_size(map->array), policy_id, assets);
+    }
+
+    cardano_asset_name_map_unref(&assets);
+
+    if (insert_result != CARDANO_SUCCESS)
+    {
+      cardano_multi_asset_unref(&map);
+      return insert_result;
+    }
+  }
+
+  *result = map;
+
+  return CARDANO_SUCCESS;
 }
 
 /* DEFINITIONS ****************************************************************/
@@ -186,7 +435,7 @@ cardano_multi_asset_new(cardano_multi_asset_t** multi_asset)
   }
 
   map->base.ref_count     = 1;
-  map->base.last_error[0] = '\0';
+  map->base.last_error    = NULL;
   map->base.deallocator   = cardano_multi_asset_deallocate;
 
   map->array = cardano_array_new(128);
@@ -368,6 +617,17 @@ cardano_multi_asset_get_policy_count(const cardano_multi_asset_t* multi_asset)
   return cardano_array_get_size(multi_asset->array);
 }
 
+cardano_error_t
+cardano_multi_asset_reserve(cardano_multi_asset_t* multi_asset, const size_t capacity)
+{
+  if (multi_asset == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return cardano_array_reserve(multi_asset->array, capacity);
+}
+
 cardano_error_t
 cardano_multi_asset_insert_assets(
   cardano_multi_asset_t*    multi_asset,
@@ -379,6 +639,11 @@ cardano_multi_asset_insert_assets(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&multi_asset->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (policy_id == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -389,57 +654,23 @@ cardano_multi_asset_insert_assets(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  size_t size = cardano_array_get_size(multi_asset->array);
+  bool         found = false;
+  const size_t index = cardano_array_lower_bound(multi_asset->array, compare_with_key, policy_id, &found);
 
-  for (size_t i = 0U; i < size; ++i)
+  if (found)
   {
-    cardano_multi_asset_kvp_t* kvp = (cardano_multi_asset_kvp_t*)((void*)cardano_array_get(multi_asset->array, i));
+    cardano_multi_asset_kvp_t* kvp = (cardano_multi_asset_kvp_t*)((void*)cardano_array_get(multi_asset->array, index));
     cardano_object_unref((cardano_object_t**)((void*)&kvp));
 
-    if (kvp == NULL)
-    {
-      return CARDANO_ERROR_ELEMENT_NOT_FOUND;
-    }
-
-    if (cardano_blake2b_hash_equals(kvp->key, policy_id))
-    {
-      cardano_asset_name_map_unref(&kvp->value);
-      cardano_asset_name_map_ref(assets);
-
-      kvp->value = assets;
-
-      return CARDANO_SUCCESS;
-    }
-  }
-
-  cardano_multi_asset_kvp_t* kvp = _cardano_malloc(sizeof(cardano_multi_asset_kvp_t));
-
-  if (kvp == NULL)
-  {
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
-
-  kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
-  kvp->base.deallocator   = cardano_multi_asset_kvp_deallocate;
-  kvp->key                = policy_id;
-  kvp->value              = assets;
-
-  cardano_blake2b_hash_ref(policy_id);
-  cardano_asset_name_map_ref(assets);
+    cardano_asset_name_map_unref(&kvp->value);
+    cardano_asset_name_map_ref(assets);
 
-  const size_t old_size = cardano_array_get_size(multi_asset->array);
-  const size_t new_size = cardano_array_push(multi_asset->array, (cardano_object_t*)((void*)kvp));
+    kvp->value = assets;
 
-  if (new_size != (old_size + 1U))
-  {
-    cardano_multi_asset_kvp_deallocate(kvp);
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    return CARDANO_SUCCESS;
   }
 
-  cardano_array_sort(multi_asset->array, compare_by_hash, NULL);
-
-  return CARDANO_SUCCESS;
+  return insert_kvp_at(multi_asset, index, policy_id, assets);
 }
 
 cardano_error_t
@@ -463,28 +694,21 @@ cardano_multi_asset_get_assets(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  size_t size = cardano_array_get_size(multi_asset->array);
+  bool         found = false;
+  const size_t index = cardano_array_lower_bound(multi_asset->array, compare_with_key, policy_id, &found);
 
-  for (size_t i = 0U; i < size; ++i)
+  if (!found)
   {
-    cardano_multi_asset_kvp_t* kvp = (cardano_multi_asset_kvp_t*)((void*)cardano_array_get(multi_asset->array, i));
-    cardano_object_unref((cardano_object_t**)((void*)&kvp));
+    return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  }
 
-    if (kvp == NULL)
-    {
-      return CARDANO_ERROR_ELEMENT_NOT_FOUND;
-    }
+  cardano_multi_asset_kvp_t* kvp = (cardano_multi_asset_kvp_t*)((void*)cardano_array_get(multi_asset->array, index));
+  cardano_object_unref((cardano_object_t**)((void*)&kvp));
 
-    if (cardano_blake2b_hash_equals(kvp->key, policy_id))
-    {
-      cardano_asset_name_map_ref(kvp->value);
-      *assets = kvp->value;
+  cardano_asset_name_map_ref(kvp->value);
+  *assets = kvp->value;
 
-      return CARDANO_SUCCESS;
-    }
-  }
-
-  return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  return CARDANO_SUCCESS;
 }
 
 cardano_error_t
@@ -577,6 +801,11 @@ cardano_multi_asset_set(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&multi_asset->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (policy_id == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -698,85 +927,123 @@ cardano_multi_asset_add(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_multi_asset_t* map = NULL;
+  return merge(lhs, rhs, false, result);
+}
 
-  cardano_error_t create_result = cardano_multi_asset_new(&map);
+cardano_error_t
+cardano_multi_asset_add_assign(cardano_multi_asset_t* lhs, const cardano_multi_asset_t* rhs)
+{
+  if (lhs == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
 
-  if (create_result != CARDANO_SUCCESS)
+  if (rhs == NULL)
   {
-    return create_result;
+    return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  for (size_t i = 0; i < cardano_array_get_size(lhs->array); ++i)
+  if (cardano_object_is_frozen(&lhs->base))
   {
-    cardano_object_t*          object = cardano_array_get(lhs->array, i);
-    cardano_multi_asset_kvp_t* kvp    = (cardano_multi_asset_kvp_t*)((void*)object);
-    cardano_object_unref(&object);
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
 
-    cardano_error_t insert_result = cardano_multi_asset_insert_assets(map, kvp->key, kvp->value);
+  const size_t rhs_size = cardano_array_get_size(rhs->array);
 
-    if (insert_result != CARDANO_SUCCESS)
+  for (size_t j = 0U; j < rhs_size; ++j)
+  {
+    const cardano_multi_asset_kvp_t* rhs_kvp = (const cardano_multi_asset_kvp_t*)((void*)cardano_array_peek(rhs->array, j));
+
+    if (cardano_asset_name_map_get_length(rhs_kvp->value) == 0U)
     {
-      cardano_multi_asset_unref(&map);
-      return insert_result;
+      continue;
     }
-  }
 
-  for (size_t i = 0; i < cardano_array_get_size(rhs->array); ++i)
-  {
-    cardano_object_t*          object = cardano_array_get(rhs->array, i);
-    cardano_multi_asset_kvp_t* kvp    = (cardano_multi_asset_kvp_t*)((void*)object);
-    cardano_object_unref(&object);
+    bool         found = false;
+    const size_t index = cardano_array_lower_bound(lhs->array, compare_with_key, rhs_kvp->key, &found);
 
-    cardano_asset_name_map_t* value      = NULL;
-    cardano_error_t           get_result = cardano_multi_asset_get_assets(map, kvp->key, &value);
-
-    if (get_result == CARDANO_SUCCESS)
+    if (!found)
     {
-      cardano_asset_name_map_t* add_result = NULL;
+      // Copied rather than shared with rhs, so the next additions to this policy can update it in place
+      cardano_asset_name_map_t* assets = NULL;
 
-      cardano_error_t add_assets_result = cardano_asset_name_map_add(value, kvp->value, &add_result);
+      cardano_error_t result = cardano_asset_name_map_new(&assets);
 
-      if (add_assets_result != CARDANO_SUCCESS)
+      if (result == CARDANO_SUCCESS)
       {
-        cardano_asset_name_map_unref(&value);
-        cardano_asset_name_map_unref(&add_result);
-        cardano_multi_asset_unref(&map);
+        result = cardano_asset_name_map_reserve(assets, cardano_asset_name_map_get_length(rhs_kvp->value));
+      }
 
-        return add_assets_result;
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_asset_name_map_add_assign(assets, rhs_kvp->value);
       }
 
-      cardano_error_t insert_result = cardano_multi_asset_insert_assets(map, kvp->key, add_result);
+      if ((result == CARDANO_SUCCESS) && (cardano_asset_name_map_get_length(assets) > 0U))
+      {
+        result = insert_kvp_at(lhs, index, rhs_kvp->key, assets);
+      }
 
-      cardano_asset_name_map_unref(&value);
-      cardano_asset_name_map_unref(&add_result);
+      cardano_asset_name_map_unref(&assets);
 
-      if (insert_result != CARDANO_SUCCESS)
+      if (result != CARDANO_SUCCESS)
       {
-        cardano_multi_asset_unref(&map);
-
-        return insert_result;
+        return result;
       }
+
+      continue;
     }
-    else
+
+    cardano_multi_asset_kvp_t* kvp = (cardano_multi_asset_kvp_t*)((void*)cardano_array_peek(lhs->array, index));
+
+    // Held, since making the assets of lhs unique releases them when lhs and rhs are the same multi asset
+    cardano_asset_name_map_t* rhs_assets = rhs_kvp->value;
+    cardano_asset_name_map_ref(rhs_assets);
+
+    cardano_error_t result = make_assets_unique(kvp);
+
+    if (result == CARDANO_SUCCESS)
     {
-      cardano_error_t insert_result = cardano_multi_asset_insert_assets(map, kvp->key, kvp->value);
+      result = cardano_asset_name_map_add_assign(kvp->value, rhs_assets);
+    }
 
-      if (insert_result != CARDANO_SUCCESS)
-      {
-        cardano_multi_asset_unref(&map);
+    cardano_asset_name_map_unref(&rhs_assets);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    if (cardano_asset_name_map_get_length(kvp->value) == 0U)
+    {
+      cardano_array_t* removed = cardano_array_erase(lhs->array, (int64_t)index, 1U);
 
-        return insert_result;
+      if (removed == NULL)
+      {
+        return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
       }
+
+      cardano_array_unref(&removed);
     }
   }
 
-  cardano_array_t* filtered = cardano_array_filter(map->array, different_than_empty, NULL);
+  return CARDANO_SUCCESS;
+}
 
-  cardano_array_unref(&map->array);
-  map->array = filtered;
+cardano_error_t
+cardano_multi_asset_clear(cardano_multi_asset_t* multi_asset)
+{
+  if (multi_asset == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
 
-  *result = map;
+  if (cardano_object_is_frozen(&multi_asset->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
+  cardano_array_clear(multi_asset->array);
 
   return CARDANO_SUCCESS;
 }
@@ -802,115 +1069,7 @@ cardano_multi_asset_subtract(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_multi_asset_t* map = NULL;
-
-  cardano_error_t create_result = cardano_multi_asset_new(&map);
-
-  if (create_result != CARDANO_SUCCESS)
-  {
-    return create_result;
-  }
-
-  for (size_t i = 0; i < cardano_array_get_size(lhs->array); ++i)
-  {
-    cardano_object_t*          object = cardano_array_get(lhs->array, i);
-    cardano_multi_asset_kvp_t* kvp    = (cardano_multi_asset_kvp_t*)((void*)object);
-    cardano_object_unref(&object);
-
-    cardano_error_t insert_result = cardano_multi_asset_insert_assets(map, kvp->key, kvp->value);
-
-    if (insert_result != CARDANO_SUCCESS)
-    {
-      cardano_multi_asset_unref(&map);
-
-      return insert_result;
-    }
-  }
-
-  for (size_t i = 0; i < cardano_array_get_size(rhs->array); ++i)
-  {
-    cardano_object_t*          object = cardano_array_get(rhs->array, i);
-    cardano_multi_asset_kvp_t* kvp    = (cardano_multi_asset_kvp_t*)((void*)object);
-    cardano_object_unref(&object);
-
-    cardano_asset_name_map_t* value      = NULL;
-    cardano_error_t           get_result = cardano_multi_asset_get_assets(map, kvp->key, &value);
-
-    if (get_result == CARDANO_SUCCESS)
-    {
-      cardano_asset_name_map_t* subtract_result = NULL;
-
-      cardano_error_t subtract_assets_result = cardano_asset_name_map_subtract(value, kvp->value, &subtract_result);
-
-      if (subtract_assets_result != CARDANO_SUCCESS)
-      {
-        cardano_asset_name_map_unref(&value);
-        cardano_asset_name_map_unref(&subtract_result);
-        cardano_multi_asset_unref(&map);
-
-        return subtract_assets_result;
-      }
-
-      cardano_error_t insert_result = cardano_multi_asset_insert_assets(map, kvp->key, subtract_result);
-
-      cardano_asset_name_map_unref(&value);
-      cardano_asset_name_map_unref(&subtract_result);
-
-      if (insert_result != CARDANO_SUCCESS)
-      {
-        cardano_multi_asset_unref(&map);
-
-        return insert_result;
-      }
-    }
-    else
-    {
-      cardano_asset_name_map_t* empty_map       = NULL;
-      cardano_asset_name_map_t* subtract_result = NULL;
-
-      cardano_error_t create_empty_result = cardano_asset_name_map_new(&empty_map);
-
-      if (create_empty_result != CARDANO_SUCCESS)
-      {
-        cardano_asset_name_map_unref(&empty_map);
-        cardano_multi_asset_unref(&map);
-
-        return create_empty_result;
-      }
-
-      cardano_error_t subtract_assets_result = cardano_asset_name_map_subtract(empty_map, kvp->value, &subtract_result);
-
-      if (subtract_assets_result != CARDANO_SUCCESS)
-      {
-        cardano_asset_name_map_unref(&empty_map);
-        cardano_asset_name_map_unref(&subtract_result);
-        cardano_multi_asset_unref(&map);
-
-        return subtract_assets_result;
-      }
-
-      cardano_error_t insert_result = cardano_multi_asset_insert_assets(map, kvp->key, subtract_result);
-
-      cardano_asset_name_map_unref(&empty_map);
-      cardano_asset_name_map_unref(&subtract_result);
-
-      if (insert_result != CARDANO_SUCCESS)
-      {
-        cardano_multi_asset_unref(&map);
-
-        return insert_result;
-      }
-    }
-  }
-
-  cardano_array_t* filtered = cardano_array_filter(map->array, different_than_empty, NULL);
-
-  cardano_array_unref(&map->array);
-  map->array = filtered;
-
-  *result = map;
-
-  return CARDANO_SUCCESS;
+  return merge(lhs, rhs, true, result);
 }
 
 cardano_error_t
@@ -1177,3 +1336,31 @@ cardano_multi_asset_get_last_error(const cardano_multi_asset_t* multi_asset)
 {
   return cardano_object_get_last_error(&multi_asset->base);
 }
+
+/**
+ * \brief Adds the footprint of an entry of a multi-asset, its policy id and asset name map.
+ */
+static void
+add_kvp_footprint(const cardano_object_t* item, cardano_footprint_context_t* context)
+{
+  const cardano_multi_asset_kvp_t* kvp = (const cardano_multi_asset_kvp_t*)((const void*)item);
+
+  if ((kvp == NULL) || !_cardano_footprint_visit(context, &kvp->base, CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION, sizeof(cardano_multi_asset_kvp_t)))
+  {
+    return;
+  }
+
+  _cardano_blake2b_hash_add_footprint(kvp->key, context);
+  _cardano_asset_name_map_add_footprint(kvp->value, context);
+}
+
+void
+_cardano_multi_asset_add_footprint(const cardano_multi_asset_t* multi_asset, cardano_footprint_context_t* context)
+{
+  if ((multi_asset == NULL) || !_cardano_footprint_visit(context, &multi_asset->base, CARDANO_MEMORY_FOOTPRINT_TYPE_ASSET, sizeof(cardano_multi_asset_t)))
+  {
+    return;
+  }
+
+  _cardano_array_add_footprint(multi_asset->array, context, add_kvp_footprint);
+}
@@ -89,7 +89,7 @@ cardano_policy_id_list_new(cardano_policy_id_list_t** policy_id)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_policy_id_list_deallocate;
 
   list->array = cardano_array_new(128);
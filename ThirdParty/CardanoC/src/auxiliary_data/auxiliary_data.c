@@ -27,6 +27,7 @@
 
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
 
 #include <assert.h>
@@ -141,7 +142,7 @@ cardano_auxiliary_data_new(cardano_auxiliary_data_t** auxiliary_data)
   }
 
   new_auxiliary_data->base.ref_count     = 1;
-  new_auxiliary_data->base.last_error[0] = '\0';
+  new_auxiliary_data->base.last_error    = NULL;
   new_auxiliary_data->base.deallocator   = cardano_auxiliary_data_deallocate;
   new_auxiliary_data->metadata           = NULL;
   new_auxiliary_data->native_scripts     = NULL;
@@ -882,4 +883,20 @@ const char*
 cardano_auxiliary_data_get_last_error(const cardano_auxiliary_data_t* auxiliary_data)
 {
   return cardano_object_get_last_error(&auxiliary_data->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_auxiliary_data_add_footprint(const cardano_auxiliary_data_t* auxiliary_data, cardano_footprint_context_t* context)
+{
+  if ((auxiliary_data == NULL) || !_cardano_footprint_visit(context, &auxiliary_data->base, CARDANO_MEMORY_FOOTPRINT_TYPE_AUXILIARY_DATA, sizeof(cardano_auxiliary_data_t)))
+  {
+    return;
+  }
+
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)auxiliary_data->metadata));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)auxiliary_data->native_scripts));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)auxiliary_data->plutus_v1_scripts));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)auxiliary_data->plutus_v2_scripts));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)auxiliary_data->plutus_v3_scripts));
+  _cardano_buffer_add_footprint(auxiliary_data->cbor_cache, context);
+}
@@ -0,0 +1,733 @@
+/**
+ * \file metadata_encoder.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/auxiliary_data/metadata_encoder.h>
+#include <cardano/cbor/cbor_writer.h>
+#include <cardano/crypto/blake2b_hash_size.h>
+#include <cardano/object.h>
+
+#include "../allocators.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const uint64_t AUXILIARY_DATA_TAG          = 259U;  // cppcheck-suppress misra-c2012-8.9
+static const uint64_t METADATA_KEY                = 0U;    // cppcheck-suppress misra-c2012-8.9
+static const size_t   MAX_CHUNK_SIZE              = 64U;   // cppcheck-suppress misra-c2012-8.9
+static const byte_t   UTF8_CONTINUATION_BYTE      = 0x80U; // cppcheck-suppress misra-c2012-8.9
+static const byte_t   UTF8_CONTINUATION_BYTE_MASK = 0xC0U; // cppcheck-suppress misra-c2012-8.9
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief An open map or list of the encoder.
+ */
+typedef struct encoder_frame_t
+{
+    size_t remaining; /**< Items left to write; a map entry counts as two items, its key and its value. */
+    bool   is_map;
+    bool   is_indefinite;
+} encoder_frame_t;
+
+/**
+ * \brief Writes transaction metadata straight to auxiliary data CBOR.
+ *
+ * The first frame is the map of metadata labels; the frames above it are the maps and lists opened by the caller.
+ */
+typedef struct cardano_metadata_encoder_t
+{
+    cardano_object_t       base;
+    cardano_cbor_writer_t* writer;
+    encoder_frame_t        frames[64];
+    size_t                 label_count;
+    size_t                 depth;
+    uint64_t               last_label;
+    bool                   is_finished;
+} cardano_metadata_encoder_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates a metadata encoder.
+ *
+ * \param object A void pointer to the encoder to be deallocated.
+ */
+static void
+cardano_metadata_encoder_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_metadata_encoder_t* encoder = (cardano_metadata_encoder_t*)object;
+
+  cardano_cbor_writer_unref(&encoder->writer);
+
+  _cardano_free(encoder);
+}
+
+/**
+ * \brief Checks that the next item may be written at the current position and accounts for it.
+ *
+ * The keys of the outermost map must be labels and its values anything but labels; labels may not appear anywhere
+ * else.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] is_label Whether the item is a metadata label.
+ *
+ * \return \ref CARDANO_SUCCESS if the item may be written, or \ref CARDANO_ERROR_ILLEGAL_STATE otherwise.
+ */
+static cardano_error_t
+begin_item(cardano_metadata_encoder_t* encoder, const bool is_label)
+{
+  if (encoder->is_finished)
+  {
+    cardano_metadata_encoder_set_last_error(encoder, "The metadata encoder has already been finished.");
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  encoder_frame_t* frame = &encoder->frames[encoder->depth - 1U];
+
+  if (frame->remaining == 0U)
+  {
+    cardano_metadata_encoder_set_last_error(encoder, frame->is_map ? "The map already has all its entries." : "The list already has all its items.");
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  const bool expects_label = (encoder->depth == 1U) && ((frame->remaining % 2U) == 0U);
+
+  if (is_label != expects_label)
+  {
+    cardano_metadata_encoder_set_last_error(encoder, expects_label ? "Expected a metadata label." : "A metadata label is only valid as a key of the outermost map.");
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  --frame->remaining;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Checks that a label comes after the labels written so far.
+ *
+ * Transaction metadata keeps its labels sorted, so this keeps the output identical to
+ * \ref cardano_auxiliary_data_to_cbor and rules out duplicate labels.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] label The label about to be written.
+ *
+ * \return \ref CARDANO_SUCCESS if the label may be written, or \ref CARDANO_ERROR_ILLEGAL_STATE otherwise.
+ */
+static cardano_error_t
+check_label_order(cardano_metadata_encoder_t* encoder, const uint64_t label)
+{
+  const bool is_first = encoder->frames[0].remaining == (encoder->label_count * 2U);
+
+  if (!is_first && (label <= encoder->last_label))
+  {
+    cardano_metadata_encoder_set_last_error(encoder, "Metadata labels must be written in ascending order.");
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Opens a map or a list of the given number of items.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] size The number of entries of a map or values of a list.
+ * \param[in] is_map Whether a map is opened.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+start_container(cardano_metadata_encoder_t* encoder, const size_t size, const bool is_map)
+{
+  if (encoder->depth >= (sizeof(encoder->frames) / sizeof(encoder->frames[0])))
+  {
+    cardano_metadata_encoder_set_last_error(encoder, "The metadata maps and lists are nested too deeply.");
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  if ((size > ((size_t)INT64_MAX)) || (is_map && (size > (SIZE_MAX / 2U))))
+  {
+    return CARDANO_ERROR_INTEGER_OVERFLOW;
+  }
+
+  cardano_error_t result = begin_item(encoder, false);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  // Non-empty lists are written with an indefinite length, as metadatum lists are.
+  const bool is_indefinite = !is_map && (size > 0U);
+
+  if (is_map)
+  {
+    result = cardano_cbor_writer_write_start_map(encoder->writer, (int64_t)size);
+  }
+  else
+  {
+    result = cardano_cbor_writer_write_start_array(encoder->writer, is_indefinite ? -1 : 0);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  encoder->frames[encoder->depth].remaining     = is_map ? (size * 2U) : size;
+  encoder->frames[encoder->depth].is_map        = is_map;
+  encoder->frames[encoder->depth].is_indefinite = is_indefinite;
+  ++encoder->depth;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Closes the innermost map or list.
+ *
+ * \param[in] encoder The encoder.
+ * \param[in] is_map Whether a map is expected to be closed.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_ILLEGAL_STATE if the innermost container is of the
+ * other kind or is not complete.
+ */
+static cardano_error_t
+end_container(cardano_metadata_encoder_t* encoder, const bool is_map)
+{
+  if (encoder->is_finished || (encoder->depth <= 1U) || (encoder->frames[encoder->depth - 1U].is_map != is_map))
+  {
+    cardano_metadata_encoder_set_last_error(encoder, is_map ? "There is no open map to close." : "There is no open list to close.");
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  if (encoder->frames[encoder->depth - 1U].remaining != 0U)
+  {
+    cardano_metadata_encoder_set_last_error(encoder, is_map ? "The map is closed before all its entries were written." : "The list is closed before all its items were written.");
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  --encoder->depth;
+
+  if (encoder->frames[encoder->depth].is_indefinite)
+  {
+    return cardano_cbor_writer_write_end_array(encoder->writer);
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Gets the size of the next text chunk, cut on a UTF-8 character boundary.
+ *
+ * \param[in] text The remaining text.
+ * \param[in] size The size of the remaining text.
+ *
+ * \return The size of the chunk, at most \ref MAX_CHUNK_SIZE.
+ */
+static size_t
+get_text_chunk_size(const char* text, const size_t size)
+{
+  if (size <= MAX_CHUNK_SIZE)
+  {
+    return size;
+  }
+
+  size_t chunk_size = MAX_CHUNK_SIZE;
+
+  while ((chunk_size > 0U) && ((((byte_t)text[chunk_size]) & UTF8_CONTINUATION_BYTE_MASK) == UTF8_CONTINUATION_BYTE))
+  {
+    --chunk_size;
+  }
+
+  // Not valid UTF-8; cut at the size limit rather than writing an empty chunk.
+  return (chunk_size == 0U) ? MAX_CHUNK_SIZE : chunk_size;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_metadata_encoder_new(const size_t label_count, cardano_metadata_encoder_t** encoder)
+{
+  if (encoder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((label_count > ((size_t)INT64_MAX)) || (label_count > (SIZE_MAX / 2U)))
+  {
+    return CARDANO_ERROR_INTEGER_OVERFLOW;
+  }
+
+  cardano_metadata_encoder_t* obj = (cardano_metadata_encoder_t*)_cardano_malloc(sizeof(cardano_metadata_encoder_t));
+
+  if (obj == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  obj->base.ref_count     = 1;
+  obj->base.last_error    = NULL;
+  obj->base.deallocator   = cardano_metadata_encoder_deallocate;
+
+  obj->writer              = cardano_cbor_writer_new();
+  obj->frames[0].remaining     = label_count * 2U;
+  obj->frames[0].is_map        = true;
+  obj->frames[0].is_indefinite = false;
+  obj->label_count             = label_count;
+  obj->depth                   = 1U;
+  obj->last_label              = 0U;
+  obj->is_finished             = false;
+
+  if (obj->writer == NULL)
+  {
+    _cardano_free(obj);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_cbor_writer_write_tag(obj->writer, AUXILIARY_DATA_TAG);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_write_start_map(obj->writer, 1);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_write_uint(obj->writer, METADATA_KEY);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_write_start_map(obj->writer, (int64_t)label_count);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_metadata_encoder_deallocate(obj);
+    return result;
+  }
+
+  *encoder = obj;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_metadata_encoder_write_label(cardano_metadata_encoder_t* encoder, const uint64_t label)
+{
+  if (encoder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = check_label_order(encoder, label);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = begin_item(encoder, true);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  encoder->last_label = label;
+
+  return cardano_cbor_writer_write_uint(encoder->writer, label);
+}
+
+cardano_error_t
+cardano_metadata_encoder_write_int(cardano_metadata_encoder_t* encoder, const int64_t value)
+{
+  if (encoder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = begin_item(encoder, false);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (value < 0)
+  {
+    return cardano_cbor_writer_write_signed_int(encoder->writer, value);
+  }
+
+  return cardano_cbor_writer_write_uint(encoder->writer, (uint64_t)value);
+}
+
+cardano_error_t
+cardano_metadata_encoder_write_uint(cardano_metadata_encoder_t* encoder, const uint64_t value)
+{
+  if (encoder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = begin_item(encoder, false);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return cardano_cbor_writer_write_uint(encoder->writer, value);
+}
+
+cardano_error_t
+cardano_metadata_encoder_write_text(cardano_metadata_encoder_t* encoder, const char* text, const size_t size)
+{
+  if (encoder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((text == NULL) && (size > 0U))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (size > MAX_CHUNK_SIZE)
+  {
+    cardano_metadata_encoder_set_last_error(encoder, "Metadata text strings can be at most 64 bytes long.");
+    return CARDANO_ERROR_INVALID_METADATUM_TEXT_STRING_SIZE;
+  }
+
+  cardano_error_t result = begin_item(encoder, false);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return cardano_cbor_writer_write_textstring(encoder->writer, (size > 0U) ? text : "", size);
+}
+
+cardano_error_t
+cardano_metadata_encoder_write_text_chunked(cardano_metadata_encoder_t* encoder, const char* text, const size_t size)
+{
+  if (encoder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (size <= MAX_CHUNK_SIZE)
+  {
+    return cardano_metadata_encoder_write_text(encoder, text, size);
+  }
+
+  if (text == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  size_t chunk_count = 0U;
+
+  for (size_t offset = 0U; offset < size; offset += get_text_chunk_size(&text[offset], size - offset))
+  {
+    ++chunk_count;
+  }
+
+  cardano_error_t result = cardano_metadata_encoder_start_list(encoder, chunk_count);
+
+  size_t offset = 0U;
+
+  while ((result == CARDANO_SUCCESS) && (offset < size))
+  {
+    const size_t chunk_size = get_text_chunk_size(&text[offset], size - offset);
+
+    result  = cardano_metadata_encoder_write_text(encoder, &text[offset], chunk_size);
+    offset += chunk_size;
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return cardano_metadata_encoder_end_list(encoder);
+}
+
+cardano_error_t
+cardano_metadata_encoder_write_bytes(cardano_metadata_encoder_t* encoder, const byte_t* data, const size_t size)
+{
+  if (encoder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((data == NULL) && (size > 0U))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (size > MAX_CHUNK_SIZE)
+  {
+    cardano_metadata_encoder_set_last_error(encoder, "Metadata byte strings can be at most 64 bytes long.");
+    return CARDANO_ERROR_INVALID_METADATUM_BOUNDED_BYTES_SIZE;
+  }
+
+  cardano_error_t result = begin_item(encoder, false);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  static const byte_t empty = 0U;
+
+  return cardano_cbor_writer_write_bytestring(encoder->writer, (size > 0U) ? data : &empty, size);
+}
+
+cardano_error_t
+cardano_metadata_encoder_write_bytes_chunked(cardano_metadata_encoder_t* encoder, const byte_t* data, const size_t size)
+{
+  if (encoder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (size <= MAX_CHUNK_SIZE)
+  {
+    return cardano_metadata_encoder_write_bytes(encoder, data, size);
+  }
+
+  if (data == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = cardano_metadata_encoder_start_list(encoder, (size + MAX_CHUNK_SIZE - 1U) / MAX_CHUNK_SIZE);
+
+  for (size_t offset = 0U; (result == CARDANO_SUCCESS) && (offset < size); offset += MAX_CHUNK_SIZE)
+  {
+    const size_t chunk_size = ((size - offset) < MAX_CHUNK_SIZE) ? (size - offset) : MAX_CHUNK_SIZE;
+
+    result = cardano_metadata_encoder_write_bytes(encoder, &data[offset], chunk_size);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return cardano_metadata_encoder_end_list(encoder);
+}
+
+cardano_error_t
+cardano_metadata_encoder_start_map(cardano_metadata_encoder_t* encoder, const size_t size)
+{
+  if (encoder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return start_container(encoder, size, true);
+}
+
+cardano_error_t
+cardano_metadata_encoder_end_map(cardano_metadata_encoder_t* encoder)
+{
+  if (encoder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return end_container(encoder, true);
+}
+
+cardano_error_t
+cardano_metadata_encoder_start_list(cardano_metadata_encoder_t* encoder, const size_t size)
+{
+  if (encoder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return start_container(encoder, size, false);
+}
+
+cardano_error_t
+cardano_metadata_encoder_end_list(cardano_metadata_encoder_t* encoder)
+{
+  if (encoder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return end_container(encoder, false);
+}
+
+cardano_error_t
+cardano_metadata_encoder_write_map_entries(
+  cardano_metadata_encoder_t*     encoder,
+  const size_t                    count,
+  cardano_metadata_entry_writer_t entry_writer,
+  void*                           context)
+{
+  if ((encoder == NULL) || (entry_writer == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = cardano_metadata_encoder_start_map(encoder, count);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const size_t depth = encoder->depth;
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    const size_t remaining = encoder->frames[depth - 1U].remaining;
+
+    result = entry_writer(context, i, encoder);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    if ((encoder->depth != depth) || ((remaining - encoder->frames[depth - 1U].remaining) != 2U))
+    {
+      cardano_metadata_encoder_set_last_error(encoder, "The entry writer must write exactly one key and one value.");
+      return CARDANO_ERROR_ILLEGAL_STATE;
+    }
+  }
+
+  return cardano_metadata_encoder_end_map(encoder);
+}
+
+cardano_error_t
+cardano_metadata_encoder_finish(
+  cardano_metadata_encoder_t* encoder,
+  cardano_buffer_t**          auxiliary_data_cbor,
+  cardano_blake2b_hash_t**    hash)
+{
+  if ((encoder == NULL) || (auxiliary_data_cbor == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (encoder->is_finished)
+  {
+    cardano_metadata_encoder_set_last_error(encoder, "The metadata encoder has already been finished.");
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  if ((encoder->depth != 1U) || (encoder->frames[0].remaining != 0U))
+  {
+    cardano_metadata_encoder_set_last_error(encoder, (encoder->depth != 1U) ? "A metadata map or list is still open." : "Not all metadata labels were written.");
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  cardano_buffer_t* cbor   = NULL;
+  cardano_error_t   result = cardano_cbor_writer_encode_in_buffer(encoder->writer, &cbor);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (hash != NULL)
+  {
+    result = cardano_blake2b_compute_hash(cardano_buffer_get_data(cbor), cardano_buffer_get_size(cbor), CARDANO_BLAKE2B_HASH_SIZE_256, hash);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_buffer_unref(&cbor);
+      return result;
+    }
+  }
+
+  encoder->is_finished = true;
+  *auxiliary_data_cbor = cbor;
+
+  return CARDANO_SUCCESS;
+}
+
+void
+cardano_metadata_encoder_unref(cardano_metadata_encoder_t** encoder)
+{
+  if ((encoder == NULL) || (*encoder == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*encoder)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *encoder = NULL;
+    return;
+  }
+}
+
+void
+cardano_metadata_encoder_ref(cardano_metadata_encoder_t* encoder)
+{
+  if (encoder == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&encoder->base);
+}
+
+size_t
+cardano_metadata_encoder_refcount(const cardano_metadata_encoder_t* encoder)
+{
+  if (encoder == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&encoder->base);
+}
+
+void
+cardano_metadata_encoder_set_last_error(cardano_metadata_encoder_t* encoder, const char* message)
+{
+  cardano_object_set_last_error(&encoder->base, message);
+}
+
+const char*
+cardano_metadata_encoder_get_last_error(const cardano_metadata_encoder_t* encoder)
+{
+  return cardano_object_get_last_error(&encoder->base);
+}
@@ -30,6 +30,7 @@
 #include <cardano/object.h>
 
 #include "../allocators.h"
+#include "../config.h"
 #include "../string_safe.h"
 
 #include <assert.h>
@@ -113,7 +114,7 @@ cardano_metadatum_new(void)
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_metadatum_deallocate;
 
   data->map     = NULL;
@@ -385,106 +386,166 @@ convert_metadatum_to_json_object(cardano_json_writer_t* writer, cardano_metadatu
     case CARDANO_METADATUM_KIND_MAP:
     {
       cardano_json_writer_write_start_object(writer);
-      cardano_metadatum_list_t* keys   = NULL;
-      cardano_metadatum_list_t* values = NULL;
-
-      cardano_error_t error = cardano_metadatum_map_get_keys(metadatum->map, &keys);
-
-      if (error != CARDANO_SUCCESS)
-      {
-        cardano_metadatum_list_unref(&keys);
-        return error;
-      }
-
-      error = cardano_metadatum_map_get_values(metadatum->map, &values);
-
-      if (error != CARDANO_SUCCESS)
-      {
-        cardano_metadatum_list_unref(&keys);
-        cardano_metadatum_list_unref(&values);
-
-        return error;
-      }
 
       for (size_t i = 0U; i < cardano_metadatum_map_get_length(metadatum->map); i++)
       {
         cardano_metadatum_t* key   = NULL;
         cardano_metadatum_t* value = NULL;
 
-        error = cardano_metadatum_list_get(keys, i, &key);
-        cardano_metadatum_unref(&key);
+        cardano_error_t error = cardano_metadatum_map_get_key_value_at(metadatum->map, i, &key, &value);
 
         if (error != CARDANO_SUCCESS)
         {
-          cardano_metadatum_list_unref(&keys);
-          cardano_metadatum_list_unref(&values);
-
           return error;
         }
 
-        error = cardano_metadatum_list_get(values, i, &value);
+        cardano_metadatum_unref(&key);
         cardano_metadatum_unref(&value);
 
-        if (error != CARDANO_SUCCESS)
+        if (key->kind != CARDANO_METADATUM_KIND_TEXT)
         {
-          cardano_metadatum_list_unref(&keys);
-          cardano_metadatum_list_unref(&values);
+          cardano_metadatum_set_last_error(metadatum, "JSON map keys must be strings.");
 
-          return error;
+          return CARDANO_ERROR_INVALID_METADATUM_CONVERSION;
         }
 
-        cardano_metadatum_kind_t key_kind;
+        cardano_json_writer_write_property_name(writer, (const char*)cardano_buffer_get_data(key->text), cardano_buffer_get_size(key->text));
 
-        error = cardano_metadatum_get_kind(key, &key_kind);
+        // cppcheck-suppress misra-c2012-17.2; Reason: Parsing the JSON object is a recursive operation. TODO: Create cardano_json_reader_t and cardano_json_writer_t to break the recursion.
+        error = convert_metadatum_to_json_object(writer, value);
 
         if (error != CARDANO_SUCCESS)
         {
-          cardano_metadatum_list_unref(&keys);
-          cardano_metadatum_list_unref(&values);
-
           return error;
         }
+      }
 
-        if (key_kind != CARDANO_METADATUM_KIND_TEXT)
-        {
-          cardano_metadatum_set_last_error(metadatum, "JSON map keys must be strings.");
+      cardano_json_writer_write_end_object(writer);
 
-          cardano_metadatum_list_unref(&keys);
-          cardano_metadatum_list_unref(&values);
+      break;
+    }
+    case CARDANO_METADATUM_KIND_BYTES:
+    {
+      cardano_metadatum_set_last_error(metadatum, "Metadatum of type 'bytes' cannot be converted to JSON.");
+      return CARDANO_ERROR_INVALID_METADATUM_CONVERSION;
+    }
+    default:
+    {
+      cardano_metadatum_set_last_error(metadatum, "Invalid metadatum kind.");
+      return CARDANO_ERROR_INVALID_METADATUM_CONVERSION;
+    }
+  }
 
-          return CARDANO_ERROR_INVALID_METADATUM_CONVERSION;
-        }
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Computes the size of the pretty-printed JSON a metadatum converts to, without writing it.
+ *
+ * Mirrors the layout \ref convert_metadatum_to_json_object produces with a \ref CARDANO_JSON_FORMAT_PRETTY writer:
+ * every array element and object property starts on its own line, indented two spaces per level, and non-empty
+ * containers close on their own line.
+ *
+ * \param[in] metadatum The metadatum to measure.
+ * \param[in] depth The nesting level of \p metadatum; zero for the root.
+ * \param[out] size The number of bytes the JSON text takes, without the null terminator.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error the conversion itself would report.
+ */
+static cardano_error_t
+get_metadatum_json_size(cardano_metadatum_t* metadatum, const size_t depth, size_t* size)
+{
+  assert(metadatum != NULL);
+  assert(size != NULL);
+
+  switch (metadatum->kind)
+  {
+    case CARDANO_METADATUM_KIND_INTEGER:
+    {
+      char buffer[24] = { 0 };
 
-        const size_t key_size = cardano_buffer_get_size(key->text);
-        char*        key_str  = (char*)_cardano_malloc(key_size);
+      *size = cardano_safe_int64_to_string(cardano_bigint_to_int(metadatum->integer), buffer, sizeof(buffer));
 
-        CARDANO_UNUSED(memset(key_str, 0, key_size));
+      return CARDANO_SUCCESS;
+    }
+    case CARDANO_METADATUM_KIND_TEXT:
+    {
+      *size = cardano_json_writer_get_string_size((const char*)cardano_buffer_get_data(metadatum->text), cardano_buffer_get_size(metadatum->text));
 
-        cardano_safe_memcpy(key_str, key_size, (void*)cardano_buffer_get_data(key->text), cardano_buffer_get_size(key->text));
+      return CARDANO_SUCCESS;
+    }
+    case CARDANO_METADATUM_KIND_LIST:
+    case CARDANO_METADATUM_KIND_MAP:
+    {
+      if (depth >= ((size_t)LIB_CARDANO_C_MAX_JSON_DEPTH - 1U))
+      {
+        cardano_metadatum_set_last_error(metadatum, "JSON nesting depth exceeded maximum allowed.");
+        return CARDANO_ERROR_ENCODING;
+      }
 
-        cardano_json_writer_write_property_name(writer, key_str, key_size);
+      const bool   is_list = metadatum->kind == CARDANO_METADATUM_KIND_LIST;
+      const size_t length  = is_list ? cardano_metadatum_list_get_length(metadatum->list) : cardano_metadatum_map_get_length(metadatum->map);
 
-        // cppcheck-suppress misra-c2012-17.2; Reason: Parsing the JSON object is a recursive operation. TODO: Create cardano_json_reader_t and cardano_json_writer_t to break the recursion.
-        cardano_error_t res = convert_metadatum_to_json_object(writer, value);
+      // Brackets, one comma between entries, and a new line plus indentation before every entry
+      size_t total = 2U + ((length > 0U) ? (length - 1U) : 0U) + (length * (1U + ((depth + 1U) * 2U)));
+
+      if (length > 0U)
+      {
+        // New line and indentation before the closing bracket
+        total += 1U + (depth * 2U);
+      }
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        cardano_metadatum_t* key   = NULL;
+        cardano_metadatum_t* value = NULL;
+        cardano_error_t      error = CARDANO_SUCCESS;
 
-        if ((value == NULL) || (res != CARDANO_SUCCESS))
+        if (is_list)
+        {
+          error = cardano_metadatum_list_get(metadatum->list, i, &value);
+        }
+        else
         {
-          cardano_metadatum_list_unref(&keys);
-          cardano_metadatum_list_unref(&values);
-          _cardano_free(key_str);
+          error = cardano_metadatum_map_get_key_value_at(metadatum->map, i, &key, &value);
+        }
 
-          return res;
+        if (error != CARDANO_SUCCESS)
+        {
+          return error;
         }
 
-        _cardano_free(key_str);
-      }
+        cardano_metadatum_unref(&key);
+        cardano_metadatum_unref(&value);
 
-      cardano_metadatum_list_unref(&keys);
-      cardano_metadatum_list_unref(&values);
+        if (key != NULL)
+        {
+          if (key->kind != CARDANO_METADATUM_KIND_TEXT)
+          {
+            cardano_metadatum_set_last_error(metadatum, "JSON map keys must be strings.");
+            return CARDANO_ERROR_INVALID_METADATUM_CONVERSION;
+          }
 
-      cardano_json_writer_write_end_object(writer);
+          // Quoted key, colon and space
+          total += cardano_json_writer_get_string_size((const char*)cardano_buffer_get_data(key->text), cardano_buffer_get_size(key->text)) + 2U;
+        }
 
-      break;
+        size_t value_size = 0U;
+
+        // cppcheck-suppress misra-c2012-17.2; Reason: Measuring follows the same recursion as the conversion.
+        error = get_metadatum_json_size(value, depth + 1U, &value_size);
+
+        if (error != CARDANO_SUCCESS)
+        {
+          return error;
+        }
+
+        total += value_size;
+      }
+
+      *size = total;
+
+      return CARDANO_SUCCESS;
     }
     case CARDANO_METADATUM_KIND_BYTES:
     {
@@ -497,8 +558,6 @@ convert_metadatum_to_json_object(cardano_json_writer_t* writer, cardano_metadatu
       return CARDANO_ERROR_INVALID_METADATUM_CONVERSION;
     }
   }
-
-  return CARDANO_SUCCESS;
 }
 
 /* DEFINITIONS ****************************************************************/
@@ -1058,53 +1117,86 @@ cardano_metadatum_to_json(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_json_writer_t* writer = cardano_json_writer_new(CARDANO_JSON_FORMAT_PRETTY);
-  cardano_error_t        result = convert_metadatum_to_json_object(writer, metadatum);
+  size_t          required_size = 0U;
+  cardano_error_t result        = get_metadatum_json_size(metadatum, 0U, &required_size);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_json_writer_unref(&writer);
     return result;
   }
 
-  size_t required_size = cardano_json_writer_get_encoded_size(writer);
-
-  if (json_size < required_size)
+  if (json_size < (required_size + 1U))
   {
-    cardano_json_writer_unref(&writer);
     return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
   }
 
-  result = cardano_json_writer_encode(writer, json, json_size);
+  cardano_json_writer_t* writer = cardano_json_writer_new(CARDANO_JSON_FORMAT_PRETTY);
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  result = cardano_json_writer_reserve(writer, required_size);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = convert_metadatum_to_json_object(writer, metadatum);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_json_writer_encode(writer, json, json_size);
+  }
 
   cardano_json_writer_unref(&writer);
 
   return result;
 }
 
-size_t
-cardano_metadatum_get_json_size(cardano_metadatum_t* metadatum)
+cardano_error_t
+cardano_metadatum_write_json(cardano_metadatum_t* metadatum, cardano_json_writer_t* writer)
 {
-  if (metadatum == NULL)
+  if ((metadatum == NULL) || (writer == NULL))
   {
-    return 0U;
+    return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_json_writer_t* writer = cardano_json_writer_new(CARDANO_JSON_FORMAT_PRETTY);
-  cardano_error_t        result = convert_metadatum_to_json_object(writer, metadatum);
+  size_t          required_size = 0U;
+  cardano_error_t result        = get_metadatum_json_size(metadatum, 0U, &required_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  // The pretty layout is the larger one, so the reservation also covers compact writers
+  result = cardano_json_writer_reserve(writer, cardano_json_writer_get_encoded_size(writer) + required_size);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_json_writer_unref(&writer);
+    return result;
+  }
+
+  return convert_metadatum_to_json_object(writer, metadatum);
+}
 
+size_t
+cardano_metadatum_get_json_size(cardano_metadatum_t* metadatum)
+{
+  if (metadatum == NULL)
+  {
     return 0U;
   }
 
-  const size_t size = cardano_json_writer_get_encoded_size(writer);
+  size_t size = 0U;
 
-  cardano_json_writer_unref(&writer);
+  if (get_metadatum_json_size(metadatum, 0U, &size) != CARDANO_SUCCESS)
+  {
+    return 0U;
+  }
 
-  return size;
+  return size + 1U;
 }
 
 cardano_error_t
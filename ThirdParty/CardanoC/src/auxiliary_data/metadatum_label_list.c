@@ -122,7 +122,7 @@ cardano_metadatum_label_list_new(cardano_metadatum_label_list_t** metadatum_labe
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_metadatum_label_list_deallocate;
 
   list->array = cardano_array_new(128);
@@ -196,7 +196,7 @@ cardano_metadatum_label_list_add(cardano_metadatum_label_list_t* metadatum_label
   }
 
   metadatum_label->base.ref_count     = 0;
-  metadatum_label->base.last_error[0] = '\0';
+  metadatum_label->base.last_error    = NULL;
   metadatum_label->base.deallocator   = _cardano_free;
   metadatum_label->value              = element;
 
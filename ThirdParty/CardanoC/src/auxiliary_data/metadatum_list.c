@@ -91,7 +91,7 @@ cardano_metadatum_list_new(cardano_metadatum_list_t** metadatum_list)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_metadatum_list_deallocate;
 
   list->array = cardano_array_new(128);
@@ -136,7 +136,7 @@ cardano_metadatum_map_new(cardano_metadatum_map_t** metadatum_map)
   }
 
   map->base.ref_count          = 1;
-  map->base.last_error[0]      = '\0';
+  map->base.last_error         = NULL;
   map->base.deallocator        = cardano_metadatum_map_deallocate;
   map->use_indefinite_encoding = false;
 
@@ -235,7 +235,7 @@ cardano_metadatum_map_from_cbor(cardano_cbor_reader_t* reader, cardano_metadatum
     }
 
     kvp->base.ref_count     = 0;
-    kvp->base.last_error[0] = '\0';
+    kvp->base.last_error    = NULL;
     kvp->base.deallocator   = cardano_metadatum_map_kvp_deallocate;
     kvp->key                = key;
     kvp->value              = value;
@@ -421,7 +421,7 @@ cardano_metadatum_map_insert(
   }
 
   kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
+  kvp->base.last_error    = NULL;
   kvp->base.deallocator   = cardano_metadatum_map_kvp_deallocate;
   kvp->key                = key;
   kvp->value              = value;
@@ -532,6 +532,36 @@ cardano_metadatum_map_get_values(
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_metadatum_map_get_key_value_at(
+  const cardano_metadatum_map_t* metadatum_map,
+  const size_t                   index,
+  cardano_metadatum_t**          key,
+  cardano_metadatum_t**          value)
+{
+  if ((metadatum_map == NULL) || (key == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (index >= cardano_array_get_size(metadatum_map->array))
+  {
+    return CARDANO_ERROR_INDEX_OUT_OF_BOUNDS;
+  }
+
+  cardano_object_t*            object = cardano_array_get(metadatum_map->array, index);
+  cardano_metadatum_map_kvp_t* kvp    = (cardano_metadatum_map_kvp_t*)((void*)object);
+
+  cardano_metadatum_ref(kvp->key);
+  cardano_metadatum_ref(kvp->value);
+  cardano_object_unref(&object);
+
+  *key   = kvp->key;
+  *value = kvp->value;
+
+  return CARDANO_SUCCESS;
+}
+
 bool
 cardano_metadatum_map_equals(const cardano_metadatum_map_t* lhs, const cardano_metadatum_map_t* rhs)
 {
@@ -91,7 +91,7 @@ cardano_plutus_v1_script_list_new(cardano_plutus_v1_script_list_t** plutus_v1_sc
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_plutus_v1_script_list_deallocate;
 
   list->array = cardano_array_new(128);
@@ -151,7 +151,7 @@ cardano_transaction_metadata_new(cardano_transaction_metadata_t** transaction_me
   }
 
   map->base.ref_count     = 1;
-  map->base.last_error[0] = '\0';
+  map->base.last_error    = NULL;
   map->base.deallocator   = cardano_transaction_metadata_deallocate;
 
   map->array = cardano_array_new(32);
@@ -245,7 +245,7 @@ cardano_transaction_metadata_from_cbor(cardano_cbor_reader_t* reader, cardano_tr
     }
 
     kvp->base.ref_count     = 0;
-    kvp->base.last_error[0] = '\0';
+    kvp->base.last_error    = NULL;
     kvp->base.deallocator   = cardano_transaction_metadata_kvp_deallocate;
     kvp->key                = key;
     kvp->value              = value;
@@ -402,7 +402,7 @@ cardano_transaction_metadata_insert(
   }
 
   kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
+  kvp->base.last_error    = NULL;
   kvp->base.deallocator   = cardano_transaction_metadata_kvp_deallocate;
   kvp->key                = key;
   kvp->value              = value;
@@ -22,9 +22,11 @@
 /* INCLUDES ******************************************************************/
 
 #include <cardano/bip39.h>
+#include <cardano/object.h>
 
 #include "bip39_wordlist_en.h"
 
+#include "../allocators.h"
 #include "../string_safe.h"
 #include <assert.h>
 #include <sodium.h>
@@ -32,16 +34,287 @@
 
 /* CONSTANTS *****************************************************************/
 
-static const size_t BITS_PER_WORD = 11U;
+static const size_t   BITS_PER_WORD      = 11U;
+static const uint32_t WORD_INDEX_MASK    = 0x7FFU;
+static const size_t   MAX_WORD_SIZE      = 64U;
+static const size_t   MAX_BITSTREAM_SIZE = 34U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A BIP-39 wordlist together with the order of its words, for lookups by binary search.
+ */
+typedef struct cardano_bip39_wordlist_t
+{
+    cardano_object_t base;
+    char*            storage;
+    const char*      words[CARDANO_BIP39_WORDLIST_SIZE];
+    uint16_t         sorted[CARDANO_BIP39_WORDLIST_SIZE];
+} cardano_bip39_wordlist_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates a wordlist object.
+ *
+ * \param object A void pointer to the wordlist object to be deallocated.
+ */
+static void
+cardano_bip39_wordlist_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_bip39_wordlist_t* data = (cardano_bip39_wordlist_t*)object;
+
+  _cardano_free(data->storage);
+  _cardano_free(data);
+}
+
+/**
+ * \brief Sorts the word indices of a wordlist by the bytes of their words.
+ *
+ * A bottom-up merge sort, so building a wordlist takes at most 11 passes over its indices.
+ *
+ * \param wordlist The wordlist whose \c sorted member is filled.
+ * \param scratch A buffer of \ref CARDANO_BIP39_WORDLIST_SIZE indices.
+ */
+static void
+sort_words(cardano_bip39_wordlist_t* wordlist, uint16_t* scratch)
+{
+  uint16_t* source = wordlist->sorted;
+  uint16_t* target = scratch;
+
+  for (size_t i = 0U; i < CARDANO_BIP39_WORDLIST_SIZE; ++i)
+  {
+    source[i] = (uint16_t)i;
+  }
+
+  for (size_t width = 1U; width < CARDANO_BIP39_WORDLIST_SIZE; width *= 2U)
+  {
+    for (size_t start = 0U; start < CARDANO_BIP39_WORDLIST_SIZE; start += 2U * width)
+    {
+      const size_t middle = start + width;
+      const size_t end    = start + (2U * width);
+      size_t       left   = start;
+      size_t       right  = middle;
+
+      for (size_t i = start; i < end; ++i)
+      {
+        const bool take_left = (right >= end) || ((left < middle) && (strcmp(wordlist->words[source[left]], wordlist->words[source[right]]) <= 0));
+
+        if (take_left)
+        {
+          target[i] = source[left];
+          ++left;
+        }
+        else
+        {
+          target[i] = source[right];
+          ++right;
+        }
+      }
+    }
+
+    uint16_t* swap = source;
+    source         = target;
+    target         = swap;
+  }
+
+  if (source != wordlist->sorted)
+  {
+    cardano_safe_memcpy(wordlist->sorted, sizeof(wordlist->sorted), source, sizeof(wordlist->sorted));
+  }
+}
+
+/**
+ * \brief Gets the word at a position of the byte order of a wordlist.
+ *
+ * \param wordlist The wordlist, or NULL for the English one, which is stored in that order.
+ * \param rank The position in byte order.
+ * \param index On return, the index of the word in the wordlist.
+ *
+ * \return The word.
+ */
+static const char*
+get_ranked_word(const cardano_bip39_wordlist_t* wordlist, const size_t rank, size_t* index)
+{
+  *index = (wordlist == NULL) ? rank : (size_t)wordlist->sorted[rank];
+
+  return (wordlist == NULL) ? BIP39_WORDLIST_EN[*index] : wordlist->words[*index];
+}
+
+/**
+ * \brief Finds a word by binary search, in at most 11 comparisons.
+ *
+ * \param wordlist The wordlist, or NULL for the English one.
+ * \param word The word to find.
+ * \param index On success, the index of the word.
+ *
+ * \return Whether the word is in the wordlist.
+ */
+static bool
+find_word(const cardano_bip39_wordlist_t* wordlist, const char* word, size_t* index)
+{
+  size_t low  = 0U;
+  size_t high = CARDANO_BIP39_WORDLIST_SIZE;
+
+  while (low < high)
+  {
+    const size_t middle     = low + ((high - low) / 2U);
+    size_t       found      = 0U;
+    const int    comparison = strcmp(word, get_ranked_word(wordlist, middle, &found));
+
+    if (comparison == 0)
+    {
+      *index = found;
+      return true;
+    }
+
+    if (comparison < 0)
+    {
+      high = middle;
+    }
+    else
+    {
+      low = middle + 1U;
+    }
+  }
+
+  return false;
+}
 
 /* IMPLEMENTATION ************************************************************/
 
+cardano_error_t
+cardano_bip39_wordlist_new(
+  const char* const*         words,
+  const size_t               word_count,
+  cardano_bip39_wordlist_t** wordlist)
+{
+  if ((words == NULL) || (wordlist == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (word_count != CARDANO_BIP39_WORDLIST_SIZE)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  size_t data_size = 0U;
+
+  for (size_t i = 0U; i < word_count; ++i)
+  {
+    if (words[i] == NULL)
+    {
+      return CARDANO_ERROR_POINTER_IS_NULL;
+    }
+
+    const size_t size = cardano_safe_strlen(words[i], MAX_WORD_SIZE + 1U);
+
+    if ((size == 0U) || (size > MAX_WORD_SIZE))
+    {
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+
+    data_size += size + 1U;
+  }
+
+  cardano_bip39_wordlist_t* data    = _cardano_malloc(sizeof(cardano_bip39_wordlist_t));
+  uint16_t*                 scratch = _cardano_malloc(CARDANO_BIP39_WORDLIST_SIZE * sizeof(uint16_t));
+
+  if ((data == NULL) || (scratch == NULL))
+  {
+    _cardano_free(data);
+    _cardano_free(scratch);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  data->base.ref_count   = 1;
+  data->base.last_error  = NULL;
+  data->base.deallocator = cardano_bip39_wordlist_deallocate;
+  data->storage          = _cardano_malloc(data_size);
+
+  if (data->storage == NULL)
+  {
+    _cardano_free(scratch);
+    cardano_bip39_wordlist_unref(&data);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  // The words are copied into one block, so the wordlist does not depend on the lifetime of the caller's strings.
+  size_t offset = 0U;
+
+  for (size_t i = 0U; i < word_count; ++i)
+  {
+    const size_t size = cardano_safe_strlen(words[i], MAX_WORD_SIZE);
+
+    cardano_safe_memcpy(&data->storage[offset], data_size - offset, words[i], size);
+    data->storage[offset + size] = '\0';
+    data->words[i]               = &data->storage[offset];
+
+    offset += size + 1U;
+  }
+
+  sort_words(data, scratch);
+  _cardano_free(scratch);
+
+  for (size_t i = 1U; i < word_count; ++i)
+  {
+    if (strcmp(data->words[data->sorted[i - 1U]], data->words[data->sorted[i]]) == 0)
+    {
+      cardano_bip39_wordlist_unref(&data);
+
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+  }
+
+  *wordlist = data;
+
+  return CARDANO_SUCCESS;
+}
+
+const char*
+cardano_bip39_wordlist_get_word(const cardano_bip39_wordlist_t* wordlist, const size_t index)
+{
+  if (index >= CARDANO_BIP39_WORDLIST_SIZE)
+  {
+    return NULL;
+  }
+
+  return (wordlist == NULL) ? BIP39_WORDLIST_EN[index] : wordlist->words[index];
+}
+
+cardano_error_t
+cardano_bip39_wordlist_find(const cardano_bip39_wordlist_t* wordlist, const char* word, size_t* index)
+{
+  if ((word == NULL) || (index == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return find_word(wordlist, word, index) ? CARDANO_SUCCESS : CARDANO_ERROR_ELEMENT_NOT_FOUND;
+}
+
 cardano_error_t
 cardano_bip39_entropy_to_mnemonic_words(
   const byte_t* entropy,
   const size_t  entropy_size,
   const char**  words,
   size_t*       word_count)
+{
+  return cardano_bip39_entropy_to_mnemonic_words_ex(NULL, entropy, entropy_size, words, word_count);
+}
+
+cardano_error_t
+cardano_bip39_entropy_to_mnemonic_words_ex(
+  const cardano_bip39_wordlist_t* wordlist,
+  const byte_t*                   entropy,
+  const size_t                    entropy_size,
+  const char**                    words,
+  size_t*                         word_count)
 {
   if (!entropy || !words || !word_count)
   {
@@ -57,40 +330,39 @@ cardano_bip39_entropy_to_mnemonic_words(
   size_t total_bits    = (entropy_size * 8U) + checksum_bits;
   *word_count          = total_bits / BITS_PER_WORD;
 
-  byte_t entropy_with_checksum[33] = { 0 };
-  cardano_safe_memcpy(entropy_with_checksum, sizeof(entropy_with_checksum), entropy, entropy_size);
-
   byte_t hash[32] = { 0 };
   CARDANO_UNUSED(crypto_hash_sha256(hash, entropy, entropy_size));
 
-  if (checksum_bits > 0U)
-  {
-    entropy_with_checksum[entropy_size] = hash[0];
-  }
-
+  // The checksum is at most 8 bits, so the first byte of the hash holds all of it.
   byte_t bitstream[33] = { 0 };
-  cardano_safe_memcpy(bitstream, sizeof(bitstream), entropy_with_checksum, entropy_size + 1U);
+  cardano_safe_memcpy(bitstream, sizeof(bitstream), entropy, entropy_size);
+  bitstream[entropy_size] = hash[0];
+
+  // Whole bytes are fed into an accumulator and 11-bit indices taken from its top, instead of moving single bits.
+  uint32_t accumulator = 0U;
+  size_t   bits        = 0U;
+  size_t   next_byte   = 0U;
 
   for (size_t i = 0U; i < *word_count; ++i)
   {
-    uint16_t index = 0U;
-
-    for (size_t j = 0U; j < BITS_PER_WORD; ++j)
+    while (bits < BITS_PER_WORD)
     {
-      size_t bit_index   = (i * BITS_PER_WORD) + j;
-      size_t byte_index  = bit_index / 8U;
-      size_t bit_in_byte = 7U - (bit_index % 8U);
-
-      if ((bitstream[byte_index] & (1U << bit_in_byte)) > 0U)
-      {
-        index |= (uint16_t)(1U << (BITS_PER_WORD - 1U - j));
-      }
+      accumulator = (accumulator << 8U) | bitstream[next_byte];
+      bits += 8U;
+      ++next_byte;
     }
 
-    assert(index < 2048U);
-    words[i] = BIP39_WORDLIST_EN[index];
+    bits -= BITS_PER_WORD;
+
+    const size_t index = (size_t)((accumulator >> bits) & WORD_INDEX_MASK);
+
+    assert(index < CARDANO_BIP39_WORDLIST_SIZE);
+    words[i] = cardano_bip39_wordlist_get_word(wordlist, index);
   }
 
+  sodium_memzero(bitstream, sizeof(bitstream));
+  sodium_memzero(hash, sizeof(hash));
+
   return CARDANO_SUCCESS;
 }
 
@@ -101,6 +373,18 @@ cardano_bip39_mnemonic_words_to_entropy(
   byte_t*      entropy,
   const size_t entropy_buf_size,
   size_t*      entropy_size)
+{
+  return cardano_bip39_mnemonic_words_to_entropy_ex(NULL, words, word_count, entropy, entropy_buf_size, entropy_size);
+}
+
+cardano_error_t
+cardano_bip39_mnemonic_words_to_entropy_ex(
+  const cardano_bip39_wordlist_t* wordlist,
+  const char**                    words,
+  const size_t                    word_count,
+  byte_t*                         entropy,
+  const size_t                    entropy_buf_size,
+  size_t*                         entropy_size)
 {
   if (!words || !entropy || !entropy_size)
   {
@@ -121,44 +405,41 @@ cardano_bip39_mnemonic_words_to_entropy(
     return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
   }
 
-  size_t total_bits    = word_count * BITS_PER_WORD;
-  size_t bitstram_size = (total_bits + 7U) / 8U;
   byte_t bitstream[34] = { 0 };
 
-  CARDANO_UNUSED(memset(bitstream, 0U, bitstram_size));
+  uint32_t accumulator = 0U;
+  size_t   bits        = 0U;
+  size_t   next_byte   = 0U;
 
   for (size_t i = 0U; i < word_count; i++)
   {
-    int32_t index = -1;
-    for (int32_t j = 0; j < 2048; ++j)
-    {
-      if (strcmp(words[i], BIP39_WORDLIST_EN[j]) == 0)
-      {
-        index = j;
-        break;
-      }
-    }
-    if (index == -1)
+    size_t index = 0U;
+
+    if ((words[i] == NULL) || !find_word(wordlist, words[i], &index))
     {
+      sodium_memzero(bitstream, sizeof(bitstream));
+
       return CARDANO_ERROR_INVALID_ARGUMENT;
     }
 
-    for (size_t k = 0U; k < BITS_PER_WORD; ++k)
-    {
-      size_t shift_amount = 10U - k;
-      size_t mask         = ((size_t)1) << shift_amount;
-
-      if (((uint32_t)index & (uint32_t)mask) != 0U)
-      {
-        size_t bit_index   = (i * BITS_PER_WORD) + k;
-        size_t byte_index  = bit_index / 8U;
-        byte_t bit_in_byte = (byte_t)(7U - (bit_index % 8U));
+    accumulator = (accumulator << BITS_PER_WORD) | (uint32_t)index;
+    bits += BITS_PER_WORD;
 
-        bitstream[byte_index] |= (1U << bit_in_byte);
-      }
+    while (bits >= 8U)
+    {
+      bits -= 8U;
+      bitstream[next_byte] = (byte_t)((accumulator >> bits) & 0xFFU);
+      ++next_byte;
     }
   }
 
+  // The bits left over are the tail of the checksum, stored left-aligned like the rest of the stream.
+  if (bits > 0U)
+  {
+    assert(next_byte < MAX_BITSTREAM_SIZE);
+    bitstream[next_byte] = (byte_t)((accumulator << (8U - bits)) & 0xFFU);
+  }
+
   cardano_safe_memcpy(entropy, entropy_buf_size, bitstream, entropy_bytes);
 
   *entropy_size = entropy_bytes;
@@ -167,26 +448,66 @@ cardano_bip39_mnemonic_words_to_entropy(
   crypto_hash_sha256(hash, entropy, entropy_bytes);
 
   byte_t calculated_checksum = hash[0] >> (8U - checksum_bits);
+  byte_t extracted_checksum  = bitstream[entropy_bytes] >> (8U - checksum_bits);
 
-  byte_t extracted_checksum = 0U;
-  size_t checksum_start_bit = entropy_bits;
+  sodium_memzero(bitstream, sizeof(bitstream));
 
-  for (size_t i = 0U; i < checksum_bits; i++)
+  if (calculated_checksum != extracted_checksum)
   {
-    size_t bit_index   = checksum_start_bit + i;
-    size_t byte_index  = bit_index / 8U;
-    size_t bit_in_byte = 7U - (bit_index % 8U);
+    return CARDANO_ERROR_INVALID_CHECKSUM;
+  }
 
-    if ((bitstream[byte_index] & (1U << bit_in_byte)) > 0U)
-    {
-      extracted_checksum |= (byte_t)(1U << (checksum_bits - 1U - i));
-    }
+  return CARDANO_SUCCESS;
+}
+
+void
+cardano_bip39_wordlist_unref(cardano_bip39_wordlist_t** wordlist)
+{
+  if ((wordlist == NULL) || (*wordlist == NULL))
+  {
+    return;
   }
 
-  if (calculated_checksum != extracted_checksum)
+  cardano_object_t* object = &(*wordlist)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
   {
-    return CARDANO_ERROR_INVALID_CHECKSUM;
+    *wordlist = NULL;
+    return;
+  }
+}
+
+void
+cardano_bip39_wordlist_ref(cardano_bip39_wordlist_t* wordlist)
+{
+  if (wordlist == NULL)
+  {
+    return;
   }
 
-  return CARDANO_SUCCESS;
-}
\ No newline at end of file
+  cardano_object_ref(&wordlist->base);
+}
+
+size_t
+cardano_bip39_wordlist_refcount(const cardano_bip39_wordlist_t* wordlist)
+{
+  if (wordlist == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&wordlist->base);
+}
+
+void
+cardano_bip39_wordlist_set_last_error(cardano_bip39_wordlist_t* wordlist, const char* message)
+{
+  cardano_object_set_last_error(&wordlist->base, message);
+}
+
+const char*
+cardano_bip39_wordlist_get_last_error(const cardano_bip39_wordlist_t* wordlist)
+{
+  return cardano_object_get_last_error(&wordlist->base);
+}
@@ -28,6 +28,8 @@
 #include <cardano/object.h>
 
 #include "../allocators.h"
+#include "../encoding/internals/hex_codec.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
 
 #include <assert.h>
@@ -37,8 +39,27 @@
 
 #include "../config.h"
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Capacity up to which a buffer keeps its bytes in the same allocation as its structure.
+ *
+ * Covers hashes, keys and signatures, so most buffers of the library cost one heap block instead of two.
+ */
+static const size_t INLINE_CAPACITY = 64U;
+
 /* STRUCTS *******************************************************************/
 
+/**
+ * \brief Storage an owning buffer moved away from while views still referenced it.
+ */
+typedef struct cardano_buffer_retired_t
+{
+    byte_t*                          data;
+    size_t                           capacity;
+    struct cardano_buffer_retired_t* next;
+} cardano_buffer_retired_t;
+
 /**
  * \struct cardano_buffer_t
  * \brief Represents a dynamically sized buffer for storing binary data.
@@ -46,18 +67,162 @@
  * This structure is designed to manage a variable-sized sequence of bytes, providing mechanisms
  * for dynamically resizing the buffer as necessary. It is built on top of \c cardano_object_t,
  * inheriting reference counting and basic object management functionalities.
+ *
+ * A view (\c parent not NULL) does not own \c data, which points into the storage of its parent, and holds a
+ * reference to the parent. Views are always made of an owning buffer, never of another view.
+ *
+ * A buffer created with a capacity of at most \ref INLINE_CAPACITY bytes keeps them right after the structure, in
+ * \c inline_capacity bytes of the same allocation, until it grows beyond them.
  */
 typedef struct cardano_buffer_t
 {
-    cardano_object_t base;
-    byte_t*          data;
-    size_t           size;
-    size_t           head;
-    size_t           capacity;
+    cardano_object_t          base;
+    byte_t*                   data;
+    size_t                    size;
+    size_t                    head;
+    size_t                    capacity;
+    struct cardano_buffer_t*  parent;
+    size_t                    view_count;
+    bool                      is_shared;
+    cardano_buffer_retired_t* retired;
+    size_t                    inline_capacity;
 } cardano_buffer_t;
 
 /* STATIC FUNCTIONS ***********************************************************/
 
+/**
+ * \brief Initializes the bookkeeping fields of a new buffer, as an owning buffer with no views.
+ *
+ * \param[in] buffer The buffer to initialize.
+ */
+static void
+init_owner(cardano_buffer_t* buffer)
+{
+  assert(buffer != NULL);
+
+  buffer->head             = 0;
+  buffer->parent           = NULL;
+  buffer->view_count       = 0U;
+  buffer->is_shared        = false;
+  buffer->retired          = NULL;
+  buffer->inline_capacity  = 0U;
+  buffer->base.ref_count   = 1;
+  buffer->base.last_error  = NULL;
+}
+
+/**
+ * \brief Checks whether the bytes of a buffer are the inline storage that follows its structure.
+ *
+ * \param[in] buffer The buffer.
+ *
+ * \return \c true if \c data is the inline storage, which is not freed on its own.
+ */
+static bool
+uses_inline_storage(const cardano_buffer_t* buffer)
+{
+  assert(buffer != NULL);
+
+  return (buffer->inline_capacity > 0U) && (buffer->data == (const byte_t*)&buffer[1]);
+}
+
+/**
+ * \brief Frees the storage an owning buffer retired while views referenced it.
+ *
+ * \param[in] buffer The owning buffer.
+ */
+static void
+free_retired(cardano_buffer_t* buffer)
+{
+  assert(buffer != NULL);
+
+  while (buffer->retired != NULL)
+  {
+    cardano_buffer_retired_t* next = buffer->retired->next;
+
+    // The storage was replaced, not cleared, so it may still hold whatever the buffer held then
+    sodium_memzero(buffer->retired->data, buffer->retired->capacity);
+    _cardano_free(buffer->retired->data);
+    _cardano_free(buffer->retired);
+
+    buffer->retired = next;
+  }
+}
+
+/**
+ * \brief Gives the buffer storage of its own that no view references, copying its bytes if needed.
+ *
+ * A view copies its range and drops its parent. An owning buffer whose storage views reference copies it and retires
+ * the old storage, which it frees once its last view is gone. Either way the bytes seen by every other buffer stay as
+ * they were.
+ *
+ * \param[in] buffer The buffer about to be modified.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+detach_storage(cardano_buffer_t* buffer)
+{
+  assert(buffer != NULL);
+
+  if ((buffer->parent == NULL) && !buffer->is_shared)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  const size_t capacity = (buffer->capacity > 0U) ? buffer->capacity : 1U;
+  byte_t*      data     = (byte_t*)_cardano_malloc_alongside(buffer, capacity);
+
+  if (data == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_safe_memcpy(data, capacity, buffer->data, buffer->size);
+
+  if (buffer->parent != NULL)
+  {
+    cardano_buffer_t* parent = buffer->parent;
+
+    assert(parent->view_count > 0U);
+    parent->view_count -= 1U;
+
+    if (parent->view_count == 0U)
+    {
+      parent->is_shared = false;
+      free_retired(parent);
+    }
+
+    buffer->parent = NULL;
+    cardano_buffer_unref(&parent);
+  }
+  else if (!uses_inline_storage(buffer))
+  {
+    cardano_buffer_retired_t* retired = (cardano_buffer_retired_t*)_cardano_malloc_alongside(buffer, sizeof(cardano_buffer_retired_t));
+
+    if (retired == NULL)
+    {
+      _cardano_free(data);
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    retired->data     = buffer->data;
+    retired->capacity = buffer->capacity;
+    retired->next     = buffer->retired;
+    buffer->retired   = retired;
+    buffer->is_shared = false;
+  }
+  else
+  {
+    // Inline storage lives as long as the structure, which the views keep alive
+    buffer->is_shared = false;
+  }
+
+  buffer->data     = data;
+  buffer->capacity = capacity;
+
+  return CARDANO_SUCCESS;
+}
+
 /**
  * \brief Grows the buffer if there is not enough capacity to hold the new data.
  *
@@ -73,10 +238,31 @@ grow_buffer_if_needed(cardano_buffer_t* buffer, const size_t size_of_new_data)
 {
   assert(buffer != NULL);
 
+  const cardano_error_t detach_result = detach_storage(buffer);
+
+  if (detach_result != CARDANO_SUCCESS)
+  {
+    return detach_result;
+  }
+
   if ((buffer->size + size_of_new_data) >= buffer->capacity)
   {
     size_t  new_capacity = (size_t)ceil((float)((float)buffer->size + (float)size_of_new_data) * (float)LIB_CARDANO_C_COLLECTION_GROW_FACTOR);
-    byte_t* new_data     = (byte_t*)_cardano_realloc(buffer->data, new_capacity);
+    byte_t* new_data     = NULL;
+
+    if (uses_inline_storage(buffer))
+    {
+      new_data = (byte_t*)_cardano_malloc_alongside(buffer, new_capacity);
+
+      if (new_data != NULL)
+      {
+        cardano_safe_memcpy(new_data, new_capacity, buffer->data, buffer->size);
+      }
+    }
+    else
+    {
+      new_data = (byte_t*)_cardano_realloc(buffer->data, new_capacity);
+    }
 
     if (new_data == NULL)
     {
@@ -110,45 +296,86 @@ cardano_buffer_deallocate(void* object)
 
   cardano_buffer_t* buffer = (cardano_buffer_t*)object;
 
-  if (buffer->data != NULL)
+  if (buffer->parent != NULL)
+  {
+    cardano_buffer_t* parent = buffer->parent;
+
+    assert(parent->view_count > 0U);
+    parent->view_count -= 1U;
+
+    if (parent->view_count == 0U)
+    {
+      parent->is_shared = false;
+      free_retired(parent);
+    }
+
+    cardano_buffer_unref(&parent);
+    _cardano_free(buffer);
+
+    return;
+  }
+
+  if ((buffer->data != NULL) && !uses_inline_storage(buffer))
   {
     _cardano_free(buffer->data);
     buffer->data = NULL;
   }
 
+  free_retired(buffer);
   _cardano_free(buffer);
 }
 
-/* DEFINITIONS ****************************************************************/
-
-cardano_buffer_t*
-cardano_buffer_new(const size_t capacity)
+/**
+ * \brief Allocates an empty owning buffer, with its storage inline when \p capacity is small enough.
+ *
+ * \param[in] capacity The capacity of the buffer.
+ *
+ * \return The new buffer, or NULL if memory could not be allocated.
+ */
+static cardano_buffer_t*
+buffer_alloc(const size_t capacity)
 {
-  cardano_buffer_t* buffer = (cardano_buffer_t*)_cardano_malloc(sizeof(cardano_buffer_t));
+  const size_t      inline_capacity = ((capacity > 0U) && (capacity <= INLINE_CAPACITY)) ? capacity : 0U;
+  cardano_buffer_t* buffer          = (cardano_buffer_t*)_cardano_malloc(sizeof(cardano_buffer_t) + inline_capacity);
 
   if (buffer == NULL)
   {
     return NULL;
   }
 
-  buffer->data = (byte_t*)_cardano_malloc(capacity);
+  init_owner(buffer);
 
-  if (buffer->data == NULL)
+  if (inline_capacity > 0U)
   {
-    _cardano_free(buffer);
-    return NULL;
+    buffer->data = (byte_t*)&buffer[1];
+  }
+  else
+  {
+    buffer->data = (byte_t*)_cardano_malloc(capacity);
+
+    if (buffer->data == NULL)
+    {
+      _cardano_free(buffer);
+      return NULL;
+    }
   }
 
-  buffer->size               = 0;
-  buffer->head               = 0;
-  buffer->capacity           = capacity;
-  buffer->base.ref_count     = 1;
-  buffer->base.last_error[0] = '\0';
-  buffer->base.deallocator   = cardano_buffer_deallocate;
+  buffer->size             = 0;
+  buffer->capacity         = capacity;
+  buffer->inline_capacity  = inline_capacity;
+  buffer->base.deallocator = cardano_buffer_deallocate;
 
   return buffer;
 }
 
+/* DEFINITIONS ****************************************************************/
+
+cardano_buffer_t*
+cardano_buffer_new(const size_t capacity)
+{
+  return buffer_alloc(capacity);
+}
+
 cardano_buffer_t*
 cardano_buffer_new_from(const byte_t* array, const size_t size)
 {
@@ -157,29 +384,16 @@ cardano_buffer_new_from(const byte_t* array, const size_t size)
     return NULL;
   }
 
-  cardano_buffer_t* buffer = (cardano_buffer_t*)_cardano_malloc(sizeof(cardano_buffer_t));
+  cardano_buffer_t* buffer = buffer_alloc(size);
 
   if (buffer == NULL)
   {
     return NULL;
   }
 
-  buffer->data = (byte_t*)_cardano_malloc(size);
-
-  if (buffer->data == NULL)
-  {
-    _cardano_free(buffer);
-    return NULL;
-  }
-
   cardano_safe_memcpy(buffer->data, size, array, size);
 
-  buffer->size               = size;
-  buffer->head               = 0;
-  buffer->capacity           = buffer->size;
-  buffer->base.ref_count     = 1;
-  buffer->base.last_error[0] = '\0';
-  buffer->base.deallocator   = cardano_buffer_deallocate;
+  buffer->size = size;
 
   return buffer;
 }
@@ -197,30 +411,17 @@ cardano_buffer_concat(const cardano_buffer_t* lhs, const cardano_buffer_t* rhs)
     return NULL;
   }
 
-  cardano_buffer_t* buffer = (cardano_buffer_t*)_cardano_malloc(sizeof(cardano_buffer_t));
+  cardano_buffer_t* buffer = buffer_alloc(lhs->size + rhs->size);
 
   if (buffer == NULL)
   {
     return NULL;
   }
 
-  buffer->data = (byte_t*)_cardano_malloc(lhs->size + rhs->size);
-
-  if (buffer->data == NULL)
-  {
-    _cardano_free(buffer);
-    return NULL;
-  }
-
   cardano_safe_memcpy(buffer->data, lhs->size + rhs->size, lhs->data, lhs->size);
   cardano_safe_memcpy(&buffer->data[lhs->size], rhs->size, rhs->data, rhs->size);
 
-  buffer->size               = lhs->size + rhs->size;
-  buffer->head               = 0;
-  buffer->capacity           = buffer->size;
-  buffer->base.ref_count     = 1;
-  buffer->base.last_error[0] = '\0';
-  buffer->base.deallocator   = cardano_buffer_deallocate;
+  buffer->size = lhs->size + rhs->size;
 
   return buffer;
 }
@@ -255,83 +456,114 @@ cardano_buffer_slice(const cardano_buffer_t* buffer, size_t start, size_t end)
     return cardano_buffer_new(1U);
   }
 
-  byte_t* slice_data = (byte_t*)_cardano_malloc(slice_size);
+  cardano_buffer_t* sliced_buffer = buffer_alloc(slice_size);
 
-  if (slice_data == NULL)
+  if (sliced_buffer == NULL)
   {
     return NULL;
   }
 
   assert(buffer->data != NULL);
 
-  cardano_safe_memcpy(slice_data, slice_size, &buffer->data[start], slice_size);
-
-  cardano_buffer_t* sliced_buffer = (cardano_buffer_t*)_cardano_malloc(sizeof(cardano_buffer_t));
-
-  if (sliced_buffer == NULL)
-  {
-    _cardano_free(slice_data);
-    return NULL;
-  }
+  cardano_safe_memcpy(sliced_buffer->data, slice_size, &buffer->data[start], slice_size);
 
-  sliced_buffer->data               = slice_data;
-  sliced_buffer->size               = slice_size;
-  sliced_buffer->head               = 0;
-  sliced_buffer->capacity           = sliced_buffer->size;
-  sliced_buffer->base.ref_count     = 1;
-  sliced_buffer->base.last_error[0] = '\0';
-  sliced_buffer->base.deallocator   = cardano_buffer_deallocate;
+  sliced_buffer->size = slice_size;
 
   return sliced_buffer;
 }
 
 cardano_buffer_t*
-cardano_buffer_from_hex(const char* hex_string, const size_t size)
+cardano_buffer_slice_view(cardano_buffer_t* buffer, size_t start, size_t end)
 {
-  if (hex_string == NULL)
+  if (buffer == NULL)
   {
     return NULL;
   }
 
-  if ((size % 2U) != 0U)
+  if ((start > buffer->size) || (end > buffer->size) || (end < start))
   {
     return NULL;
   }
 
-  cardano_buffer_t* buffer = (cardano_buffer_t*)_cardano_malloc(sizeof(cardano_buffer_t));
+  if (start == end)
+  {
+    return cardano_buffer_new(1U);
+  }
 
-  if (buffer == NULL)
+  cardano_buffer_t* parent = (buffer->parent != NULL) ? buffer->parent : buffer;
+  cardano_buffer_t* view   = (cardano_buffer_t*)_cardano_malloc(sizeof(cardano_buffer_t));
+
+  if (view == NULL)
   {
     return NULL;
   }
 
-  buffer->data               = (byte_t*)_cardano_malloc(size / 2U);
-  buffer->size               = size / 2U;
-  buffer->head               = 0;
-  buffer->capacity           = buffer->size;
-  buffer->base.ref_count     = 1;
-  buffer->base.last_error[0] = '\0';
-  buffer->base.deallocator   = cardano_buffer_deallocate;
+  assert(buffer->data != NULL);
 
-  if (buffer->data == NULL)
+  init_owner(view);
+
+  view->data             = &buffer->data[start];
+  view->size             = end - start;
+  view->capacity         = view->size;
+  view->parent           = parent;
+  view->base.deallocator = cardano_buffer_deallocate;
+
+  cardano_buffer_ref(parent);
+  parent->view_count += 1U;
+
+  if (buffer->parent == NULL)
+  {
+    parent->is_shared = true;
+  }
+
+  return view;
+}
+
+bool
+cardano_buffer_is_view(const cardano_buffer_t* buffer)
+{
+  if (buffer == NULL)
+  {
+    return false;
+  }
+
+  return buffer->parent != NULL;
+}
+
+cardano_error_t
+cardano_buffer_make_unique(cardano_buffer_t* buffer)
+{
+  if (buffer == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return detach_storage(buffer);
+}
+
+cardano_buffer_t*
+cardano_buffer_from_hex(const char* hex_string, const size_t size)
+{
+  if (hex_string == NULL)
   {
-    _cardano_free(buffer);
     return NULL;
   }
 
-  const char* end = NULL;
+  if ((size % 2U) != 0U)
+  {
+    return NULL;
+  }
 
-  int init_result = sodium_init();
+  cardano_buffer_t* buffer = buffer_alloc(size / 2U);
 
-  if (init_result == -1)
+  if (buffer == NULL)
   {
-    cardano_buffer_unref(&buffer);
     return NULL;
   }
 
-  int decode_result = sodium_hex2bin(buffer->data, size, hex_string, size, NULL, NULL, &end);
+  buffer->size = size / 2U;
 
-  if (decode_result != 0)
+  if (!cardano_hex_decode(hex_string, size, buffer->data))
   {
     cardano_buffer_unref(&buffer);
     return NULL;
@@ -374,19 +606,10 @@ cardano_buffer_to_hex(const cardano_buffer_t* buffer, char* dest, const size_t d
     return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
   }
 
-  int init_result = sodium_init();
-
-  if (init_result == -1)
-  {
-    return CARDANO_ERROR_GENERIC;
-  }
-
   assert(buffer->data != NULL);
 
-  if (sodium_bin2hex(dest, dest_size, buffer->data, buffer->size) < 0)
-  {
-    return CARDANO_ERROR_GENERIC;
-  }
+  cardano_hex_encode(buffer->data, buffer->size, dest);
+  dest[buffer->size * 2U] = '\0';
 
   return CARDANO_SUCCESS;
 }
@@ -570,6 +793,7 @@ cardano_buffer_memzero(cardano_buffer_t* buffer)
     return;
   }
 
+  // Shared bytes are wiped where they are, for the views sharing them too: a private copy would leave them behind
   sodium_memzero(buffer->data, buffer->size);
 }
 
@@ -1620,3 +1844,30 @@ cardano_buffer_get_last_error(const cardano_buffer_t* buffer)
 {
   return cardano_object_get_last_error(&buffer->base);
 }
+
+void
+_cardano_buffer_add_footprint(const cardano_buffer_t* buffer, cardano_footprint_context_t* context)
+{
+  if ((buffer == NULL) || !_cardano_footprint_visit(context, &buffer->base, CARDANO_MEMORY_FOOTPRINT_TYPE_BUFFER, sizeof(cardano_buffer_t) + buffer->inline_capacity))
+  {
+    return;
+  }
+
+  // A view keeps the whole storage of its parent alive, which is counted once however many views share it
+  if (buffer->parent != NULL)
+  {
+    _cardano_buffer_add_footprint(buffer->parent, context);
+    return;
+  }
+
+  if (!uses_inline_storage(buffer))
+  {
+    _cardano_footprint_add_block(context, CARDANO_MEMORY_FOOTPRINT_TYPE_BUFFER, buffer->capacity);
+  }
+
+  for (const cardano_buffer_retired_t* retired = buffer->retired; retired != NULL; retired = retired->next)
+  {
+    _cardano_footprint_add_block(context, CARDANO_MEMORY_FOOTPRINT_TYPE_BUFFER, sizeof(cardano_buffer_retired_t));
+    _cardano_footprint_add_block(context, CARDANO_MEMORY_FOOTPRINT_TYPE_BUFFER, retired->capacity);
+  }
+}
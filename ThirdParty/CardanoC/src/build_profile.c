@@ -0,0 +1,104 @@
+/**
+ * \file build_profile.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "build_profile.h"
+
+#include <stddef.h>
+#include <time.h>
+
+/* CONSTANTS *****************************************************************/
+
+#if defined(_MSC_VER)
+#define CARDANO_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+#define CARDANO_THREAD_LOCAL _Thread_local
+#else
+#define CARDANO_THREAD_LOCAL __thread
+#endif
+
+static const uint64_t NANOSECONDS_PER_SECOND = 1000000000U;
+
+/* STATIC DECLARATIONS *******************************************************/
+
+static CARDANO_THREAD_LOCAL cardano_tx_build_profile_t* s_current_profile = NULL;
+
+/* DEFINITIONS ***************************************************************/
+
+void
+_cardano_build_profile_begin(cardano_tx_build_profile_t* profile, cardano_tx_build_profile_t** previous)
+{
+  if (previous != NULL)
+  {
+    *previous = s_current_profile;
+  }
+
+  s_current_profile = profile;
+}
+
+void
+_cardano_build_profile_end(cardano_tx_build_profile_t* previous)
+{
+  s_current_profile = previous;
+}
+
+cardano_tx_build_profile_t*
+_cardano_build_profile_current(void)
+{
+  return s_current_profile;
+}
+
+uint64_t
+_cardano_build_profile_now(void)
+{
+  struct timespec now = { 0 };
+
+  if (timespec_get(&now, TIME_UTC) == 0)
+  {
+    return 0U;
+  }
+
+  return ((uint64_t)now.tv_sec * NANOSECONDS_PER_SECOND) + (uint64_t)now.tv_nsec;
+}
+
+void
+_cardano_build_profile_count_serialization(const size_t size)
+{
+  if (s_current_profile == NULL)
+  {
+    return;
+  }
+
+  ++s_current_profile->serialization_count;
+  s_current_profile->serialized_bytes += (uint64_t)size;
+}
+
+void
+_cardano_build_profile_count_hash(void)
+{
+  if (s_current_profile == NULL)
+  {
+    return;
+  }
+
+  ++s_current_profile->hash_count;
+}
@@ -0,0 +1,85 @@
+/**
+ * \file build_profile.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_BUILD_PROFILE_INTERNAL_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_BUILD_PROFILE_INTERNAL_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/transaction_builder/build_profile.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Makes `profile` the build profile of the calling thread until \ref _cardano_build_profile_end is called.
+ *
+ * While a profile is active, the CBOR writer and the hashing functions count their work into it, and the balancer
+ * records its phases. Profiles nest: the one active before is returned through `previous` and restored by
+ * \ref _cardano_build_profile_end.
+ *
+ * \param[in] profile The profile to fill in. Its counters are not reset.
+ * \param[out] previous Receives the profile that was active on the thread, if any.
+ */
+void _cardano_build_profile_begin(cardano_tx_build_profile_t* profile, cardano_tx_build_profile_t** previous);
+
+/**
+ * \brief Restores the profile that was active before the matching \ref _cardano_build_profile_begin.
+ *
+ * \param[in] previous The profile returned by the matching \ref _cardano_build_profile_begin.
+ */
+void _cardano_build_profile_end(cardano_tx_build_profile_t* previous);
+
+/**
+ * \brief Gets the build profile active on the calling thread.
+ *
+ * \return The active profile, or \c NULL when no build is being profiled on this thread.
+ */
+cardano_tx_build_profile_t* _cardano_build_profile_current(void);
+
+/**
+ * \brief Reads the clock the profile times are measured with.
+ *
+ * \return The current time in nanoseconds.
+ */
+uint64_t _cardano_build_profile_now(void);
+
+/**
+ * \brief Counts a CBOR serialization of `size` bytes into the active profile, if any.
+ *
+ * \param[in] size The number of bytes written.
+ */
+void _cardano_build_profile_count_serialization(size_t size);
+
+/**
+ * \brief Counts a hash computation into the active profile, if any.
+ */
+void _cardano_build_profile_count_hash(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_BUILD_PROFILE_INTERNAL_H
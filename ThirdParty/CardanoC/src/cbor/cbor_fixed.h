@@ -0,0 +1,152 @@
+/**
+ * \file cbor_fixed.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_CBOR_FIXED_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_CBOR_FIXED_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/cbor/cbor_major_type.h>
+#include <cardano/typedefs.h>
+
+#include "cbor_additional_info.h"
+
+#include <string.h>
+
+/* DEFINITIONS ****************************************************************/
+
+/*
+ * Encoders for structures whose CBOR shape is fixed, such as transaction inputs and vkey witnesses. The item is
+ * assembled in a stack buffer, with the headers of its known-size parts as constants and the payloads copied in, and
+ * handed to the writer with one cardano_cbor_writer_write_encoded call instead of one checked call per field.
+ * The output is byte for byte what the generic writer calls produce.
+ */
+
+/**
+ * \brief Initial byte of a definite-length array of fewer than 24 items.
+ */
+#define CARDANO_CBOR_FIXED_ARRAY(count) ((byte_t)(((byte_t)CARDANO_CBOR_MAJOR_TYPE_ARRAY << 5) | (byte_t)(count)))
+
+/**
+ * \brief Initial byte of a definite-length map of fewer than 24 pairs.
+ */
+#define CARDANO_CBOR_FIXED_MAP(count) ((byte_t)(((byte_t)CARDANO_CBOR_MAJOR_TYPE_MAP << 5) | (byte_t)(count)))
+
+/**
+ * \brief Header of a byte string of 24 to 255 bytes, such as a 32-byte hash or key or a 64-byte signature.
+ */
+#define CARDANO_CBOR_FIXED_BYTESTRING_8BIT(size)                                                     \
+  (byte_t)(((byte_t)CARDANO_CBOR_MAJOR_TYPE_BYTE_STRING << 5) | CARDANO_CBOR_ADDITIONAL_INFO_8BIT_DATA), \
+  (byte_t)(size)
+
+/**
+ * \brief The largest encoding of a header: the initial byte and a 64-bit argument.
+ */
+#define CARDANO_CBOR_FIXED_MAX_HEADER_SIZE 9U
+
+/* INLINE FUNCTIONS **********************************************************/
+
+/**
+ * \brief Writes the shortest header of a major type and argument, as the generic writer does.
+ *
+ * \param[out] dest Where to write the header; must have room for \ref CARDANO_CBOR_FIXED_MAX_HEADER_SIZE bytes.
+ * \param[in] major_type The major type of the item.
+ * \param[in] value The argument: an integer value, or the length of a string.
+ *
+ * \return The number of bytes written.
+ */
+static inline size_t
+cardano_cbor_fixed_put_header(byte_t* dest, const cardano_cbor_major_type_t major_type, const uint64_t value)
+{
+  const byte_t type = (byte_t)((byte_t)major_type << 5);
+
+  if (value < 24U)
+  {
+    dest[0] = type | (byte_t)value;
+    return 1U;
+  }
+
+  size_t arg_size = 8U;
+  byte_t info     = (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_64BIT_DATA;
+
+  if (value < 256U)
+  {
+    arg_size = 1U;
+    info     = (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_8BIT_DATA;
+  }
+  else if (value < 65536U)
+  {
+    arg_size = 2U;
+    info     = (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_16BIT_DATA;
+  }
+  else if (value < 4294967296U)
+  {
+    arg_size = 4U;
+    info     = (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_32BIT_DATA;
+  }
+
+  dest[0] = type | info;
+
+  for (size_t i = 0U; i < arg_size; ++i)
+  {
+    dest[arg_size - i] = (byte_t)(value >> (8U * i));
+  }
+
+  return arg_size + 1U;
+}
+
+/**
+ * \brief Writes an unsigned integer.
+ *
+ * \param[out] dest Where to write; must have room for \ref CARDANO_CBOR_FIXED_MAX_HEADER_SIZE bytes.
+ * \param[in] value The value to write.
+ *
+ * \return The number of bytes written.
+ */
+static inline size_t
+cardano_cbor_fixed_put_uint(byte_t* dest, const uint64_t value)
+{
+  return cardano_cbor_fixed_put_header(dest, CARDANO_CBOR_MAJOR_TYPE_UNSIGNED_INTEGER, value);
+}
+
+/**
+ * \brief Writes a byte string: its header, then the bytes.
+ *
+ * \param[out] dest Where to write; must have room for `size` plus \ref CARDANO_CBOR_FIXED_MAX_HEADER_SIZE bytes.
+ * \param[in] data The bytes of the string.
+ * \param[in] size The number of bytes.
+ *
+ * \return The number of bytes written.
+ */
+static inline size_t
+cardano_cbor_fixed_put_bytestring(byte_t* dest, const byte_t* data, const size_t size)
+{
+  const size_t header_size = cardano_cbor_fixed_put_header(dest, CARDANO_CBOR_MAJOR_TYPE_BYTE_STRING, size);
+
+  if (size > 0U)
+  {
+    (void)memcpy(&dest[header_size], data, size);
+  }
+
+  return header_size + size;
+}
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_CBOR_FIXED_H
@@ -30,6 +30,7 @@
 
 #include "../../allocators.h"
 #include "../../collections/array.h"
+#include "../cbor_scan.h"
 #include "cbor_reader_collections.h"
 #include "cbor_reader_core.h"
 #include "cbor_reader_numeric.h"
@@ -37,8 +38,46 @@
 #include "cbor_reader_tags.h"
 
 #include <assert.h>
+#include <stdbool.h>
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+static const byte_t CBOR_BREAK_BYTE = 0xFFU;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief One segment of a path given to \ref cardano_cbor_reader_seek.
+ */
+typedef struct path_segment_t
+{
+    /**
+     * \brief Whether the segment is a text map key rather than a number.
+     */
+    bool is_text;
+
+    /**
+     * \brief The text of the segment, when it is a text map key.
+     */
+    const char* text;
+
+    /**
+     * \brief The size in bytes of the text.
+     */
+    size_t text_size;
+
+    /**
+     * \brief Whether the number is negative.
+     */
+    bool is_negative;
+
+    /**
+     * \brief The absolute value of the number, when the segment is a number.
+     */
+    uint64_t value;
+} path_segment_t;
+
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
@@ -128,7 +167,7 @@ clone_nested_items(cardano_array_t* src, cardano_array_t** clone)
 
     cloned_frame->base.ref_count     = 0;
     cloned_frame->base.deallocator   = _cardano_free;
-    cloned_frame->base.last_error[0] = '\0';
+    cloned_frame->base.last_error    = NULL;
     cloned_frame->type               = frame->type;
     cloned_frame->frame_offset       = frame->frame_offset;
     cloned_frame->definite_length    = frame->definite_length;
@@ -151,6 +190,322 @@ clone_nested_items(cardano_array_t* src, cardano_array_t** clone)
   return CARDANO_SUCCESS;
 }
 
+/**
+ * \brief Skips the next data item with the header scan, which jumps over strings by their length and containers by
+ * counting, without allocating.
+ *
+ * Items the scan rejects, and the positions that are not the start of a data item (end of a container or of the
+ * input), are handed to the reader's own state machine, which reports the error in its usual terms.
+ *
+ * \param reader The reader to advance.
+ * \param start On success, the offset of the first byte of the skipped item.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the decoding error.
+ */
+static cardano_error_t
+skip_data_item(cardano_cbor_reader_t* reader, size_t* start)
+{
+  cardano_cbor_reader_state_t state  = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  cardano_error_t             result = _cbor_reader_peek_state(reader, &state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  *start = reader->offset;
+
+  switch (state)
+  {
+    case CARDANO_CBOR_READER_STATE_UNDEFINED:
+    case CARDANO_CBOR_READER_STATE_END_INDEFINITE_LENGTH_BYTESTRING:
+    case CARDANO_CBOR_READER_STATE_END_INDEFINITE_LENGTH_TEXTSTRING:
+    case CARDANO_CBOR_READER_STATE_END_ARRAY:
+    case CARDANO_CBOR_READER_STATE_END_MAP:
+    case CARDANO_CBOR_READER_STATE_FINISHED:
+      break;
+    default:
+    {
+      size_t end = 0U;
+
+      if (cardano_cbor_scan_data_item(reader->data, reader->size, reader->offset, 0U, &end, NULL) == CARDANO_SUCCESS)
+      {
+        reader->offset       = end;
+        reader->cached_state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+        _cbor_reader_advance_data_item_counters(reader);
+
+        return CARDANO_SUCCESS;
+      }
+
+      break;
+    }
+  }
+
+  size_t depth = 0;
+
+  do
+  {
+    result = _cbor_reader_skip_next_node(reader, &depth);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+  while (depth > 0U);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Reads the next segment of a path.
+ *
+ * Segments are separated by dots, and a segment in brackets may follow another one without a dot, as in `1[3].1`.
+ * A segment made of decimal digits, optionally preceded by a minus sign, is a number; anything else is a text key.
+ *
+ * \param path The path.
+ * \param path_size The size of the path in bytes.
+ * \param offset The offset of the segment; advanced past it and its separator.
+ * \param segment On success, the segment read.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_INVALID_ARGUMENT if the segment is empty, a bracket
+ *         is not closed or holds something other than a number, or a number does not fit in 64 bits.
+ */
+static cardano_error_t
+read_path_segment(const char* path, const size_t path_size, size_t* offset, path_segment_t* segment)
+{
+  size_t     begin     = *offset;
+  const bool bracketed = (path[begin] == '[');
+
+  if (bracketed)
+  {
+    ++begin;
+  }
+
+  size_t end = begin;
+
+  while ((end < path_size) && (path[end] != '.') && (path[end] != '[') && (path[end] != ']'))
+  {
+    ++end;
+  }
+
+  if (end == begin)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  size_t next = end;
+
+  if (bracketed)
+  {
+    if ((end >= path_size) || (path[end] != ']'))
+    {
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+
+    ++next;
+  }
+  else if ((end < path_size) && (path[end] == ']'))
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  if ((next < path_size) && (path[next] == '.'))
+  {
+    ++next;
+
+    if (next == path_size)
+    {
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+  }
+
+  segment->is_text     = false;
+  segment->text        = &path[begin];
+  segment->text_size   = end - begin;
+  segment->is_negative = (path[begin] == '-');
+  segment->value       = 0U;
+
+  const size_t digits = segment->is_negative ? (begin + 1U) : begin;
+
+  for (size_t i = digits; i < end; ++i)
+  {
+    const char c = path[i];
+
+    if ((c < '0') || (c > '9'))
+    {
+      segment->is_text = true;
+      break;
+    }
+
+    const uint64_t digit = (uint64_t)(c - '0');
+
+    if (segment->value > ((UINT64_MAX - digit) / 10U))
+    {
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+
+    segment->value = (segment->value * 10U) + digit;
+  }
+
+  if (digits == end)
+  {
+    segment->is_text = true;
+  }
+
+  if (segment->is_text && bracketed)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  // A negative key -1 - n is encoded with the argument n.
+  if (!segment->is_text && segment->is_negative)
+  {
+    if (segment->value == 0U)
+    {
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+
+    segment->value -= 1U;
+  }
+
+  *offset = next;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Checks whether the map key at an offset matches a path segment.
+ *
+ * \param data The bytes being read.
+ * \param size The size of the bytes being read.
+ * \param offset The offset of the key.
+ * \param segment The segment to match.
+ *
+ * \return true if the key is the integer or the definite-length text string of the segment.
+ */
+static bool
+key_matches(const byte_t* data, const size_t size, const size_t offset, const path_segment_t* segment)
+{
+  byte_t   major_type = 0U;
+  uint64_t argument   = 0U;
+  bool     indefinite = false;
+  size_t   end        = 0U;
+
+  if ((cardano_cbor_scan_header(data, size, offset, &major_type, &argument, &indefinite, &end) != CARDANO_SUCCESS) || indefinite)
+  {
+    return false;
+  }
+
+  if (segment->is_text)
+  {
+    return (major_type == (byte_t)CARDANO_CBOR_MAJOR_TYPE_UTF8_STRING) && (argument == segment->text_size)
+      && (argument <= (size - end)) && (memcmp(&data[end], segment->text, segment->text_size) == 0);
+  }
+
+  const byte_t expected = segment->is_negative ? (byte_t)CARDANO_CBOR_MAJOR_TYPE_NEGATIVE_INTEGER : (byte_t)CARDANO_CBOR_MAJOR_TYPE_UNSIGNED_INTEGER;
+
+  return (major_type == expected) && (argument == segment->value);
+}
+
+/**
+ * \brief Moves from an array or a map to one of its elements, without decoding anything.
+ *
+ * Tags in front of the container are skipped. A number selects an array element by index; in a map, the segment
+ * selects the value whose key is that integer or text string.
+ *
+ * \param reader The reader being searched, for the error messages.
+ * \param segment The segment to follow.
+ * \param offset The offset of the container; on success, the offset of the selected element.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if there is no such element, or
+ *         \ref CARDANO_ERROR_DECODING if the data is malformed.
+ */
+static cardano_error_t
+seek_segment(cardano_cbor_reader_t* reader, const path_segment_t* segment, size_t* offset)
+{
+  const byte_t* data       = reader->data;
+  const size_t  size       = reader->size;
+  byte_t        major_type = 0U;
+  uint64_t      argument   = 0U;
+  bool          indefinite = false;
+  size_t        position   = *offset;
+
+  do
+  {
+    if (cardano_cbor_scan_header(data, size, position, &major_type, &argument, &indefinite, &position) != CARDANO_SUCCESS)
+    {
+      cardano_cbor_reader_set_last_error(reader, "Invalid CBOR data item header.");
+      return CARDANO_ERROR_DECODING;
+    }
+  }
+  while (major_type == (byte_t)CARDANO_CBOR_MAJOR_TYPE_TAG);
+
+  const bool is_array = (major_type == (byte_t)CARDANO_CBOR_MAJOR_TYPE_ARRAY);
+
+  if (!is_array && (major_type != (byte_t)CARDANO_CBOR_MAJOR_TYPE_MAP))
+  {
+    cardano_cbor_reader_set_last_error(reader, "Path goes through a data item that is neither an array nor a map.");
+    return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  }
+
+  if (is_array && (segment->is_text || segment->is_negative))
+  {
+    cardano_cbor_reader_set_last_error(reader, "Arrays can only be indexed by non-negative numbers.");
+    return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  }
+
+  for (uint64_t i = 0U; indefinite || (i < argument); ++i)
+  {
+    if (position >= size)
+    {
+      cardano_cbor_reader_set_last_error(reader, "Unexpected end of buffer.");
+      return CARDANO_ERROR_DECODING;
+    }
+
+    if (indefinite && (data[position] == CBOR_BREAK_BYTE))
+    {
+      break;
+    }
+
+    if (is_array && (i == segment->value))
+    {
+      *offset = position;
+      return CARDANO_SUCCESS;
+    }
+
+    size_t end = 0U;
+
+    if (cardano_cbor_scan_data_item(data, size, position, 0U, &end, NULL) != CARDANO_SUCCESS)
+    {
+      cardano_cbor_reader_set_last_error(reader, "Invalid CBOR data item.");
+      return CARDANO_ERROR_DECODING;
+    }
+
+    if (is_array)
+    {
+      position = end;
+      continue;
+    }
+
+    if (key_matches(data, size, position, segment))
+    {
+      *offset = end;
+      return CARDANO_SUCCESS;
+    }
+
+    if (cardano_cbor_scan_data_item(data, size, end, 0U, &position, NULL) != CARDANO_SUCCESS)
+    {
+      cardano_cbor_reader_set_last_error(reader, "Invalid CBOR data item.");
+      return CARDANO_ERROR_DECODING;
+    }
+  }
+
+  cardano_cbor_reader_set_last_error(reader, "Path element not found.");
+
+  return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+}
+
 /* DECLARATIONS **************************************************************/
 
 cardano_cbor_reader_t*
@@ -175,8 +530,10 @@ cardano_cbor_reader_new(const byte_t* cbor_data, const size_t size)
 
   obj->base.ref_count     = 1;
   obj->base.deallocator   = cardano_cbor_reader_deallocate;
-  obj->base.last_error[0] = '\0';
+  obj->base.last_error    = NULL;
   obj->buffer             = cardano_buffer_new_from(cbor_data, size);
+  obj->data               = cardano_buffer_get_data(obj->buffer);
+  obj->size               = cardano_buffer_get_size(obj->buffer);
 
   obj->offset                           = 0;
   obj->nested_items                     = cardano_array_new(32);
@@ -222,8 +579,10 @@ cardano_cbor_reader_from_hex(const char* hex_string, const size_t size)
 
   obj->base.ref_count     = 1;
   obj->base.deallocator   = cardano_cbor_reader_deallocate;
-  obj->base.last_error[0] = '\0';
+  obj->base.last_error    = NULL;
   obj->buffer             = cardano_buffer_from_hex(hex_string, size);
+  obj->data               = cardano_buffer_get_data(obj->buffer);
+  obj->size               = cardano_buffer_get_size(obj->buffer);
 
   obj->offset                           = 0;
   obj->nested_items                     = cardano_array_new(32);
@@ -247,6 +606,53 @@ cardano_cbor_reader_from_hex(const char* hex_string, const size_t size)
   return obj;
 }
 
+cardano_cbor_reader_t*
+cardano_cbor_reader_from_view(const byte_t* cbor_data, const size_t size)
+{
+  if (cbor_data == NULL)
+  {
+    return NULL;
+  }
+
+  if (size == 0U)
+  {
+    return NULL;
+  }
+
+  cardano_cbor_reader_t* obj = (cardano_cbor_reader_t*)_cardano_malloc(sizeof(cardano_cbor_reader_t));
+
+  if (obj == NULL)
+  {
+    return NULL;
+  }
+
+  obj->base.ref_count     = 1;
+  obj->base.deallocator   = cardano_cbor_reader_deallocate;
+  obj->base.last_error    = NULL;
+  obj->buffer             = NULL;
+  obj->data               = cbor_data;
+  obj->size               = size;
+
+  obj->offset                           = 0;
+  obj->nested_items                     = cardano_array_new(32);
+  obj->is_tag_context                   = false;
+  obj->cached_state                     = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  obj->current_frame.type               = CARDANO_CBOR_MAJOR_TYPE_UNDEFINED;
+  obj->current_frame.current_key_offset = -1;
+  obj->current_frame.frame_offset       = 0;
+  obj->current_frame.items_read         = 0;
+  obj->current_frame.definite_length    = -1;
+
+  if (obj->nested_items == NULL)
+  {
+    _cardano_free(obj);
+
+    return NULL;
+  }
+
+  return obj;
+}
+
 void
 cardano_cbor_reader_unref(cardano_cbor_reader_t** cbor_reader)
 {
@@ -306,7 +712,7 @@ cardano_cbor_reader_get_bytes_remaining(cardano_cbor_reader_t* reader, size_t* b
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  *bytes_remaining = cardano_buffer_get_size(reader->buffer) - reader->offset;
+  *bytes_remaining = reader->size - reader->offset;
 
   return CARDANO_SUCCESS;
 }
@@ -324,7 +730,7 @@ cardano_cbor_reader_get_remainder_bytes(cardano_cbor_reader_t* reader, cardano_b
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_buffer_t* slice = cardano_buffer_slice(reader->buffer, reader->offset, cardano_buffer_get_size(reader->buffer));
+  cardano_buffer_t* slice = _cbor_reader_copy_range(reader, reader->offset, reader->size);
 
   if (slice == NULL)
   {
@@ -349,12 +755,11 @@ cardano_cbor_reader_clone(cardano_cbor_reader_t* reader, cardano_cbor_reader_t**
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_buffer_t* buffer = cardano_buffer_new_from(cardano_buffer_get_data(reader->buffer), cardano_buffer_get_size(reader->buffer));
+  // A view reader clones into another view of the same memory; an owning reader shares its copy, which no reader
+  // ever modifies.
+  cardano_buffer_t* buffer = reader->buffer;
 
-  if (buffer == NULL)
-  {
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
+  cardano_buffer_ref(buffer);
 
   cardano_cbor_reader_t* obj = (cardano_cbor_reader_t*)_cardano_malloc(sizeof(cardano_cbor_reader_t));
 
@@ -366,7 +771,7 @@ cardano_cbor_reader_clone(cardano_cbor_reader_t* reader, cardano_cbor_reader_t**
 
   obj->base.ref_count     = 1;
   obj->base.deallocator   = cardano_cbor_reader_deallocate;
-  obj->base.last_error[0] = '\0';
+  obj->base.last_error    = NULL;
 
   if (clone_nested_items(reader->nested_items, &obj->nested_items) != CARDANO_SUCCESS)
   {
@@ -377,6 +782,8 @@ cardano_cbor_reader_clone(cardano_cbor_reader_t* reader, cardano_cbor_reader_t**
   }
 
   obj->buffer                           = buffer;
+  obj->data                             = (buffer != NULL) ? cardano_buffer_get_data(buffer) : reader->data;
+  obj->size                             = reader->size;
   obj->offset                           = reader->offset;
   obj->is_tag_context                   = reader->is_tag_context;
   obj->cached_state                     = reader->cached_state;
@@ -396,47 +803,148 @@ cardano_cbor_reader_clone(cardano_cbor_reader_t* reader, cardano_cbor_reader_t**
 cardano_error_t
 cardano_cbor_reader_skip_value(cardano_cbor_reader_t* reader)
 {
-  cardano_buffer_t* encoded_value = NULL;
-  cardano_error_t   result        = cardano_cbor_reader_read_encoded_value(reader, &encoded_value);
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  size_t start = 0U;
+
+  return skip_data_item(reader, &start);
+}
+
+cardano_error_t
+cardano_cbor_reader_read_encoded_value(cardano_cbor_reader_t* reader, cardano_buffer_t** encoded_value)
+{
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (encoded_value == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const byte_t*   data   = NULL;
+  size_t          size   = 0U;
+  cardano_error_t result = cardano_cbor_reader_read_encoded_value_view(reader, &data, &size);
 
   if (result != CARDANO_SUCCESS)
   {
     return result;
   }
 
-  cardano_buffer_unref(&encoded_value);
+  *encoded_value = _cbor_reader_copy_range(reader, reader->offset - size, reader->offset);
 
   return CARDANO_SUCCESS;
 }
 
 cardano_error_t
-cardano_cbor_reader_read_encoded_value(cardano_cbor_reader_t* reader, cardano_buffer_t** encoded_value)
+cardano_cbor_reader_read_encoded_value_view(cardano_cbor_reader_t* reader, const byte_t** data, size_t* size)
 {
   if (reader == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  if (encoded_value == NULL)
+  if ((data == NULL) || (size == NULL))
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  size_t initial_offset = reader->offset;
-  size_t depth          = 0;
+  size_t                initial_offset = 0U;
+  const cardano_error_t result         = skip_data_item(reader, &initial_offset);
 
-  do
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  *data = &reader->data[initial_offset];
+  *size = reader->offset - initial_offset;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_cbor_reader_seek(
+  cardano_cbor_reader_t*  reader,
+  const char*             path,
+  const size_t            path_size,
+  cardano_cbor_reader_t** field)
+{
+  if ((reader == NULL) || (field == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((path == NULL) && (path_size > 0U))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *field = NULL;
+
+  cardano_cbor_reader_state_t state  = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  cardano_error_t             result = _cbor_reader_peek_state(reader, &state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  switch (state)
+  {
+    case CARDANO_CBOR_READER_STATE_UNDEFINED:
+    case CARDANO_CBOR_READER_STATE_END_INDEFINITE_LENGTH_BYTESTRING:
+    case CARDANO_CBOR_READER_STATE_END_INDEFINITE_LENGTH_TEXTSTRING:
+    case CARDANO_CBOR_READER_STATE_END_ARRAY:
+    case CARDANO_CBOR_READER_STATE_END_MAP:
+    case CARDANO_CBOR_READER_STATE_FINISHED:
+      cardano_cbor_reader_set_last_error(reader, "The reader is not positioned at a data item.");
+      return CARDANO_ERROR_DECODING;
+    default:
+      break;
+  }
+
+  size_t offset      = reader->offset;
+  size_t path_offset = 0U;
+
+  while (path_offset < path_size)
   {
-    cardano_error_t result = _cbor_reader_skip_next_node(reader, &depth);
+    path_segment_t segment = { 0 };
+
+    result = read_path_segment(path, path_size, &path_offset, &segment);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_cbor_reader_set_last_error(reader, "Invalid path.");
+      return result;
+    }
+
+    result = seek_segment(reader, &segment, &offset);
 
     if (result != CARDANO_SUCCESS)
     {
       return result;
     }
   }
-  while (depth > 0U);
 
-  *encoded_value = cardano_buffer_slice(reader->buffer, initial_offset, reader->offset);
+  size_t end = 0U;
+
+  if (cardano_cbor_scan_data_item(reader->data, reader->size, offset, 0U, &end, NULL) != CARDANO_SUCCESS)
+  {
+    cardano_cbor_reader_set_last_error(reader, "Invalid CBOR data item.");
+    return CARDANO_ERROR_DECODING;
+  }
+
+  *field = cardano_cbor_reader_from_view(&reader->data[offset], end - offset);
+
+  if (*field == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
 
   return CARDANO_SUCCESS;
 }
@@ -519,6 +1027,37 @@ cardano_cbor_reader_read_textstring(cardano_cbor_reader_t* reader, cardano_buffe
   return _cbor_reader_read_string(reader, CARDANO_CBOR_MAJOR_TYPE_UTF8_STRING, text_string);
 }
 
+cardano_error_t
+cardano_cbor_reader_read_bytestring_view(cardano_cbor_reader_t* reader, const byte_t** data, size_t* size)
+{
+  if ((reader == NULL) || (data == NULL) || (size == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return _cbor_reader_read_string_view(reader, CARDANO_CBOR_MAJOR_TYPE_BYTE_STRING, data, size);
+}
+
+cardano_error_t
+cardano_cbor_reader_read_textstring_view(cardano_cbor_reader_t* reader, const char** data, size_t* size)
+{
+  if ((reader == NULL) || (data == NULL) || (size == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const byte_t* bytes = NULL;
+
+  cardano_error_t result = _cbor_reader_read_string_view(reader, CARDANO_CBOR_MAJOR_TYPE_UTF8_STRING, &bytes, size);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    *data = (const char*)((const void*)bytes);
+  }
+
+  return result;
+}
+
 cardano_error_t
 cardano_cbor_reader_read_tag(cardano_cbor_reader_t* reader, cardano_cbor_tag_t* tag)
 {
@@ -75,13 +75,14 @@ validate_next_break_byte(cardano_cbor_reader_t* reader)
 }
 
 /**
- * \brief Peeks at the length of the next definite length CBOR data item, without advancing the buffer's read position.
+ * \brief Peeks at the length of the next definite length CBOR data item, without advancing the reader.
  *
- * This function examines a buffer containing CBOR encoded data to determine the length of the next data item, assuming
- * it has a definite length. The function does not consume the data; it merely calculates the length based on the
+ * This function examines CBOR encoded data to determine the length of the next data item, assuming it has a
+ * definite length. The function does not consume the data; it merely calculates the length based on the
  * initial byte and any additional bytes that encode the length.
  *
- * \param[in]  buffer        A pointer to an initialized cardano_buffer_t structure containing the CBOR data to be examined.
+ * \param[in]  data          A pointer to the CBOR data to be examined, starting at the initial byte of the data item.
+ * \param[in]  size          The number of bytes available at `data`.
  * \param[in]  initial_byte  The initial byte of the CBOR data item, which includes the major type and additional information
  *                           that may encode the item's length.
  * \param[out] length        A pointer to an int64_t variable where the determined length of the data item will be stored.
@@ -94,16 +95,16 @@ validate_next_break_byte(cardano_cbor_reader_t* reader)
  * indicate the reason for failure.
  */
 static cardano_error_t
-peek_definite_length(cardano_buffer_t* buffer, const byte_t initial_byte, int64_t* length, size_t* bytes_read)
+peek_definite_length(const byte_t* data, const size_t size, const byte_t initial_byte, int64_t* length, size_t* bytes_read)
 {
-  assert(buffer != NULL);
+  assert(data != NULL);
   assert(length != NULL);
   assert(bytes_read != NULL);
 
   uint64_t definite_length = 0;
   size_t   read            = 0;
 
-  cardano_error_t result = _cbor_reader_decode_unsigned_integer(buffer, initial_byte, &definite_length, &read);
+  cardano_error_t result = _cbor_reader_decode_unsigned_integer(data, size, initial_byte, &definite_length, &read);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -131,7 +132,7 @@ _cbor_reader_read_start_indefinite_length_string(cardano_cbor_reader_t* reader,
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  const size_t remaining_bytes = cardano_buffer_get_size(reader->buffer);
+  const size_t remaining_bytes = reader->size;
 
   if ((remaining_bytes - reader->offset) < HEADER_BYTE_SIZE)
   {
@@ -206,86 +207,60 @@ _cbor_reader_read_indefinite_length_concatenated(cardano_cbor_reader_t* reader,
   assert(buffer != NULL);
   assert(encoding_length != NULL);
 
-  cardano_buffer_t* data   = NULL;
-  cardano_error_t   result = cardano_cbor_reader_get_remainder_bytes(reader, &data);
-
-  if (result != CARDANO_SUCCESS)
-  {
-    cardano_buffer_unref(&data);
-    return result;
-  }
+  const byte_t* data = &reader->data[reader->offset];
+  const size_t  size = reader->size - reader->offset;
 
   cardano_buffer_t* concat = cardano_buffer_new(INITIAL_CONCAT_BUFFER_CAPACITY);
 
-  size_t       i    = HEADER_BYTE_SIZE;
-  const size_t size = cardano_buffer_get_size(data);
+  size_t i = HEADER_BYTE_SIZE;
 
   if ((concat == NULL) || (size <= HEADER_BYTE_SIZE))
   {
-    cardano_buffer_unref(&data);
     cardano_buffer_unref(&concat);
 
     return CARDANO_ERROR_DECODING;
   }
 
-  byte_t initial_byte = cardano_buffer_get_data(data)[i];
+  byte_t initial_byte = data[i];
 
   while (initial_byte != CBOR_INITIAL_BYTE_INDEFINITE_LENGTH_BREAK)
   {
     int64_t chunk_length = 0;
     size_t  bytes_read   = 0;
 
-    cardano_buffer_t* slice = cardano_buffer_slice(data, i, cardano_buffer_get_size(data));
-
-    if ((slice == NULL) || (cardano_buffer_get_size(slice) == 0U))
-    {
-      cardano_buffer_unref(&data);
-      cardano_buffer_unref(&concat);
-
-      return CARDANO_ERROR_DECODING;
-    }
-
-    cardano_error_t peek_definite_length_result = peek_definite_length(slice, initial_byte, &chunk_length, &bytes_read);
-
-    cardano_buffer_unref(&slice);
+    cardano_error_t peek_definite_length_result = peek_definite_length(&data[i], size - i, initial_byte, &chunk_length, &bytes_read);
 
     if (peek_definite_length_result != CARDANO_SUCCESS)
     {
-      cardano_buffer_unref(&data);
       cardano_buffer_unref(&concat);
 
       return peek_definite_length_result;
     }
 
-    size_t payload_size = bytes_read + (size_t)chunk_length;
-
-    cardano_buffer_t* chunk = cardano_buffer_slice(data, i + (payload_size - (size_t)chunk_length), i + payload_size);
-
-    if (chunk != NULL)
+    // The chunk, and at least the break byte after it, must fit in what is left.
+    if ((uint64_t)chunk_length >= (uint64_t)(size - i - bytes_read))
     {
-      cardano_buffer_t* tmp = concat;
-      concat                = cardano_buffer_concat(tmp, chunk);
+      cardano_buffer_unref(&concat);
 
-      cardano_buffer_unref(&chunk);
-      cardano_buffer_unref(&tmp);
+      return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
     }
 
-    i += payload_size;
+    cardano_error_t write_result = cardano_buffer_write(concat, &data[i + bytes_read], (size_t)chunk_length);
 
-    if (i >= size)
+    if (write_result != CARDANO_SUCCESS)
     {
-      cardano_buffer_unref(&data);
       cardano_buffer_unref(&concat);
 
-      return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
+      return write_result;
     }
 
-    initial_byte = cardano_buffer_get_data(data)[i];
+    i += bytes_read + (size_t)chunk_length;
+
+    initial_byte = data[i];
   }
 
   *buffer = concat;
 
-  cardano_buffer_unref(&data);
   *encoding_length = i + HEADER_BYTE_SIZE;
 
   return CARDANO_SUCCESS;
@@ -324,26 +299,15 @@ _cbor_reader_read_start_array(cardano_cbor_reader_t* reader, int64_t* size)
   int64_t length     = 0;
   size_t  bytes_read = 0;
 
-  cardano_buffer_t* remaining_bytes  = NULL;
-  cardano_error_t   get_bytes_result = cardano_cbor_reader_get_remainder_bytes(reader, &remaining_bytes);
-
-  if (get_bytes_result != CARDANO_SUCCESS)
-  {
-    return get_bytes_result;
-  }
-
-  result = peek_definite_length(remaining_bytes, header, &length, &bytes_read);
+  result = peek_definite_length(&reader->data[reader->offset], reader->size - reader->offset, header, &length, &bytes_read);
 
   if (result != CARDANO_SUCCESS)
   {
     cardano_cbor_reader_set_last_error(reader, "Failed to read length of definite array");
-    cardano_buffer_unref(&remaining_bytes);
 
     return result;
   }
 
-  cardano_buffer_unref(&remaining_bytes);
-
   cardano_error_t advance_result = _cbor_reader_advance_buffer(reader, bytes_read);
 
   assert(advance_result == CARDANO_SUCCESS);
@@ -435,25 +399,14 @@ _cbor_reader_read_start_map(cardano_cbor_reader_t* reader, int64_t* size)
   int64_t length     = 0;
   size_t  bytes_read = 0;
 
-  cardano_buffer_t* remaining_bytes  = NULL;
-  cardano_error_t   get_bytes_result = cardano_cbor_reader_get_remainder_bytes(reader, &remaining_bytes);
-
-  if (get_bytes_result != CARDANO_SUCCESS)
-  {
-    return get_bytes_result;
-  }
-
-  result = peek_definite_length(remaining_bytes, header, &length, &bytes_read);
+  result = peek_definite_length(&reader->data[reader->offset], reader->size - reader->offset, header, &length, &bytes_read);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_buffer_unref(&remaining_bytes);
     return result;
   }
 
-  cardano_buffer_unref(&remaining_bytes);
-
-  if ((KEY_VALUE_PAIR_SIZE * (size_t)length) > (cardano_buffer_get_size(reader->buffer) - reader->offset))
+  if ((KEY_VALUE_PAIR_SIZE * (size_t)length) > (reader->size - reader->offset))
   {
     cardano_cbor_reader_set_last_error(reader, "Definite length exceeds buffer size");
 
@@ -557,38 +510,64 @@ _cbor_reader_read_string(cardano_cbor_reader_t* reader, const cardano_cbor_major
     return CARDANO_SUCCESS;
   }
 
-  cardano_buffer_t* buffer                 = NULL;
-  cardano_error_t   remainder_bytes_result = cardano_cbor_reader_get_remainder_bytes(reader, &buffer);
+  const byte_t* data = NULL;
+  size_t        size = 0U;
+
+  result = _cbor_reader_read_string_view(reader, type, &data, &size);
 
-  if (remainder_bytes_result != CARDANO_SUCCESS)
+  if (result != CARDANO_SUCCESS)
   {
-    return remainder_bytes_result;
+    return result;
+  }
+
+  const size_t start = (size_t)(data - reader->data);
+
+  *byte_string = _cbor_reader_copy_range(reader, start, start + size);
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+_cbor_reader_read_string_view(cardano_cbor_reader_t* reader, const cardano_cbor_major_type_t type, const byte_t** data, size_t* size)
+{
+  byte_t          header = 0;
+  cardano_error_t result = _cbor_reader_peek_initial_byte(reader, type, &header);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (cardano_cbor_initial_byte_get_additional_info(header) == CARDANO_CBOR_ADDITIONAL_INFO_INDEFINITE_LENGTH)
+  {
+    cardano_object_set_last_error(&reader->base, "Indefinite length strings are not contiguous and cannot be read as a view.");
+    return CARDANO_ERROR_DECODING;
   }
 
   int64_t length = 0;
 
   size_t bytes_read = 0;
 
-  result = peek_definite_length(buffer, header, &length, &bytes_read);
+  result = peek_definite_length(&reader->data[reader->offset], reader->size - reader->offset, header, &length, &bytes_read);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_buffer_unref(&buffer);
     return result;
   }
 
+  const byte_t* start = &reader->data[reader->offset + bytes_read];
+
   cardano_error_t advance_result = _cbor_reader_advance_buffer(reader, bytes_read + (size_t)length);
 
   if (advance_result != CARDANO_SUCCESS)
   {
-    cardano_buffer_unref(&buffer);
     return advance_result;
   }
 
   _cbor_reader_advance_data_item_counters(reader);
 
-  *byte_string = cardano_buffer_slice(buffer, bytes_read, bytes_read + (size_t)length);
-  cardano_buffer_unref(&buffer);
+  *data = start;
+  *size = (size_t)length;
 
   return CARDANO_SUCCESS;
 }
@@ -183,4 +183,20 @@ _cbor_reader_read_end_map(cardano_cbor_reader_t* reader);
 cardano_error_t
 _cbor_reader_read_string(cardano_cbor_reader_t* reader, cardano_cbor_major_type_t type, cardano_buffer_t** byte_string);
 
+/**
+ * \brief Reads a definite length string (byte or text) from the CBOR stream without copying it.
+ *
+ * \param[in] reader A pointer to the cardano_cbor_reader_t structure that represents the CBOR stream
+ *                   from which the string is to be read.
+ * \param[in] type The major type of the string to be read. This must be either CARDANO_CBOR_MAJOR_TYPE_BYTE_STRING (2)
+ *                 for byte strings or CARDANO_CBOR_MAJOR_TYPE_UTF8_STRING (3) for text strings.
+ * \param[out] data On success, a pointer to the first byte of the string inside the data being read.
+ * \param[out] size On success, the length of the string in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS if the string was read. Indefinite length strings are split into chunks and have no
+ * single contiguous representation, so they fail with \ref CARDANO_ERROR_DECODING without advancing the reader.
+ */
+cardano_error_t
+_cbor_reader_read_string_view(cardano_cbor_reader_t* reader, cardano_cbor_major_type_t type, const byte_t** data, size_t* size);
+
 #endif // BIGLUP_LABS_INCLUDE_CARDANO_CBOR_READER_INTERNAL_COLLECTIONS_H
\ No newline at end of file
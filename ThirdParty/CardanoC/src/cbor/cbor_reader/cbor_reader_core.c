@@ -253,7 +253,7 @@ map_major_type_to_reader_state(cardano_cbor_reader_t* reader, cardano_cbor_reade
   assert(reader != NULL);
   assert(state != NULL);
 
-  byte_t*                              buffer_data     = cardano_buffer_get_data(reader->buffer);
+  const byte_t*                        buffer_data     = reader->data;
   const byte_t                         initial_byte    = buffer_data[reader->offset];
   const cardano_cbor_additional_info_t additional_info = cardano_cbor_initial_byte_get_additional_info(initial_byte);
   const cardano_cbor_major_type_t      major_type      = cardano_cbor_initial_byte_get_major_type(initial_byte);
@@ -347,8 +347,8 @@ peek_state_core(cardano_cbor_reader_t* reader, cardano_cbor_reader_state_t* stat
   assert(reader != NULL);
   assert(state != NULL);
 
-  const size_t buffer_size = cardano_buffer_get_size(reader->buffer);
-  byte_t*      buffer_data = cardano_buffer_get_data(reader->buffer);
+  const size_t  buffer_size = reader->size;
+  const byte_t* buffer_data = reader->data;
 
   if ((reader->current_frame.definite_length != INDEFINITE_LENGTH) && ((reader->current_frame.definite_length - (int64_t)reader->current_frame.items_read) == 0))
   {
@@ -405,7 +405,7 @@ _cbor_reader_push_data_item(cardano_cbor_reader_t* reader, const cardano_cbor_ma
 
   frame->base.ref_count     = 0;
   frame->base.deallocator   = _cardano_free;
-  frame->base.last_error[0] = '\0';
+  frame->base.last_error    = NULL;
 
   frame->type               = reader->current_frame.type;
   frame->frame_offset       = reader->current_frame.frame_offset;
@@ -491,7 +491,7 @@ _cbor_reader_peek_initial_byte(cardano_cbor_reader_t* reader, const cardano_cbor
   assert(reader != NULL);
   assert(initial_byte != NULL);
 
-  const size_t buffer_size = cardano_buffer_get_size(reader->buffer);
+  const size_t buffer_size = reader->size;
 
   if (reader->offset >= buffer_size)
   {
@@ -505,7 +505,7 @@ _cbor_reader_peek_initial_byte(cardano_cbor_reader_t* reader, const cardano_cbor
     return CARDANO_ERROR_DECODING;
   }
 
-  byte_t*                              buffer_data      = cardano_buffer_get_data(reader->buffer);
+  const byte_t*                        buffer_data      = reader->data;
   const byte_t                         tmp_initial_byte = buffer_data[reader->offset];
   const cardano_cbor_major_type_t      major_type       = cardano_cbor_initial_byte_get_major_type(tmp_initial_byte);
   const cardano_cbor_additional_info_t additional_info  = cardano_cbor_initial_byte_get_additional_info(tmp_initial_byte);
@@ -557,7 +557,7 @@ _cbor_reader_advance_buffer(cardano_cbor_reader_t* reader, const size_t length)
 {
   assert(reader != NULL);
 
-  const size_t buffer_size = cardano_buffer_get_size(reader->buffer);
+  const size_t buffer_size = reader->size;
 
   if ((reader->offset + length) > buffer_size)
   {
@@ -842,4 +842,28 @@ _cbor_reader_peek_state(cardano_cbor_reader_t* reader, cardano_cbor_reader_state
   *state = reader->cached_state;
 
   return CARDANO_SUCCESS;
-}
\ No newline at end of file
+}
+
+cardano_buffer_t*
+_cbor_reader_copy_range(const cardano_cbor_reader_t* reader, const size_t start, const size_t end)
+{
+  assert(reader != NULL);
+
+  if ((start > end) || (end > reader->size))
+  {
+    return NULL;
+  }
+
+  if (start == end)
+  {
+    return cardano_buffer_new(1U);
+  }
+
+  // An owning reader shares its copy of the input instead of copying each range out of it again
+  if (reader->buffer != NULL)
+  {
+    return cardano_buffer_slice_view(reader->buffer, start, end);
+  }
+
+  return cardano_buffer_new_from(&reader->data[start], end - start);
+}
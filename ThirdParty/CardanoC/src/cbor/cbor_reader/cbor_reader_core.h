@@ -50,11 +50,17 @@ typedef struct cbor_reader_stack_frame_t
 
 /**
  * \brief A simple reader for Concise Binary Object Representation (CBOR) encoded data.
+ *
+ * `data` and `size` describe the bytes being read. They point into `buffer` when the reader owns a copy of its
+ * input, or into caller-owned memory when it was created with \ref cardano_cbor_reader_from_view, in which case
+ * `buffer` is NULL.
  */
 typedef struct cardano_cbor_reader_t
 {
     cardano_object_t            base;
     cardano_buffer_t*           buffer;
+    const byte_t*               data;
+    size_t                      size;
     uint64_t                    offset;
     cardano_array_t*            nested_items;
     bool                        is_tag_context;
@@ -193,4 +199,19 @@ _cbor_reader_skip_next_node(cardano_cbor_reader_t* reader, size_t* depth);
 cardano_error_t
 _cbor_reader_peek_state(cardano_cbor_reader_t* reader, cardano_cbor_reader_state_t* state);
 
+/**
+ * \brief Gets a range of the bytes being read as a new buffer.
+ *
+ * An owning reader returns a view into its copy of the input (see \ref cardano_buffer_slice_view), which keeps that
+ * copy alive; a view reader copies the range, since it does not own the memory it reads.
+ *
+ * \param[in] reader A pointer to the \ref cardano_cbor_reader_t instance.
+ * \param[in] start The offset of the first byte to copy.
+ * \param[in] end The offset one past the last byte to copy. An empty range yields an empty buffer.
+ *
+ * \return A new buffer holding the bytes, or NULL if the range is out of bounds or memory could not be allocated.
+ */
+cardano_buffer_t*
+_cbor_reader_copy_range(const cardano_cbor_reader_t* reader, size_t start, size_t end);
+
 #endif // BIGLUP_LABS_INCLUDE_CARDANO_CBOR_READER_INTERNAL_CORE_H
\ No newline at end of file
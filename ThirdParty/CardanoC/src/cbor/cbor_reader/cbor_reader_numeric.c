@@ -29,6 +29,7 @@
 #include <cardano/cbor/cbor_reader.h>
 #include <cardano/error.h>
 
+#include "../../endian.h"
 #include "../cbor_additional_info.h"
 #include "../cbor_initial_byte.h"
 
@@ -85,18 +86,7 @@ peek_signed_integer(cardano_cbor_reader_t* reader, int64_t* signed_int, size_t*
       uint64_t unsigned_int = 0;
       size_t   read         = 0;
 
-      cardano_buffer_t* buffer = NULL;
-
-      cardano_error_t remainder_bytes_result = cardano_cbor_reader_get_remainder_bytes(reader, &buffer);
-
-      if (remainder_bytes_result != CARDANO_SUCCESS)
-      {
-        return remainder_bytes_result;
-      }
-
-      cardano_error_t decode_result = _cbor_reader_decode_unsigned_integer(buffer, header, &unsigned_int, &read);
-
-      cardano_buffer_unref(&buffer);
+      cardano_error_t decode_result = _cbor_reader_decode_unsigned_integer(&reader->data[reader->offset], reader->size - reader->offset, header, &unsigned_int, &read);
 
       if (decode_result != CARDANO_SUCCESS)
       {
@@ -112,18 +102,7 @@ peek_signed_integer(cardano_cbor_reader_t* reader, int64_t* signed_int, size_t*
       uint64_t unsigned_int = 0;
       size_t   read         = 0;
 
-      cardano_buffer_t* buffer = NULL;
-
-      cardano_error_t remainder_bytes_result = cardano_cbor_reader_get_remainder_bytes(reader, &buffer);
-
-      if (remainder_bytes_result != CARDANO_SUCCESS)
-      {
-        return remainder_bytes_result;
-      }
-
-      cardano_error_t decode_result = _cbor_reader_decode_unsigned_integer(buffer, header, &unsigned_int, &read);
-
-      cardano_buffer_unref(&buffer);
+      cardano_error_t decode_result = _cbor_reader_decode_unsigned_integer(&reader->data[reader->offset], reader->size - reader->offset, header, &unsigned_int, &read);
 
       if (decode_result != CARDANO_SUCCESS)
       {
@@ -205,18 +184,7 @@ peek_unsigned_integer(cardano_cbor_reader_t* reader, uint64_t* signed_int, size_
       uint64_t unsigned_int = 0;
       size_t   read         = 0;
 
-      cardano_buffer_t* buffer = NULL;
-
-      cardano_error_t remainder_bytes_result = cardano_cbor_reader_get_remainder_bytes(reader, &buffer);
-
-      if (remainder_bytes_result != CARDANO_SUCCESS)
-      {
-        return remainder_bytes_result;
-      }
-
-      cardano_error_t decode_result = _cbor_reader_decode_unsigned_integer(buffer, header, &unsigned_int, &read);
-
-      cardano_buffer_unref(&buffer);
+      cardano_error_t decode_result = _cbor_reader_decode_unsigned_integer(&reader->data[reader->offset], reader->size - reader->offset, header, &unsigned_int, &read);
 
       if (decode_result != CARDANO_SUCCESS)
       {
@@ -252,35 +220,18 @@ peek_unsigned_integer(cardano_cbor_reader_t* reader, uint64_t* signed_int, size_
 }
 
 /**
- * \brief Decodes a half-precision floating point number from the buffer into a double.
+ * \brief Decodes a half-precision floating point number into a double.
  *
- * This function decodes a floating point number encoded in half-precision (16 bits) format
- * stored in a given buffer and converts it into a double precision floating point number.
+ * This function converts a floating point number encoded in half-precision (16 bits) format into a double
+ * precision floating point number.
  *
- * \param[in] buffer A pointer to the \ref cardano_buffer_t instance that contains the half-precision
- *                   floating point number to be decoded. The buffer should contain at least 2 bytes of
- *                   data representing the half-precision float.
- * \param[out] value A pointer to a double variable where the decoded double precision floating point
- *                   number will be stored. The decoded value is calculated by extending the precision
- *                   of the half-precision float to fit the double precision format.
+ * \param[in] half The half-precision float, in host byte order.
  *
- * \return A \ref cardano_error_t indicating the outcome of the operation. If the half-precision float is
- * successfully decoded, \ref CARDANO_SUCCESS is returned. If an error occurs during decoding, such as if the
- * buffer does not contain sufficient data to represent a half-precision float, an appropriate error code will
- * be returned to denote the specific reason for failure.
+ * \return The decoded value, extended to double precision.
  */
-static cardano_error_t
-decode_half_precision_float(cardano_buffer_t* buffer, double* value)
+static double
+decode_half_precision_float(const uint16_t half)
 {
-  assert(buffer != NULL);
-  assert(value != NULL);
-
-  uint16_t              half   = 0;
-  const cardano_error_t result = cardano_buffer_read_uint16_be(buffer, &half);
-
-  assert(result == CARDANO_SUCCESS);
-  CARDANO_UNUSED(result);
-
   const uint16_t exp  = (half >> 10) & (byte_t)0x1f;
   const uint16_t mant = half & (uint16_t)0x03ff;
 
@@ -299,19 +250,17 @@ decode_half_precision_float(cardano_buffer_t* buffer, double* value)
     val = (mant == 0U) ? INFINITY : NAN;
   }
 
-  *value = (half & (uint16_t)0x8000) ? -val : val;
-
-  return CARDANO_SUCCESS;
+  return (half & (uint16_t)0x8000) ? -val : val;
 }
 
 /* IMPLEMENTATION ************************************************************/
 
 cardano_error_t
-_cbor_reader_decode_unsigned_integer(cardano_buffer_t* buffer, byte_t header, uint64_t* unsigned_int, size_t* bytes_read)
+_cbor_reader_decode_unsigned_integer(const byte_t* data, const size_t size, const byte_t header, uint64_t* unsigned_int, size_t* bytes_read)
 {
   static const byte_t additional_information_mask = 0b00011111;
 
-  if (buffer == NULL)
+  if (data == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
@@ -330,17 +279,11 @@ _cbor_reader_decode_unsigned_integer(cardano_buffer_t* buffer, byte_t header, ui
   {
     case CARDANO_CBOR_ADDITIONAL_INFO_8BIT_DATA:
     {
-      if (cardano_buffer_get_size(buffer) < 2U)
+      if (size < 2U)
       {
         return CARDANO_ERROR_DECODING;
       }
 
-      byte_t          data[2] = { 0, 0 };
-      cardano_error_t result  = cardano_buffer_read(buffer, &data[0], 2);
-
-      assert(result == CARDANO_SUCCESS);
-      CARDANO_UNUSED(result);
-
       *bytes_read   = 2;
       *unsigned_int = (uint64_t)data[1];
 
@@ -348,76 +291,43 @@ _cbor_reader_decode_unsigned_integer(cardano_buffer_t* buffer, byte_t header, ui
     }
     case CARDANO_CBOR_ADDITIONAL_INFO_16BIT_DATA:
     {
-      if (cardano_buffer_get_size(buffer) < 3U)
+      uint16_t value = 0;
+
+      if (cardano_read_uint16_be(&value, data, size, 1U) != CARDANO_SUCCESS)
       {
         return CARDANO_ERROR_DECODING;
       }
 
-      uint16_t data    = 0;
-      byte_t   to_skip = 0;
-
-      cardano_error_t result = cardano_buffer_read(buffer, &to_skip, 1);
-
-      assert(result == CARDANO_SUCCESS);
-      CARDANO_UNUSED(result);
-
-      result = cardano_buffer_read_uint16_be(buffer, &data);
-
-      assert(result == CARDANO_SUCCESS);
-      CARDANO_UNUSED(result);
-
       *bytes_read   = 3;
-      *unsigned_int = (uint64_t)data;
+      *unsigned_int = (uint64_t)value;
 
       break;
     }
     case CARDANO_CBOR_ADDITIONAL_INFO_32BIT_DATA:
     {
-      if (cardano_buffer_get_size(buffer) < 5U)
+      uint32_t value = 0;
+
+      if (cardano_read_uint32_be(&value, data, size, 1U) != CARDANO_SUCCESS)
       {
         return CARDANO_ERROR_DECODING;
       }
 
-      uint32_t data    = 0;
-      byte_t   to_skip = 0;
-
-      cardano_error_t result = cardano_buffer_read(buffer, &to_skip, 1);
-
-      assert(result == CARDANO_SUCCESS);
-      CARDANO_UNUSED(result);
-
-      result = cardano_buffer_read_uint32_be(buffer, &data);
-
-      assert(result == CARDANO_SUCCESS);
-      CARDANO_UNUSED(result);
-
       *bytes_read   = 5;
-      *unsigned_int = (uint64_t)data;
+      *unsigned_int = (uint64_t)value;
 
       break;
     }
     case CARDANO_CBOR_ADDITIONAL_INFO_64BIT_DATA:
     {
-      if (cardano_buffer_get_size(buffer) < 9U)
+      uint64_t value = 0;
+
+      if (cardano_read_uint64_be(&value, data, size, 1U) != CARDANO_SUCCESS)
       {
         return CARDANO_ERROR_DECODING;
       }
 
-      uint64_t data    = 0;
-      byte_t   to_skip = 0;
-
-      cardano_error_t result = cardano_buffer_read(buffer, &to_skip, 1);
-
-      assert(result == CARDANO_SUCCESS);
-      CARDANO_UNUSED(result);
-
-      result = cardano_buffer_read_uint64_be(buffer, &data);
-
-      assert(result == CARDANO_SUCCESS);
-      CARDANO_UNUSED(result);
-
       *bytes_read   = 9;
-      *unsigned_int = data;
+      *unsigned_int = value;
 
       break;
     }
@@ -451,100 +361,69 @@ _cbor_reader_read_double(cardano_cbor_reader_t* reader, double* value)
 
   cardano_cbor_additional_info_t additional_info = cardano_cbor_initial_byte_get_additional_info(header);
 
-  cardano_buffer_t* buffer                 = NULL;
-  cardano_error_t   remainder_bytes_result = cardano_cbor_reader_get_remainder_bytes(reader, &buffer);
-
-  if (remainder_bytes_result != CARDANO_SUCCESS)
-  {
-    return remainder_bytes_result;
-  }
-
-  byte_t          to_skip     = 0;
-  cardano_error_t skip_result = cardano_buffer_read(buffer, &to_skip, 1);
-
-  assert(skip_result == CARDANO_SUCCESS);
-  CARDANO_UNUSED(skip_result);
+  const byte_t* data = &reader->data[reader->offset];
+  const size_t  size = reader->size - reader->offset;
 
   switch (additional_info)
   {
     case CARDANO_CBOR_ADDITIONAL_INFO_16BIT_DATA:
     {
-      if (cardano_buffer_get_size(buffer) < 3U)
+      uint16_t half = 0;
+
+      if (cardano_read_uint16_be(&half, data, size, 1U) != CARDANO_SUCCESS)
       {
-        cardano_buffer_unref(&buffer);
         return CARDANO_ERROR_DECODING;
       }
 
-      double half_precision = 0.0;
-
-      cardano_error_t decode_result = decode_half_precision_float(buffer, &half_precision);
-
-      assert(decode_result == CARDANO_SUCCESS);
-      CARDANO_UNUSED(decode_result);
-
       cardano_error_t advance_result = _cbor_reader_advance_buffer(reader, 3);
 
       assert(advance_result == CARDANO_SUCCESS);
       CARDANO_UNUSED(advance_result);
 
       _cbor_reader_advance_data_item_counters(reader);
-      cardano_buffer_unref(&buffer);
 
-      *value = half_precision;
+      *value = decode_half_precision_float(half);
       break;
     }
     case CARDANO_CBOR_ADDITIONAL_INFO_32BIT_DATA:
     {
-      if (cardano_buffer_get_size(buffer) < 5U)
+      float single_precision = 0.0f;
+
+      if (cardano_read_float_be(&single_precision, data, size, 1U) != CARDANO_SUCCESS)
       {
-        cardano_buffer_unref(&buffer);
         return CARDANO_ERROR_DECODING;
       }
 
-      float single_precision = 0.0f;
-
-      cardano_error_t decode_result = cardano_buffer_read_float_be(buffer, &single_precision);
-
-      assert(decode_result == CARDANO_SUCCESS);
-      CARDANO_UNUSED(decode_result);
-
       cardano_error_t advance_result = _cbor_reader_advance_buffer(reader, 5);
 
       assert(advance_result == CARDANO_SUCCESS);
       CARDANO_UNUSED(advance_result);
 
       _cbor_reader_advance_data_item_counters(reader);
-      cardano_buffer_unref(&buffer);
+
       *value = single_precision;
       break;
     }
     case CARDANO_CBOR_ADDITIONAL_INFO_64BIT_DATA:
     {
-      if (cardano_buffer_get_size(buffer) < 9U)
+      double double_precision = 0.0;
+
+      if (cardano_read_double_be(&double_precision, data, size, 1U) != CARDANO_SUCCESS)
       {
-        cardano_buffer_unref(&buffer);
         return CARDANO_ERROR_DECODING;
       }
 
-      double          double_precision = 0.0;
-      cardano_error_t decode_result    = cardano_buffer_read_double_be(buffer, &double_precision);
-
-      assert(decode_result == CARDANO_SUCCESS);
-      CARDANO_UNUSED(decode_result);
-
       cardano_error_t advance_result = _cbor_reader_advance_buffer(reader, 9);
 
       assert(advance_result == CARDANO_SUCCESS);
       CARDANO_UNUSED(advance_result);
 
       _cbor_reader_advance_data_item_counters(reader);
-      cardano_buffer_unref(&buffer);
 
       *value = double_precision;
       break;
     }
     default:
-      cardano_buffer_unref(&buffer);
       cardano_cbor_reader_set_last_error(reader, "Not a float encoding");
       return CARDANO_ERROR_DECODING;
   }
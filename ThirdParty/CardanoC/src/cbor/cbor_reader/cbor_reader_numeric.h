@@ -32,14 +32,15 @@
 /* DECLARATIONS **************************************************************/
 
 /**
- * \brief Decodes an unsigned integer from a buffer based on the provided CBOR header.
+ * \brief Decodes an unsigned integer from memory based on the provided CBOR header.
  *
- * This function is designed to decode an unsigned integer encoded in CBOR format from a given buffer.
+ * This function is designed to decode an unsigned integer encoded in CBOR format, reading it in place.
  * The CBOR encoding for integers uses a header byte to indicate the size and format of the integer that follows.
  * This function interprets the header byte and reads the subsequent bytes from the buffer to reconstruct the
  * unsigned integer value.
  *
- * \param[in] buffer A pointer to the \ref cardano_buffer_t instance containing the CBOR encoded data.
+ * \param[in] data A pointer to the CBOR encoded data, starting at the header byte.
+ * \param[in] size The number of bytes available at `data`.
  * \param[in] header The CBOR header byte that precedes the encoded integer. This byte contains information
  *                   about the integer's size and whether it is unsigned.
  * \param[out] unsigned_int A pointer to a uint64_t variable where the decoded unsigned integer value will be stored.
@@ -52,7 +53,7 @@
  * reason for failure.
  */
 cardano_error_t
-_cbor_reader_decode_unsigned_integer(cardano_buffer_t* buffer, byte_t header, uint64_t* unsigned_int, size_t* bytes_read);
+_cbor_reader_decode_unsigned_integer(const byte_t* data, size_t size, byte_t header, uint64_t* unsigned_int, size_t* bytes_read);
 
 /**
  * \brief Reads a double-precision floating point number from the CBOR stream.
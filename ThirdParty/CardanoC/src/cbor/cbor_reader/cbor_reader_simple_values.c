@@ -112,12 +112,12 @@ _cbor_reader_read_simple_value(cardano_cbor_reader_t* reader, cardano_cbor_simpl
 
   if (additional_info == CARDANO_CBOR_ADDITIONAL_INFO_8BIT_DATA)
   {
-    if (cardano_buffer_get_size(reader->buffer) <= (reader->offset + 1U))
+    if (reader->size <= (reader->offset + 1U))
     {
       return CARDANO_ERROR_DECODING;
     }
 
-    byte_t simple_value = cardano_buffer_get_data(reader->buffer)[reader->offset + 1U];
+    byte_t simple_value = reader->data[reader->offset + 1U];
 
     CARDANO_UNUSED(_cbor_reader_advance_buffer(reader, 2));
 
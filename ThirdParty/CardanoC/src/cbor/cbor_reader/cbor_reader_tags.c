@@ -73,18 +73,7 @@ peek_tag_core(cardano_cbor_reader_t* reader, cardano_cbor_tag_t* tag, size_t* by
 
   size_t read = 0;
 
-  cardano_buffer_t* buffer = NULL;
-
-  cardano_error_t remainder_bytes_result = cardano_cbor_reader_get_remainder_bytes(reader, &buffer);
-
-  if (remainder_bytes_result != CARDANO_SUCCESS)
-  {
-    return remainder_bytes_result;
-  }
-
-  cardano_error_t decode_result = _cbor_reader_decode_unsigned_integer(buffer, header, &unsigned_int, &read);
-
-  cardano_buffer_unref(&buffer);
+  cardano_error_t decode_result = _cbor_reader_decode_unsigned_integer(&reader->data[reader->offset], reader->size - reader->offset, header, &unsigned_int, &read);
 
   if (decode_result != CARDANO_SUCCESS)
   {
@@ -0,0 +1,89 @@
+/**
+ * \file cbor_scan.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_CBOR_SCAN_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_CBOR_SCAN_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/cbor/cbor_well_formed.h>
+#include <cardano/error.h>
+#include <cardano/typedefs.h>
+
+#include <stdbool.h>
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Finds the end of the CBOR data item starting at a given offset, without decoding it.
+ *
+ * This is the scan behind \ref cardano_cbor_validate_well_formed, with the same checks, except that the data item may
+ * be followed by more bytes. Strings are jumped over by their declared length and containers by counting their
+ * items, so the cost is one step per data item header, whatever the size of the strings; nothing is allocated.
+ *
+ * \param[in] data The bytes to scan.
+ * \param[in] size The size of `data` in bytes.
+ * \param[in] start The offset of the initial byte of the data item.
+ * \param[in] max_depth The maximum nesting depth allowed. Zero, or a value larger than
+ *                      \ref CARDANO_CBOR_WELL_FORMED_MAX_DEPTH, selects \ref CARDANO_CBOR_WELL_FORMED_MAX_DEPTH.
+ * \param[out] end On success, the offset right after the data item.
+ * \param[out] error_offset Optional. If the data item is malformed, set to the offset of the offending byte (or `size`
+ *                          if it is truncated). May be NULL.
+ *
+ * \return \ref CARDANO_SUCCESS if the data item is well formed, \ref CARDANO_ERROR_POINTER_IS_NULL if `data` or `end`
+ *         is NULL, or \ref CARDANO_ERROR_DECODING if it is malformed, truncated or too deeply nested.
+ */
+cardano_error_t
+cardano_cbor_scan_data_item(
+  const byte_t* data,
+  size_t        size,
+  size_t        start,
+  size_t        max_depth,
+  size_t*       end,
+  size_t*       error_offset);
+
+/**
+ * \brief Reads the header of the CBOR data item starting at a given offset.
+ *
+ * \param[in] data The bytes to read.
+ * \param[in] size The size of `data` in bytes.
+ * \param[in] start The offset of the initial byte of the data item.
+ * \param[out] major_type On success, the major type of the data item.
+ * \param[out] argument On success, the argument of the header: the value of an integer or simple value, the length
+ *                      of a string, the item count of an array, the pair count of a map or the number of a tag. Zero
+ *                      for indefinite lengths.
+ * \param[out] indefinite On success, whether the header announces an indefinite length (or is a break).
+ * \param[out] end On success, the offset right after the header.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if a pointer is NULL, or
+ *         \ref CARDANO_ERROR_DECODING if the header is truncated or uses reserved additional information.
+ */
+cardano_error_t
+cardano_cbor_scan_header(
+  const byte_t* data,
+  size_t        size,
+  size_t        start,
+  byte_t*       major_type,
+  uint64_t*     argument,
+  bool*         indefinite,
+  size_t*       end);
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_CBOR_SCAN_H
@@ -290,35 +290,25 @@ cardano_cbor_validate_array_of_n_elements(const char* validator_name, cardano_cb
     return CARDANO_ERROR_UNEXPECTED_CBOR_TYPE;
   }
 
-  cardano_buffer_t* buffer                     = NULL;
-  cardano_error_t   get_remainder_bytes_result = cardano_cbor_reader_get_remainder_bytes(reader, &buffer);
-
-  if (get_remainder_bytes_result != CARDANO_SUCCESS)
-  {
-    return get_remainder_bytes_result;
-  }
-
   int64_t array_size = 0U;
 
   cardano_error_t read_start_array_result = cardano_cbor_reader_read_start_array(reader, &array_size);
 
   if (read_start_array_result != CARDANO_SUCCESS)
   {
-    cardano_buffer_unref(&buffer);
     return read_start_array_result;
   }
 
+  // Only an indefinite array needs its elements counted ahead; copying the rest of the input up front
+  // for every array made decoding a long list of small structures quadratic in its size.
   if (array_size < 0)
   {
-    cardano_cbor_reader_t* inner_reader = cardano_cbor_reader_new(cardano_buffer_get_data(buffer), cardano_buffer_get_size(buffer));
-    cardano_buffer_unref(&buffer);
+    cardano_cbor_reader_t* inner_reader = NULL;
+    cardano_error_t        clone_result = cardano_cbor_reader_clone(reader, &inner_reader);
 
-    read_start_array_result = cardano_cbor_reader_read_start_array(inner_reader, &array_size);
-
-    if (read_start_array_result != CARDANO_SUCCESS)
+    if (clone_result != CARDANO_SUCCESS)
     {
-      cardano_cbor_reader_unref(&inner_reader);
-      return read_start_array_result;
+      return clone_result;
     }
 
     array_size                                     = 0U;
@@ -353,8 +343,6 @@ cardano_cbor_validate_array_of_n_elements(const char* validator_name, cardano_cb
     cardano_cbor_reader_unref(&inner_reader);
   }
 
-  cardano_buffer_unref(&buffer);
-
   if ((uint64_t)array_size != n)
   {
     set_invalid_size_error_message(
@@ -710,4 +698,19 @@ cardano_cbor_validate_enum_value(
   }
 
   return CARDANO_SUCCESS;
-}
\ No newline at end of file
+}
+
+size_t
+cardano_cbor_get_reserve_count(cardano_cbor_reader_t* reader, const int64_t length, const size_t min_element_size)
+{
+  size_t remaining = 0U;
+
+  if ((length <= 0) || (cardano_cbor_reader_get_bytes_remaining(reader, &remaining) != CARDANO_SUCCESS))
+  {
+    return 0U;
+  }
+
+  const size_t capacity = remaining / ((min_element_size > 0U) ? min_element_size : 1U);
+
+  return ((uint64_t)length < (uint64_t)capacity) ? (size_t)length : capacity;
+}
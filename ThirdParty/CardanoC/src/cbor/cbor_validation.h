@@ -345,4 +345,20 @@ cardano_cbor_validate_enum_value(
   enum_to_string_callback_t enum_to_string_callback,
   uint64_t*                 actual_value);
 
+/**
+ * \brief Gets how many elements to reserve room for from the length a collection header announced.
+ *
+ * A header may announce any length, so the count is capped by how many elements of at least \p min_element_size
+ * bytes the rest of the reader could hold. Decoders reserve that count once instead of growing per element.
+ *
+ * \param[in] reader The reader, positioned after the collection header.
+ * \param[in] length The length read from the header, negative for an indefinite length collection.
+ * \param[in] min_element_size The smallest encoded size of one element; zero is treated as one.
+ *
+ * \return The number of elements to reserve, or zero if there is nothing to reserve.
+ */
+CARDANO_NODISCARD
+size_t
+cardano_cbor_get_reserve_count(cardano_cbor_reader_t* reader, int64_t length, size_t min_element_size);
+
 #endif // BIGLUP_LABS_INCLUDE_CARDANO_CBOR_VALIDATION_H
@@ -0,0 +1,416 @@
+/**
+ * \file cbor_well_formed.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/cbor/cbor_major_type.h>
+#include <cardano/cbor/cbor_well_formed.h>
+
+#include "cbor_additional_info.h"
+#include "cbor_scan.h"
+
+#include <stdbool.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const byte_t CBOR_BREAK_BYTE      = 0xFFU;
+static const byte_t CBOR_MIN_SIMPLE_8BIT = 32U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief The kind of item whose content is being scanned.
+ */
+typedef enum
+{
+  /**
+   * \brief An item with a known number of data items left: definite-length arrays and maps, and tags.
+   */
+  FRAME_KIND_DEFINITE = 0,
+
+  /**
+   * \brief An indefinite-length array.
+   */
+  FRAME_KIND_INDEFINITE_ARRAY = 1,
+
+  /**
+   * \brief An indefinite-length map.
+   */
+  FRAME_KIND_INDEFINITE_MAP = 2,
+
+  /**
+   * \brief An indefinite-length byte or text string, made of chunks of its own major type.
+   */
+  FRAME_KIND_INDEFINITE_STRING = 3
+} frame_kind_t;
+
+/**
+ * \brief An open item on the scanning stack.
+ */
+typedef struct frame_t
+{
+    uint64_t     remaining;
+    frame_kind_t kind;
+    byte_t       chunk_major_type;
+} frame_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Reads the argument of a data item header.
+ *
+ * \param[in] data The input buffer.
+ * \param[in] size The size of the input buffer.
+ * \param[in,out] offset The offset right after the initial byte; advanced past the argument bytes.
+ * \param[in] additional_info The additional information of the initial byte (below 28).
+ * \param[out] argument The argument value.
+ *
+ * \return true if the argument bytes are available, false if the input is truncated.
+ */
+static bool
+read_argument(
+  const byte_t* data,
+  const size_t  size,
+  size_t*       offset,
+  const byte_t  additional_info,
+  uint64_t*     argument)
+{
+  if (additional_info < (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_8BIT_DATA)
+  {
+    *argument = additional_info;
+
+    return true;
+  }
+
+  const size_t width = (size_t)1U << (additional_info - (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_8BIT_DATA);
+
+  if (width > (size - *offset))
+  {
+    return false;
+  }
+
+  uint64_t value = 0U;
+
+  for (size_t i = 0U; i < width; ++i)
+  {
+    value = (value << 8U) | data[*offset + i];
+  }
+
+  *offset  += width;
+  *argument = value;
+
+  return true;
+}
+
+/**
+ * \brief Records the offset of the first malformed byte, if requested.
+ *
+ * \param[out] error_offset Where the offset is stored, or NULL.
+ * \param[in] offset The offset to report.
+ *
+ * \return Always \ref CARDANO_ERROR_DECODING.
+ */
+static cardano_error_t
+malformed(size_t* error_offset, const size_t offset)
+{
+  if (error_offset != NULL)
+  {
+    *error_offset = offset;
+  }
+
+  return CARDANO_ERROR_DECODING;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_cbor_scan_data_item(
+  const byte_t* data,
+  const size_t  size,
+  const size_t  start,
+  size_t        max_depth,
+  size_t*       end,
+  size_t*       error_offset)
+{
+  if ((data == NULL) || (end == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (start > size)
+  {
+    return malformed(error_offset, size);
+  }
+
+  if ((max_depth == 0U) || (max_depth > CARDANO_CBOR_WELL_FORMED_MAX_DEPTH))
+  {
+    max_depth = CARDANO_CBOR_WELL_FORMED_MAX_DEPTH;
+  }
+
+  // Frame zero stands for the top level, which expects exactly one data item.
+  frame_t stack[CARDANO_CBOR_WELL_FORMED_MAX_DEPTH + 1U];
+  size_t  depth  = 1U;
+  size_t  offset = start;
+
+  stack[0].remaining        = 1U;
+  stack[0].kind             = FRAME_KIND_DEFINITE;
+  stack[0].chunk_major_type = 0U;
+
+  while (depth > 0U)
+  {
+    frame_t* frame = &stack[depth - 1U];
+
+    if ((frame->kind == FRAME_KIND_DEFINITE) && (frame->remaining == 0U))
+    {
+      --depth;
+      continue;
+    }
+
+    if (offset >= size)
+    {
+      return malformed(error_offset, size);
+    }
+
+    const size_t item_offset  = offset;
+    const byte_t initial_byte = data[offset];
+
+    if ((initial_byte == CBOR_BREAK_BYTE) && (frame->kind != FRAME_KIND_DEFINITE))
+    {
+      // The remaining count of an indefinite map holds the parity of the items read so far.
+      if ((frame->kind == FRAME_KIND_INDEFINITE_MAP) && (frame->remaining != 0U))
+      {
+        return malformed(error_offset, item_offset);
+      }
+
+      ++offset;
+      --depth;
+      continue;
+    }
+
+    const byte_t major_type      = (byte_t)(initial_byte >> 5U);
+    const byte_t additional_info = (byte_t)(initial_byte & 0x1FU);
+
+    if (frame->kind == FRAME_KIND_INDEFINITE_STRING)
+    {
+      if ((major_type != frame->chunk_major_type) || (additional_info == (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_INDEFINITE_LENGTH))
+      {
+        return malformed(error_offset, item_offset);
+      }
+    }
+
+    if (frame->kind == FRAME_KIND_DEFINITE)
+    {
+      --frame->remaining;
+    }
+    else if (frame->kind == FRAME_KIND_INDEFINITE_MAP)
+    {
+      frame->remaining ^= 1U;
+    }
+
+    ++offset;
+
+    // Additional information 28 to 30 is reserved.
+    if ((additional_info > (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_64BIT_DATA) && (additional_info < (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_INDEFINITE_LENGTH))
+    {
+      return malformed(error_offset, item_offset);
+    }
+
+    const bool indefinite = (additional_info == (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_INDEFINITE_LENGTH);
+    uint64_t   argument   = 0U;
+
+    if (!indefinite && !read_argument(data, size, &offset, additional_info, &argument))
+    {
+      return malformed(error_offset, size);
+    }
+
+    const uint64_t available = (uint64_t)(size - offset);
+    frame_t        child     = { 0U, FRAME_KIND_DEFINITE, 0U };
+    bool           push      = false;
+
+    switch (major_type)
+    {
+      case (byte_t)CARDANO_CBOR_MAJOR_TYPE_UNSIGNED_INTEGER:
+      case (byte_t)CARDANO_CBOR_MAJOR_TYPE_NEGATIVE_INTEGER:
+      {
+        if (indefinite)
+        {
+          return malformed(error_offset, item_offset);
+        }
+
+        break;
+      }
+      case (byte_t)CARDANO_CBOR_MAJOR_TYPE_BYTE_STRING:
+      case (byte_t)CARDANO_CBOR_MAJOR_TYPE_UTF8_STRING:
+      {
+        if (indefinite)
+        {
+          child.kind             = FRAME_KIND_INDEFINITE_STRING;
+          child.chunk_major_type = major_type;
+          push                   = true;
+        }
+        else if (argument > available)
+        {
+          return malformed(error_offset, item_offset);
+        }
+        else
+        {
+          offset += (size_t)argument;
+        }
+
+        break;
+      }
+      case (byte_t)CARDANO_CBOR_MAJOR_TYPE_ARRAY:
+      case (byte_t)CARDANO_CBOR_MAJOR_TYPE_MAP:
+      {
+        const bool is_map = (major_type == (byte_t)CARDANO_CBOR_MAJOR_TYPE_MAP);
+
+        if (indefinite)
+        {
+          child.kind = is_map ? FRAME_KIND_INDEFINITE_MAP : FRAME_KIND_INDEFINITE_ARRAY;
+          push       = true;
+        }
+        else
+        {
+          // Every data item takes at least one byte, so larger counts can never be satisfied.
+          const uint64_t max_items = is_map ? (available / 2U) : available;
+
+          if (argument > max_items)
+          {
+            return malformed(error_offset, item_offset);
+          }
+
+          child.remaining = is_map ? (argument * 2U) : argument;
+          push            = (child.remaining > 0U);
+        }
+
+        break;
+      }
+      case (byte_t)CARDANO_CBOR_MAJOR_TYPE_TAG:
+      {
+        if (indefinite)
+        {
+          return malformed(error_offset, item_offset);
+        }
+
+        child.remaining = 1U;
+        push            = true;
+
+        break;
+      }
+      default:
+      {
+        // Simple values and floats. A break here is not closing any indefinite-length item.
+        if (indefinite)
+        {
+          return malformed(error_offset, item_offset);
+        }
+
+        if ((additional_info == (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_8BIT_DATA) && (argument < CBOR_MIN_SIMPLE_8BIT))
+        {
+          return malformed(error_offset, item_offset);
+        }
+
+        break;
+      }
+    }
+
+    if (push)
+    {
+      if (depth > max_depth)
+      {
+        return malformed(error_offset, item_offset);
+      }
+
+      stack[depth] = child;
+      ++depth;
+    }
+  }
+
+  *end = offset;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_cbor_scan_header(
+  const byte_t* data,
+  const size_t  size,
+  const size_t  start,
+  byte_t*       major_type,
+  uint64_t*     argument,
+  bool*         indefinite,
+  size_t*       end)
+{
+  if ((data == NULL) || (major_type == NULL) || (argument == NULL) || (indefinite == NULL) || (end == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (start >= size)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  const byte_t initial_byte    = data[start];
+  const byte_t additional_info = (byte_t)(initial_byte & 0x1FU);
+  size_t       offset          = start + 1U;
+
+  if ((additional_info > (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_64BIT_DATA) && (additional_info < (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_INDEFINITE_LENGTH))
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  *major_type = (byte_t)(initial_byte >> 5U);
+  *indefinite = (additional_info == (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_INDEFINITE_LENGTH);
+  *argument   = 0U;
+
+  if (!*indefinite && !read_argument(data, size, &offset, additional_info, argument))
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  *end = offset;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_cbor_validate_well_formed(
+  const byte_t* data,
+  const size_t  size,
+  const size_t  max_depth,
+  size_t*       error_offset)
+{
+  size_t          end    = 0U;
+  cardano_error_t result = cardano_cbor_scan_data_item(data, size, 0U, max_depth, &end, error_offset);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (end != size)
+  {
+    return malformed(error_offset, end);
+  }
+
+  return CARDANO_SUCCESS;
+}
@@ -29,6 +29,7 @@
 #include <cardano/object.h>
 
 #include "../allocators.h"
+#include "../build_profile.h"
 #include "../string_safe.h"
 
 #include <assert.h>
@@ -43,96 +44,111 @@ typedef struct cardano_cbor_writer_t
 {
     cardano_object_t  base;
     cardano_buffer_t* buffer;
+    size_t            size;
 } cardano_cbor_writer_t;
 
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
- * \brief Writes a value with a specified CBOR major type to a buffer.
+ * \brief Appends raw bytes to the writer output.
+ *
+ * In a size-only writer (see \ref cardano_cbor_writer_new_size_only) the bytes are not stored, only counted.
+ *
+ * \param writer The writer to append to.
+ * \param data The bytes to append.
+ * \param size The number of bytes to append.
+ *
+ * \return \c CARDANO_SUCCESS on success, or the error returned by the underlying buffer.
+ */
+static cardano_error_t
+writer_write(cardano_cbor_writer_t* writer, const byte_t* data, const size_t size)
+{
+  if (writer->buffer == NULL)
+  {
+    writer->size += size;
+
+    return CARDANO_SUCCESS;
+  }
+
+  return cardano_buffer_write(writer->buffer, data, size);
+}
+
+/**
+ * \brief Writes a value with a specified CBOR major type to the writer.
  *
  * This function serializes a given value into a format specified by the CBOR
- * (Concise Binary Object Representation) encoding standard, targeting the provided
- * buffer. The major type parameter determines how the value is interpreted and encoded
- * according to CBOR's major type specification.
+ * (Concise Binary Object Representation) encoding standard. The header and its argument are
+ * assembled on the stack and appended with a single write. The major type parameter determines
+ * how the value is interpreted and encoded according to CBOR's major type specification.
  *
- * \param buffer A pointer to the \c cardano_buffer_t structure representing the target buffer
- *               where the encoded data will be written.
+ * \param writer A pointer to the \c cardano_cbor_writer_t the encoded data will be written to.
  * \param major_type The CBOR major type of the value to write. This parameter defines the data type
  *                   and format of the value in the CBOR encoding (e.g., unsigned integer, byte string, etc.).
  *                   It must be one of the values defined by the \c cardano_cbor_major_type_t enumeration.
- * \param value The value to be encoded and written to the buffer. The function interprets and encodes
+ * \param value The value to be encoded and written. The function interprets and encodes
  *              this value according to the specified CBOR major type.
  *
  * \return A \c cardano_error_t indicating the result of the operation. Returns \c CARDANO_SUCCESS if
- *         the value is successfully encoded and written to the buffer. If an error occurs during the
+ *         the value is successfully encoded and written. If an error occurs during the
  *         operation, a corresponding error code is returned, indicating the failure reason.
  */
 static cardano_error_t
-write_type_value(cardano_buffer_t* buffer, const cardano_cbor_major_type_t major_type, const uint64_t value)
+write_type_value(cardano_cbor_writer_t* writer, const cardano_cbor_major_type_t major_type, const uint64_t value)
 {
-  const byte_t type = (byte_t)major_type << 5;
+  const byte_t type        = (byte_t)major_type << 5;
+  byte_t       encoded[9]  = { 0 };
+  size_t       arg_size    = 0U;
+  byte_t       header_info = 0U;
 
   if (value < 24U)
   {
-    byte_t          header = type | (byte_t)value;
-    cardano_error_t result = cardano_buffer_write(buffer, &header, sizeof(header));
-
-    if (result != CARDANO_SUCCESS)
-    {
-      return result;
-    }
+    header_info = (byte_t)value;
   }
   else if (value < 256U)
   {
-    byte_t          header = type | (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_8BIT_DATA;
-    cardano_error_t result = cardano_buffer_write(buffer, &header, sizeof(header));
-
-    if (result != CARDANO_SUCCESS)
-    {
-      return result;
-    }
-
-    byte_t val = (byte_t)value;
-    return cardano_buffer_write(buffer, &val, 1);
+    header_info = (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_8BIT_DATA;
+    arg_size    = 1U;
   }
   else if (value < 65536U)
   {
-    byte_t          header = type | (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_16BIT_DATA;
-    cardano_error_t result = cardano_buffer_write(buffer, &header, sizeof(header));
-
-    if (result != CARDANO_SUCCESS)
-    {
-      return result;
-    }
-
-    return cardano_buffer_write_uint16_be(buffer, (uint16_t)value);
+    header_info = (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_16BIT_DATA;
+    arg_size    = 2U;
   }
   else if (value < 4294967296U)
   {
-    byte_t          header = type | (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_32BIT_DATA;
-    cardano_error_t result = cardano_buffer_write(buffer, &header, sizeof(header));
-
-    if (result != CARDANO_SUCCESS)
-    {
-      return result;
-    }
-
-    return cardano_buffer_write_uint32_be(buffer, (uint32_t)value);
+    header_info = (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_32BIT_DATA;
+    arg_size    = 4U;
   }
   else
   {
-    byte_t          header = type | (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_64BIT_DATA;
-    cardano_error_t result = cardano_buffer_write(buffer, &header, sizeof(header));
+    header_info = (byte_t)CARDANO_CBOR_ADDITIONAL_INFO_64BIT_DATA;
+    arg_size    = 8U;
+  }
 
-    if (result != CARDANO_SUCCESS)
-    {
-      return result;
-    }
+  encoded[0] = type | header_info;
 
-    return cardano_buffer_write_uint64_be(buffer, value);
+  for (size_t i = 0U; i < arg_size; ++i)
+  {
+    encoded[arg_size - i] = (byte_t)(value >> (8U * i));
   }
 
-  return CARDANO_SUCCESS;
+  return writer_write(writer, encoded, arg_size + 1U);
+}
+
+/**
+ * \brief Counts the output of a writer that is about to be discarded into the active build profile, if any.
+ *
+ * \param writer The writer being released or reset.
+ */
+static void
+count_serialization(const cardano_cbor_writer_t* writer)
+{
+  const size_t size = (writer->buffer == NULL) ? writer->size : cardano_buffer_get_size(writer->buffer);
+
+  if (size > 0U)
+  {
+    _cardano_build_profile_count_serialization(size);
+  }
 }
 
 /**
@@ -155,6 +171,8 @@ cardano_cbor_writer_deallocate(void* object)
 
   cardano_cbor_writer_t* cbor_writer = (cardano_cbor_writer_t*)object;
 
+  count_serialization(cbor_writer);
+
   if (cbor_writer->buffer != NULL)
   {
     cardano_buffer_unref(&cbor_writer->buffer);
@@ -163,10 +181,16 @@ cardano_cbor_writer_deallocate(void* object)
   _cardano_free(cbor_writer);
 }
 
-/* DECLARATIONS **************************************************************/
-
-cardano_cbor_writer_t*
-cardano_cbor_writer_new(void)
+/**
+ * \brief Allocates a writer object.
+ *
+ * \param capacity Initial capacity of the output buffer. Ignored for size-only writers.
+ * \param size_only If true, the writer keeps no buffer and only counts the bytes written.
+ *
+ * \return The new writer, or \c NULL if memory could not be allocated.
+ */
+static cardano_cbor_writer_t*
+cbor_writer_new(const size_t capacity, const bool size_only)
 {
   cardano_cbor_writer_t* obj = (cardano_cbor_writer_t*)_cardano_malloc(sizeof(cardano_cbor_writer_t));
 
@@ -177,8 +201,16 @@ cardano_cbor_writer_new(void)
 
   obj->base.ref_count     = 1;
   obj->base.deallocator   = cardano_cbor_writer_deallocate;
-  obj->base.last_error[0] = '\0';
-  obj->buffer             = cardano_buffer_new(128);
+  obj->base.last_error    = NULL;
+  obj->buffer             = NULL;
+  obj->size               = 0U;
+
+  if (size_only)
+  {
+    return obj;
+  }
+
+  obj->buffer = cardano_buffer_new(capacity);
 
   if (obj->buffer == NULL)
   {
@@ -189,6 +221,26 @@ cardano_cbor_writer_new(void)
   return obj;
 }
 
+/* DECLARATIONS **************************************************************/
+
+cardano_cbor_writer_t*
+cardano_cbor_writer_new(void)
+{
+  return cbor_writer_new(128U, false);
+}
+
+cardano_cbor_writer_t*
+cardano_cbor_writer_new_with_capacity(const size_t capacity)
+{
+  return cbor_writer_new((capacity == 0U) ? 1U : capacity, false);
+}
+
+cardano_cbor_writer_t*
+cardano_cbor_writer_new_size_only(void)
+{
+  return cbor_writer_new(0U, true);
+}
+
 void
 cardano_cbor_writer_unref(cardano_cbor_writer_t** cbor_writer)
 {
@@ -303,9 +355,10 @@ cardano_cbor_writer_write_bool(cardano_cbor_writer_t* writer, const bool value)
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  byte_t cbor_bool_val = (byte_t)(value ? 245 : 244);
+  static byte_t cbor_false = 0xf4U;
+  static byte_t cbor_true  = 0xf5U;
 
-  return cardano_buffer_write(writer->buffer, &cbor_bool_val, 1);
+  return writer_write(writer, value ? &cbor_true : &cbor_false, 1);
 }
 
 cardano_error_t
@@ -321,14 +374,14 @@ cardano_cbor_writer_write_bytestring(cardano_cbor_writer_t* writer, const byte_t
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_error_t result = write_type_value(writer->buffer, CARDANO_CBOR_MAJOR_TYPE_BYTE_STRING, size);
+  cardano_error_t result = write_type_value(writer, CARDANO_CBOR_MAJOR_TYPE_BYTE_STRING, size);
 
   if (result != CARDANO_SUCCESS)
   {
     return result;
   }
 
-  return cardano_buffer_write(writer->buffer, data, size);
+  return writer_write(writer, data, size);
 }
 
 cardano_error_t
@@ -344,14 +397,14 @@ cardano_cbor_writer_write_textstring(cardano_cbor_writer_t* writer, const char*
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_error_t result = write_type_value(writer->buffer, CARDANO_CBOR_MAJOR_TYPE_UTF8_STRING, size);
+  cardano_error_t result = write_type_value(writer, CARDANO_CBOR_MAJOR_TYPE_UTF8_STRING, size);
 
   if (result != CARDANO_SUCCESS)
   {
     return result;
   }
 
-  return cardano_buffer_write(writer->buffer, (const byte_t*)data, size);
+  return writer_write(writer, (const byte_t*)data, size);
 }
 
 cardano_error_t
@@ -367,7 +420,7 @@ cardano_cbor_writer_write_encoded(cardano_cbor_writer_t* writer, const byte_t* d
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return cardano_buffer_write(writer->buffer, data, size);
+  return writer_write(writer, data, size);
 }
 
 cardano_error_t
@@ -382,10 +435,10 @@ cardano_cbor_writer_write_start_array(cardano_cbor_writer_t* writer, const int64
 
   if (size < 0)
   {
-    return cardano_buffer_write(writer->buffer, &indefinite_length_array, sizeof(indefinite_length_array));
+    return writer_write(writer, &indefinite_length_array, sizeof(indefinite_length_array));
   }
 
-  return write_type_value(writer->buffer, CARDANO_CBOR_MAJOR_TYPE_ARRAY, size);
+  return write_type_value(writer, CARDANO_CBOR_MAJOR_TYPE_ARRAY, size);
 }
 
 cardano_error_t
@@ -398,7 +451,7 @@ cardano_cbor_writer_write_end_array(cardano_cbor_writer_t* writer)
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return cardano_buffer_write(writer->buffer, &indefiniteLengthBreakByte, sizeof(indefiniteLengthBreakByte));
+  return writer_write(writer, &indefiniteLengthBreakByte, sizeof(indefiniteLengthBreakByte));
 }
 
 cardano_error_t
@@ -413,10 +466,10 @@ cardano_cbor_writer_write_start_map(cardano_cbor_writer_t* writer, const int64_t
 
   if (size < 0)
   {
-    return cardano_buffer_write(writer->buffer, &indefinite_length_map, sizeof(indefinite_length_map));
+    return writer_write(writer, &indefinite_length_map, sizeof(indefinite_length_map));
   }
 
-  return write_type_value(writer->buffer, CARDANO_CBOR_MAJOR_TYPE_MAP, size);
+  return write_type_value(writer, CARDANO_CBOR_MAJOR_TYPE_MAP, size);
 }
 
 cardano_error_t
@@ -433,7 +486,7 @@ cardano_cbor_writer_write_uint(cardano_cbor_writer_t* writer, const uint64_t val
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return write_type_value(writer->buffer, CARDANO_CBOR_MAJOR_TYPE_UNSIGNED_INTEGER, value);
+  return write_type_value(writer, CARDANO_CBOR_MAJOR_TYPE_UNSIGNED_INTEGER, value);
 }
 
 cardano_error_t
@@ -446,10 +499,10 @@ cardano_cbor_writer_write_signed_int(cardano_cbor_writer_t* writer, const int64_
 
   if (value < 0)
   {
-    return write_type_value(writer->buffer, CARDANO_CBOR_MAJOR_TYPE_NEGATIVE_INTEGER, -1 - value);
+    return write_type_value(writer, CARDANO_CBOR_MAJOR_TYPE_NEGATIVE_INTEGER, -1 - value);
   }
 
-  return write_type_value(writer->buffer, CARDANO_CBOR_MAJOR_TYPE_UNSIGNED_INTEGER, value);
+  return write_type_value(writer, CARDANO_CBOR_MAJOR_TYPE_UNSIGNED_INTEGER, value);
 }
 
 cardano_error_t
@@ -462,7 +515,7 @@ cardano_cbor_writer_write_null(cardano_cbor_writer_t* writer)
 
   static byte_t cbor_null = 0xf6U;
 
-  return cardano_buffer_write(writer->buffer, &cbor_null, sizeof(cbor_null));
+  return writer_write(writer, &cbor_null, sizeof(cbor_null));
 }
 
 cardano_error_t
@@ -475,7 +528,7 @@ cardano_cbor_writer_write_undefined(cardano_cbor_writer_t* writer)
 
   static byte_t cbor_undefined = 0xf7U;
 
-  return cardano_buffer_write(writer->buffer, &cbor_undefined, sizeof(cbor_undefined));
+  return writer_write(writer, &cbor_undefined, sizeof(cbor_undefined));
 }
 
 cardano_error_t
@@ -486,7 +539,7 @@ cardano_cbor_writer_write_tag(cardano_cbor_writer_t* writer, const cardano_cbor_
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return write_type_value(writer->buffer, CARDANO_CBOR_MAJOR_TYPE_TAG, tag);
+  return write_type_value(writer, CARDANO_CBOR_MAJOR_TYPE_TAG, tag);
 }
 
 size_t
@@ -497,6 +550,11 @@ cardano_cbor_writer_get_encode_size(cardano_cbor_writer_t* writer)
     return 0U;
   }
 
+  if (writer->buffer == NULL)
+  {
+    return writer->size;
+  }
+
   return cardano_buffer_get_size(writer->buffer);
 }
 
@@ -513,6 +571,11 @@ cardano_cbor_writer_encode(cardano_cbor_writer_t* writer, byte_t* data, const si
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (writer->buffer == NULL)
+  {
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
   const size_t buffer_size = cardano_buffer_get_size(writer->buffer);
 
   if (buffer_size > size)
@@ -538,6 +601,11 @@ cardano_cbor_writer_encode_in_buffer(cardano_cbor_writer_t* writer, cardano_buff
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (writer->buffer == NULL)
+  {
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
   *buffer = cardano_buffer_new(cardano_buffer_get_size(writer->buffer));
 
   if (*buffer == NULL)
@@ -579,6 +647,11 @@ cardano_cbor_writer_encode_hex(const cardano_cbor_writer_t* writer, char* dest,
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (writer->buffer == NULL)
+  {
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
   return cardano_buffer_to_hex(writer->buffer, dest, dest_size);
 }
 
@@ -590,10 +663,23 @@ cardano_cbor_writer_reset(cardano_cbor_writer_t* writer)
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_buffer_unref(&writer->buffer);
-  writer->buffer = cardano_buffer_new(128);
+  count_serialization(writer);
+  writer->size = 0U;
 
-  return CARDANO_SUCCESS;
+  if (writer->buffer == NULL)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  // Keep the allocation so a reused writer stops reallocating once it has seen its largest output.
+  cardano_error_t result = cardano_buffer_set_size(writer->buffer, 0U);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return cardano_buffer_seek(writer->buffer, 0U);
 }
 
 void
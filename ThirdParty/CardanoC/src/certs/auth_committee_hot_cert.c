@@ -107,7 +107,7 @@ cardano_auth_committee_hot_cert_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_auth_committee_hot_cert_deallocate;
 
   cardano_credential_ref(committee_cold_cred);
@@ -145,7 +145,7 @@ cardano_certificate_new(void)
   }
 
   data->base.ref_count                          = 1;
-  data->base.last_error[0]                      = '\0';
+  data->base.last_error                         = NULL;
   data->base.deallocator                        = cardano_certificate_deallocate;
   data->auth_committee_hot_cert                 = NULL;
   data->genesis_key_delegation_cert             = NULL;
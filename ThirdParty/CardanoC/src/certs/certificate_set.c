@@ -90,7 +90,7 @@ cardano_certificate_set_new(cardano_certificate_set_t** certificate_set)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_certificate_set_deallocate;
 
   list->array = cardano_array_new(128);
@@ -117,7 +117,7 @@ cardano_genesis_key_delegation_cert_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_genesis_key_delegation_cert_deallocate;
 
   cardano_blake2b_hash_ref(genesis_hash);
@@ -96,7 +96,7 @@ cardano_mir_cert_new(void)
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_mir_cert_deallocate;
 
   data->mir_to_pot_cert         = NULL;
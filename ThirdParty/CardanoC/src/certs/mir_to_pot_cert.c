@@ -91,7 +91,7 @@ cardano_mir_to_pot_cert_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_mir_to_pot_cert_deallocate;
 
   data->pot    = pot_type;
@@ -169,7 +169,7 @@ cardano_mir_to_stake_creds_cert_new(const cardano_mir_cert_pot_type_t pot_type,
   }
 
   map->base.ref_count     = 1;
-  map->base.last_error[0] = '\0';
+  map->base.last_error    = NULL;
   map->base.deallocator   = cardano_mir_to_stake_creds_cert_deallocate;
 
   map->array = cardano_array_new(128);
@@ -288,7 +288,7 @@ cardano_mir_to_stake_creds_cert_from_cbor(cardano_cbor_reader_t* reader, cardano
     }
 
     kvp->base.ref_count     = 0;
-    kvp->base.last_error[0] = '\0';
+    kvp->base.last_error    = NULL;
     kvp->base.deallocator   = cardano_mir_to_stake_creds_cert_kvp_deallocate;
     kvp->key                = key;
     kvp->value              = value;
@@ -449,7 +449,7 @@ cardano_mir_to_stake_creds_cert_insert(
   }
 
   kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
+  kvp->base.last_error    = NULL;
   kvp->base.deallocator   = cardano_mir_to_stake_creds_cert_kvp_deallocate;
   kvp->key                = credential;
   kvp->value              = amount;
@@ -101,7 +101,7 @@ cardano_pool_registration_cert_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_pool_registration_cert_deallocate;
 
   cardano_pool_params_ref(params);
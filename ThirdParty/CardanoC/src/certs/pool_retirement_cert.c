@@ -102,7 +102,7 @@ cardano_pool_retirement_cert_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_pool_retirement_cert_deallocate;
 
   cardano_blake2b_hash_ref(pool_key_hash);
@@ -110,7 +110,7 @@ cardano_registration_cert_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_registration_cert_deallocate;
 
   cardano_credential_ref(credential);
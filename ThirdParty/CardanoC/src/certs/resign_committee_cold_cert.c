@@ -104,7 +104,7 @@ cardano_resign_committee_cold_cert_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_resign_committee_cold_cert_deallocate;
 
   cardano_credential_ref(committee_cold_cred);
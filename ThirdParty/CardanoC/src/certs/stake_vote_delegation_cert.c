@@ -120,7 +120,7 @@ cardano_stake_vote_delegation_cert_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_stake_vote_delegation_cert_deallocate;
 
   cardano_credential_ref(credential);
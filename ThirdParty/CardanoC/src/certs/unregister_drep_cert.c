@@ -106,7 +106,7 @@ cardano_unregister_drep_cert_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_unregister_drep_cert_deallocate;
 
   cardano_credential_ref(credential);
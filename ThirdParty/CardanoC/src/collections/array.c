@@ -26,6 +26,7 @@
 #include <cardano/object.h>
 
 #include "../allocators.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <math.h>
@@ -71,8 +72,15 @@ grow_array_if_needed(cardano_array_t* array)
 
   if ((array->size + 1U) >= array->capacity)
   {
-    size_t             new_capacity = (size_t)ceil((float)array->capacity * (float)LIB_CARDANO_C_COLLECTION_GROW_FACTOR);
-    cardano_object_t** new_items    = (cardano_object_t**)_cardano_realloc(array->items, new_capacity * sizeof(cardano_object_t*));
+    size_t new_capacity = (size_t)ceil((float)array->capacity * (float)LIB_CARDANO_C_COLLECTION_GROW_FACTOR);
+
+    // Arrays made by concat or slice are exactly full, and may be empty, so the factor alone may not make room
+    if (new_capacity <= (array->size + 1U))
+    {
+      new_capacity = array->size + 2U;
+    }
+
+    cardano_object_t** new_items = (cardano_object_t**)_cardano_realloc(array->items, new_capacity * sizeof(cardano_object_t*));
 
     if (new_items == NULL)
     {
@@ -184,7 +192,7 @@ cardano_array_new(const size_t capacity)
   array->head               = 0;
   array->capacity           = capacity;
   array->base.ref_count     = 1;
-  array->base.last_error[0] = '\0';
+  array->base.last_error    = NULL;
   array->base.deallocator   = cardano_array_deallocate;
 
   return array;
@@ -239,7 +247,7 @@ cardano_array_concat(const cardano_array_t* lhs, const cardano_array_t* rhs)
   array->head               = 0;
   array->capacity           = array->size;
   array->base.ref_count     = 1;
-  array->base.last_error[0] = '\0';
+  array->base.last_error    = NULL;
   array->base.deallocator   = cardano_array_deallocate;
 
   return array;
@@ -309,7 +317,7 @@ cardano_array_slice(const cardano_array_t* array, size_t start, size_t end)
   sliced_array->head               = 0;
   sliced_array->capacity           = sliced_array->size;
   sliced_array->base.ref_count     = 1;
-  sliced_array->base.last_error[0] = '\0';
+  sliced_array->base.last_error    = NULL;
   sliced_array->base.deallocator   = cardano_array_deallocate;
 
   return sliced_array;
@@ -444,6 +452,38 @@ cardano_array_get(const cardano_array_t* array, const size_t index)
   return item;
 }
 
+cardano_object_t*
+cardano_array_peek(const cardano_array_t* array, const size_t index)
+{
+  if ((array == NULL) || (index >= array->size))
+  {
+    return NULL;
+  }
+
+  return array->items[index];
+}
+
+cardano_error_t
+cardano_array_for_each(const cardano_array_t* array, const cardano_array_for_each_func_t callback, void* context)
+{
+  if ((array == NULL) || (callback == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  for (size_t i = 0U; i < array->size; ++i)
+  {
+    cardano_error_t result = callback(array->items[i], i, context);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
 size_t
 cardano_array_push(cardano_array_t* array, cardano_object_t* item)
 {
@@ -472,6 +512,36 @@ cardano_array_push(cardano_array_t* array, cardano_object_t* item)
   return array->size;
 }
 
+size_t
+cardano_array_insert(cardano_array_t* array, const size_t index, cardano_object_t* item)
+{
+  if (array == NULL)
+  {
+    return 0U;
+  }
+
+  if ((item == NULL) || (index > array->size))
+  {
+    return array->size;
+  }
+
+  cardano_error_t error = grow_array_if_needed(array);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    cardano_array_set_last_error(array, cardano_error_to_string(error));
+    return array->size;
+  }
+
+  CARDANO_UNUSED(memmove(&array->items[index + 1U], &array->items[index], (array->size - index) * sizeof(cardano_object_t*)));
+
+  cardano_object_ref(item);
+  array->items[index] = item;
+  ++array->size;
+
+  return array->size;
+}
+
 cardano_object_t*
 cardano_array_pop(cardano_array_t* array)
 {
@@ -504,6 +574,37 @@ cardano_array_get_size(const cardano_array_t* array)
   return array->size;
 }
 
+cardano_error_t
+cardano_array_reserve(cardano_array_t* array, const size_t capacity)
+{
+  if (array == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (capacity >= ((SIZE_MAX / sizeof(cardano_object_t*)) - 1U))
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  // One slot more than the items, as growth keeps the array from ever being full
+  if (capacity >= array->capacity)
+  {
+    const size_t       new_capacity = capacity + 1U;
+    cardano_object_t** new_items    = (cardano_object_t**)_cardano_realloc(array->items, new_capacity * sizeof(cardano_object_t*));
+
+    if (new_items == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    array->items    = new_items;
+    array->capacity = new_capacity;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
 size_t
 cardano_array_get_capacity(const cardano_array_t* array)
 {
@@ -547,6 +648,48 @@ cardano_array_sort(cardano_array_t* array, cardano_array_compare_item_t compare,
   insertion_sort(array->items, array->size, compare, context);
 }
 
+size_t
+cardano_array_lower_bound(
+  const cardano_array_t*            array,
+  const cardano_array_key_compare_t compare,
+  const void*                       key,
+  bool*                             found)
+{
+  if (found != NULL)
+  {
+    *found = false;
+  }
+
+  if ((array == NULL) || (compare == NULL))
+  {
+    return 0U;
+  }
+
+  size_t low  = 0U;
+  size_t high = array->size;
+
+  while (low < high)
+  {
+    const size_t middle = low + ((high - low) / 2U);
+
+    if (compare(array->items[middle], key) < 0)
+    {
+      low = middle + 1U;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+
+  if ((found != NULL) && (low < array->size))
+  {
+    *found = (compare(array->items[low], key) == 0);
+  }
+
+  return low;
+}
+
 cardano_object_t*
 cardano_array_find(const cardano_array_t* array, cardano_array_unary_predicate_t predicate, const void* context)
 {
@@ -619,3 +762,26 @@ cardano_array_get_last_error(const cardano_array_t* array)
 {
   return cardano_object_get_last_error(&array->base);
 }
+
+void
+_cardano_array_add_footprint(const cardano_array_t* array, cardano_footprint_context_t* context, cardano_footprint_item_t add_item)
+{
+  if ((array == NULL) || !_cardano_footprint_visit(context, &array->base, CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION, sizeof(cardano_array_t)))
+  {
+    return;
+  }
+
+  _cardano_footprint_add_block(context, CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION, array->capacity * sizeof(cardano_object_t*));
+
+  for (size_t i = 0U; i < array->size; ++i)
+  {
+    if (add_item == NULL)
+    {
+      _cardano_footprint_add_unmeasured(context, array->items[i]);
+    }
+    else
+    {
+      add_item(array->items[i], context);
+    }
+  }
+}
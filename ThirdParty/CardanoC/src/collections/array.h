@@ -62,6 +62,31 @@ typedef int (*cardano_array_compare_item_t)(const cardano_object_t* lhs, const c
  */
 typedef bool (*cardano_array_unary_predicate_t)(const cardano_object_t* item, const void* context);
 
+/**
+ * \brief Defines a function pointer for comparing an object in an array against a search key.
+ *
+ * This typedef is used by \ref cardano_array_lower_bound to search sorted arrays by a key that is not itself an
+ * array element (for instance the key of a key value pair).
+ *
+ * \param[in] item The array element to compare.
+ * \param[in] key The search key.
+ *
+ * \return A negative value if `item` orders before `key`, 0 if it matches `key`, or a positive value if it orders
+ * after `key`.
+ */
+typedef int (*cardano_array_key_compare_t)(const cardano_object_t* item, const void* key);
+
+/**
+ * \brief Defines a function pointer invoked by \ref cardano_array_for_each for every element of an array.
+ *
+ * \param[in] item The element, borrowed: its reference count is not incremented.
+ * \param[in] index The index of the element.
+ * \param[in] context The context given to \ref cardano_array_for_each.
+ *
+ * \return \ref CARDANO_SUCCESS to continue the iteration; any other value stops it and is returned to the caller.
+ */
+typedef cardano_error_t (*cardano_array_for_each_func_t)(cardano_object_t* item, size_t index, void* context);
+
 /**
  * \brief A dynamic, reference-counted array with configurable exponential growth.
  *
@@ -179,6 +204,37 @@ CARDANO_EXPORT size_t cardano_array_refcount(const cardano_array_t* array);
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_object_t* cardano_array_get(const cardano_array_t* array, size_t index);
 
+/**
+ * \brief Retrieves an element of the array without taking a reference to it.
+ *
+ * Unlike \ref cardano_array_get, the reference count of the element is left untouched, so loops over arrays do
+ * not pay for a ref/unref pair per element.
+ *
+ * \param[in] array Target array.
+ * \param[in] index Index of the element to retrieve.
+ *
+ * \return A borrowed pointer to the element, or NULL if `array` is NULL or `index` is out of bounds. The pointer is
+ *         owned by the array and is only valid while the element remains in it; the caller must not unref it.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_object_t* cardano_array_peek(const cardano_array_t* array, size_t index);
+
+/**
+ * \brief Invokes a callback for every element of the array, in order, without touching reference counts.
+ *
+ * \param[in] array Target array.
+ * \param[in] callback The function invoked for every element. The array must not be modified while iterating.
+ * \param[in] context An optional context pointer passed to the callback.
+ *
+ * \return \ref CARDANO_SUCCESS if every element was visited, \ref CARDANO_ERROR_POINTER_IS_NULL if `array` or
+ *         `callback` is NULL, or the first error returned by the callback.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_array_for_each(
+  const cardano_array_t*        array,
+  cardano_array_for_each_func_t callback,
+  void*                         context);
+
 /**
  * \brief Adds an item to the end of the array.
  *
@@ -195,6 +251,23 @@ CARDANO_EXPORT cardano_object_t* cardano_array_get(const cardano_array_t* array,
 CARDANO_NODISCARD
 CARDANO_EXPORT size_t cardano_array_push(cardano_array_t* array, cardano_object_t* item);
 
+/**
+ * \brief Inserts an item at the given position of the array, shifting the following items up by one.
+ *
+ * Combined with \ref cardano_array_lower_bound, this keeps an array sorted without re-sorting it after every
+ * insertion.
+ *
+ * \warning This function increases the reference count of item, caller must free its own reference by calling \ref cardano_array_unref.
+ *
+ * \param[in] array Target array to which the item will be added.
+ * \param[in] index The position at which the item is inserted. Must not be greater than the size of the array.
+ * \param[in] item  Pointer to the item to be added to the array.
+ *
+ * \return The new size of the array after the item has been added, or the unchanged size on failure.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_array_insert(cardano_array_t* array, size_t index, cardano_object_t* item);
+
 /**
  * \brief Pops an item from the end of a cardano_array_t.
  *
@@ -257,6 +330,27 @@ CARDANO_EXPORT void cardano_array_clear(cardano_array_t* array);
  */
 CARDANO_EXPORT void cardano_array_sort(cardano_array_t* array, cardano_array_compare_item_t compare, void* context);
 
+/**
+ * Finds, by binary search, the first element of a sorted array that does not order before a key.
+ *
+ * The array must be sorted consistently with `compare`. No reference counts are touched.
+ *
+ * @param[in] array The sorted array to search.
+ * @param[in] compare The function comparing an element against `key`.
+ * @param[in] key The search key.
+ * @param[out] found Optional. Set to true if the element at the returned index matches `key`.
+ *
+ * @return The index of the first element not ordering before `key`, which is also where `key` must be inserted to
+ *         keep the array sorted. Returns the size of the array if every element orders before `key`, and 0 if
+ *         `array` or `compare` is NULL.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT size_t cardano_array_lower_bound(
+  const cardano_array_t*      array,
+  cardano_array_key_compare_t compare,
+  const void*                 key,
+  bool*                       found);
+
 /**
  * Searches for an element in the array that satisfies a predicate.
  *
@@ -295,6 +389,21 @@ CARDANO_NODISCARD
 CARDANO_EXPORT
 cardano_array_t* cardano_array_filter(const cardano_array_t* array, cardano_array_unary_predicate_t predicate, const void* context);
 
+/**
+ * \brief Makes room for a number of items, so that many pushes and inserts do not reallocate the array.
+ *
+ * Callers that know how many items they are about to add reserve them once instead of paying for every growth step.
+ * Never shrinks the array.
+ *
+ * \param[in] array Target array.
+ * \param[in] capacity The number of items the array must hold without growing.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if `array` is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED, in which case the array is left as it was.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_array_reserve(cardano_array_t* array, size_t capacity);
+
 /**
  * \brief Fetches the array's total capacity.
  *
@@ -34,32 +34,34 @@
 
 /* CONSTANTS *****************************************************************/
 
-static const size_t BUCKET_COUNT = 128U;
+static const size_t MIN_CAPACITY = 16U;
 
 /* STRUCTS *******************************************************************/
 
 /**
- * \brief Represents an entry in a Cardano set.
+ * \brief Represents a slot in the table of a Cardano set.
  *
- * This structure is a linked list node that contains a pointer to the stored object
- * and a pointer to the next entry in the bucket.
+ * A slot is empty when `object` is NULL. The full hash of the stored object is kept so the table can be grown and
+ * probed without calling the hash function again.
  */
-typedef struct cardano_set_entry_t
+typedef struct cardano_set_slot_t
 {
-    cardano_object_t*           object;
-    struct cardano_set_entry_t* next;
-} cardano_set_entry_t;
+    cardano_object_t* object;
+    uint64_t          hash;
+} cardano_set_slot_t;
 
 /**
  * \brief Represents a set data structure in the Cardano C library.
  *
- * This structure provides a hash set implementation. It stores unique elements in an array of
- * linked lists (buckets) to manage collisions.
+ * This structure provides an open-addressing hash set using Robin Hood linear probing. All slots live in a single
+ * contiguous table whose capacity is a power of two. The table grows when it becomes three quarters full, so lookups
+ * and inserts stay constant time however large the set grows.
  */
 typedef struct cardano_set_t
 {
     cardano_object_t           base;
-    cardano_set_entry_t*       buckets[128];
+    cardano_set_slot_t*        slots;
+    size_t                     capacity;
     size_t                     size;
     cardano_set_compare_item_t compare;
     cardano_set_hash_func_t    hash;
@@ -67,6 +69,26 @@ typedef struct cardano_set_t
 
 /* STATIC FUNCTIONS ***********************************************************/
 
+/**
+ * \brief Releases every object held by a set, leaving all slots empty.
+ *
+ * \param set The set to empty.
+ */
+static void
+release_slots(cardano_set_t* set)
+{
+  for (size_t i = 0U; i < set->capacity; ++i)
+  {
+    // Unref only clears the pointer it is given when the item is freed, so the slot is emptied through a copy
+    cardano_object_t* object = set->slots[i].object;
+
+    set->slots[i].object = NULL;
+    cardano_object_unref(&object);
+  }
+
+  set->size = 0U;
+}
+
 /**
  * \brief Deallocates a set object.
  *
@@ -86,25 +108,158 @@ cardano_set_deallocate(void* object)
   cardano_set_t* set = (cardano_set_t*)object;
   assert(set != NULL);
 
-  for (size_t i = 0U; i < BUCKET_COUNT; ++i)
+  release_slots(set);
+
+  _cardano_free(set->slots);
+  _cardano_free(set);
+}
+
+/**
+ * \brief Computes how far a slot is from the ideal slot of the hash it holds.
+ *
+ * \param set The set owning the slot.
+ * \param index The index of the slot.
+ * \param hash The hash stored in the slot.
+ *
+ * \return The probe distance.
+ */
+static size_t
+probe_distance(const cardano_set_t* set, const size_t index, const uint64_t hash)
+{
+  const size_t mask = set->capacity - 1U;
+
+  return (index + set->capacity - ((size_t)hash & mask)) & mask;
+}
+
+/**
+ * \brief Finds the slot holding an item.
+ *
+ * Robin Hood ordering guarantees that the item cannot be further than any slot whose own probe distance is shorter
+ * than the current one, so the scan stops there.
+ *
+ * \param set The set to search.
+ * \param item The item to look for.
+ * \param hash The hash of `item`.
+ *
+ * \return The index of the slot holding the item, or `set->capacity` if it is not in the set.
+ */
+static size_t
+find_slot(const cardano_set_t* set, const cardano_object_t* item, const uint64_t hash)
+{
+  if (set->capacity == 0U)
   {
-    cardano_set_entry_t* entry = set->buckets[i];
+    return 0U;
+  }
 
-    while (entry != NULL)
+  const size_t mask  = set->capacity - 1U;
+  size_t       index = (size_t)hash & mask;
+
+  for (size_t distance = 0U; distance < set->capacity; ++distance)
+  {
+    const cardano_set_slot_t* slot = &set->slots[index];
+
+    if ((slot->object == NULL) || (probe_distance(set, index, slot->hash) < distance))
+    {
+      break;
+    }
+
+    if ((slot->hash == hash) && (set->compare(slot->object, item) == 0))
     {
-      cardano_set_entry_t* next = entry->next;
+      return index;
+    }
+
+    index = (index + 1U) & mask;
+  }
+
+  return set->capacity;
+}
 
-      cardano_object_unref(&(entry->object));
+/**
+ * \brief Places an object known not to be in the set, displacing richer slots Robin Hood style.
+ *
+ * \param set The set, which must have at least one empty slot.
+ * \param object The object to place. Its reference is moved into the table.
+ * \param hash The hash of `object`.
+ */
+static void
+place_slot(cardano_set_t* set, cardano_object_t* object, uint64_t hash)
+{
+  const size_t mask     = set->capacity - 1U;
+  size_t       index    = (size_t)hash & mask;
+  size_t       distance = 0U;
 
-      _cardano_free(entry);
+  while (set->slots[index].object != NULL)
+  {
+    const size_t existing_distance = probe_distance(set, index, set->slots[index].hash);
 
-      entry = next;
+    if (existing_distance < distance)
+    {
+      cardano_set_slot_t displaced = set->slots[index];
+
+      set->slots[index].object = object;
+      set->slots[index].hash   = hash;
+
+      object   = displaced.object;
+      hash     = displaced.hash;
+      distance = existing_distance;
     }
 
-    set->buckets[i] = NULL;
+    index = (index + 1U) & mask;
+    ++distance;
   }
 
-  _cardano_free(set);
+  set->slots[index].object = object;
+  set->slots[index].hash   = hash;
+}
+
+/**
+ * \brief Makes room for one more item, growing the table if it would exceed three quarters of its capacity.
+ *
+ * \param set The set to grow.
+ *
+ * \return true on success, false if the new table could not be allocated.
+ */
+static bool
+reserve_slot(cardano_set_t* set)
+{
+  if ((set->capacity != 0U) && (((set->size + 1U) * 4U) <= (set->capacity * 3U)))
+  {
+    return true;
+  }
+
+  const size_t new_capacity = (set->capacity == 0U) ? MIN_CAPACITY : (set->capacity * 2U);
+
+  if (new_capacity < set->capacity)
+  {
+    return false;
+  }
+
+  cardano_set_slot_t* new_slots = (cardano_set_slot_t*)_cardano_malloc(new_capacity * sizeof(cardano_set_slot_t));
+
+  if (new_slots == NULL)
+  {
+    return false;
+  }
+
+  CARDANO_UNUSED(memset(new_slots, 0, new_capacity * sizeof(cardano_set_slot_t)));
+
+  cardano_set_slot_t* old_slots    = set->slots;
+  const size_t        old_capacity = set->capacity;
+
+  set->slots    = new_slots;
+  set->capacity = new_capacity;
+
+  for (size_t i = 0U; i < old_capacity; ++i)
+  {
+    if (old_slots[i].object != NULL)
+    {
+      place_slot(set, old_slots[i].object, old_slots[i].hash);
+    }
+  }
+
+  _cardano_free(old_slots);
+
+  return true;
 }
 
 /* DEFINITIONS ****************************************************************/
@@ -119,13 +274,13 @@ cardano_set_new(cardano_set_compare_item_t compare, cardano_set_hash_func_t hash
     return NULL;
   }
 
-  CARDANO_UNUSED(memset(set->buckets, 0, sizeof(set->buckets)));
-
+  set->slots              = NULL;
+  set->capacity           = 0;
   set->size               = 0;
   set->compare            = compare;
   set->hash               = hash;
   set->base.ref_count     = 1;
-  set->base.last_error[0] = '\0';
+  set->base.last_error    = NULL;
   set->base.deallocator   = cardano_set_deallocate;
 
   return set;
@@ -213,30 +368,20 @@ cardano_set_add(cardano_set_t* set, cardano_object_t* item)
     return 0;
   }
 
-  size_t index = set->hash(item) % BUCKET_COUNT;
+  const uint64_t hash = set->hash(item);
 
-  cardano_set_entry_t** entry = &(set->buckets[index]);
-
-  while (*entry != NULL)
+  if (find_slot(set, item, hash) < set->capacity)
   {
-    if (set->compare((*entry)->object, item) == 0)
-    {
-      return set->size;
-    }
-
-    entry = &((*entry)->next);
+    return set->size;
   }
 
-  *entry = (cardano_set_entry_t*)_cardano_malloc(sizeof(cardano_set_entry_t));
-
-  if (*entry == NULL)
+  if (!reserve_slot(set))
   {
     return 0;
   }
 
   cardano_object_ref(item);
-  (*entry)->object = item;
-  (*entry)->next   = NULL;
+  place_slot(set, item, hash);
 
   ++set->size;
 
@@ -251,17 +396,29 @@ cardano_set_has(cardano_set_t* set, cardano_object_t* item)
     return false;
   }
 
-  size_t index = set->hash(item) % BUCKET_COUNT;
+  return find_slot(set, item, set->hash(item)) < set->capacity;
+}
 
-  for (cardano_set_entry_t* entry = set->buckets[index]; entry != NULL; entry = entry->next)
+cardano_object_t*
+cardano_set_get(const cardano_set_t* set, const cardano_object_t* item)
+{
+  if ((set == NULL) || (item == NULL))
   {
-    if (set->compare(entry->object, item) == 0)
-    {
-      return true;
-    }
+    return NULL;
   }
 
-  return false;
+  const size_t index = find_slot(set, item, set->hash(item));
+
+  if (index >= set->capacity)
+  {
+    return NULL;
+  }
+
+  cardano_object_t* object = set->slots[index].object;
+
+  cardano_object_ref(object);
+
+  return object;
 }
 
 bool
@@ -272,28 +429,34 @@ cardano_set_delete(cardano_set_t* set, cardano_object_t* item)
     return false;
   }
 
-  size_t                index = set->hash(item) % BUCKET_COUNT;
-  cardano_set_entry_t** entry = &(set->buckets[index]);
+  size_t index = find_slot(set, item, set->hash(item));
 
-  while (*entry != NULL)
+  if (index >= set->capacity)
   {
-    if (set->compare((*entry)->object, item) == 0)
-    {
-      cardano_set_entry_t* toDelete = *entry;
-      *entry                        = (*entry)->next;
+    return false;
+  }
 
-      cardano_object_unref(&(toDelete->object));
-      _cardano_free(toDelete);
+  cardano_object_t* object = set->slots[index].object;
 
-      --set->size;
+  set->slots[index].object = NULL;
+  cardano_object_unref(&object);
 
-      return true;
-    }
+  // Backward-shift deletion: pull the following displaced slots one step closer to their ideal slot.
+  const size_t mask = set->capacity - 1U;
+  size_t       next = (index + 1U) & mask;
+
+  while ((set->slots[next].object != NULL) && (probe_distance(set, next, set->slots[next].hash) > 0U))
+  {
+    set->slots[index]       = set->slots[next];
+    set->slots[next].object = NULL;
 
-    entry = &((*entry)->next);
+    index = next;
+    next  = (next + 1U) & mask;
   }
 
-  return false;
+  --set->size;
+
+  return true;
 }
 
 cardano_array_t*
@@ -311,15 +474,17 @@ cardano_get_entries(cardano_set_t* set)
     return NULL;
   }
 
-  for (size_t i = 0; i < BUCKET_COUNT; ++i)
+  for (size_t i = 0; i < set->capacity; ++i)
   {
-    for (cardano_set_entry_t* entry = set->buckets[i]; entry != NULL; entry = entry->next)
+    if (set->slots[i].object == NULL)
     {
-      if (!cardano_array_push(array, entry->object))
-      {
-        cardano_array_unref(&array);
-        return NULL;
-      }
+      continue;
+    }
+
+    if (!cardano_array_push(array, set->slots[i].object))
+    {
+      cardano_array_unref(&array);
+      return NULL;
     }
   }
 
@@ -337,6 +502,18 @@ cardano_set_get_size(const cardano_set_t* set)
   return set->size;
 }
 
+uint64_t
+cardano_set_hash_bytes(uint64_t hash, const byte_t* data, const size_t size)
+{
+  for (size_t i = 0U; i < size; ++i)
+  {
+    hash ^= (uint64_t)data[i];
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
 void
 cardano_set_clear(cardano_set_t* set)
 {
@@ -345,22 +522,7 @@ cardano_set_clear(cardano_set_t* set)
     return;
   }
 
-  for (size_t i = 0; i < BUCKET_COUNT; ++i)
-  {
-    cardano_set_entry_t* entry = set->buckets[i];
-
-    while (entry != NULL)
-    {
-      cardano_set_entry_t* next = entry->next;
-      cardano_object_unref(&entry->object); // Assuming this is the correct function name.
-      _cardano_free(entry);
-      entry = next;
-    }
-
-    set->buckets[i] = NULL;
-  }
-
-  set->size = 0;
+  release_slots(set);
 }
 
 cardano_object_t*
@@ -371,15 +533,14 @@ cardano_set_find(const cardano_set_t* set, cardano_set_unary_predicate_t predica
     return NULL;
   }
 
-  for (size_t i = 0; i < BUCKET_COUNT; ++i)
+  for (size_t i = 0; i < set->capacity; ++i)
   {
-    for (cardano_set_entry_t* entry = set->buckets[i]; entry != NULL; entry = entry->next)
+    cardano_object_t* object = set->slots[i].object;
+
+    if ((object != NULL) && predicate(object, context))
     {
-      if (predicate(entry->object, context))
-      {
-        cardano_object_ref(entry->object);
-        return entry->object;
-      }
+      cardano_object_ref(object);
+      return object;
     }
   }
 
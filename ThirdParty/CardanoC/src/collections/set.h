@@ -31,6 +31,13 @@
 
 #include "array.h"
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The FNV-1a offset basis, the hash \ref cardano_set_hash_bytes starts from.
+ */
+#define CARDANO_SET_HASH_SEED 14695981039346656037ULL
+
 /* DECLARATIONS **************************************************************/
 
 #ifdef __cplusplus
@@ -182,6 +189,22 @@ CARDANO_EXPORT size_t cardano_set_add(cardano_set_t* set, cardano_object_t* item
 CARDANO_NODISCARD
 CARDANO_EXPORT bool cardano_set_has(cardano_set_t* set, cardano_object_t* item);
 
+/**
+ * \brief Retrieves the element of the set equal to the specified item.
+ *
+ * Unlike \ref cardano_set_has, this returns the stored element itself, which lets a set of key-value pairs
+ * act as a hash index: `item` only needs to carry the fields the set's hash and compare functions read, and
+ * can be a temporary that is never referenced by the set.
+ *
+ * \param[in] set A pointer to the set in which to search for the item.
+ * \param[in] item A pointer to an object equal to the one being searched for.
+ *
+ * \return A new reference to the stored element, or NULL if no element of the set is equal to `item`.
+ *         The caller must release it with \ref cardano_object_unref.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_object_t* cardano_set_get(const cardano_set_t* set, const cardano_object_t* item);
+
 /**
  * \brief Removes a specified item from the set.
  *
@@ -221,6 +244,21 @@ CARDANO_EXPORT cardano_array_t* cardano_get_entries(cardano_set_t* set);
 CARDANO_NODISCARD
 CARDANO_EXPORT size_t cardano_set_get_size(const cardano_set_t* set);
 
+/**
+ * \brief Computes the 64-bit FNV-1a hash of a byte buffer, continuing from a previous hash.
+ *
+ * Helper for \ref cardano_set_hash_func_t implementations that hash an object from its identifying bytes,
+ * such as a key hash, or a transaction hash followed by an index.
+ *
+ * \param[in] hash The hash to continue from, or \ref CARDANO_SET_HASH_SEED to start a new one.
+ * \param[in] data The bytes to hash.
+ * \param[in] size The number of bytes.
+ *
+ * \return The updated hash.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT uint64_t cardano_set_hash_bytes(uint64_t hash, const byte_t* data, size_t size);
+
 /**
  * Clears the contents of the specified set.
  *
@@ -111,7 +111,7 @@ cardano_anchor_new(
 
   (*anchor)->base.deallocator   = cardano_anchor_deallocate;
   (*anchor)->base.ref_count     = 1;
-  (*anchor)->base.last_error[0] = '\0';
+  (*anchor)->base.last_error    = NULL;
 
   CARDANO_UNUSED(memset((*anchor)->hash_bytes, 0, sizeof((*anchor)->hash_bytes)));
   CARDANO_UNUSED(memset((*anchor)->hash_hex, 0, sizeof((*anchor)->hash_hex)));
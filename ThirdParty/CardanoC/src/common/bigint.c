@@ -19,6 +19,7 @@
  * limitations under the License.
  */
 
+
 /* INCLUDES ******************************************************************/
 
 #include <cardano/buffer.h>
@@ -26,6 +27,7 @@
 #include <cardano/object.h>
 
 #include "../allocators.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
 
 #include "../external/gmp/mini-gmp.h"
@@ -33,6 +35,18 @@
 #include "../endian.h"
 #include <assert.h>
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Number of limbs needed to hold the magnitude of a 64-bit integer.
+ */
+#define INT64_LIMB_COUNT ((sizeof(uint64_t) + sizeof(mp_limb_t) - 1U) / sizeof(mp_limb_t))
+
+/**
+ * \brief Longest base 10 string, without sign, that always fits in an `int64_t`.
+ */
+static const size_t SMALL_DECIMAL_MAX_DIGITS = 18U;
+
 /* STRUCTURES ****************************************************************/
 
 /**
@@ -40,10 +54,16 @@
  *
  * The \ref cardano_bigint_t type is used for representing numeric values that are too large to be
  * represented by the standard numeric primitive types, such as int64_t or uint64_t.
+ *
+ * Values that fit in an `int64_t` are kept inline in `small`, and the common operations on them run on native
+ * integers. The `mpz` value is only meaningful when `is_small` is false; a result that no longer fits is promoted to
+ * it, and a result that fits again is demoted back.
  */
 typedef struct cardano_bigint_t
 {
     cardano_object_t base;
+    bool             is_small;
+    int64_t          small;
     mpz_t            mpz;
 } cardano_bigint_t;
 
@@ -75,7 +95,7 @@ cardano_bigint_deallocate(void* object)
 }
 
 /**
- * \brief Creates a new bigint object.
+ * \brief Creates a new bigint object holding zero.
  *
  * \return A pointer to the newly created bigint object, or `NULL` if the operation failed.
  */
@@ -90,14 +110,322 @@ cardano_bigint_new(void)
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_bigint_deallocate;
+  data->is_small           = true;
+  data->small              = 0;
 
   mpz_init(data->mpz);
 
   return data;
 }
 
+/**
+ * \brief Gets the magnitude of a 64-bit integer, including INT64_MIN.
+ *
+ * \param value The value.
+ *
+ * \return The absolute value of `value`.
+ */
+static uint64_t
+magnitude(const int64_t value)
+{
+  return (value < 0) ? ((uint64_t)(-(value + 1)) + 1U) : (uint64_t)value;
+}
+
+/**
+ * \brief Stores a native value in a bigint.
+ *
+ * \param bigint The bigint to update.
+ * \param value The value to store.
+ */
+static void
+set_small(cardano_bigint_t* bigint, const int64_t value)
+{
+  bigint->is_small = true;
+  bigint->small    = value;
+}
+
+/**
+ * \brief Fills a limb array with the magnitude of a 64-bit value.
+ *
+ * \param value The magnitude.
+ * \param limbs The limbs to fill, least significant first.
+ *
+ * \return The number of significant limbs.
+ */
+static mp_size_t
+fill_limbs(uint64_t value, mp_limb_t limbs[INT64_LIMB_COUNT])
+{
+  mp_size_t count = 0;
+
+  for (size_t i = 0U; i < INT64_LIMB_COUNT; ++i)
+  {
+    limbs[i] = (mp_limb_t)value;
+
+    if (value != 0U)
+    {
+      count = (mp_size_t)i + 1;
+    }
+
+    value = (sizeof(mp_limb_t) < sizeof(uint64_t)) ? (value >> (sizeof(mp_limb_t) * 8U)) : 0U;
+  }
+
+  return count;
+}
+
+/**
+ * \brief Gets an mpz view of a bigint without allocating.
+ *
+ * Inline values are exposed through a read-only mpz backed by `limbs`, so the returned pointer is only valid while
+ * `view` and `limbs` are in scope.
+ *
+ * \param bigint The bigint to view.
+ * \param view Storage for the read-only view of an inline value.
+ * \param limbs Storage for the limbs of an inline value.
+ *
+ * \return The mpz value of the bigint.
+ */
+static mpz_srcptr
+get_mpz(const cardano_bigint_t* bigint, mpz_t view, mp_limb_t limbs[INT64_LIMB_COUNT])
+{
+  if (!bigint->is_small)
+  {
+    return bigint->mpz;
+  }
+
+  const mp_size_t count = fill_limbs(magnitude(bigint->small), limbs);
+
+  return mpz_roinit_n(view, limbs, (bigint->small < 0) ? -count : count);
+}
+
+/**
+ * \brief Moves an inline value to the mpz representation, so it can be modified in place by mini-gmp.
+ *
+ * \param bigint The bigint to promote.
+ */
+static void
+promote(cardano_bigint_t* bigint)
+{
+  if (!bigint->is_small)
+  {
+    return;
+  }
+
+  mp_limb_t limbs[INT64_LIMB_COUNT];
+  mpz_t     view;
+
+  mpz_set(bigint->mpz, get_mpz(bigint, view, limbs));
+  bigint->is_small = false;
+}
+
+/**
+ * \brief Moves a bigint whose mpz value fits in an `int64_t` back to the inline representation.
+ *
+ * The mpz limbs are kept allocated, so a later promotion can reuse them.
+ *
+ * \param bigint The bigint to demote.
+ */
+static void
+demote(cardano_bigint_t* bigint)
+{
+  if (bigint->is_small || (mpz_size(bigint->mpz) > INT64_LIMB_COUNT))
+  {
+    return;
+  }
+
+  const mp_srcptr limbs = mpz_limbs_read(bigint->mpz);
+  const size_t    count = mpz_size(bigint->mpz);
+  uint64_t        value = 0U;
+
+  for (size_t i = count; i > 0U; --i)
+  {
+    value = (sizeof(mp_limb_t) < sizeof(uint64_t)) ? (value << (sizeof(mp_limb_t) * 8U)) : 0U;
+    value |= (uint64_t)limbs[i - 1U];
+  }
+
+  if (mpz_sgn(bigint->mpz) < 0)
+  {
+    if (value > ((uint64_t)INT64_MAX + 1U))
+    {
+      return;
+    }
+
+    set_small(bigint, (value == ((uint64_t)INT64_MAX + 1U)) ? INT64_MIN : -(int64_t)value);
+  }
+  else if (value <= (uint64_t)INT64_MAX)
+  {
+    set_small(bigint, (int64_t)value);
+  }
+  else
+  {
+    // Does not fit, stays in the mpz representation.
+  }
+}
+
+/**
+ * \brief Adds two native integers, detecting overflow.
+ *
+ * \param lhs The first operand.
+ * \param rhs The second operand.
+ * \param result On success, the sum.
+ *
+ * \return \c true if the sum fits in an `int64_t`.
+ */
+static bool
+checked_add(const int64_t lhs, const int64_t rhs, int64_t* result)
+{
+  if (((rhs > 0) && (lhs > (INT64_MAX - rhs))) || ((rhs < 0) && (lhs < (INT64_MIN - rhs))))
+  {
+    return false;
+  }
+
+  *result = lhs + rhs;
+
+  return true;
+}
+
+/**
+ * \brief Subtracts two native integers, detecting overflow.
+ *
+ * \param lhs The minuend.
+ * \param rhs The subtrahend.
+ * \param result On success, the difference.
+ *
+ * \return \c true if the difference fits in an `int64_t`.
+ */
+static bool
+checked_subtract(const int64_t lhs, const int64_t rhs, int64_t* result)
+{
+  if (((rhs < 0) && (lhs > (INT64_MAX + rhs))) || ((rhs > 0) && (lhs < (INT64_MIN + rhs))))
+  {
+    return false;
+  }
+
+  *result = lhs - rhs;
+
+  return true;
+}
+
+/**
+ * \brief Multiplies two native integers, detecting overflow.
+ *
+ * \param lhs The first operand.
+ * \param rhs The second operand.
+ * \param result On success, the product.
+ *
+ * \return \c true if the product fits in an `int64_t`.
+ */
+static bool
+checked_multiply(const int64_t lhs, const int64_t rhs, int64_t* result)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return !__builtin_mul_overflow(lhs, rhs, result);
+#else
+  const uint64_t abs_lhs  = magnitude(lhs);
+  const uint64_t abs_rhs  = magnitude(rhs);
+  const bool     negative = (lhs < 0) != (rhs < 0);
+  const uint64_t limit    = negative ? ((uint64_t)INT64_MAX + 1U) : (uint64_t)INT64_MAX;
+
+  if ((abs_lhs != 0U) && (abs_rhs > (limit / abs_lhs)))
+  {
+    return false;
+  }
+
+  const uint64_t product = abs_lhs * abs_rhs;
+
+  *result = negative ? ((product == ((uint64_t)INT64_MAX + 1U)) ? INT64_MIN : -(int64_t)product) : (int64_t)product;
+
+  return true;
+#endif
+}
+
+/**
+ * \brief Writes an inline value as a string, in the same format as `mpz_get_str`.
+ *
+ * \param value The value to format.
+ * \param base The base, from 2 to 36.
+ * \param buffer The buffer to write to; 66 bytes are always enough.
+ *
+ * \return The length of the string, excluding the null terminator.
+ */
+static size_t
+format_small(const int64_t value, const int32_t base, char buffer[66])
+{
+  static const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+  char     reversed[64];
+  size_t   count     = 0U;
+  size_t   length    = 0U;
+  uint64_t remaining = magnitude(value);
+
+  do
+  {
+    reversed[count] = digits[remaining % (uint64_t)base];
+    remaining /= (uint64_t)base;
+    ++count;
+  }
+  while (remaining != 0U);
+
+  if (value < 0)
+  {
+    buffer[length] = '-';
+    ++length;
+  }
+
+  while (count > 0U)
+  {
+    --count;
+    buffer[length] = reversed[count];
+    ++length;
+  }
+
+  buffer[length] = '\0';
+
+  return length;
+}
+
+/**
+ * \brief Parses a short base 10 string into a native integer.
+ *
+ * Only plain `[-]digits` strings short enough to never overflow are accepted; anything else is left to mini-gmp.
+ *
+ * \param string The null terminated string to parse.
+ * \param value On success, the parsed value.
+ *
+ * \return \c true if the string was parsed.
+ */
+static bool
+parse_small_decimal(const char* string, int64_t* value)
+{
+  const bool negative = (string[0] == '-');
+  size_t     index    = negative ? 1U : 0U;
+  size_t     digits   = 0U;
+  int64_t    result   = 0;
+
+  while (string[index] != '\0')
+  {
+    if ((string[index] < '0') || (string[index] > '9') || (digits == SMALL_DECIMAL_MAX_DIGITS))
+    {
+      return false;
+    }
+
+    result = (result * 10) + (int64_t)(string[index] - '0');
+
+    ++digits;
+    ++index;
+  }
+
+  if (digits == 0U)
+  {
+    return false;
+  }
+
+  *value = negative ? -result : result;
+
+  return true;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -115,7 +443,15 @@ cardano_bigint_clone(const cardano_bigint_t* bigint, cardano_bigint_t** clone)
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  mpz_init_set((*clone)->mpz, bigint->mpz);
+  if (bigint->is_small)
+  {
+    set_small(*clone, bigint->small);
+  }
+  else
+  {
+    mpz_set((*clone)->mpz, bigint->mpz);
+    (*clone)->is_small = false;
+  }
 
   return CARDANO_SUCCESS;
 }
@@ -140,8 +476,17 @@ cardano_bigint_from_string(const char* string, const size_t size, const int32_t
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
+  int64_t value = 0;
+
+  if ((base == 10) && parse_small_decimal(string, &value))
+  {
+    set_small(*bigint, value);
+
+    return CARDANO_SUCCESS;
+  }
+
   // cppcheck-suppress misra-c2012-11.8; Reason: False positive.
-  int ret = mpz_init_set_str((*bigint)->mpz, string, base);
+  int ret = mpz_set_str((*bigint)->mpz, string, base);
 
   if (ret != 0)
   {
@@ -150,6 +495,9 @@ cardano_bigint_from_string(const char* string, const size_t size, const int32_t
     return CARDANO_ERROR_CONVERSION_FAILED;
   }
 
+  (*bigint)->is_small = false;
+  demote(*bigint);
+
   return CARDANO_SUCCESS;
 }
 
@@ -161,14 +509,25 @@ cardano_bigint_get_string_size(cardano_bigint_t* bigint, const int32_t base)
     return 0U;
   }
 
-  char* temp = mpz_get_str(NULL, base, bigint->mpz);
+  if (bigint->is_small && (base >= 2) && (base <= 36))
+  {
+    char buffer[66];
+
+    return format_small(bigint->small, base, buffer) + 1U;
+  }
+
+  mp_limb_t        limbs[INT64_LIMB_COUNT];
+  mpz_t            view;
+  const mpz_srcptr value = get_mpz(bigint, view, limbs);
+
+  char* temp = mpz_get_str(NULL, base, value);
 
   if (temp == NULL)
   {
     return 0;
   }
 
-  const size_t num_digits = mpz_sizeinbase(bigint->mpz, base);
+  const size_t num_digits = mpz_sizeinbase(value, base);
   const size_t max_size   = num_digits + 1U + 1U;
 
   const size_t digits = cardano_safe_strlen(temp, max_size);
@@ -193,17 +552,7 @@ cardano_bigint_from_int(int64_t value, cardano_bigint_t** bigint)
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  mpz_init((*bigint)->mpz);
-
-  int      order     = cardano_is_little_endian() ? -1 : 1;
-  uint64_t abs_value = (value < 0) ? (uint64_t)(-value) : (uint64_t)value;
-
-  mpz_import((*bigint)->mpz, 1, order, sizeof(abs_value), 0, 0, &abs_value);
-
-  if (value < 0)
-  {
-    mpz_neg((*bigint)->mpz, (*bigint)->mpz);
-  }
+  set_small(*bigint, value);
 
   return CARDANO_SUCCESS;
 }
@@ -223,11 +572,17 @@ cardano_bigint_from_unsigned_int(uint64_t value, cardano_bigint_t** bigint)
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  mpz_init((*bigint)->mpz);
+  if (value <= (uint64_t)INT64_MAX)
+  {
+    set_small(*bigint, (int64_t)value);
+
+    return CARDANO_SUCCESS;
+  }
 
   int order = cardano_is_little_endian() ? -1 : 1;
 
   mpz_import((*bigint)->mpz, 1, order, sizeof(value), 0, 0, &value);
+  (*bigint)->is_small = false;
 
   return CARDANO_SUCCESS;
 }
@@ -251,6 +606,22 @@ cardano_bigint_from_bytes(
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
+  if (size < sizeof(uint64_t))
+  {
+    uint64_t value = 0U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      const size_t index = (byte_order == CARDANO_BYTE_ORDER_LITTLE_ENDIAN) ? (size - 1U - i) : i;
+
+      value = (value << 8U) | (uint64_t)data[index];
+    }
+
+    set_small(*bigint, (int64_t)value);
+
+    return CARDANO_SUCCESS;
+  }
+
   int32_t       order         = 1;
   const int32_t size_per_word = 1;
   const int32_t nails         = 0;
@@ -261,6 +632,8 @@ cardano_bigint_from_bytes(
   }
 
   mpz_import((*bigint)->mpz, size, order, size_per_word, 0, nails, data);
+  (*bigint)->is_small = false;
+  demote(*bigint);
 
   return CARDANO_SUCCESS;
 }
@@ -277,7 +650,25 @@ cardano_bigint_to_string(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  char* temp = mpz_get_str(NULL, base, bigint->mpz);
+  if (bigint->is_small && (base >= 2) && (base <= 36))
+  {
+    char         buffer[66];
+    const size_t length = format_small(bigint->small, base, buffer);
+
+    if ((length + 1U) > size)
+    {
+      return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    cardano_safe_memcpy(string, size, buffer, length + 1U);
+
+    return CARDANO_SUCCESS;
+  }
+
+  mp_limb_t limbs[INT64_LIMB_COUNT];
+  mpz_t     view;
+
+  char* temp = mpz_get_str(NULL, base, get_mpz(bigint, view, limbs));
 
   if (temp == NULL)
   {
@@ -294,7 +685,7 @@ cardano_bigint_to_string(
   }
 
   cardano_safe_memcpy(string, size, temp, temp_len);
-  string[size - 1U] = '\0';
+  string[temp_len] = '\0';
 
   _cardano_free(temp);
 
@@ -309,6 +700,11 @@ cardano_bigint_to_int(const cardano_bigint_t* bigint)
     return 0;
   }
 
+  if (bigint->is_small)
+  {
+    return bigint->small;
+  }
+
   const int order      = cardano_is_little_endian() ? -1 : 1;
   uint64_t  abs_result = 0;
 
@@ -325,6 +721,11 @@ cardano_bigint_to_unsigned_int(const cardano_bigint_t* bigint)
     return 0;
   }
 
+  if (bigint->is_small)
+  {
+    return magnitude(bigint->small);
+  }
+
   const int order  = cardano_is_little_endian() ? -1 : 1;
   uint64_t  result = 0;
 
@@ -336,7 +737,10 @@ cardano_bigint_to_unsigned_int(const cardano_bigint_t* bigint)
 size_t
 cardano_bigint_get_bytes_size(const cardano_bigint_t* bigint)
 {
-  return (mpz_sizeinbase(bigint->mpz, 2) + 7U) / 8U;
+  mp_limb_t limbs[INT64_LIMB_COUNT];
+  mpz_t     view;
+
+  return (mpz_sizeinbase(get_mpz(bigint, view, limbs), 2) + 7U) / 8U;
 }
 
 cardano_error_t
@@ -362,8 +766,10 @@ cardano_bigint_to_bytes(
   const int32_t order         = (byte_order == CARDANO_BYTE_ORDER_BIG_ENDIAN) ? (int32_t)1 : (int32_t)-1;
   const int32_t size_per_word = 1;
   const int32_t nails         = 0;
+  mp_limb_t     limbs[INT64_LIMB_COUNT];
+  mpz_t         view;
 
-  mpz_export(data, &count, order, size_per_word, 0, nails, bigint->mpz);
+  mpz_export(data, &count, order, size_per_word, 0, nails, get_mpz(bigint, view, limbs));
 
   if (count != size)
   {
@@ -384,7 +790,23 @@ cardano_bigint_add(
     return;
   }
 
-  mpz_add(result->mpz, lhs->mpz, rhs->mpz);
+  int64_t sum = 0;
+
+  if (lhs->is_small && rhs->is_small && checked_add(lhs->small, rhs->small, &sum))
+  {
+    set_small(result, sum);
+
+    return;
+  }
+
+  mp_limb_t lhs_limbs[INT64_LIMB_COUNT];
+  mp_limb_t rhs_limbs[INT64_LIMB_COUNT];
+  mpz_t     lhs_view;
+  mpz_t     rhs_view;
+
+  mpz_add(result->mpz, get_mpz(lhs, lhs_view, lhs_limbs), get_mpz(rhs, rhs_view, rhs_limbs));
+  result->is_small = false;
+  demote(result);
 }
 
 void
@@ -398,7 +820,23 @@ cardano_bigint_subtract(
     return;
   }
 
-  mpz_sub(result->mpz, lhs->mpz, rhs->mpz);
+  int64_t difference = 0;
+
+  if (lhs->is_small && rhs->is_small && checked_subtract(lhs->small, rhs->small, &difference))
+  {
+    set_small(result, difference);
+
+    return;
+  }
+
+  mp_limb_t lhs_limbs[INT64_LIMB_COUNT];
+  mp_limb_t rhs_limbs[INT64_LIMB_COUNT];
+  mpz_t     lhs_view;
+  mpz_t     rhs_view;
+
+  mpz_sub(result->mpz, get_mpz(lhs, lhs_view, lhs_limbs), get_mpz(rhs, rhs_view, rhs_limbs));
+  result->is_small = false;
+  demote(result);
 }
 
 void
@@ -412,7 +850,23 @@ cardano_bigint_multiply(
     return;
   }
 
-  mpz_mul(result->mpz, lhs->mpz, rhs->mpz);
+  int64_t product = 0;
+
+  if (lhs->is_small && rhs->is_small && checked_multiply(lhs->small, rhs->small, &product))
+  {
+    set_small(result, product);
+
+    return;
+  }
+
+  mp_limb_t lhs_limbs[INT64_LIMB_COUNT];
+  mp_limb_t rhs_limbs[INT64_LIMB_COUNT];
+  mpz_t     lhs_view;
+  mpz_t     rhs_view;
+
+  mpz_mul(result->mpz, get_mpz(lhs, lhs_view, lhs_limbs), get_mpz(rhs, rhs_view, rhs_limbs));
+  result->is_small = false;
+  demote(result);
 }
 
 void
@@ -426,7 +880,21 @@ cardano_bigint_divide(
     return;
   }
 
-  mpz_tdiv_q(result->mpz, dividend->mpz, divisor->mpz);
+  if (dividend->is_small && divisor->is_small && (divisor->small != 0) && !((dividend->small == INT64_MIN) && (divisor->small == -1)))
+  {
+    set_small(result, dividend->small / divisor->small);
+
+    return;
+  }
+
+  mp_limb_t dividend_limbs[INT64_LIMB_COUNT];
+  mp_limb_t divisor_limbs[INT64_LIMB_COUNT];
+  mpz_t     dividend_view;
+  mpz_t     divisor_view;
+
+  mpz_tdiv_q(result->mpz, get_mpz(dividend, dividend_view, dividend_limbs), get_mpz(divisor, divisor_view, divisor_limbs));
+  result->is_small = false;
+  demote(result);
 }
 
 void
@@ -441,7 +909,27 @@ cardano_bigint_divide_and_reminder(
     return;
   }
 
-  mpz_tdiv_qr(quotient->mpz, reminder->mpz, dividend->mpz, divisor->mpz);
+  if (dividend->is_small && divisor->is_small && (divisor->small != 0) && !((dividend->small == INT64_MIN) && (divisor->small == -1)))
+  {
+    const int64_t q = dividend->small / divisor->small;
+    const int64_t r = dividend->small % divisor->small;
+
+    set_small(quotient, q);
+    set_small(reminder, r);
+
+    return;
+  }
+
+  mp_limb_t dividend_limbs[INT64_LIMB_COUNT];
+  mp_limb_t divisor_limbs[INT64_LIMB_COUNT];
+  mpz_t     dividend_view;
+  mpz_t     divisor_view;
+
+  mpz_tdiv_qr(quotient->mpz, reminder->mpz, get_mpz(dividend, dividend_view, dividend_limbs), get_mpz(divisor, divisor_view, divisor_limbs));
+  quotient->is_small = false;
+  reminder->is_small = false;
+  demote(quotient);
+  demote(reminder);
 }
 
 void
@@ -455,7 +943,21 @@ cardano_bigint_reminder(
     return;
   }
 
-  mpz_tdiv_r(reminder->mpz, dividend->mpz, divisor->mpz);
+  if (dividend->is_small && divisor->is_small && (divisor->small != 0) && (divisor->small != -1))
+  {
+    set_small(reminder, dividend->small % divisor->small);
+
+    return;
+  }
+
+  mp_limb_t dividend_limbs[INT64_LIMB_COUNT];
+  mp_limb_t divisor_limbs[INT64_LIMB_COUNT];
+  mpz_t     dividend_view;
+  mpz_t     divisor_view;
+
+  mpz_tdiv_r(reminder->mpz, get_mpz(dividend, dividend_view, dividend_limbs), get_mpz(divisor, divisor_view, divisor_limbs));
+  reminder->is_small = false;
+  demote(reminder);
 }
 
 void
@@ -466,7 +968,19 @@ cardano_bigint_abs(const cardano_bigint_t* bignum, cardano_bigint_t* result)
     return;
   }
 
-  mpz_abs(result->mpz, bignum->mpz);
+  if (bignum->is_small && (bignum->small != INT64_MIN))
+  {
+    set_small(result, (bignum->small < 0) ? -bignum->small : bignum->small);
+
+    return;
+  }
+
+  mp_limb_t limbs[INT64_LIMB_COUNT];
+  mpz_t     view;
+
+  mpz_abs(result->mpz, get_mpz(bignum, view, limbs));
+  result->is_small = false;
+  demote(result);
 }
 
 void
@@ -477,7 +991,14 @@ cardano_bigint_gcd(const cardano_bigint_t* lhs, const cardano_bigint_t* rhs, car
     return;
   }
 
-  mpz_gcd(result->mpz, lhs->mpz, rhs->mpz);
+  mp_limb_t lhs_limbs[INT64_LIMB_COUNT];
+  mp_limb_t rhs_limbs[INT64_LIMB_COUNT];
+  mpz_t     lhs_view;
+  mpz_t     rhs_view;
+
+  mpz_gcd(result->mpz, get_mpz(lhs, lhs_view, lhs_limbs), get_mpz(rhs, rhs_view, rhs_limbs));
+  result->is_small = false;
+  demote(result);
 }
 
 void
@@ -488,7 +1009,19 @@ cardano_bigint_negate(const cardano_bigint_t* bignum, cardano_bigint_t* result)
     return;
   }
 
-  mpz_neg(result->mpz, bignum->mpz);
+  if (bignum->is_small && (bignum->small != INT64_MIN))
+  {
+    set_small(result, -bignum->small);
+
+    return;
+  }
+
+  mp_limb_t limbs[INT64_LIMB_COUNT];
+  mpz_t     view;
+
+  mpz_neg(result->mpz, get_mpz(bignum, view, limbs));
+  result->is_small = false;
+  demote(result);
 }
 
 int32_t
@@ -499,6 +1032,11 @@ cardano_bigint_signum(const cardano_bigint_t* bignum)
     return 0;
   }
 
+  if (bignum->is_small)
+  {
+    return (bignum->small > 0) ? 1 : ((bignum->small < 0) ? -1 : 0);
+  }
+
   return mpz_sgn(bignum->mpz);
 }
 
@@ -523,7 +1061,21 @@ cardano_bigint_mod_pow(
     return;
   }
 
-  mpz_powm(result->mpz, base->mpz, exponent->mpz, modulus->mpz);
+  mp_limb_t base_limbs[INT64_LIMB_COUNT];
+  mp_limb_t exponent_limbs[INT64_LIMB_COUNT];
+  mp_limb_t modulus_limbs[INT64_LIMB_COUNT];
+  mpz_t     base_view;
+  mpz_t     exponent_view;
+  mpz_t     modulus_view;
+
+  mpz_powm(
+    result->mpz,
+    get_mpz(base, base_view, base_limbs),
+    get_mpz(exponent, exponent_view, exponent_limbs),
+    get_mpz(modulus, modulus_view, modulus_limbs));
+
+  result->is_small = false;
+  demote(result);
 }
 
 void
@@ -537,7 +1089,14 @@ cardano_bigint_mod_inverse(
     return;
   }
 
-  mpz_invert(result->mpz, bignum->mpz, modulus->mpz);
+  mp_limb_t bignum_limbs[INT64_LIMB_COUNT];
+  mp_limb_t modulus_limbs[INT64_LIMB_COUNT];
+  mpz_t     bignum_view;
+  mpz_t     modulus_view;
+
+  promote(result);
+  mpz_invert(result->mpz, get_mpz(bignum, bignum_view, bignum_limbs), get_mpz(modulus, modulus_view, modulus_limbs));
+  demote(result);
 }
 
 void
@@ -551,7 +1110,21 @@ cardano_bigint_and(
     return;
   }
 
-  mpz_and(result->mpz, lhs->mpz, rhs->mpz);
+  if (lhs->is_small && rhs->is_small)
+  {
+    set_small(result, lhs->small & rhs->small);
+
+    return;
+  }
+
+  mp_limb_t lhs_limbs[INT64_LIMB_COUNT];
+  mp_limb_t rhs_limbs[INT64_LIMB_COUNT];
+  mpz_t     lhs_view;
+  mpz_t     rhs_view;
+
+  mpz_and(result->mpz, get_mpz(lhs, lhs_view, lhs_limbs), get_mpz(rhs, rhs_view, rhs_limbs));
+  result->is_small = false;
+  demote(result);
 }
 
 void
@@ -565,7 +1138,21 @@ cardano_bigint_or(
     return;
   }
 
-  mpz_ior(result->mpz, lhs->mpz, rhs->mpz);
+  if (lhs->is_small && rhs->is_small)
+  {
+    set_small(result, lhs->small | rhs->small);
+
+    return;
+  }
+
+  mp_limb_t lhs_limbs[INT64_LIMB_COUNT];
+  mp_limb_t rhs_limbs[INT64_LIMB_COUNT];
+  mpz_t     lhs_view;
+  mpz_t     rhs_view;
+
+  mpz_ior(result->mpz, get_mpz(lhs, lhs_view, lhs_limbs), get_mpz(rhs, rhs_view, rhs_limbs));
+  result->is_small = false;
+  demote(result);
 }
 
 void
@@ -579,7 +1166,21 @@ cardano_bigint_xor(
     return;
   }
 
-  mpz_xor(result->mpz, lhs->mpz, rhs->mpz);
+  if (lhs->is_small && rhs->is_small)
+  {
+    set_small(result, lhs->small ^ rhs->small);
+
+    return;
+  }
+
+  mp_limb_t lhs_limbs[INT64_LIMB_COUNT];
+  mp_limb_t rhs_limbs[INT64_LIMB_COUNT];
+  mpz_t     lhs_view;
+  mpz_t     rhs_view;
+
+  mpz_xor(result->mpz, get_mpz(lhs, lhs_view, lhs_limbs), get_mpz(rhs, rhs_view, rhs_limbs));
+  result->is_small = false;
+  demote(result);
 }
 
 void
@@ -592,7 +1193,16 @@ cardano_bigint_not(
     return;
   }
 
+  if (bigint->is_small)
+  {
+    set_small(result, ~bigint->small);
+
+    return;
+  }
+
   mpz_com(result->mpz, bigint->mpz);
+  result->is_small = false;
+  demote(result);
 }
 
 bool
@@ -605,7 +1215,10 @@ cardano_bigint_test_bit(
     return false;
   }
 
-  return mpz_tstbit(bigint->mpz, n);
+  mp_limb_t limbs[INT64_LIMB_COUNT];
+  mpz_t     view;
+
+  return mpz_tstbit(get_mpz(bigint, view, limbs), n);
 }
 
 void
@@ -618,7 +1231,9 @@ cardano_bigint_set_bit(
     return;
   }
 
+  promote(bigint);
   mpz_setbit(bigint->mpz, n);
+  demote(bigint);
 }
 
 void
@@ -631,7 +1246,9 @@ cardano_bigint_clear_bit(
     return;
   }
 
+  promote(bigint);
   mpz_clrbit(bigint->mpz, n);
+  demote(bigint);
 }
 
 void
@@ -644,7 +1261,9 @@ cardano_bigint_flip_bit(
     return;
   }
 
+  promote(bigint);
   mpz_combit(bigint->mpz, n);
+  demote(bigint);
 }
 
 size_t
@@ -655,6 +1274,20 @@ cardano_bigint_bit_count(const cardano_bigint_t* bigint)
     return 0;
   }
 
+  if (bigint->is_small)
+  {
+    uint64_t value = magnitude(bigint->small);
+    size_t   count = 0;
+
+    while (value != 0U)
+    {
+      value &= value - 1U;
+      ++count;
+    }
+
+    return count;
+  }
+
   mpz_t tmp;
   mpz_init_set(tmp, bigint->mpz);
 
@@ -686,7 +1319,10 @@ cardano_bigint_bit_length(const cardano_bigint_t* bigint)
     return 0;
   }
 
-  return mpz_sizeinbase(bigint->mpz, 2);
+  mp_limb_t limbs[INT64_LIMB_COUNT];
+  mpz_t     view;
+
+  return mpz_sizeinbase(get_mpz(bigint, view, limbs), 2);
 }
 
 void
@@ -700,13 +1336,13 @@ cardano_bigint_min(
     return;
   }
 
-  if (mpz_cmp(lhs->mpz, rhs->mpz) <= 0)
+  if (cardano_bigint_compare(lhs, rhs) <= 0)
   {
-    mpz_set(result->mpz, lhs->mpz);
+    cardano_bigint_assign(lhs, result);
   }
   else
   {
-    mpz_set(result->mpz, rhs->mpz);
+    cardano_bigint_assign(rhs, result);
   }
 }
 
@@ -721,13 +1357,13 @@ cardano_bigint_max(
     return;
   }
 
-  if (mpz_cmp(lhs->mpz, rhs->mpz) >= 0)
+  if (cardano_bigint_compare(lhs, rhs) >= 0)
   {
-    mpz_set(result->mpz, lhs->mpz);
+    cardano_bigint_assign(lhs, result);
   }
   else
   {
-    mpz_set(result->mpz, rhs->mpz);
+    cardano_bigint_assign(rhs, result);
   }
 }
 
@@ -742,7 +1378,12 @@ cardano_bigint_shift_left(
     return;
   }
 
-  mpz_mul_2exp(result->mpz, n->mpz, bits);
+  mp_limb_t limbs[INT64_LIMB_COUNT];
+  mpz_t     view;
+
+  mpz_mul_2exp(result->mpz, get_mpz(n, view, limbs), bits);
+  result->is_small = false;
+  demote(result);
 }
 
 void
@@ -756,7 +1397,12 @@ cardano_bigint_shift_right(
     return;
   }
 
-  mpz_fdiv_q_2exp(result->mpz, n->mpz, bits);
+  mp_limb_t limbs[INT64_LIMB_COUNT];
+  mpz_t     view;
+
+  mpz_fdiv_q_2exp(result->mpz, get_mpz(n, view, limbs), bits);
+  result->is_small = false;
+  demote(result);
 }
 
 bool
@@ -767,7 +1413,7 @@ cardano_bigint_equals(const cardano_bigint_t* lhs, const cardano_bigint_t* rhs)
     return false;
   }
 
-  return mpz_cmp(lhs->mpz, rhs->mpz) == 0;
+  return cardano_bigint_compare(lhs, rhs) == 0;
 }
 
 int32_t
@@ -780,7 +1426,17 @@ cardano_bigint_compare(
     return 0;
   }
 
-  return mpz_cmp(lhs->mpz, rhs->mpz);
+  if (lhs->is_small && rhs->is_small)
+  {
+    return (lhs->small > rhs->small) ? 1 : ((lhs->small < rhs->small) ? -1 : 0);
+  }
+
+  mp_limb_t lhs_limbs[INT64_LIMB_COUNT];
+  mp_limb_t rhs_limbs[INT64_LIMB_COUNT];
+  mpz_t     lhs_view;
+  mpz_t     rhs_view;
+
+  return mpz_cmp(get_mpz(lhs, lhs_view, lhs_limbs), get_mpz(rhs, rhs_view, rhs_limbs));
 }
 
 bool
@@ -791,7 +1447,7 @@ cardano_bigint_is_zero(const cardano_bigint_t* n)
     return false;
   }
 
-  return mpz_sgn(n->mpz) == 0;
+  return cardano_bigint_signum(n) == 0;
 }
 
 void
@@ -802,7 +1458,16 @@ cardano_bigint_increment(cardano_bigint_t* n)
     return;
   }
 
+  if (n->is_small && (n->small != INT64_MAX))
+  {
+    n->small += 1;
+
+    return;
+  }
+
+  promote(n);
   mpz_add_ui(n->mpz, n->mpz, 1);
+  demote(n);
 }
 
 void
@@ -813,7 +1478,16 @@ cardano_bigint_decrement(cardano_bigint_t* n)
     return;
   }
 
+  if (n->is_small && (n->small != INT64_MIN))
+  {
+    n->small -= 1;
+
+    return;
+  }
+
+  promote(n);
   mpz_sub_ui(n->mpz, n->mpz, 1);
+  demote(n);
 }
 
 void
@@ -824,7 +1498,12 @@ cardano_bigint_pow(const cardano_bigint_t* base, const uint64_t exponent, cardan
     return;
   }
 
-  mpz_pow_ui(result->mpz, base->mpz, (unsigned long)exponent);
+  mp_limb_t limbs[INT64_LIMB_COUNT];
+  mpz_t     view;
+
+  mpz_pow_ui(result->mpz, get_mpz(base, view, limbs), (unsigned long)exponent);
+  result->is_small = false;
+  demote(result);
 }
 
 void
@@ -837,7 +1516,15 @@ cardano_bigint_assign(
     return;
   }
 
+  if (destination->is_small)
+  {
+    set_small(source, destination->small);
+
+    return;
+  }
+
   mpz_set(source->mpz, destination->mpz);
+  source->is_small = false;
 }
 
 void
@@ -890,4 +1577,15 @@ const char*
 cardano_bigint_get_last_error(const cardano_bigint_t* bigint)
 {
   return cardano_object_get_last_error(&bigint->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_bigint_add_footprint(const cardano_bigint_t* bigint, cardano_footprint_context_t* context)
+{
+  if ((bigint == NULL) || !_cardano_footprint_visit(context, &bigint->base, CARDANO_MEMORY_FOOTPRINT_TYPE_PLUTUS_DATA, sizeof(cardano_bigint_t)))
+  {
+    return;
+  }
+
+  _cardano_footprint_add_block(context, CARDANO_MEMORY_FOOTPRINT_TYPE_PLUTUS_DATA, (size_t)bigint->mpz->_mp_alloc * sizeof(mp_limb_t));
+}
@@ -27,6 +27,7 @@
 
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
 
 #include <assert.h>
@@ -96,7 +97,7 @@ cardano_credential_new(const cardano_blake2b_hash_t* hash, const cardano_credent
 
   (*credential)->base.deallocator   = cardano_credential_deallocate;
   (*credential)->base.ref_count     = 1;
-  (*credential)->base.last_error[0] = '\0';
+  (*credential)->base.last_error    = NULL;
   (*credential)->type               = type;
 
   const size_t hash_size = cardano_blake2b_hash_get_bytes_size(hash);
@@ -541,4 +542,15 @@ const char*
 cardano_credential_get_last_error(const cardano_credential_t* credential)
 {
   return cardano_object_get_last_error(&credential->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_credential_add_footprint(const cardano_credential_t* credential, cardano_footprint_context_t* context)
+{
+  if (credential == NULL)
+  {
+    return;
+  }
+
+  CARDANO_UNUSED(_cardano_footprint_visit(context, &credential->base, CARDANO_MEMORY_FOOTPRINT_TYPE_ADDRESS, sizeof(cardano_credential_t)));
+}
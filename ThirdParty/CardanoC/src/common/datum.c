@@ -28,6 +28,7 @@
 
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
 
 #include <assert.h>
@@ -101,7 +102,7 @@ cardano_datum_new_data_hash(const cardano_blake2b_hash_t* hash, cardano_datum_t*
 
   (*datum)->base.deallocator   = cardano_datum_deallocate;
   (*datum)->base.ref_count     = 1;
-  (*datum)->base.last_error[0] = '\0';
+  (*datum)->base.last_error    = NULL;
   (*datum)->type               = CARDANO_DATUM_TYPE_DATA_HASH;
   (*datum)->inline_data        = NULL;
 
@@ -235,7 +236,7 @@ cardano_datum_new_inline_data(
 
   (*datum)->base.deallocator   = cardano_datum_deallocate;
   (*datum)->base.ref_count     = 1;
-  (*datum)->base.last_error[0] = '\0';
+  (*datum)->base.last_error    = NULL;
   (*datum)->type               = CARDANO_DATUM_TYPE_INLINE_DATA;
   (*datum)->inline_data        = data;
 
@@ -687,4 +688,15 @@ const char*
 cardano_datum_get_last_error(const cardano_datum_t* datum)
 {
   return cardano_object_get_last_error(&datum->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_datum_add_footprint(const cardano_datum_t* datum, cardano_footprint_context_t* context)
+{
+  if ((datum == NULL) || !_cardano_footprint_visit(context, &datum->base, CARDANO_MEMORY_FOOTPRINT_TYPE_DATUM, sizeof(cardano_datum_t)))
+  {
+    return;
+  }
+
+  _cardano_plutus_data_add_footprint(datum->inline_data, context);
+}
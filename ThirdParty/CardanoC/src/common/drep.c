@@ -116,7 +116,7 @@ cardano_drep_new(const cardano_drep_type_t type, cardano_credential_t* credentia
 
   (*drep)->base.deallocator   = cardano_drep_deallocate;
   (*drep)->base.ref_count     = 1;
-  (*drep)->base.last_error[0] = '\0';
+  (*drep)->base.last_error    = NULL;
   (*drep)->type               = type;
 
   if (credential != NULL)
@@ -27,6 +27,7 @@
 
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
 
 #include <assert.h>
@@ -89,7 +90,7 @@ cardano_ex_units_new(const uint64_t memory, const uint64_t cpu_steps, cardano_ex
 
   (*ex_units)->base.deallocator   = cardano_ex_units_deallocate;
   (*ex_units)->base.ref_count     = 1;
-  (*ex_units)->base.last_error[0] = '\0';
+  (*ex_units)->base.last_error    = NULL;
 
   (*ex_units)->memory = memory;
   (*ex_units)->cpu    = cpu_steps;
@@ -212,6 +213,11 @@ cardano_ex_units_set_memory(cardano_ex_units_t* ex_units, const uint64_t memory)
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&ex_units->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   ex_units->memory = memory;
 
   return CARDANO_SUCCESS;
@@ -236,6 +242,11 @@ cardano_ex_units_set_cpu_steps(cardano_ex_units_t* ex_units, const uint64_t cpu_
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&ex_units->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   ex_units->cpu = cpu_steps;
 
   return CARDANO_SUCCESS;
@@ -291,4 +302,15 @@ const char*
 cardano_ex_units_get_last_error(const cardano_ex_units_t* ex_units)
 {
   return cardano_object_get_last_error(&ex_units->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_ex_units_add_footprint(const cardano_ex_units_t* ex_units, cardano_footprint_context_t* context)
+{
+  if (ex_units == NULL)
+  {
+    return;
+  }
+
+  CARDANO_UNUSED(_cardano_footprint_visit(context, &ex_units->base, CARDANO_MEMORY_FOOTPRINT_TYPE_WITNESS, sizeof(cardano_ex_units_t)));
+}
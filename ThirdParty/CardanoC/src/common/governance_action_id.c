@@ -143,7 +143,7 @@ cardano_governance_action_id_new(const cardano_blake2b_hash_t* hash, const uint6
 
   (*governance_action_id)->base.deallocator   = cardano_governance_action_id_deallocate;
   (*governance_action_id)->base.ref_count     = 1;
-  (*governance_action_id)->base.last_error[0] = '\0';
+  (*governance_action_id)->base.last_error    = NULL;
   (*governance_action_id)->index              = index;
 
   CARDANO_UNUSED(memset((*governance_action_id)->hash_bytes, 0, sizeof((*governance_action_id)->hash_bytes)));
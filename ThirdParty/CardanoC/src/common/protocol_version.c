@@ -92,7 +92,7 @@ cardano_protocol_version_new(
 
   (*protocol_version)->base.deallocator   = cardano_protocol_version_deallocate;
   (*protocol_version)->base.ref_count     = 1;
-  (*protocol_version)->base.last_error[0] = '\0';
+  (*protocol_version)->base.last_error    = NULL;
 
   (*protocol_version)->major = major;
   (*protocol_version)->minor = minor;
@@ -217,6 +217,11 @@ cardano_protocol_version_set_major(cardano_protocol_version_t* protocol_version,
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_version->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_version->major = major;
 
   return CARDANO_SUCCESS;
@@ -241,6 +246,11 @@ cardano_protocol_version_set_minor(cardano_protocol_version_t* protocol_version,
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_version->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_version->minor = minor;
 
   return CARDANO_SUCCESS;
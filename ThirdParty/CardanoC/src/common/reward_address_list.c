@@ -125,7 +125,7 @@ cardano_reward_address_list_new(cardano_reward_address_list_t** reward_address_l
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_reward_address_list_deallocate;
 
   list->array = cardano_array_new(128);
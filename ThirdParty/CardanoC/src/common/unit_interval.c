@@ -165,7 +165,7 @@ cardano_unit_interval_new(
 
   (*unit_interval)->base.deallocator   = cardano_unit_interval_deallocate;
   (*unit_interval)->base.ref_count     = 1;
-  (*unit_interval)->base.last_error[0] = '\0';
+  (*unit_interval)->base.last_error    = NULL;
 
   (*unit_interval)->numerator   = numerator;
   (*unit_interval)->denominator = denominator;
@@ -321,6 +321,11 @@ cardano_unit_interval_set_numerator(cardano_unit_interval_t* unit_interval, cons
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&unit_interval->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   unit_interval->numerator = numerator;
 
   return CARDANO_SUCCESS;
@@ -345,6 +350,11 @@ cardano_unit_interval_set_denominator(cardano_unit_interval_t* unit_interval, co
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&unit_interval->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   unit_interval->denominator = denominator;
 
   return CARDANO_SUCCESS;
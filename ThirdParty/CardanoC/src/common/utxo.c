@@ -26,6 +26,7 @@
 
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
 
 #include <assert.h>
@@ -109,7 +110,7 @@ cardano_utxo_new(
 
   (*utxo)->base.deallocator   = cardano_utxo_deallocate;
   (*utxo)->base.ref_count     = 1;
-  (*utxo)->base.last_error[0] = '\0';
+  (*utxo)->base.last_error    = NULL;
 
   cardano_transaction_input_ref(input);
   (*utxo)->input = input;
@@ -240,6 +241,11 @@ cardano_utxo_set_input(cardano_utxo_t* utxo, cardano_transaction_input_t* input)
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&utxo->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (input == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -273,6 +279,11 @@ cardano_utxo_set_output(cardano_utxo_t* utxo, cardano_transaction_output_t* outp
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&utxo->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (output == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -307,6 +318,31 @@ cardano_utxo_equals(const cardano_utxo_t* lhs, const cardano_utxo_t* rhs)
     cardano_transaction_output_equals(lhs->output, rhs->output);
 }
 
+void
+cardano_utxo_freeze(cardano_utxo_t* utxo)
+{
+  if (utxo == NULL)
+  {
+    return;
+  }
+
+  cardano_object_freeze(&utxo->base);
+
+  cardano_transaction_input_freeze(utxo->input);
+  cardano_transaction_output_freeze(utxo->output);
+}
+
+bool
+cardano_utxo_is_frozen(const cardano_utxo_t* utxo)
+{
+  if (utxo == NULL)
+  {
+    return false;
+  }
+
+  return cardano_object_is_frozen(&utxo->base);
+}
+
 void
 cardano_utxo_unref(cardano_utxo_t** utxo)
 {
@@ -357,4 +393,16 @@ const char*
 cardano_utxo_get_last_error(const cardano_utxo_t* utxo)
 {
   return cardano_object_get_last_error(&utxo->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_utxo_add_footprint(const cardano_utxo_t* utxo, cardano_footprint_context_t* context)
+{
+  if ((utxo == NULL) || !_cardano_footprint_visit(context, &utxo->base, CARDANO_MEMORY_FOOTPRINT_TYPE_UTXO, sizeof(cardano_utxo_t)))
+  {
+    return;
+  }
+
+  _cardano_transaction_input_add_footprint(utxo->input, context);
+  _cardano_transaction_output_add_footprint(utxo->output, context);
+}
@@ -24,13 +24,25 @@
 #include <cardano/common/utxo.h>
 #include <cardano/common/utxo_list.h>
 #include <cardano/object.h>
+#include <cardano/transaction_body/transaction_input.h>
+#include <cardano/transaction_body/transaction_output.h>
 
 #include "../allocators.h"
+#include "../cbor/cbor_validation.h"
 #include "../collections/array.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Lower bound of the encoded size of one UTxO: a 32-byte transaction hash with its index, and an output
+ * holding an enterprise address and a coin. Caps what a definite length header can make us allocate.
+ */
+static const size_t MIN_UTXO_CBOR_SIZE = 64U;
+
 /* STRUCTURES ****************************************************************/
 
 /**
@@ -72,6 +84,240 @@ cardano_utxo_list_deallocate(void* object)
   _cardano_free(list);
 }
 
+/**
+ * \brief Allocates the list storage once for the number of entries a definite length header announces.
+ *
+ * \param[in] list The empty list being filled.
+ * \param[in] reader The reader, positioned after the header; its remaining bytes bound the reservation.
+ * \param[in] count The announced number of entries, or a negative value for indefinite length.
+ *
+ * \return \ref CARDANO_SUCCESS, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+reserve_entries(cardano_utxo_list_t* list, cardano_cbor_reader_t* reader, const int64_t count)
+{
+  return cardano_array_reserve(list->array, cardano_cbor_get_reserve_count(reader, count, MIN_UTXO_CBOR_SIZE));
+}
+
+/**
+ * \brief Tells whether the next entry of a map or array is the last one.
+ *
+ * \param[in] reader The reader, positioned before the next entry.
+ * \param[in] count The announced number of entries, or a negative value for indefinite length.
+ * \param[in] index The number of entries read so far.
+ * \param[in] end_state The state that closes an indefinite length container.
+ * \param[out] is_done Set to true when no entry is left.
+ *
+ * \return \ref CARDANO_SUCCESS, or the error of peeking at the reader.
+ */
+static cardano_error_t
+is_container_done(
+  cardano_cbor_reader_t*            reader,
+  const int64_t                     count,
+  const int64_t                     index,
+  const cardano_cbor_reader_state_t end_state,
+  bool*                             is_done)
+{
+  if (count >= 0)
+  {
+    *is_done = index >= count;
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_cbor_reader_state_t state  = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  const cardano_error_t       result = cardano_cbor_reader_peek_state(reader, &state);
+
+  *is_done = state == end_state;
+
+  return result;
+}
+
+/**
+ * \brief Moves a decoded UTxO into the list.
+ *
+ * \param[in] list The list being filled.
+ * \param[in,out] utxo The UTxO; the reference of the caller is released.
+ *
+ * \return \ref CARDANO_SUCCESS, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the list could not grow.
+ */
+static cardano_error_t
+push_utxo(cardano_utxo_list_t* list, cardano_utxo_t** utxo)
+{
+  const size_t original_size = cardano_array_get_size(list->array);
+
+  // cppcheck-suppress misra-c2012-11.1; Reason: We need this so we can have typesafe parameters.
+  const size_t new_size = cardano_array_push(list->array, (cardano_object_t*)((void*)*utxo));
+
+  cardano_utxo_unref(utxo);
+
+  return (new_size == (original_size + 1U)) ? CARDANO_SUCCESS : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+}
+
+/**
+ * \brief Reads a map of transaction inputs to transaction outputs.
+ *
+ * \param[in] reader The reader, positioned at the start of the map.
+ * \param[in] list The list being filled.
+ *
+ * \return \ref CARDANO_SUCCESS, or the error of the first entry that failed to decode.
+ */
+static cardano_error_t
+read_utxo_map(cardano_cbor_reader_t* reader, cardano_utxo_list_t* list)
+{
+  int64_t         count   = 0;
+  bool            is_done = false;
+  cardano_error_t result  = cardano_cbor_reader_read_start_map(reader, &count);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = reserve_entries(list, reader, count);
+  }
+
+  for (int64_t i = 0; result == CARDANO_SUCCESS; ++i)
+  {
+    result = is_container_done(reader, count, i, CARDANO_CBOR_READER_STATE_END_MAP, &is_done);
+
+    if ((result != CARDANO_SUCCESS) || is_done)
+    {
+      break;
+    }
+
+    cardano_transaction_input_t*  input  = NULL;
+    cardano_transaction_output_t* output = NULL;
+    cardano_utxo_t*               utxo   = NULL;
+
+    result = cardano_transaction_input_from_cbor(reader, &input);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_transaction_output_from_cbor(reader, &output);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_utxo_new(input, output, &utxo);
+    }
+
+    cardano_transaction_input_unref(&input);
+    cardano_transaction_output_unref(&output);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = push_utxo(list, &utxo);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_end_map(reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Reads `[input, output]` pairs, either the entries of an array or, when `in_array` is false, a bare
+ * sequence running to the end of the data.
+ *
+ * \param[in] reader The reader, positioned at the start of the array or of the first pair.
+ * \param[in] list The list being filled.
+ * \param[in] in_array Whether the pairs are wrapped in an array.
+ *
+ * \return \ref CARDANO_SUCCESS, or the error of the first entry that failed to decode.
+ */
+static cardano_error_t
+read_utxo_pairs(cardano_cbor_reader_t* reader, cardano_utxo_list_t* list, const bool in_array)
+{
+  int64_t         count   = -1;
+  bool            is_done = false;
+  cardano_error_t result  = CARDANO_SUCCESS;
+
+  if (in_array)
+  {
+    result = cardano_cbor_reader_read_start_array(reader, &count);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = reserve_entries(list, reader, count);
+    }
+  }
+
+  const cardano_cbor_reader_state_t end_state = in_array ? CARDANO_CBOR_READER_STATE_END_ARRAY : CARDANO_CBOR_READER_STATE_FINISHED;
+
+  for (int64_t i = 0; result == CARDANO_SUCCESS; ++i)
+  {
+    result = is_container_done(reader, count, i, end_state, &is_done);
+
+    if ((result != CARDANO_SUCCESS) || is_done)
+    {
+      break;
+    }
+
+    cardano_utxo_t* utxo = NULL;
+
+    result = cardano_utxo_from_cbor(reader, &utxo);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = push_utxo(list, &utxo);
+    }
+  }
+
+  if ((result == CARDANO_SUCCESS) && in_array)
+  {
+    result = cardano_cbor_reader_read_end_array(reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Tells an array of pairs from a sequence of pairs, which both start with an array header: the first
+ * element of a pair is an input, itself an array starting with a byte string, while the first element of an array
+ * of pairs is a pair, an array starting with another array.
+ *
+ * \param[in] reader The reader, positioned at the first array header. It is not advanced.
+ * \param[out] is_sequence Set to true when the data is a bare sequence of pairs.
+ *
+ * \return \ref CARDANO_SUCCESS, or the error of reading the headers.
+ */
+static cardano_error_t
+is_pair_sequence(cardano_cbor_reader_t* reader, bool* is_sequence)
+{
+  cardano_cbor_reader_t*      clone  = NULL;
+  cardano_cbor_reader_state_t state  = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  int64_t                     length = 0;
+  cardano_error_t             result = cardano_cbor_reader_clone(reader, &clone);
+
+  *is_sequence = false;
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_start_array(clone, &length);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_peek_state(clone, &state);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (state == CARDANO_CBOR_READER_STATE_START_ARRAY))
+  {
+    result = cardano_cbor_reader_read_start_array(clone, &length);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_peek_state(clone, &state);
+    }
+
+    *is_sequence = (result == CARDANO_SUCCESS) && (state == CARDANO_CBOR_READER_STATE_BYTESTRING);
+  }
+
+  cardano_cbor_reader_unref(&clone);
+
+  return result;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -90,7 +336,7 @@ cardano_utxo_list_new(cardano_utxo_list_t** utxo_list)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_utxo_list_deallocate;
 
   list->array = cardano_array_new(128);
@@ -106,6 +352,81 @@ cardano_utxo_list_new(cardano_utxo_list_t** utxo_list)
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_utxo_list_from_cbor_stream(const byte_t* data, const size_t size, cardano_utxo_list_t** utxo_list)
+{
+  if (utxo_list == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((data == NULL) && (size > 0U))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_utxo_list_t* list   = NULL;
+  cardano_error_t      result = cardano_utxo_list_new(&list);
+
+  if ((result != CARDANO_SUCCESS) || (size == 0U))
+  {
+    *utxo_list = list;
+    return result;
+  }
+
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(data, size);
+
+  if (reader == NULL)
+  {
+    cardano_utxo_list_unref(&list);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_cbor_reader_state_t state       = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  bool                        is_sequence = false;
+
+  result = cardano_cbor_reader_peek_state(reader, &state);
+
+  if ((result == CARDANO_SUCCESS) && (state == CARDANO_CBOR_READER_STATE_START_MAP))
+  {
+    result = read_utxo_map(reader, list);
+  }
+  else if ((result == CARDANO_SUCCESS) && (state == CARDANO_CBOR_READER_STATE_START_ARRAY))
+  {
+    result = is_pair_sequence(reader, &is_sequence);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = read_utxo_pairs(reader, list, !is_sequence);
+    }
+  }
+  else if (result == CARDANO_SUCCESS)
+  {
+    result = CARDANO_ERROR_UNEXPECTED_CBOR_TYPE;
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_peek_state(reader, &state);
+
+    if ((result == CARDANO_SUCCESS) && (state != CARDANO_CBOR_READER_STATE_FINISHED))
+    {
+      result = CARDANO_ERROR_DECODING;
+    }
+  }
+
+  cardano_cbor_reader_unref(&reader);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(&list);
+  }
+
+  *utxo_list = list;
+
+  return result;
+}
+
 size_t
 cardano_utxo_list_get_length(const cardano_utxo_list_t* utxo_list)
 {
@@ -117,6 +438,17 @@ cardano_utxo_list_get_length(const cardano_utxo_list_t* utxo_list)
   return cardano_array_get_size(utxo_list->array);
 }
 
+cardano_error_t
+cardano_utxo_list_reserve(cardano_utxo_list_t* utxo_list, const size_t capacity)
+{
+  if (utxo_list == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return cardano_array_reserve(utxo_list->array, capacity);
+}
+
 cardano_error_t
 cardano_utxo_list_get(
   const cardano_utxo_list_t* utxo_list,
@@ -145,6 +477,17 @@ cardano_utxo_list_get(
   return CARDANO_SUCCESS;
 }
 
+cardano_utxo_t*
+cardano_utxo_list_peek(const cardano_utxo_list_t* utxo_list, const size_t index)
+{
+  if (utxo_list == NULL)
+  {
+    return NULL;
+  }
+
+  return (cardano_utxo_t*)((void*)cardano_array_peek(utxo_list->array, index));
+}
+
 cardano_error_t
 cardano_utxo_list_add(cardano_utxo_list_t* utxo_list, cardano_utxo_t* element)
 {
@@ -153,6 +496,11 @@ cardano_utxo_list_add(cardano_utxo_list_t* utxo_list, cardano_utxo_t* element)
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&utxo_list->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (element == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -178,6 +526,11 @@ cardano_utxo_list_clear(cardano_utxo_list_t* utxo_list)
     return;
   }
 
+  if (cardano_object_is_frozen(&utxo_list->base))
+  {
+    return;
+  }
+
   cardano_array_clear(utxo_list->array);
 }
 
@@ -189,6 +542,11 @@ cardano_utxo_list_sort(cardano_utxo_list_t* utxo_list, cardano_utxo_list_compare
     return;
   }
 
+  if (cardano_object_is_frozen(&utxo_list->base))
+  {
+    return;
+  }
+
   if (compare == NULL)
   {
     return;
@@ -313,6 +671,11 @@ cardano_utxo_list_erase(
     return NULL;
   }
 
+  if (cardano_object_is_frozen(&utxo_list->base))
+  {
+    return NULL;
+  }
+
   cardano_utxo_list_t* result = NULL;
 
   cardano_error_t error = cardano_utxo_list_new(&result);
@@ -338,6 +701,11 @@ cardano_utxo_list_erase(
 cardano_error_t
 cardano_utxo_list_remove(cardano_utxo_list_t* utxo_list, cardano_utxo_t* element)
 {
+  if ((utxo_list != NULL) && cardano_object_is_frozen(&utxo_list->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   int32_t found_at = -1;
 
   const size_t length = cardano_utxo_list_get_length(utxo_list);
@@ -389,6 +757,35 @@ cardano_utxo_list_clone(cardano_utxo_list_t* utxo_list)
   return cardano_utxo_list_slice(utxo_list, 0, cardano_utxo_list_get_length(utxo_list));
 }
 
+void
+cardano_utxo_list_freeze(cardano_utxo_list_t* utxo_list)
+{
+  if (utxo_list == NULL)
+  {
+    return;
+  }
+
+  cardano_object_freeze(&utxo_list->base);
+
+  const size_t length = cardano_array_get_size(utxo_list->array);
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    cardano_utxo_freeze((cardano_utxo_t*)((void*)cardano_array_peek(utxo_list->array, i)));
+  }
+}
+
+bool
+cardano_utxo_list_is_frozen(const cardano_utxo_list_t* utxo_list)
+{
+  if (utxo_list == NULL)
+  {
+    return false;
+  }
+
+  return cardano_object_is_frozen(&utxo_list->base);
+}
+
 void
 cardano_utxo_list_unref(cardano_utxo_list_t** utxo_list)
 {
@@ -440,3 +837,23 @@ cardano_utxo_list_get_last_error(const cardano_utxo_list_t* utxo_list)
 {
   return cardano_object_get_last_error(&utxo_list->base);
 }
+
+/**
+ * \brief Adds the footprint of a UTxO stored in a list.
+ */
+static void
+add_utxo_footprint(const cardano_object_t* item, cardano_footprint_context_t* context)
+{
+  _cardano_utxo_add_footprint((const cardano_utxo_t*)((const void*)item), context);
+}
+
+void
+_cardano_utxo_list_add_footprint(const cardano_utxo_list_t* utxo_list, cardano_footprint_context_t* context)
+{
+  if ((utxo_list == NULL) || !_cardano_footprint_visit(context, &utxo_list->base, CARDANO_MEMORY_FOOTPRINT_TYPE_UTXO, sizeof(cardano_utxo_list_t)))
+  {
+    return;
+  }
+
+  _cardano_array_add_footprint(utxo_list->array, context, add_utxo_footprint);
+}
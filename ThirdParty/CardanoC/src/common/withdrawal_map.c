@@ -197,7 +197,7 @@ cardano_withdrawal_map_new(cardano_withdrawal_map_t** withdrawal_map)
   }
 
   map->base.ref_count     = 1;
-  map->base.last_error[0] = '\0';
+  map->base.last_error    = NULL;
   map->base.deallocator   = cardano_withdrawal_map_deallocate;
 
   map->array = cardano_array_new(32);
@@ -304,7 +304,7 @@ cardano_withdrawal_map_from_cbor(cardano_cbor_reader_t* reader, cardano_withdraw
     }
 
     kvp->base.ref_count     = 0;
-    kvp->base.last_error[0] = '\0';
+    kvp->base.last_error    = NULL;
     kvp->base.deallocator   = cardano_withdrawal_map_kvp_deallocate;
     kvp->key                = key;
     kvp->value              = value;
@@ -465,7 +465,7 @@ cardano_withdrawal_map_insert(
   }
 
   kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
+  kvp->base.last_error    = NULL;
   kvp->base.deallocator   = cardano_withdrawal_map_kvp_deallocate;
   kvp->key                = key;
   kvp->value              = value;
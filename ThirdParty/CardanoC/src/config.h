@@ -31,5 +31,8 @@
 
 #define LIB_CARDANO_C_COLLECTION_GROW_FACTOR (1.5)
 #define LIB_CARDANO_C_MAX_JSON_DEPTH         (256)
+/* #undef LIB_CARDANO_C_ATOMIC_REFCOUNT */
+/* #undef LIB_CARDANO_C_DISABLE_SIMD */
+/* #undef LIB_CARDANO_C_ALLOCATION_TRACKING */
 
 #endif /* CARDANO_C_CONFIG_H_ */
@@ -0,0 +1,519 @@
+/**
+ * \file bip32_derivation_cache.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/crypto/bip32_derivation_cache.h>
+
+#include <cardano/export.h>
+#include <cardano/object.h>
+
+#include "../allocators.h"
+
+#include <assert.h>
+#include <sodium.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const size_t ROOT_FINGERPRINT_SIZE = 32U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A cached intermediate node.
+ *
+ * Exactly one of `private_key` and `public_key` is set on a used entry; both are NULL on a free one.
+ */
+typedef struct cardano_bip32_derivation_cache_entry_t
+{
+    byte_t                       root_fingerprint[32];
+    uint32_t                     path[CARDANO_BIP32_DERIVATION_CACHE_MAX_DEPTH];
+    size_t                       depth;
+    uint64_t                     last_used;
+    cardano_bip32_private_key_t* private_key;
+    cardano_bip32_public_key_t*  public_key;
+} cardano_bip32_derivation_cache_entry_t;
+
+/**
+ * \brief A least-recently-used cache of intermediate BIP32 nodes.
+ */
+typedef struct cardano_bip32_derivation_cache_t
+{
+    cardano_object_t                        base;
+    cardano_bip32_derivation_cache_entry_t* entries;
+    size_t                                  capacity;
+    size_t                                  size;
+    uint64_t                                clock;
+} cardano_bip32_derivation_cache_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Releases the node held by a cache entry and marks it free.
+ *
+ * \param entry The entry.
+ */
+static void
+release_entry(cardano_bip32_derivation_cache_entry_t* entry)
+{
+  cardano_bip32_private_key_unref(&entry->private_key);
+  cardano_bip32_public_key_unref(&entry->public_key);
+
+  sodium_memzero((void*)entry, sizeof(cardano_bip32_derivation_cache_entry_t));
+}
+
+/**
+ * \brief Deallocates a derivation cache, wiping every cached node.
+ *
+ * \param object A void pointer to the derivation cache to be deallocated.
+ */
+static void
+cardano_bip32_derivation_cache_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_bip32_derivation_cache_t* cache = (cardano_bip32_derivation_cache_t*)object;
+
+  cardano_bip32_derivation_cache_clear(cache);
+
+  _cardano_free(cache->entries);
+  _cardano_free(cache);
+}
+
+/**
+ * \brief Computes the fingerprint cached nodes are keyed by.
+ *
+ * Private and public roots are fingerprinted under different domain bytes, so a private root never matches
+ * nodes cached under a public root with the same encoding.
+ *
+ * \param key_bytes The root key bytes.
+ * \param key_size The size of the root key.
+ * \param is_private Whether the root is a private key.
+ * \param fingerprint The 32-byte output.
+ */
+static void
+compute_root_fingerprint(const byte_t* key_bytes, const size_t key_size, const bool is_private, byte_t* fingerprint)
+{
+  const byte_t domain = is_private ? 1U : 2U;
+
+  crypto_generichash_state state;
+
+  CARDANO_UNUSED(crypto_generichash_init(&state, NULL, 0U, ROOT_FINGERPRINT_SIZE));
+  CARDANO_UNUSED(crypto_generichash_update(&state, &domain, 1U));
+  CARDANO_UNUSED(crypto_generichash_update(&state, key_bytes, key_size));
+  CARDANO_UNUSED(crypto_generichash_final(&state, fingerprint, ROOT_FINGERPRINT_SIZE));
+
+  sodium_memzero((void*)&state, sizeof(state));
+}
+
+/**
+ * \brief Finds the cached node for the longest prefix of a path.
+ *
+ * \param cache The derivation cache.
+ * \param fingerprint The root fingerprint.
+ * \param indices The derivation path.
+ * \param indices_count The length of the path.
+ *
+ * \return The matching entry, or NULL if no prefix of the path is cached.
+ */
+static cardano_bip32_derivation_cache_entry_t*
+find_longest_prefix(
+  cardano_bip32_derivation_cache_t* cache,
+  const byte_t*                     fingerprint,
+  const uint32_t*                   indices,
+  const size_t                      indices_count)
+{
+  cardano_bip32_derivation_cache_entry_t* best = NULL;
+
+  for (size_t i = 0U; i < cache->capacity; ++i)
+  {
+    cardano_bip32_derivation_cache_entry_t* entry = &cache->entries[i];
+
+    if ((entry->depth == 0U) || (entry->depth > indices_count) || ((best != NULL) && (entry->depth <= best->depth)))
+    {
+      continue;
+    }
+
+    if ((memcmp(entry->path, indices, entry->depth * sizeof(uint32_t)) == 0) && (sodium_memcmp(entry->root_fingerprint, fingerprint, ROOT_FINGERPRINT_SIZE) == 0))
+    {
+      best = entry;
+    }
+  }
+
+  if (best != NULL)
+  {
+    cache->clock += 1U;
+    best->last_used = cache->clock;
+  }
+
+  return best;
+}
+
+/**
+ * \brief Picks the entry a new node is stored in: a free one if any, otherwise the least recently used.
+ *
+ * \param cache The derivation cache.
+ *
+ * \return The entry, already released.
+ */
+static cardano_bip32_derivation_cache_entry_t*
+take_entry(cardano_bip32_derivation_cache_t* cache)
+{
+  cardano_bip32_derivation_cache_entry_t* victim = &cache->entries[0];
+
+  for (size_t i = 0U; i < cache->capacity; ++i)
+  {
+    cardano_bip32_derivation_cache_entry_t* entry = &cache->entries[i];
+
+    if (entry->depth == 0U)
+    {
+      victim = entry;
+      break;
+    }
+
+    if (entry->last_used < victim->last_used)
+    {
+      victim = entry;
+    }
+  }
+
+  if (victim->depth != 0U)
+  {
+    release_entry(victim);
+    cache->size -= 1U;
+  }
+
+  return victim;
+}
+
+/**
+ * \brief Stores an intermediate node in the cache.
+ *
+ * \param cache The derivation cache.
+ * \param fingerprint The root fingerprint.
+ * \param indices The path of the node.
+ * \param depth The length of the path.
+ * \param private_key The node if it is private, or NULL.
+ * \param public_key The node if it is public, or NULL.
+ */
+static void
+keep_node(
+  cardano_bip32_derivation_cache_t* cache,
+  const byte_t*                     fingerprint,
+  const uint32_t*                   indices,
+  const size_t                      depth,
+  cardano_bip32_private_key_t*      private_key,
+  cardano_bip32_public_key_t*       public_key)
+{
+  if ((depth == 0U) || (depth > CARDANO_BIP32_DERIVATION_CACHE_MAX_DEPTH))
+  {
+    return;
+  }
+
+  cardano_bip32_derivation_cache_entry_t* entry = take_entry(cache);
+
+  CARDANO_UNUSED(memcpy(entry->root_fingerprint, fingerprint, ROOT_FINGERPRINT_SIZE));
+  CARDANO_UNUSED(memcpy(entry->path, indices, depth * sizeof(uint32_t)));
+
+  cardano_bip32_private_key_ref(private_key);
+  cardano_bip32_public_key_ref(public_key);
+
+  cache->clock += 1U;
+
+  entry->depth       = depth;
+  entry->last_used   = cache->clock;
+  entry->private_key = private_key;
+  entry->public_key  = public_key;
+
+  cache->size += 1U;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_bip32_derivation_cache_new(const size_t capacity, cardano_bip32_derivation_cache_t** cache)
+{
+  if (cache == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *cache = NULL;
+
+  if (sodium_init() == -1)
+  {
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  const size_t entry_count = (capacity == 0U) ? CARDANO_BIP32_DERIVATION_CACHE_DEFAULT_CAPACITY : capacity;
+
+  cardano_bip32_derivation_cache_t* new_cache = (cardano_bip32_derivation_cache_t*)_cardano_malloc(sizeof(cardano_bip32_derivation_cache_t));
+
+  if (new_cache == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  new_cache->entries = (cardano_bip32_derivation_cache_entry_t*)_cardano_malloc(entry_count * sizeof(cardano_bip32_derivation_cache_entry_t));
+
+  if (new_cache->entries == NULL)
+  {
+    _cardano_free(new_cache);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset((void*)new_cache->entries, 0, entry_count * sizeof(cardano_bip32_derivation_cache_entry_t)));
+
+  new_cache->base.ref_count     = 1;
+  new_cache->base.deallocator   = cardano_bip32_derivation_cache_deallocate;
+  new_cache->base.last_error    = NULL;
+  new_cache->capacity           = entry_count;
+  new_cache->size               = 0U;
+  new_cache->clock              = 0U;
+
+  *cache = new_cache;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_bip32_derivation_cache_derive_private(
+  cardano_bip32_derivation_cache_t*  cache,
+  const cardano_bip32_private_key_t* root_private_key,
+  const uint32_t*                    indices,
+  const size_t                       indices_count,
+  cardano_bip32_private_key_t**      derived_private_key)
+{
+  if (derived_private_key == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *derived_private_key = NULL;
+
+  if ((cache == NULL) || (root_private_key == NULL) || (indices == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (indices_count == 0U)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  byte_t fingerprint[32] = { 0 };
+
+  compute_root_fingerprint(
+    cardano_bip32_private_key_get_data(root_private_key),
+    cardano_bip32_private_key_get_bytes_size(root_private_key),
+    true,
+    fingerprint);
+
+  const cardano_bip32_derivation_cache_entry_t* cached = find_longest_prefix(cache, fingerprint, indices, indices_count);
+
+  cardano_bip32_private_key_t* node   = NULL;
+  size_t                       depth  = 0U;
+  cardano_error_t              result = CARDANO_SUCCESS;
+
+  if (cached != NULL)
+  {
+    node  = cached->private_key;
+    depth = cached->depth;
+
+    cardano_bip32_private_key_ref(node);
+  }
+
+  while ((result == CARDANO_SUCCESS) && (depth < indices_count))
+  {
+    cardano_bip32_private_key_t* child = NULL;
+
+    result = cardano_bip32_private_key_derive((node != NULL) ? node : root_private_key, &indices[depth], 1U, &child);
+
+    cardano_bip32_private_key_unref(&node);
+
+    node   = child;
+    depth += 1U;
+
+    // The requested node itself is not cached, only the prefixes leading to it.
+    if ((result == CARDANO_SUCCESS) && (depth < indices_count))
+    {
+      keep_node(cache, fingerprint, indices, depth, node, NULL);
+    }
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_bip32_private_key_unref(&node);
+
+    return result;
+  }
+
+  *derived_private_key = node;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_bip32_derivation_cache_derive_public(
+  cardano_bip32_derivation_cache_t* cache,
+  const cardano_bip32_public_key_t* root_public_key,
+  const uint32_t*                   indices,
+  const size_t                      indices_count,
+  cardano_bip32_public_key_t**      derived_public_key)
+{
+  if (derived_public_key == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *derived_public_key = NULL;
+
+  if ((cache == NULL) || (root_public_key == NULL) || (indices == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (indices_count == 0U)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  byte_t fingerprint[32] = { 0 };
+
+  compute_root_fingerprint(
+    cardano_bip32_public_key_get_data(root_public_key),
+    cardano_bip32_public_key_get_bytes_size(root_public_key),
+    false,
+    fingerprint);
+
+  const cardano_bip32_derivation_cache_entry_t* cached = find_longest_prefix(cache, fingerprint, indices, indices_count);
+
+  cardano_bip32_public_key_t* node   = NULL;
+  size_t                      depth  = 0U;
+  cardano_error_t             result = CARDANO_SUCCESS;
+
+  if (cached != NULL)
+  {
+    node  = cached->public_key;
+    depth = cached->depth;
+
+    cardano_bip32_public_key_ref(node);
+  }
+
+  while ((result == CARDANO_SUCCESS) && (depth < indices_count))
+  {
+    cardano_bip32_public_key_t* child = NULL;
+
+    result = cardano_bip32_public_key_derive((node != NULL) ? node : root_public_key, &indices[depth], 1U, &child);
+
+    cardano_bip32_public_key_unref(&node);
+
+    node   = child;
+    depth += 1U;
+
+    // The requested node itself is not cached, only the prefixes leading to it.
+    if ((result == CARDANO_SUCCESS) && (depth < indices_count))
+    {
+      keep_node(cache, fingerprint, indices, depth, NULL, node);
+    }
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_bip32_public_key_unref(&node);
+
+    return result;
+  }
+
+  *derived_public_key = node;
+
+  return CARDANO_SUCCESS;
+}
+
+size_t
+cardano_bip32_derivation_cache_get_size(const cardano_bip32_derivation_cache_t* cache)
+{
+  if (cache == NULL)
+  {
+    return 0U;
+  }
+
+  return cache->size;
+}
+
+void
+cardano_bip32_derivation_cache_clear(cardano_bip32_derivation_cache_t* cache)
+{
+  if (cache == NULL)
+  {
+    return;
+  }
+
+  for (size_t i = 0U; i < cache->capacity; ++i)
+  {
+    release_entry(&cache->entries[i]);
+  }
+
+  cache->size  = 0U;
+  cache->clock = 0U;
+}
+
+void
+cardano_bip32_derivation_cache_unref(cardano_bip32_derivation_cache_t** cache)
+{
+  if ((cache == NULL) || (*cache == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*cache)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *cache = NULL;
+    return;
+  }
+}
+
+void
+cardano_bip32_derivation_cache_ref(cardano_bip32_derivation_cache_t* cache)
+{
+  if (cache == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&cache->base);
+}
+
+size_t
+cardano_bip32_derivation_cache_refcount(const cardano_bip32_derivation_cache_t* cache)
+{
+  if (cache == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&cache->base);
+}
@@ -141,7 +141,7 @@ cardano_bip32_private_key_from_bytes(
 
   bip32_private_key->base.ref_count     = 1;
   bip32_private_key->base.deallocator   = cardano_bip32_private_key_deallocate;
-  bip32_private_key->base.last_error[0] = '\0';
+  bip32_private_key->base.last_error    = NULL;
   bip32_private_key->key_material       = cardano_buffer_new_from(key_bytes, key_length);
 
   if (bip32_private_key->key_material == NULL)
@@ -238,18 +238,31 @@ cardano_bip32_private_key_from_hex(
     return CARDANO_ERROR_INVALID_BIP32_PRIVATE_KEY_SIZE;
   }
 
+  byte_t      key_material[96] = { 0 };
+  const char* end              = NULL;
+
+  // Key material goes through the constant-time libsodium codec rather than the vectorized one
+  if ((sodium_init() == -1) || (sodium_hex2bin(&key_material[0], BIP32_ED25519_PRIVATE_KEY_LENGTH, hex, hex_length, NULL, NULL, &end) != 0))
+  {
+    *private_key = NULL;
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
   cardano_bip32_private_key_t* bip32_private_key = (cardano_bip32_private_key_t*)_cardano_malloc(sizeof(cardano_bip32_private_key_t));
 
   if (bip32_private_key == NULL)
   {
+    sodium_memzero(&key_material[0], sizeof(key_material));
     *private_key = NULL;
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
   bip32_private_key->base.ref_count     = 1;
   bip32_private_key->base.deallocator   = cardano_bip32_private_key_deallocate;
-  bip32_private_key->base.last_error[0] = '\0';
-  bip32_private_key->key_material       = cardano_buffer_from_hex(hex, hex_length);
+  bip32_private_key->base.last_error    = NULL;
+  bip32_private_key->key_material       = cardano_buffer_new_from(&key_material[0], BIP32_ED25519_PRIVATE_KEY_LENGTH);
+
+  sodium_memzero(&key_material[0], sizeof(key_material));
 
   if (bip32_private_key->key_material == NULL)
   {
@@ -502,7 +515,23 @@ cardano_bip32_private_key_to_hex(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return cardano_buffer_to_hex(bip32_private_key->key_material, hex, hex_length);
+  if (hex == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (hex_length < cardano_buffer_get_hex_size(bip32_private_key->key_material))
+  {
+    return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
+  }
+
+  // Key material goes through the constant-time libsodium codec rather than the vectorized one
+  if ((sodium_init() == -1) || (sodium_bin2hex(hex, hex_length, cardano_buffer_get_data(bip32_private_key->key_material), cardano_buffer_get_size(bip32_private_key->key_material)) == NULL))
+  {
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  return CARDANO_SUCCESS;
 }
 
 uint32_t
@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <cardano/crypto/blake2b_hash_size.h>
+#include <cardano/encoding/bech32.h>
 #include <string.h>
 
 /* CONSTANTS *****************************************************************/
@@ -118,7 +119,7 @@ cardano_bip32_public_key_from_bytes(
 
   bip32_public_key->base.ref_count     = 1;
   bip32_public_key->base.deallocator   = cardano_bip32_public_key_deallocate;
-  bip32_public_key->base.last_error[0] = '\0';
+  bip32_public_key->base.last_error    = NULL;
   bip32_public_key->key_material       = cardano_buffer_new_from(data, data_length);
 
   if (bip32_public_key->key_material == NULL)
@@ -165,7 +166,7 @@ cardano_bip32_public_key_from_hex(
 
   bip32_public_key->base.ref_count     = 1;
   bip32_public_key->base.deallocator   = cardano_bip32_public_key_deallocate;
-  bip32_public_key->base.last_error[0] = '\0';
+  bip32_public_key->base.last_error    = NULL;
   bip32_public_key->key_material       = cardano_buffer_from_hex(hex, hex_length);
 
   if (bip32_public_key->key_material == NULL)
@@ -179,6 +180,66 @@ cardano_bip32_public_key_from_hex(
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_bip32_public_key_from_bech32(
+  const char*                  bech32,
+  const size_t                 bech32_length,
+  cardano_bip32_public_key_t** public_key)
+{
+  if (public_key == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *public_key = NULL;
+
+  if (bech32 == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (bech32_length == 0U)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  size_t       hrp_size    = 0;
+  const size_t data_length = cardano_encoding_bech32_get_decoded_length(bech32, bech32_length, &hrp_size);
+
+  if ((hrp_size == 0U) || (data_length != BIP32_ED25519_PUBLIC_KEY_LENGTH))
+  {
+    return (hrp_size == 0U) ? CARDANO_ERROR_DECODING : CARDANO_ERROR_INVALID_BIP32_PUBLIC_KEY_SIZE;
+  }
+
+  char* hrp = (char*)_cardano_malloc(hrp_size);
+
+  if (hrp == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  byte_t          data[64] = { 0 };
+  cardano_error_t result   = cardano_encoding_bech32_decode(bech32, bech32_length, hrp, hrp_size, data, data_length);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    _cardano_free(hrp);
+
+    return result;
+  }
+
+  const bool is_account_key = (strcmp(hrp, "acct_xvk") == 0) || (strcmp(hrp, "acct_shared_xvk") == 0);
+
+  _cardano_free(hrp);
+
+  if (!is_account_key)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  return cardano_bip32_public_key_from_bytes(data, data_length, public_key);
+}
+
 void
 cardano_bip32_public_key_unref(cardano_bip32_public_key_t** bip32_public_key)
 {
@@ -28,7 +28,11 @@
 #include <cardano/object.h>
 
 #include "../allocators.h"
+#include "../build_profile.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
+#include "../string_safe.h"
+#include "./internals/inline_bytes.h"
 
 #include <assert.h>
 #include <sodium.h>
@@ -38,15 +42,32 @@
 
 /**
  * \brief Represents a BLAKE2b cryptographic hash.
+ *
+ * The \c size bytes of the hash follow the structure in the same allocation, so a hash costs one heap block.
  */
 typedef struct cardano_blake2b_hash_t
 {
-    cardano_object_t  base;
-    cardano_buffer_t* buffer;
+    cardano_object_t base;
+    size_t           size;
 } cardano_blake2b_hash_t;
 
 /* STATIC FUNCTIONS **********************************************************/
 
+/**
+ * \brief Gets the bytes of a hash, stored right after its structure.
+ *
+ * \param[in] hash The hash.
+ *
+ * \return The bytes of the hash.
+ */
+static byte_t*
+get_bytes(const cardano_blake2b_hash_t* hash)
+{
+  assert(hash != NULL);
+
+  return (byte_t*)&hash[1];
+}
+
 /**
  * \brief Deallocates a Blake2b hash object.
  *
@@ -65,14 +86,32 @@ cardano_blake2b_hash_deallocate(void* object)
 {
   assert(object != NULL);
 
-  cardano_blake2b_hash_t* hash = (cardano_blake2b_hash_t*)object;
+  _cardano_free(object);
+}
 
-  if (hash->buffer != NULL)
+/**
+ * \brief Allocates a hash of \p size bytes, with its bytes left uninitialized.
+ *
+ * \param[in] size The size of the hash in bytes.
+ *
+ * \return The new hash, or NULL if memory could not be allocated.
+ */
+static cardano_blake2b_hash_t*
+hash_new(const size_t size)
+{
+  cardano_blake2b_hash_t* hash = (cardano_blake2b_hash_t*)_cardano_malloc(sizeof(cardano_blake2b_hash_t) + size);
+
+  if (hash == NULL)
   {
-    cardano_buffer_unref(&hash->buffer);
+    return NULL;
   }
 
-  _cardano_free(hash);
+  hash->base.ref_count   = 1;
+  hash->base.deallocator = cardano_blake2b_hash_deallocate;
+  hash->base.last_error  = NULL;
+  hash->size             = size;
+
+  return hash;
 }
 
 /* DEFINITIONS ****************************************************************/
@@ -110,7 +149,7 @@ cardano_blake2b_compute_hash(
     return CARDANO_ERROR_INVALID_BLAKE2B_HASH_SIZE;
   }
 
-  cardano_blake2b_hash_t* obj = (cardano_blake2b_hash_t*)_cardano_malloc(sizeof(cardano_blake2b_hash_t));
+  cardano_blake2b_hash_t* obj = hash_new(hash_length);
 
   if (obj == NULL)
   {
@@ -119,19 +158,6 @@ cardano_blake2b_compute_hash(
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  obj->base.ref_count     = 1;
-  obj->base.deallocator   = cardano_blake2b_hash_deallocate;
-  obj->base.last_error[0] = '\0';
-  obj->buffer             = cardano_buffer_new(hash_length);
-
-  if (obj->buffer == NULL)
-  {
-    _cardano_free(obj);
-    *hash = NULL;
-
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
-
   int init_result = sodium_init();
 
   if (init_result == -1)
@@ -143,7 +169,7 @@ cardano_blake2b_compute_hash(
   }
 
   int hashing_result = crypto_generichash(
-    cardano_buffer_get_data(obj->buffer),
+    get_bytes(obj),
     hash_length,
     data,
     data_length,
@@ -158,16 +184,106 @@ cardano_blake2b_compute_hash(
     return CARDANO_ERROR_GENERIC;
   }
 
-  cardano_error_t set_size_result = cardano_buffer_set_size(obj->buffer, hash_length);
-
-  assert(set_size_result == CARDANO_SUCCESS);
-  CARDANO_UNUSED(set_size_result);
+  _cardano_build_profile_count_hash();
 
   *hash = obj;
 
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_blake2b_compute_hash_many(
+  const byte_t* const*     data,
+  const size_t*            data_lengths,
+  const size_t             count,
+  const size_t             hash_length,
+  cardano_blake2b_hash_t** hashes)
+{
+  if ((data == NULL) || (data_lengths == NULL) || (hashes == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    hashes[i] = NULL;
+  }
+
+  if ((hash_length == 0U) || (hash_length > crypto_generichash_blake2b_BYTES_MAX))
+  {
+    return CARDANO_ERROR_INVALID_BLAKE2B_HASH_SIZE;
+  }
+
+  if (count == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    if (data[i] == NULL)
+    {
+      return CARDANO_ERROR_POINTER_IS_NULL;
+    }
+
+    if (data_lengths[i] == 0U)
+    {
+      return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
+    }
+  }
+
+  if (sodium_init() == -1)
+  {
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  byte_t*             digests = (byte_t*)_cardano_malloc(count * hash_length);
+  unsigned long long* lengths = (unsigned long long*)_cardano_malloc(count * sizeof(unsigned long long));
+
+  if ((digests == NULL) || (lengths == NULL))
+  {
+    _cardano_free(digests);
+    _cardano_free(lengths);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    lengths[i] = (unsigned long long)data_lengths[i];
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (crypto_generichash_blake2b_many(digests, hash_length, data, lengths, count) == -1)
+  {
+    result = CARDANO_ERROR_GENERIC;
+  }
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < count); ++i)
+  {
+    _cardano_build_profile_count_hash();
+  }
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < count); ++i)
+  {
+    result = cardano_blake2b_hash_from_bytes(&digests[i * hash_length], hash_length, &hashes[i]);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    for (size_t i = 0U; i < count; ++i)
+    {
+      cardano_blake2b_hash_unref(&hashes[i]);
+    }
+  }
+
+  _cardano_free(digests);
+  _cardano_free(lengths);
+
+  return result;
+}
+
 cardano_error_t
 cardano_blake2b_hash_from_bytes(
   const byte_t*            data,
@@ -193,7 +309,7 @@ cardano_blake2b_hash_from_bytes(
     return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
   }
 
-  cardano_blake2b_hash_t* blake2b_hash = (cardano_blake2b_hash_t*)_cardano_malloc(sizeof(cardano_blake2b_hash_t));
+  cardano_blake2b_hash_t* blake2b_hash = hash_new(data_length);
 
   if (blake2b_hash == NULL)
   {
@@ -202,18 +318,7 @@ cardano_blake2b_hash_from_bytes(
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  blake2b_hash->base.ref_count     = 1;
-  blake2b_hash->base.deallocator   = cardano_blake2b_hash_deallocate;
-  blake2b_hash->base.last_error[0] = '\0';
-  blake2b_hash->buffer             = cardano_buffer_new_from(data, data_length);
-
-  if (blake2b_hash->buffer == NULL)
-  {
-    *hash = NULL;
-    _cardano_free(blake2b_hash);
-
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
+  cardano_safe_memcpy(get_bytes(blake2b_hash), data_length, data, data_length);
 
   *hash = blake2b_hash;
 
@@ -243,19 +348,14 @@ cardano_blake2b_hash_from_hex(
     return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
   }
 
-  cardano_blake2b_hash_t* blake2b_hash = (cardano_blake2b_hash_t*)_cardano_malloc(sizeof(cardano_blake2b_hash_t));
+  cardano_blake2b_hash_t* blake2b_hash = hash_new(hex_length / 2U);
 
   if (blake2b_hash == NULL)
   {
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
-  blake2b_hash->base.ref_count     = 1;
-  blake2b_hash->base.deallocator   = cardano_blake2b_hash_deallocate;
-  blake2b_hash->base.last_error[0] = '\0';
-  blake2b_hash->buffer             = cardano_buffer_from_hex(hex, hex_length);
-
-  if (blake2b_hash->buffer == NULL)
+  if (!_cardano_inline_bytes_from_hex(hex, hex_length, get_bytes(blake2b_hash), blake2b_hash->size))
   {
     _cardano_free(blake2b_hash);
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
@@ -283,6 +383,15 @@ cardano_blake2b_hash_from_cbor(cardano_cbor_reader_t* reader, cardano_blake2b_ha
     return CARDANO_ERROR_UNEXPECTED_CBOR_TYPE;
   }
 
+  const byte_t* data = NULL;
+  size_t        size = 0U;
+
+  // Hashes are definite length byte strings, read in place; any other encoding goes through a buffer
+  if (cardano_cbor_reader_read_bytestring_view(reader, &data, &size) == CARDANO_SUCCESS)
+  {
+    return cardano_blake2b_hash_from_bytes(data, size, blake2b_hash);
+  }
+
   cardano_buffer_t*     byte_string             = NULL;
   const cardano_error_t read_byte_string_result = cardano_cbor_reader_read_bytestring(reader, &byte_string);
 
@@ -318,8 +427,8 @@ cardano_blake2b_hash_to_cbor(
 
   cardano_error_t write_bytes_result = cardano_cbor_writer_write_bytestring(
     writer,
-    cardano_buffer_get_data(blake2b_hash->buffer),
-    cardano_buffer_get_size(blake2b_hash->buffer));
+    get_bytes(blake2b_hash),
+    blake2b_hash->size);
 
   if (write_bytes_result != CARDANO_SUCCESS)
   {
@@ -344,7 +453,7 @@ cardano_blake2b_hash_equals(
     return false;
   }
 
-  return cardano_buffer_equals(lhs->buffer, rhs->buffer);
+  return (lhs->size == rhs->size) && (memcmp(get_bytes(lhs), get_bytes(rhs), lhs->size) == 0);
 }
 
 int32_t
@@ -367,7 +476,7 @@ cardano_blake2b_hash_compare(
     return 1;
   }
 
-  return cardano_buffer_compare(lhs->buffer, rhs->buffer);
+  return _cardano_inline_bytes_compare(get_bytes(lhs), lhs->size, get_bytes(rhs), rhs->size);
 }
 
 void
@@ -418,7 +527,7 @@ cardano_blake2b_hash_get_data(const cardano_blake2b_hash_t* blake2b_hash)
     return NULL;
   }
 
-  return cardano_buffer_get_data(blake2b_hash->buffer);
+  return get_bytes(blake2b_hash);
 }
 
 size_t
@@ -429,7 +538,7 @@ cardano_blake2b_hash_get_bytes_size(const cardano_blake2b_hash_t* blake2b_hash)
     return 0U;
   }
 
-  return cardano_buffer_get_size(blake2b_hash->buffer);
+  return blake2b_hash->size;
 }
 
 cardano_error_t
@@ -443,7 +552,7 @@ cardano_blake2b_hash_to_bytes(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return cardano_buffer_copy_bytes(blake2b_hash->buffer, hash, hash_length);
+  return _cardano_inline_bytes_copy(get_bytes(blake2b_hash), blake2b_hash->size, hash, hash_length);
 }
 
 size_t
@@ -454,7 +563,7 @@ cardano_blake2b_hash_get_hex_size(const cardano_blake2b_hash_t* blake2b_hash)
     return 0U;
   }
 
-  return cardano_buffer_get_hex_size(blake2b_hash->buffer);
+  return _cardano_inline_bytes_get_hex_size(blake2b_hash->size);
 }
 
 cardano_error_t
@@ -468,5 +577,16 @@ cardano_blake2b_hash_to_hex(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return cardano_buffer_to_hex(blake2b_hash->buffer, hex_hash, hash_len);
-}
\ No newline at end of file
+  return _cardano_inline_bytes_to_hex(get_bytes(blake2b_hash), blake2b_hash->size, hex_hash, hash_len);
+}
+
+void
+_cardano_blake2b_hash_add_footprint(const cardano_blake2b_hash_t* hash, cardano_footprint_context_t* context)
+{
+  if (hash == NULL)
+  {
+    return;
+  }
+
+  CARDANO_UNUSED(_cardano_footprint_visit(context, &hash->base, CARDANO_MEMORY_FOOTPRINT_TYPE_HASH, sizeof(cardano_blake2b_hash_t) + hash->size));
+}
@@ -28,6 +28,7 @@
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
 #include "../collections/array.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
@@ -118,7 +119,7 @@ cardano_blake2b_hash_set_new(cardano_blake2b_hash_set_t** blake2b_hash_set)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_blake2b_hash_set_deallocate;
 
   list->array = cardano_array_new(128);
@@ -407,3 +408,23 @@ cardano_blake2b_hash_set_get_last_error(const cardano_blake2b_hash_set_t* blake2
 {
   return cardano_object_get_last_error(&blake2b_hash_set->base);
 }
+
+/**
+ * \brief Adds the footprint of a \ref cardano_blake2b_hash_t stored in a set.
+ */
+static void
+add_hash_footprint(const cardano_object_t* item, cardano_footprint_context_t* context)
+{
+  _cardano_blake2b_hash_add_footprint((const cardano_blake2b_hash_t*)((const void*)item), context);
+}
+
+void
+_cardano_blake2b_hash_set_add_footprint(const cardano_blake2b_hash_set_t* set, cardano_footprint_context_t* context)
+{
+  if ((set == NULL) || !_cardano_footprint_visit(context, &set->base, CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION, sizeof(cardano_blake2b_hash_set_t)))
+  {
+    return;
+  }
+
+  _cardano_array_add_footprint(set->array, context, add_hash_footprint);
+}
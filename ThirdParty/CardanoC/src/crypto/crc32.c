@@ -23,8 +23,15 @@
 
 #include <cardano/crypto/crc32.h>
 
+#include "../string_safe.h"
+
 /* MACROS ********************************************************************/
 
+#if defined(__ARM_FEATURE_CRC32) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define CARDANO_HAS_CRC32_INSTRUCTIONS 1
+#include <arm_acle.h>
+#endif
+
 #ifdef __GNUC__
 #ifdef __cplusplus
 #define CARDANO_32_ALIGN alignas(32)
@@ -39,80 +46,623 @@
 
 /* clang-format off */
 
+#ifndef CARDANO_HAS_CRC32_INSTRUCTIONS
+
 // We suppress the MISRA C:2012 rule 8.9 because the table inlining the table inside the function
 // would make the code less readable.
 
+// Table k holds the CRC of each byte followed by k zero bytes, so eight bytes are folded in per step (slice-by-8).
 // cppcheck-suppress misra-c2012-8.9
-CARDANO_32_ALIGN static uint32_t s_crc32_table[256] =
+CARDANO_32_ALIGN static uint32_t s_crc32_tables[8][256] =
 {
-    (uint32_t)(0x00000000), (uint32_t)(0x77073096), (uint32_t)(0xee0e612c), (uint32_t)(0x990951ba),
-    (uint32_t)(0x076dc419), (uint32_t)(0x706af48f), (uint32_t)(0xe963a535), (uint32_t)(0x9e6495a3),
-    (uint32_t)(0x0edb8832), (uint32_t)(0x79dcb8a4), (uint32_t)(0xe0d5e91e), (uint32_t)(0x97d2d988),
-    (uint32_t)(0x09b64c2b), (uint32_t)(0x7eb17cbd), (uint32_t)(0xe7b82d07), (uint32_t)(0x90bf1d91),
-    (uint32_t)(0x1db71064), (uint32_t)(0x6ab020f2), (uint32_t)(0xf3b97148), (uint32_t)(0x84be41de),
-    (uint32_t)(0x1adad47d), (uint32_t)(0x6ddde4eb), (uint32_t)(0xf4d4b551), (uint32_t)(0x83d385c7),
-    (uint32_t)(0x136c9856), (uint32_t)(0x646ba8c0), (uint32_t)(0xfd62f97a), (uint32_t)(0x8a65c9ec),
-    (uint32_t)(0x14015c4f), (uint32_t)(0x63066cd9), (uint32_t)(0xfa0f3d63), (uint32_t)(0x8d080df5),
-    (uint32_t)(0x3b6e20c8), (uint32_t)(0x4c69105e), (uint32_t)(0xd56041e4), (uint32_t)(0xa2677172),
-    (uint32_t)(0x3c03e4d1), (uint32_t)(0x4b04d447), (uint32_t)(0xd20d85fd), (uint32_t)(0xa50ab56b),
-    (uint32_t)(0x35b5a8fa), (uint32_t)(0x42b2986c), (uint32_t)(0xdbbbc9d6), (uint32_t)(0xacbcf940),
-    (uint32_t)(0x32d86ce3), (uint32_t)(0x45df5c75), (uint32_t)(0xdcd60dcf), (uint32_t)(0xabd13d59),
-    (uint32_t)(0x26d930ac), (uint32_t)(0x51de003a), (uint32_t)(0xc8d75180), (uint32_t)(0xbfd06116),
-    (uint32_t)(0x21b4f4b5), (uint32_t)(0x56b3c423), (uint32_t)(0xcfba9599), (uint32_t)(0xb8bda50f),
-    (uint32_t)(0x2802b89e), (uint32_t)(0x5f058808), (uint32_t)(0xc60cd9b2), (uint32_t)(0xb10be924),
-    (uint32_t)(0x2f6f7c87), (uint32_t)(0x58684c11), (uint32_t)(0xc1611dab), (uint32_t)(0xb6662d3d),
-    (uint32_t)(0x76dc4190), (uint32_t)(0x01db7106), (uint32_t)(0x98d220bc), (uint32_t)(0xefd5102a),
-    (uint32_t)(0x71b18589), (uint32_t)(0x06b6b51f), (uint32_t)(0x9fbfe4a5), (uint32_t)(0xe8b8d433),
-    (uint32_t)(0x7807c9a2), (uint32_t)(0x0f00f934), (uint32_t)(0x9609a88e), (uint32_t)(0xe10e9818),
-    (uint32_t)(0x7f6a0dbb), (uint32_t)(0x086d3d2d), (uint32_t)(0x91646c97), (uint32_t)(0xe6635c01),
-    (uint32_t)(0x6b6b51f4), (uint32_t)(0x1c6c6162), (uint32_t)(0x856530d8), (uint32_t)(0xf262004e),
-    (uint32_t)(0x6c0695ed), (uint32_t)(0x1b01a57b), (uint32_t)(0x8208f4c1), (uint32_t)(0xf50fc457),
-    (uint32_t)(0x65b0d9c6), (uint32_t)(0x12b7e950), (uint32_t)(0x8bbeb8ea), (uint32_t)(0xfcb9887c),
-    (uint32_t)(0x62dd1ddf), (uint32_t)(0x15da2d49), (uint32_t)(0x8cd37cf3), (uint32_t)(0xfbd44c65),
-    (uint32_t)(0x4db26158), (uint32_t)(0x3ab551ce), (uint32_t)(0xa3bc0074), (uint32_t)(0xd4bb30e2),
-    (uint32_t)(0x4adfa541), (uint32_t)(0x3dd895d7), (uint32_t)(0xa4d1c46d), (uint32_t)(0xd3d6f4fb),
-    (uint32_t)(0x4369e96a), (uint32_t)(0x346ed9fc), (uint32_t)(0xad678846), (uint32_t)(0xda60b8d0),
-    (uint32_t)(0x44042d73), (uint32_t)(0x33031de5), (uint32_t)(0xaa0a4c5f), (uint32_t)(0xdd0d7cc9),
-    (uint32_t)(0x5005713c), (uint32_t)(0x270241aa), (uint32_t)(0xbe0b1010), (uint32_t)(0xc90c2086),
-    (uint32_t)(0x5768b525), (uint32_t)(0x206f85b3), (uint32_t)(0xb966d409), (uint32_t)(0xce61e49f),
-    (uint32_t)(0x5edef90e), (uint32_t)(0x29d9c998), (uint32_t)(0xb0d09822), (uint32_t)(0xc7d7a8b4),
-    (uint32_t)(0x59b33d17), (uint32_t)(0x2eb40d81), (uint32_t)(0xb7bd5c3b), (uint32_t)(0xc0ba6cad),
-    (uint32_t)(0xedb88320), (uint32_t)(0x9abfb3b6), (uint32_t)(0x03b6e20c), (uint32_t)(0x74b1d29a),
-    (uint32_t)(0xead54739), (uint32_t)(0x9dd277af), (uint32_t)(0x04db2615), (uint32_t)(0x73dc1683),
-    (uint32_t)(0xe3630b12), (uint32_t)(0x94643b84), (uint32_t)(0x0d6d6a3e), (uint32_t)(0x7a6a5aa8),
-    (uint32_t)(0xe40ecf0b), (uint32_t)(0x9309ff9d), (uint32_t)(0x0a00ae27), (uint32_t)(0x7d079eb1),
-    (uint32_t)(0xf00f9344), (uint32_t)(0x8708a3d2), (uint32_t)(0x1e01f268), (uint32_t)(0x6906c2fe),
-    (uint32_t)(0xf762575d), (uint32_t)(0x806567cb), (uint32_t)(0x196c3671), (uint32_t)(0x6e6b06e7),
-    (uint32_t)(0xfed41b76), (uint32_t)(0x89d32be0), (uint32_t)(0x10da7a5a), (uint32_t)(0x67dd4acc),
-    (uint32_t)(0xf9b9df6f), (uint32_t)(0x8ebeeff9), (uint32_t)(0x17b7be43), (uint32_t)(0x60b08ed5),
-    (uint32_t)(0xd6d6a3e8), (uint32_t)(0xa1d1937e), (uint32_t)(0x38d8c2c4), (uint32_t)(0x4fdff252),
-    (uint32_t)(0xd1bb67f1), (uint32_t)(0xa6bc5767), (uint32_t)(0x3fb506dd), (uint32_t)(0x48b2364b),
-    (uint32_t)(0xd80d2bda), (uint32_t)(0xaf0a1b4c), (uint32_t)(0x36034af6), (uint32_t)(0x41047a60),
-    (uint32_t)(0xdf60efc3), (uint32_t)(0xa867df55), (uint32_t)(0x316e8eef), (uint32_t)(0x4669be79),
-    (uint32_t)(0xcb61b38c), (uint32_t)(0xbc66831a), (uint32_t)(0x256fd2a0), (uint32_t)(0x5268e236),
-    (uint32_t)(0xcc0c7795), (uint32_t)(0xbb0b4703), (uint32_t)(0x220216b9), (uint32_t)(0x5505262f),
-    (uint32_t)(0xc5ba3bbe), (uint32_t)(0xb2bd0b28), (uint32_t)(0x2bb45a92), (uint32_t)(0x5cb36a04),
-    (uint32_t)(0xc2d7ffa7), (uint32_t)(0xb5d0cf31), (uint32_t)(0x2cd99e8b), (uint32_t)(0x5bdeae1d),
-    (uint32_t)(0x9b64c2b0), (uint32_t)(0xec63f226), (uint32_t)(0x756aa39c), (uint32_t)(0x026d930a),
-    (uint32_t)(0x9c0906a9), (uint32_t)(0xeb0e363f), (uint32_t)(0x72076785), (uint32_t)(0x05005713),
-    (uint32_t)(0x95bf4a82), (uint32_t)(0xe2b87a14), (uint32_t)(0x7bb12bae), (uint32_t)(0x0cb61b38),
-    (uint32_t)(0x92d28e9b), (uint32_t)(0xe5d5be0d), (uint32_t)(0x7cdcefb7), (uint32_t)(0x0bdbdf21),
-    (uint32_t)(0x86d3d2d4), (uint32_t)(0xf1d4e242), (uint32_t)(0x68ddb3f8), (uint32_t)(0x1fda836e),
-    (uint32_t)(0x81be16cd), (uint32_t)(0xf6b9265b), (uint32_t)(0x6fb077e1), (uint32_t)(0x18b74777),
-    (uint32_t)(0x88085ae6), (uint32_t)(0xff0f6a70), (uint32_t)(0x66063bca), (uint32_t)(0x11010b5c),
-    (uint32_t)(0x8f659eff), (uint32_t)(0xf862ae69), (uint32_t)(0x616bffd3), (uint32_t)(0x166ccf45),
-    (uint32_t)(0xa00ae278), (uint32_t)(0xd70dd2ee), (uint32_t)(0x4e048354), (uint32_t)(0x3903b3c2),
-    (uint32_t)(0xa7672661), (uint32_t)(0xd06016f7), (uint32_t)(0x4969474d), (uint32_t)(0x3e6e77db),
-    (uint32_t)(0xaed16a4a), (uint32_t)(0xd9d65adc), (uint32_t)(0x40df0b66), (uint32_t)(0x37d83bf0),
-    (uint32_t)(0xa9bcae53), (uint32_t)(0xdebb9ec5), (uint32_t)(0x47b2cf7f), (uint32_t)(0x30b5ffe9),
-    (uint32_t)(0xbdbdf21c), (uint32_t)(0xcabac28a), (uint32_t)(0x53b39330), (uint32_t)(0x24b4a3a6),
-    (uint32_t)(0xbad03605), (uint32_t)(0xcdd70693), (uint32_t)(0x54de5729), (uint32_t)(0x23d967bf),
-    (uint32_t)(0xb3667a2e), (uint32_t)(0xc4614ab8), (uint32_t)(0x5d681b02), (uint32_t)(0x2a6f2b94),
-    (uint32_t)(0xb40bbe37), (uint32_t)(0xc30c8ea1), (uint32_t)(0x5a05df1b), (uint32_t)(0x2d02ef8d)
+    {
+        (uint32_t)(0x00000000), (uint32_t)(0x77073096), (uint32_t)(0xee0e612c), (uint32_t)(0x990951ba),
+        (uint32_t)(0x076dc419), (uint32_t)(0x706af48f), (uint32_t)(0xe963a535), (uint32_t)(0x9e6495a3),
+        (uint32_t)(0x0edb8832), (uint32_t)(0x79dcb8a4), (uint32_t)(0xe0d5e91e), (uint32_t)(0x97d2d988),
+        (uint32_t)(0x09b64c2b), (uint32_t)(0x7eb17cbd), (uint32_t)(0xe7b82d07), (uint32_t)(0x90bf1d91),
+        (uint32_t)(0x1db71064), (uint32_t)(0x6ab020f2), (uint32_t)(0xf3b97148), (uint32_t)(0x84be41de),
+        (uint32_t)(0x1adad47d), (uint32_t)(0x6ddde4eb), (uint32_t)(0xf4d4b551), (uint32_t)(0x83d385c7),
+        (uint32_t)(0x136c9856), (uint32_t)(0x646ba8c0), (uint32_t)(0xfd62f97a), (uint32_t)(0x8a65c9ec),
+        (uint32_t)(0x14015c4f), (uint32_t)(0x63066cd9), (uint32_t)(0xfa0f3d63), (uint32_t)(0x8d080df5),
+        (uint32_t)(0x3b6e20c8), (uint32_t)(0x4c69105e), (uint32_t)(0xd56041e4), (uint32_t)(0xa2677172),
+        (uint32_t)(0x3c03e4d1), (uint32_t)(0x4b04d447), (uint32_t)(0xd20d85fd), (uint32_t)(0xa50ab56b),
+        (uint32_t)(0x35b5a8fa), (uint32_t)(0x42b2986c), (uint32_t)(0xdbbbc9d6), (uint32_t)(0xacbcf940),
+        (uint32_t)(0x32d86ce3), (uint32_t)(0x45df5c75), (uint32_t)(0xdcd60dcf), (uint32_t)(0xabd13d59),
+        (uint32_t)(0x26d930ac), (uint32_t)(0x51de003a), (uint32_t)(0xc8d75180), (uint32_t)(0xbfd06116),
+        (uint32_t)(0x21b4f4b5), (uint32_t)(0x56b3c423), (uint32_t)(0xcfba9599), (uint32_t)(0xb8bda50f),
+        (uint32_t)(0x2802b89e), (uint32_t)(0x5f058808), (uint32_t)(0xc60cd9b2), (uint32_t)(0xb10be924),
+        (uint32_t)(0x2f6f7c87), (uint32_t)(0x58684c11), (uint32_t)(0xc1611dab), (uint32_t)(0xb6662d3d),
+        (uint32_t)(0x76dc4190), (uint32_t)(0x01db7106), (uint32_t)(0x98d220bc), (uint32_t)(0xefd5102a),
+        (uint32_t)(0x71b18589), (uint32_t)(0x06b6b51f), (uint32_t)(0x9fbfe4a5), (uint32_t)(0xe8b8d433),
+        (uint32_t)(0x7807c9a2), (uint32_t)(0x0f00f934), (uint32_t)(0x9609a88e), (uint32_t)(0xe10e9818),
+        (uint32_t)(0x7f6a0dbb), (uint32_t)(0x086d3d2d), (uint32_t)(0x91646c97), (uint32_t)(0xe6635c01),
+        (uint32_t)(0x6b6b51f4), (uint32_t)(0x1c6c6162), (uint32_t)(0x856530d8), (uint32_t)(0xf262004e),
+        (uint32_t)(0x6c0695ed), (uint32_t)(0x1b01a57b), (uint32_t)(0x8208f4c1), (uint32_t)(0xf50fc457),
+        (uint32_t)(0x65b0d9c6), (uint32_t)(0x12b7e950), (uint32_t)(0x8bbeb8ea), (uint32_t)(0xfcb9887c),
+        (uint32_t)(0x62dd1ddf), (uint32_t)(0x15da2d49), (uint32_t)(0x8cd37cf3), (uint32_t)(0xfbd44c65),
+        (uint32_t)(0x4db26158), (uint32_t)(0x3ab551ce), (uint32_t)(0xa3bc0074), (uint32_t)(0xd4bb30e2),
+        (uint32_t)(0x4adfa541), (uint32_t)(0x3dd895d7), (uint32_t)(0xa4d1c46d), (uint32_t)(0xd3d6f4fb),
+        (uint32_t)(0x4369e96a), (uint32_t)(0x346ed9fc), (uint32_t)(0xad678846), (uint32_t)(0xda60b8d0),
+        (uint32_t)(0x44042d73), (uint32_t)(0x33031de5), (uint32_t)(0xaa0a4c5f), (uint32_t)(0xdd0d7cc9),
+        (uint32_t)(0x5005713c), (uint32_t)(0x270241aa), (uint32_t)(0xbe0b1010), (uint32_t)(0xc90c2086),
+        (uint32_t)(0x5768b525), (uint32_t)(0x206f85b3), (uint32_t)(0xb966d409), (uint32_t)(0xce61e49f),
+        (uint32_t)(0x5edef90e), (uint32_t)(0x29d9c998), (uint32_t)(0xb0d09822), (uint32_t)(0xc7d7a8b4),
+        (uint32_t)(0x59b33d17), (uint32_t)(0x2eb40d81), (uint32_t)(0xb7bd5c3b), (uint32_t)(0xc0ba6cad),
+        (uint32_t)(0xedb88320), (uint32_t)(0x9abfb3b6), (uint32_t)(0x03b6e20c), (uint32_t)(0x74b1d29a),
+        (uint32_t)(0xead54739), (uint32_t)(0x9dd277af), (uint32_t)(0x04db2615), (uint32_t)(0x73dc1683),
+        (uint32_t)(0xe3630b12), (uint32_t)(0x94643b84), (uint32_t)(0x0d6d6a3e), (uint32_t)(0x7a6a5aa8),
+        (uint32_t)(0xe40ecf0b), (uint32_t)(0x9309ff9d), (uint32_t)(0x0a00ae27), (uint32_t)(0x7d079eb1),
+        (uint32_t)(0xf00f9344), (uint32_t)(0x8708a3d2), (uint32_t)(0x1e01f268), (uint32_t)(0x6906c2fe),
+        (uint32_t)(0xf762575d), (uint32_t)(0x806567cb), (uint32_t)(0x196c3671), (uint32_t)(0x6e6b06e7),
+        (uint32_t)(0xfed41b76), (uint32_t)(0x89d32be0), (uint32_t)(0x10da7a5a), (uint32_t)(0x67dd4acc),
+        (uint32_t)(0xf9b9df6f), (uint32_t)(0x8ebeeff9), (uint32_t)(0x17b7be43), (uint32_t)(0x60b08ed5),
+        (uint32_t)(0xd6d6a3e8), (uint32_t)(0xa1d1937e), (uint32_t)(0x38d8c2c4), (uint32_t)(0x4fdff252),
+        (uint32_t)(0xd1bb67f1), (uint32_t)(0xa6bc5767), (uint32_t)(0x3fb506dd), (uint32_t)(0x48b2364b),
+        (uint32_t)(0xd80d2bda), (uint32_t)(0xaf0a1b4c), (uint32_t)(0x36034af6), (uint32_t)(0x41047a60),
+        (uint32_t)(0xdf60efc3), (uint32_t)(0xa867df55), (uint32_t)(0x316e8eef), (uint32_t)(0x4669be79),
+        (uint32_t)(0xcb61b38c), (uint32_t)(0xbc66831a), (uint32_t)(0x256fd2a0), (uint32_t)(0x5268e236),
+        (uint32_t)(0xcc0c7795), (uint32_t)(0xbb0b4703), (uint32_t)(0x220216b9), (uint32_t)(0x5505262f),
+        (uint32_t)(0xc5ba3bbe), (uint32_t)(0xb2bd0b28), (uint32_t)(0x2bb45a92), (uint32_t)(0x5cb36a04),
+        (uint32_t)(0xc2d7ffa7), (uint32_t)(0xb5d0cf31), (uint32_t)(0x2cd99e8b), (uint32_t)(0x5bdeae1d),
+        (uint32_t)(0x9b64c2b0), (uint32_t)(0xec63f226), (uint32_t)(0x756aa39c), (uint32_t)(0x026d930a),
+        (uint32_t)(0x9c0906a9), (uint32_t)(0xeb0e363f), (uint32_t)(0x72076785), (uint32_t)(0x05005713),
+        (uint32_t)(0x95bf4a82), (uint32_t)(0xe2b87a14), (uint32_t)(0x7bb12bae), (uint32_t)(0x0cb61b38),
+        (uint32_t)(0x92d28e9b), (uint32_t)(0xe5d5be0d), (uint32_t)(0x7cdcefb7), (uint32_t)(0x0bdbdf21),
+        (uint32_t)(0x86d3d2d4), (uint32_t)(0xf1d4e242), (uint32_t)(0x68ddb3f8), (uint32_t)(0x1fda836e),
+        (uint32_t)(0x81be16cd), (uint32_t)(0xf6b9265b), (uint32_t)(0x6fb077e1), (uint32_t)(0x18b74777),
+        (uint32_t)(0x88085ae6), (uint32_t)(0xff0f6a70), (uint32_t)(0x66063bca), (uint32_t)(0x11010b5c),
+        (uint32_t)(0x8f659eff), (uint32_t)(0xf862ae69), (uint32_t)(0x616bffd3), (uint32_t)(0x166ccf45),
+        (uint32_t)(0xa00ae278), (uint32_t)(0xd70dd2ee), (uint32_t)(0x4e048354), (uint32_t)(0x3903b3c2),
+        (uint32_t)(0xa7672661), (uint32_t)(0xd06016f7), (uint32_t)(0x4969474d), (uint32_t)(0x3e6e77db),
+        (uint32_t)(0xaed16a4a), (uint32_t)(0xd9d65adc), (uint32_t)(0x40df0b66), (uint32_t)(0x37d83bf0),
+        (uint32_t)(0xa9bcae53), (uint32_t)(0xdebb9ec5), (uint32_t)(0x47b2cf7f), (uint32_t)(0x30b5ffe9),
+        (uint32_t)(0xbdbdf21c), (uint32_t)(0xcabac28a), (uint32_t)(0x53b39330), (uint32_t)(0x24b4a3a6),
+        (uint32_t)(0xbad03605), (uint32_t)(0xcdd70693), (uint32_t)(0x54de5729), (uint32_t)(0x23d967bf),
+        (uint32_t)(0xb3667a2e), (uint32_t)(0xc4614ab8), (uint32_t)(0x5d681b02), (uint32_t)(0x2a6f2b94),
+        (uint32_t)(0xb40bbe37), (uint32_t)(0xc30c8ea1), (uint32_t)(0x5a05df1b), (uint32_t)(0x2d02ef8d)
+    },
+    {
+        (uint32_t)(0x00000000), (uint32_t)(0x191b3141), (uint32_t)(0x32366282), (uint32_t)(0x2b2d53c3),
+        (uint32_t)(0x646cc504), (uint32_t)(0x7d77f445), (uint32_t)(0x565aa786), (uint32_t)(0x4f4196c7),
+        (uint32_t)(0xc8d98a08), (uint32_t)(0xd1c2bb49), (uint32_t)(0xfaefe88a), (uint32_t)(0xe3f4d9cb),
+        (uint32_t)(0xacb54f0c), (uint32_t)(0xb5ae7e4d), (uint32_t)(0x9e832d8e), (uint32_t)(0x87981ccf),
+        (uint32_t)(0x4ac21251), (uint32_t)(0x53d92310), (uint32_t)(0x78f470d3), (uint32_t)(0x61ef4192),
+        (uint32_t)(0x2eaed755), (uint32_t)(0x37b5e614), (uint32_t)(0x1c98b5d7), (uint32_t)(0x05838496),
+        (uint32_t)(0x821b9859), (uint32_t)(0x9b00a918), (uint32_t)(0xb02dfadb), (uint32_t)(0xa936cb9a),
+        (uint32_t)(0xe6775d5d), (uint32_t)(0xff6c6c1c), (uint32_t)(0xd4413fdf), (uint32_t)(0xcd5a0e9e),
+        (uint32_t)(0x958424a2), (uint32_t)(0x8c9f15e3), (uint32_t)(0xa7b24620), (uint32_t)(0xbea97761),
+        (uint32_t)(0xf1e8e1a6), (uint32_t)(0xe8f3d0e7), (uint32_t)(0xc3de8324), (uint32_t)(0xdac5b265),
+        (uint32_t)(0x5d5daeaa), (uint32_t)(0x44469feb), (uint32_t)(0x6f6bcc28), (uint32_t)(0x7670fd69),
+        (uint32_t)(0x39316bae), (uint32_t)(0x202a5aef), (uint32_t)(0x0b07092c), (uint32_t)(0x121c386d),
+        (uint32_t)(0xdf4636f3), (uint32_t)(0xc65d07b2), (uint32_t)(0xed705471), (uint32_t)(0xf46b6530),
+        (uint32_t)(0xbb2af3f7), (uint32_t)(0xa231c2b6), (uint32_t)(0x891c9175), (uint32_t)(0x9007a034),
+        (uint32_t)(0x179fbcfb), (uint32_t)(0x0e848dba), (uint32_t)(0x25a9de79), (uint32_t)(0x3cb2ef38),
+        (uint32_t)(0x73f379ff), (uint32_t)(0x6ae848be), (uint32_t)(0x41c51b7d), (uint32_t)(0x58de2a3c),
+        (uint32_t)(0xf0794f05), (uint32_t)(0xe9627e44), (uint32_t)(0xc24f2d87), (uint32_t)(0xdb541cc6),
+        (uint32_t)(0x94158a01), (uint32_t)(0x8d0ebb40), (uint32_t)(0xa623e883), (uint32_t)(0xbf38d9c2),
+        (uint32_t)(0x38a0c50d), (uint32_t)(0x21bbf44c), (uint32_t)(0x0a96a78f), (uint32_t)(0x138d96ce),
+        (uint32_t)(0x5ccc0009), (uint32_t)(0x45d73148), (uint32_t)(0x6efa628b), (uint32_t)(0x77e153ca),
+        (uint32_t)(0xbabb5d54), (uint32_t)(0xa3a06c15), (uint32_t)(0x888d3fd6), (uint32_t)(0x91960e97),
+        (uint32_t)(0xded79850), (uint32_t)(0xc7cca911), (uint32_t)(0xece1fad2), (uint32_t)(0xf5facb93),
+        (uint32_t)(0x7262d75c), (uint32_t)(0x6b79e61d), (uint32_t)(0x4054b5de), (uint32_t)(0x594f849f),
+        (uint32_t)(0x160e1258), (uint32_t)(0x0f152319), (uint32_t)(0x243870da), (uint32_t)(0x3d23419b),
+        (uint32_t)(0x65fd6ba7), (uint32_t)(0x7ce65ae6), (uint32_t)(0x57cb0925), (uint32_t)(0x4ed03864),
+        (uint32_t)(0x0191aea3), (uint32_t)(0x188a9fe2), (uint32_t)(0x33a7cc21), (uint32_t)(0x2abcfd60),
+        (uint32_t)(0xad24e1af), (uint32_t)(0xb43fd0ee), (uint32_t)(0x9f12832d), (uint32_t)(0x8609b26c),
+        (uint32_t)(0xc94824ab), (uint32_t)(0xd05315ea), (uint32_t)(0xfb7e4629), (uint32_t)(0xe2657768),
+        (uint32_t)(0x2f3f79f6), (uint32_t)(0x362448b7), (uint32_t)(0x1d091b74), (uint32_t)(0x04122a35),
+        (uint32_t)(0x4b53bcf2), (uint32_t)(0x52488db3), (uint32_t)(0x7965de70), (uint32_t)(0x607eef31),
+        (uint32_t)(0xe7e6f3fe), (uint32_t)(0xfefdc2bf), (uint32_t)(0xd5d0917c), (uint32_t)(0xcccba03d),
+        (uint32_t)(0x838a36fa), (uint32_t)(0x9a9107bb), (uint32_t)(0xb1bc5478), (uint32_t)(0xa8a76539),
+        (uint32_t)(0x3b83984b), (uint32_t)(0x2298a90a), (uint32_t)(0x09b5fac9), (uint32_t)(0x10aecb88),
+        (uint32_t)(0x5fef5d4f), (uint32_t)(0x46f46c0e), (uint32_t)(0x6dd93fcd), (uint32_t)(0x74c20e8c),
+        (uint32_t)(0xf35a1243), (uint32_t)(0xea412302), (uint32_t)(0xc16c70c1), (uint32_t)(0xd8774180),
+        (uint32_t)(0x9736d747), (uint32_t)(0x8e2de606), (uint32_t)(0xa500b5c5), (uint32_t)(0xbc1b8484),
+        (uint32_t)(0x71418a1a), (uint32_t)(0x685abb5b), (uint32_t)(0x4377e898), (uint32_t)(0x5a6cd9d9),
+        (uint32_t)(0x152d4f1e), (uint32_t)(0x0c367e5f), (uint32_t)(0x271b2d9c), (uint32_t)(0x3e001cdd),
+        (uint32_t)(0xb9980012), (uint32_t)(0xa0833153), (uint32_t)(0x8bae6290), (uint32_t)(0x92b553d1),
+        (uint32_t)(0xddf4c516), (uint32_t)(0xc4eff457), (uint32_t)(0xefc2a794), (uint32_t)(0xf6d996d5),
+        (uint32_t)(0xae07bce9), (uint32_t)(0xb71c8da8), (uint32_t)(0x9c31de6b), (uint32_t)(0x852aef2a),
+        (uint32_t)(0xca6b79ed), (uint32_t)(0xd37048ac), (uint32_t)(0xf85d1b6f), (uint32_t)(0xe1462a2e),
+        (uint32_t)(0x66de36e1), (uint32_t)(0x7fc507a0), (uint32_t)(0x54e85463), (uint32_t)(0x4df36522),
+        (uint32_t)(0x02b2f3e5), (uint32_t)(0x1ba9c2a4), (uint32_t)(0x30849167), (uint32_t)(0x299fa026),
+        (uint32_t)(0xe4c5aeb8), (uint32_t)(0xfdde9ff9), (uint32_t)(0xd6f3cc3a), (uint32_t)(0xcfe8fd7b),
+        (uint32_t)(0x80a96bbc), (uint32_t)(0x99b25afd), (uint32_t)(0xb29f093e), (uint32_t)(0xab84387f),
+        (uint32_t)(0x2c1c24b0), (uint32_t)(0x350715f1), (uint32_t)(0x1e2a4632), (uint32_t)(0x07317773),
+        (uint32_t)(0x4870e1b4), (uint32_t)(0x516bd0f5), (uint32_t)(0x7a468336), (uint32_t)(0x635db277),
+        (uint32_t)(0xcbfad74e), (uint32_t)(0xd2e1e60f), (uint32_t)(0xf9ccb5cc), (uint32_t)(0xe0d7848d),
+        (uint32_t)(0xaf96124a), (uint32_t)(0xb68d230b), (uint32_t)(0x9da070c8), (uint32_t)(0x84bb4189),
+        (uint32_t)(0x03235d46), (uint32_t)(0x1a386c07), (uint32_t)(0x31153fc4), (uint32_t)(0x280e0e85),
+        (uint32_t)(0x674f9842), (uint32_t)(0x7e54a903), (uint32_t)(0x5579fac0), (uint32_t)(0x4c62cb81),
+        (uint32_t)(0x8138c51f), (uint32_t)(0x9823f45e), (uint32_t)(0xb30ea79d), (uint32_t)(0xaa1596dc),
+        (uint32_t)(0xe554001b), (uint32_t)(0xfc4f315a), (uint32_t)(0xd7626299), (uint32_t)(0xce7953d8),
+        (uint32_t)(0x49e14f17), (uint32_t)(0x50fa7e56), (uint32_t)(0x7bd72d95), (uint32_t)(0x62cc1cd4),
+        (uint32_t)(0x2d8d8a13), (uint32_t)(0x3496bb52), (uint32_t)(0x1fbbe891), (uint32_t)(0x06a0d9d0),
+        (uint32_t)(0x5e7ef3ec), (uint32_t)(0x4765c2ad), (uint32_t)(0x6c48916e), (uint32_t)(0x7553a02f),
+        (uint32_t)(0x3a1236e8), (uint32_t)(0x230907a9), (uint32_t)(0x0824546a), (uint32_t)(0x113f652b),
+        (uint32_t)(0x96a779e4), (uint32_t)(0x8fbc48a5), (uint32_t)(0xa4911b66), (uint32_t)(0xbd8a2a27),
+        (uint32_t)(0xf2cbbce0), (uint32_t)(0xebd08da1), (uint32_t)(0xc0fdde62), (uint32_t)(0xd9e6ef23),
+        (uint32_t)(0x14bce1bd), (uint32_t)(0x0da7d0fc), (uint32_t)(0x268a833f), (uint32_t)(0x3f91b27e),
+        (uint32_t)(0x70d024b9), (uint32_t)(0x69cb15f8), (uint32_t)(0x42e6463b), (uint32_t)(0x5bfd777a),
+        (uint32_t)(0xdc656bb5), (uint32_t)(0xc57e5af4), (uint32_t)(0xee530937), (uint32_t)(0xf7483876),
+        (uint32_t)(0xb809aeb1), (uint32_t)(0xa1129ff0), (uint32_t)(0x8a3fcc33), (uint32_t)(0x9324fd72)
+    },
+    {
+        (uint32_t)(0x00000000), (uint32_t)(0x01c26a37), (uint32_t)(0x0384d46e), (uint32_t)(0x0246be59),
+        (uint32_t)(0x0709a8dc), (uint32_t)(0x06cbc2eb), (uint32_t)(0x048d7cb2), (uint32_t)(0x054f1685),
+        (uint32_t)(0x0e1351b8), (uint32_t)(0x0fd13b8f), (uint32_t)(0x0d9785d6), (uint32_t)(0x0c55efe1),
+        (uint32_t)(0x091af964), (uint32_t)(0x08d89353), (uint32_t)(0x0a9e2d0a), (uint32_t)(0x0b5c473d),
+        (uint32_t)(0x1c26a370), (uint32_t)(0x1de4c947), (uint32_t)(0x1fa2771e), (uint32_t)(0x1e601d29),
+        (uint32_t)(0x1b2f0bac), (uint32_t)(0x1aed619b), (uint32_t)(0x18abdfc2), (uint32_t)(0x1969b5f5),
+        (uint32_t)(0x1235f2c8), (uint32_t)(0x13f798ff), (uint32_t)(0x11b126a6), (uint32_t)(0x10734c91),
+        (uint32_t)(0x153c5a14), (uint32_t)(0x14fe3023), (uint32_t)(0x16b88e7a), (uint32_t)(0x177ae44d),
+        (uint32_t)(0x384d46e0), (uint32_t)(0x398f2cd7), (uint32_t)(0x3bc9928e), (uint32_t)(0x3a0bf8b9),
+        (uint32_t)(0x3f44ee3c), (uint32_t)(0x3e86840b), (uint32_t)(0x3cc03a52), (uint32_t)(0x3d025065),
+        (uint32_t)(0x365e1758), (uint32_t)(0x379c7d6f), (uint32_t)(0x35dac336), (uint32_t)(0x3418a901),
+        (uint32_t)(0x3157bf84), (uint32_t)(0x3095d5b3), (uint32_t)(0x32d36bea), (uint32_t)(0x331101dd),
+        (uint32_t)(0x246be590), (uint32_t)(0x25a98fa7), (uint32_t)(0x27ef31fe), (uint32_t)(0x262d5bc9),
+        (uint32_t)(0x23624d4c), (uint32_t)(0x22a0277b), (uint32_t)(0x20e69922), (uint32_t)(0x2124f315),
+        (uint32_t)(0x2a78b428), (uint32_t)(0x2bbade1f), (uint32_t)(0x29fc6046), (uint32_t)(0x283e0a71),
+        (uint32_t)(0x2d711cf4), (uint32_t)(0x2cb376c3), (uint32_t)(0x2ef5c89a), (uint32_t)(0x2f37a2ad),
+        (uint32_t)(0x709a8dc0), (uint32_t)(0x7158e7f7), (uint32_t)(0x731e59ae), (uint32_t)(0x72dc3399),
+        (uint32_t)(0x7793251c), (uint32_t)(0x76514f2b), (uint32_t)(0x7417f172), (uint32_t)(0x75d59b45),
+        (uint32_t)(0x7e89dc78), (uint32_t)(0x7f4bb64f), (uint32_t)(0x7d0d0816), (uint32_t)(0x7ccf6221),
+        (uint32_t)(0x798074a4), (uint32_t)(0x78421e93), (uint32_t)(0x7a04a0ca), (uint32_t)(0x7bc6cafd),
+        (uint32_t)(0x6cbc2eb0), (uint32_t)(0x6d7e4487), (uint32_t)(0x6f38fade), (uint32_t)(0x6efa90e9),
+        (uint32_t)(0x6bb5866c), (uint32_t)(0x6a77ec5b), (uint32_t)(0x68315202), (uint32_t)(0x69f33835),
+        (uint32_t)(0x62af7f08), (uint32_t)(0x636d153f), (uint32_t)(0x612bab66), (uint32_t)(0x60e9c151),
+        (uint32_t)(0x65a6d7d4), (uint32_t)(0x6464bde3), (uint32_t)(0x662203ba), (uint32_t)(0x67e0698d),
+        (uint32_t)(0x48d7cb20), (uint32_t)(0x4915a117), (uint32_t)(0x4b531f4e), (uint32_t)(0x4a917579),
+        (uint32_t)(0x4fde63fc), (uint32_t)(0x4e1c09cb), (uint32_t)(0x4c5ab792), (uint32_t)(0x4d98dda5),
+        (uint32_t)(0x46c49a98), (uint32_t)(0x4706f0af), (uint32_t)(0x45404ef6), (uint32_t)(0x448224c1),
+        (uint32_t)(0x41cd3244), (uint32_t)(0x400f5873), (uint32_t)(0x4249e62a), (uint32_t)(0x438b8c1d),
+        (uint32_t)(0x54f16850), (uint32_t)(0x55330267), (uint32_t)(0x5775bc3e), (uint32_t)(0x56b7d609),
+        (uint32_t)(0x53f8c08c), (uint32_t)(0x523aaabb), (uint32_t)(0x507c14e2), (uint32_t)(0x51be7ed5),
+        (uint32_t)(0x5ae239e8), (uint32_t)(0x5b2053df), (uint32_t)(0x5966ed86), (uint32_t)(0x58a487b1),
+        (uint32_t)(0x5deb9134), (uint32_t)(0x5c29fb03), (uint32_t)(0x5e6f455a), (uint32_t)(0x5fad2f6d),
+        (uint32_t)(0xe1351b80), (uint32_t)(0xe0f771b7), (uint32_t)(0xe2b1cfee), (uint32_t)(0xe373a5d9),
+        (uint32_t)(0xe63cb35c), (uint32_t)(0xe7fed96b), (uint32_t)(0xe5b86732), (uint32_t)(0xe47a0d05),
+        (uint32_t)(0xef264a38), (uint32_t)(0xeee4200f), (uint32_t)(0xeca29e56), (uint32_t)(0xed60f461),
+        (uint32_t)(0xe82fe2e4), (uint32_t)(0xe9ed88d3), (uint32_t)(0xebab368a), (uint32_t)(0xea695cbd),
+        (uint32_t)(0xfd13b8f0), (uint32_t)(0xfcd1d2c7), (uint32_t)(0xfe976c9e), (uint32_t)(0xff5506a9),
+        (uint32_t)(0xfa1a102c), (uint32_t)(0xfbd87a1b), (uint32_t)(0xf99ec442), (uint32_t)(0xf85cae75),
+        (uint32_t)(0xf300e948), (uint32_t)(0xf2c2837f), (uint32_t)(0xf0843d26), (uint32_t)(0xf1465711),
+        (uint32_t)(0xf4094194), (uint32_t)(0xf5cb2ba3), (uint32_t)(0xf78d95fa), (uint32_t)(0xf64fffcd),
+        (uint32_t)(0xd9785d60), (uint32_t)(0xd8ba3757), (uint32_t)(0xdafc890e), (uint32_t)(0xdb3ee339),
+        (uint32_t)(0xde71f5bc), (uint32_t)(0xdfb39f8b), (uint32_t)(0xddf521d2), (uint32_t)(0xdc374be5),
+        (uint32_t)(0xd76b0cd8), (uint32_t)(0xd6a966ef), (uint32_t)(0xd4efd8b6), (uint32_t)(0xd52db281),
+        (uint32_t)(0xd062a404), (uint32_t)(0xd1a0ce33), (uint32_t)(0xd3e6706a), (uint32_t)(0xd2241a5d),
+        (uint32_t)(0xc55efe10), (uint32_t)(0xc49c9427), (uint32_t)(0xc6da2a7e), (uint32_t)(0xc7184049),
+        (uint32_t)(0xc25756cc), (uint32_t)(0xc3953cfb), (uint32_t)(0xc1d382a2), (uint32_t)(0xc011e895),
+        (uint32_t)(0xcb4dafa8), (uint32_t)(0xca8fc59f), (uint32_t)(0xc8c97bc6), (uint32_t)(0xc90b11f1),
+        (uint32_t)(0xcc440774), (uint32_t)(0xcd866d43), (uint32_t)(0xcfc0d31a), (uint32_t)(0xce02b92d),
+        (uint32_t)(0x91af9640), (uint32_t)(0x906dfc77), (uint32_t)(0x922b422e), (uint32_t)(0x93e92819),
+        (uint32_t)(0x96a63e9c), (uint32_t)(0x976454ab), (uint32_t)(0x9522eaf2), (uint32_t)(0x94e080c5),
+        (uint32_t)(0x9fbcc7f8), (uint32_t)(0x9e7eadcf), (uint32_t)(0x9c381396), (uint32_t)(0x9dfa79a1),
+        (uint32_t)(0x98b56f24), (uint32_t)(0x99770513), (uint32_t)(0x9b31bb4a), (uint32_t)(0x9af3d17d),
+        (uint32_t)(0x8d893530), (uint32_t)(0x8c4b5f07), (uint32_t)(0x8e0de15e), (uint32_t)(0x8fcf8b69),
+        (uint32_t)(0x8a809dec), (uint32_t)(0x8b42f7db), (uint32_t)(0x89044982), (uint32_t)(0x88c623b5),
+        (uint32_t)(0x839a6488), (uint32_t)(0x82580ebf), (uint32_t)(0x801eb0e6), (uint32_t)(0x81dcdad1),
+        (uint32_t)(0x8493cc54), (uint32_t)(0x8551a663), (uint32_t)(0x8717183a), (uint32_t)(0x86d5720d),
+        (uint32_t)(0xa9e2d0a0), (uint32_t)(0xa820ba97), (uint32_t)(0xaa6604ce), (uint32_t)(0xaba46ef9),
+        (uint32_t)(0xaeeb787c), (uint32_t)(0xaf29124b), (uint32_t)(0xad6fac12), (uint32_t)(0xacadc625),
+        (uint32_t)(0xa7f18118), (uint32_t)(0xa633eb2f), (uint32_t)(0xa4755576), (uint32_t)(0xa5b73f41),
+        (uint32_t)(0xa0f829c4), (uint32_t)(0xa13a43f3), (uint32_t)(0xa37cfdaa), (uint32_t)(0xa2be979d),
+        (uint32_t)(0xb5c473d0), (uint32_t)(0xb40619e7), (uint32_t)(0xb640a7be), (uint32_t)(0xb782cd89),
+        (uint32_t)(0xb2cddb0c), (uint32_t)(0xb30fb13b), (uint32_t)(0xb1490f62), (uint32_t)(0xb08b6555),
+        (uint32_t)(0xbbd72268), (uint32_t)(0xba15485f), (uint32_t)(0xb853f606), (uint32_t)(0xb9919c31),
+        (uint32_t)(0xbcde8ab4), (uint32_t)(0xbd1ce083), (uint32_t)(0xbf5a5eda), (uint32_t)(0xbe9834ed)
+    },
+    {
+        (uint32_t)(0x00000000), (uint32_t)(0xb8bc6765), (uint32_t)(0xaa09c88b), (uint32_t)(0x12b5afee),
+        (uint32_t)(0x8f629757), (uint32_t)(0x37def032), (uint32_t)(0x256b5fdc), (uint32_t)(0x9dd738b9),
+        (uint32_t)(0xc5b428ef), (uint32_t)(0x7d084f8a), (uint32_t)(0x6fbde064), (uint32_t)(0xd7018701),
+        (uint32_t)(0x4ad6bfb8), (uint32_t)(0xf26ad8dd), (uint32_t)(0xe0df7733), (uint32_t)(0x58631056),
+        (uint32_t)(0x5019579f), (uint32_t)(0xe8a530fa), (uint32_t)(0xfa109f14), (uint32_t)(0x42acf871),
+        (uint32_t)(0xdf7bc0c8), (uint32_t)(0x67c7a7ad), (uint32_t)(0x75720843), (uint32_t)(0xcdce6f26),
+        (uint32_t)(0x95ad7f70), (uint32_t)(0x2d111815), (uint32_t)(0x3fa4b7fb), (uint32_t)(0x8718d09e),
+        (uint32_t)(0x1acfe827), (uint32_t)(0xa2738f42), (uint32_t)(0xb0c620ac), (uint32_t)(0x087a47c9),
+        (uint32_t)(0xa032af3e), (uint32_t)(0x188ec85b), (uint32_t)(0x0a3b67b5), (uint32_t)(0xb28700d0),
+        (uint32_t)(0x2f503869), (uint32_t)(0x97ec5f0c), (uint32_t)(0x8559f0e2), (uint32_t)(0x3de59787),
+        (uint32_t)(0x658687d1), (uint32_t)(0xdd3ae0b4), (uint32_t)(0xcf8f4f5a), (uint32_t)(0x7733283f),
+        (uint32_t)(0xeae41086), (uint32_t)(0x525877e3), (uint32_t)(0x40edd80d), (uint32_t)(0xf851bf68),
+        (uint32_t)(0xf02bf8a1), (uint32_t)(0x48979fc4), (uint32_t)(0x5a22302a), (uint32_t)(0xe29e574f),
+        (uint32_t)(0x7f496ff6), (uint32_t)(0xc7f50893), (uint32_t)(0xd540a77d), (uint32_t)(0x6dfcc018),
+        (uint32_t)(0x359fd04e), (uint32_t)(0x8d23b72b), (uint32_t)(0x9f9618c5), (uint32_t)(0x272a7fa0),
+        (uint32_t)(0xbafd4719), (uint32_t)(0x0241207c), (uint32_t)(0x10f48f92), (uint32_t)(0xa848e8f7),
+        (uint32_t)(0x9b14583d), (uint32_t)(0x23a83f58), (uint32_t)(0x311d90b6), (uint32_t)(0x89a1f7d3),
+        (uint32_t)(0x1476cf6a), (uint32_t)(0xaccaa80f), (uint32_t)(0xbe7f07e1), (uint32_t)(0x06c36084),
+        (uint32_t)(0x5ea070d2), (uint32_t)(0xe61c17b7), (uint32_t)(0xf4a9b859), (uint32_t)(0x4c15df3c),
+        (uint32_t)(0xd1c2e785), (uint32_t)(0x697e80e0), (uint32_t)(0x7bcb2f0e), (uint32_t)(0xc377486b),
+        (uint32_t)(0xcb0d0fa2), (uint32_t)(0x73b168c7), (uint32_t)(0x6104c729), (uint32_t)(0xd9b8a04c),
+        (uint32_t)(0x446f98f5), (uint32_t)(0xfcd3ff90), (uint32_t)(0xee66507e), (uint32_t)(0x56da371b),
+        (uint32_t)(0x0eb9274d), (uint32_t)(0xb6054028), (uint32_t)(0xa4b0efc6), (uint32_t)(0x1c0c88a3),
+        (uint32_t)(0x81dbb01a), (uint32_t)(0x3967d77f), (uint32_t)(0x2bd27891), (uint32_t)(0x936e1ff4),
+        (uint32_t)(0x3b26f703), (uint32_t)(0x839a9066), (uint32_t)(0x912f3f88), (uint32_t)(0x299358ed),
+        (uint32_t)(0xb4446054), (uint32_t)(0x0cf80731), (uint32_t)(0x1e4da8df), (uint32_t)(0xa6f1cfba),
+        (uint32_t)(0xfe92dfec), (uint32_t)(0x462eb889), (uint32_t)(0x549b1767), (uint32_t)(0xec277002),
+        (uint32_t)(0x71f048bb), (uint32_t)(0xc94c2fde), (uint32_t)(0xdbf98030), (uint32_t)(0x6345e755),
+        (uint32_t)(0x6b3fa09c), (uint32_t)(0xd383c7f9), (uint32_t)(0xc1366817), (uint32_t)(0x798a0f72),
+        (uint32_t)(0xe45d37cb), (uint32_t)(0x5ce150ae), (uint32_t)(0x4e54ff40), (uint32_t)(0xf6e89825),
+        (uint32_t)(0xae8b8873), (uint32_t)(0x1637ef16), (uint32_t)(0x048240f8), (uint32_t)(0xbc3e279d),
+        (uint32_t)(0x21e91f24), (uint32_t)(0x99557841), (uint32_t)(0x8be0d7af), (uint32_t)(0x335cb0ca),
+        (uint32_t)(0xed59b63b), (uint32_t)(0x55e5d15e), (uint32_t)(0x47507eb0), (uint32_t)(0xffec19d5),
+        (uint32_t)(0x623b216c), (uint32_t)(0xda874609), (uint32_t)(0xc832e9e7), (uint32_t)(0x708e8e82),
+        (uint32_t)(0x28ed9ed4), (uint32_t)(0x9051f9b1), (uint32_t)(0x82e4565f), (uint32_t)(0x3a58313a),
+        (uint32_t)(0xa78f0983), (uint32_t)(0x1f336ee6), (uint32_t)(0x0d86c108), (uint32_t)(0xb53aa66d),
+        (uint32_t)(0xbd40e1a4), (uint32_t)(0x05fc86c1), (uint32_t)(0x1749292f), (uint32_t)(0xaff54e4a),
+        (uint32_t)(0x322276f3), (uint32_t)(0x8a9e1196), (uint32_t)(0x982bbe78), (uint32_t)(0x2097d91d),
+        (uint32_t)(0x78f4c94b), (uint32_t)(0xc048ae2e), (uint32_t)(0xd2fd01c0), (uint32_t)(0x6a4166a5),
+        (uint32_t)(0xf7965e1c), (uint32_t)(0x4f2a3979), (uint32_t)(0x5d9f9697), (uint32_t)(0xe523f1f2),
+        (uint32_t)(0x4d6b1905), (uint32_t)(0xf5d77e60), (uint32_t)(0xe762d18e), (uint32_t)(0x5fdeb6eb),
+        (uint32_t)(0xc2098e52), (uint32_t)(0x7ab5e937), (uint32_t)(0x680046d9), (uint32_t)(0xd0bc21bc),
+        (uint32_t)(0x88df31ea), (uint32_t)(0x3063568f), (uint32_t)(0x22d6f961), (uint32_t)(0x9a6a9e04),
+        (uint32_t)(0x07bda6bd), (uint32_t)(0xbf01c1d8), (uint32_t)(0xadb46e36), (uint32_t)(0x15080953),
+        (uint32_t)(0x1d724e9a), (uint32_t)(0xa5ce29ff), (uint32_t)(0xb77b8611), (uint32_t)(0x0fc7e174),
+        (uint32_t)(0x9210d9cd), (uint32_t)(0x2aacbea8), (uint32_t)(0x38191146), (uint32_t)(0x80a57623),
+        (uint32_t)(0xd8c66675), (uint32_t)(0x607a0110), (uint32_t)(0x72cfaefe), (uint32_t)(0xca73c99b),
+        (uint32_t)(0x57a4f122), (uint32_t)(0xef189647), (uint32_t)(0xfdad39a9), (uint32_t)(0x45115ecc),
+        (uint32_t)(0x764dee06), (uint32_t)(0xcef18963), (uint32_t)(0xdc44268d), (uint32_t)(0x64f841e8),
+        (uint32_t)(0xf92f7951), (uint32_t)(0x41931e34), (uint32_t)(0x5326b1da), (uint32_t)(0xeb9ad6bf),
+        (uint32_t)(0xb3f9c6e9), (uint32_t)(0x0b45a18c), (uint32_t)(0x19f00e62), (uint32_t)(0xa14c6907),
+        (uint32_t)(0x3c9b51be), (uint32_t)(0x842736db), (uint32_t)(0x96929935), (uint32_t)(0x2e2efe50),
+        (uint32_t)(0x2654b999), (uint32_t)(0x9ee8defc), (uint32_t)(0x8c5d7112), (uint32_t)(0x34e11677),
+        (uint32_t)(0xa9362ece), (uint32_t)(0x118a49ab), (uint32_t)(0x033fe645), (uint32_t)(0xbb838120),
+        (uint32_t)(0xe3e09176), (uint32_t)(0x5b5cf613), (uint32_t)(0x49e959fd), (uint32_t)(0xf1553e98),
+        (uint32_t)(0x6c820621), (uint32_t)(0xd43e6144), (uint32_t)(0xc68bceaa), (uint32_t)(0x7e37a9cf),
+        (uint32_t)(0xd67f4138), (uint32_t)(0x6ec3265d), (uint32_t)(0x7c7689b3), (uint32_t)(0xc4caeed6),
+        (uint32_t)(0x591dd66f), (uint32_t)(0xe1a1b10a), (uint32_t)(0xf3141ee4), (uint32_t)(0x4ba87981),
+        (uint32_t)(0x13cb69d7), (uint32_t)(0xab770eb2), (uint32_t)(0xb9c2a15c), (uint32_t)(0x017ec639),
+        (uint32_t)(0x9ca9fe80), (uint32_t)(0x241599e5), (uint32_t)(0x36a0360b), (uint32_t)(0x8e1c516e),
+        (uint32_t)(0x866616a7), (uint32_t)(0x3eda71c2), (uint32_t)(0x2c6fde2c), (uint32_t)(0x94d3b949),
+        (uint32_t)(0x090481f0), (uint32_t)(0xb1b8e695), (uint32_t)(0xa30d497b), (uint32_t)(0x1bb12e1e),
+        (uint32_t)(0x43d23e48), (uint32_t)(0xfb6e592d), (uint32_t)(0xe9dbf6c3), (uint32_t)(0x516791a6),
+        (uint32_t)(0xccb0a91f), (uint32_t)(0x740cce7a), (uint32_t)(0x66b96194), (uint32_t)(0xde0506f1)
+    },
+    {
+        (uint32_t)(0x00000000), (uint32_t)(0x3d6029b0), (uint32_t)(0x7ac05360), (uint32_t)(0x47a07ad0),
+        (uint32_t)(0xf580a6c0), (uint32_t)(0xc8e08f70), (uint32_t)(0x8f40f5a0), (uint32_t)(0xb220dc10),
+        (uint32_t)(0x30704bc1), (uint32_t)(0x0d106271), (uint32_t)(0x4ab018a1), (uint32_t)(0x77d03111),
+        (uint32_t)(0xc5f0ed01), (uint32_t)(0xf890c4b1), (uint32_t)(0xbf30be61), (uint32_t)(0x825097d1),
+        (uint32_t)(0x60e09782), (uint32_t)(0x5d80be32), (uint32_t)(0x1a20c4e2), (uint32_t)(0x2740ed52),
+        (uint32_t)(0x95603142), (uint32_t)(0xa80018f2), (uint32_t)(0xefa06222), (uint32_t)(0xd2c04b92),
+        (uint32_t)(0x5090dc43), (uint32_t)(0x6df0f5f3), (uint32_t)(0x2a508f23), (uint32_t)(0x1730a693),
+        (uint32_t)(0xa5107a83), (uint32_t)(0x98705333), (uint32_t)(0xdfd029e3), (uint32_t)(0xe2b00053),
+        (uint32_t)(0xc1c12f04), (uint32_t)(0xfca106b4), (uint32_t)(0xbb017c64), (uint32_t)(0x866155d4),
+        (uint32_t)(0x344189c4), (uint32_t)(0x0921a074), (uint32_t)(0x4e81daa4), (uint32_t)(0x73e1f314),
+        (uint32_t)(0xf1b164c5), (uint32_t)(0xccd14d75), (uint32_t)(0x8b7137a5), (uint32_t)(0xb6111e15),
+        (uint32_t)(0x0431c205), (uint32_t)(0x3951ebb5), (uint32_t)(0x7ef19165), (uint32_t)(0x4391b8d5),
+        (uint32_t)(0xa121b886), (uint32_t)(0x9c419136), (uint32_t)(0xdbe1ebe6), (uint32_t)(0xe681c256),
+        (uint32_t)(0x54a11e46), (uint32_t)(0x69c137f6), (uint32_t)(0x2e614d26), (uint32_t)(0x13016496),
+        (uint32_t)(0x9151f347), (uint32_t)(0xac31daf7), (uint32_t)(0xeb91a027), (uint32_t)(0xd6f18997),
+        (uint32_t)(0x64d15587), (uint32_t)(0x59b17c37), (uint32_t)(0x1e1106e7), (uint32_t)(0x23712f57),
+        (uint32_t)(0x58f35849), (uint32_t)(0x659371f9), (uint32_t)(0x22330b29), (uint32_t)(0x1f532299),
+        (uint32_t)(0xad73fe89), (uint32_t)(0x9013d739), (uint32_t)(0xd7b3ade9), (uint32_t)(0xead38459),
+        (uint32_t)(0x68831388), (uint32_t)(0x55e33a38), (uint32_t)(0x124340e8), (uint32_t)(0x2f236958),
+        (uint32_t)(0x9d03b548), (uint32_t)(0xa0639cf8), (uint32_t)(0xe7c3e628), (uint32_t)(0xdaa3cf98),
+        (uint32_t)(0x3813cfcb), (uint32_t)(0x0573e67b), (uint32_t)(0x42d39cab), (uint32_t)(0x7fb3b51b),
+        (uint32_t)(0xcd93690b), (uint32_t)(0xf0f340bb), (uint32_t)(0xb7533a6b), (uint32_t)(0x8a3313db),
+        (uint32_t)(0x0863840a), (uint32_t)(0x3503adba), (uint32_t)(0x72a3d76a), (uint32_t)(0x4fc3feda),
+        (uint32_t)(0xfde322ca), (uint32_t)(0xc0830b7a), (uint32_t)(0x872371aa), (uint32_t)(0xba43581a),
+        (uint32_t)(0x9932774d), (uint32_t)(0xa4525efd), (uint32_t)(0xe3f2242d), (uint32_t)(0xde920d9d),
+        (uint32_t)(0x6cb2d18d), (uint32_t)(0x51d2f83d), (uint32_t)(0x167282ed), (uint32_t)(0x2b12ab5d),
+        (uint32_t)(0xa9423c8c), (uint32_t)(0x9422153c), (uint32_t)(0xd3826fec), (uint32_t)(0xeee2465c),
+        (uint32_t)(0x5cc29a4c), (uint32_t)(0x61a2b3fc), (uint32_t)(0x2602c92c), (uint32_t)(0x1b62e09c),
+        (uint32_t)(0xf9d2e0cf), (uint32_t)(0xc4b2c97f), (uint32_t)(0x8312b3af), (uint32_t)(0xbe729a1f),
+        (uint32_t)(0x0c52460f), (uint32_t)(0x31326fbf), (uint32_t)(0x7692156f), (uint32_t)(0x4bf23cdf),
+        (uint32_t)(0xc9a2ab0e), (uint32_t)(0xf4c282be), (uint32_t)(0xb362f86e), (uint32_t)(0x8e02d1de),
+        (uint32_t)(0x3c220dce), (uint32_t)(0x0142247e), (uint32_t)(0x46e25eae), (uint32_t)(0x7b82771e),
+        (uint32_t)(0xb1e6b092), (uint32_t)(0x8c869922), (uint32_t)(0xcb26e3f2), (uint32_t)(0xf646ca42),
+        (uint32_t)(0x44661652), (uint32_t)(0x79063fe2), (uint32_t)(0x3ea64532), (uint32_t)(0x03c66c82),
+        (uint32_t)(0x8196fb53), (uint32_t)(0xbcf6d2e3), (uint32_t)(0xfb56a833), (uint32_t)(0xc6368183),
+        (uint32_t)(0x74165d93), (uint32_t)(0x49767423), (uint32_t)(0x0ed60ef3), (uint32_t)(0x33b62743),
+        (uint32_t)(0xd1062710), (uint32_t)(0xec660ea0), (uint32_t)(0xabc67470), (uint32_t)(0x96a65dc0),
+        (uint32_t)(0x248681d0), (uint32_t)(0x19e6a860), (uint32_t)(0x5e46d2b0), (uint32_t)(0x6326fb00),
+        (uint32_t)(0xe1766cd1), (uint32_t)(0xdc164561), (uint32_t)(0x9bb63fb1), (uint32_t)(0xa6d61601),
+        (uint32_t)(0x14f6ca11), (uint32_t)(0x2996e3a1), (uint32_t)(0x6e369971), (uint32_t)(0x5356b0c1),
+        (uint32_t)(0x70279f96), (uint32_t)(0x4d47b626), (uint32_t)(0x0ae7ccf6), (uint32_t)(0x3787e546),
+        (uint32_t)(0x85a73956), (uint32_t)(0xb8c710e6), (uint32_t)(0xff676a36), (uint32_t)(0xc2074386),
+        (uint32_t)(0x4057d457), (uint32_t)(0x7d37fde7), (uint32_t)(0x3a978737), (uint32_t)(0x07f7ae87),
+        (uint32_t)(0xb5d77297), (uint32_t)(0x88b75b27), (uint32_t)(0xcf1721f7), (uint32_t)(0xf2770847),
+        (uint32_t)(0x10c70814), (uint32_t)(0x2da721a4), (uint32_t)(0x6a075b74), (uint32_t)(0x576772c4),
+        (uint32_t)(0xe547aed4), (uint32_t)(0xd8278764), (uint32_t)(0x9f87fdb4), (uint32_t)(0xa2e7d404),
+        (uint32_t)(0x20b743d5), (uint32_t)(0x1dd76a65), (uint32_t)(0x5a7710b5), (uint32_t)(0x67173905),
+        (uint32_t)(0xd537e515), (uint32_t)(0xe857cca5), (uint32_t)(0xaff7b675), (uint32_t)(0x92979fc5),
+        (uint32_t)(0xe915e8db), (uint32_t)(0xd475c16b), (uint32_t)(0x93d5bbbb), (uint32_t)(0xaeb5920b),
+        (uint32_t)(0x1c954e1b), (uint32_t)(0x21f567ab), (uint32_t)(0x66551d7b), (uint32_t)(0x5b3534cb),
+        (uint32_t)(0xd965a31a), (uint32_t)(0xe4058aaa), (uint32_t)(0xa3a5f07a), (uint32_t)(0x9ec5d9ca),
+        (uint32_t)(0x2ce505da), (uint32_t)(0x11852c6a), (uint32_t)(0x562556ba), (uint32_t)(0x6b457f0a),
+        (uint32_t)(0x89f57f59), (uint32_t)(0xb49556e9), (uint32_t)(0xf3352c39), (uint32_t)(0xce550589),
+        (uint32_t)(0x7c75d999), (uint32_t)(0x4115f029), (uint32_t)(0x06b58af9), (uint32_t)(0x3bd5a349),
+        (uint32_t)(0xb9853498), (uint32_t)(0x84e51d28), (uint32_t)(0xc34567f8), (uint32_t)(0xfe254e48),
+        (uint32_t)(0x4c059258), (uint32_t)(0x7165bbe8), (uint32_t)(0x36c5c138), (uint32_t)(0x0ba5e888),
+        (uint32_t)(0x28d4c7df), (uint32_t)(0x15b4ee6f), (uint32_t)(0x521494bf), (uint32_t)(0x6f74bd0f),
+        (uint32_t)(0xdd54611f), (uint32_t)(0xe03448af), (uint32_t)(0xa794327f), (uint32_t)(0x9af41bcf),
+        (uint32_t)(0x18a48c1e), (uint32_t)(0x25c4a5ae), (uint32_t)(0x6264df7e), (uint32_t)(0x5f04f6ce),
+        (uint32_t)(0xed242ade), (uint32_t)(0xd044036e), (uint32_t)(0x97e479be), (uint32_t)(0xaa84500e),
+        (uint32_t)(0x4834505d), (uint32_t)(0x755479ed), (uint32_t)(0x32f4033d), (uint32_t)(0x0f942a8d),
+        (uint32_t)(0xbdb4f69d), (uint32_t)(0x80d4df2d), (uint32_t)(0xc774a5fd), (uint32_t)(0xfa148c4d),
+        (uint32_t)(0x78441b9c), (uint32_t)(0x4524322c), (uint32_t)(0x028448fc), (uint32_t)(0x3fe4614c),
+        (uint32_t)(0x8dc4bd5c), (uint32_t)(0xb0a494ec), (uint32_t)(0xf704ee3c), (uint32_t)(0xca64c78c)
+    },
+    {
+        (uint32_t)(0x00000000), (uint32_t)(0xcb5cd3a5), (uint32_t)(0x4dc8a10b), (uint32_t)(0x869472ae),
+        (uint32_t)(0x9b914216), (uint32_t)(0x50cd91b3), (uint32_t)(0xd659e31d), (uint32_t)(0x1d0530b8),
+        (uint32_t)(0xec53826d), (uint32_t)(0x270f51c8), (uint32_t)(0xa19b2366), (uint32_t)(0x6ac7f0c3),
+        (uint32_t)(0x77c2c07b), (uint32_t)(0xbc9e13de), (uint32_t)(0x3a0a6170), (uint32_t)(0xf156b2d5),
+        (uint32_t)(0x03d6029b), (uint32_t)(0xc88ad13e), (uint32_t)(0x4e1ea390), (uint32_t)(0x85427035),
+        (uint32_t)(0x9847408d), (uint32_t)(0x531b9328), (uint32_t)(0xd58fe186), (uint32_t)(0x1ed33223),
+        (uint32_t)(0xef8580f6), (uint32_t)(0x24d95353), (uint32_t)(0xa24d21fd), (uint32_t)(0x6911f258),
+        (uint32_t)(0x7414c2e0), (uint32_t)(0xbf481145), (uint32_t)(0x39dc63eb), (uint32_t)(0xf280b04e),
+        (uint32_t)(0x07ac0536), (uint32_t)(0xccf0d693), (uint32_t)(0x4a64a43d), (uint32_t)(0x81387798),
+        (uint32_t)(0x9c3d4720), (uint32_t)(0x57619485), (uint32_t)(0xd1f5e62b), (uint32_t)(0x1aa9358e),
+        (uint32_t)(0xebff875b), (uint32_t)(0x20a354fe), (uint32_t)(0xa6372650), (uint32_t)(0x6d6bf5f5),
+        (uint32_t)(0x706ec54d), (uint32_t)(0xbb3216e8), (uint32_t)(0x3da66446), (uint32_t)(0xf6fab7e3),
+        (uint32_t)(0x047a07ad), (uint32_t)(0xcf26d408), (uint32_t)(0x49b2a6a6), (uint32_t)(0x82ee7503),
+        (uint32_t)(0x9feb45bb), (uint32_t)(0x54b7961e), (uint32_t)(0xd223e4b0), (uint32_t)(0x197f3715),
+        (uint32_t)(0xe82985c0), (uint32_t)(0x23755665), (uint32_t)(0xa5e124cb), (uint32_t)(0x6ebdf76e),
+        (uint32_t)(0x73b8c7d6), (uint32_t)(0xb8e41473), (uint32_t)(0x3e7066dd), (uint32_t)(0xf52cb578),
+        (uint32_t)(0x0f580a6c), (uint32_t)(0xc404d9c9), (uint32_t)(0x4290ab67), (uint32_t)(0x89cc78c2),
+        (uint32_t)(0x94c9487a), (uint32_t)(0x5f959bdf), (uint32_t)(0xd901e971), (uint32_t)(0x125d3ad4),
+        (uint32_t)(0xe30b8801), (uint32_t)(0x28575ba4), (uint32_t)(0xaec3290a), (uint32_t)(0x659ffaaf),
+        (uint32_t)(0x789aca17), (uint32_t)(0xb3c619b2), (uint32_t)(0x35526b1c), (uint32_t)(0xfe0eb8b9),
+        (uint32_t)(0x0c8e08f7), (uint32_t)(0xc7d2db52), (uint32_t)(0x4146a9fc), (uint32_t)(0x8a1a7a59),
+        (uint32_t)(0x971f4ae1), (uint32_t)(0x5c439944), (uint32_t)(0xdad7ebea), (uint32_t)(0x118b384f),
+        (uint32_t)(0xe0dd8a9a), (uint32_t)(0x2b81593f), (uint32_t)(0xad152b91), (uint32_t)(0x6649f834),
+        (uint32_t)(0x7b4cc88c), (uint32_t)(0xb0101b29), (uint32_t)(0x36846987), (uint32_t)(0xfdd8ba22),
+        (uint32_t)(0x08f40f5a), (uint32_t)(0xc3a8dcff), (uint32_t)(0x453cae51), (uint32_t)(0x8e607df4),
+        (uint32_t)(0x93654d4c), (uint32_t)(0x58399ee9), (uint32_t)(0xdeadec47), (uint32_t)(0x15f13fe2),
+        (uint32_t)(0xe4a78d37), (uint32_t)(0x2ffb5e92), (uint32_t)(0xa96f2c3c), (uint32_t)(0x6233ff99),
+        (uint32_t)(0x7f36cf21), (uint32_t)(0xb46a1c84), (uint32_t)(0x32fe6e2a), (uint32_t)(0xf9a2bd8f),
+        (uint32_t)(0x0b220dc1), (uint32_t)(0xc07ede64), (uint32_t)(0x46eaacca), (uint32_t)(0x8db67f6f),
+        (uint32_t)(0x90b34fd7), (uint32_t)(0x5bef9c72), (uint32_t)(0xdd7beedc), (uint32_t)(0x16273d79),
+        (uint32_t)(0xe7718fac), (uint32_t)(0x2c2d5c09), (uint32_t)(0xaab92ea7), (uint32_t)(0x61e5fd02),
+        (uint32_t)(0x7ce0cdba), (uint32_t)(0xb7bc1e1f), (uint32_t)(0x31286cb1), (uint32_t)(0xfa74bf14),
+        (uint32_t)(0x1eb014d8), (uint32_t)(0xd5ecc77d), (uint32_t)(0x5378b5d3), (uint32_t)(0x98246676),
+        (uint32_t)(0x852156ce), (uint32_t)(0x4e7d856b), (uint32_t)(0xc8e9f7c5), (uint32_t)(0x03b52460),
+        (uint32_t)(0xf2e396b5), (uint32_t)(0x39bf4510), (uint32_t)(0xbf2b37be), (uint32_t)(0x7477e41b),
+        (uint32_t)(0x6972d4a3), (uint32_t)(0xa22e0706), (uint32_t)(0x24ba75a8), (uint32_t)(0xefe6a60d),
+        (uint32_t)(0x1d661643), (uint32_t)(0xd63ac5e6), (uint32_t)(0x50aeb748), (uint32_t)(0x9bf264ed),
+        (uint32_t)(0x86f75455), (uint32_t)(0x4dab87f0), (uint32_t)(0xcb3ff55e), (uint32_t)(0x006326fb),
+        (uint32_t)(0xf135942e), (uint32_t)(0x3a69478b), (uint32_t)(0xbcfd3525), (uint32_t)(0x77a1e680),
+        (uint32_t)(0x6aa4d638), (uint32_t)(0xa1f8059d), (uint32_t)(0x276c7733), (uint32_t)(0xec30a496),
+        (uint32_t)(0x191c11ee), (uint32_t)(0xd240c24b), (uint32_t)(0x54d4b0e5), (uint32_t)(0x9f886340),
+        (uint32_t)(0x828d53f8), (uint32_t)(0x49d1805d), (uint32_t)(0xcf45f2f3), (uint32_t)(0x04192156),
+        (uint32_t)(0xf54f9383), (uint32_t)(0x3e134026), (uint32_t)(0xb8873288), (uint32_t)(0x73dbe12d),
+        (uint32_t)(0x6eded195), (uint32_t)(0xa5820230), (uint32_t)(0x2316709e), (uint32_t)(0xe84aa33b),
+        (uint32_t)(0x1aca1375), (uint32_t)(0xd196c0d0), (uint32_t)(0x5702b27e), (uint32_t)(0x9c5e61db),
+        (uint32_t)(0x815b5163), (uint32_t)(0x4a0782c6), (uint32_t)(0xcc93f068), (uint32_t)(0x07cf23cd),
+        (uint32_t)(0xf6999118), (uint32_t)(0x3dc542bd), (uint32_t)(0xbb513013), (uint32_t)(0x700de3b6),
+        (uint32_t)(0x6d08d30e), (uint32_t)(0xa65400ab), (uint32_t)(0x20c07205), (uint32_t)(0xeb9ca1a0),
+        (uint32_t)(0x11e81eb4), (uint32_t)(0xdab4cd11), (uint32_t)(0x5c20bfbf), (uint32_t)(0x977c6c1a),
+        (uint32_t)(0x8a795ca2), (uint32_t)(0x41258f07), (uint32_t)(0xc7b1fda9), (uint32_t)(0x0ced2e0c),
+        (uint32_t)(0xfdbb9cd9), (uint32_t)(0x36e74f7c), (uint32_t)(0xb0733dd2), (uint32_t)(0x7b2fee77),
+        (uint32_t)(0x662adecf), (uint32_t)(0xad760d6a), (uint32_t)(0x2be27fc4), (uint32_t)(0xe0beac61),
+        (uint32_t)(0x123e1c2f), (uint32_t)(0xd962cf8a), (uint32_t)(0x5ff6bd24), (uint32_t)(0x94aa6e81),
+        (uint32_t)(0x89af5e39), (uint32_t)(0x42f38d9c), (uint32_t)(0xc467ff32), (uint32_t)(0x0f3b2c97),
+        (uint32_t)(0xfe6d9e42), (uint32_t)(0x35314de7), (uint32_t)(0xb3a53f49), (uint32_t)(0x78f9ecec),
+        (uint32_t)(0x65fcdc54), (uint32_t)(0xaea00ff1), (uint32_t)(0x28347d5f), (uint32_t)(0xe368aefa),
+        (uint32_t)(0x16441b82), (uint32_t)(0xdd18c827), (uint32_t)(0x5b8cba89), (uint32_t)(0x90d0692c),
+        (uint32_t)(0x8dd55994), (uint32_t)(0x46898a31), (uint32_t)(0xc01df89f), (uint32_t)(0x0b412b3a),
+        (uint32_t)(0xfa1799ef), (uint32_t)(0x314b4a4a), (uint32_t)(0xb7df38e4), (uint32_t)(0x7c83eb41),
+        (uint32_t)(0x6186dbf9), (uint32_t)(0xaada085c), (uint32_t)(0x2c4e7af2), (uint32_t)(0xe712a957),
+        (uint32_t)(0x15921919), (uint32_t)(0xdececabc), (uint32_t)(0x585ab812), (uint32_t)(0x93066bb7),
+        (uint32_t)(0x8e035b0f), (uint32_t)(0x455f88aa), (uint32_t)(0xc3cbfa04), (uint32_t)(0x089729a1),
+        (uint32_t)(0xf9c19b74), (uint32_t)(0x329d48d1), (uint32_t)(0xb4093a7f), (uint32_t)(0x7f55e9da),
+        (uint32_t)(0x6250d962), (uint32_t)(0xa90c0ac7), (uint32_t)(0x2f987869), (uint32_t)(0xe4c4abcc)
+    },
+    {
+        (uint32_t)(0x00000000), (uint32_t)(0xa6770bb4), (uint32_t)(0x979f1129), (uint32_t)(0x31e81a9d),
+        (uint32_t)(0xf44f2413), (uint32_t)(0x52382fa7), (uint32_t)(0x63d0353a), (uint32_t)(0xc5a73e8e),
+        (uint32_t)(0x33ef4e67), (uint32_t)(0x959845d3), (uint32_t)(0xa4705f4e), (uint32_t)(0x020754fa),
+        (uint32_t)(0xc7a06a74), (uint32_t)(0x61d761c0), (uint32_t)(0x503f7b5d), (uint32_t)(0xf64870e9),
+        (uint32_t)(0x67de9cce), (uint32_t)(0xc1a9977a), (uint32_t)(0xf0418de7), (uint32_t)(0x56368653),
+        (uint32_t)(0x9391b8dd), (uint32_t)(0x35e6b369), (uint32_t)(0x040ea9f4), (uint32_t)(0xa279a240),
+        (uint32_t)(0x5431d2a9), (uint32_t)(0xf246d91d), (uint32_t)(0xc3aec380), (uint32_t)(0x65d9c834),
+        (uint32_t)(0xa07ef6ba), (uint32_t)(0x0609fd0e), (uint32_t)(0x37e1e793), (uint32_t)(0x9196ec27),
+        (uint32_t)(0xcfbd399c), (uint32_t)(0x69ca3228), (uint32_t)(0x582228b5), (uint32_t)(0xfe552301),
+        (uint32_t)(0x3bf21d8f), (uint32_t)(0x9d85163b), (uint32_t)(0xac6d0ca6), (uint32_t)(0x0a1a0712),
+        (uint32_t)(0xfc5277fb), (uint32_t)(0x5a257c4f), (uint32_t)(0x6bcd66d2), (uint32_t)(0xcdba6d66),
+        (uint32_t)(0x081d53e8), (uint32_t)(0xae6a585c), (uint32_t)(0x9f8242c1), (uint32_t)(0x39f54975),
+        (uint32_t)(0xa863a552), (uint32_t)(0x0e14aee6), (uint32_t)(0x3ffcb47b), (uint32_t)(0x998bbfcf),
+        (uint32_t)(0x5c2c8141), (uint32_t)(0xfa5b8af5), (uint32_t)(0xcbb39068), (uint32_t)(0x6dc49bdc),
+        (uint32_t)(0x9b8ceb35), (uint32_t)(0x3dfbe081), (uint32_t)(0x0c13fa1c), (uint32_t)(0xaa64f1a8),
+        (uint32_t)(0x6fc3cf26), (uint32_t)(0xc9b4c492), (uint32_t)(0xf85cde0f), (uint32_t)(0x5e2bd5bb),
+        (uint32_t)(0x440b7579), (uint32_t)(0xe27c7ecd), (uint32_t)(0xd3946450), (uint32_t)(0x75e36fe4),
+        (uint32_t)(0xb044516a), (uint32_t)(0x16335ade), (uint32_t)(0x27db4043), (uint32_t)(0x81ac4bf7),
+        (uint32_t)(0x77e43b1e), (uint32_t)(0xd19330aa), (uint32_t)(0xe07b2a37), (uint32_t)(0x460c2183),
+        (uint32_t)(0x83ab1f0d), (uint32_t)(0x25dc14b9), (uint32_t)(0x14340e24), (uint32_t)(0xb2430590),
+        (uint32_t)(0x23d5e9b7), (uint32_t)(0x85a2e203), (uint32_t)(0xb44af89e), (uint32_t)(0x123df32a),
+        (uint32_t)(0xd79acda4), (uint32_t)(0x71edc610), (uint32_t)(0x4005dc8d), (uint32_t)(0xe672d739),
+        (uint32_t)(0x103aa7d0), (uint32_t)(0xb64dac64), (uint32_t)(0x87a5b6f9), (uint32_t)(0x21d2bd4d),
+        (uint32_t)(0xe47583c3), (uint32_t)(0x42028877), (uint32_t)(0x73ea92ea), (uint32_t)(0xd59d995e),
+        (uint32_t)(0x8bb64ce5), (uint32_t)(0x2dc14751), (uint32_t)(0x1c295dcc), (uint32_t)(0xba5e5678),
+        (uint32_t)(0x7ff968f6), (uint32_t)(0xd98e6342), (uint32_t)(0xe86679df), (uint32_t)(0x4e11726b),
+        (uint32_t)(0xb8590282), (uint32_t)(0x1e2e0936), (uint32_t)(0x2fc613ab), (uint32_t)(0x89b1181f),
+        (uint32_t)(0x4c162691), (uint32_t)(0xea612d25), (uint32_t)(0xdb8937b8), (uint32_t)(0x7dfe3c0c),
+        (uint32_t)(0xec68d02b), (uint32_t)(0x4a1fdb9f), (uint32_t)(0x7bf7c102), (uint32_t)(0xdd80cab6),
+        (uint32_t)(0x1827f438), (uint32_t)(0xbe50ff8c), (uint32_t)(0x8fb8e511), (uint32_t)(0x29cfeea5),
+        (uint32_t)(0xdf879e4c), (uint32_t)(0x79f095f8), (uint32_t)(0x48188f65), (uint32_t)(0xee6f84d1),
+        (uint32_t)(0x2bc8ba5f), (uint32_t)(0x8dbfb1eb), (uint32_t)(0xbc57ab76), (uint32_t)(0x1a20a0c2),
+        (uint32_t)(0x8816eaf2), (uint32_t)(0x2e61e146), (uint32_t)(0x1f89fbdb), (uint32_t)(0xb9fef06f),
+        (uint32_t)(0x7c59cee1), (uint32_t)(0xda2ec555), (uint32_t)(0xebc6dfc8), (uint32_t)(0x4db1d47c),
+        (uint32_t)(0xbbf9a495), (uint32_t)(0x1d8eaf21), (uint32_t)(0x2c66b5bc), (uint32_t)(0x8a11be08),
+        (uint32_t)(0x4fb68086), (uint32_t)(0xe9c18b32), (uint32_t)(0xd82991af), (uint32_t)(0x7e5e9a1b),
+        (uint32_t)(0xefc8763c), (uint32_t)(0x49bf7d88), (uint32_t)(0x78576715), (uint32_t)(0xde206ca1),
+        (uint32_t)(0x1b87522f), (uint32_t)(0xbdf0599b), (uint32_t)(0x8c184306), (uint32_t)(0x2a6f48b2),
+        (uint32_t)(0xdc27385b), (uint32_t)(0x7a5033ef), (uint32_t)(0x4bb82972), (uint32_t)(0xedcf22c6),
+        (uint32_t)(0x28681c48), (uint32_t)(0x8e1f17fc), (uint32_t)(0xbff70d61), (uint32_t)(0x198006d5),
+        (uint32_t)(0x47abd36e), (uint32_t)(0xe1dcd8da), (uint32_t)(0xd034c247), (uint32_t)(0x7643c9f3),
+        (uint32_t)(0xb3e4f77d), (uint32_t)(0x1593fcc9), (uint32_t)(0x247be654), (uint32_t)(0x820cede0),
+        (uint32_t)(0x74449d09), (uint32_t)(0xd23396bd), (uint32_t)(0xe3db8c20), (uint32_t)(0x45ac8794),
+        (uint32_t)(0x800bb91a), (uint32_t)(0x267cb2ae), (uint32_t)(0x1794a833), (uint32_t)(0xb1e3a387),
+        (uint32_t)(0x20754fa0), (uint32_t)(0x86024414), (uint32_t)(0xb7ea5e89), (uint32_t)(0x119d553d),
+        (uint32_t)(0xd43a6bb3), (uint32_t)(0x724d6007), (uint32_t)(0x43a57a9a), (uint32_t)(0xe5d2712e),
+        (uint32_t)(0x139a01c7), (uint32_t)(0xb5ed0a73), (uint32_t)(0x840510ee), (uint32_t)(0x22721b5a),
+        (uint32_t)(0xe7d525d4), (uint32_t)(0x41a22e60), (uint32_t)(0x704a34fd), (uint32_t)(0xd63d3f49),
+        (uint32_t)(0xcc1d9f8b), (uint32_t)(0x6a6a943f), (uint32_t)(0x5b828ea2), (uint32_t)(0xfdf58516),
+        (uint32_t)(0x3852bb98), (uint32_t)(0x9e25b02c), (uint32_t)(0xafcdaab1), (uint32_t)(0x09baa105),
+        (uint32_t)(0xfff2d1ec), (uint32_t)(0x5985da58), (uint32_t)(0x686dc0c5), (uint32_t)(0xce1acb71),
+        (uint32_t)(0x0bbdf5ff), (uint32_t)(0xadcafe4b), (uint32_t)(0x9c22e4d6), (uint32_t)(0x3a55ef62),
+        (uint32_t)(0xabc30345), (uint32_t)(0x0db408f1), (uint32_t)(0x3c5c126c), (uint32_t)(0x9a2b19d8),
+        (uint32_t)(0x5f8c2756), (uint32_t)(0xf9fb2ce2), (uint32_t)(0xc813367f), (uint32_t)(0x6e643dcb),
+        (uint32_t)(0x982c4d22), (uint32_t)(0x3e5b4696), (uint32_t)(0x0fb35c0b), (uint32_t)(0xa9c457bf),
+        (uint32_t)(0x6c636931), (uint32_t)(0xca146285), (uint32_t)(0xfbfc7818), (uint32_t)(0x5d8b73ac),
+        (uint32_t)(0x03a0a617), (uint32_t)(0xa5d7ada3), (uint32_t)(0x943fb73e), (uint32_t)(0x3248bc8a),
+        (uint32_t)(0xf7ef8204), (uint32_t)(0x519889b0), (uint32_t)(0x6070932d), (uint32_t)(0xc6079899),
+        (uint32_t)(0x304fe870), (uint32_t)(0x9638e3c4), (uint32_t)(0xa7d0f959), (uint32_t)(0x01a7f2ed),
+        (uint32_t)(0xc400cc63), (uint32_t)(0x6277c7d7), (uint32_t)(0x539fdd4a), (uint32_t)(0xf5e8d6fe),
+        (uint32_t)(0x647e3ad9), (uint32_t)(0xc209316d), (uint32_t)(0xf3e12bf0), (uint32_t)(0x55962044),
+        (uint32_t)(0x90311eca), (uint32_t)(0x3646157e), (uint32_t)(0x07ae0fe3), (uint32_t)(0xa1d90457),
+        (uint32_t)(0x579174be), (uint32_t)(0xf1e67f0a), (uint32_t)(0xc00e6597), (uint32_t)(0x66796e23),
+        (uint32_t)(0xa3de50ad), (uint32_t)(0x05a95b19), (uint32_t)(0x34414184), (uint32_t)(0x92364a30)
+    },
+    {
+        (uint32_t)(0x00000000), (uint32_t)(0xccaa009e), (uint32_t)(0x4225077d), (uint32_t)(0x8e8f07e3),
+        (uint32_t)(0x844a0efa), (uint32_t)(0x48e00e64), (uint32_t)(0xc66f0987), (uint32_t)(0x0ac50919),
+        (uint32_t)(0xd3e51bb5), (uint32_t)(0x1f4f1b2b), (uint32_t)(0x91c01cc8), (uint32_t)(0x5d6a1c56),
+        (uint32_t)(0x57af154f), (uint32_t)(0x9b0515d1), (uint32_t)(0x158a1232), (uint32_t)(0xd92012ac),
+        (uint32_t)(0x7cbb312b), (uint32_t)(0xb01131b5), (uint32_t)(0x3e9e3656), (uint32_t)(0xf23436c8),
+        (uint32_t)(0xf8f13fd1), (uint32_t)(0x345b3f4f), (uint32_t)(0xbad438ac), (uint32_t)(0x767e3832),
+        (uint32_t)(0xaf5e2a9e), (uint32_t)(0x63f42a00), (uint32_t)(0xed7b2de3), (uint32_t)(0x21d12d7d),
+        (uint32_t)(0x2b142464), (uint32_t)(0xe7be24fa), (uint32_t)(0x69312319), (uint32_t)(0xa59b2387),
+        (uint32_t)(0xf9766256), (uint32_t)(0x35dc62c8), (uint32_t)(0xbb53652b), (uint32_t)(0x77f965b5),
+        (uint32_t)(0x7d3c6cac), (uint32_t)(0xb1966c32), (uint32_t)(0x3f196bd1), (uint32_t)(0xf3b36b4f),
+        (uint32_t)(0x2a9379e3), (uint32_t)(0xe639797d), (uint32_t)(0x68b67e9e), (uint32_t)(0xa41c7e00),
+        (uint32_t)(0xaed97719), (uint32_t)(0x62737787), (uint32_t)(0xecfc7064), (uint32_t)(0x205670fa),
+        (uint32_t)(0x85cd537d), (uint32_t)(0x496753e3), (uint32_t)(0xc7e85400), (uint32_t)(0x0b42549e),
+        (uint32_t)(0x01875d87), (uint32_t)(0xcd2d5d19), (uint32_t)(0x43a25afa), (uint32_t)(0x8f085a64),
+        (uint32_t)(0x562848c8), (uint32_t)(0x9a824856), (uint32_t)(0x140d4fb5), (uint32_t)(0xd8a74f2b),
+        (uint32_t)(0xd2624632), (uint32_t)(0x1ec846ac), (uint32_t)(0x9047414f), (uint32_t)(0x5ced41d1),
+        (uint32_t)(0x299dc2ed), (uint32_t)(0xe537c273), (uint32_t)(0x6bb8c590), (uint32_t)(0xa712c50e),
+        (uint32_t)(0xadd7cc17), (uint32_t)(0x617dcc89), (uint32_t)(0xeff2cb6a), (uint32_t)(0x2358cbf4),
+        (uint32_t)(0xfa78d958), (uint32_t)(0x36d2d9c6), (uint32_t)(0xb85dde25), (uint32_t)(0x74f7debb),
+        (uint32_t)(0x7e32d7a2), (uint32_t)(0xb298d73c), (uint32_t)(0x3c17d0df), (uint32_t)(0xf0bdd041),
+        (uint32_t)(0x5526f3c6), (uint32_t)(0x998cf358), (uint32_t)(0x1703f4bb), (uint32_t)(0xdba9f425),
+        (uint32_t)(0xd16cfd3c), (uint32_t)(0x1dc6fda2), (uint32_t)(0x9349fa41), (uint32_t)(0x5fe3fadf),
+        (uint32_t)(0x86c3e873), (uint32_t)(0x4a69e8ed), (uint32_t)(0xc4e6ef0e), (uint32_t)(0x084cef90),
+        (uint32_t)(0x0289e689), (uint32_t)(0xce23e617), (uint32_t)(0x40ace1f4), (uint32_t)(0x8c06e16a),
+        (uint32_t)(0xd0eba0bb), (uint32_t)(0x1c41a025), (uint32_t)(0x92cea7c6), (uint32_t)(0x5e64a758),
+        (uint32_t)(0x54a1ae41), (uint32_t)(0x980baedf), (uint32_t)(0x1684a93c), (uint32_t)(0xda2ea9a2),
+        (uint32_t)(0x030ebb0e), (uint32_t)(0xcfa4bb90), (uint32_t)(0x412bbc73), (uint32_t)(0x8d81bced),
+        (uint32_t)(0x8744b5f4), (uint32_t)(0x4beeb56a), (uint32_t)(0xc561b289), (uint32_t)(0x09cbb217),
+        (uint32_t)(0xac509190), (uint32_t)(0x60fa910e), (uint32_t)(0xee7596ed), (uint32_t)(0x22df9673),
+        (uint32_t)(0x281a9f6a), (uint32_t)(0xe4b09ff4), (uint32_t)(0x6a3f9817), (uint32_t)(0xa6959889),
+        (uint32_t)(0x7fb58a25), (uint32_t)(0xb31f8abb), (uint32_t)(0x3d908d58), (uint32_t)(0xf13a8dc6),
+        (uint32_t)(0xfbff84df), (uint32_t)(0x37558441), (uint32_t)(0xb9da83a2), (uint32_t)(0x7570833c),
+        (uint32_t)(0x533b85da), (uint32_t)(0x9f918544), (uint32_t)(0x111e82a7), (uint32_t)(0xddb48239),
+        (uint32_t)(0xd7718b20), (uint32_t)(0x1bdb8bbe), (uint32_t)(0x95548c5d), (uint32_t)(0x59fe8cc3),
+        (uint32_t)(0x80de9e6f), (uint32_t)(0x4c749ef1), (uint32_t)(0xc2fb9912), (uint32_t)(0x0e51998c),
+        (uint32_t)(0x04949095), (uint32_t)(0xc83e900b), (uint32_t)(0x46b197e8), (uint32_t)(0x8a1b9776),
+        (uint32_t)(0x2f80b4f1), (uint32_t)(0xe32ab46f), (uint32_t)(0x6da5b38c), (uint32_t)(0xa10fb312),
+        (uint32_t)(0xabcaba0b), (uint32_t)(0x6760ba95), (uint32_t)(0xe9efbd76), (uint32_t)(0x2545bde8),
+        (uint32_t)(0xfc65af44), (uint32_t)(0x30cfafda), (uint32_t)(0xbe40a839), (uint32_t)(0x72eaa8a7),
+        (uint32_t)(0x782fa1be), (uint32_t)(0xb485a120), (uint32_t)(0x3a0aa6c3), (uint32_t)(0xf6a0a65d),
+        (uint32_t)(0xaa4de78c), (uint32_t)(0x66e7e712), (uint32_t)(0xe868e0f1), (uint32_t)(0x24c2e06f),
+        (uint32_t)(0x2e07e976), (uint32_t)(0xe2ade9e8), (uint32_t)(0x6c22ee0b), (uint32_t)(0xa088ee95),
+        (uint32_t)(0x79a8fc39), (uint32_t)(0xb502fca7), (uint32_t)(0x3b8dfb44), (uint32_t)(0xf727fbda),
+        (uint32_t)(0xfde2f2c3), (uint32_t)(0x3148f25d), (uint32_t)(0xbfc7f5be), (uint32_t)(0x736df520),
+        (uint32_t)(0xd6f6d6a7), (uint32_t)(0x1a5cd639), (uint32_t)(0x94d3d1da), (uint32_t)(0x5879d144),
+        (uint32_t)(0x52bcd85d), (uint32_t)(0x9e16d8c3), (uint32_t)(0x1099df20), (uint32_t)(0xdc33dfbe),
+        (uint32_t)(0x0513cd12), (uint32_t)(0xc9b9cd8c), (uint32_t)(0x4736ca6f), (uint32_t)(0x8b9ccaf1),
+        (uint32_t)(0x8159c3e8), (uint32_t)(0x4df3c376), (uint32_t)(0xc37cc495), (uint32_t)(0x0fd6c40b),
+        (uint32_t)(0x7aa64737), (uint32_t)(0xb60c47a9), (uint32_t)(0x3883404a), (uint32_t)(0xf42940d4),
+        (uint32_t)(0xfeec49cd), (uint32_t)(0x32464953), (uint32_t)(0xbcc94eb0), (uint32_t)(0x70634e2e),
+        (uint32_t)(0xa9435c82), (uint32_t)(0x65e95c1c), (uint32_t)(0xeb665bff), (uint32_t)(0x27cc5b61),
+        (uint32_t)(0x2d095278), (uint32_t)(0xe1a352e6), (uint32_t)(0x6f2c5505), (uint32_t)(0xa386559b),
+        (uint32_t)(0x061d761c), (uint32_t)(0xcab77682), (uint32_t)(0x44387161), (uint32_t)(0x889271ff),
+        (uint32_t)(0x825778e6), (uint32_t)(0x4efd7878), (uint32_t)(0xc0727f9b), (uint32_t)(0x0cd87f05),
+        (uint32_t)(0xd5f86da9), (uint32_t)(0x19526d37), (uint32_t)(0x97dd6ad4), (uint32_t)(0x5b776a4a),
+        (uint32_t)(0x51b26353), (uint32_t)(0x9d1863cd), (uint32_t)(0x1397642e), (uint32_t)(0xdf3d64b0),
+        (uint32_t)(0x83d02561), (uint32_t)(0x4f7a25ff), (uint32_t)(0xc1f5221c), (uint32_t)(0x0d5f2282),
+        (uint32_t)(0x079a2b9b), (uint32_t)(0xcb302b05), (uint32_t)(0x45bf2ce6), (uint32_t)(0x89152c78),
+        (uint32_t)(0x50353ed4), (uint32_t)(0x9c9f3e4a), (uint32_t)(0x121039a9), (uint32_t)(0xdeba3937),
+        (uint32_t)(0xd47f302e), (uint32_t)(0x18d530b0), (uint32_t)(0x965a3753), (uint32_t)(0x5af037cd),
+        (uint32_t)(0xff6b144a), (uint32_t)(0x33c114d4), (uint32_t)(0xbd4e1337), (uint32_t)(0x71e413a9),
+        (uint32_t)(0x7b211ab0), (uint32_t)(0xb78b1a2e), (uint32_t)(0x39041dcd), (uint32_t)(0xf5ae1d53),
+        (uint32_t)(0x2c8e0fff), (uint32_t)(0xe0240f61), (uint32_t)(0x6eab0882), (uint32_t)(0xa201081c),
+        (uint32_t)(0xa8c40105), (uint32_t)(0x646e019b), (uint32_t)(0xeae10678), (uint32_t)(0x264b06e6)
+    }
 };
 
+#endif
+
 /* clang-format on */
 
+/* STATIC FUNCTIONS **********************************************************/
+
+#ifdef CARDANO_HAS_CRC32_INSTRUCTIONS
+
+/**
+ * \brief Updates a CRC32 with the ARMv8 CRC32 instructions, which use the same polynomial as Byron addresses.
+ *
+ * x86 is not given a hardware path: its SSE4.2 CRC32 instruction computes CRC32-C, a different polynomial.
+ *
+ * \param crc The running CRC, inverted.
+ * \param data The data to fold in.
+ * \param size The size of the data.
+ *
+ * \return The updated CRC, inverted.
+ */
+static uint32_t
+update_crc32(uint32_t crc, const byte_t* data, size_t size)
+{
+  for (; size >= 8U; size -= 8U)
+  {
+    uint64_t word = 0U;
+
+    cardano_safe_memcpy(&word, sizeof(word), data, sizeof(word));
+    crc   = __crc32d(crc, word);
+    data += 8U;
+  }
+
+  for (; size > 0U; --size)
+  {
+    crc = __crc32b(crc, *data);
+    ++data;
+  }
+
+  return crc;
+}
+
+#else
+
+/**
+ * \brief Updates a CRC32 eight bytes at a time with the slice-by-8 tables.
+ *
+ * \param crc The running CRC, inverted.
+ * \param data The data to fold in.
+ * \param size The size of the data.
+ *
+ * \return The updated CRC, inverted.
+ */
+static uint32_t
+update_crc32(uint32_t crc, const byte_t* data, size_t size)
+{
+  for (; size >= 8U; size -= 8U)
+  {
+    const uint32_t low  = crc ^ ((uint32_t)data[0] | ((uint32_t)data[1] << 8U) | ((uint32_t)data[2] << 16U) | ((uint32_t)data[3] << 24U));
+    const uint32_t high = (uint32_t)data[4] | ((uint32_t)data[5] << 8U) | ((uint32_t)data[6] << 16U) | ((uint32_t)data[7] << 24U);
+
+    crc = s_crc32_tables[7][low & 0xFFU] ^ s_crc32_tables[6][(low >> 8U) & 0xFFU] ^
+      s_crc32_tables[5][(low >> 16U) & 0xFFU] ^ s_crc32_tables[4][low >> 24U] ^
+      s_crc32_tables[3][high & 0xFFU] ^ s_crc32_tables[2][(high >> 8U) & 0xFFU] ^
+      s_crc32_tables[1][(high >> 16U) & 0xFFU] ^ s_crc32_tables[0][high >> 24U];
+
+    data += 8U;
+  }
+
+  for (; size > 0U; --size)
+  {
+    crc = s_crc32_tables[0][((byte_t)(crc) ^ *data) & 0xFFU] ^ (crc >> 8);
+    ++data;
+  }
+
+  return crc;
+}
+
+#endif
+
 /* DEFINITIONS ****************************************************************/
 
 uint32_t
@@ -123,12 +673,7 @@ cardano_checksum_crc32(const byte_t* data, const size_t size)
     return 0;
   }
 
-  uint32_t crc = 0xFFFFFFFFU;
+  const uint32_t crc = update_crc32(0xFFFFFFFFU, data, size);
 
-  for (size_t i = 0; i < size; ++i)
-  {
-    byte_t k = (data)[i];
-    crc      = s_crc32_table[((byte_t)(crc) ^ k) & 0xFFU] ^ (crc >> 8);
-  }
   return (crc ^ 0xFFFFFFFF);
 }
\ No newline at end of file
@@ -29,6 +29,7 @@
 
 #include "../allocators.h"
 #include "../string_safe.h"
+#include "./internals/inline_bytes.h"
 
 #include <assert.h>
 #include <sodium.h>
@@ -72,7 +73,7 @@ typedef enum
 typedef struct cardano_ed25519_private_key_t
 {
     cardano_object_t                   base;
-    cardano_buffer_t*                  key_material;
+    byte_t                             key_material[CARDANO_ED25519_PRIVATE_KEY_SIZE_EXTENDED];
     cardano_ed25519_private_key_size_t key_size;
 } cardano_ed25519_private_key_t;
 
@@ -98,11 +99,7 @@ cardano_ed25519_private_key_deallocate(void* object)
 
   cardano_ed25519_private_key_t* private_key = (cardano_ed25519_private_key_t*)object;
 
-  if (private_key->key_material != NULL)
-  {
-    sodium_memzero(cardano_buffer_get_data(private_key->key_material), cardano_buffer_get_size(private_key->key_material));
-    cardano_buffer_unref(&private_key->key_material);
-  }
+  sodium_memzero(private_key->key_material, sizeof(private_key->key_material));
 
   _cardano_free(private_key);
 }
@@ -161,17 +158,10 @@ private_key_from_bytes(
 
   ed25519_private_key->base.ref_count     = 1;
   ed25519_private_key->base.deallocator   = cardano_ed25519_private_key_deallocate;
-  ed25519_private_key->base.last_error[0] = '\0';
-  ed25519_private_key->key_material       = cardano_buffer_new_from(data, data_length);
+  ed25519_private_key->base.last_error    = NULL;
   ed25519_private_key->key_size           = key_size;
 
-  if (ed25519_private_key->key_material == NULL)
-  {
-    *private_key = NULL;
-    _cardano_free(ed25519_private_key);
-
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
+  cardano_safe_memcpy(ed25519_private_key->key_material, sizeof(ed25519_private_key->key_material), data, data_length);
 
   *private_key = ed25519_private_key;
 
@@ -232,14 +222,16 @@ private_key_from_hex(
 
   ed25519_private_key->base.ref_count     = 1;
   ed25519_private_key->base.deallocator   = cardano_ed25519_private_key_deallocate;
-  ed25519_private_key->base.last_error[0] = '\0';
-  ed25519_private_key->key_material       = cardano_buffer_from_hex(hex, hex_length);
+  ed25519_private_key->base.last_error    = NULL;
   ed25519_private_key->key_size           = key_size;
 
-  if (ed25519_private_key->key_material == NULL)
+  const char* end = NULL;
+
+  // Key material goes through the constant-time libsodium codec rather than the vectorized one
+  if ((sodium_init() == -1) || (sodium_hex2bin(ed25519_private_key->key_material, (size_t)key_size, hex, hex_length, NULL, NULL, &end) != 0))
   {
     *private_key = NULL;
-    _cardano_free(ed25519_private_key);
+    cardano_ed25519_private_key_deallocate(ed25519_private_key);
 
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
@@ -271,7 +263,7 @@ compute_normal_public_key(
   byte_t public_key_bytes[32U] = { 0 };
   byte_t secret_key_bytes[64U] = { 0 };
 
-  if (crypto_sign_seed_keypair(public_key_bytes, secret_key_bytes, cardano_buffer_get_data(private_key->key_material)) == -1)
+  if (crypto_sign_seed_keypair(public_key_bytes, secret_key_bytes, private_key->key_material) == -1)
   {
     return CARDANO_ERROR_GENERIC;
   }
@@ -311,11 +303,11 @@ compute_extended_public_key(
   assert(private_key != NULL);
   assert(public_key != NULL);
 
-  byte_t* extended_scalar  = cardano_buffer_get_data(private_key->key_material);
+  const byte_t* extended_scalar  = private_key->key_material;
   byte_t  scalar_data[32U] = { 0 };
 
   assert(extended_scalar != NULL);
-  assert(cardano_buffer_get_size(private_key->key_material) >= SCALAR_SIZE);
+  assert((size_t)private_key->key_size >= SCALAR_SIZE);
 
   if (crypto_scalarmult_ed25519_base_noclamp(&scalar_data[0], extended_scalar) == -1)
   {
@@ -407,10 +399,10 @@ compute_signature_with_extended_key(
   assert(message != NULL);
   assert(signature != NULL);
 
-  byte_t* extended_scalar = cardano_buffer_get_data(private_key->key_material);
+  const byte_t* extended_scalar = private_key->key_material;
 
   assert(extended_scalar != NULL);
-  assert(cardano_buffer_get_size(private_key->key_material) == (SCALAR_SIZE * 2U));
+  assert((size_t)private_key->key_size == (SCALAR_SIZE * 2U));
 
   byte_t public_key[32U];
   byte_t hash_output[64U]     = { 0 };
@@ -527,7 +519,7 @@ compute_signature_with_normal_key(
     return compute_pub_key_error;
   }
 
-  const byte_t* private_key_bytes = cardano_buffer_get_data(private_key->key_material);
+  const byte_t* private_key_bytes = private_key->key_material;
 
   assert(private_key_bytes != NULL);
 
@@ -734,7 +726,7 @@ cardano_ed25519_private_key_get_data(const cardano_ed25519_private_key_t* ed2551
     return NULL;
   }
 
-  return cardano_buffer_get_data(ed25519_private_key->key_material);
+  return ed25519_private_key->key_material;
 }
 
 size_t
@@ -745,7 +737,7 @@ cardano_ed25519_private_key_get_bytes_size(const cardano_ed25519_private_key_t*
     return 0;
   }
 
-  return cardano_buffer_get_size(ed25519_private_key->key_material);
+  return (size_t)ed25519_private_key->key_size;
 }
 
 cardano_error_t
@@ -759,7 +751,7 @@ cardano_ed25519_private_key_to_bytes(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return cardano_buffer_copy_bytes(private_key->key_material, out_key_bytes, out_key_length);
+  return _cardano_inline_bytes_copy(private_key->key_material, (size_t)private_key->key_size, out_key_bytes, out_key_length);
 }
 
 size_t
@@ -770,7 +762,7 @@ cardano_ed25519_private_key_get_hex_size(const cardano_ed25519_private_key_t* pr
     return 0;
   }
 
-  return cardano_buffer_get_hex_size(private_key->key_material);
+  return _cardano_inline_bytes_get_hex_size((size_t)private_key->key_size);
 }
 
 cardano_error_t
@@ -784,5 +776,21 @@ cardano_ed25519_private_key_to_hex(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return cardano_buffer_to_hex(private_key->key_material, hex, hex_length);
+  if (hex == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (hex_length < _cardano_inline_bytes_get_hex_size((size_t)private_key->key_size))
+  {
+    return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
+  }
+
+  // Key material goes through the constant-time libsodium codec rather than the vectorized one
+  if ((sodium_init() == -1) || (sodium_bin2hex(hex, hex_length, private_key->key_material, (size_t)private_key->key_size) == NULL))
+  {
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  return CARDANO_SUCCESS;
 }
@@ -23,11 +23,13 @@
 
 #include <cardano/crypto/ed25519_public_key.h>
 
-#include <cardano/buffer.h>
 #include <cardano/export.h>
 #include <cardano/object.h>
 
 #include "../allocators.h"
+#include "../memory_footprint.h"
+#include "../string_safe.h"
+#include "./internals/inline_bytes.h"
 
 #include <assert.h>
 #include <cardano/crypto/blake2b_hash_size.h>
@@ -44,8 +46,8 @@
  */
 typedef struct cardano_ed25519_public_key_t
 {
-    cardano_object_t  base;
-    cardano_buffer_t* key_material;
+    cardano_object_t base;
+    byte_t           key_material[crypto_sign_PUBLICKEYBYTES];
 } cardano_ed25519_public_key_t;
 
 /* STATIC FUNCTIONS **********************************************************/
@@ -68,14 +70,7 @@ cardano_ed25519_public_key_deallocate(void* object)
 {
   assert(object != NULL);
 
-  cardano_ed25519_public_key_t* public_key = (cardano_ed25519_public_key_t*)object;
-
-  if (public_key->key_material != NULL)
-  {
-    cardano_buffer_unref(&public_key->key_material);
-  }
-
-  _cardano_free(public_key);
+  _cardano_free(object);
 }
 
 /* DEFINITIONS ****************************************************************/
@@ -113,16 +108,9 @@ cardano_ed25519_public_key_from_bytes(
 
   ed25519_public_key->base.ref_count     = 1;
   ed25519_public_key->base.deallocator   = cardano_ed25519_public_key_deallocate;
-  ed25519_public_key->base.last_error[0] = '\0';
-  ed25519_public_key->key_material       = cardano_buffer_new_from(data, data_length);
+  ed25519_public_key->base.last_error    = NULL;
 
-  if (ed25519_public_key->key_material == NULL)
-  {
-    *public_key = NULL;
-    _cardano_free(ed25519_public_key);
-
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
+  cardano_safe_memcpy(ed25519_public_key->key_material, sizeof(ed25519_public_key->key_material), data, data_length);
 
   *public_key = ed25519_public_key;
 
@@ -162,10 +150,9 @@ cardano_ed25519_public_key_from_hex(
 
   ed25519_public_key->base.ref_count     = 1;
   ed25519_public_key->base.deallocator   = cardano_ed25519_public_key_deallocate;
-  ed25519_public_key->base.last_error[0] = '\0';
-  ed25519_public_key->key_material       = cardano_buffer_from_hex(hex, hex_length);
+  ed25519_public_key->base.last_error    = NULL;
 
-  if (ed25519_public_key->key_material == NULL)
+  if (!_cardano_inline_bytes_from_hex(hex, hex_length, ed25519_public_key->key_material, sizeof(ed25519_public_key->key_material)))
   {
     *public_key = NULL;
     _cardano_free(ed25519_public_key);
@@ -241,11 +228,82 @@ cardano_ed25519_public_verify(
     cardano_ed25519_signature_get_data(signature),
     message,
     message_len,
-    cardano_buffer_get_data(public_key->key_material));
+    public_key->key_material);
 
   return verify_result == 0;
 }
 
+cardano_error_t
+cardano_ed25519_batch_verify(
+  const cardano_ed25519_public_key_t* const* public_keys,
+  const cardano_ed25519_signature_t* const*  signatures,
+  const byte_t* const*                       messages,
+  const size_t*                              message_lengths,
+  const size_t                               count,
+  bool*                                      results)
+{
+  if ((public_keys == NULL) || (signatures == NULL) || (messages == NULL) || (message_lengths == NULL) || (results == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (count == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    if ((public_keys[i] == NULL) || (signatures[i] == NULL) || ((messages[i] == NULL) && (message_lengths[i] > 0U)))
+    {
+      return CARDANO_ERROR_POINTER_IS_NULL;
+    }
+  }
+
+  if (sodium_init() == -1)
+  {
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  const byte_t**      sigs  = (const byte_t**)_cardano_malloc(count * sizeof(byte_t*));
+  const byte_t**      pks   = (const byte_t**)_cardano_malloc(count * sizeof(byte_t*));
+  unsigned long long* lens  = (unsigned long long*)_cardano_malloc(count * sizeof(unsigned long long));
+  int*                valid = (int*)_cardano_malloc(count * sizeof(int));
+
+  if ((sigs == NULL) || (pks == NULL) || (lens == NULL) || (valid == NULL))
+  {
+    _cardano_free((void*)sigs);
+    _cardano_free((void*)pks);
+    _cardano_free(lens);
+    _cardano_free(valid);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    assert(cardano_ed25519_signature_get_bytes_size(signatures[i]) == crypto_sign_BYTES);
+
+    sigs[i] = cardano_ed25519_signature_get_data(signatures[i]);
+    pks[i]  = public_keys[i]->key_material;
+    lens[i] = message_lengths[i];
+  }
+
+  (void)crypto_sign_ed25519_verify_batch(valid, sigs, messages, lens, pks, count);
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    results[i] = (valid[i] == 0);
+  }
+
+  _cardano_free((void*)sigs);
+  _cardano_free((void*)pks);
+  _cardano_free(lens);
+  _cardano_free(valid);
+
+  return CARDANO_SUCCESS;
+}
+
 const byte_t*
 cardano_ed25519_public_key_get_data(const cardano_ed25519_public_key_t* ed25519_public_key)
 {
@@ -254,7 +312,7 @@ cardano_ed25519_public_key_get_data(const cardano_ed25519_public_key_t* ed25519_
     return NULL;
   }
 
-  return cardano_buffer_get_data(ed25519_public_key->key_material);
+  return ed25519_public_key->key_material;
 }
 
 size_t
@@ -265,7 +323,7 @@ cardano_ed25519_public_key_get_bytes_size(const cardano_ed25519_public_key_t* ed
     return 0;
   }
 
-  return cardano_buffer_get_size(ed25519_public_key->key_material);
+  return sizeof(ed25519_public_key->key_material);
 }
 
 cardano_error_t
@@ -279,7 +337,7 @@ cardano_ed25519_public_key_to_bytes(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return cardano_buffer_copy_bytes(public_key->key_material, out_key_bytes, out_key_length);
+  return _cardano_inline_bytes_copy(public_key->key_material, sizeof(public_key->key_material), out_key_bytes, out_key_length);
 }
 
 size_t
@@ -290,7 +348,7 @@ cardano_ed25519_public_key_get_hex_size(const cardano_ed25519_public_key_t* ed25
     return 0;
   }
 
-  return cardano_buffer_get_hex_size(ed25519_public_key->key_material);
+  return _cardano_inline_bytes_get_hex_size(sizeof(ed25519_public_key->key_material));
 }
 
 cardano_error_t
@@ -304,7 +362,7 @@ cardano_ed25519_public_key_to_hex(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return cardano_buffer_to_hex(ed25519_public_key->key_material, hex, hex_length);
+  return _cardano_inline_bytes_to_hex(ed25519_public_key->key_material, sizeof(ed25519_public_key->key_material), hex, hex_length);
 }
 
 cardano_error_t
@@ -323,7 +381,16 @@ cardano_ed25519_public_key_to_hash(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  const byte_t* data = cardano_buffer_get_data(public_key->key_material);
+  return cardano_blake2b_compute_hash(public_key->key_material, sizeof(public_key->key_material), CARDANO_BLAKE2B_HASH_SIZE_224, hash);
+}
 
-  return cardano_blake2b_compute_hash(data, cardano_buffer_get_size(public_key->key_material), CARDANO_BLAKE2B_HASH_SIZE_224, hash);
-}
\ No newline at end of file
+void
+_cardano_ed25519_public_key_add_footprint(const cardano_ed25519_public_key_t* key, cardano_footprint_context_t* context)
+{
+  if (key == NULL)
+  {
+    return;
+  }
+
+  CARDANO_UNUSED(_cardano_footprint_visit(context, &key->base, CARDANO_MEMORY_FOOTPRINT_TYPE_WITNESS, sizeof(cardano_ed25519_public_key_t)));
+}
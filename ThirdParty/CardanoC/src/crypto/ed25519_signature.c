@@ -23,11 +23,13 @@
 
 #include <cardano/crypto/ed25519_signature.h>
 
-#include <cardano/buffer.h>
 #include <cardano/export.h>
 #include <cardano/object.h>
 
 #include "../allocators.h"
+#include "../memory_footprint.h"
+#include "../string_safe.h"
+#include "./internals/inline_bytes.h"
 
 #include <assert.h>
 #include <sodium.h>
@@ -43,8 +45,8 @@
  */
 typedef struct cardano_ed25519_signature_t
 {
-    cardano_object_t  base;
-    cardano_buffer_t* buffer;
+    cardano_object_t base;
+    byte_t           bytes[crypto_sign_BYTES];
 } cardano_ed25519_signature_t;
 
 /* STATIC FUNCTIONS **********************************************************/
@@ -67,14 +69,7 @@ cardano_ed25519_signature_deallocate(void* object)
 {
   assert(object != NULL);
 
-  cardano_ed25519_signature_t* signature = (cardano_ed25519_signature_t*)object;
-
-  if (signature->buffer != NULL)
-  {
-    cardano_buffer_unref(&signature->buffer);
-  }
-
-  _cardano_free(signature);
+  _cardano_free(object);
 }
 
 /* DEFINITIONS ****************************************************************/
@@ -111,14 +106,9 @@ cardano_ed25519_signature_from_bytes(
 
   ed25519_signature->base.ref_count     = 1;
   ed25519_signature->base.deallocator   = cardano_ed25519_signature_deallocate;
-  ed25519_signature->base.last_error[0] = '\0';
-  ed25519_signature->buffer             = cardano_buffer_new_from(data, data_length);
+  ed25519_signature->base.last_error    = NULL;
 
-  if (ed25519_signature->buffer == NULL)
-  {
-    _cardano_free(ed25519_signature);
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
+  cardano_safe_memcpy(ed25519_signature->bytes, sizeof(ed25519_signature->bytes), data, data_length);
 
   *signature = ed25519_signature;
 
@@ -160,10 +150,9 @@ cardano_ed25519_signature_from_hex(
 
   ed25519_signature->base.ref_count     = 1;
   ed25519_signature->base.deallocator   = cardano_ed25519_signature_deallocate;
-  ed25519_signature->base.last_error[0] = '\0';
-  ed25519_signature->buffer             = cardano_buffer_from_hex(hex, hex_length);
+  ed25519_signature->base.last_error    = NULL;
 
-  if (ed25519_signature->buffer == NULL)
+  if (!_cardano_inline_bytes_from_hex(hex, hex_length, ed25519_signature->bytes, sizeof(ed25519_signature->bytes)))
   {
     *signature = NULL;
     _cardano_free(ed25519_signature);
@@ -224,7 +213,7 @@ cardano_ed25519_signature_get_data(const cardano_ed25519_signature_t* ed25519_si
     return NULL;
   }
 
-  return cardano_buffer_get_data(ed25519_signature->buffer);
+  return ed25519_signature->bytes;
 }
 
 size_t
@@ -235,7 +224,7 @@ cardano_ed25519_signature_get_bytes_size(const cardano_ed25519_signature_t* ed25
     return 0;
   }
 
-  return cardano_buffer_get_size(ed25519_signature->buffer);
+  return sizeof(ed25519_signature->bytes);
 }
 
 cardano_error_t
@@ -249,7 +238,7 @@ cardano_ed25519_signature_to_bytes(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return cardano_buffer_copy_bytes(ed25519_signature->buffer, signature, signature_length);
+  return _cardano_inline_bytes_copy(ed25519_signature->bytes, sizeof(ed25519_signature->bytes), signature, signature_length);
 }
 
 size_t
@@ -260,7 +249,7 @@ cardano_ed25519_signature_get_hex_size(const cardano_ed25519_signature_t* ed2551
     return 0;
   }
 
-  return cardano_buffer_get_hex_size(ed25519_signature->buffer);
+  return _cardano_inline_bytes_get_hex_size(sizeof(ed25519_signature->bytes));
 }
 
 cardano_error_t
@@ -274,5 +263,16 @@ cardano_ed25519_signature_to_hex(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  return cardano_buffer_to_hex(ed25519_signature->buffer, hex, hex_length);
-}
\ No newline at end of file
+  return _cardano_inline_bytes_to_hex(ed25519_signature->bytes, sizeof(ed25519_signature->bytes), hex, hex_length);
+}
+
+void
+_cardano_ed25519_signature_add_footprint(const cardano_ed25519_signature_t* signature, cardano_footprint_context_t* context)
+{
+  if (signature == NULL)
+  {
+    return;
+  }
+
+  CARDANO_UNUSED(_cardano_footprint_visit(context, &signature->base, CARDANO_MEMORY_FOOTPRINT_TYPE_WITNESS, sizeof(cardano_ed25519_signature_t)));
+}
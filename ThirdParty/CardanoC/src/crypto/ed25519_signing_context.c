@@ -0,0 +1,312 @@
+/**
+ * \file ed25519_signing_context.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/crypto/ed25519_signing_context.h>
+
+#include <cardano/export.h>
+#include <cardano/object.h>
+
+#include "../allocators.h"
+#include "../string_safe.h"
+
+#include <assert.h>
+#include <sodium.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const size_t SCALAR_SIZE = 32U;
+static const size_t PREFIX_SIZE = 32U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A precomputed Ed25519 signing key.
+ *
+ * `secret` points to `sodium_malloc` memory holding the 32-byte signing scalar followed by the 32-byte nonce
+ * prefix. It is made read-only once filled in, where the platform supports it.
+ */
+typedef struct cardano_ed25519_signing_context_t
+{
+    cardano_object_t base;
+    byte_t*          secret;
+    byte_t           public_key[32];
+} cardano_ed25519_signing_context_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates a signing context, wiping its key material.
+ *
+ * \param object A void pointer to the signing context to be deallocated.
+ */
+static void
+cardano_ed25519_signing_context_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_ed25519_signing_context_t* context = (cardano_ed25519_signing_context_t*)object;
+
+  if (context->secret != NULL)
+  {
+    // sodium_free restores access to the region and zeroes it before releasing it.
+    sodium_free(context->secret);
+    context->secret = NULL;
+  }
+
+  _cardano_free(context);
+}
+
+/**
+ * \brief Expands a private key into the signing scalar and nonce prefix.
+ *
+ * Normal keys are expanded as RFC 8032 prescribes: SHA-512 of the seed, with the first half clamped. Extended keys
+ * already hold the (BIP32-Ed25519 tweaked) scalar and the prefix, and are copied verbatim.
+ *
+ * \param private_key The private key.
+ * \param secret A buffer of 64 bytes that receives the scalar followed by the prefix.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+expand_private_key(const cardano_ed25519_private_key_t* private_key, byte_t* secret)
+{
+  const byte_t* key_bytes = cardano_ed25519_private_key_get_data(private_key);
+  const size_t  key_size  = cardano_ed25519_private_key_get_bytes_size(private_key);
+
+  if (key_bytes == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (key_size == (SCALAR_SIZE + PREFIX_SIZE))
+  {
+    cardano_safe_memcpy(secret, SCALAR_SIZE + PREFIX_SIZE, key_bytes, key_size);
+
+    return CARDANO_SUCCESS;
+  }
+
+  if (key_size != SCALAR_SIZE)
+  {
+    return CARDANO_ERROR_INVALID_ED25519_PRIVATE_KEY_SIZE;
+  }
+
+  if (crypto_hash_sha512(secret, key_bytes, key_size) != 0)
+  {
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  secret[0] &= 248U;
+  secret[31] &= 127U;
+  secret[31] |= 64U;
+
+  return CARDANO_SUCCESS;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_ed25519_signing_context_new(
+  const cardano_ed25519_private_key_t* private_key,
+  cardano_ed25519_signing_context_t**  context)
+{
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *context = NULL;
+
+  if (private_key == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (sodium_init() == -1)
+  {
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  cardano_ed25519_signing_context_t* signing_context = (cardano_ed25519_signing_context_t*)_cardano_malloc(sizeof(cardano_ed25519_signing_context_t));
+
+  if (signing_context == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  signing_context->base.ref_count     = 1;
+  signing_context->base.deallocator   = cardano_ed25519_signing_context_deallocate;
+  signing_context->base.last_error    = NULL;
+  signing_context->secret             = (byte_t*)sodium_malloc(SCALAR_SIZE + PREFIX_SIZE);
+
+  CARDANO_UNUSED(memset(signing_context->public_key, 0, sizeof(signing_context->public_key)));
+
+  if (signing_context->secret == NULL)
+  {
+    _cardano_free(signing_context);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = expand_private_key(private_key, signing_context->secret);
+
+  if ((result == CARDANO_SUCCESS) && (crypto_scalarmult_ed25519_base_noclamp(signing_context->public_key, signing_context->secret) != 0))
+  {
+    result = CARDANO_ERROR_GENERIC;
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_ed25519_signing_context_deallocate(signing_context);
+
+    return result;
+  }
+
+  // Best effort: builds of libsodium without mprotect support report failure here, leaving the region writable.
+  CARDANO_UNUSED(sodium_mprotect_readonly(signing_context->secret));
+
+  *context = signing_context;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_ed25519_signing_context_sign(
+  const cardano_ed25519_signing_context_t* context,
+  const byte_t*                            message,
+  const size_t                             message_length,
+  cardano_ed25519_signature_t**            signature)
+{
+  if (signature == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *signature = NULL;
+
+  if ((context == NULL) || ((message == NULL) && (message_length > 0U)))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const byte_t* scalar = context->secret;
+  const byte_t* prefix = &context->secret[SCALAR_SIZE];
+
+  crypto_hash_sha512_state hash_state;
+
+  byte_t hash_output[64U]     = { 0 };
+  byte_t nonce[32U]           = { 0 };
+  byte_t hram_reduced[32U]    = { 0 };
+  byte_t signature_bytes[64U] = { 0 };
+
+  byte_t* r = &signature_bytes[0];
+  byte_t* s = &signature_bytes[32];
+
+  // r = H(prefix || M) mod L
+  CARDANO_UNUSED(crypto_hash_sha512_init(&hash_state));
+  CARDANO_UNUSED(crypto_hash_sha512_update(&hash_state, prefix, PREFIX_SIZE));
+  CARDANO_UNUSED(crypto_hash_sha512_update(&hash_state, message, message_length));
+  CARDANO_UNUSED(crypto_hash_sha512_final(&hash_state, hash_output));
+
+  crypto_core_ed25519_scalar_reduce(nonce, hash_output);
+
+  if (crypto_scalarmult_ed25519_base_noclamp(r, nonce) != 0)
+  {
+    sodium_memzero(nonce, sizeof(nonce));
+    sodium_memzero(hash_output, sizeof(hash_output));
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  // k = H(R || A || M) mod L
+  CARDANO_UNUSED(crypto_hash_sha512_init(&hash_state));
+  CARDANO_UNUSED(crypto_hash_sha512_update(&hash_state, r, 32U));
+  CARDANO_UNUSED(crypto_hash_sha512_update(&hash_state, context->public_key, sizeof(context->public_key)));
+  CARDANO_UNUSED(crypto_hash_sha512_update(&hash_state, message, message_length));
+  CARDANO_UNUSED(crypto_hash_sha512_final(&hash_state, hash_output));
+
+  crypto_core_ed25519_scalar_reduce(hram_reduced, hash_output);
+
+  // S = k * a + r mod L
+  crypto_core_ed25519_scalar_mul(s, hram_reduced, scalar);
+  crypto_core_ed25519_scalar_add(s, s, nonce);
+
+  sodium_memzero(nonce, sizeof(nonce));
+  sodium_memzero(hash_output, sizeof(hash_output));
+  sodium_memzero(&hash_state, sizeof(hash_state));
+
+  return cardano_ed25519_signature_from_bytes(signature_bytes, sizeof(signature_bytes), signature);
+}
+
+cardano_error_t
+cardano_ed25519_signing_context_get_public_key(
+  const cardano_ed25519_signing_context_t* context,
+  cardano_ed25519_public_key_t**           public_key)
+{
+  if ((context == NULL) || (public_key == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return cardano_ed25519_public_key_from_bytes(context->public_key, sizeof(context->public_key), public_key);
+}
+
+void
+cardano_ed25519_signing_context_unref(cardano_ed25519_signing_context_t** context)
+{
+  if ((context == NULL) || (*context == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*context)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *context = NULL;
+    return;
+  }
+}
+
+void
+cardano_ed25519_signing_context_ref(cardano_ed25519_signing_context_t* context)
+{
+  if (context == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&context->base);
+}
+
+size_t
+cardano_ed25519_signing_context_refcount(const cardano_ed25519_signing_context_t* context)
+{
+  if (context == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&context->base);
+}
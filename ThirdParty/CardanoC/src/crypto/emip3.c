@@ -38,6 +38,75 @@ static const uint64_t TAG_LENGTH        = crypto_aead_chacha20poly1305_IETF_ABYT
 static const uint64_t KEY_LENGTH        = 32U;
 static const uint64_t PBKDF2_ITERATIONS = 19162U;
 
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Decrypts encrypted_data into caller memory, so the plaintext is only ever written where the caller chose.
+ *
+ * \param[in] encrypted_data The salt, nonce, tag and ciphertext, in that order.
+ * \param[in] encrypted_data_length The length of encrypted_data.
+ * \param[in] passphrase The passphrase the decryption key is derived from.
+ * \param[in] passphrase_length The length of the passphrase.
+ * \param[in] iterations The PBKDF2 iteration count.
+ * \param[out] data Receives the plaintext. Left wiped on failure.
+ * \param[in] data_capacity The size of data.
+ * \param[out] data_length Receives the length of the plaintext.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of \ref cardano_crypto_emip3_decrypt_to.
+ */
+static cardano_error_t
+decrypt_to(
+  const byte_t*  encrypted_data,
+  const size_t   encrypted_data_length,
+  const byte_t*  passphrase,
+  const size_t   passphrase_length,
+  const uint32_t iterations,
+  byte_t*        data,
+  const size_t   data_capacity,
+  size_t*        data_length)
+{
+  if ((encrypted_data_length < (SALT_LENGTH + NONCE_LENGTH + TAG_LENGTH)) || (iterations == 0U))
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  const size_t ciphertext_len = encrypted_data_length - (SALT_LENGTH + NONCE_LENGTH + TAG_LENGTH);
+
+  if (ciphertext_len > data_capacity)
+  {
+    return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
+  }
+
+  const byte_t* salt       = encrypted_data;
+  const byte_t* nonce      = &encrypted_data[SALT_LENGTH];
+  const byte_t* tag        = &nonce[NONCE_LENGTH];
+  const byte_t* ciphertext = &tag[TAG_LENGTH];
+
+  byte_t key[32U] = { 0 };
+
+  cardano_error_t result = cardano_crypto_pbkdf2_hmac_sha512(
+    passphrase, passphrase_length, salt, SALT_LENGTH, iterations, key, KEY_LENGTH);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (crypto_aead_chacha20poly1305_ietf_decrypt_detached(data, NULL, ciphertext, ciphertext_len, tag, NULL, 0, nonce, key) != 0)
+  {
+    sodium_memzero(key, KEY_LENGTH);
+    sodium_memzero(data, ciphertext_len);
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  sodium_memzero(key, KEY_LENGTH);
+
+  *data_length = ciphertext_len;
+
+  return CARDANO_SUCCESS;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -47,12 +116,29 @@ cardano_crypto_emip3_encrypt(
   const byte_t*      passphrase,
   const size_t       passphrase_length,
   cardano_buffer_t** encrypted_data)
+{
+  return cardano_crypto_emip3_encrypt_with_iterations(data, data_length, passphrase, passphrase_length, (uint32_t)PBKDF2_ITERATIONS, encrypted_data);
+}
+
+cardano_error_t
+cardano_crypto_emip3_encrypt_with_iterations(
+  const byte_t*      data,
+  const size_t       data_length,
+  const byte_t*      passphrase,
+  const size_t       passphrase_length,
+  const uint32_t     iterations,
+  cardano_buffer_t** encrypted_data)
 {
   if ((data == NULL) || ((passphrase_length > 0U) && (passphrase == NULL)) || (encrypted_data == NULL))
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (iterations == 0U)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
   cardano_error_t result = CARDANO_SUCCESS;
 
   const size_t required_length = SALT_LENGTH + NONCE_LENGTH + TAG_LENGTH + data_length;
@@ -83,7 +169,7 @@ cardano_crypto_emip3_encrypt(
   byte_t key[32U] = { 0 };
 
   result = cardano_crypto_pbkdf2_hmac_sha512(
-    passphrase, passphrase_length, salt, SALT_LENGTH, (uint32_t)PBKDF2_ITERATIONS, key, KEY_LENGTH);
+    passphrase, passphrase_length, salt, SALT_LENGTH, iterations, key, KEY_LENGTH);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -120,6 +206,23 @@ cardano_crypto_emip3_decrypt(
   const size_t       passphrase_length,
   cardano_buffer_t** data)
 {
+  return cardano_crypto_emip3_decrypt_with_iterations(encrypted_data, encrypted_data_length, passphrase, passphrase_length, (uint32_t)PBKDF2_ITERATIONS, data);
+}
+
+cardano_error_t
+cardano_crypto_emip3_decrypt_with_iterations(
+  const byte_t*      encrypted_data,
+  const size_t       encrypted_data_length,
+  const byte_t*      passphrase,
+  const size_t       passphrase_length,
+  const uint32_t     iterations,
+  cardano_buffer_t** data)
+{
+  if ((encrypted_data == NULL) || ((passphrase_length > 0U) && (passphrase == NULL)) || (data == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
   if (encrypted_data_length < (SALT_LENGTH + NONCE_LENGTH + TAG_LENGTH))
   {
     return CARDANO_ERROR_INVALID_ARGUMENT;
@@ -143,32 +246,32 @@ cardano_crypto_emip3_decrypt(
     return result;
   }
 
-  const byte_t* salt       = encrypted_data;
-  const byte_t* nonce      = &encrypted_data[SALT_LENGTH];
-  const byte_t* tag        = &nonce[NONCE_LENGTH];
-  const byte_t* ciphertext = &tag[TAG_LENGTH];
-
-  byte_t key[32U] = { 0 };
+  size_t written = 0U;
 
-  result = cardano_crypto_pbkdf2_hmac_sha512(
-    passphrase, passphrase_length, salt, SALT_LENGTH, (uint32_t)PBKDF2_ITERATIONS, key, KEY_LENGTH);
+  result = decrypt_to(encrypted_data, encrypted_data_length, passphrase, passphrase_length, iterations, cardano_buffer_get_data(*data), ciphertext_len, &written);
 
   if (result != CARDANO_SUCCESS)
   {
     cardano_buffer_unref(data);
-
-    return result;
   }
 
-  if (crypto_aead_chacha20poly1305_ietf_decrypt_detached(cardano_buffer_get_data(*data), NULL, ciphertext, ciphertext_len, tag, NULL, 0, nonce, key) != 0)
-  {
-    cardano_buffer_unref(data);
-    sodium_memzero(key, KEY_LENGTH);
+  return result;
+}
 
-    return CARDANO_ERROR_GENERIC;
+cardano_error_t
+cardano_crypto_emip3_decrypt_to(
+  const byte_t* encrypted_data,
+  const size_t  encrypted_data_length,
+  const byte_t* passphrase,
+  const size_t  passphrase_length,
+  byte_t*       data,
+  const size_t  data_capacity,
+  size_t*       data_length)
+{
+  if ((encrypted_data == NULL) || ((passphrase_length > 0U) && (passphrase == NULL)) || (data == NULL) || (data_length == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  sodium_memzero(key, KEY_LENGTH);
-
-  return CARDANO_SUCCESS;
-}
\ No newline at end of file
+  return decrypt_to(encrypted_data, encrypted_data_length, passphrase, passphrase_length, (uint32_t)PBKDF2_ITERATIONS, data, data_capacity, data_length);
+}
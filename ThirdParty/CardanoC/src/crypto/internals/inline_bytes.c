@@ -0,0 +1,100 @@
+/**
+ * \file inline_bytes.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "../../encoding/internals/hex_codec.h"
+#include "../../string_safe.h"
+#include "inline_bytes.h"
+
+#include <string.h>
+
+/* DEFINITIONS ***************************************************************/
+
+cardano_error_t
+_cardano_inline_bytes_copy(const byte_t* data, const size_t size, byte_t* dest, const size_t dest_size)
+{
+  if (dest == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((dest_size == 0U) || (size > dest_size))
+  {
+    return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_WRITE;
+  }
+
+  cardano_safe_memcpy(dest, dest_size, data, size);
+
+  return CARDANO_SUCCESS;
+}
+
+size_t
+_cardano_inline_bytes_get_hex_size(const size_t size)
+{
+  return (size * 2U) + 1U;
+}
+
+cardano_error_t
+_cardano_inline_bytes_to_hex(const byte_t* data, const size_t size, char* dest, const size_t dest_size)
+{
+  if (dest == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (dest_size < _cardano_inline_bytes_get_hex_size(size))
+  {
+    return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
+  }
+
+  cardano_hex_encode(data, size, dest);
+  dest[size * 2U] = '\0';
+
+  return CARDANO_SUCCESS;
+}
+
+bool
+_cardano_inline_bytes_from_hex(const char* hex, const size_t hex_length, byte_t* out, const size_t out_size)
+{
+  if ((hex == NULL) || (out == NULL) || ((hex_length % 2U) != 0U) || ((hex_length / 2U) != out_size))
+  {
+    return false;
+  }
+
+  return cardano_hex_decode(hex, hex_length, out);
+}
+
+int32_t
+_cardano_inline_bytes_compare(const byte_t* lhs, const size_t lhs_size, const byte_t* rhs, const size_t rhs_size)
+{
+  if (lhs_size != rhs_size)
+  {
+    return (lhs_size < rhs_size) ? -1 : 1;
+  }
+
+  if (lhs_size == 0U)
+  {
+    return 0;
+  }
+
+  return memcmp(lhs, rhs, lhs_size);
+}
@@ -0,0 +1,98 @@
+/**
+ * \file inline_bytes.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_INLINE_BYTES_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_INLINE_BYTES_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Copies bytes held inline by an object to a caller buffer, as \ref cardano_buffer_copy_bytes does.
+ *
+ * \param[in] data The bytes.
+ * \param[in] size The number of bytes.
+ * \param[out] dest The buffer to copy to.
+ * \param[in] dest_size The size of \p dest.
+ *
+ * \return \ref CARDANO_SUCCESS, \ref CARDANO_ERROR_POINTER_IS_NULL if \p dest is NULL, or
+ *         \ref CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_WRITE if \p dest is empty or too small.
+ */
+cardano_error_t
+_cardano_inline_bytes_copy(const byte_t* data, size_t size, byte_t* dest, size_t dest_size);
+
+/**
+ * \brief Gets the size of the hex string of \p size bytes, including its null terminator.
+ *
+ * \param[in] size The number of bytes.
+ *
+ * \return The size of the hex string.
+ */
+size_t
+_cardano_inline_bytes_get_hex_size(size_t size);
+
+/**
+ * \brief Writes bytes held inline by an object as a null-terminated hex string, as \ref cardano_buffer_to_hex does.
+ *
+ * Not constant time, so not for secret key material, which objects encode with libsodium.
+ *
+ * \param[in] data The bytes.
+ * \param[in] size The number of bytes.
+ * \param[out] dest The buffer the string is written to.
+ * \param[in] dest_size The size of \p dest.
+ *
+ * \return \ref CARDANO_SUCCESS, \ref CARDANO_ERROR_POINTER_IS_NULL if \p dest is NULL,
+ *         \ref CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE if \p dest is too small, or \ref CARDANO_ERROR_GENERIC.
+ */
+cardano_error_t
+_cardano_inline_bytes_to_hex(const byte_t* data, size_t size, char* dest, size_t dest_size);
+
+/**
+ * \brief Decodes a hex string into inline storage of exactly half its length, as \ref cardano_buffer_from_hex does.
+ *
+ * \param[in] hex The hex string.
+ * \param[in] hex_length The length of \p hex, which must be twice \p out_size.
+ * \param[out] out The storage decoded into.
+ * \param[in] out_size The size of \p out.
+ *
+ * \return \c true on success, or \c false if the length does not match or \p hex cannot be decoded.
+ */
+bool
+_cardano_inline_bytes_from_hex(const char* hex, size_t hex_length, byte_t* out, size_t out_size);
+
+/**
+ * \brief Orders two byte strings by length, then by content, as \ref cardano_buffer_compare does.
+ *
+ * \param[in] lhs The first bytes.
+ * \param[in] lhs_size The number of bytes in \p lhs.
+ * \param[in] rhs The second bytes.
+ * \param[in] rhs_size The number of bytes in \p rhs.
+ *
+ * \return A negative value, zero or a positive value as \p lhs orders before, equal to or after \p rhs.
+ */
+int32_t
+_cardano_inline_bytes_compare(const byte_t* lhs, size_t lhs_size, const byte_t* rhs, size_t rhs_size);
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_INLINE_BYTES_H
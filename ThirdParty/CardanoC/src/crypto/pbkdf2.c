@@ -32,6 +32,193 @@
 
 #include "../endian.h"
 
+/* CONSTANTS *****************************************************************/
+
+static const uint64_t SHA512_K[80] = {
+  0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+  0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+  0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+  0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+  0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+  0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+  0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+  0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+  0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+  0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+  0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+  0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+  0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+  0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+  0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+  0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+  0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+  0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+  0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+  0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+/**
+ * The message length, in bits, of every HMAC-SHA512 hash computed after the first PBKDF2 iteration: one 128-byte
+ * key pad block followed by a 64-byte digest.
+ */
+static const uint64_t HMAC_SHA512_DIGEST_MESSAGE_BITS = (128U + 64U) * 8U;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Rotates a 64-bit word to the right.
+ *
+ * \param x The word.
+ * \param n The number of bits, between 1 and 63.
+ *
+ * \return The rotated word.
+ */
+static inline uint64_t
+rotr64(const uint64_t x, const uint32_t n)
+{
+  return (x >> n) | (x << (64U - n));
+}
+
+/**
+ * \brief Runs the SHA-512 compression function over a single block.
+ *
+ * \param state The chaining value, updated in place.
+ * \param block The 16 message words of the block, already in host order.
+ */
+static void
+sha512_compress(uint64_t state[8], const uint64_t block[16])
+{
+  uint64_t w[80];
+
+  for (size_t i = 0U; i < 16U; ++i)
+  {
+    w[i] = block[i];
+  }
+
+  for (size_t i = 16U; i < 80U; ++i)
+  {
+    const uint64_t s0 = rotr64(w[i - 15U], 1U) ^ rotr64(w[i - 15U], 8U) ^ (w[i - 15U] >> 7U);
+    const uint64_t s1 = rotr64(w[i - 2U], 19U) ^ rotr64(w[i - 2U], 61U) ^ (w[i - 2U] >> 6U);
+
+    w[i] = w[i - 16U] + s0 + w[i - 7U] + s1;
+  }
+
+  uint64_t a = state[0];
+  uint64_t b = state[1];
+  uint64_t c = state[2];
+  uint64_t d = state[3];
+  uint64_t e = state[4];
+  uint64_t f = state[5];
+  uint64_t g = state[6];
+  uint64_t h = state[7];
+
+  for (size_t i = 0U; i < 80U; ++i)
+  {
+    const uint64_t t1 = h + (rotr64(e, 14U) ^ rotr64(e, 18U) ^ rotr64(e, 41U)) + ((e & f) ^ (~e & g)) + SHA512_K[i] + w[i];
+    const uint64_t t2 = (rotr64(a, 28U) ^ rotr64(a, 34U) ^ rotr64(a, 39U)) + ((a & b) ^ (a & c) ^ (b & c));
+
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+  state[5] += f;
+  state[6] += g;
+  state[7] += h;
+
+  sodium_memzero((void*)w, sizeof(w));
+}
+
+/**
+ * \brief Computes one HMAC-SHA512 over a 64-byte message, starting from precomputed key pad states.
+ *
+ * The inner and outer states are the SHA-512 chaining values after absorbing `key ^ ipad` and `key ^ opad`. Both
+ * remaining hashes fit in a single padded block, so each PBKDF2 iteration costs exactly two compressions instead of
+ * the four the generic HMAC API performs.
+ *
+ * \param inner_state The chaining value after the inner key pad.
+ * \param outer_state The chaining value after the outer key pad.
+ * \param message The 64-byte message as 8 host-order words. Overwritten with the 64-byte MAC.
+ */
+static void
+hmac_sha512_digest(const uint64_t inner_state[8], const uint64_t outer_state[8], uint64_t message[8])
+{
+  uint64_t block[16] = { 0 };
+  uint64_t state[8];
+
+  block[8]  = 0x8000000000000000ULL;
+  block[15] = HMAC_SHA512_DIGEST_MESSAGE_BITS;
+
+  for (size_t i = 0U; i < 8U; ++i)
+  {
+    block[i] = message[i];
+    state[i] = inner_state[i];
+  }
+
+  sha512_compress(state, block);
+
+  for (size_t i = 0U; i < 8U; ++i)
+  {
+    block[i]   = state[i];
+    message[i] = outer_state[i];
+  }
+
+  sha512_compress(message, block);
+
+  sodium_memzero((void*)block, sizeof(block));
+  sodium_memzero((void*)state, sizeof(state));
+}
+
+/**
+ * \brief Loads a 64-byte digest as 8 big-endian words.
+ *
+ * \param digest The digest.
+ * \param words The output words.
+ */
+static void
+load_digest_words(const byte_t digest[64], uint64_t words[8])
+{
+  for (size_t i = 0U; i < 8U; ++i)
+  {
+    uint64_t word = 0U;
+
+    for (size_t j = 0U; j < 8U; ++j)
+    {
+      word = (word << 8U) | (uint64_t)digest[(i * 8U) + j];
+    }
+
+    words[i] = word;
+  }
+}
+
+/**
+ * \brief Stores 8 words as a big-endian 64-byte digest.
+ *
+ * \param words The words.
+ * \param digest The output digest.
+ */
+static void
+store_digest_words(const uint64_t words[8], byte_t digest[64])
+{
+  for (size_t i = 0U; i < 8U; ++i)
+  {
+    for (size_t j = 0U; j < 8U; ++j)
+    {
+      digest[(i * 8U) + j] = (byte_t)(words[i] >> (56U - (j * 8U)));
+    }
+  }
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -57,10 +244,18 @@ cardano_crypto_pbkdf2_hmac_sha512(
   crypto_auth_hmacsha512_state initial_hmac_state   = { 0 };
   crypto_auth_hmacsha512_state loop_hHmac_state     = { 0 };
   byte_t                       iteration_vector[4U] = { 0 };
-  byte_t                       temp_digest[64U]     = { 0 };
   byte_t                       block_digest[64U]    = { 0 };
+  uint64_t                     u_words[8U]          = { 0 };
+  uint64_t                     t_words[8U]          = { 0 };
+  uint64_t                     inner_state[8U]      = { 0 };
+  uint64_t                     outer_state[8U]      = { 0 };
 
+  // Keying the HMAC absorbs the inner and outer key pads; their chaining values are reused for every iteration.
   crypto_auth_hmacsha512_init(&initial_hmac_state, password, password_length);
+
+  cardano_safe_memcpy(inner_state, sizeof(inner_state), initial_hmac_state.ictx.state, sizeof(inner_state));
+  cardano_safe_memcpy(outer_state, sizeof(outer_state), initial_hmac_state.octx.state, sizeof(outer_state));
+
   crypto_auth_hmacsha512_update(&initial_hmac_state, salt, salt_length);
 
   for (size_t i = 0; (i * crypto_auth_hmacsha512_BYTES) < derived_key_length; ++i)
@@ -72,22 +267,27 @@ cardano_crypto_pbkdf2_hmac_sha512(
     cardano_safe_memcpy(&loop_hHmac_state, sizeof(crypto_auth_hmacsha512_state), &initial_hmac_state, sizeof(crypto_auth_hmacsha512_state));
 
     crypto_auth_hmacsha512_update(&loop_hHmac_state, iteration_vector, sizeof(iteration_vector));
-    crypto_auth_hmacsha512_final(&loop_hHmac_state, temp_digest);
+    crypto_auth_hmacsha512_final(&loop_hHmac_state, block_digest);
 
-    cardano_safe_memcpy(block_digest, sizeof(block_digest), temp_digest, sizeof(temp_digest));
+    load_digest_words(block_digest, u_words);
+
+    for (size_t k = 0; k < 8U; ++k)
+    {
+      t_words[k] = u_words[k];
+    }
 
     for (size_t j = 2; j <= iterations; ++j)
     {
-      crypto_auth_hmacsha512_init(&loop_hHmac_state, password, password_length);
-      crypto_auth_hmacsha512_update(&loop_hHmac_state, temp_digest, crypto_auth_hmacsha512_BYTES);
-      crypto_auth_hmacsha512_final(&loop_hHmac_state, temp_digest);
+      hmac_sha512_digest(inner_state, outer_state, u_words);
 
-      for (size_t k = 0; k < crypto_auth_hmacsha512_BYTES; ++k)
+      for (size_t k = 0; k < 8U; ++k)
       {
-        block_digest[k] ^= temp_digest[k];
+        t_words[k] ^= u_words[k];
       }
     }
 
+    store_digest_words(t_words, block_digest);
+
     current_block_length = derived_key_length - (i * crypto_auth_hmacsha512_BYTES);
 
     if (current_block_length > crypto_auth_hmacsha512_BYTES)
@@ -105,8 +305,11 @@ cardano_crypto_pbkdf2_hmac_sha512(
   sodium_memzero((void*)&initial_hmac_state, sizeof(initial_hmac_state));
   sodium_memzero((void*)&loop_hHmac_state, sizeof(loop_hHmac_state));
   sodium_memzero((void*)iteration_vector, sizeof(iteration_vector));
-  sodium_memzero((void*)temp_digest, sizeof(temp_digest));
   sodium_memzero((void*)block_digest, sizeof(block_digest));
+  sodium_memzero((void*)u_words, sizeof(u_words));
+  sodium_memzero((void*)t_words, sizeof(t_words));
+  sodium_memzero((void*)inner_state, sizeof(inner_state));
+  sodium_memzero((void*)outer_state, sizeof(outer_state));
 
   return CARDANO_SUCCESS;
 }
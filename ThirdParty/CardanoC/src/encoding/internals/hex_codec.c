@@ -0,0 +1,252 @@
+/**
+ * \file hex_codec.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "hex_codec.h"
+
+#include "../../config.h"
+
+#include <string.h>
+
+#if !defined(LIB_CARDANO_C_DISABLE_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define CARDANO_HEX_CODEC_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define CARDANO_HEX_CODEC_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+/* CONSTANTS *****************************************************************/
+
+static const char HEX_DIGITS[] = "0123456789abcdef"; // cppcheck-suppress misra-c2012-8.9
+
+#if defined(CARDANO_HEX_CODEC_SSE2) || defined(CARDANO_HEX_CODEC_NEON)
+static const size_t VECTOR_SIZE = 16U; // cppcheck-suppress misra-c2012-8.9
+#endif
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Gets the value of a hex digit.
+ *
+ * \param[in] c The character.
+ *
+ * \return The value of the digit, or a value greater than 15 if \p c is not a hex digit.
+ */
+static byte_t
+digit_value(const char c)
+{
+  const byte_t digit = (byte_t)((byte_t)c - (byte_t)'0');
+
+  if (digit <= 9U)
+  {
+    return digit;
+  }
+
+  // Setting bit 5 maps 'A'-'F' onto 'a'-'f' and leaves no other character in that range
+  const byte_t letter = (byte_t)(((byte_t)c | 0x20U) - (byte_t)'a');
+
+  return (letter <= 5U) ? (byte_t)(letter + 10U) : 0xFFU;
+}
+
+#if defined(CARDANO_HEX_CODEC_SSE2)
+
+/**
+ * \brief Turns 16 nibbles into their lower-case hex digits.
+ *
+ * \param[in] nibbles Values from 0 to 15, one per byte.
+ *
+ * \return The digits.
+ */
+static __m128i
+nibbles_to_digits(const __m128i nibbles)
+{
+  const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+
+  return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+}
+
+/**
+ * \brief Turns 16 hex digits into their values.
+ *
+ * \param[in] chars The characters.
+ * \param[out] values The values of the digits, one per byte.
+ *
+ * \return \c true if all 16 characters are hex digits.
+ */
+static bool
+digits_to_nibbles(const __m128i chars, __m128i* values)
+{
+  // Signed compares leave bytes above 0x7F out of both ranges
+  const __m128i lower    = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+  const __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+  const __m128i is_alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+
+  if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) != 0xFFFF)
+  {
+    return false;
+  }
+
+  *values = _mm_or_si128(
+    _mm_and_si128(is_digit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+    _mm_and_si128(is_alpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+
+  return true;
+}
+
+/**
+ * \brief Joins the 16 nibbles of 8 bytes, high nibble first, into those bytes.
+ *
+ * \param[in] values The nibbles.
+ *
+ * \return The bytes, one in the low half of each 16-bit lane.
+ */
+static __m128i
+join_nibbles(const __m128i values)
+{
+  const __m128i high = _mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00FF)), 4);
+
+  return _mm_or_si128(high, _mm_srli_epi16(values, 8));
+}
+
+#endif
+
+/* DEFINITIONS ***************************************************************/
+
+void
+cardano_hex_encode(const byte_t* data, const size_t size, char* dest)
+{
+  size_t offset = 0U;
+
+#if defined(CARDANO_HEX_CODEC_SSE2)
+  const __m128i low_mask = _mm_set1_epi8(0x0F);
+
+  while ((offset + VECTOR_SIZE) <= size)
+  {
+    const __m128i bytes = _mm_loadu_si128((const __m128i*)((const void*)&data[offset]));
+    const __m128i high  = nibbles_to_digits(_mm_and_si128(_mm_srli_epi16(bytes, 4), low_mask));
+    const __m128i low   = nibbles_to_digits(_mm_and_si128(bytes, low_mask));
+
+    _mm_storeu_si128((__m128i*)((void*)&dest[offset * 2U]), _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128((__m128i*)((void*)&dest[(offset * 2U) + VECTOR_SIZE]), _mm_unpackhi_epi8(high, low));
+
+    offset += VECTOR_SIZE;
+  }
+#elif defined(CARDANO_HEX_CODEC_NEON)
+  const uint8x16_t digits = vld1q_u8((const uint8_t*)((const void*)HEX_DIGITS));
+
+  while ((offset + VECTOR_SIZE) <= size)
+  {
+    const uint8x16_t bytes = vld1q_u8(&data[offset]);
+    uint8x16x2_t     chars = { 0 };
+
+    chars.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(bytes, 4));
+    chars.val[1] = vqtbl1q_u8(digits, vandq_u8(bytes, vdupq_n_u8(0x0FU)));
+
+    // The two registers are stored interleaved, high digit first
+    vst2q_u8((uint8_t*)((void*)&dest[offset * 2U]), chars);
+
+    offset += VECTOR_SIZE;
+  }
+#endif
+
+  for (; offset < size; ++offset)
+  {
+    dest[offset * 2U]        = HEX_DIGITS[data[offset] >> 4U];
+    dest[(offset * 2U) + 1U] = HEX_DIGITS[data[offset] & 0x0FU];
+  }
+}
+
+bool
+cardano_hex_decode(const char* hex, const size_t hex_length, byte_t* dest)
+{
+  if ((hex_length % 2U) != 0U)
+  {
+    return false;
+  }
+
+  const size_t size   = hex_length / 2U;
+  size_t       offset = 0U;
+
+#if defined(CARDANO_HEX_CODEC_SSE2)
+  while ((offset + VECTOR_SIZE) <= size)
+  {
+    __m128i first  = _mm_loadu_si128((const __m128i*)((const void*)&hex[offset * 2U]));
+    __m128i second = _mm_loadu_si128((const __m128i*)((const void*)&hex[(offset * 2U) + VECTOR_SIZE]));
+
+    if (!digits_to_nibbles(first, &first) || !digits_to_nibbles(second, &second))
+    {
+      return false;
+    }
+
+    _mm_storeu_si128((__m128i*)((void*)&dest[offset]), _mm_packus_epi16(join_nibbles(first), join_nibbles(second)));
+
+    offset += VECTOR_SIZE;
+  }
+#elif defined(CARDANO_HEX_CODEC_NEON)
+  const uint8x16_t nine = vdupq_n_u8(9U);
+  const uint8x16_t five = vdupq_n_u8(5U);
+
+  while ((offset + VECTOR_SIZE) <= size)
+  {
+    // Loaded deinterleaved: the high digits of the 16 bytes in val[0], the low digits in val[1]
+    const uint8x16x2_t chars     = vld2q_u8((const uint8_t*)((const void*)&hex[offset * 2U]));
+    uint8x16_t         values[2] = { vdupq_n_u8(0U), vdupq_n_u8(0U) };
+
+    for (size_t i = 0U; i < 2U; ++i)
+    {
+      const uint8x16_t digit    = vsubq_u8(chars.val[i], vdupq_n_u8((uint8_t)'0'));
+      const uint8x16_t letter   = vsubq_u8(vorrq_u8(chars.val[i], vdupq_n_u8(0x20U)), vdupq_n_u8((uint8_t)'a'));
+      const uint8x16_t is_digit = vcleq_u8(digit, nine);
+      const uint8x16_t is_alpha = vcleq_u8(letter, five);
+
+      if (vminvq_u8(vorrq_u8(is_digit, is_alpha)) == 0U)
+      {
+        return false;
+      }
+
+      values[i] = vbslq_u8(is_digit, digit, vaddq_u8(letter, vdupq_n_u8(10U)));
+    }
+
+    vst1q_u8(&dest[offset], vorrq_u8(vshlq_n_u8(values[0], 4), values[1]));
+
+    offset += VECTOR_SIZE;
+  }
+#endif
+
+  for (; offset < size; ++offset)
+  {
+    const byte_t high = digit_value(hex[offset * 2U]);
+    const byte_t low  = digit_value(hex[(offset * 2U) + 1U]);
+
+    if ((high > 15U) || (low > 15U))
+    {
+      return false;
+    }
+
+    dest[offset] = (byte_t)((byte_t)(high << 4U) | low);
+  }
+
+  return true;
+}
@@ -0,0 +1,60 @@
+/**
+ * \file hex_codec.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_HEX_CODEC_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_HEX_CODEC_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Writes bytes as lower-case hex.
+ *
+ * Runs 16 bytes at a time with SSE2 on x86 and NEON on AArch64, and one byte at a time elsewhere or when the library
+ * is built with `LIB_CARDANO_C_DISABLE_SIMD`. Unlike the libsodium codec it is not constant time, so it must not be
+ * used for secret key material.
+ *
+ * \param[in] data The bytes to encode. May be NULL if \p size is zero.
+ * \param[in] size The number of bytes.
+ * \param[out] dest Receives the <tt>2 * size</tt> hex digits, without a null terminator.
+ */
+void
+cardano_hex_encode(const byte_t* data, size_t size, char* dest);
+
+/**
+ * \brief Reads hex digits, of either case, into bytes.
+ *
+ * Runs 32 digits at a time with SSE2 on x86 and NEON on AArch64, and one digit at a time elsewhere or when the
+ * library is built with `LIB_CARDANO_C_DISABLE_SIMD`. Not constant time.
+ *
+ * \param[in] hex The digits. May be NULL if \p hex_length is zero.
+ * \param[in] hex_length The number of digits; must be even.
+ * \param[out] dest Receives the <tt>hex_length / 2</tt> bytes. Its contents are unspecified on failure.
+ *
+ * \return \c true on success, or \c false if \p hex_length is odd or a character is not a hex digit.
+ */
+bool
+cardano_hex_decode(const char* hex, size_t hex_length, byte_t* dest);
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_HEX_CODEC_H
@@ -206,6 +206,9 @@ cardano_error_to_string(const cardano_error_t error)
     case CARDANO_ERROR_JSON_TYPE_MISMATCH:
       message = "JSON type mismatch";
       break;
+    case CARDANO_ERROR_OBJECT_IS_FROZEN:
+      message = "Object is frozen";
+      break;
     default:
       message = "Unknown error code";
       break;
@@ -96,6 +96,7 @@ cardano_json_object_new(void)
   {
     object->base.ref_count     = 1U;
     object->base.deallocator   = cardano_json_object_deallocate;
+    object->base.last_error    = NULL;
     object->type               = CARDANO_JSON_OBJECT_TYPE_NULL;
     object->pairs              = NULL;
     object->array              = NULL;
@@ -122,6 +123,7 @@ cardano_json_kvp_new(void)
   {
     kvp->base.ref_count   = 1U;
     kvp->base.deallocator = cardano_json_kvp_deallocate;
+    kvp->base.last_error  = NULL;
     kvp->key              = NULL;
     kvp->value            = NULL;
   }
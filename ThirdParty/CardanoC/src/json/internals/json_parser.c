@@ -27,6 +27,7 @@
 #include "../../string_safe.h"
 #include "json_object_common.h"
 #include "json_parser.h"
+#include "json_scanner.h"
 #include "utf8.h"
 #include <assert.h>
 #include <ctype.h>
@@ -73,18 +74,9 @@ set_last_error(cardano_json_parse_context_t* ctx, const char* message)
 void
 cardano_skip_whitespace(cardano_json_parse_context_t* ctx)
 {
-  while (ctx->offset < ctx->length)
+  if (ctx->offset < ctx->length)
   {
-    char c = ctx->input[ctx->offset];
-
-    if ((c == ' ') || (c == '\n') || (c == '\r') || (c == '\t'))
-    {
-      ++ctx->offset;
-    }
-    else
-    {
-      break;
-    }
+    ctx->offset += cardano_json_scan_whitespace(&ctx->input[ctx->offset], ctx->length - ctx->offset);
   }
 }
 
@@ -113,26 +105,15 @@ cardano_has_char(const char to_match, const char* begin, const char* end)
 bool
 cardano_handle_utf8_sequence(cardano_json_parse_context_t* ctx, cardano_buffer_t* buf)
 {
-  byte_t first_byte = (byte_t)ctx->input[ctx->offset];
-  size_t seq_len    = cardano_utf8_sequence_length(first_byte);
+  const size_t seq_len = cardano_utf8_validate_sequence(&ctx->input[ctx->offset], ctx->length - ctx->offset);
 
-  if ((seq_len == 0U) || ((ctx->offset + seq_len) > ctx->length))
+  if (seq_len == 0U)
   {
     set_last_error(ctx, "Invalid UTF-8 sequence");
 
     return false;
   }
 
-  for (size_t i = 1U; i < seq_len; ++i)
-  {
-    if ((ctx->input[ctx->offset + i] & 0xC0) != 0x80)
-    {
-      set_last_error(ctx, "Invalid UTF-8 continuation byte");
-
-      return false;
-    }
-  }
-
   cardano_error_t result = cardano_buffer_write(buf, (const byte_t*)&ctx->input[ctx->offset], seq_len);
   if (result != CARDANO_SUCCESS)
   {
@@ -330,13 +311,35 @@ cardano_parse_string_value(cardano_json_parse_context_t* ctx)
     return NULL;
   }
 
+  bool is_terminated = false;
+
   while (ctx->offset < ctx->length)
   {
+    const size_t run = cardano_json_scan_string_run(&ctx->input[ctx->offset], ctx->length - ctx->offset);
+
+    if (run > 0U)
+    {
+      cardano_error_t result = cardano_buffer_write(buf, (const byte_t*)&ctx->input[ctx->offset], run);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        cardano_buffer_unref(&buf);
+        set_last_error(ctx, cardano_error_to_string(result));
+
+        return NULL;
+      }
+
+      ctx->offset += run;
+
+      continue;
+    }
+
     char c = ctx->input[ctx->offset];
 
     if (c == '\"')
     {
       ++ctx->offset;
+      is_terminated = true;
       break;
     }
 
@@ -362,6 +365,14 @@ cardano_parse_string_value(cardano_json_parse_context_t* ctx)
     }
   }
 
+  if (!is_terminated)
+  {
+    cardano_buffer_unref(&buf);
+    set_last_error(ctx, "Unterminated JSON string");
+
+    return NULL;
+  }
+
   cardano_json_object_t* obj = cardano_json_object_new();
 
   if (obj == NULL)
@@ -0,0 +1,280 @@
+/**
+ * \file json_scanner.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "json_scanner.h"
+
+#include "../../config.h"
+
+#include <string.h>
+
+#if !defined(LIB_CARDANO_C_DISABLE_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define CARDANO_JSON_SCANNER_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define CARDANO_JSON_SCANNER_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+/* CONSTANTS *****************************************************************/
+
+#if defined(CARDANO_JSON_SCANNER_SSE2) || defined(CARDANO_JSON_SCANNER_NEON)
+static const size_t VECTOR_SIZE = 16U; // cppcheck-suppress misra-c2012-8.9
+#else
+static const uint64_t SWAR_ONES  = 0x0101010101010101ULL; // cppcheck-suppress misra-c2012-8.9
+static const uint64_t SWAR_HIGHS = 0x8080808080808080ULL; // cppcheck-suppress misra-c2012-8.9
+#endif
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Checks whether a byte is JSON whitespace.
+ *
+ * \param[in] c The byte.
+ *
+ * \return `true` for space, tab, line feed and carriage return.
+ */
+static bool
+is_whitespace(const char c)
+{
+  return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
+}
+
+/**
+ * \brief Checks whether a byte ends a verbatim run of a JSON string.
+ *
+ * \param[in] c The byte.
+ *
+ * \return `true` for a quote, a backslash or a non-ASCII byte.
+ */
+static bool
+is_string_stop(const char c)
+{
+  return (c == '\"') || (c == '\\') || (((byte_t)c & 0x80U) != 0U);
+}
+
+#if !defined(CARDANO_JSON_SCANNER_SSE2) && !defined(CARDANO_JSON_SCANNER_NEON)
+
+/**
+ * \brief Loads 8 bytes without alignment requirements.
+ *
+ * \param[in] data The bytes.
+ *
+ * \return The bytes as a word, in native byte order.
+ */
+static uint64_t
+load_word(const char* data)
+{
+  uint64_t word = 0U;
+
+  (void)memcpy(&word, data, sizeof(word));
+
+  return word;
+}
+
+/**
+ * \brief Checks whether any byte of a word is zero.
+ *
+ * \param[in] word The word.
+ *
+ * \return A non-zero value if any of the eight bytes is zero.
+ */
+static uint64_t
+word_has_zero_byte(const uint64_t word)
+{
+  return (word - SWAR_ONES) & ~word & SWAR_HIGHS;
+}
+
+#endif
+
+/* FUNCTIONS *****************************************************************/
+
+size_t
+cardano_json_scan_whitespace(const char* data, const size_t size)
+{
+  size_t offset = 0U;
+
+#if defined(CARDANO_JSON_SCANNER_SSE2)
+  const __m128i space   = _mm_set1_epi8(' ');
+  const __m128i tab     = _mm_set1_epi8('\t');
+  const __m128i newline = _mm_set1_epi8('\n');
+  const __m128i carry   = _mm_set1_epi8('\r');
+
+  while ((offset + VECTOR_SIZE) <= size)
+  {
+    const __m128i chunk = _mm_loadu_si128((const __m128i*)((const void*)&data[offset]));
+    const __m128i blank = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, newline), _mm_cmpeq_epi8(chunk, carry)));
+
+    if (_mm_movemask_epi8(blank) != 0xFFFF)
+    {
+      break;
+    }
+
+    offset += VECTOR_SIZE;
+  }
+#elif defined(CARDANO_JSON_SCANNER_NEON)
+  const uint8x16_t space   = vdupq_n_u8((uint8_t)' ');
+  const uint8x16_t tab     = vdupq_n_u8((uint8_t)'\t');
+  const uint8x16_t newline = vdupq_n_u8((uint8_t)'\n');
+  const uint8x16_t carry   = vdupq_n_u8((uint8_t)'\r');
+
+  while ((offset + VECTOR_SIZE) <= size)
+  {
+    const uint8x16_t chunk = vld1q_u8((const uint8_t*)((const void*)&data[offset]));
+    const uint8x16_t blank = vorrq_u8(
+      vorrq_u8(vceqq_u8(chunk, space), vceqq_u8(chunk, tab)),
+      vorrq_u8(vceqq_u8(chunk, newline), vceqq_u8(chunk, carry)));
+
+    if (vminvq_u8(blank) == 0U)
+    {
+      break;
+    }
+
+    offset += VECTOR_SIZE;
+  }
+#endif
+
+  while ((offset < size) && is_whitespace(data[offset]))
+  {
+    ++offset;
+  }
+
+  return offset;
+}
+
+size_t
+cardano_json_scan_string_run(const char* data, const size_t size)
+{
+  size_t offset = 0U;
+
+#if defined(CARDANO_JSON_SCANNER_SSE2)
+  const __m128i quote     = _mm_set1_epi8('\"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+
+  while ((offset + VECTOR_SIZE) <= size)
+  {
+    const __m128i chunk = _mm_loadu_si128((const __m128i*)((const void*)&data[offset]));
+    const __m128i stops = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash));
+
+    // The sign bit of each byte is set for non-ASCII bytes, which is what movemask collects.
+    if ((_mm_movemask_epi8(stops) | _mm_movemask_epi8(chunk)) != 0)
+    {
+      break;
+    }
+
+    offset += VECTOR_SIZE;
+  }
+#elif defined(CARDANO_JSON_SCANNER_NEON)
+  const uint8x16_t quote     = vdupq_n_u8((uint8_t)'\"');
+  const uint8x16_t backslash = vdupq_n_u8((uint8_t)'\\');
+  const uint8x16_t high      = vdupq_n_u8(0x80U);
+
+  while ((offset + VECTOR_SIZE) <= size)
+  {
+    const uint8x16_t chunk = vld1q_u8((const uint8_t*)((const void*)&data[offset]));
+    const uint8x16_t stops = vorrq_u8(
+      vorrq_u8(vceqq_u8(chunk, quote), vceqq_u8(chunk, backslash)),
+      vcgeq_u8(chunk, high));
+
+    if (vmaxvq_u8(stops) != 0U)
+    {
+      break;
+    }
+
+    offset += VECTOR_SIZE;
+  }
+#else
+  while ((offset + sizeof(uint64_t)) <= size)
+  {
+    const uint64_t word = load_word(&data[offset]);
+
+    if (((word & SWAR_HIGHS) != 0U)
+      || (word_has_zero_byte(word ^ (SWAR_ONES * (uint64_t)'\"')) != 0U)
+      || (word_has_zero_byte(word ^ (SWAR_ONES * (uint64_t)'\\')) != 0U))
+    {
+      break;
+    }
+
+    offset += sizeof(uint64_t);
+  }
+#endif
+
+  while ((offset < size) && !is_string_stop(data[offset]))
+  {
+    ++offset;
+  }
+
+  return offset;
+}
+
+size_t
+cardano_json_scan_ascii(const char* data, const size_t size)
+{
+  size_t offset = 0U;
+
+#if defined(CARDANO_JSON_SCANNER_SSE2)
+  while ((offset + VECTOR_SIZE) <= size)
+  {
+    const __m128i chunk = _mm_loadu_si128((const __m128i*)((const void*)&data[offset]));
+
+    if (_mm_movemask_epi8(chunk) != 0)
+    {
+      break;
+    }
+
+    offset += VECTOR_SIZE;
+  }
+#elif defined(CARDANO_JSON_SCANNER_NEON)
+  while ((offset + VECTOR_SIZE) <= size)
+  {
+    const uint8x16_t chunk = vld1q_u8((const uint8_t*)((const void*)&data[offset]));
+
+    if (vmaxvq_u8(chunk) >= 0x80U)
+    {
+      break;
+    }
+
+    offset += VECTOR_SIZE;
+  }
+#else
+  while ((offset + sizeof(uint64_t)) <= size)
+  {
+    if ((load_word(&data[offset]) & SWAR_HIGHS) != 0U)
+    {
+      break;
+    }
+
+    offset += sizeof(uint64_t);
+  }
+#endif
+
+  while ((offset < size) && (((byte_t)data[offset] & 0x80U) == 0U))
+  {
+    ++offset;
+  }
+
+  return offset;
+}
@@ -0,0 +1,71 @@
+/**
+ * \file json_scanner.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_JSON_SCANNER_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_JSON_SCANNER_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Measures the run of JSON whitespace at the start of a buffer.
+ *
+ * The scan runs 16 bytes at a time with SSE2 on x86 and NEON on AArch64, and one byte at a time elsewhere or when
+ * the library is built with `LIB_CARDANO_C_DISABLE_SIMD`.
+ *
+ * \param[in] data The buffer to scan. May be NULL if \p size is zero.
+ * \param[in] size The size of the buffer in bytes.
+ *
+ * \return The number of leading space, tab, line feed and carriage return bytes.
+ */
+size_t
+cardano_json_scan_whitespace(const char* data, size_t size);
+
+/**
+ * \brief Measures the run of bytes at the start of a buffer that a JSON string can copy verbatim.
+ *
+ * The run ends at the first quote, backslash or non-ASCII byte, which are the only bytes the string parsers need to
+ * look at individually. The scan runs 16 bytes at a time with SSE2 on x86 and NEON on AArch64, and 8 bytes at a time
+ * elsewhere.
+ *
+ * \param[in] data The buffer to scan. May be NULL if \p size is zero.
+ * \param[in] size The size of the buffer in bytes.
+ *
+ * \return The number of leading bytes that are neither a quote, a backslash nor greater than 0x7F.
+ */
+size_t
+cardano_json_scan_string_run(const char* data, size_t size);
+
+/**
+ * \brief Measures the run of ASCII bytes at the start of a buffer.
+ *
+ * \param[in] data The buffer to scan. May be NULL if \p size is zero.
+ * \param[in] size The size of the buffer in bytes.
+ *
+ * \return The number of leading bytes not greater than 0x7F.
+ */
+size_t
+cardano_json_scan_ascii(const char* data, size_t size);
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_JSON_SCANNER_H
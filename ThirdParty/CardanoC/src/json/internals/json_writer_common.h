@@ -48,7 +48,6 @@ static const byte_t* FALSE        = (const byte_t*)"false"; // cppcheck-suppress
 static const byte_t* NULL_VALUE   = (const byte_t*)"null";  // cppcheck-suppress misra-c2012-8.9
 static const byte_t* NEW_LINE     = (const byte_t*)"\n";    // cppcheck-suppress misra-c2012-8.9
 static const byte_t* SPACE        = (const byte_t*)" ";     // cppcheck-suppress misra-c2012-8.9
-static const byte_t* ESCAPE       = (const byte_t*)"\\";    // cppcheck-suppress misra-c2012-8.9
 
 /* STRUCTURES ****************************************************************/
 
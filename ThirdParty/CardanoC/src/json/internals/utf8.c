@@ -55,6 +55,32 @@ cardano_utf8_sequence_length(const byte_t first_byte)
   }
 }
 
+size_t
+cardano_utf8_validate_sequence(const char* data, const size_t size)
+{
+  if (size == 0U)
+  {
+    return 0U;
+  }
+
+  const size_t seq_len = cardano_utf8_sequence_length((byte_t)data[0]);
+
+  if ((seq_len == 0U) || (seq_len > size))
+  {
+    return 0U;
+  }
+
+  for (size_t i = 1U; i < seq_len; ++i)
+  {
+    if (((byte_t)data[i] & 0xC0U) != 0x80U)
+    {
+      return 0U;
+    }
+  }
+
+  return seq_len;
+}
+
 int32_t
 cardano_parse_hex_digit(const char c)
 {
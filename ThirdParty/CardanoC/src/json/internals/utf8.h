@@ -47,6 +47,20 @@
 size_t
 cardano_utf8_sequence_length(byte_t first_byte);
 
+/**
+ * \brief Validates the UTF-8 sequence at the start of a buffer.
+ *
+ * Checks that the first byte starts a sequence and that the sequence fits in the buffer with a continuation byte in
+ * every following position.
+ *
+ * \param[in] data The buffer holding the sequence. Must not be NULL if \p size is not zero.
+ * \param[in] size The number of bytes available in the buffer.
+ *
+ * \return The length of the sequence, or `0` if the buffer is empty or does not start with a valid sequence.
+ */
+size_t
+cardano_utf8_validate_sequence(const char* data, size_t size);
+
 /**
  * \brief Parses a single hexadecimal character and returns its integer value.
  *
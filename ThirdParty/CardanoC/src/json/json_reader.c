@@ -0,0 +1,860 @@
+/**
+ * \file json_reader.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/buffer.h>
+#include <cardano/json/json_reader.h>
+#include <cardano/object.h>
+
+#include "../allocators.h"
+#include "../config.h"
+#include "../string_safe.h"
+#include "internals/json_parser.h"
+#include "internals/json_scanner.h"
+#include "internals/utf8.h"
+
+#include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const size_t MAX_NUMBER_LENGTH = 64U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief What the reader accepts as the next token.
+ */
+typedef enum
+{
+  JSON_READER_EXPECT_VALUE,
+  JSON_READER_EXPECT_FIRST_KEY_OR_END,
+  JSON_READER_EXPECT_KEY,
+  JSON_READER_EXPECT_FIRST_VALUE_OR_END,
+  JSON_READER_EXPECT_SEPARATOR_OR_END,
+  JSON_READER_EXPECT_END_OF_DOCUMENT
+} json_reader_expect_t;
+
+/**
+ * \brief Represents a forward-only JSON reader.
+ */
+typedef struct cardano_json_reader_t
+{
+    cardano_object_t             base;
+    cardano_json_parse_context_t ctx;
+    cardano_buffer_t*            scratch;
+    cardano_error_t              error;
+    json_reader_expect_t         expect;
+    cardano_json_token_type_t    token;
+    const char*                  text;
+    size_t                       text_size;
+    bool                         bool_value;
+    size_t                       depth;
+    char                         containers[LIB_CARDANO_C_MAX_JSON_DEPTH];
+} cardano_json_reader_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates a JSON reader object.
+ *
+ * \param object A void pointer to the JSON reader object to be deallocated.
+ */
+static void
+cardano_json_reader_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_json_reader_t* reader = (cardano_json_reader_t*)object;
+
+  cardano_buffer_unref(&reader->scratch);
+
+  _cardano_free(reader);
+}
+
+/**
+ * \brief Puts the reader in its error state.
+ *
+ * \param[in,out] reader The reader.
+ * \param[in] error The error every later read returns.
+ * \param[in] message The error message.
+ *
+ * \return \p error.
+ */
+static cardano_error_t
+fail(cardano_json_reader_t* reader, const cardano_error_t error, const char* message)
+{
+  reader->error     = error;
+  reader->token     = CARDANO_JSON_TOKEN_TYPE_NONE;
+  reader->text      = NULL;
+  reader->text_size = 0U;
+
+  cardano_object_set_last_error(&reader->base, message);
+
+  return error;
+}
+
+/**
+ * \brief Updates the expected token after a complete value was read.
+ *
+ * \param[in,out] reader The reader.
+ */
+static void
+end_value(cardano_json_reader_t* reader)
+{
+  reader->expect = (reader->depth == 0U) ? JSON_READER_EXPECT_END_OF_DOCUMENT : JSON_READER_EXPECT_SEPARATOR_OR_END;
+}
+
+/**
+ * \brief Reads the opening brace or bracket of a container.
+ *
+ * \param[in,out] reader The reader, positioned at the opening character.
+ * \param[in] open The opening character.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_INVALID_JSON if the nesting is too deep.
+ */
+static cardano_error_t
+read_start(cardano_json_reader_t* reader, const char open)
+{
+  if (reader->depth >= (size_t)LIB_CARDANO_C_MAX_JSON_DEPTH)
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Maximum JSON depth exceeded");
+  }
+
+  reader->containers[reader->depth] = open;
+  ++reader->depth;
+  ++reader->ctx.offset;
+
+  if (open == '{')
+  {
+    reader->token  = CARDANO_JSON_TOKEN_TYPE_START_OBJECT;
+    reader->expect = JSON_READER_EXPECT_FIRST_KEY_OR_END;
+  }
+  else
+  {
+    reader->token  = CARDANO_JSON_TOKEN_TYPE_START_ARRAY;
+    reader->expect = JSON_READER_EXPECT_FIRST_VALUE_OR_END;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Reads the closing brace or bracket of the innermost container.
+ *
+ * \param[in,out] reader The reader, positioned at the closing character.
+ * \param[in] close The closing character.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_INVALID_JSON if it does not match the container.
+ */
+static cardano_error_t
+read_end(cardano_json_reader_t* reader, const char close)
+{
+  const char open = (close == '}') ? '{' : '[';
+
+  if ((reader->depth == 0U) || (reader->containers[reader->depth - 1U] != open))
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Mismatched closing character");
+  }
+
+  --reader->depth;
+  ++reader->ctx.offset;
+
+  reader->token = (close == '}') ? CARDANO_JSON_TOKEN_TYPE_END_OBJECT : CARDANO_JSON_TOKEN_TYPE_END_ARRAY;
+  end_value(reader);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Decodes a string containing escape sequences into the scratch buffer.
+ *
+ * \param[in,out] reader The reader, positioned at the first backslash of the string.
+ * \param[in] start The offset of the first character of the string.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the string is malformed.
+ */
+static cardano_error_t
+read_escaped_string(cardano_json_reader_t* reader, const size_t start)
+{
+  cardano_json_parse_context_t* ctx = &reader->ctx;
+
+  if (reader->scratch == NULL)
+  {
+    reader->scratch = cardano_buffer_new(128);
+
+    if (reader->scratch == NULL)
+    {
+      return fail(reader, CARDANO_ERROR_MEMORY_ALLOCATION_FAILED, "Memory allocation failed");
+    }
+  }
+
+  cardano_error_t result = cardano_buffer_set_size(reader->scratch, 0U);
+
+  if ((result == CARDANO_SUCCESS) && (ctx->offset > start))
+  {
+    result = cardano_buffer_write(reader->scratch, (const byte_t*)&ctx->input[start], ctx->offset - start);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return fail(reader, result, cardano_error_to_string(result));
+  }
+
+  while (ctx->offset < ctx->length)
+  {
+    const size_t run = cardano_json_scan_string_run(&ctx->input[ctx->offset], ctx->length - ctx->offset);
+
+    if (run > 0U)
+    {
+      result = cardano_buffer_write(reader->scratch, (const byte_t*)&ctx->input[ctx->offset], run);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        return fail(reader, result, cardano_error_to_string(result));
+      }
+
+      ctx->offset += run;
+
+      continue;
+    }
+
+    const char c = ctx->input[ctx->offset];
+
+    if (c == '\"')
+    {
+      ++ctx->offset;
+
+      reader->text      = (const char*)cardano_buffer_get_data(reader->scratch);
+      reader->text_size = cardano_buffer_get_size(reader->scratch);
+
+      return CARDANO_SUCCESS;
+    }
+
+    bool is_valid = false;
+
+    if (c == '\\')
+    {
+      ++ctx->offset;
+      is_valid = cardano_handle_escape_sequence(ctx, reader->scratch);
+    }
+    else
+    {
+      is_valid = cardano_handle_utf8_sequence(ctx, reader->scratch);
+    }
+
+    if (!is_valid)
+    {
+      return fail(reader, CARDANO_ERROR_INVALID_JSON, ctx->last_error);
+    }
+  }
+
+  return fail(reader, CARDANO_ERROR_INVALID_JSON, "Unterminated JSON string");
+}
+
+/**
+ * \brief Reads a string, handing it out as a view into the input unless it contains escape sequences.
+ *
+ * \param[in,out] reader The reader, positioned at the opening quote.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the string is malformed.
+ */
+static cardano_error_t
+read_string(cardano_json_reader_t* reader)
+{
+  cardano_json_parse_context_t* ctx = &reader->ctx;
+
+  ++ctx->offset;
+
+  const size_t start = ctx->offset;
+
+  while (ctx->offset < ctx->length)
+  {
+    ctx->offset += cardano_json_scan_string_run(&ctx->input[ctx->offset], ctx->length - ctx->offset);
+
+    if (ctx->offset >= ctx->length)
+    {
+      break;
+    }
+
+    const char c = ctx->input[ctx->offset];
+
+    if (c == '\"')
+    {
+      reader->text      = &ctx->input[start];
+      reader->text_size = ctx->offset - start;
+
+      ++ctx->offset;
+
+      return CARDANO_SUCCESS;
+    }
+
+    if (c == '\\')
+    {
+      return read_escaped_string(reader, start);
+    }
+
+    const size_t seq_len = cardano_utf8_validate_sequence(&ctx->input[ctx->offset], ctx->length - ctx->offset);
+
+    if (seq_len == 0U)
+    {
+      return fail(reader, CARDANO_ERROR_INVALID_JSON, "Invalid UTF-8 sequence");
+    }
+
+    ctx->offset += seq_len;
+  }
+
+  return fail(reader, CARDANO_ERROR_INVALID_JSON, "Unterminated JSON string");
+}
+
+/**
+ * \brief Reads a number, handing it out as a view into the input.
+ *
+ * \param[in,out] reader The reader, positioned at the first character of the number.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_INVALID_JSON if the number is malformed.
+ */
+static cardano_error_t
+read_number(cardano_json_reader_t* reader)
+{
+  cardano_json_parse_context_t* ctx   = &reader->ctx;
+  const size_t                  start = ctx->offset;
+
+  while (ctx->offset < ctx->length)
+  {
+    const char c = ctx->input[ctx->offset];
+
+    if (!isdigit((unsigned char)c) && (c != '.') && (c != 'e') && (c != 'E') && (c != '-') && (c != '+'))
+    {
+      break;
+    }
+
+    ++ctx->offset;
+  }
+
+  const size_t size = ctx->offset - start;
+
+  if (size > MAX_NUMBER_LENGTH)
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Invalid JSON number");
+  }
+
+  char temp[65] = { 0 };
+  cardano_safe_memcpy(temp, sizeof(temp), &ctx->input[start], size);
+  temp[size] = '\0';
+
+  char* end = NULL;
+  errno     = 0;
+
+  (void)strtod(temp, &end);
+
+  if ((errno != 0) || (end != &temp[size]))
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Invalid JSON number");
+  }
+
+  reader->text      = &ctx->input[start];
+  reader->text_size = size;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Reads the `true`, `false` or `null` literal.
+ *
+ * \param[in,out] reader The reader, positioned at the first character of the literal.
+ * \param[in] literal The expected literal.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_INVALID_JSON if the input does not hold \p literal.
+ */
+static cardano_error_t
+read_literal(cardano_json_reader_t* reader, const char* literal)
+{
+  cardano_json_parse_context_t* ctx  = &reader->ctx;
+  const size_t                  size = strlen(literal);
+
+  if (((ctx->length - ctx->offset) < size) || (memcmp(&ctx->input[ctx->offset], literal, size) != 0))
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Invalid JSON literal");
+  }
+
+  ctx->offset += size;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Reads any value.
+ *
+ * \param[in,out] reader The reader, positioned at the first character of the value.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the value is malformed.
+ */
+static cardano_error_t
+read_value(cardano_json_reader_t* reader)
+{
+  cardano_json_parse_context_t* ctx = &reader->ctx;
+
+  if (ctx->offset >= ctx->length)
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Unexpected end of JSON input");
+  }
+
+  const char      c      = ctx->input[ctx->offset];
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  switch (c)
+  {
+    case '{':
+    case '[':
+      return read_start(reader, c);
+    case '\"':
+      reader->token = CARDANO_JSON_TOKEN_TYPE_STRING;
+      result        = read_string(reader);
+      break;
+    case 't':
+      reader->token      = CARDANO_JSON_TOKEN_TYPE_BOOLEAN;
+      reader->bool_value = true;
+      result             = read_literal(reader, "true");
+      break;
+    case 'f':
+      reader->token      = CARDANO_JSON_TOKEN_TYPE_BOOLEAN;
+      reader->bool_value = false;
+      result             = read_literal(reader, "false");
+      break;
+    case 'n':
+      reader->token = CARDANO_JSON_TOKEN_TYPE_NULL;
+      result        = read_literal(reader, "null");
+      break;
+    default:
+      if ((c != '-') && !isdigit((unsigned char)c))
+      {
+        return fail(reader, CARDANO_ERROR_INVALID_JSON, "Unexpected character in JSON input");
+      }
+
+      reader->token = CARDANO_JSON_TOKEN_TYPE_NUMBER;
+      result        = read_number(reader);
+      break;
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    end_value(reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Reads a property name and the colon that follows it.
+ *
+ * \param[in,out] reader The reader, positioned at the opening quote of the name.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the property name is malformed.
+ */
+static cardano_error_t
+read_property_name(cardano_json_reader_t* reader)
+{
+  cardano_json_parse_context_t* ctx = &reader->ctx;
+
+  if ((ctx->offset >= ctx->length) || (ctx->input[ctx->offset] != '\"'))
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Expected a JSON property name");
+  }
+
+  reader->token = CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME;
+
+  cardano_error_t result = read_string(reader);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_skip_whitespace(ctx);
+
+  if ((ctx->offset >= ctx->length) || (ctx->input[ctx->offset] != ':'))
+  {
+    return fail(reader, CARDANO_ERROR_INVALID_JSON, "Expected ':' after JSON property name");
+  }
+
+  ++ctx->offset;
+  reader->expect = JSON_READER_EXPECT_VALUE;
+
+  return CARDANO_SUCCESS;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_json_reader_t*
+cardano_json_reader_new(const char* json, const size_t size)
+{
+  if ((json == NULL) || (size == 0U))
+  {
+    return NULL;
+  }
+
+  cardano_json_reader_t* reader = (cardano_json_reader_t*)_cardano_malloc(sizeof(cardano_json_reader_t));
+
+  if (reader == NULL)
+  {
+    return NULL;
+  }
+
+  reader->base.ref_count     = 1;
+  reader->base.deallocator   = cardano_json_reader_deallocate;
+  reader->base.last_error    = NULL;
+  reader->ctx.input          = json;
+  reader->ctx.length         = size;
+  reader->ctx.offset         = 0U;
+  reader->ctx.depth          = 0U;
+  reader->ctx.last_error[0]  = '\0';
+  reader->scratch            = NULL;
+  reader->error              = CARDANO_SUCCESS;
+  reader->expect             = JSON_READER_EXPECT_VALUE;
+  reader->token              = CARDANO_JSON_TOKEN_TYPE_NONE;
+  reader->text               = NULL;
+  reader->text_size          = 0U;
+  reader->bool_value         = false;
+  reader->depth              = 0U;
+
+  return reader;
+}
+
+cardano_error_t
+cardano_json_reader_read(cardano_json_reader_t* reader, cardano_json_token_type_t* token)
+{
+  if ((reader == NULL) || (token == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *token = CARDANO_JSON_TOKEN_TYPE_NONE;
+
+  if (reader->error != CARDANO_SUCCESS)
+  {
+    return reader->error;
+  }
+
+  cardano_json_parse_context_t* ctx = &reader->ctx;
+
+  reader->text      = NULL;
+  reader->text_size = 0U;
+
+  cardano_skip_whitespace(ctx);
+
+  const char      c      = (ctx->offset < ctx->length) ? ctx->input[ctx->offset] : '\0';
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  switch (reader->expect)
+  {
+    case JSON_READER_EXPECT_END_OF_DOCUMENT:
+    {
+      if (ctx->offset < ctx->length)
+      {
+        return fail(reader, CARDANO_ERROR_INVALID_JSON, "Unexpected characters after JSON value");
+      }
+
+      reader->token = CARDANO_JSON_TOKEN_TYPE_END_OF_DOCUMENT;
+      break;
+    }
+    case JSON_READER_EXPECT_FIRST_KEY_OR_END:
+    {
+      result = (c == '}') ? read_end(reader, c) : read_property_name(reader);
+      break;
+    }
+    case JSON_READER_EXPECT_KEY:
+    {
+      result = read_property_name(reader);
+      break;
+    }
+    case JSON_READER_EXPECT_FIRST_VALUE_OR_END:
+    {
+      result = (c == ']') ? read_end(reader, c) : read_value(reader);
+      break;
+    }
+    case JSON_READER_EXPECT_SEPARATOR_OR_END:
+    {
+      if ((c == '}') || (c == ']'))
+      {
+        result = read_end(reader, c);
+      }
+      else if (c == ',')
+      {
+        ++ctx->offset;
+        cardano_skip_whitespace(ctx);
+
+        result = (reader->containers[reader->depth - 1U] == '{') ? read_property_name(reader) : read_value(reader);
+      }
+      else
+      {
+        result = fail(reader, CARDANO_ERROR_INVALID_JSON, "Expected ',' or a closing character");
+      }
+
+      break;
+    }
+    case JSON_READER_EXPECT_VALUE:
+    default:
+    {
+      result = read_value(reader);
+      break;
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    *token = reader->token;
+  }
+
+  return result;
+}
+
+cardano_error_t
+cardano_json_reader_skip(cardano_json_reader_t* reader)
+{
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_json_token_type_t token  = reader->token;
+  cardano_error_t           result = CARDANO_SUCCESS;
+
+  if (token == CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME)
+  {
+    result = cardano_json_reader_read(reader, &token);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  if ((token != CARDANO_JSON_TOKEN_TYPE_START_OBJECT) && (token != CARDANO_JSON_TOKEN_TYPE_START_ARRAY))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  const size_t target = reader->depth - 1U;
+
+  while (reader->depth > target)
+  {
+    result = cardano_json_reader_read(reader, &token);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_json_token_type_t
+cardano_json_reader_get_token_type(const cardano_json_reader_t* reader)
+{
+  if (reader == NULL)
+  {
+    return CARDANO_JSON_TOKEN_TYPE_NONE;
+  }
+
+  return reader->token;
+}
+
+const char*
+cardano_json_reader_get_string(const cardano_json_reader_t* reader, size_t* size)
+{
+  if (size != NULL)
+  {
+    *size = 0U;
+  }
+
+  if ((reader == NULL) || (reader->text == NULL))
+  {
+    return NULL;
+  }
+
+  if (size != NULL)
+  {
+    *size = reader->text_size;
+  }
+
+  return reader->text;
+}
+
+bool
+cardano_json_reader_property_equals(const cardano_json_reader_t* reader, const char* name, const size_t name_size)
+{
+  if ((reader == NULL) || (name == NULL) || (reader->token != CARDANO_JSON_TOKEN_TYPE_PROPERTY_NAME))
+  {
+    return false;
+  }
+
+  return (reader->text_size == name_size) && ((name_size == 0U) || (memcmp(reader->text, name, name_size) == 0));
+}
+
+cardano_error_t
+cardano_json_reader_get_uint(const cardano_json_reader_t* reader, uint64_t* value)
+{
+  if ((reader == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((reader->token != CARDANO_JSON_TOKEN_TYPE_NUMBER) && (reader->token != CARDANO_JSON_TOKEN_TYPE_STRING))
+  {
+    return CARDANO_ERROR_JSON_TYPE_MISMATCH;
+  }
+
+  if ((reader->text_size == 0U) || !isdigit((unsigned char)reader->text[0]))
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  return cardano_safe_string_to_uint64(reader->text, reader->text_size, value);
+}
+
+cardano_error_t
+cardano_json_reader_get_signed_int(const cardano_json_reader_t* reader, int64_t* value)
+{
+  if ((reader == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((reader->token != CARDANO_JSON_TOKEN_TYPE_NUMBER) && (reader->token != CARDANO_JSON_TOKEN_TYPE_STRING))
+  {
+    return CARDANO_ERROR_JSON_TYPE_MISMATCH;
+  }
+
+  if (reader->text_size == 0U)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  return cardano_safe_string_to_int64(reader->text, reader->text_size, value);
+}
+
+cardano_error_t
+cardano_json_reader_get_double(const cardano_json_reader_t* reader, double* value)
+{
+  if ((reader == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((reader->token != CARDANO_JSON_TOKEN_TYPE_NUMBER) && (reader->token != CARDANO_JSON_TOKEN_TYPE_STRING))
+  {
+    return CARDANO_ERROR_JSON_TYPE_MISMATCH;
+  }
+
+  if (reader->text_size == 0U)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  return cardano_safe_string_to_double(reader->text, reader->text_size, value);
+}
+
+cardano_error_t
+cardano_json_reader_get_boolean(const cardano_json_reader_t* reader, bool* value)
+{
+  if ((reader == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (reader->token != CARDANO_JSON_TOKEN_TYPE_BOOLEAN)
+  {
+    return CARDANO_ERROR_JSON_TYPE_MISMATCH;
+  }
+
+  *value = reader->bool_value;
+
+  return CARDANO_SUCCESS;
+}
+
+size_t
+cardano_json_reader_get_depth(const cardano_json_reader_t* reader)
+{
+  if (reader == NULL)
+  {
+    return 0U;
+  }
+
+  return reader->depth;
+}
+
+void
+cardano_json_reader_unref(cardano_json_reader_t** reader)
+{
+  if ((reader == NULL) || (*reader == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*reader)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *reader = NULL;
+    return;
+  }
+}
+
+void
+cardano_json_reader_ref(cardano_json_reader_t* reader)
+{
+  if (reader == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&reader->base);
+}
+
+size_t
+cardano_json_reader_refcount(const cardano_json_reader_t* reader)
+{
+  if (reader == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&reader->base);
+}
+
+void
+cardano_json_reader_set_last_error(cardano_json_reader_t* reader, const char* message)
+{
+  cardano_object_set_last_error(&reader->base, message);
+}
+
+const char*
+cardano_json_reader_get_last_error(const cardano_json_reader_t* reader)
+{
+  return cardano_object_get_last_error(&reader->base);
+}
@@ -187,6 +187,69 @@ escape(const int32_t ch)
   return '\0';
 }
 
+/**
+ * \brief Writes string content, escaping the characters JSON requires.
+ *
+ * Runs of characters that need no escaping are copied with a single buffer write.
+ *
+ * \param[in] writer The JSON writer instance.
+ * \param[in] value The characters to write.
+ * \param[in] value_size The number of characters in \p value.
+ *
+ * \return CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+write_escaped(cardano_json_writer_t* writer, const char* value, const size_t value_size)
+{
+  size_t run_start = 0U;
+
+  for (size_t i = 0U; i < value_size; ++i)
+  {
+    const byte_t c = (byte_t)value[i];
+
+    // Every escaped character is a quote, a backslash or a control character
+    if ((c >= 0x20U) && (c != (byte_t)'\"') && (c != (byte_t)'\\'))
+    {
+      continue;
+    }
+
+    const int32_t esc = escape(value[i]);
+
+    if (esc == 0)
+    {
+      continue;
+    }
+
+    cardano_error_t result = CARDANO_SUCCESS;
+
+    if (i > run_start)
+    {
+      result = cardano_buffer_write(writer->buffer, (const byte_t*)&value[run_start], i - run_start);
+    }
+
+    const byte_t pair[2] = { (byte_t)'\\', (byte_t)esc };
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_buffer_write(writer->buffer, pair, sizeof(pair));
+    }
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    run_start = i + 1U;
+  }
+
+  if (value_size > run_start)
+  {
+    return cardano_buffer_write(writer->buffer, (const byte_t*)&value[run_start], value_size - run_start);
+  }
+
+  return CARDANO_SUCCESS;
+}
+
 /* DECLARATIONS **************************************************************/
 
 cardano_json_writer_t*
@@ -201,7 +264,7 @@ cardano_json_writer_new(const cardano_json_format_t format)
 
   obj->base.ref_count     = 1;
   obj->base.deallocator   = cardano_json_writer_deallocate;
-  obj->base.last_error[0] = '\0';
+  obj->base.last_error    = NULL;
   obj->buffer             = cardano_buffer_new(128);
   obj->last_error         = CARDANO_SUCCESS;
   obj->depth              = 0;
@@ -266,24 +329,8 @@ cardano_json_writer_write_property_name(
   result = cardano_buffer_write(writer->buffer, QUOTES, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes before property name.");
 
-  for (size_t i = 0; i < name_size; ++i)
-  {
-    int32_t esc = escape(name[i]);
-
-    if (esc != 0)
-    {
-      result = cardano_buffer_write(writer->buffer, ESCAPE, 1);
-      cardano_json_writer_set_message_if_error(writer, result, "Failed to write escape character before string value.");
-
-      result = cardano_buffer_write(writer->buffer, (const byte_t*)&esc, 1);
-      cardano_json_writer_set_message_if_error(writer, result, "Failed to write escape character value.");
-    }
-    else
-    {
-      result = cardano_buffer_write(writer->buffer, (const byte_t*)&name[i], 1);
-      cardano_json_writer_set_message_if_error(writer, result, "Failed to write string value.");
-    }
-  }
+  result = write_escaped(writer, name, name_size);
+  cardano_json_writer_set_message_if_error(writer, result, "Failed to write property name.");
 
   result = cardano_buffer_write(writer->buffer, QUOTES, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes after property name.");
@@ -937,32 +984,156 @@ cardano_json_writer_write_string(
   cardano_error_t result = cardano_buffer_write(writer->buffer, QUOTES, 1);
   cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes before string value.");
 
-  for (size_t i = 0; i < value_size; ++i)
+  result = write_escaped(writer, value, value_size);
+  cardano_json_writer_set_message_if_error(writer, result, "Failed to write string value.");
+
+  result = cardano_buffer_write(writer->buffer, QUOTES, 1);
+  cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes after string value.");
+
+  current_context->item_count++;
+  current_context->expect_value = current_context->context == CARDANO_JSON_CONTEXT_ARRAY;
+}
+
+void
+cardano_json_writer_write_hex(
+  cardano_json_writer_t* writer,
+  const byte_t*          data,
+  const size_t           data_size)
+{
+  static const char hex_digits[] = "0123456789abcdef";
+
+  if ((writer == NULL) || (writer->last_error != CARDANO_SUCCESS))
   {
-    int32_t esc = escape(value[i]);
+    return;
+  }
 
-    if (esc != 0)
-    {
-      result = cardano_buffer_write(writer->buffer, ESCAPE, 1);
-      cardano_json_writer_set_message_if_error(writer, result, "Failed to write escape character before string value.");
+  if ((data == NULL) && (data_size > 0U))
+  {
+    writer->last_error = CARDANO_ERROR_POINTER_IS_NULL;
+    cardano_object_set_last_error(&writer->base, "Hex data cannot be NULL.");
+    return;
+  }
 
-      result = cardano_buffer_write(writer->buffer, (const byte_t*)&esc, 1);
-      cardano_json_writer_set_message_if_error(writer, result, "Failed to write escape character value.");
-    }
-    else
+  cardano_json_stack_frame_t* current_context = &writer->current_frame[writer->depth];
+
+  const bool is_root       = (current_context->context == CARDANO_JSON_CONTEXT_ROOT);
+  const bool is_root_first = (is_root && (current_context->item_count == 0U));
+  const bool can_write     = (is_root_first || current_context->expect_value);
+
+  if (!can_write)
+  {
+    writer->last_error = CARDANO_ERROR_ENCODING;
+    cardano_object_set_last_error(&writer->base, "Unexpected hex value.");
+    return;
+  }
+
+  if ((current_context->item_count > 0U) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
+  {
+    cardano_error_t result = cardano_buffer_write(writer->buffer, COMMA, 1);
+    cardano_json_writer_set_message_if_error(writer, result, "Failed to write comma before hex value.");
+  }
+
+  if ((writer->format == CARDANO_JSON_FORMAT_PRETTY) && (current_context->context == CARDANO_JSON_CONTEXT_ARRAY))
+  {
+    cardano_error_t result = cardano_buffer_write(writer->buffer, NEW_LINE, 1);
+    cardano_json_writer_set_message_if_error(writer, result, "Failed to write new line before hex value.");
+
+    result = write_indentation(writer);
+    cardano_json_writer_set_message_if_error(writer, result, "Failed to write indentation before hex value.");
+  }
+
+  cardano_error_t result = cardano_buffer_write(writer->buffer, QUOTES, 1);
+  cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes before hex value.");
+
+  // Encoded through a stack block, so a 32-byte hash takes a single buffer write
+  char   block[128] = { 0 };
+  size_t used       = 0U;
+
+  for (size_t i = 0U; (i < data_size) && (result == CARDANO_SUCCESS); ++i)
+  {
+    block[used]      = hex_digits[(data[i] >> 4U) & 0x0FU];
+    block[used + 1U] = hex_digits[data[i] & 0x0FU];
+    used += 2U;
+
+    if ((used == sizeof(block)) || ((i + 1U) == data_size))
     {
-      result = cardano_buffer_write(writer->buffer, (const byte_t*)&value[i], 1);
-      cardano_json_writer_set_message_if_error(writer, result, "Failed to write string value.");
+      result = cardano_buffer_write(writer->buffer, (const byte_t*)block, used);
+      used   = 0U;
     }
   }
 
+  cardano_json_writer_set_message_if_error(writer, result, "Failed to write hex value.");
+
   result = cardano_buffer_write(writer->buffer, QUOTES, 1);
-  cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes after string value.");
+  cardano_json_writer_set_message_if_error(writer, result, "Failed to write quotes after hex value.");
 
   current_context->item_count++;
   current_context->expect_value = current_context->context == CARDANO_JSON_CONTEXT_ARRAY;
 }
 
+cardano_error_t
+cardano_json_writer_reserve(cardano_json_writer_t* writer, const size_t size)
+{
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  // The buffer grows once its size would reach its capacity, so one extra byte keeps exactly `size` bytes in place
+  if (size < cardano_buffer_get_capacity(writer->buffer))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_buffer_t* buffer = cardano_buffer_new(size + 1U);
+
+  if (buffer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  const size_t written = cardano_buffer_get_size(writer->buffer);
+
+  if (written > 0U)
+  {
+    cardano_error_t result = cardano_buffer_write(buffer, cardano_buffer_get_data(writer->buffer), written);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_buffer_unref(&buffer);
+      return result;
+    }
+  }
+
+  cardano_buffer_unref(&writer->buffer);
+  writer->buffer = buffer;
+
+  return CARDANO_SUCCESS;
+}
+
+size_t
+cardano_json_writer_get_string_size(const char* value, const size_t value_size)
+{
+  size_t size = value_size + 2U;
+
+  if (value == NULL)
+  {
+    return size;
+  }
+
+  for (size_t i = 0U; i < value_size; ++i)
+  {
+    const byte_t c = (byte_t)value[i];
+
+    if (((c < 0x20U) || (c == (byte_t)'\"') || (c == (byte_t)'\\')) && (escape(value[i]) != 0))
+    {
+      ++size;
+    }
+  }
+
+  return size;
+}
+
 cardano_json_context_t
 cardano_json_writer_get_context(cardano_json_writer_t* writer)
 {
@@ -1064,9 +1235,15 @@ cardano_json_writer_reset(cardano_json_writer_t* writer)
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_buffer_unref(&writer->buffer);
+  // The buffer is kept, so a writer reused across documents stops reallocating once it has grown to fit them
+  cardano_error_t result = cardano_buffer_set_size(writer->buffer, 0U);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
 
-  writer->buffer                        = cardano_buffer_new(128);
+  writer->base.last_error               = NULL;
   writer->depth                         = 0U;
   writer->last_error                    = CARDANO_SUCCESS;
   writer->current_frame[0].context      = CARDANO_JSON_CONTEXT_ROOT;
@@ -0,0 +1,335 @@
+/**
+ * \file memory_secure_key_handler.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/crypto/ed25519_private_key.h>
+#include <cardano/crypto/ed25519_public_key.h>
+#include <cardano/crypto/ed25519_signing_context.h>
+#include <cardano/key_handlers/memory_secure_key_handler.h>
+#include <cardano/key_handlers/secure_key_handler.h>
+#include <cardano/key_handlers/secure_key_handler_impl.h>
+#include <cardano/key_handlers/secure_key_handler_type.h>
+#include <cardano/object.h>
+
+#include "../allocators.h"
+#include "../string_safe.h"
+
+#include <assert.h>
+#include <string.h>
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Context structure for the Memory Secure Key Handler.
+ *
+ * The key is held only as a precomputed signing context, whose scalar and nonce prefix live in `sodium_malloc`
+ * guarded memory for the whole lifetime of the handler. There is no encrypted copy to decrypt.
+ */
+typedef struct memory_secure_key_handler_context_t
+{
+    cardano_object_t                   base;
+    cardano_ed25519_signing_context_t* signing_context;
+} memory_secure_key_handler_context_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates the handler context, wiping the key material.
+ *
+ * \param object A void pointer to the context to be deallocated.
+ */
+static void
+memory_secure_key_handler_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  memory_secure_key_handler_context_t* context = (memory_secure_key_handler_context_t*)object;
+
+  cardano_ed25519_signing_context_unref(&context->signing_context);
+
+  _cardano_free(object);
+}
+
+/**
+ * \brief Retrieves the signing context of the handler.
+ *
+ * \param secure_key_handler_impl A pointer to the secure key handler implementation.
+ *
+ * \return The signing context (not referenced), or `NULL` if the implementation has no context.
+ */
+static cardano_ed25519_signing_context_t*
+get_signing_context(const cardano_secure_key_handler_impl_t* secure_key_handler_impl)
+{
+  const memory_secure_key_handler_context_t* context = (const memory_secure_key_handler_context_t*)((const void*)secure_key_handler_impl->context);
+
+  if (context == NULL)
+  {
+    return NULL;
+  }
+
+  return context->signing_context;
+}
+
+/**
+ * \brief Retrieves the Ed25519 public key of the handler.
+ *
+ * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[out] public_key On success, the public key. The caller must release it.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+static cardano_error_t
+ed25519_get_public_key(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  cardano_ed25519_public_key_t**     public_key)
+{
+  if ((secure_key_handler_impl == NULL) || (public_key == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_ed25519_signing_context_t* signing_context = get_signing_context(secure_key_handler_impl);
+
+  if (signing_context == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return cardano_ed25519_signing_context_get_public_key(signing_context, public_key);
+}
+
+/**
+ * \brief Signs a transaction with the Ed25519 key of the handler.
+ *
+ * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[in]  tx The transaction object to be signed.
+ * \param[out] vkey_witness_set On success, a witness set holding the single witness. The caller must release it.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+static cardano_error_t
+ed25519_sign_transaction(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  cardano_transaction_t*             tx,
+  cardano_vkey_witness_set_t**       vkey_witness_set)
+{
+  if ((secure_key_handler_impl == NULL) || (tx == NULL) || (vkey_witness_set == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_ed25519_signing_context_t* signing_context = get_signing_context(secure_key_handler_impl);
+
+  if (signing_context == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_ed25519_public_key_t* public_key = NULL;
+  cardano_ed25519_signature_t*  signature  = NULL;
+  cardano_vkey_witness_t*       witness    = NULL;
+
+  cardano_blake2b_hash_t* hash = cardano_transaction_get_id(tx);
+
+  if (hash == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = cardano_ed25519_signing_context_sign(signing_context, cardano_blake2b_hash_get_data(hash), cardano_blake2b_hash_get_bytes_size(hash), &signature);
+  cardano_blake2b_hash_unref(&hash);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_ed25519_signing_context_get_public_key(signing_context, &public_key);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_vkey_witness_new(public_key, signature, &witness);
+  }
+
+  cardano_ed25519_public_key_unref(&public_key);
+  cardano_ed25519_signature_unref(&signature);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_vkey_witness_set_new(vkey_witness_set);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_vkey_witness_set_add(*vkey_witness_set, witness);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_vkey_witness_set_unref(vkey_witness_set);
+    }
+  }
+
+  cardano_vkey_witness_unref(&witness);
+
+  return result;
+}
+
+/**
+ * \brief Retrieves the precomputed signing key of the handler.
+ *
+ * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[out] signing_context On success, a new reference to the signing key. The caller must release it.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+static cardano_error_t
+ed25519_get_signing_context(
+  cardano_secure_key_handler_impl_t*  secure_key_handler_impl,
+  cardano_ed25519_signing_context_t** signing_context)
+{
+  if ((secure_key_handler_impl == NULL) || (signing_context == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *signing_context = get_signing_context(secure_key_handler_impl);
+
+  if (*signing_context == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_ed25519_signing_context_ref(*signing_context);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Opens an unlocked session. The key is always resident, so there is nothing to do.
+ *
+ * \param[in] secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[in] ttl_seconds Unused.
+ * \param[in] max_operations Unused.
+ *
+ * \returns \ref CARDANO_SUCCESS, or \ref CARDANO_ERROR_POINTER_IS_NULL if `secure_key_handler_impl` is NULL.
+ */
+static cardano_error_t
+unlock(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  const uint64_t                     ttl_seconds,
+  const uint64_t                     max_operations)
+{
+  CARDANO_UNUSED(ttl_seconds);
+  CARDANO_UNUSED(max_operations);
+
+  if (secure_key_handler_impl == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Closes an unlocked session. The key stays resident until the handler is released.
+ *
+ * \param[in] secure_key_handler_impl A pointer to the secure key handler implementation.
+ *
+ * \returns \ref CARDANO_SUCCESS, or \ref CARDANO_ERROR_POINTER_IS_NULL if `secure_key_handler_impl` is NULL.
+ */
+static cardano_error_t
+lock(cardano_secure_key_handler_impl_t* secure_key_handler_impl)
+{
+  if (secure_key_handler_impl == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_memory_secure_key_handler_ed25519_new(
+  const cardano_ed25519_private_key_t* ed25519_private_key,
+  cardano_secure_key_handler_t**       secure_key_handler)
+{
+  static const char*                handler_name = "Ed25519 Memory Secure Key Handler";
+  cardano_secure_key_handler_impl_t impl         = { 0 };
+
+  cardano_safe_memcpy(impl.name, 256U, handler_name, cardano_safe_strlen(handler_name, 256U));
+
+  if (ed25519_private_key == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (secure_key_handler == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  memory_secure_key_handler_context_t* context = _cardano_malloc(sizeof(memory_secure_key_handler_context_t));
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  context->base.ref_count     = 1;
+  context->base.last_error    = NULL;
+  context->base.deallocator   = memory_secure_key_handler_deallocate;
+  context->signing_context    = NULL;
+
+  cardano_error_t result = cardano_ed25519_signing_context_new(ed25519_private_key, &context->signing_context);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    memory_secure_key_handler_deallocate(context);
+
+    return result;
+  }
+
+  impl.bip32_get_extended_account_public_key = NULL;
+  impl.bip32_sign_transaction                = NULL;
+  impl.bip32_sign_transactions               = NULL;
+  impl.bip32_get_signing_context             = NULL;
+  impl.ed25519_get_public_key                = ed25519_get_public_key;
+  impl.ed25519_sign_transaction              = ed25519_sign_transaction;
+  impl.ed25519_get_signing_context           = ed25519_get_signing_context;
+  impl.serialize                             = NULL;
+  impl.unlock                                = unlock;
+  impl.lock                                  = lock;
+  impl.type                                  = CARDANO_SECURE_KEY_HANDLER_TYPE_ED25519;
+
+  impl.context = (cardano_object_t*)((void*)context);
+
+  result = cardano_secure_key_handler_new(impl, secure_key_handler);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    memory_secure_key_handler_deallocate(context);
+  }
+
+  return result;
+}
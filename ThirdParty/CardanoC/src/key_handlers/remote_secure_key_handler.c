@@ -0,0 +1,869 @@
+/**
+ * \file remote_secure_key_handler.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/key_handlers/remote_secure_key_handler.h>
+
+#ifndef _WIN32
+
+#include <cardano/crypto/bip32_public_key.h>
+#include <cardano/crypto/blake2b_hash.h>
+#include <cardano/crypto/ed25519_public_key.h>
+#include <cardano/crypto/ed25519_signature.h>
+#include <cardano/key_handlers/secure_key_handler_impl.h>
+#include <cardano/key_handlers/secure_key_handler_type.h>
+#include <cardano/object.h>
+#include <cardano/transaction/transaction.h>
+#include <cardano/witness_set/vkey_witness.h>
+#include <cardano/witness_set/vkey_witness_set.h>
+
+#include "../allocators.h"
+#include "../endian.h"
+#include "../string_safe.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Send and receive timeout of the connection, in seconds. A service that does not answer within this time is
+ * considered unreachable.
+ */
+#ifndef CARDANO_REMOTE_SECURE_KEY_HANDLER_TIMEOUT_SECONDS
+#define CARDANO_REMOTE_SECURE_KEY_HANDLER_TIMEOUT_SECONDS 30
+#endif
+
+#ifdef MSG_NOSIGNAL
+static const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static const int SEND_FLAGS = 0;
+#endif
+
+static const size_t HASH_SIZE        = 32U;
+static const size_t PUBLIC_KEY_SIZE  = 32U;
+static const size_t SIGNATURE_SIZE   = 64U;
+static const size_t BIP32_KEY_SIZE   = 64U;
+static const size_t STATUS_SIZE      = 4U;
+static const size_t MAX_PAYLOAD_SIZE = 4U + ((size_t)CARDANO_SIGNING_SERVICE_MAX_BATCH_SIZE * CARDANO_SIGNING_SERVICE_SIGN_RESPONSE_ITEM_SIZE);
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Context structure for the Remote Secure Key Handler.
+ */
+typedef struct remote_secure_key_handler_context_t
+{
+    cardano_object_t base;
+
+    /**
+     * \brief The path of the socket the signing service listens on, null terminated.
+     */
+    char socket_path[sizeof(((struct sockaddr_un*)NULL)->sun_path)];
+
+    /**
+     * \brief The connected socket, or -1 while disconnected.
+     */
+    int socket;
+} remote_secure_key_handler_context_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates the handler context, closing the connection.
+ *
+ * \param object A void pointer to the context to be deallocated.
+ */
+static void
+remote_secure_key_handler_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  remote_secure_key_handler_context_t* context = (remote_secure_key_handler_context_t*)object;
+
+  if (context->socket >= 0)
+  {
+    CARDANO_UNUSED(close(context->socket));
+  }
+
+  _cardano_free(object);
+}
+
+/**
+ * \brief Copies a message into the error message buffer of the implementation.
+ *
+ * \param[in] secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[in] message The null-terminated message.
+ */
+static void
+set_error_message(cardano_secure_key_handler_impl_t* secure_key_handler_impl, const char* message)
+{
+  const size_t length = cardano_safe_strlen(message, sizeof(secure_key_handler_impl->error_message) - 1U);
+
+  cardano_safe_memcpy(secure_key_handler_impl->error_message, sizeof(secure_key_handler_impl->error_message), message, length);
+  secure_key_handler_impl->error_message[length] = '\0';
+}
+
+/**
+ * \brief Closes the connection to the signing service, if open.
+ *
+ * \param[in] context The handler context.
+ */
+static void
+disconnect(remote_secure_key_handler_context_t* context)
+{
+  if (context->socket >= 0)
+  {
+    CARDANO_UNUSED(close(context->socket));
+    context->socket = -1;
+  }
+}
+
+/**
+ * \brief Connects to the signing service.
+ *
+ * \param[in] context The handler context.
+ *
+ * \return \ref CARDANO_SUCCESS if connected, or \ref CARDANO_ERROR_GENERIC if the service could not be reached.
+ */
+static cardano_error_t
+connect_service(remote_secure_key_handler_context_t* context)
+{
+  disconnect(context);
+
+  struct sockaddr_un address;
+  struct timeval     timeout;
+
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  cardano_safe_memcpy(address.sun_path, sizeof(address.sun_path), context->socket_path, cardano_safe_strlen(context->socket_path, sizeof(context->socket_path)));
+
+  timeout.tv_sec  = CARDANO_REMOTE_SECURE_KEY_HANDLER_TIMEOUT_SECONDS;
+  timeout.tv_usec = 0;
+
+  const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+  if (fd < 0)
+  {
+    return CARDANO_ERROR_GENERIC;
+  }
+
+#ifdef SO_NOSIGPIPE
+  const int no_sigpipe = 1;
+  CARDANO_UNUSED(setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe)));
+#endif
+
+  CARDANO_UNUSED(setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)));
+  CARDANO_UNUSED(setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)));
+
+  if (connect(fd, (const struct sockaddr*)((const void*)&address), sizeof(address)) != 0)
+  {
+    CARDANO_UNUSED(close(fd));
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  context->socket = fd;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Writes a whole buffer to the connection.
+ *
+ * \param[in] fd The socket.
+ * \param[in] data The bytes to write.
+ * \param[in] size The number of bytes to write.
+ *
+ * \return `true` if every byte was written.
+ */
+static bool
+write_all(const int fd, const byte_t* data, size_t size)
+{
+  while (size > 0U)
+  {
+    const ssize_t written = send(fd, data, size, SEND_FLAGS);
+
+    if (written < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+
+      return false;
+    }
+
+    data = &data[written];
+    size -= (size_t)written;
+  }
+
+  return true;
+}
+
+/**
+ * \brief Reads exactly `size` bytes from the connection.
+ *
+ * \param[in] fd The socket.
+ * \param[out] data The buffer receiving the bytes.
+ * \param[in] size The number of bytes to read.
+ *
+ * \return `true` if every byte was read, `false` on error, timeout or end of stream.
+ */
+static bool
+read_all(const int fd, byte_t* data, size_t size)
+{
+  while (size > 0U)
+  {
+    const ssize_t received = recv(fd, data, size, 0);
+
+    if (received < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+
+      return false;
+    }
+
+    if (received == 0)
+    {
+      return false;
+    }
+
+    data = &data[received];
+    size -= (size_t)received;
+  }
+
+  return true;
+}
+
+/**
+ * \brief Sends a request frame and receives its response over the current connection.
+ *
+ * \param[in] fd The socket.
+ * \param[in] frame The request frame, header included.
+ * \param[in] frame_size The size of the request frame.
+ * \param[in] operation The operation of the request.
+ * \param[out] payload On success, the response payload. The caller must release it with `_cardano_free`.
+ * \param[out] payload_size On success, the size of the response payload.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_GENERIC if the connection failed, or
+ *         \ref CARDANO_ERROR_DECODING if the response is not a valid frame.
+ */
+static cardano_error_t
+exchange_frame(
+  const int      fd,
+  const byte_t*  frame,
+  const size_t   frame_size,
+  const uint16_t operation,
+  byte_t**       payload,
+  size_t*        payload_size)
+{
+  byte_t header[CARDANO_SIGNING_SERVICE_HEADER_SIZE] = { 0 };
+
+  if (!write_all(fd, frame, frame_size) || !read_all(fd, header, sizeof(header)))
+  {
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  uint32_t magic          = 0U;
+  uint16_t version        = 0U;
+  uint16_t response_op    = 0U;
+  uint32_t response_bytes = 0U;
+
+  CARDANO_UNUSED(cardano_read_uint32_le(&magic, header, sizeof(header), 0U));
+  CARDANO_UNUSED(cardano_read_uint16_le(&version, header, sizeof(header), 4U));
+  CARDANO_UNUSED(cardano_read_uint16_le(&response_op, header, sizeof(header), 6U));
+  CARDANO_UNUSED(cardano_read_uint32_le(&response_bytes, header, sizeof(header), 8U));
+
+  if ((magic != CARDANO_SIGNING_SERVICE_MAGIC) || (version != CARDANO_SIGNING_SERVICE_VERSION) || (response_op != operation) || (response_bytes < STATUS_SIZE) || (response_bytes > MAX_PAYLOAD_SIZE))
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  *payload = (byte_t*)_cardano_malloc(response_bytes);
+
+  if (*payload == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  if (!read_all(fd, *payload, response_bytes))
+  {
+    _cardano_free(*payload);
+    *payload = NULL;
+
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  *payload_size = response_bytes;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Sends a request to the signing service and returns the data of its response.
+ *
+ * A broken connection is reopened once and the request sent again. Requests are idempotent (Ed25519 signatures are
+ * deterministic), so a repeated request that had already been served does no harm.
+ *
+ * \param[in] secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[in] operation The operation of the request.
+ * \param[in,out] frame The request frame; its header is filled in by this function.
+ * \param[in] frame_size The size of the request frame, header included.
+ * \param[out] payload On success, the response payload, status included. The caller must release it with
+ *                     `_cardano_free`.
+ * \param[out] payload_size On success, the size of the response payload.
+ *
+ * \return \ref CARDANO_SUCCESS if the service served the request, the status returned by the service if it refused
+ *         it, or another error code if it could not be reached.
+ */
+static cardano_error_t
+send_request(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  const uint16_t                     operation,
+  byte_t*                            frame,
+  const size_t                       frame_size,
+  byte_t**                           payload,
+  size_t*                            payload_size)
+{
+  remote_secure_key_handler_context_t* context = (remote_secure_key_handler_context_t*)((void*)secure_key_handler_impl->context);
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *payload      = NULL;
+  *payload_size = 0U;
+
+  CARDANO_UNUSED(cardano_write_uint32_le(CARDANO_SIGNING_SERVICE_MAGIC, frame, frame_size, 0U));
+  CARDANO_UNUSED(cardano_write_uint16_le(CARDANO_SIGNING_SERVICE_VERSION, frame, frame_size, 4U));
+  CARDANO_UNUSED(cardano_write_uint16_le(operation, frame, frame_size, 6U));
+  CARDANO_UNUSED(cardano_write_uint32_le((uint32_t)(frame_size - CARDANO_SIGNING_SERVICE_HEADER_SIZE), frame, frame_size, 8U));
+
+  cardano_error_t result = CARDANO_ERROR_GENERIC;
+
+  for (size_t attempt = 0U; (attempt < 2U) && (result == CARDANO_ERROR_GENERIC); ++attempt)
+  {
+    if ((context->socket < 0) || (attempt > 0U))
+    {
+      result = connect_service(context);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        continue;
+      }
+    }
+
+    result = exchange_frame(context->socket, frame, frame_size, operation, payload, payload_size);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    disconnect(context);
+    set_error_message(secure_key_handler_impl, (result == CARDANO_ERROR_DECODING) ? "Invalid response from the signing service." : "Could not reach the signing service.");
+
+    return result;
+  }
+
+  uint32_t status = 0U;
+  CARDANO_UNUSED(cardano_read_uint32_le(&status, *payload, *payload_size, 0U));
+
+  if (status != (uint32_t)CARDANO_SUCCESS)
+  {
+    _cardano_free(*payload);
+    *payload = NULL;
+
+    set_error_message(secure_key_handler_impl, "The signing service refused the request.");
+
+    return (cardano_error_t)status;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Encodes a derivation path in the wire format of the signing service.
+ *
+ * \param[in] path The derivation path.
+ * \param[out] buffer The buffer receiving the encoded path.
+ * \param[in] size The size of `buffer`.
+ * \param[in] offset The offset at which the path is written.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_INVALID_ARGUMENT if a component of the path is not
+ *         a 32 bit BIP32 index.
+ */
+static cardano_error_t
+write_derivation_path(
+  const cardano_derivation_path_t* path,
+  byte_t*                          buffer,
+  const size_t                     size,
+  const size_t                     offset)
+{
+  const uint64_t components[5] = { path->purpose, path->coin_type, path->account, path->role, path->index };
+
+  for (size_t i = 0U; i < 5U; ++i)
+  {
+    if (components[i] > UINT32_MAX)
+    {
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+
+    CARDANO_UNUSED(cardano_write_uint32_le((uint32_t)components[i], buffer, size, offset + (i * 4U)));
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Builds a vkey witness from a public key and a signature returned by the signing service.
+ *
+ * \param[in] item The response item: the public key followed by the signature.
+ * \param[out] witness On success, the witness. The caller must release it.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+static cardano_error_t
+witness_from_response_item(const byte_t* item, cardano_vkey_witness_t** witness)
+{
+  cardano_ed25519_public_key_t* public_key = NULL;
+  cardano_ed25519_signature_t*  signature  = NULL;
+
+  cardano_error_t result = cardano_ed25519_public_key_from_bytes(item, PUBLIC_KEY_SIZE, &public_key);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_ed25519_signature_from_bytes(&item[PUBLIC_KEY_SIZE], SIGNATURE_SIZE, &signature);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_vkey_witness_new(public_key, signature, witness);
+  }
+
+  cardano_ed25519_signature_unref(&signature);
+  cardano_ed25519_public_key_unref(&public_key);
+
+  return result;
+}
+
+/**
+ * \brief Signs a range of the (transaction, derivation path) pairs of a batch in a single request.
+ *
+ * Pair `k` is the transaction `k / num_paths` signed with the derivation path `k % num_paths`.
+ *
+ * \param[in] secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[in] hashes The body hashes of the transactions.
+ * \param[in] derivation_paths The derivation paths signing every transaction.
+ * \param[in] num_paths The number of derivation paths.
+ * \param[in] first The first pair of the range.
+ * \param[in] count The number of pairs in the range, at most \ref CARDANO_SIGNING_SERVICE_MAX_BATCH_SIZE.
+ * \param[in,out] vkey_witness_sets The witness sets of the transactions, which receive the new witnesses.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+static cardano_error_t
+sign_range(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  cardano_blake2b_hash_t* const*     hashes,
+  const cardano_derivation_path_t*   derivation_paths,
+  const size_t                       num_paths,
+  const size_t                       first,
+  const size_t                       count,
+  cardano_vkey_witness_set_t**       vkey_witness_sets)
+{
+  const size_t frame_size = CARDANO_SIGNING_SERVICE_HEADER_SIZE + 4U + (count * CARDANO_SIGNING_SERVICE_SIGN_REQUEST_ITEM_SIZE);
+  byte_t*      frame      = (byte_t*)_cardano_malloc(frame_size);
+
+  if (frame == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(cardano_write_uint32_le((uint32_t)count, frame, frame_size, CARDANO_SIGNING_SERVICE_HEADER_SIZE));
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < count); ++i)
+  {
+    const size_t offset = CARDANO_SIGNING_SERVICE_HEADER_SIZE + 4U + (i * CARDANO_SIGNING_SERVICE_SIGN_REQUEST_ITEM_SIZE);
+    const size_t pair   = first + i;
+
+    cardano_safe_memcpy(&frame[offset], HASH_SIZE, cardano_blake2b_hash_get_data(hashes[pair / num_paths]), HASH_SIZE);
+    result = write_derivation_path(&derivation_paths[pair % num_paths], frame, frame_size, offset + HASH_SIZE);
+  }
+
+  byte_t* payload      = NULL;
+  size_t  payload_size = 0U;
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = send_request(secure_key_handler_impl, CARDANO_SIGNING_SERVICE_OP_SIGN, frame, frame_size, &payload, &payload_size);
+  }
+
+  _cardano_free(frame);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (payload_size != (STATUS_SIZE + (count * CARDANO_SIGNING_SERVICE_SIGN_RESPONSE_ITEM_SIZE)))
+  {
+    _cardano_free(payload);
+    set_error_message(secure_key_handler_impl, "Invalid response from the signing service.");
+
+    return CARDANO_ERROR_DECODING;
+  }
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < count); ++i)
+  {
+    cardano_vkey_witness_t* witness = NULL;
+
+    result = witness_from_response_item(&payload[STATUS_SIZE + (i * CARDANO_SIGNING_SERVICE_SIGN_RESPONSE_ITEM_SIZE)], &witness);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_vkey_witness_set_add(vkey_witness_sets[(first + i) / num_paths], witness);
+    }
+
+    cardano_vkey_witness_unref(&witness);
+  }
+
+  _cardano_free(payload);
+
+  return result;
+}
+
+/**
+ * \brief Signs a batch of transactions through the signing service.
+ *
+ * Every transaction is signed with every derivation path. The body hashes are computed locally and sent, with the
+ * derivation paths, in as few requests as \ref CARDANO_SIGNING_SERVICE_MAX_BATCH_SIZE allows, usually one.
+ *
+ * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[in]  txs The transactions to be signed.
+ * \param[in]  num_txs The number of transactions in the `txs` array.
+ * \param[in]  derivation_paths The derivation paths of the keys signing every transaction.
+ * \param[in]  num_paths The number of derivation paths.
+ * \param[out] vkey_witness_sets An array of `num_txs` entries that receives one witness set per transaction. On
+ *                               failure every entry is set to NULL.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+static cardano_error_t
+bip32_sign_transactions(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  cardano_transaction_t* const*      txs,
+  const size_t                       num_txs,
+  const cardano_derivation_path_t*   derivation_paths,
+  const size_t                       num_paths,
+  cardano_vkey_witness_set_t**       vkey_witness_sets)
+{
+  if ((secure_key_handler_impl == NULL) || (txs == NULL) || (derivation_paths == NULL) || (vkey_witness_sets == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  for (size_t i = 0U; i < num_txs; ++i)
+  {
+    vkey_witness_sets[i] = NULL;
+  }
+
+  if ((num_paths > 0U) && (num_txs > (SIZE_MAX / num_paths)))
+  {
+    return CARDANO_ERROR_INTEGER_OVERFLOW;
+  }
+
+  cardano_blake2b_hash_t** hashes = (cardano_blake2b_hash_t**)_cardano_malloc((num_txs > 0U ? num_txs : 1U) * sizeof(cardano_blake2b_hash_t*));
+
+  if (hashes == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  for (size_t i = 0U; i < num_txs; ++i)
+  {
+    hashes[i] = NULL;
+
+    if (result != CARDANO_SUCCESS)
+    {
+      continue;
+    }
+
+    hashes[i] = cardano_transaction_get_id(txs[i]);
+
+    if (hashes[i] == NULL)
+    {
+      result = CARDANO_ERROR_POINTER_IS_NULL;
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_vkey_witness_set_new(&vkey_witness_sets[i]);
+    }
+  }
+
+  const size_t num_pairs = num_txs * num_paths;
+
+  for (size_t first = 0U; (result == CARDANO_SUCCESS) && (first < num_pairs); first += CARDANO_SIGNING_SERVICE_MAX_BATCH_SIZE)
+  {
+    const size_t remaining = num_pairs - first;
+    const size_t count     = (remaining < CARDANO_SIGNING_SERVICE_MAX_BATCH_SIZE) ? remaining : CARDANO_SIGNING_SERVICE_MAX_BATCH_SIZE;
+
+    result = sign_range(secure_key_handler_impl, hashes, derivation_paths, num_paths, first, count, vkey_witness_sets);
+  }
+
+  for (size_t i = 0U; i < num_txs; ++i)
+  {
+    cardano_blake2b_hash_unref(&hashes[i]);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_vkey_witness_set_unref(&vkey_witness_sets[i]);
+    }
+  }
+
+  _cardano_free(hashes);
+
+  return result;
+}
+
+/**
+ * \brief Signs a transaction through the signing service.
+ *
+ * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[in]  tx The transaction to be signed.
+ * \param[in]  derivation_paths The derivation paths of the keys signing the transaction.
+ * \param[in]  num_paths The number of derivation paths.
+ * \param[out] vkey_witness_set On success, the witness set. The caller must release it.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+static cardano_error_t
+bip32_sign_transaction(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  cardano_transaction_t*             tx,
+  const cardano_derivation_path_t*   derivation_paths,
+  const size_t                       num_paths,
+  cardano_vkey_witness_set_t**       vkey_witness_set)
+{
+  if (tx == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_transaction_t* const txs[1] = { tx };
+
+  return bip32_sign_transactions(secure_key_handler_impl, &txs[0], 1U, derivation_paths, num_paths, vkey_witness_set);
+}
+
+/**
+ * \brief Retrieves an extended account public key from the signing service.
+ *
+ * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[in]  account_path The derivation path of the account.
+ * \param[out] bip32_public_key On success, the extended account public key. The caller must release it.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+static cardano_error_t
+bip32_get_extended_account_public_key(
+  cardano_secure_key_handler_impl_t*      secure_key_handler_impl,
+  const cardano_account_derivation_path_t account_path,
+  cardano_bip32_public_key_t**            bip32_public_key)
+{
+  if ((secure_key_handler_impl == NULL) || (bip32_public_key == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const cardano_derivation_path_t derivation_path = { account_path.purpose, account_path.coin_type, account_path.account, 0U, 0U };
+
+  byte_t frame[CARDANO_SIGNING_SERVICE_HEADER_SIZE + CARDANO_SIGNING_SERVICE_PATH_SIZE] = { 0 };
+
+  cardano_error_t result = write_derivation_path(&derivation_path, frame, sizeof(frame), CARDANO_SIGNING_SERVICE_HEADER_SIZE);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  byte_t* payload      = NULL;
+  size_t  payload_size = 0U;
+
+  result = send_request(secure_key_handler_impl, CARDANO_SIGNING_SERVICE_OP_GET_ACCOUNT_PUBLIC_KEY, frame, sizeof(frame), &payload, &payload_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (payload_size != (STATUS_SIZE + BIP32_KEY_SIZE))
+  {
+    result = CARDANO_ERROR_DECODING;
+    set_error_message(secure_key_handler_impl, "Invalid response from the signing service.");
+  }
+  else
+  {
+    result = cardano_bip32_public_key_from_bytes(&payload[STATUS_SIZE], BIP32_KEY_SIZE, bip32_public_key);
+  }
+
+  _cardano_free(payload);
+
+  return result;
+}
+
+/**
+ * \brief Opens an unlocked session. The signing service holds the keys unlocked, so there is nothing to do.
+ *
+ * \param[in] secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[in] ttl_seconds Unused.
+ * \param[in] max_operations Unused.
+ *
+ * \returns \ref CARDANO_SUCCESS, or \ref CARDANO_ERROR_POINTER_IS_NULL if `secure_key_handler_impl` is NULL.
+ */
+static cardano_error_t
+unlock(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  const uint64_t                     ttl_seconds,
+  const uint64_t                     max_operations)
+{
+  CARDANO_UNUSED(ttl_seconds);
+  CARDANO_UNUSED(max_operations);
+
+  if (secure_key_handler_impl == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Closes an unlocked session. The keys are managed by the signing service, so there is nothing to do.
+ *
+ * \param[in] secure_key_handler_impl A pointer to the secure key handler implementation.
+ *
+ * \returns \ref CARDANO_SUCCESS, or \ref CARDANO_ERROR_POINTER_IS_NULL if `secure_key_handler_impl` is NULL.
+ */
+static cardano_error_t
+lock(cardano_secure_key_handler_impl_t* secure_key_handler_impl)
+{
+  if (secure_key_handler_impl == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+#endif /* _WIN32 */
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_remote_secure_key_handler_new(
+  const char*                    socket_path,
+  const size_t                   socket_path_size,
+  cardano_secure_key_handler_t** secure_key_handler)
+{
+  if ((socket_path == NULL) || (secure_key_handler == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+#ifdef _WIN32
+  CARDANO_UNUSED(socket_path_size);
+
+  return CARDANO_ERROR_NOT_IMPLEMENTED;
+#else
+  static const char*                handler_name = "Remote Secure Key Handler";
+  cardano_secure_key_handler_impl_t impl         = { 0 };
+
+  cardano_safe_memcpy(impl.name, 256U, handler_name, cardano_safe_strlen(handler_name, 256U));
+
+  remote_secure_key_handler_context_t* context = _cardano_malloc(sizeof(remote_secure_key_handler_context_t));
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  if ((socket_path_size == 0U) || (socket_path_size >= sizeof(context->socket_path)))
+  {
+    _cardano_free(context);
+
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  context->base.ref_count   = 1;
+  context->base.last_error  = NULL;
+  context->base.deallocator = remote_secure_key_handler_deallocate;
+  context->socket           = -1;
+
+  memset(context->socket_path, 0, sizeof(context->socket_path));
+  cardano_safe_memcpy(context->socket_path, sizeof(context->socket_path), socket_path, socket_path_size);
+
+  cardano_error_t result = connect_service(context);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    remote_secure_key_handler_deallocate(context);
+
+    return result;
+  }
+
+  impl.bip32_get_extended_account_public_key = bip32_get_extended_account_public_key;
+  impl.bip32_sign_transaction                = bip32_sign_transaction;
+  impl.bip32_sign_transactions               = bip32_sign_transactions;
+  impl.bip32_get_signing_context             = NULL;
+  impl.ed25519_get_public_key                = NULL;
+  impl.ed25519_sign_transaction              = NULL;
+  impl.ed25519_get_signing_context           = NULL;
+  impl.serialize                             = NULL;
+  impl.unlock                                = unlock;
+  impl.lock                                  = lock;
+  impl.type                                  = CARDANO_SECURE_KEY_HANDLER_TYPE_BIP32;
+
+  impl.context = (cardano_object_t*)((void*)context);
+
+  result = cardano_secure_key_handler_new(impl, secure_key_handler);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    remote_secure_key_handler_deallocate(context);
+  }
+
+  return result;
+#endif
+}
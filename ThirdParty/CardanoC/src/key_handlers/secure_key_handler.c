@@ -94,7 +94,7 @@ cardano_secure_key_handler_new(
 
   (*secure_key_handler)->base.deallocator   = cardano_secure_key_handler_deallocate;
   (*secure_key_handler)->base.ref_count     = 1;
-  (*secure_key_handler)->base.last_error[0] = '\0';
+  (*secure_key_handler)->base.last_error    = NULL;
 
   (*secure_key_handler)->impl = impl;
 
@@ -144,6 +144,59 @@ cardano_secure_key_handler_bip32_sign_transaction(
   return result;
 }
 
+cardano_error_t
+cardano_secure_key_handler_bip32_sign_transactions(
+  cardano_secure_key_handler_t*    secure_key_handler,
+  cardano_transaction_t* const*    txs,
+  const size_t                     num_txs,
+  const cardano_derivation_path_t* derivation_paths,
+  const size_t                     num_paths,
+  cardano_vkey_witness_set_t**     vkey_witness_sets)
+{
+  if ((secure_key_handler == NULL) || (txs == NULL) || (derivation_paths == NULL) || (vkey_witness_sets == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  for (size_t i = 0U; i < num_txs; ++i)
+  {
+    vkey_witness_sets[i] = NULL;
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (secure_key_handler->impl.bip32_sign_transactions != NULL)
+  {
+    result = secure_key_handler->impl.bip32_sign_transactions(&secure_key_handler->impl, txs, num_txs, derivation_paths, num_paths, vkey_witness_sets);
+  }
+  else if (secure_key_handler->impl.bip32_sign_transaction != NULL)
+  {
+    for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < num_txs); ++i)
+    {
+      result = secure_key_handler->impl.bip32_sign_transaction(&secure_key_handler->impl, txs[i], derivation_paths, num_paths, &vkey_witness_sets[i]);
+    }
+
+    if (result != CARDANO_SUCCESS)
+    {
+      for (size_t i = 0U; i < num_txs; ++i)
+      {
+        cardano_vkey_witness_set_unref(&vkey_witness_sets[i]);
+      }
+    }
+  }
+  else
+  {
+    return CARDANO_ERROR_NOT_IMPLEMENTED;
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_secure_key_handler_set_last_error(secure_key_handler, secure_key_handler->impl.error_message);
+  }
+
+  return result;
+}
+
 cardano_error_t
 cardano_secure_key_handler_bip32_get_extended_account_public_key(
   cardano_secure_key_handler_t*           secure_key_handler,
@@ -221,6 +274,61 @@ cardano_secure_key_handler_ed25519_get_public_key(
   return result;
 }
 
+cardano_error_t
+cardano_secure_key_handler_bip32_get_signing_context(
+  cardano_secure_key_handler_t*       secure_key_handler,
+  const cardano_derivation_path_t     derivation_path,
+  cardano_ed25519_signing_context_t** signing_context)
+{
+  if ((secure_key_handler == NULL) || (signing_context == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *signing_context = NULL;
+
+  if (secure_key_handler->impl.bip32_get_signing_context == NULL)
+  {
+    return CARDANO_ERROR_NOT_IMPLEMENTED;
+  }
+
+  cardano_error_t result = secure_key_handler->impl.bip32_get_signing_context(&secure_key_handler->impl, derivation_path, signing_context);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_secure_key_handler_set_last_error(secure_key_handler, secure_key_handler->impl.error_message);
+  }
+
+  return result;
+}
+
+cardano_error_t
+cardano_secure_key_handler_ed25519_get_signing_context(
+  cardano_secure_key_handler_t*       secure_key_handler,
+  cardano_ed25519_signing_context_t** signing_context)
+{
+  if ((secure_key_handler == NULL) || (signing_context == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *signing_context = NULL;
+
+  if (secure_key_handler->impl.ed25519_get_signing_context == NULL)
+  {
+    return CARDANO_ERROR_NOT_IMPLEMENTED;
+  }
+
+  cardano_error_t result = secure_key_handler->impl.ed25519_get_signing_context(&secure_key_handler->impl, signing_context);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_secure_key_handler_set_last_error(secure_key_handler, secure_key_handler->impl.error_message);
+  }
+
+  return result;
+}
+
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t
 cardano_secure_key_handler_serialize(
@@ -247,6 +355,55 @@ cardano_secure_key_handler_serialize(
   return result;
 }
 
+cardano_error_t
+cardano_secure_key_handler_unlock(
+  cardano_secure_key_handler_t* secure_key_handler,
+  const uint64_t                ttl_seconds,
+  const uint64_t                max_operations)
+{
+  if (secure_key_handler == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (secure_key_handler->impl.unlock == NULL)
+  {
+    return CARDANO_ERROR_NOT_IMPLEMENTED;
+  }
+
+  cardano_error_t result = secure_key_handler->impl.unlock(&secure_key_handler->impl, ttl_seconds, max_operations);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_secure_key_handler_set_last_error(secure_key_handler, secure_key_handler->impl.error_message);
+  }
+
+  return result;
+}
+
+cardano_error_t
+cardano_secure_key_handler_lock(cardano_secure_key_handler_t* secure_key_handler)
+{
+  if (secure_key_handler == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (secure_key_handler->impl.lock == NULL)
+  {
+    return CARDANO_ERROR_NOT_IMPLEMENTED;
+  }
+
+  cardano_error_t result = secure_key_handler->impl.lock(&secure_key_handler->impl);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_secure_key_handler_set_last_error(secure_key_handler, secure_key_handler->impl.error_message);
+  }
+
+  return result;
+}
+
 void
 cardano_secure_key_handler_unref(cardano_secure_key_handler_t** secure_key_handler)
 {
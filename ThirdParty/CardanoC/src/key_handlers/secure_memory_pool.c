@@ -0,0 +1,143 @@
+/**
+ * \file secure_memory_pool.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "secure_memory_pool.h"
+
+#include "../allocators.h"
+
+#include <sodium/utils.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const size_t MAX_SLOT_COUNT = 64U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A locked region split into slots, with one bit per slot in use.
+ */
+struct cardano_secure_memory_pool_t
+{
+  byte_t*  region;
+  size_t   slot_size;
+  size_t   slot_count;
+  uint64_t in_use;
+};
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_secure_memory_pool_t*
+_cardano_secure_memory_pool_new(const size_t slot_size, const size_t slot_count)
+{
+  if ((slot_size == 0U) || (slot_count == 0U) || (slot_count > MAX_SLOT_COUNT) || (slot_size > (SIZE_MAX / slot_count)))
+  {
+    return NULL;
+  }
+
+  cardano_secure_memory_pool_t* pool = (cardano_secure_memory_pool_t*)_cardano_malloc(sizeof(cardano_secure_memory_pool_t));
+
+  if (pool == NULL)
+  {
+    return NULL;
+  }
+
+  // One sodium_malloc for every slot, so the pages are locked and guarded once rather than per operation
+  pool->region = (byte_t*)sodium_malloc(slot_size * slot_count);
+
+  if (pool->region == NULL)
+  {
+    _cardano_free(pool);
+    return NULL;
+  }
+
+  sodium_memzero(pool->region, slot_size * slot_count);
+
+  pool->slot_size  = slot_size;
+  pool->slot_count = slot_count;
+  pool->in_use     = 0U;
+
+  return pool;
+}
+
+void
+_cardano_secure_memory_pool_free(cardano_secure_memory_pool_t** pool)
+{
+  if ((pool == NULL) || (*pool == NULL))
+  {
+    return;
+  }
+
+  // sodium_free wipes the region before unlocking it
+  sodium_free((*pool)->region);
+  _cardano_free(*pool);
+
+  *pool = NULL;
+}
+
+byte_t*
+_cardano_secure_memory_pool_acquire(cardano_secure_memory_pool_t* pool)
+{
+  if (pool == NULL)
+  {
+    return NULL;
+  }
+
+  for (size_t i = 0U; i < pool->slot_count; ++i)
+  {
+    const uint64_t bit = (uint64_t)1U << i;
+
+    if ((pool->in_use & bit) == 0U)
+    {
+      pool->in_use |= bit;
+      return &pool->region[i * pool->slot_size];
+    }
+  }
+
+  return NULL;
+}
+
+void
+_cardano_secure_memory_pool_release(cardano_secure_memory_pool_t* pool, byte_t* slot)
+{
+  if ((pool == NULL) || (slot == NULL) || (slot < pool->region))
+  {
+    return;
+  }
+
+  const size_t offset = (size_t)(slot - pool->region);
+  const size_t index  = offset / pool->slot_size;
+
+  if ((index >= pool->slot_count) || ((offset % pool->slot_size) != 0U))
+  {
+    return;
+  }
+
+  sodium_memzero(slot, pool->slot_size);
+  pool->in_use &= ~((uint64_t)1U << index);
+}
+
+size_t
+_cardano_secure_memory_pool_slot_size(const cardano_secure_memory_pool_t* pool)
+{
+  return (pool == NULL) ? 0U : pool->slot_size;
+}
@@ -0,0 +1,93 @@
+/**
+ * \file secure_memory_pool.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_SECURE_MEMORY_POOL_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_SECURE_MEMORY_POOL_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Fixed-size slots of locked memory for key material that only lives for one operation.
+ *
+ * The whole pool is a single `sodium_malloc` region, so it is locked out of swap and fenced by guard pages, and
+ * acquiring a slot costs a bit scan rather than an allocation and an `mlock` call. Slots are wiped on release.
+ *
+ * A pool is not thread-safe; it belongs to one key handler, which is used from one thread at a time.
+ */
+typedef struct cardano_secure_memory_pool_t cardano_secure_memory_pool_t;
+
+/**
+ * \brief Creates a pool of `slot_count` slots of `slot_size` bytes each.
+ *
+ * \param[in] slot_size The size of every slot. Must be greater than zero.
+ * \param[in] slot_count The number of slots, from 1 to 64.
+ *
+ * \return The new pool, or NULL if the arguments are out of range or the memory cannot be allocated or locked.
+ */
+cardano_secure_memory_pool_t*
+_cardano_secure_memory_pool_new(size_t slot_size, size_t slot_count);
+
+/**
+ * \brief Wipes and frees the pool and sets `*pool` to NULL. Slots still acquired are released with it.
+ *
+ * \param[in,out] pool The pool to free. May point to NULL.
+ */
+void
+_cardano_secure_memory_pool_free(cardano_secure_memory_pool_t** pool);
+
+/**
+ * \brief Returns a zeroed, free slot of the pool, or NULL if `pool` is NULL or every slot is in use.
+ *
+ * \param[in] pool The pool to take the slot from.
+ */
+byte_t*
+_cardano_secure_memory_pool_acquire(cardano_secure_memory_pool_t* pool);
+
+/**
+ * \brief Wipes `slot` and gives it back to the pool. Does nothing if either is NULL or `slot` is not of the pool.
+ *
+ * \param[in] pool The pool `slot` was acquired from.
+ * \param[in] slot The slot to release.
+ */
+void
+_cardano_secure_memory_pool_release(cardano_secure_memory_pool_t* pool, byte_t* slot);
+
+/**
+ * \brief Returns the size of every slot of the pool, or zero if `pool` is NULL.
+ *
+ * \param[in] pool The pool.
+ */
+size_t
+_cardano_secure_memory_pool_slot_size(const cardano_secure_memory_pool_t* pool);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_SECURE_MEMORY_POOL_H
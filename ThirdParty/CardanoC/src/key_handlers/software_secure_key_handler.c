@@ -26,6 +26,8 @@
 #include <cardano/crypto/crc32.h>
 #include <cardano/crypto/ed25519_private_key.h>
 #include <cardano/crypto/ed25519_public_key.h>
+#include <cardano/crypto/bip32_derivation_cache.h>
+#include <cardano/crypto/ed25519_signing_context.h>
 #include <cardano/crypto/emip3.h>
 #include <cardano/key_handlers/secure_key_handler.h>
 #include <cardano/key_handlers/secure_key_handler_impl.h>
@@ -35,18 +37,36 @@
 
 #include "../allocators.h"
 #include "../string_safe.h"
+#include "secure_memory_pool.h"
 
 #include <assert.h>
+#include <sodium/core.h>
 #include <sodium/utils.h>
 #include <string.h>
+#include <time.h>
 
 /* CONSTANTS *****************************************************************/
 
 static const uint32_t SW_SECURE_KEY_BINARY_FORMAT_HANDLER_MAGIC = 0x0A0A0A0A;
 static const uint8_t  SW_SECURE_KEY_BINARY_FORMAT_VERSION       = 0x01;
+static const uint64_t SW_SECURE_KEY_SESSION_UNLIMITED_OPERATIONS = UINT64_MAX;
+static const size_t   SW_SECURE_KEY_SESSION_MAX_SIGNING_KEYS     = 64U;
+static const size_t   SW_SECURE_KEY_SECURE_MEMORY_SLOT_SIZE      = 128U;
+static const size_t   SW_SECURE_KEY_SECURE_MEMORY_SLOT_COUNT     = 2U;
 
 /* STRUCTURES ****************************************************************/
 
+/**
+ * \brief A signing key kept by an unlocked session, together with the derivation path it was derived from.
+ *
+ * Ed25519 handlers keep a single entry whose derivation path is unused.
+ */
+typedef struct software_secure_key_handler_signing_key_t
+{
+    cardano_derivation_path_t          derivation_path;
+    cardano_ed25519_signing_context_t* signing_context;
+} software_secure_key_handler_signing_key_t;
+
 /**
  * \brief Context structure for the Software Secure Key Handler.
  *
@@ -55,16 +75,650 @@ static const uint8_t  SW_SECURE_KEY_BINARY_FORMAT_VERSION       = 0x01;
  *
  * This context manages the encrypted key data as well as the mechanism for retrieving the passphrase when
  * required to decrypt the key for operations like signing or key derivation.
+ *
+ * While an unlocked session is open, `session_secret` holds the decrypted key material (the BIP32 root key, or the
+ * Ed25519 private key) in memory allocated with `sodium_malloc`, which is kept inaccessible between operations.
+ * The session also keeps the signing keys it has derived (up to `SW_SECURE_KEY_SESSION_MAX_SIGNING_KEYS`), so
+ * signing again with the same paths skips both the BIP32 derivation and the Ed25519 key expansion, and the
+ * intermediate BIP32 nodes, so signing with a new sibling path only derives its final soft step.
+ *
+ * The passphrase and the key material decrypted for a single operation are held in `secure_memory`, two locked
+ * slots allocated on the first decryption and reused by every one after it, rather than on the stack and the heap.
  */
 typedef struct software_secure_key_handler_context_t
 {
-    cardano_object_t              base;
-    cardano_buffer_t*             encrypted_data;
-    cardano_get_passphrase_func_t get_passphrase;
+    cardano_object_t                           base;
+    cardano_buffer_t*                          encrypted_data;
+    cardano_get_passphrase_func_t              get_passphrase;
+    byte_t*                                    session_secret;
+    size_t                                     session_secret_size;
+    uint64_t                                   session_expires_at;
+    uint64_t                                   session_operations_left;
+    software_secure_key_handler_signing_key_t* session_signing_keys;
+    size_t                                     session_signing_keys_count;
+    cardano_bip32_derivation_cache_t*          session_derivation_cache;
+    cardano_secure_memory_pool_t*              secure_memory;
 } software_secure_key_handler_context_t;
 
 /* STATIC FUNCTIONS **********************************************************/
 
+/**
+ * \brief Wipes and releases the key material of the unlocked session, if any.
+ *
+ * \param context The software secure key handler context.
+ */
+static void
+session_wipe(software_secure_key_handler_context_t* context)
+{
+  assert(context != NULL);
+
+  if (context->session_secret != NULL)
+  {
+    // sodium_free restores access to the region and zeroes it before releasing it.
+    sodium_free(context->session_secret);
+  }
+
+  for (size_t i = 0U; i < context->session_signing_keys_count; ++i)
+  {
+    cardano_ed25519_signing_context_unref(&context->session_signing_keys[i].signing_context);
+  }
+
+  _cardano_free(context->session_signing_keys);
+  cardano_bip32_derivation_cache_unref(&context->session_derivation_cache);
+
+  context->session_signing_keys       = NULL;
+  context->session_signing_keys_count = 0U;
+  context->session_secret             = NULL;
+  context->session_secret_size        = 0U;
+  context->session_expires_at         = 0U;
+  context->session_operations_left    = 0U;
+}
+
+/**
+ * \brief Tries to serve one operation from the unlocked session.
+ *
+ * If the session is still valid, its operation budget is decremented and the key material is made readable
+ * until \ref session_release is called. Expired or exhausted sessions are wiped.
+ *
+ * \param context The software secure key handler context.
+ *
+ * \return \c true if `session_secret` can be read, \c false if the caller must decrypt the key material.
+ */
+static bool
+session_acquire(software_secure_key_handler_context_t* context)
+{
+  assert(context != NULL);
+
+  if (context->session_secret == NULL)
+  {
+    return false;
+  }
+
+  if ((context->session_expires_at != 0U) && ((uint64_t)time(NULL) >= context->session_expires_at))
+  {
+    session_wipe(context);
+
+    return false;
+  }
+
+  if (context->session_operations_left == 0U)
+  {
+    session_wipe(context);
+
+    return false;
+  }
+
+  if (context->session_operations_left != SW_SECURE_KEY_SESSION_UNLIMITED_OPERATIONS)
+  {
+    context->session_operations_left -= 1U;
+  }
+
+  // Best effort: libsodium builds without mprotect support keep the region accessible at all times.
+  CARDANO_UNUSED(sodium_mprotect_readonly(context->session_secret));
+
+  return true;
+}
+
+/**
+ * \brief Makes the session key material inaccessible again after an operation, or wipes it if the budget is spent.
+ *
+ * \param context The software secure key handler context.
+ */
+static void
+session_release(software_secure_key_handler_context_t* context)
+{
+  assert(context != NULL);
+
+  if (context->session_secret == NULL)
+  {
+    return;
+  }
+
+  if (context->session_operations_left == 0U)
+  {
+    session_wipe(context);
+
+    return;
+  }
+
+  CARDANO_UNUSED(sodium_mprotect_noaccess(context->session_secret));
+}
+
+/**
+ * \brief Retrieves the passphrase and decrypts the key material stored in the context.
+ *
+ * Both are written to slots of `secure_memory`; the passphrase is wiped before returning.
+ *
+ * \param context The software secure key handler context.
+ * \param secret On success, the decrypted key material. The caller must give it back with \ref release_secret.
+ * \param secret_size On success, the size of the decrypted key material.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+decrypt_secret(software_secure_key_handler_context_t* context, byte_t** secret, size_t* secret_size)
+{
+  assert(context != NULL);
+  assert(secret != NULL);
+  assert(secret_size != NULL);
+
+  if (context->secure_memory == NULL)
+  {
+    if (sodium_init() == -1)
+    {
+      return CARDANO_ERROR_GENERIC;
+    }
+
+    context->secure_memory = _cardano_secure_memory_pool_new(SW_SECURE_KEY_SECURE_MEMORY_SLOT_SIZE, SW_SECURE_KEY_SECURE_MEMORY_SLOT_COUNT);
+
+    if (context->secure_memory == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+  }
+
+  byte_t* passphrase = _cardano_secure_memory_pool_acquire(context->secure_memory);
+  byte_t* data       = _cardano_secure_memory_pool_acquire(context->secure_memory);
+
+  if ((passphrase == NULL) || (data == NULL))
+  {
+    _cardano_secure_memory_pool_release(context->secure_memory, passphrase);
+    _cardano_secure_memory_pool_release(context->secure_memory, data);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  int32_t pass_len = context->get_passphrase(passphrase, SW_SECURE_KEY_SECURE_MEMORY_SLOT_SIZE);
+
+  if ((pass_len <= 0) || ((size_t)pass_len > SW_SECURE_KEY_SECURE_MEMORY_SLOT_SIZE))
+  {
+    _cardano_secure_memory_pool_release(context->secure_memory, passphrase);
+    _cardano_secure_memory_pool_release(context->secure_memory, data);
+
+    return CARDANO_ERROR_INVALID_PASSPHRASE;
+  }
+
+  cardano_error_t result = cardano_crypto_emip3_decrypt_to(
+    cardano_buffer_get_data(context->encrypted_data),
+    cardano_buffer_get_size(context->encrypted_data),
+    passphrase,
+    (size_t)pass_len,
+    data,
+    SW_SECURE_KEY_SECURE_MEMORY_SLOT_SIZE,
+    secret_size);
+
+  _cardano_secure_memory_pool_release(context->secure_memory, passphrase);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    _cardano_secure_memory_pool_release(context->secure_memory, data);
+
+    return result;
+  }
+
+  *secret = data;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Wipes key material returned by \ref decrypt_secret and gives its slot back.
+ *
+ * \param context The software secure key handler context.
+ * \param secret The key material to release.
+ */
+static void
+release_secret(software_secure_key_handler_context_t* context, byte_t* secret)
+{
+  assert(context != NULL);
+
+  _cardano_secure_memory_pool_release(context->secure_memory, secret);
+}
+
+/**
+ * \brief Loads the BIP32 root private key, from the unlocked session if possible.
+ *
+ * \param context The software secure key handler context.
+ * \param root_private_key On success, the root private key. The caller must release it.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+load_bip32_root_private_key(software_secure_key_handler_context_t* context, cardano_bip32_private_key_t** root_private_key)
+{
+  if (session_acquire(context))
+  {
+    cardano_error_t result = cardano_bip32_private_key_from_bytes(context->session_secret, context->session_secret_size, root_private_key);
+
+    session_release(context);
+
+    return result;
+  }
+
+  byte_t*         secret      = NULL;
+  size_t          secret_size = 0U;
+  cardano_error_t result      = decrypt_secret(context, &secret, &secret_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_bip32_private_key_from_bip39_entropy(NULL, 0, secret, secret_size, root_private_key);
+
+  release_secret(context, secret);
+
+  return result;
+}
+
+/**
+ * \brief Creates an Ed25519 private key from raw secret bytes, which may be in normal or extended form.
+ *
+ * \param data The key bytes.
+ * \param size The number of key bytes; 64 bytes denote an extended key.
+ * \param private_key On success, the private key. The caller must release it.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+ed25519_private_key_from_secret(const byte_t* data, const size_t size, cardano_ed25519_private_key_t** private_key)
+{
+  if (size == 64U)
+  {
+    return cardano_ed25519_private_key_from_extended_bytes(data, size, private_key);
+  }
+
+  return cardano_ed25519_private_key_from_normal_bytes(data, size, private_key);
+}
+
+/**
+ * \brief Loads the Ed25519 private key, from the unlocked session if possible.
+ *
+ * \param context The software secure key handler context.
+ * \param private_key On success, the private key. The caller must release it.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+load_ed25519_private_key(software_secure_key_handler_context_t* context, cardano_ed25519_private_key_t** private_key)
+{
+  if (session_acquire(context))
+  {
+    cardano_error_t result = ed25519_private_key_from_secret(context->session_secret, context->session_secret_size, private_key);
+
+    session_release(context);
+
+    return result;
+  }
+
+  byte_t*         secret      = NULL;
+  size_t          secret_size = 0U;
+  cardano_error_t result      = decrypt_secret(context, &secret, &secret_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = ed25519_private_key_from_secret(secret, secret_size, private_key);
+
+  release_secret(context, secret);
+
+  return result;
+}
+
+/**
+ * \brief Checks whether two derivation paths are equal.
+ *
+ * \param lhs The first derivation path.
+ * \param rhs The second derivation path.
+ *
+ * \return \c true if every level of both paths is equal.
+ */
+static bool
+derivation_path_equals(const cardano_derivation_path_t* lhs, const cardano_derivation_path_t* rhs)
+{
+  return (lhs->purpose == rhs->purpose) && (lhs->coin_type == rhs->coin_type) && (lhs->account == rhs->account)
+    && (lhs->role == rhs->role) && (lhs->index == rhs->index);
+}
+
+/**
+ * \brief Looks up a signing key kept by the unlocked session.
+ *
+ * \param context The software secure key handler context.
+ * \param derivation_path The derivation path of the key.
+ *
+ * \return A new reference to the signing key, or NULL if the session does not hold it.
+ */
+static cardano_ed25519_signing_context_t*
+session_find_signing_key(const software_secure_key_handler_context_t* context, const cardano_derivation_path_t* derivation_path)
+{
+  assert(context != NULL);
+
+  for (size_t i = 0U; i < context->session_signing_keys_count; ++i)
+  {
+    if (derivation_path_equals(&context->session_signing_keys[i].derivation_path, derivation_path))
+    {
+      cardano_ed25519_signing_context_t* signing_context = context->session_signing_keys[i].signing_context;
+
+      cardano_ed25519_signing_context_ref(signing_context);
+
+      return signing_context;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Keeps a signing key in the unlocked session so later operations can reuse it.
+ *
+ * Keys beyond `SW_SECURE_KEY_SESSION_MAX_SIGNING_KEYS` are not kept; they are derived again when needed.
+ *
+ * \param context The software secure key handler context.
+ * \param derivation_path The derivation path of the key, or NULL for the key of an Ed25519 handler.
+ * \param signing_context The signing key. The session takes its own reference.
+ */
+static void
+session_keep_signing_key(
+  software_secure_key_handler_context_t* context,
+  const cardano_derivation_path_t*       derivation_path,
+  cardano_ed25519_signing_context_t*     signing_context)
+{
+  assert(context != NULL);
+
+  if ((context->session_secret == NULL) || (context->session_signing_keys_count >= SW_SECURE_KEY_SESSION_MAX_SIGNING_KEYS))
+  {
+    return;
+  }
+
+  if (context->session_signing_keys == NULL)
+  {
+    context->session_signing_keys = (software_secure_key_handler_signing_key_t*)_cardano_malloc(
+      SW_SECURE_KEY_SESSION_MAX_SIGNING_KEYS * sizeof(software_secure_key_handler_signing_key_t));
+
+    if (context->session_signing_keys == NULL)
+    {
+      return;
+    }
+  }
+
+  software_secure_key_handler_signing_key_t* entry = &context->session_signing_keys[context->session_signing_keys_count];
+
+  CARDANO_UNUSED(memset(&entry->derivation_path, 0, sizeof(entry->derivation_path)));
+
+  if (derivation_path != NULL)
+  {
+    entry->derivation_path = *derivation_path;
+  }
+
+  cardano_ed25519_signing_context_ref(signing_context);
+
+  entry->signing_context = signing_context;
+  context->session_signing_keys_count += 1U;
+}
+
+/**
+ * \brief Derives the signing key at a derivation path from the BIP32 root key.
+ *
+ * \param root_private_key The BIP32 root private key.
+ * \param derivation_path The derivation path.
+ * \param derivation_cache The cache of intermediate nodes to derive through, or NULL to derive from the root.
+ * \param signing_context On success, the signing key. The caller must release it.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+derive_signing_key(
+  cardano_bip32_private_key_t*        root_private_key,
+  const cardano_derivation_path_t*    derivation_path,
+  cardano_bip32_derivation_cache_t*   derivation_cache,
+  cardano_ed25519_signing_context_t** signing_context)
+{
+  cardano_bip32_private_key_t*   bip32_private_key   = NULL;
+  cardano_ed25519_private_key_t* ed25519_private_key = NULL;
+
+  const uint32_t path[5] = {
+    cardano_bip32_harden((uint32_t)derivation_path->purpose),
+    cardano_bip32_harden((uint32_t)derivation_path->coin_type),
+    cardano_bip32_harden((uint32_t)derivation_path->account),
+    (uint32_t)derivation_path->role,
+    (uint32_t)derivation_path->index
+  };
+
+  cardano_error_t result = (derivation_cache != NULL)
+    ? cardano_bip32_derivation_cache_derive_private(derivation_cache, root_private_key, &path[0], 5, &bip32_private_key)
+    : cardano_bip32_private_key_derive(root_private_key, &path[0], 5, &bip32_private_key);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_bip32_private_key_to_ed25519_key(bip32_private_key, &ed25519_private_key);
+  }
+
+  cardano_bip32_private_key_unref(&bip32_private_key);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_ed25519_signing_context_new(ed25519_private_key, signing_context);
+  }
+
+  cardano_ed25519_private_key_unref(&ed25519_private_key);
+
+  return result;
+}
+
+/**
+ * \brief Releases the signing keys loaded by \ref load_bip32_signing_keys.
+ *
+ * \param signing_keys The signing keys; entries may be NULL.
+ * \param num_paths The number of entries in the array.
+ */
+static void
+free_signing_keys(cardano_ed25519_signing_context_t** signing_keys, const size_t num_paths)
+{
+  if (signing_keys == NULL)
+  {
+    return;
+  }
+
+  for (size_t i = 0U; i < num_paths; ++i)
+  {
+    cardano_ed25519_signing_context_unref(&signing_keys[i]);
+  }
+
+  _cardano_free((void*)signing_keys);
+}
+
+/**
+ * \brief Loads the signing keys for the given derivation paths.
+ *
+ * Within an unlocked session, keys the session already holds are reused, and missing ones are derived from the
+ * session's root key, through the session's derivation cache, and kept for next time. Outside a session the root key
+ * is decrypted once and every key is derived from it, sharing the common path prefixes within the call. Either way
+ * the operation is charged once to the session, regardless of the number of paths.
+ *
+ * \param context The software secure key handler context.
+ * \param derivation_paths The derivation paths.
+ * \param num_paths The number of derivation paths.
+ * \param signing_keys On success, an array of `num_paths` signing keys. Release with \ref free_signing_keys.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+load_bip32_signing_keys(
+  software_secure_key_handler_context_t*  context,
+  const cardano_derivation_path_t*        derivation_paths,
+  const size_t                            num_paths,
+  cardano_ed25519_signing_context_t***    signing_keys)
+{
+  assert(context != NULL);
+  assert(signing_keys != NULL);
+
+  *signing_keys = NULL;
+
+  if (num_paths == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_ed25519_signing_context_t** keys = (cardano_ed25519_signing_context_t**)_cardano_malloc(num_paths * sizeof(cardano_ed25519_signing_context_t*));
+
+  if (keys == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset((void*)keys, 0, num_paths * sizeof(cardano_ed25519_signing_context_t*)));
+
+  const bool                        in_session       = session_acquire(context);
+  cardano_bip32_private_key_t*      root_private_key = NULL;
+  cardano_bip32_derivation_cache_t* derivation_cache = NULL;
+  cardano_error_t                   result           = CARDANO_SUCCESS;
+
+  if (in_session)
+  {
+    if (context->session_derivation_cache == NULL)
+    {
+      // A failure here only means the session derives every path from the root.
+      const cardano_error_t cache_result = cardano_bip32_derivation_cache_new(0U, &context->session_derivation_cache);
+      CARDANO_UNUSED(cache_result);
+    }
+
+    derivation_cache = context->session_derivation_cache;
+
+    cardano_bip32_derivation_cache_ref(derivation_cache);
+  }
+  else if (num_paths > 1U)
+  {
+    const cardano_error_t cache_result = cardano_bip32_derivation_cache_new(0U, &derivation_cache);
+    CARDANO_UNUSED(cache_result);
+  }
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < num_paths); ++i)
+  {
+    if (in_session)
+    {
+      keys[i] = session_find_signing_key(context, &derivation_paths[i]);
+
+      if (keys[i] != NULL)
+      {
+        continue;
+      }
+    }
+
+    if (root_private_key == NULL)
+    {
+      result = in_session
+        ? cardano_bip32_private_key_from_bytes(context->session_secret, context->session_secret_size, &root_private_key)
+        : load_bip32_root_private_key(context, &root_private_key);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = derive_signing_key(root_private_key, &derivation_paths[i], derivation_cache, &keys[i]);
+    }
+
+    if ((result == CARDANO_SUCCESS) && in_session)
+    {
+      session_keep_signing_key(context, &derivation_paths[i], keys[i]);
+    }
+  }
+
+  cardano_bip32_derivation_cache_unref(&derivation_cache);
+
+  if (in_session)
+  {
+    session_release(context);
+  }
+
+  cardano_bip32_private_key_unref(&root_private_key);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    free_signing_keys(keys, num_paths);
+
+    return result;
+  }
+
+  *signing_keys = keys;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Loads the signing key of an Ed25519 handler, from the unlocked session if possible.
+ *
+ * \param context The software secure key handler context.
+ * \param signing_key On success, the signing key. The caller must release it.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+load_ed25519_signing_key(software_secure_key_handler_context_t* context, cardano_ed25519_signing_context_t** signing_key)
+{
+  cardano_ed25519_private_key_t* private_key = NULL;
+  cardano_error_t                result      = CARDANO_SUCCESS;
+
+  if (session_acquire(context))
+  {
+    if (context->session_signing_keys_count > 0U)
+    {
+      *signing_key = context->session_signing_keys[0].signing_context;
+
+      cardano_ed25519_signing_context_ref(*signing_key);
+    }
+    else
+    {
+      result = ed25519_private_key_from_secret(context->session_secret, context->session_secret_size, &private_key);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_ed25519_signing_context_new(private_key, signing_key);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        session_keep_signing_key(context, NULL, *signing_key);
+      }
+    }
+
+    session_release(context);
+  }
+  else
+  {
+    result = load_ed25519_private_key(context, &private_key);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_ed25519_signing_context_new(private_key, signing_key);
+    }
+  }
+
+  cardano_ed25519_private_key_unref(&private_key);
+
+  return result;
+}
+
 /**
  * \brief Deallocates a secure_key_handler object.
  *
@@ -85,6 +739,9 @@ cardano_secure_key_handler_deallocate(void* object)
 
   software_secure_key_handler_context_t* context = (software_secure_key_handler_context_t*)object;
 
+  session_wipe(context);
+  _cardano_secure_memory_pool_free(&context->secure_memory);
+
   cardano_buffer_memzero(context->encrypted_data);
   cardano_buffer_unref(&context->encrypted_data);
 
@@ -106,11 +763,19 @@ cardano_software_secure_key_handler_context_new(void)
     return NULL;
   }
 
-  data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
-  data->base.deallocator   = cardano_secure_key_handler_deallocate;
-  data->encrypted_data     = NULL;
-  data->get_passphrase     = NULL;
+  data->base.ref_count             = 1;
+  data->base.last_error            = NULL;
+  data->base.deallocator           = cardano_secure_key_handler_deallocate;
+  data->encrypted_data             = NULL;
+  data->get_passphrase             = NULL;
+  data->session_secret             = NULL;
+  data->session_secret_size        = 0U;
+  data->session_expires_at         = 0U;
+  data->session_operations_left    = 0U;
+  data->session_signing_keys       = NULL;
+  data->session_signing_keys_count = 0U;
+  data->session_derivation_cache   = NULL;
+  data->secure_memory              = NULL;
 
   return data;
 }
@@ -270,40 +935,10 @@ bip32_get_extended_account_public_key(
 
   software_secure_key_handler_context_t* context = (software_secure_key_handler_context_t*)((void*)secure_key_handler_impl->context);
 
-  byte_t passphrase[128] = { 0 };
-
-  int32_t pass_len = context->get_passphrase(&passphrase[0], sizeof(passphrase));
-
-  if ((pass_len <= 0) || (pass_len > 128))
-  {
-    sodium_memzero(passphrase, sizeof(passphrase));
-
-    return CARDANO_ERROR_INVALID_PASSPHRASE;
-  }
-
-  cardano_buffer_t* decrypted_data = NULL;
-
-  cardano_error_t result = cardano_crypto_emip3_decrypt(
-    cardano_buffer_get_data(context->encrypted_data),
-    cardano_buffer_get_size(context->encrypted_data),
-    passphrase,
-    (size_t)pass_len,
-    &decrypted_data);
-
-  sodium_memzero(&passphrase[0], sizeof(passphrase));
-
-  if (result != CARDANO_SUCCESS)
-  {
-    return result;
-  }
-
   cardano_bip32_private_key_t* root_private_key    = NULL;
   cardano_bip32_private_key_t* account_private_key = NULL;
 
-  result = cardano_bip32_private_key_from_bip39_entropy(NULL, 0, cardano_buffer_get_data(decrypted_data), cardano_buffer_get_size(decrypted_data), &root_private_key);
-
-  cardano_buffer_memzero(decrypted_data);
-  cardano_buffer_unref(&decrypted_data);
+  cardano_error_t result = load_bip32_root_private_key(context, &root_private_key);
 
   if (result != CARDANO_SUCCESS)
   {
@@ -342,39 +977,32 @@ bip32_get_extended_account_public_key(
 }
 
 /**
- * \brief Signs a transaction using BIP32 Hierarchical Deterministic (HD) keys.
+ * \brief Signs several transactions with the same set of BIP32 Hierarchical Deterministic (HD) keys.
  *
- * The `bip32_sign_transaction` function is responsible for signing a transaction by deriving the appropriate
- * BIP32 private keys using the provided derivation paths. It generates a verification key witness set that contains
- * the necessary signatures for the transaction.
- *
- * This function uses the secure key handler to access and manage the cryptographic operations necessary for deriving
- * private keys and signing the transaction.
+ * The root key is loaded (and, outside an unlocked session, decrypted) once, and every derivation path is derived
+ * once, regardless of the number of transactions. An unlocked session is charged a single operation for the batch,
+ * and keeps the derived signing keys so that later batches with the same paths skip the derivation entirely.
  *
  * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation that securely manages cryptographic operations.
- * \param[in]  tx The transaction object to be signed.
- * \param[in]  derivation_paths An array of derivation paths specifying the private keys used to sign the transaction.
+ * \param[in]  txs The transactions to be signed.
+ * \param[in]  num_txs The number of transactions in the `txs` array.
+ * \param[in]  derivation_paths An array of derivation paths specifying the private keys used to sign every transaction.
  * \param[in]  num_paths The number of derivation paths provided in the `derivation_paths` array.
- * \param[out] vkey_witness_set A pointer to the verification key witness set, which will be populated with the
- *                              signatures generated during the signing process. The caller is responsible for managing
- *                              the lifecycle of the witness set by calling `cardano_vkey_witness_set_unref` when it is no longer needed.
+ * \param[out] vkey_witness_sets An array of `num_txs` entries that receives one verification key witness set per
+ *                               transaction. On failure every entry is set to NULL.
  *
  * \returns `cardano_error_t` indicating success or the type of error encountered during the signing process.
- *
- * \note The function assumes that the necessary private keys are securely stored and managed by the key handler.
- *       The caller is responsible for ensuring that the `vkey_witness_set` is unreferenced properly to prevent memory leaks.
- *
- * \see cardano_vkey_witness_set_unref for proper memory cleanup of the witness set.
  */
 static cardano_error_t
-bip32_sign_transaction(
+bip32_sign_transactions(
   cardano_secure_key_handler_impl_t* secure_key_handler_impl,
-  cardano_transaction_t*             tx,
+  cardano_transaction_t* const*      txs,
+  const size_t                       num_txs,
   const cardano_derivation_path_t*   derivation_paths,
   const size_t                       num_paths,
-  cardano_vkey_witness_set_t**       vkey_witness_set)
+  cardano_vkey_witness_set_t**       vkey_witness_sets)
 {
-  if ((secure_key_handler_impl == NULL) || (tx == NULL) || (derivation_paths == NULL) || (vkey_witness_set == NULL))
+  if ((secure_key_handler_impl == NULL) || (txs == NULL) || (derivation_paths == NULL) || (vkey_witness_sets == NULL))
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
@@ -386,165 +1014,120 @@ bip32_sign_transaction(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_buffer_t* decrypted_data = NULL;
-
-  byte_t passphrase[128] = { 0 };
-
-  int32_t pass_len = context->get_passphrase(&passphrase[0], sizeof(passphrase));
-
-  if ((pass_len <= 0) || (pass_len > 128))
-  {
-    sodium_memzero(passphrase, sizeof(passphrase));
-
-    return CARDANO_ERROR_INVALID_PASSPHRASE;
-  }
-
-  cardano_error_t result = cardano_crypto_emip3_decrypt(
-    cardano_buffer_get_data(context->encrypted_data),
-    cardano_buffer_get_size(context->encrypted_data),
-    passphrase,
-    (size_t)pass_len,
-    &decrypted_data);
-
-  sodium_memzero(passphrase, sizeof(passphrase));
-
-  if (result != CARDANO_SUCCESS)
-  {
-    cardano_buffer_memzero(decrypted_data);
-    cardano_buffer_unref(&decrypted_data);
-
-    return result;
-  }
-
-  cardano_bip32_private_key_t* root_private_key = NULL;
-
-  result = cardano_bip32_private_key_from_bip39_entropy(NULL, 0, cardano_buffer_get_data(decrypted_data), cardano_buffer_get_size(decrypted_data), &root_private_key);
-
-  cardano_buffer_memzero(decrypted_data);
-  cardano_buffer_unref(&decrypted_data);
-
-  if (result != CARDANO_SUCCESS)
+  for (size_t i = 0U; i < num_txs; ++i)
   {
-    return result;
+    vkey_witness_sets[i] = NULL;
   }
 
-  cardano_blake2b_hash_t* hash = cardano_transaction_get_id(tx);
-
-  if (hash == NULL)
-  {
-    cardano_bip32_private_key_unref(&root_private_key);
+  cardano_ed25519_signing_context_t** signing_keys = NULL;
 
-    return CARDANO_ERROR_POINTER_IS_NULL;
-  }
-
-  result = cardano_vkey_witness_set_new(vkey_witness_set);
+  cardano_error_t result = load_bip32_signing_keys(context, derivation_paths, num_paths, &signing_keys);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_blake2b_hash_unref(&hash);
-    cardano_bip32_private_key_unref(&root_private_key);
-
     return result;
   }
 
-  for (size_t i = 0U; i < num_paths; ++i)
+  for (size_t tx_index = 0U; (result == CARDANO_SUCCESS) && (tx_index < num_txs); ++tx_index)
   {
-    cardano_ed25519_private_key_t* ed25519_private_key = NULL;
-    cardano_bip32_private_key_t*   bip32_private_key   = NULL;
-
-    const uint32_t path[5] = {
-      cardano_bip32_harden((uint32_t)derivation_paths[i].purpose),
-      cardano_bip32_harden((uint32_t)derivation_paths[i].coin_type),
-      cardano_bip32_harden((uint32_t)derivation_paths[i].account),
-      (uint32_t)derivation_paths[i].role,
-      (uint32_t)derivation_paths[i].index
-    };
-
-    result = cardano_bip32_private_key_derive(root_private_key, &path[0], 5, &bip32_private_key);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_blake2b_hash_unref(&hash);
-      cardano_vkey_witness_set_unref(vkey_witness_set);
-      cardano_bip32_private_key_unref(&root_private_key);
-
-      return result;
-    }
-
-    result = cardano_bip32_private_key_to_ed25519_key(bip32_private_key, &ed25519_private_key);
-
-    cardano_bip32_private_key_unref(&bip32_private_key);
+    cardano_blake2b_hash_t* hash = cardano_transaction_get_id(txs[tx_index]);
 
-    if (result != CARDANO_SUCCESS)
+    if (hash == NULL)
     {
-      cardano_blake2b_hash_unref(&hash);
-      cardano_vkey_witness_set_unref(vkey_witness_set);
-      cardano_bip32_private_key_unref(&root_private_key);
+      result = CARDANO_ERROR_POINTER_IS_NULL;
 
-      return result;
+      break;
     }
 
-    cardano_ed25519_signature_t*  signature  = NULL;
-    cardano_ed25519_public_key_t* public_key = NULL;
-    cardano_vkey_witness_t*       witness    = NULL;
-
-    result = cardano_ed25519_private_key_sign(ed25519_private_key, cardano_blake2b_hash_get_data(hash), cardano_blake2b_hash_get_bytes_size(hash), &signature);
+    result = cardano_vkey_witness_set_new(&vkey_witness_sets[tx_index]);
 
-    if (result != CARDANO_SUCCESS)
+    for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < num_paths); ++i)
     {
-      cardano_blake2b_hash_unref(&hash);
-      cardano_vkey_witness_set_unref(vkey_witness_set);
-      cardano_bip32_private_key_unref(&root_private_key);
+      cardano_ed25519_signature_t*  signature  = NULL;
+      cardano_ed25519_public_key_t* public_key = NULL;
+      cardano_vkey_witness_t*       witness    = NULL;
 
-      return result;
-    }
+      result = cardano_ed25519_signing_context_sign(signing_keys[i], cardano_blake2b_hash_get_data(hash), cardano_blake2b_hash_get_bytes_size(hash), &signature);
 
-    result = cardano_ed25519_private_key_get_public_key(ed25519_private_key, &public_key);
+      // Each witness gets its own copy of the public key, so witness sets of different transactions share no
+      // objects and can be consumed from different threads.
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_ed25519_signing_context_get_public_key(signing_keys[i], &public_key);
+      }
 
-    cardano_ed25519_private_key_unref(&ed25519_private_key);
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_vkey_witness_new(public_key, signature, &witness);
+      }
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_blake2b_hash_unref(&hash);
-      cardano_vkey_witness_set_unref(vkey_witness_set);
-      cardano_bip32_private_key_unref(&root_private_key);
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_vkey_witness_set_add(vkey_witness_sets[tx_index], witness);
+      }
 
-      return result;
+      cardano_vkey_witness_unref(&witness);
+      cardano_ed25519_public_key_unref(&public_key);
+      cardano_ed25519_signature_unref(&signature);
     }
 
-    result = cardano_vkey_witness_new(public_key, signature, &witness);
+    cardano_blake2b_hash_unref(&hash);
+  }
 
-    cardano_ed25519_public_key_unref(&public_key);
-    cardano_ed25519_signature_unref(&signature);
+  free_signing_keys(signing_keys, num_paths);
 
-    if (result != CARDANO_SUCCESS)
+  if (result != CARDANO_SUCCESS)
+  {
+    for (size_t i = 0U; i < num_txs; ++i)
     {
-      cardano_blake2b_hash_unref(&hash);
-      cardano_vkey_witness_unref(&witness);
-      cardano_vkey_witness_set_unref(vkey_witness_set);
-      cardano_bip32_private_key_unref(&root_private_key);
-
-      return result;
+      cardano_vkey_witness_set_unref(&vkey_witness_sets[i]);
     }
+  }
 
-    result = cardano_vkey_witness_set_add(*vkey_witness_set, witness);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_blake2b_hash_unref(&hash);
-      cardano_vkey_witness_set_unref(vkey_witness_set);
-      cardano_bip32_private_key_unref(&root_private_key);
-
-      return result;
-    }
+  return result;
+}
 
-    cardano_vkey_witness_unref(&witness);
+/**
+ * \brief Signs a transaction using BIP32 Hierarchical Deterministic (HD) keys.
+ *
+ * The `bip32_sign_transaction` function is responsible for signing a transaction by deriving the appropriate
+ * BIP32 private keys using the provided derivation paths. It generates a verification key witness set that contains
+ * the necessary signatures for the transaction.
+ *
+ * This function uses the secure key handler to access and manage the cryptographic operations necessary for deriving
+ * private keys and signing the transaction.
+ *
+ * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation that securely manages cryptographic operations.
+ * \param[in]  tx The transaction object to be signed.
+ * \param[in]  derivation_paths An array of derivation paths specifying the private keys used to sign the transaction.
+ * \param[in]  num_paths The number of derivation paths provided in the `derivation_paths` array.
+ * \param[out] vkey_witness_set A pointer to the verification key witness set, which will be populated with the
+ *                              signatures generated during the signing process. The caller is responsible for managing
+ *                              the lifecycle of the witness set by calling `cardano_vkey_witness_set_unref` when it is no longer needed.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered during the signing process.
+ *
+ * \note The function assumes that the necessary private keys are securely stored and managed by the key handler.
+ *       The caller is responsible for ensuring that the `vkey_witness_set` is unreferenced properly to prevent memory leaks.
+ *
+ * \see cardano_vkey_witness_set_unref for proper memory cleanup of the witness set.
+ */
+static cardano_error_t
+bip32_sign_transaction(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  cardano_transaction_t*             tx,
+  const cardano_derivation_path_t*   derivation_paths,
+  const size_t                       num_paths,
+  cardano_vkey_witness_set_t**       vkey_witness_set)
+{
+  if (tx == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_blake2b_hash_unref(&hash);
-  cardano_bip32_private_key_unref(&root_private_key);
+  cardano_transaction_t* const txs[1] = { tx };
 
-  return CARDANO_SUCCESS;
+  return bip32_sign_transactions(secure_key_handler_impl, &txs[0], 1U, derivation_paths, num_paths, vkey_witness_set);
 }
 
 /**
@@ -585,59 +1168,18 @@ ed25519_get_public_key(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_buffer_t* decrypted_data = NULL;
-
-  byte_t  passphrase[128] = { 0 };
-  int32_t pass_len        = context->get_passphrase(&passphrase[0], sizeof(passphrase));
-
-  if ((pass_len <= 0) || (pass_len > 128))
-  {
-    sodium_memzero(passphrase, sizeof(passphrase));
-
-    return CARDANO_ERROR_INVALID_PASSPHRASE;
-  }
-
-  cardano_error_t result = cardano_crypto_emip3_decrypt(
-    cardano_buffer_get_data(context->encrypted_data),
-    cardano_buffer_get_size(context->encrypted_data),
-    passphrase,
-    (size_t)pass_len,
-    &decrypted_data);
-
-  sodium_memzero(passphrase, sizeof(passphrase));
-
-  if (result != CARDANO_SUCCESS)
-  {
-    cardano_buffer_memzero(decrypted_data);
-    cardano_buffer_unref(&decrypted_data);
-
-    return result;
-  }
-
-  cardano_ed25519_private_key_t* ed25519_private_key = NULL;
-
-  if (cardano_buffer_get_size(decrypted_data) == 64U)
-  {
-    result = cardano_ed25519_private_key_from_extended_bytes(cardano_buffer_get_data(decrypted_data), cardano_buffer_get_size(decrypted_data), &ed25519_private_key);
-  }
-  else
-  {
-    result = cardano_ed25519_private_key_from_normal_bytes(cardano_buffer_get_data(decrypted_data), cardano_buffer_get_size(decrypted_data), &ed25519_private_key);
-  }
+  cardano_ed25519_signing_context_t* signing_key = NULL;
 
-  cardano_buffer_memzero(decrypted_data);
-  cardano_buffer_unref(&decrypted_data);
+  cardano_error_t result = load_ed25519_signing_key(context, &signing_key);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_ed25519_private_key_unref(&ed25519_private_key);
-
     return result;
   }
 
-  result = cardano_ed25519_private_key_get_public_key(ed25519_private_key, public_key);
+  result = cardano_ed25519_signing_context_get_public_key(signing_key, public_key);
 
-  cardano_ed25519_private_key_unref(&ed25519_private_key);
+  cardano_ed25519_signing_context_unref(&signing_key);
 
   return result;
 }
@@ -683,126 +1225,270 @@ ed25519_sign_transaction(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_buffer_t* decrypted_data = NULL;
+  cardano_ed25519_signing_context_t* signing_key = NULL;
+  cardano_ed25519_public_key_t*      public_key  = NULL;
+  cardano_ed25519_signature_t*       signature   = NULL;
+  cardano_vkey_witness_t*            witness     = NULL;
 
-  byte_t passphrase[128] = { 0 };
+  cardano_error_t result = load_ed25519_signing_key(context, &signing_key);
 
-  int32_t pass_len = context->get_passphrase(&passphrase[0], sizeof(passphrase));
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
 
-  if ((pass_len <= 0) || (pass_len > 128))
+  cardano_blake2b_hash_t* hash = cardano_transaction_get_id(tx);
+
+  if (hash == NULL)
   {
-    sodium_memzero(passphrase, sizeof(passphrase));
+    cardano_ed25519_signing_context_unref(&signing_key);
 
-    return CARDANO_ERROR_INVALID_PASSPHRASE;
+    return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_error_t result = cardano_crypto_emip3_decrypt(
-    cardano_buffer_get_data(context->encrypted_data),
-    cardano_buffer_get_size(context->encrypted_data),
-    passphrase,
-    (size_t)pass_len,
-    &decrypted_data);
-
-  sodium_memzero(passphrase, sizeof(passphrase));
+  result = cardano_vkey_witness_set_new(vkey_witness_set);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_buffer_memzero(decrypted_data);
-    cardano_buffer_unref(&decrypted_data);
+    cardano_blake2b_hash_unref(&hash);
+    cardano_ed25519_signing_context_unref(&signing_key);
 
     return result;
   }
 
-  cardano_ed25519_private_key_t* private_key = NULL;
-  cardano_ed25519_public_key_t*  public_key  = NULL;
-  cardano_ed25519_signature_t*   signature   = NULL;
-  cardano_vkey_witness_t*        witness     = NULL;
+  result = cardano_ed25519_signing_context_sign(signing_key, cardano_blake2b_hash_get_data(hash), cardano_blake2b_hash_get_bytes_size(hash), &signature);
+  cardano_blake2b_hash_unref(&hash);
 
-  if (cardano_buffer_get_size(decrypted_data) == 64U)
+  if (result == CARDANO_SUCCESS)
   {
-    result = cardano_ed25519_private_key_from_extended_bytes(cardano_buffer_get_data(decrypted_data), cardano_buffer_get_size(decrypted_data), &private_key);
+    result = cardano_ed25519_signing_context_get_public_key(signing_key, &public_key);
   }
-  else
+
+  cardano_ed25519_signing_context_unref(&signing_key);
+
+  if (result != CARDANO_SUCCESS)
   {
-    result = cardano_ed25519_private_key_from_normal_bytes(cardano_buffer_get_data(decrypted_data), cardano_buffer_get_size(decrypted_data), &private_key);
+    cardano_ed25519_signature_unref(&signature);
+    cardano_vkey_witness_set_unref(vkey_witness_set);
+
+    return result;
   }
 
-  cardano_buffer_memzero(decrypted_data);
-  cardano_buffer_unref(&decrypted_data);
+  result = cardano_vkey_witness_new(public_key, signature, &witness);
+
+  cardano_ed25519_public_key_unref(&public_key);
+  cardano_ed25519_signature_unref(&signature);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_ed25519_private_key_unref(&private_key);
+    cardano_vkey_witness_set_unref(vkey_witness_set);
 
     return result;
   }
 
-  cardano_blake2b_hash_t* hash = cardano_transaction_get_id(tx);
+  result = cardano_vkey_witness_set_add(*vkey_witness_set, witness);
 
-  if (hash == NULL)
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_vkey_witness_unref(&witness);
+    cardano_vkey_witness_set_unref(vkey_witness_set);
+
+    return result;
+  }
+
+  cardano_vkey_witness_unref(&witness);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Retrieves a precomputed signing key for a BIP32 derivation path.
+ *
+ * Within an unlocked session the key is served from, or kept in, the session.
+ *
+ * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[in]  derivation_path The derivation path of the signing key.
+ * \param[out] signing_context On success, the signing key. The caller must release it.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+static cardano_error_t
+bip32_get_signing_context(
+  cardano_secure_key_handler_impl_t*  secure_key_handler_impl,
+  const cardano_derivation_path_t     derivation_path,
+  cardano_ed25519_signing_context_t** signing_context)
+{
+  if ((secure_key_handler_impl == NULL) || (signing_context == NULL))
   {
-    cardano_ed25519_private_key_unref(&private_key);
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
 
+  software_secure_key_handler_context_t* context = (software_secure_key_handler_context_t*)((void*)secure_key_handler_impl->context);
+
+  if (context == NULL)
+  {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  result = cardano_vkey_witness_set_new(vkey_witness_set);
+  cardano_ed25519_signing_context_t** signing_keys = NULL;
+
+  cardano_error_t result = load_bip32_signing_keys(context, &derivation_path, 1U, &signing_keys);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_blake2b_hash_unref(&hash);
-    cardano_ed25519_private_key_unref(&private_key);
-
     return result;
   }
 
-  result = cardano_ed25519_private_key_sign(private_key, cardano_blake2b_hash_get_data(hash), cardano_blake2b_hash_get_bytes_size(hash), &signature);
-  cardano_blake2b_hash_unref(&hash);
+  // Hand the only reference over to the caller, then release the array itself.
+  *signing_context = signing_keys[0];
+  signing_keys[0]  = NULL;
 
-  if (result != CARDANO_SUCCESS)
+  free_signing_keys(signing_keys, 1U);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Retrieves a precomputed signing key for the Ed25519 key of the handler.
+ *
+ * \param[in]  secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[out] signing_context On success, the signing key. The caller must release it.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+static cardano_error_t
+ed25519_get_signing_context(
+  cardano_secure_key_handler_impl_t*  secure_key_handler_impl,
+  cardano_ed25519_signing_context_t** signing_context)
+{
+  if ((secure_key_handler_impl == NULL) || (signing_context == NULL))
   {
-    cardano_ed25519_signature_unref(&signature);
-    cardano_vkey_witness_set_unref(vkey_witness_set);
-    cardano_ed25519_private_key_unref(&private_key);
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
 
-    return result;
+  software_secure_key_handler_context_t* context = (software_secure_key_handler_context_t*)((void*)secure_key_handler_impl->context);
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  result = cardano_ed25519_private_key_get_public_key(private_key, &public_key);
+  return load_ed25519_signing_key(context, signing_context);
+}
 
-  cardano_ed25519_private_key_unref(&private_key);
+/**
+ * \brief Opens an unlocked session, keeping the decrypted key material in guarded memory.
+ *
+ * For BIP32 handlers the session holds the root private key, which also spares the BIP39 entropy to root key
+ * stretching on every operation. For Ed25519 handlers it holds the private key bytes.
+ *
+ * \param[in] secure_key_handler_impl A pointer to the secure key handler implementation.
+ * \param[in] ttl_seconds The session lifetime in seconds, or 0 for no time limit.
+ * \param[in] max_operations The number of operations served by the session, or 0 for no limit.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+static cardano_error_t
+unlock(
+  cardano_secure_key_handler_impl_t* secure_key_handler_impl,
+  const uint64_t                     ttl_seconds,
+  const uint64_t                     max_operations)
+{
+  if (secure_key_handler_impl == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
 
-  if (result != CARDANO_SUCCESS)
+  software_secure_key_handler_context_t* context = (software_secure_key_handler_context_t*)((void*)secure_key_handler_impl->context);
+
+  if (context == NULL)
   {
-    cardano_ed25519_signature_unref(&signature);
-    cardano_vkey_witness_set_unref(vkey_witness_set);
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
 
-    return result;
+  if (sodium_init() == -1)
+  {
+    return CARDANO_ERROR_GENERIC;
   }
 
-  result = cardano_vkey_witness_new(public_key, signature, &witness);
+  session_wipe(context);
 
-  cardano_ed25519_public_key_unref(&public_key);
-  cardano_ed25519_signature_unref(&signature);
+  byte_t*                      decrypted_secret = NULL;
+  size_t                       decrypted_size   = 0U;
+  cardano_bip32_private_key_t* root_private_key = NULL;
+
+  cardano_error_t result = decrypt_secret(context, &decrypted_secret, &decrypted_size);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_vkey_witness_set_unref(vkey_witness_set);
-
     return result;
   }
 
-  result = cardano_vkey_witness_set_add(*vkey_witness_set, witness);
+  const byte_t* secret      = decrypted_secret;
+  size_t        secret_size = decrypted_size;
 
-  if (result != CARDANO_SUCCESS)
+  if (secure_key_handler_impl->type == CARDANO_SECURE_KEY_HANDLER_TYPE_BIP32)
   {
-    cardano_vkey_witness_unref(&witness);
-    cardano_vkey_witness_set_unref(vkey_witness_set);
+    result = cardano_bip32_private_key_from_bip39_entropy(NULL, 0, secret, secret_size, &root_private_key);
 
-    return result;
+    if (result != CARDANO_SUCCESS)
+    {
+      release_secret(context, decrypted_secret);
+
+      return result;
+    }
+
+    secret      = cardano_bip32_private_key_get_data(root_private_key);
+    secret_size = cardano_bip32_private_key_get_bytes_size(root_private_key);
   }
 
-  cardano_vkey_witness_unref(&witness);
+  context->session_secret = (byte_t*)sodium_malloc(secret_size);
+
+  if (context->session_secret != NULL)
+  {
+    cardano_safe_memcpy(context->session_secret, secret_size, secret, secret_size);
+  }
+
+  cardano_bip32_private_key_unref(&root_private_key);
+  release_secret(context, decrypted_secret);
+
+  if (context->session_secret == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  context->session_secret_size     = secret_size;
+  context->session_expires_at      = (ttl_seconds == 0U) ? 0U : ((uint64_t)time(NULL) + ttl_seconds);
+  context->session_operations_left = (max_operations == 0U) ? SW_SECURE_KEY_SESSION_UNLIMITED_OPERATIONS : max_operations;
+
+  CARDANO_UNUSED(sodium_mprotect_noaccess(context->session_secret));
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Closes the unlocked session and wipes the key material.
+ *
+ * \param[in] secure_key_handler_impl A pointer to the secure key handler implementation.
+ *
+ * \returns `cardano_error_t` indicating success or the type of error encountered.
+ */
+static cardano_error_t
+lock(cardano_secure_key_handler_impl_t* secure_key_handler_impl)
+{
+  if (secure_key_handler_impl == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  software_secure_key_handler_context_t* context = (software_secure_key_handler_context_t*)((void*)secure_key_handler_impl->context);
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  session_wipe(context);
 
   return CARDANO_SUCCESS;
 }
@@ -871,9 +1557,14 @@ cardano_software_secure_key_handler_new(
 
   impl.bip32_get_extended_account_public_key = bip32_get_extended_account_public_key;
   impl.bip32_sign_transaction                = bip32_sign_transaction;
+  impl.bip32_sign_transactions               = bip32_sign_transactions;
+  impl.bip32_get_signing_context             = bip32_get_signing_context;
   impl.ed25519_get_public_key                = NULL;
   impl.ed25519_sign_transaction              = NULL;
+  impl.ed25519_get_signing_context           = NULL;
   impl.serialize                             = serialize;
+  impl.unlock                                = unlock;
+  impl.lock                                  = lock;
   impl.type                                  = CARDANO_SECURE_KEY_HANDLER_TYPE_BIP32;
 
   context->get_passphrase = get_passphrase;
@@ -939,9 +1630,13 @@ cardano_software_secure_key_handler_ed25519_new(
 
   impl.bip32_get_extended_account_public_key = NULL;
   impl.bip32_sign_transaction                = NULL;
+  impl.bip32_get_signing_context             = NULL;
   impl.ed25519_get_public_key                = ed25519_get_public_key;
   impl.ed25519_sign_transaction              = ed25519_sign_transaction;
+  impl.ed25519_get_signing_context           = ed25519_get_signing_context;
   impl.serialize                             = serialize;
+  impl.unlock                                = unlock;
+  impl.lock                                  = lock;
   impl.type                                  = CARDANO_SECURE_KEY_HANDLER_TYPE_ED25519;
 
   context->get_passphrase = get_passphrase;
@@ -1116,9 +1811,13 @@ cardano_software_secure_key_handler_deserialize(
       cardano_safe_memcpy(impl.name, 256, "Ed25519 Software Secure Key Handler", 256);
       impl.bip32_get_extended_account_public_key = NULL;
       impl.bip32_sign_transaction                = NULL;
+      impl.bip32_get_signing_context             = NULL;
       impl.ed25519_get_public_key                = ed25519_get_public_key;
       impl.ed25519_sign_transaction              = ed25519_sign_transaction;
+      impl.ed25519_get_signing_context           = ed25519_get_signing_context;
       impl.serialize                             = serialize;
+      impl.unlock                                = unlock;
+      impl.lock                                  = lock;
 
       context->get_passphrase = get_passphrase;
       context->encrypted_data = encrypted_data;
@@ -1134,9 +1833,14 @@ cardano_software_secure_key_handler_deserialize(
 
       impl.bip32_get_extended_account_public_key = bip32_get_extended_account_public_key;
       impl.bip32_sign_transaction                = bip32_sign_transaction;
+      impl.bip32_sign_transactions               = bip32_sign_transactions;
+      impl.bip32_get_signing_context             = bip32_get_signing_context;
       impl.ed25519_get_public_key                = NULL;
       impl.ed25519_sign_transaction              = NULL;
+      impl.ed25519_get_signing_context           = NULL;
       impl.serialize                             = serialize;
+      impl.unlock                                = unlock;
+      impl.lock                                  = lock;
 
       context->get_passphrase = get_passphrase;
       context->encrypted_data = encrypted_data;
@@ -0,0 +1,377 @@
+/**
+ * \file memory_footprint.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "memory_footprint.h"
+
+#include "allocators.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const size_t INITIAL_VISITED_CAPACITY = 64U;
+
+/* STATIC DECLARATIONS *******************************************************/
+
+/**
+ * \brief Adds the footprint of the object a public entry point was given; the cast back to the concrete type is
+ * done by the wrappers below.
+ */
+typedef void (*add_footprint_t)(const void* object, cardano_footprint_context_t* context);
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Hashes an object address into the visited set. Allocations are aligned, so the low bits carry no entropy.
+ *
+ * \param[in] object The object address.
+ * \param[in] capacity The capacity of the set, a power of two.
+ *
+ * \return The first slot to probe.
+ */
+static size_t
+visited_slot(const void* object, const size_t capacity)
+{
+  uint64_t hash = (uint64_t)(uintptr_t)object >> 4U;
+
+  hash *= 0x9E3779B97F4A7C15ULL;
+
+  return (size_t)(hash >> 32U) & (capacity - 1U);
+}
+
+/**
+ * \brief Inserts an object address into an open-addressing set, which must have a free slot.
+ *
+ * \return \c true if the address was inserted, \c false if it was already present.
+ */
+static bool
+visited_insert(const void** slots, const size_t capacity, const void* object)
+{
+  size_t slot = visited_slot(object, capacity);
+
+  while (slots[slot] != NULL)
+  {
+    if (slots[slot] == object)
+    {
+      return false;
+    }
+
+    slot = (slot + 1U) & (capacity - 1U);
+  }
+
+  slots[slot] = object;
+
+  return true;
+}
+
+/**
+ * \brief Doubles the visited set once it is half full.
+ *
+ * \return \c true on success, \c false if the set could not be grown; the computation is then marked as failed.
+ */
+static bool
+grow_visited_if_needed(cardano_footprint_context_t* context)
+{
+  if ((context->visited != NULL) && ((context->visited_count + 1U) * 2U <= context->visited_capacity))
+  {
+    return true;
+  }
+
+  const size_t new_capacity = (context->visited == NULL) ? INITIAL_VISITED_CAPACITY : (context->visited_capacity * 2U);
+  const void** slots        = (const void**)_cardano_malloc(new_capacity * sizeof(const void*));
+
+  if (slots == NULL)
+  {
+    context->failed = true;
+    return false;
+  }
+
+  CARDANO_UNUSED(memset((void*)slots, 0, new_capacity * sizeof(const void*)));
+
+  for (size_t i = 0U; i < context->visited_capacity; ++i)
+  {
+    if (context->visited[i] != NULL)
+    {
+      CARDANO_UNUSED(visited_insert(slots, new_capacity, context->visited[i]));
+    }
+  }
+
+  _cardano_free((void*)context->visited);
+
+  context->visited          = slots;
+  context->visited_capacity = new_capacity;
+
+  return true;
+}
+
+/**
+ * \brief Marks an object as counted.
+ *
+ * \return \c true if it was not counted before, \c false if it was or the computation failed.
+ */
+static bool
+mark_visited(cardano_footprint_context_t* context, const void* object)
+{
+  if (!grow_visited_if_needed(context))
+  {
+    return false;
+  }
+
+  if (!visited_insert(context->visited, context->visited_capacity, object))
+  {
+    return false;
+  }
+
+  ++context->visited_count;
+
+  return true;
+}
+
+/**
+ * \brief Runs a footprint computation from `object`.
+ *
+ * \param[in] object The root of the graph.
+ * \param[in] add_footprint Adds the footprint of the root.
+ * \param[out] footprint Receives the footprint, zeroed on failure.
+ *
+ * \return \ref CARDANO_SUCCESS, \ref CARDANO_ERROR_POINTER_IS_NULL or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+measure(const void* object, const add_footprint_t add_footprint, cardano_memory_footprint_t* footprint)
+{
+  if ((object == NULL) || (footprint == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  CARDANO_UNUSED(memset(footprint, 0, sizeof(cardano_memory_footprint_t)));
+
+  cardano_footprint_context_t context = { 0 };
+
+  context.footprint = footprint;
+
+  add_footprint(object, &context);
+
+  _cardano_free((void*)context.visited);
+
+  if (context.failed)
+  {
+    CARDANO_UNUSED(memset(footprint, 0, sizeof(cardano_memory_footprint_t)));
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+static void
+add_utxo_list(const void* object, cardano_footprint_context_t* context)
+{
+  _cardano_utxo_list_add_footprint((const cardano_utxo_list_t*)object, context);
+}
+
+static void
+add_utxo(const void* object, cardano_footprint_context_t* context)
+{
+  _cardano_utxo_add_footprint((const cardano_utxo_t*)object, context);
+}
+
+static void
+add_transaction_output(const void* object, cardano_footprint_context_t* context)
+{
+  _cardano_transaction_output_add_footprint((const cardano_transaction_output_t*)object, context);
+}
+
+static void
+add_value(const void* object, cardano_footprint_context_t* context)
+{
+  _cardano_value_add_footprint((const cardano_value_t*)object, context);
+}
+
+static void
+add_multi_asset(const void* object, cardano_footprint_context_t* context)
+{
+  _cardano_multi_asset_add_footprint((const cardano_multi_asset_t*)object, context);
+}
+
+static void
+add_address(const void* object, cardano_footprint_context_t* context)
+{
+  _cardano_address_add_footprint((const cardano_address_t*)object, context);
+}
+
+static void
+add_transaction(const void* object, cardano_footprint_context_t* context)
+{
+  _cardano_transaction_add_footprint((const cardano_transaction_t*)object, context);
+}
+
+/* DEFINITIONS ***************************************************************/
+
+bool
+_cardano_footprint_visit(
+  cardano_footprint_context_t*          context,
+  const cardano_object_t*               object,
+  const cardano_memory_footprint_type_t type,
+  const size_t                          size)
+{
+  if ((object == NULL) || context->failed || !mark_visited(context, object))
+  {
+    return false;
+  }
+
+  cardano_memory_footprint_t* footprint = context->footprint;
+
+  ++footprint->object_count;
+  footprint->refcount_overhead_bytes += offsetof(cardano_object_t, last_error);
+  footprint->last_error_bytes        += sizeof(object->last_error);
+
+  if (cardano_object_refcount(object) > 1U)
+  {
+    ++footprint->shared_object_count;
+  }
+
+  ++footprint->by_type[type].object_count;
+  _cardano_footprint_add_block(context, type, size);
+
+  if (object->last_error != NULL)
+  {
+    const size_t message_size = strlen(object->last_error) + 1U;
+
+    footprint->last_error_bytes += message_size;
+    _cardano_footprint_add_block(context, type, message_size);
+  }
+
+  return true;
+}
+
+void
+_cardano_footprint_add_block(cardano_footprint_context_t* context, const cardano_memory_footprint_type_t type, const size_t size)
+{
+  if (size == 0U)
+  {
+    return;
+  }
+
+  cardano_memory_footprint_t* footprint = context->footprint;
+
+  ++footprint->allocation_count;
+  footprint->heap_bytes                += size;
+  footprint->by_type[type].heap_bytes += size;
+}
+
+void
+_cardano_footprint_add_unmeasured(cardano_footprint_context_t* context, const cardano_object_t* object)
+{
+  if ((object == NULL) || context->failed || !mark_visited(context, object))
+  {
+    return;
+  }
+
+  ++context->footprint->unmeasured_object_count;
+}
+
+cardano_error_t
+cardano_utxo_list_get_memory_footprint(const cardano_utxo_list_t* utxo_list, cardano_memory_footprint_t* footprint)
+{
+  return measure(utxo_list, add_utxo_list, footprint);
+}
+
+cardano_error_t
+cardano_utxo_get_memory_footprint(const cardano_utxo_t* utxo, cardano_memory_footprint_t* footprint)
+{
+  return measure(utxo, add_utxo, footprint);
+}
+
+cardano_error_t
+cardano_transaction_output_get_memory_footprint(const cardano_transaction_output_t* output, cardano_memory_footprint_t* footprint)
+{
+  return measure(output, add_transaction_output, footprint);
+}
+
+cardano_error_t
+cardano_value_get_memory_footprint(const cardano_value_t* value, cardano_memory_footprint_t* footprint)
+{
+  return measure(value, add_value, footprint);
+}
+
+cardano_error_t
+cardano_multi_asset_get_memory_footprint(const cardano_multi_asset_t* multi_asset, cardano_memory_footprint_t* footprint)
+{
+  return measure(multi_asset, add_multi_asset, footprint);
+}
+
+cardano_error_t
+cardano_address_get_memory_footprint(const cardano_address_t* address, cardano_memory_footprint_t* footprint)
+{
+  return measure(address, add_address, footprint);
+}
+
+cardano_error_t
+cardano_transaction_get_memory_footprint(const cardano_transaction_t* transaction, cardano_memory_footprint_t* footprint)
+{
+  return measure(transaction, add_transaction, footprint);
+}
+
+const char*
+cardano_memory_footprint_type_to_string(const cardano_memory_footprint_type_t type)
+{
+  switch (type)
+  {
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_OTHER:
+      return "other";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION:
+      return "collection";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_BUFFER:
+      return "buffer";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_HASH:
+      return "hash";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_ASSET:
+      return "asset";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_VALUE:
+      return "value";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_ADDRESS:
+      return "address";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_TRANSACTION_INPUT:
+      return "transaction_input";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_TRANSACTION_OUTPUT:
+      return "transaction_output";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_DATUM:
+      return "datum";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_PLUTUS_DATA:
+      return "plutus_data";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_SCRIPT:
+      return "script";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_UTXO:
+      return "utxo";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_TRANSACTION:
+      return "transaction";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_WITNESS:
+      return "witness";
+    case CARDANO_MEMORY_FOOTPRINT_TYPE_AUXILIARY_DATA:
+      return "auxiliary_data";
+    default:
+      return "unknown";
+  }
+}
@@ -0,0 +1,178 @@
+/**
+ * \file memory_footprint.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_MEMORY_FOOTPRINT_INTERNAL_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_MEMORY_FOOTPRINT_INTERNAL_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/assets/asset_name.h>
+#include <cardano/assets/asset_name_map.h>
+#include <cardano/auxiliary_data/auxiliary_data.h>
+#include <cardano/buffer.h>
+#include <cardano/common/bigint.h>
+#include <cardano/common/credential.h>
+#include <cardano/common/datum.h>
+#include <cardano/common/ex_units.h>
+#include <cardano/crypto/blake2b_hash.h>
+#include <cardano/crypto/blake2b_hash_set.h>
+#include <cardano/crypto/ed25519_public_key.h>
+#include <cardano/crypto/ed25519_signature.h>
+#include <cardano/memory_footprint.h>
+#include <cardano/object.h>
+#include <cardano/plutus_data/constr_plutus_data.h>
+#include <cardano/plutus_data/plutus_data.h>
+#include <cardano/plutus_data/plutus_list.h>
+#include <cardano/plutus_data/plutus_map.h>
+#include <cardano/scripts/native_scripts/native_script.h>
+#include <cardano/scripts/plutus_scripts/plutus_v1_script.h>
+#include <cardano/scripts/plutus_scripts/plutus_v2_script.h>
+#include <cardano/scripts/plutus_scripts/plutus_v3_script.h>
+#include <cardano/scripts/script.h>
+#include <cardano/transaction_body/transaction_body.h>
+#include <cardano/transaction_body/transaction_input.h>
+#include <cardano/transaction_body/transaction_input_set.h>
+#include <cardano/transaction_body/transaction_output_list.h>
+#include <cardano/typedefs.h>
+#include <cardano/witness_set/plutus_data_set.h>
+#include <cardano/witness_set/plutus_v1_script_set.h>
+#include <cardano/witness_set/plutus_v2_script_set.h>
+#include <cardano/witness_set/plutus_v3_script_set.h>
+#include <cardano/witness_set/redeemer.h>
+#include <cardano/witness_set/redeemer_list.h>
+#include <cardano/witness_set/vkey_witness.h>
+#include <cardano/witness_set/vkey_witness_set.h>
+#include <cardano/witness_set/witness_set.h>
+
+#include "collections/array.h"
+
+/* DECLARATIONS **************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief The state of one footprint computation: the footprint being filled in and the objects already counted.
+ *
+ * Each type that can appear in a measured graph has an `_cardano_<type>_add_footprint` function, defined next to
+ * the structure it reads, that visits the object and then its children.
+ */
+typedef struct cardano_footprint_context_t
+{
+    cardano_memory_footprint_t* footprint;
+    const void**                visited;
+    size_t                      visited_count;
+    size_t                      visited_capacity;
+    bool                        failed;
+} cardano_footprint_context_t;
+
+/**
+ * \brief Adds the footprint of an element of a \ref cardano_array_t.
+ */
+typedef void (*cardano_footprint_item_t)(const cardano_object_t* item, cardano_footprint_context_t* context);
+
+/**
+ * \brief Counts an object of `size` bytes, the size of its structure, unless it was already counted.
+ *
+ * \param[in] context The computation.
+ * \param[in] object The object, or NULL.
+ * \param[in] type The type the object is counted under.
+ * \param[in] size The size of the object's structure.
+ *
+ * \return \c true if the object was counted now, and its children should be visited; \c false if it is NULL, was
+ *         already counted, or the computation failed.
+ */
+bool _cardano_footprint_visit(cardano_footprint_context_t* context, const cardano_object_t* object, cardano_memory_footprint_type_t type, size_t size);
+
+/**
+ * \brief Counts a heap block that is not an object, such as the storage of a buffer or an optional integer field.
+ *
+ * \param[in] context The computation.
+ * \param[in] type The type the block is counted under.
+ * \param[in] size The size of the block. Zero-sized blocks are not counted.
+ */
+void _cardano_footprint_add_block(cardano_footprint_context_t* context, cardano_memory_footprint_type_t type, size_t size);
+
+/**
+ * \brief Records an object the computation does not descend into.
+ *
+ * \param[in] context The computation.
+ * \param[in] object The object, or NULL.
+ */
+void _cardano_footprint_add_unmeasured(cardano_footprint_context_t* context, const cardano_object_t* object);
+
+/**
+ * \brief Adds an array, its storage, and each of its elements through `add_item`.
+ *
+ * \param[in] array The array, or NULL.
+ * \param[in] context The computation.
+ * \param[in] add_item Adds one element. If NULL, the elements are recorded as unmeasured.
+ */
+void _cardano_array_add_footprint(const cardano_array_t* array, cardano_footprint_context_t* context, cardano_footprint_item_t add_item);
+
+void _cardano_buffer_add_footprint(const cardano_buffer_t* buffer, cardano_footprint_context_t* context);
+void _cardano_blake2b_hash_add_footprint(const cardano_blake2b_hash_t* hash, cardano_footprint_context_t* context);
+void _cardano_blake2b_hash_set_add_footprint(const cardano_blake2b_hash_set_t* set, cardano_footprint_context_t* context);
+void _cardano_bigint_add_footprint(const cardano_bigint_t* bigint, cardano_footprint_context_t* context);
+void _cardano_asset_name_add_footprint(const cardano_asset_name_t* asset_name, cardano_footprint_context_t* context);
+void _cardano_asset_name_map_add_footprint(const cardano_asset_name_map_t* asset_name_map, cardano_footprint_context_t* context);
+void _cardano_multi_asset_add_footprint(const cardano_multi_asset_t* multi_asset, cardano_footprint_context_t* context);
+void _cardano_value_add_footprint(const cardano_value_t* value, cardano_footprint_context_t* context);
+void _cardano_credential_add_footprint(const cardano_credential_t* credential, cardano_footprint_context_t* context);
+void _cardano_address_add_footprint(const cardano_address_t* address, cardano_footprint_context_t* context);
+void _cardano_plutus_data_add_footprint(const cardano_plutus_data_t* plutus_data, cardano_footprint_context_t* context);
+void _cardano_plutus_list_add_footprint(const cardano_plutus_list_t* plutus_list, cardano_footprint_context_t* context);
+void _cardano_plutus_map_add_footprint(const cardano_plutus_map_t* plutus_map, cardano_footprint_context_t* context);
+void _cardano_constr_plutus_data_add_footprint(const cardano_constr_plutus_data_t* constr, cardano_footprint_context_t* context);
+void _cardano_datum_add_footprint(const cardano_datum_t* datum, cardano_footprint_context_t* context);
+void _cardano_native_script_add_footprint(const cardano_native_script_t* native_script, cardano_footprint_context_t* context);
+void _cardano_plutus_v1_script_add_footprint(const cardano_plutus_v1_script_t* script, cardano_footprint_context_t* context);
+void _cardano_plutus_v2_script_add_footprint(const cardano_plutus_v2_script_t* script, cardano_footprint_context_t* context);
+void _cardano_plutus_v3_script_add_footprint(const cardano_plutus_v3_script_t* script, cardano_footprint_context_t* context);
+void _cardano_script_add_footprint(const cardano_script_t* script, cardano_footprint_context_t* context);
+void _cardano_transaction_input_add_footprint(const cardano_transaction_input_t* input, cardano_footprint_context_t* context);
+void _cardano_transaction_input_set_add_footprint(const cardano_transaction_input_set_t* set, cardano_footprint_context_t* context);
+void _cardano_transaction_output_add_footprint(const cardano_transaction_output_t* output, cardano_footprint_context_t* context);
+void _cardano_transaction_output_list_add_footprint(const cardano_transaction_output_list_t* list, cardano_footprint_context_t* context);
+void _cardano_utxo_add_footprint(const cardano_utxo_t* utxo, cardano_footprint_context_t* context);
+void _cardano_utxo_list_add_footprint(const cardano_utxo_list_t* utxo_list, cardano_footprint_context_t* context);
+void _cardano_ex_units_add_footprint(const cardano_ex_units_t* ex_units, cardano_footprint_context_t* context);
+void _cardano_ed25519_public_key_add_footprint(const cardano_ed25519_public_key_t* key, cardano_footprint_context_t* context);
+void _cardano_ed25519_signature_add_footprint(const cardano_ed25519_signature_t* signature, cardano_footprint_context_t* context);
+void _cardano_vkey_witness_add_footprint(const cardano_vkey_witness_t* witness, cardano_footprint_context_t* context);
+void _cardano_vkey_witness_set_add_footprint(const cardano_vkey_witness_set_t* set, cardano_footprint_context_t* context);
+void _cardano_redeemer_add_footprint(const cardano_redeemer_t* redeemer, cardano_footprint_context_t* context);
+void _cardano_redeemer_list_add_footprint(const cardano_redeemer_list_t* list, cardano_footprint_context_t* context);
+void _cardano_plutus_data_set_add_footprint(const cardano_plutus_data_set_t* set, cardano_footprint_context_t* context);
+void _cardano_plutus_v1_script_set_add_footprint(const cardano_plutus_v1_script_set_t* set, cardano_footprint_context_t* context);
+void _cardano_plutus_v2_script_set_add_footprint(const cardano_plutus_v2_script_set_t* set, cardano_footprint_context_t* context);
+void _cardano_plutus_v3_script_set_add_footprint(const cardano_plutus_v3_script_set_t* set, cardano_footprint_context_t* context);
+void _cardano_witness_set_add_footprint(const cardano_witness_set_t* witness_set, cardano_footprint_context_t* context);
+void _cardano_auxiliary_data_add_footprint(const cardano_auxiliary_data_t* auxiliary_data, cardano_footprint_context_t* context);
+void _cardano_transaction_body_add_footprint(const cardano_transaction_body_t* body, cardano_footprint_context_t* context);
+void _cardano_transaction_add_footprint(const cardano_transaction_t* transaction, cardano_footprint_context_t* context);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_MEMORY_FOOTPRINT_INTERNAL_H
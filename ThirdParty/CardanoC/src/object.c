@@ -26,31 +26,175 @@
 #include <assert.h>
 #include <string.h>
 
+#include "./allocators.h"
 #include "./config.h"
 #include "./string_safe.h"
 
+#if defined(LIB_CARDANO_C_ATOMIC_REFCOUNT) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The top bit of the reference count word marks the object as frozen.
+ *
+ * Constructors initialize the word to the initial count, so objects start unfrozen without touching them.
+ */
+static const size_t FROZEN_FLAG = (size_t)1U << ((sizeof(size_t) * 8U) - 1U);
+
+/**
+ * \brief The longest error message kept, including the null terminator.
+ */
+static const size_t LAST_ERROR_MAX_SIZE = 1024U;
+
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
- * Copies a null-terminated string into a buffer safely using memcpy.
+ * \brief Releases the error message of an object, if it has one.
  *
- * @param dest Destination buffer where the string is copied.
- * @param src Source string to be copied.
- * @param maxDestSize Maximum size of the destination buffer.
+ * \param object The object.
  */
 static void
-safe_string_copy(char* dest, const char* src, const size_t max_dest_size)
+release_last_error(cardano_object_t* object)
+{
+  assert(object != NULL);
+
+  if (object->last_error != NULL)
+  {
+    _cardano_free(object->last_error);
+    object->last_error = NULL;
+  }
+}
+
+#ifdef LIB_CARDANO_C_ATOMIC_REFCOUNT
+
+/**
+ * \brief Atomically replaces the reference count if it still holds the expected value.
+ *
+ * \param ref_count The reference count to update.
+ * \param expected The value the reference count must hold.
+ * \param desired The value to store.
+ *
+ * \return The value the reference count held before the call; the update happened if it equals `expected`.
+ */
+static size_t
+compare_exchange_ref_count(size_t* ref_count, const size_t expected, const size_t desired)
 {
-  assert(dest != NULL);
-  assert(src != NULL);
-  assert(max_dest_size > 0U);
+#if defined(_MSC_VER) && defined(_WIN64)
+  return (size_t)_InterlockedCompareExchange64((volatile __int64*)ref_count, (__int64)desired, (__int64)expected);
+#elif defined(_MSC_VER)
+  return (size_t)_InterlockedCompareExchange((volatile long*)ref_count, (long)desired, (long)expected);
+#else
+  size_t previous = expected;
+
+  (void)__atomic_compare_exchange_n(ref_count, &previous, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+
+  return previous;
+#endif
+}
+
+#endif
 
-  const size_t src_length = cardano_safe_strlen(src, max_dest_size);
-  const size_t copy_size  = (src_length < (max_dest_size - 1U)) ? src_length : (max_dest_size - 1U);
+/**
+ * \brief Reads a reference count word.
+ *
+ * \param ref_count The reference count to read.
+ *
+ * \return The current value of the word, including the \ref FROZEN_FLAG bit.
+ */
+static size_t
+load_ref_count(const size_t* ref_count)
+{
+#if !defined(LIB_CARDANO_C_ATOMIC_REFCOUNT)
+  return *ref_count;
+#elif defined(_MSC_VER)
+  return *(const volatile size_t*)ref_count;
+#else
+  return __atomic_load_n(ref_count, __ATOMIC_RELAXED);
+#endif
+}
 
-  cardano_safe_memcpy(dest, max_dest_size, src, copy_size);
+/**
+ * \brief Increments a reference count.
+ *
+ * Taking a new reference requires holding one already, so the increment needs no ordering.
+ *
+ * \param ref_count The reference count to increment.
+ */
+static void
+increment_ref_count(size_t* ref_count)
+{
+#if !defined(LIB_CARDANO_C_ATOMIC_REFCOUNT)
+  *ref_count += 1U;
+#elif defined(_MSC_VER) && defined(_WIN64)
+  (void)_InterlockedIncrement64((volatile __int64*)ref_count);
+#elif defined(_MSC_VER)
+  (void)_InterlockedIncrement((volatile long*)ref_count);
+#else
+  (void)__atomic_fetch_add(ref_count, 1U, __ATOMIC_RELAXED);
+#endif
+}
 
-  dest[copy_size] = '\0';
+/**
+ * \brief Sets the \ref FROZEN_FLAG bit of a reference count word.
+ *
+ * With atomic reference counting the update has release semantics, so a thread that sees the object as frozen also
+ * sees every write made to it before it was frozen.
+ *
+ * \param ref_count The reference count word to update.
+ */
+static void
+set_frozen_flag(size_t* ref_count)
+{
+#if !defined(LIB_CARDANO_C_ATOMIC_REFCOUNT)
+  *ref_count |= FROZEN_FLAG;
+#elif defined(_MSC_VER) && defined(_WIN64)
+  (void)_InterlockedOr64((volatile __int64*)ref_count, (__int64)FROZEN_FLAG);
+#elif defined(_MSC_VER)
+  (void)_InterlockedOr((volatile long*)ref_count, (long)FROZEN_FLAG);
+#else
+  (void)__atomic_fetch_or(ref_count, FROZEN_FLAG, __ATOMIC_RELEASE);
+#endif
+}
+
+/**
+ * \brief Decrements a reference count that is not already zero, preserving the \ref FROZEN_FLAG bit.
+ *
+ * With atomic reference counting the update has acquire-release semantics, so the thread that drops the count to zero
+ * observes every write made by the threads that released their references before it.
+ *
+ * \param ref_count The reference count to decrement.
+ *
+ * \return The reference count after the decrement.
+ */
+static size_t
+decrement_ref_count(size_t* ref_count)
+{
+#ifdef LIB_CARDANO_C_ATOMIC_REFCOUNT
+  size_t current = load_ref_count(ref_count);
+
+  while ((current & ~FROZEN_FLAG) > 0U)
+  {
+    const size_t previous = compare_exchange_ref_count(ref_count, current, current - 1U);
+
+    if (previous == current)
+    {
+      return (current - 1U) & ~FROZEN_FLAG;
+    }
+
+    current = previous;
+  }
+
+  return 0U;
+#else
+  if ((*ref_count & ~FROZEN_FLAG) > 0U)
+  {
+    *ref_count -= 1U;
+  }
+
+  return *ref_count & ~FROZEN_FLAG;
+#endif
 }
 
 /* DEFINITIONS ****************************************************************/
@@ -65,14 +209,10 @@ cardano_object_unref(cardano_object_t** object)
 
   cardano_object_t* reference = *object;
 
-  if (reference->ref_count > 0U)
-  {
-    reference->ref_count -= 1U;
-  }
-
-  if (reference->ref_count == 0U)
+  if (decrement_ref_count(&reference->ref_count) == 0U)
   {
     assert(reference->deallocator != NULL);
+    release_last_error(reference);
     reference->deallocator(reference);
     *object = NULL;
   }
@@ -86,7 +226,7 @@ cardano_object_ref(cardano_object_t* object)
     return;
   }
 
-  object->ref_count += 1U;
+  increment_ref_count(&object->ref_count);
 }
 
 size_t
@@ -97,16 +237,77 @@ cardano_object_refcount(const cardano_object_t* object)
     return 0;
   }
 
-  return object->ref_count;
+  return load_ref_count(&object->ref_count) & ~FROZEN_FLAG;
+}
+
+void
+cardano_object_freeze(cardano_object_t* object)
+{
+  if (object == NULL)
+  {
+    return;
+  }
+
+  set_frozen_flag(&object->ref_count);
+}
+
+bool
+cardano_object_is_frozen(const cardano_object_t* object)
+{
+  if (object == NULL)
+  {
+    return false;
+  }
+
+#if defined(LIB_CARDANO_C_ATOMIC_REFCOUNT) && !defined(_MSC_VER)
+  return (__atomic_load_n(&object->ref_count, __ATOMIC_ACQUIRE) & FROZEN_FLAG) != 0U;
+#else
+  return (load_ref_count(&object->ref_count) & FROZEN_FLAG) != 0U;
+#endif
+}
+
+bool
+cardano_object_is_refcount_atomic(void)
+{
+#ifdef LIB_CARDANO_C_ATOMIC_REFCOUNT
+  return true;
+#else
+  return false;
+#endif
 }
 
 void
 cardano_object_set_last_error(cardano_object_t* object, const char* message)
 {
-  if ((object != NULL) && (message != NULL))
+  if ((object == NULL) || (message == NULL) || (message == object->last_error))
   {
-    safe_string_copy(object->last_error, message, sizeof(object->last_error));
+    return;
   }
+
+  const size_t length = cardano_safe_strlen(message, LAST_ERROR_MAX_SIZE - 1U);
+
+  if (length == 0U)
+  {
+    release_last_error(object);
+    return;
+  }
+
+  // Reuse the current message storage when the new message fits in it; failures tend to repeat the same message
+  if ((object->last_error == NULL) || (cardano_safe_strlen(object->last_error, LAST_ERROR_MAX_SIZE) < length))
+  {
+    release_last_error(object);
+
+    object->last_error = (char*)_cardano_malloc_alongside(object, length + 1U);
+
+    if (object->last_error == NULL)
+    {
+      return;
+    }
+  }
+
+  cardano_safe_memcpy(object->last_error, length + 1U, message, length);
+
+  object->last_error[length] = '\0';
 }
 
 const char*
@@ -117,5 +318,5 @@ cardano_object_get_last_error(const cardano_object_t* object)
     return "Object is NULL.";
   }
 
-  return object->last_error;
+  return (object->last_error != NULL) ? object->last_error : "";
 }
\ No newline at end of file
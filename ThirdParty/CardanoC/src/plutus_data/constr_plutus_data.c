@@ -27,6 +27,7 @@
 
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
@@ -154,7 +155,7 @@ cardano_constr_plutus_data_new(
 
   (*constr_plutus_data)->base.deallocator   = cardano_constr_plutus_data_deallocate;
   (*constr_plutus_data)->base.ref_count     = 1;
-  (*constr_plutus_data)->base.last_error[0] = '\0';
+  (*constr_plutus_data)->base.last_error    = NULL;
   (*constr_plutus_data)->cbor_cache         = NULL;
 
   (*constr_plutus_data)->alternative = alternative;
@@ -516,3 +517,15 @@ cardano_constr_plutus_data_get_last_error(const cardano_constr_plutus_data_t* co
 {
   return cardano_object_get_last_error(&constr_plutus_data->base);
 }
+
+void
+_cardano_constr_plutus_data_add_footprint(const cardano_constr_plutus_data_t* constr, cardano_footprint_context_t* context)
+{
+  if ((constr == NULL) || !_cardano_footprint_visit(context, &constr->base, CARDANO_MEMORY_FOOTPRINT_TYPE_PLUTUS_DATA, sizeof(cardano_constr_plutus_data_t)))
+  {
+    return;
+  }
+
+  _cardano_plutus_list_add_footprint(constr->data, context);
+  _cardano_buffer_add_footprint(constr->cbor_cache, context);
+}
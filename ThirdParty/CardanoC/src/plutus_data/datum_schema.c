@@ -0,0 +1,805 @@
+/**
+ * \file datum_schema.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/buffer.h>
+#include <cardano/cbor/cbor_tag.h>
+#include <cardano/common/bigint.h>
+#include <cardano/plutus_data/datum_schema.h>
+
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const uint64_t GENERAL_FORM_TAG       = 102U; // cppcheck-suppress misra-c2012-8.9
+static const uint64_t ALTERNATIVE_TAG_OFFSET = 7U;   // cppcheck-suppress misra-c2012-8.9
+static const uint64_t FALSE_ALTERNATIVE      = 0U;   // cppcheck-suppress misra-c2012-8.9
+static const uint64_t TRUE_ALTERNATIVE       = 1U;   // cppcheck-suppress misra-c2012-8.9
+static const uint64_t JUST_ALTERNATIVE       = 0U;   // cppcheck-suppress misra-c2012-8.9
+static const uint64_t NOTHING_ALTERNATIVE    = 1U;   // cppcheck-suppress misra-c2012-8.9
+
+/* STATIC FUNCTIONS FORWARD DECLARATIONS *************************************/
+
+static cardano_error_t write_field(const cardano_datum_field_t* field, const byte_t* value, cardano_cbor_writer_t* writer);
+static cardano_error_t read_field(const cardano_datum_field_t* field, cardano_cbor_reader_t* reader, byte_t* value);
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Writes the tag of a constructor and opens its field array.
+ *
+ * \param[in] alternative The constructor alternative.
+ * \param[in] field_count The number of fields that follow.
+ * \param[in] writer The writer.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of the writer.
+ */
+static cardano_error_t
+write_constr_start(const uint64_t alternative, const size_t field_count, cardano_cbor_writer_t* writer)
+{
+  uint64_t tag = GENERAL_FORM_TAG;
+
+  if (alternative <= 6U)
+  {
+    tag = 121U + alternative;
+  }
+  else if (alternative <= 127U)
+  {
+    tag = 1280U - ALTERNATIVE_TAG_OFFSET + alternative;
+  }
+  else
+  {
+    // Handled below.
+  }
+
+  cardano_error_t result = cardano_cbor_writer_write_tag(writer, tag);
+
+  if ((result == CARDANO_SUCCESS) && (tag == GENERAL_FORM_TAG))
+  {
+    result = cardano_cbor_writer_write_start_array(writer, 2);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_writer_write_uint(writer, alternative);
+    }
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  // Non-empty field lists are written with indefinite length, as plutus lists are.
+  return cardano_cbor_writer_write_start_array(writer, (field_count > 0U) ? -1 : 0);
+}
+
+/**
+ * \brief Closes the field array opened by \ref write_constr_start.
+ *
+ * \param[in] field_count The number of fields written.
+ * \param[in] writer The writer.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of the writer.
+ */
+static cardano_error_t
+write_constr_end(const size_t field_count, cardano_cbor_writer_t* writer)
+{
+  if (field_count == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  return cardano_cbor_writer_write_end_array(writer);
+}
+
+/**
+ * \brief Writes the fields of a schema as a constructor.
+ *
+ * \param[in] schema The schema.
+ * \param[in] value The struct.
+ * \param[in] writer The writer.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the first error encountered.
+ */
+static cardano_error_t
+write_constr(const cardano_datum_schema_t* schema, const byte_t* value, cardano_cbor_writer_t* writer)
+{
+  if ((schema->fields == NULL) && (schema->field_count > 0U))
+  {
+    cardano_cbor_writer_set_last_error(writer, "Datum schema has fields but no field descriptors.");
+    return CARDANO_ERROR_ENCODING;
+  }
+
+  cardano_error_t result = write_constr_start(schema->alternative, schema->field_count, writer);
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < schema->field_count); ++i)
+  {
+    // cppcheck-suppress misra-c2012-17.2; Reason: Schemas nest as deep as the structs they describe.
+    result = write_field(&schema->fields[i], value, writer);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return write_constr_end(schema->field_count, writer);
+}
+
+/**
+ * \brief Writes one field of a struct.
+ *
+ * \param[in] field The field descriptor.
+ * \param[in] value The struct holding the field.
+ * \param[in] writer The writer.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the first error encountered.
+ */
+static cardano_error_t
+write_field(const cardano_datum_field_t* field, const byte_t* value, cardano_cbor_writer_t* writer)
+{
+  const byte_t* member = &value[field->offset];
+
+  switch (field->type)
+  {
+    case CARDANO_DATUM_FIELD_TYPE_INTEGER:
+    {
+      int64_t integer = 0;
+
+      (void)memcpy(&integer, member, sizeof(integer));
+
+      if (integer < 0)
+      {
+        return cardano_cbor_writer_write_signed_int(writer, integer);
+      }
+
+      return cardano_cbor_writer_write_uint(writer, (uint64_t)integer);
+    }
+    case CARDANO_DATUM_FIELD_TYPE_UNSIGNED_INTEGER:
+    {
+      uint64_t integer = 0U;
+
+      (void)memcpy(&integer, member, sizeof(integer));
+
+      return cardano_cbor_writer_write_uint(writer, integer);
+    }
+    case CARDANO_DATUM_FIELD_TYPE_BYTES:
+    {
+      const cardano_datum_bytes_t* bytes = (const cardano_datum_bytes_t*)((const void*)member);
+
+      if (bytes->size > CARDANO_DATUM_BYTES_MAX_SIZE)
+      {
+        cardano_cbor_writer_set_last_error(writer, "Datum byte string is longer than CARDANO_DATUM_BYTES_MAX_SIZE.");
+        return CARDANO_ERROR_ENCODING;
+      }
+
+      return cardano_cbor_writer_write_bytestring(writer, bytes->data, bytes->size);
+    }
+    case CARDANO_DATUM_FIELD_TYPE_BOOL:
+    {
+      bool flag = false;
+
+      (void)memcpy(&flag, member, sizeof(flag));
+
+      return write_constr_start(flag ? TRUE_ALTERNATIVE : FALSE_ALTERNATIVE, 0U, writer);
+    }
+    case CARDANO_DATUM_FIELD_TYPE_CONSTR:
+    {
+      if (field->schema == NULL)
+      {
+        cardano_cbor_writer_set_last_error(writer, "Datum constructor field has no schema.");
+        return CARDANO_ERROR_ENCODING;
+      }
+
+      // cppcheck-suppress misra-c2012-17.2; Reason: Schemas nest as deep as the structs they describe.
+      return write_constr(field->schema, member, writer);
+    }
+    case CARDANO_DATUM_FIELD_TYPE_OPTION:
+    {
+      bool present = false;
+
+      if (field->item == NULL)
+      {
+        cardano_cbor_writer_set_last_error(writer, "Datum option field has no item field.");
+        return CARDANO_ERROR_ENCODING;
+      }
+
+      (void)memcpy(&present, member, sizeof(present));
+
+      if (!present)
+      {
+        return write_constr_start(NOTHING_ALTERNATIVE, 0U, writer);
+      }
+
+      cardano_error_t result = write_constr_start(JUST_ALTERNATIVE, 1U, writer);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        // cppcheck-suppress misra-c2012-17.2; Reason: Schemas nest as deep as the structs they describe.
+        result = write_field(field->item, value, writer);
+      }
+
+      if (result != CARDANO_SUCCESS)
+      {
+        return result;
+      }
+
+      return write_constr_end(1U, writer);
+    }
+    default:
+    {
+      cardano_cbor_writer_set_last_error(writer, "Unknown datum field type.");
+      return CARDANO_ERROR_ENCODING;
+    }
+  }
+}
+
+/**
+ * \brief Reads the tag of a constructor and opens its field array.
+ *
+ * \param[in] reader The reader.
+ * \param[out] alternative The constructor alternative.
+ * \param[out] length The length of the field array, or -1 if it has indefinite length.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a decoding error if the next value is not a constructor.
+ */
+static cardano_error_t
+read_constr_start(cardano_cbor_reader_t* reader, uint64_t* alternative, int64_t* length)
+{
+  cardano_cbor_reader_state_t state  = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  cardano_error_t             result = cardano_cbor_reader_peek_state(reader, &state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (state != CARDANO_CBOR_READER_STATE_TAG)
+  {
+    cardano_cbor_reader_set_last_error(reader, "Expected a plutus data constructor.");
+    return CARDANO_ERROR_UNEXPECTED_CBOR_TYPE;
+  }
+
+  cardano_cbor_tag_t tag = 0;
+
+  result = cardano_cbor_reader_read_tag(reader, &tag);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if ((uint64_t)tag == GENERAL_FORM_TAG)
+  {
+    int64_t group_size = 0;
+
+    result = cardano_cbor_reader_read_start_array(reader, &group_size);
+
+    if ((result == CARDANO_SUCCESS) && (group_size != 2))
+    {
+      cardano_cbor_reader_set_last_error(reader, "There was an error decoding 'constr_plutus_data', expected an array of 2 elements.");
+      result = CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE;
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_read_uint(reader, alternative);
+    }
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+  else if (((uint64_t)tag >= 121U) && ((uint64_t)tag <= 127U))
+  {
+    *alternative = (uint64_t)tag - 121U;
+  }
+  else if (((uint64_t)tag >= 1280U) && ((uint64_t)tag <= 1400U))
+  {
+    *alternative = ((uint64_t)tag - 1280U) + ALTERNATIVE_TAG_OFFSET;
+  }
+  else
+  {
+    cardano_cbor_reader_set_last_error(reader, "Expected a plutus data constructor tag.");
+    return CARDANO_ERROR_DECODING;
+  }
+
+  return cardano_cbor_reader_read_start_array(reader, length);
+}
+
+/**
+ * \brief Reads the tag of a constructor with a known alternative and number of fields.
+ *
+ * \param[in] reader The reader.
+ * \param[in] alternative The expected alternative.
+ * \param[in] field_count The expected number of fields.
+ *
+ * \return \ref CARDANO_SUCCESS if the constructor matches, or a decoding error.
+ */
+static cardano_error_t
+read_expected_constr_start(cardano_cbor_reader_t* reader, const uint64_t alternative, const size_t field_count)
+{
+  uint64_t actual = 0U;
+  int64_t  length = 0;
+
+  cardano_error_t result = read_constr_start(reader, &actual, &length);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (actual != alternative)
+  {
+    cardano_cbor_reader_set_last_error(reader, "Plutus data constructor alternative does not match the datum schema.");
+    return CARDANO_ERROR_DECODING;
+  }
+
+  if ((length >= 0) && ((uint64_t)length != (uint64_t)field_count))
+  {
+    cardano_cbor_reader_set_last_error(reader, "Plutus data constructor field count does not match the datum schema.");
+    return CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Closes the field array of a constructor, checking that no fields are left.
+ *
+ * \param[in] reader The reader.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a decoding error if the constructor has more fields than expected.
+ */
+static cardano_error_t
+read_constr_end(cardano_cbor_reader_t* reader)
+{
+  cardano_cbor_reader_state_t state  = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  cardano_error_t             result = cardano_cbor_reader_peek_state(reader, &state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (state != CARDANO_CBOR_READER_STATE_END_ARRAY)
+  {
+    cardano_cbor_reader_set_last_error(reader, "Plutus data constructor field count does not match the datum schema.");
+    return CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE;
+  }
+
+  return cardano_cbor_reader_read_end_array(reader);
+}
+
+/**
+ * \brief Reads a plutus integer, accepting big number tags whose value fits 64 bits.
+ *
+ * \param[in] reader The reader.
+ * \param[in] is_signed Whether the destination is an `int64_t`; otherwise it is a `uint64_t`.
+ * \param[out] member The destination.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error if the value is not an integer or does not fit.
+ */
+static cardano_error_t
+read_integer(cardano_cbor_reader_t* reader, const bool is_signed, byte_t* member)
+{
+  cardano_cbor_reader_state_t state  = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  cardano_error_t             result = cardano_cbor_reader_peek_state(reader, &state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  int64_t  signed_value   = 0;
+  uint64_t unsigned_value = 0U;
+  bool     negative       = false;
+
+  switch (state)
+  {
+    case CARDANO_CBOR_READER_STATE_UNSIGNED_INTEGER:
+    {
+      result = cardano_cbor_reader_read_uint(reader, &unsigned_value);
+      break;
+    }
+    case CARDANO_CBOR_READER_STATE_NEGATIVE_INTEGER:
+    {
+      result   = cardano_cbor_reader_read_int(reader, &signed_value);
+      negative = true;
+
+      // The reader wraps values below INT64_MIN around to non-negative ones.
+      if ((result == CARDANO_SUCCESS) && (signed_value >= 0))
+      {
+        cardano_cbor_reader_set_last_error(reader, "Plutus data integer does not fit in 64 bits.");
+        result = CARDANO_ERROR_INTEGER_OVERFLOW;
+      }
+
+      break;
+    }
+    case CARDANO_CBOR_READER_STATE_TAG:
+    {
+      cardano_bigint_t* bigint = NULL;
+
+      result = cardano_cbor_reader_read_bigint(reader, &bigint);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        break;
+      }
+
+      negative = cardano_bigint_signum(bigint) < 0;
+
+      if (cardano_bigint_bit_length(bigint) > (negative ? 63U : 64U))
+      {
+        cardano_cbor_reader_set_last_error(reader, "Plutus data integer does not fit in 64 bits.");
+        result = CARDANO_ERROR_INTEGER_OVERFLOW;
+      }
+      else if (negative)
+      {
+        signed_value = cardano_bigint_to_int(bigint);
+      }
+      else
+      {
+        unsigned_value = cardano_bigint_to_unsigned_int(bigint);
+      }
+
+      cardano_bigint_unref(&bigint);
+      break;
+    }
+    default:
+    {
+      cardano_cbor_reader_set_last_error(reader, "Expected a plutus data integer.");
+      result = CARDANO_ERROR_UNEXPECTED_CBOR_TYPE;
+      break;
+    }
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (is_signed)
+  {
+    if (!negative)
+    {
+      if (unsigned_value > (uint64_t)INT64_MAX)
+      {
+        cardano_cbor_reader_set_last_error(reader, "Plutus data integer does not fit in an int64_t.");
+        return CARDANO_ERROR_INTEGER_OVERFLOW;
+      }
+
+      signed_value = (int64_t)unsigned_value;
+    }
+
+    (void)memcpy(member, &signed_value, sizeof(signed_value));
+
+    return CARDANO_SUCCESS;
+  }
+
+  if (negative)
+  {
+    cardano_cbor_reader_set_last_error(reader, "Plutus data integer is negative but the datum schema expects an unsigned integer.");
+    return CARDANO_ERROR_INTEGER_UNDERFLOW;
+  }
+
+  (void)memcpy(member, &unsigned_value, sizeof(unsigned_value));
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Reads a plutus byte string into a \ref cardano_datum_bytes_t.
+ *
+ * \param[in] reader The reader.
+ * \param[out] bytes The destination.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error if the value is not a byte string or is too long.
+ */
+static cardano_error_t
+read_bytes(cardano_cbor_reader_t* reader, cardano_datum_bytes_t* bytes)
+{
+  cardano_cbor_reader_state_t state  = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  cardano_error_t             result = cardano_cbor_reader_peek_state(reader, &state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (state == CARDANO_CBOR_READER_STATE_BYTESTRING)
+  {
+    const byte_t* data = NULL;
+    size_t        size = 0U;
+
+    result = cardano_cbor_reader_read_bytestring_view(reader, &data, &size);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    if (size > CARDANO_DATUM_BYTES_MAX_SIZE)
+    {
+      cardano_cbor_reader_set_last_error(reader, "Plutus data byte string is longer than CARDANO_DATUM_BYTES_MAX_SIZE.");
+      return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    if (size > 0U)
+    {
+      (void)memcpy(bytes->data, data, size);
+    }
+
+    bytes->size = size;
+
+    return CARDANO_SUCCESS;
+  }
+
+  if (state != CARDANO_CBOR_READER_STATE_START_INDEFINITE_LENGTH_BYTESTRING)
+  {
+    cardano_cbor_reader_set_last_error(reader, "Expected a plutus data byte string.");
+    return CARDANO_ERROR_UNEXPECTED_CBOR_TYPE;
+  }
+
+  cardano_buffer_t* buffer = NULL;
+
+  result = cardano_cbor_reader_read_bytestring(reader, &buffer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const size_t size = cardano_buffer_get_size(buffer);
+
+  if (size > CARDANO_DATUM_BYTES_MAX_SIZE)
+  {
+    cardano_buffer_unref(&buffer);
+    cardano_cbor_reader_set_last_error(reader, "Plutus data byte string is longer than CARDANO_DATUM_BYTES_MAX_SIZE.");
+
+    return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
+  }
+
+  if (size > 0U)
+  {
+    (void)memcpy(bytes->data, cardano_buffer_get_data(buffer), size);
+  }
+
+  bytes->size = size;
+
+  cardano_buffer_unref(&buffer);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Reads a constructor described by a schema into a struct.
+ *
+ * \param[in] schema The schema.
+ * \param[in] reader The reader.
+ * \param[out] value The struct.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the first error encountered.
+ */
+static cardano_error_t
+read_constr(const cardano_datum_schema_t* schema, cardano_cbor_reader_t* reader, byte_t* value)
+{
+  if ((schema->fields == NULL) && (schema->field_count > 0U))
+  {
+    cardano_cbor_reader_set_last_error(reader, "Datum schema has fields but no field descriptors.");
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  cardano_error_t result = read_expected_constr_start(reader, schema->alternative, schema->field_count);
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < schema->field_count); ++i)
+  {
+    // cppcheck-suppress misra-c2012-17.2; Reason: Schemas nest as deep as the structs they describe.
+    result = read_field(&schema->fields[i], reader, value);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return read_constr_end(reader);
+}
+
+/**
+ * \brief Reads one field into a struct.
+ *
+ * \param[in] field The field descriptor.
+ * \param[in] reader The reader.
+ * \param[out] value The struct holding the field.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the first error encountered.
+ */
+static cardano_error_t
+read_field(const cardano_datum_field_t* field, cardano_cbor_reader_t* reader, byte_t* value)
+{
+  byte_t* member = &value[field->offset];
+
+  switch (field->type)
+  {
+    case CARDANO_DATUM_FIELD_TYPE_INTEGER:
+    {
+      return read_integer(reader, true, member);
+    }
+    case CARDANO_DATUM_FIELD_TYPE_UNSIGNED_INTEGER:
+    {
+      return read_integer(reader, false, member);
+    }
+    case CARDANO_DATUM_FIELD_TYPE_BYTES:
+    {
+      return read_bytes(reader, (cardano_datum_bytes_t*)((void*)member));
+    }
+    case CARDANO_DATUM_FIELD_TYPE_BOOL:
+    {
+      uint64_t alternative = 0U;
+      int64_t  length      = 0;
+
+      cardano_error_t result = read_constr_start(reader, &alternative, &length);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        return result;
+      }
+
+      if ((alternative != FALSE_ALTERNATIVE) && (alternative != TRUE_ALTERNATIVE))
+      {
+        cardano_cbor_reader_set_last_error(reader, "Expected a plutus data boolean.");
+        return CARDANO_ERROR_DECODING;
+      }
+
+      const bool flag = alternative == TRUE_ALTERNATIVE;
+
+      (void)memcpy(member, &flag, sizeof(flag));
+
+      return read_constr_end(reader);
+    }
+    case CARDANO_DATUM_FIELD_TYPE_CONSTR:
+    {
+      if (field->schema == NULL)
+      {
+        cardano_cbor_reader_set_last_error(reader, "Datum constructor field has no schema.");
+        return CARDANO_ERROR_INVALID_ARGUMENT;
+      }
+
+      // cppcheck-suppress misra-c2012-17.2; Reason: Schemas nest as deep as the structs they describe.
+      return read_constr(field->schema, reader, member);
+    }
+    case CARDANO_DATUM_FIELD_TYPE_OPTION:
+    {
+      uint64_t alternative = 0U;
+      int64_t  length      = 0;
+
+      if (field->item == NULL)
+      {
+        cardano_cbor_reader_set_last_error(reader, "Datum option field has no item field.");
+        return CARDANO_ERROR_INVALID_ARGUMENT;
+      }
+
+      cardano_error_t result = read_constr_start(reader, &alternative, &length);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        return result;
+      }
+
+      const bool present = alternative == JUST_ALTERNATIVE;
+
+      if (!present && (alternative != NOTHING_ALTERNATIVE))
+      {
+        cardano_cbor_reader_set_last_error(reader, "Expected a plutus data option.");
+        return CARDANO_ERROR_DECODING;
+      }
+
+      if ((length >= 0) && (length != (present ? 1 : 0)))
+      {
+        cardano_cbor_reader_set_last_error(reader, "Plutus data option has the wrong number of fields.");
+        return CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE;
+      }
+
+      (void)memcpy(member, &present, sizeof(present));
+
+      if (present)
+      {
+        // cppcheck-suppress misra-c2012-17.2; Reason: Schemas nest as deep as the structs they describe.
+        result = read_field(field->item, reader, value);
+
+        if (result != CARDANO_SUCCESS)
+        {
+          return result;
+        }
+      }
+
+      return read_constr_end(reader);
+    }
+    default:
+    {
+      cardano_cbor_reader_set_last_error(reader, "Unknown datum field type.");
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+    }
+  }
+}
+
+/* DEFINITIONS ***************************************************************/
+
+cardano_error_t
+cardano_datum_schema_to_cbor(
+  const cardano_datum_schema_t* schema,
+  const void*                   value,
+  cardano_cbor_writer_t*        writer)
+{
+  if ((schema == NULL) || (value == NULL) || (writer == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return write_constr(schema, (const byte_t*)value, writer);
+}
+
+cardano_error_t
+cardano_datum_schema_from_cbor(
+  const cardano_datum_schema_t* schema,
+  cardano_cbor_reader_t*        reader,
+  void*                         value)
+{
+  if ((schema == NULL) || (reader == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return read_constr(schema, reader, (byte_t*)value);
+}
+
+cardano_error_t
+cardano_datum_schema_peek_alternative(cardano_cbor_reader_t* reader, uint64_t* alternative)
+{
+  if ((reader == NULL) || (alternative == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_cbor_reader_t* clone  = NULL;
+  cardano_error_t        result = cardano_cbor_reader_clone(reader, &clone);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  int64_t length = 0;
+
+  result = read_constr_start(clone, alternative, &length);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_cbor_reader_set_last_error(reader, cardano_cbor_reader_get_last_error(clone));
+  }
+
+  cardano_cbor_reader_unref(&clone);
+
+  return result;
+}
@@ -0,0 +1,46 @@
+/**
+ * \file plutus_data_hash.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_PLUTUS_DATA_HASH_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_PLUTUS_DATA_HASH_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/plutus_data/plutus_data.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Computes a 64-bit hash of the value of a plutus data.
+ *
+ * The hash follows \ref cardano_plutus_data_equals rather than the CBOR encoding: values that compare equal hash
+ * equally even when they were encoded differently, for instance with definite and indefinite length lists. This makes
+ * it suitable for hashed lookups of plutus map keys.
+ *
+ * \param[in] plutus_data The plutus data to hash. May be NULL.
+ *
+ * \return The hash of the value.
+ */
+uint64_t
+cardano_plutus_data_compute_hash(const cardano_plutus_data_t* plutus_data);
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_PLUTUS_DATA_HASH_H
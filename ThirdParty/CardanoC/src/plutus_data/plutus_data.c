@@ -31,6 +31,8 @@
 #include <cardano/plutus_data/plutus_map.h>
 
 #include "../allocators.h"
+#include "../memory_footprint.h"
+#include "internals/plutus_data_hash.h"
 
 #include <assert.h>
 #include <string.h>
@@ -52,8 +54,87 @@ typedef struct cardano_plutus_data_t
     cardano_buffer_t*             cbor_cache;
 } cardano_plutus_data_t;
 
+/* CONSTANTS *****************************************************************/
+
+static const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL; // cppcheck-suppress misra-c2012-8.9
+static const uint64_t FNV_PRIME        = 1099511628211ULL;        // cppcheck-suppress misra-c2012-8.9
+
 /* STATIC FUNCTIONS **********************************************************/
 
+/**
+ * \brief Folds a buffer into a running 64-bit FNV-1a hash.
+ *
+ * \param[in] hash The hash so far.
+ * \param[in] data The bytes to fold in.
+ * \param[in] size The number of bytes.
+ *
+ * \return The updated hash.
+ */
+static uint64_t
+hash_bytes(uint64_t hash, const byte_t* data, const size_t size)
+{
+  for (size_t i = 0U; i < size; ++i)
+  {
+    hash ^= (uint64_t)data[i];
+    hash *= FNV_PRIME;
+  }
+
+  return hash;
+}
+
+/**
+ * \brief Folds a 64-bit word into a running 64-bit FNV-1a hash, least significant byte first.
+ *
+ * \param[in] hash The hash so far.
+ * \param[in] word The word to fold in.
+ *
+ * \return The updated hash.
+ */
+static uint64_t
+hash_word(uint64_t hash, const uint64_t word)
+{
+  for (size_t i = 0U; i < sizeof(uint64_t); ++i)
+  {
+    hash ^= (word >> (i * 8U)) & 0xFFU;
+    hash *= FNV_PRIME;
+  }
+
+  return hash;
+}
+
+/**
+ * \brief Folds the value of an integer into a running hash.
+ *
+ * \param[in] hash The hash so far.
+ * \param[in] integer The integer.
+ *
+ * \return The updated hash.
+ */
+static uint64_t
+hash_integer(uint64_t hash, const cardano_bigint_t* integer)
+{
+  const size_t bit_length = cardano_bigint_bit_length(integer);
+
+  hash = hash_word(hash, (uint64_t)(int64_t)cardano_bigint_signum(integer));
+
+  if (bit_length < 64U)
+  {
+    return hash_word(hash, (uint64_t)cardano_bigint_to_int(integer));
+  }
+
+  byte_t       bytes[64] = { 0 };
+  const size_t size      = cardano_bigint_get_bytes_size(integer);
+
+  // Larger integers only contribute their length, which still keeps equal values on equal hashes
+  if ((size > sizeof(bytes)) || (cardano_bigint_to_bytes(integer, CARDANO_BYTE_ORDER_LITTLE_ENDIAN, bytes, size) != CARDANO_SUCCESS))
+  {
+    return hash_word(hash, (uint64_t)bit_length);
+  }
+
+  return hash_bytes(hash, bytes, size);
+}
+
+
 /**
  * \brief Deallocates a plutus data object.
  *
@@ -102,7 +183,7 @@ cardano_plutus_data_new(void)
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_plutus_data_deallocate;
   data->cbor_cache         = NULL;
 
@@ -1046,6 +1127,113 @@ cardano_plutus_data_equals(const cardano_plutus_data_t* lhs, const cardano_plutu
   }
 }
 
+uint64_t
+cardano_plutus_data_compute_hash(const cardano_plutus_data_t* plutus_data)
+{
+  uint64_t hash = FNV_OFFSET_BASIS;
+
+  if (plutus_data == NULL)
+  {
+    return hash;
+  }
+
+  hash = hash_word(hash, (uint64_t)plutus_data->kind);
+
+  switch (plutus_data->kind)
+  {
+    case CARDANO_PLUTUS_DATA_KIND_CONSTR:
+    {
+      uint64_t               alternative = 0U;
+      cardano_plutus_list_t* fields      = NULL;
+
+      if (cardano_constr_plutus_data_get_alternative(plutus_data->constr, &alternative) == CARDANO_SUCCESS)
+      {
+        hash = hash_word(hash, alternative);
+      }
+
+      if (cardano_constr_plutus_data_get_data(plutus_data->constr, &fields) == CARDANO_SUCCESS)
+      {
+        cardano_plutus_list_unref(&fields);
+
+        const size_t length = cardano_plutus_list_get_length(fields);
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          cardano_plutus_data_t* field = NULL;
+
+          if (cardano_plutus_list_get(fields, i, &field) == CARDANO_SUCCESS)
+          {
+            cardano_plutus_data_unref(&field);
+
+            // cppcheck-suppress misra-c2012-17.2; Reason: Hashing follows the recursive structure of the data.
+            hash = hash_word(hash, cardano_plutus_data_compute_hash(field));
+          }
+        }
+      }
+
+      break;
+    }
+    case CARDANO_PLUTUS_DATA_KIND_MAP:
+    {
+      const size_t length = cardano_plutus_map_get_length(plutus_data->map);
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        cardano_plutus_data_t* key   = NULL;
+        cardano_plutus_data_t* value = NULL;
+
+        if (cardano_plutus_map_get_key_value_at(plutus_data->map, i, &key, &value) == CARDANO_SUCCESS)
+        {
+          cardano_plutus_data_unref(&key);
+          cardano_plutus_data_unref(&value);
+
+          // cppcheck-suppress misra-c2012-17.2; Reason: Hashing follows the recursive structure of the data.
+          hash = hash_word(hash, cardano_plutus_data_compute_hash(key));
+          // cppcheck-suppress misra-c2012-17.2; Reason: Hashing follows the recursive structure of the data.
+          hash = hash_word(hash, cardano_plutus_data_compute_hash(value));
+        }
+      }
+
+      break;
+    }
+    case CARDANO_PLUTUS_DATA_KIND_LIST:
+    {
+      const size_t length = cardano_plutus_list_get_length(plutus_data->list);
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        cardano_plutus_data_t* element = NULL;
+
+        if (cardano_plutus_list_get(plutus_data->list, i, &element) == CARDANO_SUCCESS)
+        {
+          cardano_plutus_data_unref(&element);
+
+          // cppcheck-suppress misra-c2012-17.2; Reason: Hashing follows the recursive structure of the data.
+          hash = hash_word(hash, cardano_plutus_data_compute_hash(element));
+        }
+      }
+
+      break;
+    }
+    case CARDANO_PLUTUS_DATA_KIND_INTEGER:
+    {
+      hash = hash_integer(hash, plutus_data->integer);
+      break;
+    }
+    case CARDANO_PLUTUS_DATA_KIND_BYTES:
+    {
+      hash = hash_bytes(hash, cardano_buffer_get_data(plutus_data->bytes), cardano_buffer_get_size(plutus_data->bytes));
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  return hash;
+}
+
 void
 cardano_plutus_data_clear_cbor_cache(cardano_plutus_data_t* plutus_data)
 {
@@ -1113,3 +1301,19 @@ cardano_plutus_data_get_last_error(const cardano_plutus_data_t* plutus_data)
 {
   return cardano_object_get_last_error(&plutus_data->base);
 }
+
+void
+_cardano_plutus_data_add_footprint(const cardano_plutus_data_t* plutus_data, cardano_footprint_context_t* context)
+{
+  if ((plutus_data == NULL) || !_cardano_footprint_visit(context, &plutus_data->base, CARDANO_MEMORY_FOOTPRINT_TYPE_PLUTUS_DATA, sizeof(cardano_plutus_data_t)))
+  {
+    return;
+  }
+
+  _cardano_plutus_map_add_footprint(plutus_data->map, context);
+  _cardano_plutus_list_add_footprint(plutus_data->list, context);
+  _cardano_bigint_add_footprint(plutus_data->integer, context);
+  _cardano_buffer_add_footprint(plutus_data->bytes, context);
+  _cardano_constr_plutus_data_add_footprint(plutus_data->constr, context);
+  _cardano_buffer_add_footprint(plutus_data->cbor_cache, context);
+}
@@ -0,0 +1,1013 @@
+/**
+ * \file plutus_data_view.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/buffer.h>
+#include <cardano/cbor/cbor_writer.h>
+#include <cardano/object.h>
+#include <cardano/plutus_data/plutus_data_view.h>
+
+#include "../allocators.h"
+
+#include <assert.h>
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const uint64_t GENERAL_FORM_TAG       = 102U;                    // cppcheck-suppress misra-c2012-8.9
+static const uint64_t ALTERNATIVE_TAG_OFFSET = 7U;                      // cppcheck-suppress misra-c2012-8.9
+static const size_t   INDEX_MIN_ENTRIES      = 8U;                      // cppcheck-suppress misra-c2012-8.9
+static const uint64_t FNV_OFFSET_BASIS       = 14695981039346656037ULL; // cppcheck-suppress misra-c2012-8.9
+static const uint64_t FNV_PRIME              = 1099511628211ULL;        // cppcheck-suppress misra-c2012-8.9
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A slot of the key index of a map view.
+ */
+typedef struct key_index_slot_t
+{
+    uint64_t hash;
+    size_t   entry; /**< Position of the entry plus one; zero marks a free slot. */
+} key_index_slot_t;
+
+/**
+ * \brief Represents a lazily decoded plutus data.
+ */
+typedef struct cardano_plutus_data_view_t
+{
+    cardano_object_t           base;
+    cardano_buffer_t*          cbor;
+    size_t                     offset;
+    size_t                     size;
+    cardano_plutus_data_kind_t kind;
+    uint64_t                   alternative;
+    size_t                     items_offset;
+    size_t*                    children;
+    size_t                     child_count;
+    bool                       is_indexed;
+    key_index_slot_t*          key_index;
+    size_t                     key_index_capacity;
+} cardano_plutus_data_view_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates a plutus data view.
+ *
+ * \param object A void pointer to the view to be deallocated.
+ */
+static void
+cardano_plutus_data_view_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_plutus_data_view_t* view = (cardano_plutus_data_view_t*)object;
+
+  cardano_buffer_unref(&view->cbor);
+  _cardano_free(view->children);
+  _cardano_free(view->key_index);
+
+  _cardano_free(view);
+}
+
+/**
+ * \brief Computes the 64-bit FNV-1a hash of a buffer.
+ *
+ * \param[in] data The buffer to hash.
+ * \param[in] size The size of the buffer.
+ *
+ * \return The hash of the buffer.
+ */
+static uint64_t
+hash_bytes(const byte_t* data, const size_t size)
+{
+  uint64_t hash = FNV_OFFSET_BASIS;
+
+  for (size_t i = 0U; i < size; ++i)
+  {
+    hash ^= (uint64_t)data[i];
+    hash *= FNV_PRIME;
+  }
+
+  return hash;
+}
+
+/**
+ * \brief Creates a reader over the bytes of a view, starting at the given offset of the shared CBOR.
+ *
+ * \param[in] view The view.
+ * \param[in] from The offset within the shared CBOR; it must lie within the view.
+ *
+ * \return The reader, or NULL if memory could not be allocated.
+ */
+static cardano_cbor_reader_t*
+open_reader(const cardano_plutus_data_view_t* view, const size_t from)
+{
+  assert((from >= view->offset) && (from < (view->offset + view->size)));
+
+  return cardano_cbor_reader_from_view(&cardano_buffer_get_data(view->cbor)[from], (view->offset + view->size) - from);
+}
+
+/**
+ * \brief Gets the position of a reader within the shared CBOR.
+ *
+ * Every reader opened by \ref open_reader ends where the view ends, so its position follows from the bytes it has left.
+ *
+ * \param[in] view The view the reader was opened on.
+ * \param[in] reader The reader.
+ *
+ * \return The offset of the next byte the reader would read.
+ */
+static size_t
+get_reader_position(const cardano_plutus_data_view_t* view, cardano_cbor_reader_t* reader)
+{
+  size_t remaining = 0U;
+
+  if (cardano_cbor_reader_get_bytes_remaining(reader, &remaining) != CARDANO_SUCCESS)
+  {
+    remaining = 0U;
+  }
+
+  return (view->offset + view->size) - remaining;
+}
+
+/**
+ * \brief Reports a failure of a reader as the last error of a view, and releases the reader.
+ *
+ * \param[in] view The view.
+ * \param[in] reader The reader. Released and set to NULL.
+ * \param[in] error The error the reader reported.
+ *
+ * \return \p error.
+ */
+static cardano_error_t
+fail_with_reader(cardano_plutus_data_view_t* view, cardano_cbor_reader_t** reader, const cardano_error_t error)
+{
+  cardano_object_set_last_error(&view->base, cardano_cbor_reader_get_last_error(*reader));
+  cardano_cbor_reader_unref(reader);
+
+  return error;
+}
+
+/**
+ * \brief Reads the outermost item of a view to find its kind and, for constructors, its alternative.
+ *
+ * Mirrors the rules of \ref cardano_plutus_data_from_cbor: big number tags are integers, and any other tag starts a
+ * constructor.
+ *
+ * \param[in] view The view, whose span is set.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a decoding error.
+ */
+static cardano_error_t
+classify(cardano_plutus_data_view_t* view)
+{
+  cardano_cbor_reader_t* reader = open_reader(view, view->offset);
+
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_cbor_reader_state_t state  = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  cardano_error_t             result = cardano_cbor_reader_peek_state(reader, &state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return fail_with_reader(view, &reader, result);
+  }
+
+  view->items_offset = view->offset;
+
+  switch (state)
+  {
+    case CARDANO_CBOR_READER_STATE_TAG:
+    {
+      cardano_cbor_tag_t tag = 0;
+
+      result = cardano_cbor_reader_read_tag(reader, &tag);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        return fail_with_reader(view, &reader, result);
+      }
+
+      if ((tag == CARDANO_CBOR_TAG_UNSIGNED_BIG_NUM) || (tag == CARDANO_CBOR_TAG_NEGATIVE_BIG_NUM))
+      {
+        view->kind = CARDANO_PLUTUS_DATA_KIND_INTEGER;
+        break;
+      }
+
+      view->kind = CARDANO_PLUTUS_DATA_KIND_CONSTR;
+
+      if ((uint64_t)tag == GENERAL_FORM_TAG)
+      {
+        int64_t length = 0;
+
+        result = cardano_cbor_reader_read_start_array(reader, &length);
+
+        if ((result == CARDANO_SUCCESS) && (length != 2))
+        {
+          cardano_cbor_reader_set_last_error(reader, "There was an error decoding 'constr_plutus_data', expected an array of 2 elements.");
+          result = CARDANO_ERROR_INVALID_CBOR_ARRAY_SIZE;
+        }
+
+        if (result == CARDANO_SUCCESS)
+        {
+          result = cardano_cbor_reader_read_uint(reader, &view->alternative);
+        }
+
+        if (result != CARDANO_SUCCESS)
+        {
+          return fail_with_reader(view, &reader, result);
+        }
+      }
+      else if (((uint64_t)tag >= 121U) && ((uint64_t)tag <= 127U))
+      {
+        view->alternative = (uint64_t)tag - 121U;
+      }
+      else if (((uint64_t)tag >= 1280U) && ((uint64_t)tag <= 1400U))
+      {
+        view->alternative = ((uint64_t)tag - 1280U) + ALTERNATIVE_TAG_OFFSET;
+      }
+      else
+      {
+        view->alternative = GENERAL_FORM_TAG;
+      }
+
+      view->items_offset = get_reader_position(view, reader);
+
+      result = cardano_cbor_reader_peek_state(reader, &state);
+
+      if ((result == CARDANO_SUCCESS) && (state != CARDANO_CBOR_READER_STATE_START_ARRAY))
+      {
+        cardano_cbor_reader_set_last_error(reader, "Constructor fields must be an array.");
+        result = CARDANO_ERROR_DECODING;
+      }
+
+      if (result != CARDANO_SUCCESS)
+      {
+        return fail_with_reader(view, &reader, result);
+      }
+
+      break;
+    }
+    case CARDANO_CBOR_READER_STATE_UNSIGNED_INTEGER:
+    case CARDANO_CBOR_READER_STATE_NEGATIVE_INTEGER:
+    {
+      view->kind = CARDANO_PLUTUS_DATA_KIND_INTEGER;
+      break;
+    }
+    case CARDANO_CBOR_READER_STATE_START_INDEFINITE_LENGTH_BYTESTRING:
+    case CARDANO_CBOR_READER_STATE_BYTESTRING:
+    {
+      view->kind = CARDANO_PLUTUS_DATA_KIND_BYTES;
+      break;
+    }
+    case CARDANO_CBOR_READER_STATE_START_ARRAY:
+    {
+      view->kind = CARDANO_PLUTUS_DATA_KIND_LIST;
+      break;
+    }
+    case CARDANO_CBOR_READER_STATE_START_MAP:
+    {
+      view->kind = CARDANO_PLUTUS_DATA_KIND_MAP;
+      break;
+    }
+    default:
+    {
+      cardano_cbor_reader_set_last_error(reader, "Invalid CBOR data item type for plutus data.");
+      return fail_with_reader(view, &reader, CARDANO_ERROR_DECODING);
+    }
+  }
+
+  cardano_cbor_reader_unref(&reader);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Creates a view of a span of a shared CBOR buffer.
+ *
+ * \param[in] cbor The shared CBOR.
+ * \param[in] offset The offset of the span.
+ * \param[in] size The size of the span.
+ * \param[out] view On success, the new view.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+create_view(cardano_buffer_t* cbor, const size_t offset, const size_t size, cardano_plutus_data_view_t** view)
+{
+  cardano_plutus_data_view_t* obj = (cardano_plutus_data_view_t*)_cardano_malloc(sizeof(cardano_plutus_data_view_t));
+
+  if (obj == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  obj->base.ref_count     = 1;
+  obj->base.last_error    = NULL;
+  obj->base.deallocator   = cardano_plutus_data_view_deallocate;
+  obj->cbor               = cbor;
+  obj->offset             = offset;
+  obj->size               = size;
+  obj->kind               = CARDANO_PLUTUS_DATA_KIND_CONSTR;
+  obj->alternative        = 0U;
+  obj->items_offset       = offset;
+  obj->children           = NULL;
+  obj->child_count        = 0U;
+  obj->is_indexed         = false;
+  obj->key_index          = NULL;
+  obj->key_index_capacity = 0U;
+
+  cardano_buffer_ref(cbor);
+
+  cardano_error_t result = classify(obj);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_plutus_data_view_deallocate(obj);
+    return result;
+  }
+
+  *view = obj;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Records where every child of a constructor, list or map starts, on first use.
+ *
+ * Children are skipped without being decoded. For a map, keys and values are recorded alternately. One more offset,
+ * the end of the last child, is recorded so that every child spans from its offset to the next one.
+ *
+ * \param[in] view The view.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or a decoding error.
+ */
+static cardano_error_t
+build_children(cardano_plutus_data_view_t* view)
+{
+  if (view->is_indexed)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_cbor_reader_t* reader = open_reader(view, view->items_offset);
+
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  const bool      is_map = view->kind == CARDANO_PLUTUS_DATA_KIND_MAP;
+  int64_t         length = 0;
+  cardano_error_t result = is_map ? cardano_cbor_reader_read_start_map(reader, &length) : cardano_cbor_reader_read_start_array(reader, &length);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return fail_with_reader(view, &reader, result);
+  }
+
+  const cardano_cbor_reader_state_t end_state = is_map ? CARDANO_CBOR_READER_STATE_END_MAP : CARDANO_CBOR_READER_STATE_END_ARRAY;
+
+  size_t  capacity = ((length > 0) ? ((size_t)length * (is_map ? 2U : 1U)) : 8U) + 1U;
+  size_t  count    = 0U;
+  size_t* children = (size_t*)_cardano_malloc(capacity * sizeof(size_t));
+
+  if (children == NULL)
+  {
+    cardano_cbor_reader_unref(&reader);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  while (result == CARDANO_SUCCESS)
+  {
+    cardano_cbor_reader_state_t state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+
+    result = cardano_cbor_reader_peek_state(reader, &state);
+
+    if ((result != CARDANO_SUCCESS) || (state == end_state))
+    {
+      break;
+    }
+
+    if ((count + 1U) >= capacity)
+    {
+      size_t* grown = (size_t*)_cardano_realloc(children, capacity * 2U * sizeof(size_t));
+
+      if (grown == NULL)
+      {
+        result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+        break;
+      }
+
+      children  = grown;
+      capacity *= 2U;
+    }
+
+    children[count] = get_reader_position(view, reader);
+    ++count;
+
+    result = cardano_cbor_reader_skip_value(reader);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    _cardano_free(children);
+    return fail_with_reader(view, &reader, result);
+  }
+
+  children[count] = get_reader_position(view, reader);
+
+  cardano_cbor_reader_unref(&reader);
+
+  view->children    = children;
+  view->child_count = is_map ? (count / 2U) : count;
+  view->is_indexed  = true;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Creates a view of the child recorded at a position of \ref build_children.
+ *
+ * \param[in] view The indexed parent view.
+ * \param[in] position The position among the recorded children.
+ * \param[out] child On success, the new view.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+get_child(cardano_plutus_data_view_t* view, const size_t position, cardano_plutus_data_view_t** child)
+{
+  const size_t start = view->children[position];
+  const size_t end   = view->children[position + 1U];
+
+  cardano_error_t result = create_view(view->cbor, start, end - start, child);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_object_set_last_error(&view->base, "Invalid CBOR data item type for plutus data.");
+  }
+
+  return result;
+}
+
+/**
+ * \brief Gets the encoded key of a map entry.
+ *
+ * \param[in] view The indexed map view.
+ * \param[in] entry The position of the entry.
+ * \param[out] size The size of the encoded key.
+ *
+ * \return The encoded key, owned by the view.
+ */
+static const byte_t*
+get_encoded_key(const cardano_plutus_data_view_t* view, const size_t entry, size_t* size)
+{
+  const size_t start = view->children[entry * 2U];
+
+  *size = view->children[(entry * 2U) + 1U] - start;
+
+  return &cardano_buffer_get_data(view->cbor)[start];
+}
+
+/**
+ * \brief Builds the hashed index of the encoded keys of a map view.
+ *
+ * \param[in] view The indexed map view.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+build_key_index(cardano_plutus_data_view_t* view)
+{
+  size_t capacity = 16U;
+
+  while (capacity < (view->child_count * 2U))
+  {
+    capacity *= 2U;
+  }
+
+  key_index_slot_t* index = (key_index_slot_t*)_cardano_malloc(capacity * sizeof(key_index_slot_t));
+
+  if (index == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset((void*)index, 0, capacity * sizeof(key_index_slot_t)));
+
+  const size_t mask = capacity - 1U;
+
+  for (size_t i = 0U; i < view->child_count; ++i)
+  {
+    size_t         key_size = 0U;
+    const byte_t*  key      = get_encoded_key(view, i, &key_size);
+    const uint64_t hash     = hash_bytes(key, key_size);
+
+    for (size_t slot = (size_t)hash & mask;; slot = (slot + 1U) & mask)
+    {
+      if (index[slot].entry == 0U)
+      {
+        index[slot].hash  = hash;
+        index[slot].entry = i + 1U;
+        break;
+      }
+
+      size_t        other_size = 0U;
+      const byte_t* other      = get_encoded_key(view, index[slot].entry - 1U, &other_size);
+
+      // Keep the first of several equal keys
+      if ((index[slot].hash == hash) && (other_size == key_size) && (memcmp(other, key, key_size) == 0))
+      {
+        break;
+      }
+    }
+  }
+
+  view->key_index          = index;
+  view->key_index_capacity = capacity;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Finds the map entry whose encoded key matches the given one.
+ *
+ * \param[in] view The indexed map view.
+ * \param[in] key The encoded key.
+ * \param[in] key_size The size of the encoded key.
+ * \param[out] entry On success, the position of the entry.
+ *
+ * \return `true` if an entry was found.
+ */
+static bool
+find_entry(cardano_plutus_data_view_t* view, const byte_t* key, const size_t key_size, size_t* entry)
+{
+  if ((view->key_index == NULL) && (view->child_count >= INDEX_MIN_ENTRIES))
+  {
+    CARDANO_UNUSED(build_key_index(view));
+  }
+
+  if (view->key_index == NULL)
+  {
+    for (size_t i = 0U; i < view->child_count; ++i)
+    {
+      size_t        other_size = 0U;
+      const byte_t* other      = get_encoded_key(view, i, &other_size);
+
+      if ((other_size == key_size) && (memcmp(other, key, key_size) == 0))
+      {
+        *entry = i;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  const uint64_t hash = hash_bytes(key, key_size);
+  const size_t   mask = view->key_index_capacity - 1U;
+
+  for (size_t slot = (size_t)hash & mask; view->key_index[slot].entry != 0U; slot = (slot + 1U) & mask)
+  {
+    if (view->key_index[slot].hash != hash)
+    {
+      continue;
+    }
+
+    size_t        other_size = 0U;
+    const byte_t* other      = get_encoded_key(view, view->key_index[slot].entry - 1U, &other_size);
+
+    if ((other_size == key_size) && (memcmp(other, key, key_size) == 0))
+    {
+      *entry = view->key_index[slot].entry - 1U;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_plutus_data_view_from_cbor(cardano_cbor_reader_t* reader, cardano_plutus_data_view_t** view)
+{
+  if ((reader == NULL) || (view == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_buffer_t* cbor   = NULL;
+  cardano_error_t   result = cardano_cbor_reader_read_encoded_value(reader, &cbor);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = create_view(cbor, 0U, cardano_buffer_get_size(cbor), view);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_cbor_reader_set_last_error(reader, "Invalid CBOR data item type for plutus data.");
+  }
+
+  cardano_buffer_unref(&cbor);
+
+  return result;
+}
+
+cardano_error_t
+cardano_plutus_data_view_get_kind(const cardano_plutus_data_view_t* view, cardano_plutus_data_kind_t* kind)
+{
+  if ((view == NULL) || (kind == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *kind = view->kind;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_plutus_data_view_get_alternative(const cardano_plutus_data_view_t* view, uint64_t* alternative)
+{
+  if ((view == NULL) || (alternative == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (view->kind != CARDANO_PLUTUS_DATA_KIND_CONSTR)
+  {
+    return CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION;
+  }
+
+  *alternative = view->alternative;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_plutus_data_view_get_length(cardano_plutus_data_view_t* view, size_t* length)
+{
+  if ((view == NULL) || (length == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((view->kind == CARDANO_PLUTUS_DATA_KIND_INTEGER) || (view->kind == CARDANO_PLUTUS_DATA_KIND_BYTES))
+  {
+    return CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION;
+  }
+
+  cardano_error_t result = build_children(view);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  *length = view->child_count;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_plutus_data_view_get_item(
+  cardano_plutus_data_view_t*  view,
+  const size_t                 index,
+  cardano_plutus_data_view_t** item)
+{
+  if ((view == NULL) || (item == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((view->kind != CARDANO_PLUTUS_DATA_KIND_CONSTR) && (view->kind != CARDANO_PLUTUS_DATA_KIND_LIST))
+  {
+    return CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION;
+  }
+
+  cardano_error_t result = build_children(view);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (index >= view->child_count)
+  {
+    return CARDANO_ERROR_INDEX_OUT_OF_BOUNDS;
+  }
+
+  return get_child(view, index, item);
+}
+
+cardano_error_t
+cardano_plutus_data_view_get_entry(
+  cardano_plutus_data_view_t*  view,
+  const size_t                 index,
+  cardano_plutus_data_view_t** key,
+  cardano_plutus_data_view_t** value)
+{
+  if ((view == NULL) || (key == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (view->kind != CARDANO_PLUTUS_DATA_KIND_MAP)
+  {
+    return CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION;
+  }
+
+  cardano_error_t result = build_children(view);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (index >= view->child_count)
+  {
+    return CARDANO_ERROR_INDEX_OUT_OF_BOUNDS;
+  }
+
+  cardano_plutus_data_view_t* key_view = NULL;
+
+  result = get_child(view, index * 2U, &key_view);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = get_child(view, (index * 2U) + 1U, value);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_plutus_data_view_unref(&key_view);
+    return result;
+  }
+
+  *key = key_view;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_plutus_data_view_find(
+  cardano_plutus_data_view_t*  view,
+  cardano_plutus_data_t*       key,
+  cardano_plutus_data_view_t** value)
+{
+  if ((view == NULL) || (key == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (view->kind != CARDANO_PLUTUS_DATA_KIND_MAP)
+  {
+    return CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION;
+  }
+
+  cardano_error_t result = build_children(view);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_buffer_t* encoded_key = NULL;
+
+  result = cardano_plutus_data_to_cbor(key, writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_encode_in_buffer(writer, &encoded_key);
+  }
+
+  cardano_cbor_writer_unref(&writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  size_t     entry = 0U;
+  const bool found = find_entry(view, cardano_buffer_get_data(encoded_key), cardano_buffer_get_size(encoded_key), &entry);
+
+  cardano_buffer_unref(&encoded_key);
+
+  if (!found)
+  {
+    return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  }
+
+  return get_child(view, (entry * 2U) + 1U, value);
+}
+
+cardano_error_t
+cardano_plutus_data_view_to_integer(const cardano_plutus_data_view_t* view, cardano_bigint_t** integer)
+{
+  if ((view == NULL) || (integer == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (view->kind != CARDANO_PLUTUS_DATA_KIND_INTEGER)
+  {
+    return CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION;
+  }
+
+  cardano_cbor_reader_t* reader = open_reader(view, view->offset);
+
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_cbor_reader_state_t state  = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  cardano_error_t             result = cardano_cbor_reader_peek_state(reader, &state);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    if (state == CARDANO_CBOR_READER_STATE_UNSIGNED_INTEGER)
+    {
+      uint64_t value = 0U;
+
+      result = cardano_cbor_reader_read_uint(reader, &value);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_bigint_from_unsigned_int(value, integer);
+      }
+    }
+    else if (state == CARDANO_CBOR_READER_STATE_NEGATIVE_INTEGER)
+    {
+      int64_t value = 0;
+
+      result = cardano_cbor_reader_read_int(reader, &value);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_bigint_from_int(value, integer);
+      }
+    }
+    else
+    {
+      result = cardano_cbor_reader_read_bigint(reader, integer);
+    }
+  }
+
+  cardano_cbor_reader_unref(&reader);
+
+  return result;
+}
+
+cardano_error_t
+cardano_plutus_data_view_to_bounded_bytes(const cardano_plutus_data_view_t* view, cardano_buffer_t** bounded_bytes)
+{
+  if ((view == NULL) || (bounded_bytes == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (view->kind != CARDANO_PLUTUS_DATA_KIND_BYTES)
+  {
+    return CARDANO_ERROR_INVALID_PLUTUS_DATA_CONVERSION;
+  }
+
+  cardano_cbor_reader_t* reader = open_reader(view, view->offset);
+
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_cbor_reader_read_bytestring(reader, bounded_bytes);
+
+  cardano_cbor_reader_unref(&reader);
+
+  return result;
+}
+
+cardano_error_t
+cardano_plutus_data_view_to_plutus_data(const cardano_plutus_data_view_t* view, cardano_plutus_data_t** plutus_data)
+{
+  if ((view == NULL) || (plutus_data == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_cbor_reader_t* reader = open_reader(view, view->offset);
+
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_plutus_data_from_cbor(reader, plutus_data);
+
+  cardano_cbor_reader_unref(&reader);
+
+  return result;
+}
+
+cardano_error_t
+cardano_plutus_data_view_get_cbor(const cardano_plutus_data_view_t* view, const byte_t** data, size_t* size)
+{
+  if ((view == NULL) || (data == NULL) || (size == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *data = &cardano_buffer_get_data(view->cbor)[view->offset];
+  *size = view->size;
+
+  return CARDANO_SUCCESS;
+}
+
+void
+cardano_plutus_data_view_unref(cardano_plutus_data_view_t** view)
+{
+  if ((view == NULL) || (*view == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*view)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *view = NULL;
+    return;
+  }
+}
+
+void
+cardano_plutus_data_view_ref(cardano_plutus_data_view_t* view)
+{
+  if (view == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&view->base);
+}
+
+size_t
+cardano_plutus_data_view_refcount(const cardano_plutus_data_view_t* view)
+{
+  if (view == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&view->base);
+}
+
+void
+cardano_plutus_data_view_set_last_error(cardano_plutus_data_view_t* view, const char* message)
+{
+  cardano_object_set_last_error(&view->base, message);
+}
+
+const char*
+cardano_plutus_data_view_get_last_error(const cardano_plutus_data_view_t* view)
+{
+  return cardano_object_get_last_error(&view->base);
+}
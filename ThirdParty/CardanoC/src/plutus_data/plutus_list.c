@@ -27,6 +27,7 @@
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
 #include "../collections/array.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <cardano/plutus_data/plutus_data.h>
@@ -90,7 +91,7 @@ cardano_plutus_list_new(cardano_plutus_list_t** plutus_list)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_plutus_list_deallocate;
   list->cbor_cache         = NULL;
 
@@ -451,3 +452,24 @@ cardano_plutus_list_get_last_error(const cardano_plutus_list_t* plutus_list)
 {
   return cardano_object_get_last_error(&plutus_list->base);
 }
+
+/**
+ * \brief Adds the footprint of an element of a plutus list.
+ */
+static void
+add_element_footprint(const cardano_object_t* item, cardano_footprint_context_t* context)
+{
+  _cardano_plutus_data_add_footprint((const cardano_plutus_data_t*)((const void*)item), context);
+}
+
+void
+_cardano_plutus_list_add_footprint(const cardano_plutus_list_t* plutus_list, cardano_footprint_context_t* context)
+{
+  if ((plutus_list == NULL) || !_cardano_footprint_visit(context, &plutus_list->base, CARDANO_MEMORY_FOOTPRINT_TYPE_PLUTUS_DATA, sizeof(cardano_plutus_list_t)))
+  {
+    return;
+  }
+
+  _cardano_array_add_footprint(plutus_list->array, context, add_element_footprint);
+  _cardano_buffer_add_footprint(plutus_list->cbor_cache, context);
+}
@@ -28,22 +28,42 @@
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
 #include "../collections/set.h"
+#include "../memory_footprint.h"
+#include "internals/plutus_data_hash.h"
 
 #include <assert.h>
 #include <cardano/plutus_data/plutus_data.h>
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Maps with fewer entries are searched linearly; hashing the key costs more than comparing a few entries.
+ */
+static const size_t INDEX_MIN_ENTRIES = 8U; // cppcheck-suppress misra-c2012-8.9
+
 /* STRUCTURES ****************************************************************/
 
+/**
+ * \brief A slot of the key index of a plutus map.
+ */
+typedef struct cardano_plutus_map_index_slot_t
+{
+    uint64_t hash;
+    size_t   position; /**< Position of the entry plus one; zero marks a free slot. */
+} cardano_plutus_map_index_slot_t;
+
 /**
  * \brief Represents a Cardano plutus map.
  */
 typedef struct cardano_plutus_map_t
 {
-    cardano_object_t  base;
-    cardano_array_t*  array;
-    cardano_buffer_t* cbor_cache;
-    bool              use_indefinite_encoding;
+    cardano_object_t                 base;
+    cardano_array_t*                 array;
+    cardano_buffer_t*                cbor_cache;
+    bool                             use_indefinite_encoding;
+    cardano_plutus_map_index_slot_t* index;
+    size_t                           index_capacity;
 } cardano_plutus_map_t;
 
 /**
@@ -80,6 +100,7 @@ cardano_plutus_map_deallocate(void* object)
 
   cardano_array_unref(&map->array);
   cardano_buffer_unref(&map->cbor_cache);
+  _cardano_free(map->index);
 
   _cardano_free(map);
 }
@@ -117,6 +138,104 @@ cardano_plutus_map_kvp_deallocate(void* object)
   _cardano_free(map);
 }
 
+/**
+ * \brief Gets the key stored at a position of a plutus map, without taking a reference.
+ *
+ * \param[in] map The plutus map.
+ * \param[in] position The position of the entry.
+ *
+ * \return The key, owned by the map.
+ */
+static cardano_plutus_data_t*
+get_key_at(const cardano_plutus_map_t* map, const size_t position)
+{
+  cardano_object_t*         object = cardano_array_get(map->array, position);
+  cardano_plutus_map_kvp_t* kvp    = (cardano_plutus_map_kvp_t*)((void*)object);
+
+  cardano_object_unref(&object);
+
+  return kvp->key;
+}
+
+/**
+ * \brief Adds an entry to the key index of a plutus map.
+ *
+ * When the map already holds an equal key, the index keeps pointing at the earlier entry, so lookups keep returning
+ * the first match as a linear search would.
+ *
+ * \param[in] map The plutus map. Its index must have room for one more entry.
+ * \param[in] position The position of the entry to add.
+ */
+static void
+index_entry(cardano_plutus_map_t* map, const size_t position)
+{
+  cardano_plutus_data_t* key  = get_key_at(map, position);
+  const uint64_t         hash = cardano_plutus_data_compute_hash(key);
+  const size_t           mask = map->index_capacity - 1U;
+
+  for (size_t slot = (size_t)hash & mask;; slot = (slot + 1U) & mask)
+  {
+    cardano_plutus_map_index_slot_t* entry = &map->index[slot];
+
+    if (entry->position == 0U)
+    {
+      entry->hash     = hash;
+      entry->position = position + 1U;
+
+      return;
+    }
+
+    if ((entry->hash == hash) && cardano_plutus_data_equals(get_key_at(map, entry->position - 1U), key))
+    {
+      return;
+    }
+  }
+}
+
+/**
+ * \brief Builds the key index of a plutus map, sized for its current entries plus room to grow.
+ *
+ * \param[in] map The plutus map.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED. On failure the map is left
+ *         without an index, and lookups search it linearly.
+ */
+static cardano_error_t
+build_index(cardano_plutus_map_t* map)
+{
+  const size_t length   = cardano_array_get_size(map->array);
+  size_t       capacity = 16U;
+
+  // Keep the index at most half full, so probe sequences stay short
+  while (capacity < (length * 2U))
+  {
+    capacity *= 2U;
+  }
+
+  _cardano_free(map->index);
+  map->index          = NULL;
+  map->index_capacity = 0U;
+
+  cardano_plutus_map_index_slot_t* index = (cardano_plutus_map_index_slot_t*)_cardano_malloc(capacity * sizeof(cardano_plutus_map_index_slot_t));
+
+  if (index == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset((void*)index, 0, capacity * sizeof(cardano_plutus_map_index_slot_t)));
+
+  map->index          = index;
+  map->index_capacity = capacity;
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    index_entry(map, i);
+  }
+
+  return CARDANO_SUCCESS;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -135,10 +254,12 @@ cardano_plutus_map_new(cardano_plutus_map_t** plutus_map)
   }
 
   map->base.ref_count          = 1;
-  map->base.last_error[0]      = '\0';
+  map->base.last_error         = NULL;
   map->base.deallocator        = cardano_plutus_map_deallocate;
   map->use_indefinite_encoding = false;
   map->cbor_cache              = NULL;
+  map->index                   = NULL;
+  map->index_capacity          = 0U;
 
   map->array = cardano_array_new(128);
 
@@ -256,7 +377,7 @@ cardano_plutus_map_from_cbor(cardano_cbor_reader_t* reader, cardano_plutus_map_t
     }
 
     kvp->base.ref_count     = 0;
-    kvp->base.last_error[0] = '\0';
+    kvp->base.last_error    = NULL;
     kvp->base.deallocator   = cardano_plutus_map_kvp_deallocate;
     kvp->key                = key;
     kvp->value              = value;
@@ -398,6 +519,44 @@ cardano_plutus_map_get(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  const size_t length = cardano_array_get_size(plutus_map->array);
+
+  if ((plutus_map->index == NULL) && (length >= INDEX_MIN_ENTRIES))
+  {
+    CARDANO_UNUSED(build_index(plutus_map));
+  }
+
+  if (plutus_map->index != NULL)
+  {
+    const uint64_t hash = cardano_plutus_data_compute_hash(key);
+    const size_t   mask = plutus_map->index_capacity - 1U;
+
+    for (size_t slot = (size_t)hash & mask; plutus_map->index[slot].position != 0U; slot = (slot + 1U) & mask)
+    {
+      const cardano_plutus_map_index_slot_t* entry = &plutus_map->index[slot];
+
+      if (entry->hash != hash)
+      {
+        continue;
+      }
+
+      cardano_object_t*         object = cardano_array_get(plutus_map->array, entry->position - 1U);
+      cardano_plutus_map_kvp_t* kvp    = (cardano_plutus_map_kvp_t*)((void*)object);
+
+      cardano_object_unref(&object);
+
+      if (cardano_plutus_data_equals(kvp->key, key))
+      {
+        cardano_plutus_data_ref(kvp->value);
+        *element = kvp->value;
+
+        return CARDANO_SUCCESS;
+      }
+    }
+
+    return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  }
+
   for (size_t i = 0; i < cardano_array_get_size(plutus_map->array); ++i)
   {
     cardano_object_t*         object = cardano_array_get(plutus_map->array, i);
@@ -447,7 +606,7 @@ cardano_plutus_map_insert(
   }
 
   kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
+  kvp->base.last_error    = NULL;
   kvp->base.deallocator   = cardano_plutus_map_kvp_deallocate;
   kvp->key                = key;
   kvp->value              = value;
@@ -461,7 +620,48 @@ cardano_plutus_map_insert(
   assert((old_size + 1U) == new_size);
 
   CARDANO_UNUSED(old_size);
-  CARDANO_UNUSED(new_size);
+
+  if (plutus_map->index != NULL)
+  {
+    if ((new_size * 2U) > plutus_map->index_capacity)
+    {
+      CARDANO_UNUSED(build_index(plutus_map));
+    }
+    else
+    {
+      index_entry(plutus_map, new_size - 1U);
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_plutus_map_get_key_value_at(
+  const cardano_plutus_map_t* plutus_map,
+  const size_t                index,
+  cardano_plutus_data_t**     key,
+  cardano_plutus_data_t**     value)
+{
+  if ((plutus_map == NULL) || (key == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (index >= cardano_array_get_size(plutus_map->array))
+  {
+    return CARDANO_ERROR_INDEX_OUT_OF_BOUNDS;
+  }
+
+  cardano_object_t*         object = cardano_array_get(plutus_map->array, index);
+  cardano_plutus_map_kvp_t* kvp    = (cardano_plutus_map_kvp_t*)((void*)object);
+
+  cardano_plutus_data_ref(kvp->key);
+  cardano_plutus_data_ref(kvp->value);
+  cardano_object_unref(&object);
+
+  *key   = kvp->key;
+  *value = kvp->value;
 
   return CARDANO_SUCCESS;
 }
@@ -665,3 +865,37 @@ cardano_plutus_map_get_last_error(const cardano_plutus_map_t* plutus_map)
 {
   return cardano_object_get_last_error(&plutus_map->base);
 }
+
+/**
+ * \brief Adds the footprint of an entry of a plutus map, its key and value.
+ */
+static void
+add_kvp_footprint(const cardano_object_t* item, cardano_footprint_context_t* context)
+{
+  const cardano_plutus_map_kvp_t* kvp = (const cardano_plutus_map_kvp_t*)((const void*)item);
+
+  if ((kvp == NULL) || !_cardano_footprint_visit(context, &kvp->base, CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION, sizeof(cardano_plutus_map_kvp_t)))
+  {
+    return;
+  }
+
+  _cardano_plutus_data_add_footprint(kvp->key, context);
+  _cardano_plutus_data_add_footprint(kvp->value, context);
+}
+
+void
+_cardano_plutus_map_add_footprint(const cardano_plutus_map_t* plutus_map, cardano_footprint_context_t* context)
+{
+  if ((plutus_map == NULL) || !_cardano_footprint_visit(context, &plutus_map->base, CARDANO_MEMORY_FOOTPRINT_TYPE_PLUTUS_DATA, sizeof(cardano_plutus_map_t)))
+  {
+    return;
+  }
+
+  if (plutus_map->index != NULL)
+  {
+    _cardano_footprint_add_block(context, CARDANO_MEMORY_FOOTPRINT_TYPE_PLUTUS_DATA, plutus_map->index_capacity * sizeof(cardano_plutus_map_index_slot_t));
+  }
+
+  _cardano_array_add_footprint(plutus_map->array, context, add_kvp_footprint);
+  _cardano_buffer_add_footprint(plutus_map->cbor_cache, context);
+}
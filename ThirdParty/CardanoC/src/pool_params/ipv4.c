@@ -163,7 +163,7 @@ cardano_ipv4_new(const byte_t* data, const size_t size, cardano_ipv4_t** ipv4)
 
   (*ipv4)->base.deallocator   = cardano_ipv4_deallocate;
   (*ipv4)->base.ref_count     = 1;
-  (*ipv4)->base.last_error[0] = '\0';
+  (*ipv4)->base.last_error    = NULL;
 
   cardano_safe_memcpy((*ipv4)->ip_bytes, 4, data, 4);
   ip_to_string((*ipv4)->ip_bytes, 4, (*ipv4)->ip_str, 16);
@@ -198,7 +198,7 @@ cardano_ipv4_from_string(const char* string, const size_t size, cardano_ipv4_t**
 
   (*ipv4)->base.deallocator   = cardano_ipv4_deallocate;
   (*ipv4)->base.ref_count     = 1;
-  (*ipv4)->base.last_error[0] = '\0';
+  (*ipv4)->base.last_error    = NULL;
 
   cardano_error_t result = ip_from_string(string, (*ipv4)->ip_bytes, 4);
 
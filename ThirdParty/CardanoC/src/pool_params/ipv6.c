@@ -166,7 +166,7 @@ cardano_ipv6_new(const byte_t* data, const size_t size, cardano_ipv6_t** ipv6)
 
   (*ipv6)->base.deallocator   = cardano_ipv6_deallocate;
   (*ipv6)->base.ref_count     = 1;
-  (*ipv6)->base.last_error[0] = '\0';
+  (*ipv6)->base.last_error    = NULL;
 
   cardano_safe_memcpy((*ipv6)->ip_bytes, 16, data, 16);
   ip_to_string((*ipv6)->ip_bytes, 16, (*ipv6)->ip_str, 40);
@@ -201,7 +201,7 @@ cardano_ipv6_from_string(const char* string, const size_t size, cardano_ipv6_t**
 
   (*ipv6)->base.deallocator   = cardano_ipv6_deallocate;
   (*ipv6)->base.ref_count     = 1;
-  (*ipv6)->base.last_error[0] = '\0';
+  (*ipv6)->base.last_error    = NULL;
 
   cardano_error_t result = ip_from_string(string, (*ipv6)->ip_bytes, 16);
 
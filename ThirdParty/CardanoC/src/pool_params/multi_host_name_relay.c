@@ -101,7 +101,7 @@ cardano_multi_host_name_relay_new(const char* dns, const size_t str_size, cardan
 
   (*multi_host_name_relay)->base.deallocator   = cardano_multi_host_name_relay_deallocate;
   (*multi_host_name_relay)->base.ref_count     = 1;
-  (*multi_host_name_relay)->base.last_error[0] = '\0';
+  (*multi_host_name_relay)->base.last_error    = NULL;
 
   CARDANO_UNUSED(memset((*multi_host_name_relay)->dns, 0, 65));
   cardano_safe_memcpy((*multi_host_name_relay)->dns, 65, dns, str_size);
@@ -115,7 +115,7 @@ cardano_pool_metadata_new(
 
   (*pool_metadata)->base.deallocator   = cardano_pool_metadata_deallocate;
   (*pool_metadata)->base.ref_count     = 1;
-  (*pool_metadata)->base.last_error[0] = '\0';
+  (*pool_metadata)->base.last_error    = NULL;
 
   CARDANO_UNUSED(memset((*pool_metadata)->url, 0, 65));
 
@@ -117,7 +117,7 @@ cardano_pool_owners_new(cardano_pool_owners_t** pool_owners)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_pool_owners_deallocate;
 
   list->array = cardano_array_new(128);
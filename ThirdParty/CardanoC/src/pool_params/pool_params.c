@@ -153,7 +153,7 @@ cardano_pool_params_new(
 
   (*pool_params)->base.deallocator   = cardano_pool_params_deallocate;
   (*pool_params)->base.ref_count     = 1;
-  (*pool_params)->base.last_error[0] = '\0';
+  (*pool_params)->base.last_error    = NULL;
 
   cardano_blake2b_hash_ref(operator_key_hash);
   (*pool_params)->operator_hash = operator_key_hash;
@@ -98,7 +98,7 @@ cardano_relay_new(void)
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_relay_deallocate;
 
   data->type                   = CARDANO_RELAY_TYPE_SINGLE_HOST_ADDRESS;
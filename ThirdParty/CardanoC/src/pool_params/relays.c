@@ -91,7 +91,7 @@ cardano_relays_new(cardano_relays_t** relays)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_relays_deallocate;
 
   list->array = cardano_array_new(128);
@@ -105,7 +105,7 @@ cardano_single_host_addr_relay_new(
 
   (*single_host_addr_relay)->base.deallocator   = cardano_single_host_addr_relay_deallocate;
   (*single_host_addr_relay)->base.ref_count     = 1;
-  (*single_host_addr_relay)->base.last_error[0] = '\0';
+  (*single_host_addr_relay)->base.last_error    = NULL;
   (*single_host_addr_relay)->port               = NULL;
   (*single_host_addr_relay)->ipv4               = NULL;
   (*single_host_addr_relay)->ipv6               = NULL;
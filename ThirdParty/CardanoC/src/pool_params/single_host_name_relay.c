@@ -106,7 +106,7 @@ cardano_single_host_name_relay_new(const uint16_t* port, const char* dns, const
 
   (*single_host_name_relay)->base.deallocator   = cardano_single_host_name_relay_deallocate;
   (*single_host_name_relay)->base.ref_count     = 1;
-  (*single_host_name_relay)->base.last_error[0] = '\0';
+  (*single_host_name_relay)->base.last_error    = NULL;
 
   CARDANO_UNUSED(memset((*single_host_name_relay)->dns, 0, 65));
   cardano_safe_memcpy((*single_host_name_relay)->dns, 65, dns, str_size);
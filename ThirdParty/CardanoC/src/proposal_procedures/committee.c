@@ -107,7 +107,7 @@ cardano_committee_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_committee_deallocate;
 
   cardano_unit_interval_ref(quorum_threshold);
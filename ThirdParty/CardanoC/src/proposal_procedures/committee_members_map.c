@@ -152,7 +152,7 @@ cardano_committee_members_map_new(cardano_committee_members_map_t** committee_me
   }
 
   map->base.ref_count     = 1;
-  map->base.last_error[0] = '\0';
+  map->base.last_error    = NULL;
   map->base.deallocator   = cardano_committee_members_map_deallocate;
 
   map->array = cardano_array_new(32);
@@ -247,7 +247,7 @@ cardano_committee_members_map_from_cbor(cardano_cbor_reader_t* reader, cardano_c
     }
 
     kvp->base.ref_count     = 0;
-    kvp->base.last_error[0] = '\0';
+    kvp->base.last_error    = NULL;
     kvp->base.deallocator   = cardano_committee_members_map_kvp_deallocate;
     kvp->key                = key;
     kvp->value              = value;
@@ -408,7 +408,7 @@ cardano_committee_members_map_insert(
   }
 
   kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
+  kvp->base.last_error    = NULL;
   kvp->base.deallocator   = cardano_committee_members_map_kvp_deallocate;
   kvp->key                = key;
   kvp->value              = value;
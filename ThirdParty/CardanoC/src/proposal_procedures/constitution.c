@@ -109,7 +109,7 @@ cardano_constitution_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_constitution_deallocate;
   data->script_hash        = NULL;
 
@@ -117,7 +117,7 @@ cardano_credential_set_new(cardano_credential_set_t** credential_set)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_credential_set_deallocate;
 
   list->array = cardano_array_new(128);
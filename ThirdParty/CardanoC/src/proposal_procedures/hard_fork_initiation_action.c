@@ -104,7 +104,7 @@ cardano_hard_fork_initiation_action_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_hard_fork_initiation_action_deallocate;
 
   cardano_protocol_version_ref(protocol_version);
@@ -90,7 +90,7 @@ cardano_info_action_new(cardano_info_action_t** info_action)
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_info_action_deallocate;
 
   *info_action = data;
@@ -96,7 +96,7 @@ cardano_no_confidence_action_new(
   }
 
   data->base.ref_count       = 1;
-  data->base.last_error[0]   = '\0';
+  data->base.last_error      = NULL;
   data->base.deallocator     = cardano_no_confidence_action_deallocate;
   data->governance_action_id = NULL;
 
@@ -109,7 +109,7 @@ cardano_parameter_change_action_new(
   }
 
   data->base.ref_count        = 1;
-  data->base.last_error[0]    = '\0';
+  data->base.last_error       = NULL;
   data->base.deallocator      = cardano_parameter_change_action_deallocate;
   data->governance_action_id  = NULL;
   data->protocol_param_update = NULL;
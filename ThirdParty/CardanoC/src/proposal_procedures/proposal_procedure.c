@@ -117,7 +117,7 @@ new_proposal_procedure(void)
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_proposal_procedure_deallocate;
 
   data->hard_fork_initiation_action = NULL;
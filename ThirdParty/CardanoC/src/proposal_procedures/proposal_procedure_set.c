@@ -91,7 +91,7 @@ cardano_proposal_procedure_set_new(cardano_proposal_procedure_set_t** proposal_p
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_proposal_procedure_set_deallocate;
 
   list->array = cardano_array_new(128);
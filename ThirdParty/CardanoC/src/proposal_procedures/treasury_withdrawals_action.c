@@ -105,7 +105,7 @@ cardano_treasury_withdrawals_action_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_treasury_withdrawals_action_deallocate;
   data->withdrawals        = NULL;
   data->policy_hash        = NULL;
@@ -122,7 +122,7 @@ cardano_update_committee_action_new(
   }
 
   data->base.ref_count        = 1;
-  data->base.last_error[0]    = '\0';
+  data->base.last_error       = NULL;
   data->base.deallocator      = cardano_update_committee_action_deallocate;
   data->governance_action_id  = NULL;
   data->members_to_be_removed = NULL;
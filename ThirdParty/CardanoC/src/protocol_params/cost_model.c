@@ -119,7 +119,7 @@ cardano_cost_model_new(
   (*cost_model)->language_version   = language;
   (*cost_model)->base.deallocator   = cardano_cost_model_deallocate;
   (*cost_model)->base.ref_count     = 1;
-  (*cost_model)->base.last_error[0] = '\0';
+  (*cost_model)->base.last_error    = NULL;
 
   for (size_t i = 0U; i < costs_size; ++i)
   {
@@ -125,7 +125,7 @@ cardano_costmdls_new(cardano_costmdls_t** costmdls)
 
   (*costmdls)->base.deallocator   = cardano_costmdls_deallocate;
   (*costmdls)->base.ref_count     = 1;
-  (*costmdls)->base.last_error[0] = '\0';
+  (*costmdls)->base.last_error    = NULL;
   (*costmdls)->plutus_v1_costs    = NULL;
   (*costmdls)->plutus_v2_costs    = NULL;
   (*costmdls)->plutus_v3_costs    = NULL;
@@ -283,6 +283,11 @@ cardano_costmdls_insert(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&costmdls->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (cost_model == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -170,7 +170,7 @@ cardano_drep_voting_thresholds_new(
 
   (*drep_voting_thresholds)->base.deallocator   = cardano_drep_voting_thresholds_deallocate;
   (*drep_voting_thresholds)->base.ref_count     = 1;
-  (*drep_voting_thresholds)->base.last_error[0] = '\0';
+  (*drep_voting_thresholds)->base.last_error    = NULL;
 
   cardano_unit_interval_ref(motion_no_confidence);
   (*drep_voting_thresholds)->motion_no_confidence = motion_no_confidence;
@@ -727,6 +727,11 @@ cardano_drep_voting_thresholds_set_motion_no_confidence(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&drep_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (motion_no_confidence == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -749,6 +754,11 @@ cardano_drep_voting_thresholds_set_committee_normal(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&drep_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (committee_normal == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -771,6 +781,11 @@ cardano_drep_voting_thresholds_set_committee_no_confidence(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&drep_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (committee_no_confidence == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -793,6 +808,11 @@ cardano_drep_voting_thresholds_set_update_constitution(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&drep_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (update_constitution == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -815,6 +835,11 @@ cardano_drep_voting_thresholds_set_hard_fork_initiation(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&drep_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (hard_fork_initiation == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -837,6 +862,11 @@ cardano_drep_voting_thresholds_set_pp_network_group(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&drep_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (pp_network_group == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -859,6 +889,11 @@ cardano_drep_voting_thresholds_set_pp_economic_group(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&drep_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (pp_economic_group == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -881,6 +916,11 @@ cardano_drep_voting_thresholds_set_pp_technical_group(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&drep_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (pp_technical_group == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -903,6 +943,11 @@ cardano_drep_voting_thresholds_set_pp_governance_group(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&drep_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (pp_governance_group == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -925,6 +970,11 @@ cardano_drep_voting_thresholds_set_treasury_withdrawal(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&drep_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (treasury_withdrawal == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
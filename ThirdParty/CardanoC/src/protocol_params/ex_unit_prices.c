@@ -109,7 +109,7 @@ cardano_ex_unit_prices_new(
 
   (*ex_unit_prices)->base.deallocator   = cardano_ex_unit_prices_deallocate;
   (*ex_unit_prices)->base.ref_count     = 1;
-  (*ex_unit_prices)->base.last_error[0] = '\0';
+  (*ex_unit_prices)->base.last_error    = NULL;
 
   cardano_unit_interval_ref(memory_prices);
   (*ex_unit_prices)->mem_prices = memory_prices;
@@ -266,6 +266,11 @@ cardano_ex_unit_prices_set_memory_prices(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&ex_unit_prices->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (memory_prices == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -288,6 +293,11 @@ cardano_ex_unit_prices_set_steps_prices(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&ex_unit_prices->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (steps_prices == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -130,7 +130,7 @@ cardano_pool_voting_thresholds_new(
 
   (*pool_voting_thresholds)->base.deallocator   = cardano_pool_voting_thresholds_deallocate;
   (*pool_voting_thresholds)->base.ref_count     = 1;
-  (*pool_voting_thresholds)->base.last_error[0] = '\0';
+  (*pool_voting_thresholds)->base.last_error    = NULL;
 
   cardano_unit_interval_ref(motion_no_confidence);
   (*pool_voting_thresholds)->motion_no_confidence = motion_no_confidence;
@@ -440,6 +440,11 @@ cardano_pool_voting_thresholds_set_motion_no_confidence(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&pool_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (motion_no_confidence == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -462,6 +467,11 @@ cardano_pool_voting_thresholds_set_committee_normal(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&pool_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (committee_normal == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -484,6 +494,11 @@ cardano_pool_voting_thresholds_set_committee_no_confidence(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&pool_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (committee_no_confidence == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -506,6 +521,11 @@ cardano_pool_voting_thresholds_set_hard_fork_initiation(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&pool_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (hard_fork_initiation == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -528,6 +548,11 @@ cardano_pool_voting_thresholds_set_security_relevant_param(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&pool_voting_thresholds->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (security_relevant_param == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
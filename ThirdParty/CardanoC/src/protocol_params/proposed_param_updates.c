@@ -163,7 +163,7 @@ cardano_proposed_param_updates_new(cardano_proposed_param_updates_t** proposed_p
   }
 
   map->base.ref_count     = 1;
-  map->base.last_error[0] = '\0';
+  map->base.last_error    = NULL;
   map->base.deallocator   = cardano_proposed_param_updates_deallocate;
 
   map->array = cardano_array_new(128);
@@ -259,7 +259,7 @@ cardano_proposed_param_updates_from_cbor(cardano_cbor_reader_t* reader, cardano_
     }
 
     kvp->base.ref_count     = 0;
-    kvp->base.last_error[0] = '\0';
+    kvp->base.last_error    = NULL;
     kvp->base.deallocator   = cardano_proposed_param_updates_kvp_deallocate;
     kvp->key                = key;
     kvp->value              = value;
@@ -380,7 +380,7 @@ cardano_proposed_param_updates_insert(
   }
 
   kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
+  kvp->base.last_error    = NULL;
   kvp->base.deallocator   = cardano_proposed_param_updates_kvp_deallocate;
   kvp->key                = genesis_delegate_key_hash;
   kvp->value              = protocol_param_update;
@@ -1245,7 +1245,7 @@ cardano_protocol_param_update_new(cardano_protocol_param_update_t** protocol_par
 
   (*protocol_param_update)->base.deallocator   = cardano_protocol_param_update_deallocate;
   (*protocol_param_update)->base.ref_count     = 1;
-  (*protocol_param_update)->base.last_error[0] = '\0';
+  (*protocol_param_update)->base.last_error    = NULL;
 
   (*protocol_param_update)->min_fee_a                         = NULL;
   (*protocol_param_update)->min_fee_b                         = NULL;
@@ -30,6 +30,10 @@
 #include <assert.h>
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+static const int64_t PROTOCOL_PARAMETERS_ARRAY_SIZE = 31;
+
 /* STRUCTURES ****************************************************************/
 
 /**
@@ -71,6 +75,7 @@ typedef struct cardano_protocol_parameters_t
     uint64_t                          drep_deposit;
     uint64_t                          drep_inactivity_period;
     cardano_unit_interval_t*          ref_script_cost_per_byte;
+    cardano_buffer_t*                 cost_models_cbor;
 } cardano_protocol_parameters_t;
 
 /* STATIC FUNCTIONS **********************************************************/
@@ -108,6 +113,7 @@ cardano_protocol_parameters_deallocate(void* object)
   cardano_pool_voting_thresholds_unref(&data->pool_voting_thresholds);
   cardano_drep_voting_thresholds_unref(&data->drep_voting_thresholds);
   cardano_unit_interval_unref(&data->ref_script_cost_per_byte);
+  cardano_buffer_unref(&data->cost_models_cbor);
 
   _cardano_free(object);
 }
@@ -309,6 +315,284 @@ cardano_get_drep_voting_thresholds(void)
   return thresholds;
 }
 
+/**
+ * \brief Decodes the cost models kept encoded by \ref cardano_protocol_parameters_from_cbor.
+ *
+ * \param[in] protocol_parameters The protocol parameters. Nothing happens if the cost models are already decoded.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of the decoder; the encoded cost models are kept on failure.
+ */
+static cardano_error_t
+decode_cost_models(cardano_protocol_parameters_t* protocol_parameters)
+{
+  if (protocol_parameters->cost_models_cbor == NULL)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(
+    cardano_buffer_get_data(protocol_parameters->cost_models_cbor),
+    cardano_buffer_get_size(protocol_parameters->cost_models_cbor));
+
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_costmdls_t*   cost_models = NULL;
+  const cardano_error_t result      = cardano_costmdls_from_cbor(reader, &cost_models);
+
+  cardano_cbor_reader_unref(&reader);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_costmdls_unref(&protocol_parameters->cost_models);
+  cardano_buffer_unref(&protocol_parameters->cost_models_cbor);
+
+  protocol_parameters->cost_models = cost_models;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Reads a unit interval and replaces the one held by a field.
+ *
+ * \param[in] reader The reader positioned at the interval.
+ * \param[in,out] field The field; its previous interval is released on success.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of the decoder.
+ */
+static cardano_error_t
+read_unit_interval(cardano_cbor_reader_t* reader, cardano_unit_interval_t** field)
+{
+  cardano_unit_interval_t* value  = NULL;
+  const cardano_error_t    result = cardano_unit_interval_from_cbor(reader, &value);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_unit_interval_unref(field);
+  *field = value;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Reads every field of a protocol parameters array, once its header has been read.
+ *
+ * \param[in] validator_name The name reported in decoding errors.
+ * \param[in] reader The reader positioned at the first field.
+ * \param[in,out] params The protocol parameters the fields are stored into.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of the first field that fails to decode.
+ */
+static cardano_error_t
+read_fields(const char* validator_name, cardano_cbor_reader_t* reader, cardano_protocol_parameters_t* params)
+{
+  uint64_t* const leading_fields[] = {
+    &params->min_fee_a,
+    &params->min_fee_b,
+    &params->max_block_body_size,
+    &params->max_tx_size,
+    &params->max_block_header_size,
+    &params->key_deposit,
+    &params->pool_deposit,
+    &params->max_epoch,
+    &params->n_opt
+  };
+
+  for (size_t i = 0U; i < (sizeof(leading_fields) / sizeof(leading_fields[0])); ++i)
+  {
+    cardano_error_t result = cardano_cbor_validate_uint_in_range(validator_name, "parameter", reader, leading_fields[i], 0, UINT64_MAX);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  cardano_unit_interval_t** const rewards_fields[] = {
+    &params->pool_pledge_influence,
+    &params->expansion_rate,
+    &params->treasury_growth_rate
+  };
+
+  for (size_t i = 0U; i < (sizeof(rewards_fields) / sizeof(rewards_fields[0])); ++i)
+  {
+    cardano_error_t result = read_unit_interval(reader, rewards_fields[i]);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  cardano_protocol_version_t* protocol_version = NULL;
+  cardano_error_t             result           = cardano_protocol_version_from_cbor(reader, &protocol_version);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_protocol_version_unref(&params->protocol_version);
+  params->protocol_version = protocol_version;
+
+  result = cardano_cbor_validate_uint_in_range(validator_name, "min_pool_cost", reader, &params->min_pool_cost, 0, UINT64_MAX);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_cbor_validate_uint_in_range(validator_name, "ada_per_utxo_byte", reader, &params->ada_per_utxo_byte, 0, UINT64_MAX);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_cbor_reader_state_t state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  result                            = cardano_cbor_reader_peek_state(reader, &state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (state != CARDANO_CBOR_READER_STATE_START_MAP)
+  {
+    cardano_cbor_reader_set_last_error(reader, "There was an error decoding 'protocol_parameters', 'cost_models' must be a map.");
+
+    return CARDANO_ERROR_UNEXPECTED_CBOR_TYPE;
+  }
+
+  result = cardano_cbor_reader_read_encoded_value(reader, &params->cost_models_cbor);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_costmdls_unref(&params->cost_models);
+
+  cardano_ex_unit_prices_t* execution_costs = NULL;
+  result                                    = cardano_ex_unit_prices_from_cbor(reader, &execution_costs);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_ex_unit_prices_unref(&params->execution_costs);
+  params->execution_costs = execution_costs;
+
+  cardano_ex_units_t** const ex_units_fields[] = { &params->max_tx_ex_units, &params->max_block_ex_units };
+
+  for (size_t i = 0U; i < (sizeof(ex_units_fields) / sizeof(ex_units_fields[0])); ++i)
+  {
+    cardano_ex_units_t* ex_units = NULL;
+    result                       = cardano_ex_units_from_cbor(reader, &ex_units);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    cardano_ex_units_unref(ex_units_fields[i]);
+    *ex_units_fields[i] = ex_units;
+  }
+
+  uint64_t* const collateral_fields[] = {
+    &params->max_value_size,
+    &params->collateral_percentage,
+    &params->max_collateral_inputs
+  };
+
+  for (size_t i = 0U; i < (sizeof(collateral_fields) / sizeof(collateral_fields[0])); ++i)
+  {
+    result = cardano_cbor_validate_uint_in_range(validator_name, "parameter", reader, collateral_fields[i], 0, UINT64_MAX);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  cardano_pool_voting_thresholds_t* pool_voting_thresholds = NULL;
+  result                                                   = cardano_pool_voting_thresholds_from_cbor(reader, &pool_voting_thresholds);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_pool_voting_thresholds_unref(&params->pool_voting_thresholds);
+  params->pool_voting_thresholds = pool_voting_thresholds;
+
+  cardano_drep_voting_thresholds_t* drep_voting_thresholds = NULL;
+  result                                                   = cardano_drep_voting_thresholds_from_cbor(reader, &drep_voting_thresholds);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_drep_voting_thresholds_unref(&params->drep_voting_thresholds);
+  params->drep_voting_thresholds = drep_voting_thresholds;
+
+  uint64_t* const governance_fields[] = {
+    &params->min_committee_size,
+    &params->committee_term_limit,
+    &params->governance_action_validity_period,
+    &params->governance_action_deposit,
+    &params->drep_deposit,
+    &params->drep_inactivity_period
+  };
+
+  for (size_t i = 0U; i < (sizeof(governance_fields) / sizeof(governance_fields[0])); ++i)
+  {
+    result = cardano_cbor_validate_uint_in_range(validator_name, "parameter", reader, governance_fields[i], 0, UINT64_MAX);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  return read_unit_interval(reader, &params->ref_script_cost_per_byte);
+}
+
+/**
+ * \brief Writes a sequence of unsigned integers.
+ *
+ * \param[in] writer The writer.
+ * \param[in] values The values, in order.
+ * \param[in] count The number of values.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of the writer.
+ */
+static cardano_error_t
+write_uints(cardano_cbor_writer_t* writer, const uint64_t* values, const size_t count)
+{
+  for (size_t i = 0U; i < count; ++i)
+  {
+    cardano_error_t result = cardano_cbor_writer_write_uint(writer, values[i]);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -328,7 +612,7 @@ cardano_protocol_parameters_new(cardano_protocol_parameters_t** protocol_paramet
 
   (*protocol_parameters)->base.deallocator   = cardano_protocol_parameters_deallocate;
   (*protocol_parameters)->base.ref_count     = 1;
-  (*protocol_parameters)->base.last_error[0] = '\0';
+  (*protocol_parameters)->base.last_error    = NULL;
 
   (*protocol_parameters)->min_fee_a                         = 0;
   (*protocol_parameters)->min_fee_b                         = 0;
@@ -363,6 +647,7 @@ cardano_protocol_parameters_new(cardano_protocol_parameters_t** protocol_paramet
   (*protocol_parameters)->drep_deposit                      = 0;
   (*protocol_parameters)->drep_inactivity_period            = 0;
   (*protocol_parameters)->ref_script_cost_per_byte          = cardano_get_one_interval();
+  (*protocol_parameters)->cost_models_cbor                  = NULL;
 
   if (((*protocol_parameters)->pool_pledge_influence == NULL) || ((*protocol_parameters)->expansion_rate == NULL) || ((*protocol_parameters)->treasury_growth_rate == NULL) || ((*protocol_parameters)->d == NULL) || ((*protocol_parameters)->extra_entropy == NULL) || ((*protocol_parameters)->protocol_version == NULL) || ((*protocol_parameters)->cost_models == NULL) || ((*protocol_parameters)->execution_costs == NULL) || ((*protocol_parameters)->max_tx_ex_units == NULL) || ((*protocol_parameters)->max_block_ex_units == NULL) || ((*protocol_parameters)->pool_voting_thresholds == NULL) || ((*protocol_parameters)->drep_voting_thresholds == NULL) || ((*protocol_parameters)->ref_script_cost_per_byte == NULL))
   {
@@ -374,6 +659,208 @@ cardano_protocol_parameters_new(cardano_protocol_parameters_t** protocol_paramet
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_protocol_parameters_from_cbor(cardano_cbor_reader_t* reader, cardano_protocol_parameters_t** protocol_parameters)
+{
+  if (protocol_parameters == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (reader == NULL)
+  {
+    *protocol_parameters = NULL;
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  static const char* validator_name = "protocol_parameters";
+
+  cardano_error_t result = cardano_cbor_validate_array_of_n_elements(validator_name, reader, (uint32_t)PROTOCOL_PARAMETERS_ARRAY_SIZE);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    *protocol_parameters = NULL;
+    return result;
+  }
+
+  cardano_protocol_parameters_t* params = NULL;
+  result                                = cardano_protocol_parameters_new(&params);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    *protocol_parameters = NULL;
+    return result;
+  }
+
+  result = read_fields(validator_name, reader, params);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_validate_end_array(validator_name, reader);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_protocol_parameters_unref(&params);
+    *protocol_parameters = NULL;
+    return result;
+  }
+
+  *protocol_parameters = params;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_protocol_parameters_to_cbor(const cardano_protocol_parameters_t* protocol_parameters, cardano_cbor_writer_t* writer)
+{
+  if ((protocol_parameters == NULL) || (writer == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = cardano_cbor_writer_write_start_array(writer, PROTOCOL_PARAMETERS_ARRAY_SIZE);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const uint64_t leading_fields[] = {
+    protocol_parameters->min_fee_a,
+    protocol_parameters->min_fee_b,
+    protocol_parameters->max_block_body_size,
+    protocol_parameters->max_tx_size,
+    protocol_parameters->max_block_header_size,
+    protocol_parameters->key_deposit,
+    protocol_parameters->pool_deposit,
+    protocol_parameters->max_epoch,
+    protocol_parameters->n_opt
+  };
+
+  result = write_uints(writer, leading_fields, sizeof(leading_fields) / sizeof(leading_fields[0]));
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const cardano_unit_interval_t* const rewards_fields[] = {
+    protocol_parameters->pool_pledge_influence,
+    protocol_parameters->expansion_rate,
+    protocol_parameters->treasury_growth_rate
+  };
+
+  for (size_t i = 0U; i < (sizeof(rewards_fields) / sizeof(rewards_fields[0])); ++i)
+  {
+    result = cardano_unit_interval_to_cbor(rewards_fields[i], writer);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  result = cardano_protocol_version_to_cbor(protocol_parameters->protocol_version, writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const uint64_t pool_cost_fields[] = { protocol_parameters->min_pool_cost, protocol_parameters->ada_per_utxo_byte };
+
+  result = write_uints(writer, pool_cost_fields, sizeof(pool_cost_fields) / sizeof(pool_cost_fields[0]));
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (protocol_parameters->cost_models_cbor != NULL)
+  {
+    result = cardano_cbor_writer_write_encoded(
+      writer,
+      cardano_buffer_get_data(protocol_parameters->cost_models_cbor),
+      cardano_buffer_get_size(protocol_parameters->cost_models_cbor));
+  }
+  else
+  {
+    result = cardano_costmdls_to_cbor(protocol_parameters->cost_models, writer);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_ex_unit_prices_to_cbor(protocol_parameters->execution_costs, writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_ex_units_to_cbor(protocol_parameters->max_tx_ex_units, writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_ex_units_to_cbor(protocol_parameters->max_block_ex_units, writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const uint64_t collateral_fields[] = {
+    protocol_parameters->max_value_size,
+    protocol_parameters->collateral_percentage,
+    protocol_parameters->max_collateral_inputs
+  };
+
+  result = write_uints(writer, collateral_fields, sizeof(collateral_fields) / sizeof(collateral_fields[0]));
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_pool_voting_thresholds_to_cbor(protocol_parameters->pool_voting_thresholds, writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_drep_voting_thresholds_to_cbor(protocol_parameters->drep_voting_thresholds, writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const uint64_t governance_fields[] = {
+    protocol_parameters->min_committee_size,
+    protocol_parameters->committee_term_limit,
+    protocol_parameters->governance_action_validity_period,
+    protocol_parameters->governance_action_deposit,
+    protocol_parameters->drep_deposit,
+    protocol_parameters->drep_inactivity_period
+  };
+
+  result = write_uints(writer, governance_fields, sizeof(governance_fields) / sizeof(governance_fields[0]));
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return cardano_unit_interval_to_cbor(protocol_parameters->ref_script_cost_per_byte, writer);
+}
+
 uint64_t
 cardano_protocol_parameters_get_min_fee_a(
   const cardano_protocol_parameters_t* protocol_parameters)
@@ -593,6 +1080,11 @@ cardano_protocol_parameters_get_cost_models(
     return NULL;
   }
 
+  if (!cardano_object_is_frozen(&protocol_parameters->base) && (decode_cost_models(protocol_parameters) != CARDANO_SUCCESS))
+  {
+    return NULL;
+  }
+
   cardano_costmdls_ref(protocol_parameters->cost_models);
   return protocol_parameters->cost_models;
 }
@@ -793,6 +1285,11 @@ cardano_protocol_parameters_set_min_fee_a(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->min_fee_a = min_fee_a;
   return CARDANO_SUCCESS;
 }
@@ -807,6 +1304,11 @@ cardano_protocol_parameters_set_min_fee_b(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->min_fee_b = min_fee_b;
   return CARDANO_SUCCESS;
 }
@@ -821,6 +1323,11 @@ cardano_protocol_parameters_set_max_block_body_size(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->max_block_body_size = max_block_body_size;
   return CARDANO_SUCCESS;
 }
@@ -835,6 +1342,11 @@ cardano_protocol_parameters_set_max_tx_size(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->max_tx_size = max_tx_size;
   return CARDANO_SUCCESS;
 }
@@ -849,6 +1361,11 @@ cardano_protocol_parameters_set_max_block_header_size(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->max_block_header_size = max_block_header_size;
   return CARDANO_SUCCESS;
 }
@@ -863,6 +1380,11 @@ cardano_protocol_parameters_set_key_deposit(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->key_deposit = key_deposit;
   return CARDANO_SUCCESS;
 }
@@ -877,6 +1399,11 @@ cardano_protocol_parameters_set_pool_deposit(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->pool_deposit = pool_deposit;
   return CARDANO_SUCCESS;
 }
@@ -891,6 +1418,11 @@ cardano_protocol_parameters_set_max_epoch(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->max_epoch = max_epoch;
   return CARDANO_SUCCESS;
 }
@@ -905,6 +1437,11 @@ cardano_protocol_parameters_set_n_opt(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->n_opt = n_opt;
   return CARDANO_SUCCESS;
 }
@@ -919,6 +1456,11 @@ cardano_protocol_parameters_set_pool_pledge_influence(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_unit_interval_ref(pool_pledge_influence);
   cardano_unit_interval_unref(&protocol_parameters->pool_pledge_influence);
   protocol_parameters->pool_pledge_influence = pool_pledge_influence;
@@ -935,6 +1477,11 @@ cardano_protocol_parameters_set_expansion_rate(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_unit_interval_ref(expansion_rate);
   cardano_unit_interval_unref(&protocol_parameters->expansion_rate);
   protocol_parameters->expansion_rate = expansion_rate;
@@ -951,6 +1498,11 @@ cardano_protocol_parameters_set_treasury_growth_rate(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_unit_interval_ref(treasury_growth_rate);
   cardano_unit_interval_unref(&protocol_parameters->treasury_growth_rate);
   protocol_parameters->treasury_growth_rate = treasury_growth_rate;
@@ -967,6 +1519,11 @@ cardano_protocol_parameters_set_d(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_unit_interval_ref(d);
   cardano_unit_interval_unref(&protocol_parameters->d);
   protocol_parameters->d = d;
@@ -983,6 +1540,11 @@ cardano_protocol_parameters_set_extra_entropy(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_buffer_ref(extra_entropy);
   cardano_buffer_unref(&protocol_parameters->extra_entropy);
   protocol_parameters->extra_entropy = extra_entropy;
@@ -999,6 +1561,11 @@ cardano_protocol_parameters_set_protocol_version(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_protocol_version_ref(protocol_version);
   cardano_protocol_version_unref(&protocol_parameters->protocol_version);
   protocol_parameters->protocol_version = protocol_version;
@@ -1015,6 +1582,11 @@ cardano_protocol_parameters_set_min_pool_cost(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->min_pool_cost = min_pool_cost;
   return CARDANO_SUCCESS;
 }
@@ -1029,6 +1601,11 @@ cardano_protocol_parameters_set_ada_per_utxo_byte(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->ada_per_utxo_byte = ada_per_utxo_byte;
   return CARDANO_SUCCESS;
 }
@@ -1043,8 +1620,14 @@ cardano_protocol_parameters_set_cost_models(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_costmdls_ref(cost_models);
   cardano_costmdls_unref(&protocol_parameters->cost_models);
+  cardano_buffer_unref(&protocol_parameters->cost_models_cbor);
   protocol_parameters->cost_models = cost_models;
   return CARDANO_SUCCESS;
 }
@@ -1059,6 +1642,11 @@ cardano_protocol_parameters_set_execution_costs(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_ex_unit_prices_ref(execution_costs);
   cardano_ex_unit_prices_unref(&protocol_parameters->execution_costs);
   protocol_parameters->execution_costs = execution_costs;
@@ -1075,6 +1663,11 @@ cardano_protocol_parameters_set_max_tx_ex_units(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_ex_units_ref(max_tx_ex_units);
   cardano_ex_units_unref(&protocol_parameters->max_tx_ex_units);
   protocol_parameters->max_tx_ex_units = max_tx_ex_units;
@@ -1091,6 +1684,11 @@ cardano_protocol_parameters_set_max_block_ex_units(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_ex_units_ref(max_block_ex_units);
   cardano_ex_units_unref(&protocol_parameters->max_block_ex_units);
   protocol_parameters->max_block_ex_units = max_block_ex_units;
@@ -1107,6 +1705,11 @@ cardano_protocol_parameters_set_max_value_size(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->max_value_size = max_value_size;
   return CARDANO_SUCCESS;
 }
@@ -1121,6 +1724,11 @@ cardano_protocol_parameters_set_collateral_percentage(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->collateral_percentage = collateral_percentage;
   return CARDANO_SUCCESS;
 }
@@ -1135,6 +1743,11 @@ cardano_protocol_parameters_set_max_collateral_inputs(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->max_collateral_inputs = max_collateral_inputs;
   return CARDANO_SUCCESS;
 }
@@ -1149,6 +1762,11 @@ cardano_protocol_parameters_set_pool_voting_thresholds(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_pool_voting_thresholds_ref(pool_voting_thresholds);
   cardano_pool_voting_thresholds_unref(&protocol_parameters->pool_voting_thresholds);
   protocol_parameters->pool_voting_thresholds = pool_voting_thresholds;
@@ -1165,6 +1783,11 @@ cardano_protocol_parameters_set_drep_voting_thresholds(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_drep_voting_thresholds_ref(drep_voting_thresholds);
   cardano_drep_voting_thresholds_unref(&protocol_parameters->drep_voting_thresholds);
   protocol_parameters->drep_voting_thresholds = drep_voting_thresholds;
@@ -1181,6 +1804,11 @@ cardano_protocol_parameters_set_min_committee_size(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->min_committee_size = min_committee_size;
   return CARDANO_SUCCESS;
 }
@@ -1195,6 +1823,11 @@ cardano_protocol_parameters_set_committee_term_limit(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->committee_term_limit = committee_term_limit;
   return CARDANO_SUCCESS;
 }
@@ -1209,6 +1842,11 @@ cardano_protocol_parameters_set_governance_action_validity_period(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->governance_action_validity_period = governance_action_validity_period;
   return CARDANO_SUCCESS;
 }
@@ -1223,6 +1861,11 @@ cardano_protocol_parameters_set_governance_action_deposit(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->governance_action_deposit = governance_action_deposit;
   return CARDANO_SUCCESS;
 }
@@ -1237,6 +1880,11 @@ cardano_protocol_parameters_set_drep_deposit(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->drep_deposit = drep_deposit;
   return CARDANO_SUCCESS;
 }
@@ -1251,6 +1899,11 @@ cardano_protocol_parameters_set_drep_inactivity_period(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   protocol_parameters->drep_inactivity_period = drep_inactivity_period;
   return CARDANO_SUCCESS;
 }
@@ -1265,12 +1918,55 @@ cardano_protocol_parameters_set_ref_script_cost_per_byte(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&protocol_parameters->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_unit_interval_ref(ref_script_cost_per_byte);
   cardano_unit_interval_unref(&protocol_parameters->ref_script_cost_per_byte);
   protocol_parameters->ref_script_cost_per_byte = ref_script_cost_per_byte;
   return CARDANO_SUCCESS;
 }
 
+void
+cardano_protocol_parameters_freeze(cardano_protocol_parameters_t* protocol_parameters)
+{
+  if (protocol_parameters == NULL)
+  {
+    return;
+  }
+
+  CARDANO_UNUSED(decode_cost_models(protocol_parameters));
+
+  cardano_object_freeze(&protocol_parameters->base);
+
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->pool_pledge_influence));
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->expansion_rate));
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->treasury_growth_rate));
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->d));
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->extra_entropy));
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->protocol_version));
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->cost_models));
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->execution_costs));
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->max_tx_ex_units));
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->max_block_ex_units));
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->pool_voting_thresholds));
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->drep_voting_thresholds));
+  cardano_object_freeze((cardano_object_t*)((void*)protocol_parameters->ref_script_cost_per_byte));
+}
+
+bool
+cardano_protocol_parameters_is_frozen(const cardano_protocol_parameters_t* protocol_parameters)
+{
+  if (protocol_parameters == NULL)
+  {
+    return false;
+  }
+
+  return cardano_object_is_frozen(&protocol_parameters->base);
+}
+
 void
 cardano_protocol_parameters_unref(cardano_protocol_parameters_t** protocol_parameters)
 {
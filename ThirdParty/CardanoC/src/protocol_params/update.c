@@ -95,7 +95,7 @@ cardano_update_new(uint64_t epoch, cardano_proposed_param_updates_t* updates, ca
 
   (*update)->base.deallocator   = cardano_update_deallocate;
   (*update)->base.ref_count     = 1;
-  (*update)->base.last_error[0] = '\0';
+  (*update)->base.last_error    = NULL;
 
   (*update)->epoch = epoch;
 
@@ -0,0 +1,762 @@
+/**
+ * \file async_provider.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/object.h>
+#include <cardano/providers/async_provider.h>
+
+#include "../allocators.h"
+#include "internals/provider_request_internals.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A query in flight that identical requests join instead of starting their own.
+ *
+ * The implementation is handed an internal upstream request; on completion its answer is forwarded to every
+ * waiting request, in the order they joined. The query holds a reference to the provider, so the provider outlives
+ * it.
+ */
+typedef struct coalesced_query_t
+{
+    struct coalesced_query_t*    next;
+    cardano_async_provider_t*    provider;
+    char*                        key;
+    cardano_provider_request_t*  upstream;
+    cardano_provider_request_t** waiters;
+    size_t                       waiter_count;
+    size_t                       waiter_capacity;
+} coalesced_query_t;
+
+/**
+ * \brief Opaque structure representing an asynchronous Cardano data provider instance.
+ */
+typedef struct cardano_async_provider_t
+{
+    cardano_object_t              base;
+    cardano_async_provider_impl_t impl;
+    coalesced_query_t*            queries;
+} cardano_async_provider_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates an asynchronous provider object.
+ *
+ * \param object A void pointer to the provider object to be deallocated.
+ */
+static void
+cardano_async_provider_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_async_provider_t* provider = (cardano_async_provider_t*)object;
+
+  cardano_object_unref(&provider->impl.context);
+
+  _cardano_free(object);
+}
+
+/**
+ * \brief Hands a request that was just started over to the caller, or reports why it did not start.
+ *
+ * \param[in] provider The provider the request was started on.
+ * \param[in] result The result of starting the request.
+ * \param[in] pending The request. This function consumes the reference to it.
+ * \param[out] request Receives the request on success, if not NULL.
+ *
+ * \return \p result.
+ */
+static cardano_error_t
+hand_over_request(
+  cardano_async_provider_t*    provider,
+  const cardano_error_t        result,
+  cardano_provider_request_t*  pending,
+  cardano_provider_request_t** request)
+{
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_async_provider_set_last_error(provider, provider->impl.error_message);
+    cardano_provider_request_unref(&pending);
+
+    return result;
+  }
+
+  if (request != NULL)
+  {
+    *request = pending;
+  }
+  else
+  {
+    cardano_provider_request_unref(&pending);
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Detaches a query from the in-flight list of its provider, if it is still in it.
+ *
+ * \param[in] query The query.
+ *
+ * \return true if the query was in the list.
+ */
+static bool
+unlink_query(coalesced_query_t* query)
+{
+  coalesced_query_t** link = &query->provider->queries;
+
+  while (*link != NULL)
+  {
+    if (*link == query)
+    {
+      *link = query->next;
+
+      return true;
+    }
+
+    link = &(*link)->next;
+  }
+
+  return false;
+}
+
+/**
+ * \brief Releases a query that is no longer in the in-flight list, along with its remaining waiters.
+ *
+ * \param[in] query The query.
+ */
+static void
+free_query(coalesced_query_t* query)
+{
+  for (size_t i = 0U; i < query->waiter_count; ++i)
+  {
+    CARDANO_UNUSED(cardano_provider_request_set_cancel_handler(query->waiters[i], NULL, NULL));
+    cardano_provider_request_unref(&query->waiters[i]);
+  }
+
+  cardano_provider_request_unref(&query->upstream);
+  cardano_async_provider_unref(&query->provider);
+
+  _cardano_free(query->waiters);
+  _cardano_free(query->key);
+  _cardano_free(query);
+}
+
+/**
+ * \brief Cancel handler of a request waiting on a query; drops the request, and the query once nobody waits on it.
+ *
+ * \param[in] request The cancelled request.
+ * \param[in] cancel_data The query.
+ */
+static void
+cancel_waiter(cardano_provider_request_t* request, void* cancel_data)
+{
+  coalesced_query_t* query = (coalesced_query_t*)cancel_data;
+
+  for (size_t i = 0U; i < query->waiter_count; ++i)
+  {
+    if (query->waiters[i] == request)
+    {
+      cardano_provider_request_unref(&query->waiters[i]);
+
+      --query->waiter_count;
+      CARDANO_UNUSED(memmove(&query->waiters[i], &query->waiters[i + 1U], (query->waiter_count - i) * sizeof(cardano_provider_request_t*)));
+
+      break;
+    }
+  }
+
+  if (query->waiter_count == 0U)
+  {
+    CARDANO_UNUSED(unlink_query(query));
+    CARDANO_UNUSED(cardano_provider_request_cancel(query->upstream));
+
+    free_query(query);
+  }
+}
+
+/**
+ * \brief Adds a request to the waiters of a query.
+ *
+ * \param[in] query The query.
+ * \param[in] request The request. The query takes a reference to it.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+add_waiter(coalesced_query_t* query, cardano_provider_request_t* request)
+{
+  if (query->waiter_count == query->waiter_capacity)
+  {
+    const size_t                 capacity = (query->waiter_capacity == 0U) ? 4U : (query->waiter_capacity * 2U);
+    cardano_provider_request_t** waiters  = _cardano_realloc(query->waiters, capacity * sizeof(cardano_provider_request_t*));
+
+    if (waiters == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    query->waiters         = waiters;
+    query->waiter_capacity = capacity;
+  }
+
+  cardano_provider_request_ref(request);
+  query->waiters[query->waiter_count] = request;
+  ++query->waiter_count;
+
+  return cardano_provider_request_set_cancel_handler(request, cancel_waiter, query);
+}
+
+/**
+ * \brief Takes a completed query out of the in-flight list, so new requests start a fresh one.
+ *
+ * The waiters are detached from the query before any of them is completed, so a callback that cancels another
+ * waiter, or starts an identical request, does not touch the query being completed.
+ *
+ * \param[in] query The query.
+ * \param[out] waiter_count The number of waiters.
+ *
+ * \return The waiters, each holding a reference the caller must release, in the order they joined. The caller must
+ *         release the array with `_cardano_free`.
+ */
+static cardano_provider_request_t**
+take_waiters(coalesced_query_t* query, size_t* waiter_count)
+{
+  cardano_provider_request_t** waiters = query->waiters;
+
+  *waiter_count = query->waiter_count;
+
+  for (size_t i = 0U; i < *waiter_count; ++i)
+  {
+    CARDANO_UNUSED(cardano_provider_request_set_cancel_handler(waiters[i], NULL, NULL));
+  }
+
+  query->waiters         = NULL;
+  query->waiter_count    = 0U;
+  query->waiter_capacity = 0U;
+
+  CARDANO_UNUSED(unlink_query(query));
+
+  return waiters;
+}
+
+/**
+ * \brief Completion callback of the upstream request of a parameters query; forwards the answer to every waiter.
+ */
+static void
+on_coalesced_parameters(
+  cardano_provider_request_t*    request,
+  const cardano_error_t          result,
+  cardano_protocol_parameters_t* parameters,
+  void*                          user_data)
+{
+  coalesced_query_t*           query        = (coalesced_query_t*)user_data;
+  size_t                       waiter_count = 0U;
+  cardano_provider_request_t** waiters      = take_waiters(query, &waiter_count);
+
+  for (size_t i = 0U; i < waiter_count; ++i)
+  {
+    if (result == CARDANO_SUCCESS)
+    {
+      CARDANO_UNUSED(cardano_provider_request_complete_parameters(waiters[i], parameters));
+    }
+    else
+    {
+      CARDANO_UNUSED(cardano_provider_request_fail(waiters[i], result, cardano_provider_request_get_last_error(request)));
+    }
+
+    cardano_provider_request_unref(&waiters[i]);
+  }
+
+  _cardano_free(waiters);
+  free_query(query);
+}
+
+/**
+ * \brief Completion callback of the upstream request of an unspent outputs query; forwards the answer to every waiter.
+ */
+static void
+on_coalesced_utxo_list(
+  cardano_provider_request_t* request,
+  const cardano_error_t       result,
+  cardano_utxo_list_t*        utxo_list,
+  void*                       user_data)
+{
+  coalesced_query_t*           query        = (coalesced_query_t*)user_data;
+  size_t                       waiter_count = 0U;
+  cardano_provider_request_t** waiters      = take_waiters(query, &waiter_count);
+
+  for (size_t i = 0U; i < waiter_count; ++i)
+  {
+    if (result == CARDANO_SUCCESS)
+    {
+      CARDANO_UNUSED(cardano_provider_request_complete_utxo_list(waiters[i], utxo_list));
+    }
+    else
+    {
+      CARDANO_UNUSED(cardano_provider_request_fail(waiters[i], result, cardano_provider_request_get_last_error(request)));
+    }
+
+    cardano_provider_request_unref(&waiters[i]);
+  }
+
+  _cardano_free(waiters);
+  free_query(query);
+}
+
+/**
+ * \brief Tells whether a query is still in flight, without touching it, as it may have been freed already.
+ *
+ * \param[in] provider The provider.
+ * \param[in] query The query.
+ *
+ * \return true if the query is in the in-flight list of the provider.
+ */
+static bool
+is_in_flight(const cardano_async_provider_t* provider, const coalesced_query_t* query)
+{
+  for (const coalesced_query_t* current = provider->queries; current != NULL; current = current->next)
+  {
+    if (current == query)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * \brief Finds the in-flight query with the given key.
+ *
+ * \param[in] provider The provider.
+ * \param[in] key The key of the query.
+ *
+ * \return The query, or NULL if there is none.
+ */
+static coalesced_query_t*
+find_query(const cardano_async_provider_t* provider, const char* key)
+{
+  for (coalesced_query_t* query = provider->queries; query != NULL; query = query->next)
+  {
+    if (strcmp(query->key, key) == 0)
+    {
+      return query;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Creates a query and its upstream request, and makes it the in-flight query of its key.
+ *
+ * \param[in] provider The provider.
+ * \param[in] key The key of the query.
+ * \param[in] type The type of the query, either parameters or unspent outputs.
+ * \param[out] query On success, the new query.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+new_query(
+  cardano_async_provider_t*             provider,
+  const char*                           key,
+  const cardano_provider_request_type_t type,
+  coalesced_query_t**                   query)
+{
+  *query = _cardano_malloc(sizeof(coalesced_query_t));
+
+  if (*query == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(*query, 0, sizeof(coalesced_query_t)));
+
+  const size_t key_size = strlen(key) + 1U;
+
+  (*query)->key = _cardano_malloc(key_size);
+
+  cardano_error_t result = ((*query)->key != NULL) ? CARDANO_SUCCESS : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+
+  if (result == CARDANO_SUCCESS)
+  {
+    CARDANO_UNUSED(memcpy((*query)->key, key, key_size));
+
+    result = (type == CARDANO_PROVIDER_REQUEST_TYPE_GET_PARAMETERS)
+      ? _cardano_provider_request_new_parameters(on_coalesced_parameters, *query, &(*query)->upstream)
+      : _cardano_provider_request_new_utxo_list(on_coalesced_utxo_list, *query, &(*query)->upstream);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    _cardano_free((*query)->key);
+    _cardano_free(*query);
+    *query = NULL;
+
+    return result;
+  }
+
+  cardano_async_provider_ref(provider);
+
+  (*query)->provider = provider;
+  (*query)->next     = provider->queries;
+  provider->queries  = *query;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Makes a request wait on the in-flight query of its key, starting the query if there is none.
+ *
+ * \param[in] provider The provider.
+ * \param[in] key The key identifying identical queries.
+ * \param[in] pending The request of the caller.
+ * \param[in] address The address of an unspent outputs query, or NULL for a parameters query.
+ *
+ * \return \ref CARDANO_SUCCESS if the request is waiting or was already answered, or the error that kept the query
+ *         from starting. On error the request is left untouched.
+ */
+static cardano_error_t
+join_query(
+  cardano_async_provider_t*   provider,
+  const char*                 key,
+  cardano_provider_request_t* pending,
+  cardano_address_t*          address)
+{
+  coalesced_query_t* query = find_query(provider, key);
+
+  if (query != NULL)
+  {
+    return add_waiter(query, pending);
+  }
+
+  cardano_error_t result = new_query(provider, key, cardano_provider_request_get_type(pending), &query);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = add_waiter(query, pending);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    // The implementation may complete the query, and free it, before returning.
+    cardano_provider_request_t* upstream = query->upstream;
+
+    cardano_provider_request_ref(upstream);
+
+    result = (address == NULL)
+      ? provider->impl.get_parameters(&provider->impl, upstream)
+      : provider->impl.get_unspent_outputs(&provider->impl, upstream, address);
+
+    cardano_provider_request_unref(&upstream);
+  }
+
+  if ((result != CARDANO_SUCCESS) && is_in_flight(provider, query))
+  {
+    CARDANO_UNUSED(unlink_query(query));
+    free_query(query);
+  }
+
+  return result;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_async_provider_new(
+  cardano_async_provider_impl_t impl,
+  cardano_async_provider_t**    provider)
+{
+  if (provider == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *provider = _cardano_malloc(sizeof(cardano_async_provider_t));
+
+  if (*provider == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  (*provider)->base.deallocator   = cardano_async_provider_deallocate;
+  (*provider)->base.ref_count     = 1;
+  (*provider)->base.last_error    = NULL;
+
+  (*provider)->impl    = impl;
+  (*provider)->queries = NULL;
+
+  (*provider)->impl.name[sizeof((*provider)->impl.name) - 1U] = '\0';
+  (*provider)->impl.error_message[0]                          = '\0';
+
+  return CARDANO_SUCCESS;
+}
+
+const char*
+cardano_async_provider_get_name(const cardano_async_provider_t* provider)
+{
+  if (provider == NULL)
+  {
+    return "";
+  }
+
+  return provider->impl.name;
+}
+
+cardano_network_magic_t
+cardano_async_provider_get_network_magic(const cardano_async_provider_t* provider)
+{
+  if (provider == NULL)
+  {
+    return CARDANO_NETWORK_MAGIC_PREPROD;
+  }
+
+  return provider->impl.network_magic;
+}
+
+cardano_error_t
+cardano_async_provider_get_parameters(
+  cardano_async_provider_t*     provider,
+  cardano_parameters_callback_t callback,
+  void*                         user_data,
+  cardano_provider_request_t**  request)
+{
+  if (provider == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (provider->impl.get_parameters == NULL)
+  {
+    return CARDANO_ERROR_NOT_IMPLEMENTED;
+  }
+
+  cardano_provider_request_t* pending = NULL;
+  cardano_error_t             result  = _cardano_provider_request_new_parameters(callback, user_data, &pending);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = join_query(provider, "p", pending, NULL);
+
+  return hand_over_request(provider, result, pending, request);
+}
+
+cardano_error_t
+cardano_async_provider_get_unspent_outputs(
+  cardano_async_provider_t*    provider,
+  cardano_address_t*           address,
+  cardano_utxo_list_callback_t callback,
+  void*                        user_data,
+  cardano_provider_request_t** request)
+{
+  if ((provider == NULL) || (address == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (provider->impl.get_unspent_outputs == NULL)
+  {
+    return CARDANO_ERROR_NOT_IMPLEMENTED;
+  }
+
+  const char* address_string = cardano_address_get_string(address);
+
+  if (address_string == NULL)
+  {
+    return CARDANO_ERROR_INVALID_ADDRESS_FORMAT;
+  }
+
+  cardano_provider_request_t* pending = NULL;
+  cardano_error_t             result  = _cardano_provider_request_new_utxo_list(callback, user_data, &pending);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  char key[512] = { 0 };
+
+  CARDANO_UNUSED(snprintf(key, sizeof(key), "u:%s", address_string));
+
+  result = join_query(provider, key, pending, address);
+
+  return hand_over_request(provider, result, pending, request);
+}
+
+cardano_error_t
+cardano_async_provider_submit_transaction(
+  cardano_async_provider_t*    provider,
+  cardano_transaction_t*       tx,
+  cardano_tx_id_callback_t     callback,
+  void*                        user_data,
+  cardano_provider_request_t** request)
+{
+  if ((provider == NULL) || (tx == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (provider->impl.post_transaction_to_chain == NULL)
+  {
+    return CARDANO_ERROR_NOT_IMPLEMENTED;
+  }
+
+  cardano_provider_request_t* pending = NULL;
+  cardano_error_t             result  = _cardano_provider_request_new_tx_id(callback, user_data, &pending);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = provider->impl.post_transaction_to_chain(&provider->impl, pending, tx);
+
+  return hand_over_request(provider, result, pending, request);
+}
+
+cardano_error_t
+cardano_async_provider_evaluate_transaction(
+  cardano_async_provider_t*        provider,
+  cardano_transaction_t*           tx,
+  cardano_utxo_list_t*             additional_utxos,
+  cardano_redeemer_list_callback_t callback,
+  void*                            user_data,
+  cardano_provider_request_t**     request)
+{
+  if ((provider == NULL) || (tx == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (provider->impl.evaluate_transaction == NULL)
+  {
+    return CARDANO_ERROR_NOT_IMPLEMENTED;
+  }
+
+  cardano_provider_request_t* pending = NULL;
+  cardano_error_t             result  = _cardano_provider_request_new_redeemers(callback, user_data, &pending);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = provider->impl.evaluate_transaction(&provider->impl, pending, tx, additional_utxos);
+
+  return hand_over_request(provider, result, pending, request);
+}
+
+cardano_error_t
+cardano_async_provider_confirm_transaction(
+  cardano_async_provider_t*       provider,
+  cardano_blake2b_hash_t*         tx_id,
+  const uint64_t                  timeout_ms,
+  cardano_confirmation_callback_t callback,
+  void*                           user_data,
+  cardano_provider_request_t**    request)
+{
+  if ((provider == NULL) || (tx_id == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (provider->impl.await_transaction_confirmation == NULL)
+  {
+    return CARDANO_ERROR_NOT_IMPLEMENTED;
+  }
+
+  cardano_provider_request_t* pending = NULL;
+  cardano_error_t             result  = _cardano_provider_request_new_confirmation(callback, user_data, &pending);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = provider->impl.await_transaction_confirmation(&provider->impl, pending, tx_id, timeout_ms);
+
+  return hand_over_request(provider, result, pending, request);
+}
+
+void
+cardano_async_provider_unref(cardano_async_provider_t** provider)
+{
+  if ((provider == NULL) || (*provider == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*provider)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *provider = NULL;
+    return;
+  }
+}
+
+void
+cardano_async_provider_ref(cardano_async_provider_t* provider)
+{
+  if (provider == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&provider->base);
+}
+
+size_t
+cardano_async_provider_refcount(const cardano_async_provider_t* provider)
+{
+  if (provider == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&provider->base);
+}
+
+void
+cardano_async_provider_set_last_error(cardano_async_provider_t* provider, const char* message)
+{
+  cardano_object_set_last_error(&provider->base, message);
+}
+
+const char*
+cardano_async_provider_get_last_error(const cardano_async_provider_t* provider)
+{
+  return cardano_object_get_last_error(&provider->base);
+}
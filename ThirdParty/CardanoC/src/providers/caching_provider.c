@@ -0,0 +1,1190 @@
+/**
+ * \file caching_provider.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/object.h>
+#include <cardano/providers/caching_provider.h>
+#include <cardano/time.h>
+
+#include "../allocators.h"
+#include "../string_safe.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Expiry time of the entries that never expire.
+ */
+static const uint64_t NEVER_EXPIRES = UINT64_MAX;
+
+/**
+ * \brief The size of the buffers cache keys are built in; the longest key is an address followed by an asset ID.
+ */
+#define CACHE_KEY_SIZE 512U
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief One cached answer.
+ *
+ * The first character of the key tells what the entry holds:
+ * `p` protocol parameters, `u` the UTxOs of an address, `a` the UTxOs of an address holding an asset,
+ * `n` the UTxO holding an NFT, `r` a rewards balance, `d` a datum by hash and `o` an output by input.
+ */
+typedef struct cache_entry_t
+{
+    char*             key;
+    uint64_t          key_hash;
+    uint64_t          expires_at_ms;
+    cardano_object_t* object;
+    uint64_t          number;
+} cache_entry_t;
+
+/**
+ * \brief Context of a caching provider.
+ */
+typedef struct caching_provider_context_t
+{
+    cardano_object_t                   base;
+    cardano_provider_t*                provider;
+    cardano_caching_provider_options_t options;
+    cache_entry_t*                     entries;
+    size_t                             entry_count;
+    size_t                             entry_capacity;
+} caching_provider_context_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Reads the system clock.
+ *
+ * \param[in] clock_data Unused.
+ *
+ * \return The current time in milliseconds.
+ */
+static uint64_t
+system_clock(void* clock_data)
+{
+  CARDANO_UNUSED(clock_data);
+
+  struct timespec now = { 0 };
+
+  if (timespec_get(&now, TIME_UTC) == 0)
+  {
+    return 0U;
+  }
+
+  return ((uint64_t)now.tv_sec * 1000U) + ((uint64_t)now.tv_nsec / 1000000U);
+}
+
+/**
+ * \brief Hashes a cache key with 64-bit FNV-1a.
+ *
+ * \param[in] key The null-terminated key.
+ *
+ * \return The hash of the key.
+ */
+static uint64_t
+hash_key(const char* key)
+{
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (const char* c = key; *c != '\0'; ++c)
+  {
+    hash ^= (uint8_t)*c;
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+/**
+ * \brief Gets the current time of the clock of a caching provider.
+ *
+ * \param[in] context The caching provider context.
+ *
+ * \return The current time in milliseconds.
+ */
+static uint64_t
+now_ms(const caching_provider_context_t* context)
+{
+  return context->options.clock(context->options.clock_data);
+}
+
+/**
+ * \brief Releases the resources of an entry and removes it from the cache.
+ *
+ * \param[in] context The caching provider context.
+ * \param[in] index The index of the entry. The last entry takes its place.
+ */
+static void
+remove_entry(caching_provider_context_t* context, const size_t index)
+{
+  cache_entry_t* entry = &context->entries[index];
+
+  _cardano_free(entry->key);
+  cardano_object_unref(&entry->object);
+
+  --context->entry_count;
+
+  if (index != context->entry_count)
+  {
+    context->entries[index] = context->entries[context->entry_count];
+  }
+}
+
+/**
+ * \brief Removes the entries that have expired.
+ *
+ * \param[in] context The caching provider context.
+ * \param[in] now The current time in milliseconds.
+ */
+static void
+remove_expired_entries(caching_provider_context_t* context, const uint64_t now)
+{
+  size_t i = 0U;
+
+  while (i < context->entry_count)
+  {
+    if (context->entries[i].expires_at_ms <= now)
+    {
+      remove_entry(context, i);
+    }
+    else
+    {
+      ++i;
+    }
+  }
+}
+
+/**
+ * \brief Removes the UTxO and rewards entries, which a submitted transaction may have made stale.
+ *
+ * \param[in] context The caching provider context.
+ */
+static void
+remove_balance_entries(caching_provider_context_t* context)
+{
+  size_t i = 0U;
+
+  while (i < context->entry_count)
+  {
+    const char kind = context->entries[i].key[0];
+
+    if ((kind == 'u') || (kind == 'a') || (kind == 'n') || (kind == 'r'))
+    {
+      remove_entry(context, i);
+    }
+    else
+    {
+      ++i;
+    }
+  }
+}
+
+/**
+ * \brief Looks up an entry that has not expired.
+ *
+ * \param[in] context The caching provider context.
+ * \param[in] key The key of the entry.
+ *
+ * \return The entry, owned by the cache, or NULL on a miss. An expired entry is removed and reported as a miss.
+ */
+static cache_entry_t*
+find_entry(caching_provider_context_t* context, const char* key)
+{
+  const uint64_t key_hash = hash_key(key);
+
+  for (size_t i = 0U; i < context->entry_count; ++i)
+  {
+    cache_entry_t* entry = &context->entries[i];
+
+    if ((entry->key_hash != key_hash) || (strcmp(entry->key, key) != 0))
+    {
+      continue;
+    }
+
+    if ((entry->expires_at_ms != NEVER_EXPIRES) && (entry->expires_at_ms <= now_ms(context)))
+    {
+      remove_entry(context, i);
+
+      return NULL;
+    }
+
+    return entry;
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Stores an answer in the cache, replacing any entry with the same key.
+ *
+ * Failing to store an answer only costs a later cache miss, so errors are not reported.
+ *
+ * \param[in] context The caching provider context.
+ * \param[in] key The key of the entry.
+ * \param[in] ttl_ms How long the entry lives, in milliseconds; \ref NEVER_EXPIRES for a content-addressed answer.
+ *                   Nothing is stored if zero.
+ * \param[in] object The object to store, or NULL for a number. The cache takes a reference to it.
+ * \param[in] number The number to store.
+ */
+static void
+store_entry(
+  caching_provider_context_t* context,
+  const char*                 key,
+  const uint64_t              ttl_ms,
+  cardano_object_t*           object,
+  const uint64_t              number)
+{
+  if (ttl_ms == 0U)
+  {
+    return;
+  }
+
+  const uint64_t now = now_ms(context);
+
+  for (size_t i = 0U; i < context->entry_count; ++i)
+  {
+    if (strcmp(context->entries[i].key, key) == 0)
+    {
+      remove_entry(context, i);
+      break;
+    }
+  }
+
+  const size_t max_entries = context->options.max_entries;
+
+  if ((max_entries > 0U) && (context->entry_count >= max_entries))
+  {
+    remove_expired_entries(context, now);
+  }
+
+  if ((max_entries > 0U) && (context->entry_count >= max_entries))
+  {
+    size_t evicted = 0U;
+
+    for (size_t i = 1U; i < context->entry_count; ++i)
+    {
+      if (context->entries[i].expires_at_ms < context->entries[evicted].expires_at_ms)
+      {
+        evicted = i;
+      }
+    }
+
+    remove_entry(context, evicted);
+  }
+
+  if (context->entry_count == context->entry_capacity)
+  {
+    const size_t   capacity = (context->entry_capacity == 0U) ? 16U : (context->entry_capacity * 2U);
+    cache_entry_t* entries  = _cardano_realloc(context->entries, capacity * sizeof(cache_entry_t));
+
+    if (entries == NULL)
+    {
+      return;
+    }
+
+    context->entries        = entries;
+    context->entry_capacity = capacity;
+  }
+
+  const size_t key_size = cardano_safe_strlen(key, CACHE_KEY_SIZE) + 1U;
+  char*        key_copy = _cardano_malloc(key_size);
+
+  if (key_copy == NULL)
+  {
+    return;
+  }
+
+  cardano_safe_memcpy(key_copy, key_size, key, key_size);
+
+  cache_entry_t* entry = &context->entries[context->entry_count];
+
+  entry->key           = key_copy;
+  entry->key_hash      = hash_key(key);
+  entry->expires_at_ms = (ttl_ms == NEVER_EXPIRES) ? NEVER_EXPIRES : ((ttl_ms >= (NEVER_EXPIRES - now)) ? (NEVER_EXPIRES - 1U) : (now + ttl_ms));
+  entry->object        = object;
+  entry->number        = number;
+
+  if (object != NULL)
+  {
+    cardano_object_ref(object);
+  }
+
+  ++context->entry_count;
+}
+
+/**
+ * \brief Copies the last error of the wrapped provider into a caching provider implementation.
+ *
+ * \param[in] provider_impl The caching provider implementation.
+ * \param[in] result The result of the forwarded call.
+ *
+ * \return \p result.
+ */
+static cardano_error_t
+forward_error(cardano_provider_impl_t* provider_impl, const cardano_error_t result)
+{
+  if (result != CARDANO_SUCCESS)
+  {
+    caching_provider_context_t* context = (caching_provider_context_t*)((void*)provider_impl->context);
+    const char*                 message = cardano_provider_get_last_error(context->provider);
+    const size_t                size    = cardano_safe_strlen(message, sizeof(provider_impl->error_message) - 1U);
+
+    cardano_safe_memcpy(provider_impl->error_message, sizeof(provider_impl->error_message), message, size);
+    provider_impl->error_message[size] = '\0';
+  }
+
+  return result;
+}
+
+/**
+ * \brief Builds the cache key of an output from its input.
+ *
+ * \param[in] input The input.
+ * \param[out] key The buffer the key is written to, of \ref CACHE_KEY_SIZE bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the input has no valid ID.
+ */
+static cardano_error_t
+build_output_key(cardano_transaction_input_t* input, char* key)
+{
+  cardano_blake2b_hash_t* tx_id = cardano_transaction_input_get_id(input);
+  cardano_blake2b_hash_unref(&tx_id);
+
+  char            hash[129] = { 0 };
+  cardano_error_t result    = cardano_blake2b_hash_to_hex(tx_id, hash, sizeof(hash));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    CARDANO_UNUSED(snprintf(key, CACHE_KEY_SIZE, "o:%s#%llu", hash, (unsigned long long)cardano_transaction_input_get_index(input)));
+  }
+
+  return result;
+}
+
+/**
+ * \brief Serves a cached UTxO list as a list of its own, so the caller can modify it.
+ *
+ * \param[in] cached The frozen cached list.
+ * \param[out] utxo_list The copy handed to the caller.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+copy_utxo_list(cardano_utxo_list_t* cached, cardano_utxo_list_t** utxo_list)
+{
+  *utxo_list = cardano_utxo_list_clone(cached);
+
+  return (*utxo_list == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Freezes a freshly fetched UTxO list, caches it and hands a copy to the caller.
+ *
+ * \param[in] context The caching provider context.
+ * \param[in] key The cache key.
+ * \param[in] ttl_ms The time to live of the entry.
+ * \param[in] fetched The fetched list. This function consumes the reference to it.
+ * \param[out] utxo_list The list handed to the caller.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+cache_utxo_list(
+  caching_provider_context_t* context,
+  const char*                 key,
+  const uint64_t              ttl_ms,
+  cardano_utxo_list_t*        fetched,
+  cardano_utxo_list_t**       utxo_list)
+{
+  if (ttl_ms == 0U)
+  {
+    *utxo_list = fetched;
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_utxo_list_freeze(fetched);
+  store_entry(context, key, ttl_ms, (cardano_object_t*)((void*)fetched), 0U);
+
+  cardano_error_t result = copy_utxo_list(fetched, utxo_list);
+
+  cardano_utxo_list_unref(&fetched);
+
+  return result;
+}
+
+/**
+ * \brief Deallocates a caching provider context.
+ *
+ * \param object A void pointer to the context to be deallocated.
+ */
+static void
+caching_provider_context_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  caching_provider_context_t* context = (caching_provider_context_t*)object;
+
+  while (context->entry_count > 0U)
+  {
+    remove_entry(context, context->entry_count - 1U);
+  }
+
+  _cardano_free(context->entries);
+  cardano_provider_unref(&context->provider);
+
+  _cardano_free(object);
+}
+
+/**
+ * \brief Serves the protocol parameters from the cache, or fetches and caches them.
+ *
+ * \see cardano_get_parameters_func_t
+ */
+static cardano_error_t
+get_parameters(cardano_provider_impl_t* provider_impl, cardano_protocol_parameters_t** parameters)
+{
+  caching_provider_context_t* context = (caching_provider_context_t*)((void*)provider_impl->context);
+  cache_entry_t*              entry   = find_entry(context, "p");
+
+  if (entry != NULL)
+  {
+    cardano_object_ref(entry->object);
+    *parameters = (cardano_protocol_parameters_t*)((void*)entry->object);
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_error_t result = forward_error(provider_impl, cardano_provider_get_parameters(context->provider, parameters));
+
+  if ((result == CARDANO_SUCCESS) && (context->options.parameters_ttl_ms > 0U))
+  {
+    cardano_protocol_parameters_freeze(*parameters);
+    store_entry(context, "p", context->options.parameters_ttl_ms, (cardano_object_t*)((void*)*parameters), 0U);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Serves the UTxOs of an address from the cache, or fetches and caches them.
+ *
+ * \see cardano_get_unspent_outputs_func_t
+ */
+static cardano_error_t
+get_unspent_outputs(
+  cardano_provider_impl_t* provider_impl,
+  cardano_address_t*       address,
+  cardano_utxo_list_t**    utxo_list)
+{
+  caching_provider_context_t* context             = (caching_provider_context_t*)((void*)provider_impl->context);
+  char                        key[CACHE_KEY_SIZE] = { 0 };
+
+  CARDANO_UNUSED(snprintf(key, sizeof(key), "u:%s", cardano_address_get_string(address)));
+
+  cache_entry_t* entry = find_entry(context, key);
+
+  if (entry != NULL)
+  {
+    return copy_utxo_list((cardano_utxo_list_t*)((void*)entry->object), utxo_list);
+  }
+
+  cardano_utxo_list_t* fetched = NULL;
+  cardano_error_t      result  = forward_error(provider_impl, cardano_provider_get_unspent_outputs(context->provider, address, &fetched));
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return cache_utxo_list(context, key, context->options.unspent_outputs_ttl_ms, fetched, utxo_list);
+}
+
+/**
+ * \brief Computes how long a rewards balance fetched now is served from the cache.
+ *
+ * \param[in] context The caching provider context.
+ *
+ * \return The time to live of a rewards entry, in milliseconds.
+ */
+static uint64_t
+rewards_ttl_ms(const caching_provider_context_t* context)
+{
+  const uint64_t ttl_ms = context->options.rewards_ttl_ms;
+
+  if ((ttl_ms == 0U) || !context->options.rewards_until_epoch_end)
+  {
+    return ttl_ms;
+  }
+
+  // Epoch boundaries are wall-clock times, so they are measured with the system clock whatever clock expires entries
+  const cardano_network_magic_t magic     = cardano_provider_get_network_magic(context->provider);
+  const uint64_t                now       = system_clock(NULL);
+  const uint64_t                epoch     = cardano_compute_epoch_from_unix_time(magic, now / 1000U);
+  const uint64_t                epoch_end = (epoch != UINT64_MAX) ? cardano_compute_unix_time_from_epoch(magic, epoch + 1U) : UINT64_MAX;
+
+  if ((epoch_end == UINT64_MAX) || ((epoch_end * 1000U) <= now))
+  {
+    return ttl_ms;
+  }
+
+  return (epoch_end * 1000U) - now;
+}
+
+/**
+ * \brief Serves a rewards balance from the cache, or fetches and caches it.
+ *
+ * \see cardano_get_rewards_balance_func_t
+ */
+static cardano_error_t
+get_rewards_balance(cardano_provider_impl_t* provider_impl, cardano_reward_address_t* address, uint64_t* rewards)
+{
+  caching_provider_context_t* context             = (caching_provider_context_t*)((void*)provider_impl->context);
+  char                        key[CACHE_KEY_SIZE] = { 0 };
+
+  CARDANO_UNUSED(snprintf(key, sizeof(key), "r:%s", cardano_reward_address_get_string(address)));
+
+  cache_entry_t* entry = find_entry(context, key);
+
+  if (entry != NULL)
+  {
+    *rewards = entry->number;
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_error_t result = forward_error(provider_impl, cardano_provider_get_rewards_available(context->provider, address, rewards));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    store_entry(context, key, rewards_ttl_ms(context), NULL, *rewards);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Serves the cached rewards balances of several addresses, and fetches the others in one batch.
+ *
+ * \see cardano_get_rewards_balances_func_t
+ */
+static cardano_error_t
+get_rewards_balances(cardano_provider_impl_t* provider_impl, cardano_reward_address_list_t* addresses, uint64_t* rewards)
+{
+  caching_provider_context_t*    context             = (caching_provider_context_t*)((void*)provider_impl->context);
+  char                           key[CACHE_KEY_SIZE] = { 0 };
+  const size_t                   count               = cardano_reward_address_list_get_length(addresses);
+  cardano_reward_address_list_t* missing             = NULL;
+  size_t*                        missing_indices     = NULL;
+  uint64_t*                      fetched             = NULL;
+
+  cardano_error_t result = cardano_reward_address_list_new(&missing);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  missing_indices = _cardano_malloc(count * sizeof(size_t));
+
+  if (missing_indices == NULL)
+  {
+    cardano_reward_address_list_unref(&missing);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  for (size_t i = 0U; (i < count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_reward_address_t* address = NULL;
+
+    result = cardano_reward_address_list_get(addresses, i, &address);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      break;
+    }
+
+    CARDANO_UNUSED(snprintf(key, sizeof(key), "r:%s", cardano_reward_address_get_string(address)));
+
+    const cache_entry_t* entry = find_entry(context, key);
+
+    if (entry != NULL)
+    {
+      rewards[i] = entry->number;
+    }
+    else
+    {
+      missing_indices[cardano_reward_address_list_get_length(missing)] = i;
+      result                                                          = cardano_reward_address_list_add(missing, address);
+    }
+
+    cardano_reward_address_unref(&address);
+  }
+
+  const size_t missing_count = cardano_reward_address_list_get_length(missing);
+
+  if ((result == CARDANO_SUCCESS) && (missing_count > 0U))
+  {
+    fetched = _cardano_malloc(missing_count * sizeof(uint64_t));
+
+    if (fetched == NULL)
+    {
+      result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+    else
+    {
+      result = forward_error(provider_impl, cardano_provider_get_rewards_available_batch(context->provider, missing, fetched, missing_count));
+    }
+  }
+
+  if ((result == CARDANO_SUCCESS) && (missing_count > 0U))
+  {
+    const uint64_t ttl_ms = rewards_ttl_ms(context);
+
+    for (size_t i = 0U; i < missing_count; ++i)
+    {
+      cardano_reward_address_t* address = NULL;
+
+      rewards[missing_indices[i]] = fetched[i];
+
+      if (cardano_reward_address_list_get(missing, i, &address) == CARDANO_SUCCESS)
+      {
+        CARDANO_UNUSED(snprintf(key, sizeof(key), "r:%s", cardano_reward_address_get_string(address)));
+        store_entry(context, key, ttl_ms, NULL, fetched[i]);
+        cardano_reward_address_unref(&address);
+      }
+    }
+  }
+
+  _cardano_free(fetched);
+  _cardano_free(missing_indices);
+  cardano_reward_address_list_unref(&missing);
+
+  return result;
+}
+
+/**
+ * \brief Serves the UTxOs of an address holding an asset from the cache, or fetches and caches them.
+ *
+ * \see cardano_get_unspent_outputs_with_asset_func_t
+ */
+static cardano_error_t
+get_unspent_outputs_with_asset(
+  cardano_provider_impl_t* provider_impl,
+  cardano_address_t*       address,
+  cardano_asset_id_t*      asset_id,
+  cardano_utxo_list_t**    utxo_list)
+{
+  caching_provider_context_t* context             = (caching_provider_context_t*)((void*)provider_impl->context);
+  char                        key[CACHE_KEY_SIZE] = { 0 };
+
+  CARDANO_UNUSED(snprintf(key, sizeof(key), "a:%s:%s", cardano_address_get_string(address), cardano_asset_id_get_hex(asset_id)));
+
+  cache_entry_t* entry = find_entry(context, key);
+
+  if (entry != NULL)
+  {
+    return copy_utxo_list((cardano_utxo_list_t*)((void*)entry->object), utxo_list);
+  }
+
+  cardano_utxo_list_t* fetched = NULL;
+  cardano_error_t      result  = forward_error(provider_impl, cardano_provider_get_unspent_outputs_with_asset(context->provider, address, asset_id, &fetched));
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return cache_utxo_list(context, key, context->options.unspent_outputs_ttl_ms, fetched, utxo_list);
+}
+
+/**
+ * \brief Serves the UTxO holding an NFT from the cache, or fetches and caches it.
+ *
+ * \see cardano_get_unspent_output_by_nft_func_t
+ */
+static cardano_error_t
+get_unspent_output_by_nft(
+  cardano_provider_impl_t* provider_impl,
+  cardano_asset_id_t*      asset_id,
+  cardano_utxo_t**         utxo)
+{
+  caching_provider_context_t* context             = (caching_provider_context_t*)((void*)provider_impl->context);
+  char                        key[CACHE_KEY_SIZE] = { 0 };
+
+  CARDANO_UNUSED(snprintf(key, sizeof(key), "n:%s", cardano_asset_id_get_hex(asset_id)));
+
+  cache_entry_t* entry = find_entry(context, key);
+
+  if (entry != NULL)
+  {
+    cardano_object_ref(entry->object);
+    *utxo = (cardano_utxo_t*)((void*)entry->object);
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_error_t result = forward_error(provider_impl, cardano_provider_get_unspent_output_by_nft(context->provider, asset_id, utxo));
+
+  if ((result == CARDANO_SUCCESS) && (context->options.unspent_output_by_nft_ttl_ms > 0U))
+  {
+    cardano_utxo_freeze(*utxo);
+    store_entry(context, key, context->options.unspent_output_by_nft_ttl_ms, (cardano_object_t*)((void*)*utxo), 0U);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Resolves outputs from the cache, forwarding only the inputs that are not cached yet.
+ *
+ * An output never changes once created, so resolved outputs are kept until evicted.
+ *
+ * \see cardano_resolve_unspent_outputs_func_t
+ */
+static cardano_error_t
+resolve_unspent_outputs(
+  cardano_provider_impl_t*         provider_impl,
+  cardano_transaction_input_set_t* tx_ins,
+  cardano_utxo_list_t**            utxo_list)
+{
+  caching_provider_context_t*      context     = (caching_provider_context_t*)((void*)provider_impl->context);
+  cardano_transaction_input_set_t* misses      = NULL;
+  cardano_error_t                  result      = cardano_utxo_list_new(utxo_list);
+  const size_t                     input_count = cardano_transaction_input_set_get_length(tx_ins);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_utxo_list_reserve(*utxo_list, input_count);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_transaction_input_set_new(&misses);
+  }
+
+  for (size_t i = 0U; (i < input_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_transaction_input_t* input               = cardano_transaction_input_set_peek(tx_ins, i);
+    char                         key[CACHE_KEY_SIZE] = { 0 };
+
+    result = build_output_key(input, key);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      break;
+    }
+
+    cache_entry_t* entry = find_entry(context, key);
+
+    result = (entry != NULL) ? cardano_utxo_list_add(*utxo_list, (cardano_utxo_t*)((void*)entry->object)) : cardano_transaction_input_set_add(misses, input);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (cardano_transaction_input_set_get_length(misses) > 0U))
+  {
+    cardano_utxo_list_t* resolved = NULL;
+
+    result = forward_error(provider_impl, cardano_provider_resolve_unspent_outputs(context->provider, misses, &resolved));
+
+    const size_t resolved_count = cardano_utxo_list_get_length(resolved);
+
+    for (size_t i = 0U; (i < resolved_count) && (result == CARDANO_SUCCESS); ++i)
+    {
+      cardano_utxo_t* utxo = NULL;
+
+      result = cardano_utxo_list_get(resolved, i, &utxo);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        break;
+      }
+
+      cardano_transaction_input_t* input               = cardano_utxo_get_input(utxo);
+      char                         key[CACHE_KEY_SIZE] = { 0 };
+
+      if ((input != NULL) && (build_output_key(input, key) == CARDANO_SUCCESS))
+      {
+        cardano_utxo_freeze(utxo);
+        store_entry(context, key, NEVER_EXPIRES, (cardano_object_t*)((void*)utxo), 0U);
+      }
+
+      result = cardano_utxo_list_add(*utxo_list, utxo);
+
+      cardano_transaction_input_unref(&input);
+      cardano_utxo_unref(&utxo);
+    }
+
+    cardano_utxo_list_unref(&resolved);
+  }
+
+  cardano_transaction_input_set_unref(&misses);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(utxo_list);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Builds the cache key of a datum.
+ *
+ * \param[in] datum_hash The hash of the datum.
+ * \param[out] key The key, \ref CACHE_KEY_SIZE bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code if the hash could not be encoded.
+ */
+static cardano_error_t
+build_datum_key(const cardano_blake2b_hash_t* datum_hash, char* key)
+{
+  char            hash[129] = { 0 };
+  cardano_error_t result    = cardano_blake2b_hash_to_hex(datum_hash, hash, sizeof(hash));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    CARDANO_UNUSED(snprintf(key, CACHE_KEY_SIZE, "d:%s", hash));
+  }
+
+  return result;
+}
+
+/**
+ * \brief Resolves a datum from the cache, or fetches and caches it.
+ *
+ * A datum is identified by its hash, so it is kept until evicted.
+ *
+ * \see cardano_resolve_datum_func_t
+ */
+static cardano_error_t
+resolve_datum(
+  cardano_provider_impl_t* provider_impl,
+  cardano_blake2b_hash_t*  datum_hash,
+  cardano_plutus_data_t**  datum)
+{
+  caching_provider_context_t* context             = (caching_provider_context_t*)((void*)provider_impl->context);
+  char                        key[CACHE_KEY_SIZE] = { 0 };
+  cardano_error_t             result              = build_datum_key(datum_hash, key);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cache_entry_t* entry = find_entry(context, key);
+
+  if (entry != NULL)
+  {
+    cardano_object_ref(entry->object);
+    *datum = (cardano_plutus_data_t*)((void*)entry->object);
+
+    return CARDANO_SUCCESS;
+  }
+
+  result = forward_error(provider_impl, cardano_provider_resolve_datum(context->provider, datum_hash, datum));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    store_entry(context, key, NEVER_EXPIRES, (cardano_object_t*)((void*)*datum), 0U);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Resolves the cached datums of a set of hashes, and fetches the others in one batch.
+ *
+ * \see cardano_resolve_datums_func_t
+ */
+static cardano_error_t
+resolve_datums(
+  cardano_provider_impl_t*    provider_impl,
+  cardano_blake2b_hash_set_t* datum_hashes,
+  cardano_plutus_list_t**     datums)
+{
+  caching_provider_context_t* context             = (caching_provider_context_t*)((void*)provider_impl->context);
+  char                        key[CACHE_KEY_SIZE] = { 0 };
+  const size_t                count               = cardano_blake2b_hash_set_get_length(datum_hashes);
+  cardano_blake2b_hash_set_t* missing             = NULL;
+  cardano_plutus_list_t*      fetched             = NULL;
+  cardano_plutus_data_t**     slots               = NULL;
+
+  cardano_error_t result = cardano_blake2b_hash_set_new(&missing);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  slots = _cardano_malloc(((count > 0U) ? count : 1U) * sizeof(cardano_plutus_data_t*));
+
+  if (slots == NULL)
+  {
+    cardano_blake2b_hash_set_unref(&missing);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset((void*)slots, 0, ((count > 0U) ? count : 1U) * sizeof(cardano_plutus_data_t*)));
+
+  for (size_t i = 0U; (i < count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_blake2b_hash_t* datum_hash = NULL;
+
+    result = cardano_blake2b_hash_set_get(datum_hashes, i, &datum_hash);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = build_datum_key(datum_hash, key);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      cache_entry_t* entry = find_entry(context, key);
+
+      if (entry != NULL)
+      {
+        cardano_object_ref(entry->object);
+        slots[i] = (cardano_plutus_data_t*)((void*)entry->object);
+      }
+      else
+      {
+        result = cardano_blake2b_hash_set_add(missing, datum_hash);
+      }
+    }
+
+    cardano_blake2b_hash_unref(&datum_hash);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (cardano_blake2b_hash_set_get_length(missing) > 0U))
+  {
+    result = forward_error(provider_impl, cardano_provider_resolve_datums(context->provider, missing, &fetched));
+  }
+
+  // The fetched datums come in the order of the misses, which is the order of the empty slots
+  size_t next_fetched = 0U;
+
+  for (size_t i = 0U; (i < count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    if (slots[i] != NULL)
+    {
+      continue;
+    }
+
+    result = cardano_plutus_list_get(fetched, next_fetched, &slots[i]);
+    ++next_fetched;
+
+    cardano_blake2b_hash_t* datum_hash = NULL;
+
+    if ((result == CARDANO_SUCCESS) && (cardano_blake2b_hash_set_get(datum_hashes, i, &datum_hash) == CARDANO_SUCCESS) && (build_datum_key(datum_hash, key) == CARDANO_SUCCESS))
+    {
+      store_entry(context, key, NEVER_EXPIRES, (cardano_object_t*)((void*)slots[i]), 0U);
+    }
+
+    cardano_blake2b_hash_unref(&datum_hash);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_plutus_list_new(datums);
+  }
+
+  for (size_t i = 0U; (i < count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    result = cardano_plutus_list_add(*datums, slots[i]);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_plutus_list_unref(datums);
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    cardano_plutus_data_unref(&slots[i]);
+  }
+
+  _cardano_free((void*)slots);
+  cardano_plutus_list_unref(&fetched);
+  cardano_blake2b_hash_set_unref(&missing);
+
+  return result;
+}
+
+/**
+ * \brief Forwards a confirmation wait.
+ *
+ * \see cardano_confirm_transaction_func_t
+ */
+static cardano_error_t
+await_transaction_confirmation(
+  cardano_provider_impl_t* provider_impl,
+  cardano_blake2b_hash_t*  tx_id,
+  const uint64_t           timeout_ms,
+  bool*                    confirmed)
+{
+  caching_provider_context_t* context = (caching_provider_context_t*)((void*)provider_impl->context);
+
+  return forward_error(provider_impl, cardano_provider_confirm_transaction(context->provider, tx_id, timeout_ms, confirmed));
+}
+
+/**
+ * \brief Forwards a submission, then drops the cached answers it may have invalidated.
+ *
+ * \see cardano_submit_transaction_func_t
+ */
+static cardano_error_t
+post_transaction_to_chain(
+  cardano_provider_impl_t* provider_impl,
+  cardano_transaction_t*   tx,
+  cardano_blake2b_hash_t** tx_id)
+{
+  caching_provider_context_t* context = (caching_provider_context_t*)((void*)provider_impl->context);
+  cardano_error_t             result  = forward_error(provider_impl, cardano_provider_submit_transaction(context->provider, tx, tx_id));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    // The cached UTxO sets still list the inputs the transaction spends.
+    remove_balance_entries(context);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Forwards an evaluation.
+ *
+ * \see cardano_evaluate_transaction_func_t
+ */
+static cardano_error_t
+evaluate_transaction(
+  cardano_provider_impl_t*  provider_impl,
+  cardano_transaction_t*    tx,
+  cardano_utxo_list_t*      additional_utxos,
+  cardano_redeemer_list_t** redeemers)
+{
+  caching_provider_context_t* context = (caching_provider_context_t*)((void*)provider_impl->context);
+
+  return forward_error(provider_impl, cardano_provider_evaluate_transaction(context->provider, tx, additional_utxos, redeemers));
+}
+
+/* DEFINITIONS ****************************************************************/
+
+void
+cardano_caching_provider_options_init(cardano_caching_provider_options_t* options)
+{
+  if (options == NULL)
+  {
+    return;
+  }
+
+  CARDANO_UNUSED(memset(options, 0, sizeof(cardano_caching_provider_options_t)));
+
+  options->parameters_ttl_ms            = 60000U;
+  options->unspent_outputs_ttl_ms       = 2000U;
+  options->unspent_output_by_nft_ttl_ms = 2000U;
+  options->rewards_ttl_ms               = 20000U;
+  options->rewards_until_epoch_end      = false;
+  options->max_entries                  = 4096U;
+  options->clock                        = NULL;
+  options->clock_data                   = NULL;
+}
+
+cardano_error_t
+cardano_caching_provider_new(
+  cardano_provider_t*                       provider,
+  const cardano_caching_provider_options_t* options,
+  cardano_provider_t**                      caching_provider)
+{
+  if ((provider == NULL) || (caching_provider == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  caching_provider_context_t* context = _cardano_malloc(sizeof(caching_provider_context_t));
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(context, 0, sizeof(caching_provider_context_t)));
+
+  context->base.deallocator   = caching_provider_context_deallocate;
+  context->base.ref_count     = 1;
+  context->base.last_error    = NULL;
+
+  if (options != NULL)
+  {
+    context->options = *options;
+  }
+  else
+  {
+    cardano_caching_provider_options_init(&context->options);
+  }
+
+  if (context->options.clock == NULL)
+  {
+    context->options.clock      = system_clock;
+    context->options.clock_data = NULL;
+  }
+
+  cardano_provider_ref(provider);
+  context->provider = provider;
+
+  cardano_provider_impl_t impl = { 0 };
+
+  CARDANO_UNUSED(snprintf(impl.name, sizeof(impl.name), "cached-%s", cardano_provider_get_name(provider)));
+
+  impl.network_magic                  = cardano_provider_get_network_magic(provider);
+  impl.get_parameters                 = get_parameters;
+  impl.get_unspent_outputs            = get_unspent_outputs;
+  impl.get_rewards_balance            = get_rewards_balance;
+  impl.get_rewards_balances           = get_rewards_balances;
+  impl.get_unspent_outputs_with_asset = get_unspent_outputs_with_asset;
+  impl.get_unspent_output_by_nft      = get_unspent_output_by_nft;
+  impl.resolve_unspent_outputs        = resolve_unspent_outputs;
+  impl.resolve_datum                  = resolve_datum;
+  impl.resolve_datums                 = resolve_datums;
+  impl.await_transaction_confirmation = await_transaction_confirmation;
+  impl.post_transaction_to_chain      = post_transaction_to_chain;
+  impl.evaluate_transaction           = evaluate_transaction;
+  impl.context                        = (cardano_object_t*)((void*)context);
+
+  cardano_error_t result = cardano_provider_new(impl, caching_provider);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_object_t* object = (cardano_object_t*)((void*)context);
+    cardano_object_unref(&object);
+  }
+
+  return result;
+}
@@ -0,0 +1,107 @@
+/**
+ * \file provider_request_internals.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_PROVIDER_REQUEST_INTERNALS_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_PROVIDER_REQUEST_INTERNALS_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/error.h>
+#include <cardano/providers/provider_request.h>
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Creates a pending protocol parameters request.
+ *
+ * \param[in] callback The completion callback.
+ * \param[in] user_data A pointer passed to \p callback.
+ * \param[out] request On success, the new request.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+cardano_error_t
+_cardano_provider_request_new_parameters(
+  cardano_parameters_callback_t callback,
+  void*                         user_data,
+  cardano_provider_request_t**  request);
+
+/**
+ * \brief Creates a pending unspent outputs request.
+ *
+ * \param[in] callback The completion callback.
+ * \param[in] user_data A pointer passed to \p callback.
+ * \param[out] request On success, the new request.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+cardano_error_t
+_cardano_provider_request_new_utxo_list(
+  cardano_utxo_list_callback_t callback,
+  void*                        user_data,
+  cardano_provider_request_t** request);
+
+/**
+ * \brief Creates a pending transaction submission request.
+ *
+ * \param[in] callback The completion callback.
+ * \param[in] user_data A pointer passed to \p callback.
+ * \param[out] request On success, the new request.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+cardano_error_t
+_cardano_provider_request_new_tx_id(
+  cardano_tx_id_callback_t     callback,
+  void*                        user_data,
+  cardano_provider_request_t** request);
+
+/**
+ * \brief Creates a pending transaction evaluation request.
+ *
+ * \param[in] callback The completion callback.
+ * \param[in] user_data A pointer passed to \p callback.
+ * \param[out] request On success, the new request.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+cardano_error_t
+_cardano_provider_request_new_redeemers(
+  cardano_redeemer_list_callback_t callback,
+  void*                            user_data,
+  cardano_provider_request_t**     request);
+
+/**
+ * \brief Creates a pending transaction confirmation request.
+ *
+ * \param[in] callback The completion callback.
+ * \param[in] user_data A pointer passed to \p callback.
+ * \param[out] request On success, the new request.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+cardano_error_t
+_cardano_provider_request_new_confirmation(
+  cardano_confirmation_callback_t callback,
+  void*                           user_data,
+  cardano_provider_request_t**    request);
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_PROVIDER_REQUEST_INTERNALS_H
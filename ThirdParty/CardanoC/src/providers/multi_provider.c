@@ -0,0 +1,1540 @@
+/**
+ * \file multi_provider.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/object.h>
+#include <cardano/providers/async_provider_impl.h>
+#include <cardano/providers/multi_provider.h>
+
+#include "../allocators.h"
+#include "../string_safe.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief The number of recent latencies the percentiles of an endpoint are computed over.
+ */
+#define LATENCY_WINDOW 32U
+
+/**
+ * \brief The weight of the latest outcome in the decaying error rate of an endpoint.
+ */
+static const double ERROR_RATE_WEIGHT = 0.2;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief What a multi-endpoint provider knows about one of its endpoints.
+ */
+typedef struct endpoint_stats_t
+{
+    uint32_t latencies_ms[LATENCY_WINDOW];
+    size_t   latency_count;
+    size_t   next_latency;
+    uint64_t p50_ms;
+    uint64_t p99_ms;
+    double   error_rate;
+    size_t   consecutive_failures;
+    uint64_t set_aside_until_ms;
+} endpoint_stats_t;
+
+/**
+ * \brief Routing state shared by the blocking and asynchronous multi-endpoint providers.
+ */
+typedef struct router_t
+{
+    cardano_multi_provider_options_t options;
+    endpoint_stats_t                 endpoints[CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS];
+    size_t                           endpoint_count;
+} router_t;
+
+/**
+ * \brief Context of a blocking multi-endpoint provider.
+ */
+typedef struct multi_provider_context_t
+{
+    cardano_object_t    base;
+    cardano_provider_t* providers[CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS];
+    router_t            router;
+} multi_provider_context_t;
+
+/**
+ * \brief The endpoints a blocking call is tried on, best first, and the outcome of the current try.
+ */
+typedef struct route_t
+{
+    multi_provider_context_t* context;
+    size_t                    order[CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS];
+    size_t                    count;
+    size_t                    position;
+    size_t                    current;
+    uint64_t                  started_ms;
+    cardano_error_t           result;
+} route_t;
+
+/**
+ * \brief Context of an asynchronous multi-endpoint provider.
+ */
+typedef struct multi_async_context_t
+{
+    cardano_object_t          base;
+    cardano_async_provider_t* providers[CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS];
+    router_t                  router;
+} multi_async_context_t;
+
+typedef struct race_t race_t;
+
+/**
+ * \brief A query started on one endpoint on behalf of a race.
+ */
+typedef struct attempt_t
+{
+    race_t*                     race;
+    size_t                      endpoint;
+    uint64_t                    started_ms;
+    cardano_provider_request_t* request;
+    bool                        running;
+} attempt_t;
+
+/**
+ * \brief An asynchronous request and the attempts started on its behalf.
+ *
+ * The race is released once it holds no references: one for each running attempt, and one for whoever is
+ * starting or cancelling attempts.
+ */
+struct race_t
+{
+    size_t                      references;
+    multi_async_context_t*      context;
+    cardano_provider_request_t* request;
+    cardano_address_t*          address;
+    cardano_transaction_t*      tx;
+    cardano_utxo_list_t*        additional_utxos;
+    cardano_blake2b_hash_t*     tx_id;
+    uint64_t                    timeout_ms;
+    size_t                      order[CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS];
+    size_t                      count;
+    size_t                      position;
+    attempt_t                   attempts[CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS];
+    size_t                      started;
+    size_t                      running;
+    bool                        settled;
+    cardano_error_t             result;
+    char                        error_message[1024];
+};
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Reads the system clock.
+ *
+ * \param[in] clock_data Unused.
+ *
+ * \return The current time in milliseconds.
+ */
+static uint64_t
+system_clock(void* clock_data)
+{
+  CARDANO_UNUSED(clock_data);
+
+  struct timespec now = { 0 };
+
+  if (timespec_get(&now, TIME_UTC) == 0)
+  {
+    return 0U;
+  }
+
+  return ((uint64_t)now.tv_sec * 1000U) + ((uint64_t)now.tv_nsec / 1000000U);
+}
+
+/**
+ * \brief Gets the current time of the clock of a router.
+ *
+ * \param[in] router The router.
+ *
+ * \return The current time in milliseconds.
+ */
+static uint64_t
+now_ms(const router_t* router)
+{
+  return router->options.clock(router->options.clock_data);
+}
+
+/**
+ * \brief Sets up the routing state of a new provider.
+ *
+ * \param[out] router The router.
+ * \param[in] options The options, or NULL for the defaults.
+ * \param[in] endpoint_count The number of endpoints.
+ */
+static void
+init_router(router_t* router, const cardano_multi_provider_options_t* options, const size_t endpoint_count)
+{
+  CARDANO_UNUSED(memset(router, 0, sizeof(router_t)));
+
+  if (options != NULL)
+  {
+    router->options = *options;
+  }
+  else
+  {
+    cardano_multi_provider_options_init(&router->options);
+  }
+
+  if (router->options.clock == NULL)
+  {
+    router->options.clock      = system_clock;
+    router->options.clock_data = NULL;
+  }
+
+  router->endpoint_count = endpoint_count;
+}
+
+/**
+ * \brief Recomputes the latency percentiles of an endpoint from its window.
+ *
+ * \param[in] stats The endpoint.
+ */
+static void
+update_percentiles(endpoint_stats_t* stats)
+{
+  uint32_t sorted[LATENCY_WINDOW] = { 0 };
+
+  for (size_t i = 0U; i < stats->latency_count; ++i)
+  {
+    size_t j = i;
+
+    while ((j > 0U) && (sorted[j - 1U] > stats->latencies_ms[i]))
+    {
+      sorted[j] = sorted[j - 1U];
+      --j;
+    }
+
+    sorted[j] = stats->latencies_ms[i];
+  }
+
+  const size_t last = stats->latency_count - 1U;
+  const size_t p99  = (stats->latency_count * 99U) / 100U;
+
+  stats->p50_ms = sorted[last / 2U];
+  stats->p99_ms = sorted[(p99 < last) ? p99 : last];
+}
+
+/**
+ * \brief Records the outcome of a call on an endpoint.
+ *
+ * Only answers feed the latencies; a fast failure says nothing about how fast the endpoint answers.
+ *
+ * \param[in] router The router.
+ * \param[in] endpoint The index of the endpoint.
+ * \param[in] started_ms When the call started.
+ * \param[in] result The result of the call. \ref CARDANO_ERROR_NOT_IMPLEMENTED is not held against the endpoint.
+ */
+static void
+record_outcome(router_t* router, const size_t endpoint, const uint64_t started_ms, const cardano_error_t result)
+{
+  endpoint_stats_t* stats = &router->endpoints[endpoint];
+  const uint64_t    now   = now_ms(router);
+
+  if (result == CARDANO_ERROR_NOT_IMPLEMENTED)
+  {
+    return;
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    stats->error_rate += (1.0 - stats->error_rate) * ERROR_RATE_WEIGHT;
+    ++stats->consecutive_failures;
+
+    if ((router->options.max_consecutive_failures > 0U) && (stats->consecutive_failures >= router->options.max_consecutive_failures))
+    {
+      stats->set_aside_until_ms = now + router->options.failure_cooldown_ms;
+    }
+
+    return;
+  }
+
+  const uint64_t latency = (now > started_ms) ? (now - started_ms) : 0U;
+
+  stats->latencies_ms[stats->next_latency] = (latency < UINT32_MAX) ? (uint32_t)latency : UINT32_MAX;
+  stats->next_latency                      = (stats->next_latency + 1U) % LATENCY_WINDOW;
+
+  if (stats->latency_count < LATENCY_WINDOW)
+  {
+    ++stats->latency_count;
+  }
+
+  stats->error_rate           -= stats->error_rate * ERROR_RATE_WEIGHT;
+  stats->consecutive_failures  = 0U;
+  stats->set_aside_until_ms    = 0U;
+
+  update_percentiles(stats);
+}
+
+/**
+ * \brief Scores an endpoint; the lower the score, the sooner the endpoint is tried.
+ *
+ * The median is what a call usually costs and the 99th percentile how badly it can stall; the score weighs in a
+ * quarter of that spread and scales it up with the error rate. Endpoints without answers score zero, so they get
+ * measured.
+ *
+ * \param[in] stats The endpoint.
+ *
+ * \return The score.
+ */
+static double
+endpoint_score(const endpoint_stats_t* stats)
+{
+  if (stats->latency_count == 0U)
+  {
+    return 0.0;
+  }
+
+  const double latency = (double)stats->p50_ms + ((double)(stats->p99_ms - stats->p50_ms) / 4.0);
+
+  return (latency + 1.0) * (1.0 + (4.0 * stats->error_rate));
+}
+
+/**
+ * \brief Orders the endpoints of a router from the best to the worst.
+ *
+ * Endpoints that were set aside come last, so they are only tried once every other endpoint failed.
+ *
+ * \param[in] router The router.
+ * \param[out] order Receives the indices of the endpoints.
+ *
+ * \return The number of endpoints.
+ */
+static size_t
+rank_endpoints(const router_t* router, size_t* order)
+{
+  const uint64_t now = now_ms(router);
+  double         keys[CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS];
+
+  for (size_t i = 0U; i < router->endpoint_count; ++i)
+  {
+    const endpoint_stats_t* stats     = &router->endpoints[i];
+    const bool              set_aside = now < stats->set_aside_until_ms;
+    const double            key       = endpoint_score(stats) + (set_aside ? 1e18 : 0.0);
+    size_t                  j         = i;
+
+    while ((j > 0U) && (keys[j - 1U] > key))
+    {
+      keys[j]  = keys[j - 1U];
+      order[j] = order[j - 1U];
+      --j;
+    }
+
+    keys[j]  = key;
+    order[j] = i;
+  }
+
+  return router->endpoint_count;
+}
+
+/**
+ * \brief Copies an error message into a buffer.
+ *
+ * \param[out] buffer The buffer.
+ * \param[in] size The size of the buffer.
+ * \param[in] message The message.
+ */
+static void
+copy_message(char* buffer, const size_t size, const char* message)
+{
+  const size_t length = cardano_safe_strlen(message, size - 1U);
+
+  cardano_safe_memcpy(buffer, size, message, length);
+  buffer[length] = '\0';
+}
+
+/**
+ * \brief Deallocates a blocking multi-endpoint provider context.
+ *
+ * \param object A void pointer to the context to be deallocated.
+ */
+static void
+multi_provider_context_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  multi_provider_context_t* context = (multi_provider_context_t*)object;
+
+  for (size_t i = 0U; i < context->router.endpoint_count; ++i)
+  {
+    cardano_provider_unref(&context->providers[i]);
+  }
+
+  _cardano_free(object);
+}
+
+/**
+ * \brief Ranks the endpoints a blocking call is tried on.
+ *
+ * \param[in] provider_impl The multi-endpoint provider implementation.
+ * \param[out] route The route.
+ */
+static void
+start_route(cardano_provider_impl_t* provider_impl, route_t* route)
+{
+  CARDANO_UNUSED(memset(route, 0, sizeof(route_t)));
+
+  route->context = (multi_provider_context_t*)((void*)provider_impl->context);
+  route->count   = rank_endpoints(&route->context->router, route->order);
+  route->result  = CARDANO_ERROR_NOT_IMPLEMENTED;
+}
+
+/**
+ * \brief Records the outcome of the current try, and moves on to the next endpoint if it failed.
+ *
+ * \param[in] route The route.
+ *
+ * \return true if the call must be tried on \ref route_t::current, false once it succeeded or no endpoint is left.
+ */
+static bool
+next_endpoint(route_t* route)
+{
+  router_t* router = &route->context->router;
+
+  if (route->position > 0U)
+  {
+    record_outcome(router, route->current, route->started_ms, route->result);
+
+    if (route->result == CARDANO_SUCCESS)
+    {
+      return false;
+    }
+  }
+
+  if (route->position == route->count)
+  {
+    return false;
+  }
+
+  route->current    = route->order[route->position];
+  route->started_ms = now_ms(router);
+  ++route->position;
+
+  return true;
+}
+
+/**
+ * \brief Reports the outcome of a blocking call, with the error message of the last endpoint tried.
+ *
+ * \param[in] provider_impl The multi-endpoint provider implementation.
+ * \param[in] route The route.
+ *
+ * \return The result of the last try.
+ */
+static cardano_error_t
+finish_route(cardano_provider_impl_t* provider_impl, const route_t* route)
+{
+  if ((route->result != CARDANO_SUCCESS) && (route->position > 0U))
+  {
+    const char* message = cardano_provider_get_last_error(route->context->providers[route->current]);
+
+    copy_message(provider_impl->error_message, sizeof(provider_impl->error_message), message);
+  }
+
+  return route->result;
+}
+
+/**
+ * \brief Fetches the protocol parameters from the best endpoint that answers.
+ *
+ * \see cardano_get_parameters_func_t
+ */
+static cardano_error_t
+get_parameters(cardano_provider_impl_t* provider_impl, cardano_protocol_parameters_t** parameters)
+{
+  route_t route;
+
+  start_route(provider_impl, &route);
+
+  while (next_endpoint(&route))
+  {
+    route.result = cardano_provider_get_parameters(route.context->providers[route.current], parameters);
+  }
+
+  return finish_route(provider_impl, &route);
+}
+
+/**
+ * \brief Fetches the UTxOs of an address from the best endpoint that answers.
+ *
+ * \see cardano_get_unspent_outputs_func_t
+ */
+static cardano_error_t
+get_unspent_outputs(
+  cardano_provider_impl_t* provider_impl,
+  cardano_address_t*       address,
+  cardano_utxo_list_t**    utxo_list)
+{
+  route_t route;
+
+  start_route(provider_impl, &route);
+
+  while (next_endpoint(&route))
+  {
+    route.result = cardano_provider_get_unspent_outputs(route.context->providers[route.current], address, utxo_list);
+  }
+
+  return finish_route(provider_impl, &route);
+}
+
+/**
+ * \brief Fetches a rewards balance from the best endpoint that answers.
+ *
+ * \see cardano_get_rewards_balance_func_t
+ */
+static cardano_error_t
+get_rewards_balance(cardano_provider_impl_t* provider_impl, cardano_reward_address_t* address, uint64_t* rewards)
+{
+  route_t route;
+
+  start_route(provider_impl, &route);
+
+  while (next_endpoint(&route))
+  {
+    route.result = cardano_provider_get_rewards_available(route.context->providers[route.current], address, rewards);
+  }
+
+  return finish_route(provider_impl, &route);
+}
+
+/**
+ * \brief Fetches the rewards balances of several addresses from the best endpoint that answers.
+ *
+ * \see cardano_get_rewards_balances_func_t
+ */
+static cardano_error_t
+get_rewards_balances(cardano_provider_impl_t* provider_impl, cardano_reward_address_list_t* addresses, uint64_t* rewards)
+{
+  const size_t count = cardano_reward_address_list_get_length(addresses);
+  route_t      route;
+
+  start_route(provider_impl, &route);
+
+  while (next_endpoint(&route))
+  {
+    route.result = cardano_provider_get_rewards_available_batch(route.context->providers[route.current], addresses, rewards, count);
+  }
+
+  return finish_route(provider_impl, &route);
+}
+
+/**
+ * \brief Fetches the UTxOs of an address holding an asset from the best endpoint that answers.
+ *
+ * \see cardano_get_unspent_outputs_with_asset_func_t
+ */
+static cardano_error_t
+get_unspent_outputs_with_asset(
+  cardano_provider_impl_t* provider_impl,
+  cardano_address_t*       address,
+  cardano_asset_id_t*      asset_id,
+  cardano_utxo_list_t**    utxo_list)
+{
+  route_t route;
+
+  start_route(provider_impl, &route);
+
+  while (next_endpoint(&route))
+  {
+    route.result = cardano_provider_get_unspent_outputs_with_asset(route.context->providers[route.current], address, asset_id, utxo_list);
+  }
+
+  return finish_route(provider_impl, &route);
+}
+
+/**
+ * \brief Fetches the UTxO holding an NFT from the best endpoint that answers.
+ *
+ * \see cardano_get_unspent_output_by_nft_func_t
+ */
+static cardano_error_t
+get_unspent_output_by_nft(
+  cardano_provider_impl_t* provider_impl,
+  cardano_asset_id_t*      asset_id,
+  cardano_utxo_t**         utxo)
+{
+  route_t route;
+
+  start_route(provider_impl, &route);
+
+  while (next_endpoint(&route))
+  {
+    route.result = cardano_provider_get_unspent_output_by_nft(route.context->providers[route.current], asset_id, utxo);
+  }
+
+  return finish_route(provider_impl, &route);
+}
+
+/**
+ * \brief Resolves outputs on the best endpoint that answers.
+ *
+ * \see cardano_resolve_unspent_outputs_func_t
+ */
+static cardano_error_t
+resolve_unspent_outputs(
+  cardano_provider_impl_t*         provider_impl,
+  cardano_transaction_input_set_t* tx_ins,
+  cardano_utxo_list_t**            utxo_list)
+{
+  route_t route;
+
+  start_route(provider_impl, &route);
+
+  while (next_endpoint(&route))
+  {
+    route.result = cardano_provider_resolve_unspent_outputs(route.context->providers[route.current], tx_ins, utxo_list);
+  }
+
+  return finish_route(provider_impl, &route);
+}
+
+/**
+ * \brief Resolves a datum on the best endpoint that answers.
+ *
+ * \see cardano_resolve_datum_func_t
+ */
+static cardano_error_t
+resolve_datum(
+  cardano_provider_impl_t* provider_impl,
+  cardano_blake2b_hash_t*  datum_hash,
+  cardano_plutus_data_t**  datum)
+{
+  route_t route;
+
+  start_route(provider_impl, &route);
+
+  while (next_endpoint(&route))
+  {
+    route.result = cardano_provider_resolve_datum(route.context->providers[route.current], datum_hash, datum);
+  }
+
+  return finish_route(provider_impl, &route);
+}
+
+/**
+ * \brief Resolves several datums on the best endpoint that answers.
+ *
+ * \see cardano_resolve_datums_func_t
+ */
+static cardano_error_t
+resolve_datums(
+  cardano_provider_impl_t*    provider_impl,
+  cardano_blake2b_hash_set_t* datum_hashes,
+  cardano_plutus_list_t**     datums)
+{
+  route_t route;
+
+  start_route(provider_impl, &route);
+
+  while (next_endpoint(&route))
+  {
+    route.result = cardano_provider_resolve_datums(route.context->providers[route.current], datum_hashes, datums);
+  }
+
+  return finish_route(provider_impl, &route);
+}
+
+/**
+ * \brief Waits for a confirmation on the best endpoint that answers.
+ *
+ * \see cardano_confirm_transaction_func_t
+ */
+static cardano_error_t
+await_transaction_confirmation(
+  cardano_provider_impl_t* provider_impl,
+  cardano_blake2b_hash_t*  tx_id,
+  const uint64_t           timeout_ms,
+  bool*                    confirmed)
+{
+  route_t route;
+
+  start_route(provider_impl, &route);
+
+  while (next_endpoint(&route))
+  {
+    route.result = cardano_provider_confirm_transaction(route.context->providers[route.current], tx_id, timeout_ms, confirmed);
+  }
+
+  return finish_route(provider_impl, &route);
+}
+
+/**
+ * \brief Submits a transaction to every endpoint, best first.
+ *
+ * \see cardano_submit_transaction_func_t
+ */
+static cardano_error_t
+post_transaction_to_chain(
+  cardano_provider_impl_t* provider_impl,
+  cardano_transaction_t*   tx,
+  cardano_blake2b_hash_t** tx_id)
+{
+  route_t route;
+  bool    accepted = false;
+
+  start_route(provider_impl, &route);
+
+  for (size_t i = 0U; i < route.count; ++i)
+  {
+    const size_t            endpoint   = route.order[i];
+    const uint64_t          started_ms = now_ms(&route.context->router);
+    cardano_blake2b_hash_t* id         = NULL;
+    const cardano_error_t   result     = cardano_provider_submit_transaction(route.context->providers[endpoint], tx, &id);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      record_outcome(&route.context->router, endpoint, started_ms, result);
+
+      if (!accepted)
+      {
+        *tx_id   = id;
+        accepted = true;
+      }
+      else
+      {
+        cardano_blake2b_hash_unref(&id);
+      }
+    }
+    else if (!accepted)
+    {
+      route.current  = endpoint;
+      route.position = i + 1U;
+      route.result   = result;
+    }
+  }
+
+  if (accepted)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  return finish_route(provider_impl, &route);
+}
+
+/**
+ * \brief Evaluates a transaction on the best endpoint that answers.
+ *
+ * \see cardano_evaluate_transaction_func_t
+ */
+static cardano_error_t
+evaluate_transaction(
+  cardano_provider_impl_t*  provider_impl,
+  cardano_transaction_t*    tx,
+  cardano_utxo_list_t*      additional_utxos,
+  cardano_redeemer_list_t** redeemers)
+{
+  route_t route;
+
+  start_route(provider_impl, &route);
+
+  while (next_endpoint(&route))
+  {
+    route.result = cardano_provider_evaluate_transaction(route.context->providers[route.current], tx, additional_utxos, redeemers);
+  }
+
+  return finish_route(provider_impl, &route);
+}
+
+/**
+ * \brief Deallocates an asynchronous multi-endpoint provider context.
+ *
+ * \param object A void pointer to the context to be deallocated.
+ */
+static void
+multi_async_context_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  multi_async_context_t* context = (multi_async_context_t*)object;
+
+  for (size_t i = 0U; i < context->router.endpoint_count; ++i)
+  {
+    cardano_async_provider_unref(&context->providers[i]);
+  }
+
+  _cardano_free(object);
+}
+
+/**
+ * \brief Drops a reference to a race, releasing it with the last one.
+ *
+ * \param[in] race The race.
+ */
+static void
+release_race(race_t* race)
+{
+  --race->references;
+
+  if (race->references > 0U)
+  {
+    return;
+  }
+
+  cardano_object_t* context = (cardano_object_t*)((void*)race->context);
+
+  cardano_provider_request_unref(&race->request);
+  cardano_address_unref(&race->address);
+  cardano_transaction_unref(&race->tx);
+  cardano_utxo_list_unref(&race->additional_utxos);
+  cardano_blake2b_hash_unref(&race->tx_id);
+  cardano_object_unref(&context);
+
+  _cardano_free(race);
+}
+
+/**
+ * \brief Tells whether a race is a submission, whose attempts all run to the end.
+ *
+ * \param[in] race The race.
+ *
+ * \return true for a submission.
+ */
+static bool
+is_submission(const race_t* race)
+{
+  return cardano_provider_request_get_type(race->request) == CARDANO_PROVIDER_REQUEST_TYPE_SUBMIT_TRANSACTION;
+}
+
+/**
+ * \brief Cancels the attempts of a race that are still running.
+ *
+ * The caller must hold a reference to the race.
+ *
+ * \param[in] race The race.
+ */
+static void
+cancel_attempts(race_t* race)
+{
+  for (size_t i = 0U; i < race->position; ++i)
+  {
+    attempt_t* attempt = &race->attempts[i];
+
+    if (!attempt->running)
+    {
+      continue;
+    }
+
+    attempt->running = false;
+    --race->running;
+
+    CARDANO_UNUSED(cardano_provider_request_cancel(attempt->request));
+    cardano_provider_request_unref(&attempt->request);
+
+    release_race(race);
+  }
+}
+
+/**
+ * \brief Cancel handler of the request of a race; cancels every attempt.
+ *
+ * \param[in] request The cancelled request.
+ * \param[in] cancel_data The race.
+ */
+static void
+cancel_race(cardano_provider_request_t* request, void* cancel_data)
+{
+  CARDANO_UNUSED(request);
+
+  race_t* race = (race_t*)cancel_data;
+
+  ++race->references;
+
+  race->settled = true;
+  cancel_attempts(race);
+
+  release_race(race);
+}
+
+/**
+ * \brief Fails the request of a race with the error of its last failed attempt.
+ *
+ * \param[in] race The race.
+ */
+static void
+fail_race(race_t* race)
+{
+  race->settled = true;
+
+  CARDANO_UNUSED(cardano_provider_request_fail(race->request, race->result, race->error_message));
+}
+
+static bool launch_next(race_t* race);
+
+/**
+ * \brief Books the end of an attempt, and decides what becomes of its race.
+ *
+ * A successful attempt wins the race if nothing settled it yet. A failed one is replaced by the next endpoint; once
+ * no endpoint is left and nothing runs, the race fails.
+ *
+ * \param[in] attempt The attempt.
+ * \param[in] request The request of the attempt.
+ * \param[in] result The result of the attempt.
+ *
+ * \return true if the caller must complete the request of the race with the answer of the attempt.
+ */
+static bool
+finish_attempt(attempt_t* attempt, cardano_provider_request_t* request, const cardano_error_t result)
+{
+  race_t*   race   = attempt->race;
+  router_t* router = &race->context->router;
+
+  attempt->running = false;
+  --race->running;
+
+  cardano_provider_request_unref(&attempt->request);
+
+  if ((result == CARDANO_SUCCESS) || !is_submission(race))
+  {
+    record_outcome(router, attempt->endpoint, attempt->started_ms, result);
+  }
+
+  if (race->settled)
+  {
+    return false;
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    race->settled = true;
+
+    return true;
+  }
+
+  race->result = result;
+  copy_message(race->error_message, sizeof(race->error_message), cardano_provider_request_get_last_error(request));
+
+  if (!is_submission(race))
+  {
+    CARDANO_UNUSED(launch_next(race));
+  }
+
+  if (!race->settled && (race->running == 0U) && (race->position == race->count))
+  {
+    fail_race(race);
+  }
+
+  return false;
+}
+
+/**
+ * \brief Cancels the attempts that lost a race; submissions keep theirs running.
+ *
+ * \param[in] race The race.
+ */
+static void
+settle_race(race_t* race)
+{
+  if (!is_submission(race))
+  {
+    cancel_attempts(race);
+  }
+}
+
+/**
+ * \brief Completion callback of a protocol parameters attempt.
+ */
+static void
+on_attempt_parameters(
+  cardano_provider_request_t*    request,
+  const cardano_error_t          result,
+  cardano_protocol_parameters_t* parameters,
+  void*                          user_data)
+{
+  race_t* race = ((attempt_t*)user_data)->race;
+
+  if (finish_attempt((attempt_t*)user_data, request, result))
+  {
+    CARDANO_UNUSED(cardano_provider_request_complete_parameters(race->request, parameters));
+    settle_race(race);
+  }
+
+  release_race(race);
+}
+
+/**
+ * \brief Completion callback of an unspent outputs attempt.
+ */
+static void
+on_attempt_utxo_list(
+  cardano_provider_request_t* request,
+  const cardano_error_t       result,
+  cardano_utxo_list_t*        utxo_list,
+  void*                       user_data)
+{
+  race_t* race = ((attempt_t*)user_data)->race;
+
+  if (finish_attempt((attempt_t*)user_data, request, result))
+  {
+    CARDANO_UNUSED(cardano_provider_request_complete_utxo_list(race->request, utxo_list));
+    settle_race(race);
+  }
+
+  release_race(race);
+}
+
+/**
+ * \brief Completion callback of a submission attempt.
+ */
+static void
+on_attempt_tx_id(
+  cardano_provider_request_t* request,
+  const cardano_error_t       result,
+  cardano_blake2b_hash_t*     tx_id,
+  void*                       user_data)
+{
+  race_t* race = ((attempt_t*)user_data)->race;
+
+  if (finish_attempt((attempt_t*)user_data, request, result))
+  {
+    CARDANO_UNUSED(cardano_provider_request_complete_tx_id(race->request, tx_id));
+    settle_race(race);
+  }
+
+  release_race(race);
+}
+
+/**
+ * \brief Completion callback of an evaluation attempt.
+ */
+static void
+on_attempt_redeemers(
+  cardano_provider_request_t* request,
+  const cardano_error_t       result,
+  cardano_redeemer_list_t*    redeemers,
+  void*                       user_data)
+{
+  race_t* race = ((attempt_t*)user_data)->race;
+
+  if (finish_attempt((attempt_t*)user_data, request, result))
+  {
+    CARDANO_UNUSED(cardano_provider_request_complete_redeemers(race->request, redeemers));
+    settle_race(race);
+  }
+
+  release_race(race);
+}
+
+/**
+ * \brief Completion callback of a confirmation attempt.
+ */
+static void
+on_attempt_confirmation(
+  cardano_provider_request_t* request,
+  const cardano_error_t       result,
+  const bool                  confirmed,
+  void*                       user_data)
+{
+  race_t* race = ((attempt_t*)user_data)->race;
+
+  if (finish_attempt((attempt_t*)user_data, request, result))
+  {
+    CARDANO_UNUSED(cardano_provider_request_complete_confirmation(race->request, confirmed));
+    settle_race(race);
+  }
+
+  release_race(race);
+}
+
+/**
+ * \brief Starts the query of a race on the endpoint of an attempt.
+ *
+ * \param[in] race The race.
+ * \param[in] attempt The attempt.
+ *
+ * \return The result of starting the query.
+ */
+static cardano_error_t
+start_attempt(race_t* race, attempt_t* attempt)
+{
+  cardano_async_provider_t* provider = race->context->providers[attempt->endpoint];
+
+  switch (cardano_provider_request_get_type(race->request))
+  {
+    case CARDANO_PROVIDER_REQUEST_TYPE_GET_PARAMETERS:
+      return cardano_async_provider_get_parameters(provider, on_attempt_parameters, attempt, &attempt->request);
+    case CARDANO_PROVIDER_REQUEST_TYPE_GET_UNSPENT_OUTPUTS:
+      return cardano_async_provider_get_unspent_outputs(provider, race->address, on_attempt_utxo_list, attempt, &attempt->request);
+    case CARDANO_PROVIDER_REQUEST_TYPE_SUBMIT_TRANSACTION:
+      return cardano_async_provider_submit_transaction(provider, race->tx, on_attempt_tx_id, attempt, &attempt->request);
+    case CARDANO_PROVIDER_REQUEST_TYPE_EVALUATE_TRANSACTION:
+      return cardano_async_provider_evaluate_transaction(provider, race->tx, race->additional_utxos, on_attempt_redeemers, attempt, &attempt->request);
+    case CARDANO_PROVIDER_REQUEST_TYPE_CONFIRM_TRANSACTION:
+      return cardano_async_provider_confirm_transaction(provider, race->tx_id, race->timeout_ms, on_attempt_confirmation, attempt, &attempt->request);
+    default:
+      return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+}
+
+/**
+ * \brief Starts an attempt on the next endpoint of a race that accepts it.
+ *
+ * The attempt may finish before this function returns. The caller must hold a reference to the race.
+ *
+ * \param[in] race The race.
+ *
+ * \return true if an attempt started, false if the race is settled or no endpoint is left.
+ */
+static bool
+launch_next(race_t* race)
+{
+  while (!race->settled && (race->position < race->count))
+  {
+    attempt_t* attempt = &race->attempts[race->position];
+
+    attempt->race       = race;
+    attempt->endpoint   = race->order[race->position];
+    attempt->started_ms = now_ms(&race->context->router);
+    attempt->request    = NULL;
+    attempt->running    = true;
+
+    ++race->position;
+    ++race->running;
+    ++race->references;
+
+    const cardano_error_t result = start_attempt(race, attempt);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      ++race->started;
+
+      // An attempt that already finished did not have its request yet when it was booked.
+      if (!attempt->running)
+      {
+        cardano_provider_request_unref(&attempt->request);
+      }
+
+      return true;
+    }
+
+    attempt->running = false;
+    --race->running;
+    --race->references;
+
+    record_outcome(&race->context->router, attempt->endpoint, attempt->started_ms, result);
+
+    race->result = result;
+    copy_message(race->error_message, sizeof(race->error_message), cardano_async_provider_get_last_error(race->context->providers[attempt->endpoint]));
+  }
+
+  return false;
+}
+
+/**
+ * \brief Starts a race for a request on up to \p width endpoints.
+ *
+ * \param[in] provider_impl The multi-endpoint provider implementation.
+ * \param[in] race The race, holding one reference that this function consumes.
+ * \param[in] width How many endpoints to start on at once.
+ *
+ * \return \ref CARDANO_SUCCESS if an attempt started, or the error of the last endpoint that refused it.
+ */
+static cardano_error_t
+run_race(cardano_async_provider_impl_t* provider_impl, race_t* race, const size_t width)
+{
+  race->count = rank_endpoints(&race->context->router, race->order);
+
+  cardano_error_t result = cardano_provider_request_set_cancel_handler(race->request, cancel_race, race);
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < width); ++i)
+  {
+    if (!launch_next(race))
+    {
+      break;
+    }
+  }
+
+  if ((result == CARDANO_SUCCESS) && (race->started == 0U))
+  {
+    CARDANO_UNUSED(cardano_provider_request_set_cancel_handler(race->request, NULL, NULL));
+    copy_message(provider_impl->error_message, sizeof(provider_impl->error_message), race->error_message);
+
+    result = race->result;
+  }
+
+  if ((race->started > 0U) && !race->settled && (race->running == 0U) && (race->position == race->count))
+  {
+    fail_race(race);
+  }
+
+  release_race(race);
+
+  return result;
+}
+
+/**
+ * \brief Allocates a race for a request.
+ *
+ * \param[in] provider_impl The multi-endpoint provider implementation.
+ * \param[in] request The request. The race takes a reference to it.
+ *
+ * \return The race, or NULL if memory ran out.
+ */
+static race_t*
+new_race(cardano_async_provider_impl_t* provider_impl, cardano_provider_request_t* request)
+{
+  race_t* race = _cardano_malloc(sizeof(race_t));
+
+  if (race == NULL)
+  {
+    return NULL;
+  }
+
+  CARDANO_UNUSED(memset(race, 0, sizeof(race_t)));
+
+  race->references = 1U;
+  race->context    = (multi_async_context_t*)((void*)provider_impl->context);
+  race->result     = CARDANO_ERROR_NOT_IMPLEMENTED;
+
+  cardano_object_ref(provider_impl->context);
+  cardano_provider_request_ref(request);
+
+  race->request = request;
+
+  return race;
+}
+
+/**
+ * \brief Starts a protocol parameters query on the best endpoint.
+ *
+ * \see cardano_async_get_parameters_func_t
+ */
+static cardano_error_t
+async_get_parameters(cardano_async_provider_impl_t* provider_impl, cardano_provider_request_t* request)
+{
+  race_t* race = new_race(provider_impl, request);
+
+  if (race == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  return run_race(provider_impl, race, 1U);
+}
+
+/**
+ * \brief Starts an unspent outputs query on the best endpoints at once.
+ *
+ * \see cardano_async_get_unspent_outputs_func_t
+ */
+static cardano_error_t
+async_get_unspent_outputs(
+  cardano_async_provider_impl_t* provider_impl,
+  cardano_provider_request_t*    request,
+  cardano_address_t*             address)
+{
+  race_t* race = new_race(provider_impl, request);
+
+  if (race == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_address_ref(address);
+  race->address = address;
+
+  const size_t hedge_count = race->context->router.options.hedge_count;
+
+  return run_race(provider_impl, race, (hedge_count > 0U) ? hedge_count : 1U);
+}
+
+/**
+ * \brief Starts a submission on every endpoint at once.
+ *
+ * \see cardano_async_submit_transaction_func_t
+ */
+static cardano_error_t
+async_post_transaction_to_chain(
+  cardano_async_provider_impl_t* provider_impl,
+  cardano_provider_request_t*    request,
+  cardano_transaction_t*         tx)
+{
+  race_t* race = new_race(provider_impl, request);
+
+  if (race == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_transaction_ref(tx);
+  race->tx = tx;
+
+  return run_race(provider_impl, race, CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS);
+}
+
+/**
+ * \brief Starts an evaluation on the best endpoint.
+ *
+ * \see cardano_async_evaluate_transaction_func_t
+ */
+static cardano_error_t
+async_evaluate_transaction(
+  cardano_async_provider_impl_t* provider_impl,
+  cardano_provider_request_t*    request,
+  cardano_transaction_t*         tx,
+  cardano_utxo_list_t*           additional_utxos)
+{
+  race_t* race = new_race(provider_impl, request);
+
+  if (race == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_transaction_ref(tx);
+  cardano_utxo_list_ref(additional_utxos);
+  race->tx               = tx;
+  race->additional_utxos = additional_utxos;
+
+  return run_race(provider_impl, race, 1U);
+}
+
+/**
+ * \brief Starts waiting for a confirmation on the best endpoint.
+ *
+ * \see cardano_async_confirm_transaction_func_t
+ */
+static cardano_error_t
+async_await_transaction_confirmation(
+  cardano_async_provider_impl_t* provider_impl,
+  cardano_provider_request_t*    request,
+  cardano_blake2b_hash_t*        tx_id,
+  const uint64_t                 timeout_ms)
+{
+  race_t* race = new_race(provider_impl, request);
+
+  if (race == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_blake2b_hash_ref(tx_id);
+  race->tx_id      = tx_id;
+  race->timeout_ms = timeout_ms;
+
+  return run_race(provider_impl, race, 1U);
+}
+
+/**
+ * \brief Names a multi-endpoint provider after its endpoints.
+ *
+ * \param[out] name The buffer the name is written to.
+ * \param[in] size The size of the buffer.
+ * \param[in] names The names of the endpoints.
+ * \param[in] count The number of endpoints.
+ */
+static void
+build_name(char* name, const size_t size, const char* const* names, const size_t count)
+{
+  size_t length = 0U;
+
+  for (size_t i = 0U; (i < count) && (length < size); ++i)
+  {
+    const int written = snprintf(&name[length], size - length, "%s%s", (i == 0U) ? "multi:" : "+", names[i]);
+
+    if (written < 0)
+    {
+      break;
+    }
+
+    length += (size_t)written;
+  }
+}
+
+/* DEFINITIONS ****************************************************************/
+
+void
+cardano_multi_provider_options_init(cardano_multi_provider_options_t* options)
+{
+  if (options == NULL)
+  {
+    return;
+  }
+
+  CARDANO_UNUSED(memset(options, 0, sizeof(cardano_multi_provider_options_t)));
+
+  options->max_consecutive_failures = 3U;
+  options->failure_cooldown_ms      = 30000U;
+  options->hedge_count              = 2U;
+  options->clock                    = NULL;
+  options->clock_data               = NULL;
+}
+
+cardano_error_t
+cardano_multi_provider_new(
+  cardano_provider_t**                    providers,
+  const size_t                            provider_count,
+  const cardano_multi_provider_options_t* options,
+  cardano_provider_t**                    multi_provider)
+{
+  if ((providers == NULL) || (multi_provider == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((provider_count == 0U) || (provider_count > CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS))
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  for (size_t i = 0U; i < provider_count; ++i)
+  {
+    if (providers[i] == NULL)
+    {
+      return CARDANO_ERROR_POINTER_IS_NULL;
+    }
+  }
+
+  multi_provider_context_t* context = _cardano_malloc(sizeof(multi_provider_context_t));
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(context, 0, sizeof(multi_provider_context_t)));
+
+  context->base.deallocator   = multi_provider_context_deallocate;
+  context->base.ref_count     = 1;
+  context->base.last_error    = NULL;
+
+  init_router(&context->router, options, provider_count);
+
+  const char* names[CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS] = { 0 };
+
+  for (size_t i = 0U; i < provider_count; ++i)
+  {
+    cardano_provider_ref(providers[i]);
+    context->providers[i] = providers[i];
+    names[i]              = cardano_provider_get_name(providers[i]);
+  }
+
+  cardano_provider_impl_t impl = { 0 };
+
+  build_name(impl.name, sizeof(impl.name), names, provider_count);
+
+  impl.network_magic                  = cardano_provider_get_network_magic(providers[0]);
+  impl.get_parameters                 = get_parameters;
+  impl.get_unspent_outputs            = get_unspent_outputs;
+  impl.get_rewards_balance            = get_rewards_balance;
+  impl.get_rewards_balances           = get_rewards_balances;
+  impl.get_unspent_outputs_with_asset = get_unspent_outputs_with_asset;
+  impl.get_unspent_output_by_nft      = get_unspent_output_by_nft;
+  impl.resolve_unspent_outputs        = resolve_unspent_outputs;
+  impl.resolve_datum                  = resolve_datum;
+  impl.resolve_datums                 = resolve_datums;
+  impl.await_transaction_confirmation = await_transaction_confirmation;
+  impl.post_transaction_to_chain      = post_transaction_to_chain;
+  impl.evaluate_transaction           = evaluate_transaction;
+  impl.context                        = (cardano_object_t*)((void*)context);
+
+  cardano_error_t result = cardano_provider_new(impl, multi_provider);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_object_t* object = (cardano_object_t*)((void*)context);
+    cardano_object_unref(&object);
+  }
+
+  return result;
+}
+
+cardano_error_t
+cardano_multi_async_provider_new(
+  cardano_async_provider_t**              providers,
+  const size_t                            provider_count,
+  const cardano_multi_provider_options_t* options,
+  cardano_async_provider_t**              multi_provider)
+{
+  if ((providers == NULL) || (multi_provider == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((provider_count == 0U) || (provider_count > CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS))
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  for (size_t i = 0U; i < provider_count; ++i)
+  {
+    if (providers[i] == NULL)
+    {
+      return CARDANO_ERROR_POINTER_IS_NULL;
+    }
+  }
+
+  multi_async_context_t* context = _cardano_malloc(sizeof(multi_async_context_t));
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(context, 0, sizeof(multi_async_context_t)));
+
+  context->base.deallocator   = multi_async_context_deallocate;
+  context->base.ref_count     = 1;
+  context->base.last_error    = NULL;
+
+  init_router(&context->router, options, provider_count);
+
+  const char* names[CARDANO_MULTI_PROVIDER_MAX_ENDPOINTS] = { 0 };
+
+  for (size_t i = 0U; i < provider_count; ++i)
+  {
+    cardano_async_provider_ref(providers[i]);
+    context->providers[i] = providers[i];
+    names[i]              = cardano_async_provider_get_name(providers[i]);
+  }
+
+  cardano_async_provider_impl_t impl = { 0 };
+
+  build_name(impl.name, sizeof(impl.name), names, provider_count);
+
+  impl.network_magic                  = cardano_async_provider_get_network_magic(providers[0]);
+  impl.get_parameters                 = async_get_parameters;
+  impl.get_unspent_outputs            = async_get_unspent_outputs;
+  impl.post_transaction_to_chain      = async_post_transaction_to_chain;
+  impl.evaluate_transaction           = async_evaluate_transaction;
+  impl.await_transaction_confirmation = async_await_transaction_confirmation;
+  impl.context                        = (cardano_object_t*)((void*)context);
+
+  cardano_error_t result = cardano_async_provider_new(impl, multi_provider);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_object_t* object = (cardano_object_t*)((void*)context);
+    cardano_object_unref(&object);
+  }
+
+  return result;
+}
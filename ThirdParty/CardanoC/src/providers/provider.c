@@ -91,7 +91,7 @@ cardano_provider_new(
 
   (*provider)->base.deallocator   = cardano_provider_deallocate;
   (*provider)->base.ref_count     = 1;
-  (*provider)->base.last_error[0] = '\0';
+  (*provider)->base.last_error    = NULL;
 
   (*provider)->impl = impl;
 
@@ -201,6 +201,65 @@ cardano_provider_get_rewards_available(
   return result;
 }
 
+cardano_error_t
+cardano_provider_get_rewards_available_batch(
+  cardano_provider_t*            provider,
+  cardano_reward_address_list_t* addresses,
+  uint64_t*                      rewards,
+  const size_t                   rewards_size)
+{
+  if ((provider == NULL) || (addresses == NULL) || (rewards == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const size_t count = cardano_reward_address_list_get_length(addresses);
+
+  if (rewards_size < count)
+  {
+    return CARDANO_ERROR_INSUFFICIENT_BUFFER_SIZE;
+  }
+
+  if (count == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  if (provider->impl.get_rewards_balances != NULL)
+  {
+    cardano_error_t result = provider->impl.get_rewards_balances(&provider->impl, addresses, rewards);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_provider_set_last_error(provider, provider->impl.error_message);
+    }
+
+    return result;
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    cardano_reward_address_t* address = NULL;
+    cardano_error_t           result  = cardano_reward_address_list_get(addresses, i, &address);
+
+    cardano_reward_address_unref(&address);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    result = cardano_provider_get_rewards_available(provider, address, &rewards[i]);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
 cardano_error_t
 cardano_provider_get_unspent_outputs_with_asset(
   cardano_provider_t*   provider,
@@ -306,6 +365,60 @@ cardano_provider_resolve_datum(
   return result;
 }
 
+cardano_error_t
+cardano_provider_resolve_datums(
+  cardano_provider_t*         provider,
+  cardano_blake2b_hash_set_t* datum_hashes,
+  cardano_plutus_list_t**     datums)
+{
+  if ((provider == NULL) || (datum_hashes == NULL) || (datums == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (provider->impl.resolve_datums != NULL)
+  {
+    cardano_error_t result = provider->impl.resolve_datums(&provider->impl, datum_hashes, datums);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_provider_set_last_error(provider, provider->impl.error_message);
+    }
+
+    return result;
+  }
+
+  cardano_error_t result = cardano_plutus_list_new(datums);
+
+  for (size_t i = 0U; (i < cardano_blake2b_hash_set_get_length(datum_hashes)) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_blake2b_hash_t* datum_hash = NULL;
+    cardano_plutus_data_t*  datum      = NULL;
+
+    result = cardano_blake2b_hash_set_get(datum_hashes, i, &datum_hash);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_provider_resolve_datum(provider, datum_hash, &datum);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_plutus_list_add(*datums, datum);
+    }
+
+    cardano_plutus_data_unref(&datum);
+    cardano_blake2b_hash_unref(&datum_hash);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_plutus_list_unref(datums);
+  }
+
+  return result;
+}
+
 cardano_error_t
 cardano_provider_confirm_transaction(
   cardano_provider_t*     provider,
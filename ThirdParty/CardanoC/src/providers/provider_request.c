@@ -0,0 +1,545 @@
+/**
+ * \file provider_request.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/object.h>
+#include <cardano/providers/provider_request.h>
+
+#include "../allocators.h"
+#include "internals/provider_request_internals.h"
+
+#include <assert.h>
+#include <string.h>
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Handle to one in-flight query of an asynchronous provider.
+ */
+typedef struct cardano_provider_request_t
+{
+    cardano_object_t                       base;
+    cardano_provider_request_type_t        type;
+    cardano_provider_request_state_t       state;
+    cardano_error_t                        result;
+    cardano_provider_request_cancel_func_t cancel;
+    void*                                  cancel_data;
+    void*                                  user_data;
+
+    /**
+     * \brief The completion callback; the member in use is given by the request type.
+     */
+    union
+    {
+        cardano_parameters_callback_t    parameters;
+        cardano_utxo_list_callback_t     utxo_list;
+        cardano_tx_id_callback_t         tx_id;
+        cardano_redeemer_list_callback_t redeemers;
+        cardano_confirmation_callback_t  confirmation;
+    } callback;
+} cardano_provider_request_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates a provider request object.
+ *
+ * \param object A void pointer to the request object to be deallocated.
+ */
+static void
+cardano_provider_request_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  _cardano_free(object);
+}
+
+/**
+ * \brief Allocates a pending request of the given type.
+ *
+ * \param[in] type The type of the request.
+ * \param[in] user_data The pointer passed to the completion callback.
+ * \param[out] request On success, the new request, with no callback set.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code on failure.
+ */
+static cardano_error_t
+provider_request_new(
+  const cardano_provider_request_type_t type,
+  void*                                 user_data,
+  cardano_provider_request_t**          request)
+{
+  if (request == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *request = _cardano_malloc(sizeof(cardano_provider_request_t));
+
+  if (*request == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(*request, 0, sizeof(cardano_provider_request_t)));
+
+  (*request)->base.deallocator   = cardano_provider_request_deallocate;
+  (*request)->base.ref_count     = 1;
+  (*request)->base.last_error    = NULL;
+
+  (*request)->type      = type;
+  (*request)->state     = CARDANO_PROVIDER_REQUEST_STATE_PENDING;
+  (*request)->result    = CARDANO_ERROR_ILLEGAL_STATE;
+  (*request)->user_data = user_data;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Checks whether a request can be completed and moves it out of the pending state.
+ *
+ * \param[in] request The request.
+ * \param[in] type The type the request must have, to catch an implementation completing it with the wrong payload.
+ * \param[in] state The state to move the request to.
+ * \param[in] result The result to record.
+ * \param[out] run_callback Set to true if the caller must run the callback, or false if the request was cancelled.
+ *
+ * \return \ref CARDANO_SUCCESS if the request was pending or cancelled, or the error code to return otherwise.
+ */
+static cardano_error_t
+finish_request(
+  cardano_provider_request_t*            request,
+  const cardano_provider_request_type_t  type,
+  const cardano_provider_request_state_t state,
+  const cardano_error_t                  result,
+  bool*                                  run_callback)
+{
+  *run_callback = false;
+
+  if (request->type != type)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (request->state == CARDANO_PROVIDER_REQUEST_STATE_CANCELLED)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  if (request->state != CARDANO_PROVIDER_REQUEST_STATE_PENDING)
+  {
+    return CARDANO_ERROR_ILLEGAL_STATE;
+  }
+
+  request->state       = state;
+  request->result      = result;
+  request->cancel      = NULL;
+  request->cancel_data = NULL;
+  *run_callback        = true;
+
+  return CARDANO_SUCCESS;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+_cardano_provider_request_new_parameters(
+  cardano_parameters_callback_t callback,
+  void*                         user_data,
+  cardano_provider_request_t**  request)
+{
+  cardano_error_t result = provider_request_new(CARDANO_PROVIDER_REQUEST_TYPE_GET_PARAMETERS, user_data, request);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    (*request)->callback.parameters = callback;
+  }
+
+  return result;
+}
+
+cardano_error_t
+_cardano_provider_request_new_utxo_list(
+  cardano_utxo_list_callback_t callback,
+  void*                        user_data,
+  cardano_provider_request_t** request)
+{
+  cardano_error_t result = provider_request_new(CARDANO_PROVIDER_REQUEST_TYPE_GET_UNSPENT_OUTPUTS, user_data, request);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    (*request)->callback.utxo_list = callback;
+  }
+
+  return result;
+}
+
+cardano_error_t
+_cardano_provider_request_new_tx_id(
+  cardano_tx_id_callback_t     callback,
+  void*                        user_data,
+  cardano_provider_request_t** request)
+{
+  cardano_error_t result = provider_request_new(CARDANO_PROVIDER_REQUEST_TYPE_SUBMIT_TRANSACTION, user_data, request);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    (*request)->callback.tx_id = callback;
+  }
+
+  return result;
+}
+
+cardano_error_t
+_cardano_provider_request_new_redeemers(
+  cardano_redeemer_list_callback_t callback,
+  void*                            user_data,
+  cardano_provider_request_t**     request)
+{
+  cardano_error_t result = provider_request_new(CARDANO_PROVIDER_REQUEST_TYPE_EVALUATE_TRANSACTION, user_data, request);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    (*request)->callback.redeemers = callback;
+  }
+
+  return result;
+}
+
+cardano_error_t
+_cardano_provider_request_new_confirmation(
+  cardano_confirmation_callback_t callback,
+  void*                           user_data,
+  cardano_provider_request_t**    request)
+{
+  cardano_error_t result = provider_request_new(CARDANO_PROVIDER_REQUEST_TYPE_CONFIRM_TRANSACTION, user_data, request);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    (*request)->callback.confirmation = callback;
+  }
+
+  return result;
+}
+
+cardano_provider_request_type_t
+cardano_provider_request_get_type(const cardano_provider_request_t* request)
+{
+  if (request == NULL)
+  {
+    return CARDANO_PROVIDER_REQUEST_TYPE_GET_PARAMETERS;
+  }
+
+  return request->type;
+}
+
+cardano_provider_request_state_t
+cardano_provider_request_get_state(const cardano_provider_request_t* request)
+{
+  if (request == NULL)
+  {
+    return CARDANO_PROVIDER_REQUEST_STATE_CANCELLED;
+  }
+
+  return request->state;
+}
+
+cardano_error_t
+cardano_provider_request_get_result(const cardano_provider_request_t* request)
+{
+  if (request == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return request->result;
+}
+
+cardano_error_t
+cardano_provider_request_cancel(cardano_provider_request_t* request)
+{
+  if (request == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (request->state != CARDANO_PROVIDER_REQUEST_STATE_PENDING)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_provider_request_cancel_func_t cancel      = request->cancel;
+  void*                                  cancel_data = request->cancel_data;
+
+  request->state       = CARDANO_PROVIDER_REQUEST_STATE_CANCELLED;
+  request->cancel      = NULL;
+  request->cancel_data = NULL;
+
+  if (cancel != NULL)
+  {
+    // The handler usually releases the reference the implementation holds, so keep the request alive until it returns.
+    cardano_provider_request_ref(request);
+    cancel(request, cancel_data);
+    cardano_provider_request_unref(&request);
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_provider_request_set_cancel_handler(
+  cardano_provider_request_t*            request,
+  cardano_provider_request_cancel_func_t cancel,
+  void*                                  cancel_data)
+{
+  if (request == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  request->cancel      = cancel;
+  request->cancel_data = cancel_data;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_provider_request_complete_parameters(
+  cardano_provider_request_t*    request,
+  cardano_protocol_parameters_t* parameters)
+{
+  if ((request == NULL) || (parameters == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  bool            run_callback = false;
+  cardano_error_t result       = finish_request(request, CARDANO_PROVIDER_REQUEST_TYPE_GET_PARAMETERS, CARDANO_PROVIDER_REQUEST_STATE_COMPLETED, CARDANO_SUCCESS, &run_callback);
+
+  if (run_callback && (request->callback.parameters != NULL))
+  {
+    request->callback.parameters(request, CARDANO_SUCCESS, parameters, request->user_data);
+  }
+
+  return result;
+}
+
+cardano_error_t
+cardano_provider_request_complete_utxo_list(
+  cardano_provider_request_t* request,
+  cardano_utxo_list_t*        utxo_list)
+{
+  if ((request == NULL) || (utxo_list == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  bool            run_callback = false;
+  cardano_error_t result       = finish_request(request, CARDANO_PROVIDER_REQUEST_TYPE_GET_UNSPENT_OUTPUTS, CARDANO_PROVIDER_REQUEST_STATE_COMPLETED, CARDANO_SUCCESS, &run_callback);
+
+  if (run_callback && (request->callback.utxo_list != NULL))
+  {
+    request->callback.utxo_list(request, CARDANO_SUCCESS, utxo_list, request->user_data);
+  }
+
+  return result;
+}
+
+cardano_error_t
+cardano_provider_request_complete_tx_id(
+  cardano_provider_request_t* request,
+  cardano_blake2b_hash_t*     tx_id)
+{
+  if ((request == NULL) || (tx_id == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  bool            run_callback = false;
+  cardano_error_t result       = finish_request(request, CARDANO_PROVIDER_REQUEST_TYPE_SUBMIT_TRANSACTION, CARDANO_PROVIDER_REQUEST_STATE_COMPLETED, CARDANO_SUCCESS, &run_callback);
+
+  if (run_callback && (request->callback.tx_id != NULL))
+  {
+    request->callback.tx_id(request, CARDANO_SUCCESS, tx_id, request->user_data);
+  }
+
+  return result;
+}
+
+cardano_error_t
+cardano_provider_request_complete_redeemers(
+  cardano_provider_request_t* request,
+  cardano_redeemer_list_t*    redeemers)
+{
+  if ((request == NULL) || (redeemers == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  bool            run_callback = false;
+  cardano_error_t result       = finish_request(request, CARDANO_PROVIDER_REQUEST_TYPE_EVALUATE_TRANSACTION, CARDANO_PROVIDER_REQUEST_STATE_COMPLETED, CARDANO_SUCCESS, &run_callback);
+
+  if (run_callback && (request->callback.redeemers != NULL))
+  {
+    request->callback.redeemers(request, CARDANO_SUCCESS, redeemers, request->user_data);
+  }
+
+  return result;
+}
+
+cardano_error_t
+cardano_provider_request_complete_confirmation(
+  cardano_provider_request_t* request,
+  const bool                  confirmed)
+{
+  if (request == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  bool            run_callback = false;
+  cardano_error_t result       = finish_request(request, CARDANO_PROVIDER_REQUEST_TYPE_CONFIRM_TRANSACTION, CARDANO_PROVIDER_REQUEST_STATE_COMPLETED, CARDANO_SUCCESS, &run_callback);
+
+  if (run_callback && (request->callback.confirmation != NULL))
+  {
+    request->callback.confirmation(request, CARDANO_SUCCESS, confirmed, request->user_data);
+  }
+
+  return result;
+}
+
+cardano_error_t
+cardano_provider_request_fail(
+  cardano_provider_request_t* request,
+  const cardano_error_t       error,
+  const char*                 message)
+{
+  if (request == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (error == CARDANO_SUCCESS)
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  bool            run_callback = false;
+  cardano_error_t result       = finish_request(request, request->type, CARDANO_PROVIDER_REQUEST_STATE_FAILED, error, &run_callback);
+
+  if (!run_callback)
+  {
+    return result;
+  }
+
+  cardano_provider_request_set_last_error(request, message);
+
+  switch (request->type)
+  {
+    case CARDANO_PROVIDER_REQUEST_TYPE_GET_PARAMETERS:
+      if (request->callback.parameters != NULL)
+      {
+        request->callback.parameters(request, error, NULL, request->user_data);
+      }
+      break;
+    case CARDANO_PROVIDER_REQUEST_TYPE_GET_UNSPENT_OUTPUTS:
+      if (request->callback.utxo_list != NULL)
+      {
+        request->callback.utxo_list(request, error, NULL, request->user_data);
+      }
+      break;
+    case CARDANO_PROVIDER_REQUEST_TYPE_SUBMIT_TRANSACTION:
+      if (request->callback.tx_id != NULL)
+      {
+        request->callback.tx_id(request, error, NULL, request->user_data);
+      }
+      break;
+    case CARDANO_PROVIDER_REQUEST_TYPE_EVALUATE_TRANSACTION:
+      if (request->callback.redeemers != NULL)
+      {
+        request->callback.redeemers(request, error, NULL, request->user_data);
+      }
+      break;
+    case CARDANO_PROVIDER_REQUEST_TYPE_CONFIRM_TRANSACTION:
+      if (request->callback.confirmation != NULL)
+      {
+        request->callback.confirmation(request, error, false, request->user_data);
+      }
+      break;
+    default:
+      break;
+  }
+
+  return result;
+}
+
+void
+cardano_provider_request_unref(cardano_provider_request_t** request)
+{
+  if ((request == NULL) || (*request == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*request)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *request = NULL;
+    return;
+  }
+}
+
+void
+cardano_provider_request_ref(cardano_provider_request_t* request)
+{
+  if (request == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&request->base);
+}
+
+size_t
+cardano_provider_request_refcount(const cardano_provider_request_t* request)
+{
+  if (request == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&request->base);
+}
+
+void
+cardano_provider_request_set_last_error(cardano_provider_request_t* request, const char* message)
+{
+  cardano_object_set_last_error(&request->base, message);
+}
+
+const char*
+cardano_provider_request_get_last_error(const cardano_provider_request_t* request)
+{
+  return cardano_object_get_last_error(&request->base);
+}
@@ -0,0 +1,790 @@
+/**
+ * \file compiled_native_script.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/buffer.h>
+#include <cardano/cbor/cbor_reader.h>
+#include <cardano/cbor/cbor_writer.h>
+#include <cardano/crypto/blake2b_hash_size.h>
+#include <cardano/object.h>
+#include <cardano/scripts/native_scripts/compiled_native_script.h>
+#include <cardano/scripts/native_scripts/native_script_type.h>
+
+#include "../../allocators.h"
+
+#include <assert.h>
+#include <string.h>
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A node of the flattened script tree.
+ *
+ * Nodes are stored in preorder, so the sub-scripts of a node follow it directly and a whole subtree can be skipped by
+ * advancing \ref subtree_size nodes.
+ */
+typedef struct compiled_node_t
+{
+    cardano_native_script_type_t type;
+    uint64_t                     value;
+    size_t                       child_count;
+    size_t                       subtree_size;
+} compiled_node_t;
+
+/**
+ * \brief A native script with its hash, keys, signer count and timelock bounds computed once.
+ */
+typedef struct cardano_compiled_native_script_t
+{
+    cardano_object_t            base;
+    cardano_native_script_t*    script;
+    cardano_blake2b_hash_t*     hash;
+    cardano_blake2b_hash_set_t* key_hash_set;
+    byte_t*                     keys;
+    size_t                      key_count;
+    compiled_node_t*            nodes;
+    size_t                      node_count;
+    size_t                      node_capacity;
+    size_t                      min_signer_count;
+    bool                        has_invalid_before;
+    uint64_t                    invalid_before;
+    bool                        has_invalid_hereafter;
+    uint64_t                    invalid_hereafter;
+} cardano_compiled_native_script_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates a compiled native script object.
+ *
+ * \param object A void pointer to the compiled native script object to be deallocated.
+ */
+static void
+cardano_compiled_native_script_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  cardano_compiled_native_script_t* data = (cardano_compiled_native_script_t*)object;
+
+  cardano_native_script_unref(&data->script);
+  cardano_blake2b_hash_unref(&data->hash);
+  cardano_blake2b_hash_set_unref(&data->key_hash_set);
+  _cardano_free(data->keys);
+  _cardano_free(data->nodes);
+
+  _cardano_free(data);
+}
+
+/**
+ * \brief Appends a node to the flattened tree.
+ *
+ * \param compiled The compiled script being built.
+ * \param type The type of the node.
+ * \param value The threshold, key index or slot of the node.
+ * \param index On success, the index of the new node.
+ *
+ * \return \ref CARDANO_SUCCESS or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+append_node(
+  cardano_compiled_native_script_t* compiled,
+  const cardano_native_script_type_t type,
+  const uint64_t                     value,
+  size_t*                            index)
+{
+  if (compiled->node_count == compiled->node_capacity)
+  {
+    const size_t     capacity = (compiled->node_capacity == 0U) ? 8U : (compiled->node_capacity * 2U);
+    compiled_node_t* nodes    = _cardano_realloc(compiled->nodes, capacity * sizeof(compiled_node_t));
+
+    if (nodes == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    compiled->nodes         = nodes;
+    compiled->node_capacity = capacity;
+  }
+
+  compiled_node_t* node = &compiled->nodes[compiled->node_count];
+
+  node->type         = type;
+  node->value        = value;
+  node->child_count  = 0U;
+  node->subtree_size = 1U;
+
+  *index = compiled->node_count;
+  ++compiled->node_count;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Finds a key hash among the keys of the script, adding it if it is not there yet.
+ *
+ * \param compiled The compiled script being built.
+ * \param key_hash The key hash, \ref CARDANO_BLAKE2B_HASH_SIZE_224 bytes long.
+ * \param index On success, the index of the key.
+ *
+ * \return \ref CARDANO_SUCCESS or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+intern_key(cardano_compiled_native_script_t* compiled, const byte_t* key_hash, size_t* index)
+{
+  for (size_t i = 0U; i < compiled->key_count; ++i)
+  {
+    if (memcmp(&compiled->keys[i * CARDANO_BLAKE2B_HASH_SIZE_224], key_hash, CARDANO_BLAKE2B_HASH_SIZE_224) == 0)
+    {
+      *index = i;
+      return CARDANO_SUCCESS;
+    }
+  }
+
+  byte_t* keys = _cardano_realloc(compiled->keys, (compiled->key_count + 1U) * CARDANO_BLAKE2B_HASH_SIZE_224);
+
+  if (keys == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  compiled->keys = keys;
+  (void)memcpy(&compiled->keys[compiled->key_count * CARDANO_BLAKE2B_HASH_SIZE_224], key_hash, CARDANO_BLAKE2B_HASH_SIZE_224);
+
+  *index = compiled->key_count;
+  ++compiled->key_count;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Adds two signer counts, where `SIZE_MAX` stands for an unsatisfiable script.
+ */
+static size_t
+add_signer_counts(const size_t lhs, const size_t rhs)
+{
+  if ((lhs == SIZE_MAX) || (rhs == SIZE_MAX) || (lhs > (SIZE_MAX - 1U - rhs)))
+  {
+    return SIZE_MAX;
+  }
+
+  return lhs + rhs;
+}
+
+/**
+ * \brief Computes the signer count of a threshold node: the sum of its \p required cheapest sub-scripts.
+ *
+ * \param costs The signer counts of the sub-scripts. Sorted in place.
+ * \param count The number of sub-scripts.
+ * \param required How many sub-scripts must be satisfied.
+ *
+ * \return The signer count, or `SIZE_MAX` if fewer than \p required sub-scripts can be satisfied.
+ */
+static size_t
+threshold_signer_count(size_t* costs, const size_t count, const uint64_t required)
+{
+  if (required > (uint64_t)count)
+  {
+    return SIZE_MAX;
+  }
+
+  for (size_t i = 1U; i < count; ++i)
+  {
+    const size_t cost = costs[i];
+    size_t       j    = i;
+
+    while ((j > 0U) && (costs[j - 1U] > cost))
+    {
+      costs[j] = costs[j - 1U];
+      --j;
+    }
+
+    costs[j] = cost;
+  }
+
+  size_t total = 0U;
+
+  for (size_t i = 0U; i < (size_t)required; ++i)
+  {
+    total = add_signer_counts(total, costs[i]);
+  }
+
+  return total;
+}
+
+/**
+ * \brief Flattens the native script at the current position of a reader into the node array.
+ *
+ * \param compiled The compiled script being built.
+ * \param reader The reader positioned at a native script.
+ * \param signer_count On success, the smallest number of signatures satisfying the script.
+ *
+ * \return \ref CARDANO_SUCCESS, or the error raised while reading the script or allocating memory.
+ */
+// cppcheck-suppress misra-c2012-17.2; Reason: Native scripts are trees, recursion follows their shape.
+static cardano_error_t
+compile_node(cardano_compiled_native_script_t* compiled, cardano_cbor_reader_t* reader, size_t* signer_count)
+{
+  int64_t  length = 0;
+  uint64_t type   = 0U;
+
+  cardano_error_t result = cardano_cbor_reader_read_start_array(reader, &length);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_uint(reader, &type);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  size_t index = 0U;
+
+  switch ((cardano_native_script_type_t)type)
+  {
+    case CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_PUBKEY:
+    {
+      const byte_t* key_hash  = NULL;
+      size_t        hash_size = 0U;
+      size_t        key_index = 0U;
+
+      result = cardano_cbor_reader_read_bytestring_view(reader, &key_hash, &hash_size);
+
+      if ((result == CARDANO_SUCCESS) && (hash_size != CARDANO_BLAKE2B_HASH_SIZE_224))
+      {
+        result = CARDANO_ERROR_INVALID_BLAKE2B_HASH_SIZE;
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = intern_key(compiled, key_hash, &key_index);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = append_node(compiled, CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_PUBKEY, key_index, &index);
+      }
+
+      *signer_count = 1U;
+      break;
+    }
+    case CARDANO_NATIVE_SCRIPT_TYPE_INVALID_BEFORE:
+    case CARDANO_NATIVE_SCRIPT_TYPE_INVALID_AFTER:
+    {
+      uint64_t slot = 0U;
+
+      result = cardano_cbor_reader_read_uint(reader, &slot);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = append_node(compiled, (cardano_native_script_type_t)type, slot, &index);
+      }
+
+      if (type == (uint64_t)CARDANO_NATIVE_SCRIPT_TYPE_INVALID_BEFORE)
+      {
+        if (!compiled->has_invalid_before || (slot > compiled->invalid_before))
+        {
+          compiled->invalid_before = slot;
+        }
+
+        compiled->has_invalid_before = true;
+      }
+      else
+      {
+        if (!compiled->has_invalid_hereafter || (slot < compiled->invalid_hereafter))
+        {
+          compiled->invalid_hereafter = slot;
+        }
+
+        compiled->has_invalid_hereafter = true;
+      }
+
+      *signer_count = 0U;
+      break;
+    }
+    case CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_ALL_OF:
+    case CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_ANY_OF:
+    case CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_N_OF_K:
+    {
+      uint64_t required = 0U;
+      int64_t  count    = 0;
+
+      if (type == (uint64_t)CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_N_OF_K)
+      {
+        result = cardano_cbor_reader_read_uint(reader, &required);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_cbor_reader_read_start_array(reader, &count);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = append_node(compiled, (cardano_native_script_type_t)type, 0U, &index);
+      }
+
+      if (result != CARDANO_SUCCESS)
+      {
+        return result;
+      }
+
+      size_t* costs    = NULL;
+      size_t  children = 0U;
+
+      while (result == CARDANO_SUCCESS)
+      {
+        cardano_cbor_reader_state_t state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+
+        result = cardano_cbor_reader_peek_state(reader, &state);
+
+        if ((result != CARDANO_SUCCESS) || (state == CARDANO_CBOR_READER_STATE_END_ARRAY))
+        {
+          break;
+        }
+
+        size_t* grown = _cardano_realloc(costs, (children + 1U) * sizeof(size_t));
+
+        if (grown == NULL)
+        {
+          result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+          break;
+        }
+
+        costs = grown;
+
+        result = compile_node(compiled, reader, &costs[children]);
+        ++children;
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_cbor_reader_read_end_array(reader);
+      }
+
+      if (type == (uint64_t)CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_ALL_OF)
+      {
+        required = children;
+      }
+      else if (type == (uint64_t)CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_ANY_OF)
+      {
+        required = 1U;
+      }
+      else
+      {
+        // N of K keeps the threshold read above.
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        compiled_node_t* node = &compiled->nodes[index];
+
+        node->value        = required;
+        node->child_count  = children;
+        node->subtree_size = compiled->node_count - index;
+
+        *signer_count = threshold_signer_count(costs, children, required);
+      }
+
+      _cardano_free(costs);
+      break;
+    }
+    default:
+      result = CARDANO_ERROR_INVALID_NATIVE_SCRIPT_TYPE;
+      break;
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_end_array(reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Builds the set of key hashes handed out by \ref cardano_compiled_native_script_get_key_hashes.
+ *
+ * \param compiled The compiled script.
+ *
+ * \return \ref CARDANO_SUCCESS, or the error raised while building the set.
+ */
+static cardano_error_t
+build_key_hash_set(cardano_compiled_native_script_t* compiled)
+{
+  cardano_error_t result = cardano_blake2b_hash_set_new(&compiled->key_hash_set);
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < compiled->key_count); ++i)
+  {
+    cardano_blake2b_hash_t* key_hash = NULL;
+
+    result = cardano_blake2b_hash_from_bytes(&compiled->keys[i * CARDANO_BLAKE2B_HASH_SIZE_224], CARDANO_BLAKE2B_HASH_SIZE_224, &key_hash);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_blake2b_hash_set_add(compiled->key_hash_set, key_hash);
+    }
+
+    cardano_blake2b_hash_unref(&key_hash);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Evaluates the node at \p index.
+ *
+ * \param compiled The compiled script.
+ * \param index The index of the node.
+ * \param is_signed For every key of the script, whether the transaction carries its signature.
+ * \param invalid_before The start of the validity interval, or NULL.
+ * \param invalid_hereafter The end of the validity interval, or NULL.
+ *
+ * \return Whether the node is satisfied.
+ */
+// cppcheck-suppress misra-c2012-17.2; Reason: Native scripts are trees, recursion follows their shape.
+static bool
+evaluate_node(
+  const cardano_compiled_native_script_t* compiled,
+  const size_t                            index,
+  const bool*                             is_signed,
+  const uint64_t*                         invalid_before,
+  const uint64_t*                         invalid_hereafter)
+{
+  const compiled_node_t* node = &compiled->nodes[index];
+
+  switch (node->type)
+  {
+    case CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_PUBKEY:
+      return is_signed[node->value];
+    case CARDANO_NATIVE_SCRIPT_TYPE_INVALID_BEFORE:
+      return (invalid_before != NULL) && (node->value <= *invalid_before);
+    case CARDANO_NATIVE_SCRIPT_TYPE_INVALID_AFTER:
+      return (invalid_hereafter != NULL) && (*invalid_hereafter <= node->value);
+    default:
+      break;
+  }
+
+  uint64_t satisfied = 0U;
+  size_t   child     = index + 1U;
+
+  for (size_t i = 0U; (i < node->child_count) && (satisfied < node->value); ++i)
+  {
+    if (evaluate_node(compiled, child, is_signed, invalid_before, invalid_hereafter))
+    {
+      ++satisfied;
+    }
+
+    child += compiled->nodes[child].subtree_size;
+  }
+
+  return satisfied >= node->value;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_compiled_native_script_new(
+  cardano_native_script_t*           native_script,
+  cardano_compiled_native_script_t** compiled_native_script)
+{
+  if ((native_script == NULL) || (compiled_native_script == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_compiled_native_script_t* data = _cardano_malloc(sizeof(cardano_compiled_native_script_t));
+
+  if (data == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  data->base.ref_count     = 1;
+  data->base.last_error    = NULL;
+  data->base.deallocator   = cardano_compiled_native_script_deallocate;
+
+  data->script                = NULL;
+  data->hash                  = NULL;
+  data->key_hash_set          = NULL;
+  data->keys                  = NULL;
+  data->key_count             = 0U;
+  data->nodes                 = NULL;
+  data->node_count            = 0U;
+  data->node_capacity         = 0U;
+  data->min_signer_count      = 0U;
+  data->has_invalid_before    = false;
+  data->invalid_before        = 0U;
+  data->has_invalid_hereafter = false;
+  data->invalid_hereafter     = 0U;
+
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+  cardano_buffer_t*      cbor   = NULL;
+
+  if (writer == NULL)
+  {
+    cardano_compiled_native_script_unref(&data);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_native_script_to_cbor(native_script, writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_encode_in_buffer(writer, &cbor);
+  }
+
+  cardano_cbor_writer_unref(&writer);
+
+  // The snapshot is decoded from the encoding rather than shared, so later changes to the caller's script cannot
+  // invalidate what is computed here.
+  if (result == CARDANO_SUCCESS)
+  {
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_new(cardano_buffer_get_data(cbor), cardano_buffer_get_size(cbor));
+
+    result = (reader == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : cardano_native_script_from_cbor(reader, &data->script);
+
+    cardano_cbor_reader_unref(&reader);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    cardano_cbor_reader_t* reader = cardano_cbor_reader_new(cardano_buffer_get_data(cbor), cardano_buffer_get_size(cbor));
+
+    result = (reader == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : compile_node(data, reader, &data->min_signer_count);
+
+    cardano_cbor_reader_unref(&reader);
+  }
+
+  cardano_buffer_unref(&cbor);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    cardano_native_script_freeze(data->script);
+    data->hash = cardano_native_script_get_hash(data->script);
+
+    result = (data->hash == NULL) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : build_key_hash_set(data);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_compiled_native_script_unref(&data);
+    return result;
+  }
+
+  // Keys shared between branches can make the per-branch sum overshoot, but never beyond every key signing.
+  if ((data->min_signer_count != SIZE_MAX) && (data->min_signer_count > data->key_count))
+  {
+    data->min_signer_count = data->key_count;
+  }
+
+  *compiled_native_script = data;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_native_script_t*
+cardano_compiled_native_script_get_script(cardano_compiled_native_script_t* compiled_native_script)
+{
+  if (compiled_native_script == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_native_script_ref(compiled_native_script->script);
+
+  return compiled_native_script->script;
+}
+
+cardano_blake2b_hash_t*
+cardano_compiled_native_script_get_hash(cardano_compiled_native_script_t* compiled_native_script)
+{
+  if (compiled_native_script == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_blake2b_hash_ref(compiled_native_script->hash);
+
+  return compiled_native_script->hash;
+}
+
+cardano_blake2b_hash_set_t*
+cardano_compiled_native_script_get_key_hashes(cardano_compiled_native_script_t* compiled_native_script)
+{
+  if (compiled_native_script == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_blake2b_hash_set_ref(compiled_native_script->key_hash_set);
+
+  return compiled_native_script->key_hash_set;
+}
+
+size_t
+cardano_compiled_native_script_get_min_signer_count(const cardano_compiled_native_script_t* compiled_native_script)
+{
+  if (compiled_native_script == NULL)
+  {
+    return 0U;
+  }
+
+  return compiled_native_script->min_signer_count;
+}
+
+const uint64_t*
+cardano_compiled_native_script_get_invalid_before(const cardano_compiled_native_script_t* compiled_native_script)
+{
+  if ((compiled_native_script == NULL) || !compiled_native_script->has_invalid_before)
+  {
+    return NULL;
+  }
+
+  return &compiled_native_script->invalid_before;
+}
+
+const uint64_t*
+cardano_compiled_native_script_get_invalid_hereafter(const cardano_compiled_native_script_t* compiled_native_script)
+{
+  if ((compiled_native_script == NULL) || !compiled_native_script->has_invalid_hereafter)
+  {
+    return NULL;
+  }
+
+  return &compiled_native_script->invalid_hereafter;
+}
+
+cardano_error_t
+cardano_compiled_native_script_evaluate(
+  const cardano_compiled_native_script_t* compiled_native_script,
+  const cardano_blake2b_hash_set_t*       signers,
+  const uint64_t*                         invalid_before,
+  const uint64_t*                         invalid_hereafter,
+  bool*                                   is_satisfied)
+{
+  if ((compiled_native_script == NULL) || (is_satisfied == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  bool* is_signed = NULL;
+
+  if (compiled_native_script->key_count > 0U)
+  {
+    is_signed = _cardano_malloc(compiled_native_script->key_count * sizeof(bool));
+
+    if (is_signed == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    (void)memset(is_signed, 0, compiled_native_script->key_count * sizeof(bool));
+  }
+
+  const size_t signer_count = cardano_blake2b_hash_set_get_length(signers);
+
+  for (size_t i = 0U; i < signer_count; ++i)
+  {
+    cardano_blake2b_hash_t* signer = NULL;
+
+    if (cardano_blake2b_hash_set_get(signers, i, &signer) != CARDANO_SUCCESS)
+    {
+      continue;
+    }
+
+    if (cardano_blake2b_hash_get_bytes_size(signer) == CARDANO_BLAKE2B_HASH_SIZE_224)
+    {
+      const byte_t* signer_data = cardano_blake2b_hash_get_data(signer);
+
+      for (size_t j = 0U; j < compiled_native_script->key_count; ++j)
+      {
+        if (memcmp(&compiled_native_script->keys[j * CARDANO_BLAKE2B_HASH_SIZE_224], signer_data, CARDANO_BLAKE2B_HASH_SIZE_224) == 0)
+        {
+          is_signed[j] = true;
+          break;
+        }
+      }
+    }
+
+    cardano_blake2b_hash_unref(&signer);
+  }
+
+  *is_satisfied = evaluate_node(compiled_native_script, 0U, is_signed, invalid_before, invalid_hereafter);
+
+  _cardano_free(is_signed);
+
+  return CARDANO_SUCCESS;
+}
+
+void
+cardano_compiled_native_script_unref(cardano_compiled_native_script_t** compiled_native_script)
+{
+  if ((compiled_native_script == NULL) || (*compiled_native_script == NULL))
+  {
+    return;
+  }
+
+  cardano_object_t* object = &(*compiled_native_script)->base;
+  cardano_object_unref(&object);
+
+  if (object == NULL)
+  {
+    *compiled_native_script = NULL;
+    return;
+  }
+}
+
+void
+cardano_compiled_native_script_ref(cardano_compiled_native_script_t* compiled_native_script)
+{
+  if (compiled_native_script == NULL)
+  {
+    return;
+  }
+
+  cardano_object_ref(&compiled_native_script->base);
+}
+
+size_t
+cardano_compiled_native_script_refcount(const cardano_compiled_native_script_t* compiled_native_script)
+{
+  if (compiled_native_script == NULL)
+  {
+    return 0;
+  }
+
+  return cardano_object_refcount(&compiled_native_script->base);
+}
+
+void
+cardano_compiled_native_script_set_last_error(cardano_compiled_native_script_t* compiled_native_script, const char* message)
+{
+  cardano_object_set_last_error(&compiled_native_script->base, message);
+}
+
+const char*
+cardano_compiled_native_script_get_last_error(const cardano_compiled_native_script_t* compiled_native_script)
+{
+  return cardano_object_get_last_error(&compiled_native_script->base);
+}
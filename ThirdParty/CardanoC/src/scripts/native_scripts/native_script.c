@@ -24,6 +24,7 @@
 #include <cardano/crypto/blake2b_hash_size.h>
 #include <cardano/error.h>
 #include <cardano/scripts/native_scripts/native_script.h>
+#include <cardano/scripts/native_scripts/native_script_list.h>
 #include <cardano/scripts/native_scripts/native_script_type.h>
 #include <cardano/scripts/native_scripts/script_all.h>
 #include <cardano/scripts/native_scripts/script_any.h>
@@ -36,6 +37,7 @@
 
 #include "../../allocators.h"
 #include "../../cbor/cbor_validation.h"
+#include "../../memory_footprint.h"
 #include "../../string_safe.h"
 
 #include <assert.h>
@@ -57,9 +59,14 @@ typedef struct cardano_native_script_t
     cardano_script_invalid_before_t* invalid_before;
     cardano_script_n_of_k_t*         n_of_k;
     cardano_script_pubkey_t*         pubkey;
+    cardano_blake2b_hash_t*          hash_cache;
 
 } cardano_native_script_t;
 
+/* STATIC FUNCTIONS FORWARD DECLARATIONS *************************************/
+
+static void freeze_native_script(cardano_native_script_t* native_script);
+
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
@@ -88,6 +95,7 @@ cardano_native_script_deallocate(void* object)
   cardano_script_invalid_before_unref(&data->invalid_before);
   cardano_script_n_of_k_unref(&data->n_of_k);
   cardano_script_pubkey_unref(&data->pubkey);
+  cardano_blake2b_hash_unref(&data->hash_cache);
 
   _cardano_free(data);
 }
@@ -108,7 +116,7 @@ cardano_native_script_new(void)
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_native_script_deallocate;
 
   data->type           = CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_ALL_OF;
@@ -118,10 +126,142 @@ cardano_native_script_new(void)
   data->invalid_before = NULL;
   data->n_of_k         = NULL;
   data->pubkey         = NULL;
+  data->hash_cache     = NULL;
 
   return data;
 }
 
+/**
+ * \brief Freezes a list of native scripts and, recursively, every script in it.
+ *
+ * \param list The list to freeze.
+ */
+static void
+freeze_native_script_list(cardano_native_script_list_t* list)
+{
+  cardano_object_freeze((cardano_object_t*)((void*)list));
+
+  const size_t length = cardano_native_script_list_get_length(list);
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    cardano_native_script_t* script = NULL;
+
+    if ((cardano_native_script_list_get(list, i, &script) == CARDANO_SUCCESS) && !cardano_native_script_is_frozen(script))
+    {
+      // cppcheck-suppress misra-c2012-17.2; Reason: Native scripts nest, and so does freezing them.
+      freeze_native_script(script);
+    }
+
+    cardano_native_script_unref(&script);
+  }
+}
+
+/**
+ * \brief Freezes a native script and every object it owns, recursing into nested scripts.
+ *
+ * \param native_script The script to freeze.
+ */
+static void
+freeze_native_script(cardano_native_script_t* native_script)
+{
+  cardano_object_freeze(&native_script->base);
+
+  cardano_object_freeze((cardano_object_t*)((void*)native_script->invalid_after));
+  cardano_object_freeze((cardano_object_t*)((void*)native_script->invalid_before));
+  cardano_object_freeze((cardano_object_t*)((void*)native_script->pubkey));
+
+  cardano_native_script_list_t* scripts = NULL;
+
+  if (native_script->all != NULL)
+  {
+    cardano_object_freeze((cardano_object_t*)((void*)native_script->all));
+
+    if (cardano_script_all_get_scripts(native_script->all, &scripts) == CARDANO_SUCCESS)
+    {
+      freeze_native_script_list(scripts);
+    }
+  }
+  else if (native_script->any != NULL)
+  {
+    cardano_object_freeze((cardano_object_t*)((void*)native_script->any));
+
+    if (cardano_script_any_get_scripts(native_script->any, &scripts) == CARDANO_SUCCESS)
+    {
+      freeze_native_script_list(scripts);
+    }
+  }
+  else if (native_script->n_of_k != NULL)
+  {
+    cardano_object_freeze((cardano_object_t*)((void*)native_script->n_of_k));
+
+    if (cardano_script_n_of_k_get_scripts(native_script->n_of_k, &scripts) == CARDANO_SUCCESS)
+    {
+      freeze_native_script_list(scripts);
+    }
+  }
+
+  cardano_native_script_list_unref(&scripts);
+}
+
+/**
+ * \brief Computes the hash of a native script: BLAKE2b-224 of its CBOR encoding prefixed by the native script tag.
+ *
+ * \param native_script The script.
+ *
+ * \return A new reference to the hash, or NULL if it could not be computed.
+ */
+static cardano_blake2b_hash_t*
+compute_hash(const cardano_native_script_t* native_script)
+{
+  static const byte_t native_prefix = 0x00;
+
+  cardano_buffer_t*      hash_input = NULL;
+  cardano_cbor_writer_t* writer     = cardano_cbor_writer_new();
+
+  if (writer == NULL)
+  {
+    return NULL;
+  }
+
+  // The tag is a raw byte rather than a CBOR item, written ahead of the encoding so the preimage is built in one buffer.
+  cardano_error_t result = cardano_cbor_writer_write_encoded(writer, &native_prefix, sizeof(native_prefix));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_native_script_to_cbor(native_script, writer);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_encode_in_buffer(writer, &hash_input);
+  }
+
+  cardano_cbor_writer_unref(&writer);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return NULL;
+  }
+
+  cardano_blake2b_hash_t* hash = NULL;
+
+  result = cardano_blake2b_compute_hash(
+    cardano_buffer_get_data(hash_input),
+    cardano_buffer_get_size(hash_input),
+    CARDANO_BLAKE2B_HASH_SIZE_224,
+    &hash);
+
+  cardano_buffer_unref(&hash_input);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return NULL;
+  }
+
+  return hash;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -858,78 +998,14 @@ cardano_native_script_get_hash(
     return NULL;
   }
 
-  cardano_buffer_t*      cbor   = NULL;
-  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
-
-  if (writer == NULL)
-  {
-    return NULL;
-  }
-
-  cardano_error_t result = cardano_native_script_to_cbor(native_script, writer);
-
-  if (result != CARDANO_SUCCESS)
-  {
-    cardano_cbor_writer_unref(&writer);
-    return NULL;
-  }
-
-  result = cardano_cbor_writer_encode_in_buffer(writer, &cbor);
-
-  cardano_cbor_writer_unref(&writer);
-
-  if (result != CARDANO_SUCCESS)
-  {
-    return NULL;
-  }
-
-  cardano_blake2b_hash_t* hash = NULL;
-
-  static const byte_t native_prefix = 0x00;
-
-  cardano_buffer_t* hash_input = cardano_buffer_new(cardano_buffer_get_size(cbor) + 1U);
-
-  if (hash_input == NULL)
-  {
-    cardano_buffer_unref(&cbor);
-    return NULL;
-  }
-
-  cardano_error_t error = cardano_buffer_write(hash_input, &native_prefix, 1);
-
-  if (error != CARDANO_SUCCESS)
-  {
-    cardano_buffer_unref(&cbor);
-    cardano_buffer_unref(&hash_input);
-
-    return NULL;
-  }
-
-  error = cardano_buffer_write(hash_input, cardano_buffer_get_data(cbor), cardano_buffer_get_size(cbor));
-
-  cardano_buffer_unref(&cbor);
-
-  if (error != CARDANO_SUCCESS)
-  {
-    cardano_buffer_unref(&hash_input);
-
-    return NULL;
-  }
-
-  error = cardano_blake2b_compute_hash(
-    cardano_buffer_get_data(hash_input),
-    cardano_buffer_get_size(hash_input),
-    CARDANO_BLAKE2B_HASH_SIZE_224,
-    &hash);
-
-  cardano_buffer_unref(&hash_input);
-
-  if (error != CARDANO_SUCCESS)
+  // Only frozen scripts carry a cached hash: the scripts nested in a script that is not frozen can still change.
+  if (native_script->hash_cache != NULL)
   {
-    return NULL;
+    cardano_blake2b_hash_ref(native_script->hash_cache);
+    return native_script->hash_cache;
   }
 
-  return hash;
+  return compute_hash(native_script);
 }
 
 bool
@@ -986,6 +1062,32 @@ cardano_native_script_equals(
   return result;
 }
 
+void
+cardano_native_script_freeze(cardano_native_script_t* native_script)
+{
+  if ((native_script == NULL) || cardano_object_is_frozen(&native_script->base))
+  {
+    return;
+  }
+
+  freeze_native_script(native_script);
+
+  // The script can no longer change, so its hash is computed once here and served from the cache afterwards. Doing
+  // it before the script is shared keeps cardano_native_script_get_hash free of writes on frozen scripts.
+  native_script->hash_cache = compute_hash(native_script);
+}
+
+bool
+cardano_native_script_is_frozen(const cardano_native_script_t* native_script)
+{
+  if (native_script == NULL)
+  {
+    return false;
+  }
+
+  return cardano_object_is_frozen(&native_script->base);
+}
+
 void
 cardano_native_script_unref(cardano_native_script_t** native_script)
 {
@@ -1037,3 +1139,20 @@ cardano_native_script_get_last_error(const cardano_native_script_t* native_scrip
 {
   return cardano_object_get_last_error(&native_script->base);
 }
+
+void
+_cardano_native_script_add_footprint(const cardano_native_script_t* native_script, cardano_footprint_context_t* context)
+{
+  if ((native_script == NULL) || !_cardano_footprint_visit(context, &native_script->base, CARDANO_MEMORY_FOOTPRINT_TYPE_SCRIPT, sizeof(cardano_native_script_t)))
+  {
+    return;
+  }
+
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)native_script->all));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)native_script->any));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)native_script->invalid_after));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)native_script->invalid_before));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)native_script->n_of_k));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)native_script->pubkey));
+  _cardano_blake2b_hash_add_footprint(native_script->hash_cache, context);
+}
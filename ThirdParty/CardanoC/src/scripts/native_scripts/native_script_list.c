@@ -93,7 +93,7 @@ cardano_native_script_list_new(cardano_native_script_list_t** native_script_list
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_native_script_list_deallocate;
 
   list->array                   = cardano_array_new(128);
@@ -411,6 +411,11 @@ cardano_native_script_list_add(cardano_native_script_list_t* native_script_list,
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&native_script_list->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (element == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
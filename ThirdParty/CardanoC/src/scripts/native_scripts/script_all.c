@@ -103,7 +103,7 @@ cardano_script_all_new(cardano_native_script_list_t* native_scripts, cardano_scr
   cardano_native_script_list_ref(native_scripts);
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_script_all_deallocate;
   data->type               = CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_ALL_OF;
   data->scripts            = native_scripts;
@@ -315,6 +315,11 @@ cardano_script_all_set_scripts(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&script_all->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (list == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
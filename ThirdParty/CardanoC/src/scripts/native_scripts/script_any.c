@@ -102,7 +102,7 @@ cardano_script_any_new(cardano_native_script_list_t* native_scripts, cardano_scr
   cardano_native_script_list_ref(native_scripts);
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_script_any_deallocate;
   data->type               = CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_ANY_OF;
   data->scripts            = native_scripts;
@@ -311,6 +311,11 @@ cardano_script_any_set_scripts(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&script_any->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (list == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -96,7 +96,7 @@ cardano_script_invalid_after_new(const uint64_t slot, cardano_script_invalid_aft
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_script_invalid_after_deallocate;
   data->type               = CARDANO_NATIVE_SCRIPT_TYPE_INVALID_AFTER;
   data->slot               = slot;
@@ -297,6 +297,11 @@ cardano_script_invalid_after_set_slot(cardano_script_invalid_after_t* script_inv
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&script_invalid_after->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   script_invalid_after->slot = slot;
 
   return CARDANO_SUCCESS;
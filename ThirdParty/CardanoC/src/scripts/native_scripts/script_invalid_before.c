@@ -95,7 +95,7 @@ cardano_script_invalid_before_new(const uint64_t slot, cardano_script_invalid_be
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_script_invalid_before_deallocate;
   data->type               = CARDANO_NATIVE_SCRIPT_TYPE_INVALID_BEFORE;
   data->slot               = slot;
@@ -295,6 +295,11 @@ cardano_script_invalid_before_set_slot(cardano_script_invalid_before_t* script_i
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&script_invalid_before->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   script_invalid_before->slot = slot;
 
   return CARDANO_SUCCESS;
@@ -101,7 +101,7 @@ cardano_script_n_of_k_new(cardano_native_script_list_t* native_scripts, const si
   cardano_native_script_list_ref(native_scripts);
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_script_n_of_k_deallocate;
   data->type               = CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_N_OF_K;
   data->scripts            = native_scripts;
@@ -327,6 +327,11 @@ cardano_script_n_of_k_set_required(cardano_script_n_of_k_t* script_n_of_k, size_
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&script_n_of_k->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   script_n_of_k->required = required;
 
   return CARDANO_SUCCESS;
@@ -375,6 +380,11 @@ cardano_script_n_of_k_set_scripts(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&script_n_of_k->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (list == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -104,7 +104,7 @@ cardano_script_pubkey_new(cardano_blake2b_hash_t* key_hash, cardano_script_pubke
   cardano_blake2b_hash_ref(key_hash);
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_script_pubkey_deallocate;
   data->type               = CARDANO_NATIVE_SCRIPT_TYPE_REQUIRE_PUBKEY;
   data->key_hash           = key_hash;
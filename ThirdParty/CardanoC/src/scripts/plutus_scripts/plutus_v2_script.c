@@ -28,6 +28,7 @@
 #include <cardano/scripts/plutus_scripts/plutus_v2_script.h>
 
 #include "../../allocators.h"
+#include "../../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
@@ -39,8 +40,9 @@
  */
 typedef struct cardano_plutus_v2_script_t
 {
-    cardano_object_t  base;
-    cardano_buffer_t* compiled_code;
+    cardano_object_t        base;
+    cardano_buffer_t*       compiled_code;
+    cardano_blake2b_hash_t* hash_cache;
 } cardano_plutus_v2_script_t;
 
 /* STATIC FUNCTIONS **********************************************************/
@@ -66,6 +68,7 @@ cardano_plutus_v2_script_deallocate(void* object)
   cardano_plutus_v2_script_t* data = (cardano_plutus_v2_script_t*)object;
 
   cardano_buffer_unref(&data->compiled_code);
+  cardano_blake2b_hash_unref(&data->hash_cache);
 
   _cardano_free(data);
 }
@@ -86,9 +89,10 @@ cardano_plutus_v2_script_new(void)
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_plutus_v2_script_deallocate;
   data->compiled_code      = cardano_buffer_new(128);
+  data->hash_cache         = NULL;
 
   if (data->compiled_code == NULL)
   {
@@ -99,6 +103,61 @@ cardano_plutus_v2_script_new(void)
   return data;
 }
 
+/**
+ * \brief Computes the hash of a plutus v2 script.
+ *
+ * \param[in] plutus_v2_script The script.
+ *
+ * \return A new reference to the hash, or NULL if it could not be computed.
+ */
+static cardano_blake2b_hash_t*
+compute_hash(const cardano_plutus_v2_script_t* plutus_v2_script)
+{
+  cardano_blake2b_hash_t* hash = NULL;
+
+  // To compute a script hash, note that you must prepend a tag to the bytes of
+  // the script before hashing. The tags in the Babbage era for PlutusV2 is "\x02"
+  static const byte_t plutus_v2_prefix = 0x02;
+
+  cardano_buffer_t* hash_input = cardano_buffer_new(cardano_buffer_get_size(plutus_v2_script->compiled_code) + 1U);
+
+  if (hash_input == NULL)
+  {
+    return NULL;
+  }
+
+  cardano_error_t error = cardano_buffer_write(hash_input, &plutus_v2_prefix, 1);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    cardano_buffer_unref(&hash_input);
+    return NULL;
+  }
+
+  error = cardano_buffer_write(hash_input, cardano_buffer_get_data(plutus_v2_script->compiled_code), cardano_buffer_get_size(plutus_v2_script->compiled_code));
+
+  if (error != CARDANO_SUCCESS)
+  {
+    cardano_buffer_unref(&hash_input);
+    return NULL;
+  }
+
+  error = cardano_blake2b_compute_hash(
+    cardano_buffer_get_data(hash_input),
+    cardano_buffer_get_size(hash_input),
+    CARDANO_BLAKE2B_HASH_SIZE_224,
+    &hash);
+
+  cardano_buffer_unref(&hash_input);
+
+  if (error != CARDANO_SUCCESS)
+  {
+    return NULL;
+  }
+
+  return hash;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -276,46 +335,23 @@ cardano_plutus_v2_script_get_hash(const cardano_plutus_v2_script_t* plutus_v2_sc
     return NULL;
   }
 
-  cardano_blake2b_hash_t* hash = NULL;
-
-  // To compute a script hash, note that you must prepend a tag to the bytes of
-  // the script before hashing. The tags in the Babbage era for PlutusV2 is "\x02"
-  static const byte_t plutus_v2_prefix = 0x02;
-
-  cardano_buffer_t* hash_input = cardano_buffer_new((size_t)CARDANO_BLAKE2B_HASH_SIZE_224 + 1U);
-
-  if (hash_input == NULL)
+  if (plutus_v2_script->hash_cache != NULL)
   {
-    return NULL;
+    cardano_blake2b_hash_ref(plutus_v2_script->hash_cache);
+    return plutus_v2_script->hash_cache;
   }
 
-  cardano_error_t error = cardano_buffer_write(hash_input, &plutus_v2_prefix, 1);
+  cardano_blake2b_hash_t* hash = compute_hash(plutus_v2_script);
 
-  if (error != CARDANO_SUCCESS)
+  // The compiled code never changes, so the hash is kept for later calls. Frozen scripts may be read from several
+  // threads and are never written to; cardano_script_freeze fills their cache before freezing them.
+  if ((hash != NULL) && !cardano_object_is_frozen(&plutus_v2_script->base))
   {
-    cardano_buffer_unref(&hash_input);
-    return NULL;
-  }
+    // cppcheck-suppress misra-c2012-11.8; Reason: The hash cache is not part of the value of the script.
+    cardano_plutus_v2_script_t* script = (cardano_plutus_v2_script_t*)((void*)plutus_v2_script);
 
-  error = cardano_buffer_write(hash_input, cardano_buffer_get_data(plutus_v2_script->compiled_code), cardano_buffer_get_size(plutus_v2_script->compiled_code));
-
-  if (error != CARDANO_SUCCESS)
-  {
-    cardano_buffer_unref(&hash_input);
-    return NULL;
-  }
-
-  error = cardano_blake2b_compute_hash(
-    cardano_buffer_get_data(hash_input),
-    cardano_buffer_get_size(hash_input),
-    CARDANO_BLAKE2B_HASH_SIZE_224,
-    &hash);
-
-  cardano_buffer_unref(&hash_input);
-
-  if (error != CARDANO_SUCCESS)
-  {
-    return NULL;
+    cardano_blake2b_hash_ref(hash);
+    script->hash_cache = hash;
   }
 
   return hash;
@@ -383,3 +419,15 @@ cardano_plutus_v2_script_get_last_error(const cardano_plutus_v2_script_t* plutus
 {
   return cardano_object_get_last_error(&plutus_v2_script->base);
 }
+
+void
+_cardano_plutus_v2_script_add_footprint(const cardano_plutus_v2_script_t* script, cardano_footprint_context_t* context)
+{
+  if ((script == NULL) || !_cardano_footprint_visit(context, &script->base, CARDANO_MEMORY_FOOTPRINT_TYPE_SCRIPT, sizeof(cardano_plutus_v2_script_t)))
+  {
+    return;
+  }
+
+  _cardano_buffer_add_footprint(script->compiled_code, context);
+  _cardano_blake2b_hash_add_footprint(script->hash_cache, context);
+}
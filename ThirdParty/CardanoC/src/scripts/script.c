@@ -32,6 +32,7 @@
 
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
@@ -101,7 +102,7 @@ cardano_script_new(void)
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_script_deallocate;
 
   data->native_script    = NULL;
@@ -609,6 +610,41 @@ cardano_script_equals(const cardano_script_t* lhs, const cardano_script_t* rhs)
   return result;
 }
 
+void
+cardano_script_freeze(cardano_script_t* script)
+{
+  if (script == NULL)
+  {
+    return;
+  }
+
+  if (script->language != CARDANO_SCRIPT_LANGUAGE_NATIVE)
+  {
+    // Plutus scripts cache their hash on first use, which they no longer do once frozen, so fill the cache now.
+    cardano_blake2b_hash_t* hash = cardano_script_get_hash(script);
+    cardano_blake2b_hash_unref(&hash);
+  }
+
+  cardano_object_freeze(&script->base);
+
+  cardano_native_script_freeze(script->native_script);
+
+  cardano_object_freeze((cardano_object_t*)((void*)script->plutus_v1_script));
+  cardano_object_freeze((cardano_object_t*)((void*)script->plutus_v2_script));
+  cardano_object_freeze((cardano_object_t*)((void*)script->plutus_v3_script));
+}
+
+bool
+cardano_script_is_frozen(const cardano_script_t* script)
+{
+  if (script == NULL)
+  {
+    return false;
+  }
+
+  return cardano_object_is_frozen(&script->base);
+}
+
 void
 cardano_script_unref(cardano_script_t** script)
 {
@@ -660,3 +696,17 @@ cardano_script_get_last_error(const cardano_script_t* script)
 {
   return cardano_object_get_last_error(&script->base);
 }
+
+void
+_cardano_script_add_footprint(const cardano_script_t* script, cardano_footprint_context_t* context)
+{
+  if ((script == NULL) || !_cardano_footprint_visit(context, &script->base, CARDANO_MEMORY_FOOTPRINT_TYPE_SCRIPT, sizeof(cardano_script_t)))
+  {
+    return;
+  }
+
+  _cardano_native_script_add_footprint(script->native_script, context);
+  _cardano_plutus_v1_script_add_footprint(script->plutus_v1_script, context);
+  _cardano_plutus_v2_script_add_footprint(script->plutus_v2_script, context);
+  _cardano_plutus_v3_script_add_footprint(script->plutus_v3_script, context);
+}
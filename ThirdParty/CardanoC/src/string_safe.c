@@ -31,6 +31,89 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+static const char DIGIT_PAIRS[] = // cppcheck-suppress misra-c2012-8.9
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Counts the decimal digits of an unsigned integer.
+ *
+ * \param[in] value The value.
+ *
+ * \return The number of digits, between 1 and 20.
+ */
+static size_t
+count_digits(uint64_t value)
+{
+  size_t digits = 1U;
+
+  while (value >= 10000U)
+  {
+    value /= 10000U;
+    digits += 4U;
+  }
+
+  if (value >= 1000U)
+  {
+    return digits + 3U;
+  }
+
+  if (value >= 100U)
+  {
+    return digits + 2U;
+  }
+
+  return (value >= 10U) ? (digits + 1U) : digits;
+}
+
+/**
+ * \brief Writes the decimal digits of an unsigned integer, two at a time, without a null terminator.
+ *
+ * \param[in] value The value.
+ * \param[out] buffer The destination, which must have room for \p digits characters.
+ * \param[in] digits The number of digits of \p value, as returned by \ref count_digits.
+ */
+static void
+write_digits(uint64_t value, char* buffer, const size_t digits)
+{
+  size_t position = digits;
+
+  while (value >= 100U)
+  {
+    const size_t pair = (size_t)(value % 100U) * 2U;
+
+    value /= 100U;
+    position -= 2U;
+
+    buffer[position]      = DIGIT_PAIRS[pair];
+    buffer[position + 1U] = DIGIT_PAIRS[pair + 1U];
+  }
+
+  if (value >= 10U)
+  {
+    const size_t pair = (size_t)value * 2U;
+
+    buffer[0] = DIGIT_PAIRS[pair];
+    buffer[1] = DIGIT_PAIRS[pair + 1U];
+  }
+  else
+  {
+    buffer[0] = (char)('0' + (char)value);
+  }
+}
+
 /* DEFINITIONS ***************************************************************/
 
 void
@@ -72,14 +155,25 @@ cardano_safe_int64_to_string(const int64_t value, char* buffer, size_t buffer_si
     return 0U;
   }
 
-  int written = snprintf(buffer, buffer_size, "%lld", (long long)value);
+  const bool     is_negative = (value < 0);
+  const uint64_t magnitude   = is_negative ? ((uint64_t)0 - (uint64_t)value) : (uint64_t)value;
+  const size_t   sign_size   = is_negative ? 1U : 0U;
+  const size_t   digits      = count_digits(magnitude);
 
-  if ((written < 0) || ((size_t)written >= buffer_size))
+  if ((sign_size + digits) >= buffer_size)
   {
     return 0U;
   }
 
-  return (size_t)written;
+  if (is_negative)
+  {
+    buffer[0] = '-';
+  }
+
+  write_digits(magnitude, &buffer[sign_size], digits);
+  buffer[sign_size + digits] = '\0';
+
+  return sign_size + digits;
 }
 
 cardano_error_t
@@ -132,14 +226,17 @@ cardano_safe_uint64_to_string(const uint64_t value, char* buffer, size_t buffer_
     return 0U;
   }
 
-  int written = snprintf(buffer, buffer_size, "%llu", (unsigned long long)value);
+  const size_t digits = count_digits(value);
 
-  if ((written < 0) || ((size_t)written >= buffer_size))
+  if (digits >= buffer_size)
   {
     return 0U;
   }
 
-  return (size_t)written;
+  write_digits(value, buffer, digits);
+  buffer[digits] = '\0';
+
+  return digits;
 }
 
 cardano_error_t
@@ -211,4 +211,37 @@ cardano_compute_epoch_from_unix_time(const cardano_network_magic_t magic, uint64
   const uint64_t epoch       = (time_passed / 1000U / config.epoch_length) + config.start_epoch;
 
   return epoch;
-}
\ No newline at end of file
+}
+
+uint64_t
+cardano_compute_unix_time_from_epoch(const cardano_network_magic_t magic, const uint64_t epoch)
+{
+  cardano_slot_config_t config = { 0U };
+
+  switch (magic)
+  {
+    case CARDANO_NETWORK_MAGIC_MAINNET:
+      config = MAINNET_SLOT_CONFIG;
+      break;
+    case CARDANO_NETWORK_MAGIC_PREVIEW:
+      config = PREVIEW_SLOT_CONFIG;
+      break;
+    case CARDANO_NETWORK_MAGIC_PREPROD:
+      config = PREPROD_SLOT_CONFIG;
+      break;
+    default:
+    {
+      config = TESTNET_SLOT_CONFIG;
+    }
+  }
+
+  if (config.epoch_length == 0U)
+  {
+    return UINT64_MAX;
+  }
+
+  // Earlier epochs ran with other slot lengths, which the configuration does not describe
+  const uint64_t epochs_passed = (epoch > config.start_epoch) ? (epoch - config.start_epoch) : 0U;
+
+  return (config.zero_time + (epochs_passed * config.epoch_length * config.slot_length)) / 1000U;
+}
@@ -21,11 +21,13 @@
 
 /* INCLUDES ******************************************************************/
 
+#include <cardano/cbor/cbor_well_formed.h>
 #include <cardano/object.h>
 #include <cardano/transaction/transaction.h>
 
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
 
 #include <assert.h>
@@ -35,6 +37,14 @@
 
 static const int64_t ALONZO_ERA_FRAME_SIZE = 4;
 
+enum
+{
+  PARALLEL_PART_BODY           = 0,
+  PARALLEL_PART_WITNESS_SET    = 1,
+  PARALLEL_PART_AUXILIARY_DATA = 2,
+  PARALLEL_PART_COUNT          = 3
+};
+
 /* STRUCTURES ****************************************************************/
 
 /**
@@ -45,10 +55,171 @@ typedef struct cardano_transaction_t
     cardano_object_t            base;
     cardano_transaction_body_t* body;
     cardano_witness_set_t*      witness_set;
+    cardano_buffer_t*           witness_set_cbor;
     cardano_auxiliary_data_t*   auxiliary_data;
+    cardano_buffer_t*           auxiliary_data_cbor;
     bool                        is_valid;
 } cardano_transaction_t;
 
+/**
+ * \brief How a field name of \ref cardano_transaction_seek maps to the encoding.
+ */
+typedef enum
+{
+  /**
+   * \brief The field is the element at the given key or index.
+   */
+  FIELD_KIND_KEY = 0,
+
+  /**
+   * \brief A field of the transaction array after the witness set, one index lower in pre-Alonzo transactions,
+   * which have no validity flag.
+   */
+  FIELD_KIND_TRAILING = 1,
+
+  /**
+   * \brief The metadata of auxiliary data: the auxiliary data itself in the Shelley format, and its first element
+   * in the later ones.
+   */
+  FIELD_KIND_METADATA = 2
+} field_kind_t;
+
+/**
+ * \brief A named field of \ref cardano_transaction_seek. Tables of fields end with a NULL name.
+ */
+typedef struct field_name_t
+{
+    /**
+     * \brief The name of the field.
+     */
+    const char* name;
+
+    /**
+     * \brief The key or index of the field.
+     */
+    uint64_t key;
+
+    /**
+     * \brief How the key applies.
+     */
+    field_kind_t kind;
+
+    /**
+     * \brief The names of the fields of the field, or of its elements for a list, or NULL.
+     */
+    const struct field_name_t* fields;
+} field_name_t;
+
+/**
+ * \brief The parts of a transaction decoded by \ref cardano_transaction_from_cbor_parallel, one per task.
+ */
+typedef struct parallel_decode_t
+{
+    /**
+     * \brief The encoding of each part, pointing into the input of the transaction reader.
+     */
+    const byte_t* data[PARALLEL_PART_COUNT];
+
+    /**
+     * \brief The size in bytes of the encoding of each part, or zero for absent auxiliary data.
+     */
+    size_t size[PARALLEL_PART_COUNT];
+
+    /**
+     * \brief The reader of each part, kept until the tasks completed so their last error can be read.
+     */
+    cardano_cbor_reader_t* readers[PARALLEL_PART_COUNT];
+
+    /**
+     * \brief The result of decoding each part.
+     */
+    cardano_error_t results[PARALLEL_PART_COUNT];
+
+    /**
+     * \brief The decoded body.
+     */
+    cardano_transaction_body_t* body;
+
+    /**
+     * \brief The decoded witness set.
+     */
+    cardano_witness_set_t* witness_set;
+
+    /**
+     * \brief The decoded auxiliary data, or NULL if absent.
+     */
+    cardano_auxiliary_data_t* auxiliary_data;
+} parallel_decode_t;
+
+static const field_name_t INPUT_FIELDS[] = {
+  { "transaction_id", 0U, FIELD_KIND_KEY, NULL },
+  { "index", 1U, FIELD_KIND_KEY, NULL },
+  { NULL, 0U, FIELD_KIND_KEY, NULL }
+};
+
+static const field_name_t OUTPUT_FIELDS[] = {
+  { "address", 0U, FIELD_KIND_KEY, NULL },
+  { "amount", 1U, FIELD_KIND_KEY, NULL },
+  { "value", 1U, FIELD_KIND_KEY, NULL },
+  { "datum", 2U, FIELD_KIND_KEY, NULL },
+  { "script_ref", 3U, FIELD_KIND_KEY, NULL },
+  { NULL, 0U, FIELD_KIND_KEY, NULL }
+};
+
+static const field_name_t BODY_FIELDS[] = {
+  { "inputs", 0U, FIELD_KIND_KEY, INPUT_FIELDS },
+  { "outputs", 1U, FIELD_KIND_KEY, OUTPUT_FIELDS },
+  { "fee", 2U, FIELD_KIND_KEY, NULL },
+  { "invalid_after", 3U, FIELD_KIND_KEY, NULL },
+  { "certificates", 4U, FIELD_KIND_KEY, NULL },
+  { "withdrawals", 5U, FIELD_KIND_KEY, NULL },
+  { "update", 6U, FIELD_KIND_KEY, NULL },
+  { "aux_data_hash", 7U, FIELD_KIND_KEY, NULL },
+  { "invalid_before", 8U, FIELD_KIND_KEY, NULL },
+  { "mint", 9U, FIELD_KIND_KEY, NULL },
+  { "script_data_hash", 11U, FIELD_KIND_KEY, NULL },
+  { "collateral", 13U, FIELD_KIND_KEY, INPUT_FIELDS },
+  { "required_signers", 14U, FIELD_KIND_KEY, NULL },
+  { "network_id", 15U, FIELD_KIND_KEY, NULL },
+  { "collateral_return", 16U, FIELD_KIND_KEY, OUTPUT_FIELDS },
+  { "total_collateral", 17U, FIELD_KIND_KEY, NULL },
+  { "reference_inputs", 18U, FIELD_KIND_KEY, INPUT_FIELDS },
+  { "voting_procedures", 19U, FIELD_KIND_KEY, NULL },
+  { "proposal_procedures", 20U, FIELD_KIND_KEY, NULL },
+  { "treasury_value", 21U, FIELD_KIND_KEY, NULL },
+  { "donation", 22U, FIELD_KIND_KEY, NULL },
+  { NULL, 0U, FIELD_KIND_KEY, NULL }
+};
+
+static const field_name_t WITNESS_SET_FIELDS[] = {
+  { "vkeys", 0U, FIELD_KIND_KEY, NULL },
+  { "native_scripts", 1U, FIELD_KIND_KEY, NULL },
+  { "bootstrap", 2U, FIELD_KIND_KEY, NULL },
+  { "plutus_v1_scripts", 3U, FIELD_KIND_KEY, NULL },
+  { "plutus_data", 4U, FIELD_KIND_KEY, NULL },
+  { "redeemers", 5U, FIELD_KIND_KEY, NULL },
+  { "plutus_v2_scripts", 6U, FIELD_KIND_KEY, NULL },
+  { "plutus_v3_scripts", 7U, FIELD_KIND_KEY, NULL },
+  { NULL, 0U, FIELD_KIND_KEY, NULL }
+};
+
+static const field_name_t AUXILIARY_DATA_FIELDS[] = {
+  { "metadata", 0U, FIELD_KIND_METADATA, NULL },
+  { "native_scripts", 1U, FIELD_KIND_KEY, NULL },
+  { "plutus_v1_scripts", 2U, FIELD_KIND_KEY, NULL },
+  { "plutus_v2_scripts", 3U, FIELD_KIND_KEY, NULL },
+  { "plutus_v3_scripts", 4U, FIELD_KIND_KEY, NULL },
+  { NULL, 0U, FIELD_KIND_KEY, NULL }
+};
+
+static const field_name_t TRANSACTION_FIELDS[] = {
+  { "body", 0U, FIELD_KIND_KEY, BODY_FIELDS },
+  { "witness_set", 1U, FIELD_KIND_KEY, WITNESS_SET_FIELDS },
+  { "is_valid", 2U, FIELD_KIND_TRAILING, NULL },
+  { "auxiliary_data", 3U, FIELD_KIND_TRAILING, AUXILIARY_DATA_FIELDS },
+  { NULL, 0U, FIELD_KIND_KEY, NULL }
+};
+
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
@@ -73,11 +244,567 @@ cardano_transaction_deallocate(void* object)
 
   cardano_transaction_body_unref(&transaction->body);
   cardano_witness_set_unref(&transaction->witness_set);
+  cardano_buffer_unref(&transaction->witness_set_cbor);
   cardano_auxiliary_data_unref(&transaction->auxiliary_data);
+  cardano_buffer_unref(&transaction->auxiliary_data_cbor);
 
   _cardano_free(object);
 }
 
+/**
+ * \brief Allocates a transaction object.
+ *
+ * The witness set and the auxiliary data can each be given either decoded or as their retained CBOR encoding, which
+ * is decoded on first access.
+ *
+ * \param body The transaction body.
+ * \param witness_set The decoded witness set, or NULL if `witness_set_cbor` is given.
+ * \param witness_set_cbor The encoded witness set, or NULL if `witness_set` is given.
+ * \param auxiliary_data The decoded auxiliary data, or NULL.
+ * \param auxiliary_data_cbor The encoded auxiliary data, or NULL.
+ * \param transaction On success, the new transaction object.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+create_transaction(
+  cardano_transaction_body_t* body,
+  cardano_witness_set_t*      witness_set,
+  cardano_buffer_t*           witness_set_cbor,
+  cardano_auxiliary_data_t*   auxiliary_data,
+  cardano_buffer_t*           auxiliary_data_cbor,
+  cardano_transaction_t**     transaction)
+{
+  *transaction = _cardano_malloc(sizeof(cardano_transaction_t));
+
+  if (*transaction == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  (*transaction)->base.deallocator    = cardano_transaction_deallocate;
+  (*transaction)->base.ref_count      = 1;
+  (*transaction)->base.last_error     = NULL;
+  (*transaction)->body                = body;
+  (*transaction)->witness_set         = witness_set;
+  (*transaction)->witness_set_cbor    = witness_set_cbor;
+  (*transaction)->auxiliary_data      = auxiliary_data;
+  (*transaction)->auxiliary_data_cbor = auxiliary_data_cbor;
+  (*transaction)->is_valid            = true;
+
+  cardano_transaction_body_ref(body);
+  cardano_witness_set_ref(witness_set);
+  cardano_buffer_ref(witness_set_cbor);
+  cardano_auxiliary_data_ref(auxiliary_data);
+  cardano_buffer_ref(auxiliary_data_cbor);
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Decodes the witness set retained by \ref cardano_transaction_from_cbor_lazy, if it was not decoded yet.
+ *
+ * On failure the retained encoding is kept and the reason is recorded as the last error of the transaction.
+ *
+ * \param transaction The transaction whose witness set is needed.
+ *
+ * \return \ref CARDANO_SUCCESS if the witness set is decoded, or the decoding error.
+ */
+static cardano_error_t
+decode_witness_set(cardano_transaction_t* transaction)
+{
+  if (transaction->witness_set_cbor == NULL)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(
+    cardano_buffer_get_data(transaction->witness_set_cbor),
+    cardano_buffer_get_size(transaction->witness_set_cbor));
+
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_witness_set_t* witness_set = NULL;
+  cardano_error_t        result      = cardano_witness_set_from_cbor(reader, &witness_set);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_transaction_set_last_error(transaction, cardano_cbor_reader_get_last_error(reader));
+    cardano_cbor_reader_unref(&reader);
+
+    return result;
+  }
+
+  cardano_cbor_reader_unref(&reader);
+  cardano_buffer_unref(&transaction->witness_set_cbor);
+
+  transaction->witness_set = witness_set;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Decodes the auxiliary data retained by \ref cardano_transaction_from_cbor_lazy, if it was not decoded yet.
+ *
+ * On failure the retained encoding is kept and the reason is recorded as the last error of the transaction.
+ *
+ * \param transaction The transaction whose auxiliary data is needed.
+ *
+ * \return \ref CARDANO_SUCCESS if the auxiliary data is decoded (or absent), or the decoding error.
+ */
+static cardano_error_t
+decode_auxiliary_data(cardano_transaction_t* transaction)
+{
+  if (transaction->auxiliary_data_cbor == NULL)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_cbor_reader_t* reader = cardano_cbor_reader_from_view(
+    cardano_buffer_get_data(transaction->auxiliary_data_cbor),
+    cardano_buffer_get_size(transaction->auxiliary_data_cbor));
+
+  if (reader == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_auxiliary_data_t* auxiliary_data = NULL;
+  cardano_error_t           result         = cardano_auxiliary_data_from_cbor(reader, &auxiliary_data);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_transaction_set_last_error(transaction, cardano_cbor_reader_get_last_error(reader));
+    cardano_cbor_reader_unref(&reader);
+
+    return result;
+  }
+
+  cardano_cbor_reader_unref(&reader);
+  cardano_buffer_unref(&transaction->auxiliary_data_cbor);
+
+  transaction->auxiliary_data      = auxiliary_data;
+  transaction->auxiliary_data_cbor = NULL;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Reads the witness set of a transaction, either decoding it or retaining its encoding.
+ *
+ * \param reader The reader positioned at the witness set.
+ * \param lazy Whether to retain the encoding instead of decoding it.
+ * \param witness_set On success, the decoded witness set when `lazy` is false.
+ * \param witness_set_cbor On success, the encoded witness set when `lazy` is true.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the decoding error.
+ */
+static cardano_error_t
+read_witness_set(
+  cardano_cbor_reader_t*  reader,
+  const bool              lazy,
+  cardano_witness_set_t** witness_set,
+  cardano_buffer_t**      witness_set_cbor)
+{
+  if (lazy)
+  {
+    return cardano_cbor_reader_read_encoded_value(reader, witness_set_cbor);
+  }
+
+  return cardano_witness_set_from_cbor(reader, witness_set);
+}
+
+/**
+ * \brief Reads the auxiliary data of a transaction, either decoding it or retaining its encoding.
+ *
+ * Absent auxiliary data (encoded as null) leaves both outputs NULL.
+ *
+ * \param reader The reader positioned at the auxiliary data.
+ * \param lazy Whether to retain the encoding instead of decoding it.
+ * \param auxiliary_data On success, the decoded auxiliary data when `lazy` is false.
+ * \param auxiliary_data_cbor On success, the encoded auxiliary data when `lazy` is true.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the decoding error.
+ */
+static cardano_error_t
+read_auxiliary_data(
+  cardano_cbor_reader_t*     reader,
+  const bool                 lazy,
+  cardano_auxiliary_data_t** auxiliary_data,
+  cardano_buffer_t**         auxiliary_data_cbor)
+{
+  cardano_cbor_reader_state_t state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+
+  cardano_error_t result = cardano_cbor_reader_peek_state(reader, &state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (state == CARDANO_CBOR_READER_STATE_NULL)
+  {
+    return cardano_cbor_reader_read_null(reader);
+  }
+
+  if (lazy)
+  {
+    return cardano_cbor_reader_read_encoded_value(reader, auxiliary_data_cbor);
+  }
+
+  return cardano_auxiliary_data_from_cbor(reader, auxiliary_data);
+}
+
+/**
+ * \brief Decodes a transaction, optionally retaining the encoding of its witness set and auxiliary data.
+ *
+ * \param reader The reader positioned at the transaction.
+ * \param lazy Whether to defer decoding the witness set and the auxiliary data until they are accessed.
+ * \param transaction On success, the decoded transaction.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the decoding error.
+ */
+static cardano_error_t
+transaction_from_cbor(cardano_cbor_reader_t* reader, const bool lazy, cardano_transaction_t** transaction)
+{
+  if (transaction == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (reader == NULL)
+  {
+    *transaction = NULL;
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  static const char* validator_name = "transaction";
+
+  int64_t array_size = 0U;
+
+  cardano_error_t result = cardano_cbor_reader_read_start_array(reader, &array_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    *transaction = NULL;
+    return result;
+  }
+
+  cardano_transaction_body_t* body                = NULL;
+  cardano_witness_set_t*      witness_set         = NULL;
+  cardano_buffer_t*           witness_set_cbor    = NULL;
+  cardano_auxiliary_data_t*   auxiliary_data      = NULL;
+  cardano_buffer_t*           auxiliary_data_cbor = NULL;
+  bool                        is_valid            = true;
+
+  cardano_error_t body_result = cardano_transaction_body_from_cbor(reader, &body);
+
+  if (body_result != CARDANO_SUCCESS)
+  {
+    *transaction = NULL;
+    return body_result;
+  }
+
+  cardano_error_t witness_set_result = read_witness_set(reader, lazy, &witness_set, &witness_set_cbor);
+
+  if (witness_set_result != CARDANO_SUCCESS)
+  {
+    cardano_transaction_body_unref(&body);
+    *transaction = NULL;
+    return witness_set_result;
+  }
+
+  if (array_size == ALONZO_ERA_FRAME_SIZE)
+  {
+    cardano_error_t read_bool_result = cardano_cbor_reader_read_bool(reader, &is_valid);
+
+    if (read_bool_result != CARDANO_SUCCESS)
+    {
+      cardano_transaction_body_unref(&body);
+      cardano_witness_set_unref(&witness_set);
+      cardano_buffer_unref(&witness_set_cbor);
+      *transaction = NULL;
+
+      return read_bool_result;
+    }
+  }
+
+  cardano_error_t auxiliary_data_result = read_auxiliary_data(reader, lazy, &auxiliary_data, &auxiliary_data_cbor);
+
+  if (auxiliary_data_result != CARDANO_SUCCESS)
+  {
+    cardano_transaction_body_unref(&body);
+    cardano_witness_set_unref(&witness_set);
+    cardano_buffer_unref(&witness_set_cbor);
+    *transaction = NULL;
+
+    return auxiliary_data_result;
+  }
+
+  const cardano_error_t expect_end_array_result = cardano_cbor_validate_end_array(validator_name, reader);
+
+  if (expect_end_array_result != CARDANO_SUCCESS)
+  {
+    *transaction = NULL;
+
+    cardano_transaction_body_unref(&body);
+    cardano_witness_set_unref(&witness_set);
+    cardano_buffer_unref(&witness_set_cbor);
+    cardano_auxiliary_data_unref(&auxiliary_data);
+    cardano_buffer_unref(&auxiliary_data_cbor);
+
+    return expect_end_array_result;
+  }
+
+  cardano_error_t create_instance_result = create_transaction(
+    body,
+    witness_set,
+    witness_set_cbor,
+    auxiliary_data,
+    auxiliary_data_cbor,
+    transaction);
+
+  cardano_transaction_body_unref(&body);
+  cardano_witness_set_unref(&witness_set);
+  cardano_buffer_unref(&witness_set_cbor);
+  cardano_auxiliary_data_unref(&auxiliary_data);
+  cardano_buffer_unref(&auxiliary_data_cbor);
+
+  if (create_instance_result != CARDANO_SUCCESS)
+  {
+    *transaction = NULL;
+    return create_instance_result;
+  }
+
+  (*transaction)->is_valid = is_valid;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Decodes one part of a transaction, as a task of \ref cardano_transaction_from_cbor_parallel.
+ *
+ * Each task only touches its own slots of the state, so the tasks can run concurrently.
+ *
+ * \param data The \ref parallel_decode_t of the transaction.
+ * \param index The part to decode.
+ */
+static void
+decode_part(void* data, const size_t index)
+{
+  parallel_decode_t* state = (parallel_decode_t*)data;
+
+  if ((index >= PARALLEL_PART_COUNT) || (state->size[index] == 0U))
+  {
+    return;
+  }
+
+  state->readers[index] = cardano_cbor_reader_from_view(state->data[index], state->size[index]);
+
+  if (state->readers[index] == NULL)
+  {
+    state->results[index] = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    return;
+  }
+
+  switch (index)
+  {
+    case PARALLEL_PART_BODY:
+      state->results[index] = cardano_transaction_body_from_cbor(state->readers[index], &state->body);
+      break;
+    case PARALLEL_PART_WITNESS_SET:
+      state->results[index] = cardano_witness_set_from_cbor(state->readers[index], &state->witness_set);
+      break;
+    default:
+      state->results[index] = cardano_auxiliary_data_from_cbor(state->readers[index], &state->auxiliary_data);
+      break;
+  }
+}
+
+/**
+ * \brief Locates the parts of a transaction without decoding them.
+ *
+ * \param reader The reader positioned at the transaction.
+ * \param state On success, the encoding of each part.
+ * \param is_valid On success, the validity flag of the transaction.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the decoding error.
+ */
+static cardano_error_t
+split_transaction(cardano_cbor_reader_t* reader, parallel_decode_t* state, bool* is_valid)
+{
+  static const char* validator_name = "transaction";
+
+  int64_t array_size = 0U;
+
+  cardano_error_t result = cardano_cbor_reader_read_start_array(reader, &array_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_cbor_reader_read_encoded_value_view(
+    reader,
+    &state->data[PARALLEL_PART_BODY],
+    &state->size[PARALLEL_PART_BODY]);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_cbor_reader_read_encoded_value_view(
+    reader,
+    &state->data[PARALLEL_PART_WITNESS_SET],
+    &state->size[PARALLEL_PART_WITNESS_SET]);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (array_size == ALONZO_ERA_FRAME_SIZE)
+  {
+    result = cardano_cbor_reader_read_bool(reader, is_valid);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  cardano_cbor_reader_state_t reader_state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+
+  result = cardano_cbor_reader_peek_state(reader, &reader_state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (reader_state == CARDANO_CBOR_READER_STATE_NULL)
+  {
+    result = cardano_cbor_reader_read_null(reader);
+  }
+  else
+  {
+    result = cardano_cbor_reader_read_encoded_value_view(
+      reader,
+      &state->data[PARALLEL_PART_AUXILIARY_DATA],
+      &state->size[PARALLEL_PART_AUXILIARY_DATA]);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return cardano_cbor_validate_end_array(validator_name, reader);
+}
+
+/**
+ * \brief Looks up a field name of \ref cardano_transaction_seek.
+ *
+ * \param fields The names of the fields, or NULL.
+ * \param name The segment of the path.
+ * \param name_size The size of the segment.
+ *
+ * \return The field, or NULL if the segment is not a name of `fields`.
+ */
+static const field_name_t*
+find_field(const field_name_t* fields, const char* name, const size_t name_size)
+{
+  if (fields == NULL)
+  {
+    return NULL;
+  }
+
+  for (const field_name_t* field = fields; field->name != NULL; ++field)
+  {
+    if ((strlen(field->name) == name_size) && (memcmp(field->name, name, name_size) == 0))
+    {
+      return field;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Computes the path segment selecting a named field within a data item.
+ *
+ * \param item A reader over the data item holding the field.
+ * \param field The field.
+ * \param segment On success, the segment, NULL-terminated; empty if the field is the data item itself.
+ * \param segment_size The size of the segment buffer.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if the data item cannot hold the field, or
+ *         the decoding error.
+ */
+static cardano_error_t
+resolve_field(cardano_cbor_reader_t* item, const field_name_t* field, char* segment, const size_t segment_size)
+{
+  uint64_t key = field->key;
+
+  if (field->kind != FIELD_KIND_KEY)
+  {
+    cardano_cbor_reader_t* clone  = NULL;
+    cardano_error_t        result = cardano_cbor_reader_clone(item, &clone);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    cardano_cbor_reader_state_t state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+    int64_t                     size  = 0;
+
+    result = cardano_cbor_reader_peek_state(clone, &state);
+
+    if ((result == CARDANO_SUCCESS) && (field->kind == FIELD_KIND_TRAILING))
+    {
+      result = cardano_cbor_reader_read_start_array(clone, &size);
+    }
+
+    cardano_cbor_reader_unref(&clone);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    if (field->kind == FIELD_KIND_METADATA)
+    {
+      if (state == CARDANO_CBOR_READER_STATE_START_MAP)
+      {
+        segment[0] = '\0';
+        return CARDANO_SUCCESS;
+      }
+    }
+    else if (size != ALONZO_ERA_FRAME_SIZE)
+    {
+      if (key == 2U)
+      {
+        cardano_cbor_reader_set_last_error(item, "Pre-Alonzo transactions have no validity flag.");
+        return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+      }
+
+      key -= 1U;
+    }
+  }
+
+  const size_t written = cardano_safe_uint64_to_string(key, segment, segment_size);
+
+  assert(written > 0U);
+  CARDANO_UNUSED(written);
+
+  return CARDANO_SUCCESS;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -102,163 +829,214 @@ cardano_transaction_new(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  *transaction = _cardano_malloc(sizeof(cardano_transaction_t));
-
-  if (*transaction == NULL)
-  {
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
-  }
-
-  (*transaction)->base.deallocator   = cardano_transaction_deallocate;
-  (*transaction)->base.ref_count     = 1;
-  (*transaction)->base.last_error[0] = '\0';
-  (*transaction)->body               = body;
-  (*transaction)->witness_set        = witness_set;
-  (*transaction)->auxiliary_data     = auxiliary_data;
-  (*transaction)->is_valid           = true;
+  return create_transaction(body, witness_set, NULL, auxiliary_data, NULL, transaction);
+}
 
-  cardano_transaction_body_ref(body);
-  cardano_witness_set_ref(witness_set);
-  cardano_auxiliary_data_ref(auxiliary_data);
+cardano_error_t
+cardano_transaction_from_cbor(cardano_cbor_reader_t* reader, cardano_transaction_t** transaction)
+{
+  return transaction_from_cbor(reader, false, transaction);
+}
 
-  return CARDANO_SUCCESS;
+cardano_error_t
+cardano_transaction_from_cbor_lazy(cardano_cbor_reader_t* reader, cardano_transaction_t** transaction)
+{
+  return transaction_from_cbor(reader, true, transaction);
 }
 
 cardano_error_t
-cardano_transaction_from_cbor(cardano_cbor_reader_t* reader, cardano_transaction_t** transaction)
+cardano_transaction_from_cbor_parallel(
+  cardano_cbor_reader_t*  reader,
+  cardano_parallel_for_t  parallel_for,
+  void*                   context,
+  cardano_transaction_t** transaction)
 {
   if (transaction == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  *transaction = NULL;
+
   if (reader == NULL)
   {
-    *transaction = NULL;
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  static const char* validator_name = "transaction";
-
-  int64_t array_size = 0U;
+  parallel_decode_t state    = { 0 };
+  bool              is_valid = true;
 
-  cardano_error_t result = cardano_cbor_reader_read_start_array(reader, &array_size);
+  cardano_error_t result = split_transaction(reader, &state, &is_valid);
 
   if (result != CARDANO_SUCCESS)
   {
-    *transaction = NULL;
     return result;
   }
 
-  cardano_transaction_body_t* body           = NULL;
-  cardano_witness_set_t*      witness_set    = NULL;
-  cardano_auxiliary_data_t*   auxiliary_data = NULL;
-  bool                        is_valid       = true;
-
-  cardano_error_t body_result = cardano_transaction_body_from_cbor(reader, &body);
+  const size_t total_size = state.size[PARALLEL_PART_BODY] + state.size[PARALLEL_PART_WITNESS_SET] + state.size[PARALLEL_PART_AUXILIARY_DATA];
 
-  if (body_result != CARDANO_SUCCESS)
+  if ((parallel_for == NULL) || (total_size < CARDANO_TRANSACTION_PARALLEL_DECODE_MIN_SIZE))
   {
-    *transaction = NULL;
-    return body_result;
+    for (size_t i = 0U; i < PARALLEL_PART_COUNT; ++i)
+    {
+      decode_part(&state, i);
+    }
   }
-
-  cardano_error_t witness_set_result = cardano_witness_set_from_cbor(reader, &witness_set);
-
-  if (witness_set_result != CARDANO_SUCCESS)
+  else
   {
-    cardano_transaction_body_unref(&body);
-    *transaction = NULL;
-    return witness_set_result;
+    parallel_for(context, PARALLEL_PART_COUNT, decode_part, &state);
   }
 
-  if (array_size == ALONZO_ERA_FRAME_SIZE)
+  for (size_t i = 0U; i < PARALLEL_PART_COUNT; ++i)
   {
-    cardano_error_t read_bool_result = cardano_cbor_reader_read_bool(reader, &is_valid);
-
-    if (read_bool_result != CARDANO_SUCCESS)
+    if ((result == CARDANO_SUCCESS) && (state.results[i] != CARDANO_SUCCESS))
     {
-      cardano_transaction_body_unref(&body);
-      cardano_witness_set_unref(&witness_set);
-      *transaction = NULL;
+      result = state.results[i];
 
-      return read_bool_result;
+      if (state.readers[i] != NULL)
+      {
+        cardano_cbor_reader_set_last_error(reader, cardano_cbor_reader_get_last_error(state.readers[i]));
+      }
     }
+
+    cardano_cbor_reader_unref(&state.readers[i]);
   }
 
-  cardano_cbor_reader_state_t state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  if (result == CARDANO_SUCCESS)
+  {
+    result = create_transaction(state.body, state.witness_set, NULL, state.auxiliary_data, NULL, transaction);
+  }
 
-  cardano_error_t state_result = cardano_cbor_reader_peek_state(reader, &state);
+  cardano_transaction_body_unref(&state.body);
+  cardano_witness_set_unref(&state.witness_set);
+  cardano_auxiliary_data_unref(&state.auxiliary_data);
 
-  if (state_result != CARDANO_SUCCESS)
+  if (result != CARDANO_SUCCESS)
   {
-    cardano_transaction_body_unref(&body);
-    cardano_witness_set_unref(&witness_set);
     *transaction = NULL;
+    return result;
+  }
+
+  (*transaction)->is_valid = is_valid;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_transaction_seek(
+  cardano_cbor_reader_t*  reader,
+  const char*             path,
+  const size_t            path_size,
+  cardano_cbor_reader_t** field)
+{
+  if ((reader == NULL) || (field == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
 
-    return state_result;
+  if ((path == NULL) && (path_size > 0U))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  if (state == CARDANO_CBOR_READER_STATE_NULL)
+  *field = NULL;
+
+  cardano_cbor_reader_t* current = NULL;
+  cardano_error_t        result  = cardano_cbor_reader_seek(reader, NULL, 0U, &current);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const field_name_t* fields = TRANSACTION_FIELDS;
+  size_t              offset = 0U;
+
+  while (offset < path_size)
   {
-    cardano_error_t read_null_result = cardano_cbor_reader_read_null(reader);
+    size_t end = offset;
 
-    if (read_null_result != CARDANO_SUCCESS)
+    if (path[offset] == '[')
     {
-      cardano_transaction_body_unref(&body);
-      cardano_witness_set_unref(&witness_set);
-      *transaction = NULL;
+      while ((end < path_size) && (path[end] != ']'))
+      {
+        ++end;
+      }
 
-      return read_null_result;
+      end = (end < path_size) ? (end + 1U) : end;
+    }
+    else
+    {
+      while ((end < path_size) && (path[end] != '.') && (path[end] != '['))
+      {
+        ++end;
+      }
     }
-  }
-  else
-  {
-    cardano_error_t auxiliary_data_result = cardano_auxiliary_data_from_cbor(reader, &auxiliary_data);
 
-    if (auxiliary_data_result != CARDANO_SUCCESS)
+    const char* segment      = &path[offset];
+    size_t      segment_size = end - offset;
+
+    if ((end < path_size) && (path[end] == '.'))
     {
-      cardano_transaction_body_unref(&body);
-      cardano_witness_set_unref(&witness_set);
-      *transaction = NULL;
+      ++end;
+    }
 
-      return auxiliary_data_result;
+    if ((segment_size == 0U) || ((end == path_size) && (path[end - 1U] == '.')))
+    {
+      cardano_cbor_reader_set_last_error(reader, "Invalid path.");
+      cardano_cbor_reader_unref(&current);
+
+      return CARDANO_ERROR_INVALID_ARGUMENT;
     }
-  }
 
-  const cardano_error_t expect_end_array_result = cardano_cbor_validate_end_array(validator_name, reader);
+    const field_name_t* named   = find_field(fields, segment, segment_size);
+    char                key[24] = { 0 };
 
-  if (expect_end_array_result != CARDANO_SUCCESS)
-  {
-    *transaction = NULL;
+    if (named != NULL)
+    {
+      result = resolve_field(current, named, key, sizeof(key));
 
-    cardano_transaction_body_unref(&body);
-    cardano_witness_set_unref(&witness_set);
-    cardano_auxiliary_data_unref(&auxiliary_data);
+      if (result != CARDANO_SUCCESS)
+      {
+        cardano_cbor_reader_set_last_error(reader, cardano_cbor_reader_get_last_error(current));
+        cardano_cbor_reader_unref(&current);
 
-    return expect_end_array_result;
-  }
+        return result;
+      }
 
-  cardano_error_t create_instance_result = cardano_transaction_new(body, witness_set, auxiliary_data, transaction);
+      segment      = key;
+      segment_size = strlen(key);
+      fields       = named->fields;
+    }
+    else if ((segment[0] != '[') && (segment[0] != '-') && ((segment[0] < '0') || (segment[0] > '9')))
+    {
+      // A text map key, whose content this function knows nothing about.
+      fields = NULL;
+    }
 
-  cardano_transaction_body_unref(&body);
-  cardano_witness_set_unref(&witness_set);
-  cardano_auxiliary_data_unref(&auxiliary_data);
+    if (segment_size > 0U)
+    {
+      cardano_cbor_reader_t* next = NULL;
 
-  if (create_instance_result != CARDANO_SUCCESS)
-  {
-    cardano_transaction_unref(transaction);
-    return create_instance_result;
-  }
+      result = cardano_cbor_reader_seek(current, segment, segment_size, &next);
 
-  cardano_error_t set_is_valid_result = cardano_transaction_set_is_valid(*transaction, is_valid);
+      if (result != CARDANO_SUCCESS)
+      {
+        cardano_cbor_reader_set_last_error(reader, cardano_cbor_reader_get_last_error(current));
+        cardano_cbor_reader_unref(&current);
 
-  if (set_is_valid_result != CARDANO_SUCCESS)
-  {
-    cardano_transaction_unref(transaction);
-    return set_is_valid_result;
+        return result;
+      }
+
+      cardano_cbor_reader_unref(&current);
+      current = next;
+    }
+
+    offset = end;
   }
 
+  *field = current;
+
   return CARDANO_SUCCESS;
 }
 
@@ -291,7 +1069,19 @@ cardano_transaction_to_cbor(const cardano_transaction_t* transaction, cardano_cb
     return body_result;
   }
 
-  cardano_error_t witness_set_result = cardano_witness_set_to_cbor(transaction->witness_set, writer);
+  cardano_error_t witness_set_result;
+
+  if (transaction->witness_set_cbor != NULL)
+  {
+    witness_set_result = cardano_cbor_writer_write_encoded(
+      writer,
+      cardano_buffer_get_data(transaction->witness_set_cbor),
+      cardano_buffer_get_size(transaction->witness_set_cbor));
+  }
+  else
+  {
+    witness_set_result = cardano_witness_set_to_cbor(transaction->witness_set, writer);
+  }
 
   if (witness_set_result != CARDANO_SUCCESS)
   {
@@ -305,7 +1095,19 @@ cardano_transaction_to_cbor(const cardano_transaction_t* transaction, cardano_cb
     return write_bool_result;
   }
 
-  if (transaction->auxiliary_data == NULL)
+  if (transaction->auxiliary_data_cbor != NULL)
+  {
+    cardano_error_t write_encoded_result = cardano_cbor_writer_write_encoded(
+      writer,
+      cardano_buffer_get_data(transaction->auxiliary_data_cbor),
+      cardano_buffer_get_size(transaction->auxiliary_data_cbor));
+
+    if (write_encoded_result != CARDANO_SUCCESS)
+    {
+      return write_encoded_result;
+    }
+  }
+  else if (transaction->auxiliary_data == NULL)
   {
     cardano_error_t write_null_result = cardano_cbor_writer_write_null(writer);
 
@@ -327,6 +1129,38 @@ cardano_transaction_to_cbor(const cardano_transaction_t* transaction, cardano_cb
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_transaction_get_cbor_size(const cardano_transaction_t* transaction, size_t* size)
+{
+  if (transaction == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (size == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new_size_only();
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_transaction_to_cbor(transaction, writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    *size = cardano_cbor_writer_get_encode_size(writer);
+  }
+
+  cardano_cbor_writer_unref(&writer);
+
+  return result;
+}
+
 cardano_transaction_body_t*
 cardano_transaction_get_body(cardano_transaction_t* transaction)
 {
@@ -348,6 +1182,11 @@ cardano_transaction_set_body(cardano_transaction_t* transaction, cardano_transac
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (body == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -370,6 +1209,11 @@ cardano_transaction_get_witness_set(cardano_transaction_t* transaction)
     return NULL;
   }
 
+  if (decode_witness_set(transaction) != CARDANO_SUCCESS)
+  {
+    return NULL;
+  }
+
   cardano_witness_set_ref(transaction->witness_set);
 
   return transaction->witness_set;
@@ -383,12 +1227,18 @@ cardano_transaction_set_witness_set(cardano_transaction_t* transaction, cardano_
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (witness_set == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
   cardano_witness_set_unref(&transaction->witness_set);
+  cardano_buffer_unref(&transaction->witness_set_cbor);
 
   transaction->witness_set = witness_set;
 
@@ -405,6 +1255,11 @@ cardano_transaction_get_auxiliary_data(cardano_transaction_t* transaction)
     return NULL;
   }
 
+  if (decode_auxiliary_data(transaction) != CARDANO_SUCCESS)
+  {
+    return NULL;
+  }
+
   cardano_auxiliary_data_ref(transaction->auxiliary_data);
 
   return transaction->auxiliary_data;
@@ -418,15 +1273,58 @@ cardano_transaction_set_auxiliary_data(cardano_transaction_t* transaction, carda
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_auxiliary_data_unref(&transaction->auxiliary_data);
+  cardano_buffer_unref(&transaction->auxiliary_data_cbor);
 
-  transaction->auxiliary_data = auxiliary_data;
+  transaction->auxiliary_data      = auxiliary_data;
+  transaction->auxiliary_data_cbor = NULL;
 
   cardano_auxiliary_data_ref(auxiliary_data);
 
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_transaction_set_auxiliary_data_cbor(cardano_transaction_t* transaction, cardano_buffer_t* auxiliary_data_cbor)
+{
+  if ((transaction == NULL) || (auxiliary_data_cbor == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (cardano_object_is_frozen(&transaction->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
+  cardano_error_t result = cardano_cbor_validate_well_formed(
+    cardano_buffer_get_data(auxiliary_data_cbor),
+    cardano_buffer_get_size(auxiliary_data_cbor),
+    0U,
+    NULL);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_transaction_set_last_error(transaction, "The auxiliary data is not a well-formed CBOR data item.");
+    return result;
+  }
+
+  cardano_buffer_ref(auxiliary_data_cbor);
+
+  cardano_auxiliary_data_unref(&transaction->auxiliary_data);
+  cardano_buffer_unref(&transaction->auxiliary_data_cbor);
+
+  transaction->auxiliary_data      = NULL;
+  transaction->auxiliary_data_cbor = auxiliary_data_cbor;
+
+  return CARDANO_SUCCESS;
+}
+
 bool
 cardano_transaction_get_is_valid(cardano_transaction_t* transaction)
 {
@@ -446,6 +1344,11 @@ cardano_transaction_set_is_valid(cardano_transaction_t* transaction, const bool
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   transaction->is_valid = is_valid;
 
   return CARDANO_SUCCESS;
@@ -470,11 +1373,67 @@ cardano_transaction_clear_cbor_cache(cardano_transaction_t* transaction)
     return;
   }
 
+  if (cardano_object_is_frozen(&transaction->base))
+  {
+    return;
+  }
+
+  // Retained encodings are part of the cache too: they must be decoded so the next serialization reflects the objects.
+  if ((decode_witness_set(transaction) != CARDANO_SUCCESS) || (decode_auxiliary_data(transaction) != CARDANO_SUCCESS))
+  {
+    return;
+  }
+
   cardano_transaction_body_clear_cbor_cache(transaction->body);
   cardano_witness_set_clear_cbor_cache(transaction->witness_set);
   cardano_auxiliary_data_clear_cbor_cache(transaction->auxiliary_data);
 }
 
+cardano_error_t
+cardano_transaction_freeze(cardano_transaction_t* transaction)
+{
+  if (transaction == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (cardano_object_is_frozen(&transaction->base))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  // Deferred parts are decoded on first access, which readers on several threads must never do at once
+  cardano_error_t result = decode_witness_set(transaction);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = decode_auxiliary_data(transaction);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  cardano_transaction_body_freeze(transaction->body);
+  cardano_object_freeze((cardano_object_t*)((void*)transaction->witness_set));
+  cardano_object_freeze((cardano_object_t*)((void*)transaction->auxiliary_data));
+  cardano_object_freeze(&transaction->base);
+
+  return CARDANO_SUCCESS;
+}
+
+bool
+cardano_transaction_is_frozen(const cardano_transaction_t* transaction)
+{
+  if (transaction == NULL)
+  {
+    return false;
+  }
+
+  return cardano_object_is_frozen(&transaction->base);
+}
+
 cardano_error_t
 cardano_transaction_apply_vkey_witnesses(
   cardano_transaction_t*      transaction,
@@ -485,11 +1444,23 @@ cardano_transaction_apply_vkey_witnesses(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (new_vkeys == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  cardano_error_t decode_result = decode_witness_set(transaction);
+
+  if (decode_result != CARDANO_SUCCESS)
+  {
+    return decode_result;
+  }
+
   cardano_witness_set_t* witness_set = cardano_transaction_get_witness_set(transaction);
 
   cardano_witness_set_unref(&witness_set);
@@ -600,4 +1571,19 @@ const char*
 cardano_transaction_get_last_error(const cardano_transaction_t* transaction)
 {
   return cardano_object_get_last_error(&transaction->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_transaction_add_footprint(const cardano_transaction_t* transaction, cardano_footprint_context_t* context)
+{
+  if ((transaction == NULL) || !_cardano_footprint_visit(context, &transaction->base, CARDANO_MEMORY_FOOTPRINT_TYPE_TRANSACTION, sizeof(cardano_transaction_t)))
+  {
+    return;
+  }
+
+  _cardano_transaction_body_add_footprint(transaction->body, context);
+  _cardano_witness_set_add_footprint(transaction->witness_set, context);
+  _cardano_buffer_add_footprint(transaction->witness_set_cbor, context);
+  _cardano_auxiliary_data_add_footprint(transaction->auxiliary_data, context);
+  _cardano_buffer_add_footprint(transaction->auxiliary_data_cbor, context);
+}
@@ -0,0 +1,1007 @@
+/**
+ * \file transaction_visitor.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/cbor/cbor_reader.h>
+#include <cardano/transaction/transaction_visitor.h>
+
+#include <assert.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const uint64_t TRANSACTION_BODY_OUTPUTS_KEY = 1U;
+static const uint64_t OUTPUT_ADDRESS_KEY           = 0U;
+static const uint64_t OUTPUT_AMOUNT_KEY            = 1U;
+static const uint64_t ALONZO_METADATA_KEY          = 0U;
+static const uint64_t ALONZO_AUXILIARY_DATA_TAG    = 259U;
+static const uint64_t LAST_BYRON_ERA               = 1U;
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief State shared by the visiting functions.
+ */
+typedef struct visit_state_t
+{
+    const cardano_transaction_visitor_t* visitor;
+    cardano_cbor_reader_t*               reader;
+    const byte_t*                        data;
+    size_t                               size;
+} visit_state_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Checks whether the next item of the current array or map is its end.
+ *
+ * \param[in]  reader The reader.
+ * \param[in]  end_state \ref CARDANO_CBOR_READER_STATE_END_ARRAY or \ref CARDANO_CBOR_READER_STATE_END_MAP.
+ * \param[out] more `true` if there is at least one more item.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error returned by the reader.
+ */
+static cardano_error_t
+has_next(cardano_cbor_reader_t* reader, const cardano_cbor_reader_state_t end_state, bool* more)
+{
+  cardano_cbor_reader_state_t state  = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  cardano_error_t             result = cardano_cbor_reader_peek_state(reader, &state);
+
+  *more = (result == CARDANO_SUCCESS) && (state != end_state);
+
+  return result;
+}
+
+/**
+ * \brief Gets the offset of the reader in the visited data.
+ *
+ * \param[in] state The visit state.
+ *
+ * \return The offset of the next byte to be read.
+ */
+static size_t
+get_offset(const visit_state_t* state)
+{
+  size_t remaining = 0U;
+
+  if (cardano_cbor_reader_get_bytes_remaining(state->reader, &remaining) != CARDANO_SUCCESS)
+  {
+    return state->size;
+  }
+
+  return state->size - remaining;
+}
+
+/**
+ * \brief Visits a multi-asset map, invoking the asset callback for each entry.
+ *
+ * \param[in] state The visit state.
+ * \param[in] tx_index The index of the transaction.
+ * \param[in] output_index The index of the output holding the assets.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+visit_assets(const visit_state_t* state, const size_t tx_index, const size_t output_index)
+{
+  cardano_cbor_reader_t* reader = state->reader;
+
+  if (state->visitor->asset == NULL)
+  {
+    return cardano_cbor_reader_skip_value(reader);
+  }
+
+  int64_t         length = 0;
+  bool            more   = false;
+  cardano_error_t result = cardano_cbor_reader_read_start_map(reader, &length);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = has_next(reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+  }
+
+  while ((result == CARDANO_SUCCESS) && more)
+  {
+    const byte_t* policy_id      = NULL;
+    size_t        policy_id_size = 0U;
+
+    result = cardano_cbor_reader_read_bytestring_view(reader, &policy_id, &policy_id_size);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_read_start_map(reader, &length);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = has_next(reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+    }
+
+    while ((result == CARDANO_SUCCESS) && more)
+    {
+      const byte_t* asset_name      = NULL;
+      size_t        asset_name_size = 0U;
+      uint64_t      quantity        = 0U;
+
+      result = cardano_cbor_reader_read_bytestring_view(reader, &asset_name, &asset_name_size);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_cbor_reader_read_uint(reader, &quantity);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = state->visitor->asset(state->visitor->context, tx_index, output_index, policy_id, policy_id_size, asset_name, asset_name_size, quantity);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = has_next(reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+      }
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_read_end_map(reader);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = has_next(reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_end_map(reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Visits the amount of an output, invoking the output callback and then the asset callbacks.
+ *
+ * \param[in] state The visit state.
+ * \param[in] tx_index The index of the transaction.
+ * \param[in] output_index The index of the output.
+ * \param[in] address The address of the output.
+ * \param[in] address_size The size of the address.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+visit_value(
+  const visit_state_t* state,
+  const size_t         tx_index,
+  const size_t         output_index,
+  const byte_t*        address,
+  const size_t         address_size)
+{
+  cardano_cbor_reader_t*      reader      = state->reader;
+  cardano_cbor_reader_state_t value_state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  cardano_error_t             result      = cardano_cbor_reader_peek_state(reader, &value_state);
+  uint64_t                    coin        = 0U;
+  int64_t                     length      = 0;
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const bool has_assets = (value_state == CARDANO_CBOR_READER_STATE_START_ARRAY);
+
+  if (has_assets)
+  {
+    result = cardano_cbor_reader_read_start_array(reader, &length);
+  }
+  else if (value_state != CARDANO_CBOR_READER_STATE_UNSIGNED_INTEGER)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_uint(reader, &coin);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (state->visitor->output != NULL))
+  {
+    result = state->visitor->output(state->visitor->context, tx_index, output_index, address, address_size, coin);
+  }
+
+  if ((result == CARDANO_SUCCESS) && has_assets)
+  {
+    result = visit_assets(state, tx_index, output_index);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_read_end_array(reader);
+    }
+  }
+
+  return result;
+}
+
+/**
+ * \brief Visits an output in the map format, where the amount may precede the address.
+ *
+ * \param[in] state The visit state.
+ * \param[in] tx_index The index of the transaction.
+ * \param[in] output_index The index of the output.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+visit_map_output(const visit_state_t* state, const size_t tx_index, const size_t output_index)
+{
+  cardano_cbor_reader_t* reader       = state->reader;
+  const byte_t*          address      = NULL;
+  size_t                 address_size = 0U;
+  const byte_t*          amount       = NULL;
+  size_t                 amount_size  = 0U;
+  bool                   has_amount   = false;
+  int64_t                length       = 0;
+  bool                   more         = false;
+  cardano_error_t        result       = cardano_cbor_reader_read_start_map(reader, &length);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = has_next(reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+  }
+
+  while ((result == CARDANO_SUCCESS) && more)
+  {
+    uint64_t key = 0U;
+
+    result = cardano_cbor_reader_read_uint(reader, &key);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      break;
+    }
+
+    if (key == OUTPUT_ADDRESS_KEY)
+    {
+      result = cardano_cbor_reader_read_bytestring_view(reader, &address, &address_size);
+    }
+    else if ((key == OUTPUT_AMOUNT_KEY) && (address != NULL))
+    {
+      has_amount = true;
+      result     = visit_value(state, tx_index, output_index, address, address_size);
+    }
+    else if (key == OUTPUT_AMOUNT_KEY)
+    {
+      // The amount comes before the address, which canonical encoders never do: keep it for later.
+      has_amount = true;
+      result     = cardano_cbor_reader_read_encoded_value_view(reader, &amount, &amount_size);
+    }
+    else
+    {
+      result = cardano_cbor_reader_skip_value(reader);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = has_next(reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_end_map(reader);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if ((address == NULL) || !has_amount)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  if (amount == NULL)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  visit_state_t amount_state = *state;
+
+  amount_state.reader = cardano_cbor_reader_from_view(amount, amount_size);
+
+  if (amount_state.reader == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  result = visit_value(&amount_state, tx_index, output_index, address, address_size);
+
+  cardano_cbor_reader_unref(&amount_state.reader);
+
+  return result;
+}
+
+/**
+ * \brief Visits a transaction output in either the legacy array format or the map format.
+ *
+ * \param[in] state The visit state.
+ * \param[in] tx_index The index of the transaction.
+ * \param[in] output_index The index of the output.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+visit_output(const visit_state_t* state, const size_t tx_index, const size_t output_index)
+{
+  cardano_cbor_reader_t*      reader       = state->reader;
+  cardano_cbor_reader_state_t output_state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  cardano_error_t             result       = cardano_cbor_reader_peek_state(reader, &output_state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (output_state == CARDANO_CBOR_READER_STATE_START_MAP)
+  {
+    return visit_map_output(state, tx_index, output_index);
+  }
+
+  if (output_state != CARDANO_CBOR_READER_STATE_START_ARRAY)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  const byte_t* address      = NULL;
+  size_t        address_size = 0U;
+  int64_t       length       = 0;
+  bool          more         = false;
+
+  result = cardano_cbor_reader_read_start_array(reader, &length);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_bytestring_view(reader, &address, &address_size);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = visit_value(state, tx_index, output_index, address, address_size);
+  }
+
+  // Legacy outputs may carry a datum hash after the amount
+  if (result == CARDANO_SUCCESS)
+  {
+    result = has_next(reader, CARDANO_CBOR_READER_STATE_END_ARRAY, &more);
+  }
+
+  while ((result == CARDANO_SUCCESS) && more)
+  {
+    result = cardano_cbor_reader_skip_value(reader);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = has_next(reader, CARDANO_CBOR_READER_STATE_END_ARRAY, &more);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_end_array(reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Visits the outputs of a transaction body.
+ *
+ * \param[in] state The visit state.
+ * \param[in] tx_index The index of the transaction.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+visit_outputs(const visit_state_t* state, const size_t tx_index)
+{
+  int64_t         length       = 0;
+  bool            more         = false;
+  size_t          output_index = 0U;
+  cardano_error_t result       = cardano_cbor_reader_read_start_array(state->reader, &length);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = has_next(state->reader, CARDANO_CBOR_READER_STATE_END_ARRAY, &more);
+  }
+
+  while ((result == CARDANO_SUCCESS) && more)
+  {
+    result = visit_output(state, tx_index, output_index);
+    ++output_index;
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = has_next(state->reader, CARDANO_CBOR_READER_STATE_END_ARRAY, &more);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_end_array(state->reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Visits a transaction body, then invokes the body callback with its encoding.
+ *
+ * \param[in] state The visit state.
+ * \param[in] tx_index The index of the transaction.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+visit_body(const visit_state_t* state, const size_t tx_index)
+{
+  const cardano_transaction_visitor_t* visitor = state->visitor;
+
+  const bool   wants_outputs = (visitor->output != NULL) || (visitor->asset != NULL);
+  const size_t start         = get_offset(state);
+
+  int64_t         length = 0;
+  bool            more   = false;
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (!wants_outputs)
+  {
+    result = cardano_cbor_reader_skip_value(state->reader);
+  }
+  else
+  {
+    result = cardano_cbor_reader_read_start_map(state->reader, &length);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = has_next(state->reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+    }
+
+    while ((result == CARDANO_SUCCESS) && more)
+    {
+      uint64_t key = 0U;
+
+      result = cardano_cbor_reader_read_uint(state->reader, &key);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = (key == TRANSACTION_BODY_OUTPUTS_KEY) ? visit_outputs(state, tx_index) : cardano_cbor_reader_skip_value(state->reader);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = has_next(state->reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+      }
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_read_end_map(state->reader);
+    }
+  }
+
+  if ((result == CARDANO_SUCCESS) && (visitor->body != NULL))
+  {
+    const size_t end = get_offset(state);
+
+    assert(end >= start);
+
+    result = visitor->body(visitor->context, tx_index, &state->data[start], end - start);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Visits a metadata map, invoking the metadatum callback for each label.
+ *
+ * \param[in] state The visit state.
+ * \param[in] tx_index The index of the transaction.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+visit_metadata(const visit_state_t* state, const size_t tx_index)
+{
+  int64_t         length = 0;
+  bool            more   = false;
+  cardano_error_t result = cardano_cbor_reader_read_start_map(state->reader, &length);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = has_next(state->reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+  }
+
+  while ((result == CARDANO_SUCCESS) && more)
+  {
+    uint64_t      label          = 0U;
+    const byte_t* metadatum      = NULL;
+    size_t        metadatum_size = 0U;
+
+    result = cardano_cbor_reader_read_uint(state->reader, &label);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_read_encoded_value_view(state->reader, &metadatum, &metadatum_size);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = state->visitor->metadatum(state->visitor->context, tx_index, label, metadatum, metadatum_size);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = has_next(state->reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_end_map(state->reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Skips the remaining items of the current array or map and reads its end.
+ *
+ * \param[in] reader The reader.
+ * \param[in] end_state \ref CARDANO_CBOR_READER_STATE_END_ARRAY or \ref CARDANO_CBOR_READER_STATE_END_MAP.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error returned by the reader.
+ */
+static cardano_error_t
+skip_to_end(cardano_cbor_reader_t* reader, const cardano_cbor_reader_state_t end_state)
+{
+  bool            more   = false;
+  cardano_error_t result = has_next(reader, end_state, &more);
+
+  while ((result == CARDANO_SUCCESS) && more)
+  {
+    result = cardano_cbor_reader_skip_value(reader);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = has_next(reader, end_state, &more);
+    }
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  return (end_state == CARDANO_CBOR_READER_STATE_END_MAP) ? cardano_cbor_reader_read_end_map(reader) : cardano_cbor_reader_read_end_array(reader);
+}
+
+/**
+ * \brief Visits the metadata of auxiliary data in the Shelley, Allegra/Mary or Alonzo format.
+ *
+ * \param[in] state The visit state.
+ * \param[in] tx_index The index of the transaction.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+visit_auxiliary_data(const visit_state_t* state, const size_t tx_index)
+{
+  cardano_cbor_reader_t*      reader    = state->reader;
+  cardano_cbor_reader_state_t aux_state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  int64_t                     length    = 0;
+  bool                        more      = false;
+
+  if (state->visitor->metadatum == NULL)
+  {
+    return cardano_cbor_reader_skip_value(reader);
+  }
+
+  cardano_error_t result = cardano_cbor_reader_peek_state(reader, &aux_state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  switch (aux_state)
+  {
+    case CARDANO_CBOR_READER_STATE_NULL:
+    {
+      return cardano_cbor_reader_read_null(reader);
+    }
+    case CARDANO_CBOR_READER_STATE_START_MAP:
+    {
+      return visit_metadata(state, tx_index);
+    }
+    case CARDANO_CBOR_READER_STATE_START_ARRAY:
+    {
+      // Allegra/Mary: [metadata, auxiliary_scripts]
+      result = cardano_cbor_reader_read_start_array(reader, &length);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = visit_metadata(state, tx_index);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = skip_to_end(reader, CARDANO_CBOR_READER_STATE_END_ARRAY);
+      }
+
+      return result;
+    }
+    case CARDANO_CBOR_READER_STATE_TAG:
+    {
+      cardano_cbor_tag_t tag = CARDANO_CBOR_TAG_SET;
+
+      result = cardano_cbor_reader_read_tag(reader, &tag);
+
+      if ((result == CARDANO_SUCCESS) && ((uint64_t)tag != ALONZO_AUXILIARY_DATA_TAG))
+      {
+        result = CARDANO_ERROR_DECODING;
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_cbor_reader_read_start_map(reader, &length);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = has_next(reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+      }
+
+      while ((result == CARDANO_SUCCESS) && more)
+      {
+        uint64_t key = 0U;
+
+        result = cardano_cbor_reader_read_uint(reader, &key);
+
+        if (result == CARDANO_SUCCESS)
+        {
+          result = (key == ALONZO_METADATA_KEY) ? visit_metadata(state, tx_index) : cardano_cbor_reader_skip_value(reader);
+        }
+
+        if (result == CARDANO_SUCCESS)
+        {
+          result = has_next(reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+        }
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = cardano_cbor_reader_read_end_map(reader);
+      }
+
+      return result;
+    }
+    default:
+    {
+      return CARDANO_ERROR_DECODING;
+    }
+  }
+}
+
+/**
+ * \brief Visits an encoded transaction at the position of the reader.
+ *
+ * \param[in] state The visit state.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+visit_transaction(const visit_state_t* state)
+{
+  cardano_cbor_reader_t*      reader     = state->reader;
+  cardano_cbor_reader_state_t next_state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  int64_t                     length     = 0;
+  bool                        is_valid   = true;
+
+  cardano_error_t result = cardano_cbor_reader_read_start_array(reader, &length);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = visit_body(state, 0U);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_skip_value(reader);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_peek_state(reader, &next_state);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (next_state == CARDANO_CBOR_READER_STATE_BOOLEAN))
+  {
+    result = cardano_cbor_reader_read_bool(reader, &is_valid);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_peek_state(reader, &next_state);
+    }
+  }
+
+  if ((result == CARDANO_SUCCESS) && (next_state != CARDANO_CBOR_READER_STATE_END_ARRAY))
+  {
+    result = visit_auxiliary_data(state, 0U);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_end_array(reader);
+  }
+
+  if ((result == CARDANO_SUCCESS) && !is_valid && (state->visitor->invalid_transaction != NULL))
+  {
+    result = state->visitor->invalid_transaction(state->visitor->context, 0U);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Visits an encoded block at the position of the reader.
+ *
+ * \param[in] state The visit state.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+visit_block(const visit_state_t* state)
+{
+  cardano_cbor_reader_t*               reader  = state->reader;
+  const cardano_transaction_visitor_t* visitor = state->visitor;
+
+  cardano_cbor_reader_state_t next_state = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  int64_t                     length     = 0;
+  bool                        more       = false;
+  bool                        is_wrapped = false;
+
+  cardano_error_t result = cardano_cbor_reader_read_start_array(reader, &length);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_peek_state(reader, &next_state);
+  }
+
+  // [era, block] envelope
+  if ((result == CARDANO_SUCCESS) && (next_state == CARDANO_CBOR_READER_STATE_UNSIGNED_INTEGER))
+  {
+    uint64_t era = 0U;
+
+    is_wrapped = true;
+    result     = cardano_cbor_reader_read_uint(reader, &era);
+
+    if ((result == CARDANO_SUCCESS) && (era <= LAST_BYRON_ERA))
+    {
+      result = CARDANO_ERROR_DECODING;
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_read_start_array(reader, &length);
+    }
+  }
+
+  // Header
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_skip_value(reader);
+  }
+
+  // Transaction bodies
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_start_array(reader, &length);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = has_next(reader, CARDANO_CBOR_READER_STATE_END_ARRAY, &more);
+  }
+
+  for (size_t tx_index = 0U; (result == CARDANO_SUCCESS) && more; ++tx_index)
+  {
+    result = visit_body(state, tx_index);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = has_next(reader, CARDANO_CBOR_READER_STATE_END_ARRAY, &more);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_end_array(reader);
+  }
+
+  // Witness sets
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_skip_value(reader);
+  }
+
+  // Auxiliary data, keyed by transaction index
+  if ((result == CARDANO_SUCCESS) && (visitor->metadatum == NULL))
+  {
+    result = cardano_cbor_reader_skip_value(reader);
+  }
+  else if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_start_map(reader, &length);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = has_next(reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+    }
+
+    while ((result == CARDANO_SUCCESS) && more)
+    {
+      uint64_t tx_index = 0U;
+
+      result = cardano_cbor_reader_read_uint(reader, &tx_index);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = visit_auxiliary_data(state, (size_t)tx_index);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = has_next(reader, CARDANO_CBOR_READER_STATE_END_MAP, &more);
+      }
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_read_end_map(reader);
+    }
+  }
+
+  // Invalid transactions, absent before Alonzo
+  if (result == CARDANO_SUCCESS)
+  {
+    result = has_next(reader, CARDANO_CBOR_READER_STATE_END_ARRAY, &more);
+  }
+
+  if ((result == CARDANO_SUCCESS) && more && (visitor->invalid_transaction != NULL))
+  {
+    result = cardano_cbor_reader_read_start_array(reader, &length);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = has_next(reader, CARDANO_CBOR_READER_STATE_END_ARRAY, &more);
+    }
+
+    while ((result == CARDANO_SUCCESS) && more)
+    {
+      uint64_t tx_index = 0U;
+
+      result = cardano_cbor_reader_read_uint(reader, &tx_index);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = visitor->invalid_transaction(visitor->context, (size_t)tx_index);
+      }
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = has_next(reader, CARDANO_CBOR_READER_STATE_END_ARRAY, &more);
+      }
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_read_end_array(reader);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = skip_to_end(reader, CARDANO_CBOR_READER_STATE_END_ARRAY);
+  }
+
+  if ((result == CARDANO_SUCCESS) && is_wrapped)
+  {
+    result = cardano_cbor_reader_read_end_array(reader);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Runs a visiting function over caller-owned CBOR data.
+ *
+ * \param[in] cbor The CBOR data.
+ * \param[in] size The size of the data.
+ * \param[in] visitor The visitor callbacks.
+ * \param[in] visit The visiting function.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+visit(
+  const byte_t*                        cbor,
+  const size_t                         size,
+  const cardano_transaction_visitor_t* visitor,
+  cardano_error_t (*visit_func)(const visit_state_t*))
+{
+  if ((cbor == NULL) || (visitor == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (size == 0U)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  visit_state_t state = { visitor, NULL, cbor, size };
+
+  state.reader = cardano_cbor_reader_from_view(cbor, size);
+
+  if (state.reader == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = visit_func(&state);
+
+  cardano_cbor_reader_unref(&state.reader);
+
+  return result;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_transaction_visit(
+  const byte_t*                        cbor,
+  const size_t                         size,
+  const cardano_transaction_visitor_t* visitor)
+{
+  return visit(cbor, size, visitor, visit_transaction);
+}
+
+cardano_error_t
+cardano_block_visit(
+  const byte_t*                        cbor,
+  const size_t                         size,
+  const cardano_transaction_visitor_t* visitor)
+{
+  return visit(cbor, size, visitor, visit_block);
+}
@@ -28,6 +28,7 @@
 
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
@@ -62,6 +63,7 @@ typedef struct cardano_transaction_body_t
     uint64_t*                          treasury_value;
     uint64_t*                          donation;
     cardano_buffer_t*                  cbor_cache;
+    cardano_blake2b_hash_t*            hash_cache;
 } cardano_transaction_body_t;
 
 /* STATIC DECLARATIONS *******************************************************/
@@ -130,6 +132,7 @@ cardano_transaction_body_deallocate(void* object)
   _cardano_free(data->treasury_value);
   _cardano_free(data->donation);
   cardano_buffer_unref(&data->cbor_cache);
+  cardano_blake2b_hash_unref(&data->hash_cache);
 
   _cardano_free(object);
 }
@@ -1327,7 +1330,7 @@ create_transaction_body_new(void)
 
   transaction_body->base.deallocator    = cardano_transaction_body_deallocate;
   transaction_body->base.ref_count      = 1;
-  transaction_body->base.last_error[0]  = '\0';
+  transaction_body->base.last_error     = NULL;
   transaction_body->inputs              = NULL;
   transaction_body->outputs             = NULL;
   transaction_body->fee                 = NULL;
@@ -1350,6 +1353,7 @@ create_transaction_body_new(void)
   transaction_body->treasury_value      = NULL;
   transaction_body->donation            = NULL;
   transaction_body->cbor_cache          = NULL;
+  transaction_body->hash_cache          = NULL;
 
   return transaction_body;
 }
@@ -1720,6 +1724,38 @@ cardano_transaction_body_to_cbor(const cardano_transaction_body_t* transaction_b
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_transaction_body_get_cbor_size(const cardano_transaction_body_t* transaction_body, size_t* size)
+{
+  if (transaction_body == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (size == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new_size_only();
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_transaction_body_to_cbor(transaction_body, writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    *size = cardano_cbor_writer_get_encode_size(writer);
+  }
+
+  cardano_cbor_writer_unref(&writer);
+
+  return result;
+}
+
 cardano_transaction_input_set_t*
 cardano_transaction_body_get_inputs(cardano_transaction_body_t* transaction_body)
 {
@@ -1741,6 +1777,11 @@ cardano_transaction_body_set_inputs(cardano_transaction_body_t* transaction_body
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (inputs == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -1774,6 +1815,11 @@ cardano_transaction_body_set_outputs(cardano_transaction_body_t* transaction_bod
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (outputs == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -1810,6 +1856,11 @@ cardano_transaction_body_set_fee(cardano_transaction_body_t* transaction_body, c
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (transaction_body->fee == NULL)
   {
     transaction_body->fee = (uint64_t*)_cardano_malloc(sizeof(uint64_t));
@@ -1844,6 +1895,11 @@ cardano_transaction_body_set_invalid_after(cardano_transaction_body_t* transacti
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (epoch == NULL)
   {
     _cardano_free(transaction_body->invalid_after);
@@ -1888,6 +1944,11 @@ cardano_transaction_body_set_certificates(cardano_transaction_body_t* transactio
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (certificates == NULL)
   {
     cardano_certificate_set_unref(&transaction_body->certificates);
@@ -1924,6 +1985,11 @@ cardano_transaction_body_set_withdrawals(cardano_transaction_body_t* transaction
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (withdrawals == NULL)
   {
     cardano_withdrawal_map_unref(&transaction_body->withdrawals);
@@ -1960,6 +2026,11 @@ cardano_transaction_body_set_update(cardano_transaction_body_t* transaction_body
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (update == NULL)
   {
     cardano_update_unref(&transaction_body->update);
@@ -1996,6 +2067,11 @@ cardano_transaction_body_set_aux_data_hash(cardano_transaction_body_t* transacti
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (aux_data_hash == NULL)
   {
     cardano_blake2b_hash_unref(&transaction_body->aux_data_hash);
@@ -2030,6 +2106,11 @@ cardano_transaction_body_set_invalid_before(cardano_transaction_body_t* transact
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (epoch == NULL)
   {
     _cardano_free(transaction_body->invalid_before);
@@ -2074,6 +2155,11 @@ cardano_transaction_body_set_mint(cardano_transaction_body_t* transaction_body,
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (mint == NULL)
   {
     cardano_multi_asset_unref(&transaction_body->mint);
@@ -2110,6 +2196,11 @@ cardano_transaction_body_set_script_data_hash(cardano_transaction_body_t* transa
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (script_data_hash == NULL)
   {
     cardano_blake2b_hash_unref(&transaction_body->script_data_hash);
@@ -2146,6 +2237,11 @@ cardano_transaction_body_set_collateral(cardano_transaction_body_t* transaction_
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (collateral == NULL)
   {
     cardano_transaction_input_set_unref(&transaction_body->collateral);
@@ -2184,6 +2280,11 @@ cardano_transaction_body_set_required_signers(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (required_signers == NULL)
   {
     cardano_blake2b_hash_set_unref(&transaction_body->required_signers);
@@ -2218,6 +2319,11 @@ cardano_transaction_body_set_network_id(cardano_transaction_body_t* transaction_
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (network_id == NULL)
   {
     _cardano_free(transaction_body->network_id);
@@ -2262,6 +2368,11 @@ cardano_transaction_body_set_collateral_return(cardano_transaction_body_t* trans
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (output == NULL)
   {
     cardano_transaction_output_unref(&transaction_body->collateral_return);
@@ -2296,6 +2407,11 @@ cardano_transaction_body_set_total_collateral(cardano_transaction_body_t* transa
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (total_collateral == NULL)
   {
     _cardano_free(transaction_body->total_collateral);
@@ -2341,6 +2457,11 @@ cardano_transaction_body_set_reference_inputs(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (reference_inputs == NULL)
   {
     cardano_transaction_input_set_unref(&transaction_body->reference_inputs);
@@ -2379,6 +2500,11 @@ cardano_transaction_body_set_voting_procedures(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (voting_procedures == NULL)
   {
     cardano_voting_procedures_unref(&transaction_body->voting_procedures);
@@ -2417,6 +2543,11 @@ cardano_transaction_body_set_proposal_procedure(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (proposal_procedures == NULL)
   {
     cardano_proposal_procedure_set_unref(&transaction_body->proposal_procedures);
@@ -2451,6 +2582,11 @@ cardano_transaction_body_set_treasury_value(cardano_transaction_body_t* transact
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (treasury_value == NULL)
   {
     _cardano_free(transaction_body->treasury_value);
@@ -2493,6 +2629,11 @@ cardano_transaction_body_set_donation(cardano_transaction_body_t* transaction_bo
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (donation == NULL)
   {
     _cardano_free(transaction_body->donation);
@@ -2524,6 +2665,38 @@ cardano_transaction_body_get_hash(cardano_transaction_body_t* transaction_body)
     return NULL;
   }
 
+  if (transaction_body->hash_cache != NULL)
+  {
+    cardano_blake2b_hash_ref(transaction_body->hash_cache);
+
+    return transaction_body->hash_cache;
+  }
+
+  // A decoded body serializes to its original bytes, so those are hashed as they are and the hash is kept until
+  // the cache is cleared. Frozen bodies may be shared between threads, so their hash is computed but not stored.
+  if (transaction_body->cbor_cache != NULL)
+  {
+    cardano_blake2b_hash_t* hash = NULL;
+
+    if (cardano_blake2b_compute_hash(
+          cardano_buffer_get_data(transaction_body->cbor_cache),
+          cardano_buffer_get_size(transaction_body->cbor_cache),
+          CARDANO_BLAKE2B_HASH_SIZE_256,
+          &hash)
+        != CARDANO_SUCCESS)
+    {
+      return NULL;
+    }
+
+    if (!cardano_object_is_frozen(&transaction_body->base))
+    {
+      cardano_blake2b_hash_ref(hash);
+      transaction_body->hash_cache = hash;
+    }
+
+    return hash;
+  }
+
   cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
 
   if (writer == NULL)
@@ -2598,8 +2771,89 @@ cardano_transaction_body_clear_cbor_cache(cardano_transaction_body_t* transactio
     return;
   }
 
+  if (cardano_object_is_frozen(&transaction_body->base))
+  {
+    return;
+  }
+
   cardano_buffer_unref(&transaction_body->cbor_cache);
   transaction_body->cbor_cache = NULL;
+
+  cardano_blake2b_hash_unref(&transaction_body->hash_cache);
+  transaction_body->hash_cache = NULL;
+}
+
+/**
+ * \brief Freezes the inputs of an input set, and the set itself.
+ *
+ * \param[in] inputs The input set, or NULL.
+ */
+static void
+freeze_input_set(cardano_transaction_input_set_t* inputs)
+{
+  const size_t length = cardano_transaction_input_set_get_length(inputs);
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    cardano_transaction_input_t* input = NULL;
+
+    if (cardano_transaction_input_set_get(inputs, i, &input) == CARDANO_SUCCESS)
+    {
+      cardano_transaction_input_freeze(input);
+    }
+
+    cardano_transaction_input_unref(&input);
+  }
+
+  cardano_object_freeze((cardano_object_t*)((void*)inputs));
+}
+
+void
+cardano_transaction_body_freeze(cardano_transaction_body_t* transaction_body)
+{
+  if (transaction_body == NULL)
+  {
+    return;
+  }
+
+  // A frozen body computes its hash on every call instead of storing it, so it is stored now
+  cardano_blake2b_hash_t* hash = cardano_transaction_body_get_hash(transaction_body);
+  cardano_blake2b_hash_unref(&hash);
+
+  cardano_object_freeze(&transaction_body->base);
+
+  freeze_input_set(transaction_body->inputs);
+  freeze_input_set(transaction_body->collateral);
+  freeze_input_set(transaction_body->reference_inputs);
+
+  const size_t output_count = cardano_transaction_output_list_get_length(transaction_body->outputs);
+
+  for (size_t i = 0U; i < output_count; ++i)
+  {
+    cardano_transaction_output_t* output = NULL;
+
+    if (cardano_transaction_output_list_get(transaction_body->outputs, i, &output) == CARDANO_SUCCESS)
+    {
+      cardano_transaction_output_freeze(output);
+    }
+
+    cardano_transaction_output_unref(&output);
+  }
+
+  cardano_object_freeze((cardano_object_t*)((void*)transaction_body->outputs));
+  cardano_transaction_output_freeze(transaction_body->collateral_return);
+  cardano_object_freeze((cardano_object_t*)((void*)transaction_body->mint));
+}
+
+bool
+cardano_transaction_body_is_frozen(const cardano_transaction_body_t* transaction_body)
+{
+  if (transaction_body == NULL)
+  {
+    return false;
+  }
+
+  return cardano_object_is_frozen(&transaction_body->base);
 }
 
 void
@@ -2652,4 +2906,51 @@ const char*
 cardano_transaction_body_get_last_error(const cardano_transaction_body_t* transaction_body)
 {
   return cardano_object_get_last_error(&transaction_body->base);
-}
\ No newline at end of file
+}
+
+/**
+ * \brief Adds an optional integer field of a transaction body, a heap block of its own when present.
+ */
+static void
+add_optional_field_footprint(const void* field, const size_t size, cardano_footprint_context_t* context)
+{
+  if (field != NULL)
+  {
+    _cardano_footprint_add_block(context, CARDANO_MEMORY_FOOTPRINT_TYPE_TRANSACTION, size);
+  }
+}
+
+void
+_cardano_transaction_body_add_footprint(const cardano_transaction_body_t* body, cardano_footprint_context_t* context)
+{
+  if ((body == NULL) || !_cardano_footprint_visit(context, &body->base, CARDANO_MEMORY_FOOTPRINT_TYPE_TRANSACTION, sizeof(cardano_transaction_body_t)))
+  {
+    return;
+  }
+
+  add_optional_field_footprint(body->fee, sizeof(uint64_t), context);
+  add_optional_field_footprint(body->invalid_after, sizeof(uint64_t), context);
+  add_optional_field_footprint(body->invalid_before, sizeof(uint64_t), context);
+  add_optional_field_footprint(body->network_id, sizeof(cardano_network_id_t), context);
+  add_optional_field_footprint(body->total_collateral, sizeof(uint64_t), context);
+  add_optional_field_footprint(body->treasury_value, sizeof(uint64_t), context);
+  add_optional_field_footprint(body->donation, sizeof(uint64_t), context);
+
+  _cardano_transaction_input_set_add_footprint(body->inputs, context);
+  _cardano_transaction_output_list_add_footprint(body->outputs, context);
+  _cardano_blake2b_hash_add_footprint(body->aux_data_hash, context);
+  _cardano_multi_asset_add_footprint(body->mint, context);
+  _cardano_blake2b_hash_add_footprint(body->script_data_hash, context);
+  _cardano_transaction_input_set_add_footprint(body->collateral, context);
+  _cardano_blake2b_hash_set_add_footprint(body->required_signers, context);
+  _cardano_transaction_output_add_footprint(body->collateral_return, context);
+  _cardano_transaction_input_set_add_footprint(body->reference_inputs, context);
+  _cardano_buffer_add_footprint(body->cbor_cache, context);
+  _cardano_blake2b_hash_add_footprint(body->hash_cache, context);
+
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)body->certificates));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)body->withdrawals));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)body->update));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)body->voting_procedures));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)body->proposal_procedures));
+}
@@ -26,7 +26,9 @@
 #include <cardano/transaction_body/transaction_input.h>
 
 #include "../allocators.h"
+#include "../cbor/cbor_fixed.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
 
 #include <assert.h>
@@ -106,7 +108,7 @@ cardano_transaction_input_new(
   }
 
   new_transaction_input->base.ref_count     = 1;
-  new_transaction_input->base.last_error[0] = '\0';
+  new_transaction_input->base.last_error    = NULL;
   new_transaction_input->base.deallocator   = cardano_transaction_input_deallocate;
 
   cardano_blake2b_hash_ref(id);
@@ -252,6 +254,22 @@ cardano_transaction_input_to_cbor(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_blake2b_hash_get_bytes_size(transaction_input->id) == (size_t)CARDANO_BLAKE2B_HASH_SIZE_256)
+  {
+    // [ bytes(32), index ], written in one append; inputs dominate the size of large transaction bodies
+    byte_t encoded[3U + (size_t)CARDANO_BLAKE2B_HASH_SIZE_256 + CARDANO_CBOR_FIXED_MAX_HEADER_SIZE] = {
+      CARDANO_CBOR_FIXED_ARRAY(TRANSACTION_INPUT_ARRAY_SIZE),
+      CARDANO_CBOR_FIXED_BYTESTRING_8BIT(CARDANO_BLAKE2B_HASH_SIZE_256)
+    };
+
+    (void)memcpy(&encoded[3], cardano_blake2b_hash_get_data(transaction_input->id), (size_t)CARDANO_BLAKE2B_HASH_SIZE_256);
+
+    const size_t size = 3U + (size_t)CARDANO_BLAKE2B_HASH_SIZE_256 +
+      cardano_cbor_fixed_put_uint(&encoded[3U + (size_t)CARDANO_BLAKE2B_HASH_SIZE_256], transaction_input->index);
+
+    return cardano_cbor_writer_write_encoded(writer, encoded, size);
+  }
+
   cardano_error_t write_start_array_result = cardano_cbor_writer_write_start_array(writer, TRANSACTION_INPUT_ARRAY_SIZE);
 
   if (write_start_array_result != CARDANO_SUCCESS)
@@ -297,6 +315,11 @@ cardano_transaction_input_set_id(cardano_transaction_input_t* input, cardano_bla
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&input->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (id == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -329,6 +352,11 @@ cardano_transaction_input_set_index(cardano_transaction_input_t* transaction_inp
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&transaction_input->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   transaction_input->index = index;
 
   return CARDANO_SUCCESS;
@@ -380,6 +408,28 @@ cardano_transaction_input_equals(const cardano_transaction_input_t* lhs, const c
   return cardano_transaction_input_compare(lhs, rhs) == 0;
 }
 
+void
+cardano_transaction_input_freeze(cardano_transaction_input_t* transaction_input)
+{
+  if (transaction_input == NULL)
+  {
+    return;
+  }
+
+  cardano_object_freeze(&transaction_input->base);
+}
+
+bool
+cardano_transaction_input_is_frozen(const cardano_transaction_input_t* transaction_input)
+{
+  if (transaction_input == NULL)
+  {
+    return false;
+  }
+
+  return cardano_object_is_frozen(&transaction_input->base);
+}
+
 void
 cardano_transaction_input_unref(cardano_transaction_input_t** transaction_input)
 {
@@ -430,4 +480,15 @@ const char*
 cardano_transaction_input_get_last_error(const cardano_transaction_input_t* transaction_input)
 {
   return cardano_object_get_last_error(&transaction_input->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_transaction_input_add_footprint(const cardano_transaction_input_t* input, cardano_footprint_context_t* context)
+{
+  if ((input == NULL) || !_cardano_footprint_visit(context, &input->base, CARDANO_MEMORY_FOOTPRINT_TYPE_TRANSACTION_INPUT, sizeof(cardano_transaction_input_t)))
+  {
+    return;
+  }
+
+  _cardano_blake2b_hash_add_footprint(input->id, context);
+}
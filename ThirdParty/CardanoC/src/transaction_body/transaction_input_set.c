@@ -27,10 +27,19 @@
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
 #include "../collections/array.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Lower bound of the encoded size of one input: a 32-byte transaction hash and its index. Caps what a
+ * definite length header can make us reserve.
+ */
+static const size_t MIN_INPUT_CBOR_SIZE = 36U;
+
 /* STRUCTURES ****************************************************************/
 
 /**
@@ -118,7 +127,7 @@ cardano_transaction_input_set_new(cardano_transaction_input_set_t** transaction_
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_transaction_input_set_deallocate;
 
   list->array    = cardano_array_new(128);
@@ -186,6 +195,14 @@ cardano_transaction_input_set_from_cbor(cardano_cbor_reader_t* reader, cardano_t
     return result;
   }
 
+  result = cardano_array_reserve(list->array, cardano_cbor_get_reserve_count(reader, length, MIN_INPUT_CBOR_SIZE));
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_transaction_input_set_unref(&list);
+    return result;
+  }
+
   state = CARDANO_CBOR_READER_STATE_UNDEFINED;
 
   while (state != CARDANO_CBOR_READER_STATE_END_ARRAY)
@@ -306,6 +323,17 @@ cardano_transaction_input_set_get_length(const cardano_transaction_input_set_t*
   return cardano_array_get_size(transaction_input_set->array);
 }
 
+cardano_error_t
+cardano_transaction_input_set_reserve(cardano_transaction_input_set_t* transaction_input_set, const size_t capacity)
+{
+  if (transaction_input_set == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return cardano_array_reserve(transaction_input_set->array, capacity);
+}
+
 cardano_error_t
 cardano_transaction_input_set_get(
   const cardano_transaction_input_set_t* transaction_input_set,
@@ -334,6 +362,17 @@ cardano_transaction_input_set_get(
   return CARDANO_SUCCESS;
 }
 
+cardano_transaction_input_t*
+cardano_transaction_input_set_peek(const cardano_transaction_input_set_t* transaction_input_set, const size_t index)
+{
+  if (transaction_input_set == NULL)
+  {
+    return NULL;
+  }
+
+  return (cardano_transaction_input_t*)((void*)cardano_array_peek(transaction_input_set->array, index));
+}
+
 cardano_error_t
 cardano_transaction_input_set_add(cardano_transaction_input_set_t* transaction_input_set, cardano_transaction_input_t* element)
 {
@@ -421,3 +460,23 @@ cardano_transaction_input_set_get_last_error(const cardano_transaction_input_set
 {
   return cardano_object_get_last_error(&transaction_input_set->base);
 }
+
+/**
+ * \brief Adds the footprint of an input stored in a set.
+ */
+static void
+add_input_footprint(const cardano_object_t* item, cardano_footprint_context_t* context)
+{
+  _cardano_transaction_input_add_footprint((const cardano_transaction_input_t*)((const void*)item), context);
+}
+
+void
+_cardano_transaction_input_set_add_footprint(const cardano_transaction_input_set_t* set, cardano_footprint_context_t* context)
+{
+  if ((set == NULL) || !_cardano_footprint_visit(context, &set->base, CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION, sizeof(cardano_transaction_input_set_t)))
+  {
+    return;
+  }
+
+  _cardano_array_add_footprint(set->array, context, add_input_footprint);
+}
@@ -21,17 +21,26 @@
 
 /* INCLUDES ******************************************************************/
 
+#include <cardano/address/address_cache.h>
 #include <cardano/crypto/blake2b_hash_size.h>
 #include <cardano/object.h>
 #include <cardano/transaction_body/transaction_output.h>
 
 #include "../allocators.h"
+#include "../cbor/cbor_fixed.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
 
 #include <assert.h>
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+/* The largest address written by the single-append encoder; Shelley addresses are at most 57 bytes, and larger
+ * (Byron) addresses take the generic path. */
+#define TRANSACTION_OUTPUT_FIXED_ADDRESS_SIZE 128U
+
 /* STRUCTURES ****************************************************************/
 
 /**
@@ -78,6 +87,24 @@ cardano_transaction_output_deallocate(void* object)
   _cardano_free(object);
 }
 
+/**
+ * \brief Checks whether a value holds any native asset, that is, whether it is encoded as more than its coin.
+ *
+ * \param[in] value The value to check.
+ *
+ * \return \c true if the value has at least one policy.
+ */
+static bool
+has_assets(cardano_value_t* value)
+{
+  cardano_multi_asset_t* multi_asset = cardano_value_get_multi_asset(value);
+  const bool             has_policy  = (multi_asset != NULL) && (cardano_multi_asset_get_policy_count(multi_asset) > 0U);
+
+  cardano_multi_asset_unref(&multi_asset);
+
+  return has_policy;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -114,7 +141,7 @@ cardano_transaction_output_new(
   }
 
   new_transaction_output->base.ref_count     = 1;
-  new_transaction_output->base.last_error[0] = '\0';
+  new_transaction_output->base.last_error    = NULL;
   new_transaction_output->base.deallocator   = cardano_transaction_output_deallocate;
   new_transaction_output->address            = NULL;
   new_transaction_output->datum              = NULL;
@@ -230,7 +257,7 @@ cardano_transaction_output_from_cbor(cardano_cbor_reader_t* reader, cardano_tran
             return read_address_result;
           }
 
-          const cardano_error_t address_from_bytes_result = cardano_address_from_bytes(cardano_buffer_get_data(address_bytes), cardano_buffer_get_size(address_bytes), &address);
+          const cardano_error_t address_from_bytes_result = cardano_address_intern_from_bytes(cardano_buffer_get_data(address_bytes), cardano_buffer_get_size(address_bytes), &address);
 
           cardano_buffer_unref(&address_bytes);
 
@@ -435,7 +462,7 @@ cardano_transaction_output_from_cbor(cardano_cbor_reader_t* reader, cardano_tran
       return read_address_result;
     }
 
-    const cardano_error_t address_from_bytes_result = cardano_address_from_bytes(cardano_buffer_get_data(address_bytes), cardano_buffer_get_size(address_bytes), &address);
+    const cardano_error_t address_from_bytes_result = cardano_address_intern_from_bytes(cardano_buffer_get_data(address_bytes), cardano_buffer_get_size(address_bytes), &address);
 
     cardano_buffer_unref(&address_bytes);
 
@@ -548,6 +575,28 @@ cardano_transaction_output_to_cbor(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if ((transaction_output->datum == NULL) && (transaction_output->script_ref == NULL))
+  {
+    const size_t address_size = cardano_address_get_bytes_size(transaction_output->address);
+
+    if ((transaction_output->value != NULL) && (address_size <= TRANSACTION_OUTPUT_FIXED_ADDRESS_SIZE) && !has_assets(transaction_output->value))
+    {
+      // { 0: bytes(address), 1: coin }, the shape of payments and change; written in one append
+      byte_t encoded[2U + CARDANO_CBOR_FIXED_MAX_HEADER_SIZE + TRANSACTION_OUTPUT_FIXED_ADDRESS_SIZE + 1U + CARDANO_CBOR_FIXED_MAX_HEADER_SIZE] = {
+        CARDANO_CBOR_FIXED_MAP(2),
+        0x00U
+      };
+
+      size_t size = 2U;
+      size += cardano_cbor_fixed_put_bytestring(&encoded[size], cardano_address_get_bytes(transaction_output->address), address_size);
+      encoded[size] = 0x01U;
+      ++size;
+      size += cardano_cbor_fixed_put_uint(&encoded[size], (uint64_t)cardano_value_get_coin(transaction_output->value));
+
+      return cardano_cbor_writer_write_encoded(writer, encoded, size);
+    }
+  }
+
   int64_t map_size = 2;
 
   if (transaction_output->datum != NULL)
@@ -687,6 +736,11 @@ cardano_transaction_output_set_address(cardano_transaction_output_t* output, car
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&output->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (address == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -721,6 +775,11 @@ cardano_transaction_output_set_value(cardano_transaction_output_t* output, carda
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&output->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (value == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -755,6 +814,11 @@ cardano_transaction_output_set_datum(cardano_transaction_output_t* output, carda
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&output->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_datum_ref(datum);
   cardano_datum_unref(&output->datum);
 
@@ -784,6 +848,11 @@ cardano_transaction_output_set_script_ref(cardano_transaction_output_t* output,
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&output->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_script_ref(script_ref);
   cardano_script_unref(&output->script_ref);
 
@@ -830,6 +899,34 @@ cardano_transaction_output_equals(
   return true;
 }
 
+void
+cardano_transaction_output_freeze(cardano_transaction_output_t* transaction_output)
+{
+  if (transaction_output == NULL)
+  {
+    return;
+  }
+
+  cardano_object_freeze(&transaction_output->base);
+
+  cardano_value_freeze(transaction_output->value);
+  cardano_script_freeze(transaction_output->script_ref);
+
+  cardano_object_freeze((cardano_object_t*)((void*)transaction_output->address));
+  cardano_object_freeze((cardano_object_t*)((void*)transaction_output->datum));
+}
+
+bool
+cardano_transaction_output_is_frozen(const cardano_transaction_output_t* transaction_output)
+{
+  if (transaction_output == NULL)
+  {
+    return false;
+  }
+
+  return cardano_object_is_frozen(&transaction_output->base);
+}
+
 void
 cardano_transaction_output_unref(cardano_transaction_output_t** transaction_output)
 {
@@ -880,4 +977,18 @@ const char*
 cardano_transaction_output_get_last_error(const cardano_transaction_output_t* transaction_output)
 {
   return cardano_object_get_last_error(&transaction_output->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_transaction_output_add_footprint(const cardano_transaction_output_t* output, cardano_footprint_context_t* context)
+{
+  if ((output == NULL) || !_cardano_footprint_visit(context, &output->base, CARDANO_MEMORY_FOOTPRINT_TYPE_TRANSACTION_OUTPUT, sizeof(cardano_transaction_output_t)))
+  {
+    return;
+  }
+
+  _cardano_address_add_footprint(output->address, context);
+  _cardano_value_add_footprint(output->value, context);
+  _cardano_datum_add_footprint(output->datum, context);
+  _cardano_script_add_footprint(output->script_ref, context);
+}
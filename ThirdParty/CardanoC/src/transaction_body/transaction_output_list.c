@@ -28,10 +28,19 @@
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
 #include "../collections/array.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Lower bound of the encoded size of one output: an enterprise address and a coin. Caps what a definite
+ * length header can make us reserve.
+ */
+static const size_t MIN_OUTPUT_CBOR_SIZE = 32U;
+
 /* STRUCTURES ****************************************************************/
 
 /**
@@ -91,7 +100,7 @@ cardano_transaction_output_list_new(cardano_transaction_output_list_t** transact
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_transaction_output_list_deallocate;
 
   list->array = cardano_array_new(128);
@@ -131,7 +140,13 @@ cardano_transaction_output_list_from_cbor(cardano_cbor_reader_t* reader, cardano
   int64_t length = 0;
   result         = cardano_cbor_reader_read_start_array(reader, &length);
 
-  CARDANO_UNUSED(length);
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_transaction_output_list_unref(&list);
+    return result;
+  }
+
+  result = cardano_array_reserve(list->array, cardano_cbor_get_reserve_count(reader, length, MIN_OUTPUT_CBOR_SIZE));
 
   if (result != CARDANO_SUCCESS)
   {
@@ -250,6 +265,17 @@ cardano_transaction_output_list_get_length(const cardano_transaction_output_list
   return cardano_array_get_size(transaction_output_list->array);
 }
 
+cardano_error_t
+cardano_transaction_output_list_reserve(cardano_transaction_output_list_t* transaction_output_list, const size_t capacity)
+{
+  if (transaction_output_list == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  return cardano_array_reserve(transaction_output_list->array, capacity);
+}
+
 cardano_error_t
 cardano_transaction_output_list_get(
   const cardano_transaction_output_list_t* transaction_output_list,
@@ -278,6 +304,17 @@ cardano_transaction_output_list_get(
   return CARDANO_SUCCESS;
 }
 
+cardano_transaction_output_t*
+cardano_transaction_output_list_peek(const cardano_transaction_output_list_t* transaction_output_list, const size_t index)
+{
+  if (transaction_output_list == NULL)
+  {
+    return NULL;
+  }
+
+  return (cardano_transaction_output_t*)((void*)cardano_array_peek(transaction_output_list->array, index));
+}
+
 cardano_error_t
 cardano_transaction_output_list_add(cardano_transaction_output_list_t* transaction_output_list, cardano_transaction_output_t* element)
 {
@@ -352,3 +389,23 @@ cardano_transaction_output_list_get_last_error(const cardano_transaction_output_
 {
   return cardano_object_get_last_error(&transaction_output_list->base);
 }
+
+/**
+ * \brief Adds the footprint of an output stored in a list.
+ */
+static void
+add_output_footprint(const cardano_object_t* item, cardano_footprint_context_t* context)
+{
+  _cardano_transaction_output_add_footprint((const cardano_transaction_output_t*)((const void*)item), context);
+}
+
+void
+_cardano_transaction_output_list_add_footprint(const cardano_transaction_output_list_t* list, cardano_footprint_context_t* context)
+{
+  if ((list == NULL) || !_cardano_footprint_visit(context, &list->base, CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION, sizeof(cardano_transaction_output_list_t)))
+  {
+    return;
+  }
+
+  _cardano_array_add_footprint(list->array, context, add_output_footprint);
+}
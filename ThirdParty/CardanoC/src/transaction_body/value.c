@@ -33,6 +33,7 @@
 
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
@@ -84,6 +85,47 @@ cardano_value_deallocate(void* object)
   _cardano_free(object);
 }
 
+/**
+ * \brief Gives a value a multi asset of its own, copying it if it is shared, so it can be updated in place.
+ *
+ * \param[in,out] value The value whose assets are about to change.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+make_multi_asset_unique(cardano_value_t* value)
+{
+  if ((value->multi_asset != NULL) && (cardano_multi_asset_refcount(value->multi_asset) <= 1U))
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_multi_asset_t* copy = NULL;
+
+  cardano_error_t create_result = cardano_multi_asset_new(&copy);
+
+  if (create_result != CARDANO_SUCCESS)
+  {
+    return create_result;
+  }
+
+  if (value->multi_asset != NULL)
+  {
+    cardano_error_t copy_result = cardano_multi_asset_add_assign(copy, value->multi_asset);
+
+    if (copy_result != CARDANO_SUCCESS)
+    {
+      cardano_multi_asset_unref(&copy);
+      return copy_result;
+    }
+  }
+
+  cardano_multi_asset_unref(&value->multi_asset);
+  value->multi_asset = copy;
+
+  return CARDANO_SUCCESS;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -105,7 +147,7 @@ cardano_value_new(
   }
 
   new_value->base.ref_count     = 1;
-  new_value->base.last_error[0] = '\0';
+  new_value->base.last_error    = NULL;
   new_value->base.deallocator   = cardano_value_deallocate;
   new_value->coin               = coin;
   new_value->multi_asset        = NULL;
@@ -383,6 +425,11 @@ cardano_value_set_multi_asset(cardano_value_t* value, cardano_multi_asset_t* ass
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&value->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   cardano_multi_asset_ref(assets);
   cardano_multi_asset_unref(&value->multi_asset);
   value->multi_asset = assets;
@@ -409,6 +456,11 @@ cardano_value_set_coin(cardano_value_t* value, const int64_t coin)
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&value->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   value->coin = coin;
 
   return CARDANO_SUCCESS;
@@ -422,6 +474,11 @@ cardano_value_add_coin(cardano_value_t* value, const int64_t coin)
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&value->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   value->coin += coin;
 
   return CARDANO_SUCCESS;
@@ -435,6 +492,11 @@ cardano_value_subtract_coin(cardano_value_t* value, const int64_t coin)
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&value->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   value->coin -= coin;
 
   return CARDANO_SUCCESS;
@@ -448,6 +510,11 @@ cardano_value_add_multi_asset(cardano_value_t* value, cardano_multi_asset_t* mul
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&value->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (multi_asset == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -475,6 +542,11 @@ cardano_value_subtract_multi_asset(cardano_value_t* value, cardano_multi_asset_t
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&value->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (multi_asset == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -506,6 +578,11 @@ cardano_value_add_asset(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&value->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (policy_id == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -543,6 +620,11 @@ cardano_value_add_asset_ex(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&value->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (policy_id_hex == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -592,6 +674,11 @@ cardano_value_add_asset_with_id(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&value->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (asset_id == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -622,6 +709,11 @@ cardano_value_add_asset_with_id_ex(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  if (cardano_object_is_frozen(&value->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
   if (asset_id_hex == NULL)
   {
     return CARDANO_ERROR_POINTER_IS_NULL;
@@ -689,6 +781,72 @@ cardano_value_add(cardano_value_t* lhs, cardano_value_t* rhs, cardano_value_t**
   return new_value_result;
 }
 
+cardano_error_t
+cardano_value_add_assign(cardano_value_t* value, const cardano_value_t* rhs)
+{
+  if (value == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (rhs == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (cardano_object_is_frozen(&value->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
+  if ((rhs->multi_asset != NULL) && (cardano_multi_asset_get_policy_count(rhs->multi_asset) > 0U))
+  {
+    cardano_error_t unique_result = make_multi_asset_unique(value);
+
+    if (unique_result != CARDANO_SUCCESS)
+    {
+      return unique_result;
+    }
+
+    cardano_error_t add_result = cardano_multi_asset_add_assign(value->multi_asset, rhs->multi_asset);
+
+    if (add_result != CARDANO_SUCCESS)
+    {
+      return add_result;
+    }
+  }
+
+  value->coin += rhs->coin;
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_value_clear(cardano_value_t* value)
+{
+  if (value == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (cardano_object_is_frozen(&value->base))
+  {
+    return CARDANO_ERROR_OBJECT_IS_FROZEN;
+  }
+
+  value->coin = 0;
+
+  // A multi asset shared with another object is let go rather than emptied under it
+  if ((value->multi_asset != NULL) && (cardano_multi_asset_refcount(value->multi_asset) <= 1U))
+  {
+    return cardano_multi_asset_clear(value->multi_asset);
+  }
+
+  cardano_multi_asset_unref(&value->multi_asset);
+
+  return cardano_multi_asset_new(&value->multi_asset);
+}
+
 cardano_error_t
 cardano_value_subtract(cardano_value_t* lhs, cardano_value_t* rhs, cardano_value_t** result)
 {
@@ -1218,6 +1376,29 @@ cardano_value_equals(const cardano_value_t* lhs, const cardano_value_t* rhs)
   return cardano_multi_asset_equals(lhs->multi_asset, rhs->multi_asset);
 }
 
+void
+cardano_value_freeze(cardano_value_t* value)
+{
+  if (value == NULL)
+  {
+    return;
+  }
+
+  cardano_object_freeze(&value->base);
+  cardano_object_freeze((cardano_object_t*)((void*)value->multi_asset));
+}
+
+bool
+cardano_value_is_frozen(const cardano_value_t* value)
+{
+  if (value == NULL)
+  {
+    return false;
+  }
+
+  return cardano_object_is_frozen(&value->base);
+}
+
 void
 cardano_value_unref(cardano_value_t** value)
 {
@@ -1268,4 +1449,15 @@ const char*
 cardano_value_get_last_error(const cardano_value_t* value)
 {
   return cardano_object_get_last_error(&value->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_value_add_footprint(const cardano_value_t* value, cardano_footprint_context_t* context)
+{
+  if ((value == NULL) || !_cardano_footprint_visit(context, &value->base, CARDANO_MEMORY_FOOTPRINT_TYPE_VALUE, sizeof(cardano_value_t)))
+  {
+    return;
+  }
+
+  _cardano_multi_asset_add_footprint(value->multi_asset, context);
+}
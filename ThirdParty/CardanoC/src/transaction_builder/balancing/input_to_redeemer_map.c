@@ -126,7 +126,7 @@ cardano_input_to_redeemer_map_new(cardano_input_to_redeemer_map_t** input_to_red
   }
 
   (*input_to_redeemer_map)->base.ref_count     = 1;
-  (*input_to_redeemer_map)->base.last_error[0] = '\0';
+  (*input_to_redeemer_map)->base.last_error    = NULL;
   (*input_to_redeemer_map)->base.deallocator   = cardano_input_to_redeemer_map_deallocate;
 
   (*input_to_redeemer_map)->array = cardano_array_new(32);
@@ -222,7 +222,7 @@ cardano_input_to_redeemer_map_insert(
   }
 
   kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
+  kvp->base.last_error    = NULL;
   kvp->base.deallocator   = cardano_input_to_redeemer_map_kvp_deallocate;
   kvp->key                = key;
   kvp->value              = value;
@@ -26,8 +26,388 @@
 #include <cardano/common/utxo.h>
 #include <cardano/transaction_builder/coin_selection/large_first_coin_selector.h>
 
+#include "../../../allocators.h"
+
 #include <cardano/transaction_builder/fee.h>
 #include <math.h>
+#include <string.h>
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Gets the lovelace held by a UTxO.
+ *
+ * \param[in] utxo The UTxO.
+ *
+ * \return The lovelace of the UTxO, 0 if it has none.
+ */
+static uint64_t
+get_utxo_coin(cardano_utxo_t* utxo)
+{
+  cardano_transaction_output_t* output = cardano_utxo_get_output(utxo);
+  cardano_value_t*              value  = cardano_transaction_output_get_value(output);
+
+  cardano_transaction_output_unref(&output);
+  cardano_value_unref(&value);
+
+  const int64_t coin = cardano_value_get_coin(value);
+
+  return (coin > 0) ? (uint64_t)coin : 0U;
+}
+
+/**
+ * \brief Tells whether a UTxO holds lovelace and nothing else.
+ *
+ * \param[in] utxo The UTxO.
+ * \param[in] context Unused.
+ *
+ * \return true if the UTxO holds no native assets.
+ */
+static bool
+is_ada_only(cardano_utxo_t* utxo, const void* context)
+{
+  CARDANO_UNUSED(context);
+
+  cardano_transaction_output_t* output = cardano_utxo_get_output(utxo);
+  cardano_value_t*              value  = cardano_transaction_output_get_value(output);
+  cardano_multi_asset_t*        assets = cardano_value_get_multi_asset(value);
+
+  cardano_transaction_output_unref(&output);
+  cardano_value_unref(&value);
+
+  const bool has_assets = cardano_multi_asset_get_policy_count(assets) > 0U;
+
+  cardano_multi_asset_unref(&assets);
+
+  return !has_assets;
+}
+
+/**
+ * \brief Orders UTxOs by increasing lovelace.
+ */
+static int
+compare_by_coin(cardano_utxo_t* lhs, cardano_utxo_t* rhs, void* context)
+{
+  CARDANO_UNUSED(context);
+
+  const uint64_t lhs_coin = get_utxo_coin(lhs);
+  const uint64_t rhs_coin = get_utxo_coin(rhs);
+
+  if (lhs_coin == rhs_coin)
+  {
+    return 0;
+  }
+
+  return (lhs_coin < rhs_coin) ? -1 : 1;
+}
+
+/**
+ * \brief Tells whether collateral inputs holding `coin` lovelace can cover `amount` exactly or with a valid return.
+ *
+ * \param[in] coin The lovelace of the collateral inputs.
+ * \param[in] amount The total collateral.
+ * \param[in] min_return The least lovelace a collateral return output can hold.
+ *
+ * \return true if the inputs cover the amount.
+ */
+static bool
+is_covering(const uint64_t coin, const uint64_t amount, const uint64_t min_return)
+{
+  return (coin == amount) || ((coin > amount) && ((coin - amount) >= min_return));
+}
+
+/**
+ * \brief Finds the first candidate holding at least `coin` lovelace that is not already picked.
+ *
+ * \param[in] cache The cache whose candidates are searched.
+ * \param[in] end The number of candidates to search, from the first.
+ * \param[in] coin The least lovelace to look for.
+ * \param[in] picked The indices of the picked candidates.
+ * \param[in] picked_count The number of picked candidates.
+ *
+ * \return The index of the candidate, or `end` if there is none.
+ */
+static size_t
+find_unpicked(
+  const cardano_collateral_cache_t* cache,
+  const size_t                      end,
+  const uint64_t                    coin,
+  const size_t*                     picked,
+  const size_t                      picked_count)
+{
+  size_t low  = 0U;
+  size_t high = end;
+
+  while (low < high)
+  {
+    const size_t middle = low + ((high - low) / 2U);
+
+    if (cache->coins[middle] < coin)
+    {
+      low = middle + 1U;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+
+  for (; low < end; ++low)
+  {
+    bool is_picked = false;
+
+    for (size_t i = 0U; (i < picked_count) && !is_picked; ++i)
+    {
+      is_picked = picked[i] == low;
+    }
+
+    if (!is_picked)
+    {
+      break;
+    }
+  }
+
+  return low;
+}
+
+/**
+ * \brief Finds the candidate that, added to collateral inputs holding `coin` lovelace, covers `amount` with the least
+ * lovelace.
+ *
+ * \param[in] cache The cache whose candidates are searched.
+ * \param[in] end The number of candidates to search, from the first.
+ * \param[in] coin The lovelace of the collateral inputs without the candidate.
+ * \param[in] amount The total collateral.
+ * \param[in] picked The indices of the candidates already in the collateral inputs.
+ * \param[in] picked_count The number of candidates in the collateral inputs.
+ *
+ * \return The index of the candidate, or `end` if none covers the amount.
+ */
+static size_t
+find_completion(
+  const cardano_collateral_cache_t* cache,
+  const size_t                      end,
+  const uint64_t                    coin,
+  const uint64_t                    amount,
+  const size_t*                     picked,
+  const size_t                      picked_count)
+{
+  // A candidate matching the amount exactly needs no return output, and holds less than any that needs one
+  if (coin < amount)
+  {
+    const size_t exact = find_unpicked(cache, end, amount - coin, picked, picked_count);
+
+    if ((exact < end) && (cache->coins[exact] == (amount - coin)))
+    {
+      return exact;
+    }
+  }
+
+  const uint64_t least = amount + cache->min_return;
+
+  return find_unpicked(cache, end, (coin < least) ? (least - coin) : 0U, picked, picked_count);
+}
+
+/**
+ * \brief Picks the fewest candidates covering the collateral amount, then lowers their lovelace.
+ *
+ * For each number of inputs up to the limit, the largest candidates are completed by the smallest one that covers the
+ * amount; the first count that succeeds is kept. Each of the large candidates is then swapped for the smallest unpicked
+ * one that still covers the amount. This bounds the search by the number of inputs rather than by the amounts.
+ *
+ * \param[in] cache The cache holding the sorted candidates.
+ * \param[in] amount The total collateral.
+ * \param[in] max_inputs The most collateral inputs the transaction can have.
+ * \param[out] picked The indices of the picked candidates; must hold `max_inputs` entries.
+ * \param[out] picked_count The number of picked candidates.
+ * \param[out] picked_coin The lovelace of the picked candidates.
+ *
+ * \return true if the candidates could cover the amount.
+ */
+static bool
+pick_candidates(
+  const cardano_collateral_cache_t* cache,
+  const uint64_t                    amount,
+  const size_t                      max_inputs,
+  size_t*                           picked,
+  size_t*                           picked_count,
+  uint64_t*                         picked_coin)
+{
+  const size_t count = cache->candidate_count;
+  uint64_t     top   = 0U;
+
+  for (size_t inputs = 1U; inputs <= max_inputs; ++inputs)
+  {
+    const size_t end = count - (inputs - 1U);
+
+    if (inputs > 1U)
+    {
+      top += cache->coins[end];
+      picked[inputs - 2U] = end;
+    }
+
+    const size_t last = find_completion(cache, end, top, amount, picked, 0U);
+
+    if (last >= end)
+    {
+      continue;
+    }
+
+    picked[inputs - 1U] = last;
+    *picked_count       = inputs;
+    *picked_coin        = top + cache->coins[last];
+
+    // The large candidates were picked largest first, so the earliest swaps save the most
+    for (size_t i = 0U; (i + 1U) < inputs; ++i)
+    {
+      const uint64_t rest        = *picked_coin - cache->coins[picked[i]];
+      const size_t   replacement = find_completion(cache, picked[i], rest, amount, picked, inputs);
+
+      if (replacement < picked[i])
+      {
+        *picked_coin = rest + cache->coins[replacement];
+        picked[i]    = replacement;
+      }
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * \brief Collects the ada-only collateral candidates, sorted by increasing lovelace, and the least return they allow.
+ *
+ * \param[in,out] cache The cache to fill.
+ * \param[in] available_collateral_outputs The UTxOs that can be used as collateral.
+ * \param[in] protocol_params The protocol parameters.
+ * \param[in] change_address The address of the collateral return output.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+index_candidates(
+  cardano_collateral_cache_t*    cache,
+  cardano_utxo_list_t*           available_collateral_outputs,
+  cardano_protocol_parameters_t* protocol_params,
+  cardano_address_t*             change_address)
+{
+  cardano_utxo_list_t* candidates = cardano_utxo_list_filter(available_collateral_outputs, is_ada_only, NULL);
+
+  if (candidates == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_utxo_list_sort(candidates, compare_by_coin, NULL);
+
+  const size_t count = cardano_utxo_list_get_length(candidates);
+  uint64_t*    coins = (uint64_t*)_cardano_malloc((count + 1U) * sizeof(uint64_t));
+
+  if (coins == NULL)
+  {
+    cardano_utxo_list_unref(&candidates);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  uint64_t total_coin = 0U;
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    coins[i]    = get_utxo_coin(cardano_utxo_list_peek(candidates, i));
+    total_coin += coins[i];
+  }
+
+  // The return output never holds more than all the candidates, so its minimum at that coin bounds every return
+  cardano_transaction_output_t* output = NULL;
+  cardano_error_t               result = cardano_transaction_output_new(change_address, total_coin, &output);
+  uint64_t                      min_return = 0U;
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_compute_min_ada_required(output, cardano_protocol_parameters_get_ada_per_utxo_byte(protocol_params), &min_return);
+  }
+
+  cardano_transaction_output_unref(&output);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    _cardano_free(coins);
+    cardano_utxo_list_unref(&candidates);
+
+    return result;
+  }
+
+  cache->candidates      = candidates;
+  cache->coins           = coins;
+  cache->candidate_count = count;
+  cache->min_return      = min_return;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Chooses the collateral inputs covering an amount among the cached candidates.
+ *
+ * \param[in,out] cache The cache whose candidates are chosen from, and which keeps the choice.
+ * \param[in] amount The total collateral.
+ * \param[in] max_inputs The most collateral inputs the transaction can have.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_BALANCE_INSUFFICIENT if the candidates cannot cover the
+ *         amount in that many inputs, or another appropriate error code.
+ */
+static cardano_error_t
+choose_collateral(cardano_collateral_cache_t* cache, const uint64_t amount, const size_t max_inputs)
+{
+  cardano_utxo_list_unref(&cache->selection);
+  cache->selection = NULL;
+
+  const size_t limit = ((max_inputs == 0U) || (max_inputs > cache->candidate_count)) ? cache->candidate_count : max_inputs;
+
+  if (limit == 0U)
+  {
+    return CARDANO_ERROR_BALANCE_INSUFFICIENT;
+  }
+
+  size_t* picked = (size_t*)_cardano_malloc(limit * sizeof(size_t));
+
+  if (picked == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  size_t   picked_count = 0U;
+  uint64_t picked_coin  = 0U;
+
+  if (!pick_candidates(cache, amount, limit, picked, &picked_count, &picked_coin))
+  {
+    _cardano_free(picked);
+    return CARDANO_ERROR_BALANCE_INSUFFICIENT;
+  }
+
+  cardano_utxo_list_t* selection = NULL;
+  cardano_error_t      result    = cardano_utxo_list_new(&selection);
+
+  for (size_t i = 0U; (i < picked_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    result = cardano_utxo_list_add(selection, cardano_utxo_list_peek(cache->candidates, picked[i]));
+  }
+
+  _cardano_free(picked);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(&selection);
+    return result;
+  }
+
+  cache->selection     = selection;
+  cache->selected_coin = picked_coin;
+  cache->least_amount  = amount;
+
+  return CARDANO_SUCCESS;
+}
 
 /* IMPLEMENTATION ************************************************************/
 
@@ -61,20 +441,14 @@ _cardano_coalesce_all_utxos(cardano_utxo_list_t* utxos, cardano_value_t** total_
     cardano_transaction_output_unref(&output);
     cardano_value_unref(&value);
 
-    cardano_value_t* tmp_value = NULL;
-
-    result = cardano_value_add(total_value, value, &tmp_value);
+    result = cardano_value_add_assign(total_value, value);
 
     if (result != CARDANO_SUCCESS)
     {
-      cardano_value_unref(&tmp_value);
       cardano_value_unref(&total_value);
 
       return result;
     }
-
-    cardano_value_unref(&total_value);
-    total_value = tmp_value;
   }
 
   *total_output_value = total_value;
@@ -206,14 +580,12 @@ _cardano_update_transaction_body_collateral(
     return result;
   }
 
-  if (change_output != NULL)
-  {
-    result = cardano_transaction_body_set_collateral_return(body, change_output);
+  // A NULL output removes the return a previous iteration may have set
+  result = cardano_transaction_body_set_collateral_return(body, change_output);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      return result;
-    }
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
   }
 
   cardano_transaction_input_set_t* collateral_inputs = _cardano_utxo_list_to_input_set(selection);
@@ -361,4 +733,97 @@ _cardano_set_collateral_output(
   cardano_coin_selector_unref(&coin_selector);
 
   return CARDANO_SUCCESS;
-}
\ No newline at end of file
+}
+cardano_error_t
+_cardano_set_cached_collateral_output(
+  cardano_collateral_cache_t*    cache,
+  cardano_transaction_t*         tx,
+  cardano_protocol_parameters_t* protocol_params,
+  cardano_utxo_list_t*           available_collateral_outputs,
+  cardano_address_t*             change_address)
+{
+  if ((cache == NULL) || (tx == NULL) || (protocol_params == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if ((cardano_utxo_list_get_length(available_collateral_outputs) == 0U) || (change_address == NULL))
+  {
+    return _cardano_set_collateral_output(tx, protocol_params, available_collateral_outputs, change_address);
+  }
+
+  cardano_transaction_body_t* body = cardano_transaction_get_body(tx);
+  cardano_transaction_body_unref(&body);
+
+  const uint64_t fee                   = cardano_transaction_body_get_fee(body);
+  const uint64_t collateral_percentage = cardano_protocol_parameters_get_collateral_percentage(protocol_params);
+  const uint64_t collateral_amount     = _cardano_calculate_collateral_amount(fee, collateral_percentage);
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (cache->candidates == NULL)
+  {
+    result = index_candidates(cache, available_collateral_outputs, protocol_params, change_address);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  // The choice holds until the amount outgrows what it can return change for, or falls below what it was made for
+  const bool is_reusable = (cache->selection != NULL) && (collateral_amount >= cache->least_amount) &&
+    is_covering(cache->selected_coin, collateral_amount, cache->min_return);
+
+  if (!is_reusable)
+  {
+    const size_t max_inputs = (size_t)cardano_protocol_parameters_get_max_collateral_inputs(protocol_params);
+
+    result = choose_collateral(cache, collateral_amount, max_inputs);
+
+    if (result == CARDANO_ERROR_BALANCE_INSUFFICIENT)
+    {
+      // Not enough lovelace-only UTxOs: select among all of them, returning the native assets
+      return _cardano_set_collateral_output(tx, protocol_params, available_collateral_outputs, change_address);
+    }
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  cardano_transaction_output_t* change_output = NULL;
+  const uint64_t                change_coin   = cache->selected_coin - collateral_amount;
+
+  if (change_coin > 0U)
+  {
+    result = cardano_transaction_output_new(change_address, change_coin, &change_output);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  result = _cardano_update_transaction_body_collateral(body, collateral_amount, change_output, cache->selection);
+
+  cardano_transaction_output_unref(&change_output);
+
+  return result;
+}
+
+void
+_cardano_collateral_cache_release(cardano_collateral_cache_t* cache)
+{
+  if (cache == NULL)
+  {
+    return;
+  }
+
+  cardano_utxo_list_unref(&cache->candidates);
+  cardano_utxo_list_unref(&cache->selection);
+  _cardano_free(cache->coins);
+
+  CARDANO_UNUSED(memset(cache, 0, sizeof(cardano_collateral_cache_t)));
+}
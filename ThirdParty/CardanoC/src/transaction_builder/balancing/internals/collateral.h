@@ -30,6 +30,26 @@
 #include <cardano/transaction/transaction.h>
 #include <cardano/typedefs.h>
 
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief What collateral selection keeps from one iteration of the balancing loop to the next.
+ *
+ * The collateral UTxOs do not change while a transaction is balanced, so the lovelace-only ones are collected and
+ * sorted once. The inputs chosen for one collateral amount are kept while they cover the amounts of later iterations,
+ * which only move with the fee.
+ */
+typedef struct cardano_collateral_cache_t
+{
+    cardano_utxo_list_t* candidates;
+    uint64_t*            coins;
+    size_t               candidate_count;
+    uint64_t             min_return;
+    cardano_utxo_list_t* selection;
+    uint64_t             selected_coin;
+    uint64_t             least_amount;
+} cardano_collateral_cache_t;
+
 /* DECLARATIONS **************************************************************/
 
 /**
@@ -135,4 +155,38 @@ _cardano_set_collateral_output(
   cardano_utxo_list_t*           available_collateral_outputs,
   cardano_address_t*             change_address);
 
+/**
+ * \brief Sets the collateral of a transaction being balanced, reusing what the cache knows.
+ *
+ * The collateral is taken from the lovelace-only UTxOs: the fewest of them, up to the maximum number of collateral
+ * inputs of the protocol parameters, that cover the amount either exactly or with a valid return output, preferring
+ * the ones holding the least lovelace. The inputs chosen are kept for the next calls while they still cover the
+ * amount. When no such inputs exist, this falls back to \ref _cardano_set_collateral_output.
+ *
+ * \param[in,out] cache The cache. Must be zero-initialized before the first call, then released with
+ *                      \ref _cardano_collateral_cache_release. Must be used with the same collateral UTxOs and
+ *                      change address on every call.
+ * \param[in,out] tx The transaction where the collateral will be set.
+ * \param[in] protocol_params The protocol parameters.
+ * \param[in] available_collateral_outputs The UTxOs that can be used as collateral.
+ * \param[in] change_address The address of the collateral return output.
+ *
+ * \return \ref CARDANO_SUCCESS if the collateral was set, or an appropriate error code indicating the failure reason.
+ */
+cardano_error_t
+_cardano_set_cached_collateral_output(
+  cardano_collateral_cache_t*    cache,
+  cardano_transaction_t*         tx,
+  cardano_protocol_parameters_t* protocol_params,
+  cardano_utxo_list_t*           available_collateral_outputs,
+  cardano_address_t*             change_address);
+
+/**
+ * \brief Releases what a collateral cache holds, leaving it zero-initialized.
+ *
+ * \param[in,out] cache The cache to release.
+ */
+void
+_cardano_collateral_cache_release(cardano_collateral_cache_t* cache);
+
 #endif // BIGLUP_LABS_INCLUDE_CARDANO_COLLATERAL_H
\ No newline at end of file
@@ -0,0 +1,221 @@
+/**
+ * \file evaluation_cache.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "evaluation_cache.h"
+
+#include <cardano/buffer.h>
+#include <cardano/cbor/cbor_writer.h>
+#include <cardano/crypto/blake2b_hash_size.h>
+#include <cardano/transaction_body/transaction_body.h>
+#include <cardano/transaction_body/transaction_input_set.h>
+#include <cardano/transaction_body/transaction_output_list.h>
+#include <cardano/witness_set/redeemer.h>
+#include <cardano/witness_set/witness_set.h>
+
+#include <string.h>
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Writes an input set, or null when the body has none.
+ *
+ * \param[in] inputs The input set; may be NULL. The reference is released.
+ * \param[in] writer The writer of the digest.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of the writer.
+ */
+static cardano_error_t
+write_input_set(cardano_transaction_input_set_t* inputs, cardano_cbor_writer_t* writer)
+{
+  cardano_error_t result = (inputs != NULL)
+    ? cardano_transaction_input_set_to_cbor(inputs, writer)
+    : cardano_cbor_writer_write_null(writer);
+
+  cardano_transaction_input_set_unref(&inputs);
+
+  return result;
+}
+
+/**
+ * \brief Hashes the parts of a transaction that change between balancing iterations and that its scripts see.
+ *
+ * \param[in] tx The transaction.
+ * \param[out] hash On success, the Blake2b-256 digest.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error of the serialization or of the hash.
+ */
+static cardano_error_t
+compute_context_hash(cardano_transaction_t* tx, cardano_blake2b_hash_t** hash)
+{
+  cardano_transaction_body_t* body = cardano_transaction_get_body(tx);
+  cardano_transaction_body_unref(&body);
+
+  cardano_witness_set_t* witnesses = cardano_transaction_get_witness_set(tx);
+  cardano_witness_set_unref(&witnesses);
+
+  if ((body == NULL) || (witnesses == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_transaction_output_list_t* outputs = cardano_transaction_body_get_outputs(body);
+  const size_t                       output_count = cardano_transaction_output_list_get_length(outputs);
+  cardano_transaction_output_list_unref(&outputs);
+
+  cardano_redeemer_list_t* redeemers = cardano_witness_set_get_redeemers(witnesses);
+  const size_t             redeemer_count = cardano_redeemer_list_get_length(redeemers);
+
+  cardano_error_t result = write_input_set(cardano_transaction_body_get_inputs(body), writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = write_input_set(cardano_transaction_body_get_reference_inputs(body), writer);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = write_input_set(cardano_transaction_body_get_collateral(body), writer);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_write_uint(writer, output_count);
+  }
+
+  // Only the pointers: the data of the redeemers is fixed for the balancing, and their units are what gets evaluated
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < redeemer_count); ++i)
+  {
+    const cardano_redeemer_t* redeemer = cardano_redeemer_list_peek(redeemers, i);
+
+    result = (redeemer != NULL)
+      ? cardano_cbor_writer_write_uint(writer, (uint64_t)cardano_redeemer_get_tag(redeemer))
+      : CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_writer_write_uint(writer, cardano_redeemer_get_index(redeemer));
+    }
+  }
+
+  cardano_redeemer_list_unref(&redeemers);
+
+  cardano_buffer_t* encoded = NULL;
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_encode_in_buffer(writer, &encoded);
+  }
+
+  cardano_cbor_writer_unref(&writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_blake2b_compute_hash(
+      cardano_buffer_get_data(encoded),
+      cardano_buffer_get_size(encoded),
+      CARDANO_BLAKE2B_HASH_SIZE_256,
+      hash);
+  }
+
+  cardano_buffer_unref(&encoded);
+
+  return result;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+_cardano_evaluate_cached(
+  cardano_evaluation_cache_t* cache,
+  cardano_tx_evaluator_t*     evaluator,
+  cardano_transaction_t*      tx,
+  cardano_utxo_list_t*        additional_utxos,
+  cardano_redeemer_list_t**   redeemers,
+  bool*                       hit)
+{
+  if ((cache == NULL) || (tx == NULL) || (redeemers == NULL) || (hit == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *hit = false;
+
+  cardano_blake2b_hash_t* context_hash = NULL;
+  cardano_error_t         result       = compute_context_hash(tx, &context_hash);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if ((cache->redeemers != NULL) && cardano_blake2b_hash_equals(cache->context_hash, context_hash))
+  {
+    cardano_blake2b_hash_unref(&context_hash);
+    cardano_redeemer_list_ref(cache->redeemers);
+
+    *redeemers = cache->redeemers;
+    *hit       = true;
+
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_redeemer_list_t* evaluated = NULL;
+  result                             = cardano_tx_evaluator_evaluate(evaluator, tx, additional_utxos, &evaluated);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_blake2b_hash_unref(&context_hash);
+    return result;
+  }
+
+  _cardano_evaluation_cache_release(cache);
+
+  cardano_redeemer_list_ref(evaluated);
+
+  cache->context_hash = context_hash;
+  cache->redeemers    = evaluated;
+  *redeemers          = evaluated;
+
+  return CARDANO_SUCCESS;
+}
+
+void
+_cardano_evaluation_cache_release(cardano_evaluation_cache_t* cache)
+{
+  if (cache == NULL)
+  {
+    return;
+  }
+
+  cardano_blake2b_hash_unref(&cache->context_hash);
+  cardano_redeemer_list_unref(&cache->redeemers);
+
+  CARDANO_UNUSED(memset(cache, 0, sizeof(cardano_evaluation_cache_t)));
+}
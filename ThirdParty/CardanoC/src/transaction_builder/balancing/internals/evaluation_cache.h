@@ -0,0 +1,86 @@
+/**
+ * \file evaluation_cache.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_EVALUATION_CACHE_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_EVALUATION_CACHE_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/common/utxo_list.h>
+#include <cardano/crypto/blake2b_hash.h>
+#include <cardano/error.h>
+#include <cardano/transaction/transaction.h>
+#include <cardano/transaction_builder/evaluation/tx_evaluator.h>
+#include <cardano/typedefs.h>
+#include <cardano/witness_set/redeemer_list.h>
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Remembers, across the iterations of the balancing loop, the execution units the evaluator last returned.
+ *
+ * Within one balancing the scripts, datums, redeemer data, mint and requested outputs never change; what an
+ * iteration may change is the fee, the change output, the selected inputs (and so the indices of the spend
+ * redeemers) and the collateral. The evaluation is reused while the inputs, reference inputs, collateral inputs,
+ * number of outputs and redeemer pointers are those it was made for, so a pass that only raised the fee costs no
+ * evaluator call, which for a provider evaluator is a network round trip.
+ *
+ * A script could still branch on the fee or on the lovelace of the change output, but not pay for their magnitude:
+ * Plutus costs integers by their size in words, and both always fit one.
+ */
+typedef struct cardano_evaluation_cache_t
+{
+    cardano_blake2b_hash_t*  context_hash;
+    cardano_redeemer_list_t* redeemers;
+} cardano_evaluation_cache_t;
+
+/**
+ * \brief Evaluates the redeemers of a transaction, or returns the result of the previous evaluation if the parts of
+ *        the transaction it depends on are unchanged.
+ *
+ * \param[in,out] cache The cache. Must be zero-initialized before the first call, then released with
+ *                      \ref _cardano_evaluation_cache_release. Must be used for one transaction only.
+ * \param[in] evaluator The evaluator to call on a miss.
+ * \param[in] tx The transaction being balanced.
+ * \param[in] additional_utxos The UTxOs spent by the transaction, passed on to the evaluator.
+ * \param[out] redeemers On success, the evaluated redeemers; the caller owns this reference.
+ * \param[out] hit Set to true if the redeemers came from the cache.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of the evaluator or of the digest of the transaction.
+ */
+cardano_error_t
+_cardano_evaluate_cached(
+  cardano_evaluation_cache_t* cache,
+  cardano_tx_evaluator_t*     evaluator,
+  cardano_transaction_t*      tx,
+  cardano_utxo_list_t*        additional_utxos,
+  cardano_redeemer_list_t**   redeemers,
+  bool*                       hit);
+
+/**
+ * \brief Releases what an evaluation cache holds, leaving it zero-initialized.
+ *
+ * \param[in,out] cache The cache to release.
+ */
+void
+_cardano_evaluation_cache_release(cardano_evaluation_cache_t* cache);
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_EVALUATION_CACHE_H
@@ -0,0 +1,357 @@
+/**
+ * \file tx_size_model.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "tx_size_model.h"
+
+#include <cardano/cbor/cbor_writer.h>
+#include <cardano/transaction_builder/fee.h>
+#include <math.h>
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Writes the map entries of the fields the balancing loop rewrites to a writer.
+ *
+ * Each entry is written exactly as the transaction body and witness set serialize it: the key followed by the value,
+ * and nothing when the field is absent.
+ *
+ * \param[in] tx     The transaction.
+ * \param[in] writer The writer, usually a size-only writer.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+write_tracked_fields(cardano_transaction_t* tx, cardano_cbor_writer_t* writer)
+{
+  cardano_transaction_body_t* body = cardano_transaction_get_body(tx);
+  cardano_transaction_body_unref(&body);
+
+  cardano_witness_set_t* witness_set = cardano_transaction_get_witness_set(tx);
+  cardano_witness_set_unref(&witness_set);
+
+  if ((body == NULL) || (witness_set == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_transaction_input_set_t*   inputs            = cardano_transaction_body_get_inputs(body);
+  cardano_transaction_output_list_t* outputs           = cardano_transaction_body_get_outputs(body);
+  cardano_transaction_input_set_t*   collateral        = cardano_transaction_body_get_collateral(body);
+  cardano_transaction_output_t*      collateral_return = cardano_transaction_body_get_collateral_return(body);
+  const uint64_t*                    total_collateral  = cardano_transaction_body_get_total_collateral(body);
+  cardano_redeemer_list_t*           redeemers         = cardano_witness_set_get_redeemers(witness_set);
+
+  cardano_transaction_input_set_unref(&inputs);
+  cardano_transaction_output_list_unref(&outputs);
+  cardano_transaction_input_set_unref(&collateral);
+  cardano_transaction_output_unref(&collateral_return);
+  cardano_redeemer_list_unref(&redeemers);
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (inputs != NULL)
+  {
+    result = cardano_cbor_writer_write_uint(writer, 0U);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_transaction_input_set_to_cbor(inputs, writer);
+    }
+  }
+
+  if ((result == CARDANO_SUCCESS) && (outputs != NULL))
+  {
+    result = cardano_cbor_writer_write_uint(writer, 1U);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_transaction_output_list_to_cbor(outputs, writer);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_write_uint(writer, 2U);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_writer_write_uint(writer, cardano_transaction_body_get_fee(body));
+    }
+  }
+
+  if ((result == CARDANO_SUCCESS) && (collateral != NULL))
+  {
+    result = cardano_cbor_writer_write_uint(writer, 13U);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_transaction_input_set_to_cbor(collateral, writer);
+    }
+  }
+
+  if ((result == CARDANO_SUCCESS) && (collateral_return != NULL))
+  {
+    result = cardano_cbor_writer_write_uint(writer, 16U);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_transaction_output_to_cbor(collateral_return, writer);
+    }
+  }
+
+  if ((result == CARDANO_SUCCESS) && (total_collateral != NULL))
+  {
+    result = cardano_cbor_writer_write_uint(writer, 17U);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_writer_write_uint(writer, *total_collateral);
+    }
+  }
+
+  if ((result == CARDANO_SUCCESS) && (cardano_redeemer_list_get_length(redeemers) > 0U))
+  {
+    result = cardano_cbor_writer_write_uint(writer, 5U);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_redeemer_list_to_cbor(redeemers, writer);
+    }
+  }
+
+  return result;
+}
+
+/**
+ * \brief Computes the serialized size of the fields the balancing loop rewrites.
+ *
+ * \param[in]  tx   The transaction.
+ * \param[out] size On success, the size of the map entries of the tracked fields, in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+get_tracked_fields_size(cardano_transaction_t* tx, size_t* size)
+{
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new_size_only();
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = write_tracked_fields(tx, writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    *size = cardano_cbor_writer_get_encode_size(writer);
+  }
+
+  cardano_cbor_writer_unref(&writer);
+
+  return result;
+}
+
+/**
+ * \brief Computes the fee for the execution units of the redeemers.
+ *
+ * \param[in]  redeemers The redeemers of the transaction.
+ * \param[in]  prices    The execution unit prices.
+ * \param[out] fee       On success, the fee in lovelace.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+compute_ex_units_fee(cardano_redeemer_list_t* redeemers, cardano_ex_unit_prices_t* prices, uint64_t* fee)
+{
+  cardano_ex_units_t* total_ex_units = NULL;
+  cardano_error_t     result         = cardano_get_total_ex_units_in_redeemers(redeemers, &total_ex_units);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const uint64_t cpu_steps = cardano_ex_units_get_cpu_steps(total_ex_units);
+  const uint64_t memory    = cardano_ex_units_get_memory(total_ex_units);
+
+  cardano_ex_units_unref(&total_ex_units);
+
+  cardano_unit_interval_t* cpu_steps_prices = NULL;
+  cardano_unit_interval_t* memory_prices    = NULL;
+
+  result = cardano_ex_unit_prices_get_steps_prices(prices, &cpu_steps_prices);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_ex_unit_prices_get_memory_prices(prices, &memory_prices);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_unit_interval_unref(&cpu_steps_prices);
+    return result;
+  }
+
+  const double cpu_price = cardano_unit_interval_to_double(cpu_steps_prices);
+  const double mem_price = cardano_unit_interval_to_double(memory_prices);
+
+  cardano_unit_interval_unref(&cpu_steps_prices);
+  cardano_unit_interval_unref(&memory_prices);
+
+  *fee = (uint64_t)ceil(((double)cpu_steps * cpu_price) + ((double)memory * mem_price));
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Computes the serialized size of the transaction.
+ *
+ * The first call serializes the whole transaction; later calls only measure the tracked fields.
+ *
+ * \param[in,out] model The size model.
+ * \param[in]     tx    The transaction being balanced.
+ * \param[out]    size  On success, the serialized size of \p tx in bytes.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+get_size(cardano_tx_size_model_t* model, cardano_transaction_t* tx, size_t* size)
+{
+  size_t          tracked_size = 0U;
+  cardano_error_t result       = get_tracked_fields_size(tx, &tracked_size);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (!model->is_initialized)
+  {
+    size_t full_size = 0U;
+
+    result = cardano_transaction_get_cbor_size(tx, &full_size);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    if (full_size < tracked_size)
+    {
+      return CARDANO_ERROR_ILLEGAL_STATE;
+    }
+
+    model->fixed_size     = full_size - tracked_size;
+    model->is_initialized = true;
+  }
+
+  *size = model->fixed_size + tracked_size;
+
+  return CARDANO_SUCCESS;
+}
+
+/* IMPLEMENTATION ************************************************************/
+
+cardano_error_t
+_cardano_tx_size_model_compute_fee(
+  cardano_tx_size_model_t*       model,
+  cardano_transaction_t*         tx,
+  cardano_utxo_list_t*           resolved_reference_inputs,
+  cardano_protocol_parameters_t* protocol_params,
+  uint64_t*                      fee)
+{
+  if ((model == NULL) || (tx == NULL) || (resolved_reference_inputs == NULL) || (protocol_params == NULL) || (fee == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_ex_unit_prices_t* prices = cardano_protocol_parameters_get_execution_costs(protocol_params);
+  cardano_ex_unit_prices_unref(&prices);
+
+  if (prices == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (!model->is_initialized)
+  {
+    cardano_unit_interval_t* coins_per_ref_script_byte = cardano_protocol_parameters_get_ref_script_cost_per_byte(protocol_params);
+    cardano_unit_interval_unref(&coins_per_ref_script_byte);
+
+    if (coins_per_ref_script_byte == NULL)
+    {
+      return CARDANO_ERROR_POINTER_IS_NULL;
+    }
+
+    result = cardano_compute_script_ref_fee(resolved_reference_inputs, coins_per_ref_script_byte, &model->ref_script_fee);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  size_t size_in_bytes = 0U;
+
+  result = get_size(model, tx, &size_in_bytes);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const uint64_t min_fee_coefficient = cardano_protocol_parameters_get_min_fee_a(protocol_params);
+  const uint64_t min_fee_constant    = cardano_protocol_parameters_get_min_fee_b(protocol_params);
+
+  *fee = (uint64_t)ceil((double)min_fee_constant + ((double)min_fee_coefficient * (double)size_in_bytes));
+
+  cardano_witness_set_t* witness_set = cardano_transaction_get_witness_set(tx);
+  cardano_witness_set_unref(&witness_set);
+
+  cardano_redeemer_list_t* redeemers = cardano_witness_set_get_redeemers(witness_set);
+  cardano_redeemer_list_unref(&redeemers);
+
+  // As in cardano_compute_min_script_fee, reference scripts are only priced when the transaction runs scripts.
+  if (cardano_redeemer_list_get_length(redeemers) == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  uint64_t ex_units_fee = 0U;
+
+  result = compute_ex_units_fee(redeemers, prices, &ex_units_fee);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  *fee += ex_units_fee + model->ref_script_fee;
+
+  return CARDANO_SUCCESS;
+}
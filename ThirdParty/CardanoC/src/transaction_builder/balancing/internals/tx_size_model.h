@@ -0,0 +1,78 @@
+/**
+ * \file tx_size_model.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_TX_SIZE_MODEL_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_TX_SIZE_MODEL_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/common/utxo_list.h>
+#include <cardano/error.h>
+#include <cardano/protocol_params/protocol_parameters.h>
+#include <cardano/transaction/transaction.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Incremental model of the serialized size of a transaction being balanced.
+ *
+ * The balancing loop only rewrites a handful of fields between iterations: the inputs, outputs and fee of the body,
+ * the collateral fields, and the execution units of the redeemers. The model serializes the whole transaction once,
+ * remembers the size of everything else, and from then on only measures the fields the loop touches. The size of
+ * reference scripts, which never changes while balancing, is priced once as well.
+ *
+ * The model assumes the CBOR map headers of the body and the witness set stay one byte long, which always holds
+ * since both maps have fewer than 24 keys.
+ */
+typedef struct cardano_tx_size_model_t
+{
+    bool     is_initialized;
+    size_t   fixed_size;
+    uint64_t ref_script_fee;
+} cardano_tx_size_model_t;
+
+/**
+ * \brief Computes the minimum fee of the transaction using the size model.
+ *
+ * The first call serializes the whole transaction and prices its reference scripts; later calls only measure the
+ * fields rewritten by the balancing loop and add them to the size of the rest, measured by the first call. The result
+ * is the same as \ref cardano_compute_transaction_fee, as long as the only differences between calls are in the
+ * fields tracked by the model.
+ *
+ * \param[in,out] model                     The size model. Must be zero-initialized before the first call.
+ * \param[in]     tx                        The transaction being balanced. Must be the same transaction on every
+ *                                          call.
+ * \param[in]     resolved_reference_inputs The resolved reference inputs. Only read by the first call.
+ * \param[in]     protocol_params           The protocol parameters.
+ * \param[out]    fee                       On success, the minimum fee in lovelace.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+cardano_error_t
+_cardano_tx_size_model_compute_fee(
+  cardano_tx_size_model_t*       model,
+  cardano_transaction_t*         tx,
+  cardano_utxo_list_t*           resolved_reference_inputs,
+  cardano_protocol_parameters_t* protocol_params,
+  uint64_t*                      fee);
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_TX_SIZE_MODEL_H
@@ -47,68 +47,196 @@
 /* STATIC FUNCTIONS **********************************************************/
 
 /**
- * \brief Callback function to find a specific UTXO based on the provided context.
+ * \brief Hashes a key hash stored in a signer set.
  *
- * This function checks if the provided UTXO matches the criteria specified in `context`.
+ * \param[in] object The \ref cardano_blake2b_hash_t to hash.
  *
- * \param[in] item The UTXO to evaluate.
- * \param[in] context A pointer to the search criteria, typically a structure or identifier.
+ * \return The hash of its bytes.
+ */
+static uint64_t
+hash_key_hash(const cardano_object_t* object)
+{
+  const cardano_blake2b_hash_t* hash = (const cardano_blake2b_hash_t*)((const void*)object);
+
+  return cardano_set_hash_bytes(CARDANO_SET_HASH_SEED, cardano_blake2b_hash_get_data(hash), cardano_blake2b_hash_get_bytes_size(hash));
+}
+
+/**
+ * \brief Compares two key hashes stored in a signer set.
+ *
+ * \param[in] lhs The first \ref cardano_blake2b_hash_t.
+ * \param[in] rhs The second \ref cardano_blake2b_hash_t.
  *
- * \return `true` if the UTXO matches the search criteria; otherwise, `false`.
+ * \return Zero if both hashes are equal.
  */
-static bool
-find_utxo(cardano_utxo_t* item, const void* context)
+static int
+compare_key_hashes(const cardano_object_t* lhs, const cardano_object_t* rhs)
 {
-  const cardano_transaction_input_t* input      = (const cardano_transaction_input_t*)context;
-  cardano_transaction_input_t*       utxo_input = cardano_utxo_get_input(item);
+  return cardano_blake2b_hash_compare(
+    (const cardano_blake2b_hash_t*)((const void*)lhs),
+    (const cardano_blake2b_hash_t*)((const void*)rhs));
+}
 
-  bool found = cardano_transaction_input_equals(utxo_input, input);
+/**
+ * \brief Hashes a transaction input by transaction id and output index.
+ *
+ * \param[in] object The \ref cardano_transaction_input_t to hash.
+ *
+ * \return The hash of the input.
+ */
+static uint64_t
+hash_input(const cardano_object_t* object)
+{
+  cardano_transaction_input_t* input = (cardano_transaction_input_t*)((void*)object);
+  cardano_blake2b_hash_t*      id    = cardano_transaction_input_get_id(input);
+  const uint64_t               index = cardano_transaction_input_get_index(input);
+
+  uint64_t hash = cardano_set_hash_bytes(CARDANO_SET_HASH_SEED, cardano_blake2b_hash_get_data(id), cardano_blake2b_hash_get_bytes_size(id));
 
-  cardano_transaction_input_unref(&utxo_input);
+  cardano_blake2b_hash_unref(&id);
 
-  return found;
+  return cardano_set_hash_bytes(hash, (const byte_t*)&index, sizeof(index));
 }
 
-/* IMPLEMENTATION ************************************************************/
+/**
+ * \brief Compares two transaction inputs stored in an input index.
+ *
+ * \param[in] lhs The first \ref cardano_transaction_input_t.
+ * \param[in] rhs The second \ref cardano_transaction_input_t.
+ *
+ * \return Zero if both inputs point to the same output.
+ */
+static int
+compare_inputs(const cardano_object_t* lhs, const cardano_object_t* rhs)
+{
+  return cardano_transaction_input_compare(
+    (const cardano_transaction_input_t*)((const void*)lhs),
+    (const cardano_transaction_input_t*)((const void*)rhs));
+}
 
-bool
-_cardano_blake2b_hash_set_has(cardano_blake2b_hash_set_t* set, const cardano_blake2b_hash_t* hash)
+/**
+ * \brief Checks whether two input sets hold the same inputs in the same order.
+ *
+ * \param[in] lhs The first set, or NULL.
+ * \param[in] rhs The second set, or NULL.
+ *
+ * \return \c true if both sets are NULL, or hold equal inputs.
+ */
+static bool
+same_inputs(const cardano_transaction_input_set_t* lhs, const cardano_transaction_input_set_t* rhs)
 {
-  if ((set == NULL) || (hash == NULL))
+  if ((lhs == NULL) || (rhs == NULL))
   {
-    return false;
+    return lhs == rhs;
   }
 
-  const size_t size = cardano_blake2b_hash_set_get_length(set);
+  const size_t size = cardano_transaction_input_set_get_length(lhs);
 
-  if (size == 0U)
+  if (size != cardano_transaction_input_set_get_length(rhs))
   {
     return false;
   }
 
   for (size_t i = 0U; i < size; ++i)
   {
-    cardano_blake2b_hash_t* current = NULL;
-
-    cardano_error_t result = cardano_blake2b_hash_set_get(set, i, &current);
-    cardano_blake2b_hash_unref(&current);
-
-    if (result != CARDANO_SUCCESS)
+    if (!cardano_transaction_input_equals(cardano_transaction_input_set_peek(lhs, i), cardano_transaction_input_set_peek(rhs, i)))
     {
       return false;
     }
+  }
+
+  return true;
+}
+
+/**
+ * \brief Counts the signers of a transaction on top of the signers of its body, without a cache.
+ *
+ * \param[in] body_signers The signers of the body, from \ref _cardano_get_body_signers.
+ * \param[in] inputs The inputs of the transaction.
+ * \param[in] collateral The collateral inputs of the transaction, or NULL.
+ * \param[in] resolved_inputs The UTxOs the inputs and collateral inputs spend.
+ * \param[out] count On success, the number of unique signers.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+static cardano_error_t
+count_signers(
+  cardano_set_t*                   body_signers,
+  cardano_transaction_input_set_t* inputs,
+  cardano_transaction_input_set_t* collateral,
+  cardano_utxo_list_t*             resolved_inputs,
+  size_t*                          count)
+{
+  cardano_set_t* input_signers = _cardano_signer_set_new();
+
+  if (input_signers == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = _cardano_add_input_signers(input_signers, inputs, resolved_inputs);
+
+  if ((result == CARDANO_SUCCESS) && (collateral != NULL))
+  {
+    result = _cardano_add_input_signers(input_signers, collateral, resolved_inputs);
+  }
 
-    if (cardano_blake2b_hash_equals(current, hash))
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_set_unref(&input_signers);
+    return result;
+  }
+
+  // Only the input signers are walked: they are the ones not already known to sign the body
+  cardano_array_t* entries = cardano_get_entries(input_signers);
+
+  cardano_set_unref(&input_signers);
+
+  if (entries == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  size_t total = cardano_set_get_size(body_signers);
+
+  for (size_t i = 0U; i < cardano_array_get_size(entries); ++i)
+  {
+    if (!cardano_set_has(body_signers, cardano_array_peek(entries, i)))
     {
-      return true;
+      ++total;
     }
   }
 
-  return false;
+  cardano_array_unref(&entries);
+
+  *count = total;
+
+  return CARDANO_SUCCESS;
+}
+
+/* IMPLEMENTATION ************************************************************/
+
+cardano_set_t*
+_cardano_signer_set_new(void)
+{
+  return cardano_set_new(compare_key_hashes, hash_key_hash);
 }
 
 cardano_error_t
-_cardano_add_required_signers(cardano_blake2b_hash_set_t* unique_signers, cardano_blake2b_hash_set_t* required_signers)
+_cardano_add_signer(cardano_set_t* unique_signers, cardano_blake2b_hash_t* hash)
+{
+  if ((unique_signers == NULL) || (hash == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const size_t size = cardano_set_add(unique_signers, (cardano_object_t*)((void*)hash));
+
+  return (size == 0U) ? CARDANO_ERROR_MEMORY_ALLOCATION_FAILED : CARDANO_SUCCESS;
+}
+
+cardano_error_t
+_cardano_add_required_signers(cardano_set_t* unique_signers, cardano_blake2b_hash_set_t* required_signers)
 {
   if (unique_signers == NULL)
   {
@@ -134,14 +262,11 @@ _cardano_add_required_signers(cardano_blake2b_hash_set_t* unique_signers, cardan
       return result;
     }
 
-    if (!_cardano_blake2b_hash_set_has(unique_signers, current))
-    {
-      result = cardano_blake2b_hash_set_add(unique_signers, current);
+    result = _cardano_add_signer(unique_signers, current);
 
-      if (result != CARDANO_SUCCESS)
-      {
-        return result;
-      }
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
     }
   }
 
@@ -231,7 +356,7 @@ _cardano_get_payment_pub_key_hash(cardano_address_t* address)
 
 cardano_error_t
 _cardano_add_input_signers(
-  cardano_blake2b_hash_set_t*      unique_signers,
+  cardano_set_t*                   unique_signers,
   cardano_transaction_input_set_t* set,
   cardano_utxo_list_t*             resolved_inputs)
 {
@@ -247,23 +372,40 @@ _cardano_add_input_signers(
     return CARDANO_SUCCESS;
   }
 
+  // The inputs are indexed and the resolved UTxOs walked once, each taking its input out of the index, instead of
+  // searching the UTxO list for every input
+  cardano_set_t* pending = cardano_set_new(compare_inputs, hash_input);
+
+  if (pending == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
   for (size_t i = 0U; i < size; ++i)
   {
-    cardano_transaction_input_t* input  = NULL;
-    cardano_error_t              result = cardano_transaction_input_set_get(set, i, &input);
-    cardano_transaction_input_unref(&input);
+    cardano_transaction_input_t* input = cardano_transaction_input_set_peek(set, i);
 
-    if (result != CARDANO_SUCCESS)
+    if ((input == NULL) || (cardano_set_add(pending, (cardano_object_t*)((void*)input)) == 0U))
     {
-      return result;
+      cardano_set_unref(&pending);
+      return (input == NULL) ? CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
     }
+  }
 
-    cardano_utxo_t* utxo = cardano_utxo_list_find(resolved_inputs, find_utxo, (void*)input);
-    cardano_utxo_unref(&utxo);
+  const size_t utxo_count = cardano_utxo_list_get_length(resolved_inputs);
 
-    if (utxo == NULL)
+  for (size_t i = 0U; (i < utxo_count) && (cardano_set_get_size(pending) > 0U); ++i)
+  {
+    cardano_utxo_t*              utxo  = cardano_utxo_list_peek(resolved_inputs, i);
+    cardano_transaction_input_t* input = cardano_utxo_get_input(utxo);
+
+    const bool is_spent = cardano_set_delete(pending, (cardano_object_t*)((void*)input));
+
+    cardano_transaction_input_unref(&input);
+
+    if (!is_spent)
     {
-      return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+      continue;
     }
 
     cardano_transaction_output_t* output = cardano_utxo_get_output(utxo);
@@ -279,27 +421,28 @@ _cardano_add_input_signers(
       continue;
     }
 
-    if (!_cardano_blake2b_hash_set_has(unique_signers, pub_key_hash))
-    {
-      result = cardano_blake2b_hash_set_add(unique_signers, pub_key_hash);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        cardano_blake2b_hash_unref(&pub_key_hash);
-        return result;
-      }
-    }
+    cardano_error_t result = _cardano_add_signer(unique_signers, pub_key_hash);
 
     cardano_blake2b_hash_unref(&pub_key_hash);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_set_unref(&pending);
+      return result;
+    }
   }
 
-  return CARDANO_SUCCESS;
+  const bool is_resolved = cardano_set_get_size(pending) == 0U;
+
+  cardano_set_unref(&pending);
+
+  return is_resolved ? CARDANO_SUCCESS : CARDANO_ERROR_ELEMENT_NOT_FOUND;
 }
 
 cardano_error_t
 _cardano_add_withdrawals(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_withdrawal_map_t*   withdrawals)
+  cardano_set_t*            unique_signers,
+  cardano_withdrawal_map_t* withdrawals)
 {
   if (unique_signers == NULL)
   {
@@ -357,16 +500,13 @@ _cardano_add_withdrawals(
       return CARDANO_ERROR_POINTER_IS_NULL;
     }
 
-    if (!_cardano_blake2b_hash_set_has(unique_signers, pub_key_hash))
-    {
-      result = cardano_blake2b_hash_set_add(unique_signers, pub_key_hash);
+    result = _cardano_add_signer(unique_signers, pub_key_hash);
 
-      if (result != CARDANO_SUCCESS)
-      {
-        cardano_blake2b_hash_unref(&pub_key_hash);
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_blake2b_hash_unref(&pub_key_hash);
 
-        return result;
-      }
+      return result;
     }
 
     cardano_blake2b_hash_unref(&pub_key_hash);
@@ -377,8 +517,8 @@ _cardano_add_withdrawals(
 
 cardano_error_t
 _process_credential(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_credential_t*       credential)
+  cardano_set_t*        unique_signers,
+  cardano_credential_t* credential)
 {
   if (unique_signers == NULL)
   {
@@ -406,15 +546,12 @@ _process_credential(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  if (!_cardano_blake2b_hash_set_has(unique_signers, pub_key_hash))
-  {
-    result = cardano_blake2b_hash_set_add(unique_signers, pub_key_hash);
+  result = _cardano_add_signer(unique_signers, pub_key_hash);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_blake2b_hash_unref(&pub_key_hash);
-      return result;
-    }
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_blake2b_hash_unref(&pub_key_hash);
+    return result;
   }
 
   cardano_blake2b_hash_unref(&pub_key_hash);
@@ -423,8 +560,8 @@ _process_credential(
 
 cardano_error_t
 _process_pool_registration(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_certificate_t*      certificate)
+  cardano_set_t*         unique_signers,
+  cardano_certificate_t* certificate)
 {
   cardano_error_t                   result;
   cardano_pool_registration_cert_t* registration = NULL;
@@ -473,19 +610,16 @@ _process_pool_registration(
       return result;
     }
 
-    if (!_cardano_blake2b_hash_set_has(unique_signers, pub_key_hash))
-    {
-      result = cardano_blake2b_hash_set_add(unique_signers, pub_key_hash);
+    result = _cardano_add_signer(unique_signers, pub_key_hash);
 
-      if (result != CARDANO_SUCCESS)
-      {
-        cardano_blake2b_hash_unref(&pub_key_hash);
-        cardano_pool_owners_unref(&owners);
-        cardano_pool_params_unref(&params);
-        cardano_pool_registration_cert_unref(&registration);
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_blake2b_hash_unref(&pub_key_hash);
+      cardano_pool_owners_unref(&owners);
+      cardano_pool_params_unref(&params);
+      cardano_pool_registration_cert_unref(&registration);
 
-        return result;
-      }
+      return result;
     }
 
     cardano_blake2b_hash_unref(&pub_key_hash);
@@ -500,8 +634,8 @@ _process_pool_registration(
 
 cardano_error_t
 _process_pool_retirement(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_certificate_t*      certificate)
+  cardano_set_t*         unique_signers,
+  cardano_certificate_t* certificate)
 {
   cardano_error_t                 result;
   cardano_pool_retirement_cert_t* retirement = NULL;
@@ -522,17 +656,14 @@ _process_pool_retirement(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  if (!_cardano_blake2b_hash_set_has(unique_signers, pub_key_hash))
-  {
-    result = cardano_blake2b_hash_set_add(unique_signers, pub_key_hash);
+  result = _cardano_add_signer(unique_signers, pub_key_hash);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_blake2b_hash_unref(&pub_key_hash);
-      cardano_pool_retirement_cert_unref(&retirement);
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_blake2b_hash_unref(&pub_key_hash);
+    cardano_pool_retirement_cert_unref(&retirement);
 
-      return result;
-    }
+    return result;
   }
 
   cardano_blake2b_hash_unref(&pub_key_hash);
@@ -543,8 +674,8 @@ _process_pool_retirement(
 
 cardano_error_t
 _process_auth_committee_hot(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_certificate_t*      certificate)
+  cardano_set_t*         unique_signers,
+  cardano_certificate_t* certificate)
 {
   cardano_error_t                    result;
   cardano_auth_committee_hot_cert_t* auth_committee = NULL;
@@ -575,9 +706,9 @@ _process_auth_committee_hot(
 
 cardano_error_t
 _process_certificate_with_credential(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_certificate_t*      certificate,
-  cardano_cert_type_t         type)
+  cardano_set_t*         unique_signers,
+  cardano_certificate_t* certificate,
+  cardano_cert_type_t    type)
 {
   cardano_error_t       result;
   cardano_credential_t* credential = NULL;
@@ -796,8 +927,8 @@ _process_certificate_with_credential(
 
 cardano_error_t
 _cardano_add_certificates_pub_key_hashes(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_certificate_set_t*  certificates)
+  cardano_set_t*             unique_signers,
+  cardano_certificate_set_t* certificates)
 {
   if (unique_signers == NULL)
   {
@@ -913,7 +1044,7 @@ _cardano_add_certificates_pub_key_hashes(
 
 cardano_error_t
 _cardano_voting_procedures_pub_key_hashes(
-  cardano_blake2b_hash_set_t*  unique_signers,
+  cardano_set_t*               unique_signers,
   cardano_voting_procedures_t* procedures)
 {
   if (unique_signers == NULL)
@@ -975,7 +1106,6 @@ _cardano_voting_procedures_pub_key_hashes(
     if (cred_type != CARDANO_CREDENTIAL_TYPE_KEY_HASH)
     {
       cardano_voter_unref(&voter);
-      cardano_voter_list_unref(&voters);
 
       continue;
     }
@@ -990,18 +1120,15 @@ _cardano_voting_procedures_pub_key_hashes(
       return CARDANO_ERROR_POINTER_IS_NULL;
     }
 
-    if (!_cardano_blake2b_hash_set_has(unique_signers, pub_key_hash))
-    {
-      result = cardano_blake2b_hash_set_add(unique_signers, pub_key_hash);
+    result = _cardano_add_signer(unique_signers, pub_key_hash);
 
-      if (result != CARDANO_SUCCESS)
-      {
-        cardano_blake2b_hash_unref(&pub_key_hash);
-        cardano_voter_unref(&voter);
-        cardano_voter_list_unref(&voters);
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_blake2b_hash_unref(&pub_key_hash);
+      cardano_voter_unref(&voter);
+      cardano_voter_list_unref(&voters);
 
-        return result;
-      }
+      return result;
     }
 
     cardano_blake2b_hash_unref(&pub_key_hash);
@@ -1013,6 +1140,65 @@ _cardano_voting_procedures_pub_key_hashes(
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+_cardano_get_body_signers(cardano_transaction_t* tx, cardano_set_t** body_signers)
+{
+  if ((tx == NULL) || (body_signers == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_transaction_body_t* body = cardano_transaction_get_body(tx);
+  cardano_transaction_body_unref(&body);
+
+  cardano_set_t* signers = _cardano_signer_set_new();
+
+  if (signers == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_blake2b_hash_set_t* required_signers = cardano_transaction_body_get_required_signers(body);
+  cardano_blake2b_hash_set_unref(&required_signers);
+
+  cardano_error_t result = _cardano_add_required_signers(signers, required_signers);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    cardano_withdrawal_map_t* withdrawals = cardano_transaction_body_get_withdrawals(body);
+    cardano_withdrawal_map_unref(&withdrawals);
+
+    result = _cardano_add_withdrawals(signers, withdrawals);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    cardano_certificate_set_t* certificates = cardano_transaction_body_get_certificates(body);
+    cardano_certificate_set_unref(&certificates);
+
+    result = _cardano_add_certificates_pub_key_hashes(signers, certificates);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    cardano_voting_procedures_t* procedures = cardano_transaction_body_get_voting_procedures(body);
+    cardano_voting_procedures_unref(&procedures);
+
+    result = _cardano_voting_procedures_pub_key_hashes(signers, procedures);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_set_unref(&signers);
+
+    return result;
+  }
+
+  *body_signers = signers;
+
+  return CARDANO_SUCCESS;
+}
+
 cardano_error_t
 _cardano_get_unique_signers(
   cardano_transaction_t*       tx,
@@ -1037,81 +1223,128 @@ _cardano_get_unique_signers(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_error_t result = cardano_blake2b_hash_set_new(unique_signers);
+  cardano_set_t*  signers = NULL;
+  cardano_error_t result  = _cardano_get_body_signers(tx, &signers);
 
   if (result != CARDANO_SUCCESS)
   {
     return result;
   }
 
-  cardano_blake2b_hash_set_t* required_signers = cardano_transaction_body_get_required_signers(body);
-  cardano_blake2b_hash_set_unref(&required_signers);
-
-  result = _cardano_add_required_signers(*unique_signers, required_signers);
+  result = _cardano_add_input_signers(signers, inputs, resolved_inputs);
 
-  if (result != CARDANO_SUCCESS)
+  if ((result == CARDANO_SUCCESS) && (collateral_inputs != NULL))
   {
-    cardano_blake2b_hash_set_unref(unique_signers);
-
-    return result;
+    result = _cardano_add_input_signers(signers, collateral_inputs, resolved_inputs);
   }
 
-  result = _cardano_add_input_signers(*unique_signers, inputs, resolved_inputs);
+  cardano_array_t* entries = (result == CARDANO_SUCCESS) ? cardano_get_entries(signers) : NULL;
+
+  cardano_set_unref(&signers);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_blake2b_hash_set_unref(unique_signers);
-
     return result;
   }
 
-  if (collateral_inputs != NULL)
+  if (entries == NULL)
   {
-    result = _cardano_add_input_signers(*unique_signers, collateral_inputs, resolved_inputs);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_blake2b_hash_set_unref(unique_signers);
+  result = cardano_blake2b_hash_set_new(unique_signers);
 
-      return result;
-    }
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < cardano_array_get_size(entries)); ++i)
+  {
+    result = cardano_blake2b_hash_set_add(*unique_signers, (cardano_blake2b_hash_t*)((void*)cardano_array_peek(entries, i)));
   }
 
-  cardano_withdrawal_map_t* withdrawals = cardano_transaction_body_get_withdrawals(body);
-  cardano_withdrawal_map_unref(&withdrawals);
-
-  result = _cardano_add_withdrawals(*unique_signers, withdrawals);
+  cardano_array_unref(&entries);
 
   if (result != CARDANO_SUCCESS)
   {
     cardano_blake2b_hash_set_unref(unique_signers);
+  }
 
-    return result;
+  return result;
+}
+
+cardano_error_t
+_cardano_unique_signers_cache_count(
+  cardano_unique_signers_cache_t* cache,
+  cardano_transaction_t*          tx,
+  cardano_utxo_list_t*            resolved_inputs,
+  size_t*                         count)
+{
+  if ((cache == NULL) || (tx == NULL) || (resolved_inputs == NULL) || (count == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_certificate_set_t* certificates = cardano_transaction_body_get_certificates(body);
-  cardano_certificate_set_unref(&certificates);
+  cardano_transaction_body_t*      body       = cardano_transaction_get_body(tx);
+  cardano_transaction_input_set_t* inputs     = cardano_transaction_body_get_inputs(body);
+  cardano_transaction_input_set_t* collateral = cardano_transaction_body_get_collateral(body);
 
-  result = _cardano_add_certificates_pub_key_hashes(*unique_signers, certificates);
+  cardano_transaction_body_unref(&body);
 
-  if (result != CARDANO_SUCCESS)
+  if (inputs == NULL)
   {
-    cardano_blake2b_hash_set_unref(unique_signers);
+    cardano_transaction_input_set_unref(&collateral);
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
 
-    return result;
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (cache->body_signers == NULL)
+  {
+    result = _cardano_get_body_signers(tx, &cache->body_signers);
+  }
+  else if (same_inputs(cache->inputs, inputs) && same_inputs(cache->collateral, collateral))
+  {
+    cardano_transaction_input_set_unref(&inputs);
+    cardano_transaction_input_set_unref(&collateral);
+
+    *count = cache->count;
+
+    return CARDANO_SUCCESS;
   }
 
-  cardano_voting_procedures_t* procedures = cardano_transaction_body_get_voting_procedures(body);
-  cardano_voting_procedures_unref(&procedures);
+  if (result == CARDANO_SUCCESS)
+  {
+    result = count_signers(cache->body_signers, inputs, collateral, resolved_inputs, &cache->count);
+  }
 
-  result = _cardano_voting_procedures_pub_key_hashes(*unique_signers, procedures);
+  // The previous inputs are let go even on failure, so a failed count is never reused
+  cardano_transaction_input_set_unref(&cache->inputs);
+  cardano_transaction_input_set_unref(&cache->collateral);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_blake2b_hash_set_unref(unique_signers);
+    cardano_transaction_input_set_unref(&inputs);
+    cardano_transaction_input_set_unref(&collateral);
 
     return result;
   }
 
+  cache->inputs     = inputs;
+  cache->collateral = collateral;
+
+  *count = cache->count;
+
   return CARDANO_SUCCESS;
-}
\ No newline at end of file
+}
+
+void
+_cardano_unique_signers_cache_release(cardano_unique_signers_cache_t* cache)
+{
+  if (cache == NULL)
+  {
+    return;
+  }
+
+  cardano_set_unref(&cache->body_signers);
+  cardano_transaction_input_set_unref(&cache->inputs);
+  cardano_transaction_input_set_unref(&cache->collateral);
+
+  cache->count = 0U;
+}
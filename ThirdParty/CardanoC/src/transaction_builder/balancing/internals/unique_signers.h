@@ -29,28 +29,46 @@
 #include <cardano/transaction/transaction.h>
 #include <cardano/typedefs.h>
 
+#include "../../../collections/set.h"
+
 /* DECLARATIONS **************************************************************/
 
 /**
- * \brief Checks if a specified public key hash exists within a Cardano Blake2b hash set.
+ * \brief Remembers, across the iterations of the balancing loop, what the signers of a transaction depend on.
  *
- * This function determines whether a given public key hash is present in the specified `set`
- * of Blake2b hashes. It is typically used to verify if a particular signer’s hash has already
- * been added to a collection of required or unique signers.
+ * The required signers, withdrawals, certificates and votes of the body never change while a transaction is being
+ * balanced, so their signers are collected once. The signers of the inputs and collateral inputs are counted again
+ * only when those inputs differ from the previous count, and not when only the outputs or the fee changed.
+ */
+typedef struct cardano_unique_signers_cache_t
+{
+    cardano_set_t*                   body_signers;
+    cardano_transaction_input_set_t* inputs;
+    cardano_transaction_input_set_t* collateral;
+    size_t                           count;
+} cardano_unique_signers_cache_t;
+
+/**
+ * \brief Creates an empty set of signers, which holds each key hash once.
+ *
+ * \return The new set, or NULL if it could not be allocated. It must be released with \ref cardano_set_unref.
+ */
+cardano_set_t*
+_cardano_signer_set_new(void);
+
+/**
+ * \brief Adds a key hash to a set of signers, unless it is already there.
  *
- * \param[in] set A pointer to an initialized \ref cardano_blake2b_hash_set_t object representing the set
- *                of hashes to search. This parameter is required and must not be NULL.
- * \param[in] hash A pointer to a \ref cardano_blake2b_hash_t object representing the hash to search for within `set`.
- *                 This parameter is required and must not be NULL.
+ * \param[in,out] unique_signers The set created by \ref _cardano_signer_set_new.
+ * \param[in] hash The key hash to add.
  *
- * \return A boolean value indicating the presence of the specified hash in the set:
- *         - `true` if the hash exists in `set`
- *         - `false` if the hash does not exist in `set` or if an error occurs
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if any of the pointers is NULL, or
+ *         \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
  */
-bool
-_cardano_blake2b_hash_set_has(
-  cardano_blake2b_hash_set_t*   set,
-  const cardano_blake2b_hash_t* hash);
+cardano_error_t
+_cardano_add_signer(
+  cardano_set_t*          unique_signers,
+  cardano_blake2b_hash_t* hash);
 
 /**
  * \brief Adds public key hashes from a set of required signers to the unique signers set.
@@ -58,7 +76,7 @@ _cardano_blake2b_hash_set_has(
  * This function iterates through a set of required public key hashes (signers) and adds each unique hash
  * to the specified `unique_signers` set.
  *
- * \param[in,out] unique_signers A pointer to an initialized \ref cardano_blake2b_hash_set_t object where the required
+ * \param[in,out] unique_signers A pointer to a set from \ref _cardano_signer_set_new where the required
  *                               public key hashes will be added. This parameter must not be NULL.
  * \param[in] required_signers A pointer to an initialized \ref cardano_blake2b_hash_set_t object representing the set
  *                             of required public key hashes to be added to `unique_signers`. This parameter is required
@@ -70,7 +88,7 @@ _cardano_blake2b_hash_set_has(
  */
 cardano_error_t
 _cardano_add_required_signers(
-  cardano_blake2b_hash_set_t* unique_signers,
+  cardano_set_t*              unique_signers,
   cardano_blake2b_hash_set_t* required_signers);
 
 /**
@@ -97,7 +115,7 @@ _cardano_get_payment_pub_key_hash(cardano_address_t* address);
  * extracts the public key hashes required for each input, and adds these hashes to the provided `unique_signers` set.
  * Each input may require authorization from different signers, identified by their public key hashes.
  *
- * \param[in,out] unique_signers A pointer to an initialized \ref cardano_blake2b_hash_set_t object where the unique
+ * \param[in,out] unique_signers A pointer to a set from \ref _cardano_signer_set_new where the unique
  *                               public key hashes required for the transaction inputs will be added. This parameter must not be NULL.
  * \param[in] set A pointer to an initialized \ref cardano_transaction_input_set_t object representing the set of transaction
  *                inputs to be processed. This parameter is required and must not be NULL.
@@ -110,7 +128,7 @@ _cardano_get_payment_pub_key_hash(cardano_address_t* address);
  */
 cardano_error_t
 _cardano_add_input_signers(
-  cardano_blake2b_hash_set_t*      unique_signers,
+  cardano_set_t*                   unique_signers,
   cardano_transaction_input_set_t* set,
   cardano_utxo_list_t*             resolved_inputs);
 
@@ -121,7 +139,7 @@ _cardano_add_input_signers(
  * with each withdrawal address, and adds these hashes to the provided `unique_signers` set. Each withdrawal
  * may require authorization from different signers, identified by their public key hashes.
  *
- * \param[in,out] unique_signers A pointer to an initialized \ref cardano_blake2b_hash_set_t object where the unique
+ * \param[in,out] unique_signers A pointer to a set from \ref _cardano_signer_set_new where the unique
  *                               public key hashes required for the withdrawals will be added. This parameter must not be NULL.
  * \param[in] withdrawals A pointer to an initialized \ref cardano_withdrawal_map_t object representing the set of withdrawals
  *                        to be processed. This parameter is required and must not be NULL. If the map is empty, the function
@@ -133,8 +151,8 @@ _cardano_add_input_signers(
  */
 cardano_error_t
 _cardano_add_withdrawals(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_withdrawal_map_t*   withdrawals);
+  cardano_set_t*            unique_signers,
+  cardano_withdrawal_map_t* withdrawals);
 
 /**
  * \brief Processes a Cardano credential by extracting and adding its unique public key hash.
@@ -143,7 +161,7 @@ _cardano_add_withdrawals(
  * with it if it represents a key hash credential type, and adds this hash to the provided `unique_signers` set.
  * This is commonly used in processing various certificate types where credentials are involved.
  *
- * \param[in,out] unique_signers A pointer to an initialized \ref cardano_blake2b_hash_set_t object where the unique
+ * \param[in,out] unique_signers A pointer to a set from \ref _cardano_signer_set_new where the unique
  *                               public key hash required for the credential will be added. This parameter must not be NULL.
  * \param[in] credential A pointer to an initialized \ref cardano_credential_t object representing the credential
  *                       to be processed. This parameter is required and must not be NULL.
@@ -154,8 +172,8 @@ _cardano_add_withdrawals(
  */
 cardano_error_t
 _process_credential(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_credential_t*       credential);
+  cardano_set_t*        unique_signers,
+  cardano_credential_t* credential);
 
 /**
  * \brief Processes a pool registration certificate by extracting and adding its unique public key hashes.
@@ -165,7 +183,7 @@ _process_credential(
  * represents the registration of a staking pool within the Cardano network, and multiple owners may be associated
  * with a single pool.
  *
- * \param[in,out] unique_signers A pointer to an initialized \ref cardano_blake2b_hash_set_t object where the unique
+ * \param[in,out] unique_signers A pointer to a set from \ref _cardano_signer_set_new where the unique
  *                               public key hashes required for the pool registration certificate will be added.
  *                               This parameter must not be NULL.
  * \param[in] certificate A pointer to an initialized \ref cardano_certificate_t object representing the pool registration
@@ -177,8 +195,8 @@ _process_credential(
  */
 cardano_error_t
 _process_pool_registration(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_certificate_t*      certificate);
+  cardano_set_t*         unique_signers,
+  cardano_certificate_t* certificate);
 
 /**
  * \brief Processes a pool retirement certificate by extracting and adding its unique public key hash.
@@ -187,7 +205,7 @@ _process_pool_registration(
  * with the retiring pool, and adds this hash to the provided `unique_signers` set. This certificate type
  * represents the retirement of a staking pool within the Cardano network.
  *
- * \param[in,out] unique_signers A pointer to an initialized \ref cardano_blake2b_hash_set_t object where the unique
+ * \param[in,out] unique_signers A pointer to a set from \ref _cardano_signer_set_new where the unique
  *                               public key hash required for the pool retirement certificate will be added.
  *                               This parameter must not be NULL.
  * \param[in] certificate A pointer to an initialized \ref cardano_certificate_t object representing the pool retirement
@@ -199,8 +217,8 @@ _process_pool_registration(
  */
 cardano_error_t
 _process_pool_retirement(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_certificate_t*      certificate);
+  cardano_set_t*         unique_signers,
+  cardano_certificate_t* certificate);
 
 /**
  * \brief Processes an authorization committee hot certificate by extracting and adding its unique public key hash.
@@ -208,7 +226,7 @@ _process_pool_retirement(
  * This function processes a Cardano authorization committee hot certificate, extracts the public key hash associated
  * with it, and adds this hash to the provided `unique_signers` set.
  *
- * \param[in,out] unique_signers A pointer to an initialized \ref cardano_blake2b_hash_set_t object where the unique
+ * \param[in,out] unique_signers A pointer to a set from \ref _cardano_signer_set_new where the unique
  *                               public key hash required for the authorization committee hot certificate will be added.
  *                               This parameter must not be NULL.
  * \param[in] certificate A pointer to an initialized \ref cardano_certificate_t object representing the authorization
@@ -220,8 +238,8 @@ _process_pool_retirement(
  */
 cardano_error_t
 _process_auth_committee_hot(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_certificate_t*      certificate);
+  cardano_set_t*         unique_signers,
+  cardano_certificate_t* certificate);
 
 /**
  * \brief Processes a Cardano certificate by extracting and adding the unique public key hash required
@@ -230,7 +248,7 @@ _process_auth_committee_hot(
  * This function examines a specific Cardano certificate of a given type, extracts the public key hash associated
  * with it (if applicable), and adds this hash to the provided `unique_signers` set.
  *
- * \param[in,out] unique_signers A pointer to an initialized \ref cardano_blake2b_hash_set_t object where the unique
+ * \param[in,out] unique_signers A pointer to a set from \ref _cardano_signer_set_new where the unique
  *                               public key hash required for the certificate will be added. This parameter must not be NULL.
  * \param[in] certificate A pointer to an initialized \ref cardano_certificate_t object representing the certificate
  *                        to be processed. This parameter is required and must not be NULL.
@@ -242,9 +260,9 @@ _process_auth_committee_hot(
  */
 cardano_error_t
 _process_certificate_with_credential(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_certificate_t*      certificate,
-  cardano_cert_type_t         type);
+  cardano_set_t*         unique_signers,
+  cardano_certificate_t* certificate,
+  cardano_cert_type_t    type);
 
 /**
  * \brief Adds the unique set of public key hashes required for a set of Cardano certificates.
@@ -252,7 +270,7 @@ _process_certificate_with_credential(
  * This function iterates through a set of Cardano certificates and extracts the unique public key
  * hashes required to authorize each certificate. These hashes are added to the specified `unique_signers` set.
  *
- * \param[in,out] unique_signers A pointer to an initialized \ref cardano_blake2b_hash_set_t object where the unique
+ * \param[in,out] unique_signers A pointer to a set from \ref _cardano_signer_set_new where the unique
  *                               public key hashes required for the certificates will be added. This parameter must
  *                               not be NULL. The caller is responsible for managing this object and ensuring it is
  *                               correctly initialized before calling this function.
@@ -266,8 +284,8 @@ _process_certificate_with_credential(
  */
 cardano_error_t
 _cardano_add_certificates_pub_key_hashes(
-  cardano_blake2b_hash_set_t* unique_signers,
-  cardano_certificate_set_t*  certificates);
+  cardano_set_t*             unique_signers,
+  cardano_certificate_set_t* certificates);
 
 /**
  * \brief Extracts the unique set of public key hashes required for a set of Cardano voting procedures.
@@ -275,7 +293,7 @@ _cardano_add_certificates_pub_key_hashes(
  * This function processes a given set of voting procedures and adds the unique public key hashes
  * (representing the signers) required for each procedure to the specified `unique_signers` set.
  *
- * \param[in,out] unique_signers A pointer to an initialized \ref cardano_blake2b_hash_set_t object where the unique
+ * \param[in,out] unique_signers A pointer to a set from \ref _cardano_signer_set_new where the unique
  *                               public key hashes required for the voting procedures will be added. This parameter must
  *                               not be NULL. The caller is responsible for managing this object and ensuring it is
  *                               correctly initialized before calling this function.
@@ -288,7 +306,7 @@ _cardano_add_certificates_pub_key_hashes(
  */
 cardano_error_t
 _cardano_voting_procedures_pub_key_hashes(
-  cardano_blake2b_hash_set_t*  unique_signers,
+  cardano_set_t*               unique_signers,
   cardano_voting_procedures_t* procedures);
 
 /**
@@ -317,4 +335,51 @@ _cardano_get_unique_signers(
   cardano_utxo_list_t*         resolved_inputs,
   cardano_blake2b_hash_set_t** unique_signers);
 
+/**
+ * \brief Collects the signers of a transaction that do not depend on its inputs.
+ *
+ * These are the required signers, and the key hashes of the withdrawals, certificates and votes of the body.
+ *
+ * \param[in] tx The transaction.
+ * \param[out] body_signers On success, a new signer set. It must be released with \ref cardano_set_unref.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code.
+ */
+cardano_error_t
+_cardano_get_body_signers(
+  cardano_transaction_t* tx,
+  cardano_set_t**        body_signers);
+
+/**
+ * \brief Counts the unique signers of a transaction being balanced, reusing what the cache knows.
+ *
+ * The result is the length of the set \ref _cardano_get_unique_signers would return. The first call collects the
+ * signers of the body; later calls reuse them, and reuse the whole count when the inputs and collateral inputs are
+ * the same as on the previous call. Resolving the inputs takes linear time in the inputs and resolved UTxOs.
+ *
+ * \param[in,out] cache The cache. Must be zero-initialized before the first call, then released with
+ *                      \ref _cardano_unique_signers_cache_release. Must be used with the same transaction on
+ *                      every call, whose fields other than the inputs, collateral, outputs and fee do not change.
+ * \param[in] tx The transaction being balanced.
+ * \param[in] resolved_inputs The UTxOs spent by the inputs and collateral inputs.
+ * \param[out] count On success, the number of unique signers.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_ELEMENT_NOT_FOUND if an input is not in
+ *         `resolved_inputs`, or another appropriate error code.
+ */
+cardano_error_t
+_cardano_unique_signers_cache_count(
+  cardano_unique_signers_cache_t* cache,
+  cardano_transaction_t*          tx,
+  cardano_utxo_list_t*            resolved_inputs,
+  size_t*                         count);
+
+/**
+ * \brief Releases what a signer cache holds, leaving it zero-initialized.
+ *
+ * \param[in,out] cache The cache to release.
+ */
+void
+_cardano_unique_signers_cache_release(cardano_unique_signers_cache_t* cache);
+
 #endif // BIGLUP_LABS_INCLUDE_CARDANO_SIGNERS_COUNT_H
\ No newline at end of file
@@ -21,7 +21,10 @@
 
 /* INCLUDES ******************************************************************/
 
+#include "../../build_profile.h"
 #include "internals/collateral.h"
+#include "internals/evaluation_cache.h"
+#include "internals/tx_size_model.h"
 #include "internals/unique_signers.h"
 #include <cardano/transaction_builder/balancing/implicit_coin.h>
 #include <cardano/transaction_builder/balancing/transaction_balancing.h>
@@ -56,7 +59,7 @@ find_utxo(cardano_utxo_t* item, const void* context)
  * \brief Coalesces all input values in a transaction input set into a single total value.
  *
  * This function iterates over each input in the provided transaction input set, looks up the resolved value
- * in the corresponding UTXO list, and accumulates it into a single total input value.
+ * in the corresponding UTXO list, and accumulates it in place into a single total input value.
  *
  * \param[in]  inputs            The set of transaction inputs to coalesce.
  * \param[in]  resolved_inputs   The UTXO list containing resolved values for each input.
@@ -83,15 +86,13 @@ coalesce_all_inputs(
 
   for (size_t i = 0U; i < num_inputs; ++i)
   {
-    cardano_transaction_input_t* input  = NULL;
-    cardano_error_t              result = cardano_transaction_input_set_get(inputs, i, &input);
-    cardano_transaction_input_unref(&input);
+    cardano_transaction_input_t* input = cardano_transaction_input_set_peek(inputs, i);
 
-    if (result != CARDANO_SUCCESS)
+    if (input == NULL)
     {
       cardano_value_unref(&total_value);
 
-      return result;
+      return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
     }
 
     cardano_utxo_t* utxo = cardano_utxo_list_find(resolved_inputs, find_utxo, (void*)input);
@@ -110,20 +111,14 @@ coalesce_all_inputs(
     cardano_transaction_output_unref(&output);
     cardano_value_unref(&value);
 
-    cardano_value_t* tmp_value = NULL;
-
-    result = cardano_value_add(total_value, value, &tmp_value);
+    cardano_error_t result = cardano_value_add_assign(total_value, value);
 
     if (result != CARDANO_SUCCESS)
     {
-      cardano_value_unref(&tmp_value);
       cardano_value_unref(&total_value);
 
       return result;
     }
-
-    cardano_value_unref(&total_value);
-    total_value = tmp_value;
   }
 
   *total_input_value = total_value;
@@ -135,7 +130,7 @@ coalesce_all_inputs(
  * \brief Coalesces all output values in a transaction output list into a single total value.
  *
  * This function iterates over each transaction output in the provided list, extracts its value,
- * and accumulates it into a single total output value.
+ * and accumulates it in place into a single total output value, so no value is allocated per output.
  *
  * \param[in]  outputs            The list of transaction outputs to coalesce.
  * \param[out] total_output_value  A pointer to store the cumulative value of all outputs.
@@ -158,34 +153,26 @@ coalesce_all_outputs(cardano_transaction_output_list_t* outputs, cardano_value_t
 
   for (size_t i = 0U; i < num_outputs; ++i)
   {
-    cardano_transaction_output_t* output = NULL;
-    cardano_error_t               result = cardano_transaction_output_list_get(outputs, i, &output);
-    cardano_transaction_output_unref(&output);
+    cardano_transaction_output_t* output = cardano_transaction_output_list_peek(outputs, i);
 
-    if (result != CARDANO_SUCCESS)
+    if (output == NULL)
     {
       cardano_value_unref(&total_value);
 
-      return result;
+      return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
     }
 
     cardano_value_t* value = cardano_transaction_output_get_value(output);
     cardano_value_unref(&value);
 
-    cardano_value_t* tmp_value = NULL;
-
-    result = cardano_value_add(total_value, value, &tmp_value);
+    cardano_error_t result = cardano_value_add_assign(total_value, value);
 
     if (result != CARDANO_SUCCESS)
     {
-      cardano_value_unref(&tmp_value);
       cardano_value_unref(&total_value);
 
       return result;
     }
-
-    cardano_value_unref(&total_value);
-    total_value = tmp_value;
   }
 
   *total_output_value = total_value;
@@ -198,9 +185,13 @@ coalesce_all_outputs(cardano_transaction_output_list_t* outputs, cardano_value_t
  *
  * This function takes a list of selected UTXOs and sets them as inputs in the provided transaction body.
  *
+ * The spend redeemer of an input points at the position of the input in the sorted input set, so the redeemers whose
+ * input moved are renumbered, and the redeemer list of the witness set is reindexed only when one of them did.
+ *
  * \param[in,out] body       The transaction body to which the inputs will be added.
  * \param[in]     selection  The list of selected UTXOs to be set as transaction inputs.
  * \param[in]     input_to_redeemer_map A map of input to redeemer values.
+ * \param[in,out] redeemers  The redeemers of the witness set, or NULL.
  *
  * \return \ref CARDANO_SUCCESS if the inputs were successfully set, or an appropriate error code indicating failure.
  */
@@ -208,7 +199,8 @@ static cardano_error_t
 set_transaction_inputs(
   cardano_transaction_body_t*      body,
   cardano_utxo_list_t*             selection,
-  cardano_input_to_redeemer_map_t* input_to_redeemer_map)
+  cardano_input_to_redeemer_map_t* input_to_redeemer_map,
+  cardano_redeemer_list_t*         redeemers)
 {
   cardano_transaction_input_set_t* inputs = NULL;
   cardano_error_t                  result = cardano_transaction_input_set_new(&inputs);
@@ -222,15 +214,13 @@ set_transaction_inputs(
 
   for (size_t i = 0U; i < num_inputs; ++i)
   {
-    cardano_utxo_t* utxo = NULL;
-    result               = cardano_utxo_list_get(selection, i, &utxo);
-    cardano_utxo_unref(&utxo);
+    cardano_utxo_t* utxo = cardano_utxo_list_peek(selection, i);
 
-    if (result != CARDANO_SUCCESS)
+    if (utxo == NULL)
     {
       cardano_transaction_input_set_unref(&inputs);
 
-      return result;
+      return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
     }
 
     cardano_transaction_input_t* input = cardano_utxo_get_input(utxo);
@@ -244,20 +234,41 @@ set_transaction_inputs(
 
       return result;
     }
+  }
+
+  bool is_renumbered = false;
+
+  for (size_t i = 0U; (input_to_redeemer_map != NULL) && (i < num_inputs); ++i)
+  {
+    cardano_transaction_input_t* input    = cardano_transaction_input_set_peek(inputs, i);
+    cardano_redeemer_t*          redeemer = NULL;
 
-    if (input_to_redeemer_map != NULL)
+    if (cardano_input_to_redeemer_map_get(input_to_redeemer_map, input, &redeemer) != CARDANO_SUCCESS)
     {
-      result = cardano_input_to_redeemer_map_update_redeemer_index(input_to_redeemer_map, input, i);
+      continue;
+    }
 
-      if (result != CARDANO_SUCCESS)
-      {
-        cardano_transaction_input_set_unref(&inputs);
+    if (cardano_redeemer_get_index(redeemer) != (uint64_t)i)
+    {
+      result        = cardano_redeemer_set_index(redeemer, i);
+      is_renumbered = true;
+    }
 
-        return result;
-      }
+    cardano_redeemer_unref(&redeemer);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_transaction_input_set_unref(&inputs);
+
+      return result;
     }
   }
 
+  if (is_renumbered)
+  {
+    cardano_redeemer_list_reindex(redeemers);
+  }
+
   result = cardano_transaction_body_set_inputs(body, inputs);
 
   cardano_transaction_input_set_unref(&inputs);
@@ -352,6 +363,12 @@ shallow_clone_outputs(cardano_transaction_output_list_t* original)
 {
   cardano_transaction_output_list_t* new_outputs = NULL;
   cardano_error_t                    result      = cardano_transaction_output_list_new(&new_outputs);
+  const size_t                       num_outputs = cardano_transaction_output_list_get_length(original);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_transaction_output_list_reserve(new_outputs, num_outputs);
+  }
 
   if (result != CARDANO_SUCCESS)
   {
@@ -360,15 +377,11 @@ shallow_clone_outputs(cardano_transaction_output_list_t* original)
     return NULL;
   }
 
-  const size_t num_outputs = cardano_transaction_output_list_get_length(original);
-
   for (size_t i = 0U; i < num_outputs; ++i)
   {
-    cardano_transaction_output_t* output = NULL;
-    result                               = cardano_transaction_output_list_get(original, i, &output);
-    cardano_transaction_output_unref(&output);
+    cardano_transaction_output_t* output = cardano_transaction_output_list_peek(original, i);
 
-    if (result != CARDANO_SUCCESS)
+    if (output == NULL)
     {
       cardano_transaction_output_list_unref(&new_outputs);
 
@@ -434,6 +447,39 @@ cbor_array_header_size(const size_t element_count)
  *
  * \return The computed cost for including the VK witnesses.
  */
+/**
+ * \brief Reads the profile clock if a build is being profiled.
+ *
+ * \param[in] profile The active build profile, or \c NULL.
+ *
+ * \return The current profile time, or 0 if `profile` is \c NULL.
+ */
+static uint64_t
+profile_start(const cardano_tx_build_profile_t* profile)
+{
+  return (profile != NULL) ? _cardano_build_profile_now() : 0U;
+}
+
+/**
+ * \brief Adds one call and the time elapsed since `start` to a pair of profile counters.
+ *
+ * \param[in] profile The active build profile, or \c NULL, in which case nothing is recorded.
+ * \param[in,out] count The call counter of the phase.
+ * \param[in,out] elapsed_ns The time counter of the phase.
+ * \param[in] start The time returned by \ref profile_start when the call began.
+ */
+static void
+profile_record(const cardano_tx_build_profile_t* profile, uint64_t* count, uint64_t* elapsed_ns, const uint64_t start)
+{
+  if (profile == NULL)
+  {
+    return;
+  }
+
+  ++(*count);
+  *elapsed_ns += _cardano_build_profile_now() - start;
+}
+
 static int64_t
 compute_vk_witnesses_cost(const size_t signature_count, const uint64_t min_fee_coefficient)
 {
@@ -442,10 +488,16 @@ compute_vk_witnesses_cost(const size_t signature_count, const uint64_t min_fee_c
   return (int64_t)vk_witness_set_size * (int64_t)min_fee_coefficient;
 }
 
-/* IMPLEMENTATION ************************************************************/
-
-cardano_error_t
-cardano_balance_transaction(
+/**
+ * \brief Balances a transaction; see \ref cardano_balance_transaction.
+ *
+ * \param[in,out] signer_cache The signers counted on previous iterations of the balancing loop.
+ * \param[in,out] collateral_cache The collateral chosen on previous iterations of the balancing loop.
+ *
+ * Both caches are released by the caller, so the loop can return from anywhere.
+ */
+static cardano_error_t
+balance_transaction(
   cardano_transaction_t*           unbalanced_tx,
   const size_t                     foreign_signature_count,
   cardano_protocol_parameters_t*   protocol_params,
@@ -457,7 +509,10 @@ cardano_balance_transaction(
   cardano_address_t*               change_address,
   cardano_utxo_list_t*             available_collateral_utxo,
   cardano_address_t*               collateral_change_address,
-  cardano_tx_evaluator_t*          evaluator)
+  cardano_tx_evaluator_t*          evaluator,
+  cardano_unique_signers_cache_t*  signer_cache,
+  cardano_collateral_cache_t*      collateral_cache,
+  cardano_evaluation_cache_t*      evaluation_cache)
 {
   cardano_error_t result      = CARDANO_SUCCESS;
   bool            is_balanced = false;
@@ -480,11 +535,19 @@ cardano_balance_transaction(
   cardano_transaction_output_list_t* shallow_cloned_outputs = shallow_clone_outputs(original_outputs);
   cardano_transaction_output_list_unref(&original_outputs);
 
-  uint64_t fee            = cardano_transaction_body_get_fee(body);
-  uint64_t change_padding = 0U;
+  uint64_t                fee            = cardano_transaction_body_get_fee(body);
+  uint64_t                change_padding = 0U;
+  cardano_tx_size_model_t size_model     = { 0 };
+
+  // Only the builder profiles; the dummy counters keep the recording below free of NULL checks
+  cardano_tx_build_profile_t* profile   = _cardano_build_profile_current();
+  cardano_tx_build_profile_t  discarded = { 0 };
+  cardano_tx_build_profile_t* counters  = (profile != NULL) ? profile : &discarded;
 
   while (!is_balanced)
   {
+    ++counters->balancing_iterations;
+
     cardano_transaction_output_list_t* outputs            = cardano_transaction_body_get_outputs(body);
     cardano_value_t*                   total_output_value = NULL;
     result                                                = coalesce_all_outputs(outputs, &total_output_value);
@@ -497,7 +560,8 @@ cardano_balance_transaction(
       return result;
     }
 
-    result = _cardano_set_collateral_output(
+    result = _cardano_set_cached_collateral_output(
+      collateral_cache,
       unbalanced_tx,
       protocol_params,
       available_collateral_utxo,
@@ -542,6 +606,8 @@ cardano_balance_transaction(
     cardano_utxo_list_t* selection      = NULL;
     cardano_utxo_list_t* remaining_utxo = NULL;
 
+    uint64_t phase_start = profile_start(profile);
+
     result = cardano_coin_selector_select(
       coin_selector,
       pre_selected_utxo,
@@ -550,6 +616,8 @@ cardano_balance_transaction(
       &selection,
       &remaining_utxo);
 
+    profile_record(profile, &counters->selection_count, &counters->selection_ns, phase_start);
+
     if (result != CARDANO_SUCCESS)
     {
       cardano_transaction_output_list_unref(&shallow_cloned_outputs);
@@ -558,7 +626,13 @@ cardano_balance_transaction(
       return result;
     }
 
-    result = set_transaction_inputs(body, selection, input_to_redeemer_map);
+    cardano_witness_set_t* input_witnesses = cardano_transaction_get_witness_set(unbalanced_tx);
+    cardano_witness_set_unref(&input_witnesses);
+
+    cardano_redeemer_list_t* input_redeemers = cardano_witness_set_get_redeemers(input_witnesses);
+    cardano_redeemer_list_unref(&input_redeemers);
+
+    result = set_transaction_inputs(body, selection, input_to_redeemer_map, input_redeemers);
 
     if (result != CARDANO_SUCCESS)
     {
@@ -705,7 +779,19 @@ cardano_balance_transaction(
     if (has_plutus_scripts)
     {
       cardano_redeemer_list_t* redeemers = NULL;
-      result                             = cardano_tx_evaluator_evaluate(evaluator, unbalanced_tx, selection, &redeemers);
+      bool                     cache_hit = false;
+
+      phase_start = profile_start(profile);
+      result      = _cardano_evaluate_cached(evaluation_cache, evaluator, unbalanced_tx, selection, &redeemers, &cache_hit);
+
+      if (cache_hit)
+      {
+        ++counters->evaluation_cache_hits;
+      }
+      else
+      {
+        profile_record(profile, &counters->evaluation_count, &counters->evaluation_ns, phase_start);
+      }
 
       if (result != CARDANO_SUCCESS)
       {
@@ -722,18 +808,16 @@ cardano_balance_transaction(
 
       for (size_t i = 0U; i < redeemers_count; ++i)
       {
-        cardano_redeemer_t* redeemer = NULL;
-        result                       = cardano_redeemer_list_get(redeemers, i, &redeemer);
-        cardano_redeemer_unref(&redeemer);
+        cardano_redeemer_t* redeemer = cardano_redeemer_list_peek(redeemers, i);
 
-        if (result != CARDANO_SUCCESS)
+        if (redeemer == NULL)
         {
           cardano_transaction_output_list_unref(&shallow_cloned_outputs);
           cardano_utxo_list_unref(&selection);
           cardano_utxo_list_unref(&remaining_utxo);
           cardano_redeemer_list_unref(&redeemers);
 
-          return result;
+          return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
         }
 
         const cardano_redeemer_tag_t tag   = cardano_redeemer_get_tag(redeemer);
@@ -779,9 +863,9 @@ cardano_balance_transaction(
       resolved_inputs = resolved_with_collateral;
     }
 
-    cardano_blake2b_hash_set_t* unique_signers = NULL;
+    size_t unique_signer_count = 0U;
 
-    result = _cardano_get_unique_signers(unbalanced_tx, resolved_inputs, &unique_signers);
+    result = _cardano_unique_signers_cache_count(signer_cache, unbalanced_tx, resolved_inputs, &unique_signer_count);
 
     if (result != CARDANO_SUCCESS)
     {
@@ -793,16 +877,18 @@ cardano_balance_transaction(
       return result;
     }
 
-    result = cardano_compute_transaction_fee(unbalanced_tx, reference_inputs, protocol_params, &computed_fee);
+    phase_start = profile_start(profile);
+    result      = _cardano_tx_size_model_compute_fee(&size_model, unbalanced_tx, reference_inputs, protocol_params, &computed_fee);
 
-    const uint64_t signer_count      = foreign_signature_count + cardano_blake2b_hash_set_get_length(unique_signers);
+    profile_record(profile, &counters->fee_computation_count, &counters->fee_computation_ns, phase_start);
+
+    const uint64_t signer_count      = foreign_signature_count + unique_signer_count;
     const int64_t  vk_witnesses_cost = compute_vk_witnesses_cost(signer_count, cardano_protocol_parameters_get_min_fee_a(protocol_params));
 
     computed_fee += (uint64_t)vk_witnesses_cost;
 
     cardano_utxo_list_unref(&selection);
     cardano_utxo_list_unref(&remaining_utxo);
-    cardano_blake2b_hash_set_unref(&unique_signers);
 
     if (result != CARDANO_SUCCESS)
     {
@@ -812,8 +898,32 @@ cardano_balance_transaction(
       return result;
     }
 
+    if (computed_fee <= fee)
+    {
+      // The size model only tracks the fields this loop rewrites, so confirm with a full serialization before
+      // accepting the fee.
+      uint64_t exact_fee = 0U;
+
+      phase_start = profile_start(profile);
+      result      = cardano_compute_transaction_fee(unbalanced_tx, reference_inputs, protocol_params, &exact_fee);
+
+      profile_record(profile, &counters->fee_computation_count, &counters->fee_computation_ns, phase_start);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        cardano_transaction_output_list_unref(&shallow_cloned_outputs);
+        cardano_utxo_list_unref(&resolved_inputs);
+
+        return result;
+      }
+
+      computed_fee = exact_fee + (uint64_t)vk_witnesses_cost;
+    }
+
     if (computed_fee > fee)
     {
+      ++counters->fee_iterations;
+
       fee    = computed_fee;
       result = cardano_transaction_body_set_fee(body, fee);
 
@@ -902,6 +1012,51 @@ cardano_balance_transaction(
   return CARDANO_SUCCESS;
 }
 
+/* IMPLEMENTATION ************************************************************/
+
+cardano_error_t
+cardano_balance_transaction(
+  cardano_transaction_t*           unbalanced_tx,
+  const size_t                     foreign_signature_count,
+  cardano_protocol_parameters_t*   protocol_params,
+  cardano_utxo_list_t*             reference_inputs,
+  cardano_utxo_list_t*             pre_selected_utxo,
+  cardano_input_to_redeemer_map_t* input_to_redeemer_map,
+  cardano_utxo_list_t*             available_utxo,
+  cardano_coin_selector_t*         coin_selector,
+  cardano_address_t*               change_address,
+  cardano_utxo_list_t*             available_collateral_utxo,
+  cardano_address_t*               collateral_change_address,
+  cardano_tx_evaluator_t*          evaluator)
+{
+  cardano_unique_signers_cache_t signer_cache     = { 0 };
+  cardano_collateral_cache_t     collateral_cache = { 0 };
+  cardano_evaluation_cache_t     evaluation_cache = { 0 };
+
+  cardano_error_t result = balance_transaction(
+    unbalanced_tx,
+    foreign_signature_count,
+    protocol_params,
+    reference_inputs,
+    pre_selected_utxo,
+    input_to_redeemer_map,
+    available_utxo,
+    coin_selector,
+    change_address,
+    available_collateral_utxo,
+    collateral_change_address,
+    evaluator,
+    &signer_cache,
+    &collateral_cache,
+    &evaluation_cache);
+
+  _cardano_unique_signers_cache_release(&signer_cache);
+  _cardano_collateral_cache_release(&collateral_cache);
+  _cardano_evaluation_cache_release(&evaluation_cache);
+
+  return result;
+}
+
 cardano_error_t
 cardano_is_transaction_balanced(
   cardano_transaction_t*         tx,
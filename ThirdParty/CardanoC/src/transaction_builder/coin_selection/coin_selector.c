@@ -88,7 +88,7 @@ cardano_coin_selector_new(
 
   (*coin_selector)->base.deallocator   = cardano_coin_selector_deallocate;
   (*coin_selector)->base.ref_count     = 1;
-  (*coin_selector)->base.last_error[0] = '\0';
+  (*coin_selector)->base.last_error    = NULL;
 
   (*coin_selector)->impl = impl;
 
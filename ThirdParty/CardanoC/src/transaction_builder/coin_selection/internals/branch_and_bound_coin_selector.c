@@ -0,0 +1,532 @@
+/**
+ * \file branch_and_bound_coin_selector.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/assets/asset_id.h>
+#include <cardano/common/utxo.h>
+#include <cardano/common/utxo_list.h>
+#include <cardano/error.h>
+#include <cardano/object.h>
+#include <cardano/transaction_builder/coin_selection/branch_and_bound_coin_selector.h>
+#include <cardano/transaction_builder/coin_selection/coin_selector.h>
+#include <cardano/transaction_builder/coin_selection/large_first_coin_selector.h>
+
+#include "../../../allocators.h"
+#include "../../../string_safe.h"
+#include "./large_first_helpers.h"
+#include "./selection_state.h"
+#include "./utxo_columns.h"
+
+#include <assert.h>
+#include <string.h>
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Context of the branch and bound coin selector.
+ */
+typedef struct branch_and_bound_context_t
+{
+    cardano_object_t         base;
+    uint64_t                 tolerance;
+    size_t                   max_nodes;
+    cardano_coin_selector_t* fallback;
+} branch_and_bound_context_t;
+
+/**
+ * \brief Working buffers of a branch and bound search over the lovelace-only candidates.
+ *
+ * Candidates are sorted by decreasing lovelace. `suffix_sums[i]` is the lovelace of candidates `i` and later, which
+ * bounds what a branch can still reach.
+ */
+typedef struct search_t
+{
+    size_t   count;
+    size_t*  rows;
+    int64_t* values;
+    int64_t* suffix_sums;
+    size_t*  stack;
+    size_t*  best;
+    size_t   best_size;
+} search_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates the selector context.
+ *
+ * \param object A void pointer to the context to be deallocated.
+ */
+static void
+branch_and_bound_context_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  branch_and_bound_context_t* context = (branch_and_bound_context_t*)object;
+
+  cardano_coin_selector_unref(&context->fallback);
+
+  _cardano_free(object);
+}
+
+/**
+ * \brief Releases the buffers of a search.
+ *
+ * \param[in,out] search The search to release.
+ */
+static void
+search_free(search_t* search)
+{
+  _cardano_free(search->rows);
+  _cardano_free(search->values);
+  _cardano_free(search->suffix_sums);
+  _cardano_free(search->stack);
+  _cardano_free(search->best);
+}
+
+/**
+ * \brief Collects the lovelace-only rows of the snapshot, largest first.
+ *
+ * \param[in,out] state The selection state; its row order is left sorted by lovelace.
+ * \param[out] search The search to initialize.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+search_init(cardano_selection_state_t* state, search_t* search)
+{
+  const cardano_utxo_columns_t* columns = state->columns;
+  const size_t                  rows    = (columns->count == 0U) ? 1U : columns->count;
+
+  CARDANO_UNUSED(memset(search, 0, sizeof(search_t)));
+
+  search->rows        = (size_t*)_cardano_malloc(rows * sizeof(size_t));
+  search->values      = (int64_t*)_cardano_malloc(rows * sizeof(int64_t));
+  search->suffix_sums = (int64_t*)_cardano_malloc((rows + 1U) * sizeof(int64_t));
+  search->stack       = (size_t*)_cardano_malloc(rows * sizeof(size_t));
+  search->best        = (size_t*)_cardano_malloc(rows * sizeof(size_t));
+
+  if ((search->rows == NULL) || (search->values == NULL) || (search->suffix_sums == NULL) || (search->stack == NULL) || (search->best == NULL))
+  {
+    search_free(search);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memcpy(state->amounts, columns->lovelace, columns->count * sizeof(int64_t)));
+  _cardano_utxo_columns_sort_desc(state->order, columns->count, state->amounts, state->scratch);
+
+  for (size_t i = 0U; i < columns->count; ++i)
+  {
+    const size_t row = state->order[i];
+
+    if ((columns->asset_offsets[row] == columns->asset_offsets[row + 1U]) && (columns->lovelace[row] > 0))
+    {
+      search->rows[search->count]   = row;
+      search->values[search->count] = columns->lovelace[row];
+      ++search->count;
+    }
+  }
+
+  search->suffix_sums[search->count] = 0;
+
+  for (size_t i = search->count; i > 0U; --i)
+  {
+    search->suffix_sums[i - 1U] = _cardano_selection_saturating_add(search->suffix_sums[i], search->values[i - 1U]);
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Searches for the subset of candidates whose lovelace lands in `[needed, needed + tolerance]` with the least
+ * excess.
+ *
+ * Candidates are included depth first in decreasing order of value. A branch is abandoned when it overshoots the
+ * window or when the remaining candidates cannot bring it up to `needed`. After a candidate is excluded, the next
+ * candidates with the same value are skipped, since including them would repeat the branch just explored.
+ *
+ * \param[in,out] search The search; on return `best` and `best_size` hold the best subset found, if any.
+ * \param[in] needed The lovelace to cover.
+ * \param[in] tolerance The lovelace the selection may spend above `needed`.
+ * \param[in] max_nodes The number of search steps after which the search stops.
+ *
+ * \return true if a subset was found.
+ */
+static bool
+search_run(search_t* search, const int64_t needed, const uint64_t tolerance, const size_t max_nodes)
+{
+  const int64_t upper_bound = _cardano_selection_saturating_add(needed, (tolerance > (uint64_t)INT64_MAX) ? INT64_MAX : (int64_t)tolerance);
+
+  uint64_t best_excess = UINT64_MAX;
+  bool     found       = false;
+  size_t   depth       = 0U;
+  size_t   stack_size  = 0U;
+  int64_t  sum         = 0;
+
+  for (size_t nodes = 0U; nodes < max_nodes; ++nodes)
+  {
+    bool backtrack = false;
+
+    if ((sum > upper_bound) || (_cardano_selection_saturating_add(sum, search->suffix_sums[depth]) < needed))
+    {
+      backtrack = true;
+    }
+    else if (sum >= needed)
+    {
+      const uint64_t excess = (uint64_t)sum - (uint64_t)needed;
+
+      if (excess < best_excess)
+      {
+        best_excess       = excess;
+        found             = true;
+        search->best_size = stack_size;
+
+        CARDANO_UNUSED(memcpy(search->best, search->stack, stack_size * sizeof(size_t)));
+
+        if (excess == 0U)
+        {
+          break;
+        }
+      }
+
+      backtrack = true;
+    }
+
+    if (!backtrack)
+    {
+      search->stack[stack_size] = depth;
+      ++stack_size;
+
+      sum += search->values[depth];
+      ++depth;
+
+      continue;
+    }
+
+    if (stack_size == 0U)
+    {
+      break;
+    }
+
+    --stack_size;
+
+    const size_t excluded = search->stack[stack_size];
+
+    sum  -= search->values[excluded];
+    depth = excluded + 1U;
+
+    while ((depth < search->count) && (search->values[depth] == search->values[excluded]))
+    {
+      ++depth;
+    }
+  }
+
+  return found;
+}
+
+/**
+ * \brief Builds a selection from the pre-selected UTxOs and the given rows, and the list of rows left over.
+ *
+ * \param[in] pre_selected_utxo The pre-selected UTxOs, or NULL.
+ * \param[in,out] state The selection state.
+ * \param[in] search The search holding the chosen rows, or NULL to choose none.
+ * \param[out] selection On success, the selection.
+ * \param[out] remaining_utxo On success, the UTxOs that were not selected, in their original order.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code.
+ */
+static cardano_error_t
+build_result(
+  cardano_utxo_list_t*       pre_selected_utxo,
+  cardano_selection_state_t* state,
+  const search_t*            search,
+  cardano_utxo_list_t**      selection,
+  cardano_utxo_list_t**      remaining_utxo)
+{
+  cardano_error_t result = cardano_utxo_list_new(selection);
+
+  const size_t pre_selected_count = cardano_utxo_list_get_length(pre_selected_utxo);
+
+  for (size_t i = 0U; (i < pre_selected_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    result = cardano_utxo_list_add(*selection, cardano_utxo_list_peek(pre_selected_utxo, i));
+  }
+
+  const size_t chosen_count = (search == NULL) ? 0U : search->best_size;
+
+  for (size_t i = 0U; (i < chosen_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    const size_t row = search->rows[search->best[i]];
+
+    result = cardano_utxo_list_add(*selection, _cardano_utxo_columns_peek_utxo(state->columns, row));
+
+    _cardano_selection_state_mark_selected(state, row);
+  }
+
+  for (size_t i = 0U; i < state->columns->count; ++i)
+  {
+    state->order[i] = i;
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = _cardano_selection_state_collect_remaining(state, remaining_utxo);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(selection);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Looks for a changeless selection.
+ *
+ * \param[in] context The selector context.
+ * \param[in] pre_selected_utxo The pre-selected UTxOs, or NULL.
+ * \param[in] available_utxo The available UTxOs.
+ * \param[in] target The target value.
+ * \param[out] selection On success, the selection.
+ * \param[out] remaining_utxo On success, the UTxOs that were not selected.
+ * \param[out] found Set to true if a changeless selection was found.
+ *
+ * \return \ref CARDANO_SUCCESS if the search ran, whether or not it found a selection, or an error code.
+ */
+static cardano_error_t
+select_changeless(
+  const branch_and_bound_context_t* context,
+  cardano_utxo_list_t*              pre_selected_utxo,
+  cardano_utxo_list_t*              available_utxo,
+  cardano_value_t*                  target,
+  cardano_utxo_list_t**             selection,
+  cardano_utxo_list_t**             remaining_utxo,
+  bool*                             found)
+{
+  *found = false;
+
+  cardano_multi_asset_t* target_assets = cardano_value_get_multi_asset(target);
+  cardano_multi_asset_unref(&target_assets);
+
+  if (cardano_multi_asset_get_policy_count(target_assets) > 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_value_t* preselected_value = NULL;
+  cardano_error_t  result            = CARDANO_SUCCESS;
+
+  if (pre_selected_utxo != NULL)
+  {
+    bool satisfies_target = false;
+
+    result = _cardano_large_fist_check_preselected(pre_selected_utxo, target, &preselected_value, &satisfies_target);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+  }
+
+  cardano_multi_asset_t* preselected_assets = cardano_value_get_multi_asset(preselected_value);
+  cardano_multi_asset_unref(&preselected_assets);
+
+  const int64_t preselected_coin = (preselected_value == NULL) ? 0 : cardano_value_get_coin(preselected_value);
+  const bool    has_assets       = cardano_multi_asset_get_policy_count(preselected_assets) > 0U;
+
+  cardano_value_unref(&preselected_value);
+
+  if (has_assets)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  const int64_t needed = cardano_value_get_coin(target) - preselected_coin;
+
+  cardano_utxo_list_t* candidates = cardano_utxo_list_clone(available_utxo);
+
+  if (candidates == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  const size_t pre_selected_count = cardano_utxo_list_get_length(pre_selected_utxo);
+
+  for (size_t i = 0U; (i < pre_selected_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    result = cardano_utxo_list_remove(candidates, cardano_utxo_list_peek(pre_selected_utxo, i));
+
+    if (result == CARDANO_ERROR_ELEMENT_NOT_FOUND)
+    {
+      result = CARDANO_SUCCESS;
+    }
+  }
+
+  cardano_selection_state_t state = { 0 };
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = _cardano_selection_state_init(candidates, &state);
+  }
+
+  cardano_utxo_list_unref(&candidates);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  if (needed <= 0)
+  {
+    // The pre-selected UTxOs already cover the target; they are changeless if they do not overshoot it by too much.
+    if ((pre_selected_count > 0U) && (((uint64_t)0 - (uint64_t)needed) <= context->tolerance))
+    {
+      result = build_result(pre_selected_utxo, &state, NULL, selection, remaining_utxo);
+      *found = (result == CARDANO_SUCCESS);
+    }
+
+    _cardano_selection_state_free(&state);
+
+    return result;
+  }
+
+  search_t search = { 0 };
+
+  result = search_init(&state, &search);
+
+  if ((result == CARDANO_SUCCESS) && search_run(&search, needed, context->tolerance, context->max_nodes))
+  {
+    result = build_result(pre_selected_utxo, &state, &search, selection, remaining_utxo);
+    *found = (result == CARDANO_SUCCESS);
+  }
+
+  search_free(&search);
+  _cardano_selection_state_free(&state);
+
+  return result;
+}
+
+/**
+ * \brief Selects UTXOs that cover the target without change, or delegates to the fallback selector.
+ *
+ * \param[in] coin_selector A pointer to the coin selector implementation object.
+ * \param[in] pre_selected_utxo A list of pre-selected UTXOs that must be included in the final selection.
+ * \param[in] available_utxo A list of available UTXOs to select from.
+ * \param[in] target A pointer to a \ref cardano_value_t object that defines the target amount of ADA and assets.
+ * \param[out] selection A pointer to the list of selected UTXOs that meet the target value.
+ * \param[out] remaining_utxo A pointer to the list of UTXOs that were not selected and remain available for future transactions.
+ *
+ * \return \ref CARDANO_SUCCESS if UTXOs were successfully selected, or an appropriate error code indicating failure.
+ */
+static cardano_error_t
+select(
+  cardano_coin_selector_impl_t* coin_selector,
+  cardano_utxo_list_t*          pre_selected_utxo,
+  cardano_utxo_list_t*          available_utxo,
+  cardano_value_t*              target,
+  cardano_utxo_list_t**         selection,
+  cardano_utxo_list_t**         remaining_utxo)
+{
+  assert(coin_selector != NULL);
+  assert(available_utxo != NULL);
+  assert(target != NULL);
+
+  const branch_and_bound_context_t* context = (const branch_and_bound_context_t*)((const void*)coin_selector->context);
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  bool            found  = false;
+  cardano_error_t result = select_changeless(context, pre_selected_utxo, available_utxo, target, selection, remaining_utxo, &found);
+
+  if ((result != CARDANO_SUCCESS) || found)
+  {
+    return result;
+  }
+
+  return cardano_coin_selector_select(context->fallback, pre_selected_utxo, available_utxo, target, selection, remaining_utxo);
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_branch_and_bound_coin_selector_new(
+  const uint64_t            tolerance,
+  const size_t              max_nodes,
+  cardano_coin_selector_t*  fallback,
+  cardano_coin_selector_t** coin_selector)
+{
+  static const char*           handler_name = "Branch and bound coin selector";
+  cardano_coin_selector_impl_t impl         = { 0 };
+
+  if (coin_selector == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_safe_memcpy(impl.name, 256U, handler_name, cardano_safe_strlen(handler_name, 256U));
+
+  branch_and_bound_context_t* context = (branch_and_bound_context_t*)_cardano_malloc(sizeof(branch_and_bound_context_t));
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  context->base.ref_count     = 1;
+  context->base.last_error    = NULL;
+  context->base.deallocator   = branch_and_bound_context_deallocate;
+  context->tolerance          = tolerance;
+  context->max_nodes          = (max_nodes == 0U) ? CARDANO_BRANCH_AND_BOUND_DEFAULT_MAX_NODES : max_nodes;
+  context->fallback           = NULL;
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (fallback != NULL)
+  {
+    cardano_coin_selector_ref(fallback);
+    context->fallback = fallback;
+  }
+  else
+  {
+    result = cardano_large_first_coin_selector_new(&context->fallback);
+  }
+
+  impl.select  = select;
+  impl.context = (cardano_object_t*)((void*)context);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_coin_selector_new(impl, coin_selector);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_object_unref(&impl.context);
+  }
+
+  return result;
+}
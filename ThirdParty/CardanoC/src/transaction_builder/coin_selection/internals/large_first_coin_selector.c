@@ -31,12 +31,141 @@
 
 #include "../../../string_safe.h"
 #include "./large_first_helpers.h"
+#include "./selection_state.h"
+#include "./utxo_columns.h"
 
 #include <assert.h>
 #include <string.h>
 
 /* STATIC FUNCTIONS ************************************************************/
 
+/**
+ * \brief Selects rows, largest amount first, until the required amount is reached.
+ *
+ * \param[in,out] state The selection state.
+ * \param[in] rows The candidate rows, sorted by decreasing amount.
+ * \param[in] amounts The amount held by each candidate row, in the same order as `rows`.
+ * \param[in] count The number of candidate rows.
+ * \param[in] required_amount The amount required.
+ * \param[in,out] accumulated_amount The amount covered so far.
+ * \param[out] selection The list the selected UTxOs are appended to.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code.
+ */
+static cardano_error_t
+select_rows(
+  cardano_selection_state_t* state,
+  const size_t*              rows,
+  const int64_t*             amounts,
+  const size_t               count,
+  const int64_t              required_amount,
+  int64_t*                   accumulated_amount,
+  cardano_utxo_list_t*       selection)
+{
+  for (size_t i = 0U; (i < count) && (*accumulated_amount < required_amount); ++i)
+  {
+    const size_t row = rows[i];
+
+    if (state->selected[row] || (amounts[i] <= 0))
+    {
+      continue;
+    }
+
+    cardano_error_t result = cardano_utxo_list_add(selection, _cardano_utxo_columns_peek_utxo(state->columns, row));
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    *accumulated_amount = _cardano_selection_saturating_add(*accumulated_amount, amounts[i]);
+
+    _cardano_selection_state_mark_selected(state, row);
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Selects the rows holding the most of an asset until the required amount is reached.
+ *
+ * Native assets are looked up in the asset index of the snapshot, so only the rows holding the asset are ranked.
+ * Lovelace is held by every row, which are ranked by the lovelace column. Both use a stable sort, so rows are taken
+ * largest amount first, with ties in their original order.
+ *
+ * \param[in,out] state The selection state.
+ * \param[in] asset_id The asset to select for.
+ * \param[in] required_amount The amount of the asset required.
+ * \param[in] initial_amount The amount of the asset already covered outside of the snapshot (pre-selected UTxOs).
+ * \param[out] selection The list the selected UTxOs are appended to.
+ *
+ * \return \ref CARDANO_SUCCESS if the required amount was reached, \ref CARDANO_ERROR_BALANCE_INSUFFICIENT if the
+ *         available UTxOs do not hold enough of the asset, or another error code.
+ */
+static cardano_error_t
+select_asset(
+  cardano_selection_state_t* state,
+  cardano_asset_id_t*        asset_id,
+  const int64_t              required_amount,
+  const int64_t              initial_amount,
+  cardano_utxo_list_t*       selection)
+{
+  int64_t accumulated_amount = _cardano_selection_saturating_add(initial_amount, _cardano_selection_state_get_selected_amount(state, asset_id));
+
+  if (accumulated_amount >= required_amount)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (cardano_asset_id_is_lovelace(asset_id))
+  {
+    const size_t count = state->columns->count;
+
+    _cardano_utxo_columns_sort_desc(state->order, count, state->columns->lovelace, state->scratch);
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      state->amounts[i] = state->columns->lovelace[state->order[i]];
+    }
+
+    result = select_rows(state, state->order, state->amounts, count, required_amount, &accumulated_amount, selection);
+  }
+  else
+  {
+    const size_t*  rows       = NULL;
+    const int64_t* quantities = NULL;
+    size_t         count      = 0U;
+
+    if (_cardano_utxo_columns_get_asset_rows(state->columns, asset_id, &rows, &quantities, &count))
+    {
+      // Sort positions into the asset's rows rather than the rows themselves, so only those rows are ranked.
+      for (size_t i = 0U; i < count; ++i)
+      {
+        state->candidates[i] = i;
+      }
+
+      _cardano_utxo_columns_sort_desc(state->candidates, count, quantities, state->scratch);
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        state->amounts[i]    = quantities[state->candidates[i]];
+        state->candidates[i] = rows[state->candidates[i]];
+      }
+
+      result = select_rows(state, state->candidates, state->amounts, count, required_amount, &accumulated_amount, selection);
+    }
+  }
+
+  if ((result == CARDANO_SUCCESS) && (accumulated_amount < required_amount))
+  {
+    return CARDANO_ERROR_BALANCE_INSUFFICIENT;
+  }
+
+  return result;
+}
+
 /**
  * \brief Selects UTXOs from the available list and pre-selected UTXOs to meet the target value.
  *
@@ -142,6 +271,19 @@ select(
     }
   }
 
+  cardano_selection_state_t state = { 0 };
+
+  result = _cardano_selection_state_init(*remaining_utxo, &state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(selection);
+    cardano_utxo_list_unref(remaining_utxo);
+    cardano_value_unref(&accumulated_value);
+
+    return result;
+  }
+
   cardano_asset_id_map_t* assets      = cardano_value_as_assets_map(target);
   size_t                  asset_count = cardano_asset_id_map_get_length(assets);
 
@@ -160,80 +302,58 @@ select(
       cardano_asset_id_t* lovelace = NULL;
       result                       = cardano_asset_id_new_lovelace(&lovelace);
 
-      if (result != CARDANO_SUCCESS)
+      if (result == CARDANO_SUCCESS)
       {
-        cardano_asset_id_map_unref(&assets);
-        cardano_utxo_list_unref(selection);
-        cardano_utxo_list_unref(remaining_utxo);
-        cardano_value_unref(&accumulated_value);
-
-        return result;
+        result = select_asset(&state, lovelace, 1, 0, *selection);
       }
 
-      cardano_value_t* tmp_accum_value = cardano_value_new_zero();
-
-      result = _cardano_large_fist_select_utxos(lovelace, 1, *remaining_utxo, *selection, &tmp_accum_value);
-
-      cardano_value_unref(&tmp_accum_value);
       cardano_asset_id_unref(&lovelace);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        cardano_asset_id_map_unref(&assets);
-        cardano_utxo_list_unref(selection);
-        cardano_utxo_list_unref(remaining_utxo);
-        cardano_value_unref(&accumulated_value);
-
-        return result;
-      }
     }
   }
 
-  for (size_t i = 0U; i < asset_count; ++i)
+  // Native assets go first: the UTxOs picked for them also bring lovelace, which often covers the lovelace target
+  // without further inputs.
+  for (size_t pass = 0U; (pass < 2U) && (result == CARDANO_SUCCESS); ++pass)
   {
-    cardano_asset_id_t* asset_id     = NULL;
-    int64_t             asset_amount = 0;
+    for (size_t i = 0U; (i < asset_count) && (result == CARDANO_SUCCESS); ++i)
+    {
+      cardano_asset_id_t* asset_id     = NULL;
+      int64_t             asset_amount = 0;
 
-    result = cardano_asset_id_map_get_key_at(assets, i, &asset_id);
-    cardano_asset_id_unref(&asset_id);
+      result = cardano_asset_id_map_get_key_value_at(assets, i, &asset_id, &asset_amount);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_asset_id_map_unref(&assets);
-      cardano_utxo_list_unref(selection);
-      cardano_utxo_list_unref(remaining_utxo);
-      cardano_value_unref(&accumulated_value);
+      if ((result == CARDANO_SUCCESS) && (cardano_asset_id_is_lovelace(asset_id) == (pass == 1U)))
+      {
+        const int64_t preselected_amount = _cardano_large_fist_get_amount(accumulated_value, asset_id);
 
-      return result;
+        result = select_asset(&state, asset_id, asset_amount, preselected_amount, *selection);
+      }
+
+      cardano_asset_id_unref(&asset_id);
     }
+  }
 
-    result = cardano_asset_id_map_get(assets, asset_id, &asset_amount);
+  cardano_asset_id_map_unref(&assets);
+  cardano_value_unref(&accumulated_value);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_asset_id_map_unref(&assets);
-      cardano_utxo_list_unref(selection);
-      cardano_utxo_list_unref(remaining_utxo);
-      cardano_value_unref(&accumulated_value);
+  cardano_utxo_list_t* remaining = NULL;
 
-      return result;
-    }
+  if (result == CARDANO_SUCCESS)
+  {
+    result = _cardano_selection_state_collect_remaining(&state, &remaining);
+  }
 
-    result = _cardano_large_fist_select_utxos(asset_id, asset_amount, *remaining_utxo, *selection, &accumulated_value);
+  _cardano_selection_state_free(&state);
+  cardano_utxo_list_unref(remaining_utxo);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_asset_id_map_unref(&assets);
-      cardano_utxo_list_unref(selection);
-      cardano_utxo_list_unref(remaining_utxo);
-      cardano_value_unref(&accumulated_value);
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(selection);
 
-      return result;
-    }
+    return result;
   }
 
-  cardano_asset_id_map_unref(&assets);
-  cardano_value_unref(&accumulated_value);
+  *remaining_utxo = remaining;
 
   return CARDANO_SUCCESS;
 }
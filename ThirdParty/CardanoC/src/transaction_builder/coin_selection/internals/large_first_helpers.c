@@ -118,19 +118,15 @@ _cardano_large_fist_value_gte(
 
     for (size_t i = 0U; i < assets_count; ++i)
     {
-      cardano_asset_id_t* id = NULL;
+      cardano_asset_id_t* id = cardano_asset_id_list_peek(asset_ids, i);
 
-      op_result = cardano_asset_id_list_get(asset_ids, i, &id);
-
-      cardano_asset_id_unref(&id);
-
-      if (op_result != CARDANO_SUCCESS)
+      if (id == NULL)
       {
         cardano_asset_id_list_unref(&asset_ids);
         cardano_asset_id_map_unref(&lhs_asset_id_map);
         cardano_asset_id_map_unref(&rhs_asset_id_map);
 
-        return op_result;
+        return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
       }
 
       int64_t lhs_multi_asset_amount = 0;
@@ -191,43 +187,6 @@ _cardano_large_fist_value_gte(
   return CARDANO_SUCCESS;
 }
 
-int32_t
-_cardano_large_fist_compare_utxos(cardano_utxo_t* lhs, cardano_utxo_t* rhs, void* context)
-{
-  cardano_asset_id_t* asset_id = (cardano_asset_id_t*)context;
-
-  cardano_transaction_output_t* lhs_output = cardano_utxo_get_output(lhs);
-  cardano_transaction_output_t* rhs_output = cardano_utxo_get_output(rhs);
-
-  cardano_value_t* lhs_value = cardano_transaction_output_get_value(lhs_output);
-  cardano_value_t* rhs_value = cardano_transaction_output_get_value(rhs_output);
-
-  int64_t lhs_amount = _cardano_large_fist_get_amount(lhs_value, asset_id);
-  int64_t rhs_amount = _cardano_large_fist_get_amount(rhs_value, asset_id);
-
-  int32_t result = 0;
-
-  if (lhs_amount < rhs_amount)
-  {
-    result = 1;
-  }
-  else if (lhs_amount > rhs_amount)
-  {
-    result = -1;
-  }
-  else
-  {
-    result = 0;
-  }
-
-  cardano_value_unref(&lhs_value);
-  cardano_value_unref(&rhs_value);
-  cardano_transaction_output_unref(&lhs_output);
-  cardano_transaction_output_unref(&rhs_output);
-
-  return result;
-}
-
 cardano_error_t
 _cardano_large_fist_check_preselected(
   cardano_utxo_list_t* pre_selected_utxo,
@@ -256,16 +215,13 @@ _cardano_large_fist_check_preselected(
 
   for (size_t i = 0U; i < utxo_count; ++i)
   {
-    cardano_utxo_t* utxo = NULL;
-
-    result = cardano_utxo_list_get(pre_selected_utxo, i, &utxo);
-    cardano_utxo_unref(&utxo);
+    cardano_utxo_t* utxo = cardano_utxo_list_peek(pre_selected_utxo, i);
 
-    if (result != CARDANO_SUCCESS)
+    if (utxo == NULL)
     {
       cardano_value_unref(accumulated_value);
 
-      return result;
+      return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
     }
 
     cardano_transaction_output_t* output     = cardano_utxo_get_output(utxo);
@@ -306,129 +262,3 @@ _cardano_large_fist_check_preselected(
 
   return CARDANO_SUCCESS;
 }
-
-cardano_error_t
-_cardano_large_fist_select_utxos(
-  cardano_asset_id_t*  asset_req,
-  int64_t              required_amount,
-  cardano_utxo_list_t* available_utxos,
-  cardano_utxo_list_t* selected_utxos,
-  cardano_value_t**    accumulated_value)
-{
-  if ((asset_req == NULL) || (available_utxos == NULL) || (selected_utxos == NULL) || (accumulated_value == NULL))
-  {
-    return CARDANO_ERROR_POINTER_IS_NULL;
-  }
-
-  cardano_error_t result = CARDANO_SUCCESS;
-
-  if (*accumulated_value == NULL)
-  {
-    result = cardano_value_new(0, NULL, accumulated_value);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      return result;
-    }
-  }
-
-  cardano_asset_id_map_t* assets = cardano_value_as_assets_map(*accumulated_value);
-
-  if (assets == NULL)
-  {
-    return CARDANO_ERROR_POINTER_IS_NULL;
-  }
-
-  int64_t accumulated_amount = 0;
-  result                     = cardano_asset_id_map_get(assets, asset_req, &accumulated_amount);
-
-  if ((result != CARDANO_SUCCESS) && (result != CARDANO_ERROR_ELEMENT_NOT_FOUND))
-  {
-    cardano_asset_id_map_unref(&assets);
-
-    return result;
-  }
-
-  if (accumulated_amount >= required_amount)
-  {
-    cardano_asset_id_map_unref(&assets);
-
-    return CARDANO_SUCCESS;
-  }
-
-  cardano_utxo_list_sort(available_utxos, _cardano_large_fist_compare_utxos, (void*)asset_req);
-
-  size_t utxo_count = cardano_utxo_list_get_length(available_utxos);
-
-  for (size_t i = 0U; (i < utxo_count) && (accumulated_amount < required_amount); ++i)
-  {
-    cardano_utxo_t* utxo = NULL;
-    result               = cardano_utxo_list_get(available_utxos, i, &utxo);
-
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_asset_id_map_unref(&assets);
-
-      return result;
-    }
-
-    cardano_transaction_output_t* output     = cardano_utxo_get_output(utxo);
-    cardano_value_t*              utxo_value = cardano_transaction_output_get_value(output);
-
-    int64_t utxo_asset_amount = _cardano_large_fist_get_amount(utxo_value, asset_req);
-
-    if (utxo_asset_amount > 0)
-    {
-      result = cardano_utxo_list_add(selected_utxos, utxo);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        cardano_asset_id_map_unref(&assets);
-        cardano_value_unref(&utxo_value);
-        cardano_transaction_output_unref(&output);
-        cardano_utxo_unref(&utxo);
-
-        return result;
-      }
-
-      accumulated_amount += utxo_asset_amount;
-
-      cardano_value_t* new_accumulated_value = NULL;
-      result                                 = cardano_value_add(*accumulated_value, utxo_value, &new_accumulated_value);
-
-      if (result != CARDANO_SUCCESS)
-      {
-        cardano_asset_id_map_unref(&assets);
-        cardano_value_unref(&utxo_value);
-        cardano_transaction_output_unref(&output);
-        cardano_utxo_unref(&utxo);
-
-        return result;
-      }
-
-      cardano_value_unref(accumulated_value);
-      *accumulated_value = new_accumulated_value;
-
-      cardano_utxo_list_t* removed = cardano_utxo_list_erase(available_utxos, (int64_t)i, 1);
-      cardano_utxo_list_unref(&removed);
-
-      --i;
-      --utxo_count;
-    }
-
-    cardano_value_unref(&utxo_value);
-    cardano_transaction_output_unref(&output);
-    cardano_utxo_unref(&utxo);
-  }
-
-  if (accumulated_amount < required_amount)
-  {
-    cardano_asset_id_map_unref(&assets);
-
-    return CARDANO_ERROR_BALANCE_INSUFFICIENT;
-  }
-
-  cardano_asset_id_map_unref(&assets);
-
-  return CARDANO_SUCCESS;
-}
@@ -62,21 +62,6 @@ cardano_error_t _cardano_large_fist_value_gte(
   cardano_value_t* rhs,
   bool*            result);
 
-/**
- * \brief Compares two UTXOs by a specific asset amount in descending order.
- *
- * This function compares the specified asset amounts in the values of two UTXOs. It sorts in descending order,
- * meaning the UTXO with the greater amount of the asset comes first.
- *
- * \param[in] lhs The left-hand side UTXO to compare.
- * \param[in] rhs The right-hand side UTXO to compare.
- * \param[in] context A pointer to the specific \ref cardano_asset_id_t representing the asset to compare.
- *
- * \return A negative value if lhs has more of the asset than rhs, a positive value if rhs has more of the asset than lhs,
- *         or 0 if they are equal in terms of the asset amount.
- */
-int32_t _cardano_large_fist_compare_utxos(cardano_utxo_t* lhs, cardano_utxo_t* rhs, void* context);
-
 /**
  * \brief Checks if the pre-selected UTXOs satisfy the target value.
  *
@@ -97,27 +82,4 @@ cardano_error_t _cardano_large_fist_check_preselected(
   cardano_value_t**    accumulated_value,
   bool*                satisfies_target);
 
-/**
- * \brief Selects UTXOs containing the specified asset to satisfy the required amount.
- *
- * This function iterates over the available UTXOs and selects those that contain the specified asset,
- * accumulating their value until the required amount is met or exceeded.
- *
- * \param[in] asset_req The asset ID for which UTXOs are being selected.
- * \param[in] required_amount The amount of the asset required.
- * \param[in] available_utxos A list of available UTXOs to select from.
- * \param[out] selected_utxos A list where the selected UTXOs will be added.
- * \param[out] accumulated_value A pointer to a \ref cardano_value_t object that will accumulate the selected asset's value.
- *
- * \return \ref CARDANO_SUCCESS if UTXOs were successfully selected, or an appropriate error code indicating failure.
- *
- * \note The caller is responsible for managing the memory of the `selected_utxos` and `accumulated_value` lists.
- */
-cardano_error_t _cardano_large_fist_select_utxos(
-  cardano_asset_id_t*  asset_req,
-  int64_t              required_amount,
-  cardano_utxo_list_t* available_utxos,
-  cardano_utxo_list_t* selected_utxos,
-  cardano_value_t**    accumulated_value);
-
 #endif // BIGLUP_LABS_INCLUDE_CARDANO_LARGE_FIRST_HELPERS_H
\ No newline at end of file
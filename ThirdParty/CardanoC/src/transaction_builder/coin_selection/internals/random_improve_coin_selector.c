@@ -0,0 +1,671 @@
+/**
+ * \file random_improve_coin_selector.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/assets/asset_id.h>
+#include <cardano/assets/asset_id_map.h>
+#include <cardano/common/utxo.h>
+#include <cardano/common/utxo_list.h>
+#include <cardano/error.h>
+#include <cardano/object.h>
+#include <cardano/transaction_builder/coin_selection/coin_selector.h>
+#include <cardano/transaction_builder/coin_selection/random_improve_coin_selector.h>
+
+#include "../../../allocators.h"
+#include "../../../string_safe.h"
+#include "./large_first_helpers.h"
+#include "./selection_state.h"
+#include "./utxo_columns.h"
+
+#include <assert.h>
+#include <sodium.h>
+#include <string.h>
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Context of the random improve coin selector.
+ *
+ * Holds the state of the selector's random number generator, which advances with every selection.
+ */
+typedef struct random_improve_context_t
+{
+    cardano_object_t base;
+    uint64_t         random_state;
+} random_improve_context_t;
+
+/**
+ * \brief An asset the selection has to cover, with the amount already covered by the pre-selected UTxOs.
+ */
+typedef struct selection_target_t
+{
+    cardano_asset_id_t* asset_id;
+    int64_t             required_amount;
+    int64_t             preselected_amount;
+} selection_target_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Deallocates the selector context.
+ *
+ * \param object A void pointer to the context to be deallocated.
+ */
+static void
+random_improve_context_deallocate(void* object)
+{
+  assert(object != NULL);
+
+  _cardano_free(object);
+}
+
+/**
+ * \brief Draws the next pseudo-random number of the selector (SplitMix64).
+ *
+ * \param[in,out] context The selector context.
+ *
+ * \return A uniformly distributed 64-bit value.
+ */
+static uint64_t
+next_random(random_improve_context_t* context)
+{
+  context->random_state += 0x9E3779B97F4A7C15ULL;
+
+  uint64_t value = context->random_state;
+
+  value = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27U)) * 0x94D049BB133111EBULL;
+
+  return value ^ (value >> 31U);
+}
+
+/**
+ * \brief Gets the distance between two non-negative amounts.
+ *
+ * \param[in] lhs The first amount.
+ * \param[in] rhs The second amount.
+ *
+ * \return The absolute difference of the amounts.
+ */
+static uint64_t
+distance(const int64_t lhs, const int64_t rhs)
+{
+  return (lhs > rhs) ? ((uint64_t)lhs - (uint64_t)rhs) : ((uint64_t)rhs - (uint64_t)lhs);
+}
+
+/**
+ * \brief Collects the rows that are not selected yet and hold some of an asset.
+ *
+ * Native assets are looked up in the asset index of the snapshot, so only the rows holding the asset are visited.
+ * The amount of each candidate is written to `state->amounts`, indexed by row; other rows are left untouched.
+ *
+ * \param[in,out] state The selection state.
+ * \param[in] asset_id The asset to collect candidates for.
+ *
+ * \return The number of candidate rows, stored at the start of `state->scratch`.
+ */
+static size_t
+collect_candidates(cardano_selection_state_t* state, const cardano_asset_id_t* asset_id)
+{
+  size_t count = 0U;
+
+  if (cardano_asset_id_is_lovelace(asset_id))
+  {
+    for (size_t row = 0U; row < state->columns->count; ++row)
+    {
+      if (!state->selected[row] && (state->columns->lovelace[row] > 0))
+      {
+        state->amounts[row]   = state->columns->lovelace[row];
+        state->scratch[count] = row;
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  const size_t*  rows       = NULL;
+  const int64_t* quantities = NULL;
+  size_t         row_count  = 0U;
+
+  if (!_cardano_utxo_columns_get_asset_rows(state->columns, asset_id, &rows, &quantities, &row_count))
+  {
+    return 0U;
+  }
+
+  for (size_t i = 0U; i < row_count; ++i)
+  {
+    if (!state->selected[rows[i]] && (quantities[i] > 0))
+    {
+      state->amounts[rows[i]] = quantities[i];
+      state->scratch[count]   = rows[i];
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+/**
+ * \brief Removes a random candidate from the candidate set and returns it.
+ *
+ * \param[in,out] context The selector context.
+ * \param[in,out] state The selection state holding the candidates in `scratch`.
+ * \param[in,out] candidate_count The number of candidates; decremented by one.
+ *
+ * \return The row of the drawn candidate.
+ */
+static size_t
+draw_candidate(random_improve_context_t* context, cardano_selection_state_t* state, size_t* candidate_count)
+{
+  const size_t index = (size_t)(next_random(context) % (uint64_t)*candidate_count);
+  const size_t row   = state->scratch[index];
+
+  --*candidate_count;
+  state->scratch[index] = state->scratch[*candidate_count];
+
+  return row;
+}
+
+/**
+ * \brief Adds the UTxO of a row to the selection.
+ *
+ * \param[in,out] state The selection state.
+ * \param[in] row The row to select.
+ * \param[out] selection The list the UTxO is appended to.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code.
+ */
+static cardano_error_t
+select_row(cardano_selection_state_t* state, const size_t row, cardano_utxo_list_t* selection)
+{
+  cardano_error_t result = cardano_utxo_list_add(selection, _cardano_utxo_columns_peek_utxo(state->columns, row));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    _cardano_selection_state_mark_selected(state, row);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Phase one of CIP-2: selects random UTxOs holding the asset until the required amount is covered.
+ *
+ * \param[in,out] context The selector context.
+ * \param[in,out] state The selection state.
+ * \param[in] target The asset to cover.
+ * \param[out] selection The list the selected UTxOs are appended to.
+ *
+ * \return \ref CARDANO_SUCCESS if the amount was covered, \ref CARDANO_ERROR_BALANCE_INSUFFICIENT if the available
+ *         UTxOs do not hold enough of the asset, or another error code.
+ */
+static cardano_error_t
+select_randomly(
+  random_improve_context_t*  context,
+  cardano_selection_state_t* state,
+  const selection_target_t*  target,
+  cardano_utxo_list_t*       selection)
+{
+  int64_t accumulated_amount = _cardano_selection_saturating_add(target->preselected_amount, _cardano_selection_state_get_selected_amount(state, target->asset_id));
+
+  if (accumulated_amount >= target->required_amount)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  size_t candidate_count = collect_candidates(state, target->asset_id);
+
+  while (accumulated_amount < target->required_amount)
+  {
+    if (candidate_count == 0U)
+    {
+      return CARDANO_ERROR_BALANCE_INSUFFICIENT;
+    }
+
+    const size_t    row    = draw_candidate(context, state, &candidate_count);
+    cardano_error_t result = select_row(state, row, selection);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    accumulated_amount = _cardano_selection_saturating_add(accumulated_amount, state->amounts[row]);
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Phase two of CIP-2: adds random UTxOs holding the asset while they move the selected amount closer to
+ * twice the required amount without exceeding three times it.
+ *
+ * The phase ends at the first candidate that would not improve the selection.
+ *
+ * \param[in,out] context The selector context.
+ * \param[in,out] state The selection state.
+ * \param[in] target The asset to improve.
+ * \param[out] selection The list the selected UTxOs are appended to.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code.
+ */
+static cardano_error_t
+improve_selection(
+  random_improve_context_t*  context,
+  cardano_selection_state_t* state,
+  const selection_target_t*  target,
+  cardano_utxo_list_t*       selection)
+{
+  const int64_t ideal_amount   = _cardano_selection_saturating_add(target->required_amount, target->required_amount);
+  const int64_t maximum_amount = _cardano_selection_saturating_add(ideal_amount, target->required_amount);
+
+  int64_t accumulated_amount = _cardano_selection_saturating_add(target->preselected_amount, _cardano_selection_state_get_selected_amount(state, target->asset_id));
+
+  size_t candidate_count = collect_candidates(state, target->asset_id);
+
+  while (candidate_count > 0U)
+  {
+    const size_t  row        = draw_candidate(context, state, &candidate_count);
+    const int64_t new_amount = _cardano_selection_saturating_add(accumulated_amount, state->amounts[row]);
+
+    if ((new_amount > maximum_amount) || (distance(ideal_amount, new_amount) >= distance(ideal_amount, accumulated_amount)))
+    {
+      break;
+    }
+
+    cardano_error_t result = select_row(state, row, selection);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    accumulated_amount = new_amount;
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Lists the assets of the target value, native assets first and lovelace last.
+ *
+ * Native assets go first because the UTxOs picked for them also bring lovelace, which often covers the lovelace
+ * target without further inputs.
+ *
+ * \param[in] target The target value.
+ * \param[in] preselected_value The value of the pre-selected UTxOs, or NULL.
+ * \param[out] targets On success, an array of targets that must be released with \ref free_targets.
+ * \param[out] target_count The number of targets.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code.
+ */
+static cardano_error_t
+get_targets(
+  cardano_value_t*     target,
+  cardano_value_t*     preselected_value,
+  selection_target_t** targets,
+  size_t*              target_count)
+{
+  cardano_asset_id_map_t* assets = cardano_value_as_assets_map(target);
+
+  if (assets == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  const size_t asset_count = cardano_asset_id_map_get_length(assets);
+
+  *targets      = (selection_target_t*)_cardano_malloc(((asset_count == 0U) ? 1U : asset_count) * sizeof(selection_target_t));
+  *target_count = 0U;
+
+  if (*targets == NULL)
+  {
+    cardano_asset_id_map_unref(&assets);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  // The first pass lists the native assets and the second one lovelace.
+  for (size_t pass = 0U; (pass < 2U) && (result == CARDANO_SUCCESS); ++pass)
+  {
+    for (size_t i = 0U; (i < asset_count) && (result == CARDANO_SUCCESS); ++i)
+    {
+      cardano_asset_id_t* asset_id = NULL;
+      int64_t             amount   = 0;
+
+      result = cardano_asset_id_map_get_key_value_at(assets, i, &asset_id, &amount);
+
+      if ((result == CARDANO_SUCCESS) && (cardano_asset_id_is_lovelace(asset_id) == (pass == 1U)))
+      {
+        selection_target_t* entry = &(*targets)[*target_count];
+
+        entry->asset_id           = asset_id;
+        entry->required_amount    = amount;
+        entry->preselected_amount = _cardano_large_fist_get_amount(preselected_value, asset_id);
+
+        cardano_asset_id_ref(asset_id);
+        ++*target_count;
+      }
+
+      cardano_asset_id_unref(&asset_id);
+    }
+  }
+
+  cardano_asset_id_map_unref(&assets);
+
+  return result;
+}
+
+/**
+ * \brief Releases the targets returned by \ref get_targets.
+ *
+ * \param[in,out] targets The targets to release.
+ * \param[in] target_count The number of targets.
+ */
+static void
+free_targets(selection_target_t** targets, const size_t target_count)
+{
+  if (*targets == NULL)
+  {
+    return;
+  }
+
+  for (size_t i = 0U; i < target_count; ++i)
+  {
+    cardano_asset_id_unref(&(*targets)[i].asset_id);
+  }
+
+  _cardano_free(*targets);
+  *targets = NULL;
+}
+
+/**
+ * \brief Moves the pre-selected UTxOs into the selection and out of the remaining UTxOs.
+ *
+ * \param[in] pre_selected_utxo The pre-selected UTxOs.
+ * \param[in,out] selection The selection.
+ * \param[in,out] remaining_utxo The remaining UTxOs.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code.
+ */
+static cardano_error_t
+add_preselected(
+  cardano_utxo_list_t* pre_selected_utxo,
+  cardano_utxo_list_t* selection,
+  cardano_utxo_list_t* remaining_utxo)
+{
+  const size_t pre_selected_count = cardano_utxo_list_get_length(pre_selected_utxo);
+
+  for (size_t i = 0U; i < pre_selected_count; ++i)
+  {
+    cardano_utxo_t* utxo = cardano_utxo_list_peek(pre_selected_utxo, i);
+
+    if (utxo == NULL)
+    {
+      return CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ;
+    }
+
+    cardano_error_t result = cardano_utxo_list_add(selection, utxo);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    result = cardano_utxo_list_remove(remaining_utxo, utxo);
+
+    if ((result != CARDANO_SUCCESS) && (result != CARDANO_ERROR_ELEMENT_NOT_FOUND))
+    {
+      return result;
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Runs both phases of the selection over the remaining UTxOs.
+ *
+ * \param[in,out] context The selector context.
+ * \param[in] target The target value.
+ * \param[in] preselected_value The value of the pre-selected UTxOs, or NULL.
+ * \param[in,out] selection The selection, holding the pre-selected UTxOs.
+ * \param[in,out] remaining_utxo The remaining UTxOs; replaced by the UTxOs left after the selection.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code.
+ */
+static cardano_error_t
+run_selection(
+  random_improve_context_t* context,
+  cardano_value_t*          target,
+  cardano_value_t*          preselected_value,
+  cardano_utxo_list_t*      selection,
+  cardano_utxo_list_t**     remaining_utxo)
+{
+  selection_target_t* targets      = NULL;
+  size_t              target_count = 0U;
+
+  cardano_error_t result = get_targets(target, preselected_value, &targets, &target_count);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    free_targets(&targets, target_count);
+
+    return result;
+  }
+
+  cardano_selection_state_t state = { 0 };
+
+  result = _cardano_selection_state_init(*remaining_utxo, &state);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    free_targets(&targets, target_count);
+
+    return result;
+  }
+
+  // A transaction needs at least one input, so an empty target still spends one UTxO.
+  if ((target_count == 0U) && (cardano_utxo_list_get_length(selection) == 0U))
+  {
+    cardano_asset_id_t* lovelace = NULL;
+    result                       = cardano_asset_id_new_lovelace(&lovelace);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      const selection_target_t any_input = { lovelace, 1, 0 };
+
+      result = select_randomly(context, &state, &any_input, selection);
+    }
+
+    cardano_asset_id_unref(&lovelace);
+  }
+
+  for (size_t i = 0U; (i < target_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    result = select_randomly(context, &state, &targets[i], selection);
+  }
+
+  for (size_t i = 0U; (i < target_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    result = improve_selection(context, &state, &targets[i], selection);
+  }
+
+  cardano_utxo_list_t* remaining = NULL;
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = _cardano_selection_state_collect_remaining(&state, &remaining);
+  }
+
+  _cardano_selection_state_free(&state);
+  free_targets(&targets, target_count);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(remaining_utxo);
+    *remaining_utxo = remaining;
+  }
+
+  return result;
+}
+
+/**
+ * \brief Selects UTXOs with the CIP-2 random improve algorithm.
+ *
+ * \param[in] coin_selector A pointer to the coin selector implementation object.
+ * \param[in] pre_selected_utxo A list of pre-selected UTXOs that must be included in the final selection.
+ * \param[in] available_utxo A list of available UTXOs to select from.
+ * \param[in] target A pointer to a \ref cardano_value_t object that defines the target amount of ADA and assets.
+ * \param[out] selection A pointer to the list of selected UTXOs that meet the target value.
+ * \param[out] remaining_utxo A pointer to the list of UTXOs that were not selected and remain available for future transactions.
+ *
+ * \return \ref CARDANO_SUCCESS if UTXOs were successfully selected, or an appropriate error code indicating failure.
+ */
+static cardano_error_t
+select(
+  cardano_coin_selector_impl_t* coin_selector,
+  cardano_utxo_list_t*          pre_selected_utxo,
+  cardano_utxo_list_t*          available_utxo,
+  cardano_value_t*              target,
+  cardano_utxo_list_t**         selection,
+  cardano_utxo_list_t**         remaining_utxo)
+{
+  assert(coin_selector != NULL);
+  assert(available_utxo != NULL);
+  assert(target != NULL);
+
+  random_improve_context_t* context = (random_improve_context_t*)((void*)coin_selector->context);
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = cardano_utxo_list_new(selection);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  *remaining_utxo = cardano_utxo_list_clone(available_utxo);
+
+  if (*remaining_utxo == NULL)
+  {
+    cardano_utxo_list_unref(selection);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_value_t* preselected_value = NULL;
+
+  if (pre_selected_utxo != NULL)
+  {
+    bool satisfies_target = false;
+
+    result = _cardano_large_fist_check_preselected(pre_selected_utxo, target, &preselected_value, &satisfies_target);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = add_preselected(pre_selected_utxo, *selection, *remaining_utxo);
+    }
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = run_selection(context, target, preselected_value, *selection, remaining_utxo);
+  }
+
+  cardano_value_unref(&preselected_value);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(selection);
+    cardano_utxo_list_unref(remaining_utxo);
+  }
+
+  return result;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_random_improve_coin_selector_new_with_seed(const uint64_t seed, cardano_coin_selector_t** coin_selector)
+{
+  static const char*           handler_name = "Random improve coin selector";
+  cardano_coin_selector_impl_t impl         = { 0 };
+
+  if (coin_selector == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_safe_memcpy(impl.name, 256U, handler_name, cardano_safe_strlen(handler_name, 256U));
+
+  random_improve_context_t* context = (random_improve_context_t*)_cardano_malloc(sizeof(random_improve_context_t));
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  context->base.ref_count     = 1;
+  context->base.last_error    = NULL;
+  context->base.deallocator   = random_improve_context_deallocate;
+  context->random_state       = seed;
+
+  impl.select  = select;
+  impl.context = (cardano_object_t*)((void*)context);
+
+  cardano_error_t result = cardano_coin_selector_new(impl, coin_selector);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_object_unref(&impl.context);
+  }
+
+  return result;
+}
+
+cardano_error_t
+cardano_random_improve_coin_selector_new(cardano_coin_selector_t** coin_selector)
+{
+  if (coin_selector == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (sodium_init() == -1)
+  {
+    return CARDANO_ERROR_GENERIC;
+  }
+
+  uint64_t seed = 0U;
+
+  randombytes_buf(&seed, sizeof(seed));
+
+  return cardano_random_improve_coin_selector_new_with_seed(seed, coin_selector);
+}
@@ -0,0 +1,149 @@
+/**
+ * \file selection_state.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include "../../../allocators.h"
+#include "./selection_state.h"
+
+#include <string.h>
+
+/* DEFINITIONS ****************************************************************/
+
+int64_t
+_cardano_selection_saturating_add(const int64_t lhs, const int64_t rhs)
+{
+  if ((rhs > 0) && (lhs > (INT64_MAX - rhs)))
+  {
+    return INT64_MAX;
+  }
+
+  return lhs + rhs;
+}
+
+void
+_cardano_selection_state_free(cardano_selection_state_t* state)
+{
+  _cardano_utxo_columns_free(&state->columns);
+  _cardano_free(state->order);
+  _cardano_free(state->scratch);
+  _cardano_free(state->candidates);
+  _cardano_free(state->amounts);
+  _cardano_free(state->selected);
+  _cardano_free(state->selected_assets);
+}
+
+cardano_error_t
+_cardano_selection_state_init(cardano_utxo_list_t* utxos, cardano_selection_state_t* state)
+{
+  CARDANO_UNUSED(memset(state, 0, sizeof(cardano_selection_state_t)));
+
+  cardano_error_t result = _cardano_utxo_columns_new(utxos, &state->columns);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  const size_t rows   = (state->columns->count == 0U) ? 1U : state->columns->count;
+  const size_t assets = (state->columns->asset_count == 0U) ? 1U : state->columns->asset_count;
+
+  state->order           = (size_t*)_cardano_malloc(rows * sizeof(size_t));
+  state->scratch         = (size_t*)_cardano_malloc(rows * sizeof(size_t));
+  state->candidates      = (size_t*)_cardano_malloc(rows * sizeof(size_t));
+  state->amounts         = (int64_t*)_cardano_malloc(rows * sizeof(int64_t));
+  state->selected        = (bool*)_cardano_malloc(rows * sizeof(bool));
+  state->selected_assets = (int64_t*)_cardano_malloc(assets * sizeof(int64_t));
+
+  if ((state->order == NULL) || (state->scratch == NULL) || (state->candidates == NULL) || (state->amounts == NULL) || (state->selected == NULL) || (state->selected_assets == NULL))
+  {
+    _cardano_selection_state_free(state);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  for (size_t i = 0U; i < state->columns->count; ++i)
+  {
+    state->order[i]    = i;
+    state->selected[i] = false;
+  }
+
+  CARDANO_UNUSED(memset(state->selected_assets, 0, assets * sizeof(int64_t)));
+
+  return CARDANO_SUCCESS;
+}
+
+int64_t
+_cardano_selection_state_get_selected_amount(const cardano_selection_state_t* state, const cardano_asset_id_t* asset_id)
+{
+  if (cardano_asset_id_is_lovelace(asset_id))
+  {
+    return state->selected_lovelace;
+  }
+
+  uint32_t index = 0U;
+
+  if (!_cardano_utxo_columns_find_asset(state->columns, asset_id, &index))
+  {
+    return 0;
+  }
+
+  return state->selected_assets[index];
+}
+
+void
+_cardano_selection_state_mark_selected(cardano_selection_state_t* state, const size_t row)
+{
+  const cardano_utxo_columns_t* columns = state->columns;
+
+  state->selected[row]     = true;
+  state->selected_lovelace = _cardano_selection_saturating_add(state->selected_lovelace, columns->lovelace[row]);
+
+  for (size_t entry = columns->asset_offsets[row]; entry < columns->asset_offsets[row + 1U]; ++entry)
+  {
+    const uint32_t index = columns->asset_ids[entry];
+
+    state->selected_assets[index] = _cardano_selection_saturating_add(state->selected_assets[index], columns->asset_quantities[entry]);
+  }
+}
+
+cardano_error_t
+_cardano_selection_state_collect_remaining(const cardano_selection_state_t* state, cardano_utxo_list_t** remaining)
+{
+  cardano_error_t result = cardano_utxo_list_new(remaining);
+
+  for (size_t i = 0U; (i < state->columns->count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    const size_t row = state->order[i];
+
+    if (!state->selected[row])
+    {
+      result = cardano_utxo_list_add(*remaining, _cardano_utxo_columns_peek_utxo(state->columns, row));
+    }
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(remaining);
+  }
+
+  return result;
+}
@@ -0,0 +1,112 @@
+/**
+ * \file selection_state.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License")
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_SELECTION_STATE_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_SELECTION_STATE_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/assets/asset_id.h>
+#include <cardano/common/utxo_list.h>
+#include <cardano/error.h>
+#include <cardano/typedefs.h>
+
+#include "./utxo_columns.h"
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief Scratch state of a selection run over a columnar snapshot of the available UTxOs.
+ *
+ * `order`, `scratch` and `candidates` each hold one row index per row; `amounts` holds one amount per row.
+ */
+typedef struct cardano_selection_state_t
+{
+    cardano_utxo_columns_t* columns;
+    size_t*                 order;
+    size_t*                 scratch;
+    size_t*                 candidates;
+    int64_t*                amounts;
+    bool*                   selected;
+    int64_t*                selected_assets;
+    int64_t                 selected_lovelace;
+} cardano_selection_state_t;
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Adds two amounts, saturating instead of overflowing.
+ *
+ * \param[in] lhs The first amount.
+ * \param[in] rhs The second amount, which must not be negative.
+ *
+ * \return The sum, or INT64_MAX if it does not fit.
+ */
+int64_t _cardano_selection_saturating_add(int64_t lhs, int64_t rhs);
+
+/**
+ * \brief Releases the scratch state of a selection run.
+ *
+ * \param[in,out] state The state to release.
+ */
+void _cardano_selection_state_free(cardano_selection_state_t* state);
+
+/**
+ * \brief Prepares the scratch state of a selection run over the given UTxOs.
+ *
+ * The initial row order is the order of the list, as the sorting passes of the selection start from it.
+ *
+ * \param[in] utxos The available UTxOs.
+ * \param[out] state The state to initialize.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code.
+ */
+cardano_error_t _cardano_selection_state_init(cardano_utxo_list_t* utxos, cardano_selection_state_t* state);
+
+/**
+ * \brief Gets the total amount of an asset held by the rows selected so far.
+ *
+ * \param[in] state The selection state.
+ * \param[in] asset_id The asset, lovelace included.
+ *
+ * \return The selected amount of the asset.
+ */
+int64_t _cardano_selection_state_get_selected_amount(const cardano_selection_state_t* state, const cardano_asset_id_t* asset_id);
+
+/**
+ * \brief Marks a row as selected and adds its lovelace and assets to the selected totals.
+ *
+ * \param[in,out] state The selection state.
+ * \param[in] row The row to select.
+ */
+void _cardano_selection_state_mark_selected(cardano_selection_state_t* state, size_t row);
+
+/**
+ * \brief Builds the list of rows that were not selected, in the order left by the last sorting pass.
+ *
+ * \param[in] state The selection state.
+ * \param[out] remaining On success, the new list.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code.
+ */
+cardano_error_t _cardano_selection_state_collect_remaining(const cardano_selection_state_t* state, cardano_utxo_list_t** remaining);
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_SELECTION_STATE_H
@@ -0,0 +1,606 @@
+/**
+ * \file utxo_columns.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/assets/asset_id_map.h>
+#include <cardano/crypto/blake2b_hash.h>
+#include <cardano/transaction_body/transaction_input.h>
+#include <cardano/transaction_body/transaction_output.h>
+#include <cardano/transaction_body/value.h>
+
+#include "../../../allocators.h"
+#include "../../../string_safe.h"
+#include "./utxo_columns.h"
+
+#include <string.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const size_t INITIAL_ASSET_SLOT_COUNT = 64U;
+static const size_t INITIAL_ENTRY_CAPACITY   = 64U;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Computes the 64-bit FNV-1a hash of the bytes of an asset id.
+ *
+ * \param[in] asset_id The asset id to hash.
+ *
+ * \return The hash of the asset id.
+ */
+static uint64_t
+hash_asset_id(const cardano_asset_id_t* asset_id)
+{
+  const byte_t* data = cardano_asset_id_get_bytes(asset_id);
+  const size_t  size = cardano_asset_id_get_bytes_size(asset_id);
+  uint64_t      hash = 14695981039346656037ULL;
+
+  for (size_t i = 0U; i < size; ++i)
+  {
+    hash ^= (uint64_t)data[i];
+    hash *= 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+/**
+ * \brief Finds the slot of an asset in the open-addressing table, or the empty slot where it belongs.
+ *
+ * \param[in] columns The snapshot.
+ * \param[in] asset_id The asset to look for.
+ * \param[in] hash The hash of the asset.
+ *
+ * \return The slot index. The slot holds zero if the asset is not interned, or its index plus one otherwise.
+ */
+static size_t
+find_slot(const cardano_utxo_columns_t* columns, const cardano_asset_id_t* asset_id, const uint64_t hash)
+{
+  const size_t  mask = columns->asset_slot_count - 1U;
+  const byte_t* data = cardano_asset_id_get_bytes(asset_id);
+  const size_t  size = cardano_asset_id_get_bytes_size(asset_id);
+  size_t        slot = (size_t)hash & mask;
+
+  while (columns->asset_slots[slot] != 0U)
+  {
+    const size_t              index    = (size_t)columns->asset_slots[slot] - 1U;
+    const cardano_asset_id_t* interned = columns->assets[index];
+
+    if ((columns->asset_hashes[index] == hash) && (cardano_asset_id_get_bytes_size(interned) == size) && (memcmp(cardano_asset_id_get_bytes(interned), data, size) == 0))
+    {
+      return slot;
+    }
+
+    slot = (slot + 1U) & mask;
+  }
+
+  return slot;
+}
+
+/**
+ * \brief Doubles the open-addressing table and reinserts every interned asset.
+ *
+ * \param[in,out] columns The snapshot.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+grow_slots(cardano_utxo_columns_t* columns)
+{
+  const size_t slot_count = columns->asset_slot_count * 2U;
+  uint32_t*    slots      = (uint32_t*)_cardano_malloc(slot_count * sizeof(uint32_t));
+
+  if (slots == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(slots, 0, slot_count * sizeof(uint32_t)));
+
+  for (size_t i = 0U; i < columns->asset_count; ++i)
+  {
+    size_t slot = (size_t)columns->asset_hashes[i] & (slot_count - 1U);
+
+    while (slots[slot] != 0U)
+    {
+      slot = (slot + 1U) & (slot_count - 1U);
+    }
+
+    slots[slot] = (uint32_t)(i + 1U);
+  }
+
+  _cardano_free(columns->asset_slots);
+
+  columns->asset_slots      = slots;
+  columns->asset_slot_count = slot_count;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Returns the interned index of an asset, interning it if it was not seen before.
+ *
+ * \param[in,out] columns The snapshot.
+ * \param[in] asset_id The asset to intern. A new reference is taken if it is added.
+ * \param[out] index The interned index of the asset.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+intern_asset(cardano_utxo_columns_t* columns, cardano_asset_id_t* asset_id, uint32_t* index)
+{
+  const uint64_t hash = hash_asset_id(asset_id);
+  size_t         slot = find_slot(columns, asset_id, hash);
+
+  if (columns->asset_slots[slot] != 0U)
+  {
+    *index = columns->asset_slots[slot] - 1U;
+
+    return CARDANO_SUCCESS;
+  }
+
+  if (((columns->asset_count + 1U) * 2U) > columns->asset_slot_count)
+  {
+    cardano_error_t result = grow_slots(columns);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      return result;
+    }
+
+    slot = find_slot(columns, asset_id, hash);
+  }
+
+  cardano_asset_id_t** assets = (cardano_asset_id_t**)_cardano_realloc((void*)columns->assets, (columns->asset_count + 1U) * sizeof(cardano_asset_id_t*));
+
+  if (assets == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  columns->assets = assets;
+
+  uint64_t* hashes = (uint64_t*)_cardano_realloc(columns->asset_hashes, (columns->asset_count + 1U) * sizeof(uint64_t));
+
+  if (hashes == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  columns->asset_hashes = hashes;
+
+  cardano_asset_id_ref(asset_id);
+
+  columns->assets[columns->asset_count]       = asset_id;
+  columns->asset_hashes[columns->asset_count] = hash;
+  columns->asset_slots[slot]                  = (uint32_t)(columns->asset_count + 1U);
+
+  *index = (uint32_t)columns->asset_count;
+  ++columns->asset_count;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Appends an asset entry to the compressed sparse row columns, growing them as needed.
+ *
+ * \param[in,out] columns The snapshot.
+ * \param[in,out] capacity The current capacity of the entry columns.
+ * \param[in] asset_index The interned index of the asset.
+ * \param[in] quantity The quantity of the asset.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+push_entry(cardano_utxo_columns_t* columns, size_t* capacity, const uint32_t asset_index, const int64_t quantity)
+{
+  const size_t size = columns->asset_offsets[columns->count];
+
+  if (size == *capacity)
+  {
+    const size_t new_capacity = (*capacity == 0U) ? INITIAL_ENTRY_CAPACITY : (*capacity * 2U);
+
+    uint32_t* ids = (uint32_t*)_cardano_realloc(columns->asset_ids, new_capacity * sizeof(uint32_t));
+
+    if (ids == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    columns->asset_ids = ids;
+
+    int64_t* quantities = (int64_t*)_cardano_realloc(columns->asset_quantities, new_capacity * sizeof(int64_t));
+
+    if (quantities == NULL)
+    {
+      return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+
+    columns->asset_quantities = quantities;
+    *capacity                 = new_capacity;
+  }
+
+  columns->asset_ids[size]        = asset_index;
+  columns->asset_quantities[size] = quantity;
+
+  ++columns->asset_offsets[columns->count];
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Appends the row of a UTxO to the snapshot.
+ *
+ * \param[in,out] columns The snapshot; `count` is the index of the new row.
+ * \param[in,out] capacity The current capacity of the entry columns.
+ * \param[in] utxo The UTxO to append.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an error code.
+ */
+static cardano_error_t
+push_row(cardano_utxo_columns_t* columns, size_t* capacity, cardano_utxo_t* utxo)
+{
+  const size_t row = columns->count;
+
+  cardano_transaction_input_t*  input  = cardano_utxo_get_input(utxo);
+  cardano_transaction_output_t* output = cardano_utxo_get_output(utxo);
+  cardano_blake2b_hash_t*       tx_id  = cardano_transaction_input_get_id(input);
+  cardano_value_t*              value  = cardano_transaction_output_get_value(output);
+
+  cardano_transaction_input_unref(&input);
+  cardano_transaction_output_unref(&output);
+  cardano_blake2b_hash_unref(&tx_id);
+  cardano_value_unref(&value);
+
+  if ((input == NULL) || (tx_id == NULL) || (value == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  byte_t*      tx_hash   = &columns->tx_hashes[row * CARDANO_UTXO_COLUMNS_TX_HASH_SIZE];
+  const size_t hash_size = cardano_blake2b_hash_get_bytes_size(tx_id);
+
+  CARDANO_UNUSED(memset(tx_hash, 0, CARDANO_UTXO_COLUMNS_TX_HASH_SIZE));
+  cardano_safe_memcpy(tx_hash, CARDANO_UTXO_COLUMNS_TX_HASH_SIZE, cardano_blake2b_hash_get_data(tx_id), (hash_size < CARDANO_UTXO_COLUMNS_TX_HASH_SIZE) ? hash_size : CARDANO_UTXO_COLUMNS_TX_HASH_SIZE);
+
+  columns->output_indices[row]    = cardano_transaction_input_get_index(input);
+  columns->lovelace[row]          = cardano_value_get_coin(value);
+  columns->asset_offsets[row + 1] = columns->asset_offsets[row];
+
+  cardano_asset_id_map_t* assets = cardano_value_as_assets_map(value);
+
+  if (assets == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  // push_entry bumps the offset at index `count`, which is the end offset of this row while it is being built.
+  columns->count = row + 1U;
+
+  const size_t asset_count = cardano_asset_id_map_get_length(assets);
+
+  for (size_t i = 0U; (i < asset_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_asset_id_t* asset_id = NULL;
+    int64_t             quantity = 0;
+    uint32_t            index    = 0U;
+
+    result = cardano_asset_id_map_get_key_value_at(assets, i, &asset_id, &quantity);
+
+    if ((result == CARDANO_SUCCESS) && !cardano_asset_id_is_lovelace(asset_id))
+    {
+      result = intern_asset(columns, asset_id, &index);
+
+      if (result == CARDANO_SUCCESS)
+      {
+        result = push_entry(columns, capacity, index, quantity);
+      }
+    }
+
+    cardano_asset_id_unref(&asset_id);
+  }
+
+  cardano_asset_id_map_unref(&assets);
+
+  return result;
+}
+
+/**
+ * \brief Builds the asset-to-rows index of a snapshot from its row-major asset columns.
+ *
+ * This is a counting sort of the asset entries by asset, so it runs in time linear in the number of entries and
+ * keeps the rows of each asset in row order.
+ *
+ * \param[in,out] columns The snapshot, with every row pushed.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED.
+ */
+static cardano_error_t
+build_asset_index(cardano_utxo_columns_t* columns)
+{
+  const size_t entry_count = columns->asset_offsets[columns->count];
+  const size_t entries     = (entry_count == 0U) ? 1U : entry_count;
+
+  columns->asset_row_offsets    = (size_t*)_cardano_malloc((columns->asset_count + 1U) * sizeof(size_t));
+  columns->asset_rows           = (size_t*)_cardano_malloc(entries * sizeof(size_t));
+  columns->asset_row_quantities = (int64_t*)_cardano_malloc(entries * sizeof(int64_t));
+
+  size_t* cursors = (size_t*)_cardano_malloc((columns->asset_count + 1U) * sizeof(size_t));
+
+  if ((columns->asset_row_offsets == NULL) || (columns->asset_rows == NULL) || (columns->asset_row_quantities == NULL) || (cursors == NULL))
+  {
+    _cardano_free(cursors);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(columns->asset_row_offsets, 0, (columns->asset_count + 1U) * sizeof(size_t)));
+
+  for (size_t entry = 0U; entry < entry_count; ++entry)
+  {
+    ++columns->asset_row_offsets[columns->asset_ids[entry] + 1U];
+  }
+
+  for (size_t asset = 0U; asset < columns->asset_count; ++asset)
+  {
+    columns->asset_row_offsets[asset + 1U] += columns->asset_row_offsets[asset];
+  }
+
+  cardano_safe_memcpy(cursors, (columns->asset_count + 1U) * sizeof(size_t), columns->asset_row_offsets, (columns->asset_count + 1U) * sizeof(size_t));
+
+  for (size_t row = 0U; row < columns->count; ++row)
+  {
+    for (size_t entry = columns->asset_offsets[row]; entry < columns->asset_offsets[row + 1U]; ++entry)
+    {
+      const size_t position = cursors[columns->asset_ids[entry]];
+
+      columns->asset_rows[position]           = row;
+      columns->asset_row_quantities[position] = columns->asset_quantities[entry];
+
+      ++cursors[columns->asset_ids[entry]];
+    }
+  }
+
+  _cardano_free(cursors);
+
+  return CARDANO_SUCCESS;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+_cardano_utxo_columns_new(cardano_utxo_list_t* utxos, cardano_utxo_columns_t** columns)
+{
+  if ((utxos == NULL) || (columns == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_utxo_columns_t* snapshot = (cardano_utxo_columns_t*)_cardano_malloc(sizeof(cardano_utxo_columns_t));
+
+  if (snapshot == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(snapshot, 0, sizeof(cardano_utxo_columns_t)));
+
+  cardano_utxo_list_ref(utxos);
+  snapshot->source = utxos;
+
+  const size_t count = cardano_utxo_list_get_length(utxos);
+
+  // Allocate at least one row so empty lists do not depend on zero-sized allocations.
+  const size_t rows = (count == 0U) ? 1U : count;
+
+  snapshot->tx_hashes        = (byte_t*)_cardano_malloc(rows * CARDANO_UTXO_COLUMNS_TX_HASH_SIZE);
+  snapshot->output_indices   = (uint64_t*)_cardano_malloc(rows * sizeof(uint64_t));
+  snapshot->lovelace         = (int64_t*)_cardano_malloc(rows * sizeof(int64_t));
+  snapshot->asset_offsets    = (size_t*)_cardano_malloc((rows + 1U) * sizeof(size_t));
+  snapshot->asset_slots      = (uint32_t*)_cardano_malloc(INITIAL_ASSET_SLOT_COUNT * sizeof(uint32_t));
+  snapshot->asset_slot_count = INITIAL_ASSET_SLOT_COUNT;
+
+  if ((snapshot->tx_hashes == NULL) || (snapshot->output_indices == NULL) || (snapshot->lovelace == NULL) || (snapshot->asset_offsets == NULL) || (snapshot->asset_slots == NULL))
+  {
+    _cardano_utxo_columns_free(&snapshot);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset(snapshot->asset_slots, 0, INITIAL_ASSET_SLOT_COUNT * sizeof(uint32_t)));
+  snapshot->asset_offsets[0] = 0U;
+
+  size_t capacity = 0U;
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    cardano_utxo_t* utxo = cardano_utxo_list_peek(utxos, i);
+
+    cardano_error_t result = (utxo == NULL) ? CARDANO_ERROR_OUT_OF_BOUNDS_MEMORY_READ : push_row(snapshot, &capacity, utxo);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      _cardano_utxo_columns_free(&snapshot);
+
+      return result;
+    }
+  }
+
+  cardano_error_t result = build_asset_index(snapshot);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    _cardano_utxo_columns_free(&snapshot);
+
+    return result;
+  }
+
+  *columns = snapshot;
+
+  return CARDANO_SUCCESS;
+}
+
+void
+_cardano_utxo_columns_free(cardano_utxo_columns_t** columns)
+{
+  if ((columns == NULL) || (*columns == NULL))
+  {
+    return;
+  }
+
+  cardano_utxo_columns_t* snapshot = *columns;
+
+  for (size_t i = 0U; i < snapshot->asset_count; ++i)
+  {
+    cardano_asset_id_unref(&snapshot->assets[i]);
+  }
+
+  cardano_utxo_list_unref(&snapshot->source);
+
+  _cardano_free(snapshot->tx_hashes);
+  _cardano_free(snapshot->output_indices);
+  _cardano_free(snapshot->lovelace);
+  _cardano_free(snapshot->asset_offsets);
+  _cardano_free(snapshot->asset_ids);
+  _cardano_free(snapshot->asset_quantities);
+  _cardano_free((void*)snapshot->assets);
+  _cardano_free(snapshot->asset_hashes);
+  _cardano_free(snapshot->asset_slots);
+  _cardano_free(snapshot->asset_row_offsets);
+  _cardano_free(snapshot->asset_rows);
+  _cardano_free(snapshot->asset_row_quantities);
+  _cardano_free(snapshot);
+
+  *columns = NULL;
+}
+
+cardano_utxo_t*
+_cardano_utxo_columns_peek_utxo(const cardano_utxo_columns_t* columns, const size_t row)
+{
+  if ((columns == NULL) || (row >= columns->count))
+  {
+    return NULL;
+  }
+
+  return cardano_utxo_list_peek(columns->source, row);
+}
+
+bool
+_cardano_utxo_columns_find_asset(const cardano_utxo_columns_t* columns, const cardano_asset_id_t* asset_id, uint32_t* index)
+{
+  if ((columns == NULL) || (asset_id == NULL) || (index == NULL) || (columns->asset_count == 0U))
+  {
+    return false;
+  }
+
+  const size_t slot = find_slot(columns, asset_id, hash_asset_id(asset_id));
+
+  if (columns->asset_slots[slot] == 0U)
+  {
+    return false;
+  }
+
+  *index = columns->asset_slots[slot] - 1U;
+
+  return true;
+}
+
+bool
+_cardano_utxo_columns_get_asset_rows(
+  const cardano_utxo_columns_t* columns,
+  const cardano_asset_id_t*     asset_id,
+  const size_t**                rows,
+  const int64_t**               quantities,
+  size_t*                       count)
+{
+  if ((rows == NULL) || (quantities == NULL) || (count == NULL))
+  {
+    return false;
+  }
+
+  *count = 0U;
+
+  uint32_t index = 0U;
+
+  if (!_cardano_utxo_columns_find_asset(columns, asset_id, &index))
+  {
+    return false;
+  }
+
+  const size_t begin = columns->asset_row_offsets[index];
+
+  *rows       = &columns->asset_rows[begin];
+  *quantities = &columns->asset_row_quantities[begin];
+  *count      = columns->asset_row_offsets[index + 1U] - begin;
+
+  return true;
+}
+
+void
+_cardano_utxo_columns_sort_desc(size_t* order, const size_t count, const int64_t* amounts, size_t* scratch)
+{
+  if ((order == NULL) || (amounts == NULL) || (scratch == NULL))
+  {
+    return;
+  }
+
+  size_t* source      = order;
+  size_t* destination = scratch;
+
+  for (size_t width = 1U; width < count; width *= 2U)
+  {
+    for (size_t start = 0U; start < count; start += 2U * width)
+    {
+      const size_t middle = ((start + width) < count) ? (start + width) : count;
+      const size_t end    = ((start + (2U * width)) < count) ? (start + (2U * width)) : count;
+
+      size_t left  = start;
+      size_t right = middle;
+
+      for (size_t out = start; out < end; ++out)
+      {
+        // Taking from the left run on ties keeps the sort stable.
+        if ((left < middle) && ((right >= end) || (amounts[source[left]] >= amounts[source[right]])))
+        {
+          destination[out] = source[left];
+          ++left;
+        }
+        else
+        {
+          destination[out] = source[right];
+          ++right;
+        }
+      }
+    }
+
+    size_t* swap = source;
+    source       = destination;
+    destination  = swap;
+  }
+
+  if (source != order)
+  {
+    cardano_safe_memcpy(order, count * sizeof(size_t), source, count * sizeof(size_t));
+  }
+}
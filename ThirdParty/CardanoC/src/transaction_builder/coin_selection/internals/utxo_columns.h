@@ -0,0 +1,151 @@
+/**
+ * \file utxo_columns.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_UTXO_COLUMNS_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_UTXO_COLUMNS_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/assets/asset_id.h>
+#include <cardano/common/utxo.h>
+#include <cardano/common/utxo_list.h>
+#include <cardano/error.h>
+#include <cardano/typedefs.h>
+
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Size in bytes of a transaction hash in the \ref cardano_utxo_columns_t::tx_hashes column.
+ */
+#define CARDANO_UTXO_COLUMNS_TX_HASH_SIZE 32U
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A read-only columnar snapshot of a UTxO list.
+ *
+ * Row `i` describes the `i`-th UTxO of the source list. Scalar fields are stored in one flat array per field, and the
+ * native assets of row `i` are the entries `asset_offsets[i]` to `asset_offsets[i + 1] - 1` of the `asset_ids` and
+ * `asset_quantities` columns (compressed sparse row layout). The entries of `asset_ids` are indexes into `assets`,
+ * which holds each distinct asset id of the snapshot once. Lovelace is kept in its own column and never appears in
+ * the asset columns.
+ *
+ * The snapshot also holds the transposed index: the rows holding asset `a` are the entries `asset_row_offsets[a]` to
+ * `asset_row_offsets[a + 1] - 1` of the `asset_rows` and `asset_row_quantities` columns, in row order. Selecting
+ * for an asset then only visits the rows that hold it.
+ *
+ * Scanning a column touches contiguous memory only, instead of walking utxo, output, value and multi-asset objects
+ * for every candidate.
+ *
+ * The snapshot keeps a reference to the source list; the list must not be modified while the snapshot is in use.
+ */
+typedef struct cardano_utxo_columns_t
+{
+    cardano_utxo_list_t* source;
+    size_t               count;
+    byte_t*              tx_hashes;
+    uint64_t*            output_indices;
+    int64_t*             lovelace;
+    size_t*              asset_offsets;
+    uint32_t*            asset_ids;
+    int64_t*             asset_quantities;
+    cardano_asset_id_t** assets;
+    size_t               asset_count;
+    uint64_t*            asset_hashes;
+    uint32_t*            asset_slots;
+    size_t               asset_slot_count;
+    size_t*              asset_row_offsets;
+    size_t*              asset_rows;
+    int64_t*             asset_row_quantities;
+} cardano_utxo_columns_t;
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Builds a columnar snapshot of a UTxO list.
+ *
+ * \param[in] utxos The list to snapshot.
+ * \param[out] columns On success, the new snapshot. It must be released with \ref _cardano_utxo_columns_free.
+ *
+ * \return \ref CARDANO_SUCCESS on success, \ref CARDANO_ERROR_POINTER_IS_NULL if an argument or a UTxO field is NULL,
+ *         or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED if the columns could not be allocated.
+ */
+cardano_error_t _cardano_utxo_columns_new(cardano_utxo_list_t* utxos, cardano_utxo_columns_t** columns);
+
+/**
+ * \brief Releases a columnar snapshot and sets `*columns` to NULL.
+ *
+ * \param[in,out] columns The snapshot to release.
+ */
+void _cardano_utxo_columns_free(cardano_utxo_columns_t** columns);
+
+/**
+ * \brief Gets the UTxO of a row, without taking a reference.
+ *
+ * \param[in] columns The snapshot.
+ * \param[in] row The row index.
+ *
+ * \return The UTxO object of the row, still owned by the source list.
+ */
+cardano_utxo_t* _cardano_utxo_columns_peek_utxo(const cardano_utxo_columns_t* columns, size_t row);
+
+/**
+ * \brief Looks up the interned index of a native asset.
+ *
+ * \param[in] columns The snapshot.
+ * \param[in] asset_id The asset to look up; must not be lovelace.
+ * \param[out] index On success, the index of the asset in \ref cardano_utxo_columns_t::assets.
+ *
+ * \return true if some row of the snapshot holds the asset, false otherwise.
+ */
+bool _cardano_utxo_columns_find_asset(const cardano_utxo_columns_t* columns, const cardano_asset_id_t* asset_id, uint32_t* index);
+
+/**
+ * \brief Gets the rows holding a native asset, in row order.
+ *
+ * \param[in] columns The snapshot.
+ * \param[in] asset_id The asset to look up; must not be lovelace.
+ * \param[out] rows On success, the rows holding the asset. The array is owned by the snapshot.
+ * \param[out] quantities On success, the quantity held by each of those rows. The array is owned by the snapshot.
+ * \param[out] count The number of rows holding the asset; zero if none does.
+ *
+ * \return true if some row of the snapshot holds the asset, false otherwise.
+ */
+bool _cardano_utxo_columns_get_asset_rows(
+  const cardano_utxo_columns_t* columns,
+  const cardano_asset_id_t*     asset_id,
+  const size_t**                rows,
+  const int64_t**               quantities,
+  size_t*                       count);
+
+/**
+ * \brief Stably sorts row indexes by decreasing amount.
+ *
+ * Rows with equal amounts keep their relative order, matching \ref cardano_utxo_list_sort.
+ *
+ * \param[in,out] order The row indexes to sort.
+ * \param[in] count The number of row indexes.
+ * \param[in] amounts The amount of each row, indexed by row.
+ * \param[in] scratch A buffer of `count` elements used while sorting.
+ */
+void _cardano_utxo_columns_sort_desc(size_t* order, size_t count, const int64_t* amounts, size_t* scratch);
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_UTXO_COLUMNS_H
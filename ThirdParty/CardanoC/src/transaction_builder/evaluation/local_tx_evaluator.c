@@ -0,0 +1,693 @@
+/**
+ * \file local_tx_evaluator.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/address/address.h>
+#include <cardano/address/base_address.h>
+#include <cardano/address/enterprise_address.h>
+#include <cardano/address/pointer_address.h>
+#include <cardano/address/reward_address.h>
+#include <cardano/assets/multi_asset.h>
+#include <cardano/common/credential.h>
+#include <cardano/common/utxo.h>
+#include <cardano/common/withdrawal_map.h>
+#include <cardano/object.h>
+#include <cardano/transaction_body/transaction_body.h>
+#include <cardano/transaction_body/transaction_input_set.h>
+#include <cardano/transaction_body/transaction_output.h>
+#include <cardano/transaction_builder/evaluation/local_tx_evaluator.h>
+#include <cardano/witness_set/redeemer_list.h>
+#include <cardano/witness_set/witness_set.h>
+
+#include "../../allocators.h"
+#include "../../string_safe.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief The budget of one script, with its hash decoded.
+ */
+typedef struct script_budget_entry_t
+{
+    cardano_blake2b_hash_t* script_hash;
+    uint64_t                memory;
+    uint64_t                cpu_steps;
+} script_budget_entry_t;
+
+/**
+ * \brief Context of a local transaction evaluator.
+ *
+ * Budget evaluators point \ref evaluate_script at their own table, so both kinds share one evaluation path.
+ */
+typedef struct local_tx_evaluator_context_t
+{
+    cardano_object_t               base;
+    cardano_script_evaluate_func_t evaluate_script;
+    void*                          script_context;
+    cardano_tx_evaluator_t*        fallback;
+    script_budget_entry_t*         budgets;
+    size_t                         budget_count;
+} local_tx_evaluator_context_t;
+
+/**
+ * \brief Units computed in-process for the redeemer at the same position of the transaction redeemer list.
+ */
+typedef struct local_units_t
+{
+    bool     evaluated;
+    uint64_t memory;
+    uint64_t cpu_steps;
+} local_units_t;
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Releases the resources of a local transaction evaluator context.
+ *
+ * \param[in] object The context.
+ */
+static void
+local_tx_evaluator_context_deallocate(void* object)
+{
+  local_tx_evaluator_context_t* context = (local_tx_evaluator_context_t*)object;
+
+  for (size_t i = 0U; i < context->budget_count; ++i)
+  {
+    cardano_blake2b_hash_unref(&context->budgets[i].script_hash);
+  }
+
+  _cardano_free(context->budgets);
+  cardano_tx_evaluator_unref(&context->fallback);
+  _cardano_free(context);
+}
+
+/**
+ * \brief Gets the hash of a credential if it is a script credential.
+ *
+ * \param[in] credential The credential, or NULL.
+ *
+ * \return A new reference to the script hash, or NULL if \p credential is NULL or a key hash.
+ */
+static cardano_blake2b_hash_t*
+get_script_hash(const cardano_credential_t* credential)
+{
+  cardano_credential_type_t type = CARDANO_CREDENTIAL_TYPE_KEY_HASH;
+
+  if ((credential == NULL) || (cardano_credential_get_type(credential, &type) != CARDANO_SUCCESS) || (type != CARDANO_CREDENTIAL_TYPE_SCRIPT_HASH))
+  {
+    return NULL;
+  }
+
+  return cardano_credential_get_hash(credential);
+}
+
+/**
+ * \brief Gets the payment script hash of an address.
+ *
+ * \param[in] address The address.
+ *
+ * \return A new reference to the script hash, or NULL if the address is not locked by a script.
+ */
+static cardano_blake2b_hash_t*
+get_payment_script_hash(const cardano_address_t* address)
+{
+  cardano_credential_t* credential = NULL;
+
+  cardano_base_address_t*       base_address       = cardano_address_to_base_address(address);
+  cardano_enterprise_address_t* enterprise_address = cardano_address_to_enterprise_address(address);
+  cardano_pointer_address_t*    pointer_address    = cardano_address_to_pointer_address(address);
+
+  if (base_address != NULL)
+  {
+    credential = cardano_base_address_get_payment_credential(base_address);
+  }
+  else if (enterprise_address != NULL)
+  {
+    credential = cardano_enterprise_address_get_payment_credential(enterprise_address);
+  }
+  else if (pointer_address != NULL)
+  {
+    credential = cardano_pointer_address_get_payment_credential(pointer_address);
+  }
+
+  cardano_base_address_unref(&base_address);
+  cardano_enterprise_address_unref(&enterprise_address);
+  cardano_pointer_address_unref(&pointer_address);
+
+  cardano_blake2b_hash_t* script_hash = get_script_hash(credential);
+  cardano_credential_unref(&credential);
+
+  return script_hash;
+}
+
+/**
+ * \brief Finds the script the spending redeemer at an index runs.
+ *
+ * \param[in] body The transaction body. Inputs are kept sorted, so redeemer indices are positions in the set.
+ * \param[in] resolved_inputs The outputs spent by the transaction, or NULL.
+ * \param[in] index The redeemer index.
+ *
+ * \return A new reference to the script hash, or NULL if it cannot be found.
+ */
+static cardano_blake2b_hash_t*
+resolve_spend_script(cardano_transaction_body_t* body, cardano_utxo_list_t* resolved_inputs, uint64_t index)
+{
+  cardano_transaction_input_set_t* inputs = cardano_transaction_body_get_inputs(body);
+  cardano_transaction_input_t*     input  = NULL;
+
+  cardano_error_t result = cardano_transaction_input_set_get(inputs, (size_t)index, &input);
+  cardano_transaction_input_set_unref(&inputs);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return NULL;
+  }
+
+  cardano_blake2b_hash_t* script_hash = NULL;
+
+  for (size_t i = 0U; (script_hash == NULL) && (i < cardano_utxo_list_get_length(resolved_inputs)); ++i)
+  {
+    cardano_utxo_t*              utxo       = cardano_utxo_list_peek(resolved_inputs, i);
+    cardano_transaction_input_t* utxo_input = cardano_utxo_get_input(utxo);
+
+    if (cardano_transaction_input_equals(input, utxo_input))
+    {
+      cardano_transaction_output_t* output  = cardano_utxo_get_output(utxo);
+      cardano_address_t*            address = cardano_transaction_output_get_address(output);
+
+      script_hash = get_payment_script_hash(address);
+
+      cardano_address_unref(&address);
+      cardano_transaction_output_unref(&output);
+    }
+
+    cardano_transaction_input_unref(&utxo_input);
+  }
+
+  cardano_transaction_input_unref(&input);
+
+  return script_hash;
+}
+
+/**
+ * \brief Finds the script the minting redeemer at an index runs.
+ *
+ * \param[in] body The transaction body. Policies are kept sorted, so redeemer indices are positions in the mint.
+ * \param[in] index The redeemer index.
+ *
+ * \return A new reference to the policy ID, or NULL if there is no policy at \p index.
+ */
+static cardano_blake2b_hash_t*
+resolve_mint_script(cardano_transaction_body_t* body, uint64_t index)
+{
+  cardano_multi_asset_t*    mint        = cardano_transaction_body_get_mint(body);
+  cardano_policy_id_list_t* policy_ids  = NULL;
+  cardano_blake2b_hash_t*   script_hash = NULL;
+
+  if ((mint != NULL) && (cardano_multi_asset_get_keys(mint, &policy_ids) == CARDANO_SUCCESS))
+  {
+    if (cardano_policy_id_list_get(policy_ids, (size_t)index, &script_hash) != CARDANO_SUCCESS)
+    {
+      script_hash = NULL;
+    }
+  }
+
+  cardano_policy_id_list_unref(&policy_ids);
+  cardano_multi_asset_unref(&mint);
+
+  return script_hash;
+}
+
+/**
+ * \brief Finds the script the withdrawal redeemer at an index runs.
+ *
+ * \param[in] body The transaction body. Withdrawals are kept sorted, so redeemer indices are positions in the map.
+ * \param[in] index The redeemer index.
+ *
+ * \return A new reference to the script hash, or NULL if the withdrawal does not exist or is not from a script.
+ */
+static cardano_blake2b_hash_t*
+resolve_reward_script(cardano_transaction_body_t* body, uint64_t index)
+{
+  cardano_withdrawal_map_t* withdrawals    = cardano_transaction_body_get_withdrawals(body);
+  cardano_reward_address_t* reward_address = NULL;
+  cardano_blake2b_hash_t*   script_hash    = NULL;
+
+  if ((withdrawals != NULL) && (cardano_withdrawal_map_get_key_at(withdrawals, (size_t)index, &reward_address) == CARDANO_SUCCESS))
+  {
+    cardano_credential_t* credential = cardano_reward_address_get_credential(reward_address);
+
+    script_hash = get_script_hash(credential);
+
+    cardano_credential_unref(&credential);
+  }
+
+  cardano_reward_address_unref(&reward_address);
+  cardano_withdrawal_map_unref(&withdrawals);
+
+  return script_hash;
+}
+
+/**
+ * \brief Finds the script a redeemer runs.
+ *
+ * \param[in] body The transaction body.
+ * \param[in] resolved_inputs The outputs spent by the transaction, or NULL.
+ * \param[in] redeemer The redeemer.
+ *
+ * \return A new reference to the script hash, or NULL if it cannot be told from the transaction alone.
+ */
+static cardano_blake2b_hash_t*
+resolve_script_hash(cardano_transaction_body_t* body, cardano_utxo_list_t* resolved_inputs, const cardano_redeemer_t* redeemer)
+{
+  const uint64_t index = cardano_redeemer_get_index(redeemer);
+
+  switch (cardano_redeemer_get_tag(redeemer))
+  {
+    case CARDANO_REDEEMER_TAG_SPEND:
+      return resolve_spend_script(body, resolved_inputs, index);
+    case CARDANO_REDEEMER_TAG_MINT:
+      return resolve_mint_script(body, index);
+    case CARDANO_REDEEMER_TAG_REWARD:
+      return resolve_reward_script(body, index);
+    case CARDANO_REDEEMER_TAG_CERTIFYING:
+    case CARDANO_REDEEMER_TAG_VOTING:
+    case CARDANO_REDEEMER_TAG_PROPOSING:
+    default:
+      return NULL;
+  }
+}
+
+/**
+ * \brief Looks a script up in the budget table of the evaluator.
+ *
+ * \param[in] context The local evaluator context.
+ *
+ * \return \ref CARDANO_SUCCESS if the script has a budget, \ref CARDANO_ERROR_ELEMENT_NOT_FOUND otherwise.
+ */
+static cardano_error_t
+evaluate_from_budgets(
+  void*                   context,
+  cardano_redeemer_t*     redeemer,
+  cardano_blake2b_hash_t* script_hash,
+  cardano_transaction_t*  tx,
+  cardano_utxo_list_t*    resolved_inputs,
+  uint64_t*               memory,
+  uint64_t*               cpu_steps)
+{
+  CARDANO_UNUSED(redeemer);
+  CARDANO_UNUSED(tx);
+  CARDANO_UNUSED(resolved_inputs);
+
+  const local_tx_evaluator_context_t* evaluator = (const local_tx_evaluator_context_t*)context;
+
+  for (size_t i = 0U; (script_hash != NULL) && (i < evaluator->budget_count); ++i)
+  {
+    if (cardano_blake2b_hash_equals(evaluator->budgets[i].script_hash, script_hash))
+    {
+      *memory    = evaluator->budgets[i].memory;
+      *cpu_steps = evaluator->budgets[i].cpu_steps;
+
+      return CARDANO_SUCCESS;
+    }
+  }
+
+  return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+}
+
+/**
+ * \brief Copies the units the fallback evaluator computed onto the result.
+ *
+ * \param[in] context The local evaluator context.
+ * \param[in] tx The transaction.
+ * \param[in] additional_utxos The outputs spent by the transaction, or NULL.
+ * \param[in] result_redeemers The redeemers being returned.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of the fallback evaluator.
+ */
+static cardano_error_t
+apply_fallback(
+  const local_tx_evaluator_context_t* context,
+  cardano_transaction_t*              tx,
+  cardano_utxo_list_t*                additional_utxos,
+  cardano_redeemer_list_t*            result_redeemers)
+{
+  cardano_redeemer_list_t* remote = NULL;
+  cardano_error_t          result = cardano_tx_evaluator_evaluate(context->fallback, tx, additional_utxos, &remote);
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < cardano_redeemer_list_get_length(remote)); ++i)
+  {
+    cardano_redeemer_t* redeemer = cardano_redeemer_list_peek(remote, i);
+    cardano_ex_units_t* ex_units = cardano_redeemer_get_ex_units(redeemer);
+
+    result = cardano_redeemer_list_set_ex_units(
+      result_redeemers,
+      cardano_redeemer_get_tag(redeemer),
+      cardano_redeemer_get_index(redeemer),
+      cardano_ex_units_get_memory(ex_units),
+      cardano_ex_units_get_cpu_steps(ex_units));
+
+    cardano_ex_units_unref(&ex_units);
+  }
+
+  cardano_redeemer_list_unref(&remote);
+
+  return result;
+}
+
+/**
+ * \brief Evaluates the redeemers of a transaction locally, asking the fallback only about unknown scripts.
+ *
+ * \param[in] tx_evaluator_impl The evaluator implementation.
+ * \param[in] tx The transaction.
+ * \param[in] additional_utxos The outputs spent by the transaction, or NULL.
+ * \param[out] redeemers On success, the redeemers of the transaction with their units set.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+evaluate(
+  cardano_tx_evaluator_impl_t* tx_evaluator_impl,
+  cardano_transaction_t*       tx,
+  cardano_utxo_list_t*         additional_utxos,
+  cardano_redeemer_list_t**    redeemers)
+{
+  assert(tx_evaluator_impl != NULL);
+  assert(tx_evaluator_impl->context != NULL);
+  assert(tx != NULL);
+  assert(redeemers != NULL);
+
+  const local_tx_evaluator_context_t* context = (const local_tx_evaluator_context_t*)((void*)tx_evaluator_impl->context);
+
+  cardano_witness_set_t*   witness_set  = cardano_transaction_get_witness_set(tx);
+  cardano_redeemer_list_t* tx_redeemers = cardano_witness_set_get_redeemers(witness_set);
+  cardano_witness_set_unref(&witness_set);
+
+  cardano_redeemer_list_t* result_redeemers = NULL;
+  cardano_error_t          result           = CARDANO_SUCCESS;
+
+  if (tx_redeemers == NULL)
+  {
+    result = cardano_redeemer_list_new(&result_redeemers);
+  }
+  else
+  {
+    result = cardano_redeemer_list_clone(tx_redeemers, &result_redeemers);
+  }
+
+  const size_t   count = cardano_redeemer_list_get_length(tx_redeemers);
+  local_units_t* units = NULL;
+
+  if ((result == CARDANO_SUCCESS) && (count > 0U))
+  {
+    units = (local_units_t*)_cardano_malloc(count * sizeof(local_units_t));
+
+    if (units == NULL)
+    {
+      result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+  }
+
+  cardano_transaction_body_t* body               = cardano_transaction_get_body(tx);
+  bool                        needs_fallback     = false;
+  size_t                      unknown_index      = 0U;
+  cardano_redeemer_tag_t      unknown_tag        = CARDANO_REDEEMER_TAG_SPEND;
+  uint64_t                    unknown_redeemer_index = 0U;
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < count); ++i)
+  {
+    cardano_redeemer_t*     redeemer    = cardano_redeemer_list_peek(tx_redeemers, i);
+    cardano_blake2b_hash_t* script_hash = resolve_script_hash(body, additional_utxos, redeemer);
+
+    units[i].evaluated = false;
+    units[i].memory    = 0U;
+    units[i].cpu_steps = 0U;
+
+    result = context->evaluate_script(context->script_context, redeemer, script_hash, tx, additional_utxos, &units[i].memory, &units[i].cpu_steps);
+
+    cardano_blake2b_hash_unref(&script_hash);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      units[i].evaluated = true;
+    }
+    else if (result == CARDANO_ERROR_ELEMENT_NOT_FOUND)
+    {
+      if (!needs_fallback)
+      {
+        unknown_index      = i;
+        unknown_tag        = cardano_redeemer_get_tag(redeemer);
+        unknown_redeemer_index = cardano_redeemer_get_index(redeemer);
+      }
+
+      needs_fallback = true;
+      result         = CARDANO_SUCCESS;
+    }
+    else
+    {
+      CARDANO_UNUSED(snprintf(tx_evaluator_impl->error_message, sizeof(tx_evaluator_impl->error_message), "Local evaluation of redeemer %zu failed.", i));
+    }
+  }
+
+  cardano_transaction_body_unref(&body);
+
+  if ((result == CARDANO_SUCCESS) && needs_fallback)
+  {
+    if (context->fallback == NULL)
+    {
+      CARDANO_UNUSED(snprintf(
+        tx_evaluator_impl->error_message,
+        sizeof(tx_evaluator_impl->error_message),
+        "No local budget for redeemer %zu (tag %d, index %llu) and no fallback evaluator.",
+        unknown_index,
+        (int)unknown_tag,
+        (unsigned long long)unknown_redeemer_index));
+
+      result = CARDANO_ERROR_ELEMENT_NOT_FOUND;
+    }
+    else
+    {
+      result = apply_fallback(context, tx, additional_utxos, result_redeemers);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        CARDANO_UNUSED(snprintf(
+          tx_evaluator_impl->error_message,
+          sizeof(tx_evaluator_impl->error_message),
+          "%s",
+          cardano_tx_evaluator_get_last_error(context->fallback)));
+      }
+    }
+  }
+
+  // Local units are applied last, so they win over whatever the fallback returned for the same redeemer
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < count); ++i)
+  {
+    if (units[i].evaluated)
+    {
+      const cardano_redeemer_t* redeemer = cardano_redeemer_list_peek(tx_redeemers, i);
+
+      result = cardano_redeemer_list_set_ex_units(
+        result_redeemers,
+        cardano_redeemer_get_tag(redeemer),
+        cardano_redeemer_get_index(redeemer),
+        units[i].memory,
+        units[i].cpu_steps);
+    }
+  }
+
+  _cardano_free(units);
+  cardano_redeemer_list_unref(&tx_redeemers);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_redeemer_list_unref(&result_redeemers);
+    return result;
+  }
+
+  *redeemers = result_redeemers;
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Allocates a local evaluator context.
+ *
+ * \param[in] fallback The fallback evaluator, or NULL. The context takes a reference to it.
+ *
+ * \return The new context, or NULL if memory could not be allocated.
+ */
+static local_tx_evaluator_context_t*
+local_tx_evaluator_context_new(cardano_tx_evaluator_t* fallback)
+{
+  local_tx_evaluator_context_t* context = _cardano_malloc(sizeof(local_tx_evaluator_context_t));
+
+  if (context == NULL)
+  {
+    return NULL;
+  }
+
+  CARDANO_UNUSED(memset(context, 0, sizeof(local_tx_evaluator_context_t)));
+
+  context->base.deallocator   = local_tx_evaluator_context_deallocate;
+  context->base.ref_count     = 1;
+  context->base.last_error    = NULL;
+
+  if (fallback != NULL)
+  {
+    cardano_tx_evaluator_ref(fallback);
+    context->fallback = fallback;
+  }
+
+  return context;
+}
+
+/**
+ * \brief Wraps a local evaluator context in a transaction evaluator.
+ *
+ * \param[in] context The context. The evaluator takes over its reference, and releases it on failure.
+ * \param[in] name The name of the evaluator.
+ * \param[out] tx_evaluator On success, the new evaluator.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+wrap_context(local_tx_evaluator_context_t* context, const char* name, cardano_tx_evaluator_t** tx_evaluator)
+{
+  cardano_tx_evaluator_impl_t impl = { 0 };
+
+  cardano_safe_memcpy(impl.name, sizeof(impl.name), name, strlen(name));
+
+  impl.context  = (cardano_object_t*)((void*)context);
+  impl.evaluate = evaluate;
+
+  cardano_error_t result = cardano_tx_evaluator_new(impl, tx_evaluator);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_object_t* object = (cardano_object_t*)((void*)context);
+    cardano_object_unref(&object);
+  }
+
+  return result;
+}
+
+/* DEFINITIONS ****************************************************************/
+
+cardano_error_t
+cardano_local_tx_evaluator_new(
+  cardano_script_evaluate_func_t evaluate_script,
+  void*                          context,
+  cardano_tx_evaluator_t*        fallback,
+  cardano_tx_evaluator_t**       tx_evaluator)
+{
+  if ((evaluate_script == NULL) || (tx_evaluator == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  local_tx_evaluator_context_t* local_context = local_tx_evaluator_context_new(fallback);
+
+  if (local_context == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  local_context->evaluate_script = evaluate_script;
+  local_context->script_context  = context;
+
+  return wrap_context(local_context, "Local transaction evaluator", tx_evaluator);
+}
+
+cardano_error_t
+cardano_budget_tx_evaluator_new(
+  const cardano_script_budget_t* budgets,
+  size_t                         budget_count,
+  cardano_tx_evaluator_t*        fallback,
+  cardano_tx_evaluator_t**       tx_evaluator)
+{
+  if (((budgets == NULL) && (budget_count > 0U)) || (tx_evaluator == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  local_tx_evaluator_context_t* context = local_tx_evaluator_context_new(fallback);
+
+  if (context == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  context->evaluate_script = evaluate_from_budgets;
+  context->script_context  = context;
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (budget_count > 0U)
+  {
+    context->budgets = (script_budget_entry_t*)_cardano_malloc(budget_count * sizeof(script_budget_entry_t));
+
+    if (context->budgets == NULL)
+    {
+      result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    }
+  }
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < budget_count); ++i)
+  {
+    script_budget_entry_t* entry = &context->budgets[i];
+
+    entry->script_hash = NULL;
+    entry->memory      = budgets[i].memory;
+    entry->cpu_steps   = budgets[i].cpu_steps;
+
+    if (budgets[i].script_hash_hex == NULL)
+    {
+      result = CARDANO_ERROR_POINTER_IS_NULL;
+      break;
+    }
+
+    result = cardano_blake2b_hash_from_hex(budgets[i].script_hash_hex, strlen(budgets[i].script_hash_hex), &entry->script_hash);
+
+    if ((result == CARDANO_SUCCESS) && (cardano_blake2b_hash_get_bytes_size(entry->script_hash) != 28U))
+    {
+      result = CARDANO_ERROR_INVALID_BLAKE2B_HASH_SIZE;
+    }
+
+    // Counted even on failure, so the deallocator releases this entry too
+    context->budget_count = i + 1U;
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_object_t* object = (cardano_object_t*)((void*)context);
+    cardano_object_unref(&object);
+
+    return result;
+  }
+
+  return wrap_context(context, "Budget transaction evaluator", tx_evaluator);
+}
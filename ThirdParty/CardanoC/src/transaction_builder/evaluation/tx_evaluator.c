@@ -91,7 +91,7 @@ cardano_tx_evaluator_new(
 
   (*tx_evaluator)->base.deallocator   = cardano_tx_evaluator_deallocate;
   (*tx_evaluator)->base.ref_count     = 1;
-  (*tx_evaluator)->base.last_error[0] = '\0';
+  (*tx_evaluator)->base.last_error    = NULL;
 
   (*tx_evaluator)->impl = impl;
 
@@ -64,26 +64,29 @@ cardano_get_serialized_coin_size(const uint64_t lovelace, size_t* size_in_bytes)
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
-
-  if (writer == NULL)
+  // The size of a CBOR unsigned integer only depends on its magnitude, no need to encode it.
+  if (lovelace < 24U)
   {
-    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    *size_in_bytes = 1U;
   }
-
-  cardano_error_t result = cardano_cbor_writer_write_uint(writer, lovelace);
-
-  if (result != CARDANO_SUCCESS)
+  else if (lovelace < 256U)
   {
-    cardano_cbor_writer_unref(&writer);
-
-    return result;
+    *size_in_bytes = 2U;
+  }
+  else if (lovelace < 65536U)
+  {
+    *size_in_bytes = 3U;
+  }
+  else if (lovelace < 4294967296U)
+  {
+    *size_in_bytes = 5U;
+  }
+  else
+  {
+    *size_in_bytes = 9U;
   }
 
-  *size_in_bytes = cardano_cbor_writer_get_encode_size(writer);
-  cardano_cbor_writer_unref(&writer);
-
-  return result;
+  return CARDANO_SUCCESS;
 }
 
 cardano_error_t
@@ -99,7 +102,7 @@ cardano_get_serialized_output_size(cardano_transaction_output_t* output, size_t*
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new_size_only();
 
   if (writer == NULL)
   {
@@ -134,7 +137,7 @@ cardano_get_serialized_script_size(cardano_script_t* script, size_t* size_in_byt
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new_size_only();
 
   if (writer == NULL)
   {
@@ -169,7 +172,7 @@ cardano_get_serialized_transaction_size(cardano_transaction_t* transaction, size
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new_size_only();
 
   if (writer == NULL)
   {
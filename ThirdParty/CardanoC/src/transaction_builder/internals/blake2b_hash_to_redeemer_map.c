@@ -152,7 +152,7 @@ cardano_blake2b_hash_to_redeemer_map_new(cardano_blake2b_hash_to_redeemer_map_t*
   }
 
   (*map)->base.ref_count     = 1;
-  (*map)->base.last_error[0] = '\0';
+  (*map)->base.last_error    = NULL;
   (*map)->base.deallocator   = cardano_blake2b_hash_to_redeemer_map_deallocate;
 
   (*map)->array = cardano_array_new(32);
@@ -258,7 +258,7 @@ cardano_blake2b_hash_to_redeemer_map_insert(
   }
 
   kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
+  kvp->base.last_error    = NULL;
   kvp->base.deallocator   = cardano_blake2b_hash_to_redeemer_map_kvp_deallocate;
   kvp->key                = key;
   kvp->value              = value;
@@ -23,7 +23,11 @@
 
 #include <cardano/transaction_builder/transaction_builder.h>
 
+#include <cardano/crypto/blake2b_hash_set.h>
+#include <cardano/crypto/blake2b_hash_size.h>
 #include <cardano/object.h>
+#include <cardano/plutus_data/plutus_list.h>
+#include <cardano/scripts/script.h>
 #include <cardano/time.h>
 #include <cardano/transaction_builder/balancing/input_to_redeemer_map.h>
 #include <cardano/transaction_builder/balancing/transaction_balancing.h>
@@ -33,6 +37,7 @@
 #include <cardano/witness_set/redeemer.h>
 
 #include "../allocators.h"
+#include "../build_profile.h"
 #include "./internals/blake2b_hash_to_redeemer_map.h"
 
 #include <assert.h>
@@ -56,6 +61,17 @@
 
 /* STRUCTURES ****************************************************************/
 
+/**
+ * \brief An input whose output has not been resolved yet, kept until the builder resolves all of them together.
+ */
+typedef struct cardano_tx_builder_pending_input_t
+{
+    cardano_transaction_input_t* input;
+    cardano_plutus_data_t*       redeemer;
+    cardano_plutus_data_t*       datum;
+    bool                         is_reference;
+} cardano_tx_builder_pending_input_t;
+
 /**
  * \brief Type definition for the Cardano Transaction builder.
  *
@@ -82,10 +98,17 @@ typedef struct cardano_tx_builder_t
     cardano_utxo_list_t*           collateral_utxos;
     cardano_utxo_list_t*           pre_selected_inputs;
     cardano_utxo_list_t*           reference_inputs;
+    cardano_tx_builder_pending_input_t* pending_inputs;
+    size_t                         pending_input_count;
+    size_t                         pending_input_capacity;
     bool                           has_plutus_v1;
     bool                           has_plutus_v2;
     bool                           has_plutus_v3;
     size_t                         additional_signature_count;
+    size_t                         native_script_signature_count;
+    cardano_blake2b_hash_set_t*    native_script_hashes;
+    bool                           profiling_enabled;
+    cardano_tx_build_profile_t     profile;
 
     // Redeemer maps
     cardano_input_to_redeemer_map_t*        input_to_redeemer_map;
@@ -96,6 +119,24 @@ typedef struct cardano_tx_builder_t
 
 /* STATIC DECLARATIONS *******************************************************/
 
+/**
+ * \brief Releases the pending inputs of the builder.
+ *
+ * \param[in,out] builder The builder; must not be \c NULL.
+ */
+static void
+clear_pending_inputs(cardano_tx_builder_t* builder)
+{
+  for (size_t i = 0U; i < builder->pending_input_count; ++i)
+  {
+    cardano_transaction_input_unref(&builder->pending_inputs[i].input);
+    cardano_plutus_data_unref(&builder->pending_inputs[i].redeemer);
+    cardano_plutus_data_unref(&builder->pending_inputs[i].datum);
+  }
+
+  builder->pending_input_count = 0U;
+}
+
 /**
  * \brief Deallocates a tx_builder object.
  *
@@ -127,7 +168,10 @@ cardano_tx_builder_deallocate(void* object)
   cardano_utxo_list_unref(&builder->collateral_utxos);
   cardano_utxo_list_unref(&builder->pre_selected_inputs);
   cardano_utxo_list_unref(&builder->reference_inputs);
+  clear_pending_inputs(builder);
+  _cardano_free(builder->pending_inputs);
   cardano_input_to_redeemer_map_unref(&builder->input_to_redeemer_map);
+  cardano_blake2b_hash_set_unref(&builder->native_script_hashes);
   cardano_blake2b_hash_to_redeemer_map_unref(&builder->withdrawals_to_redeemer_map);
   cardano_blake2b_hash_to_redeemer_map_unref(&builder->mints_to_redeemer_map);
   cardano_blake2b_hash_to_redeemer_map_unref(&builder->votes_to_redeemer_map);
@@ -409,10 +453,387 @@ update_script_data_hash(cardano_tx_builder_t* builder, cardano_transaction_t* tx
   cardano_transaction_body_t* body = cardano_transaction_get_body(tx);
   cardano_transaction_body_unref(&body);
 
-  result = cardano_transaction_body_set_script_data_hash(body, hash);
-  cardano_blake2b_hash_unref(&hash);
+  result = cardano_transaction_body_set_script_data_hash(body, hash);
+  cardano_blake2b_hash_unref(&hash);
+
+  return result;
+}
+
+/**
+ * \brief Finds the UTxO of an input in a list.
+ *
+ * \param[in] utxos The list to search.
+ * \param[in] input The input to look for.
+ *
+ * \return The UTxO, owned by the list, or \c NULL if the list does not contain it.
+ */
+static cardano_utxo_t*
+find_utxo(const cardano_utxo_list_t* utxos, const cardano_transaction_input_t* input)
+{
+  const size_t length = cardano_utxo_list_get_length(utxos);
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    cardano_utxo_t*              utxo      = cardano_utxo_list_peek(utxos, i);
+    cardano_transaction_input_t* utxo_input = cardano_utxo_get_input(utxo);
+
+    cardano_transaction_input_unref(&utxo_input);
+
+    if (cardano_transaction_input_equals(utxo_input, input))
+    {
+      return utxo;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * \brief Gets the datum hash a pending spend input still needs a datum for.
+ *
+ * \param[in] pending The pending input.
+ * \param[in] utxo The resolved UTxO of the input.
+ *
+ * \return A new reference to the hash, or \c NULL if the input is a reference input, already has a datum, or its
+ *         output does not carry a datum hash.
+ */
+static cardano_blake2b_hash_t*
+get_missing_datum_hash(const cardano_tx_builder_pending_input_t* pending, cardano_utxo_t* utxo)
+{
+  if (pending->is_reference || (pending->datum != NULL))
+  {
+    return NULL;
+  }
+
+  cardano_transaction_output_t* output = cardano_utxo_get_output(utxo);
+  cardano_transaction_output_unref(&output);
+
+  cardano_datum_t* datum = cardano_transaction_output_get_datum(output);
+  cardano_datum_unref(&datum);
+
+  cardano_datum_type_t type = CARDANO_DATUM_TYPE_INLINE_DATA;
+
+  if ((datum == NULL) || (cardano_datum_get_type(datum, &type) != CARDANO_SUCCESS) || (type != CARDANO_DATUM_TYPE_DATA_HASH))
+  {
+    return NULL;
+  }
+
+  return cardano_datum_get_data_hash(datum);
+}
+
+/**
+ * \brief Finds the position of a hash in a set.
+ *
+ * \param[in] hashes The set to search.
+ * \param[in] hash The hash to look for.
+ *
+ * \return The index of the hash, or the length of the set if it does not contain it.
+ */
+static size_t
+find_hash(const cardano_blake2b_hash_set_t* hashes, const cardano_blake2b_hash_t* hash)
+{
+  const size_t length = cardano_blake2b_hash_set_get_length(hashes);
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    cardano_blake2b_hash_t* element = NULL;
+
+    if (cardano_blake2b_hash_set_get(hashes, i, &element) != CARDANO_SUCCESS)
+    {
+      continue;
+    }
+
+    const bool found = cardano_blake2b_hash_equals(element, hash);
+
+    cardano_blake2b_hash_unref(&element);
+
+    if (found)
+    {
+      return i;
+    }
+  }
+
+  return length;
+}
+
+/**
+ * \brief Collects the datum hashes the pending spend inputs still need and resolves them with one provider call.
+ *
+ * \param[in] builder The builder; must not be \c NULL.
+ * \param[in] utxos The resolved UTxOs of the pending inputs.
+ * \param[out] hashes On success, the hashes that were resolved.
+ * \param[out] datums On success, the datum of each hash in \p hashes, in the same order.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or an appropriate error code on failure.
+ */
+static cardano_error_t
+resolve_pending_datums(
+  cardano_tx_builder_t*        builder,
+  const cardano_utxo_list_t*   utxos,
+  cardano_blake2b_hash_set_t** hashes,
+  cardano_plutus_list_t**      datums)
+{
+  cardano_error_t result = cardano_blake2b_hash_set_new(hashes);
+
+  for (size_t i = 0U; (i < builder->pending_input_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    cardano_tx_builder_pending_input_t* pending = &builder->pending_inputs[i];
+    cardano_blake2b_hash_t*             hash    = get_missing_datum_hash(pending, find_utxo(utxos, pending->input));
+
+    if ((hash != NULL) && (find_hash(*hashes, hash) == cardano_blake2b_hash_set_get_length(*hashes)))
+    {
+      result = cardano_blake2b_hash_set_add(*hashes, hash);
+    }
+
+    cardano_blake2b_hash_unref(&hash);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (cardano_blake2b_hash_set_get_length(*hashes) > 0U))
+  {
+    result = cardano_provider_resolve_datums(builder->provider, *hashes, datums);
+  }
+  else if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_plutus_list_new(datums);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_blake2b_hash_set_unref(hashes);
+  }
+
+  return result;
+}
+
+/**
+ * \brief Resolves the pending inputs of the builder and adds them to the transaction.
+ *
+ * All the pending inputs are resolved with a single \ref cardano_provider_resolve_unspent_outputs call, and the
+ * datums their outputs only reference by hash with a single \ref cardano_provider_resolve_datums call, so a
+ * transaction spending many script outputs costs two round trips instead of one per input and datum.
+ *
+ * \param[in,out] builder The builder; must not be \c NULL.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error that stopped the resolution.
+ */
+static cardano_error_t
+resolve_pending_inputs(cardano_tx_builder_t* builder)
+{
+  if (builder->pending_input_count == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_transaction_input_set_t* inputs = NULL;
+  cardano_error_t                  result = cardano_transaction_input_set_new(&inputs);
+
+  for (size_t i = 0U; (i < builder->pending_input_count) && (result == CARDANO_SUCCESS); ++i)
+  {
+    result = cardano_transaction_input_set_add(inputs, builder->pending_inputs[i].input);
+  }
+
+  cardano_utxo_list_t* utxos = NULL;
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_provider_resolve_unspent_outputs(builder->provider, inputs, &utxos);
+  }
+
+  cardano_transaction_input_set_unref(&inputs);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_tx_builder_set_last_error(builder, cardano_provider_get_last_error(builder->provider));
+    builder->last_error = result;
+    return result;
+  }
+
+  for (size_t i = 0U; i < builder->pending_input_count; ++i)
+  {
+    if (find_utxo(utxos, builder->pending_inputs[i].input) == NULL)
+    {
+      cardano_utxo_list_unref(&utxos);
+      cardano_tx_builder_set_last_error(builder, "An input could not be resolved; its output may already be spent.");
+      builder->last_error = CARDANO_ERROR_ELEMENT_NOT_FOUND;
+      return builder->last_error;
+    }
+  }
+
+  cardano_blake2b_hash_set_t* hashes = NULL;
+  cardano_plutus_list_t*      datums = NULL;
+
+  result = resolve_pending_datums(builder, utxos, &hashes, &datums);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_utxo_list_unref(&utxos);
+    cardano_tx_builder_set_last_error(builder, cardano_provider_get_last_error(builder->provider));
+    builder->last_error = result;
+    return result;
+  }
+
+  for (size_t i = 0U; (i < builder->pending_input_count) && (builder->last_error == CARDANO_SUCCESS); ++i)
+  {
+    cardano_tx_builder_pending_input_t* pending = &builder->pending_inputs[i];
+    cardano_utxo_t*                     utxo    = find_utxo(utxos, pending->input);
+
+    if (pending->is_reference)
+    {
+      cardano_tx_builder_add_reference_input(builder, utxo);
+      continue;
+    }
+
+    cardano_plutus_data_t*  datum = pending->datum;
+    cardano_blake2b_hash_t* hash  = get_missing_datum_hash(pending, utxo);
+
+    if (hash != NULL)
+    {
+      result = cardano_plutus_list_get(datums, find_hash(hashes, hash), &datum);
+      cardano_plutus_data_unref(&datum);
+      cardano_blake2b_hash_unref(&hash);
+
+      if (result != CARDANO_SUCCESS)
+      {
+        cardano_tx_builder_set_last_error(builder, "Failed to resolve the datum of an input.");
+        builder->last_error = result;
+        break;
+      }
+    }
+
+    cardano_tx_builder_add_input(builder, utxo, pending->redeemer, datum);
+  }
+
+  cardano_plutus_list_unref(&datums);
+  cardano_blake2b_hash_set_unref(&hashes);
+  cardano_utxo_list_unref(&utxos);
+
+  clear_pending_inputs(builder);
+
+  return builder->last_error;
+}
+
+/**
+ * \brief Validates the builder state, then balances the transaction and computes its script data hash.
+ *
+ * \param[in] builder The builder; must not be \c NULL.
+ * \param[out] transaction On success, the built transaction.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error that stopped the build.
+ */
+static cardano_error_t
+build_transaction(cardano_tx_builder_t* builder, cardano_transaction_t** transaction)
+{
+  if (transaction == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (builder->last_error != CARDANO_SUCCESS)
+  {
+    return builder->last_error;
+  }
+
+  if (builder->change_address == NULL)
+  {
+    builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
+    cardano_tx_builder_set_last_error(
+      builder,
+      "You must set a change address before calling `build`.");
+
+    return builder->last_error;
+  }
+
+  if (builder->available_utxos == NULL)
+  {
+    builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
+    cardano_tx_builder_set_last_error(
+      builder,
+      "You must set the available UTXOs for input selection before calling `build`.");
+
+    return builder->last_error;
+  }
+
+  if (resolve_pending_inputs(builder) != CARDANO_SUCCESS)
+  {
+    return builder->last_error;
+  }
+
+  if (cardano_transaction_has_script_data(builder->transaction))
+  {
+    if (builder->collateral_address == NULL)
+    {
+      builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
+      cardano_tx_builder_set_last_error(
+        builder,
+        "This transaction interacts with plutus validators. You must set a collateral change address before calling `build`.");
+
+      return builder->last_error;
+    }
+
+    if (builder->collateral_utxos == NULL)
+    {
+      builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
+      cardano_tx_builder_set_last_error(
+        builder,
+        "This transaction interacts with plutus validators. You must set the collateral UTXOs before calling `build`.");
+
+      return builder->last_error;
+    }
+  }
+
+  cardano_transaction_t* tx = builder->transaction;
+
+  cardano_error_t result = set_dummy_script_data_hash(tx);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    builder->last_error = result;
+    return result;
+  }
+
+  cardano_tx_build_profile_t* profile         = _cardano_build_profile_current();
+  const uint64_t              balancing_start = (profile != NULL) ? _cardano_build_profile_now() : 0U;
+
+  result = cardano_balance_transaction(
+    tx,
+    builder->additional_signature_count + builder->native_script_signature_count,
+    builder->params,
+    builder->reference_inputs,
+    builder->pre_selected_inputs,
+    builder->input_to_redeemer_map,
+    builder->available_utxos,
+    builder->coin_selector,
+    builder->change_address,
+    builder->collateral_utxos,
+    builder->collateral_address,
+    builder->tx_evaluator);
+
+  if (profile != NULL)
+  {
+    profile->balancing_ns += _cardano_build_profile_now() - balancing_start;
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    builder->last_error = result;
+    return result;
+  }
+
+  result = update_script_data_hash(builder, tx);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    builder->last_error = result;
+    return result;
+  }
+
+  cardano_transaction_ref(tx);
+  *transaction = tx;
 
-  return result;
+  // Build method can only be called once
+  builder->last_error = CARDANO_ERROR_ILLEGAL_STATE;
+
+  return CARDANO_SUCCESS;
 }
 
 /**
@@ -614,6 +1035,102 @@ get_proposal_procedure_set(cardano_tx_builder_t* builder, cardano_transaction_bo
   return proposals;
 }
 
+/**
+ * \brief Gets the voting procedures from the transaction body. If there are no voting procedures,
+ * it creates them.
+ *
+ * \param builder The transaction builder.
+ * \param body The transaction body.
+ *
+ * \return The voting procedures, owned by the body, or NULL on failure with the error recorded in the builder.
+ */
+static cardano_voting_procedures_t*
+get_voting_procedures(cardano_tx_builder_t* builder, cardano_transaction_body_t* body)
+{
+  cardano_voting_procedures_t* votes = cardano_transaction_body_get_voting_procedures(body);
+
+  if (votes == NULL)
+  {
+    cardano_error_t result = cardano_voting_procedures_new(&votes);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_tx_builder_set_last_error(builder, "Failed to create voting procedures.");
+      builder->last_error = result;
+
+      return NULL;
+    }
+
+    result = cardano_transaction_body_set_voting_procedures(body, votes);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_tx_builder_set_last_error(builder, "Failed to set voting procedures.");
+      cardano_voting_procedures_unref(&votes);
+      builder->last_error = result;
+
+      return NULL;
+    }
+  }
+
+  cardano_voting_procedures_unref(&votes);
+
+  return votes;
+}
+
+/**
+ * \brief Inserts a vote into the voting procedures and records the redeemer of a script voter.
+ *
+ * \param builder The transaction builder.
+ * \param votes The voting procedures of the transaction body.
+ * \param voter The voter.
+ * \param action_id The governance action voted on.
+ * \param vote The vote.
+ * \param redeemer The redeemer of a script voter, or NULL.
+ *
+ * \return CARDANO_SUCCESS on success, or the error recorded in the builder.
+ */
+static cardano_error_t
+add_vote(
+  cardano_tx_builder_t*           builder,
+  cardano_voting_procedures_t*    votes,
+  cardano_voter_t*                voter,
+  cardano_governance_action_id_t* action_id,
+  cardano_voting_procedure_t*     vote,
+  cardano_plutus_data_t*          redeemer)
+{
+  cardano_error_t result = cardano_voting_procedures_insert(votes, voter, action_id, vote);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_tx_builder_set_last_error(builder, "Failed to insert vote.");
+    builder->last_error = result;
+    return result;
+  }
+
+  if (redeemer != NULL)
+  {
+    cardano_witness_set_t* witnesses = cardano_transaction_get_witness_set(builder->transaction);
+    cardano_witness_set_unref(&witnesses);
+
+    cardano_credential_t* credential = cardano_voter_get_credential(voter);
+    cardano_credential_unref(&credential);
+
+    cardano_blake2b_hash_t* hash = cardano_credential_get_hash(credential);
+
+    result = add_redeemer(witnesses, hash, redeemer, CARDANO_REDEEMER_TAG_VOTING, builder);
+    cardano_blake2b_hash_unref(&hash);
+
+    if (result != CARDANO_SUCCESS)
+    {
+      cardano_tx_builder_set_last_error(builder, "Failed to add redeemer.");
+      builder->last_error = result;
+    }
+  }
+
+  return result;
+}
+
 /**
  * \brief Creates an empty plutus data object.
  *
@@ -716,6 +1233,160 @@ add_proposing_redeemer(
   return result;
 }
 
+/**
+ * \brief Queues an input for resolution when the transaction is built.
+ *
+ * \param[in,out] builder The builder; must not be \c NULL.
+ * \param[in] input The input to resolve.
+ * \param[in] redeemer The redeemer of the input, or \c NULL.
+ * \param[in] datum The datum of the input, or \c NULL to resolve it from the output's datum hash.
+ * \param[in] is_reference Whether the input is a reference input.
+ */
+static void
+add_pending_input(
+  cardano_tx_builder_t*        builder,
+  cardano_transaction_input_t* input,
+  cardano_plutus_data_t*       redeemer,
+  cardano_plutus_data_t*       datum,
+  const bool                   is_reference)
+{
+  if ((builder == NULL) || (builder->last_error != CARDANO_SUCCESS))
+  {
+    return;
+  }
+
+  if (input == NULL)
+  {
+    cardano_tx_builder_set_last_error(builder, "Input is NULL.");
+    builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
+    return;
+  }
+
+  if (builder->pending_input_count == builder->pending_input_capacity)
+  {
+    const size_t                        capacity = (builder->pending_input_capacity == 0U) ? 4U : (builder->pending_input_capacity * 2U);
+    cardano_tx_builder_pending_input_t* pending  = _cardano_realloc(builder->pending_inputs, capacity * sizeof(cardano_tx_builder_pending_input_t));
+
+    if (pending == NULL)
+    {
+      cardano_tx_builder_set_last_error(builder, "Failed to queue the input for resolution.");
+      builder->last_error = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+      return;
+    }
+
+    builder->pending_inputs         = pending;
+    builder->pending_input_capacity = capacity;
+  }
+
+  cardano_transaction_input_ref(input);
+
+  if (redeemer != NULL)
+  {
+    cardano_plutus_data_ref(redeemer);
+  }
+
+  if (datum != NULL)
+  {
+    cardano_plutus_data_ref(datum);
+  }
+
+  cardano_tx_builder_pending_input_t* pending = &builder->pending_inputs[builder->pending_input_count];
+
+  pending->input        = input;
+  pending->redeemer     = redeemer;
+  pending->datum        = datum;
+  pending->is_reference = is_reference;
+
+  ++builder->pending_input_count;
+}
+
+/**
+ * \brief Stores the encoded auxiliary data in the transaction and commits to it in the body.
+ *
+ * The transaction writes the bytes as they are, so the metadata maps are not walked and re-encoded each time the
+ * balancing loop serializes the transaction, and the bytes written always match the hash in the body.
+ *
+ * \param[in,out] builder The builder; must not be \c NULL.
+ * \param[in] auxiliary_data_cbor The encoded auxiliary data.
+ * \param[in] hash The hash of \p auxiliary_data_cbor.
+ */
+static void
+set_auxiliary_data_cbor(cardano_tx_builder_t* builder, cardano_buffer_t* auxiliary_data_cbor, cardano_blake2b_hash_t* hash)
+{
+  cardano_error_t result = cardano_transaction_set_auxiliary_data_cbor(builder->transaction, auxiliary_data_cbor);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_tx_builder_set_last_error(builder, "Failed to set auxiliary data.");
+    builder->last_error = result;
+    return;
+  }
+
+  cardano_transaction_body_t* body = cardano_transaction_get_body(builder->transaction);
+  cardano_transaction_body_unref(&body);
+
+  result = cardano_transaction_body_set_aux_data_hash(body, hash);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_tx_builder_set_last_error(builder, "Failed to set auxiliary data hash.");
+    builder->last_error = result;
+  }
+}
+
+/**
+ * \brief Encodes the auxiliary data of the transaction once and stores the encoding in its place.
+ *
+ * \param[in,out] builder The builder; must not be \c NULL.
+ * \param[in] auxiliary_data The auxiliary data of the transaction.
+ */
+static void
+freeze_auxiliary_data(cardano_tx_builder_t* builder, cardano_auxiliary_data_t* auxiliary_data)
+{
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+
+  if (writer == NULL)
+  {
+    cardano_tx_builder_set_last_error(builder, "Failed to encode auxiliary data.");
+    builder->last_error = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+    return;
+  }
+
+  cardano_buffer_t*       auxiliary_data_cbor = NULL;
+  cardano_blake2b_hash_t* hash                = NULL;
+
+  cardano_error_t result = cardano_auxiliary_data_to_cbor(auxiliary_data, writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_encode_in_buffer(writer, &auxiliary_data_cbor);
+  }
+
+  cardano_cbor_writer_unref(&writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_blake2b_compute_hash(
+      cardano_buffer_get_data(auxiliary_data_cbor),
+      cardano_buffer_get_size(auxiliary_data_cbor),
+      CARDANO_BLAKE2B_HASH_SIZE_256,
+      &hash);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_tx_builder_set_last_error(builder, "Failed to encode auxiliary data.");
+    cardano_buffer_unref(&auxiliary_data_cbor);
+    builder->last_error = result;
+    return;
+  }
+
+  set_auxiliary_data_cbor(builder, auxiliary_data_cbor, hash);
+
+  cardano_buffer_unref(&auxiliary_data_cbor);
+  cardano_blake2b_hash_unref(&hash);
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_tx_builder_t*
@@ -736,7 +1407,7 @@ cardano_tx_builder_new(
   }
 
   builder->base.ref_count     = 1;
-  builder->base.last_error[0] = '\0';
+  builder->base.last_error    = NULL;
   builder->base.deallocator   = cardano_tx_builder_deallocate;
 
   builder->last_error                  = CARDANO_SUCCESS;
@@ -751,10 +1422,14 @@ cardano_tx_builder_new(
   builder->collateral_utxos            = NULL;
   builder->pre_selected_inputs         = NULL;
   builder->reference_inputs            = NULL;
+  builder->pending_inputs              = NULL;
+  builder->pending_input_count         = 0U;
+  builder->pending_input_capacity      = 0U;
   builder->input_to_redeemer_map       = NULL;
   builder->withdrawals_to_redeemer_map = NULL;
   builder->mints_to_redeemer_map       = NULL;
   builder->votes_to_redeemer_map       = NULL;
+  builder->native_script_hashes        = NULL;
 
   cardano_protocol_parameters_ref(params);
   builder->params = params;
@@ -795,7 +1470,20 @@ cardano_tx_builder_new(
   builder->has_plutus_v1              = false;
   builder->has_plutus_v2              = false;
   builder->has_plutus_v3              = false;
-  builder->additional_signature_count = 0U;
+  builder->additional_signature_count    = 0U;
+  builder->native_script_signature_count = 0U;
+  builder->profiling_enabled             = false;
+
+  const cardano_tx_build_profile_t empty_profile = { 0 };
+  builder->profile                               = empty_profile;
+
+  result = cardano_blake2b_hash_set_new(&builder->native_script_hashes);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_tx_builder_unref(&builder);
+    return NULL;
+  }
 
   result = cardano_utxo_list_new(&builder->pre_selected_inputs);
 
@@ -848,6 +1536,127 @@ cardano_tx_builder_new(
   return builder;
 }
 
+cardano_error_t
+cardano_tx_builder_reset(cardano_tx_builder_t* builder)
+{
+  if (builder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_transaction_t*                  transaction     = transaction_new();
+  cardano_blake2b_hash_set_t*             script_hashes   = NULL;
+  cardano_input_to_redeemer_map_t*        input_map       = NULL;
+  cardano_blake2b_hash_to_redeemer_map_t* withdrawals_map = NULL;
+  cardano_blake2b_hash_to_redeemer_map_t* mints_map       = NULL;
+  cardano_blake2b_hash_to_redeemer_map_t* votes_map       = NULL;
+
+  // The sets and maps have no way to be emptied in place, and most transactions never fill them; only the ones
+  // the previous transaction used are replaced
+  cardano_error_t result = (transaction != NULL) ? CARDANO_SUCCESS : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+
+  if ((result == CARDANO_SUCCESS) && (cardano_blake2b_hash_set_get_length(builder->native_script_hashes) > 0U))
+  {
+    result = cardano_blake2b_hash_set_new(&script_hashes);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (cardano_input_to_redeemer_map_get_length(builder->input_to_redeemer_map) > 0U))
+  {
+    result = cardano_input_to_redeemer_map_new(&input_map);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (cardano_blake2b_hash_to_redeemer_map_get_length(builder->withdrawals_to_redeemer_map) > 0U))
+  {
+    result = cardano_blake2b_hash_to_redeemer_map_new(&withdrawals_map);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (cardano_blake2b_hash_to_redeemer_map_get_length(builder->mints_to_redeemer_map) > 0U))
+  {
+    result = cardano_blake2b_hash_to_redeemer_map_new(&mints_map);
+  }
+
+  if ((result == CARDANO_SUCCESS) && (cardano_blake2b_hash_to_redeemer_map_get_length(builder->votes_to_redeemer_map) > 0U))
+  {
+    result = cardano_blake2b_hash_to_redeemer_map_new(&votes_map);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    cardano_transaction_body_t* old_body = cardano_transaction_get_body(builder->transaction);
+    cardano_transaction_body_t* new_body = cardano_transaction_get_body(transaction);
+
+    const cardano_network_id_t* network_id = cardano_transaction_body_get_network_id(old_body);
+
+    if (network_id != NULL)
+    {
+      result = cardano_transaction_body_set_network_id(new_body, network_id);
+    }
+
+    cardano_transaction_body_unref(&new_body);
+    cardano_transaction_body_unref(&old_body);
+  }
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_transaction_unref(&transaction);
+    cardano_blake2b_hash_set_unref(&script_hashes);
+    cardano_input_to_redeemer_map_unref(&input_map);
+    cardano_blake2b_hash_to_redeemer_map_unref(&withdrawals_map);
+    cardano_blake2b_hash_to_redeemer_map_unref(&mints_map);
+    cardano_blake2b_hash_to_redeemer_map_unref(&votes_map);
+
+    return result;
+  }
+
+  cardano_transaction_unref(&builder->transaction);
+  builder->transaction = transaction;
+
+  if (script_hashes != NULL)
+  {
+    cardano_blake2b_hash_set_unref(&builder->native_script_hashes);
+    builder->native_script_hashes = script_hashes;
+  }
+
+  if (input_map != NULL)
+  {
+    cardano_input_to_redeemer_map_unref(&builder->input_to_redeemer_map);
+    builder->input_to_redeemer_map = input_map;
+  }
+
+  if (withdrawals_map != NULL)
+  {
+    cardano_blake2b_hash_to_redeemer_map_unref(&builder->withdrawals_to_redeemer_map);
+    builder->withdrawals_to_redeemer_map = withdrawals_map;
+  }
+
+  if (mints_map != NULL)
+  {
+    cardano_blake2b_hash_to_redeemer_map_unref(&builder->mints_to_redeemer_map);
+    builder->mints_to_redeemer_map = mints_map;
+  }
+
+  if (votes_map != NULL)
+  {
+    cardano_blake2b_hash_to_redeemer_map_unref(&builder->votes_to_redeemer_map);
+    builder->votes_to_redeemer_map = votes_map;
+  }
+
+  cardano_utxo_list_clear(builder->pre_selected_inputs);
+  cardano_utxo_list_clear(builder->reference_inputs);
+  clear_pending_inputs(builder);
+
+  builder->has_plutus_v1                 = false;
+  builder->has_plutus_v2                 = false;
+  builder->has_plutus_v3                 = false;
+  builder->additional_signature_count    = 0U;
+  builder->native_script_signature_count = 0U;
+  builder->last_error                    = CARDANO_SUCCESS;
+
+  cardano_tx_builder_set_last_error(builder, "");
+
+  return CARDANO_SUCCESS;
+}
+
 void
 cardano_tx_builder_set_coin_selector(
   cardano_tx_builder_t*    builder,
@@ -1345,6 +2154,14 @@ cardano_tx_builder_add_reference_input(
   }
 }
 
+void
+cardano_tx_builder_add_unresolved_reference_input(
+  cardano_tx_builder_t*        builder,
+  cardano_transaction_input_t* input)
+{
+  add_pending_input(builder, input, NULL, NULL, true);
+}
+
 void
 cardano_tx_builder_send_lovelace(
   cardano_tx_builder_t* builder,
@@ -1878,6 +2695,16 @@ cardano_tx_builder_add_input(
   }
 }
 
+void
+cardano_tx_builder_add_unresolved_input(
+  cardano_tx_builder_t*        builder,
+  cardano_transaction_input_t* input,
+  cardano_plutus_data_t*       redeemer,
+  cardano_plutus_data_t*       datum)
+{
+  add_pending_input(builder, input, redeemer, datum, false);
+}
+
 void
 cardano_tx_builder_add_output(
   cardano_tx_builder_t*         builder,
@@ -1952,6 +2779,10 @@ cardano_tx_builder_set_metadata(
 
   cardano_auxiliary_data_unref(&auxiliary_data);
 
+  // The auxiliary data may have been decoded from the encoding stored by an earlier call; that encoding is
+  // about to go stale.
+  cardano_auxiliary_data_clear_cbor_cache(auxiliary_data);
+
   cardano_transaction_metadata_t* tx_metadata = cardano_auxiliary_data_get_transaction_metadata(auxiliary_data);
 
   if (tx_metadata == NULL)
@@ -1988,19 +2819,42 @@ cardano_tx_builder_set_metadata(
     return;
   }
 
-  cardano_transaction_body_t* body = cardano_transaction_get_body(builder->transaction);
-  cardano_transaction_body_unref(&body);
+  freeze_auxiliary_data(builder, auxiliary_data);
+}
 
-  cardano_blake2b_hash_t* hash = cardano_auxiliary_data_get_hash(auxiliary_data);
+void
+cardano_tx_builder_set_metadata_from_encoder(
+  cardano_tx_builder_t*       builder,
+  cardano_metadata_encoder_t* encoder)
+{
+  if ((builder == NULL) || (builder->last_error != CARDANO_SUCCESS))
+  {
+    return;
+  }
 
-  result = cardano_transaction_body_set_aux_data_hash(body, hash);
-  cardano_blake2b_hash_unref(&hash);
+  if (encoder == NULL)
+  {
+    cardano_tx_builder_set_last_error(builder, "Metadata encoder is NULL.");
+    builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
+    return;
+  }
+
+  cardano_buffer_t*       auxiliary_data_cbor = NULL;
+  cardano_blake2b_hash_t* hash                = NULL;
+
+  cardano_error_t result = cardano_metadata_encoder_finish(encoder, &auxiliary_data_cbor, &hash);
 
   if (result != CARDANO_SUCCESS)
   {
-    cardano_tx_builder_set_last_error(builder, "Failed to set auxiliary data hash.");
+    cardano_tx_builder_set_last_error(builder, cardano_metadata_encoder_get_last_error(encoder));
     builder->last_error = result;
+    return;
   }
+
+  set_auxiliary_data_cbor(builder, auxiliary_data_cbor, hash);
+
+  cardano_buffer_unref(&auxiliary_data_cbor);
+  cardano_blake2b_hash_unref(&hash);
 }
 
 void
@@ -3286,60 +4140,69 @@ cardano_tx_builder_vote(
   cardano_transaction_body_t* body = cardano_transaction_get_body(builder->transaction);
   cardano_transaction_body_unref(&body);
 
-  cardano_voting_procedures_t* votes = cardano_transaction_body_get_voting_procedures(body);
+  cardano_voting_procedures_t* votes = get_voting_procedures(builder, body);
 
   if (votes == NULL)
   {
-    cardano_error_t result = cardano_voting_procedures_new(&votes);
+    return;
+  }
 
-    if (result != CARDANO_SUCCESS)
-    {
-      cardano_tx_builder_set_last_error(builder, "Failed to create voting procedures.");
-      builder->last_error = result;
-      return;
-    }
+  // Failures are recorded in the builder and reported by cardano_tx_builder_build
+  const cardano_error_t result = add_vote(builder, votes, voter, action_id, vote, redeemer);
 
-    result = cardano_transaction_body_set_voting_procedures(body, votes);
+  CARDANO_UNUSED(result);
+}
 
-    if (result != CARDANO_SUCCESS)
+void
+cardano_tx_builder_vote_batch(
+  cardano_tx_builder_t*            builder,
+  const cardano_tx_builder_vote_t* votes,
+  const size_t                     count)
+{
+  if ((builder == NULL) || (builder->last_error != CARDANO_SUCCESS))
+  {
+    return;
+  }
+
+  if ((votes == NULL) && (count > 0U))
+  {
+    cardano_tx_builder_set_last_error(builder, "Votes are NULL.");
+    builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
+    return;
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    if ((votes[i].voter == NULL) || (votes[i].action_id == NULL) || (votes[i].vote == NULL))
     {
-      cardano_tx_builder_set_last_error(builder, "Failed to set voting procedures.");
-      cardano_voting_procedures_unref(&votes);
-      builder->last_error = result;
+      cardano_tx_builder_set_last_error(builder, "A vote of the batch lacks its voter, action ID or vote.");
+      builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
       return;
     }
   }
 
-  cardano_voting_procedures_unref(&votes);
+  cardano_transaction_body_t* body = cardano_transaction_get_body(builder->transaction);
+  cardano_transaction_body_unref(&body);
 
-  cardano_error_t result = cardano_voting_procedures_insert(votes, voter, action_id, vote);
+  cardano_voting_procedures_t* voting_procedures = get_voting_procedures(builder, body);
 
-  if (result != CARDANO_SUCCESS)
+  if (voting_procedures == NULL)
   {
-    cardano_tx_builder_set_last_error(builder, "Failed to insert vote.");
-    builder->last_error = result;
     return;
   }
 
-  if (redeemer != NULL)
+  for (size_t i = 0U; i < count; ++i)
   {
-    cardano_witness_set_t* witnesses = cardano_transaction_get_witness_set(builder->transaction);
-    cardano_witness_set_unref(&witnesses);
-
-    cardano_credential_t* credential = cardano_voter_get_credential(voter);
-    cardano_credential_unref(&credential);
-
-    cardano_blake2b_hash_t* hash = cardano_credential_get_hash(credential);
-
-    result = add_redeemer(witnesses, hash, redeemer, CARDANO_REDEEMER_TAG_VOTING, builder);
-    cardano_blake2b_hash_unref(&hash);
+    const cardano_tx_builder_vote_t* entry = &votes[i];
 
-    if (result != CARDANO_SUCCESS)
+    if (add_vote(builder, voting_procedures, entry->voter, entry->action_id, entry->vote, entry->redeemer) != CARDANO_SUCCESS)
     {
-      cardano_tx_builder_set_last_error(builder, "Failed to add redeemer.");
-      builder->last_error = result;
+      return;
     }
   }
+
+  // Sorted once for the whole batch, so the body encodes canonical maps without sorting on every insertion
+  cardano_voting_procedures_sort(voting_procedures);
 }
 
 void
@@ -3544,6 +4407,95 @@ cardano_tx_builder_add_script(
   }
 }
 
+void
+cardano_tx_builder_add_compiled_native_script(
+  cardano_tx_builder_t*             builder,
+  cardano_compiled_native_script_t* compiled_native_script)
+{
+  if ((builder == NULL) || (builder->last_error != CARDANO_SUCCESS))
+  {
+    return;
+  }
+
+  if (compiled_native_script == NULL)
+  {
+    cardano_tx_builder_set_last_error(builder, "Compiled native script is NULL.");
+    builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
+
+    return;
+  }
+
+  cardano_blake2b_hash_t* hash = cardano_compiled_native_script_get_hash(compiled_native_script);
+
+  const size_t known_count = cardano_blake2b_hash_set_get_length(builder->native_script_hashes);
+
+  for (size_t i = 0U; i < known_count; ++i)
+  {
+    cardano_blake2b_hash_t* known = NULL;
+
+    if (cardano_blake2b_hash_set_get(builder->native_script_hashes, i, &known) != CARDANO_SUCCESS)
+    {
+      continue;
+    }
+
+    const bool is_known = cardano_blake2b_hash_equals(known, hash);
+    cardano_blake2b_hash_unref(&known);
+
+    if (is_known)
+    {
+      cardano_blake2b_hash_unref(&hash);
+      return;
+    }
+  }
+
+  cardano_native_script_t* native_script = cardano_compiled_native_script_get_script(compiled_native_script);
+  cardano_script_t*        script        = NULL;
+
+  cardano_error_t result = cardano_script_new_native(native_script, &script);
+  cardano_native_script_unref(&native_script);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_blake2b_hash_unref(&hash);
+    cardano_tx_builder_set_last_error(builder, "Failed to create script from compiled native script.");
+    builder->last_error = result;
+
+    return;
+  }
+
+  cardano_tx_builder_add_script(builder, script);
+  cardano_script_unref(&script);
+
+  if (builder->last_error != CARDANO_SUCCESS)
+  {
+    cardano_blake2b_hash_unref(&hash);
+    return;
+  }
+
+  result = cardano_blake2b_hash_set_add(builder->native_script_hashes, hash);
+  cardano_blake2b_hash_unref(&hash);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    cardano_tx_builder_set_last_error(builder, "Failed to record compiled native script.");
+    builder->last_error = result;
+
+    return;
+  }
+
+  const size_t signer_count = cardano_compiled_native_script_get_min_signer_count(compiled_native_script);
+
+  if (signer_count == SIZE_MAX)
+  {
+    cardano_tx_builder_set_last_error(builder, "Compiled native script can never be satisfied.");
+    builder->last_error = CARDANO_ERROR_INVALID_ARGUMENT;
+
+    return;
+  }
+
+  builder->native_script_signature_count += signer_count;
+}
+
 void
 cardano_tx_builder_propose_parameter_change(
   cardano_tx_builder_t*            builder,
@@ -4601,6 +5553,7 @@ cardano_tx_builder_propose_info_ex(
   cardano_reward_address_unref(&addr);
 }
 
+
 cardano_error_t
 cardano_tx_builder_build(
   cardano_tx_builder_t*   builder,
@@ -4611,104 +5564,25 @@ cardano_tx_builder_build(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  if (transaction == NULL)
-  {
-    return CARDANO_ERROR_POINTER_IS_NULL;
-  }
-
-  if (builder->last_error != CARDANO_SUCCESS)
-  {
-    return builder->last_error;
-  }
-
-  if (builder->change_address == NULL)
-  {
-    builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
-    cardano_tx_builder_set_last_error(
-      builder,
-      "You must set a change address before calling `build`.");
-
-    return builder->last_error;
-  }
-
-  if (builder->available_utxos == NULL)
-  {
-    builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
-    cardano_tx_builder_set_last_error(
-      builder,
-      "You must set the available UTXOs for input selection before calling `build`.");
-
-    return builder->last_error;
-  }
-
-  if (cardano_transaction_has_script_data(builder->transaction))
-  {
-    if (builder->collateral_address == NULL)
-    {
-      builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
-      cardano_tx_builder_set_last_error(
-        builder,
-        "This transaction interacts with plutus validators. You must set a collateral change address before calling `build`.");
-
-      return builder->last_error;
-    }
-
-    if (builder->collateral_utxos == NULL)
-    {
-      builder->last_error = CARDANO_ERROR_POINTER_IS_NULL;
-      cardano_tx_builder_set_last_error(
-        builder,
-        "This transaction interacts with plutus validators. You must set the collateral UTXOs before calling `build`.");
-
-      return builder->last_error;
-    }
-  }
-
-  cardano_transaction_t* tx = builder->transaction;
-
-  cardano_error_t result = set_dummy_script_data_hash(tx);
-
-  if (result != CARDANO_SUCCESS)
+  if (!builder->profiling_enabled)
   {
-    builder->last_error = result;
-    return result;
+    return build_transaction(builder, transaction);
   }
 
-  result = cardano_balance_transaction(
-    tx,
-    builder->additional_signature_count,
-    builder->params,
-    builder->reference_inputs,
-    builder->pre_selected_inputs,
-    builder->input_to_redeemer_map,
-    builder->available_utxos,
-    builder->coin_selector,
-    builder->change_address,
-    builder->collateral_utxos,
-    builder->collateral_address,
-    builder->tx_evaluator);
-
-  if (result != CARDANO_SUCCESS)
-  {
-    builder->last_error = result;
-    return result;
-  }
+  const cardano_tx_build_profile_t empty_profile = { 0 };
+  cardano_tx_build_profile_t*      previous      = NULL;
 
-  result = update_script_data_hash(builder, tx);
+  builder->profile = empty_profile;
 
-  if (result != CARDANO_SUCCESS)
-  {
-    builder->last_error = result;
-    return result;
-  }
+  const uint64_t start = _cardano_build_profile_now();
 
-  cardano_transaction_ref(tx);
-  *transaction = tx;
+  _cardano_build_profile_begin(&builder->profile, &previous);
+  const cardano_error_t result = build_transaction(builder, transaction);
+  _cardano_build_profile_end(previous);
 
-  // Build method can only be called once
-  builder->last_error = CARDANO_ERROR_ILLEGAL_STATE;
+  builder->profile.total_ns = _cardano_build_profile_now() - start;
 
-  return CARDANO_SUCCESS;
+  return result;
 }
 
 void
@@ -4761,4 +5635,33 @@ const char*
 cardano_tx_builder_get_last_error(const cardano_tx_builder_t* tx_builder)
 {
   return cardano_object_get_last_error(&tx_builder->base);
-}
\ No newline at end of file
+}
+
+void
+cardano_tx_builder_set_profiling_enabled(cardano_tx_builder_t* builder, const bool enabled)
+{
+  if (builder == NULL)
+  {
+    return;
+  }
+
+  builder->profiling_enabled = enabled;
+}
+
+cardano_error_t
+cardano_tx_builder_get_build_profile(const cardano_tx_builder_t* builder, cardano_tx_build_profile_t* profile)
+{
+  if (builder == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (profile == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *profile = builder->profile;
+
+  return CARDANO_SUCCESS;
+}
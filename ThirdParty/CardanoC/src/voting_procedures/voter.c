@@ -99,7 +99,7 @@ cardano_voter_new(const cardano_voter_type_t type, cardano_credential_t* credent
 
   (*voter)->base.deallocator   = cardano_voter_deallocate;
   (*voter)->base.ref_count     = 1;
-  (*voter)->base.last_error[0] = '\0';
+  (*voter)->base.last_error    = NULL;
   (*voter)->type               = type;
 
   cardano_credential_ref(credential);
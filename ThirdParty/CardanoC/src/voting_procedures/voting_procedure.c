@@ -98,7 +98,7 @@ cardano_voting_procedure_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_voting_procedure_deallocate;
 
   if (anchor != NULL)
@@ -90,7 +90,7 @@ cardano_voting_procedure_list_new(cardano_voting_procedure_list_t** voting_proce
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_voting_procedure_list_deallocate;
 
   list->array = cardano_array_new(128);
@@ -22,6 +22,7 @@
 /* INCLUDES ******************************************************************/
 
 #include <cardano/common/governance_action_id.h>
+#include <cardano/crypto/blake2b_hash_size.h>
 #include <cardano/object.h>
 #include <cardano/voting_procedures/governance_action_id_list.h>
 #include <cardano/voting_procedures/voting_procedure.h>
@@ -29,6 +30,7 @@
 
 #include "../allocators.h"
 #include "../collections/array.h"
+#include "../collections/set.h"
 #include "voting_procedure_map.h"
 
 #include <assert.h>
@@ -43,6 +45,7 @@ typedef struct cardano_voting_procedure_map_t
 {
     cardano_object_t base;
     cardano_array_t* array;
+    cardano_set_t*   index;
 } cardano_voting_procedure_map_t;
 
 /**
@@ -82,6 +85,11 @@ cardano_voting_procedure_map_deallocate(void* object)
     cardano_array_unref(&map->array);
   }
 
+  if (map->index != NULL)
+  {
+    cardano_set_unref(&map->index);
+  }
+
   _cardano_free(map);
 }
 
@@ -118,6 +126,105 @@ cardano_voting_procedure_map_kvp_deallocate(void* object)
   _cardano_free(map);
 }
 
+/**
+ * \brief Hashes a key value pair of the map index by its governance action id.
+ *
+ * \param[in] object The \ref cardano_voting_procedure_map_kvp_t to hash.
+ *
+ * \return The hash of the transaction hash and index of its key.
+ */
+static uint64_t
+hash_kvp_key(const cardano_object_t* object)
+{
+  const cardano_voting_procedure_map_kvp_t* kvp = (const cardano_voting_procedure_map_kvp_t*)((const void*)object);
+
+  uint64_t              index  = 0U;
+  const cardano_error_t result = cardano_governance_action_id_get_index(kvp->key, &index);
+
+  CARDANO_UNUSED(result);
+
+  const uint64_t hash = cardano_set_hash_bytes(
+    CARDANO_SET_HASH_SEED,
+    cardano_governance_action_id_get_hash_bytes(kvp->key),
+    cardano_governance_action_id_get_hash_bytes_size(kvp->key));
+
+  return cardano_set_hash_bytes(hash, (const byte_t*)&index, sizeof(index));
+}
+
+/**
+ * \brief Compares two key value pairs of the map index by their governance action ids.
+ *
+ * \param[in] lhs The first \ref cardano_voting_procedure_map_kvp_t.
+ * \param[in] rhs The second \ref cardano_voting_procedure_map_kvp_t.
+ *
+ * \return 0 if both keys are the same governance action, non-zero otherwise.
+ */
+static int
+compare_kvp_keys(const cardano_object_t* lhs, const cardano_object_t* rhs)
+{
+  const cardano_voting_procedure_map_kvp_t* lhs_kvp = (const cardano_voting_procedure_map_kvp_t*)((const void*)lhs);
+  const cardano_voting_procedure_map_kvp_t* rhs_kvp = (const cardano_voting_procedure_map_kvp_t*)((const void*)rhs);
+
+  return cardano_governance_action_id_equals(lhs_kvp->key, rhs_kvp->key) ? 0 : 1;
+}
+
+/**
+ * \brief Finds the entry of a governance action id in the map index.
+ *
+ * \param[in] map The map to search.
+ * \param[in] key The governance action id to look for.
+ *
+ * \return A new reference to the key value pair holding `key`, or NULL if the map has none.
+ */
+static cardano_voting_procedure_map_kvp_t*
+find_kvp(const cardano_voting_procedure_map_t* map, cardano_governance_action_id_t* key)
+{
+  cardano_voting_procedure_map_kvp_t probe = { 0 };
+
+  probe.key = key;
+
+  return (cardano_voting_procedure_map_kvp_t*)((void*)cardano_set_get(map->index, (const cardano_object_t*)((const void*)&probe)));
+}
+
+/**
+ * \brief Orders two key value pairs of the map by their governance action ids.
+ *
+ * \param[in] lhs The first \ref cardano_voting_procedure_map_kvp_t.
+ * \param[in] rhs The second \ref cardano_voting_procedure_map_kvp_t.
+ * \param[in] context Unused.
+ *
+ * \return A negative value, zero or a positive value if the key of `lhs` orders before, with or after the one of `rhs`.
+ */
+static int
+order_kvp_keys(const cardano_object_t* lhs, const cardano_object_t* rhs, void* context)
+{
+  CARDANO_UNUSED(context);
+
+  const cardano_voting_procedure_map_kvp_t* lhs_kvp = (const cardano_voting_procedure_map_kvp_t*)((const void*)lhs);
+  const cardano_voting_procedure_map_kvp_t* rhs_kvp = (const cardano_voting_procedure_map_kvp_t*)((const void*)rhs);
+
+  const int hash_order = memcmp(
+    cardano_governance_action_id_get_hash_bytes(lhs_kvp->key),
+    cardano_governance_action_id_get_hash_bytes(rhs_kvp->key),
+    CARDANO_BLAKE2B_HASH_SIZE_256);
+
+  if (hash_order != 0)
+  {
+    return hash_order;
+  }
+
+  uint64_t lhs_index = 0U;
+  uint64_t rhs_index = 0U;
+
+  const cardano_error_t lhs_result = cardano_governance_action_id_get_index(lhs_kvp->key, &lhs_index);
+  const cardano_error_t rhs_result = cardano_governance_action_id_get_index(rhs_kvp->key, &rhs_index);
+
+  CARDANO_UNUSED(lhs_result);
+  CARDANO_UNUSED(rhs_result);
+
+  return (lhs_index > rhs_index) - (lhs_index < rhs_index);
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -136,7 +243,7 @@ cardano_voting_procedure_map_new(cardano_voting_procedure_map_t** voting_procedu
   }
 
   map->base.ref_count     = 1;
-  map->base.last_error[0] = '\0';
+  map->base.last_error    = NULL;
   map->base.deallocator   = cardano_voting_procedure_map_deallocate;
 
   map->array = cardano_array_new(128);
@@ -147,6 +254,15 @@ cardano_voting_procedure_map_new(cardano_voting_procedure_map_t** voting_procedu
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
+  map->index = cardano_set_new(compare_kvp_keys, hash_kvp_key);
+
+  if (map->index == NULL)
+  {
+    cardano_array_unref(&map->array);
+    _cardano_free(map);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
   *voting_procedure_map = map;
 
   return CARDANO_SUCCESS;
@@ -184,24 +300,19 @@ cardano_voting_procedure_map_get(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  for (size_t i = 0; i < cardano_array_get_size(voting_procedure_map->array); ++i)
-  {
-    cardano_object_t*                   object = cardano_array_get(voting_procedure_map->array, i);
-    cardano_voting_procedure_map_kvp_t* kvp    = (cardano_voting_procedure_map_kvp_t*)((void*)object);
+  cardano_voting_procedure_map_kvp_t* kvp = find_kvp(voting_procedure_map, key);
 
-    if (cardano_governance_action_id_equals(kvp->key, key))
-    {
-      cardano_voting_procedure_ref(kvp->value);
-      *element = kvp->value;
+  if (kvp == NULL)
+  {
+    return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  }
 
-      cardano_object_unref(&object);
-      return CARDANO_SUCCESS;
-    }
+  cardano_voting_procedure_ref(kvp->value);
+  *element = kvp->value;
 
-    cardano_object_unref(&object);
-  }
+  cardano_object_unref((cardano_object_t**)((void*)&kvp));
 
-  return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  return CARDANO_SUCCESS;
 }
 
 cardano_error_t
@@ -225,6 +336,20 @@ cardano_voting_procedure_map_insert(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  // A governance action is voted on once per voter, so a repeated key replaces its vote
+  cardano_voting_procedure_map_kvp_t* existing = find_kvp(voting_procedure_map, key);
+
+  if (existing != NULL)
+  {
+    cardano_voting_procedure_ref(value);
+    cardano_voting_procedure_unref(&existing->value);
+    existing->value = value;
+
+    cardano_object_unref((cardano_object_t**)((void*)&existing));
+
+    return CARDANO_SUCCESS;
+  }
+
   cardano_voting_procedure_map_kvp_t* kvp = _cardano_malloc(sizeof(cardano_voting_procedure_map_kvp_t));
 
   if (kvp == NULL)
@@ -233,7 +358,7 @@ cardano_voting_procedure_map_insert(
   }
 
   kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
+  kvp->base.last_error    = NULL;
   kvp->base.deallocator   = cardano_voting_procedure_map_kvp_deallocate;
   kvp->key                = key;
   kvp->value              = value;
@@ -244,10 +369,20 @@ cardano_voting_procedure_map_insert(
   const size_t old_size = cardano_array_get_size(voting_procedure_map->array);
   const size_t new_size = cardano_array_push(voting_procedure_map->array, (cardano_object_t*)((void*)kvp));
 
-  assert((old_size + 1U) == new_size);
+  if (new_size != (old_size + 1U))
+  {
+    cardano_voting_procedure_map_kvp_deallocate(kvp);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  if (cardano_set_add(voting_procedure_map->index, (cardano_object_t*)((void*)kvp)) != cardano_array_get_size(voting_procedure_map->array))
+  {
+    cardano_object_t* last = cardano_array_pop(voting_procedure_map->array);
+
+    cardano_object_unref(&last);
 
-  CARDANO_UNUSED(old_size);
-  CARDANO_UNUSED(new_size);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
 
   return CARDANO_SUCCESS;
 }
@@ -344,6 +479,49 @@ cardano_voting_procedure_map_get_values(
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_voting_procedure_map_to_cbor(const cardano_voting_procedure_map_t* voting_procedure_map, cardano_cbor_writer_t* writer)
+{
+  if (voting_procedure_map == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  const size_t size = cardano_array_get_size(voting_procedure_map->array);
+
+  cardano_error_t result = cardano_cbor_writer_write_start_map(writer, (int64_t)size);
+
+  for (size_t i = 0U; (i < size) && (result == CARDANO_SUCCESS); ++i)
+  {
+    const cardano_voting_procedure_map_kvp_t* kvp = (const cardano_voting_procedure_map_kvp_t*)((const void*)cardano_array_peek(voting_procedure_map->array, i));
+
+    result = cardano_governance_action_id_to_cbor(kvp->key, writer);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_voting_procedure_to_cbor(kvp->value, writer);
+    }
+  }
+
+  return result;
+}
+
+void
+cardano_voting_procedure_map_sort(cardano_voting_procedure_map_t* voting_procedure_map)
+{
+  if (voting_procedure_map == NULL)
+  {
+    return;
+  }
+
+  cardano_array_sort(voting_procedure_map->array, order_kvp_keys, NULL);
+}
+
 void
 cardano_voting_procedure_map_unref(cardano_voting_procedure_map_t** voting_procedure_map)
 {
@@ -24,6 +24,7 @@
 
 /* INCLUDES ******************************************************************/
 
+#include <cardano/cbor/cbor_writer.h>
 #include <cardano/common/governance_action_id.h>
 #include <cardano/error.h>
 #include <cardano/export.h>
@@ -153,6 +154,7 @@ CARDANO_EXPORT cardano_error_t cardano_voting_procedure_map_get(cardano_voting_p
  * \brief Inserts a key-value pair into the voting procedure map.
  *
  * This function inserts the specified key-value pair into the provided voting procedure map.
+ * If the map already holds the key, its value is replaced, so each governance action appears once.
  *
  * \param[in] voting_procedure_map A constant pointer to the \ref cardano_voting_procedure_map_t object where
  *                       the key-value pair is to be inserted.
@@ -280,6 +282,26 @@ CARDANO_EXPORT cardano_error_t cardano_voting_procedure_map_get_keys(cardano_vot
 CARDANO_NODISCARD
 CARDANO_EXPORT cardano_error_t cardano_voting_procedure_map_get_values(cardano_voting_procedure_map_t* voting_procedure_map, cardano_voting_procedure_list_t** values);
 
+/**
+ * \brief Writes the votes of the map to a CBOR writer, as the entries of a map in the order they are held.
+ *
+ * \param[in] voting_procedure_map The map to encode.
+ * \param[in] writer The writer the map header and its entries are written to.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of the first write that failed.
+ */
+CARDANO_NODISCARD
+CARDANO_EXPORT cardano_error_t cardano_voting_procedure_map_to_cbor(const cardano_voting_procedure_map_t* voting_procedure_map, cardano_cbor_writer_t* writer);
+
+/**
+ * \brief Sorts the entries of the map by governance action id, transaction hash first and then index.
+ *
+ * This is the order of their encoded keys under the core deterministic encoding of RFC 8949, section 4.2.1.
+ *
+ * \param[in,out] voting_procedure_map The map to sort.
+ */
+CARDANO_EXPORT void cardano_voting_procedure_map_sort(cardano_voting_procedure_map_t* voting_procedure_map);
+
 /**
  * \brief Decrements the reference count of a voting_procedure_map object.
  *
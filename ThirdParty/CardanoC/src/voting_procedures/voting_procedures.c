@@ -30,6 +30,7 @@
 
 #include "../allocators.h"
 #include "../collections/array.h"
+#include "../collections/set.h"
 #include "voting_procedure_map.h"
 
 #include <assert.h>
@@ -58,6 +59,7 @@ typedef struct cardano_voting_procedures_t
 {
     cardano_object_t base;
     cardano_array_t* array;
+    cardano_set_t*   index;
 } cardano_voting_procedures_t;
 
 /* STATIC FUNCTIONS **********************************************************/
@@ -87,6 +89,11 @@ cardano_voting_procedures_deallocate(void* object)
     cardano_array_unref(&map->array);
   }
 
+  if (map->index != NULL)
+  {
+    cardano_set_unref(&map->index);
+  }
+
   _cardano_free(map);
 }
 
@@ -123,6 +130,124 @@ cardano_voting_procedure_kvp_deallocate(void* object)
   _cardano_free(map);
 }
 
+/**
+ * \brief Hashes a key value pair of the voter index by its voter.
+ *
+ * \param[in] object The \ref cardano_voting_procedure_kvp_t to hash.
+ *
+ * \return The hash of the type and credential hash of its voter.
+ */
+static uint64_t
+hash_kvp_voter(const cardano_object_t* object)
+{
+  const cardano_voting_procedure_kvp_t* kvp = (const cardano_voting_procedure_kvp_t*)((const void*)object);
+
+  cardano_voter_type_t  type   = CARDANO_VOTER_TYPE_CONSTITUTIONAL_COMMITTEE_KEY_HASH;
+  const cardano_error_t result = cardano_voter_get_type(kvp->key, &type);
+
+  CARDANO_UNUSED(result);
+
+  const uint32_t        type_value = (uint32_t)type;
+  cardano_credential_t* credential = cardano_voter_get_credential(kvp->key);
+
+  const uint64_t hash = cardano_set_hash_bytes(
+    cardano_set_hash_bytes(CARDANO_SET_HASH_SEED, (const byte_t*)&type_value, sizeof(type_value)),
+    cardano_credential_get_hash_bytes(credential),
+    cardano_credential_get_hash_bytes_size(credential));
+
+  cardano_credential_unref(&credential);
+
+  return hash;
+}
+
+/**
+ * \brief Compares two key value pairs of the voter index by their voters.
+ *
+ * \param[in] lhs The first \ref cardano_voting_procedure_kvp_t.
+ * \param[in] rhs The second \ref cardano_voting_procedure_kvp_t.
+ *
+ * \return 0 if both keys are the same voter, non-zero otherwise.
+ */
+static int
+compare_kvp_voters(const cardano_object_t* lhs, const cardano_object_t* rhs)
+{
+  const cardano_voting_procedure_kvp_t* lhs_kvp = (const cardano_voting_procedure_kvp_t*)((const void*)lhs);
+  const cardano_voting_procedure_kvp_t* rhs_kvp = (const cardano_voting_procedure_kvp_t*)((const void*)rhs);
+
+  return cardano_voter_equals(lhs_kvp->key, rhs_kvp->key) ? 0 : 1;
+}
+
+/**
+ * \brief Finds the votes of a voter in the voter index.
+ *
+ * \param[in] voting_procedures The voting procedures to search.
+ * \param[in] voter The voter to look for.
+ *
+ * \return A new reference to the key value pair holding the votes of `voter`, or NULL if it cast none.
+ */
+static cardano_voting_procedure_kvp_t*
+find_voter_kvp(const cardano_voting_procedures_t* voting_procedures, cardano_voter_t* voter)
+{
+  cardano_voting_procedure_kvp_t probe = { 0 };
+
+  probe.key = voter;
+
+  return (cardano_voting_procedure_kvp_t*)((void*)cardano_set_get(voting_procedures->index, (const cardano_object_t*)((const void*)&probe)));
+}
+
+/**
+ * \brief Orders two key value pairs of the voting procedures by their voters, type first and then credential hash.
+ *
+ * \param[in] lhs The first \ref cardano_voting_procedure_kvp_t.
+ * \param[in] rhs The second \ref cardano_voting_procedure_kvp_t.
+ * \param[in] context Unused.
+ *
+ * \return A negative value, zero or a positive value if the voter of `lhs` orders before, with or after the one of `rhs`.
+ */
+static int
+order_kvp_voters(const cardano_object_t* lhs, const cardano_object_t* rhs, void* context)
+{
+  CARDANO_UNUSED(context);
+
+  const cardano_voting_procedure_kvp_t* lhs_kvp = (const cardano_voting_procedure_kvp_t*)((const void*)lhs);
+  const cardano_voting_procedure_kvp_t* rhs_kvp = (const cardano_voting_procedure_kvp_t*)((const void*)rhs);
+
+  cardano_voter_type_t lhs_type = CARDANO_VOTER_TYPE_CONSTITUTIONAL_COMMITTEE_KEY_HASH;
+  cardano_voter_type_t rhs_type = CARDANO_VOTER_TYPE_CONSTITUTIONAL_COMMITTEE_KEY_HASH;
+
+  const cardano_error_t lhs_result = cardano_voter_get_type(lhs_kvp->key, &lhs_type);
+  const cardano_error_t rhs_result = cardano_voter_get_type(rhs_kvp->key, &rhs_type);
+
+  CARDANO_UNUSED(lhs_result);
+  CARDANO_UNUSED(rhs_result);
+
+  if (lhs_type != rhs_type)
+  {
+    return (lhs_type < rhs_type) ? -1 : 1;
+  }
+
+  cardano_credential_t* lhs_credential = cardano_voter_get_credential(lhs_kvp->key);
+  cardano_credential_t* rhs_credential = cardano_voter_get_credential(rhs_kvp->key);
+
+  const size_t lhs_size = cardano_credential_get_hash_bytes_size(lhs_credential);
+  const size_t rhs_size = cardano_credential_get_hash_bytes_size(rhs_credential);
+
+  int order = memcmp(
+    cardano_credential_get_hash_bytes(lhs_credential),
+    cardano_credential_get_hash_bytes(rhs_credential),
+    (lhs_size < rhs_size) ? lhs_size : rhs_size);
+
+  if (order == 0)
+  {
+    order = (lhs_size > rhs_size) - (lhs_size < rhs_size);
+  }
+
+  cardano_credential_unref(&lhs_credential);
+  cardano_credential_unref(&rhs_credential);
+
+  return order;
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -141,7 +266,7 @@ cardano_voting_procedures_new(cardano_voting_procedures_t** voting_procedures)
   }
 
   map->base.ref_count     = 1;
-  map->base.last_error[0] = '\0';
+  map->base.last_error    = NULL;
   map->base.deallocator   = cardano_voting_procedures_deallocate;
 
   map->array = cardano_array_new(128);
@@ -152,6 +277,15 @@ cardano_voting_procedures_new(cardano_voting_procedures_t** voting_procedures)
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
+  map->index = cardano_set_new(compare_kvp_voters, hash_kvp_voter);
+
+  if (map->index == NULL)
+  {
+    cardano_array_unref(&map->array);
+    _cardano_free(map);
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
   *voting_procedures = map;
 
   return CARDANO_SUCCESS;
@@ -342,101 +476,21 @@ cardano_voting_procedures_to_cbor(
 
   for (size_t i = 0U; i < size; ++i)
   {
-    cardano_voting_procedure_kvp_t* kvp = (cardano_voting_procedure_kvp_t*)((void*)cardano_array_get(voting_procedures->array, i));
-
-    if (kvp == NULL)
-    {
-      return CARDANO_ERROR_ELEMENT_NOT_FOUND;
-    }
+    const cardano_voting_procedure_kvp_t* kvp = (const cardano_voting_procedure_kvp_t*)((const void*)cardano_array_peek(voting_procedures->array, i));
 
     cardano_error_t write_voter_result = cardano_voter_to_cbor(kvp->key, writer);
 
     if (write_voter_result != CARDANO_SUCCESS)
     {
-      cardano_object_unref((cardano_object_t**)((void*)&kvp));
-
       return write_voter_result;
     }
 
-    size_t votes_size = cardano_voting_procedure_map_get_length(kvp->value);
+    cardano_error_t write_votes_result = cardano_voting_procedure_map_to_cbor(kvp->value, writer);
 
-    cardano_error_t write_votes_map_result = cardano_cbor_writer_write_start_map(writer, (int64_t)votes_size);
-
-    if (write_votes_map_result != CARDANO_SUCCESS)
+    if (write_votes_result != CARDANO_SUCCESS)
     {
-      cardano_object_unref((cardano_object_t**)((void*)&kvp));
-
-      return write_votes_map_result;
+      return write_votes_result;
     }
-
-    cardano_governance_action_id_list_t* action_ids = NULL;
-
-    cardano_error_t get_keys_result = cardano_voting_procedure_map_get_keys(kvp->value, &action_ids);
-
-    if (get_keys_result != CARDANO_SUCCESS)
-    {
-      cardano_object_unref((cardano_object_t**)((void*)&kvp));
-
-      return get_keys_result;
-    }
-
-    size_t action_ids_size = cardano_governance_action_id_list_get_length(action_ids);
-
-    for (size_t j = 0U; j < action_ids_size; ++j)
-    {
-      cardano_governance_action_id_t* action_id = NULL;
-
-      cardano_error_t get_action_id_result = cardano_governance_action_id_list_get(action_ids, j, &action_id);
-
-      if (get_action_id_result != CARDANO_SUCCESS)
-      {
-        cardano_governance_action_id_list_unref(&action_ids);
-        cardano_object_unref((cardano_object_t**)((void*)&kvp));
-
-        return get_action_id_result;
-      }
-
-      cardano_voting_procedure_t* vote = NULL;
-
-      cardano_error_t get_vote_result = cardano_voting_procedure_map_get(kvp->value, action_id, &vote);
-
-      if (get_vote_result != CARDANO_SUCCESS)
-      {
-        cardano_governance_action_id_unref(&action_id);
-        cardano_governance_action_id_list_unref(&action_ids);
-        cardano_object_unref((cardano_object_t**)((void*)&kvp));
-
-        return get_vote_result;
-      }
-
-      cardano_error_t write_action_id_result = cardano_governance_action_id_to_cbor(action_id, writer);
-
-      if (write_action_id_result != CARDANO_SUCCESS)
-      {
-        cardano_governance_action_id_unref(&action_id);
-        cardano_governance_action_id_list_unref(&action_ids);
-        cardano_object_unref((cardano_object_t**)((void*)&kvp));
-
-        return write_action_id_result;
-      }
-
-      cardano_error_t write_vote_result = cardano_voting_procedure_to_cbor(vote, writer);
-
-      if (write_vote_result != CARDANO_SUCCESS)
-      {
-        cardano_governance_action_id_unref(&action_id);
-        cardano_governance_action_id_list_unref(&action_ids);
-        cardano_object_unref((cardano_object_t**)((void*)&kvp));
-
-        return write_vote_result;
-      }
-
-      cardano_governance_action_id_unref(&action_id);
-      cardano_voting_procedure_unref(&vote);
-    }
-
-    cardano_governance_action_id_list_unref(&action_ids);
-    cardano_object_unref((cardano_object_t**)((void*)&kvp));
   }
 
   return CARDANO_SUCCESS;
@@ -469,34 +523,15 @@ cardano_voting_procedures_insert(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  size_t size = cardano_array_get_size(voting_procedures->array);
+  cardano_voting_procedure_kvp_t* existing = find_voter_kvp(voting_procedures, voter);
 
-  for (size_t i = 0U; i < size; ++i)
+  if (existing != NULL)
   {
-    cardano_voting_procedure_kvp_t* kvp = (cardano_voting_procedure_kvp_t*)((void*)cardano_array_get(voting_procedures->array, i));
+    cardano_error_t insert_result = cardano_voting_procedure_map_insert(existing->value, governance_action_id, value);
 
-    if (kvp == NULL)
-    {
-      return CARDANO_ERROR_ELEMENT_NOT_FOUND;
-    }
+    cardano_object_unref((cardano_object_t**)((void*)&existing));
 
-    if (cardano_voter_equals(kvp->key, voter))
-    {
-      cardano_error_t insert_result = cardano_voting_procedure_map_insert(kvp->value, governance_action_id, value);
-
-      if (insert_result != CARDANO_SUCCESS)
-      {
-        cardano_object_unref((cardano_object_t**)((void*)&kvp));
-
-        return insert_result;
-      }
-
-      cardano_object_unref((cardano_object_t**)((void*)&kvp));
-
-      return CARDANO_SUCCESS;
-    }
-
-    cardano_object_unref((cardano_object_t**)((void*)&kvp));
+    return insert_result;
   }
 
   cardano_voting_procedure_map_t* map               = NULL;
@@ -524,7 +559,7 @@ cardano_voting_procedures_insert(
   }
 
   kvp->base.ref_count     = 0;
-  kvp->base.last_error[0] = '\0';
+  kvp->base.last_error    = NULL;
   kvp->base.deallocator   = cardano_voting_procedure_kvp_deallocate;
   kvp->key                = voter;
   kvp->value              = map;
@@ -540,6 +575,15 @@ cardano_voting_procedures_insert(
     return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
   }
 
+  if (cardano_set_add(voting_procedures->index, (cardano_object_t*)((void*)kvp)) != new_size)
+  {
+    cardano_object_t* last = cardano_array_pop(voting_procedures->array);
+
+    cardano_object_unref(&last);
+
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
   return CARDANO_SUCCESS;
 }
 
@@ -564,37 +608,25 @@ cardano_voting_procedures_get(
     return NULL;
   }
 
-  size_t size = cardano_array_get_size(voting_procedures->array);
+  cardano_voting_procedure_kvp_t* kvp = find_voter_kvp(voting_procedures, voter);
 
-  for (size_t i = 0U; i < size; ++i)
+  if (kvp == NULL)
   {
-    cardano_voting_procedure_kvp_t* kvp = (cardano_voting_procedure_kvp_t*)((void*)cardano_array_get(voting_procedures->array, i));
-
-    if (kvp == NULL)
-    {
-      return NULL;
-    }
-
-    if (cardano_voter_equals(kvp->key, voter))
-    {
-      cardano_voting_procedure_t* procedure = NULL;
-
-      cardano_error_t get_element_result = cardano_voting_procedure_map_get(kvp->value, governance_action_id, &procedure);
+    return NULL;
+  }
 
-      cardano_object_unref((cardano_object_t**)((void*)&kvp));
+  cardano_voting_procedure_t* procedure = NULL;
 
-      if (get_element_result != CARDANO_SUCCESS)
-      {
-        return NULL;
-      }
+  cardano_error_t get_element_result = cardano_voting_procedure_map_get(kvp->value, governance_action_id, &procedure);
 
-      return procedure;
-    }
+  cardano_object_unref((cardano_object_t**)((void*)&kvp));
 
-    cardano_object_unref((cardano_object_t**)((void*)&kvp));
+  if (get_element_result != CARDANO_SUCCESS)
+  {
+    return NULL;
   }
 
-  return NULL;
+  return procedure;
 }
 
 cardano_error_t
@@ -618,32 +650,18 @@ cardano_voting_procedures_get_governance_ids_by_voter(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  size_t size = cardano_array_get_size(voting_procedures->array);
+  cardano_voting_procedure_kvp_t* kvp = find_voter_kvp(voting_procedures, voter);
 
-  for (size_t i = 0U; i < size; ++i)
+  if (kvp == NULL)
   {
-    cardano_voting_procedure_kvp_t* kvp = (cardano_voting_procedure_kvp_t*)((void*)cardano_array_get(voting_procedures->array, i));
-
-    if (kvp == NULL)
-    {
-      return CARDANO_ERROR_ELEMENT_NOT_FOUND;
-    }
-
-    if (cardano_voter_equals(kvp->key, voter))
-    {
-      cardano_error_t get_result = cardano_voting_procedure_map_get_keys(kvp->value, governance_action_ids);
+    return CARDANO_SUCCESS;
+  }
 
-      if (get_result != CARDANO_SUCCESS)
-      {
-        cardano_object_unref((cardano_object_t**)((void*)&kvp));
-        return get_result;
-      }
-    }
+  cardano_error_t get_result = cardano_voting_procedure_map_get_keys(kvp->value, governance_action_ids);
 
-    cardano_object_unref((cardano_object_t**)((void*)&kvp));
-  }
+  cardano_object_unref((cardano_object_t**)((void*)&kvp));
 
-  return CARDANO_SUCCESS;
+  return get_result;
 }
 
 cardano_error_t
@@ -696,6 +714,26 @@ cardano_voting_procedures_get_voters(cardano_voting_procedures_t* voting_procedu
   return CARDANO_SUCCESS;
 }
 
+void
+cardano_voting_procedures_sort(cardano_voting_procedures_t* voting_procedures)
+{
+  if (voting_procedures == NULL)
+  {
+    return;
+  }
+
+  const size_t size = cardano_array_get_size(voting_procedures->array);
+
+  for (size_t i = 0U; i < size; ++i)
+  {
+    const cardano_voting_procedure_kvp_t* kvp = (const cardano_voting_procedure_kvp_t*)((const void*)cardano_array_peek(voting_procedures->array, i));
+
+    cardano_voting_procedure_map_sort(kvp->value);
+  }
+
+  cardano_array_sort(voting_procedures->array, order_kvp_voters, NULL);
+}
+
 void
 cardano_voting_procedures_unref(cardano_voting_procedures_t** voting_procedures)
 {
@@ -127,7 +127,7 @@ cardano_bootstrap_witness_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_bootstrap_witness_deallocate;
 
   cardano_ed25519_public_key_ref(vkey);
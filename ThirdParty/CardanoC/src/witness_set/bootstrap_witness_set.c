@@ -91,7 +91,7 @@ cardano_bootstrap_witness_set_new(cardano_bootstrap_witness_set_t** bootstrap_wi
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_bootstrap_witness_set_deallocate;
 
   list->array     = cardano_array_new(128);
@@ -0,0 +1,99 @@
+/**
+ * \file ex_units_patch.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/cbor/cbor_writer.h>
+
+#include "../../string_safe.h"
+#include "ex_units_patch.h"
+
+#include <string.h>
+
+/* DEFINITIONS ***************************************************************/
+
+size_t
+_cardano_cbor_reader_get_offset(cardano_cbor_reader_t* reader, const size_t size)
+{
+  size_t remaining = 0U;
+
+  if (cardano_cbor_reader_get_bytes_remaining(reader, &remaining) != CARDANO_SUCCESS)
+  {
+    return size;
+  }
+
+  return size - remaining;
+}
+
+bool
+_cardano_patch_ex_units_cbor(
+  cardano_buffer_t* cbor,
+  const size_t      offset,
+  const size_t      size,
+  const uint64_t    memory,
+  const uint64_t    cpu_steps)
+{
+  // An array header and two unsigned integers of at most nine bytes each.
+  byte_t encoded[19] = { 0 };
+
+  if ((cbor == NULL) || (size > sizeof(encoded)) || (offset > cardano_buffer_get_size(cbor)) || (size > (cardano_buffer_get_size(cbor) - offset)))
+  {
+    return false;
+  }
+
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new();
+
+  if (writer == NULL)
+  {
+    return false;
+  }
+
+  cardano_error_t result = cardano_cbor_writer_write_start_array(writer, 2);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_write_uint(writer, memory);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_writer_write_uint(writer, cpu_steps);
+  }
+
+  if ((result != CARDANO_SUCCESS) || (cardano_cbor_writer_get_encode_size(writer) != size))
+  {
+    cardano_cbor_writer_unref(&writer);
+    return false;
+  }
+
+  result = cardano_cbor_writer_encode(writer, encoded, sizeof(encoded));
+  cardano_cbor_writer_unref(&writer);
+
+  // The cached encoding may be a view into the transaction it was decoded from, which must keep its original bytes
+  if ((result != CARDANO_SUCCESS) || (cardano_buffer_make_unique(cbor) != CARDANO_SUCCESS))
+  {
+    return false;
+  }
+
+  cardano_safe_memcpy(&cardano_buffer_get_data(cbor)[offset], size, encoded, size);
+
+  return true;
+}
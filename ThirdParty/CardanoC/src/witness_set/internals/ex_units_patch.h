@@ -0,0 +1,67 @@
+/**
+ * \file ex_units_patch.h
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BIGLUP_LABS_INCLUDE_CARDANO_EX_UNITS_PATCH_H
+#define BIGLUP_LABS_INCLUDE_CARDANO_EX_UNITS_PATCH_H
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/buffer.h>
+#include <cardano/cbor/cbor_reader.h>
+#include <cardano/typedefs.h>
+
+/* DECLARATIONS **************************************************************/
+
+/**
+ * \brief Gets the offset of the next byte a reader over a buffer would read.
+ *
+ * \param[in] reader A reader created over the whole buffer.
+ * \param[in] size The size of the buffer.
+ *
+ * \return The offset within the buffer.
+ */
+size_t
+_cardano_cbor_reader_get_offset(cardano_cbor_reader_t* reader, size_t size);
+
+/**
+ * \brief Overwrites an execution units encoding held in a cached CBOR buffer.
+ *
+ * The new values are only written when their encoding takes exactly as many bytes as the encoding being replaced, so
+ * the rest of the buffer stays valid.
+ *
+ * \param[in,out] cbor The cached CBOR.
+ * \param[in] offset The offset of the execution units encoding within \p cbor.
+ * \param[in] size The size of the execution units encoding.
+ * \param[in] memory The new memory units.
+ * \param[in] cpu_steps The new CPU steps.
+ *
+ * \return `true` if the encoding was overwritten, or `false` if the new encoding has a different size (or could not
+ * be produced), in which case the caller must drop the cache.
+ */
+bool
+_cardano_patch_ex_units_cbor(
+  cardano_buffer_t* cbor,
+  size_t            offset,
+  size_t            size,
+  uint64_t          memory,
+  uint64_t          cpu_steps);
+
+#endif // BIGLUP_LABS_INCLUDE_CARDANO_EX_UNITS_PATCH_H
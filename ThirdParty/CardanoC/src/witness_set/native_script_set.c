@@ -91,7 +91,7 @@ cardano_native_script_set_new(cardano_native_script_set_t** native_script_set)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_native_script_set_deallocate;
   list->uses_tags          = true;
 
@@ -27,6 +27,7 @@
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
 #include "../collections/array.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
@@ -91,7 +92,7 @@ cardano_plutus_v1_script_set_new(cardano_plutus_v1_script_set_t** plutus_v1_scri
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_plutus_v1_script_set_deallocate;
   list->uses_tags          = true;
 
@@ -406,3 +407,23 @@ cardano_plutus_v1_script_set_get_last_error(const cardano_plutus_v1_script_set_t
 {
   return cardano_object_get_last_error(&plutus_v1_script_set->base);
 }
+
+/**
+ * \brief Adds the footprint of a script stored in a set.
+ */
+static void
+add_script_footprint(const cardano_object_t* item, cardano_footprint_context_t* context)
+{
+  _cardano_plutus_v1_script_add_footprint((const cardano_plutus_v1_script_t*)((const void*)item), context);
+}
+
+void
+_cardano_plutus_v1_script_set_add_footprint(const cardano_plutus_v1_script_set_t* set, cardano_footprint_context_t* context)
+{
+  if ((set == NULL) || !_cardano_footprint_visit(context, &set->base, CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION, sizeof(cardano_plutus_v1_script_set_t)))
+  {
+    return;
+  }
+
+  _cardano_array_add_footprint(set->array, context, add_script_footprint);
+}
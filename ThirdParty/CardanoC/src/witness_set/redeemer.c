@@ -26,7 +26,9 @@
 
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 #include "../string_safe.h"
+#include "./internals/ex_units_patch.h"
 
 #include <assert.h>
 #include <string.h>
@@ -80,6 +82,71 @@ cardano_redeemer_deallocate(void* object)
   _cardano_free(object);
 }
 
+/**
+ * \brief Brings the cached encoding of a redeemer in line with its execution units.
+ *
+ * The execution units are the last field of the encoding, so they are overwritten in place when the new values take
+ * as many bytes as the old ones; otherwise the cache is dropped and the redeemer is encoded again on demand. The
+ * cached encoding of the redeemer data is kept either way.
+ *
+ * \param[in,out] redeemer The redeemer whose execution units changed.
+ */
+static void
+update_cached_ex_units(cardano_redeemer_t* redeemer)
+{
+  if (redeemer->cbor_cache == NULL)
+  {
+    return;
+  }
+
+  const size_t           cbor_size = cardano_buffer_get_size(redeemer->cbor_cache);
+  cardano_cbor_reader_t* reader    = cardano_cbor_reader_from_view(cardano_buffer_get_data(redeemer->cbor_cache), cbor_size);
+
+  int64_t  length = 0;
+  uint64_t field  = 0U;
+
+  cardano_error_t result = (reader != NULL) ? cardano_cbor_reader_read_start_array(reader, &length) : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_uint(reader, &field);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_read_uint(reader, &field);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_skip_value(reader);
+  }
+
+  const size_t ex_units_offset = _cardano_cbor_reader_get_offset(reader, cbor_size);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_skip_value(reader);
+  }
+
+  const size_t ex_units_size = _cardano_cbor_reader_get_offset(reader, cbor_size) - ex_units_offset;
+
+  cardano_cbor_reader_unref(&reader);
+
+  const bool is_patched = (result == CARDANO_SUCCESS) && _cardano_patch_ex_units_cbor(
+    redeemer->cbor_cache,
+    ex_units_offset,
+    ex_units_size,
+    cardano_ex_units_get_memory(redeemer->execution_units),
+    cardano_ex_units_get_cpu_steps(redeemer->execution_units));
+
+  if (!is_patched)
+  {
+    cardano_buffer_unref(&redeemer->cbor_cache);
+    redeemer->cbor_cache = NULL;
+  }
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -114,7 +181,7 @@ cardano_redeemer_new(
 
   (*redeemer)->base.deallocator   = cardano_redeemer_deallocate;
   (*redeemer)->base.ref_count     = 1;
-  (*redeemer)->base.last_error[0] = '\0';
+  (*redeemer)->base.last_error    = NULL;
 
   (*redeemer)->tag             = tag;
   (*redeemer)->index           = index;
@@ -428,6 +495,40 @@ cardano_redeemer_set_ex_units(cardano_redeemer_t* redeemer, cardano_ex_units_t*
 
   cardano_ex_units_ref(ex_units);
 
+  update_cached_ex_units(redeemer);
+
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_redeemer_update_ex_units(cardano_redeemer_t* redeemer, const uint64_t memory, const uint64_t cpu_steps)
+{
+  if (redeemer == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (redeemer->execution_units == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_error_t result = cardano_ex_units_set_memory(redeemer->execution_units, memory);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  result = cardano_ex_units_set_cpu_steps(redeemer->execution_units, cpu_steps);
+
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
+
+  update_cached_ex_units(redeemer);
+
   return CARDANO_SUCCESS;
 }
 
@@ -495,4 +596,17 @@ const char*
 cardano_redeemer_get_last_error(const cardano_redeemer_t* redeemer)
 {
   return cardano_object_get_last_error(&redeemer->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_redeemer_add_footprint(const cardano_redeemer_t* redeemer, cardano_footprint_context_t* context)
+{
+  if ((redeemer == NULL) || !_cardano_footprint_visit(context, &redeemer->base, CARDANO_MEMORY_FOOTPRINT_TYPE_WITNESS, sizeof(cardano_redeemer_t)))
+  {
+    return;
+  }
+
+  _cardano_plutus_data_add_footprint(redeemer->data, context);
+  _cardano_ex_units_add_footprint(redeemer->execution_units, context);
+  _cardano_buffer_add_footprint(redeemer->cbor_cache, context);
+}
@@ -28,20 +28,41 @@
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
 #include "../collections/array.h"
+#include "../memory_footprint.h"
+#include "./internals/ex_units_patch.h"
 
 #include <assert.h>
 #include <string.h>
 
+/* CONSTANTS *****************************************************************/
+
+/**
+ * \brief Lists with fewer redeemers are searched linearly; maintaining the index costs more than comparing a few entries.
+ */
+static const size_t INDEX_MIN_ENTRIES = 8U; // cppcheck-suppress misra-c2012-8.9
+
 /* STRUCTURES ****************************************************************/
 
+/**
+ * \brief A slot of the (tag, index) index of a redeemer list.
+ */
+typedef struct cardano_redeemer_list_index_slot_t
+{
+    uint64_t               index;
+    cardano_redeemer_tag_t tag;
+    size_t                 position; /**< Position of the redeemer plus one; zero marks a free slot. */
+} cardano_redeemer_list_index_slot_t;
+
 /**
  * \brief Represents a Cardano redeemer list.
  */
 typedef struct cardano_redeemer_list_t
 {
-    cardano_object_t  base;
-    cardano_array_t*  array;
-    cardano_buffer_t* cbor_cache;
+    cardano_object_t                    base;
+    cardano_array_t*                    array;
+    cardano_buffer_t*                   cbor_cache;
+    cardano_redeemer_list_index_slot_t* index;
+    size_t                              index_capacity;
 } cardano_redeemer_list_t;
 
 /* STATIC FUNCTIONS **********************************************************/
@@ -68,6 +89,7 @@ cardano_redeemer_list_deallocate(void* object)
 
   cardano_array_unref(&list->array);
   cardano_buffer_unref(&list->cbor_cache);
+  _cardano_free(list->index);
 
   _cardano_free(list);
 }
@@ -124,6 +146,317 @@ compare_by_key(const cardano_object_t* lhs, const cardano_object_t* rhs, void* c
   return 0;
 }
 
+/**
+ * \brief Computes the first index slot of a redeemer key.
+ *
+ * \param[in] tag The tag of the redeemer.
+ * \param[in] index The index of the redeemer.
+ * \param[in] mask The capacity of the index minus one.
+ *
+ * \return The slot to start probing from.
+ */
+static size_t
+key_slot(const cardano_redeemer_tag_t tag, const uint64_t index, const size_t mask)
+{
+  const uint64_t hash = ((index << 3U) ^ (uint64_t)tag) * 0x9E3779B97F4A7C15ULL;
+
+  return (size_t)(hash >> 32U) & mask;
+}
+
+/**
+ * \brief Checks whether the redeemer at a position of a list has the given key.
+ *
+ * \param[in] list The redeemer list.
+ * \param[in] position The position of the redeemer.
+ * \param[in] tag The tag to compare against.
+ * \param[in] index The index to compare against.
+ *
+ * \return `true` if the redeemer has the key.
+ */
+static bool
+has_key_at(const cardano_redeemer_list_t* list, const size_t position, const cardano_redeemer_tag_t tag, const uint64_t index)
+{
+  const cardano_redeemer_t* redeemer = (const cardano_redeemer_t*)((const void*)cardano_array_peek(list->array, position));
+
+  return (redeemer != NULL) && (cardano_redeemer_get_tag(redeemer) == tag) && (cardano_redeemer_get_index(redeemer) == index);
+}
+
+/**
+ * \brief Drops the (tag, index) index of a redeemer list; it is rebuilt by the next lookup that needs it.
+ *
+ * \param[in] list The redeemer list.
+ */
+static void
+drop_index(cardano_redeemer_list_t* list)
+{
+  _cardano_free(list->index);
+
+  list->index          = NULL;
+  list->index_capacity = 0U;
+}
+
+/**
+ * \brief Builds the (tag, index) index of a redeemer list.
+ *
+ * When two redeemers share a key, the index points at the first one, so lookups return what a linear search would.
+ *
+ * \param[in] list The redeemer list.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or \ref CARDANO_ERROR_MEMORY_ALLOCATION_FAILED. On failure the list is left
+ *         without an index, and lookups search it linearly.
+ */
+static cardano_error_t
+build_index(cardano_redeemer_list_t* list)
+{
+  const size_t length   = cardano_array_get_size(list->array);
+  size_t       capacity = 16U;
+
+  // Keep the index at most half full, so probe sequences stay short
+  while (capacity < (length * 2U))
+  {
+    capacity *= 2U;
+  }
+
+  drop_index(list);
+
+  cardano_redeemer_list_index_slot_t* index = (cardano_redeemer_list_index_slot_t*)_cardano_malloc(capacity * sizeof(cardano_redeemer_list_index_slot_t));
+
+  if (index == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  CARDANO_UNUSED(memset((void*)index, 0, capacity * sizeof(cardano_redeemer_list_index_slot_t)));
+
+  list->index          = index;
+  list->index_capacity = capacity;
+
+  const size_t mask = capacity - 1U;
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    const cardano_redeemer_t*    redeemer       = (const cardano_redeemer_t*)((const void*)cardano_array_peek(list->array, i));
+    const cardano_redeemer_tag_t tag            = cardano_redeemer_get_tag(redeemer);
+    const uint64_t               redeemer_index = cardano_redeemer_get_index(redeemer);
+
+    for (size_t slot = key_slot(tag, redeemer_index, mask);; slot = (slot + 1U) & mask)
+    {
+      cardano_redeemer_list_index_slot_t* entry = &index[slot];
+
+      if (entry->position == 0U)
+      {
+        entry->index    = redeemer_index;
+        entry->tag      = tag;
+        entry->position = i + 1U;
+
+        break;
+      }
+
+      if ((entry->tag == tag) && (entry->index == redeemer_index))
+      {
+        break;
+      }
+    }
+  }
+
+  return CARDANO_SUCCESS;
+}
+
+/**
+ * \brief Finds the position of the redeemer with the given key.
+ *
+ * Redeemer indices can be changed behind the back of the list with \ref cardano_redeemer_set_index, so a hit is
+ * checked against the redeemer it points at, and a miss is confirmed with a linear search. Either way a stale index
+ * is dropped and rebuilt by the next lookup.
+ *
+ * \param[in] list The redeemer list.
+ * \param[in] tag The tag of the redeemer.
+ * \param[in] index The index of the redeemer.
+ * \param[out] position On success, the position of the redeemer.
+ *
+ * \return `true` if the list holds a redeemer with the key.
+ */
+static bool
+find_position(cardano_redeemer_list_t* list, const cardano_redeemer_tag_t tag, const uint64_t index, size_t* position)
+{
+  const size_t length = cardano_array_get_size(list->array);
+
+  if ((list->index == NULL) && (length >= INDEX_MIN_ENTRIES))
+  {
+    CARDANO_UNUSED(build_index(list));
+  }
+
+  if (list->index != NULL)
+  {
+    const size_t mask = list->index_capacity - 1U;
+
+    for (size_t slot = key_slot(tag, index, mask); list->index[slot].position != 0U; slot = (slot + 1U) & mask)
+    {
+      const cardano_redeemer_list_index_slot_t* entry = &list->index[slot];
+
+      if ((entry->tag == tag) && (entry->index == index))
+      {
+        if (has_key_at(list, entry->position - 1U, tag, index))
+        {
+          *position = entry->position - 1U;
+
+          return true;
+        }
+
+        break;
+      }
+    }
+  }
+
+  for (size_t i = 0U; i < length; ++i)
+  {
+    if (has_key_at(list, i, tag, index))
+    {
+      drop_index(list);
+      *position = i;
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * \brief Positions a reader over the cached encoding of a redeemer list at the execution units of a redeemer.
+ *
+ * Both the map encoding (`{ [tag, index] => [data, ex_units] }`) and the legacy array encoding
+ * (`[ [tag, index, data, ex_units] ]`) are handled.
+ *
+ * \param[in] reader A reader at the start of the cached encoding.
+ * \param[in] tag The tag of the redeemer.
+ * \param[in] index The index of the redeemer.
+ *
+ * \return \ref CARDANO_SUCCESS if the reader is at the execution units of the redeemer, \ref CARDANO_ERROR_ELEMENT_NOT_FOUND
+ * if the encoding has no such redeemer, or a decoding error.
+ */
+static cardano_error_t
+seek_cached_ex_units(cardano_cbor_reader_t* reader, const cardano_redeemer_tag_t tag, const uint64_t index)
+{
+  cardano_cbor_reader_state_t state  = CARDANO_CBOR_READER_STATE_UNDEFINED;
+  int64_t                     length = 0;
+  cardano_error_t             result = cardano_cbor_reader_peek_state(reader, &state);
+
+  const bool is_map = state == CARDANO_CBOR_READER_STATE_START_MAP;
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = is_map ? cardano_cbor_reader_read_start_map(reader, &length) : cardano_cbor_reader_read_start_array(reader, &length);
+  }
+
+  while (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_peek_state(reader, &state);
+
+    if ((result != CARDANO_SUCCESS) || (state == CARDANO_CBOR_READER_STATE_END_MAP) || (state == CARDANO_CBOR_READER_STATE_END_ARRAY))
+    {
+      return (result != CARDANO_SUCCESS) ? result : CARDANO_ERROR_ELEMENT_NOT_FOUND;
+    }
+
+    uint64_t entry_tag   = 0U;
+    uint64_t entry_index = 0U;
+
+    result = cardano_cbor_reader_read_start_array(reader, &length);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_read_uint(reader, &entry_tag);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_read_uint(reader, &entry_index);
+    }
+
+    if ((result == CARDANO_SUCCESS) && is_map)
+    {
+      result = cardano_cbor_reader_read_end_array(reader);
+    }
+
+    if ((result == CARDANO_SUCCESS) && is_map)
+    {
+      result = cardano_cbor_reader_read_start_array(reader, &length);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_skip_value(reader);
+    }
+
+    if ((result == CARDANO_SUCCESS) && (entry_tag == (uint64_t)tag) && (entry_index == index))
+    {
+      return CARDANO_SUCCESS;
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_skip_value(reader);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_cbor_reader_read_end_array(reader);
+    }
+  }
+
+  return result;
+}
+
+/**
+ * \brief Brings the cached encoding of a redeemer list in line with new execution units of one of its redeemers.
+ *
+ * The execution units are overwritten in place when the new values take as many bytes as the old ones, so a
+ * re-evaluated transaction keeps its encoding; otherwise the cache is dropped and the list is encoded again on demand.
+ *
+ * \param[in,out] redeemer_list The redeemer list.
+ * \param[in] tag The tag of the redeemer that changed.
+ * \param[in] index The index of the redeemer that changed.
+ * \param[in] mem The new memory units.
+ * \param[in] steps The new CPU steps.
+ */
+static void
+update_cached_ex_units(
+  cardano_redeemer_list_t*     redeemer_list,
+  const cardano_redeemer_tag_t tag,
+  const uint64_t               index,
+  const uint64_t               mem,
+  const uint64_t               steps)
+{
+  if (redeemer_list->cbor_cache == NULL)
+  {
+    return;
+  }
+
+  const size_t           cbor_size = cardano_buffer_get_size(redeemer_list->cbor_cache);
+  cardano_cbor_reader_t* reader    = cardano_cbor_reader_from_view(cardano_buffer_get_data(redeemer_list->cbor_cache), cbor_size);
+
+  cardano_error_t result = (reader != NULL) ? seek_cached_ex_units(reader, tag, index) : CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+
+  const size_t ex_units_offset = _cardano_cbor_reader_get_offset(reader, cbor_size);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_cbor_reader_skip_value(reader);
+  }
+
+  const size_t ex_units_size = _cardano_cbor_reader_get_offset(reader, cbor_size) - ex_units_offset;
+
+  cardano_cbor_reader_unref(&reader);
+
+  const bool is_patched = (result == CARDANO_SUCCESS) && _cardano_patch_ex_units_cbor(redeemer_list->cbor_cache, ex_units_offset, ex_units_size, mem, steps);
+
+  if (!is_patched)
+  {
+    cardano_buffer_unref(&redeemer_list->cbor_cache);
+    redeemer_list->cbor_cache = NULL;
+  }
+}
+
 /* DEFINITIONS ****************************************************************/
 
 cardano_error_t
@@ -142,11 +475,13 @@ cardano_redeemer_list_new(cardano_redeemer_list_t** redeemer_list)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_redeemer_list_deallocate;
 
-  list->array      = cardano_array_new(128);
-  list->cbor_cache = NULL;
+  list->array          = cardano_array_new(128);
+  list->cbor_cache     = NULL;
+  list->index          = NULL;
+  list->index_capacity = 0U;
 
   if (list->array == NULL)
   {
@@ -558,6 +893,17 @@ cardano_redeemer_list_get(
   return CARDANO_SUCCESS;
 }
 
+cardano_redeemer_t*
+cardano_redeemer_list_peek(const cardano_redeemer_list_t* redeemer_list, const size_t index)
+{
+  if (redeemer_list == NULL)
+  {
+    return NULL;
+  }
+
+  return (cardano_redeemer_t*)((void*)cardano_array_peek(redeemer_list->array, index));
+}
+
 cardano_error_t
 cardano_redeemer_list_add(cardano_redeemer_list_t* redeemer_list, cardano_redeemer_t* element)
 {
@@ -579,6 +925,7 @@ cardano_redeemer_list_add(cardano_redeemer_list_t* redeemer_list, cardano_redeem
   CARDANO_UNUSED(new_size);
 
   cardano_array_sort(redeemer_list->array, compare_by_key, NULL);
+  drop_index(redeemer_list);
 
   return CARDANO_SUCCESS;
 }
@@ -596,42 +943,69 @@ cardano_redeemer_list_set_ex_units(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
-  for (size_t i = 0U; i < cardano_redeemer_list_get_length(redeemer_list); ++i)
+  size_t position = 0U;
+
+  if (!find_position(redeemer_list, tag, index, &position))
   {
-    cardano_redeemer_t* redeemer = NULL;
+    return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  }
 
-    cardano_error_t result = cardano_redeemer_list_get(redeemer_list, i, &redeemer);
-    cardano_redeemer_unref(&redeemer);
+  cardano_redeemer_t* redeemer = cardano_redeemer_list_peek(redeemer_list, position);
+  cardano_error_t     result   = cardano_redeemer_update_ex_units(redeemer, mem, steps);
 
-    if (result != CARDANO_SUCCESS)
-    {
-      return result;
-    }
+  if (result != CARDANO_SUCCESS)
+  {
+    return result;
+  }
 
-    if ((cardano_redeemer_get_tag(redeemer) == tag) && (cardano_redeemer_get_index(redeemer) == index))
-    {
-      cardano_ex_units_t* ex_units = cardano_redeemer_get_ex_units(redeemer);
-      cardano_ex_units_unref(&ex_units);
+  update_cached_ex_units(redeemer_list, tag, index, mem, steps);
 
-      if (ex_units == NULL)
-      {
-        return CARDANO_ERROR_POINTER_IS_NULL;
-      }
+  return CARDANO_SUCCESS;
+}
+
+cardano_error_t
+cardano_redeemer_list_find(
+  cardano_redeemer_list_t*     redeemer_list,
+  const cardano_redeemer_tag_t tag,
+  const uint64_t               index,
+  cardano_redeemer_t**         redeemer)
+{
+  if ((redeemer_list == NULL) || (redeemer == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
 
-      cardano_error_t set_result = cardano_ex_units_set_memory(ex_units, mem);
+  size_t position = 0U;
 
-      if (set_result != CARDANO_SUCCESS)
-      {
-        return set_result;
-      }
+  if (!find_position(redeemer_list, tag, index, &position))
+  {
+    return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  }
 
-      set_result = cardano_ex_units_set_cpu_steps(ex_units, steps);
+  return cardano_redeemer_list_get(redeemer_list, position, redeemer);
+}
 
-      return set_result;
-    }
+void
+cardano_redeemer_list_reindex(cardano_redeemer_list_t* redeemer_list)
+{
+  if (redeemer_list == NULL)
+  {
+    return;
   }
 
-  return CARDANO_ERROR_ELEMENT_NOT_FOUND;
+  cardano_array_sort(redeemer_list->array, compare_by_key, NULL);
+
+  cardano_buffer_unref(&redeemer_list->cbor_cache);
+  redeemer_list->cbor_cache = NULL;
+
+  if (cardano_array_get_size(redeemer_list->array) >= INDEX_MIN_ENTRIES)
+  {
+    CARDANO_UNUSED(build_index(redeemer_list));
+  }
+  else
+  {
+    drop_index(redeemer_list);
+  }
 }
 
 cardano_error_t
@@ -770,3 +1144,29 @@ cardano_redeemer_list_get_last_error(const cardano_redeemer_list_t* redeemer_lis
 {
   return cardano_object_get_last_error(&redeemer_list->base);
 }
+
+/**
+ * \brief Adds the footprint of a redeemer stored in a list.
+ */
+static void
+add_redeemer_footprint(const cardano_object_t* item, cardano_footprint_context_t* context)
+{
+  _cardano_redeemer_add_footprint((const cardano_redeemer_t*)((const void*)item), context);
+}
+
+void
+_cardano_redeemer_list_add_footprint(const cardano_redeemer_list_t* list, cardano_footprint_context_t* context)
+{
+  if ((list == NULL) || !_cardano_footprint_visit(context, &list->base, CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION, sizeof(cardano_redeemer_list_t)))
+  {
+    return;
+  }
+
+  _cardano_array_add_footprint(list->array, context, add_redeemer_footprint);
+  _cardano_buffer_add_footprint(list->cbor_cache, context);
+
+  if (list->index != NULL)
+  {
+    _cardano_footprint_add_block(context, CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION, list->index_capacity * sizeof(cardano_redeemer_list_index_slot_t));
+  }
+}
@@ -27,7 +27,9 @@
 #include <cardano/witness_set/vkey_witness.h>
 
 #include "../allocators.h"
+#include "../cbor/cbor_fixed.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
@@ -36,6 +38,10 @@
 
 static const int64_t EMBEDDED_GROUP_SIZE = 2;
 
+/* Sizes of an Ed25519 public key and signature, as macros so they can size the encoding buffer. */
+#define VKEY_SIZE      32U
+#define SIGNATURE_SIZE 64U
+
 /* STRUCTURES ****************************************************************/
 
 /**
@@ -109,7 +115,7 @@ cardano_vkey_witness_new(
   }
 
   data->base.ref_count     = 1;
-  data->base.last_error[0] = '\0';
+  data->base.last_error    = NULL;
   data->base.deallocator   = cardano_vkey_witness_deallocate;
 
   cardano_ed25519_public_key_ref(vkey);
@@ -216,6 +222,26 @@ cardano_vkey_witness_to_cbor(
     return CARDANO_ERROR_POINTER_IS_NULL;
   }
 
+  const size_t vkey_size      = cardano_ed25519_public_key_get_bytes_size(vkey_witness->vkey);
+  const size_t signature_size = cardano_ed25519_signature_get_bytes_size(vkey_witness->signature);
+
+  if ((vkey_size == VKEY_SIZE) && (signature_size == SIGNATURE_SIZE))
+  {
+    // [ bytes(32), bytes(64) ]: every witness has this shape, so only the payloads vary
+    byte_t encoded[1U + 2U + VKEY_SIZE + 2U + SIGNATURE_SIZE] = {
+      CARDANO_CBOR_FIXED_ARRAY(EMBEDDED_GROUP_SIZE),
+      CARDANO_CBOR_FIXED_BYTESTRING_8BIT(VKEY_SIZE)
+    };
+
+    const byte_t signature_header[2] = { CARDANO_CBOR_FIXED_BYTESTRING_8BIT(SIGNATURE_SIZE) };
+
+    (void)memcpy(&encoded[3], cardano_ed25519_public_key_get_data(vkey_witness->vkey), VKEY_SIZE);
+    (void)memcpy(&encoded[3U + VKEY_SIZE], signature_header, sizeof(signature_header));
+    (void)memcpy(&encoded[5U + VKEY_SIZE], cardano_ed25519_signature_get_data(vkey_witness->signature), SIGNATURE_SIZE);
+
+    return cardano_cbor_writer_write_encoded(writer, encoded, sizeof(encoded));
+  }
+
   cardano_error_t write_array_result = cardano_cbor_writer_write_start_array(writer, EMBEDDED_GROUP_SIZE);
 
   if (write_array_result != CARDANO_SUCCESS)
@@ -387,3 +413,15 @@ cardano_vkey_witness_get_last_error(const cardano_vkey_witness_t* vkey_witness)
 {
   return cardano_object_get_last_error(&vkey_witness->base);
 }
+
+void
+_cardano_vkey_witness_add_footprint(const cardano_vkey_witness_t* witness, cardano_footprint_context_t* context)
+{
+  if ((witness == NULL) || !_cardano_footprint_visit(context, &witness->base, CARDANO_MEMORY_FOOTPRINT_TYPE_WITNESS, sizeof(cardano_vkey_witness_t)))
+  {
+    return;
+  }
+
+  _cardano_ed25519_public_key_add_footprint(witness->vkey, context);
+  _cardano_ed25519_signature_add_footprint(witness->signature, context);
+}
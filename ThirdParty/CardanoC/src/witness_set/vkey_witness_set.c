@@ -27,6 +27,7 @@
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
 #include "../collections/array.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <string.h>
@@ -107,7 +108,7 @@ cardano_vkey_witness_set_new(cardano_vkey_witness_set_t** vkey_witness_set)
   }
 
   list->base.ref_count     = 1;
-  list->base.last_error[0] = '\0';
+  list->base.last_error    = NULL;
   list->base.deallocator   = cardano_vkey_witness_set_deallocate;
   list->uses_tags          = true;
 
@@ -488,3 +489,23 @@ cardano_vkey_witness_set_get_last_error(const cardano_vkey_witness_set_t* vkey_w
 {
   return cardano_object_get_last_error(&vkey_witness_set->base);
 }
+
+/**
+ * \brief Adds the footprint of a witness stored in a set.
+ */
+static void
+add_witness_footprint(const cardano_object_t* item, cardano_footprint_context_t* context)
+{
+  _cardano_vkey_witness_add_footprint((const cardano_vkey_witness_t*)((const void*)item), context);
+}
+
+void
+_cardano_vkey_witness_set_add_footprint(const cardano_vkey_witness_set_t* set, cardano_footprint_context_t* context)
+{
+  if ((set == NULL) || !_cardano_footprint_visit(context, &set->base, CARDANO_MEMORY_FOOTPRINT_TYPE_COLLECTION, sizeof(cardano_vkey_witness_set_t)))
+  {
+    return;
+  }
+
+  _cardano_array_add_footprint(set->array, context, add_witness_footprint);
+}
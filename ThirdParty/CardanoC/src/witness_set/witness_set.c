@@ -26,6 +26,7 @@
 
 #include "../allocators.h"
 #include "../cbor/cbor_validation.h"
+#include "../memory_footprint.h"
 
 #include <assert.h>
 #include <cardano/scripts/script.h>
@@ -833,7 +834,7 @@ create_witness_set_new(void)
 
   witness_set->base.deallocator    = cardano_witness_set_deallocate;
   witness_set->base.ref_count      = 1;
-  witness_set->base.last_error[0]  = '\0';
+  witness_set->base.last_error     = NULL;
   witness_set->vkey_witnesses      = NULL;
   witness_set->native_scripts      = NULL;
   witness_set->bootstrap_witnesses = NULL;
@@ -1030,6 +1031,38 @@ cardano_witness_set_to_cbor(const cardano_witness_set_t* witness_set, cardano_cb
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_witness_set_get_cbor_size(const cardano_witness_set_t* witness_set, size_t* size)
+{
+  if (witness_set == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  if (size == NULL)
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  cardano_cbor_writer_t* writer = cardano_cbor_writer_new_size_only();
+
+  if (writer == NULL)
+  {
+    return CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  cardano_error_t result = cardano_witness_set_to_cbor(witness_set, writer);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    *size = cardano_cbor_writer_get_encode_size(writer);
+  }
+
+  cardano_cbor_writer_unref(&writer);
+
+  return result;
+}
+
 cardano_vkey_witness_set_t*
 cardano_witness_set_get_vkeys(cardano_witness_set_t* witness_set)
 {
@@ -1564,6 +1597,112 @@ cardano_witness_set_add_script(cardano_witness_set_t* witness_set, cardano_scrip
   return CARDANO_SUCCESS;
 }
 
+cardano_error_t
+cardano_witness_set_verify_vkeys(
+  cardano_witness_set_t*        witness_set,
+  const cardano_blake2b_hash_t* tx_body_hash,
+  bool*                         all_valid)
+{
+  if ((witness_set == NULL) || (tx_body_hash == NULL) || (all_valid == NULL))
+  {
+    return CARDANO_ERROR_POINTER_IS_NULL;
+  }
+
+  *all_valid = true;
+
+  const size_t count = cardano_vkey_witness_set_get_length(witness_set->vkey_witnesses);
+
+  if (count == 0U)
+  {
+    return CARDANO_SUCCESS;
+  }
+
+  cardano_ed25519_public_key_t** keys    = (cardano_ed25519_public_key_t**)_cardano_malloc(count * sizeof(cardano_ed25519_public_key_t*));
+  cardano_ed25519_signature_t**  sigs    = (cardano_ed25519_signature_t**)_cardano_malloc(count * sizeof(cardano_ed25519_signature_t*));
+  const byte_t**                 msgs    = (const byte_t**)_cardano_malloc(count * sizeof(byte_t*));
+  size_t*                        lengths = (size_t*)_cardano_malloc(count * sizeof(size_t));
+  bool*                          results = (bool*)_cardano_malloc(count * sizeof(bool));
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  if (keys != NULL)
+  {
+    CARDANO_UNUSED(memset((void*)keys, 0, count * sizeof(cardano_ed25519_public_key_t*)));
+  }
+
+  if (sigs != NULL)
+  {
+    CARDANO_UNUSED(memset((void*)sigs, 0, count * sizeof(cardano_ed25519_signature_t*)));
+  }
+
+  if ((keys == NULL) || (sigs == NULL) || (msgs == NULL) || (lengths == NULL) || (results == NULL))
+  {
+    result = CARDANO_ERROR_MEMORY_ALLOCATION_FAILED;
+  }
+
+  const byte_t* hash_data = cardano_blake2b_hash_get_data(tx_body_hash);
+  const size_t  hash_size = cardano_blake2b_hash_get_bytes_size(tx_body_hash);
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < count); ++i)
+  {
+    cardano_vkey_witness_t* vkey_witness = NULL;
+
+    result = cardano_vkey_witness_set_get(witness_set->vkey_witnesses, i, &vkey_witness);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      keys[i]    = cardano_vkey_witness_get_vkey(vkey_witness);
+      sigs[i]    = cardano_vkey_witness_get_signature(vkey_witness);
+      msgs[i]    = hash_data;
+      lengths[i] = hash_size;
+
+      if ((keys[i] == NULL) || (sigs[i] == NULL))
+      {
+        result = CARDANO_ERROR_POINTER_IS_NULL;
+      }
+    }
+
+    cardano_vkey_witness_unref(&vkey_witness);
+  }
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_ed25519_batch_verify(
+      (const cardano_ed25519_public_key_t* const*)keys,
+      (const cardano_ed25519_signature_t* const*)sigs,
+      msgs,
+      lengths,
+      count,
+      results);
+  }
+
+  for (size_t i = 0U; i < count; ++i)
+  {
+    if ((result == CARDANO_SUCCESS) && !results[i])
+    {
+      *all_valid = false;
+    }
+
+    if (keys != NULL)
+    {
+      cardano_ed25519_public_key_unref(&keys[i]);
+    }
+
+    if (sigs != NULL)
+    {
+      cardano_ed25519_signature_unref(&sigs[i]);
+    }
+  }
+
+  _cardano_free(keys);
+  _cardano_free(sigs);
+  _cardano_free((void*)msgs);
+  _cardano_free(lengths);
+  _cardano_free(results);
+
+  return result;
+}
+
 void
 cardano_witness_set_unref(cardano_witness_set_t** witness_set)
 {
@@ -1614,4 +1753,22 @@ const char*
 cardano_witness_set_get_last_error(const cardano_witness_set_t* witness_set)
 {
   return cardano_object_get_last_error(&witness_set->base);
-}
\ No newline at end of file
+}
+
+void
+_cardano_witness_set_add_footprint(const cardano_witness_set_t* witness_set, cardano_footprint_context_t* context)
+{
+  if ((witness_set == NULL) || !_cardano_footprint_visit(context, &witness_set->base, CARDANO_MEMORY_FOOTPRINT_TYPE_WITNESS, sizeof(cardano_witness_set_t)))
+  {
+    return;
+  }
+
+  _cardano_vkey_witness_set_add_footprint(witness_set->vkey_witnesses, context);
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)witness_set->native_scripts));
+  _cardano_footprint_add_unmeasured(context, (const cardano_object_t*)((const void*)witness_set->bootstrap_witnesses));
+  _cardano_plutus_v1_script_set_add_footprint(witness_set->plutus_v1_scripts, context);
+  _cardano_plutus_data_set_add_footprint(witness_set->plutus_data, context);
+  _cardano_redeemer_list_add_footprint(witness_set->redeemer, context);
+  _cardano_plutus_v2_script_set_add_footprint(witness_set->plutus_v2_scripts, context);
+  _cardano_plutus_v3_script_set_add_footprint(witness_set->plutus_v3_scripts, context);
+}
@@ -0,0 +1,1208 @@
+/**
+ * \file cardano_signer.c
+ *
+ * \author angel.castillo
+ * \date   Oct 14, 2026
+ *
+ * Copyright 2024 Biglup Labs
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * cardano-signer: a signing service holding unlocked BIP32 keys for many processes.
+ *
+ * The daemon loads a serialized software secure key handler, opens an unlocked session that does not expire, and
+ * serves batched sign requests over a Unix domain socket, in the protocol described in
+ * <cardano/key_handlers/remote_secure_key_handler.h>. Clients use cardano_remote_secure_key_handler_new.
+ *
+ * Each derivation path is derived once, on first use, and its signing key kept for the lifetime of the daemon, so a
+ * request costs one Ed25519 signature per item. Every connection is served by its own thread and signs without
+ * holding a lock, so concurrent clients scale with the cores of the machine.
+ *
+ * Usage:
+ *
+ *   cardano-signer --key-file <path> --socket <path> [--passphrase-file <path>] [--allow-uid <uid>]...
+ *                  [--max-connections <count>]
+ *
+ * The passphrase is read from the first line of --passphrase-file, or from the CARDANO_SIGNER_PASSPHRASE
+ * environment variable, which is cleared once read. It is wiped as soon as the session is open.
+ *
+ * Only processes running as the same user as the daemon, or as a user given with --allow-uid, may connect. The
+ * socket is created with mode 0600, core dumps and ptrace attachment are disabled, and the process memory is locked
+ * when the limits allow it.
+ */
+
+#define _GNU_SOURCE
+
+/* INCLUDES ******************************************************************/
+
+#include <cardano/cardano.h>
+#include <cardano/key_handlers/remote_secure_key_handler.h>
+#include <cardano/key_handlers/software_secure_key_handler.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/* CONSTANTS *****************************************************************/
+
+static const size_t HASH_SIZE               = 32U;
+static const size_t PUBLIC_KEY_SIZE         = 32U;
+static const size_t STATUS_SIZE             = 4U;
+static const size_t MAX_PASSPHRASE_SIZE     = 128U;
+static const size_t MAX_ALLOWED_UIDS        = 32U;
+static const size_t DEFAULT_MAX_CONNECTIONS = 64U;
+static const size_t KEY_TABLE_CAPACITY      = 8192U;
+static const size_t MAX_REQUEST_SIZE        = 4U + ((size_t)CARDANO_SIGNING_SERVICE_MAX_BATCH_SIZE * CARDANO_SIGNING_SERVICE_SIGN_REQUEST_ITEM_SIZE);
+
+/* STRUCTURES ****************************************************************/
+
+/**
+ * \brief A derived signing key, kept for the lifetime of the daemon.
+ */
+typedef struct signing_key_t
+{
+    /**
+     * \brief The encoded derivation path of the key.
+     */
+    byte_t path[CARDANO_SIGNING_SERVICE_PATH_SIZE];
+
+    /**
+     * \brief The signing context of the key, or NULL for an empty slot.
+     */
+    cardano_ed25519_signing_context_t* context;
+
+    /**
+     * \brief The Ed25519 public key of the key.
+     */
+    byte_t public_key[32];
+} signing_key_t;
+
+/**
+ * \brief The state shared by every connection.
+ */
+typedef struct signer_t
+{
+    /**
+     * \brief The key handler holding the unlocked session. Only used with `mutex` held.
+     */
+    cardano_secure_key_handler_t* handler;
+
+    /**
+     * \brief Open addressing table of the derived keys. Slots are only filled, with `mutex` held, and never emptied
+     *        before shutdown, so a key found in the table can be used without the lock.
+     */
+    signing_key_t* keys;
+
+    /**
+     * \brief The number of filled slots in `keys`.
+     */
+    size_t key_count;
+
+    /**
+     * \brief The file descriptors of the open connections, -1 for free slots.
+     */
+    int* connections;
+
+    /**
+     * \brief The capacity of `connections`.
+     */
+    size_t max_connections;
+
+    /**
+     * \brief The number of open connections.
+     */
+    size_t connection_count;
+
+    /**
+     * \brief The user ids allowed to connect.
+     */
+    uid_t allowed_uids[32];
+
+    /**
+     * \brief The number of entries in `allowed_uids`.
+     */
+    size_t allowed_uid_count;
+
+    /**
+     * \brief Guards every field above.
+     */
+    pthread_mutex_t mutex;
+
+    /**
+     * \brief Signalled when the last connection closes.
+     */
+    pthread_cond_t idle;
+} signer_t;
+
+/**
+ * \brief The arguments of a connection thread.
+ */
+typedef struct connection_t
+{
+    signer_t* signer;
+    int       fd;
+} connection_t;
+
+/* STATIC VARIABLES **********************************************************/
+
+static byte_t* s_passphrase      = NULL;
+static size_t  s_passphrase_size = 0U;
+static int     s_stop_pipe[2]    = { -1, -1 };
+
+/* STATIC FUNCTIONS **********************************************************/
+
+/**
+ * \brief Overwrites a buffer with zeros in a way the compiler cannot elide.
+ *
+ * \param[out] data The buffer to wipe.
+ * \param[in] size The size of the buffer.
+ */
+static void
+wipe(void* data, const size_t size)
+{
+  volatile byte_t* bytes = (volatile byte_t*)data;
+
+  for (size_t i = 0U; i < size; ++i)
+  {
+    bytes[i] = 0U;
+  }
+}
+
+/**
+ * \brief Prints a message to the standard error, prefixed with the program name.
+ *
+ * \param[in] format The printf format of the message.
+ */
+static void
+log_message(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+static void
+log_message(const char* format, ...)
+{
+  va_list args;
+
+  va_start(args, format);
+  fputs("cardano-signer: ", stderr);
+  vfprintf(stderr, format, args);
+  fputc('\n', stderr);
+  va_end(args);
+}
+
+/**
+ * \brief Passphrase callback of the key handler, serving the passphrase read at startup.
+ *
+ * \param[out] buffer The buffer receiving the passphrase.
+ * \param[in] buffer_len The size of `buffer`.
+ *
+ * \return The length of the passphrase, or -1 if it is no longer available.
+ */
+static int32_t
+get_passphrase(byte_t* buffer, const size_t buffer_len)
+{
+  if ((s_passphrase == NULL) || (s_passphrase_size == 0U) || (s_passphrase_size > buffer_len))
+  {
+    return -1;
+  }
+
+  memcpy(buffer, s_passphrase, s_passphrase_size);
+
+  return (int32_t)s_passphrase_size;
+}
+
+/**
+ * \brief Wipes and releases the passphrase.
+ */
+static void
+forget_passphrase(void)
+{
+  if (s_passphrase != NULL)
+  {
+    wipe(s_passphrase, MAX_PASSPHRASE_SIZE);
+    free(s_passphrase);
+  }
+
+  s_passphrase      = NULL;
+  s_passphrase_size = 0U;
+}
+
+/**
+ * \brief Reads the passphrase from a file, or from the CARDANO_SIGNER_PASSPHRASE environment variable.
+ *
+ * \param[in] path The path of the passphrase file, or NULL to use the environment.
+ *
+ * \return `true` if a non empty passphrase was read.
+ */
+static bool
+load_passphrase(const char* path)
+{
+  s_passphrase = (byte_t*)calloc(1U, MAX_PASSPHRASE_SIZE);
+
+  if (s_passphrase == NULL)
+  {
+    return false;
+  }
+
+  if (path != NULL)
+  {
+    FILE* file = fopen(path, "rb");
+
+    if (file == NULL)
+    {
+      return false;
+    }
+
+    int c = fgetc(file);
+
+    while ((c != EOF) && (c != '\n') && (c != '\r') && (s_passphrase_size < MAX_PASSPHRASE_SIZE))
+    {
+      s_passphrase[s_passphrase_size] = (byte_t)c;
+      ++s_passphrase_size;
+      c = fgetc(file);
+    }
+
+    CARDANO_UNUSED(fclose(file));
+  }
+  else
+  {
+    char* value = getenv("CARDANO_SIGNER_PASSPHRASE");
+
+    if (value != NULL)
+    {
+      s_passphrase_size = strnlen(value, MAX_PASSPHRASE_SIZE);
+      memcpy(s_passphrase, value, s_passphrase_size);
+      wipe(value, strlen(value));
+      CARDANO_UNUSED(unsetenv("CARDANO_SIGNER_PASSPHRASE"));
+    }
+  }
+
+  return s_passphrase_size > 0U;
+}
+
+/**
+ * \brief Reads a whole file into memory.
+ *
+ * \param[in] path The path of the file.
+ * \param[out] size On success, the size of the file.
+ *
+ * \return The contents of the file, to be released with `free`, or NULL on failure.
+ */
+static byte_t*
+read_file(const char* path, size_t* size)
+{
+  FILE* file = fopen(path, "rb");
+
+  if (file == NULL)
+  {
+    return NULL;
+  }
+
+  byte_t* data     = NULL;
+  size_t  capacity = 0U;
+
+  *size = 0U;
+
+  for (;;)
+  {
+    if (*size == capacity)
+    {
+      capacity = (capacity == 0U) ? 4096U : (capacity * 2U);
+
+      byte_t* grown = (byte_t*)realloc(data, capacity);
+
+      if (grown == NULL)
+      {
+        free(data);
+        CARDANO_UNUSED(fclose(file));
+
+        return NULL;
+      }
+
+      data = grown;
+    }
+
+    const size_t read = fread(&data[*size], 1U, capacity - *size, file);
+
+    if (read == 0U)
+    {
+      break;
+    }
+
+    *size += read;
+  }
+
+  CARDANO_UNUSED(fclose(file));
+
+  return data;
+}
+
+/**
+ * \brief Writes a little endian 32 bit value.
+ *
+ * \param[out] buffer The destination.
+ * \param[in] value The value.
+ */
+static void
+write_u32(byte_t* buffer, const uint32_t value)
+{
+  buffer[0] = (byte_t)(value & 0xFFU);
+  buffer[1] = (byte_t)((value >> 8U) & 0xFFU);
+  buffer[2] = (byte_t)((value >> 16U) & 0xFFU);
+  buffer[3] = (byte_t)((value >> 24U) & 0xFFU);
+}
+
+/**
+ * \brief Reads a little endian 32 bit value.
+ *
+ * \param[in] buffer The source.
+ *
+ * \return The value.
+ */
+static uint32_t
+read_u32(const byte_t* buffer)
+{
+  return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8U) | ((uint32_t)buffer[2] << 16U) | ((uint32_t)buffer[3] << 24U);
+}
+
+/**
+ * \brief Reads a little endian 16 bit value.
+ *
+ * \param[in] buffer The source.
+ *
+ * \return The value.
+ */
+static uint16_t
+read_u16(const byte_t* buffer)
+{
+  return (uint16_t)((uint16_t)buffer[0] | (uint16_t)((uint16_t)buffer[1] << 8U));
+}
+
+/**
+ * \brief Decodes a derivation path of the wire format.
+ *
+ * \param[in] data The encoded path.
+ *
+ * \return The derivation path.
+ */
+static cardano_derivation_path_t
+read_derivation_path(const byte_t* data)
+{
+  cardano_derivation_path_t path;
+
+  path.purpose   = read_u32(&data[0]);
+  path.coin_type = read_u32(&data[4]);
+  path.account   = read_u32(&data[8]);
+  path.role      = read_u32(&data[12]);
+  path.index     = read_u32(&data[16]);
+
+  return path;
+}
+
+/**
+ * \brief Finds the slot of a derivation path in the key table. Must be called with the mutex held.
+ *
+ * \param[in] signer The signer.
+ * \param[in] path The encoded derivation path.
+ *
+ * \return The slot holding the path, or the empty slot where it belongs.
+ */
+static signing_key_t*
+find_key_slot(const signer_t* signer, const byte_t* path)
+{
+  // FNV-1a over the encoded path
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (size_t i = 0U; i < CARDANO_SIGNING_SERVICE_PATH_SIZE; ++i)
+  {
+    hash ^= path[i];
+    hash *= 1099511628211ULL;
+  }
+
+  size_t slot = (size_t)hash & (KEY_TABLE_CAPACITY - 1U);
+
+  while ((signer->keys[slot].context != NULL) && (memcmp(signer->keys[slot].path, path, CARDANO_SIGNING_SERVICE_PATH_SIZE) != 0))
+  {
+    slot = (slot + 1U) & (KEY_TABLE_CAPACITY - 1U);
+  }
+
+  return &signer->keys[slot];
+}
+
+/**
+ * \brief Returns the signing key of a derivation path, deriving it on first use.
+ *
+ * \param[in] signer The signer.
+ * \param[in] path The encoded derivation path.
+ * \param[out] key On success, the signing key. It stays valid until shutdown.
+ *
+ * \return \ref CARDANO_SUCCESS on success, or the error of the key handler.
+ */
+static cardano_error_t
+get_signing_key(signer_t* signer, const byte_t* path, const signing_key_t** key)
+{
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  CARDANO_UNUSED(pthread_mutex_lock(&signer->mutex));
+
+  signing_key_t* slot = find_key_slot(signer, path);
+
+  if (slot->context == NULL)
+  {
+    cardano_ed25519_signing_context_t* context    = NULL;
+    cardano_ed25519_public_key_t*      public_key = NULL;
+
+    // Half the table at most, so probing stays short and always finds an empty slot
+    if (signer->key_count >= (KEY_TABLE_CAPACITY / 2U))
+    {
+      result = CARDANO_ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_secure_key_handler_bip32_get_signing_context(signer->handler, read_derivation_path(path), &context);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_ed25519_signing_context_get_public_key(context, &public_key);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      memcpy(slot->path, path, CARDANO_SIGNING_SERVICE_PATH_SIZE);
+      memcpy(slot->public_key, cardano_ed25519_public_key_get_data(public_key), PUBLIC_KEY_SIZE);
+      slot->context = context;
+      ++signer->key_count;
+    }
+    else
+    {
+      cardano_ed25519_signing_context_unref(&context);
+    }
+
+    cardano_ed25519_public_key_unref(&public_key);
+  }
+
+  CARDANO_UNUSED(pthread_mutex_unlock(&signer->mutex));
+
+  *key = slot;
+
+  return result;
+}
+
+/**
+ * \brief Serves a sign request.
+ *
+ * \param[in] signer The signer.
+ * \param[in] payload The request payload.
+ * \param[in] payload_size The size of the request payload.
+ * \param[out] response The buffer receiving the response payload, of at least `STATUS_SIZE` plus one response item per
+ *                      request item bytes.
+ * \param[out] response_size The size of the response payload.
+ *
+ * \return The status of the response.
+ */
+static cardano_error_t
+serve_sign(
+  signer_t*     signer,
+  const byte_t* payload,
+  const size_t  payload_size,
+  byte_t*       response,
+  size_t*       response_size)
+{
+  if (payload_size < 4U)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  const size_t count = read_u32(payload);
+
+  if ((count > CARDANO_SIGNING_SERVICE_MAX_BATCH_SIZE) || (payload_size != (4U + (count * CARDANO_SIGNING_SERVICE_SIGN_REQUEST_ITEM_SIZE))))
+  {
+    return CARDANO_ERROR_INVALID_ARGUMENT;
+  }
+
+  cardano_error_t result = CARDANO_SUCCESS;
+
+  for (size_t i = 0U; (result == CARDANO_SUCCESS) && (i < count); ++i)
+  {
+    const byte_t*        item = &payload[4U + (i * CARDANO_SIGNING_SERVICE_SIGN_REQUEST_ITEM_SIZE)];
+    byte_t*              out  = &response[STATUS_SIZE + (i * CARDANO_SIGNING_SERVICE_SIGN_RESPONSE_ITEM_SIZE)];
+    const signing_key_t* key  = NULL;
+
+    cardano_ed25519_signature_t* signature = NULL;
+
+    result = get_signing_key(signer, &item[HASH_SIZE], &key);
+
+    if (result == CARDANO_SUCCESS)
+    {
+      result = cardano_ed25519_signing_context_sign(key->context, item, HASH_SIZE, &signature);
+    }
+
+    if (result == CARDANO_SUCCESS)
+    {
+      memcpy(out, key->public_key, PUBLIC_KEY_SIZE);
+      memcpy(&out[PUBLIC_KEY_SIZE], cardano_ed25519_signature_get_data(signature), cardano_ed25519_signature_get_bytes_size(signature));
+    }
+
+    cardano_ed25519_signature_unref(&signature);
+  }
+
+  *response_size = STATUS_SIZE + (count * CARDANO_SIGNING_SERVICE_SIGN_RESPONSE_ITEM_SIZE);
+
+  return result;
+}
+
+/**
+ * \brief Serves an account public key request.
+ *
+ * \param[in] signer The signer.
+ * \param[in] payload The request payload.
+ * \param[in] payload_size The size of the request payload.
+ * \param[out] response The buffer receiving the response payload.
+ * \param[out] response_size The size of the response payload.
+ *
+ * \return The status of the response.
+ */
+static cardano_error_t
+serve_account_public_key(
+  signer_t*     signer,
+  const byte_t* payload,
+  const size_t  payload_size,
+  byte_t*       response,
+  size_t*       response_size)
+{
+  if (payload_size != CARDANO_SIGNING_SERVICE_PATH_SIZE)
+  {
+    return CARDANO_ERROR_DECODING;
+  }
+
+  const cardano_derivation_path_t         path         = read_derivation_path(payload);
+  const cardano_account_derivation_path_t account_path = { path.purpose, path.coin_type, path.account };
+
+  cardano_bip32_public_key_t* public_key = NULL;
+
+  CARDANO_UNUSED(pthread_mutex_lock(&signer->mutex));
+  cardano_error_t result = cardano_secure_key_handler_bip32_get_extended_account_public_key(signer->handler, account_path, &public_key);
+  CARDANO_UNUSED(pthread_mutex_unlock(&signer->mutex));
+
+  if (result == CARDANO_SUCCESS)
+  {
+    const size_t size = cardano_bip32_public_key_get_bytes_size(public_key);
+
+    memcpy(&response[STATUS_SIZE], cardano_bip32_public_key_get_data(public_key), size);
+    *response_size = STATUS_SIZE + size;
+  }
+
+  cardano_bip32_public_key_unref(&public_key);
+
+  return result;
+}
+
+/**
+ * \brief Writes a whole buffer to a connection.
+ *
+ * \param[in] fd The connection.
+ * \param[in] data The bytes to write.
+ * \param[in] size The number of bytes.
+ *
+ * \return `true` if every byte was written.
+ */
+static bool
+write_all(const int fd, const byte_t* data, size_t size)
+{
+  while (size > 0U)
+  {
+    const ssize_t written = send(fd, data, size, MSG_NOSIGNAL);
+
+    if ((written < 0) && (errno == EINTR))
+    {
+      continue;
+    }
+
+    if (written <= 0)
+    {
+      return false;
+    }
+
+    data = &data[written];
+    size -= (size_t)written;
+  }
+
+  return true;
+}
+
+/**
+ * \brief Reads exactly `size` bytes from a connection.
+ *
+ * \param[in] fd The connection.
+ * \param[out] data The buffer receiving the bytes.
+ * \param[in] size The number of bytes.
+ *
+ * \return `true` if every byte was read, `false` on error or end of stream.
+ */
+static bool
+read_all(const int fd, byte_t* data, size_t size)
+{
+  while (size > 0U)
+  {
+    const ssize_t received = recv(fd, data, size, 0);
+
+    if ((received < 0) && (errno == EINTR))
+    {
+      continue;
+    }
+
+    if (received <= 0)
+    {
+      return false;
+    }
+
+    data = &data[received];
+    size -= (size_t)received;
+  }
+
+  return true;
+}
+
+/**
+ * \brief Serves the requests of a connection until it closes or sends an invalid frame.
+ *
+ * \param[in] signer The signer.
+ * \param[in] fd The connection.
+ */
+static void
+serve_connection(signer_t* signer, const int fd)
+{
+  const size_t max_response_size = CARDANO_SIGNING_SERVICE_HEADER_SIZE + STATUS_SIZE + ((size_t)CARDANO_SIGNING_SERVICE_MAX_BATCH_SIZE * CARDANO_SIGNING_SERVICE_SIGN_RESPONSE_ITEM_SIZE);
+
+  byte_t* request  = (byte_t*)malloc(MAX_REQUEST_SIZE);
+  byte_t* response = (byte_t*)malloc(max_response_size);
+  byte_t  header[CARDANO_SIGNING_SERVICE_HEADER_SIZE];
+
+  while ((request != NULL) && (response != NULL) && read_all(fd, header, sizeof(header)))
+  {
+    const uint32_t magic        = read_u32(&header[0]);
+    const uint16_t version      = read_u16(&header[4]);
+    const uint16_t operation    = read_u16(&header[6]);
+    const uint32_t payload_size = read_u32(&header[8]);
+
+    if ((magic != CARDANO_SIGNING_SERVICE_MAGIC) || (version != CARDANO_SIGNING_SERVICE_VERSION) || (payload_size > MAX_REQUEST_SIZE))
+    {
+      break;
+    }
+
+    if (!read_all(fd, request, payload_size))
+    {
+      break;
+    }
+
+    size_t          response_size = STATUS_SIZE;
+    cardano_error_t result        = CARDANO_ERROR_NOT_IMPLEMENTED;
+
+    switch (operation)
+    {
+      case CARDANO_SIGNING_SERVICE_OP_SIGN:
+        result = serve_sign(signer, request, payload_size, &response[CARDANO_SIGNING_SERVICE_HEADER_SIZE], &response_size);
+        break;
+      case CARDANO_SIGNING_SERVICE_OP_GET_ACCOUNT_PUBLIC_KEY:
+        result = serve_account_public_key(signer, request, payload_size, &response[CARDANO_SIGNING_SERVICE_HEADER_SIZE], &response_size);
+        break;
+      default:
+        break;
+    }
+
+    if (result != CARDANO_SUCCESS)
+    {
+      log_message("request %u failed: %s", (unsigned)operation, cardano_error_to_string(result));
+      response_size = STATUS_SIZE;
+    }
+
+    memcpy(response, header, 8U);
+    write_u32(&response[8], (uint32_t)response_size);
+    write_u32(&response[CARDANO_SIGNING_SERVICE_HEADER_SIZE], (uint32_t)result);
+
+    if (!write_all(fd, response, CARDANO_SIGNING_SERVICE_HEADER_SIZE + response_size))
+    {
+      break;
+    }
+  }
+
+  if (request != NULL)
+  {
+    wipe(request, MAX_REQUEST_SIZE);
+  }
+
+  free(request);
+  free(response);
+}
+
+/**
+ * \brief Thread entry point serving a connection.
+ *
+ * \param[in] argument The \ref connection_t of the connection, released by this function.
+ *
+ * \return NULL.
+ */
+static void*
+connection_thread(void* argument)
+{
+  connection_t* connection = (connection_t*)argument;
+  signer_t*     signer     = connection->signer;
+  const int     fd         = connection->fd;
+
+  free(connection);
+
+  serve_connection(signer, fd);
+
+  CARDANO_UNUSED(pthread_mutex_lock(&signer->mutex));
+
+  for (size_t i = 0U; i < signer->max_connections; ++i)
+  {
+    if (signer->connections[i] == fd)
+    {
+      signer->connections[i] = -1;
+      break;
+    }
+  }
+
+  CARDANO_UNUSED(close(fd));
+  --signer->connection_count;
+
+  if (signer->connection_count == 0U)
+  {
+    CARDANO_UNUSED(pthread_cond_signal(&signer->idle));
+  }
+
+  CARDANO_UNUSED(pthread_mutex_unlock(&signer->mutex));
+
+  return NULL;
+}
+
+/**
+ * \brief Checks that the peer of a connection runs as an allowed user.
+ *
+ * \param[in] signer The signer.
+ * \param[in] fd The connection.
+ *
+ * \return `true` if the peer may use the signer.
+ */
+static bool
+is_peer_allowed(const signer_t* signer, const int fd)
+{
+  struct ucred credentials;
+  socklen_t    size = sizeof(credentials);
+
+  if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &size) != 0)
+  {
+    return false;
+  }
+
+  for (size_t i = 0U; i < signer->allowed_uid_count; ++i)
+  {
+    if (signer->allowed_uids[i] == credentials.uid)
+    {
+      return true;
+    }
+  }
+
+  log_message("refused a connection from uid %u", (unsigned)credentials.uid);
+
+  return false;
+}
+
+/**
+ * \brief Hands a new connection to its own thread.
+ *
+ * \param[in] signer The signer.
+ * \param[in] fd The connection.
+ */
+static void
+accept_connection(signer_t* signer, const int fd)
+{
+  if (!is_peer_allowed(signer, fd))
+  {
+    CARDANO_UNUSED(close(fd));
+
+    return;
+  }
+
+  connection_t* connection = (connection_t*)malloc(sizeof(connection_t));
+  bool          started    = false;
+
+  CARDANO_UNUSED(pthread_mutex_lock(&signer->mutex));
+
+  for (size_t i = 0U; (connection != NULL) && (i < signer->max_connections); ++i)
+  {
+    if (signer->connections[i] < 0)
+    {
+      pthread_t thread;
+
+      connection->signer = signer;
+      connection->fd     = fd;
+
+      if (pthread_create(&thread, NULL, connection_thread, connection) == 0)
+      {
+        CARDANO_UNUSED(pthread_detach(thread));
+        signer->connections[i] = fd;
+        ++signer->connection_count;
+        started = true;
+      }
+
+      break;
+    }
+  }
+
+  CARDANO_UNUSED(pthread_mutex_unlock(&signer->mutex));
+
+  if (!started)
+  {
+    log_message("refused a connection: too many connections");
+    free(connection);
+    CARDANO_UNUSED(close(fd));
+  }
+}
+
+/**
+ * \brief Signal handler requesting a clean shutdown.
+ *
+ * \param[in] signal_number Unused.
+ */
+static void
+request_stop(const int signal_number)
+{
+  CARDANO_UNUSED(signal_number);
+
+  const byte_t byte = 0U;
+
+  CARDANO_UNUSED(write(s_stop_pipe[1], &byte, 1U));
+}
+
+/**
+ * \brief Disables core dumps and debugger attachment, and locks the process memory where the limits allow it.
+ */
+static void
+harden_process(void)
+{
+  const struct rlimit no_core = { 0, 0 };
+
+  CARDANO_UNUSED(setrlimit(RLIMIT_CORE, &no_core));
+  CARDANO_UNUSED(prctl(PR_SET_DUMPABLE, 0, 0, 0, 0));
+
+  if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+  {
+    log_message("could not lock the process memory (%s); key material is still kept in locked pages", strerror(errno));
+  }
+}
+
+/**
+ * \brief Binds and listens on the socket, replacing a stale socket left by a previous run.
+ *
+ * \param[in] path The socket path.
+ *
+ * \return The listening socket, or -1 on failure.
+ */
+static int
+listen_on(const char* path)
+{
+  struct sockaddr_un address;
+  struct stat        status;
+
+  if (strlen(path) >= sizeof(address.sun_path))
+  {
+    log_message("socket path too long: %s", path);
+
+    return -1;
+  }
+
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  memcpy(address.sun_path, path, strlen(path));
+
+  if ((lstat(path, &status) == 0) && S_ISSOCK(status.st_mode))
+  {
+    CARDANO_UNUSED(unlink(path));
+  }
+
+  const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+  if (fd < 0)
+  {
+    return -1;
+  }
+
+  const mode_t previous_mask = umask(0177);
+  const int    bound         = bind(fd, (const struct sockaddr*)((const void*)&address), sizeof(address));
+
+  CARDANO_UNUSED(umask(previous_mask));
+
+  if ((bound != 0) || (listen(fd, SOMAXCONN) != 0))
+  {
+    log_message("could not listen on %s: %s", path, strerror(errno));
+    CARDANO_UNUSED(close(fd));
+
+    return -1;
+  }
+
+  return fd;
+}
+
+/**
+ * \brief Loads the key handler and opens a session that keeps its keys unlocked until shutdown.
+ *
+ * \param[in] key_file The path of the serialized key handler.
+ * \param[in] passphrase_file The path of the passphrase file, or NULL to read it from the environment.
+ *
+ * \return The key handler, or NULL on failure.
+ */
+static cardano_secure_key_handler_t*
+load_key_handler(const char* key_file, const char* passphrase_file)
+{
+  size_t  size       = 0U;
+  byte_t* serialized = read_file(key_file, &size);
+
+  if (serialized == NULL)
+  {
+    log_message("could not read %s", key_file);
+
+    return NULL;
+  }
+
+  if (!load_passphrase(passphrase_file))
+  {
+    log_message("no passphrase; use --passphrase-file or CARDANO_SIGNER_PASSPHRASE");
+    free(serialized);
+    forget_passphrase();
+
+    return NULL;
+  }
+
+  cardano_secure_key_handler_t* handler = NULL;
+
+  cardano_error_t result = cardano_software_secure_key_handler_deserialize(serialized, size, get_passphrase, &handler);
+
+  free(serialized);
+
+  if (result == CARDANO_SUCCESS)
+  {
+    result = cardano_secure_key_handler_unlock(handler, 0U, 0U);
+  }
+
+  // The session never expires, so the passphrase is not needed anymore
+  forget_passphrase();
+
+  if (result != CARDANO_SUCCESS)
+  {
+    log_message("could not unlock %s: %s", key_file, cardano_error_to_string(result));
+    cardano_secure_key_handler_unref(&handler);
+
+    return NULL;
+  }
+
+  return handler;
+}
+
+/**
+ * \brief Prints the usage of the program.
+ */
+static void
+print_usage(void)
+{
+  fputs(
+    "usage: cardano-signer --key-file <path> --socket <path> [--passphrase-file <path>]\n"
+    "                      [--allow-uid <uid>]... [--max-connections <count>]\n",
+    stderr);
+}
+
+/* DEFINITIONS ***************************************************************/
+
+int
+main(const int argc, char** argv)
+{
+  const char* key_file        = NULL;
+  const char* passphrase_file = NULL;
+  const char* socket_path     = NULL;
+
+  signer_t signer;
+
+  memset(&signer, 0, sizeof(signer));
+  signer.max_connections   = DEFAULT_MAX_CONNECTIONS;
+  signer.allowed_uids[0]   = getuid();
+  signer.allowed_uid_count = 1U;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const bool has_value = (i + 1) < argc;
+
+    if ((strcmp(argv[i], "--key-file") == 0) && has_value)
+    {
+      key_file = argv[++i];
+    }
+    else if ((strcmp(argv[i], "--passphrase-file") == 0) && has_value)
+    {
+      passphrase_file = argv[++i];
+    }
+    else if ((strcmp(argv[i], "--socket") == 0) && has_value)
+    {
+      socket_path = argv[++i];
+    }
+    else if ((strcmp(argv[i], "--allow-uid") == 0) && has_value && (signer.allowed_uid_count < MAX_ALLOWED_UIDS))
+    {
+      signer.allowed_uids[signer.allowed_uid_count++] = (uid_t)strtoul(argv[++i], NULL, 10);
+    }
+    else if ((strcmp(argv[i], "--max-connections") == 0) && has_value)
+    {
+      signer.max_connections = (size_t)strtoul(argv[++i], NULL, 10);
+    }
+    else
+    {
+      print_usage();
+
+      return EXIT_FAILURE;
+    }
+  }
+
+  if ((key_file == NULL) || (socket_path == NULL) || (signer.max_connections == 0U))
+  {
+    print_usage();
+
+    return EXIT_FAILURE;
+  }
+
+  harden_process();
+
+  signer.keys        = (signing_key_t*)calloc(KEY_TABLE_CAPACITY, sizeof(signing_key_t));
+  signer.connections = (int*)malloc(signer.max_connections * sizeof(int));
+
+  if ((signer.keys == NULL) || (signer.connections == NULL) || (pipe2(s_stop_pipe, O_CLOEXEC) != 0))
+  {
+    log_message("out of memory");
+
+    return EXIT_FAILURE;
+  }
+
+  for (size_t i = 0U; i < signer.max_connections; ++i)
+  {
+    signer.connections[i] = -1;
+  }
+
+  signer.handler = load_key_handler(key_file, passphrase_file);
+
+  if (signer.handler == NULL)
+  {
+    return EXIT_FAILURE;
+  }
+
+  const int listener = listen_on(socket_path);
+
+  if (listener < 0)
+  {
+    cardano_secure_key_handler_unref(&signer.handler);
+
+    return EXIT_FAILURE;
+  }
+
+  CARDANO_UNUSED(pthread_mutex_init(&signer.mutex, NULL));
+  CARDANO_UNUSED(pthread_cond_init(&signer.idle, NULL));
+
+  struct sigaction action;
+
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = request_stop;
+  CARDANO_UNUSED(sigaction(SIGINT, &action, NULL));
+  CARDANO_UNUSED(sigaction(SIGTERM, &action, NULL));
+  CARDANO_UNUSED(signal(SIGPIPE, SIG_IGN));
+
+  log_message("listening on %s", socket_path);
+
+  struct pollfd descriptors[2] = { { listener, POLLIN, 0 }, { s_stop_pipe[0], POLLIN, 0 } };
+
+  for (;;)
+  {
+    if (poll(descriptors, 2U, -1) < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+
+      break;
+    }
+
+    if ((descriptors[1].revents & POLLIN) != 0)
+    {
+      break;
+    }
+
+    if ((descriptors[0].revents & POLLIN) != 0)
+    {
+      const int fd = accept4(listener, NULL, NULL, SOCK_CLOEXEC);
+
+      if (fd >= 0)
+      {
+        accept_connection(&signer, fd);
+      }
+    }
+  }
+
+  log_message("shutting down");
+
+  CARDANO_UNUSED(close(listener));
+  CARDANO_UNUSED(unlink(socket_path));
+
+  // Wake up every connection thread and wait for them to release the keys
+  CARDANO_UNUSED(pthread_mutex_lock(&signer.mutex));
+
+  for (size_t i = 0U; i < signer.max_connections; ++i)
+  {
+    if (signer.connections[i] >= 0)
+    {
+      CARDANO_UNUSED(shutdown(signer.connections[i], SHUT_RDWR));
+    }
+  }
+
+  while (signer.connection_count > 0U)
+  {
+    CARDANO_UNUSED(pthread_cond_wait(&signer.idle, &signer.mutex));
+  }
+
+  CARDANO_UNUSED(pthread_mutex_unlock(&signer.mutex));
+
+  for (size_t i = 0U; i < KEY_TABLE_CAPACITY; ++i)
+  {
+    cardano_ed25519_signing_context_unref(&signer.keys[i].context);
+  }
+
+  CARDANO_UNUSED(cardano_secure_key_handler_lock(signer.handler));
+  cardano_secure_key_handler_unref(&signer.handler);
+
+  free(signer.keys);
+  free(signer.connections);
+
+  return EXIT_SUCCESS;
+}